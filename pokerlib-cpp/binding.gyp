@@ -10,9 +10,12 @@
         "src/Evaluator.cpp",
         "src/HandDescription.cpp",
         "omp/HandEvaluator.cpp",
+        "omp/OmahaEvaluator.cpp",
         "omp/EquityCalculator.cpp",
         "omp/CombinedRange.cpp",
         "omp/CardRange.cpp",
+        "omp/ThreadPool.cpp",
+        "omp/BoardContext.cpp",
         "binding/pokerlib_binding.cpp"
       ],
       "include_dirs": [
@@ -47,14 +47,11 @@ Napi::Array CardsToJsArray(Napi::Env env, const std::vector<pokerlib::Card>& car
 
 // HandDescription to JavaScript object
 Napi::Object HandDescriptionToJsObject(Napi::Env env, const pokerlib::HandDescription& desc) {
-    // Create a non-const copy that we can call to_string on
-    pokerlib::HandDescription descCopy = desc;
-    
     auto obj = Napi::Object::New(env);
     obj.Set("category", static_cast<int>(desc.GetCategory()));
     
     // Convert HandCategory enum to string
-    std::string categoryName;
+    const char* categoryName;
     switch (desc.GetCategory()) {
         case pokerlib::HandCategory::HighCard: categoryName = "High Card"; break;
         case pokerlib::HandCategory::Pair: categoryName = "Pair"; break;
@@ -69,7 +66,7 @@ Napi::Object HandDescriptionToJsObject(Napi::Env env, const pokerlib::HandDescri
     }
     
     obj.Set("categoryName", Napi::String::New(env, categoryName));
-    obj.Set("description", Napi::String::New(env, descCopy.to_string()));
+    obj.Set("description", Napi::String::New(env, desc.to_string()));
     return obj;
 }
 
@@ -0,0 +1,464 @@
+#include "omp/HandEvaluator.h"
+#include "omp/OmahaEvaluator.h"
+#include "omp/EquityCalculator.h"
+#include "omp/Random.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cmath>
+
+typedef std::chrono::high_resolution_clock Clock;
+
+double secondsSince(Clock::time_point start)
+{
+	return 1e-9 * std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+// Creates random 7-card hands.
+std::vector<omp::Hand> randomHands(size_t count)
+{
+	omp::XoroShiro128Plus rng(12345);
+	omp::FastUniformIntDistribution<unsigned, 16> cardDist(0, omp::CARD_COUNT - 1);
+	std::vector<omp::Hand> hands(count);
+	for (auto& hand : hands) {
+		uint64_t usedCards = 0;
+		hand = omp::Hand::empty();
+		for (unsigned i = 0; i < 7; ++i) {
+			unsigned card;
+			do {
+				card = cardDist(rng);
+			} while (usedCards & (1ull << card));
+			usedCards |= 1ull << card;
+			hand += card;
+		}
+	}
+	return hands;
+}
+
+// Compares the startup cost of the constant lookup tables against generating them at runtime, which is what every
+// process used to do when the first HandEvaluator was constructed. Needs to run before anything else touches the
+// evaluator.
+void benchmarkStartup()
+{
+	const unsigned ROUNDS = 20;
+
+	auto t = Clock::now();
+	omp::HandEvaluator eval;
+	volatile uint16_t rank = eval.evaluate(omp::Hand::empty() + 51 + 47 + 43 + 39 + 35);
+	double firstEvalTime = secondsSince(t);
+	(void)rank;
+
+	std::vector<uint16_t> lookup(omp::HandEvaluator::LOOKUP_SIZE), flushLookup(omp::HandEvaluator::FLUSH_LOOKUP_SIZE);
+	t = Clock::now();
+	for (unsigned r = 0; r < ROUNDS; ++r)
+		omp::HandEvaluator::generateLookupTables(lookup.data(), flushLookup.data());
+	double generateTime = secondsSince(t) / ROUNDS;
+
+	std::cout << "Startup" << std::endl;
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "  constant tables, first evaluation: " << 1e3 * firstEvalTime << " ms" << std::endl;
+	std::cout << "  runtime table generation:          " << 1e3 * generateTime << " ms" << std::endl;
+}
+
+// Compares scalar evaluation of one hand at a time against HandEvaluator::evaluateBatch().
+void benchmarkBatchEvaluation()
+{
+	const size_t HAND_COUNT = 1 << 20;
+	const unsigned ROUNDS = 20;
+
+	omp::HandEvaluator eval;
+	std::vector<omp::Hand> hands = randomHands(HAND_COUNT);
+	std::vector<uint16_t> scalarRanks(HAND_COUNT), batchRanks(HAND_COUNT);
+
+	auto t = Clock::now();
+	for (unsigned r = 0; r < ROUNDS; ++r) {
+		for (size_t i = 0; i < HAND_COUNT; ++i)
+			scalarRanks[i] = eval.evaluate(hands[i]);
+	}
+	double scalarTime = secondsSince(t);
+
+	t = Clock::now();
+	for (unsigned r = 0; r < ROUNDS; ++r)
+		eval.evaluateBatch(hands.data(), HAND_COUNT, batchRanks.data());
+	double batchTime = secondsSince(t);
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < HAND_COUNT; ++i)
+		mismatches += scalarRanks[i] != batchRanks[i];
+
+	double evals = (double)HAND_COUNT * ROUNDS;
+	std::cout << "Batch evaluation (" << HAND_COUNT << " random 7-card hands x " << ROUNDS << ")" << std::endl;
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "  scalar: " << 1e-6 * evals / scalarTime << " M/s" << std::endl;
+	std::cout << "  batch:  " << 1e-6 * evals / batchTime << " M/s" << std::endl;
+	std::cout << "  mismatches: " << mismatches << std::endl;
+}
+
+// Compares the non-flush river loop of EquityCalculator::enumerateBoardRec(), which evaluates each river rank one
+// player at a time, against the SIMD variant that was tried there: the river ranks of each player are evaluated 8 at
+// a time with the AVX2 gathers of HandEvaluator::evaluateBatch() and the winners are picked from the ranks. Both use
+// the same rank multipliers.
+void benchmarkRiverLoop()
+{
+	const unsigned DEAL_COUNT = 100000;
+	const unsigned MAX_DEAL_PLAYERS = 6;
+
+	struct Deal
+	{
+		omp::Hand turnHands[MAX_DEAL_PLAYERS];
+		unsigned rivers[omp::RANK_COUNT], multipliers[omp::RANK_COUNT];
+		unsigned riverCount;
+	};
+
+	omp::HandEvaluator eval;
+	omp::XoroShiro128Plus rng(54321);
+	omp::FastUniformIntDistribution<unsigned, 16> cardDist(0, omp::CARD_COUNT - 1);
+
+	std::cout << "River loop (" << DEAL_COUNT << " turns without flush draws)" << std::endl;
+	std::cout << std::fixed << std::setprecision(1);
+	for (unsigned players : { 2u, 3u, 4u, 6u }) {
+		// Deal hole cards and a turn board. Like in enumerateBoardRec(), a suit can't make a flush on the river if the
+		// board and any one player have less than 4 cards of it.
+		std::vector<Deal> deals;
+		while (deals.size() < DEAL_COUNT) {
+			uint64_t usedCards = 0;
+			unsigned cards[2 * MAX_DEAL_PLAYERS + 4];
+			for (unsigned i = 0; i < 2 * players + 4; ++i) {
+				do {
+					cards[i] = cardDist(rng);
+				} while (usedCards & (1ull << cards[i]));
+				usedCards |= 1ull << cards[i];
+			}
+
+			const unsigned* boardCards = cards + 2 * players;
+			unsigned suitCounts[omp::SUIT_COUNT] = {};
+			for (unsigned i = 0; i < players; ++i) {
+				for (unsigned suit = 0; suit < omp::SUIT_COUNT; ++suit) {
+					unsigned count = ((cards[2 * i] & 3) == suit) + ((cards[2 * i + 1] & 3) == suit);
+					suitCounts[suit] = std::max(suitCounts[suit], count);
+				}
+			}
+			for (unsigned i = 0; i < 4; ++i)
+				++suitCounts[boardCards[i] & 3];
+			if (*std::max_element(suitCounts, suitCounts + omp::SUIT_COUNT) >= 4)
+				continue;
+
+			Deal deal;
+			omp::Hand board = omp::Hand::empty();
+			for (unsigned i = 0; i < 4; ++i)
+				board += boardCards[i];
+			for (unsigned i = 0; i < players; ++i)
+				deal.turnHands[i] = board + omp::Hand(cards[2 * i]) + omp::Hand(cards[2 * i + 1]);
+			deal.riverCount = 0;
+			for (unsigned rank = 0; rank < omp::RANK_COUNT; ++rank) {
+				unsigned multiplier = 0;
+				for (unsigned card = 4 * rank; card < 4 * rank + 4; ++card) {
+					if (!(usedCards & (1ull << card))) {
+						if (!multiplier)
+							deal.rivers[deal.riverCount] = card;
+						++multiplier;
+					}
+				}
+				if (multiplier)
+					deal.multipliers[deal.riverCount++] = multiplier;
+			}
+			deals.push_back(deal);
+		}
+
+		uint64_t evals = 0;
+		std::vector<uint64_t> scalarWins(1u << players), simdWins(1u << players);
+		auto t = Clock::now();
+		for (const Deal& deal : deals) {
+			for (unsigned r = 0; r < deal.riverCount; ++r) {
+				omp::Hand river(deal.rivers[r]);
+				uint16_t bestRank = 0;
+				unsigned winnersMask = 0;
+				for (unsigned i = 0; i < players; ++i) {
+					uint16_t rank = eval.evaluate(deal.turnHands[i] + river);
+					if (rank > bestRank) {
+						bestRank = rank;
+						winnersMask = 0;
+					}
+					if (rank == bestRank)
+						winnersMask |= 1u << i;
+				}
+				scalarWins[winnersMask] += deal.multipliers[r];
+			}
+			evals += deal.riverCount * players;
+		}
+		double scalarTime = secondsSince(t);
+
+		// The river hands are padded to 16 with copies of the last river so that evaluateBatch() only uses gathers.
+		t = Clock::now();
+		for (const Deal& deal : deals) {
+			omp::Hand riverHands[16];
+			uint16_t ranks[MAX_DEAL_PLAYERS][16];
+			for (unsigned i = 0; i < players; ++i) {
+				for (unsigned r = 0; r < 16; ++r)
+					riverHands[r] = deal.turnHands[i] + omp::Hand(deal.rivers[std::min(r, deal.riverCount - 1)]);
+				eval.evaluateBatch(riverHands, 16, ranks[i]);
+			}
+			for (unsigned r = 0; r < deal.riverCount; ++r) {
+				uint16_t bestRank = 0;
+				for (unsigned i = 0; i < players; ++i)
+					bestRank = std::max(bestRank, ranks[i][r]);
+				unsigned winnersMask = 0;
+				for (unsigned i = 0; i < players; ++i)
+					winnersMask |= (unsigned)(ranks[i][r] == bestRank) << i;
+				simdWins[winnersMask] += deal.multipliers[r];
+			}
+		}
+		double simdTime = secondsSince(t);
+
+		std::cout << "  " << players << " players: scalar " << std::setw(6) << 1e-6 * evals / scalarTime
+			<< " M/s  gathers " << std::setw(6) << 1e-6 * evals / simdTime << " M/s  mismatches "
+			<< (scalarWins != simdWins) << std::endl;
+	}
+}
+
+// Measures one evaluator layout alone and interleaved with other cache-hungry work, which reads the next 64 KB of a
+// big buffer after every CHUNK hands. The best of a few runs is used because the interleaved
+// timing is noisy.
+template<class tLayout>
+void benchmarkLayout(const char* name, const std::vector<omp::Hand>& hands, const std::vector<uint64_t>& pollution)
+{
+	const unsigned RUNS = 3, ROUNDS = 5;
+	const size_t CHUNK = 1024, POLLUTION_STRIDE = 8, POLLUTION_LINES = 1024;
+
+	omp::HandEvaluatorT<tLayout> eval;
+	uint64_t sum = 0;
+	size_t p = 0;
+
+	double plainTime = 1e9, pressureTime = 1e9;
+	for (unsigned run = 0; run < RUNS; ++run) {
+		auto t = Clock::now();
+		for (unsigned r = 0; r < ROUNDS; ++r) {
+			for (const omp::Hand& hand : hands)
+				sum += eval.evaluate(hand);
+		}
+		plainTime = std::min(plainTime, secondsSince(t));
+
+		t = Clock::now();
+		for (unsigned r = 0; r < ROUNDS; ++r) {
+			for (size_t i = 0; i < hands.size(); i += CHUNK) {
+				for (size_t j = i; j < std::min(i + CHUNK, hands.size()); ++j)
+					sum += eval.evaluate(hands[j]);
+				for (size_t j = 0; j < POLLUTION_LINES; ++j, p = (p + POLLUTION_STRIDE) & (pollution.size() - 1))
+					sum += pollution[p];
+			}
+		}
+		pressureTime = std::min(pressureTime, secondsSince(t));
+	}
+
+	double evals = (double)hands.size() * ROUNDS;
+	size_t tableBytes = sizeof(tLayout::LOOKUP) + sizeof(tLayout::PERF_HASH_ROW_OFFSETS);
+	std::cout << "  " << std::left << std::setw(6) << name << std::right << std::setw(4) << tableBytes / 1024 << " KB"
+		<< std::setw(8) << 1e-6 * evals / plainTime << " M/s" << std::setw(8) << 1e-6 * evals / pressureTime
+		<< " M/s interleaved" << (sum == 0 ? " " : "") << std::endl;
+}
+
+// Compares the lookup table layouts on 7-card hands.
+void benchmarkLayouts()
+{
+	std::vector<omp::Hand> hands = randomHands(1 << 20);
+	std::vector<uint64_t> pollution(4 << 20); // 32 MB, size must be a power of 2
+	for (size_t i = 0; i < pollution.size(); ++i)
+		pollution[i] = i;
+
+	std::cout << "Lookup table layouts (random 7-card hands, interleaved with a 64 KB scan every 1024 hands)" << std::endl;
+	std::cout << std::fixed << std::setprecision(1);
+	benchmarkLayout<omp::FullLookupLayout>("0-7", hands, pollution);
+	benchmarkLayout<omp::FiveCardLookupLayout>("5-7", hands, pollution);
+	benchmarkLayout<omp::SevenCardLookupLayout>("7", hands, pollution);
+}
+
+// Evaluates an Omaha hand by going through every combination of two hole cards and three board cards.
+uint16_t evaluateOmahaBruteForce(const omp::HandEvaluator& eval, const uint8_t* holeCards, unsigned holeCardCount,
+	const uint8_t* boardCards)
+{
+	uint16_t best = 0;
+	for (unsigned i = 0; i < 5; ++i)
+		for (unsigned j = i + 1; j < 5; ++j)
+			for (unsigned k = j + 1; k < 5; ++k) {
+				omp::Hand board = omp::Hand::empty() + boardCards[i] + boardCards[j] + boardCards[k];
+				for (unsigned a = 0; a < holeCardCount; ++a)
+					for (unsigned b = a + 1; b < holeCardCount; ++b)
+						best = std::max(best, eval.evaluate(board + holeCards[a] + holeCards[b]));
+			}
+	return best;
+}
+
+// Compares OmahaEvaluator against evaluating every 5 card hand on random PLO4 and PLO5 deals.
+void benchmarkOmaha()
+{
+	const unsigned DEAL_COUNT = 1 << 20;
+
+	omp::HandEvaluator eval;
+	omp::OmahaEvaluator omahaEval;
+	omp::XoroShiro128Plus rng(12345);
+	omp::FastUniformIntDistribution<unsigned, 16> cardDist(0, omp::CARD_COUNT - 1);
+
+	std::cout << "Omaha evaluation (" << DEAL_COUNT << " random deals)" << std::endl;
+	for (unsigned holeCardCount = 4; holeCardCount <= 5; ++holeCardCount) {
+		// Board cards followed by hole cards.
+		std::vector<uint8_t> deals(DEAL_COUNT * (5 + holeCardCount));
+		for (size_t i = 0; i < deals.size(); i += 5 + holeCardCount) {
+			uint64_t usedCards = 0;
+			for (unsigned j = 0; j < 5 + holeCardCount; ++j) {
+				unsigned card;
+				do {
+					card = cardDist(rng);
+				} while (usedCards & (1ull << card));
+				usedCards |= 1ull << card;
+				deals[i + j] = (uint8_t)card;
+			}
+		}
+
+		std::vector<uint16_t> bruteForceRanks(DEAL_COUNT), omahaRanks(DEAL_COUNT);
+		auto t = Clock::now();
+		for (size_t i = 0; i < DEAL_COUNT; ++i) {
+			const uint8_t* deal = &deals[i * (5 + holeCardCount)];
+			bruteForceRanks[i] = evaluateOmahaBruteForce(eval, deal + 5, holeCardCount, deal);
+		}
+		double bruteForceTime = secondsSince(t);
+
+		t = Clock::now();
+		for (size_t i = 0; i < DEAL_COUNT; ++i) {
+			const uint8_t* deal = &deals[i * (5 + holeCardCount)];
+			omahaRanks[i] = omahaEval.evaluate(deal + 5, holeCardCount, deal);
+		}
+		double omahaTime = secondsSince(t);
+
+		size_t mismatches = 0;
+		for (size_t i = 0; i < DEAL_COUNT; ++i)
+			mismatches += bruteForceRanks[i] != omahaRanks[i];
+
+		std::cout << std::fixed << std::setprecision(1);
+		std::cout << "  PLO" << holeCardCount << " brute force: " << 1e-6 * DEAL_COUNT / bruteForceTime << " M/s"
+			<< "  OmahaEvaluator: " << 1e-6 * DEAL_COUNT / omahaTime << " M/s"
+			<< "  mismatches: " << mismatches << std::endl;
+	}
+}
+
+// Compares exact enumeration of the same 3-way all-in with a normal deck and a short deck.
+void benchmarkShortDeck()
+{
+	std::vector<omp::CardRange> ranges{ omp::CardRange("AsKs"), omp::CardRange("QhQd"), omp::CardRange("JcTc") };
+
+	std::cout << "Short deck enumeration (AsKs vs QhQd vs JcTc)" << std::endl;
+	std::cout << std::fixed << std::setprecision(3);
+	for (bool shortDeck : { false, true }) {
+		omp::EquityCalculator eq;
+		eq.setShortDeck(shortDeck);
+		auto t = Clock::now();
+		eq.start(ranges, 0, 0, true, 0, nullptr, 0.2, 1);
+		eq.wait();
+		double time = secondsSince(t);
+		auto results = eq.getResults();
+		std::cout << "  " << (shortDeck ? "36 cards: " : "52 cards: ") << results.hands << " boards  "
+			<< 1e3 * time << " ms  equities";
+		for (unsigned i = 0; i < results.players; ++i)
+			std::cout << " " << results.equity[i];
+		std::cout << std::endl;
+	}
+}
+
+// Compares EquityCalculator::calculateBatch() against a separate start() for each query. The same preflops come up
+// on different flops, so results cached for one board must not be reused for another.
+void benchmarkEquityBatch()
+{
+	const char* preflops[][3] = { { "AK", "QQ", "JJ" }, { "AKs", "QQ", nullptr }, { "AK,AQ", "JJ,TT", nullptr } };
+	const char* flops[] = { "2c7d9h", "Kc7d9h", "Qs8s3d", "Ah5c5d", "TdJdQd" };
+
+	std::vector<omp::EquityCalculator::Query> queries;
+	for (const char* flop : flops) {
+		for (auto& preflop : preflops) {
+			omp::EquityCalculator::Query query;
+			for (const char* range : preflop) {
+				if (range)
+					query.handRanges.emplace_back(range);
+			}
+			query.boardCards = omp::CardRange::getCardMask(flop);
+			query.enumerateAll = true;
+			queries.push_back(query);
+		}
+	}
+
+	std::vector<omp::EquityCalculator::Results> expected(queries.size()), results(queries.size());
+	auto t = Clock::now();
+	for (size_t i = 0; i < queries.size(); ++i) {
+		omp::EquityCalculator eq;
+		eq.start(queries[i].handRanges, queries[i].boardCards, 0, true);
+		eq.wait();
+		expected[i] = eq.getResults();
+	}
+	double separateTime = secondsSince(t);
+
+	omp::EquityCalculator eq;
+	t = Clock::now();
+	eq.calculateBatch(queries.data(), queries.size(), results.data());
+	double batchTime = secondsSince(t);
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < queries.size(); ++i) {
+		bool mismatch = results[i].hands != expected[i].hands;
+		for (unsigned j = 0; j < expected[i].players; ++j)
+			mismatch |= std::abs(results[i].equity[j] - expected[i].equity[j]) > 1e-9;
+		mismatches += mismatch;
+	}
+
+	std::cout << "Equity batch (" << queries.size() << " flop enumerations)" << std::endl;
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "  separate: " << 1e3 * separateTime << " ms" << std::endl;
+	std::cout << "  batch:    " << 1e3 * batchTime << " ms" << std::endl;
+	std::cout << "  mismatches: " << mismatches << std::endl;
+}
+
+// Measures hands/s with different numbers of threads, for monte carlo (results are updated every 4096 hands) and an
+// exact 3-way enumeration of ranges on the turn (results are updated after every preflop combo, multiway spots don't
+// use sweepShowdowns()). Shows how well the calculations scale when many threads update the results at the same time.
+void benchmarkThreadScaling()
+{
+	std::vector<omp::CardRange> ranges{ omp::CardRange("66+,A8s+,KTs+,QTs+,AJo+,KQo"),
+		omp::CardRange("22+,A2s+,K9s+,QTs+,JTs,ATo+,KJo+"), omp::CardRange("22+,A2s+,K9s+,QTs+,JTs,ATo+,KJo+") };
+	uint64_t board = omp::CardRange::getCardMask("Ah7c2d5s");
+	unsigned maxThreads = omp::ThreadPool::instance().threadCount();
+
+	std::cout << "Thread scaling (" << maxThreads << " threads in the pool)" << std::endl;
+	std::cout << std::fixed << std::setprecision(1);
+	for (unsigned threads = 1;; threads = std::min(2 * threads, maxThreads)) {
+		omp::EquityCalculator mc;
+		mc.setTimeLimit(0.5);
+		mc.start(ranges, 0, 0, false, 0, nullptr, 0.2, threads);
+		mc.wait();
+		double mcSpeed = mc.getResults().speed;
+
+		omp::EquityCalculator eq;
+		auto t = Clock::now();
+		eq.start(ranges, board, 0, true, 0, nullptr, 0.2, threads);
+		eq.wait();
+		double enumSpeed = eq.getResults().hands / secondsSince(t);
+
+		std::cout << "  " << std::setw(3) << threads << " threads: monte carlo " << std::setw(7) << 1e-6 * mcSpeed
+			<< " M/s  enumeration " << std::setw(7) << 1e-6 * enumSpeed << " M/s" << std::endl;
+		if (threads == maxThreads)
+			break;
+	}
+}
+
+int main()
+{
+	std::cout << "Dispatch target: " << omp::dispatchTarget() << std::endl;
+	benchmarkStartup();
+	benchmarkBatchEvaluation();
+	benchmarkRiverLoop();
+	benchmarkLayouts();
+	benchmarkOmaha();
+	benchmarkShortDeck();
+	benchmarkEquityBatch();
+	benchmarkThreadScaling();
+	return 0;
+}
@@ -72,18 +72,60 @@ namespace pokerlib {
 	/**
 	 * @brief Gets the five best cards from a set of cards
 	 * @param cards Vector of cards to evaluate
-	 * @return The five best cards
+	 * @return The five best cards, in their original order. Repeated cards are only returned once.
 	 */
 	std::vector<Card> GetFiveBestCards(std::vector<Card> cards);
 
+	/**
+	 * @brief Gets the five best cards from a set of cards without allocating
+	 * @param cardMask Bitmask of cards, where bit (rank * 4 + suit) is set for each card. Up to 7 cards are ranked
+	 * with at most 21 evaluations, more cards by trying every 5-card subset.
+	 * @return Bitmask of the five best cards (all cards when there are 5 or fewer)
+	 */
+	uint64_t GetFiveBestCardsMask(uint64_t cardMask);
+
 	/**
 	 * @brief Evaluates poker hands and calculates equity
 	 * @param hands Vector of hand strings (e.g., "AhKs")
 	 * @param boardStr String representing the board cards
 	 * @param deadStr String representing dead cards to exclude from runouts
+	 * @param maxSeconds Time budget in seconds. Spots that can't be enumerated within it are simulated with
+	 * Monte Carlo instead. 0 to always enumerate every runout.
 	 * @return Vector of PlayerResults for each player
 	 */
-	std::vector<PlayerResults> Evaluate(std::vector<std::string> hands, std::string boardStr = "", std::string deadStr = "");
+	std::vector<PlayerResults> Evaluate(std::vector<std::string> hands, std::string boardStr = "", std::string deadStr = "",
+		double maxSeconds = 0);
+
+	/**
+	 * @brief Evaluates the same hands street by street, reusing the flop enumeration on the turn and river
+	 *
+	 * On the flop the session deals every turn and river once and keeps the winners of each runout. The turn and
+	 * river results are then sums over that table, so they are available without starting a new calculation.
+	 * Preflop boards are passed on to Evaluate().
+	 */
+	class EvaluationSession {
+	public:
+		/**
+		 * @param hands Vector of hand strings (e.g., "AhKs")
+		 * @param deadStr String representing dead cards to exclude from runouts
+		 */
+		EvaluationSession(std::vector<std::string> hands, std::string deadStr = "");
+
+		/**
+		 * @brief Evaluates the hands on a board, with the same results as Evaluate()
+		 * @param boardStr String representing the board cards, usually the previous board plus the new street
+		 * @return Vector of PlayerResults for each player
+		 */
+		std::vector<PlayerResults> Evaluate(std::string boardStr);
+
+	private:
+		void DealRunouts(const std::vector<Card>& flop);
+
+		std::vector<std::string> hands;  ///< Hand strings of the players
+		std::string deadStr;             ///< Dead cards
+		uint64_t flopMask = 0;           ///< Flop of the runout table, 0 if there is no table yet
+		std::vector<uint16_t> winners;   ///< Winning player mask by turn * 52 + river card index
+	};
 
 } // namespace pokerlib
 
@@ -72,9 +72,9 @@ namespace pokerlib {
 
 		/**
 		 * @brief Converts the hand description to a human-readable string
-		 * @return String representation of the hand (e.g., "pair of aces")
+		 * @return String representation of the hand (e.g., "pair of aces"), interned so no string is built per call
 		 */
-		std::string to_string();
+		const std::string& to_string() const;
 
 		/**
 		 * @brief Creates an invalid hand description
@@ -90,6 +90,9 @@ namespace pokerlib {
 	public:
 		/**
 		 * @brief Get a description for a hand evaluation
+		 *
+		 * The high and low cards of every evaluation are precomputed on first use, so this is a single table lookup.
+		 *
 		 * @param eval The hand evaluation value
 		 * @return HandDescription object with details about the hand
 		 */
@@ -0,0 +1,357 @@
+#include "BoardContext.h"
+#include "HandEvaluator.h"
+#include "ShowdownSweep.h"
+#include <algorithm>
+
+namespace omp {
+
+	// Evaluates every combo on every runout.
+	BoardContext::BoardContext(uint64_t boardCards, bool shortDeck)
+		: mBoardCards(boardCards), mShortDeck(shortDeck)
+	{
+		omp_assert(bitCount(boardCards) >= 3 && bitCount(boardCards) <= BOARD_CARDS);
+		unsigned firstCard = shortDeck ? SHORT_DECK_FIRST_CARD : 0;
+		for (unsigned c1 = 1; c1 < CARD_COUNT; ++c1) {
+			for (unsigned c2 = 0; c2 < c1; ++c2)
+				mCombos[comboIndex(c1, c2)] = { (uint8_t)c1, (uint8_t)c2 };
+		}
+
+		std::vector<unsigned> deck;
+		for (unsigned c = firstCard; c < CARD_COUNT; ++c) {
+			if (!(boardCards & (1ull << c)))
+				deck.push_back(c);
+		}
+		unsigned remainingBoardCards = BOARD_CARDS - bitCount(boardCards);
+		if (remainingBoardCards == 0)
+			mRunouts.push_back(0);
+		for (unsigned i = 0; i < deck.size() && remainingBoardCards > 0; ++i) {
+			if (remainingBoardCards == 1)
+				mRunouts.push_back(1ull << deck[i]);
+			for (unsigned j = i + 1; j < deck.size() && remainingBoardCards == 2; ++j)
+				mRunouts.push_back(1ull << deck[i] | 1ull << deck[j]);
+		}
+
+		HandEvaluator eval;
+		ShortDeckHandEvaluator shortDeckEval;
+		uint64_t removedCards = (1ull << firstCard) - 1;
+		mRanks.resize(mRunouts.size() * COMBO_COUNT);
+		for (size_t i = 0; i < mRunouts.size(); ++i) {
+			uint64_t usedCards = boardCards | mRunouts[i] | removedCards;
+			Hand board = Hand::empty();
+			for (unsigned c = 0; c < CARD_COUNT; ++c) {
+				if ((boardCards | mRunouts[i]) & (1ull << c))
+					board += c;
+			}
+
+			uint16_t* ranks = &mRanks[i * COMBO_COUNT];
+			for (unsigned j = 0; j < COMBO_COUNT; ++j) {
+				const std::array<uint8_t, 2>& cards = mCombos[j];
+				if (usedCards & (1ull << cards[0] | 1ull << cards[1])) {
+					ranks[j] = 0;
+					continue;
+				}
+				Hand hand = board + cards[0] + cards[1];
+				ranks[j] = shortDeck ? shortDeckEval.evaluate(hand) : eval.evaluate(hand);
+			}
+		}
+	}
+
+	// With a small range, each of its combos is compared against the cached ranks of all the combos in the other range,
+	// 16 at a time with AVX2. Otherwise ShowdownSweep sorts the combos of both ranges on each runout.
+	bool BoardContext::calculate(const std::vector<CardRange>& handRanges, EquityCalculator::Results& results,
+		uint64_t deadCards) const
+	{
+		if (handRanges.size() != 2 || (deadCards & mBoardCards))
+			return false;
+
+		std::vector<unsigned> combos[2] = { liveCombos(handRanges[0], deadCards), liveCombos(handRanges[1], deadCards) };
+		std::vector<size_t> runouts = liveRunouts(deadCards);
+		unsigned runoutCount = (unsigned)runouts.size();
+
+		// Combos of the other player that don't share a card with each combo of the smaller range.
+		unsigned hero = combos[0].size() <= combos[1].size() ? 0 : 1, villain = hero ^ 1;
+		unsigned villainCount = (unsigned)combos[villain].size();
+		std::vector<uint16_t> villainWeights(villainCount * combos[hero].size());
+		uint64_t preflopCombos = 0;
+		for (size_t i = 0; i < combos[hero].size(); ++i) {
+			const std::array<uint8_t, 2>& heroCards = mCombos[combos[hero][i]];
+			uint64_t heroMask = 1ull << heroCards[0] | 1ull << heroCards[1];
+			for (unsigned j = 0; j < villainCount; ++j) {
+				const std::array<uint8_t, 2>& cards = mCombos[combos[villain][j]];
+				villainWeights[i * villainCount + j] = !(heroMask & (1ull << cards[0] | 1ull << cards[1]));
+				preflopCombos += villainWeights[i * villainCount + j];
+			}
+		}
+		if (preflopCombos == 0)
+			return false;
+
+		// Showdowns won by the hero, ties and all showdowns.
+		uint64_t counts[3] = {};
+		if (combos[hero].size() <= MAX_COMPARED_COMBOS) {
+			std::vector<uint16_t> villainRanks((size_t)runoutCount * villainCount);
+			for (unsigned i = 0; i < runoutCount; ++i) {
+				const uint16_t* ranks = &mRanks[runouts[i] * COMBO_COUNT];
+				for (unsigned j = 0; j < villainCount; ++j)
+					villainRanks[(size_t)i * villainCount + j] = ranks[combos[villain][j]];
+			}
+			for (size_t i = 0; i < combos[hero].size(); ++i) {
+				for (unsigned j = 0; j < runoutCount; ++j) {
+					uint16_t rank = mRanks[runouts[j] * COMBO_COUNT + combos[hero][i]];
+					if (rank)
+						compareRanks(rank, &villainRanks[(size_t)j * villainCount], &villainWeights[i * villainCount],
+							villainCount, counts);
+				}
+			}
+		}
+		else {
+			ShowdownSweep sweep;
+			for (size_t runout : runouts) {
+				const uint16_t* ranks = &mRanks[runout * COMBO_COUNT];
+				sweep.clear();
+				for (unsigned i = 0; i < 2; ++i) {
+					for (unsigned combo : combos[i]) {
+						if (ranks[combo])
+							sweep.add(i == hero ? 0 : 1, ranks[combo], mCombos[combo][0], mCombos[combo][1]);
+					}
+				}
+				uint64_t wins[2], ties;
+				sweep.count(wins, ties);
+				counts[0] += wins[0];
+				counts[1] += ties;
+				counts[2] += wins[0] + wins[1] + ties;
+			}
+		}
+
+		results = EquityCalculator::Results();
+		results.players = 2;
+		results.wins[hero] = counts[0];
+		results.wins[villain] = counts[2] - counts[0] - counts[1];
+		results.ties[0] = results.ties[1] = counts[1];
+		results.winsByPlayerMask[1u << hero] = results.wins[hero];
+		results.winsByPlayerMask[1u << villain] = results.wins[villain];
+		results.winsByPlayerMask[3] = counts[1];
+		results.hands = results.intervalHands = counts[2];
+		for (unsigned i = 0; i < 2; ++i)
+			results.equity[i] = (results.wins[i] + results.ties[i]) / (results.hands + 1e-9);
+		results.progress = 1;
+		results.preflopCombos = preflopCombos;
+		results.enumerateAll = true;
+		results.finished = true;
+		return true;
+	}
+
+	// Goes through the combos of the first range one at a time and compares its rank on each runout against the cached
+	// ranks of all the combos in the second range, which accumulates the counts of a row of the matrix.
+	bool BoardContext::calculateMatrix(const std::vector<CardRange>& handRanges, Matrix& matrix,
+		uint64_t deadCards) const
+	{
+		if (handRanges.size() != 2 || (deadCards & mBoardCards))
+			return false;
+
+		std::vector<unsigned> combos[2] = { liveCombos(handRanges[0], deadCards), liveCombos(handRanges[1], deadCards) };
+		std::vector<size_t> runouts = liveRunouts(deadCards);
+		unsigned runoutCount = (unsigned)runouts.size();
+		unsigned villainCount = (unsigned)combos[1].size();
+
+		matrix = Matrix();
+		for (unsigned i = 0; i < 2; ++i) {
+			for (unsigned combo : combos[i])
+				matrix.combos[i].push_back(mCombos[combo]);
+		}
+		size_t pairCount = combos[0].size() * villainCount;
+		matrix.wins.resize(pairCount);
+		matrix.ties.resize(pairCount);
+		matrix.hands.resize(pairCount);
+
+		std::vector<uint16_t> villainRanks((size_t)runoutCount * villainCount);
+		for (unsigned i = 0; i < runoutCount; ++i) {
+			const uint16_t* ranks = &mRanks[runouts[i] * COMBO_COUNT];
+			for (unsigned j = 0; j < villainCount; ++j)
+				villainRanks[(size_t)i * villainCount + j] = ranks[combos[1][j]];
+		}
+
+		bool hasShowdowns = false;
+		for (size_t i = 0; i < combos[0].size(); ++i) {
+			size_t row = i * villainCount;
+			for (unsigned j = 0; j < runoutCount; ++j) {
+				uint16_t rank = mRanks[runouts[j] * COMBO_COUNT + combos[0][i]];
+				if (rank)
+					countShowdowns(rank, &villainRanks[(size_t)j * villainCount], villainCount, &matrix.wins[row],
+						&matrix.ties[row], &matrix.hands[row]);
+			}
+
+			// The ranks don't know about the cards of the other combo, so the pairs that share a card are cleared.
+			const std::array<uint8_t, 2>& heroCards = mCombos[combos[0][i]];
+			uint64_t heroMask = 1ull << heroCards[0] | 1ull << heroCards[1];
+			for (unsigned j = 0; j < villainCount; ++j) {
+				const std::array<uint8_t, 2>& cards = mCombos[combos[1][j]];
+				if (heroMask & (1ull << cards[0] | 1ull << cards[1]))
+					matrix.wins[row + j] = matrix.ties[row + j] = matrix.hands[row + j] = 0;
+				else
+					hasShowdowns = true;
+			}
+		}
+		if (!hasShowdowns)
+			return false;
+
+		// Wins and ties of each combo against the other range, and the showdowns they were out of.
+		std::vector<uint64_t> wins[2], ties[2], hands[2];
+		for (unsigned i = 0; i < 2; ++i) {
+			wins[i].resize(combos[i].size());
+			ties[i].resize(combos[i].size());
+			hands[i].resize(combos[i].size());
+		}
+		for (size_t i = 0; i < combos[0].size(); ++i) {
+			for (unsigned j = 0; j < villainCount; ++j) {
+				size_t pair = i * villainCount + j;
+				unsigned losses = matrix.hands[pair] - matrix.wins[pair] - matrix.ties[pair];
+				wins[0][i] += matrix.wins[pair];
+				wins[1][j] += losses;
+				ties[0][i] += matrix.ties[pair];
+				ties[1][j] += matrix.ties[pair];
+				hands[0][i] += matrix.hands[pair];
+				hands[1][j] += matrix.hands[pair];
+			}
+		}
+		for (unsigned i = 0; i < 2; ++i) {
+			for (size_t j = 0; j < combos[i].size(); ++j)
+				matrix.equity[i].push_back((wins[i][j] + ties[i][j]) / (hands[i][j] + 1e-9));
+		}
+		return true;
+	}
+
+	// Index of a combo in the order (1,0), (2,0), (2,1), (3,0), ...
+	unsigned BoardContext::comboIndex(unsigned card1, unsigned card2)
+	{
+		unsigned high = std::max(card1, card2), low = std::min(card1, card2);
+		return high * (high - 1) / 2 + low;
+	}
+
+	// Combos of a range that don't share a card with the board, the dead cards or the cards removed from a short deck.
+	std::vector<unsigned> BoardContext::liveCombos(const CardRange& range, uint64_t deadCards) const
+	{
+		unsigned firstCard = mShortDeck ? SHORT_DECK_FIRST_CARD : 0;
+		uint64_t removedCards = mBoardCards | deadCards | ((1ull << firstCard) - 1);
+		std::vector<unsigned> combos;
+		for (const std::array<uint8_t, 2>& cards : range.combinations()) {
+			if (!(removedCards & (1ull << cards[0] | 1ull << cards[1])))
+				combos.push_back(comboIndex(cards[0], cards[1]));
+		}
+		return combos;
+	}
+
+	// Indices of the runouts that don't use dead cards.
+	std::vector<size_t> BoardContext::liveRunouts(uint64_t deadCards) const
+	{
+		std::vector<size_t> runouts;
+		for (size_t i = 0; i < mRunouts.size(); ++i) {
+			if (!(mRunouts[i] & deadCards))
+				runouts.push_back(i);
+		}
+		return runouts;
+	}
+
+	// Adds the showdowns of one combo on one runout to the counts of its pairs with each villain combo. Villain combos
+	// that share a card with the runout have rank 0 and are skipped.
+	void BoardContext::countShowdowns(uint16_t rank, const uint16_t* villainRanks, unsigned villainCount,
+		uint16_t* wins, uint16_t* ties, uint16_t* hands)
+	{
+		unsigned i = 0;
+
+		#if OMP_AVX2_KERNELS
+		static const bool hasAvx2 = cpuSupportsAvx2();
+		if (hasAvx2)
+			i = countShowdownsAvx2(rank, villainRanks, villainCount, wins, ties, hands);
+		#endif
+
+		for (; i < villainCount; ++i) {
+			bool live = villainRanks[i] != 0;
+			wins[i] += live && villainRanks[i] < rank;
+			ties[i] += villainRanks[i] == rank;
+			hands[i] += live;
+		}
+	}
+
+	// Adds the showdowns of one hero combo against the villain combos with weight 1 on one runout. counts gets the
+	// villain combos that the hero beats, ties and the number of showdowns. Villain combos that share a card with the
+	// runout have rank 0 and are skipped.
+	void BoardContext::compareRanks(uint16_t rank, const uint16_t* villainRanks, const uint16_t* villainWeights,
+		unsigned villainCount, uint64_t* counts)
+	{
+		unsigned i = 0;
+
+		#if OMP_AVX2_KERNELS
+		static const bool hasAvx2 = cpuSupportsAvx2();
+		if (hasAvx2)
+			i = compareRanksAvx2(rank, villainRanks, villainWeights, villainCount, counts);
+		#endif
+
+		for (; i < villainCount; ++i) {
+			unsigned weight = villainRanks[i] ? villainWeights[i] : 0;
+			counts[0] += villainRanks[i] < rank ? weight : 0;
+			counts[1] += villainRanks[i] == rank ? weight : 0;
+			counts[2] += weight;
+		}
+	}
+
+	#if OMP_AVX2_KERNELS
+	// Counts the showdowns of 16 villain combos at a time and returns how many were done. The comparison masks are -1
+	// in the lanes where they hold, so subtracting them increments the counts.
+	OMP_TARGET_AVX2 unsigned BoardContext::countShowdownsAvx2(uint16_t rank, const uint16_t* villainRanks,
+		unsigned villainCount, uint16_t* wins, uint16_t* ties, uint16_t* hands)
+	{
+		__m256i zero = _mm256_setzero_si256();
+		__m256i rankVec = _mm256_set1_epi16((short)rank);
+		__m256i lowerRankVec = _mm256_set1_epi16((short)(rank - 1));
+		unsigned i = 0;
+		for (; i + 16 <= villainCount; i += 16) {
+			__m256i ranks = _mm256_loadu_si256((const __m256i*)(villainRanks + i));
+			__m256i isDead = _mm256_cmpeq_epi16(ranks, zero);
+			__m256i isLower = _mm256_andnot_si256(isDead,
+				_mm256_cmpeq_epi16(_mm256_min_epu16(ranks, lowerRankVec), ranks));
+			__m256i isLive = _mm256_andnot_si256(isDead, _mm256_cmpeq_epi16(ranks, ranks));
+			__m256i* winsVec = (__m256i*)(wins + i);
+			__m256i* tiesVec = (__m256i*)(ties + i);
+			__m256i* handsVec = (__m256i*)(hands + i);
+			_mm256_storeu_si256(winsVec, _mm256_sub_epi16(_mm256_loadu_si256(winsVec), isLower));
+			_mm256_storeu_si256(tiesVec, _mm256_sub_epi16(_mm256_loadu_si256(tiesVec),
+				_mm256_cmpeq_epi16(ranks, rankVec)));
+			_mm256_storeu_si256(handsVec, _mm256_sub_epi16(_mm256_loadu_si256(handsVec), isLive));
+		}
+		return i;
+	}
+
+	// Compares 16 villain combos at a time and returns how many were done. Each 16-bit lane counts at most
+	// COMBO_COUNT / 16 combos, so it can't overflow.
+	OMP_TARGET_AVX2 unsigned BoardContext::compareRanksAvx2(uint16_t rank, const uint16_t* villainRanks,
+		const uint16_t* villainWeights, unsigned villainCount, uint64_t* counts)
+	{
+		__m256i zero = _mm256_setzero_si256();
+		__m256i rankVec = _mm256_set1_epi16((short)rank);
+		__m256i lowerRankVec = _mm256_set1_epi16((short)(rank - 1));
+		__m256i lower = zero, equal = zero, live = zero;
+		unsigned i = 0;
+		for (; i + 16 <= villainCount; i += 16) {
+			__m256i ranks = _mm256_loadu_si256((const __m256i*)(villainRanks + i));
+			__m256i weights = _mm256_loadu_si256((const __m256i*)(villainWeights + i));
+			weights = _mm256_andnot_si256(_mm256_cmpeq_epi16(ranks, zero), weights);
+			// rank > 0, so villain rank < rank is the same as min(villain rank, rank - 1) == villain rank.
+			__m256i isLower = _mm256_cmpeq_epi16(_mm256_min_epu16(ranks, lowerRankVec), ranks);
+			lower = _mm256_add_epi16(lower, _mm256_and_si256(isLower, weights));
+			equal = _mm256_add_epi16(equal, _mm256_and_si256(_mm256_cmpeq_epi16(ranks, rankVec), weights));
+			live = _mm256_add_epi16(live, weights);
+		}
+
+		__m256i* sums[3] = { &lower, &equal, &live };
+		for (unsigned j = 0; j < 3; ++j) {
+			__m256i sum = _mm256_madd_epi16(*sums[j], _mm256_set1_epi16(1));
+			sum = _mm256_add_epi32(sum, _mm256_permute2x128_si256(sum, sum, 1));
+			sum = _mm256_add_epi32(sum, _mm256_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+			sum = _mm256_add_epi32(sum, _mm256_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+			counts[j] += (uint32_t)_mm256_cvtsi256_si32(sum);
+		}
+		return i;
+	}
+	#endif
+
+}
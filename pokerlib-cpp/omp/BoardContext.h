@@ -0,0 +1,90 @@
+#ifndef OMP_BOARD_CONTEXT_H
+#define OMP_BOARD_CONTEXT_H
+
+#include "EquityCalculator.h"
+#include "CardRange.h"
+#include "Constants.h"
+#include "Util.h"
+#include <vector>
+#include <array>
+#include <cstdint>
+
+namespace omp {
+
+// Hand ranks of every combo on every runout of a flop, turn or river. Building the context evaluates each
+// (runout, combo) pair once (about 3 MB for a flop), after which heads-up equities on the board are only comparisons
+// of cached ranks. Meant for answering many queries with different hands and ranges on the same board. The context
+// is immutable after construction, so it can be shared between threads.
+class BoardContext
+{
+public:
+    // boardCards: bitmask of 3 to 5 board cards
+    // shortDeck: use short deck (6+) Hold'em, see EquityCalculator::setShortDeck()
+    BoardContext(uint64_t boardCards, bool shortDeck = false);
+
+    // Exact heads-up equities of two hand ranges on the board, with the same results as an enumeration with
+    // EquityCalculator. Returns false if there aren't exactly two ranges, if the dead cards include board cards or if
+    // a range has no combos left after card removal.
+    bool calculate(const std::vector<CardRange>& handRanges, EquityCalculator::Results& results,
+                   uint64_t deadCards = 0) const;
+
+    // Showdown counts of every combo pair of two ranges, see calculateMatrix().
+    struct Matrix
+    {
+        // Combos of each range that don't share a card with the board or the dead cards, in the order of
+        // CardRange::combinations().
+        std::vector<std::array<uint8_t,2>> combos[2];
+        // Counts by combo pair, at index i * combos[1].size() + j for combos[0][i] and combos[1][j]. wins are the
+        // showdowns won by the combo of the first range. Pairs that share a card have no showdowns.
+        std::vector<uint16_t> wins, ties, hands;
+        // Equity of each combo against all the combos of the other range (computed like Results::equity).
+        std::vector<double> equity[2];
+    };
+
+    // Exact heads-up showdown counts of each combo in one range against each combo in the other range, all in one
+    // pass. Returns false in the same cases as calculate().
+    bool calculateMatrix(const std::vector<CardRange>& handRanges, Matrix& matrix, uint64_t deadCards = 0) const;
+
+    uint64_t boardCards() const
+    {
+        return mBoardCards;
+    }
+
+    // Number of ways to complete the board.
+    size_t runoutCount() const
+    {
+        return mRunouts.size();
+    }
+
+private:
+    // Queries where one range has at most this many combos compare the ranks of each combo pair directly.
+    static const unsigned MAX_COMPARED_COMBOS = 256;
+
+    static unsigned comboIndex(unsigned card1, unsigned card2);
+    std::vector<unsigned> liveCombos(const CardRange& range, uint64_t deadCards) const;
+    std::vector<size_t> liveRunouts(uint64_t deadCards) const;
+    static void compareRanks(uint16_t rank, const uint16_t* villainRanks, const uint16_t* villainWeights,
+                             unsigned villainCount, uint64_t* counts);
+    static void countShowdowns(uint16_t rank, const uint16_t* villainRanks, unsigned villainCount, uint16_t* wins,
+                               uint16_t* ties, uint16_t* hands);
+    #if OMP_AVX2_KERNELS
+    OMP_TARGET_AVX2 static unsigned countShowdownsAvx2(uint16_t rank, const uint16_t* villainRanks,
+                                                       unsigned villainCount, uint16_t* wins, uint16_t* ties,
+                                                       uint16_t* hands);
+    OMP_TARGET_AVX2 static unsigned compareRanksAvx2(uint16_t rank, const uint16_t* villainRanks,
+                                                     const uint16_t* villainWeights, unsigned villainCount,
+                                                     uint64_t* counts);
+    #endif
+
+    uint64_t mBoardCards;
+    bool mShortDeck;
+    // Missing board cards of each runout.
+    std::vector<uint64_t> mRunouts;
+    // Rank of each combo on each runout, COMBO_COUNT per runout. 0 if the combo and the board share a card.
+    std::vector<uint16_t> mRanks;
+    std::array<std::array<uint8_t, 2>, COMBO_COUNT> mCombos;
+};
+
+}
+
+#endif // OMP_BOARD_CONTEXT_H
@@ -26,6 +26,14 @@ namespace omp {
 	static const unsigned FOUR_OF_A_KIND = 8 * HAND_CATEGORY_OFFSET;
 	static const unsigned STRAIGHT_FLUSH = 9 * HAND_CATEGORY_OFFSET;
 
+	// Short deck (6+) Hold'em uses the 36 cards from six to ace, which are cards 16-51. A-6-7-8-9 is the lowest
+	// straight and flush beats full house, so those two categories are swapped.
+	static const unsigned SHORT_DECK_CARD_COUNT = 36;
+	static const unsigned SHORT_DECK_FIRST_RANK = 4;
+	static const unsigned SHORT_DECK_FIRST_CARD = SHORT_DECK_FIRST_RANK << RANK_SHIFT;
+	static const unsigned SHORT_DECK_FULL_HOUSE = 6 * HAND_CATEGORY_OFFSET;
+	static const unsigned SHORT_DECK_FLUSH = 7 * HAND_CATEGORY_OFFSET;
+
 }
 
 #endif // OMP_CONSTANTS_H
@@ -1,6 +1,8 @@
 #include "EquityCalculator.h"
 
 #include "Util.h"
+#include "ShowdownSweep.h"
+#include "PrecalculatedResults.hxx"
 #include "../libdivide/libdivide.h"
 #include <random>
 #include <iostream>
@@ -9,30 +11,204 @@
 
 namespace omp {
 
-	// Start new calculation and spawn threads.
+	// Passed by reference to make_shared, so it needs a definition.
+	const size_t EquityCalculator::DEFAULT_LOOKUP_CACHE_BYTES;
+
+	// How long a task runs before it's requeued in the thread pool.
+	static const std::chrono::milliseconds TIME_SLICE(20);
+
+	// Start new calculation and submit its tasks to the thread pool.
 	bool EquityCalculator::start(const std::vector<CardRange>& handRanges, uint64_t boardCards, uint64_t deadCards,
 		bool enumerateAll, double stdevTarget, std::function<void(const Results&)> callback,
 		double updateInterval, unsigned threadCount)
 	{
-		if (handRanges.size() == 0 || handRanges.size() > MAX_PLAYERS)
-			return false;
-		if (bitCount(boardCards) > BOARD_CARDS)
+		if (threadCount == 0)
+			threadCount = ThreadPool::instance().threadCount();
+		Kernel kernel = setup(handRanges, boardCards, deadCards, enumerateAll, stdevTarget, callback, updateInterval,
+			threadCount);
+		if (!kernel)
 			return false;
-		if (2 * handRanges.size() + bitCount(deadCards) + BOARD_CARDS > CARD_COUNT)
+		mRunning = true;
+
+		// Start tasks. Each task runs for a time slice and is then requeued, so that other calculations get their share
+		// of the pool.
+		for (unsigned i = 0; i < threadCount; ++i) {
+			TaskResults* task = &mTaskResults[i];
+			ThreadPool::instance().submit([this, kernel, task] {
+				return (this->*kernel)(*task);
+			}, mPriority);
+		}
+
+		// Started successfully.
+		return true;
+	}
+
+	// The cost of an exact enumeration is estimated from the number of showdowns and the measured time of one hand
+	// evaluation. Lookups, isomorphism and sweeps often make the enumeration faster than that, so the estimate errs on
+	// the safe side.
+	bool EquityCalculator::calculate(const std::vector<CardRange>& handRanges, uint64_t boardCards, uint64_t deadCards,
+		Results& results, double maxSeconds, double stdevTarget)
+	{
+		Kernel kernel = setup(handRanges, boardCards, deadCards, true, stdevTarget, nullptr, INFINITE, 1);
+		if (!kernel)
 			return false;
+		// Heads-up preflops without board or dead cards are read from the precalculated results.
+		bool precalculated = handRanges.size() == 2 && !boardCards && !deadCards && !mShortDeck;
+		double evaluations = (double)getPreflopCombinationCount()
+			* (precalculated ? 1 : getPostflopCombinationCount() * handRanges.size());
+		double seconds = evaluations * evaluationSeconds();
+
+		// Small enumerations take less time than waking up the threads of the pool.
+		if (seconds <= MAX_INLINE_SECONDS) {
+			while ((this->*kernel)(mTaskResults[0]))
+				;
+			results = mUpdateResults;
+			return true;
+		}
+
+		unsigned threadCount = ThreadPool::instance().threadCount();
+		bool enumerateAll = maxSeconds <= 0 || seconds / threadCount <= maxSeconds;
+		double timeLimit = mTimeLimit;
+		if (!enumerateAll)
+			mTimeLimit = std::min(timeLimit, maxSeconds);
+		bool started = start(handRanges, boardCards, deadCards, enumerateAll, stdevTarget);
+		if (started) {
+			wait();
+			results = getResults();
+		}
+		mTimeLimit = timeLimit;
+		return started;
+	}
+
+	// Seconds per hand evaluation on this machine, measured once on a fixed set of 7-card hands.
+	double EquityCalculator::evaluationSeconds()
+	{
+		static const double seconds = [] {
+			static const unsigned HANDS = 1 << 14;
+			HandEvaluator eval;
+			Rng rng(1);
+			FastUniformIntDistribution<unsigned, 16> cardDist(0, CARD_COUNT - 1);
+			std::vector<Hand> hands;
+			for (unsigned i = 0; i < HANDS; ++i) {
+				uint64_t usedCards = 0;
+				Hand hand = Hand::empty();
+				while (bitCount(usedCards) < 7) {
+					unsigned card = cardDist(rng);
+					if (!(usedCards & (1ull << card))) {
+						usedCards |= 1ull << card;
+						hand += card;
+					}
+				}
+				hands.push_back(hand);
+			}
+
+			auto t = std::chrono::high_resolution_clock::now();
+			unsigned rankSum = 0;
+			for (const Hand& hand : hands)
+				rankSum += eval.evaluate(hand);
+			double elapsed = 1e-9 * std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::high_resolution_clock::now() - t).count();
+			// The sum is used so that the evaluations aren't optimized away.
+			return (elapsed + (rankSum == 0)) / HANDS;
+		}();
+		return seconds;
+	}
+
+	// Every task of the batch has its own calculator, which runs one query at a time with a single TaskResults. A
+	// query that is still running at the end of a time slice continues when the task is run again.
+	void EquityCalculator::calculateBatch(const Query* queries, size_t queryCount, Results* results,
+		unsigned threadCount)
+	{
+		if (threadCount == 0)
+			threadCount = ThreadPool::instance().threadCount();
+		threadCount = (unsigned)std::min<size_t>(threadCount, queryCount);
+
+		struct Worker
+		{
+			EquityCalculator calculator;
+			Kernel kernel = nullptr;
+			size_t query = 0;
+		};
+		std::vector<std::unique_ptr<Worker>> workers;
+		for (unsigned i = 0; i < threadCount; ++i) {
+			workers.emplace_back(new Worker());
+			EquityCalculator& calculator = workers.back()->calculator;
+			calculator.mLookup = mLookup;
+			calculator.mShortDeck = mShortDeck;
+			calculator.mTimeLimit = mTimeLimit.load();
+			calculator.mHandLimit = mHandLimit.load();
+		}
+
+		std::atomic<size_t> nextQuery{ 0 };
+		std::mutex mutex;
+		std::condition_variable finished;
+		unsigned unfinishedWorkers = threadCount;
+		for (unsigned i = 0; i < threadCount; ++i) {
+			Worker* worker = workers[i].get();
+			ThreadPool::instance().submit([=, &nextQuery, &mutex, &finished, &unfinishedWorkers] {
+				EquityCalculator& calculator = worker->calculator;
+				auto sliceEnd = std::chrono::high_resolution_clock::now() + TIME_SLICE;
+				while (std::chrono::high_resolution_clock::now() < sliceEnd) {
+					if (!worker->kernel) {
+						worker->query = nextQuery++;
+						if (worker->query >= queryCount) {
+							std::lock_guard<std::mutex> lock(mutex);
+							if (--unfinishedWorkers == 0)
+								finished.notify_all();
+							return false;
+						}
+						// Monte carlo checks the standard deviation after every batch of showdowns, so that it stops as
+						// soon as it reaches the target. Enumerations only collect their results at the end.
+						const Query& query = queries[worker->query];
+						worker->kernel = calculator.setup(query.handRanges, query.boardCards, query.deadCards,
+							query.enumerateAll, query.stdevTarget, nullptr, query.enumerateAll ? INFINITE : 0, 1);
+						if (!worker->kernel) {
+							results[worker->query] = Results();
+							continue;
+						}
+					}
+					if ((calculator.*worker->kernel)(calculator.mTaskResults[0]))
+						return true;
+					results[worker->query] = calculator.mUpdateResults;
+					worker->kernel = nullptr;
+				}
+				return true;
+			}, mPriority);
+		}
+
+		std::unique_lock<std::mutex> lock(mutex);
+		finished.wait(lock, [&] { return unfinishedWorkers == 0; });
+	}
+
+	// Validates the arguments of a calculation and prepares the shared data for its tasks. Returns the kernel for the
+	// tasks, or nullptr if the calculation is impossible.
+	EquityCalculator::Kernel EquityCalculator::setup(const std::vector<CardRange>& handRanges, uint64_t boardCards,
+		uint64_t deadCards, bool enumerateAll, double stdevTarget, std::function<void(const Results&)> callback,
+		double updateInterval, unsigned threadCount)
+	{
+		if (handRanges.size() == 0 || handRanges.size() > MAX_PLAYERS)
+			return nullptr;
+		if (bitCount(boardCards) > BOARD_CARDS)
+			return nullptr;
+		// Cards below firstCard() are not in the deck.
+		uint64_t removedCards = (1ull << firstCard()) - 1;
+		if ((boardCards | deadCards) & removedCards)
+			return nullptr;
+		if (2 * handRanges.size() + bitCount(deadCards) + BOARD_CARDS > CARD_COUNT - firstCard())
+			return nullptr;
 
 		// Set up card ranges.
 		mDeadCards = deadCards;
 		mBoardCards = boardCards;
 		mOriginalHandRanges = handRanges;
-		mHandRanges = removeInvalidCombos(handRanges, mDeadCards | mBoardCards);
+		mHandRanges = removeInvalidCombos(handRanges, mDeadCards | mBoardCards | removedCards);
 		std::vector<CombinedRange> combinedRanges = CombinedRange::joinRanges(mHandRanges, MAX_COMBINED_RANGE_SIZE);
 
 		for (unsigned i = 0; i < combinedRanges.size(); ++i)
 		{
 			if (combinedRanges[i].combos().size() == 0)
 			{
-				return false;
+				return nullptr;
 			}
 
 			if (!enumerateAll)
@@ -47,7 +223,7 @@ namespace omp {
 
 		// Set up simulation settings.
 		mEnumPosition = 0;
-		mBatchSum = mBatchSumSqr = mBatchCount = 0;
+		mHandCount = 0;
 		mResults = Results();
 		mResults.players = (unsigned)handRanges.size();
 		mResults.enumerateAll = enumerateAll;
@@ -56,36 +232,87 @@ namespace omp {
 		mCallback = callback;
 		mUpdateInterval = updateInterval;
 		mStopped = false;
-		mLastUpdate = std::chrono::high_resolution_clock::now();
-		if (threadCount == 0)
-			threadCount = std::thread::hardware_concurrency();
-		mUnfinishedThreads = threadCount;
+		mStartTime = mLastUpdate = std::chrono::high_resolution_clock::now();
+		mNextUpdate = updateInterval;
+		mUnfinishedTasks = threadCount;
+		mTaskCount = threadCount;
+		mTaskResults.reset(new TaskResults[threadCount]);
+
+		// Big heads-up ranges on a flop or later are enumerated one board at a time, see sweepShowdowns().
+		unsigned remainingBoardCards = BOARD_CARDS - bitCount(boardCards);
+		mSweepBoards.clear();
+		bool sweep = enumerateAll && handRanges.size() == 2 && remainingBoardCards <= 2
+			&& getPreflopCombinationCount() >= (uint64_t)MIN_SWEEP_PREFLOPS_PER_COMBO
+				* (mHandRanges[0].size() + mHandRanges[1].size());
+		if (sweep) {
+			std::vector<unsigned> deck;
+			for (unsigned c = firstCard(); c < CARD_COUNT; ++c) {
+				if (!((boardCards | deadCards) & (1ull << c)))
+					deck.push_back(c);
+			}
+			if (remainingBoardCards == 0)
+				mSweepBoards.push_back(0);
+			for (unsigned i = 0; i < deck.size() && remainingBoardCards > 0; ++i) {
+				if (remainingBoardCards == 1)
+					mSweepBoards.push_back(1ull << deck[i]);
+				for (unsigned j = i + 1; j < deck.size() && remainingBoardCards == 2; ++j)
+					mSweepBoards.push_back(1ull << deck[i] | 1ull << deck[j]);
+			}
+		}
 
-		// Start threads.
-		mThreads.clear();
-		for (unsigned i = 0; i < threadCount; ++i) {
-			mThreads.emplace_back([this, enumerateAll] {
-				if (enumerateAll)
-					enumerate();
-				else
-					simulateRandomWalkMonteCarlo();
-			});
+		// With only a few preflop combos there isn't enough preflop work for every thread, so each postflop
+		// enumeration is split into parts by the first board cards.
+		mPostflopParts = 1;
+		mPostflopSplitLevels = 0;
+		if (enumerateAll && !sweep && threadCount > 1 && remainingBoardCards >= 2) {
+			uint64_t preflopCombos = getPreflopCombinationCount();
+			if (preflopCombos < 4 * threadCount && getPostflopCombinationCount() >= MIN_SPLIT_POSTFLOP_COMBOS) {
+				mPostflopParts = (unsigned)std::min<uint64_t>(MAX_POSTFLOP_PARTS,
+					(8 * threadCount + preflopCombos - 1) / preflopCombos);
+				mPostflopSplitLevels = remainingBoardCards > MAX_SPLIT_LEVELS ? MAX_SPLIT_LEVELS : remainingBoardCards - 1;
+			}
 		}
 
-		// Started successfully.
-		return true;
+		return sweep ? &EquityCalculator::sweepShowdowns : selectKernel((unsigned)handRanges.size(), enumerateAll);
 	}
 
-	// Regular monte carlo simulation.
-	void EquityCalculator::simulateRegularMonteCarlo()
+	// Picks the kernel specialized for the player count, or the generic one.
+	EquityCalculator::Kernel EquityCalculator::selectKernel(unsigned nplayers, bool enumerateAll) const
 	{
+		static_assert(MAX_SPECIALIZED_PLAYERS == 9, "Update the specializations below.");
+		switch (nplayers) {
+		case 2:
+			return enumerateAll ? &EquityCalculator::enumerate<2> : &EquityCalculator::simulateRandomWalkMonteCarlo<2>;
+		case 3:
+			return enumerateAll ? &EquityCalculator::enumerate<3> : &EquityCalculator::simulateRandomWalkMonteCarlo<3>;
+		case 4:
+			return enumerateAll ? &EquityCalculator::enumerate<4> : &EquityCalculator::simulateRandomWalkMonteCarlo<4>;
+		case 5:
+			return enumerateAll ? &EquityCalculator::enumerate<5> : &EquityCalculator::simulateRandomWalkMonteCarlo<5>;
+		case 6:
+			return enumerateAll ? &EquityCalculator::enumerate<6> : &EquityCalculator::simulateRandomWalkMonteCarlo<6>;
+		case 7:
+			return enumerateAll ? &EquityCalculator::enumerate<7> : &EquityCalculator::simulateRandomWalkMonteCarlo<7>;
+		case 8:
+			return enumerateAll ? &EquityCalculator::enumerate<8> : &EquityCalculator::simulateRandomWalkMonteCarlo<8>;
+		case 9:
+			return enumerateAll ? &EquityCalculator::enumerate<9> : &EquityCalculator::simulateRandomWalkMonteCarlo<9>;
+		default:
+			return enumerateAll ? &EquityCalculator::enumerate<0> : &EquityCalculator::simulateRandomWalkMonteCarlo<0>;
+		}
+	}
+
+	// Regular monte carlo simulation. Returns true if the time slice ended before the simulation.
+	bool EquityCalculator::simulateRegularMonteCarlo(TaskResults& task)
+	{
+		auto sliceEnd = std::chrono::high_resolution_clock::now() + TIME_SLICE;
 		unsigned nplayers = (unsigned)mHandRanges.size();
 		Hand fixedBoard = getBoardFromBitmask(mBoardCards);
 		unsigned remainingCards = BOARD_CARDS - fixedBoard.count();
 		BatchResults stats(nplayers);
 
 		Rng rng{ std::random_device{}() };
-		FastUniformIntDistribution<unsigned, 16> cardDist(0, CARD_COUNT - 1);
+		FastUniformIntDistribution<unsigned, 16> cardDist(firstCard(), CARD_COUNT - 1);
 		FastUniformIntDistribution<unsigned, 21> comboDists[MAX_PLAYERS];
 		unsigned combinedRangeCount = mCombinedRangeCount;
 		for (unsigned i = 0; i < mCombinedRangeCount; ++i)
@@ -119,18 +346,24 @@ namespace omp {
 
 			Hand board = fixedBoard;
 			randomizeBoard(board, remainingCards, usedCardsMask | mDeadCards | mBoardCards, rng, cardDist);
-			evaluateHands(playerHands, nplayers, board, &stats, 1);
+			if (nplayers >= MIN_SIMD_SHOWDOWN_PLAYERS)
+				evaluateHandsSimd(playerHands, nplayers, board, &stats);
+			else
+				evaluateHands<0>(playerHands, nplayers, board, &stats, 1);
 
 			// Update periodically.
 			if ((stats.evalCount & 0xfff) == 0) {
-				updateResults(stats, false);
-				stats = BatchResults(nplayers);
+				updateResults(stats, false, task);
+				stats.reset(nplayers);
 				if (mStopped)
 					break;
+				if (std::chrono::high_resolution_clock::now() >= sliceEnd)
+					return true;
 			}
 		}
 
-		updateResults(stats, true);
+		updateResults(stats, true, task);
+		return false;
 	}
 
 	// Monte carlo simulation using a random walk. On each iteration a random player is chosen and the next feasible
@@ -138,15 +371,18 @@ namespace omp {
 	// visited the preflop combinations can be thought of as a directed k-regular graph. The transition probability
 	// matrix P then has k non-zero values on each row and column, and all non-zero elements have value of 1/k.
 	// It is easy to see that (1,1,...,1) * P = (1,1,...,1), i.e. (1,1,...,1) is a stable distribution.
-	void EquityCalculator::simulateRandomWalkMonteCarlo()
+	// Returns true if the time slice ended before the simulation.
+	template<unsigned tPlayers>
+	bool EquityCalculator::simulateRandomWalkMonteCarlo(TaskResults& task)
 	{
-		unsigned nplayers = (unsigned)mHandRanges.size();
+		auto sliceEnd = std::chrono::high_resolution_clock::now() + TIME_SLICE;
+		unsigned nplayers = kernelPlayerCount<tPlayers>((unsigned)mHandRanges.size());
 		Hand fixedBoard = getBoardFromBitmask(mBoardCards);
 		unsigned remainingCards = 5 - fixedBoard.count();
 		BatchResults stats(nplayers);
 
 		Rng rng{ std::random_device{}() };
-		FastUniformIntDistribution<unsigned, 16> cardDist(0, CARD_COUNT - 1);
+		FastUniformIntDistribution<unsigned, 16> cardDist(firstCard(), CARD_COUNT - 1);
 		FastUniformIntDistribution<unsigned, 21> comboDists[MAX_PLAYERS];
 		FastUniformIntDistribution<unsigned, 16> combinedRangeDist(0, mCombinedRangeCount - 1);
 		for (unsigned i = 0; i < mCombinedRangeCount; ++i)
@@ -163,14 +399,19 @@ namespace omp {
 				// Randomize board and evaluate for current holecards.
 				Hand board = fixedBoard;
 				randomizeBoard(board, remainingCards, usedCardsMask, rng, cardDist);
-				evaluateHands(playerHands, nplayers, board, &stats, 1);
+				if (nplayers >= MIN_SIMD_SHOWDOWN_PLAYERS)
+					evaluateHandsSimd(playerHands, nplayers, board, &stats);
+				else
+					evaluateHands<tPlayers>(playerHands, nplayers, board, &stats, 1);
 
 				// Update results periodically.
 				if ((stats.evalCount & 0xfff) == 0) {
-					updateResults(stats, false);
+					updateResults(stats, false, task);
 					if (mStopped)
 						break;
-					stats = BatchResults(nplayers);
+					if (std::chrono::high_resolution_clock::now() >= sliceEnd)
+						return true;
+					stats.reset(nplayers);
 					// Occasionally do a full randomization, because in some rare cases the random walk might
 					// not be able to visit all preflop combinations by changing just one hand at a time.
 					// This shouldn't happen if MAX_COMBINED_RANGE_SIZE is big enough, but extra randomization never hurts.
@@ -200,7 +441,8 @@ namespace omp {
 			}
 		}
 
-		updateResults(stats, true);
+		updateResults(stats, true, task);
+		return false;
 	}
 
 	// Randomize holecards using rejection sampling. Returns false if maximum number of attempts was reached.
@@ -246,18 +488,22 @@ namespace omp {
 		}
 	}
 
-	// Evaluates a single showdown with one or more players and stores the result.
-	template<bool tFlushPossible>
+	// Evaluates a single showdown with one or more players and stores the result. The hand of player i is
+	// playerHands[i] + board, so playerHands can also include some of the board cards.
+	template<unsigned tPlayers, bool tFlushPossible>
 	void EquityCalculator::evaluateHands(const Hand* playerHands, unsigned nplayers, const Hand& board, BatchResults* stats,
 		unsigned weight)
 	{
-		omp_assert(board.count() == BOARD_CARDS);
+		nplayers = kernelPlayerCount<tPlayers>(nplayers);
+		omp_assert(nplayers == 0 || (board + playerHands[0]).count() == BOARD_CARDS + 2);
 		++stats->evalCount;
 		unsigned bestRank = 0;
 		unsigned winnersMask = 0;
+		bool shortDeck = mShortDeck;
 		for (unsigned i = 0, m = 1; i < nplayers; ++i, m <<= 1) {
 			Hand hand = board + playerHands[i];
-			unsigned rank = mEval.evaluate<tFlushPossible>(hand);
+			unsigned rank = shortDeck ? mShortDeckEval.evaluate<tFlushPossible>(hand)
+				: mEval.evaluate<tFlushPossible>(hand);
 			if (rank > bestRank) {
 				bestRank = rank;
 				winnersMask = m;
@@ -270,15 +516,32 @@ namespace omp {
 		stats->winsByPlayerMask[winnersMask] += weight;
 	}
 
-	// Calculates exact equities by enumerating through all possible combinations.
-	void EquityCalculator::enumerate()
+	// Same as evaluateHands(), but evaluates all the hands at once with HandEvaluatorT::evaluateWinners(). This is
+	// faster in the monte carlo simulations with many players. The enumeration evaluates partial boards and mostly
+	// non-flush rivers, and is faster with the scalar version.
+	void EquityCalculator::evaluateHandsSimd(const Hand* playerHands, unsigned nplayers, const Hand& board,
+		BatchResults* stats)
+	{
+		++stats->evalCount;
+		unsigned winnersMask = mShortDeck ? mShortDeckEval.evaluateWinners(board, playerHands, nplayers)
+			: mEval.evaluateWinners(board, playerHands, nplayers);
+		++stats->winsByPlayerMask[winnersMask];
+	}
+
+	// Calculates exact equities by enumerating through all possible combinations. Returns true if the time slice ended
+	// before the enumeration. The slice can only end between batches, so no reserved work is left undone.
+	template<unsigned tPlayers>
+	bool EquityCalculator::enumerate(TaskResults& task)
 	{
+		auto sliceEnd = std::chrono::high_resolution_clock::now() + TIME_SLICE;
 		uint64_t enumPosition = 0, enumEnd = 0;
 		uint64_t preflopCombos = getPreflopCombinationCount();
-		unsigned nplayers = (unsigned)mHandRanges.size();
+		unsigned postflopParts = mPostflopParts;
+		PostflopPart part;
+		part.count = postflopParts;
+		unsigned nplayers = kernelPlayerCount<tPlayers>((unsigned)mHandRanges.size());
 		BatchResults stats(nplayers);
 		UniqueRng64 urng(preflopCombos);
-		Hand fixedBoard = getBoardFromBitmask(mBoardCards);
 		libdivide::libdivide_u64_t fastDividers[MAX_PLAYERS];
 		unsigned combinedRangeCount = mCombinedRangeCount;
 		for (unsigned i = 0; i < combinedRangeCount; ++i)
@@ -290,20 +553,30 @@ namespace omp {
 
 		// Disable random preflop enumeration order if postflop is too small (bad for caching). It's also makes no sense
 		// if all the combos don't fit in the lookup table.
-		bool randomizeOrder = postflopCombos > 10000 && preflopCombos <= 2 * MAX_LOOKUP_SIZE;
+		size_t lookupCapacity = mLookup->maxBytes() / (mLookup->ENTRY_BYTES + (sizeof(unsigned) << nplayers));
+		bool randomizeOrder = postflopCombos > 10000 && preflopCombos <= 2 * lookupCapacity;
 
 		for (;; ++enumPosition) {
 			// Ask for more work if we don't have any.
 			if (enumPosition >= enumEnd) {
-				uint64_t batchSize = std::max<uint64_t>(2000000 / postflopCombos, 1);
+				if (std::chrono::high_resolution_clock::now() >= sliceEnd && !mStopped) {
+					if (stats.evalCount || stats.skippedPreflopCombos)
+						updateResults(stats, false, task);
+					return true;
+				}
+				uint64_t batchSize = std::max<uint64_t>(2000000 * postflopParts / postflopCombos, 1);
 				std::tie(enumPosition, enumEnd) = reserveBatch(batchSize);
 				if (enumPosition >= enumEnd)
 					break;
 			}
 
+			// Each preflop has postflopParts consecutive positions, one for each part of its postflop enumeration.
+			uint64_t preflopPosition = enumPosition / postflopParts;
+			part.index = (unsigned)(enumPosition % postflopParts);
+
 			// Use a quasi-RNG to randomize the preflop enumeration order, while still making sure
 			// every combo is evaluated once.
-			uint64_t randomizedEnumPos = randomizeOrder ? urng(enumPosition) : enumPosition;
+			uint64_t randomizedEnumPos = randomizeOrder ? urng(preflopPosition) : preflopPosition;
 
 			// Map enumeration index to actual hands and check duplicate card.
 			bool ok = true;
@@ -328,7 +601,8 @@ namespace omp {
 			}
 
 			if (!ok) {
-				++stats.skippedPreflopCombos; //TODO fix skipcount
+				if (part.index == 0)
+					++stats.skippedPreflopCombos; //TODO fix skipcount
 			}
 			else {
 				// Transform preflop into canonical form so that suit and player isomoprhism can be detected.
@@ -357,9 +631,12 @@ namespace omp {
 					for (unsigned j = 0; j < nplayers; ++j)
 						usedCardsMask |= (1ull << playerHands[j].cards[0]) | (1ull << playerHands[j].cards[1]);
 
-					// Get cached results if this combo has already been calculated.
-					uint64_t preflopId = calculateUniquePreflopId(playerHands, nplayers);
-					if (lookupResults(preflopId, stats)) {
+					// Get cached results if this combo has already been calculated. Every part finds the same results,
+					// so only the first one uses them. Results of a single part are not cached.
+					LookupKey key{ calculateUniquePreflopId(playerHands, nplayers), boardCards, deadCards, mShortDeck };
+					if (lookupResults(key, stats)) {
+						if (part.index != 0)
+							stats.reset(nplayers);
 						for (unsigned i = 0; i < nplayers; ++i)
 							stats.playerIds[i] = playerHands[i].playerIdx;
 						stats.evalCount = 0;
@@ -367,34 +644,88 @@ namespace omp {
 					}
 					else {
 						// Do full postflop enumeration.
-						++stats.uniquePreflopCombos;
-						Hand board = getBoardFromBitmask(boardCards);
-						enumerateBoard(playerHands, nplayers, board, usedCardsMask, &stats);
-						storeResults(preflopId, stats);
+						stats.uniquePreflopCombos += part.index == 0;
+						enumerateBoard<tPlayers>(playerHands, nplayers, boardCards, usedCardsMask, &stats, &part);
+						if (postflopParts == 1)
+							storeResults(key, stats);
 					}
 				}
 				else {
-					++stats.uniquePreflopCombos;
-					enumerateBoard(playerHands, nplayers, fixedBoard, usedCardsMask, &stats);
+					stats.uniquePreflopCombos += part.index == 0;
+					enumerateBoard<tPlayers>(playerHands, nplayers, mBoardCards, usedCardsMask, &stats, &part);
 				}
 			}
 
 			//TODO combine lookup results here so we don't need update so often
 			if (stats.evalCount >= 10000 || stats.skippedPreflopCombos >= 10000 || useLookup) {
-				updateResults(stats, false);
-				stats = BatchResults(nplayers);
+				updateResults(stats, false, task);
+				stats.reset(nplayers);
 				if (mStopped)
 					break;
 			}
 		}
 
-		updateResults(stats, true);
+		updateResults(stats, true, task);
+		return false;
 	}
 
-	// Starts the postflop enumeration.
+	// Heads-up enumeration that goes through the boards instead of the preflops. On each board every live combo of
+	// both players is evaluated once, and ShowdownSweep counts the showdowns between them. The work per board then
+	// grows with the number of combos instead of the number of preflops. Returns true if the time slice ended before
+	// the enumeration.
+	bool EquityCalculator::sweepShowdowns(TaskResults& task)
+	{
+		auto sliceEnd = std::chrono::high_resolution_clock::now() + TIME_SLICE;
+		BatchResults stats(2);
+		bool shortDeck = mShortDeck;
+
+		ShowdownSweep sweep;
+
+		for (;;) {
+			if (std::chrono::high_resolution_clock::now() >= sliceEnd && !mStopped)
+				return true;
+			uint64_t position, end;
+			std::tie(position, end) = reserveBatch(1);
+			if (position >= end)
+				break;
+
+			uint64_t boardCards = mSweepBoards[(size_t)position];
+			Hand board = getBoardFromBitmask(mBoardCards | boardCards);
+			sweep.clear();
+			for (unsigned i = 0; i < 2; ++i) {
+				for (const std::array<uint8_t, 2>& cards : mHandRanges[i]) {
+					if (boardCards & (1ull << cards[0] | 1ull << cards[1]))
+						continue;
+					Hand hand = board + cards[0] + cards[1];
+					unsigned rank = shortDeck ? mShortDeckEval.evaluate(hand) : mEval.evaluate(hand);
+					sweep.add(i, rank, cards[0], cards[1]);
+				}
+			}
+			uint64_t wins[2], ties;
+			sweep.count(wins, ties);
+
+			stats.reset(2);
+			stats.evalCount = sweep.size();
+			stats.winsByPlayerMask[1] = (unsigned)wins[0];
+			stats.winsByPlayerMask[2] = (unsigned)wins[1];
+			stats.winsByPlayerMask[3] = (unsigned)ties;
+			updateResults(stats, false, task);
+			if (mStopped)
+				break;
+		}
+
+		stats.reset(2);
+		updateResults(stats, true, task);
+		return false;
+	}
+
+	// Starts the postflop enumeration, or the given part of it.
+	template<unsigned tPlayers>
 	void EquityCalculator::enumerateBoard(const HandWithPlayerIdx* playerHands, unsigned nplayers,
-		const Hand& board, uint64_t usedCardsMask, BatchResults* stats)
+		uint64_t boardCards, uint64_t usedCardsMask, BatchResults* stats, PostflopPart* part)
 	{
+		nplayers = kernelPlayerCount<tPlayers>(nplayers);
+		Hand board = getBoardFromBitmask(boardCards);
 		Hand hands[MAX_PLAYERS];
 		for (unsigned i = 0; i < nplayers; ++i)
 			hands[i] = Hand(playerHands[i].cards);
@@ -402,7 +733,7 @@ namespace omp {
 		// Take a shortcut when no board cards left to iterate.
 		unsigned remainingCards = BOARD_CARDS - board.count();
 		if (remainingCards == 0) {
-			evaluateHands(hands, nplayers, board, stats, 1);
+			evaluateHands<tPlayers>(hands, nplayers, board, stats, 1);
 			return;
 		}
 
@@ -411,7 +742,7 @@ namespace omp {
 		// unlikely to be due to caching, because reversing the evaluator's rank multipliers has no effect.
 		unsigned deck[CARD_COUNT];
 		unsigned ndeck = 0;
-		for (unsigned c = CARD_COUNT; c-- > 0;) {
+		for (unsigned c = CARD_COUNT; c-- > firstCard();) {
 			if (!(usedCardsMask & (1ull << c)))
 				deck[ndeck++] = c;
 		}
@@ -430,151 +761,240 @@ namespace omp {
 		for (unsigned i = 0; i < SUIT_COUNT; ++i)
 			suitCounts[i] += board.suitCount(i);
 
-		enumerateBoardRec(hands, nplayers, stats, board, deck, ndeck, suitCounts, remainingCards, 0, 1);
+		// Suits are interchangeable when swapping them changes neither the hands of the players nor the board or the
+		// dead cards, i.e. when they have the same ranks in each of them. Every class of interchangeable suits is
+		// identified by its first suit.
+		auto sameRanks = [](uint64_t cards, unsigned suit1, unsigned suit2) {
+			return ((cards >> suit1 ^ cards >> suit2) & 0x1111111111111ull) == 0;
+		};
+		auto interchangeable = [&](unsigned suit1, unsigned suit2) {
+			if (!sameRanks(usedCardsMask, suit1, suit2) || !sameRanks(boardCards, suit1, suit2))
+				return false;
+			for (unsigned i = 0; i < nplayers; ++i) {
+				uint64_t holeCards = (1ull << playerHands[i].cards[0]) | (1ull << playerHands[i].cards[1]);
+				if (!sameRanks(holeCards, suit1, suit2))
+					return false;
+			}
+			return true;
+		};
+		unsigned suitClasses[SUIT_COUNT];
+		for (unsigned suit = 0; suit < SUIT_COUNT; ++suit) {
+			suitClasses[suit] = suit;
+			for (unsigned suit2 = 0; suit2 < suit; ++suit2) {
+				if (suitClasses[suit2] == suit2 && interchangeable(suit, suit2)) {
+					suitClasses[suit] = suit2;
+					break;
+				}
+			}
+		}
+
+		unsigned splitLevels = 0;
+		if (part && part->count > 1) {
+			splitLevels = mPostflopSplitLevels;
+			part->subtree = 0;
+		}
+		omp_assert(splitLevels < remainingCards);
+		enumerateBoardRec<tPlayers>(hands, nplayers, stats, board, deck, ndeck, suitCounts, suitClasses, remainingCards,
+			0, 1, part, splitLevels);
 	}
 
 	// Enumerates board cards recursively. Detects some isomorphic subtrees by looking at the number of cards for
 	// each suit. Suits that cannot create a flush anymore (called here "irrelevant suits") are handled at the same time,
-	// which gives roughly a speedup of 3x.
+	// which gives roughly a speedup of 3x. Cards of the same rank in interchangeable suits (suitClasses) are handled at
+	// the same time too. Choosing some of them splits their class into the chosen and the other suits.
+	// When splitLevels > 0, only the subtrees of the current part are enumerated. The subtrees on the first splitLevels
+	// levels are numbered in enumeration order and distributed between the parts round-robin. Every part goes through
+	// the same levels in the same order, so the numbering is the same in all of them.
+	template<unsigned tPlayers>
 	void EquityCalculator::enumerateBoardRec(const Hand* playerHands, unsigned nplayers, BatchResults* stats,
-		const Hand& board, unsigned* deck, unsigned ndeck, unsigned* suitCounts,
-		unsigned cardsLeft, unsigned start, unsigned weight)
+		const Hand& board, unsigned* deck, unsigned ndeck, unsigned* suitCounts, const unsigned* suitClasses,
+		unsigned cardsLeft, unsigned start, unsigned weight, PostflopPart* part, unsigned splitLevels)
 	{
+		nplayers = kernelPlayerCount<tPlayers>(nplayers);
+		// Cards of the same rank give isomorphic subtrees if their suits are in the same group: either all irrelevant
+		// (group SUIT_COUNT) or in the same class of interchangeable suits.
+		unsigned suitGroups[SUIT_COUNT], groupSizes[SUIT_COUNT + 1];
+		auto findSuitGroups = [&]() {
+			std::fill(groupSizes, groupSizes + SUIT_COUNT + 1, 0);
+			for (unsigned suit = 0; suit < SUIT_COUNT; ++suit) {
+				suitGroups[suit] = suitCounts[suit] + cardsLeft < 5 ? SUIT_COUNT : suitClasses[suit];
+				++groupSizes[suitGroups[suit]];
+			}
+		};
+
 		// More efficient version for the innermost loop.
 		if (cardsLeft == 1)
 		{
-			// Even simpler version for non-flush rivers.
+			// The other board cards are the same for every river, so they are added to the players' hands only once
+			// and each river just adds its own card.
+			Hand turnHands[MAX_PLAYERS];
+			for (unsigned i = 0; i < nplayers; ++i)
+				turnHands[i] = board + playerHands[i];
+
+			// Even simpler version for non-flush rivers. Evaluating the river ranks of each player 8 at a time with
+			// AVX2 gathers isn't faster than this loop, see benchmarkRiverLoop() in examples/benchmark.cpp.
 			if (suitCounts[0] < 4 && suitCounts[1] < 4 && suitCounts[2] < 4 && suitCounts[3] < 4) {
 				for (unsigned i = start; i < ndeck; ) {
 					unsigned multiplier = 1;
 
-					Hand newBoard = board + deck[i];
+					Hand river(deck[i]);
 
 					// Count how many cards there are with same rank.
 					unsigned rank = deck[i] >> 2;
 					for (++i; i < ndeck && deck[i] >> 2 == rank; ++i)
 						++multiplier;
 
-					evaluateHands<false>(playerHands, nplayers, newBoard, stats, multiplier * weight);
+					evaluateHands<tPlayers, false>(turnHands, nplayers, river, stats, multiplier * weight);
 				}
 			}
 			else {
-				unsigned lastRank = ~0;
+				// Since this is last card there's no need to do reorder deck cards; we just count the cards in the
+				// same group and rank and evaluate the first one.
+				findSuitGroups();
+				unsigned lastRank = ~0, doneGroups = 0;
 				for (unsigned i = start; i < ndeck; ++i) {
 					unsigned multiplier = 1;
 
-					if (suitCounts[deck[i] & 3] < 4) {
+					unsigned group = suitGroups[deck[i] & 3];
+					if (groupSizes[group] > 1) {
 						unsigned rank = deck[i] >> 2;
-						if (rank == lastRank)
+						if (rank != lastRank) {
+							lastRank = rank;
+							doneGroups = 0;
+						}
+						if (doneGroups & (1 << group))
 							continue;
-						// Since this is last card there's no need to do reorder deck cards; we just count the
-						// irrelevant suits in current rank.
+						doneGroups |= 1 << group;
 						for (unsigned j = i + 1; j < ndeck && deck[j] >> 2 == rank; ++j) {
-							if (suitCounts[deck[j] & 3] < 4)
+							if (suitGroups[deck[j] & 3] == group)
 								++multiplier;
 						}
-						lastRank = rank;
 					}
 
-					Hand newBoard = board + deck[i];
-					evaluateHands(playerHands, nplayers, newBoard, stats, multiplier * weight);
+					evaluateHands<tPlayers>(turnHands, nplayers, Hand(deck[i]), stats, multiplier * weight);
 				}
 			}
 			return;
 		}
 
+		// Subtrees that are split further on the next levels are enumerated by every part. Showdowns and the river loop
+		// can't be split, so they count as a single subtree.
+		auto childSplitLevels = [&](unsigned childCardsLeft) {
+			return splitLevels > 1 && childCardsLeft > 1 ? std::min(splitLevels - 1, childCardsLeft - 1) : 0;
+		};
+		auto skipSubtree = [&](unsigned childCardsLeft) {
+			if (splitLevels == 0 || childSplitLevels(childCardsLeft) > 0)
+				return false;
+			return part->subtree++ % part->count != part->index;
+		};
+		// Subtrees reorder the cards of the deck, which would change the numbering of the following subtrees in the
+		// parts that skip them, so on split levels they get their own copy.
+		auto childDeck = [&]() {
+			if (splitLevels == 0)
+				return deck;
+			unsigned* copy = part->decks[splitLevels - 1];
+			std::copy(deck, deck + ndeck, copy);
+			return copy;
+		};
+
 		// General version.
+		findSuitGroups();
 		for (unsigned i = start; i < ndeck; ++i) {
 			Hand newBoard = board;
 
 			unsigned suit = deck[i] & 3;
+			unsigned group = suitGroups[suit];
+			bool irrelevant = group == SUIT_COUNT;
 
-			if (suitCounts[suit] + cardsLeft < 5) {
-				unsigned irrelevantCount = 1;
+			// Go through all the cards with same rank (they're always consecutive) and find the others in the same
+			// group. Move them right after this card so they don't get used again.
+			unsigned groupCount = 1;
+			if (groupSizes[group] > 1) {
 				unsigned rank = deck[i] >> 2;
-
-				// Go through all the cards with same rank (they're always consecutive) and count the irrelevat suits.
 				for (unsigned j = i + 1; j < ndeck && deck[j] >> 2 == rank; ++j) {
-					unsigned suit2 = deck[j] & 3;
-					if (suitCounts[suit2] + cardsLeft < 5) {
-						// Move all the irrelevant suits before other suits so they don't get used again.
-						if (j != i + irrelevantCount)
-							std::swap(deck[j], deck[i + irrelevantCount]);
-						++irrelevantCount;
+					if (suitGroups[deck[j] & 3] == group) {
+						if (j != i + groupCount)
+							std::swap(deck[j], deck[i + groupCount]);
+						++groupCount;
 					}
 				}
+			}
 
-				// When there are multiple cards with irrelevant suits we have to choose how many of them to use,
-				// and the number of isomorphic subtrees depends on it.
-				for (unsigned repeats = 1; repeats <= std::min(irrelevantCount, cardsLeft); ++repeats) {
-					static const unsigned BINOM_COEFF[5][5] = { {0}, {0, 1}, {1, 2, 1}, {1, 3, 3, 1}, {1, 4, 6, 4, 1} };
-					unsigned newWeight = BINOM_COEFF[irrelevantCount][repeats] * weight;
-					newBoard += deck[i + repeats - 1];
-					if (repeats == cardsLeft)
-						evaluateHands(playerHands, nplayers, newBoard, stats, newWeight);
-					else
-						enumerateBoardRec(playerHands, nplayers, stats, newBoard, deck, ndeck, suitCounts,
-							cardsLeft - repeats, i + irrelevantCount, newWeight);
+			// When there are multiple cards in the group we have to choose how many of them to use, and the number of
+			// isomorphic subtrees depends on it.
+			unsigned maxRepeats = std::min(groupCount, cardsLeft);
+			for (unsigned repeats = 1; repeats <= maxRepeats; ++repeats) {
+				static const unsigned BINOM_COEFF[5][5] = { {0}, {0, 1}, {1, 2, 1}, {1, 3, 3, 1}, {1, 4, 6, 4, 1} };
+				unsigned newWeight = BINOM_COEFF[groupCount][repeats] * weight;
+				unsigned card = deck[i + repeats - 1];
+				newBoard += card;
+				if (!irrelevant)
+					++suitCounts[card & 3];
+				if (skipSubtree(cardsLeft - repeats))
+					continue;
+				if (repeats == cardsLeft) {
+					evaluateHands<tPlayers>(playerHands, nplayers, newBoard, stats, newWeight);
+					continue;
 				}
 
-				i += irrelevantCount - 1;
+				// The chosen suits are no longer interchangeable with the others.
+				unsigned childClasses[SUIT_COUNT];
+				const unsigned* newClasses = suitClasses;
+				if (repeats < groupCount && !irrelevant) {
+					std::copy(suitClasses, suitClasses + SUIT_COUNT, childClasses);
+					for (unsigned j = 0; j < groupCount; ++j)
+						childClasses[deck[i + j] & 3] = j < repeats ? suit : deck[i + repeats] & 3;
+					newClasses = childClasses;
+				}
+				enumerateBoardRec<tPlayers>(playerHands, nplayers, stats, newBoard, childDeck(), ndeck, suitCounts,
+					newClasses, cardsLeft - repeats, i + groupCount, newWeight, part,
+					childSplitLevels(cardsLeft - repeats));
 			}
-			else {
-				newBoard += deck[i];
-				++suitCounts[suit];
-				enumerateBoardRec(playerHands, nplayers, stats, newBoard, deck, ndeck, suitCounts,
-					cardsLeft - 1, i + 1, weight);
-				--suitCounts[suit];
+
+			if (!irrelevant) {
+				for (unsigned j = 0; j < maxRepeats; ++j)
+					--suitCounts[deck[i + j] & 3];
 			}
+			i += groupCount - 1;
 		}
 	}
 
 	// Lookup cached results for particular preflop.
-	bool EquityCalculator::lookupResults(uint64_t preflopId, BatchResults& results)
+	bool EquityCalculator::lookupResults(const LookupKey& key, BatchResults& results)
 	{
-		if (!mDeadCards && !mBoardCards && lookupPrecalculatedResults(preflopId, results))
+		if (!key.deadCards && !key.boardCards && !key.shortDeck && lookupPrecalculatedResults(key.preflopId, results))
 			return true;
 
-		std::lock_guard<std::mutex> lock(mMutex);
-		auto it = mLookup.find(preflopId);
-		if (it != mLookup.end())
-			results = it->second;
-		return it != mLookup.end();
+		unsigned* wins = results.winsByPlayerMask;
+		return mLookup->find(key, [wins](const std::vector<unsigned>& cached) {
+			std::copy(cached.begin(), cached.end(), wins);
+		});
 	}
 
-	// Lookup precalculated results.
+	// Lookup precalculated results. The table covers every canonical heads-up preflop (ids h1 * 1327 + h2), so the
+	// lookup is a perfect hash like in HandEvaluator.
 	bool EquityCalculator::lookupPrecalculatedResults(uint64_t preflopId, BatchResults& results) const
 	{
-		struct Cmp
-		{
-			// Need two overloads because of the asymmetry.
-			bool operator()(uint32_t preflopId, uint64_t a) { return preflopId < (a & 0x3fffff); }
-			bool operator()(uint64_t a, uint32_t preflopId) { return (a & 0x1fffff) < preflopId; }
-		};
-
-		// Binary search.
-		auto it = std::lower_bound(PRECALCULATED_2PLAYER_RESULTS.begin(), PRECALCULATED_2PLAYER_RESULTS.end(),
-			(uint32_t)preflopId, Cmp());
-		if (it == PRECALCULATED_2PLAYER_RESULTS.end() || (*it & 0x3fffff) != preflopId)
+		if (preflopId <= COMBO_COUNT + 1 || preflopId >= (uint64_t)(COMBO_COUNT + 1) * (COMBO_COUNT + 1))
 			return false;
+		size_t idx = PRECALCULATED_2PLAYER_ROW_OFFSETS[preflopId >> PRECALCULATED_2PLAYER_ROW_SHIFT]
+			+ (preflopId & PRECALCULATED_2PLAYER_COLUMN_MASK);
+		const uint16_t* entry = PRECALCULATED_2PLAYER_RESULTS + 3 * idx;
+		uint64_t packed = entry[0] | (uint64_t)entry[1] << 16 | (uint64_t)entry[2] << 32;
 
 		// Unpack results.
-		results.winsByPlayerMask[1] = (*it >> 22) & 0x1fffff;
-		results.winsByPlayerMask[3] = (*it >> 43) & 0x1fffff;
+		results.winsByPlayerMask[1] = packed & 0x1fffff;
+		results.winsByPlayerMask[3] = (packed >> 21) & 0x1fffff;
 		results.winsByPlayerMask[2] = 1712304 - results.winsByPlayerMask[1] - results.winsByPlayerMask[3];
 
 		return true;
 	}
 
-	// Store results for one preflop in the lookup table.
-	void EquityCalculator::storeResults(uint64_t preflopId, const BatchResults& results)
+	// Store results for one preflop in the lookup table. Only the counters of the current player count are stored.
+	void EquityCalculator::storeResults(const LookupKey& key, const BatchResults& results)
 	{
-		std::lock_guard<std::mutex> lock(mMutex); //TODO read-write lock
-		mLookup.emplace(preflopId, results);
-		// Make sure the hash map doesn't eat all memory. Not a great way of doing it but the lookup
-		// table is quite useless with that many preflop combos anyway.
-		if (mLookup.size() >= MAX_LOOKUP_SIZE)
-			mLookup.clear();
+		const unsigned* wins = results.winsByPlayerMask;
+		mLookup->insert(key, std::vector<unsigned>(wins, wins + (1u << mHandRanges.size())));
 	}
 
 	// Transforms suits in such way that suit isomorphism can be easily detected. Goes through all the holecards, board
@@ -668,14 +1088,9 @@ namespace omp {
 	// Work allocation for enumeration threads.
 	std::pair<uint64_t, uint64_t> EquityCalculator::reserveBatch(uint64_t batchCount)
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
-
-		uint64_t totalBatchCount = getPreflopCombinationCount();
-		uint64_t start = mEnumPosition;
-		uint64_t end = std::min<uint64_t>(totalBatchCount, mEnumPosition + batchCount);
-		mEnumPosition = end;
-
-		return { start, end };
+		uint64_t totalBatchCount = getEnumerationSize();
+		uint64_t start = mEnumPosition.fetch_add(batchCount);
+		return { std::min(start, totalBatchCount), std::min(start + batchCount, totalBatchCount) };
 	}
 
 	// Number of different preflops with given hand ranges, assuming no conflicts between players' hands.
@@ -687,12 +1102,20 @@ namespace omp {
 		return combos;
 	}
 
+	// Number of enumeration positions: the parts of each preflop, or the boards of a sweep.
+	uint64_t EquityCalculator::getEnumerationSize()
+	{
+		if (!mSweepBoards.empty())
+			return mSweepBoards.size();
+		return getPreflopCombinationCount() * mPostflopParts;
+	}
+
 	// Calculates size of the postflop tree, i.e. n choose k, where n is remaining deck size and k is number
 	// of undealt board cards.
 	uint64_t EquityCalculator::getPostflopCombinationCount()
 	{
 		omp_assert(bitCount(mBoardCards) <= BOARD_CARDS);
-		unsigned cardsInDeck = CARD_COUNT;
+		unsigned cardsInDeck = CARD_COUNT - firstCard();
 		cardsInDeck -= bitCount(mDeadCards | mBoardCards);
 		cardsInDeck -= 2 * (unsigned)mHandRanges.size();
 		unsigned boardCardsRemaining = BOARD_CARDS - bitCount(mBoardCards);
@@ -704,93 +1127,140 @@ namespace omp {
 		return postflopCombos;
 	}
 
-	// Results aggregation for both enumeration and monte carlo.
-	void EquityCalculator::updateResults(const BatchResults& stats, bool threadFinished)
+	// Results aggregation for both enumeration and monte carlo. The batch is added to the task's own results, so tasks
+	// don't wait for each other. The task that notices that an update is due collects the results of all tasks, unless
+	// another task is already doing it. The last task to finish always does the final update.
+	void EquityCalculator::updateResults(const BatchResults& stats, bool taskFinished, TaskResults& task)
 	{
-		auto t = std::chrono::high_resolution_clock::now();
-
-		std::lock_guard<std::mutex> lock(mMutex);
-
-		double batchEquity = combineResults(stats);
-
-		// Store values for stdev calculation
-		if (!threadFinished) {
-			mBatchSum += batchEquity;
-			mBatchSumSqr += batchEquity * batchEquity;
-			mBatchCount += 1;
+		uint64_t batchHands;
+		{
+			std::lock_guard<std::mutex> lock(task.mutex);
+			uint64_t previousHands = task.hands;
+			double batchEquity = combineResults(stats, task);
+			batchHands = task.hands - previousHands;
+
+			// Store values for stdev calculation
+			if (!taskFinished) {
+				task.batchSum += batchEquity;
+				task.batchSumSqr += batchEquity * batchEquity;
+				task.batchCount += 1;
+			}
 		}
 
-		mResults.finished = threadFinished && --mUnfinishedThreads == 0;
-
-		double dt = 1e-9 * std::chrono::duration_cast<std::chrono::nanoseconds>(t - mLastUpdate).count();
-		//std::cout << mResults.hands << " " << mHandLimit << std::endl;
-		if (mResults.time + dt >= mTimeLimit || mResults.hands + mResults.intervalHands >= mHandLimit)
+		auto t = std::chrono::high_resolution_clock::now();
+		double elapsed = 1e-9 * std::chrono::duration_cast<std::chrono::nanoseconds>(t - mStartTime).count();
+		uint64_t hands = mHandCount.fetch_add(batchHands) + batchHands;
+		if (elapsed >= mTimeLimit || hands >= mHandLimit)
 			mStopped = true;
 
-		// Periodic update through callback.
-		if (dt >= mUpdateInterval || mResults.finished) {
-			mResults.intervalTime = dt;
-			mResults.time += mResults.intervalTime;
-			mResults.hands += mResults.intervalHands;
-			mResults.intervalSpeed = mResults.intervalHands / (mResults.intervalTime + 1e-9);
-			mResults.speed = mResults.hands / (mResults.time + 1e-9);
-			mResults.intervalHands = 0;
-			mResults.stdev = std::sqrt(1e-9 + mBatchSumSqr - mBatchSum * mBatchSum / mBatchCount) / mBatchCount;
-			mResults.stdevPerHand = mResults.stdev * std::sqrt(mResults.hands);
-			if (mResults.enumerateAll) {
-				mResults.progress = (double)mEnumPosition / getPreflopCombinationCount();
+		if (taskFinished) {
+			if (--mUnfinishedTasks == 0) {
+				std::lock_guard<std::mutex> lock(mMutex);
+				reportResults(t, true);
+				mRunning = false;
+				mFinished.notify_all();
 			}
-			else {
-				double estimatedHands = std::pow(mResults.stdev / mStdevTarget, 2) * mResults.hands;
-				mResults.progress = mResults.hands / estimatedHands;
+		}
+		else if (elapsed >= mNextUpdate.load(std::memory_order_relaxed)) {
+			// Periodic update through callback.
+			std::unique_lock<std::mutex> lock(mMutex, std::try_to_lock);
+			if (lock.owns_lock() && elapsed >= mNextUpdate)
+				reportResults(t, false);
+		}
+
+		//if (finished)
+		//    outputLookupTable();
+	}
+
+	// Collects the results of all tasks into mResults, publishes them and calls the callback. mMutex must be locked.
+	void EquityCalculator::reportResults(std::chrono::high_resolution_clock::time_point t, bool finished)
+	{
+		unsigned players = mResults.players;
+		uint64_t hands = 0;
+		double batchSum = 0, batchSumSqr = 0, batchCount = 0;
+		std::fill(mResults.wins, mResults.wins + players, 0);
+		std::fill(mResults.ties, mResults.ties + players, 0);
+		std::fill(mResults.winsByPlayerMask, mResults.winsByPlayerMask + (1u << players), 0);
+		mResults.evaluations = mResults.skippedPreflopCombos = mResults.evaluatedPreflopCombos = 0;
+		for (unsigned i = 0; i < mTaskCount; ++i) {
+			TaskResults& task = mTaskResults[i];
+			std::lock_guard<std::mutex> lock(task.mutex);
+			for (unsigned j = 0; j < players; ++j) {
+				mResults.wins[j] += task.wins[j];
+				mResults.ties[j] += task.ties[j];
 			}
-			mResults.preflopCombos = getPreflopCombinationCount();
+			for (unsigned j = 0; j < (1u << players); ++j)
+				mResults.winsByPlayerMask[j] += task.winsByPlayerMask[j];
+			hands += task.hands;
+			mResults.evaluations += task.evaluations;
+			mResults.skippedPreflopCombos += task.skippedPreflopCombos;
+			mResults.evaluatedPreflopCombos += task.evaluatedPreflopCombos;
+			batchSum += task.batchSum;
+			batchSumSqr += task.batchSumSqr;
+			batchCount += task.batchCount;
+		}
 
-			if (!mResults.enumerateAll && mResults.stdev < mStdevTarget) //TODO use max stdev of any player
-				mStopped = true;
+		mResults.finished = finished;
+		mResults.intervalTime = 1e-9 * std::chrono::duration_cast<std::chrono::nanoseconds>(t - mLastUpdate).count();
+		mResults.time += mResults.intervalTime;
+		mResults.intervalHands = hands - mResults.hands;
+		mResults.hands = hands;
+		mResults.intervalSpeed = mResults.intervalHands / (mResults.intervalTime + 1e-9);
+		mResults.speed = mResults.hands / (mResults.time + 1e-9);
+		mResults.stdev = std::sqrt(1e-9 + batchSumSqr - batchSum * batchSum / batchCount) / batchCount;
+		mResults.stdevPerHand = mResults.stdev * std::sqrt(mResults.hands);
+		if (mResults.enumerateAll) {
+			mResults.progress = std::min(1.0, (double)mEnumPosition.load() / getEnumerationSize());
+		}
+		else {
+			double estimatedHands = std::pow(mResults.stdev / mStdevTarget, 2) * mResults.hands;
+			mResults.progress = mResults.hands / estimatedHands;
+		}
+		mResults.preflopCombos = getPreflopCombinationCount();
 
-			for (unsigned i = 0; i < mResults.players; ++i)
-				mResults.equity[i] = (mResults.wins[i] + mResults.ties[i]) / (mResults.hands + 1e-9);
+		//TODO use max stdev of any player
+		if (!mResults.enumerateAll && batchCount >= MIN_STDEV_BATCHES && mResults.stdev < mStdevTarget)
+			mStopped = true;
 
-			mUpdateResults = mResults;
+		for (unsigned i = 0; i < players; ++i)
+			mResults.equity[i] = (mResults.wins[i] + mResults.ties[i]) / (mResults.hands + 1e-9);
 
-			if (mCallback)
-				mCallback(mResults);
+		mUpdateResults = mResults;
 
-			mLastUpdate = t;
-		}
+		if (mCallback)
+			mCallback(mResults);
 
-		//if (finished)
-		//    outputLookupTable();
+		mLastUpdate = t;
+		mNextUpdate = mResults.time + mUpdateInterval;
 	}
 
-	// Sum batch results in the main results structure.
-	double EquityCalculator::combineResults(const BatchResults& batch)
+	// Sum batch results in the results of a task.
+	double EquityCalculator::combineResults(const BatchResults& batch, TaskResults& task)
 	{
 		uint64_t batchHands = 0;
 		double batchEquity = 0;
+		unsigned players = mResults.players;
 
-		for (unsigned i = 0; i < (1u << mResults.players); ++i) 
+		for (unsigned i = 0; i < (1u << players); ++i) 
 		{
-			mResults.intervalHands += batch.winsByPlayerMask[i];
 			batchHands += batch.winsByPlayerMask[i];
 			unsigned winnerCount = bitCount(i);
 			unsigned actualPlayerMask = 0;
 
-			for (unsigned j = 0; j < mResults.players; ++j) 
+			for (unsigned j = 0; j < players; ++j) 
 			{
 				if (i & (1 << j)) 
 				{
 					if (winnerCount == 1) 
 					{
-						mResults.wins[batch.playerIds[j]] += batch.winsByPlayerMask[i];
+						task.wins[batch.playerIds[j]] += batch.winsByPlayerMask[i];
 
 						if (batch.playerIds[j] == 0)
 							batchEquity += batch.winsByPlayerMask[i];
 					}
 					else 
 					{
-						mResults.ties[batch.playerIds[j]] += batch.winsByPlayerMask[i];
+						task.ties[batch.playerIds[j]] += batch.winsByPlayerMask[i];
 
 						if (batch.playerIds[j] == 0)
 							batchEquity += batch.winsByPlayerMask[i] / (double)winnerCount;
@@ -800,40 +1270,94 @@ namespace omp {
 				}
 			}
 
-			mResults.winsByPlayerMask[actualPlayerMask] += batch.winsByPlayerMask[i];
+			task.winsByPlayerMask[actualPlayerMask] += batch.winsByPlayerMask[i];
 		}
 
-		mResults.evaluations += batch.evalCount;
-		mResults.skippedPreflopCombos += batch.skippedPreflopCombos;
-		mResults.evaluatedPreflopCombos += batch.uniquePreflopCombos;
+		task.hands += batchHands;
+		task.evaluations += batch.evalCount;
+		task.skippedPreflopCombos += batch.skippedPreflopCombos;
+		task.evaluatedPreflopCombos += batch.uniquePreflopCombos;
 
 		return batchEquity / (batchHands + 1e-9);
 	}
 
-	// Helper function for printing out precalculated lookup tables.
+	// Helper function for printing out precalculated lookup tables. Only heads-up results are output, so this should
+	// be run after enumerating random vs random. The ids are divided into rows which are then fitted into the table
+	// densest first at the first offset that doesn't collide with previous rows (same as the evaluator's perfect hash).
 	void EquityCalculator::outputLookupTable() const
 	{
-		std::vector<std::array<unsigned, 3>> a;
-		for (auto& e : mLookup) {
-			a.push_back({ (unsigned)e.first, (unsigned)e.second.winsByPlayerMask[1],
-						 (unsigned)e.second.winsByPlayerMask[3] });
-		}
-		std::sort(a.begin(), a.end(), [](const std::array<unsigned, 3>& lhs, const std::array<unsigned, 3>& rhs) {
-			return lhs[0] < rhs[0];
+		std::vector<std::pair<size_t, std::vector<std::pair<unsigned, uint64_t>>>> rows(
+			((COMBO_COUNT + 1) * (COMBO_COUNT + 1) >> PRECALCULATED_2PLAYER_ROW_SHIFT) + 1);
+		for (size_t i = 0; i < rows.size(); ++i)
+			rows[i].first = i;
+		mLookup->forEach([&](const LookupKey& key, const std::vector<unsigned>& wins) {
+			uint64_t preflopId = key.preflopId;
+			if (key.boardCards || key.deadCards || key.shortDeck || preflopId <= COMBO_COUNT + 1 || preflopId >= (uint64_t)(COMBO_COUNT + 1) * (COMBO_COUNT + 1)
+				|| wins.size() != 4)
+				return;
+			uint64_t packed = wins[1] | (uint64_t)wins[3] << 21;
+			rows[preflopId >> PRECALCULATED_2PLAYER_ROW_SHIFT].second.emplace_back(
+				(unsigned)(preflopId & PRECALCULATED_2PLAYER_COLUMN_MASK), packed);
+		});
+
+		std::vector<uint16_t> offsets(rows.size());
+		std::stable_sort(rows.begin(), rows.end(), [](const std::pair<size_t, std::vector<std::pair<unsigned, uint64_t>>>& lhs,
+			const std::pair<size_t, std::vector<std::pair<unsigned, uint64_t>>>& rhs) {
+			return lhs.second.size() > rhs.second.size();
 		});
 
-		std::cout << std::hex;
-		for (size_t i = 0; i < a.size(); ++i) {
-			if (i % 6 == 0)
-				std::cout << std::endl;
-			std::cout << " 0x" << ((uint64_t)a[i][0] | (uint64_t)a[i][1] << 22 | (uint64_t)a[i][2] << 43) << ",";
+		std::vector<uint64_t> table;
+		std::vector<bool> used;
+		for (auto& row : rows) {
+			if (row.second.empty())
+				break;
+			size_t offset = 0;
+			for (;; ++offset) {
+				bool ok = true;
+				for (auto& e : row.second) {
+					if (e.first + offset < used.size() && used[e.first + offset]) {
+						ok = false;
+						break;
+					}
+				}
+				if (ok)
+					break;
+			}
+			offsets[row.first] = (uint16_t)offset;
+			for (auto& e : row.second) {
+				if (e.first + offset >= table.size()) {
+					table.resize(e.first + offset + 1);
+					used.resize(e.first + offset + 1);
+				}
+				table[e.first + offset] = e.second;
+				used[e.first + offset] = true;
+			}
 		}
-		std::cout << std::endl;
+
+		// Trailing zeros are left out because they get zero-initialized anyway.
+		size_t offsetCount = offsets.size();
+		while (offsetCount > 0 && offsets[offsetCount - 1] == 0)
+			--offsetCount;
+
+		std::cout << "#include \"EquityCalculator.h\"" << std::endl << std::endl;
+		std::cout << "// Precalculated heads-up preflop results. Generated by EquityCalculator::outputLookupTable()." << std::endl;
+		std::cout << "// Table size: " << table.size() << std::endl;
+		std::cout << "const uint16_t omp::EquityCalculator::PRECALCULATED_2PLAYER_ROW_OFFSETS[] {";
+		for (size_t i = 0; i < offsetCount; ++i) {
+			if (i % 16 == 0)
+				std::cout << std::endl << "   ";
+			std::cout << " " << offsets[i] << ",";
+		}
+		std::cout << std::endl << "};" << std::endl << std::endl;
+		std::cout << "const uint16_t omp::EquityCalculator::PRECALCULATED_2PLAYER_RESULTS[] {" << std::hex;
+		for (size_t i = 0; i < table.size(); ++i) {
+			if (i % 4 == 0)
+				std::cout << std::endl << "   ";
+			for (unsigned j = 0; j < 3; ++j)
+				std::cout << " 0x" << ((table[i] >> 16 * j) & 0xffff) << ",";
+		}
+		std::cout << std::dec << std::endl << "};" << std::endl;
 		std::cout.flush();
 	}
 
-	//Not used atm.
-	const std::vector<uint64_t> EquityCalculator::PRECALCULATED_2PLAYER_RESULTS{
-	};
-
 }
@@ -7,19 +7,24 @@
 #include "HandEvaluator.h"
 #include "Constants.h"
 #include "Util.h"
+#include "ThreadPool.h"
+#include "LookupCache.h"
 #include <chrono>
-#include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
-#include <unordered_map>
+#include <memory>
 #include <array>
+#include <vector>
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 
 namespace omp {
 
 // Calculates all-in equities in Texas Holdem for given player hand ranges, board cards and dead cards. Supports both
-// exact enumeration and monte carlo simulation.
+// exact enumeration and monte carlo simulation, with a normal deck or a short deck (6+). The calculations run in the
+// process-wide ThreadPool, so concurrent calculators share the same threads.
 class EquityCalculator
 {
 public:
@@ -71,39 +76,93 @@ public:
     // stdevTarget: stops monte carlo when standard deviation is smaller than this, use 0 for infinite simulation
     // callback: function that is called periodically with incomplete results
     // updateInterval: how often callback is called
-    // threadCount: number of threads to spawn, 0 for maximum parallelism supported by hardware
+    // threadCount: number of tasks to run in parallel, 0 for one per thread in the pool
     bool start(const std::vector<CardRange>& handRanges, uint64_t boardCards = 0, uint64_t deadCards = 0,
                bool enumerateAll = false, double stdevTarget = 5e-5,
                std::function<void(const Results&)> callback = nullptr,
                double updateInterval = 0.2, unsigned threadCount = 0);
 
+    // One calculation for calculateBatch(), with the same meaning as the arguments of start().
+    struct Query
+    {
+        std::vector<CardRange> handRanges;
+        uint64_t boardCards = 0, deadCards = 0;
+        bool enumerateAll = false;
+        double stdevTarget = 5e-5;
+    };
+
+    // Runs many independent calculations and waits for them to finish. Each calculation runs in a single task, and
+    // each task takes the next query as soon as the previous one is done, so that small calculations don't pay for
+    // starting and waiting for threads. The results of queries[i] are written to results[i], which have players = 0
+    // if start() would have returned false. Uses the settings of this calculator, and the lookup cache is shared
+    // between the queries. Must not be called from a task in the thread pool.
+    // threadCount: number of tasks to run in parallel, 0 for one per thread in the pool
+    void calculateBatch(const Query* queries, size_t queryCount, Results* results, unsigned threadCount = 0);
+
+    // Calculates the equities and waits for the results, choosing the method from the estimated time of an exact
+    // enumeration. Small enumerations run on the calling thread without the thread pool, bigger ones run in the pool,
+    // and if an enumeration wouldn't finish in maxSeconds, monte carlo runs until stdevTarget or maxSeconds. Returns
+    // false if start() would. Must not be called during a calculation or from a task in the thread pool.
+    // maxSeconds: time budget, 0 for exact enumeration regardless of the time
+    bool calculate(const std::vector<CardRange>& handRanges, uint64_t boardCards, uint64_t deadCards, Results& results,
+                   double maxSeconds = 0, double stdevTarget = 5e-5);
+
     // Force current calculation to stop before it's ready. Still must call wait()!
     void stop()
     {
         mStopped = true;
     }
 
-    // Wait for calculation to finish. Must always be called once for every successful start() call!
+    // Wait for calculation to finish. Must always be called for every successful start() call before starting a new
+    // calculation or destroying the calculator! Must not be called from a task in the thread pool.
     void wait()
     {
-        for (auto& t : mThreads)
-            t.join();
+        std::unique_lock<std::mutex> lock(mMutex);
+        mFinished.wait(lock, [this] { return !mRunning; });
+    }
+
+    ~EquityCalculator()
+    {
+        stop();
+        wait();
+    }
+
+    // Set the priority of the calculation's tasks in the thread pool. Tasks with higher priority run first. Applies
+    // to the next start(). 0 by default.
+    void setPriority(int priority)
+    {
+        mPriority = priority;
     }
 
     // Set a time limit for the calculation in seconds. Use 0 to disable. Disabled by default.
     void setTimeLimit(double seconds)
     {
-        std::lock_guard<std::mutex> lock(mMutex);
         mTimeLimit = seconds <= 0 ? INFINITE : seconds;
     }
 
     // Set a hand limit for the calculation or 0 to disable. Disabled by default.
     void setHandLimit(uint64_t handLimit)
     {
-        std::lock_guard<std::mutex> lock(mMutex);
         mHandLimit = handLimit == 0 ? INFINITE : handLimit;
     }
 
+    // Use short deck (6+) Hold'em: 36 card deck without twos to fives, and short deck hand rankings (see
+    // ShortDeckHandEvaluator). Hand range combos with removed cards are ignored, and start() fails if board or dead
+    // cards have them. Disabled by default. Must not be called during a calculation.
+    void setShortDeck(bool shortDeck)
+    {
+        mShortDeck = shortDeck;
+    }
+
+    // Set the memory budget in bytes for the results of enumerated preflops, which are reused when the same preflop
+    // comes up again with the same board, dead cards and deck (after suit isomorphism), also in later calculations
+    // and other queries of calculateBatch(). Clears the cache. 256 MB by default. Must
+    // not be called during a calculation.
+    void setLookupCacheSize(size_t bytes)
+    {
+        mLookup->setMaxBytes(bytes);
+    }
+
     // Get results from previous update.
     Results getResults()
     {
@@ -120,24 +179,65 @@ public:
 private:
     typedef XoroShiro128Plus Rng;
 
-    static const size_t MAX_LOOKUP_SIZE = 1000000;
+    static const size_t DEFAULT_LOOKUP_CACHE_BYTES = 256 << 20;
     static const size_t MAX_COMBINED_RANGE_SIZE = 10000;
+    // Postflop enumeration is split between threads when there are few preflop combos and at least this many boards.
+    static const uint64_t MIN_SPLIT_POSTFLOP_COMBOS = 50000;
+    static const unsigned MAX_POSTFLOP_PARTS = 256;
     static const uint64_t INFINITE = ~0ull;
+    // calculate() runs enumerations on the calling thread if they are estimated to take at most this long.
+    static constexpr double MAX_INLINE_SECONDS = 1e-3;
+    // Monte carlo doesn't stop at the stdev target before this many batches, since the estimate needs enough samples.
+    static const unsigned MIN_STDEV_BATCHES = 64;
 
-    // Temporary storage for results.
+    // Temporary storage for results. Only the first 2^nplayers elements of winsByPlayerMask are used, so only those
+    // are cleared and this should be reused with reset() instead of copied.
     struct BatchResults
     {
-        BatchResults(unsigned nplayers)
+        BatchResults(unsigned nplayers = 0)
         {
+            reset(nplayers);
+        }
+
+        void reset(unsigned nplayers)
+        {
+            skippedPreflopCombos = 0;
+            uniquePreflopCombos = 0;
+            evalCount = 0;
             for (unsigned i = 0; i < nplayers; ++i)
                 playerIds[i] = i;
+            std::fill(winsByPlayerMask, winsByPlayerMask + (1u << nplayers), 0u);
         }
 
-        uint64_t skippedPreflopCombos = 0;
-        uint64_t uniquePreflopCombos = 0;
-        uint64_t evalCount = 0;
+        uint64_t skippedPreflopCombos;
+        uint64_t uniquePreflopCombos;
+        uint64_t evalCount;
         uint8_t playerIds[MAX_PLAYERS];
-        unsigned winsByPlayerMask[1 << MAX_PLAYERS] = {};
+        unsigned winsByPlayerMask[1 << MAX_PLAYERS];
+    };
+
+    static const unsigned MAX_SPLIT_LEVELS = 2;
+
+    // Part of a postflop enumeration that is split between threads. subtree counts the subtrees on the split levels,
+    // which also have their own copies of the deck.
+    struct PostflopPart
+    {
+        unsigned count = 1;
+        unsigned index = 0;
+        unsigned subtree = 0;
+        unsigned decks[MAX_SPLIT_LEVELS][CARD_COUNT];
+    };
+
+    // Results of one task. Only the task itself and the task that reports the combined results touch them, so tasks
+    // don't block each other. Aligned to a cache line to avoid false sharing.
+    struct alignas(64) TaskResults
+    {
+        std::mutex mutex;
+        uint64_t wins[MAX_PLAYERS] = {};
+        uint64_t ties[MAX_PLAYERS] = {};
+        uint64_t winsByPlayerMask[1 << MAX_PLAYERS] = {};
+        uint64_t hands = 0, evaluations = 0, skippedPreflopCombos = 0, evaluatedPreflopCombos = 0;
+        double batchSum = 0, batchSumSqr = 0, batchCount = 0;
     };
 
     // Ad-hoc struct used when sorting hands.
@@ -147,24 +247,80 @@ private:
         unsigned playerIdx;
     };
 
-    void simulateRegularMonteCarlo();
-    void simulateRandomWalkMonteCarlo();
+    // Key of the lookup cache. The board and dead cards are transformed with the same suits as the preflop, so that
+    // results are only reused for the same cards up to suit isomorphism.
+    struct LookupKey
+    {
+        uint64_t preflopId;
+        uint64_t boardCards;
+        uint64_t deadCards;
+        bool shortDeck;
+
+        bool operator==(const LookupKey& other) const
+        {
+            return preflopId == other.preflopId && boardCards == other.boardCards && deadCards == other.deadCards
+                && shortDeck == other.shortDeck;
+        }
+    };
+
+    struct LookupKeyHash
+    {
+        size_t operator()(const LookupKey& key) const
+        {
+            return (size_t)(key.preflopId ^ (key.boardCards * 0xc2b2ae3d27d4eb4full)
+                ^ (key.deadCards * 0x165667b19e3779f9ull) ^ key.shortDeck);
+        }
+    };
+
+    typedef bool (EquityCalculator::*Kernel)(TaskResults& task);
+
+    // The simulation and enumeration kernels return true when they need to run again. The templated kernels are
+    // compiled separately for each player count from 2 to MAX_SPECIALIZED_PLAYERS, so that the per-player loops can be
+    // unrolled. tPlayers = 0 is the generic version for the other player counts.
+    static const unsigned MAX_SPECIALIZED_PLAYERS = 9;
+    // Monte carlo showdowns with at least this many players are evaluated with evaluateHandsSimd().
+    static const unsigned MIN_SIMD_SHOWDOWN_PLAYERS = 4;
+    // Heads-up enumerations with at least three board cards use sweepShowdowns() when there are at least this many
+    // preflop combos for each combo in the two ranges.
+    static const unsigned MIN_SWEEP_PREFLOPS_PER_COMBO = 16;
+    Kernel setup(const std::vector<CardRange>& handRanges, uint64_t boardCards, uint64_t deadCards, bool enumerateAll,
+                 double stdevTarget, std::function<void(const Results&)> callback, double updateInterval,
+                 unsigned threadCount);
+    Kernel selectKernel(unsigned nplayers, bool enumerateAll) const;
+    static double evaluationSeconds();
+    template<unsigned tPlayers>
+    static unsigned kernelPlayerCount(unsigned nplayers)
+    {
+        return tPlayers ? tPlayers : nplayers;
+    }
+    bool simulateRegularMonteCarlo(TaskResults& task);
+    template<unsigned tPlayers>
+    bool simulateRandomWalkMonteCarlo(TaskResults& task);
     bool randomizeHoleCards(uint64_t &usedCardsMask, unsigned* comboIndexes, Hand* playerHands,
                             Rng& rng, FastUniformIntDistribution<unsigned,21>*comboDists);
     OMP_FORCE_INLINE void randomizeBoard(Hand& board, unsigned remainingCards, uint64_t usedCardsMask,
                         Rng& rng, FastUniformIntDistribution<unsigned,16>& cardDist);
-    template<bool tFlushPossible = true>
+    template<unsigned tPlayers, bool tFlushPossible = true>
     OMP_FORCE_INLINE void evaluateHands(const Hand* playerHands, unsigned nplayers, const Hand& board,
             BatchResults* stats, unsigned weight);
-    void enumerate();
+    OMP_FORCE_INLINE void evaluateHandsSimd(const Hand* playerHands, unsigned nplayers, const Hand& board,
+            BatchResults* stats);
+    template<unsigned tPlayers>
+    bool enumerate(TaskResults& task);
+    template<unsigned tPlayers>
     void enumerateBoard(const HandWithPlayerIdx* playerHands, unsigned nplayers,
-                   const Hand& board, uint64_t usedCardsMask, BatchResults* stats);
+                   uint64_t boardCards, uint64_t usedCardsMask, BatchResults* stats,
+                   PostflopPart* part = nullptr);
+    template<unsigned tPlayers>
     void enumerateBoardRec(const Hand* playerHands, unsigned nplayers, BatchResults* stats,
-                           const Hand& board, unsigned* deck, unsigned ndeck,  unsigned* suitCounts,
-                           unsigned k, unsigned start, unsigned weight);
-    bool lookupResults(uint64_t hash, BatchResults& results);
-    bool lookupPrecalculatedResults(uint64_t hash, BatchResults& results) const;
-    void storeResults(uint64_t hash, const BatchResults& results);
+                           const Hand& board, unsigned* deck, unsigned ndeck, unsigned* suitCounts,
+                           const unsigned* suitClasses,
+                           unsigned k, unsigned start, unsigned weight, PostflopPart* part = nullptr,
+                           unsigned splitLevels = 0);
+    bool sweepShowdowns(TaskResults& task);
+    bool lookupResults(const LookupKey& key, BatchResults& results);
+    bool lookupPrecalculatedResults(uint64_t preflopId, BatchResults& results) const;
+    void storeResults(const LookupKey& key, const BatchResults& results);
     static unsigned transformSuits(HandWithPlayerIdx* playerHands, unsigned nplayers,
                                    uint64_t* boardCards, uint64_t* usedCards);
     static uint64_t calculateUniquePreflopId(const HandWithPlayerIdx* playerHands, unsigned nplayers);
@@ -173,37 +329,64 @@ private:
                                                                uint64_t reservedCards);
     std::pair<uint64_t,uint64_t> reserveBatch(uint64_t batchCount);
     uint64_t getPreflopCombinationCount();
+    uint64_t getEnumerationSize();
     uint64_t getPostflopCombinationCount();
+    unsigned firstCard() const
+    {
+        return mShortDeck ? SHORT_DECK_FIRST_CARD : 0;
+    }
 
-    void updateResults(const BatchResults& stats, bool finished);
-    double combineResults(const BatchResults& batch);
+    void updateResults(const BatchResults& stats, bool taskFinished, TaskResults& task);
+    void reportResults(std::chrono::high_resolution_clock::time_point t, bool finished);
+    double combineResults(const BatchResults& batch, TaskResults& task);
     void outputLookupTable() const;
 
-    std::vector<std::thread> mThreads;
-
     // Shared between threads, protected by mMutex.
     std::mutex mMutex;
-    std::atomic<bool> mStopped;
-    unsigned mUnfinishedThreads;
+    std::condition_variable mFinished;
+    bool mRunning = false;
     std::chrono::high_resolution_clock::time_point mLastUpdate;
     Results mResults, mUpdateResults;
-    double mBatchSum, mBatchSumSqr, mBatchCount;
-    uint64_t mEnumPosition;
-    std::unordered_map<uint64_t, BatchResults> mLookup;
+
+    // Shared between threads without locking.
+    std::atomic<bool> mStopped;
+    std::atomic<unsigned> mUnfinishedTasks;
+    std::atomic<uint64_t> mEnumPosition, mHandCount;
+    std::atomic<double> mNextUpdate; // Seconds from mStartTime.
+    std::atomic<double> mTimeLimit{ (double)INFINITE };
+    std::atomic<uint64_t> mHandLimit{ INFINITE };
+
+    // Cached winsByPlayerMask of each preflop, 2^nplayers elements. Shared with the workers of calculateBatch().
+    typedef LookupCache<LookupKey, std::vector<unsigned>, LookupKeyHash> ResultCache;
+    std::shared_ptr<ResultCache> mLookup = std::make_shared<ResultCache>(DEFAULT_LOOKUP_CACHE_BYTES);
 
     // Constant shared data
+    std::unique_ptr<TaskResults[]> mTaskResults; // The contents are protected by TaskResults::mutex.
+    unsigned mTaskCount = 0;
+    std::chrono::high_resolution_clock::time_point mStartTime;
+    unsigned mPostflopParts = 1, mPostflopSplitLevels = 0;
+    std::vector<uint64_t> mSweepBoards; // Missing board cards of each board for sweepShowdowns(), otherwise empty.
     std::vector<CardRange> mOriginalHandRanges; // Original ranges without before card removal.
     std::vector<std::vector<std::array<uint8_t,2>>> mHandRanges; // Ranges after card removal.
     CombinedRange mCombinedRanges[MAX_PLAYERS];
     unsigned mCombinedRangeCount;
     uint64_t mDeadCards, mBoardCards;
     HandEvaluator mEval;
-    double mStdevTarget = 5e-5, mTimeLimit = (double)INFINITE, mUpdateInterval = 0.1;
-    uint64_t mHandLimit = INFINITE;
+    ShortDeckHandEvaluator mShortDeckEval;
+    bool mShortDeck = false;
+    int mPriority = 0;
+    double mStdevTarget = 5e-5, mUpdateInterval = 0.1;
     std::function<void(const Results& results)> mCallback;
 
-    // Precalculated results for 2 player preflop situations. Uses a sorted array for lowest memory use.
-    static const std::vector<uint64_t> PRECALCULATED_2PLAYER_RESULTS;
+    // Precalculated results for 2 player preflop situations without board or dead cards. Constant data generated by
+    // outputLookupTable() and indexed with a perfect hash of the preflop id. Each entry is 48 bits with the wins of
+    // player 0 in the low 21 bits and ties in the next 21 bits.
+    static const unsigned PRECALCULATED_2PLAYER_ROW_SHIFT = 6;
+    static const unsigned PRECALCULATED_2PLAYER_COLUMN_MASK = (1 << PRECALCULATED_2PLAYER_ROW_SHIFT) - 1;
+    static const size_t PRECALCULATED_2PLAYER_RESULTS_SIZE = 63362;
+    static const uint16_t PRECALCULATED_2PLAYER_ROW_OFFSETS[
+        ((COMBO_COUNT + 1) * (COMBO_COUNT + 1) >> PRECALCULATED_2PLAYER_ROW_SHIFT) + 1];
+    static const uint16_t PRECALCULATED_2PLAYER_RESULTS[3 * PRECALCULATED_2PLAYER_RESULTS_SIZE];
 };
 
 }
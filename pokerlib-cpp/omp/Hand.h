@@ -30,7 +30,7 @@ struct Hand
     }
 
     // Copy constructor.
-    Hand(const Hand& other)
+    OMP_FORCE_INLINE Hand(const Hand& other)
     {
         #if OMP_SSE2
         omp_assert((uintptr_t)&mData % sizeof(__m128i) == 0);
@@ -40,7 +40,7 @@ struct Hand
 
     // Create a Hand from a card. CardIdx is an integer between 0 and 51, so that CARD = 4 * RANK + SUIT, where
     // rank ranges from 0 (deuce) to 12 (ace) and suit is from 0 (spade) to 3 (diamond).
-    Hand(unsigned cardIdx)
+    OMP_FORCE_INLINE Hand(unsigned cardIdx)
     {
         #if OMP_SSE2
         omp_assert((uintptr_t)&mData % sizeof(__m128i) == 0);
@@ -60,7 +60,7 @@ struct Hand
     }
 
     // Combine with another hand.
-    Hand operator+(const Hand& hand2) const
+    OMP_FORCE_INLINE Hand operator+(const Hand& hand2) const
     {
         Hand ret = *this;
         ret += hand2;
@@ -68,7 +68,7 @@ struct Hand
     }
 
     // Combine with another hand.
-    Hand& operator+=(const Hand& hand2)
+    OMP_FORCE_INLINE Hand& operator+=(const Hand& hand2)
     {
         omp_assert(!(mask() & hand2.mask()));
         #if OMP_SSE2
@@ -81,7 +81,7 @@ struct Hand
     }
 
     // Remove cards from this hand.
-    Hand operator-(const Hand& hand2) const
+    OMP_FORCE_INLINE Hand operator-(const Hand& hand2) const
     {
         Hand ret = *this;
         ret -= hand2;
@@ -89,7 +89,7 @@ struct Hand
     }
 
     // Remove cards from this hand.
-    Hand& operator-=(const Hand& hand2)
+    OMP_FORCE_INLINE Hand& operator-=(const Hand& hand2)
     {
         omp_assert((mask() & hand2.mask()) == hand2.mask());
         #if OMP_SSE2
@@ -132,7 +132,7 @@ struct Hand
     }
 
     // Returns true if hand has 5 or more cards of the same suit.
-    bool hasFlush() const
+    OMP_FORCE_INLINE bool hasFlush() const
     {
         // Hand has a 4-bit counter for each suit. They start at 3 so the 4th bit gets set when
         // there is 5 or more cards of that suit. We can check for flush by simply masking
@@ -148,7 +148,7 @@ struct Hand
     }
 
     // Returns a 32-bit key that is unique for each card rank combination.
-    uint32_t rankKey() const
+    OMP_FORCE_INLINE uint32_t rankKey() const
     {
         #if OMP_SSE4 && !OMP_X64
         return _mm_extract_epi32(mData, 0); // sse4.1
@@ -158,7 +158,7 @@ struct Hand
     }
 
     // Returns a card mask for the suit that has 5 or more cards.
-    uint16_t flushKey() const
+    OMP_FORCE_INLINE uint16_t flushKey() const
     {
         // Get the index of the flush check bit and use it to get the card mask for that suit.
         unsigned flushCheckBits = counters() & FLUSH_CHECK_MASK32;
@@ -179,7 +179,7 @@ private:
     static const uint32_t FLUSH_CHECK_MASK32 = 0x8888ull << (SUITS_SHIFT - 32);
 
     // Returns the counters.
-    uint32_t counters() const
+    OMP_FORCE_INLINE uint32_t counters() const
     {
         #if OMP_SSE4
         return _mm_extract_epi32(mData, 1); // sse4.1
@@ -189,7 +189,7 @@ private:
     }
 
     // Low 64-bits. (Key & counters.)
-    uint64_t key() const
+    OMP_FORCE_INLINE uint64_t key() const
     {
         #if OMP_SSE2 && OMP_X64
         return _mm_cvtsi128_si64(mData); // sse2, x64 only
@@ -203,7 +203,7 @@ private:
     }
 
     // High 64-bits.
-    uint64_t mask() const
+    OMP_FORCE_INLINE uint64_t mask() const
     {
         #if OMP_SSE4 && OMP_X64
         return _mm_extract_epi64(mData, 1); // sse4.1, x64 only
@@ -244,7 +244,8 @@ private:
     uint64_t mMask;
     #endif
 
-    friend class HandEvaluator;
+    friend class HandEvaluatorBase;
+    template<class tLayout> friend class HandEvaluatorT;
 };
 
 }
@@ -1,8 +1,16 @@
 #include "HandEvaluator.h"
 
 #include "OffsetTable.hxx"
+#include "OffsetTable5.hxx"
+#include "OffsetTable7.hxx"
+#include "LookupTables.hxx"
+#include "LookupTables5.hxx"
+#include "LookupTables7.hxx"
+#include "OffsetTableShortDeck.hxx"
+#include "LookupTablesShortDeck.hxx"
 #include "Util.h"
 #include <vector>
+#include <string>
 #include <iostream>
 #include <algorithm>
 #include <utility>
@@ -11,30 +19,170 @@
 namespace omp {
 
 	// Rank multipliers that guarantee a unique key for every rank combination in a 0-7 card hand.
-	const unsigned HandEvaluator::RANKS[]{ 0x2000, 0x8001, 0x11000, 0x3a000, 0x91000, 0x176005, 0x366000,
+	const unsigned HandEvaluatorBase::RANKS[]{ 0x2000, 0x8001, 0x11000, 0x3a000, 0x91000, 0x176005, 0x366000,
 			0x41a013, 0x47802e, 0x479068, 0x48c0e4, 0x48f211, 0x494493 };
 
 	// Rank multipliers for flush hands where only 1 of each rank is allowed. We could choose smaller numbers here but
 	// we want to get the key from a bitmask, so powers of 2 are used.
-	const unsigned HandEvaluator::FLUSH_RANKS[]{ 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+	const unsigned HandEvaluatorBase::FLUSH_RANKS[]{ 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
 
 	Hand Hand::CARDS[]{};
 	const Hand Hand::EMPTY(0x3333ull << SUITS_SHIFT, 0);
-	uint16_t HandEvaluator::LOOKUP[]{};
-	uint16_t* HandEvaluator::ORIG_LOOKUP = nullptr;
-	uint16_t HandEvaluator::FLUSH_LOOKUP[]{};
-	const unsigned HandEvaluator::MAX_KEY = 4 * RANKS[12] + 3 * RANKS[11];
-	bool HandEvaluator::cardInit = (initCardConstants(), true);
-
-	// Does a thread-safe (guaranteed by C++11) one time initialization of static data.
-	HandEvaluator::HandEvaluator()
+	bool HandEvaluatorBase::GEN_SHORT_DECK = false;
+	unsigned HandEvaluatorBase::GEN_MIN_CARDS = 0;
+	unsigned HandEvaluatorBase::GEN_ROW_SHIFT = 0;
+	const uint32_t* HandEvaluatorBase::GEN_OFFSETS = nullptr;
+	uint16_t* HandEvaluatorBase::ORIG_LOOKUP = nullptr;
+	uint16_t* HandEvaluatorBase::GEN_LOOKUP = nullptr;
+	uint16_t* HandEvaluatorBase::GEN_FLUSH_LOOKUP = nullptr;
+	const unsigned HandEvaluatorBase::MAX_KEY = 4 * RANKS[12] + 3 * RANKS[11];
+	bool HandEvaluatorBase::cardInit = (initCardConstants(), true);
+
+	// Batch evaluation. Uses the AVX2 kernel if the CPU supports it and does the remainder one hand at a time.
+	template<class tLayout>
+	void HandEvaluatorT<tLayout>::evaluateBatch(const Hand* hands, size_t count, uint16_t* ranks) const
 	{
-		static bool initVar = (staticInit(), true);
-		(void)initVar;
+		size_t i = 0;
+
+		#if OMP_AVX2_KERNELS
+		static const bool hasAvx2 = cpuSupportsAvx2();
+		if (hasAvx2)
+			i = evaluateBatchAvx2(hands, count, ranks);
+		#endif
+
+		for (; i < count; ++i)
+			ranks[i] = evaluate(hands[i]);
+	}
+
+	// Evaluates the hands one at a time and compares the ranks.
+	template<class tLayout>
+	unsigned HandEvaluatorT<tLayout>::evaluateWinners(const Hand& board, const Hand* hands, unsigned count) const
+	{
+		omp_assert(count <= MAX_PLAYERS);
+
+		#if OMP_AVX2_KERNELS
+		static const bool hasAvx2 = cpuSupportsAvx2();
+		if (hasAvx2)
+			return evaluateWinnersAvx2(board, hands, count);
+		#endif
+
+		unsigned bestRank = 0;
+		unsigned winnersMask = 0;
+		for (unsigned i = 0; i < count; ++i) {
+			unsigned rank = evaluate(board + hands[i]);
+			if (rank > bestRank) {
+				bestRank = rank;
+				winnersMask = 1u << i;
+			}
+			else if (rank == bestRank) {
+				winnersMask |= 1u << i;
+			}
+		}
+		return winnersMask;
+	}
+
+	#if OMP_AVX2_KERNELS
+	// Evaluates 8 hands and returns their ranks as 32-bit integers in the same order.
+	template<class tLayout>
+	OMP_TARGET_AVX2 OMP_FORCE_INLINE __m256i HandEvaluatorT<tLayout>::evaluate8Avx2(const Hand* hands)
+	{
+		// The hands are loaded two per register and the rank keys and counters are picked out with shuffles, which
+		// leaves the lanes in order 0, 2, 4, 6, 1, 3, 5, 7. Offsets of each lane's hand in 32-bit words:
+		const __m256i handOffsets = _mm256_setr_epi32(0, 8, 16, 24, 4, 12, 20, 28);
+		const __m256i laneOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+		const __m256i flushCheckMask = _mm256_set1_epi32(Hand::FLUSH_CHECK_MASK32);
+		const __m256i lowMask = _mm256_set1_epi32(0xffff);
+		const __m256i one = _mm256_set1_epi32(1);
+		const __m256i zero = _mm256_setzero_si256();
+
+		const __m256i* p = (const __m256i*)hands;
+		__m256i lo = _mm256_unpacklo_epi64(_mm256_loadu_si256(p), _mm256_loadu_si256(p + 1));
+		__m256i hi = _mm256_unpacklo_epi64(_mm256_loadu_si256(p + 2), _mm256_loadu_si256(p + 3));
+		__m256i keys = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(lo), _mm256_castsi256_ps(hi),
+			_MM_SHUFFLE(2, 0, 2, 0)));
+		__m256i counters = _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(lo), _mm256_castsi256_ps(hi),
+			_MM_SHUFFLE(3, 1, 3, 1)));
+
+		// Non-flush lookup for all lanes: LOOKUP[key + PERF_HASH_ROW_OFFSETS[key >> PERF_HASH_ROW_SHIFT]].
+		__m256i rows = _mm256_srli_epi32(keys, tLayout::PERF_HASH_ROW_SHIFT);
+		__m256i hashes = _mm256_add_epi32(keys, _mm256_i32gather_epi32((const int*)tLayout::PERF_HASH_ROW_OFFSETS,
+			rows, 4));
+		__m256i result = _mm256_and_si256(_mm256_i32gather_epi32((const int*)tLayout::LOOKUP, hashes, 2), lowMask);
+
+		// Flush lanes. Only one suit can have the flush check bit set, so the index of the suit's 16-bit group in
+		// the card mask is simply 1 * bit27 + 2 * bit23 + 3 * bit19 (bit31 maps to group 0).
+		__m256i flushBits = _mm256_and_si256(counters, flushCheckMask);
+		if (!_mm256_testz_si256(flushBits, flushBits)) {
+			__m256i flushLanes = _mm256_andnot_si256(_mm256_cmpeq_epi32(flushBits, zero), _mm256_set1_epi32(-1));
+			__m256i b27 = _mm256_and_si256(_mm256_srli_epi32(flushBits, 27), one);
+			__m256i b23 = _mm256_and_si256(_mm256_srli_epi32(flushBits, 23), one);
+			__m256i b19 = _mm256_and_si256(_mm256_srli_epi32(flushBits, 19), one);
+			__m256i group = _mm256_add_epi32(_mm256_add_epi32(b27, b19), _mm256_slli_epi32(_mm256_add_epi32(b23, b19), 1));
+
+			// Load the 32-bit word that contains the group and shift the right half down.
+			__m256i wordOffsets = _mm256_add_epi32(handOffsets, _mm256_add_epi32(_mm256_srli_epi32(group, 1),
+				_mm256_set1_epi32(2)));
+			__m256i maskWords = _mm256_mask_i32gather_epi32(zero, (const int*)hands, wordOffsets, flushLanes, 4);
+			__m256i shifts = _mm256_slli_epi32(_mm256_and_si256(group, one), 4);
+			__m256i flushKeys = _mm256_and_si256(_mm256_srlv_epi32(maskWords, shifts), lowMask);
+
+			__m256i flushRanks = _mm256_mask_i32gather_epi32(zero, (const int*)flushLookup(), flushKeys, flushLanes, 2);
+			result = _mm256_blendv_epi8(result, _mm256_and_si256(flushRanks, lowMask), flushLanes);
+		}
+
+		// Restore hand order.
+		return _mm256_permutevar8x32_epi32(result, laneOrder);
+	}
+
+	// Evaluates 8 hands per iteration and returns the number of hands evaluated.
+	template<class tLayout>
+	OMP_TARGET_AVX2 size_t HandEvaluatorT<tLayout>::evaluateBatchAvx2(const Hand* hands, size_t count, uint16_t* ranks)
+	{
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256i result = evaluate8Avx2(hands + i);
+
+			// Pack 8 x 32-bit to 8 x 16-bit. Packing works within 128-bit lanes so the halves need to be reordered
+			// afterwards.
+			__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+			_mm_storeu_si128((__m128i*)(ranks + i), _mm256_castsi256_si128(packed));
+		}
+
+		return i;
 	}
 
+	// The hands are padded to a multiple of 8 with copies of the first one, which doesn't change the best rank.
+	template<class tLayout>
+	OMP_TARGET_AVX2 unsigned HandEvaluatorT<tLayout>::evaluateWinnersAvx2(const Hand& board, const Hand* hands,
+		unsigned count)
+	{
+		static_assert(MAX_PLAYERS <= 16, "Hands are evaluated in at most two vectors.");
+		Hand boardHands[16];
+		unsigned paddedCount = (count + 7) & ~7u;
+		for (unsigned i = 0; i < count; ++i)
+			boardHands[i] = board + hands[i];
+		for (unsigned i = count; i < paddedCount; ++i)
+			boardHands[i] = boardHands[0];
+
+		__m256i ranks0 = evaluate8Avx2(boardHands);
+		__m256i ranks1 = ranks0;
+		if (paddedCount > 8)
+			ranks1 = evaluate8Avx2(boardHands + 8);
+
+		// Broadcast the maximum to every lane.
+		__m256i best = _mm256_max_epu32(ranks0, ranks1);
+		best = _mm256_max_epu32(best, _mm256_permute2x128_si256(best, best, 1));
+		best = _mm256_max_epu32(best, _mm256_shuffle_epi32(best, _MM_SHUFFLE(1, 0, 3, 2)));
+		best = _mm256_max_epu32(best, _mm256_shuffle_epi32(best, _MM_SHUFFLE(2, 3, 0, 1)));
+
+		unsigned winnersMask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(ranks0, best)));
+		winnersMask |= (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(ranks1, best))) << 8;
+		return winnersMask & ((1u << count) - 1);
+	}
+	#endif
+
 	// Initialize card constants.
-	void HandEvaluator::initCardConstants()
+	void HandEvaluatorBase::initCardConstants()
 	{
 		for (unsigned c = 0; c < CARD_COUNT; ++c) {
 			unsigned rank = c / 4, suit = c % 4;
@@ -43,14 +191,28 @@ namespace omp {
 		}
 	}
 
-	// Initialize static class data.
-	void HandEvaluator::staticInit()
+	// Generates the lookup tables by going through every hand category from worst to best.
+	size_t HandEvaluatorBase::generateTables(bool shortDeck, unsigned minCards, unsigned rowShift,
+		const uint32_t* offsets, uint16_t* lookup, size_t lookupSize, uint16_t* flushLookup,
+		std::vector<uint32_t>* newOffsets)
 	{
+		GEN_SHORT_DECK = shortDeck;
+		GEN_MIN_CARDS = minCards;
+		GEN_ROW_SHIFT = rowShift;
+		GEN_OFFSETS = offsets;
+		GEN_LOOKUP = lookup;
+		GEN_FLUSH_LOOKUP = flushLookup;
+		std::fill(lookup, lookup + lookupSize, (uint16_t)0);
+		std::fill(flushLookup, flushLookup + FLUSH_LOOKUP_SIZE, (uint16_t)0);
+
 		// Temporary table for hash recalculation.
-		if (RECALCULATE_PERF_HASH_OFFSETS)
-			ORIG_LOOKUP = new uint16_t[MAX_KEY + 1];
+		if (!offsets)
+			ORIG_LOOKUP = new uint16_t[MAX_KEY + 1]{};
 
 		static const unsigned RC = RANK_COUNT;
+		const unsigned R0 = shortDeck ? SHORT_DECK_FIRST_RANK : 0;
+		// Lowest straight: A-2-3-4-5, or A-6-7-8-9 in short deck.
+		const uint64_t lowStraight = 0x1000000000000ull | 0x1111ull << 4 * R0;
 
 		// 1. High card
 		unsigned handValue = HIGH_CARD;
@@ -58,78 +220,154 @@ namespace omp {
 
 		// 2. Pair
 		handValue = PAIR;
-		for (unsigned r = 0; r < RC; ++r)
+		for (unsigned r = R0; r < RC; ++r)
 			handValue = populateLookup(2ull << 4 * r, 2, handValue, RC, 0, 0, 0);
 
 		// 3. Two pairs
 		handValue = TWO_PAIR;
-		for (unsigned r1 = 0; r1 < RC; ++r1)
-			for (unsigned r2 = 0; r2 < r1; ++r2)
+		for (unsigned r1 = R0; r1 < RC; ++r1)
+			for (unsigned r2 = R0; r2 < r1; ++r2)
 				handValue = populateLookup((2ull << 4 * r1) + (2ull << 4 * r2), 4, handValue, RC, r2, 0, 0);
 
 		// 4. Three of a kind
 		handValue = THREE_OF_A_KIND;
-		for (unsigned r = 0; r < RC; ++r)
+		for (unsigned r = R0; r < RC; ++r)
 			handValue = populateLookup(3ull << 4 * r, 3, handValue, RC, 0, r, 0);
 
 		// 4. Straight
 		handValue = STRAIGHT;
-		handValue = populateLookup(0x1000000001111ull, 5, handValue, RC, RC, RC, 3); // wheel
-		for (unsigned r = 4; r < RC; ++r)
+		handValue = populateLookup(lowStraight, 5, handValue, RC, RC, RC, 3); // wheel
+		for (unsigned r = R0 + 4; r < RC; ++r)
 			handValue = populateLookup(0x11111ull << 4 * (r - 4), 5, handValue, RC, RC, RC, r);
 
-		// 6. FLUSH
-		handValue = FLUSH;
+		// 6. FLUSH (7. in short deck)
+		handValue = shortDeck ? SHORT_DECK_FLUSH : FLUSH;
 		handValue = populateLookup(0, 0, handValue, RC, 0, 0, 0, true);
 
-		// 7. Full house
-		handValue = FULL_HOUSE;
-		for (unsigned r1 = 0; r1 < RC; ++r1)
-			for (unsigned r2 = 0; r2 < RC; ++r2)
+		// 7. Full house (6. in short deck)
+		handValue = shortDeck ? SHORT_DECK_FULL_HOUSE : FULL_HOUSE;
+		for (unsigned r1 = R0; r1 < RC; ++r1)
+			for (unsigned r2 = R0; r2 < RC; ++r2)
 				if (r2 != r1)
 					handValue = populateLookup((3ull << 4 * r1) + (2ull << 4 * r2), 5, handValue, RC, r2, r1, RC);
 
 		// 8. Quads
 		handValue = FOUR_OF_A_KIND;
-		for (unsigned r = 0; r < RC; ++r)
+		for (unsigned r = R0; r < RC; ++r)
 			handValue = populateLookup(4ull << 4 * r, 4, handValue, RC, RC, RC, RC);
 
 		// 9. Straight flush
 		handValue = STRAIGHT_FLUSH;
-		handValue = populateLookup(0x1000000001111ull, 5, handValue, RC, 0, 0, 3, true); // low straight flush
-		for (unsigned r = 4; r < RC; ++r)
+		handValue = populateLookup(lowStraight, 5, handValue, RC, 0, 0, 3, true); // low straight flush
+		for (unsigned r = R0 + 4; r < RC; ++r)
 			handValue = populateLookup(0x11111ull << 4 * (r - 4), 5, handValue, RC, 0, 0, r, true);
 
-		if (RECALCULATE_PERF_HASH_OFFSETS) {
-			calculatePerfectHashOffsets();
+		size_t usedSize = lookupSize;
+		if (!offsets) {
+			usedSize = calculatePerfectHashOffsets(rowShift, *newOffsets);
 			delete[] ORIG_LOOKUP;
+			ORIG_LOOKUP = nullptr;
+		}
+
+		GEN_LOOKUP = GEN_FLUSH_LOOKUP = nullptr;
+		GEN_OFFSETS = nullptr;
+		return usedSize;
+	}
+
+	template<class tLayout>
+	void HandEvaluatorT<tLayout>::generateLookupTables(uint16_t* lookup, uint16_t* flushLookup)
+	{
+		generateTables(SHORT_DECK, MIN_CARDS, tLayout::PERF_HASH_ROW_SHIFT, tLayout::PERF_HASH_ROW_OFFSETS, lookup,
+			LOOKUP_SIZE, flushLookup);
+	}
+
+	// Output the offset table and the non-flush lookup table as C++ source. The lookup table is generated in a buffer
+	// that is big enough for any offsets.
+	template<class tLayout>
+	void HandEvaluatorT<tLayout>::outputLookupTables(std::ostream& offsetTable, std::ostream& lookupTable,
+		const char* layoutName)
+	{
+		std::vector<uint16_t> lookup(MAX_KEY + 1), flushLookup(FLUSH_LOOKUP_SIZE);
+		std::vector<uint32_t> offsets;
+		size_t size = generateTables(SHORT_DECK, MIN_CARDS, tLayout::PERF_HASH_ROW_SHIFT, nullptr, lookup.data(),
+			lookup.size(), flushLookup.data(), &offsets);
+
+		std::string name = std::string("omp::") + layoutName + "::";
+		offsetTable << "#include \"HandEvaluator.h\"" << std::endl << std::endl;
+		offsetTable << "// Offset table for the perfect hashing algorithm used in the evaluator (" << layoutName
+			<< ", " << offsets.size() << " rows)." << std::endl;
+		offsetTable << "// Generated by HandEvaluatorT::outputLookupTables()." << std::endl;
+		outputOffsetTable(offsetTable, (name + "PERF_HASH_ROW_OFFSETS").c_str(), offsets);
+
+		lookupTable << "#include \"HandEvaluator.h\"" << std::endl << std::endl;
+		lookupTable << "// Non-flush lookup table for the evaluator (" << layoutName << ", size " << size
+			<< " + 1 padding)." << std::endl;
+		lookupTable << "// Generated by HandEvaluatorT::outputLookupTables()." << std::endl;
+		outputTable(lookupTable, (name + "LOOKUP").c_str(), lookup.data(), size);
+	}
+
+	// Output the flush lookup table as C++ source. Short deck keys are a subset of the full keys, so the full layout's
+	// perfect hash works for both.
+	void HandEvaluatorBase::outputFlushLookup(std::ostream& out, bool shortDeck)
+	{
+		std::vector<uint16_t> lookup(FullLookupLayout::LOOKUP_SIZE), flushLookup(FLUSH_LOOKUP_SIZE);
+		generateTables(shortDeck, FullLookupLayout::MIN_CARDS, FullLookupLayout::PERF_HASH_ROW_SHIFT,
+			FullLookupLayout::PERF_HASH_ROW_OFFSETS, lookup.data(), lookup.size(), flushLookup.data());
+		outputTable(out, shortDeck ? "omp::HandEvaluatorBase::SHORT_DECK_FLUSH_LOOKUP"
+			: "omp::HandEvaluatorBase::FLUSH_LOOKUP", flushLookup.data(), flushLookup.size());
+	}
+
+	void HandEvaluatorBase::outputTable(std::ostream& out, const char* name, const uint16_t* table, size_t size)
+	{
+		// Trailing zeros are left out because they get zero-initialized anyway.
+		while (size > 0 && table[size - 1] == 0)
+			--size;
+		out << "const uint16_t " << name << "[] {";
+		for (size_t i = 0; i < size; ++i) {
+			if (i % 16 == 0)
+				out << std::endl << "   ";
+			out << " " << table[i] << ",";
 		}
+		out << std::endl << "};" << std::endl;
+	}
+
+	void HandEvaluatorBase::outputOffsetTable(std::ostream& out, const char* name, const std::vector<uint32_t>& offsets)
+	{
+		out << "const uint32_t " << name << "[] {" << std::hex;
+		for (size_t i = 0; i < offsets.size(); ++i) {
+			if (i % 8 == 0)
+				out << std::endl << "   ";
+			out << " 0x" << offsets[i] << ",";
+		}
+		out << std::dec << std::endl << "};" << std::endl;
 	}
 
 	// Iterates recursively over the the remaining cards ranks in a hand and writes the hand values for each combination
 	// to lookup table. Parameters maxPair, maxTrips, maxStraight are used for checking that the hand
 	// doesn't improve (except kickers).
-	unsigned HandEvaluator::populateLookup(uint64_t ranks, unsigned ncards, unsigned handValue, unsigned endRank,
+	unsigned HandEvaluatorBase::populateLookup(uint64_t ranks, unsigned ncards, unsigned handValue, unsigned endRank,
 		unsigned maxPair, unsigned maxTrips, unsigned maxStraight, bool flush)
 	{
-		// Only increment hand value counter for every valid 5 card combination. (Or smaller hands if enabled.)
-		if (ncards <= 5 && ncards >= (MIN_CARDS < 5 ? MIN_CARDS : 5))
+		// Increment hand value counter for every valid combination of up to 5 cards, also the ones that don't go in
+		// the table, so that the ranks are the same with every layout.
+		if (ncards <= 5)
 			++handValue;
 
 		// Write hand value to lookup when we have required number of cards.
-		if (ncards >= MIN_CARDS || (flush && ncards >= 5)) {
+		if (ncards >= GEN_MIN_CARDS || (flush && ncards >= 5)) {
 			unsigned key = getKey(ranks, flush);
 
 			// Write flush and non-flush hands in different tables
 			if (flush) {
-				FLUSH_LOOKUP[key] = handValue;
+				GEN_FLUSH_LOOKUP[key] = handValue;
 			}
-			else if (RECALCULATE_PERF_HASH_OFFSETS) {
+			else if (!GEN_OFFSETS) {
 				ORIG_LOOKUP[key] = handValue;
 			}
 			else {
-				omp_assert(LOOKUP[perfHash(key)] == 0 || LOOKUP[perfHash(key)] == handValue);
-				LOOKUP[perfHash(key)] = handValue;
+				unsigned idx = key + GEN_OFFSETS[key >> GEN_ROW_SHIFT];
+				omp_assert(GEN_LOOKUP[idx] == 0 || GEN_LOOKUP[idx] == handValue);
+				GEN_LOOKUP[idx] = handValue;
 			}
 
 			if (ncards == 7)
@@ -137,7 +375,7 @@ namespace omp {
 		}
 
 		// Iterate next card rank.
-		for (unsigned r = 0; r < endRank; ++r) {
+		for (unsigned r = GEN_SHORT_DECK ? SHORT_DECK_FIRST_RANK : 0; r < endRank; ++r) {
 			uint64_t newRanks = ranks + (1ull << (4 * r));
 
 			// Check that hand doesn't improve.
@@ -158,7 +396,7 @@ namespace omp {
 	}
 
 	// Calculate lookup table key from rank counts.
-	unsigned HandEvaluator::getKey(uint64_t ranks, bool flush)
+	unsigned HandEvaluatorBase::getKey(uint64_t ranks, bool flush)
 	{
 		unsigned key = 0;
 		for (unsigned r = 0; r < RANK_COUNT; ++r)
@@ -167,26 +405,29 @@ namespace omp {
 	}
 
 	// Returns index of the highest straight card or 0 when no straight.
-	unsigned HandEvaluator::getBiggestStraight(uint64_t ranks)
+	unsigned HandEvaluatorBase::getBiggestStraight(uint64_t ranks)
 	{
 		uint64_t rankMask = (0x1111111111111 & ranks) | (0x2222222222222 & ranks) >> 1 | (0x4444444444444 & ranks) >> 2;
 		for (unsigned i = 9; i-- > 0; )
 			if (((rankMask >> 4 * i) & 0x11111ull) == 0x11111ull)
 				return i + 4;
-		if ((rankMask & 0x1000000001111) == 0x1000000001111)
+		uint64_t lowStraight = GEN_SHORT_DECK ? 0x1000011110000 : 0x1000000001111;
+		if ((rankMask & lowStraight) == lowStraight)
 			return 3;
 		return 0;
 	}
 
 	// Perfect hashing based on the algorithm described in
 	// http://www.drdobbs.com/architecture-and-design/generating-perfect-hash-functions/184404506
-	void HandEvaluator::calculatePerfectHashOffsets()
+	size_t HandEvaluatorBase::calculatePerfectHashOffsets(unsigned rowShift, std::vector<uint32_t>& offsets)
 	{
+		const size_t columnMask = ((size_t)1 << rowShift) - 1;
+
 		// Store locations of all non-zero elements in original lookup table, divided into rows.
 		std::vector<std::pair<size_t, std::vector<size_t>>> rows;
 		for (size_t i = 0; i < MAX_KEY + 1; ++i) {
 			if (ORIG_LOOKUP[i]) {
-				size_t rowIdx = i >> PERF_HASH_ROW_SHIFT;
+				size_t rowIdx = i >> rowShift;
 				if (rowIdx >= rows.size())
 					rows.resize(rowIdx + 1);
 				rows[rowIdx].second.push_back(i);
@@ -198,20 +439,21 @@ namespace omp {
 			rows[i].first = i;
 
 		// Try to fit the densest rows first. Results in slightly smaller table.
-		std::sort(rows.begin(), rows.end(), [](const std::pair<size_t, std::vector<size_t>>& lhs,
+		std::stable_sort(rows.begin(), rows.end(), [](const std::pair<size_t, std::vector<size_t>>& lhs,
 			const std::pair<size_t, std::vector<size_t>> & rhs) {
 			return lhs.second.size() > rhs.second.size();
 		});
 
 		// Goes through every row and for each of them try to find the first offset that doesn't cause any collisions with
 		// previous rows. Does a very naive brute force search.
+		offsets.assign(rows.size(), 0);
 		size_t maxIdx = 0;
 		for (size_t i = 0; i < rows.size(); ++i) {
-			size_t offset = 0; //-(rows[i].second[0] & PERF_HASH_COLUMN_MASK); makes no difference so let's avoid negative
+			size_t offset = 0; //-(rows[i].second[0] & columnMask); makes no difference so let's avoid negative
 			for (;; ++offset) {
 				bool ok = true;
 				for (auto x : rows[i].second) {
-					unsigned val = LOOKUP[(x & PERF_HASH_COLUMN_MASK) + offset];
+					unsigned val = GEN_LOOKUP[(x & columnMask) + offset];
 					if (val && val != ORIG_LOOKUP[x]) { // Allow collisions if value is the same
 						ok = false;
 						break;
@@ -220,35 +462,25 @@ namespace omp {
 				if (ok)
 					break;
 			}
-			//std::cout << "row=" << i << " size=" << rows[i].second.size() << " offset=" << offset << std::endl;
-			PERF_HASH_ROW_OFFSETS[rows[i].first] = (uint32_t)(offset - (rows[i].first << PERF_HASH_ROW_SHIFT));
+			offsets[rows[i].first] = (uint32_t)(offset - (rows[i].first << rowShift));
 			for (size_t key : rows[i].second) {
-				size_t newIdx = (key & PERF_HASH_COLUMN_MASK) + offset;
+				size_t newIdx = (key & columnMask) + offset;
 				maxIdx = std::max<size_t>(maxIdx, newIdx);
-				LOOKUP[newIdx] = ORIG_LOOKUP[key];
+				GEN_LOOKUP[newIdx] = ORIG_LOOKUP[key];
 			}
 		}
 
-		// Output offset array.
-		std::cout << "offsets: " << std::endl;
-		for (size_t i = 0; i < rows.size(); ++i) {
-			if (i % 8 == 0)
-				std::cout << std::endl;
-			std::cout << std::hex << "0x" << PERF_HASH_ROW_OFFSETS[i] << std::dec << ", ";
-		}
-
 		// Output stats.
-		std::cout << std::endl;
-		outputTableStats("FLUSH_LOOKUP", FLUSH_LOOKUP, 2, FLUSH_LOOKUP_SIZE);
+		outputTableStats("FLUSH_LOOKUP", GEN_FLUSH_LOOKUP, 2, FLUSH_LOOKUP_SIZE);
 		outputTableStats("ORIG_LOOKUP", ORIG_LOOKUP, 2, MAX_KEY + 1);
-		outputTableStats("LOOKUP", LOOKUP, 2, maxIdx + 1);
-		outputTableStats("OFFSETS", PERF_HASH_ROW_OFFSETS, 4, rows.size());
-		std::cout << "lookup table size: " << maxIdx + 1 << std::endl;
-		std::cout << "offset table size: " << rows.size() << std::endl;
+		outputTableStats("LOOKUP", GEN_LOOKUP, 2, maxIdx + 1);
+		outputTableStats("OFFSETS", offsets.data(), 4, offsets.size());
+
+		return maxIdx + 1;
 	}
 
-	// Output stats about memory usage of a lookup table.
-	void HandEvaluator::outputTableStats(const char* name, const void* p, size_t elementSize, size_t count)
+	// Output stats about memory usage of a lookup table to stderr.
+	void HandEvaluatorBase::outputTableStats(const char* name, const void* p, size_t elementSize, size_t count)
 	{
 		char dummy[64]{};
 		size_t totalCacheLines = 0, usedCacheLines = 0, usedElements = 0;
@@ -263,10 +495,15 @@ namespace omp {
 			}
 			usedCacheLines += used;
 		}
-		std::cout << name << ": cachelines: " << usedCacheLines << "/" << totalCacheLines
+		std::cerr << name << ": cachelines: " << usedCacheLines << "/" << totalCacheLines
 			<< "  kbytes: " << usedCacheLines / 16 << "/" << totalCacheLines / 16
 			<< "  elements: " << usedElements << "/" << count
 			<< std::endl;
 	}
 
+	template class HandEvaluatorT<FullLookupLayout>;
+	template class HandEvaluatorT<FiveCardLookupLayout>;
+	template class HandEvaluatorT<SevenCardLookupLayout>;
+	template class HandEvaluatorT<ShortDeckLookupLayout>;
+
 }
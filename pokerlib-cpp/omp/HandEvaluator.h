@@ -6,74 +6,198 @@
 #include "Hand.h"
 #include <cstdint>
 #include <cassert>
+#include <iosfwd>
+#include <vector>
+#if OMP_AVX2_KERNELS
+#include <immintrin.h>
+#endif
 
 namespace omp {
 
-// Evaluates hands with any number of cards up to 7.
-class HandEvaluator
+// Layouts of the non-flush lookup table. Each layout has its own perfect hash (offset table) and lookup table, which
+// are generated by HandEvaluatorT::outputLookupTables(). Hands with less than MIN_CARDS cards are left out of the
+// table, which makes it smaller. Fewer rows (bigger PERF_HASH_ROW_SHIFT) means a smaller offset table but a bigger
+// lookup table. The ranks are the same with every layout, except for the short deck layout, which uses its own
+// ranking rules.
+
+// Hands with 0-7 cards. (LookupTables.hxx, OffsetTable.hxx)
+struct FullLookupLayout
+{
+    static const bool SHORT_DECK = false;
+    static const unsigned MIN_CARDS = 0;
+    static const unsigned PERF_HASH_ROW_SHIFT = 12;
+    static const size_t LOOKUP_SIZE = 86547 + 1;
+    static const size_t ROW_COUNT = 8191;
+    static const uint16_t LOOKUP[LOOKUP_SIZE];
+    static const uint32_t PERF_HASH_ROW_OFFSETS[ROW_COUNT];
+};
+
+// Hands with 5-7 cards. (LookupTables5.hxx, OffsetTable5.hxx)
+struct FiveCardLookupLayout
+{
+    static const bool SHORT_DECK = false;
+    static const unsigned MIN_CARDS = 5;
+    static const unsigned PERF_HASH_ROW_SHIFT = 12;
+    static const size_t LOOKUP_SIZE = 83116 + 1;
+    static const size_t ROW_COUNT = 8191;
+    static const uint16_t LOOKUP[LOOKUP_SIZE];
+    static const uint32_t PERF_HASH_ROW_OFFSETS[ROW_COUNT];
+};
+
+// Hands with exactly 7 cards. Smallest tables, which makes it less sensitive to cache pressure from other work.
+// (LookupTables7.hxx, OffsetTable7.hxx)
+struct SevenCardLookupLayout
+{
+    static const bool SHORT_DECK = false;
+    static const unsigned MIN_CARDS = 7;
+    static const unsigned PERF_HASH_ROW_SHIFT = 12;
+    static const size_t LOOKUP_SIZE = 50137 + 1;
+    static const size_t ROW_COUNT = 8191;
+    static const uint16_t LOOKUP[LOOKUP_SIZE];
+    static const uint32_t PERF_HASH_ROW_OFFSETS[ROW_COUNT];
+};
+
+// Short deck (6+) hands with 0-7 cards. Only cards from six to ace are allowed. (LookupTablesShortDeck.hxx,
+// OffsetTableShortDeck.hxx)
+struct ShortDeckLookupLayout
+{
+    static const bool SHORT_DECK = true;
+    static const unsigned MIN_CARDS = 0;
+    static const unsigned PERF_HASH_ROW_SHIFT = 14;
+    static const size_t LOOKUP_SIZE = 17375 + 1;
+    static const size_t ROW_COUNT = 2048;
+    static const uint16_t LOOKUP[LOOKUP_SIZE];
+    static const uint32_t PERF_HASH_ROW_OFFSETS[ROW_COUNT];
+};
+
+// Tables and table generation shared by all evaluator layouts.
+class HandEvaluatorBase
 {
 public:
-    HandEvaluator();
+    static const size_t FLUSH_LOOKUP_SIZE = 8192;
+
+    // Prints the flush lookup table to out in the format of LookupTables.hxx (or LookupTablesShortDeck.hxx).
+    static void outputFlushLookup(std::ostream& out, bool shortDeck = false);
+
+protected:
+    // Generates the rank of every hand with normal or short deck rules. Non-flush hands with at least minCards cards
+    // are written to lookup[key + offsets[key >> rowShift]], or to a temporary table when offsets is null, in which
+    // case new offsets are calculated and returned. Returns the size of the used part of lookup.
+    static size_t generateTables(bool shortDeck, unsigned minCards, unsigned rowShift, const uint32_t* offsets,
+                                 uint16_t* lookup, size_t lookupSize, uint16_t* flushLookup,
+                                 std::vector<uint32_t>* newOffsets = nullptr);
+    static void outputTable(std::ostream& out, const char* name, const uint16_t* table, size_t size);
+    static void outputOffsetTable(std::ostream& out, const char* name, const std::vector<uint32_t>& offsets);
+
+    // Rank multipliers for non-flush and flush hands.
+    static const unsigned RANKS[RANK_COUNT];
+    static const unsigned FLUSH_RANKS[RANK_COUNT];
+
+    static const unsigned MAX_KEY;
+    static const uint16_t FLUSH_LOOKUP[FLUSH_LOOKUP_SIZE];
+    static const uint16_t SHORT_DECK_FLUSH_LOOKUP[FLUSH_LOOKUP_SIZE];
+
+private:
+    static bool cardInit;
+    static void initCardConstants();
+    static size_t calculatePerfectHashOffsets(unsigned rowShift, std::vector<uint32_t>& offsets);
+    static unsigned populateLookup(uint64_t rankCounts, unsigned ncards, unsigned handValue, unsigned endRank,
+                                   unsigned maxPair, unsigned maxTrips, unsigned maxStraight, bool flush = false);
+    static unsigned getKey(uint64_t rankCounts, bool flush);
+    static unsigned getBiggestStraight(uint64_t rankCounts);
+    static void outputTableStats(const char* name, const void* p, size_t elementSize, size_t count);
 
+    // State of the table generation.
+    static bool GEN_SHORT_DECK;
+    static unsigned GEN_MIN_CARDS;
+    static unsigned GEN_ROW_SHIFT;
+    static const uint32_t* GEN_OFFSETS;
+    static uint16_t* ORIG_LOOKUP;
+    static uint16_t* GEN_LOOKUP;
+    static uint16_t* GEN_FLUSH_LOOKUP;
+};
+
+// Evaluates hands with any number of cards up to 7 (at least tLayout::MIN_CARDS).
+template<class tLayout>
+class HandEvaluatorT : public HandEvaluatorBase
+{
+public:
     // Returns the rank of a hand as a 16-bit integer. Higher value is better. Can also rank hands with less than 5
     // cards. A missing card is considered the worst kicker, e.g. K < KQJT8 < A < AK < KKAQJ < AA < AA2 < AA4 < AA432.
     // Hand category can be extracted by dividing the value by 4096. 1=highcard, 2=pair, etc.
     template<bool tFlushPossible = true>
     OMP_FORCE_INLINE uint16_t evaluate(const Hand& hand) const
     {
-        omp_assert(hand.count() <= 7 && hand.count() == bitCount(hand.mask()));
+        omp_assert(hand.count() <= 7 && hand.count() >= MIN_CARDS && hand.count() == bitCount(hand.mask()));
+        omp_assert(!tLayout::SHORT_DECK || !(hand.mask() & SHORT_DECK_REMOVED_CARDS));
         if (!tFlushPossible || !hand.hasFlush()) {
             uint32_t key = hand.rankKey();
-            return LOOKUP[perfHash(key)];
+            return tLayout::LOOKUP[perfHash(key)];
         } else {
             uint16_t flushKey = hand.flushKey();
             omp_assert(flushKey < FLUSH_LOOKUP_SIZE);
-            return FLUSH_LOOKUP[flushKey];
+            return flushLookup()[flushKey];
         }
     }
 
-private:
-    static unsigned perfHash(unsigned key)
-    {
-        omp_assert(key <= MAX_KEY);
-        return key + PERF_HASH_ROW_OFFSETS[key >> PERF_HASH_ROW_SHIFT];
-    }
+    // Evaluates count hands and writes the rank of hands[i] to ranks[i]. Gives the same results as evaluate(). With
+    // AVX2 the hands are processed 8 at a time using gathers from the lookup tables, and flush and non-flush lanes are
+    // combined with a blend instead of branching on each hand. AVX2 support is detected at runtime when the build
+    // doesn't target AVX2 already. Falls back to the scalar evaluator otherwise.
+    void evaluateBatch(const Hand* hands, size_t count, uint16_t* ranks) const;
 
-    static bool cardInit;
-    static void initCardConstants();
-    static void staticInit();
-    static void calculatePerfectHashOffsets();
-    static unsigned populateLookup(uint64_t rankCounts, unsigned ncards, unsigned handValue, unsigned endRank,
-                                   unsigned maxPair, unsigned maxTrips, unsigned maxStraight, bool flush = false);
-    static unsigned getKey(uint64_t rankCounts, bool flush);
-    static unsigned getBiggestStraight(uint64_t rankCounts);
-    static void outputTableStats(const char* name, const void* p, size_t elementSize, size_t count);
+    // Evaluates board + hands[i] for count <= MAX_PLAYERS hands and returns a mask with bit i set for every hand that
+    // has the best rank. With AVX2 all the hands are evaluated at once like in evaluateBatch() and the mask comes from
+    // comparing the ranks with their maximum. Falls back to the scalar evaluator otherwise.
+    unsigned evaluateWinners(const Hand& board, const Hand* hands, unsigned count) const;
 
-    // Rank multipliers for non-flush and flush hands.
-    static const unsigned RANKS[RANK_COUNT];
-    static const unsigned FLUSH_RANKS[RANK_COUNT];
+    static const unsigned MIN_CARDS = tLayout::MIN_CARDS;
+    static const bool SHORT_DECK = tLayout::SHORT_DECK;
 
-    // Turn on to recalculate and output the offset array.
-    static const bool RECALCULATE_PERF_HASH_OFFSETS = false;
+    // Size of the non-flush lookup table including one element of padding, so that 32-bit gathers of the last entry
+    // stay inside the array.
+    static const size_t LOOKUP_SIZE = tLayout::LOOKUP_SIZE;
 
-    // Determines in how many rows the original lookup table is divided (2^shift). More rows means slightly smaller
-    // lookup table but much bigger offset table.
-    static const unsigned PERF_HASH_ROW_SHIFT = 12;
-    static const unsigned PERF_HASH_COLUMN_MASK = (1 << PERF_HASH_ROW_SHIFT) - 1;
+    // Generates the lookup tables at runtime using the layout's offset table. The evaluator itself uses constant
+    // tables, so this is only needed for benchmarking. lookup must have room for LOOKUP_SIZE elements and flushLookup
+    // for FLUSH_LOOKUP_SIZE elements. Not thread-safe.
+    static void generateLookupTables(uint16_t* lookup, uint16_t* flushLookup);
 
-    // Minimum number of cards required for evaluating a hand. Can be set to higher value to decrease lookup
-    // table size (requires hash recalculation).
-    static const unsigned MIN_CARDS = 0;
+    // Recalculates the perfect hash for the layout and prints the offset table and the non-flush lookup table in the
+    // format of OffsetTable.hxx and LookupTables.hxx. Slow and uses a lot of memory. Not thread-safe.
+    static void outputLookupTables(std::ostream& offsetTable, std::ostream& lookupTable, const char* layoutName);
 
-    // Lookup tables
-    static const unsigned MAX_KEY;
-    static const size_t FLUSH_LOOKUP_SIZE = 8192;
-    static uint16_t* ORIG_LOOKUP;
-    static uint16_t LOOKUP[86547 + RECALCULATE_PERF_HASH_OFFSETS * 100000000];
-    static uint16_t FLUSH_LOOKUP[FLUSH_LOOKUP_SIZE];
-    static uint32_t PERF_HASH_ROW_OFFSETS[8191 + RECALCULATE_PERF_HASH_OFFSETS * 100000];
+private:
+    // Twos to fives in the card mask of a Hand.
+    static const uint64_t SHORT_DECK_REMOVED_CARDS = 0x000f000f000f000full;
+
+    static const uint16_t* flushLookup()
+    {
+        return tLayout::SHORT_DECK ? SHORT_DECK_FLUSH_LOOKUP : FLUSH_LOOKUP;
+    }
+
+    static unsigned perfHash(unsigned key)
+    {
+        omp_assert(key <= MAX_KEY);
+        return key + tLayout::PERF_HASH_ROW_OFFSETS[key >> tLayout::PERF_HASH_ROW_SHIFT];
+    }
+
+    #if OMP_AVX2_KERNELS
+    OMP_TARGET_AVX2 static __m256i evaluate8Avx2(const Hand* hands);
+    OMP_TARGET_AVX2 static size_t evaluateBatchAvx2(const Hand* hands, size_t count, uint16_t* ranks);
+    OMP_TARGET_AVX2 static unsigned evaluateWinnersAvx2(const Hand& board, const Hand* hands, unsigned count);
+    #endif
 };
 
+// The default evaluator handles any number of cards. The others are smaller variants for hands with at least
+// 5 or exactly 7 cards. Which one is fastest depends on the machine and how much cache is left for the evaluator, see
+// examples/benchmark.cpp. ShortDeckHandEvaluator ranks short deck hands, where flush beats full house (see
+// SHORT_DECK_FLUSH in Constants.h) and A-6-7-8-9 is a straight.
+typedef HandEvaluatorT<FullLookupLayout> HandEvaluator;
+typedef HandEvaluatorT<FiveCardLookupLayout> FiveCardHandEvaluator;
+typedef HandEvaluatorT<SevenCardLookupLayout> SevenCardHandEvaluator;
+typedef HandEvaluatorT<ShortDeckLookupLayout> ShortDeckHandEvaluator;
+
 }
 
 #endif // OMP_HAND_EVALUATOR_H
@@ -0,0 +1,177 @@
+#ifndef OMP_LOOKUP_CACHE_H
+#define OMP_LOOKUP_CACHE_H
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+namespace omp {
+
+// Thread-safe cache from keys to values with a memory budget. The keys are spread over shards that each have
+// their own lock, so threads rarely wait for each other. When a shard is full, entries are evicted with the CLOCK
+// algorithm: entries get a second chance if they have been used since the clock hand last passed them, which
+// approximates LRU without any bookkeeping on lookups. Values can have different sizes (see valueBytes()).
+template<class tKey, class tValue, class tHash = std::hash<tKey>>
+class LookupCache
+{
+public:
+    // Approximate memory used by one entry without the memory that the value allocates, including the hash map node.
+    static const size_t ENTRY_BYTES = sizeof(tKey) + sizeof(tValue) + sizeof(size_t) + sizeof(bool)
+        + 4 * sizeof(void*);
+
+    LookupCache(size_t maxBytes)
+        : mShards(new Shard[SHARD_COUNT])
+    {
+        setMaxBytes(maxBytes);
+    }
+
+    // Sets the memory budget and removes all entries. Not thread-safe.
+    void setMaxBytes(size_t maxBytes)
+    {
+        mMaxBytes = maxBytes;
+        clear();
+    }
+
+    size_t maxBytes() const
+    {
+        return mMaxBytes;
+    }
+
+    // Calls f(value) for the value of key and marks the entry as used. Returns false if key is not in the cache. The
+    // shard stays locked during the call.
+    template<class tFunc>
+    bool find(const tKey& key, tFunc f)
+    {
+        Shard& shard = mShards[shardIndex(key)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end())
+            return false;
+        Entry& entry = shard.entries[it->second];
+        entry.used = true;
+        f(const_cast<const tValue&>(entry.value));
+        return true;
+    }
+
+    // Adds an entry unless key is already in the cache, evicting other entries until the shard has room for it.
+    void insert(const tKey& key, tValue value)
+    {
+        size_t bytes = ENTRY_BYTES + valueBytes(value);
+        size_t shardMaxBytes = mMaxBytes / SHARD_COUNT;
+        if (bytes > shardMaxBytes)
+            return;
+
+        Shard& shard = mShards[shardIndex(key)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.index.count(key))
+            return;
+        while (shard.bytes + bytes > shardMaxBytes)
+            evict(shard);
+
+        shard.entries.push_back(Entry{ key, std::move(value), bytes, false });
+        shard.index.emplace(key, shard.entries.size() - 1);
+        shard.bytes += bytes;
+    }
+
+    // Removes all entries.
+    void clear()
+    {
+        for (unsigned i = 0; i < SHARD_COUNT; ++i) {
+            Shard& shard = mShards[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.index.clear();
+            shard.entries.clear();
+            shard.entries.shrink_to_fit();
+            shard.bytes = 0;
+            shard.hand = 0;
+        }
+    }
+
+    // Calls f(key, value) for every entry.
+    template<class tFunc>
+    void forEach(tFunc f) const
+    {
+        for (unsigned i = 0; i < SHARD_COUNT; ++i) {
+            Shard& shard = mShards[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const Entry& entry : shard.entries)
+                f(entry.key, entry.value);
+        }
+    }
+
+private:
+    static const unsigned SHARD_SHIFT = 6;
+    static const unsigned SHARD_COUNT = 1 << SHARD_SHIFT;
+
+    struct Entry
+    {
+        tKey key;
+        tValue value;
+        size_t bytes;
+        bool used;
+    };
+
+    // Aligned to a cache line so that the locks of different shards don't share a line.
+    struct alignas(64) Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<tKey, size_t, tHash> index;
+        std::vector<Entry> entries;
+        size_t bytes = 0;
+        size_t hand = 0;
+    };
+
+    // Memory allocated by a value.
+    template<class T>
+    static size_t valueBytes(const T&)
+    {
+        return 0;
+    }
+
+    template<class T>
+    static size_t valueBytes(const std::vector<T>& value)
+    {
+        return value.capacity() * sizeof(T);
+    }
+
+    // Advances the clock hand to the first entry that hasn't been used since the last pass and removes it. The last
+    // entry is moved to its place.
+    static void evict(Shard& shard)
+    {
+        for (;; shard.hand = (shard.hand + 1) % shard.entries.size()) {
+            Entry& entry = shard.entries[shard.hand];
+            if (!entry.used)
+                break;
+            entry.used = false;
+        }
+
+        Entry& entry = shard.entries[shard.hand];
+        shard.index.erase(entry.key);
+        shard.bytes -= entry.bytes;
+        if (shard.hand != shard.entries.size() - 1) {
+            entry = std::move(shard.entries.back());
+            shard.index[entry.key] = shard.hand;
+        }
+        shard.entries.pop_back();
+        if (shard.hand == shard.entries.size())
+            shard.hand = 0;
+    }
+
+    // The hashes are often sequential or share low bits, so they are mixed before picking a shard.
+    static unsigned shardIndex(const tKey& key)
+    {
+        return (unsigned)(((uint64_t)tHash()(key) * 0x9e3779b97f4a7c15ull) >> (64 - SHARD_SHIFT));
+    }
+
+    std::unique_ptr<Shard[]> mShards;
+    size_t mMaxBytes;
+};
+
+}
+
+#endif // OMP_LOOKUP_CACHE_H
@@ -0,0 +1,5927 @@
+#include "HandEvaluator.h"
+
+// Lookup tables for the evaluator. Generated by HandEvaluator::outputLookupTables() and
+// HandEvaluatorBase::outputFlushLookup().
+const uint16_t omp::FullLookupLayout::LOOKUP[] {
+    12402, 28702, 10001, 32850, 8223, 16564, 32850, 12495, 32772, 9092, 32850, 9729, 32785, 12402, 8219, 28713,
+    12378, 8818, 12533, 16722, 8843, 32788, 32788, 28749, 32800, 12447, 32776, 10031, 12448, 28678, 28701, 9736,
+    16406, 32802, 12331, 28745, 16405, 9147, 8822, 12462, 32826, 28714, 28685, 10349, 32826, 12546, 16418, 32841,
+    12344, 28713, 12594, 10324, 12463, 16893, 10349, 12472, 28714, 28714, 12473, 12522, 8855, 12344, 16814, 12440,
+    32790, 12520, 9476, 16498, 16737, 12536, 12605, 28690, 16403, 32816, 4473, 12366, 28723, 12523, 16579, 16557,
+    9773, 32774, 9705, 12331, 12415, 12451, 12451, 12428, 28737, 12584, 28690, 28735, 12679, 28704, 28685, 4237,
+    16643, 28748, 32842, 28728, 28689, 12449, 8276, 12679, 12357, 9467, 12403, 8577, 12512, 16973, 28757, 12393,
+    10663, 16499, 4250, 32789, 12644, 32817, 28724, 32778, 8587, 28716, 32803, 12296, 16745, 8584, 28736, 9494,
+    32843, 12656, 12714, 4635, 12714, 28699, 8613, 12714, 9802, 16816, 4635, 28761, 28770, 28747, 12585, 17045,
+    12392, 28769, 28716, 12629, 17045, 32776, 16940, 28770, 20486, 12585, 28689, 28728, 4374, 8883, 28697, 12393,
+    28724, 16586, 9217, 28724, 12668, 12381, 28700, 12452, 12656, 8902, 16981, 12417, 16509, 16667, 8234, 20484,
+    12405, 9116, 9795, 4487, 28686, 16981, 32843, 28734, 10627, 10326, 8247, 8542, 28690, 12367, 12498, 12369,
+    12656, 9168, 32778, 9484, 10688, 20483, 12485, 4300, 10688, 28771, 16959, 32867, 32841, 20482, 16737, 9454,
+    12775, 28705, 12681, 20484, 12775, 28703, 28698, 32816, 8602, 10695, 16825, 10712, 9469, 17031, 8873, 32855,
+    12345, 12567, 8848, 12427, 32857, 16753, 28717, 9766, 10002, 16746, 12677, 32857, 28723, 28717, 16594, 28761,
+    16816, 9756, 4827, 16432, 32857, 12752, 8338, 12430, 12810, 12657, 12478, 9219, 12536, 28687, 8271, 4890,
+    12741, 28771, 12729, 11005, 28693, 11005, 8649, 10905, 11005, 9547, 28722, 32777, 12637, 4609, 32804, 4485,
+    32857, 12333, 16665, 28709, 28690, 8655, 16467, 12418, 12753, 28692, 16507, 9468, 12752, 8939, 9254, 28758,
+    10941, 9202, 12522, 12429, 16437, 12358, 9832, 9819, 10946, 16587, 4969, 28702, 16755, 12429, 9829, 4737,
+    16754, 4526, 28686, 16741, 12331, 12318, 16667, 9791, 10987, 8658, 4976, 9520, 10444, 32813, 12505, 12550,
+    12346, 17045, 28781, 28680, 28783, 28691, 32867, 12586, 28701, 9757, 12634, 28699, 10735, 17112, 16484, 16832,
+    12681, 32792, 16499, 12620, 12679, 8650, 10749, 16752, 9562, 12821, 12586, 9737, 12646, 4436, 12773, 8367,
+    8658, 28733, 32789, 8367, 5077, 12485, 12668, 16492, 32855, 32828, 5062, 5077, 32840, 28783, 32870, 16972,
+    32865, 16751, 28745, 16405, 5077, 10720, 32868, 4634, 32803, 12663, 12538, 12750, 10337, 20486, 5086, 28681,
+    28741, 9562, 32779, 5002, 28770, 12429, 10394, 8238, 8667, 4861, 4563, 9564, 28674, 32856, 32792, 9540,
+    5077, 20486, 12670, 16822, 16862, 28673, 10072, 32844, 17053, 8611, 28825, 28760, 10407, 9236, 28677, 12753,
+    16728, 12334, 32890, 28734, 32775, 4184, 10415, 28723, 32890, 32792, 10756, 10756, 32779, 4777, 28721, 8367,
+    10756, 8667, 28677, 9554, 5087, 28698, 12778, 12730, 16409, 28705, 28752, 12685, 10684, 28678, 11022, 16518,
+    9720, 12778, 17051, 32818, 28785, 12334, 32816, 28717, 12775, 32839, 12868, 9773, 8368, 12883, 12294, 8549,
+    12393, 12572, 12496, 8823, 32855, 32778, 9783, 28742, 28783, 32826, 12764, 28742, 9713, 16677, 32831, 12872,
+    10749, 28678, 11275, 28692, 16734, 12870, 12742, 12836, 20487, 11018, 28679, 9729, 16756, 12759, 4694, 12439,
+    12676, 28738, 12512, 4886, 9219, 12332, 12861, 5017, 28693, 9218, 12861, 20483, 17067, 28694, 28677, 28674,
+    12867, 12861, 8920, 12812, 12392, 16437, 12403, 16825, 16902, 9713, 10071, 32776, 4255, 11310, 32883, 12440,
+    28757, 32806, 12335, 16587, 32858, 12872, 17058, 5207, 11310, 28748, 32858, 5084, 8667, 8957, 16604, 10152,
+    28763, 10946, 32804, 9196, 12929, 8683, 9292, 16816, 28702, 10170, 32854, 11250, 12477, 5144, 9217, 28781,
+    8396, 12345, 12850, 9580, 28749, 12618, 9892, 28680, 32854, 20485, 12825, 12514, 16834, 28694, 28693, 12442,
+    12381, 16643, 8234, 28741, 11347, 12838, 9886, 12318, 28781, 10161, 12682, 28717, 16605, 20483, 16844, 12369,
+    20483, 12825, 5353, 12299, 28781, 12431, 5354, 28693, 12430, 5369, 11246, 8993, 28697, 5354, 5369, 5273,
+    16485, 10974, 5275, 32845, 12488, 8554, 16911, 12587, 32832, 8704, 4949, 8843, 10430, 28704, 8321, 32843,
+    11055, 10768, 28682, 12382, 9600, 16449, 10286, 12670, 28704, 28776, 16687, 8410, 12860, 16439, 32856, 32882,
+    8249, 9605, 16677, 32829, 28784, 12594, 9117, 9160, 8359, 12455, 12406, 32826, 10460, 32845, 8404, 10795,
+    16450, 32813, 9769, 32792, 5462, 9463, 28682, 12682, 12941, 28712, 12941, 12537, 10084, 12941, 32858, 8413,
+    16579, 12619, 5347, 9278, 12647, 12333, 28680, 28706, 28769, 28769, 5471, 12730, 16592, 32932, 28794, 12359,
+    28793, 5470, 28794, 9275, 9610, 12494, 20488, 9853, 12311, 4545, 11310, 28797, 16687, 28798, 12778, 10773,
+    5176, 16608, 12417, 28687, 32895, 5092, 8413, 28769, 5112, 5274, 10490, 12455, 16981, 12367, 32818, 28742,
+    32857, 12381, 12702, 8394, 10444, 8838, 12929, 12394, 10477, 12359, 16762, 28795, 28795, 28677, 16529, 12370,
+    16446, 28705, 17215, 32775, 9118, 28705, 17181, 5497, 28765, 16449, 16954, 28794, 8530, 12813, 10706, 12692,
+    4312, 12821, 28764, 28789, 12342, 9617, 12850, 5518, 12755, 9617, 28698, 12438, 28701, 9611, 4367, 11303,
+    32837, 12742, 28770, 11094, 12585, 12813, 8548, 17215, 16846, 28725, 32934, 9319, 16767, 28680, 12347, 11101,
+    9317, 17130, 9319, 9155, 32880, 12571, 12731, 28681, 9609, 10749, 12731, 9463, 11055, 17141, 5462, 11101,
+    16593, 32883, 12356, 28721, 28789, 8722, 12379, 12311, 12716, 16530, 12910, 12454, 9310, 32819, 28715, 32856,
+    12750, 12659, 32830, 11071, 32779, 4796, 28771, 5627, 5627, 5627, 28828, 11101, 8722, 28711, 16846, 12860,
+    28783, 11287, 9517, 28794, 9540, 9019, 16844, 28710, 12928, 32832, 12941, 4933, 32868, 5561, 16583, 4984,
+    11050, 12946, 28799, 28781, 12886, 9579, 16675, 28688, 12707, 4217, 28688, 12878, 8301, 9021, 12345, 12928,
+    28816, 32793, 8830, 12486, 32881, 32890, 28733, 12311, 12815, 16609, 16411, 28733, 12343, 10756, 32881, 28777,
+    10759, 20482, 12645, 20488, 16518, 12695, 10490, 12369, 10184, 12683, 20483, 12461, 12371, 12501, 12659, 28749,
+    32814, 12731, 12599, 9614, 12850, 28697, 9802, 8664, 5433, 12932, 9174, 5671, 28721, 5671, 5099, 8404,
+    5671, 12511, 4227, 28757, 32901, 32901, 9007, 12501, 16924, 12701, 32819, 12563, 5453, 16421, 5464, 12871,
+    28740, 16901, 17224, 28774, 10169, 16846, 28766, 28775, 4365, 4890, 32830, 32788, 12299, 9885, 12605, 28690,
+    9321, 16571, 16677, 16673, 12609, 10105, 12692, 28796, 10775, 10107, 28697, 10795, 12940, 8396, 9809, 28771,
+    17149, 11101, 28827, 12774, 16766, 9189, 12716, 28705, 12932, 28674, 12742, 12931, 8981, 12755, 12873, 8405,
+    28711, 8359, 9597, 9607, 16819, 5076, 28781, 32858, 12825, 12621, 4186, 12887, 12839, 12754, 28775, 12851,
+    12887, 12887, 28766, 11364, 5439, 10699, 28678, 17003, 17220, 12762, 11087, 32868, 12875, 28674, 16764, 5443,
+    9802, 28730, 32870, 12875, 8713, 16436, 28762, 9281, 28678, 28796, 12922, 10368, 12875, 5631, 28675, 5574,
+    32801, 4169, 9839, 10699, 28709, 28778, 12383, 12681, 12449, 32855, 32896, 12851, 28713, 12797, 12383, 10802,
+    10415, 28694, 5514, 32935, 10204, 28694, 9301, 16451, 12875, 4211, 9182, 12596, 28766, 10217, 32901, 28816,
+    28799, 12849, 32814, 12988, 10512, 28733, 13003, 12834, 12631, 28719, 12788, 8553, 16412, 12461, 32907, 11310,
+    28678, 9908, 5592, 12755, 28743, 11545, 12992, 12319, 17151, 32897, 12992, 28743, 32897, 12298, 11574, 17080,
+    32779, 9222, 9607, 12356, 20489, 12911, 9019, 9619, 4636, 16735, 28707, 12599, 32894, 32819, 28793, 12547,
+    32867, 17031, 12801, 12981, 16596, 12442, 12969, 4296, 9899, 12987, 12981, 16887, 13003, 16746, 12310, 10815,
+    5564, 12730, 12478, 16944, 28749, 32819, 16764, 28761, 32814, 12335, 32869, 12567, 12861, 12839, 12992, 28782,
+    9320, 10507, 12704, 12332, 12632, 11354, 12751, 12647, 32845, 16682, 12290, 11058, 28695, 12369, 28749, 8414,
+    13049, 28737, 12779, 11354, 12956, 10632, 9020, 16752, 12453, 32884, 12526, 12958, 28695, 12645, 12982, 12993,
+    10213, 12525, 12392, 32857, 12488, 11399, 12970, 32859, 12994, 28760, 8446, 12348, 10946, 12958, 8403, 17215,
+    5772, 16452, 32859, 12993, 16929, 9938, 12360, 28737, 12850, 9321, 12336, 28702, 9051, 9917, 12489, 28690,
+    12300, 28734, 16775, 12955, 5805, 12921, 10963, 32884, 9265, 32875, 8657, 28716, 13052, 17234, 10546, 28793,
+    32879, 8620, 17234, 5858, 28793, 10546, 28724, 17230, 5368, 32833, 32900, 9039, 11508, 17233, 10546, 32794,
+    16764, 28694, 17230, 16766, 16855, 12980, 28754, 12360, 5913, 28784, 32855, 28794, 28706, 32820, 12598, 8956,
+    12324, 28716, 8760, 28704, 12827, 16776, 11096, 5919, 10976, 17232, 10546, 4952, 10802, 32807, 9331, 12684,
+    11575, 28753, 32894, 28704, 12426, 28801, 13061, 16846, 12299, 10930, 10802, 17161, 32866, 9573, 5629, 16540,
+    8704, 16761, 32907, 5824, 10851, 10851, 11115, 11661, 12588, 28816, 10851, 12971, 13048, 28766, 5914, 9366,
+    16777, 8469, 12971, 12798, 16856, 28743, 12659, 6022, 6006, 9058, 11094, 9169, 12995, 32832, 10677, 28770,
+    17088, 12588, 6022, 5592, 6014, 28788, 12946, 12491, 28743, 28704, 12322, 12622, 12719, 12819, 12968, 13049,
+    10940, 5945, 5064, 16619, 12983, 4676, 6043, 20485, 5448, 9666, 12324, 12959, 16533, 9642, 20482, 12959,
+    8769, 11399, 9265, 16458, 11698, 9496, 32831, 16773, 28762, 10816, 32880, 16413, 8453, 16598, 12324, 11646,
+    16965, 16849, 12707, 32806, 5472, 16609, 11028, 16538, 12957, 10858, 32906, 5720, 32792, 8469, 10858, 6026,
+    11698, 9656, 6030, 16615, 32863, 12780, 28729, 28705, 8967, 32805, 10425, 11414, 32793, 8758, 17156, 17234,
+    28735, 17131, 8440, 9601, 4431, 11395, 10811, 12623, 12360, 28753, 28717, 9673, 9367, 12851, 32828, 17411,
+    5221, 32937, 10065, 28686, 17003, 32832, 10674, 12442, 12403, 16857, 12755, 12464, 28755, 8683, 5111, 32803,
+    12628, 12648, 12525, 28737, 11157, 12744, 20483, 28755, 12980, 28743, 32854, 12802, 12971, 12910, 12887, 32909,
+    32887, 17411, 12732, 13061, 9918, 5960, 12995, 32902, 9077, 9636, 17088, 8778, 5040, 32807, 9370, 9077,
+    8611, 12547, 12716, 28716, 13018, 32902, 12989, 16925, 13048, 9873, 28725, 12687, 12754, 32832, 28690, 9376,
+    20481, 9530, 8621, 9375, 28721, 12791, 32836, 16699, 16815, 6027, 6057, 9059, 16491, 12945, 12851, 28794,
+    12885, 17004, 11326, 32830, 9919, 13041, 12821, 12636, 12875, 6125, 28781, 12731, 9358, 12958, 28828, 12432,
+    6196, 28751, 13052, 8461, 8779, 28755, 12983, 32794, 9616, 12516, 9262, 8779, 13071, 13071, 13071, 12945,
+    9294, 28695, 6224, 9813, 8480, 8495, 17130, 6224, 17093, 28826, 13019, 12959, 5411, 28789, 5929, 28767,
+    12933, 16856, 10554, 32804, 10895, 12744, 9946, 8768, 6123, 10262, 16726, 28709, 32836, 16484, 5541, 16388,
+    12995, 28703, 13018, 10264, 16993, 13005, 12459, 12394, 12312, 13031, 16857, 12825, 9076, 16407, 11157, 12366,
+    13031, 9635, 28774, 28767, 13051, 9276, 16856, 12492, 12911, 32936, 9076, 16912, 13060, 13031, 28777, 12783,
+    9965, 28741, 12503, 28809, 9666, 32843, 8461, 12514, 28805, 9078, 28809, 12636, 10490, 13019, 16924, 16419,
+    13007, 16538, 32872, 28809, 11647, 13048, 5585, 12322, 28723, 5477, 32890, 11166, 17002, 20486, 12944, 12296,
+    16536, 16450, 12307, 32819, 12442, 28808, 13064, 16990, 32906, 9533, 16613, 32781, 11417, 32856, 9492, 28809,
+    12852, 9367, 12694, 28806, 17294, 32869, 28682, 16461, 11434, 28676, 28806, 12888, 28742, 12671, 28806, 32818,
+    12971, 17124, 12455, 28806, 9579, 28702, 6057, 13070, 5541, 10743, 11609, 12575, 17167, 16857, 28773, 9377,
+    28793, 4171, 12405, 32792, 10867, 28693, 12839, 8896, 12957, 12864, 17220, 12864, 28713, 12754, 12864, 28806,
+    11455, 12576, 17240, 32909, 11420, 12300, 10458, 12426, 13063, 11455, 10437, 16609, 13043, 28807, 16449, 28715,
+    32839, 12885, 17303, 9488, 6224, 6252, 16491, 9683, 32910, 17241, 10562, 10459, 20482, 6180, 32877, 11129,
+    12585, 20481, 28823, 12873, 20482, 11455, 10244, 16845, 16563, 32859, 28764, 28710, 9385, 12461, 9168, 32845,
+    12319, 5561, 32937, 12825, 16451, 12852, 11464, 10851, 12319, 9744, 10853, 12682, 12852, 8535, 11653, 32885,
+    5579, 28694, 17411, 6335, 32891, 28694, 28794, 8788, 12359, 6117, 9526, 9020, 32882, 10976, 16735, 28711,
+    12473, 12384, 28771, 5739, 28794, 6363, 28686, 6363, 16858, 16858, 6363, 16756, 16858, 9076, 17294, 16542,
+    32818, 12852, 9642, 9085, 4278, 28685, 32897, 28808, 11166, 10274, 12345, 6297, 17014, 12415, 12359, 28757,
+    28704, 11637, 32828, 4764, 10838, 28783, 12804, 12660, 6234, 13055, 6315, 9087, 12588, 12660, 6101, 16542,
+    12660, 8490, 12918, 32794, 12596, 17015, 9975, 13002, 28772, 9676, 28722, 28805, 10513, 9791, 32779, 9521,
+    11713, 12631, 8758, 12599, 9321, 32846, 28805, 8196, 28677, 12779, 28806, 17410, 12660, 28706, 12354, 17170,
+    9918, 9680, 6229, 32936, 12959, 5971, 12803, 10870, 9686, 6022, 16650, 9011, 28735, 12966, 6407, 12778,
+    12396, 10218, 17244, 28794, 16684, 9384, 17410, 8789, 13015, 8779, 20485, 32934, 10291, 12754, 20483, 28725,
+    11464, 12898, 16428, 16858, 17015, 6152, 28714, 5835, 9291, 10162, 11160, 12402, 8260, 12893, 9387, 32843,
+    16982, 12884, 12312, 12499, 10175, 12876, 13015, 28739, 8789, 32839, 13015, 12780, 28753, 32815, 11712, 12537,
+    5663, 17169, 17093, 12455, 32842, 28779, 28705, 28787, 11137, 10869, 8584, 12756, 32794, 11682, 28808, 13066,
+    12402, 5112, 12705, 28752, 28793, 12438, 28778, 28675, 12383, 10496, 9687, 28687, 32843, 6415, 28753, 9687,
+    32853, 12849, 32898, 12983, 20483, 10943, 5665, 16542, 28685, 9825, 12384, 28680, 13078, 16918, 12767, 9388,
+    32855, 28716, 10206, 28705, 12384, 10794, 12539, 11157, 16858, 16562, 9388, 28719, 13079, 12311, 16993, 32826,
+    12344, 12690, 32935, 13076, 12396, 28695, 10461, 16754, 9377, 6452, 8790, 8469, 16981, 12534, 12801, 8790,
+    6248, 17173, 32866, 8790, 17309, 12563, 9211, 9088, 17313, 12563, 28800, 28679, 17242, 32877, 28754, 6187,
+    12430, 17202, 10578, 12655, 9897, 12909, 28805, 16972, 28701, 32818, 9057, 32854, 9386, 6187, 10706, 10760,
+    6328, 17137, 28734, 28697, 9175, 12543, 17172, 8658, 9197, 17067, 12799, 8428, 28813, 10712, 28747, 9322,
+    12967, 16990, 28686, 12714, 9085, 16542, 12633, 6328, 32885, 12624, 12946, 12635, 28812, 6292, 4317, 8491,
+    13072, 10218, 16617, 6315, 12912, 28808, 4175, 13031, 8786, 5112, 12968, 4800, 11058, 9635, 17217, 12732,
+    28783, 12449, 5922, 28813, 12418, 17033, 10962, 12993, 12928, 11093, 12741, 12456, 12395, 5454, 12611, 28809,
+    20487, 32780, 5147, 6231, 12886, 10875, 12948, 17293, 11679, 5507, 17001, 11624, 16745, 20488, 32843, 4726,
+    32910, 16446, 20483, 16857, 9086, 16773, 28716, 16925, 32851, 12932, 8586, 5088, 17318, 8785, 12334, 9963,
+    17095, 12821, 28787, 6452, 9918, 32914, 32913, 32914, 13065, 6411, 32914, 12359, 12707, 11713, 11470, 28806,
+    10116, 16937, 9077, 32827, 12850, 12535, 6215, 9387, 28749, 13053, 9387, 12860, 13077, 11055, 11622, 9975,
+    17094, 32932, 28753, 11608, 17001, 17170, 28705, 12876, 5899, 12707, 17106, 12740, 28705, 12609, 12752, 11109,
+    11474, 12827, 10723, 32855, 10795, 11470, 32867, 28693, 28758, 16737, 12598, 11472, 11459, 20490, 12511, 8790,
+    12888, 28811, 20485, 12380, 12876, 17238, 9729, 10152, 12491, 11463, 17318, 4177, 12600, 9058, 16779, 28771,
+    12636, 9388, 5062, 17251, 28801, 28742, 12449, 5033, 28681, 5896, 10646, 12606, 5916, 32858, 32934, 20486,
+    12418, 9089, 12768, 28740, 8342, 13051, 12525, 16618, 16754, 12644, 12562, 4978, 32844, 16598, 12368, 32856,
+    12852, 12948, 8658, 10729, 11181, 11715, 28682, 10490, 9211, 11717, 12539, 9496, 17130, 17316, 12874, 32781,
+    11716, 12960, 28788, 28700, 10749, 28787, 32871, 28763, 28743, 8767, 12996, 12996, 17251, 13065, 12402, 16895,
+    20481, 28682, 12502, 12477, 11171, 17016, 16509, 28828, 9042, 28683, 32935, 12573, 16794, 12803, 17320, 28805,
+    32815, 9935, 28786, 11703, 12474, 28738, 11021, 12984, 10552, 5275, 9265, 11405, 12660, 28754, 28755, 12826,
+    9367, 32844, 11754, 20487, 16922, 8852, 12407, 32914, 12587, 11111, 13005, 28787, 12696, 12669, 32790, 32793,
+    6406, 28733, 5592, 16621, 11130, 10349, 12935, 28691, 17249, 28800, 28694, 9864, 9620, 4390, 12501, 32777,
+    4371, 16937, 32779, 11227, 28761, 28828, 12464, 28741, 10526, 20490, 28787, 13079, 12815, 11474, 11763, 12960,
+    28799, 4473, 12876, 28800, 10208, 12960, 13135, 11028, 32844, 10871, 13047, 6460, 12768, 28732, 12972, 28806,
+    13121, 13135, 10584, 11181, 4491, 8490, 12679, 12756, 11048, 32856, 16526, 28788, 6056, 28805, 16441, 10517,
+    13112, 28776, 32881, 13124, 5814, 13124, 11873, 32922, 12803, 16507, 11762, 9673, 16687, 28798, 13007, 10129,
+    16728, 9683, 9984, 28705, 10516, 17245, 13101, 13159, 28695, 11880, 5983, 16606, 13118, 16699, 12461, 12672,
+    9356, 28696, 11652, 9385, 12887, 9321, 28770, 12885, 12585, 10571, 32828, 28700, 16604, 28795, 11855, 12731,
+    16914, 12765, 28741, 11354, 28744, 28720, 16937, 20486, 12744, 28718, 28775, 16541, 6451, 11436, 12306, 6456,
+    6201, 16542, 32858, 4319, 16449, 17060, 28749, 12897, 16492, 8366, 5325, 13044, 32815, 13145, 11916, 17224,
+    11480, 16604, 11917, 9898, 12984, 28696, 9089, 12928, 28748, 11917, 11772, 11771, 11772, 11170, 13059, 12972,
+    4381, 12731, 28682, 13126, 12462, 11945, 17171, 12644, 28740, 13126, 11055, 28781, 28744, 16858, 10871, 28673,
+    32805, 12334, 16765, 20483, 13131, 9973, 12491, 11182, 12450, 32833, 28776, 28760, 28773, 12728, 12359, 16502,
+    32815, 9388, 12358, 12983, 9302, 32911, 16529, 28771, 12923, 5577, 11769, 13114, 9089, 13133, 32777, 4421,
+    12972, 10544, 11310, 16526, 12440, 32832, 10285, 9374, 12803, 13170, 5246, 13005, 8604, 12671, 28676, 4720,
+    28794, 12333, 28692, 12305, 28701, 20484, 10750, 16846, 12624, 12390, 11610, 28734, 32856, 28751, 12803, 17216,
+    28757, 5432, 32923, 10498, 6350, 9054, 8904, 9320, 12500, 13041, 28734, 32827, 28801, 12876, 12695, 13050,
+    28757, 32935, 16808, 9038, 28765, 17011, 9022, 12405, 8883, 12537, 11957, 32899, 32919, 32781, 11959, 16726,
+    12696, 12923, 12452, 12860, 28684, 12608, 11976, 28761, 28789, 12320, 16585, 12740, 12468, 5638, 11753, 10581,
+    28796, 16673, 12864, 13192, 8285, 11275, 11354, 8254, 28763, 12450, 11685, 12380, 32936, 9610, 12840, 11286,
+    28684, 16540, 9051, 9620, 8491, 16835, 11407, 16405, 11460, 5061, 6152, 12756, 13115, 32877, 11690, 32869,
+    12574, 12921, 32807, 13084, 12943, 12396, 17038, 11997, 28714, 10795, 13044, 12295, 12432, 10663, 32829, 9675,
+    17174, 16580, 11945, 13160, 16598, 32791, 28697, 28740, 9086, 16745, 12910, 28724, 13115, 9228, 28783, 32904,
+    8470, 17062, 28783, 9492, 8461, 12453, 10811, 20487, 32803, 17026, 12928, 16667, 12764, 28708, 12864, 12599,
+    4104, 12670, 9620, 12006, 12006, 12006, 12886, 28782, 13103, 16925, 12005, 12466, 5336, 12922, 6315, 12648,
+    13044, 20488, 11399, 13103, 12852, 12310, 28793, 28796, 12874, 8621, 16607, 12396, 10510, 8301, 12480, 9022,
+    12996, 12406, 11473, 16609, 11414, 8423, 8932, 28700, 13103, 16777, 32792, 13112, 28694, 10802, 32820, 12005,
+    16991, 13183, 8723, 17306, 8852, 8489, 28694, 12342, 9320, 12779, 28738, 28697, 28673, 11652, 28746, 10881,
+    32826, 12751, 11648, 12391, 12483, 12540, 32827, 12597, 12719, 32833, 32844, 12887, 12598, 12414, 12851, 4369,
+    12295, 10760, 10285, 28768, 4696, 12526, 13091, 6432, 13044, 12634, 10579, 13008, 12912, 9621, 32816, 20482,
+    12861, 32792, 16588, 32828, 32911, 11758, 17253, 12334, 12684, 12743, 12393, 8949, 12581, 10986, 17317, 28698,
+    11949, 28771, 12960, 10749, 32775, 10004, 12380, 12815, 4970, 9607, 10218, 28766, 28810, 12419, 28684, 5187,
+    13201, 13203, 4446, 11769, 13028, 16518, 13044, 11951, 16658, 13048, 12455, 12972, 28723, 13007, 16743, 5461,
+    28734, 12839, 8837, 11873, 13197, 13006, 32789, 9919, 16594, 11754, 13068, 11363, 12850, 20489, 32859, 32845,
+    11582, 13039, 13170, 10502, 8490, 28699, 32790, 9078, 9377, 28712, 12755, 9076, 32836, 12498, 13074, 17201,
+    12720, 28728, 32789, 13197, 12480, 4890, 28721, 13056, 28767, 11697, 12367, 11736, 5352, 5033, 9617, 16417,
+    28778, 12309, 13005, 28696, 16564, 12970, 9860, 5673, 8424, 12720, 28735, 12014, 5088, 11042, 9264, 6188,
+    16688, 11990, 11694, 12804, 13116, 13104, 17091, 28704, 13140, 16491, 12444, 32842, 12539, 10217, 32870, 13208,
+    11574, 8790, 16923, 12395, 8721, 28708, 9781, 11048, 32902, 28793, 12296, 12624, 16621, 28676, 16530, 32933,
+    6409, 11777, 28783, 12972, 10563, 8369, 13126, 12053, 12053, 32845, 10725, 28673, 11525, 12052, 12369, 12611,
+    32781, 12015, 28684, 11055, 32850, 16883, 9562, 13013, 12742, 11398, 28809, 9320, 28726, 11908, 9926, 11442,
+    16665, 9656, 12981, 12323, 16925, 12323, 28698, 28793, 16677, 28788, 10285, 13104, 4105, 28713, 28679, 28686,
+    9450, 28684, 4578, 32827, 10572, 5915, 9021, 12357, 28708, 28725, 17149, 8936, 13158, 8790, 28737, 12473,
+    13203, 32858, 12580, 13104, 28696, 28712, 16519, 11759, 28682, 28735, 8847, 28767, 8576, 4848, 28736, 16687,
+    28742, 12648, 12294, 32789, 16527, 13032, 9870, 6057, 11283, 5744, 11160, 13192, 11480, 12394, 12970, 11114,
+    16500, 11993, 13062, 28688, 16446, 17015, 12983, 12584, 32805, 8355, 32777, 4326, 13101, 12657, 32922, 12863,
+    8424, 16540, 28704, 28773, 13000, 28776, 11735, 6241, 28677, 12332, 13042, 16465, 13080, 12528, 10815, 12804,
+    13017, 28744, 16765, 11354, 4556, 8490, 16591, 16764, 28723, 6033, 9527, 13187, 12862, 12752, 28792, 32859,
+    13048, 16419, 13172, 12706, 4635, 28800, 6356, 28674, 12911, 12587, 12982, 8372, 11623, 8642, 10020, 28753,
+    13113, 16754, 6230, 16973, 11936, 12836, 12802, 16504, 12473, 13066, 12508, 13188, 28700, 12300, 4828, 11319,
+    28740, 12839, 12647, 12586, 16960, 12899, 9722, 16528, 10569, 17080, 28791, 16802, 28746, 16686, 12499, 16449,
+    28679, 5462, 13164, 6234, 16570, 12744, 16741, 12427, 12356, 9898, 12001, 11609, 5563, 12061, 12443, 10771,
+    5491, 16518, 12811, 11478, 28787, 16683, 12718, 12004, 17329, 28683, 12010, 9608, 13102, 13176, 28693, 13128,
+    6005, 28783, 16914, 28804, 5928, 5977, 4463, 12777, 9609, 10725, 12360, 10507, 11397, 10882, 32845, 32877,
+    28796, 12538, 8444, 9686, 8696, 9562, 12996, 28717, 10550, 12838, 13055, 16619, 16617, 16700, 11997, 13199,
+    5921, 10831, 8306, 13156, 13060, 28750, 10802, 16845, 32894, 17329, 28744, 8713, 12678, 16777, 28795, 13029,
+    13104, 10262, 10570, 8347, 12476, 12879, 12370, 12827, 9255, 12995, 16427, 16686, 28733, 28682, 17051, 28811,
+    12855, 28697, 8613, 28707, 12371, 8667, 9012, 28794, 12957, 9518, 32779, 17177, 13017, 11104, 13162, 28805,
+    8931, 5592, 17016, 28763, 28691, 13207, 28745, 12756, 4970, 28813, 28696, 28755, 28788, 8769, 17141, 12369,
+    16937, 16387, 16747, 10868, 9687, 8490, 17071, 13068, 16594, 13163, 11758, 12384, 16993, 12396, 12552, 11932,
+    6328, 16445, 11657, 12816, 12634, 32872, 13208, 9452, 13103, 9965, 28707, 12621, 32832, 9375, 13152, 10579,
+    9563, 6102, 4984, 13048, 28751, 32857, 32827, 28700, 32819, 12582, 8422, 11713, 32829, 6187, 13007, 13006,
+    8414, 10282, 17058, 10143, 8666, 11130, 13042, 12462, 28716, 12060, 32820, 32794, 8694, 17323, 12777, 28683,
+    12774, 12307, 17238, 32878, 12836, 12417, 9337, 16500, 28702, 12502, 17094, 28805, 12383, 17309, 28739, 20490,
+    12610, 20490, 28684, 28771, 16688, 28806, 12380, 28698, 28687, 13135, 12371, 12936, 12675, 28828, 12971, 12970,
+    6152, 12012, 5599, 32856, 6057, 12840, 12442, 12428, 12456, 12681, 32897, 4572, 16697, 32898, 12821, 28697,
+    28749, 12067, 5122, 9387, 28724, 28686, 13209, 17302, 32858, 17117, 11059, 12864, 28764, 32787, 13078, 4605,
+    12579, 32901, 17060, 10677, 10281, 13032, 20486, 32805, 11023, 13101, 12050, 11978, 32793, 12057, 9487, 32780,
+    5380, 11304, 32909, 5275, 10153, 9974, 32856, 13060, 17051, 10452, 6409, 12883, 12884, 28783, 16530, 28707,
+    12500, 16858, 11012, 28732, 16746, 10866, 11412, 12933, 13213, 12932, 13214, 28797, 5601, 13215, 11769, 12948,
+    16934, 9676, 17409, 12537, 32877, 9772, 13184, 28706, 16937, 10806, 12552, 8405, 13185, 11166, 11048, 12336,
+    17003, 16428, 28729, 9377, 9181, 11618, 10161, 12399, 12732, 13104, 28815, 12861, 8809, 8368, 28773, 13128,
+    16992, 11393, 20484, 16858, 12645, 8310, 32833, 6312, 32842, 28766, 28785, 12922, 28752, 16856, 12540, 32857,
+    6187, 16541, 17248, 10976, 28813, 13123, 28716, 16609, 13187, 28779, 28750, 11161, 17095, 16605, 12840, 16854,
+    9509, 12429, 16621, 32843, 17167, 28778, 17139, 16764, 11399, 32855, 16438, 28704, 12660, 12851, 10481, 28764,
+    28718, 17116, 8691, 12486, 28700, 12597, 10663, 32842, 10789, 10735, 9519, 13127, 32911, 5123, 13200, 28773,
+    28686, 9253, 8919, 9601, 16912, 9580, 12062, 28794, 16667, 28821, 32845, 13198, 17333, 32819, 11104, 28804,
+    28734, 32855, 28815, 16934, 13092, 11409, 32820, 8704, 12821, 5070, 16657, 8277, 16779, 11049, 12876, 10776,
+    6058, 12610, 28805, 8524, 5153, 16698, 28718, 28686, 11180, 12870, 11347, 13173, 12413, 6163, 12536, 28710,
+    32780, 11660, 10569, 12888, 6459, 28742, 13211, 17315, 11873, 28818, 28817, 12731, 11746, 12803, 6457, 12383,
+    11175, 4831, 28803, 16779, 32922, 28706, 13176, 28751, 5900, 28684, 10688, 32857, 8788, 28791, 4182, 28828,
+    32868, 28686, 11524, 10749, 12928, 8489, 12775, 32923, 17058, 12946, 9285, 28716, 28719, 28796, 17131, 28808,
+    28783, 16409, 28689, 12992, 32907, 12765, 10750, 12503, 10866, 8779, 10962, 5472, 28678, 11034, 9580, 28757,
+    32909, 17382, 12335, 17382, 9676, 17240, 17382, 13199, 17380, 10711, 12480, 10573, 28774, 13179, 4953, 8787,
+    20485, 17381, 12071, 12312, 12840, 4931, 12741, 32819, 8827, 28677, 10575, 11742, 11653, 4971, 12756, 4984,
+    12070, 20487, 20490, 11075, 10282, 9386, 17348, 28823, 16536, 12810, 8790, 28697, 28707, 17379, 28710, 32890,
+    6407, 5497, 9673, 12509, 8779, 28757, 9386, 10756, 11171, 11059, 28684, 9367, 17332, 32843, 28683, 10282,
+    10795, 32883, 12623, 32918, 12336, 28735, 16609, 28756, 12958, 9436, 8665, 28821, 6460, 10802, 17106, 10862,
+    12439, 10217, 20485, 12528, 28817, 12033, 10722, 11048, 12940, 12034, 13163, 28815, 9319, 28820, 32781, 16531,
+    12827, 8275, 16541, 13060, 32803, 8267, 16483, 10218, 10812, 9051, 9599, 28815, 28797, 12743, 16693, 12425,
+    12814, 9265, 12684, 12510, 12077, 16440, 5915, 13007, 10533, 20485, 32923, 28818, 13055, 17129, 12996, 17389,
+    28684, 28817, 28792, 8759, 16846, 10748, 8832, 17280, 12542, 12995, 32876, 8490, 5491, 28769, 11459, 28737,
+    16806, 28803, 12636, 17003, 12545, 12379, 12580, 13223, 11699, 9767, 6196, 32856, 28794, 12297, 13140, 16973,
+    28741, 32858, 32819, 12342, 17174, 13114, 32903, 28695, 12943, 13112, 12911, 17146, 32793, 6057, 12999, 28697,
+    16775, 16786, 8768, 28703, 11094, 13056, 32898, 11751, 12537, 12975, 4385, 5976, 9683, 32818, 17094, 12753,
+    17312, 17156, 12588, 28725, 11659, 12452, 32793, 12923, 28701, 28783, 12870, 28774, 9366, 11909, 13219, 28705,
+    17051, 12929, 28718, 9554, 28815, 12429, 32817, 12730, 32855, 6438, 11353, 28758, 11111, 12886, 32883, 12023,
+    16539, 12465, 6328, 9619, 12419, 12598, 28819, 4970, 8195, 9193, 28708, 8987, 8788, 28742, 16983, 28815,
+    12399, 11104, 5106, 12872, 12467, 12317, 13207, 12888, 10827, 32926, 32866, 17004, 17000, 10706, 12820, 28777,
+    32840, 11157, 10169, 12646, 9664, 32807, 11125, 6450, 32901, 4475, 28785, 12419, 12861, 12850, 12444, 17004,
+    17369, 12549, 16937, 12647, 16614, 28682, 28800, 12040, 28715, 12396, 28709, 8423, 12322, 6187, 5651, 32920,
+    17320, 12756, 28812, 16519, 17227, 12523, 12714, 16801, 13137, 16695, 17077, 12045, 10806, 11365, 28817, 12485,
+    32842, 12728, 28761, 17045, 8769, 12372, 12312, 17060, 12597, 9467, 28782, 5088, 10407, 12544, 28683, 20488,
+    17062, 32869, 12606, 12426, 12660, 12633, 32844, 12298, 28771, 12324, 32872, 32828, 12824, 28800, 12056, 16815,
+    17174, 32911, 28820, 8343, 17253, 12344, 17214, 8457, 13179, 4457, 13070, 13080, 8414, 11910, 13174, 17012,
+    6392, 32877, 11474, 12719, 28675, 12300, 32855, 8646, 8405, 28793, 12332, 12717, 28793, 28822, 12655, 28755,
+    12933, 6231, 32889, 9316, 16611, 13139, 10795, 12742, 12780, 28825, 10752, 16450, 32895, 10005, 10881, 4547,
+    28702, 12475, 9515, 8413, 17072, 28743, 12911, 9661, 5592, 4523, 12453, 5752, 16463, 16447, 12940, 16775,
+    11951, 6410, 16619, 8478, 12468, 8613, 28772, 12551, 12929, 6461, 12732, 5673, 12872, 6195, 5673, 16742,
+    9784, 12718, 28797, 17185, 12981, 16728, 9022, 11005, 12289, 28736, 28805, 17139, 32854, 12744, 28803, 32816,
+    13137, 11955, 12461, 17069, 28796, 28804, 11011, 32774, 16782, 17124, 6299, 5592, 12719, 28673, 12912, 8760,
+    32927, 9468, 13125, 17000, 28794, 28783, 12330, 28683, 8966, 12911, 10802, 12824, 13191, 10810, 11395, 12658,
+    28787, 28805, 28794, 13210, 28733, 12477, 28805, 12743, 32851, 9620, 8540, 11309, 17240, 11778, 12876, 12540,
+    28696, 12924, 12751, 28782, 12945, 10789, 32911, 32892, 32805, 4863, 11094, 9321, 17373, 28826, 9782, 16695,
+    12959, 13115, 12417, 28794, 28781, 12535, 12526, 28705, 12587, 12347, 12468, 28736, 12334, 13030, 9552, 16751,
+    13171, 32870, 12839, 9669, 32898, 32870, 16693, 12996, 11040, 16530, 28784, 9617, 32859, 32933, 9071, 28697,
+    32871, 28742, 12990, 6032, 16754, 11473, 9534, 12850, 28758, 11415, 9021, 17161, 13008, 12708, 9033, 13223,
+    13008, 8935, 11378, 17395, 12993, 16993, 8657, 11769, 28818, 13176, 12497, 28701, 28694, 12596, 12588, 28755,
+    11274, 13182, 10797, 12840, 17089, 9850, 16615, 28823, 28713, 13135, 10645, 8722, 28807, 28759, 17156, 32893,
+    13029, 4275, 12636, 12509, 11286, 32781, 17335, 10759, 11672, 28710, 16981, 13124, 13016, 8413, 12455, 13092,
+    5929, 16799, 12659, 32859, 12755, 9386, 28768, 32908, 13039, 17170, 9385, 11105, 28695, 11480, 5031, 11055,
+    9745, 10245, 6007, 20488, 16639, 16405, 12852, 28768, 12887, 28696, 8470, 32885, 28741, 28795, 10664, 12459,
+    12077, 28689, 5183, 9022, 9375, 28688, 11347, 13181, 28780, 32937, 16745, 11387, 28767, 13111, 12612, 28702,
+    12850, 4716, 11647, 13080, 11339, 32900, 12348, 28793, 28750, 12011, 28772, 12754, 11754, 32858, 28749, 12511,
+    6333, 28695, 11354, 13091, 12390, 28752, 32793, 11945, 12851, 12981, 28760, 4698, 28704, 13170, 9284, 12885,
+    28684, 12441, 9022, 28795, 16825, 11900, 12355, 5368, 11312, 16688, 8621, 16722, 12606, 12707, 10944, 17243,
+    9953, 12595, 16924, 32872, 12453, 17015, 11124, 12968, 32882, 32831, 32828, 12659, 12839, 8285, 12488, 32920,
+    32777, 4322, 32920, 28760, 32790, 16846, 12935, 9608, 28695, 5576, 28740, 4106, 8789, 28707, 28686, 12927,
+    11408, 28735, 12851, 13180, 17290, 12970, 16421, 28693, 12825, 28709, 13175, 8571, 28767, 12678, 12993, 13138,
+    13126, 32790, 12586, 13208, 16609, 12667, 11707, 10852, 28768, 16874, 12827, 13193, 13224, 9012, 28706, 13076,
+    32926, 8275, 11603, 28757, 10263, 11697, 10099, 8713, 12923, 9077, 28677, 5489, 12839, 10035, 12765, 6446,
+    28825, 17015, 32849, 10751, 16846, 4630, 9751, 11353, 12732, 12598, 28783, 16745, 4102, 5462, 28724, 13102,
+    28721, 12623, 17067, 6234, 12995, 16621, 16439, 32791, 8745, 13003, 28744, 12371, 13091, 9824, 9564, 28806,
+    13210, 9078, 28811, 8480, 8491, 9663, 6452, 5110, 13163, 28714, 28812, 6418, 28789, 28685, 13115, 12360,
+    9996, 9280, 28777, 12958, 12453, 16541, 16606, 12743, 12684, 12336, 13003, 28713, 12941, 9972, 28804, 9355,
+    5592, 13224, 28678, 12939, 28823, 11421, 12455, 12982, 28723, 12969, 11646, 10624, 12992, 9731, 12646, 13219,
+    17332, 28792, 17388, 13100, 9059, 12994, 8422, 6015, 12778, 12763, 12443, 11151, 13127, 12933, 32897, 32850,
+    10131, 28683, 8790, 12802, 17209, 13114, 11653, 9373, 28795, 10862, 32793, 10452, 32898, 16695, 4183, 11714,
+    28717, 13139, 16619, 12946, 17399, 17326, 20483, 12310, 28827, 28713, 11400, 12348, 12058, 17156, 12659, 5774,
+    12790, 32776, 4220, 13060, 28799, 10811, 28805, 28824, 9885, 32859, 12779, 17025, 16450, 8948, 16936, 12475,
+    12358, 10851, 11956, 10115, 12550, 32794, 32840, 9592, 32830, 12418, 12707, 12419, 12851, 16858, 9974, 12371,
+    16737, 32907, 12394, 11307, 10852, 9852, 32807, 11920, 28727, 32896, 13080, 4714, 28781, 12837, 12294, 11696,
+    16825, 12934, 12584, 11261, 12827, 8876, 16922, 9367, 17225, 13174, 12743, 28805, 9087, 11639, 28681, 12756,
+    17400, 10282, 16488, 5875, 10513, 8493, 28704, 11404, 12342, 13053, 28821, 5916, 12815, 12635, 6230, 12837,
+    28692, 16846, 12852, 12888, 32788, 10490, 16786, 12396, 12019, 12430, 32855, 5627, 16489, 12678, 12382, 4635,
+    13135, 16904, 11950, 13003, 16408, 12876, 28704, 13060, 17027, 12408, 28816, 9308, 10881, 5664, 12515, 32885,
+    10218, 13049, 12838, 17275, 9517, 17238, 28717, 12536, 5990, 12801, 12059, 13007, 5369, 8949, 28789, 10984,
+    9254, 28725, 4599, 28694, 10789, 11150, 10788, 12660, 28767, 17385, 9385, 16843, 10431, 32902, 12908, 32849,
+    13101, 11646, 13104, 12981, 12587, 16989, 10878, 9911, 9216, 11779, 10793, 32858, 4101, 12959, 10333, 17253,
+    28705, 28752, 28811, 12756, 12645, 13008, 9609, 17290, 17082, 13200, 9003, 12971, 12533, 12863, 8286, 5671,
+    11323, 8470, 32775, 8522, 9675, 17319, 10505, 16778, 12587, 28749, 13044, 28701, 12346, 13065, 28763, 13128,
+    12395, 11110, 28796, 11990, 12801, 32780, 9866, 28727, 11915, 32841, 11454, 12511, 12959, 12720, 13116, 28798,
+    16983, 12774, 28822, 4473, 8278, 12972, 16529, 28725, 28818, 11168, 28695, 28805, 12931, 12443, 12946, 12312,
+    9264, 12789, 20487, 11707, 12648, 13061, 11769, 8778, 12605, 28690, 28713, 12743, 8453, 8643, 17322, 12703,
+    11645, 20489, 28775, 5105, 16542, 16778, 32866, 28800, 12010, 12511, 11087, 12632, 6328, 5429, 32801, 4185,
+    32802, 10038, 13029, 8359, 12863, 12968, 28795, 12039, 6230, 11573, 11177, 16608, 17411, 13039, 12912, 12491,
+    11992, 28742, 32776, 8536, 9253, 5915, 12605, 17252, 11094, 12666, 32850, 32801, 9119, 17332, 12603, 13041,
+    28811, 9375, 12810, 28750, 17395, 12840, 16522, 12714, 4166, 16857, 9802, 28686, 17184, 17308, 28804, 12729,
+    32807, 10826, 13065, 9480, 12425, 12754, 28793, 12333, 28795, 9509, 11070, 6231, 16527, 5163, 13050, 12960,
+    28699, 10876, 32773, 16471, 12744, 17388, 12559, 12666, 12660, 12883, 9032, 11908, 6387, 9686, 28704, 16686,
+    12588, 8768, 12669, 16447, 20487, 8229, 28774, 28710, 32806, 11621, 17230, 6417, 32924, 10127, 13224, 9387,
+    11609, 13139, 8721, 32908, 28750, 5629, 12516, 13181, 12911, 4221, 4264, 12958, 13038, 12584, 16405, 10962,
+    11895, 28805, 13180, 28744, 32807, 8444, 8480, 13113, 12457, 12849, 9843, 10284, 28816, 16542, 13138, 28804,
+    9903, 8445, 9010, 16854, 11452, 32803, 4354, 13102, 13212, 8424, 28702, 12729, 5929, 12762, 4165, 9553,
+    12072, 10879, 28705, 13089, 5664, 5780, 17171, 12413, 10184, 12448, 4635, 11972, 12478, 16973, 10871, 28812,
+    28776, 10191, 9059, 5603, 12752, 11125, 12883, 28701, 13047, 13219, 32806, 17263, 32814, 8491, 13102, 16609,
+    32920, 11318, 17093, 28696, 11653, 16843, 5639, 12765, 12526, 8966, 28721, 32907, 12756, 28816, 28783, 17045,
+    12426, 28698, 8322, 13124, 28758, 10579, 10867, 12062, 11759, 32897, 12502, 12382, 6409, 32869, 10271, 10207,
+    12888, 10816, 9676, 12840, 28738, 32843, 12849, 13043, 9580, 17091, 20487, 13193, 12971, 12779, 28711, 16530,
+    28697, 28795, 6021, 28769, 28722, 28724, 10788, 9168, 8658, 6328, 12437, 5060, 28744, 16386, 8962, 16698,
+    8834, 12564, 11418, 32881, 32789, 9386, 20490, 10285, 28798, 12804, 12502, 10876, 6448, 12887, 5552, 28699,
+    12852, 10459, 8779, 4715, 16676, 11178, 16598, 9686, 12911, 16845, 11480, 10563, 11275, 12743, 12862, 13175,
+    32863, 28812, 11170, 10871, 28769, 12995, 9564, 5807, 10503, 17088, 16973, 12547, 13059, 10804, 12960, 17062,
+    5074, 11446, 12983, 12345, 28796, 9592, 12371, 9383, 9012, 10262, 12336, 10349, 12672, 17175, 28690, 28740,
+    8491, 13129, 20481, 28818, 12336, 32882, 13053, 8789, 12406, 6057, 16834, 32912, 13105, 11692, 4968, 13104,
+    32794, 11459, 12754, 12069, 13222, 6223, 16856, 9685, 10736, 17146, 28712, 28761, 32856, 32910, 12947, 9037,
+    10882, 12929, 28781, 17014, 5882, 16428, 12883, 10987, 10677, 28704, 8777, 28796, 17247, 10094, 6151, 17399,
+    16894, 12840, 28797, 9952, 12743, 28814, 10506, 12825, 12872, 6335, 5445, 8883, 6187, 17245, 8920, 32872,
+    10662, 13043, 28799, 12370, 12920, 17260, 11728, 12648, 10407, 16620, 12996, 16563, 11605, 16816, 6188, 4969,
+    32831, 13056, 12492, 28716, 20481, 16608, 32792, 10637, 11053, 32898, 12972, 28771, 28690, 11157, 13041, 28798,
+    16487, 10862, 28794, 28782, 11963, 28789, 12417, 8194, 6361, 28732, 28704, 9320, 16430, 32877, 17408, 12432,
+    9838, 12732, 13124, 12384, 5597, 16542, 10376, 8613, 28683, 28689, 13065, 17324, 13008, 16981, 6199, 9247,
+    6328, 13224, 4719, 12924, 28719, 28811, 28750, 32859, 8478, 12912, 13222, 11648, 11035, 10444, 12828, 13215,
+    6231, 12755, 12597, 12575, 10685, 32830, 6451, 12079, 17077, 28782, 13104, 12491, 10976, 28705, 28763, 10706,
+    16595, 12621, 17016, 5085, 4167, 12383, 10151, 28686, 32934, 10128, 12821, 28818, 12972, 32857, 20482, 28713,
+    8723, 12883, 28793, 28681, 28798, 16700, 13072, 9319, 10114, 10217, 28714, 32868, 28735, 17361, 12682, 17173,
+    32855, 16484, 12319, 9854, 10497, 17166, 13079, 13114, 16776, 12491, 12908, 10936, 12898, 10865, 8650, 13173,
+    6421, 16410, 9885, 16677, 12786, 32793, 9918, 12454, 28824, 12958, 28807, 32911, 16415, 28828, 28754, 32872,
+    13072, 12849, 6226, 10436, 11763, 8824, 6224, 28754, 12575, 32788, 9656, 11742, 28725, 13163, 28770, 11685,
+    12586, 12693, 10882, 11752, 12798, 9256, 32923, 13113, 12648, 12491, 9051, 28730, 16697, 12356, 12803, 13140,
+    10274, 10853, 28727, 12999, 12872, 12789, 5462, 6022, 17399, 28793, 12900, 10760, 28740, 12528, 28810, 6051,
+    13175, 11955, 32820, 17124, 12670, 10107, 10883, 16765, 13184, 11013, 28692, 9924, 17146, 32792, 9088, 13114,
+    28820, 28765, 9145, 8964, 12929, 6055, 28823, 28807, 12395, 12018, 28744, 16835, 28819, 28807, 28737, 12983,
+    13175, 12346, 12609, 13102, 10058, 17208, 8491, 12369, 12502, 9074, 17319, 13147, 5410, 8769, 32885, 12800,
+    17287, 11164, 16766, 11962, 11347, 17067, 16440, 12647, 16405, 13180, 12310, 10800, 10858, 28811, 28683, 12464,
+    11222, 9774, 12461, 17171, 32890, 11666, 9907, 20487, 12659, 12862, 17399, 10871, 12307, 16698, 32801, 8523,
+    12061, 12744, 11449, 12681, 32922, 28786, 20484, 28701, 28818, 10712, 12803, 32935, 28694, 12719, 17366, 28821,
+    16463, 13200, 12383, 9853, 32837, 12312, 16721, 8299, 12441, 28787, 12450, 12359, 11182, 28706, 28803, 12689,
+    8423, 12944, 5541, 10877, 28771, 28796, 17069, 8424, 12839, 16990, 9437, 9050, 12800, 12823, 12360, 12864,
+    28752, 28755, 12552, 28696, 8269, 28723, 28786, 12420, 12941, 28750, 6418, 17077, 17252, 17394, 4257, 11231,
+    12835, 6182, 28683, 28783, 12550, 32803, 8566, 28761, 12894, 12811, 28716, 10743, 5626, 32911, 28684, 8533,
+    12658, 13198, 12828, 16621, 4984, 8413, 32935, 12526, 5539, 8197, 10749, 5497, 28686, 13192, 28781, 28826,
+    13135, 11347, 28793, 28826, 28766, 12905, 11281, 5317, 9078, 32817, 10450, 12524, 11951, 8479, 28744, 12323,
+    12072, 13139, 13124, 32871, 10368, 17180, 9161, 9939, 9878, 6363, 6138, 12762, 9661, 16658, 4502, 9962,
+    32846, 9680, 12896, 28775, 32833, 28806, 8751, 8667, 12464, 12680, 12502, 6400, 4466, 12394, 28676, 12539,
+    28696, 28783, 9319, 4763, 12572, 10877, 12920, 5077, 32923, 17066, 28778, 28692, 28683, 12812, 32870, 12957,
+    28774, 13103, 12850, 12426, 28771, 9564, 32890, 8226, 13191, 12342, 10533, 17245, 32845, 12537, 12670, 11101,
+    17407, 16517, 12449, 11353, 12384, 8789, 9002, 9265, 16615, 32859, 32896, 12960, 13090, 11873, 16844, 9898,
+    5459, 17151, 17369, 8823, 28818, 17032, 9358, 9089, 10273, 11753, 16656, 28804, 12413, 16846, 6200, 12552,
+    12561, 16746, 10516, 16463, 12838, 28692, 32922, 12571, 5497, 8404, 9364, 28764, 9815, 12659, 12863, 13171,
+    4687, 17366, 16643, 32853, 32794, 9974, 12382, 8424, 11994, 9608, 12960, 28782, 9021, 28737, 13179, 28694,
+    32882, 8477, 16529, 12067, 8246, 13163, 28716, 28676, 28795, 16594, 12766, 16671, 28819, 13030, 28806, 13200,
+    12504, 12645, 13180, 32775, 4164, 11908, 12619, 32865, 12599, 11176, 16935, 5770, 28710, 9704, 13138, 11769,
+    12763, 6050, 13104, 28732, 5674, 5674, 17386, 4891, 32858, 8713, 13049, 28705, 10188, 12552, 11455, 13003,
+    13126, 9388, 9089, 9358, 12864, 17332, 28816, 28823, 8723, 12538, 12659, 8912, 12310, 12584, 28793, 12526,
+    17303, 12992, 12922, 11507, 28794, 12539, 12960, 16656, 17173, 17082, 11646, 11410, 5586, 12712, 28696, 13124,
+    32884, 9248, 12041, 13091, 32908, 32907, 32801, 16404, 11159, 12597, 11422, 28724, 12704, 12479, 8358, 28695,
+    28745, 12755, 28678, 12527, 5627, 32927, 10115, 12927, 10861, 11952, 28716, 17319, 32893, 28719, 8790, 16518,
+    12370, 5592, 13191, 11362, 9909, 9617, 28733, 32915, 17156, 13092, 10782, 5047, 16489, 32849, 13169, 28704,
+    10513, 32846, 16799, 12563, 16964, 28743, 10198, 28735, 16492, 12561, 9264, 10229, 32832, 32819, 16982, 28821,
+    6313, 32850, 8322, 8704, 12990, 28729, 12576, 11618, 12838, 12892, 12816, 28795, 28766, 28765, 13061, 28740,
+    9019, 12852, 28765, 16844, 13090, 8722, 16735, 8479, 9945, 9915, 32879, 16621, 28732, 28778, 17229, 28727,
+    9860, 32883, 11951, 16891, 12851, 13128, 28827, 17388, 28796, 16542, 12671, 28805, 12536, 10349, 28771, 12450,
+    28711, 4473, 11654, 17318, 12827, 32820, 10107, 17095, 12396, 12491, 13127, 12460, 12383, 17252, 16422, 17156,
+    28688, 6339, 16737, 13090, 9321, 13018, 28685, 10811, 10178, 13040, 8302, 12939, 13101, 16855, 28717, 12560,
+    12802, 12633, 10113, 32849, 6373, 12453, 12804, 28755, 4368, 32915, 11581, 16448, 12801, 16484, 11081, 28746,
+    17216, 12863, 28789, 32937, 12947, 9891, 28767, 5664, 13198, 9663, 32883, 13003, 12660, 32776, 4216, 9817,
+    28810, 13091, 12644, 10858, 6159, 28769, 28695, 32802, 8249, 12789, 11739, 9940, 10741, 8789, 4979, 12635,
+    28701, 4635, 28683, 13020, 12681, 12859, 5925, 13092, 13052, 12756, 28761, 12551, 9064, 9461, 12894, 13170,
+    11958, 12946, 12835, 11150, 8600, 8322, 28695, 4473, 12899, 12731, 32877, 12969, 28799, 9687, 11996, 10561,
+    11952, 10145, 12753, 4721, 16483, 11450, 32826, 16603, 12323, 12910, 28710, 11181, 17253, 28824, 11691, 9388,
+    16541, 32936, 28769, 28827, 32776, 4281, 12526, 6454, 12395, 8338, 10712, 11110, 4392, 11646, 13031, 11987,
+    12984, 13019, 11100, 17001, 28758, 17132, 10687, 28817, 28700, 12954, 16697, 11326, 28817, 16542, 4135, 32777,
+    4417, 10216, 32877, 12452, 17326, 12597, 12408, 32793, 28756, 12440, 28674, 20482, 17026, 17234, 28782, 9986,
+    12756, 5268, 10706, 11944, 12828, 28806, 12646, 17167, 12058, 12729, 16842, 12862, 28674, 11956, 11113, 10867,
+    12347, 10444, 10712, 17155, 9673, 32818, 12460, 16586, 11858, 12790, 5929, 10808, 16607, 17092, 12995, 10815,
+    17003, 28805, 12780, 4213, 8303, 10207, 9375, 28786, 12827, 12311, 11908, 13204, 16508, 16834, 12821, 13017,
+    32905, 17331, 10281, 28708, 16856, 11406, 16412, 10161, 11529, 13224, 28785, 12010, 11909, 5912, 12720, 10813,
+    9018, 12906, 6044, 16726, 16541, 32836, 11154, 9256, 28723, 10270, 32854, 12368, 12658, 32780, 5162, 32864,
+    11480, 32828, 17338, 9068, 12610, 5419, 12046, 28712, 28704, 28781, 20484, 12392, 16990, 13103, 5669, 12368,
+    32777, 4439, 5477, 28787, 12396, 12821, 12821, 9609, 13014, 32788, 28782, 12755, 11918, 9349, 12825, 28681,
+    17045, 10675, 8870, 13114, 12983, 8397, 17124, 16833, 12708, 20490, 12897, 16462, 13172, 9446, 10743, 12887,
+    28786, 10861, 16608, 28744, 12051, 17130, 17130, 12381, 8905, 13028, 28761, 12838, 17396, 9273, 8899, 11106,
+    12909, 10406, 11655, 9683, 12324, 9387, 13152, 5929, 12703, 9169, 12668, 12958, 12466, 32781, 6368, 28814,
+    12840, 4188, 13116, 28767, 28827, 9385, 4100, 6223, 10240, 28771, 12461, 28726, 11652, 16686, 16506, 12851,
+    12971, 12430, 4718, 11112, 28674, 28678, 11150, 20482, 12503, 28708, 9975, 13178, 5834, 16677, 12020, 11392,
+    12754, 16552, 8467, 16542, 28756, 16854, 12920, 13056, 28770, 12730, 20485, 12564, 16936, 13139, 11773, 6159,
+    11947, 10538, 28677, 28772, 12883, 5562, 32885, 28807, 17408, 32890, 32890, 8759, 17088, 12431, 5606, 12549,
+    16459, 8720, 28775, 10284, 12828, 10974, 12872, 32868, 13059, 28676, 13077, 12761, 12804, 28741, 12574, 32877,
+    13090, 32856, 13204, 17004, 9518, 11266, 12068, 12840, 13151, 13116, 16463, 13175, 9143, 13103, 28824, 28774,
+    9985, 11656, 12672, 11610, 28694, 12444, 13015, 12707, 8683, 16436, 12885, 16541, 11574, 28737, 28757, 12815,
+    12779, 9066, 17170, 10436, 10151, 28789, 12394, 12960, 11282, 28673, 32883, 17161, 12848, 12984, 12366, 9366,
+    13028, 8489, 12840, 11448, 13092, 16916, 12754, 28699, 11695, 28746, 28799, 13186, 10116, 11707, 32837, 13189,
+    13018, 9854, 6224, 17088, 17305, 11161, 13209, 16993, 16688, 10506, 12883, 28682, 16728, 13078, 6098, 9666,
+    16983, 28742, 28718, 12873, 12670, 17062, 12886, 32816, 16756, 16990, 16767, 9600, 12872, 16620, 12296, 10584,
+    28683, 8299, 12598, 17313, 28694, 5048, 8485, 12477, 32819, 28757, 13104, 17072, 28805, 9302, 12598, 8368,
+    12862, 17299, 10263, 17124, 9563, 12791, 28741, 12982, 12800, 12935, 28694, 10743, 8414, 10370, 8489, 12648,
+    16844, 6357, 13171, 12876, 12732, 10000, 8491, 17011, 13032, 28698, 17060, 28692, 28759, 28794, 5619, 13066,
+    10883, 12683, 28812, 28783, 12983, 12756, 4510, 12507, 12017, 16385, 28805, 12658, 12995, 6106, 32789, 12659,
+    11013, 16682, 9735, 12875, 12828, 12504, 10114, 16756, 12838, 9675, 6362, 13125, 28817, 17257, 12394, 28751,
+    32868, 10217, 11319, 13182, 12427, 32934, 6273, 13115, 10851, 13071, 12300, 28814, 13116, 12404, 28799, 4700,
+    10860, 10552, 12444, 9817, 12791, 12839, 12960, 28793, 12766, 9468, 12671, 8193, 5497, 12504, 17403, 13206,
+    16684, 12790, 12684, 11469, 13058, 8470, 32890, 8667, 11859, 12648, 16745, 13183, 28766, 4761, 8479, 17151,
+    16858, 13030, 5214, 17323, 12672, 6051, 8789, 11993, 16762, 32935, 11160, 12629, 17215, 12664, 6022, 11042,
+    9385, 5706, 32895, 9495, 13089, 6022, 28792, 17087, 28743, 12861, 9386, 4669, 17409, 28766, 13018, 17372,
+    6193, 32814, 28770, 9666, 10560, 10055, 28708, 16822, 11413, 10007, 16921, 8853, 28801, 12622, 12979, 8752,
+    13072, 6230, 4760, 12755, 12967, 28750, 12319, 13164, 32898, 10190, 12993, 17090, 20488, 11177, 13128, 28703,
+    20485, 28810, 13186, 17216, 17213, 13116, 4384, 9617, 28794, 9012, 32935, 12392, 16936, 28793, 17398, 12539,
+    17294, 28696, 12548, 12648, 16530, 8359, 12611, 28693, 28814, 9319, 13176, 28719, 9089, 32927, 8423, 20482,
+    17000, 12489, 12416, 32807, 9630, 8490, 12354, 13134, 12299, 10273, 13127, 28678, 32845, 12744, 12899, 13087,
+    13176, 11310, 12563, 28786, 12958, 12599, 17269, 16530, 12768, 16692, 28710, 28783, 17240, 17410, 32884, 10900,
+    12816, 12621, 10789, 12659, 5165, 28693, 16973, 28688, 13186, 12335, 16693, 13032, 28806, 12515, 12561, 9620,
+    28776, 12394, 12864, 12571, 8259, 5836, 32779, 4920, 12513, 8344, 12299, 28716, 11997, 12920, 16673, 13222,
+    28788, 11460, 13115, 16677, 12600, 5276, 6372, 28807, 17045, 12941, 9908, 32850, 13013, 12528, 16451, 28823,
+    28793, 5899, 11464, 28783, 12525, 16824, 28792, 17051, 12911, 6463, 10811, 10810, 20490, 12390, 9011, 8723,
+    28707, 12441, 17251, 28751, 16451, 11354, 28725, 9620, 12924, 28679, 12716, 13115, 12750, 28781, 28774, 12355,
+    12297, 9058, 32852, 12933, 8920, 12636, 32896, 10349, 13103, 17330, 5664, 16565, 12062, 8759, 32859, 32789,
+    16753, 6413, 13028, 28806, 12645, 12716, 9954, 13123, 28716, 32924, 4320, 16463, 13199, 28686, 10579, 12701,
+    28714, 16880, 32820, 17387, 32923, 8949, 11088, 8723, 9366, 5432, 32820, 16683, 12334, 28764, 16800, 13039,
+    28699, 12941, 4287, 13017, 13168, 16981, 32814, 16619, 9310, 12864, 17004, 28772, 12692, 12451, 9085, 12071,
+    8656, 12462, 32781, 6331, 12559, 13089, 5077, 28807, 12898, 32794, 9985, 12318, 17288, 16578, 32864, 32885,
+    12884, 32781, 6414, 28713, 28697, 12596, 9575, 8351, 13198, 9088, 12839, 4635, 4218, 28793, 11110, 11109,
+    28793, 17329, 12667, 9152, 16698, 28757, 10712, 13015, 17295, 10883, 5589, 13211, 12659, 10207, 12812, 16614,
+    9017, 28689, 12827, 12537, 28811, 12800, 28679, 12945, 17287, 11163, 16406, 12921, 28801, 12732, 28699, 9088,
+    4970, 28751, 20485, 32889, 12527, 17082, 12810, 28684, 17009, 12321, 12611, 10755, 28717, 13003, 8248, 28716,
+    11312, 28713, 12811, 11005, 17106, 6400, 32883, 12778, 4624, 32845, 28714, 32805, 10724, 11574, 12384, 28680,
+    28819, 13222, 11879, 9458, 11328, 28755, 17408, 28706, 12636, 12766, 10843, 13216, 4727, 11178, 12956, 16656,
+    16621, 16990, 12587, 9075, 8704, 12444, 12528, 12456, 8306, 28709, 12905, 8527, 8666, 12969, 13032, 12728,
+    13092, 32858, 11275, 12477, 12459, 13055, 9986, 28693, 17174, 13212, 11465, 13140, 17370, 9610, 10441, 10247,
+    12310, 12957, 16956, 12468, 32910, 11574, 12763, 12896, 16628, 16925, 17130, 28820, 17250, 28752, 13102, 12381,
+    12923, 6167, 12068, 13031, 32833, 32914, 8769, 12596, 12393, 13005, 13005, 16858, 5459, 16676, 11105, 12471,
+    28802, 12624, 28758, 13003, 10644, 11616, 16846, 12547, 16526, 6202, 11182, 13104, 12551, 28771, 16934, 13006,
+    12994, 28776, 28704, 5238, 12550, 8640, 28682, 28824, 11105, 5643, 10006, 32872, 13056, 12970, 9831, 12812,
+    11023, 12550, 9685, 28781, 10841, 32924, 32935, 32902, 17316, 13049, 13047, 5478, 11179, 12804, 32806, 9297,
+    12947, 12564, 13135, 12969, 12418, 9088, 9555, 32902, 28745, 28679, 10218, 28775, 28765, 8411, 8752, 28820,
+    32923, 12503, 12588, 32924, 4802, 10663, 12960, 16835, 9851, 5369, 12067, 16855, 10652, 11374, 16988, 12454,
+    9963, 16745, 12455, 9755, 28752, 8478, 12899, 12839, 10496, 17386, 9919, 11110, 28725, 28732, 12443, 32897,
+    28764, 28769, 13101, 13086, 8696, 9358, 8966, 13158, 17122, 28675, 12660, 11617, 28765, 9570, 12078, 13068,
+    10741, 13170, 32913, 28716, 9533, 28737, 9664, 11115, 10942, 28726, 17011, 28817, 6403, 12929, 28805, 12893,
+    11275, 8621, 32832, 11393, 12430, 8712, 32794, 12408, 13218, 32905, 12938, 11096, 17360, 13182, 32897, 13054,
+    5076, 11822, 28754, 11393, 12676, 16780, 28725, 28681, 9974, 32802, 16410, 16856, 11939, 11347, 28787, 12580,
+    13149, 12348, 12753, 12713, 16762, 32926, 8769, 5608, 17000, 8576, 17405, 28703, 9311, 32844, 28798, 28787,
+    17059, 16855, 28769, 12768, 28798, 32794, 9554, 12348, 5422, 10962, 12312, 32933, 32882, 32923, 28775, 32778,
+    10950, 9906, 12480, 16980, 12981, 28705, 28771, 28771, 16676, 16983, 13127, 28765, 10274, 6453, 11763, 9929,
+    12660, 16448, 4714, 9666, 32804, 10986, 6445, 11409, 9919, 28730, 12800, 13044, 28816, 6445, 12756, 28786,
+    28759, 11706, 11282, 32831, 11040, 10705, 28692, 11658, 12394, 4098, 16921, 17061, 13216, 11878, 10271, 4948,
+    16779, 12941, 9673, 12840, 28697, 12923, 12443, 12801, 12466, 12656, 11609, 9981, 6340, 6411, 28807, 6281,
+    32885, 12731, 9385, 12648, 28751, 12382, 32879, 10498, 12772, 12849, 11609, 16857, 11588, 28691, 28795, 8671,
+    17392, 10749, 16450, 6143, 8995, 11460, 28764, 12809, 12658, 13163, 12823, 17373, 32831, 28787, 28694, 9985,
+    16542, 28767, 8778, 32897, 8949, 28721, 10985, 12824, 12823, 13102, 28711, 16519, 28698, 28684, 28727, 10756,
+    12897, 16609, 32882, 16451, 12396, 10507, 6158, 16517, 9139, 6152, 6152, 5900, 10208, 28811, 5106, 10162,
+    12828, 28799, 13061, 32920, 12756, 4473, 4983, 16457, 12912, 28683, 10489, 11763, 12382, 13017, 11653, 11048,
+    13210, 8995, 32924, 28699, 32895, 28673, 10161, 28818, 9673, 12659, 28810, 12572, 4695, 17397, 28798, 13199,
+    16688, 28783, 28701, 28817, 9676, 9608, 28794, 17011, 12755, 12658, 11692, 12696, 12946, 28771, 10261, 9429,
+    8944, 17220, 8779, 10160, 17093, 9562, 17366, 9310, 17402, 28751, 12823, 12802, 9619, 5668, 16727, 13160,
+    11750, 16728, 9665, 13020, 13224, 10452, 12657, 9264, 8778, 10997, 13061, 9964, 28772, 8295, 32892, 12357,
+    28735, 12480, 13029, 13072, 8244, 16529, 12355, 9276, 32882, 12837, 13061, 13203, 32892, 32859, 5460, 8569,
+    16412, 12766, 13088, 17146, 12871, 16519, 28811, 13192, 16667, 12801, 10216, 12929, 12647, 32870, 13123, 32803,
+    16417, 13018, 12872, 28795, 13212, 28721, 28744, 28808, 32897, 13004, 11165, 13139, 28799, 4890, 11708, 10283,
+    6194, 12995, 10584, 32857, 12295, 28819, 13163, 11770, 17240, 9022, 28822, 12504, 12586, 13127, 28759, 32858,
+    28772, 13087, 12405, 8491, 17293, 9497, 12766, 16621, 10554, 28720, 12909, 32791, 13222, 28821, 11392, 12792,
+    12538, 12752, 13001, 28757, 13080, 6037, 10116, 13179, 12444, 5484, 12576, 28696, 12539, 12811, 32892, 17288,
+    12538, 12492, 12732, 9319, 16427, 16754, 32898, 12897, 12683, 12957, 12789, 12492, 12623, 8478, 28742, 17051,
+    9294, 12869, 32820, 12872, 28824, 11311, 28743, 12838, 28752, 4746, 28807, 5562, 32928, 32844, 11912, 5664,
+    12635, 32820, 12053, 28754, 10274, 5170, 32931, 32804, 8305, 28762, 9319, 28801, 11768, 20487, 12384, 12812,
+    16677, 28693, 17077, 10867, 13192, 8658, 9965, 12756, 12711, 9302, 28750, 5671, 10706, 12396, 9610, 13080,
+    5448, 12612, 12898, 12960, 17060, 9683, 11463, 16620, 13139, 28729, 28740, 9675, 28815, 12600, 12438, 28818,
+    17239, 12996, 8787, 6224, 12623, 11365, 32857, 32839, 8424, 32898, 9357, 10357, 20487, 20483, 5212, 9310,
+    28795, 28738, 8229, 8696, 11873, 8412, 13188, 11311, 12838, 32870, 17332, 13191, 32856, 5063, 12647, 6187,
+    16462, 16448, 10153, 12538, 12512, 8788, 8836, 12322, 13103, 32828, 9050, 12648, 28706, 28734, 16688, 16844,
+    13045, 28725, 8912, 32789, 12546, 12730, 12524, 28712, 32805, 5087, 9302, 10867, 9256, 12588, 9337, 8469,
+    13072, 9778, 9131, 17178, 11070, 5863, 12920, 8446, 8490, 12768, 32806, 5195, 28818, 9022, 11972, 12821,
+    32837, 13006, 10815, 16595, 28818, 10273, 8451, 11166, 16621, 12596, 12360, 8779, 12807, 11260, 13202, 8692,
+    12006, 9197, 11907, 28766, 28731, 28803, 12643, 28716, 17139, 28786, 12368, 17003, 5577, 6406, 17004, 28810,
+    16845, 12887, 12371, 13067, 12453, 12898, 12347, 28720, 28803, 28819, 28754, 9662, 12981, 8423, 13028, 11997,
+    12575, 16822, 10407, 32871, 11360, 8287, 17381, 16609, 6400, 10712, 32936, 4983, 17411, 28772, 10796, 12311,
+    28709, 5554, 12318, 32881, 17176, 28731, 12779, 12896, 6433, 11574, 16990, 12460, 17288, 13138, 4698, 28744,
+    8917, 12684, 13075, 28690, 6407, 6405, 32845, 32877, 32937, 28693, 12336, 11372, 16616, 4716, 16463, 11166,
+    28676, 11321, 28801, 12681, 32850, 11115, 11646, 12635, 28695, 13143, 5599, 28713, 32868, 17401, 5878, 8460,
+    5637, 12574, 9636, 16893, 8833, 28768, 9975, 28743, 32789, 11384, 9255, 10749, 32908, 12971, 9674, 13219,
+    12013, 28770, 13030, 10560, 5355, 13092, 28795, 5455, 28766, 32901, 12739, 12730, 28675, 28801, 13049, 5104,
+    5658, 11657, 9685, 28770, 13128, 12810, 12803, 5275, 16463, 10116, 32928, 12598, 16766, 17000, 9083, 13018,
+    17251, 16754, 12862, 8344, 11991, 16737, 16530, 17194, 5106, 16937, 28727, 11580, 10511, 17130, 12897, 8949,
+    12918, 12765, 17320, 12791, 32829, 10749, 32820, 5340, 9772, 10857, 28798, 5598, 28805, 11304, 6189, 32903,
+    32858, 28687, 12648, 32826, 16617, 12780, 32851, 12931, 17003, 17137, 10825, 12742, 4913, 13161, 10795, 28744,
+    28771, 28700, 11589, 12068, 13140, 12644, 28802, 28807, 5473, 12476, 12780, 11080, 10770, 13017, 11759, 28817,
+    28794, 28750, 11692, 12535, 8314, 28696, 12941, 12970, 9563, 8791, 6007, 12395, 28799, 32783, 12599, 11048,
+    12981, 5148, 12634, 4722, 10240, 12744, 12608, 8723, 12007, 13030, 28797, 5491, 10543, 28707, 9609, 12597,
+    17093, 13040, 28685, 10414, 12936, 16619, 32793, 16937, 16519, 12407, 9182, 13128, 16430, 4715, 8980, 11888,
+    9564, 16854, 16677, 28753, 12743, 12862, 17320, 11776, 32885, 12707, 9077, 28793, 8320, 28810, 9021, 28806,
+    12787, 28819, 32870, 16699, 11657, 6400, 16620, 12599, 32804, 10687, 28794, 10452, 12970, 28726, 13140, 17313,
+    12706, 12492, 32781, 5737, 10789, 28754, 11400, 6378, 12863, 32858, 10584, 9878, 9932, 11042, 11123, 12552,
+    13128, 13007, 11094, 11275, 28755, 28795, 17327, 12816, 12992, 12740, 32904, 13102, 12587, 13067, 12432, 28681,
+    28763, 12852, 12597, 10299, 5600, 16405, 12539, 12342, 12012, 17211, 12514, 12804, 32815, 8576, 28696, 8321,
+    12816, 12912, 28786, 13185, 13214, 16856, 11048, 10858, 16729, 13003, 28774, 11385, 17009, 12456, 12574, 28823,
+    17173, 12599, 28752, 32858, 9986, 28777, 32927, 16833, 12792, 28758, 28803, 12992, 32818, 12479, 5491, 32896,
+    5112, 12868, 28747, 11603, 9068, 10280, 12392, 12934, 10077, 8876, 12658, 11182, 12078, 16643, 28763, 11261,
+    12502, 28805, 16814, 12944, 11646, 4550, 8957, 12671, 8582, 28695, 12658, 10789, 32812, 17105, 6152, 4246,
+    12563, 6446, 9961, 12293, 13127, 12608, 12874, 17248, 11088, 10189, 11395, 28678, 28810, 17216, 6021, 28707,
+    32858, 32868, 28799, 28728, 16761, 12332, 12515, 11094, 13027, 16642, 13003, 6224, 16621, 10284, 28738, 5835,
+    12744, 28795, 12765, 12946, 12489, 16507, 12611, 16790, 13054, 16619, 12989, 4231, 28742, 11611, 12598, 32930,
+    28683, 17174, 12804, 9890, 9656, 32833, 17038, 6231, 32845, 28744, 8917, 4951, 28755, 9292, 10736, 13100,
+    12335, 12609, 9516, 11323, 12480, 12513, 16573, 12922, 28820, 16597, 12969, 12054, 9215, 9675, 10497, 32885,
+    16983, 9051, 5673, 28793, 12046, 32937, 9985, 28780, 28699, 10851, 13065, 13018, 11310, 12862, 28771, 11761,
+    6157, 28733, 12441, 16935, 12648, 4097, 32915, 12564, 8440, 17318, 12863, 28784, 9076, 5893, 17259, 28787,
+    17146, 13092, 9239, 12318, 11137, 9388, 12737, 28706, 12330, 12983, 28778, 28713, 12413, 5591, 6455, 12065,
+    12828, 11611, 12321, 9636, 10811, 12708, 11024, 6167, 28693, 28688, 17237, 28702, 12864, 9241, 28778, 12992,
+    12657, 12802, 8410, 12002, 9435, 12398, 12660, 28823, 12852, 12940, 8806, 28736, 8779, 28817, 32787, 32781,
+    11876, 4340, 9664, 16858, 10516, 8248, 11982, 28719, 28701, 8767, 28694, 28772, 12959, 12870, 12848, 32803,
+    4339, 10533, 32903, 10077, 9366, 8751, 12732, 11873, 11873, 5497, 9012, 12837, 6051, 13164, 32914, 17182,
+    28820, 32854, 28819, 16541, 13180, 9533, 12956, 28675, 13139, 17299, 9652, 6057, 16593, 11150, 32923, 12799,
+    12608, 5666, 16540, 10795, 28704, 28776, 28761, 17223, 32827, 12754, 20484, 13224, 28711, 8595, 12619, 16766,
+    12672, 12924, 13138, 4984, 11474, 6328, 13044, 12660, 11748, 11157, 9975, 28698, 28741, 12883, 28775, 17077,
+    11914, 10262, 28685, 9664, 28775, 16764, 9485, 16843, 12744, 12804, 32905, 32841, 28684, 32779, 8624, 28718,
+    6021, 17038, 11322, 28707, 28828, 32894, 11877, 28812, 12380, 32851, 17411, 28807, 16688, 16974, 5516, 8713,
+    28678, 16894, 32801, 16483, 28805, 32826, 28760, 13078, 32902, 17390, 10513, 13076, 28814, 28694, 16530, 12768,
+    17137, 9518, 32819, 8769, 9300, 8704, 12535, 17378, 17067, 12077, 10877, 11469, 32908, 12838, 16816, 28775,
+    9375, 16936, 28784, 12803, 12617, 9131, 5603, 20490, 13192, 28821, 12942, 12720, 12876, 16687, 13172, 16936,
+    12393, 32859, 13071, 32837, 10283, 13051, 11480, 9088, 28824, 8548, 12588, 17051, 28774, 28755, 5670, 9302,
+    12851, 28762, 16620, 13128, 12768, 6363, 28780, 28697, 32922, 12982, 13039, 12984, 12840, 12596, 12540, 32794,
+    11677, 9984, 28787, 11101, 28763, 16671, 13173, 13017, 12801, 28818, 28680, 28795, 28706, 11011, 28826, 13193,
+    13190, 12945, 8723, 12839, 11393, 10998, 28721, 17072, 13073, 5473, 4140, 13088, 9907, 28698, 12856, 9372,
+    32820, 28677, 8802, 13030, 11460, 8480, 12810, 32798, 28675, 12477, 12506, 10208, 32814, 9909, 16463, 12552,
+    11400, 16936, 32857, 11005, 28744, 28719, 17308, 32868, 9385, 12971, 17124, 8787, 28733, 32924, 16462, 8469,
+    13018, 28687, 28685, 5914, 11873, 13031, 12755, 9738, 28806, 6407, 12780, 28827, 11180, 12798, 10218, 11041,
+    9975, 28794, 13221, 32883, 12003, 28693, 32859, 12827, 13078, 16779, 9617, 28775, 13008, 13056, 11479, 11011,
+    13161, 11945, 10273, 6416, 13112, 12910, 12876, 11692, 9590, 16767, 11398, 5202, 12335, 32820, 12864, 8241,
+    28793, 17411, 8468, 12540, 28683, 28696, 13198, 12633, 17230, 32806, 5237, 12821, 11334, 11952, 12727, 9974,
+    12504, 28775, 13080, 11699, 8402, 9026, 17372, 10442, 28706, 13181, 16530, 12981, 13164, 8490, 28826, 17295,
+    32849, 12300, 20489, 13014, 16451, 12705, 28784, 6031, 9985, 13181, 28766, 28782, 11574, 10883, 28755, 12479,
+    28820, 11416, 32844, 13074, 12658, 10140, 28752, 12839, 5650, 28738, 11728, 12404, 17348, 10041, 32855, 5106,
+    8876, 13042, 12959, 13161, 17149, 16537, 12732, 16857, 5665, 11945, 32839, 6136, 12932, 28799, 10860, 4436,
+    5614, 9599, 5636, 13080, 17280, 11410, 13027, 28765, 28702, 10159, 6311, 12536, 28685, 9620, 9304, 10584,
+    32866, 13068, 28705, 32816, 10264, 11759, 16620, 32773, 16703, 9078, 28798, 12663, 11692, 17373, 28698, 11180,
+    10378, 13048, 32935, 28743, 16999, 16621, 9673, 8423, 12956, 5928, 12918, 17117, 8606, 13006, 13091, 32890,
+    10284, 11465, 12366, 9012, 28789, 16822, 28815, 32911, 9375, 8254, 12456, 16508, 12396, 12012, 12668, 12994,
+    10495, 12492, 28735, 17290, 20489, 10843, 11699, 28756, 8965, 6424, 28696, 28777, 28713, 13193, 32915, 11180,
+    11275, 28772, 4521, 9215, 11633, 28748, 16541, 32896, 6334, 28818, 32829, 13061, 13066, 28695, 10581, 28812,
+    9563, 12324, 12296, 28738, 5088, 8768, 12323, 12354, 9357, 16933, 10582, 11747, 13116, 32826, 12635, 28806,
+    11708, 16721, 20485, 17080, 28710, 11408, 12588, 17244, 8322, 6433, 17330, 12323, 12899, 28682, 9276, 12592,
+    9078, 13029, 5490, 28715, 13175, 12391, 9916, 11334, 32925, 12600, 16650, 12863, 8278, 16530, 11094, 12759,
+    13221, 8446, 17367, 28748, 8789, 11434, 6051, 17378, 12873, 16427, 8885, 28740, 9974, 32846, 32791, 16622,
+    8204, 20482, 28687, 17162, 12046, 32934, 28824, 16437, 32793, 12414, 28727, 12935, 12588, 17246, 17224, 28800,
+    20486, 32828, 32883, 28718, 28711, 12910, 32934, 10845, 12885, 11142, 5856, 12840, 13221, 32927, 28817, 28700,
+    12490, 12895, 32814, 17316, 8528, 13054, 12453, 20481, 6402, 9839, 12371, 10285, 28723, 12461, 12852, 12334,
+    12473, 28683, 13060, 4598, 12503, 17378, 28772, 16957, 28797, 8894, 12912, 11595, 13211, 28738, 28706, 8306,
+    11285, 16990, 17156, 28806, 8552, 6369, 28797, 11559, 12612, 10561, 28792, 11610, 12596, 12415, 6452, 12333,
+    16834, 17233, 13187, 8908, 28683, 16564, 8765, 12861, 12704, 10646, 12660, 17209, 28759, 28802, 13139, 28747,
+    10450, 28759, 16735, 17196, 12355, 12525, 9580, 28783, 10664, 12840, 17130, 16585, 9087, 17324, 13042, 12658,
+    12959, 28827, 5275, 12474, 28708, 12396, 4733, 28710, 11456, 10554, 13044, 9562, 6402, 17324, 16418, 6231,
+    9572, 10189, 28779, 12655, 6453, 9022, 13003, 12984, 12597, 32900, 16982, 11144, 12503, 16566, 13103, 12525,
+    17209, 6152, 10664, 28702, 17092, 8620, 28691, 9321, 28797, 13077, 11560, 11620, 10867, 17094, 12611, 11971,
+    10569, 12417, 28807, 13135, 11944, 12324, 13030, 11451, 8789, 12756, 32815, 8667, 16798, 28828, 11706, 4850,
+    32921, 12708, 16492, 9601, 5111, 13124, 12969, 10771, 28711, 6438, 10264, 4809, 12669, 12888, 28752, 8620,
+    8790, 16858, 9672, 9608, 11768, 28818, 9656, 12348, 11698, 17214, 16597, 32919, 12800, 10945, 32779, 4834,
+    32881, 11908, 5627, 32794, 13092, 16687, 12333, 28791, 9358, 32845, 5614, 32913, 10963, 6138, 12504, 5455,
+    12312, 9579, 28712, 12754, 17225, 12856, 12669, 8935, 13151, 17279, 12636, 32920, 6364, 12852, 11622, 10877,
+    28756, 32908, 12775, 16529, 9377, 28683, 28692, 12883, 6448, 8479, 13222, 11456, 32880, 32830, 12828, 13080,
+    12636, 12754, 13128, 28816, 28695, 16598, 12322, 12402, 12972, 13157, 11150, 12708, 8828, 16958, 28701, 9687,
+    32788, 11171, 11481, 10866, 6043, 12885, 8723, 12976, 32801, 8229, 28695, 4244, 28759, 13078, 6365, 28745,
+    6008, 13127, 12765, 13020, 6058, 11952, 13148, 12849, 12547, 28805, 12947, 8827, 10838, 8537, 32902, 10647,
+    28784, 17398, 28812, 12980, 28736, 8930, 32803, 12344, 16777, 32775, 8520, 12525, 12049, 28736, 12668, 16567,
+    10810, 5236, 12559, 9706, 12995, 12929, 13116, 12499, 28794, 12732, 12972, 32815, 13087, 13008, 28765, 12485,
+    13090, 16595, 8422, 12660, 13210, 11701, 13116, 11340, 28737, 5274, 28768, 5671, 16607, 10295, 17167, 12996,
+    9341, 28678, 11110, 17292, 12604, 28750, 28702, 13158, 8769, 12688, 8825, 8620, 10094, 10662, 9600, 9187,
+    12824, 12622, 10877, 9067, 11126, 11888, 28727, 13138, 11477, 13124, 10112, 9235, 28730, 28695, 9686, 12804,
+    13031, 8367, 28727, 9816, 12840, 28712, 13091, 11165, 12559, 32781, 11913, 12840, 17004, 32859, 16458, 16420,
+    32937, 17248, 28716, 28767, 17358, 20483, 12994, 28696, 8790, 8207, 8491, 28711, 6137, 9481, 12647, 4546,
+    28805, 9078, 17406, 8982, 16442, 13113, 8424, 10794, 12065, 8479, 12383, 28790, 32882, 16700, 8789, 12584,
+    12864, 13102, 9955, 9635, 11109, 12475, 28693, 16620, 13187, 17072, 16614, 11057, 9310, 32923, 17305, 6402,
+    12417, 10686, 28775, 12595, 16778, 11462, 16815, 12756, 28744, 12357, 8351, 32775, 8819, 28692, 16447, 13175,
+    12536, 28731, 12072, 9982, 12900, 9708, 10506, 11400, 13150, 28808, 32793, 9673, 12947, 12784, 8491, 16461,
+    28807, 10961, 32806, 8379, 32830, 12300, 28793, 13115, 10130, 10189, 10218, 32781, 5681, 16957, 12837, 11757,
+    6197, 4694, 12467, 12560, 28757, 28678, 17410, 9424, 28792, 28742, 28678, 13078, 28705, 28673, 32848, 12720,
+    12912, 12969, 28682, 13215, 16430, 11779, 12611, 17110, 12680, 16645, 16411, 8778, 8787, 8491, 10452, 10728,
+    9554, 28776, 9685, 12618, 8717, 16698, 17088, 12573, 12861, 12011, 13180, 32805, 9238, 12558, 10664, 28756,
+    28745, 16886, 9256, 10998, 9386, 13212, 28721, 16496, 12537, 12636, 28775, 10398, 32817, 28756, 28805, 28682,
+    12960, 28746, 9477, 32915, 32819, 17103, 9534, 17254, 32935, 28771, 32931, 28684, 6406, 32855, 6437, 13005,
+    28692, 12391, 28692, 12560, 28807, 32831, 12407, 9986, 28710, 28685, 13091, 4697, 16924, 28820, 13049, 9086,
+    10162, 12993, 9248, 12580, 28674, 11653, 12641, 13204, 12512, 9855, 13006, 12552, 10693, 28710, 16425, 32866,
+    6375, 12336, 28709, 32907, 16524, 16428, 12058, 11707, 8227, 9908, 28687, 9561, 9072, 28767, 4419, 28695,
+    16568, 28686, 13112, 12508, 5356, 9778, 28793, 28781, 12744, 16884, 13015, 10404, 12450, 13166, 6453, 28756,
+    8359, 28822, 28822, 11027, 8365, 12933, 4660, 11720, 12490, 20483, 12970, 12763, 28684, 8424, 4657, 5664,
+    9740, 32815, 6174, 10420, 12513, 8904, 11954, 28807, 28755, 11583, 32863, 28737, 10284, 11143, 12660, 13203,
+    28819, 5430, 6321, 16825, 28824, 28795, 28673, 4713, 9683, 20482, 17311, 12360, 4890, 4361, 16688, 32902,
+    28765, 12429, 9387, 13210, 13127, 28775, 32915, 16779, 6449, 28714, 28727, 12368, 17067, 9256, 13056, 9687,
+    28696, 28705, 28704, 10712, 12873, 9916, 16423, 10648, 12360, 28768, 12737, 13030, 12767, 32839, 28706, 28729,
+    28794, 11755, 32872, 28827, 28707, 16753, 12452, 10694, 8788, 12755, 8327, 9555, 5112, 4109, 12012, 17058,
+    28698, 28748, 12624, 13069, 12695, 12633, 13140, 9246, 17015, 12959, 5047, 11991, 12392, 9617, 32817, 8947,
+    32846, 12418, 32920, 12837, 28746, 8491, 6386, 28720, 8322, 10399, 32801, 12330, 17161, 10348, 12456, 12741,
+    12872, 5578, 28700, 28705, 12826, 16518, 6401, 4618, 10431, 13091, 4907, 11393, 28771, 10217, 9518, 16677,
+    6370, 17171, 9481, 6463, 12515, 12851, 13104, 9617, 16602, 10285, 8533, 8792, 10806, 8722, 5915, 32783,
+    28788, 12407, 12959, 11239, 12310, 11207, 28706, 12660, 32846, 12635, 11748, 4245, 10173, 12656, 11157, 12850,
+    11055, 12443, 12792, 32871, 13135, 9885, 28783, 28765, 4976, 11181, 10158, 10947, 28740, 28751, 12658, 10101,
+    12756, 9164, 12644, 32858, 17332, 28822, 11755, 8722, 28799, 9889, 9562, 16844, 16608, 28717, 8526, 28803,
+    17410, 12347, 11235, 17137, 12888, 5640, 28761, 9862, 28818, 17130, 17294, 12894, 10201, 28740, 28769, 28722,
+    13114, 16957, 9234, 4473, 13101, 12383, 11889, 28777, 11679, 32856, 12659, 11029, 28782, 12588, 32844, 12858,
+    12334, 8490, 6033, 13210, 8666, 16450, 9995, 5318, 32896, 28690, 8667, 16842, 28771, 12345, 10413, 8777,
+    11578, 12657, 11609, 6461, 12852, 13202, 13104, 13072, 13212, 9083, 10490, 10273, 12848, 12775, 11290, 28707,
+    17160, 9682, 10664, 9730, 12516, 12078, 28806, 12656, 16563, 9089, 9002, 8783, 5302, 11112, 13049, 10179,
+    32794, 11776, 12718, 16745, 12382, 8255, 9376, 9850, 17027, 9169, 11952, 17332, 32776, 8534, 12744, 12767,
+    28741, 9973, 12597, 17027, 9517, 16458, 32792, 32793, 12833, 12907, 32877, 12683, 11464, 12741, 12970, 4697,
+    16779, 28679, 32910, 12407, 12982, 10760, 16667, 12586, 4178, 9002, 12850, 9592, 28776, 28746, 10225, 9972,
+    16411, 17196, 11010, 8621, 12826, 32845, 28742, 9941, 16529, 11908, 32832, 11496, 11963, 12336, 12755, 32805,
+    11322, 28800, 17411, 12430, 28692, 28814, 16844, 5434, 28790, 10976, 28684, 28770, 16621, 12587, 6160, 11275,
+    12754, 6327, 9617, 12347, 12512, 28682, 28754, 17082, 12882, 8305, 32854, 8480, 12053, 28817, 28811, 11471,
+    12816, 28803, 32919, 13114, 12885, 12659, 10963, 5207, 16601, 12984, 12383, 5614, 12790, 17410, 10552, 8988,
+    16841, 12608, 13061, 13149, 10184, 12658, 12347, 12906, 16841, 28816, 13104, 28702, 8367, 12079, 8694, 32920,
+    12431, 28705, 8722, 12420, 28821, 16694, 11998, 10987, 5274, 32788, 8853, 12068, 28782, 28810, 20490, 12311,
+    16598, 16843, 28689, 9088, 12927, 9554, 9899, 12563, 13104, 17150, 16649, 9011, 17388, 12403, 11449, 8389,
+    12884, 6211, 4120, 8359, 16420, 28818, 32789, 11778, 5614, 12477, 13181, 28780, 28784, 17347, 13170, 28732,
+    16733, 28711, 8720, 8692, 11633, 28817, 13138, 5473, 28719, 6029, 5634, 9068, 11760, 17318, 5478, 8832,
+    12324, 32845, 28795, 28782, 28711, 12646, 32871, 17083, 20484, 13193, 16687, 28807, 32933, 8831, 12063, 12744,
+    13134, 32869, 9306, 10498, 28713, 11041, 11754, 11453, 16516, 12755, 28676, 12683, 8847, 5777, 12357, 13101,
+    28690, 13119, 20487, 17050, 6466, 12940, 13102, 12450, 12898, 17300, 12395, 9310, 12548, 16767, 10197, 8300,
+    11655, 12347, 12369, 4179, 28742, 28693, 16419, 8368, 11259, 16536, 32857, 11998, 12636, 28705, 20483, 12347,
+    28812, 12680, 16440, 12298, 12864, 12804, 12467, 13089, 12048, 12634, 17241, 28770, 12860, 10504, 6152, 12917,
+    9019, 9674, 12972, 28706, 9063, 6363, 28806, 12538, 17081, 9656, 16641, 28797, 6400, 8722, 5664, 13198,
+    32853, 13180, 20482, 28713, 6387, 10147, 10883, 11011, 12972, 11048, 28715, 32817, 4219, 13138, 12432, 28800,
+    16662, 28684, 32819, 5602, 32781, 6155, 12431, 12524, 32850, 12708, 28758, 12600, 17245, 28738, 32902, 28715,
+    12731, 8778, 28740, 9031, 20490, 13091, 13161, 8718, 16460, 12648, 32817, 17167, 10049, 28675, 10876, 12779,
+    28718, 11693, 12996, 10867, 17124, 17090, 13207, 32842, 13215, 13140, 9686, 28714, 10743, 13102, 28707, 9909,
+    8488, 17223, 12924, 13149, 12838, 32833, 32919, 12644, 10473, 28739, 32805, 4771, 32937, 4276, 9531, 5355,
+    11176, 28794, 16973, 16688, 8285, 12776, 17411, 17241, 12451, 12469, 12536, 28744, 4118, 17146, 13040, 28760,
+    12011, 20489, 28821, 16607, 12450, 32819, 12587, 28765, 32806, 11667, 8789, 12635, 28818, 12756, 13032, 16462,
+    28705, 13207, 28707, 16541, 28817, 13192, 6466, 8501, 13092, 13173, 17240, 12791, 28689, 32885, 9229, 4726,
+    12450, 16778, 12570, 17051, 16755, 11176, 12016, 28731, 12370, 28766, 11856, 8712, 16670, 12298, 12862, 13114,
+    28716, 12351, 28818, 9089, 12838, 12863, 12792, 32890, 8912, 12862, 32857, 28719, 5633, 8920, 13115, 12323,
+    12862, 28753, 11175, 12597, 28724, 28708, 28825, 20483, 13147, 11159, 28811, 28794, 13055, 12056, 28805, 12383,
+    10706, 8778, 12875, 12677, 12646, 32922, 16686, 12969, 5670, 10688, 9759, 12740, 13174, 9218, 11505, 9121,
+    17205, 32830, 13152, 5047, 4190, 17062, 12804, 28810, 28683, 12504, 10769, 13192, 12796, 9120, 28807, 28736,
+    11373, 12851, 16569, 13090, 12884, 12635, 10230, 28811, 10284, 12740, 8424, 4982, 17077, 10003, 32806, 11069,
+    12574, 13114, 28674, 32817, 12727, 28782, 12612, 16725, 12450, 5834, 5447, 11534, 9878, 12754, 8861, 9011,
+    4890, 11609, 12395, 12787, 28693, 5447, 17016, 11011, 28828, 11883, 20490, 28717, 5497, 10829, 9656, 11544,
+    32911, 12884, 6250, 5645, 28827, 16608, 28702, 5557, 12480, 28793, 9339, 13126, 28707, 16649, 8971, 28795,
+    32895, 17382, 32793, 8790, 28707, 17181, 32866, 10838, 8480, 8276, 20488, 28754, 28759, 12960, 12372, 13032,
+    32915, 9655, 12323, 32829, 17124, 12956, 28717, 32893, 11334, 9824, 16504, 28761, 12038, 17106, 12648, 28713,
+    10435, 12849, 12588, 28682, 13115, 10724, 16904, 5625, 10677, 17141, 12384, 9490, 32898, 32831, 11067, 11245,
+    4116, 13092, 20481, 9646, 32894, 28814, 28761, 13196, 10156, 11068, 13078, 28720, 9366, 10712, 9020, 13025,
+    11101, 13206, 17070, 20487, 12660, 12297, 28784, 28802, 12634, 17111, 32845, 9863, 16697, 28777, 10572, 16598,
+    8338, 10730, 8301, 12958, 32881, 28800, 11574, 12468, 12335, 11345, 32794, 5578, 13016, 28807, 17388, 8357,
+    12442, 11127, 28721, 8723, 28765, 13038, 10225, 17313, 5063, 12958, 11005, 8490, 17396, 32875, 12906, 12420,
+    11895, 9563, 28825, 10284, 5836, 13056, 32806, 5602, 12956, 28744, 11412, 6121, 9021, 17391, 32780, 11577,
+    13056, 13002, 12706, 28706, 16924, 12599, 13056, 5955, 17060, 8490, 5835, 12896, 12477, 8486, 12300, 5484,
+    9985, 13125, 8414, 12838, 12996, 12718, 16513, 28708, 28681, 12588, 32819, 28813, 10976, 13140, 28818, 12718,
+    13026, 9321, 13041, 9982, 12552, 17209, 5339, 28815, 8974, 12417, 28688, 28780, 32793, 12367, 11424, 32882,
+    28769, 28813, 32871, 16774, 9066, 9302, 11058, 28716, 16530, 12994, 6057, 12324, 11024, 13047, 12072, 28679,
+    16595, 17216, 17161, 11035, 10246, 11029, 16525, 28711, 5992, 12442, 12863, 10152, 16773, 28784, 4783, 32792,
+    9012, 10712, 16929, 28822, 16914, 12636, 10858, 9366, 32933, 8912, 16864, 12540, 16921, 28685, 9377, 6314,
+    28681, 28709, 8711, 8757, 11260, 28817, 32855, 11297, 8848, 12336, 32840, 10283, 28827, 16698, 12827, 28695,
+    9656, 28763, 28782, 6443, 4679, 9665, 12744, 28777, 28826, 16843, 32807, 6338, 12588, 20488, 12564, 28706,
+    20482, 8306, 12336, 6082, 9168, 16556, 10325, 32842, 16902, 16687, 28815, 10675, 12743, 8480, 13060, 28776,
+    11105, 4222, 12684, 11470, 28686, 4580, 20490, 17411, 10260, 11347, 28817, 16737, 9021, 32923, 17150, 32794,
+    28692, 17331, 32814, 12992, 11011, 6339, 13004, 28728, 12851, 13092, 28678, 28717, 12539, 28737, 9265, 9067,
+    6112, 13059, 32794, 32816, 28789, 9964, 28704, 8405, 11320, 28798, 11703, 13089, 16694, 16772, 32885, 28714,
+    9089, 12707, 12732, 12502, 13007, 17130, 11735, 9600, 28689, 11131, 17167, 28807, 12392, 28736, 9919, 12563,
+    12492, 28799, 6014, 13104, 32887, 4880, 12969, 28770, 6029, 28761, 4607, 5355, 12455, 11873, 9586, 5167,
+    28783, 16542, 11996, 9123, 17402, 11773, 20487, 11711, 28771, 13161, 6137, 12798, 8917, 11702, 32801, 8528,
+    12335, 28770, 11408, 10506, 9564, 28824, 16410, 12647, 28741, 10261, 28738, 13080, 32857, 32801, 8233, 13219,
+    32895, 28801, 9634, 16488, 28731, 11993, 5606, 9906, 12788, 17058, 11705, 8414, 9077, 12992, 16528, 12431,
+    32779, 4830, 12768, 28794, 28693, 17209, 10857, 16529, 12360, 28826, 11773, 13164, 28819, 17081, 12802, 13135,
+    16620, 28702, 32932, 10862, 12646, 28777, 32777, 4334, 6203, 11011, 16542, 17058, 11110, 12720, 12825, 5473,
+    28795, 12012, 12828, 32889, 28721, 12827, 5484, 28761, 10377, 9076, 17337, 12658, 10214, 12837, 6198, 12334,
+    8375, 9959, 12350, 17319, 20487, 32879, 5402, 12778, 12895, 17219, 28743, 12599, 12468, 6152, 32871, 13113,
+    28688, 9386, 32898, 16462, 12395, 17160, 9672, 12982, 12635, 16517, 28775, 11275, 28721, 28683, 20485, 16721,
+    28699, 16723, 12982, 16505, 16478, 28775, 32867, 16570, 4917, 12982, 12718, 12743, 16676, 28696, 17231, 12636,
+    12707, 16648, 16957, 12660, 11664, 10270, 12524, 12742, 12431, 8421, 8367, 28808, 28700, 17137, 5835, 9665,
+    6332, 12918, 28757, 16617, 28688, 17067, 32814, 28724, 12443, 17056, 17166, 8528, 5627, 12534, 6464, 16497,
+    12359, 11105, 10865, 28701, 10646, 13191, 16461, 17171, 4223, 28805, 17303, 28686, 32937, 13004, 28673, 11932,
+    12525, 8461, 28712, 10664, 8663, 17252, 12644, 28794, 10811, 32897, 32841, 16875, 16460, 9919, 28754, 8769,
+    6291, 12893, 8225, 12636, 13176, 16688, 11413, 9672, 12393, 32890, 8479, 12875, 12803, 28694, 13115, 9899,
+    16412, 16451, 9022, 10827, 28773, 17410, 6234, 28705, 8723, 8882, 28786, 11181, 11088, 28679, 28754, 9664,
+    8620, 12708, 5369, 11662, 13128, 12500, 8742, 16655, 17385, 17053, 13044, 12526, 12358, 12946, 11663, 12420,
+    16956, 16698, 6387, 11165, 16699, 11698, 12360, 10160, 12624, 17397, 10748, 9321, 17230, 4393, 9022, 13175,
+    32909, 28808, 12440, 28809, 28795, 13096, 17230, 12669, 10496, 17374, 12957, 17225, 28781, 17291, 16842, 16540,
+    16421, 20481, 10643, 12693, 28766, 28681, 12798, 28812, 32898, 9235, 28819, 8658, 12009, 32859, 16541, 13103,
+    28700, 10208, 12875, 12939, 28806, 10713, 17312, 13098, 13112, 12888, 16746, 6342, 11110, 9385, 32896, 28817,
+    16485, 12971, 9311, 12788, 13188, 5462, 12934, 11150, 11093, 28728, 28824, 11901, 28771, 9125, 12456, 16912,
+    28705, 6336, 16672, 11874, 12467, 9311, 16560, 12802, 17011, 12801, 13204, 16784, 11312, 28682, 12705, 11906,
+    16410, 12500, 8333, 10151, 9673, 6254, 32883, 16655, 28684, 28806, 12766, 5628, 12610, 9078, 28798, 10584,
+    10513, 13181, 11115, 4162, 17395, 17406, 12789, 4981, 16676, 10920, 10845, 12980, 16564, 12928, 8478, 11461,
+    9854, 12863, 16858, 28740, 20484, 13176, 12335, 10661, 9863, 5714, 11373, 28820, 28683, 5367, 9685, 13204,
+    9097, 12864, 5671, 9534, 8778, 17124, 10353, 28786, 12850, 28750, 12371, 28696, 10677, 12489, 12588, 28790,
+    12393, 8649, 28771, 12311, 12622, 32777, 4338, 11722, 12767, 17332, 32851, 28767, 12394, 5836, 32869, 17038,
+    12396, 13098, 28820, 16519, 12428, 8367, 32896, 12635, 11480, 32844, 12959, 16746, 9329, 17082, 12648, 8650,
+    13017, 28762, 16674, 28806, 5663, 32935, 12372, 12535, 28695, 11703, 16689, 8434, 9078, 28802, 12371, 12940,
+    12068, 13116, 8480, 12659, 32908, 28731, 28755, 9078, 16562, 28743, 6367, 13068, 28819, 11558, 9078, 28711,
+    11596, 12437, 32833, 28797, 12058, 5730, 16676, 28712, 20488, 11421, 28758, 12645, 28718, 9684, 16716, 11895,
+    9388, 12940, 10831, 16955, 9605, 5020, 6406, 12800, 28707, 12838, 12787, 10959, 12911, 10583, 16777, 28827,
+    28787, 12981, 13088, 17240, 20486, 12635, 13116, 12312, 10498, 32819, 12995, 32857, 10645, 13104, 6426, 6461,
+    9366, 12751, 9674, 28794, 32859, 4889, 28705, 32851, 8490, 12899, 12744, 28715, 9523, 32898, 32884, 32881,
+    28740, 28805, 28804, 13053, 12730, 12526, 5669, 28807, 10253, 5131, 9554, 11094, 11859, 28806, 16540, 13056,
+    10214, 28714, 12744, 28740, 12535, 17082, 17392, 28754, 11011, 4884, 17004, 8368, 12587, 12970, 16699, 28771,
+    11574, 6381, 12466, 13067, 12815, 6293, 16853, 28685, 32936, 11286, 10208, 17224, 28778, 9917, 12451, 12480,
+    32832, 12019, 28783, 11419, 16619, 8657, 13090, 9089, 16463, 13041, 12646, 16671, 12310, 12446, 28826, 8920,
+    9087, 17230, 20486, 9724, 16752, 9058, 12382, 9925, 12755, 12306, 28754, 17171, 28793, 28719, 17013, 6184,
+    9613, 13072, 32856, 10824, 12924, 17220, 13078, 12719, 9264, 11108, 13055, 12695, 9619, 16567, 32882, 28681,
+    11921, 16615, 28740, 32924, 28817, 12850, 10256, 28724, 12587, 17403, 28682, 9447, 12971, 5037, 9320, 28815,
+    32806, 8678, 16461, 12384, 17088, 32937, 32792, 9211, 17308, 9965, 28817, 10579, 16542, 12636, 8440, 16934,
+    32882, 28736, 6235, 28719, 13127, 9385, 16578, 12360, 5365, 17161, 12996, 12945, 28692, 8459, 32872, 16657,
+    12971, 6397, 4890, 12753, 5112, 17324, 6008, 11284, 13024, 32871, 32777, 8578, 13187, 16813, 12445, 9665,
+    12659, 4427, 9022, 32794, 28802, 6337, 16664, 9554, 32890, 11842, 9087, 28789, 10861, 17288, 20488, 28704,
+    16676, 13080, 8470, 11113, 11574, 12792, 16564, 10173, 11860, 16682, 16619, 10797, 28704, 8413, 9518, 13203,
+    9011, 8480, 12321, 32781, 8728, 12391, 28812, 16449, 12393, 12300, 32776, 8545, 5626, 28819, 13067, 28782,
+    12718, 17308, 28706, 28828, 9889, 9974, 28709, 12646, 12384, 28734, 32817, 12802, 11964, 17070, 12743, 28676,
+    16621, 10407, 32780, 5215, 28821, 28700, 8789, 28799, 28703, 8965, 16857, 9753, 17403, 5588, 16616, 11456,
+    12348, 11137, 11442, 12897, 32895, 12918, 12912, 5498, 12321, 13047, 12729, 17174, 16766, 16541, 32936, 12442,
+    11692, 17304, 17240, 32828, 28778, 32839, 32877, 28702, 9657, 12312, 13013, 16937, 13126, 6122, 10771, 11821,
+    12826, 28775, 6135, 28724, 12755, 6174, 12972, 10852, 8832, 12357, 9608, 13185, 28826, 12972, 10690, 32828,
+    17170, 12043, 28768, 12298, 16527, 9607, 10712, 9441, 9617, 12838, 28676, 10214, 20482, 16620, 5448, 11096,
+    28705, 12593, 28740, 28786, 13109, 10262, 12570, 12670, 12648, 5587, 17173, 13090, 16674, 16925, 12332, 12839,
+    9122, 13072, 16745, 12344, 9538, 28818, 28723, 12466, 5046, 12449, 8713, 9302, 11651, 12983, 16478, 28688,
+    28821, 11058, 12473, 28800, 11708, 12658, 8491, 5064, 8722, 28809, 28823, 32870, 12803, 28767, 10217, 13038,
+    28743, 16463, 12714, 8480, 13041, 11261, 10877, 10610, 8491, 12324, 12695, 16524, 28683, 16970, 13116, 11386,
+    16699, 12504, 16835, 16744, 8653, 32806, 9873, 17388, 8957, 12801, 12821, 9193, 12989, 13199, 9018, 4971,
+    32805, 11285, 11070, 32775, 8518, 12393, 6400, 16716, 11769, 28813, 32778, 4665, 12719, 6022, 32858, 17042,
+    17371, 12658, 17107, 16563, 28744, 11767, 12789, 17258, 11857, 32840, 5658, 12525, 9919, 9534, 12623, 28828,
+    8414, 16894, 16783, 8618, 12572, 11358, 28741, 28783, 16489, 16451, 32859, 12766, 5046, 11691, 8744, 12936,
+    32792, 17087, 32834, 28708, 6341, 16463, 13048, 16412, 28807, 17095, 13113, 12888, 16641, 10101, 17410, 5773,
+    10659, 12852, 16879, 12417, 11241, 28706, 13120, 12460, 13216, 28815, 12984, 12645, 12368, 12671, 28708, 8821,
+    8234, 11648, 10857, 32788, 12552, 32826, 11923, 12918, 9241, 16594, 11176, 9265, 9003, 16912, 12780, 16808,
+    12561, 28702, 28793, 12327, 4252, 28691, 17013, 13112, 13140, 32924, 10280, 12852, 4864, 12840, 12861, 28792,
+    12768, 28747, 11010, 5772, 12464, 8942, 13102, 10152, 10771, 9457, 28798, 28790, 28736, 12767, 12384, 9916,
+    12935, 10215, 12370, 11002, 12946, 28783, 12487, 8751, 9683, 6152, 12624, 12791, 16983, 12928, 28693, 12766,
+    28776, 13002, 28720, 32778, 10381, 12899, 16609, 12823, 8712, 12886, 12864, 8919, 5596, 32880, 16846, 32935,
+    12763, 5448, 11719, 16767, 12687, 11156, 28771, 8487, 11243, 17320, 13060, 32911, 32908, 11166, 12431, 20486,
+    13020, 9095, 12384, 12426, 10958, 12381, 13091, 10573, 8788, 10138, 12672, 5338, 8786, 8414, 13164, 28782,
+    13177, 28795, 28726, 12523, 12708, 6321, 12888, 17295, 12436, 12850, 5356, 13212, 12959, 28680, 5164, 28791,
+    28788, 28761, 5954, 13026, 12583, 11449, 10877, 10342, 16677, 13090, 16656, 28807, 12537, 12502, 20486, 9970,
+    12606, 28782, 9321, 16700, 8965, 28714, 28821, 28822, 16948, 13079, 12824, 13103, 11070, 28733, 13196, 28765,
+    9088, 8911, 16500, 8584, 28790, 9546, 6400, 8711, 13018, 13224, 28779, 12325, 28806, 28716, 16764, 16517,
+    16563, 13223, 12610, 12394, 28771, 9290, 28815, 32894, 32905, 12460, 10637, 28802, 13188, 28804, 28687, 28718,
+    9610, 12824, 16667, 9907, 32776, 16486, 12525, 4944, 10850, 6448, 28765, 17406, 28788, 5575, 9311, 5338,
+    16462, 28819, 12864, 17030, 9665, 10253, 11704, 32870, 16844, 11465, 32915, 4625, 11353, 28695, 8704, 16440,
+    13196, 13079, 17015, 12465, 10452, 16937, 12424, 9337, 16609, 5926, 12460, 17411, 13100, 17353, 12958, 12763,
+    12647, 12732, 9956, 12335, 17321, 28673, 8620, 28755, 28828, 13079, 11176, 12825, 6363, 11109, 16856, 11762,
+    9376, 28792, 12826, 8665, 8769, 12845, 28810, 28744, 28684, 16549, 8408, 16529, 13031, 13103, 17174, 5835,
+    17027, 28676, 28689, 12815, 13065, 28742, 28802, 16451, 12939, 12584, 12396, 28791, 9517, 28705, 12876, 17239,
+    32851, 17141, 28711, 28779, 12323, 16540, 28717, 5592, 17140, 17071, 12696, 13114, 17332, 32921, 10579, 16688,
+    4715, 12526, 9311, 28783, 16845, 5926, 13197, 10207, 12323, 9254, 16720, 10866, 13088, 12535, 8228, 9555,
+    12354, 12294, 10563, 16764, 11312, 32845, 28681, 9676, 13215, 16621, 28772, 12480, 12645, 17392, 11735, 13115,
+    6407, 13212, 11880, 12659, 16603, 8351, 6226, 28799, 17212, 28722, 32841, 28707, 8249, 13089, 13015, 5812,
+    17094, 8657, 32856, 12552, 13180, 13140, 12905, 28802, 28709, 28707, 8565, 13079, 28693, 16801, 28688, 32908,
+    28775, 8768, 16698, 8469, 28749, 12979, 28783, 8779, 13030, 11407, 16618, 11741, 12079, 5835, 10725, 28757,
+    28784, 12312, 16596, 12896, 10987, 12993, 5503, 28788, 12670, 32923, 9562, 28740, 12744, 28779, 28696, 11481,
+    12635, 20485, 32866, 5093, 12406, 13104, 28827, 16485, 9580, 10513, 9497, 28812, 12372, 32814, 5063, 28763,
+    16666, 28798, 12813, 5651, 12512, 8461, 32791, 11961, 20483, 12484, 28771, 16439, 32804, 9491, 28807, 11165,
+    10504, 28701, 28683, 5963, 16608, 11404, 16715, 9859, 10208, 12882, 8667, 10797, 17202, 16845, 9163, 32851,
+    28782, 12428, 28801, 12636, 12346, 9885, 12427, 28783, 12996, 12412, 32915, 9985, 28820, 12062, 12503, 10810,
+    17207, 11454, 8405, 5834, 32893, 11873, 28678, 12983, 13192, 8397, 28676, 9620, 12535, 10196, 28721, 12731,
+    16682, 32932, 10533, 17302, 6404, 12358, 28689, 16727, 17016, 12540, 4975, 20485, 12414, 6439, 13209, 8777,
+    11652, 17220, 11024, 28767, 32828, 10871, 12900, 5829, 12571, 32878, 9900, 12444, 17094, 10174, 28812, 28828,
+    11369, 13068, 28700, 11059, 11093, 32924, 32846, 32777, 4349, 11414, 12957, 8723, 28807, 9169, 10881, 13103,
+    16734, 9974, 32807, 5888, 12357, 13020, 9534, 4283, 10823, 28682, 12312, 12803, 32851, 4891, 12753, 12358,
+    12791, 13173, 16773, 12836, 9664, 6328, 8666, 9984, 12847, 12679, 28740, 9083, 28695, 11904, 9677, 12984,
+    28723, 28756, 16755, 28751, 32793, 12732, 9366, 11173, 12791, 12535, 9685, 9564, 12419, 28780, 13111, 9211,
+    17332, 16595, 32807, 6199, 16506, 6445, 28817, 9021, 10876, 12510, 12960, 9610, 20482, 17332, 12524, 12333,
+    13068, 17072, 13074, 28684, 16540, 10481, 12946, 32896, 28743, 28770, 28782, 12585, 28758, 4307, 9367, 32866,
+    16765, 32846, 12646, 28792, 11369, 28756, 16807, 8752, 5275, 11170, 12648, 28683, 12581, 28676, 11720, 12717,
+    5835, 5047, 9294, 32818, 11769, 5557, 28683, 12981, 32798, 28709, 28825, 16473, 28720, 9600, 12643, 13066,
+    13054, 20486, 12864, 32870, 16606, 12308, 10776, 10743, 12598, 9020, 4505, 28681, 10079, 12859, 16697, 12635,
+    17162, 32864, 28696, 28818, 12727, 5106, 11596, 28772, 32840, 17013, 12934, 12597, 13197, 17391, 28810, 12335,
+    32882, 13126, 28804, 12984, 28702, 28772, 8524, 28713, 4698, 17220, 8424, 28814, 12888, 12647, 32800, 9712,
+    16620, 11541, 32859, 16981, 28713, 10826, 12862, 4716, 32818, 11574, 32921, 17228, 11175, 28819, 32825, 28707,
+    16666, 12983, 32818, 32868, 13197, 28793, 4467, 28828, 28677, 12756, 16594, 6323, 28765, 28763, 13124, 28776,
+    11984, 32922, 11651, 9971, 32871, 28684, 17083, 16608, 28799, 12583, 28792, 13099, 11114, 9675, 11748, 10254,
+    28800, 12600, 28780, 8470, 12739, 16621, 28757, 28825, 28732, 9593, 12670, 11460, 20482, 13089, 8460, 9376,
+    12874, 10517, 12657, 9828, 28824, 10815, 10806, 28784, 12766, 12596, 13124, 12493, 16855, 32906, 9702, 32788,
+    28698, 8440, 16887, 17160, 28741, 28714, 12631, 8480, 28708, 10280, 28716, 12765, 17055, 28692, 16845, 32884,
+    5044, 11304, 5446, 9446, 5562, 12724, 13224, 12873, 28696, 8704, 4689, 16458, 11481, 13133, 16598, 11773,
+    10815, 10714, 12456, 13090, 4950, 12468, 12079, 8201, 28681, 12339, 17172, 17253, 5063, 16608, 9700, 12971,
+    32794, 28780, 17179, 32907, 13092, 6009, 6338, 16463, 12598, 12822, 32898, 32910, 32817, 8648, 32794, 28684,
+    28824, 32897, 9984, 5560, 12729, 9853, 13092, 13114, 8368, 10816, 10507, 12995, 5133, 4716, 12658, 32855,
+    28800, 32781, 5843, 28799, 16825, 16682, 12739, 32793, 13037, 28790, 16767, 28826, 9084, 28719, 12953, 6161,
+    28773, 11735, 16985, 32928, 5339, 10552, 17000, 32815, 9975, 28818, 20486, 28768, 12536, 10748, 28743, 6044,
+    12323, 13059, 17173, 12657, 12972, 12696, 12838, 16688, 10284, 12672, 10944, 9636, 28754, 28733, 16936, 16815,
+    17133, 17354, 32802, 8553, 17409, 28702, 16673, 9686, 10789, 32842, 5991, 11747, 13188, 10458, 16540, 12694,
+    32805, 4996, 6022, 28695, 12527, 17132, 4941, 10795, 9302, 6009, 16620, 16609, 17319, 11611, 12655, 11960,
+    32935, 12779, 28701, 17003, 12967, 16609, 12720, 9986, 11258, 9021, 4889, 11156, 32814, 32891, 11403, 32827,
+    11115, 12972, 20487, 32858, 28723, 32922, 11286, 11945, 12680, 10431, 12795, 10273, 32936, 32802, 4225, 11170,
+    12840, 12403, 28684, 28706, 8713, 16714, 16570, 10516, 8414, 12012, 5809, 13091, 9077, 12924, 12720, 12754,
+    11611, 32848, 17301, 9044, 10806, 28796, 32820, 32859, 32884, 32878, 12442, 12573, 28783, 20489, 32858, 28688,
+    16713, 11047, 9348, 12883, 12658, 8723, 20483, 28783, 28718, 12792, 5146, 12671, 6321, 12768, 12576, 10721,
+    9562, 17095, 28694, 9986, 12851, 12768, 8397, 11261, 13115, 17260, 6330, 9562, 13163, 13030, 17252, 12862,
+    28795, 11104, 32934, 5335, 13224, 12454, 6118, 11114, 8779, 28816, 16406, 12923, 10693, 9264, 17299, 13175,
+    32792, 13113, 12751, 12849, 16791, 12765, 11310, 12863, 28729, 16411, 16762, 12786, 32936, 28824, 17173, 5355,
+    8667, 11273, 12729, 28694, 16971, 13052, 12526, 6229, 32819, 11690, 12960, 16519, 16657, 12659, 12371, 16413,
+    9077, 28820, 28789, 11991, 32924, 12790, 16698, 12636, 9248, 28679, 32806, 10770, 28715, 12838, 4438, 28690,
+    13031, 9058, 28775, 11341, 12368, 13019, 12946, 28789, 12741, 17339, 32932, 11323, 12859, 12822, 28708, 28817,
+    28817, 28802, 12636, 11779, 28735, 12718, 16518, 13042, 17411, 28785, 8491, 8712, 12599, 8752, 11648, 16686,
+    28682, 12396, 28681, 28823, 13114, 8905, 4728, 32933, 12593, 5621, 28803, 28827, 9601, 28675, 9003, 17253,
+    11469, 16463, 28769, 11557, 12638, 16420, 6059, 12049, 13139, 17162, 4712, 17240, 12575, 20484, 28766, 12836,
+    20488, 12955, 10704, 32780, 5287, 11870, 9126, 13100, 11448, 28782, 12826, 9697, 13013, 16440, 28707, 32907,
+    12348, 12319, 12370, 28714, 5112, 28704, 28740, 9860, 28787, 10206, 8839, 32858, 12647, 17095, 10605, 12507,
+    12932, 12775, 12740, 12982, 13209, 28787, 32903, 12370, 8397, 17251, 16744, 11175, 4642, 28720, 13125, 11069,
+    12606, 5981, 12395, 6081, 16414, 32831, 32775, 4168, 12947, 17183, 32788, 17366, 12427, 28805, 28815, 28749,
+    12432, 11042, 9012, 28744, 32866, 13008, 11164, 16688, 12761, 12884, 12982, 28710, 16990, 13188, 5275, 28776,
+    28778, 12753, 9088, 28755, 28747, 6328, 28689, 17092, 12552, 8696, 8618, 10431, 12463, 8236, 12838, 28811,
+    16663, 4826, 17409, 28733, 16775, 12382, 11054, 9356, 12734, 12295, 28812, 13200, 17172, 9657, 16775, 12488,
+    9545, 13104, 6189, 12923, 10234, 17130, 17122, 9256, 28779, 12875, 12620, 28800, 8912, 10749, 12743, 11274,
+    9302, 11094, 9078, 13090, 11947, 9350, 12780, 28795, 28726, 12835, 28741, 12502, 12428, 8946, 28780, 5898,
+    11081, 9947, 10903, 12916, 8760, 32792, 13068, 28775, 16855, 28680, 20485, 28813, 8424, 11400, 8760, 28742,
+    16640, 12294, 28782, 32823, 28775, 11950, 20483, 6458, 4892, 28702, 5106, 12929, 8942, 32882, 10322, 13200,
+    5603, 16687, 4215, 12924, 6237, 32921, 5621, 12797, 16499, 12824, 12311, 28757, 4474, 28714, 12861, 12576,
+    9601, 16700, 32870, 28813, 9261, 28812, 12929, 28787, 17052, 32812, 32909, 16540, 6008, 16463, 28768, 12011,
+    28673, 6387, 16420, 32928, 12788, 8414, 17000, 32857, 28806, 10758, 12605, 4187, 12812, 12382, 32910, 12665,
+    28742, 28752, 11350, 6457, 10132, 9961, 13067, 32807, 6032, 28777, 13042, 28788, 8723, 32928, 32776, 8835,
+    12993, 12683, 9367, 13149, 12538, 17331, 28769, 32829, 4876, 28737, 13076, 8720, 28705, 11470, 11447, 11995,
+    8404, 9845, 9714, 32880, 17332, 12551, 4531, 10795, 17071, 28695, 12575, 28724, 12357, 12732, 12400, 9260,
+    16778, 12743, 12477, 16555, 12774, 13008, 11011, 11481, 11367, 12633, 9601, 12040, 17060, 11858, 13080, 10349,
+    16895, 28770, 13092, 10504, 12354, 12948, 10218, 12676, 28742, 13163, 13078, 11713, 8869, 12449, 8721, 12417,
+    6235, 16858, 28791, 12909, 5491, 12717, 20484, 12624, 10284, 6405, 16579, 32858, 12299, 17339, 28752, 13149,
+    8778, 12383, 28740, 17208, 12396, 28751, 28812, 10367, 12837, 28801, 8911, 5836, 16973, 12360, 12900, 32857,
+    11081, 5594, 28793, 28713, 6012, 13078, 6108, 9264, 12539, 10801, 28688, 12576, 28746, 32833, 32839, 12420,
+    13151, 28767, 16542, 28680, 11989, 12779, 13198, 10184, 16506, 9666, 17137, 8344, 8488, 28751, 17045, 28719,
+    11480, 11919, 28791, 13188, 28706, 9087, 28794, 13187, 32927, 12912, 10108, 13150, 28827, 13150, 28793, 12984,
+    12774, 32806, 5639, 13052, 16843, 28763, 12863, 28744, 13061, 28777, 28762, 12867, 11757, 17120, 10125, 11585,
+    10830, 12454, 6422, 17011, 32818, 12743, 28824, 8973, 12826, 28717, 6445, 9724, 13007, 12357, 12816, 10215,
+    10414, 12632, 12312, 28753, 32839, 12474, 13113, 12623, 9286, 28705, 12343, 9841, 8479, 12658, 32934, 13003,
+    11413, 8789, 4827, 12657, 28753, 10845, 16839, 9086, 32908, 17319, 9021, 12828, 8693, 16767, 28680, 12635,
+    28742, 12528, 32852, 12308, 10851, 16438, 32858, 12936, 28691, 12392, 9674, 12970, 12971, 28805, 32777, 9754,
+    11560, 10069, 6057, 12330, 12892, 13015, 28760, 12728, 12982, 17290, 9085, 16526, 16750, 28744, 10138, 12969,
+    11768, 10452, 13038, 13100, 11275, 32882, 32846, 4229, 12945, 28695, 4891, 17173, 12957, 8722, 12547, 12984,
+    28696, 8769, 28746, 12918, 32924, 12435, 11873, 12496, 28776, 12598, 12956, 16833, 12972, 28707, 16664, 11144,
+    17408, 13146, 9298, 28681, 11171, 17317, 4954, 16586, 9569, 11713, 9441, 13137, 12514, 28810, 32881, 13079,
+    12731, 28741, 13079, 17094, 12439, 10960, 12370, 12791, 12672, 13029, 12840, 17252, 12958, 28763, 8776, 10583,
+    32859, 9930, 8461, 10881, 20481, 28756, 12332, 11657, 11341, 9854, 32793, 12549, 32872, 28804, 8272, 12935,
+    28705, 16935, 28781, 11066, 12307, 32857, 10669, 28777, 12994, 32780, 17256, 13179, 17170, 12540, 28687, 17225,
+    12618, 32812, 6298, 32923, 9554, 9376, 20487, 12874, 28685, 28736, 12079, 17235, 13197, 9264, 12931, 16835,
+    28702, 9385, 28690, 13187, 11664, 12011, 16835, 28767, 12804, 13212, 9761, 9003, 12623, 11723, 28696, 12621,
+    4359, 11747, 28764, 32830, 17172, 9496, 28808, 16851, 9068, 12660, 17095, 5791, 28742, 9017, 8966, 28748,
+    16697, 6295, 12384, 28771, 12646, 11584, 8470, 28826, 28800, 13185, 28744, 8637, 12660, 13221, 28715, 16621,
+    13124, 12348, 11779, 8940, 32880, 16542, 16618, 17173, 9664, 32831, 6411, 28740, 12454, 28772, 28721, 28824,
+    13222, 28814, 12599, 28696, 10106, 16675, 16855, 12528, 28748, 13113, 9022, 5655, 12940, 28734, 5106, 5491,
+    9366, 11685, 12730, 12983, 9919, 16700, 12983, 10417, 20488, 9067, 12742, 9683, 8966, 5112, 32780, 5632,
+    17411, 12609, 6402, 28798, 16694, 9862, 28818, 17290, 8769, 12598, 12443, 10560, 28775, 12336, 9311, 5939,
+    17318, 12972, 12943, 28743, 12452, 12443, 10743, 12324, 28708, 11409, 16775, 28780, 16541, 17334, 17216, 12814,
+    13222, 20489, 12919, 28756, 20489, 13152, 9445, 6056, 13186, 28774, 12742, 16542, 12503, 12322, 11181, 13216,
+    28676, 5460, 13100, 28743, 6163, 8936, 5077, 10533, 12742, 13161, 11280, 32829, 13036, 13197, 17373, 11544,
+    5113, 12367, 10264, 28737, 12299, 4534, 10583, 17388, 32907, 12443, 8760, 28820, 9008, 32891, 12992, 28749,
+    12453, 12766, 12767, 12930, 12508, 12682, 32885, 13067, 17288, 9596, 28798, 28722, 28738, 28706, 5158, 32880,
+    10517, 32936, 16751, 6372, 20483, 12768, 28682, 8478, 17222, 28751, 13116, 5621, 17150, 10821, 11325, 13049,
+    8779, 12439, 6425, 12886, 12982, 6138, 12850, 32830, 9308, 9664, 4530, 10477, 28767, 9078, 12616, 12488,
+    11640, 10583, 11400, 28702, 28760, 10507, 11921, 28815, 28724, 12755, 11042, 28677, 32933, 28799, 16541, 11646,
+    32807, 6162, 32830, 32832, 28825, 12388, 32908, 12551, 32794, 16542, 11456, 4131, 28792, 9619, 6033, 6150,
+    12706, 13103, 28719, 16542, 12528, 11948, 12667, 16491, 17397, 8769, 28798, 20485, 17304, 12895, 13113, 12708,
+    12524, 12659, 12525, 28682, 10862, 32805, 11234, 20486, 12344, 10477, 28712, 32919, 32928, 9608, 12600, 8869,
+    13056, 6218, 12636, 12383, 16855, 11679, 12401, 12942, 12946, 32871, 32911, 12636, 10670, 12647, 32896, 12465,
+    13178, 16922, 10460, 32921, 8759, 9302, 5460, 12980, 13092, 13076, 28693, 13184, 32872, 12432, 16463, 5670,
+    12643, 17368, 12345, 13061, 17399, 5477, 28765, 13017, 13080, 16981, 13102, 17081, 12965, 8713, 12611, 28786,
+    28811, 28683, 13044, 32793, 12848, 12583, 4782, 13020, 28682, 13049, 28751, 8599, 17015, 28807, 32921, 13041,
+    17173, 28684, 28818, 17062, 16857, 10105, 11990, 28772, 28819, 12885, 8777, 9879, 11699, 12935, 9316, 10563,
+    28807, 8995, 12360, 12405, 12802, 12576, 28720, 12599, 9066, 16462, 12669, 12743, 32833, 28728, 32871, 11671,
+    28800, 12743, 28824, 28787, 9899, 13172, 28791, 13210, 12503, 32793, 12404, 16727, 12636, 5329, 12539, 28718,
+    28817, 11801, 28821, 10796, 12986, 11481, 11182, 28764, 28778, 28722, 28750, 13188, 8233, 12033, 11102, 11144,
+    10969, 8351, 28738, 12669, 13190, 12443, 8488, 11005, 28728, 28752, 8314, 12331, 4350, 32884, 8752, 12924,
+    28811, 12563, 5590, 10699, 28740, 10422, 13176, 10101, 28732, 12756, 12668, 11396, 10997, 28741, 17162, 17330,
+    11481, 5604, 16683, 9656, 12837, 8862, 28751, 11456, 16451, 32790, 20481, 32832, 13030, 12528, 9647, 13053,
+    17071, 28728, 28823, 28771, 16824, 9358, 16436, 17141, 28755, 28824, 11357, 28717, 17218, 13012, 12592, 17095,
+    12683, 10139, 16392, 17225, 12339, 12756, 28735, 9311, 16506, 16618, 13088, 16420, 13019, 12597, 28801, 10684,
+    11182, 10567, 12456, 28692, 9279, 16814, 8787, 12065, 10517, 9687, 8321, 12775, 13038, 8778, 13188, 28709,
+    17165, 8594, 8359, 9011, 11822, 12453, 8423, 13139, 6051, 20489, 9044, 28765, 12705, 12764, 32776, 4273,
+    11103, 9126, 12912, 9899, 6357, 12315, 12944, 13146, 12312, 20482, 12461, 32922, 28784, 28796, 28796, 28735,
+    9965, 13211, 13092, 28683, 12672, 10498, 4887, 17117, 28741, 8790, 16461, 28693, 28753, 12960, 32921, 8366,
+    12864, 28822, 13048, 12440, 28703, 4121, 28709, 6462, 28686, 4715, 28826, 12372, 17253, 32884, 13006, 8258,
+    32911, 11102, 32883, 32891, 11059, 6231, 8351, 12753, 12959, 32807, 6375, 10757, 13222, 28823, 28675, 12995,
+    12552, 12659, 13173, 32911, 28805, 12633, 5819, 16463, 6204, 6284, 32882, 9554, 28793, 28828, 12382, 32903,
+    17235, 20485, 12420, 17102, 17366, 12396, 32838, 10872, 32852, 6152, 32779, 10717, 28687, 9362, 12970, 12429,
+    10019, 12371, 28701, 11159, 11182, 12740, 16548, 12514, 9374, 16801, 28763, 17287, 16435, 12948, 12995, 8554,
+    28817, 20483, 32885, 28782, 8957, 12308, 10584, 12300, 11779, 11769, 9438, 12646, 6313, 13028, 12899, 28744,
+    11481, 28689, 8479, 28734, 12418, 13135, 32846, 10515, 32880, 12872, 28724, 16419, 32818, 12989, 11888, 32820,
+    10725, 13044, 10862, 12753, 32937, 16576, 8479, 13124, 28826, 32829, 32856, 12434, 13151, 12632, 13188, 11081,
+    11441, 28720, 12301, 11779, 11828, 4967, 32783, 12526, 9167, 12860, 16925, 16937, 12947, 12895, 28822, 17147,
+    8666, 10181, 17365, 5082, 12598, 28696, 12979, 12800, 32804, 17105, 11058, 9343, 16699, 16798, 13207, 12371,
+    28704, 10743, 28805, 9201, 11428, 12357, 11400, 11699, 16700, 12680, 28696, 13051, 12394, 12719, 28681, 10571,
+    6374, 12321, 17331, 10199, 28691, 12946, 28723, 12646, 20485, 9368, 11778, 12430, 28721, 12875, 28780, 12972,
+    12791, 17240, 10506, 6328, 20487, 13197, 12828, 28713, 12046, 16604, 28811, 12438, 10398, 10281, 16759, 12742,
+    12611, 12633, 28742, 28777, 12622, 8961, 28784, 10461, 28694, 32815, 13089, 12660, 12322, 12862, 28772, 11387,
+    12318, 28739, 12851, 11759, 11024, 12599, 16543, 12780, 5112, 13044, 32784, 28813, 28750, 32826, 11393, 16734,
+    17276, 10961, 5337, 16608, 12860, 28709, 9147, 8527, 13176, 12994, 11755, 5651, 13006, 10693, 32820, 11615,
+    12459, 28754, 9969, 12655, 9899, 32870, 13079, 12356, 4214, 13079, 12360, 17295, 10240, 16515, 17078, 10554,
+    12503, 16457, 16656, 16932, 13125, 11042, 13102, 12744, 12546, 11449, 17131, 6343, 17236, 13049, 28818, 13078,
+    32924, 10569, 10750, 13127, 6399, 17203, 16700, 12600, 12476, 16854, 12540, 32818, 32933, 16936, 12333, 16542,
+    17386, 12012, 13198, 17328, 5899, 13185, 13224, 11769, 17314, 5449, 17193, 17016, 32780, 11614, 11358, 12955,
+    20490, 12369, 12875, 12345, 12372, 17104, 32870, 28679, 13091, 12629, 28827, 12309, 11842, 17252, 12523, 8956,
+    10477, 11197, 11967, 12593, 16608, 28744, 12981, 16542, 32921, 17051, 28684, 13100, 13115, 8453, 8380, 28682,
+    8278, 12528, 32846, 12480, 12636, 28775, 12669, 9311, 32935, 9506, 12595, 16607, 12825, 11465, 28792, 9600,
+    8533, 32924, 16933, 9309, 12378, 12355, 32869, 12536, 28788, 11475, 28781, 8774, 16914, 12956, 12296, 11713,
+    28741, 16686, 11718, 17387, 16856, 17140, 9146, 12600, 8966, 10604, 8995, 5113, 28818, 9367, 17237, 12612,
+    32855, 8788, 13005, 12983, 10845, 16744, 28813, 16655, 12368, 20490, 12560, 12404, 5621, 9248, 5197, 28692,
+    13134, 8414, 10823, 6446, 32790, 16705, 28809, 32928, 28763, 5723, 9232, 32800, 12293, 17058, 9664, 13126,
+    32911, 5612, 16677, 28764, 32872, 16537, 4620, 32833, 6233, 12994, 12900, 32849, 28751, 10907, 28805, 28811,
+    12336, 16450, 32893, 16696, 28693, 8618, 28792, 4780, 8999, 6391, 12719, 32923, 8249, 11011, 10273, 11741,
+    12360, 12984, 17011, 11952, 17141, 28801, 28806, 12405, 11122, 28762, 28707, 6057, 12778, 6366, 16540, 12049,
+    32858, 12933, 32857, 28810, 6407, 17093, 17410, 32908, 11686, 28821, 10583, 9974, 12707, 9310, 28742, 17411,
+    11755, 12477, 8366, 13135, 16857, 20488, 28776, 6462, 11470, 32856, 13100, 12703, 11456, 32801, 12342, 9321,
+    8954, 12588, 8422, 28682, 16529, 11701, 28752, 11311, 11144, 28815, 28814, 9033, 12066, 9655, 28724, 9318,
+    13198, 9089, 28810, 9038, 6022, 12388, 11122, 8942, 8468, 13199, 17209, 8209, 28700, 16846, 6058, 8965,
+    16831, 17137, 12776, 13101, 17317, 11403, 8648, 28765, 13163, 17160, 32773, 4115, 12339, 17253, 17051, 11290,
+    17209, 10815, 4870, 28813, 8883, 12814, 8995, 16446, 12852, 10407, 16587, 12932, 16519, 13067, 12444, 13064,
+    16772, 12492, 13128, 10365, 17024, 10477, 8936, 13032, 32906, 16937, 13223, 10283, 8986, 17395, 11920, 12335,
+    12025, 9676, 8423, 32781, 6192, 12766, 16934, 8336, 11171, 12984, 6411, 13114, 17012, 16688, 28814, 16776,
+    6453, 28684, 11349, 16430, 11094, 32897, 9983, 32882, 20486, 13080, 13186, 9666, 13095, 32924, 11242, 11882,
+    8613, 12946, 13185, 12660, 17251, 12703, 28818, 13104, 32856, 16570, 9260, 12708, 28706, 28680, 10796, 17336,
+    28716, 13104, 12766, 13125, 17225, 12636, 32937, 12839, 32896, 28767, 9609, 32936, 13212, 12423, 28725, 12648,
+    28725, 16462, 9858, 16419, 6110, 13211, 32894, 9219, 12715, 9310, 16835, 8252, 32792, 12764, 9963, 32858,
+    8357, 10584, 11011, 11735, 17091, 32895, 12777, 11411, 11938, 9874, 28708, 10879, 28766, 12992, 28802, 32911,
+    13003, 12406, 13079, 10160, 12007, 28706, 12670, 28810, 12943, 8966, 8713, 12404, 32813, 28705, 5636, 11403,
+    28790, 6218, 12992, 16706, 10582, 4226, 13224, 11224, 28698, 12876, 28673, 9256, 28781, 28741, 28816, 28673,
+    16835, 12682, 6142, 12764, 13123, 32831, 10563, 12324, 12599, 11740, 28730, 16834, 32896, 13124, 28792, 12928,
+    28695, 12346, 12980, 28783, 17227, 5338, 13015, 9675, 11855, 12799, 11755, 10883, 12753, 32924, 12755, 32858,
+    28702, 28781, 9038, 28822, 5356, 28682, 8683, 9687, 10160, 11174, 12658, 9022, 28738, 11726, 10660, 28787,
+    12370, 28770, 12371, 10458, 28809, 8551, 28788, 28776, 32832, 12863, 28678, 28759, 12835, 11449, 12891, 17229,
+    13064, 9292, 16937, 12079, 5499, 16835, 28775, 12404, 13115, 28771, 12755, 12372, 32777, 4353, 12936, 5666,
+    10870, 8711, 12875, 12452, 12768, 12393, 28786, 20490, 10079, 17309, 28793, 28743, 9086, 16686, 16767, 10580,
+    12646, 12968, 12299, 10523, 28806, 11290, 16728, 13091, 28816, 32780, 11361, 17304, 10664, 12658, 20483, 17095,
+    9319, 12803, 12836, 28817, 32818, 11998, 16463, 17288, 9311, 12851, 13043, 32820, 9320, 32936, 17092, 28734,
+    28794, 28721, 32869, 12940, 16457, 12657, 9384, 12858, 9416, 13151, 11458, 17083, 12597, 28827, 16530, 32922,
+    17411, 12047, 32922, 12461, 16764, 11559, 12311, 28776, 5083, 4698, 5635, 9509, 28769, 12852, 12754, 11908,
+    28824, 12850, 12960, 28709, 13208, 8683, 28808, 12430, 10138, 11749, 28676, 11902, 13114, 12660, 11686, 17145,
+    28707, 13103, 12883, 12918, 8489, 9896, 16525, 12927, 8557, 28733, 9497, 12948, 4889, 13052, 32802, 12295,
+    11304, 13199, 28714, 12959, 11169, 16833, 12852, 32868, 28806, 13163, 11701, 12562, 11303, 11409, 12067, 17399,
+    28675, 11414, 28766, 12551, 12742, 28774, 17239, 12054, 12411, 28755, 11495, 28741, 12659, 8468, 13115, 28736,
+    10963, 11581, 12849, 9592, 8241, 12063, 13175, 32915, 16766, 11619, 12077, 17409, 32830, 32851, 28804, 9963,
+    4478, 28689, 11161, 11952, 8453, 16682, 12371, 9695, 32859, 12860, 12755, 12444, 12765, 12934, 9059, 17221,
+    28791, 12660, 11480, 12310, 32869, 11750, 11925, 11402, 32935, 32908, 12535, 28787, 9631, 28769, 9619, 28787,
+    12729, 28689, 5520, 16777, 11276, 4952, 11359, 9546, 8713, 10817, 11317, 28749, 28715, 28695, 32832, 9264,
+    12838, 10870, 20481, 17241, 20487, 28803, 13170, 13116, 28786, 9600, 16456, 12939, 20481, 10284, 17076, 13193,
+    32775, 4172, 16597, 32859, 16834, 13092, 13222, 5411, 12463, 10820, 9711, 32869, 9986, 11115, 12647, 10206,
+    28715, 12839, 12671, 10788, 11653, 16700, 32923, 9375, 13054, 32885, 4158, 12488, 32851, 11403, 10827, 8314,
+    12540, 12923, 12768, 10573, 28677, 10477, 17174, 28757, 28740, 12647, 9664, 28783, 16845, 17011, 11983, 9049,
+    28746, 12398, 11013, 12930, 9693, 13116, 8807, 9076, 12428, 12535, 32787, 9972, 8790, 9211, 6008, 28730,
+    28795, 8255, 12600, 28758, 12730, 10503, 5670, 28696, 11152, 13064, 17162, 17309, 13090, 11747, 13051, 10845,
+    28774, 10996, 11968, 20481, 13199, 12567, 32841, 6218, 12632, 32898, 8769, 10765, 12508, 11579, 32884, 12620,
+    11544, 9012, 12516, 12396, 16752, 10845, 13104, 9608, 32781, 9922, 13108, 12405, 8480, 13223, 20484, 12850,
+    16913, 12668, 11100, 6233, 4452, 11059, 5145, 28812, 12597, 12439, 12839, 11088, 32781, 11118, 12570, 9984,
+    16857, 28801, 12743, 9063, 28747, 8321, 8777, 11087, 12957, 11692, 9068, 16824, 28816, 28782, 28731, 28704,
+    6462, 11764, 11126, 12392, 13052, 17004, 17240, 8713, 13041, 12970, 16596, 28788, 6446, 12743, 8422, 17071,
+    28764, 9799, 9868, 32879, 32917, 32924, 17031, 12863, 32871, 28718, 28771, 10815, 13053, 12948, 28782, 20482,
+    13144, 13187, 16746, 10116, 11780, 28753, 17140, 11780, 28718, 16462, 12768, 8736, 12438, 11273, 32881, 10461,
+    11316, 10512, 16609, 11144, 32772, 4107, 28693, 11991, 32784, 28779, 13066, 28721, 10963, 5094, 9656, 12381,
+    12609, 28717, 28741, 11443, 17411, 32897, 10106, 17028, 13052, 12432, 16456, 17155, 28752, 13104, 28784, 17388,
+    28805, 4971, 12645, 10809, 16641, 28816, 13078, 12513, 11432, 32932, 28796, 32897, 12312, 16451, 28827, 12460,
+    28787, 12727, 16846, 12609, 16756, 13204, 8237, 13164, 8721, 32799, 8206, 28802, 28710, 8351, 12648, 6072,
+    13054, 28802, 16525, 13038, 9808, 16462, 12499, 13222, 13064, 12826, 13042, 28677, 9358, 28708, 5045, 8957,
+    13205, 12965, 13007, 11059, 28765, 8321, 28773, 12910, 16451, 12422, 10991, 28826, 32818, 5592, 17162, 20483,
+    11523, 16542, 28729, 10909, 10699, 16773, 9388, 13198, 32807, 11805, 12708, 17332, 12400, 16877, 11267, 10284,
+    12752, 32774, 4138, 12395, 5367, 32787, 9068, 5469, 28799, 5992, 28783, 12875, 9561, 12959, 12946, 12705,
+    28684, 16936, 10721, 10452, 16754, 12370, 28826, 12068, 16925, 11476, 6357, 8412, 16858, 28754, 9562, 12985,
+    28691, 12047, 9683, 32934, 12678, 28825, 28782, 11108, 9692, 6363, 12501, 11111, 12693, 28813, 9973, 6348,
+    12334, 17139, 28807, 8966, 16700, 4953, 11954, 13010, 11712, 32870, 32932, 13116, 28675, 17001, 16834, 12720,
+    28705, 5658, 12744, 28693, 8658, 11151, 8351, 12441, 32872, 32805, 17184, 8965, 13161, 11765, 16519, 13174,
+    12875, 32872, 16542, 17141, 12883, 8446, 8789, 5112, 10882, 28799, 12780, 17071, 12400, 13199, 13127, 28702,
+    13199, 16554, 13103, 17255, 13135, 32787, 9874, 16620, 28755, 13149, 13204, 8789, 28717, 28779, 16440, 12742,
+    12635, 16519, 17288, 10756, 13067, 9003, 13055, 13077, 28712, 12971, 12684, 17094, 28701, 9387, 9056, 8469,
+    12978, 32788, 32780, 5595, 12849, 10178, 11020, 32856, 28806, 32851, 32833, 32910, 10571, 9384, 28754, 11470,
+    12408, 9377, 32895, 12742, 13125, 9044, 11734, 17015, 9265, 11711, 11625, 6235, 28799, 13220, 12920, 10233,
+    28743, 32919, 9891, 11050, 5798, 9020, 12535, 12528, 28710, 12828, 28770, 12896, 10560, 6167, 11449, 11161,
+    13046, 28783, 13199, 12816, 12840, 12908, 12007, 12330, 28709, 10870, 8765, 28743, 28694, 16462, 10460, 11766,
+    12348, 5603, 20482, 28799, 28737, 12528, 17304, 28730, 8508, 5971, 11456, 8839, 32806, 10172, 4174, 12330,
+    10218, 5337, 11911, 28826, 12372, 8438, 12540, 8759, 28751, 28752, 10217, 12957, 17304, 12528, 17367, 12498,
+    13209, 8893, 28801, 12873, 11096, 32777, 4314, 17146, 16801, 8779, 9888, 28823, 28718, 16912, 8554, 11171,
+    12587, 28743, 28800, 12406, 13104, 8779, 9905, 28736, 9362, 28690, 17001, 32908, 8696, 16463, 28716, 9599,
+    17297, 28682, 13078, 12931, 12300, 8491, 17173, 10880, 28753, 16413, 32911, 16621, 32829, 8760, 12874, 28678,
+    9960, 9600, 28792, 12370, 28761, 17229, 9077, 6432, 28709, 28683, 28688, 8912, 28805, 28720, 11654, 16923,
+    17161, 5369, 10247, 9302, 13058, 9087, 20486, 32845, 32885, 12404, 32855, 17299, 28677, 28761, 12440, 32775,
+    4180, 8322, 17383, 13196, 12672, 16462, 10152, 32885, 16538, 12458, 5929, 10743, 6371, 6448, 16765, 13079,
+    17161, 28692, 9202, 20483, 32859, 6101, 9294, 17251, 28803, 10581, 20487, 12453, 6457, 4260, 13138, 28756,
+    11862, 32878, 11358, 16834, 13181, 12936, 12462, 13164, 16981, 32935, 12671, 12426, 32779, 4751, 12727, 9358,
+    12657, 8402, 11467, 12404, 12804, 28795, 17077, 12995, 16577, 16459, 12429, 28795, 12775, 10459, 28744, 28733,
+    12983, 28757, 17013, 11130, 16845, 8696, 10262, 12943, 16450, 6465, 10706, 4372, 28768, 5406, 12764, 17087,
+    28804, 12816, 9169, 28819, 28817, 17095, 12452, 9089, 17160, 12636, 32937, 9666, 9966, 11469, 28735, 20488,
+    28735, 32907, 32832, 16856, 28775, 16688, 28819, 4889, 11654, 8480, 12922, 8412, 28693, 9367, 13184, 11176,
+    9388, 16649, 17253, 10282, 12321, 12068, 10431, 13091, 32794, 28736, 16925, 28818, 16779, 13172, 12636, 11475,
+    8489, 10498, 28788, 4636, 8470, 11176, 28800, 28690, 6412, 10573, 28764, 28692, 12391, 28675, 12345, 17319,
+    13003, 5578, 13125, 12372, 12882, 12822, 9318, 6446, 12658, 10806, 17185, 12742, 28801, 28788, 12852, 13210,
+    17409, 12410, 28719, 12995, 12479, 9074, 28823, 12704, 20482, 6409, 28755, 28680, 8788, 8423, 32895, 17227,
+    13091, 32829, 28721, 11522, 12491, 28677, 8421, 12332, 8965, 12958, 28687, 11977, 12320, 28814, 11103, 6203,
+    28695, 12419, 17396, 32831, 8423, 12420, 16913, 11158, 10691, 5535, 9264, 28760, 28772, 17166, 12767, 17383,
+    13076, 28809, 11054, 17072, 6411, 10864, 9599, 10365, 11404, 16982, 5834, 12586, 32856, 12515, 11115, 32921,
+    32895, 12679, 13196, 13079, 12009, 9683, 28816, 5559, 9017, 10533, 12598, 6462, 32830, 13206, 12306, 16436,
+    10101, 17252, 11119, 12668, 13067, 16609, 5112, 10743, 32791, 20487, 9919, 12705, 32815, 20482, 13209, 12825,
+    6156, 28806, 12946, 28707, 4634, 12826, 6235, 6411, 13040, 13217, 32869, 9599, 12754, 16824, 12472, 9182,
+    28802, 32790, 28808, 12561, 12851, 8788, 12972, 8488, 12693, 12335, 8956, 32919, 17001, 28768, 28680, 12730,
+    12883, 12312, 32891, 11042, 28731, 6455, 5673, 17251, 32935, 4971, 12707, 12415, 32838, 28775, 13204, 12432,
+    4265, 10341, 28828, 5895, 16701, 32806, 11368, 28747, 32866, 16568, 16556, 28781, 12041, 9366, 8480, 28722,
+    11833, 11481, 4774, 28742, 12780, 28708, 32842, 12719, 17287, 11162, 4181, 32803, 8271, 28824, 11352, 13053,
+    12849, 12333, 16855, 12458, 4316, 16694, 8665, 12996, 12596, 28699, 12670, 28673, 10875, 12660, 28763, 10563,
+    8202, 9388, 28687, 28794, 12863, 12655, 12933, 12764, 17325, 12714, 28828, 11042, 28763, 32911, 20483, 12918,
+    28819, 16621, 32817, 12959, 12012, 10755, 17045, 16658, 13006, 28808, 11048, 11955, 11304, 9265, 32922, 16438,
+    5462, 16740, 28818, 13018, 28797, 4623, 28784, 12827, 16621, 10351, 12047, 17141, 9065, 28820, 32919, 32778,
+    8585, 12980, 12732, 13216, 13188, 12924, 20487, 9600, 11395, 13073, 12513, 11314, 12920, 12704, 12660, 12720,
+    28773, 11884, 11402, 28741, 28735, 16702, 12497, 13139, 32898, 28813, 12371, 28697, 11275, 11585, 12972, 17208,
+    8912, 16463, 16773, 13113, 11945, 32928, 16857, 9807, 11769, 12766, 12715, 16708, 28781, 6232, 32921, 17066,
+    12968, 16557, 12820, 12439, 12634, 10801, 28814, 12647, 12669, 28694, 16904, 12945, 10026, 9221, 28784, 28760,
+    11174, 12779, 16700, 12598, 11854, 12936, 12682, 28780, 12839, 12751, 12647, 32855, 11408, 13102, 12063, 12874,
+    4953, 28815, 28732, 12767, 11480, 12967, 12708, 17309, 10963, 17145, 11005, 12360, 28703, 12526, 28744, 4971,
+    28731, 12927, 32831, 12960, 13100, 9281, 12527, 16699, 12620, 10881, 28769, 13068, 5592, 13195, 17320, 17171,
+    28752, 28693, 28812, 12322, 16517, 28772, 28770, 32910, 10458, 13221, 13164, 12948, 12993, 10563, 6191, 12864,
+    28808, 11104, 5468, 10498, 11621, 28719, 28761, 12441, 12816, 13051, 4722, 32816, 8665, 8657, 28685, 16845,
+    12852, 9088, 16755, 5369, 32827, 13006, 12647, 13015, 32854, 32922, 17003, 11612, 4884, 12909, 11478, 28728,
+    13134, 10874, 9384, 11054, 11779, 12636, 32889, 28701, 11017, 28708, 28715, 28690, 28784, 16817, 10755, 16491,
+    28680, 13079, 16429, 9265, 12670, 12619, 6310, 32805, 4943, 12948, 12778, 13115, 8480, 28772, 12743, 13137,
+    28708, 12780, 16844, 12982, 12380, 12970, 28768, 28793, 28689, 10285, 12552, 13056, 5989, 9059, 17393, 32923,
+    28802, 9859, 20481, 32846, 28682, 32852, 16463, 12755, 17076, 28721, 16619, 6328, 12820, 12899, 10997, 28782,
+    9762, 16525, 12876, 9020, 9610, 12600, 12703, 28720, 13184, 20481, 12742, 12527, 32838, 11712, 32937, 13181,
+    12682, 12751, 9058, 28780, 12599, 13176, 9311, 12409, 12803, 28761, 8389, 32937, 32910, 28797, 5593, 28684,
+    10822, 8423, 12670, 28740, 12984, 12526, 20487, 28764, 28676, 8768, 12540, 12356, 9664, 10851, 5220, 12861,
+    10460, 28807, 6457, 5077, 28692, 11172, 9689, 10883, 12585, 11177, 12984, 8722, 12429, 10853, 28682, 28795,
+    28770, 12658, 10458, 5898, 12731, 13044, 8424, 32872, 12598, 6466, 12990, 13171, 28825, 16596, 12683, 32936,
+    11181, 9723, 5916, 11750, 28701, 8657, 9688, 12814, 11423, 16777, 28784, 32898, 8769, 10562, 9388, 32894,
+    12671, 13080, 12671, 12934, 13066, 16427, 28790, 32872, 28742, 28751, 13091, 17059, 13187, 9965, 32910, 12527,
+    17367, 5462, 12303, 32859, 28784, 9367, 9086, 12900, 17392, 8272, 16571, 8831, 12670, 11126, 28770, 8767,
+    10504, 10858, 12660, 12959, 16795, 28777, 32807, 11723, 12367, 10397, 12343, 10496, 28796, 5046, 12882, 12532,
+    16707, 6329, 6163, 13078, 11120, 4373, 12766, 28685, 12894, 9230, 13056, 5579, 5064, 12012, 9518, 8703,
+    12996, 11150, 12704, 28697, 28813, 28768, 9367, 11767, 12803, 11956, 28761, 28811, 11341, 12899, 11414, 32777,
+    10053, 11152, 28752, 12732, 9281, 12297, 9175, 20486, 5462, 28704, 32780, 5465, 28749, 12658, 12311, 12715,
+    28826, 28706, 12621, 28765, 17383, 16658, 12671, 12392, 10570, 17229, 8776, 28684, 10562, 32909, 16541, 6339,
+    32778, 8601, 12820, 12922, 12767, 16778, 28812, 4159, 11998, 13199, 10078, 12872, 28787, 12923, 16662, 28815,
+    13140, 28798, 12447, 12346, 9897, 32884, 8405, 8424, 28787, 16981, 16764, 28781, 12491, 28690, 17397, 13140,
+    12766, 9376, 12345, 12926, 32910, 17167, 28821, 11924, 16462, 32895, 16699, 16933, 32878, 17308, 12393, 12598,
+    32883, 12510, 17403, 11955, 13056, 28793, 11470, 16699, 9318, 5077, 28689, 8789, 4954, 12912, 28723, 12941,
+    28787, 5629, 28688, 8412, 16958, 12293, 12800, 13216, 12497, 32817, 12804, 32854, 5574, 11560, 28733, 28805,
+    12670, 12886, 28732, 10498, 12579, 8798, 12068, 17011, 17203, 28781, 4394, 10976, 28743, 12803, 10113, 11393,
+    12838, 12635, 12968, 12811, 6174, 28785, 16790, 11650, 32806, 11584, 8243, 11409, 28687, 28674, 16450, 28814,
+    20489, 20485, 28794, 28684, 12548, 28774, 32889, 32859, 28821, 10845, 10507, 9817, 11780, 28807, 10754, 17238,
+    16752, 12419, 9302, 28806, 32895, 28697, 4636, 20483, 16846, 28709, 13176, 8631, 17072, 28775, 12911, 12910,
+    20481, 28712, 12933, 12803, 28827, 10853, 8605, 12938, 20482, 12703, 28769, 5694, 16638, 8228, 12851, 16677,
+    28781, 16588, 12679, 32937, 12498, 12487, 28677, 28687, 28818, 13204, 9544, 10561, 12323, 32894, 32857, 9480,
+    13196, 17290, 32815, 11409, 32923, 28734, 12815, 12066, 11640, 12441, 32924, 17072, 28754, 11748, 8290, 8267,
+    32846, 28710, 17228, 16736, 12365, 32805, 4916, 12567, 11691, 28696, 28680, 10407, 28769, 9020, 20489, 5621,
+    13019, 28790, 28772, 16700, 28715, 11107, 13065, 13090, 12946, 13224, 13209, 16470, 17192, 12477, 5627, 11309,
+    17332, 28772, 28806, 12840, 10533, 17240, 17396, 32879, 28766, 12910, 20484, 11542, 16825, 9676, 9414, 28821,
+    28809, 28781, 8826, 12642, 9986, 17303, 11702, 10282, 9686, 28812, 16584, 12460, 12669, 10584, 12792, 16618,
+    13043, 28828, 12417, 4678, 12765, 12047, 12922, 12333, 11425, 11152, 13046, 8723, 11966, 4477, 11100, 17388,
+    12600, 16655, 10217, 32891, 12612, 32933, 17253, 4891, 12406, 32863, 8222, 8489, 12837, 10845, 9861, 16728,
+    28708, 9022, 10282, 28677, 13068, 12298, 9067, 28787, 8490, 17353, 12982, 4677, 5369, 11922, 28717, 9918,
+    28764, 28726, 9321, 8488, 16934, 9822, 12396, 6269, 12377, 17331, 16761, 12527, 28761, 16512, 28781, 12738,
+    11156, 28759, 20481, 17011, 17408, 28810, 28741, 12714, 12670, 20487, 28782, 32776, 4224, 28710, 28765, 32789,
+    17095, 12598, 17385, 5612, 28783, 16461, 9083, 16958, 28737, 12995, 4399, 12948, 10729, 16457, 8358, 12291,
+    28736, 20486, 16835, 16779, 12851, 12935, 32883, 12738, 16756, 4435, 12485, 8703, 28758, 28809, 11875, 17330,
+    28769, 17310, 12668, 9497, 10851, 28743, 8930, 4725, 28726, 10751, 9264, 28718, 28782, 12828, 13057, 9087,
+    12672, 12766, 6466, 9237, 28704, 20489, 10760, 12427, 12668, 28815, 5667, 12634, 8948, 9280, 17061, 8723,
+    12904, 11144, 28716, 8788, 12600, 28727, 8606, 5916, 16519, 10070, 13210, 10033, 28819, 28819, 28760, 4699,
+    11150, 6051, 16815, 9374, 6420, 5064, 28812, 13211, 8584, 9975, 13127, 10458, 28800, 28722, 10283, 12983,
+    5718, 16857, 12455, 12672, 32931, 4699, 10070, 10871, 28816, 8499, 32793, 12810, 6227, 9212, 6162, 12980,
+    28738, 32831, 12704, 11758, 5991, 4468, 11356, 13066, 11649, 9022, 28688, 9984, 28809, 16856, 12756, 13128,
+    11178, 13211, 9089, 8768, 12835, 28690, 12468, 11010, 10442, 10573, 12826, 9790, 9038, 12633, 5627, 28721,
+    11990, 28673, 9687, 10857, 12731, 12497, 32800, 16478, 11150, 10622, 32924, 11392, 13054, 11050, 28766, 12780,
+    28715, 28810, 12489, 12573, 28784, 8403, 32833, 28806, 28723, 6187, 32898, 12623, 9218, 32775, 4206, 11047,
+    11035, 13080, 28717, 28787, 9357, 28780, 6448, 11074, 16846, 28755, 32924, 5658, 13065, 16937, 11457, 28786,
+    32879, 12873, 8790, 12982, 16711, 28725, 13123, 12694, 12979, 9218, 28827, 12341, 13217, 11448, 16675, 12744,
+    17305, 13014, 28761, 12466, 28744, 9388, 6218, 12768, 12320, 11691, 32832, 11953, 16450, 17087, 13127, 8461,
+    28775, 17174, 12636, 16391, 20486, 12858, 12800, 8790, 28773, 9666, 32903, 28783, 12861, 32934, 20481, 16462,
+    32814, 20482, 12861, 10729, 32858, 11369, 8696, 28713, 12068, 10815, 6461, 12838, 28763, 28816, 16856, 16756,
+    5217, 17110, 13003, 12430, 32937, 12319, 12441, 17166, 16722, 10727, 10273, 12704, 32855, 5916, 10234, 10863,
+    28791, 28802, 12981, 28677, 17235, 28767, 13088, 28674, 32876, 12648, 10413, 10216, 12408, 9302, 13210, 10421,
+    11691, 9036, 8752, 12310, 17086, 32906, 32855, 9837, 12850, 13199, 16675, 9947, 32815, 28712, 28811, 8667,
+    32844, 32937, 12969, 5643, 12823, 20490, 8649, 28795, 8571, 32918, 5990, 5897, 11991, 12898, 12079, 12599,
+    16776, 9592, 5449, 12704, 9087, 12906, 13032, 10976, 5356, 28715, 5432, 28812, 5621, 8314, 10496, 9601,
+    8200, 11156, 32806, 16680, 28753, 32908, 11117, 32910, 17094, 32879, 28710, 10064, 9018, 12510, 28773, 32882,
+    28816, 17158, 28795, 28704, 12917, 32845, 5887, 11028, 17288, 10813, 12443, 12908, 12981, 11114, 9131, 12491,
+    4524, 11392, 8414, 13054, 17304, 5430, 28826, 28765, 13056, 12912, 28735, 12959, 28761, 11025, 10306, 9961,
+    8488, 28677, 4259, 32775, 8525, 13116, 13175, 10274, 8298, 5929, 9262, 28767, 20487, 28782, 32881, 32852,
+    16983, 12680, 10691, 5664, 16921, 10284, 12900, 11244, 11155, 32803, 8282, 13053, 28705, 10871, 12684, 11196,
+    32829, 16619, 5496, 5484, 28676, 17383, 28742, 17264, 12970, 11177, 28784, 17318, 12852, 28721, 11603, 4410,
+    9673, 16843, 9078, 11171, 10398, 32880, 4112, 32858, 17071, 12799, 16492, 13042, 17230, 12812, 5579, 16937,
+    32817, 20489, 16421, 9509, 28743, 32844, 28811, 17238, 13216, 6357, 10285, 11711, 9810, 16657, 28770, 12660,
+    10560, 28725, 4110, 32895, 8490, 28698, 12600, 12598, 28725, 16609, 9151, 9664, 28812, 5276, 11235, 4678,
+    8778, 9179, 28776, 5897, 8956, 10693, 32852, 10369, 11608, 32898, 11955, 8199, 12046, 9234, 5605, 13224,
+    17314, 10872, 16765, 28825, 32802, 4256, 16858, 28736, 28817, 6223, 12874, 11235, 28707, 12514, 9529, 16699,
+    12537, 12428, 28810, 12587, 32895, 12776, 17109, 12634, 28696, 12499, 9460, 8769, 17072, 10880, 12779, 13065,
+    12514, 17241, 12595, 12369, 8719, 16544, 8999, 16821, 17032, 32784, 9844, 12550, 28828, 28687, 32852, 12536,
+    11884, 12594, 12647, 12561, 28760, 28683, 9971, 9332, 13222, 28759, 6009, 10180, 16563, 9844, 12416, 12309,
+    10432, 5432, 28684, 28812, 12443, 17206, 12309, 32924, 32908, 16606, 12335, 16781, 28778, 20482, 12780, 10583,
+    32776, 8538, 28691, 13073, 16393, 16619, 28687, 9265, 28754, 6224, 32910, 20481, 28787, 28700, 12563, 16641,
+    12306, 12322, 8708, 28736, 32931, 9011, 11380, 10625, 11841, 17111, 10851, 32859, 13102, 11780, 13137, 12994,
+    28796, 28795, 20486, 16744, 12720, 28744, 20485, 28826, 28720, 28708, 32780, 10464, 28764, 28805, 12680, 32893,
+    13185, 9335, 9002, 32818, 28778, 6446, 32858, 12624, 28746, 13091, 10283, 17144, 20489, 10274, 12813, 28733,
+    12713, 5629, 12824, 10274, 32802, 16489, 12977, 6051, 28720, 13085, 17251, 12824, 28792, 11171, 13180, 12537,
+    32911, 10407, 8796, 8619, 13173, 32933, 32785, 16776, 32871, 28827, 9975, 13163, 12847, 16857, 28770, 12512,
+    16980, 28819, 28778, 13222, 12779, 12536, 4954, 28783, 28761, 9358, 6310, 4791, 5625, 12620, 12911, 12935,
+    12431, 16766, 4899, 20484, 20486, 8405, 12454, 9448, 12002, 16772, 20482, 12887, 9778, 6446, 17298, 28752,
+    12394, 9094, 10705, 12873, 28698, 17092, 16530, 28692, 17399, 6462, 20488, 28775, 11451, 28723, 8717, 32807,
+    11424, 28810, 16578, 4147, 11391, 11380, 5992, 9320, 9386, 6453, 13223, 16858, 10854, 28683, 13176, 28787,
+    12864, 12537, 28723, 12527, 28700, 12442, 28803, 8579, 17171, 5697, 12768, 12851, 28824, 9320, 16519, 11245,
+    10871, 16700, 17369, 12624, 12809, 12550, 28699, 12595, 12899, 16490, 17075, 17332, 6422, 12537, 11932, 32893,
+    12524, 28825, 13056, 12930, 12536, 28761, 12945, 32936, 9218, 16677, 11180, 28749, 32859, 16530, 17253, 13027,
+    28718, 4324, 9182, 8703, 28698, 28753, 28713, 12837, 10845, 13162, 12729, 13195, 28687, 28778, 28781, 4577,
+    11468, 12441, 16858, 17251, 5860, 10086, 28779, 12560, 28728, 10207, 8720, 9086, 28743, 12383, 12417, 12292,
+    28692, 32785, 12388, 28798, 16936, 17320, 13150, 32774, 4130, 17239, 12671, 12492, 6363, 6186, 28801, 10806,
+    9413, 12816, 12754, 13073, 12869, 32933, 12407, 20481, 9262, 28781, 13164, 12981, 32778, 8589, 12623, 12528,
+    12776, 12634, 28798, 16491, 32921, 12828, 28730, 28772, 28770, 12001, 12597, 12887, 28769, 28804, 11475, 16619,
+    12765, 9350, 13080, 11759, 8827, 13159, 5339, 9218, 11312, 6394, 17340, 4355, 16526, 12461, 11099, 12667,
+    10283, 16825, 17173, 16857, 28828, 17002, 12347, 13222, 12840, 8779, 8479, 12672, 12395, 13091, 32933, 16539,
+    12792, 11622, 10505, 8448, 12600, 28817, 12849, 16686, 28709, 32843, 8642, 9665, 28768, 9984, 28734, 12307,
+    11767, 8460, 17160, 12466, 28823, 28741, 13161, 6410, 32936, 11694, 28724, 8727, 32898, 9828, 28807, 28756,
+    32779, 10119, 10207, 32788, 13053, 5239, 12672, 8599, 32920, 28751, 4313, 13004, 12392, 32859, 13078, 12600,
+    12682, 9583, 28802, 28826, 32922, 32872, 20490, 16685, 12394, 12984, 10831, 9299, 8460, 13037, 11327, 12611,
+    16856, 32807, 6421, 9289, 28828, 11044, 16777, 28697, 13126, 16687, 12344, 12714, 9563, 12803, 12984, 5663,
+    11002, 12754, 12995, 9086, 9030, 8422, 12598, 10853, 32794, 32780, 8684, 28695, 12654, 11290, 16699, 28765,
+    12067, 16528, 32909, 8358, 10862, 28730, 28771, 16598, 32819, 8203, 12815, 12351, 32820, 6384, 28801, 12383,
+    12955, 32885, 28793, 32872, 11303, 16650, 8769, 12872, 17398, 20489, 32907, 12538, 12623, 11667, 10414, 11639,
+    16389, 13123, 12755, 12971, 12971, 11747, 9356, 8480, 28820, 10560, 9665, 10992, 28782, 12511, 12756, 12405,
+    28749, 17407, 17034, 10814, 9320, 28694, 16767, 17331, 16450, 28694, 32936, 16904, 11881, 11779, 12562, 28827,
+    11180, 28697, 12888, 8282, 12778, 32788, 28755, 17052, 12384, 12755, 28739, 9563, 12815, 13222, 11181, 17399,
+    13116, 32868, 8477, 9555, 17318, 9012, 10544, 12955, 32909, 16728, 11245, 32911, 16546, 12887, 17366, 12882,
+    12492, 5658, 17160, 13195, 4677, 10517, 8722, 10414, 9075, 12572, 13068, 11152, 5100, 10853, 17162, 32851,
+    12384, 32906, 12852, 12994, 12659, 12509, 12295, 28753, 10478, 10444, 9758, 16992, 13152, 28774, 16587, 16990,
+    9412, 13080, 12477, 9687, 20481, 28818, 16858, 28747, 16413, 6394, 28727, 9459, 12535, 12935, 32858, 32880,
+    12052, 12743, 9745, 13197, 9350, 12827, 9247, 4410, 12660, 32842, 10273, 28787, 32876, 12312, 5644, 32818,
+    12738, 12509, 8777, 16727, 11939, 12561, 10993, 5093, 5562, 32841, 10742, 4443, 28820, 28701, 12959, 10714,
+    12670, 12864, 28796, 10437, 8415, 12022, 28689, 13018, 17246, 28814, 12623, 11012, 32916, 28718, 9745, 12404,
+    9077, 9077, 9411, 32923, 8868, 13181, 13128, 28688, 12572, 12848, 10480, 9377, 28678, 11273, 12993, 8273,
+    12314, 9965, 11480, 16547, 28751, 13042, 9599, 32785, 5492, 12995, 12452, 16696, 12586, 5106, 12623, 17304,
+    4929, 28765, 12861, 32909, 12682, 12763, 4811, 16508, 28793, 28677, 12573, 8365, 17398, 28779, 11747, 28712,
+    12695, 28722, 13115, 28674, 8811, 9939, 6200, 32820, 11143, 17032, 8945, 28800, 8779, 6036, 10134, 12755,
+    16506, 6377, 28761, 12824, 5814, 11401, 28825, 5069, 12872, 32897, 17264, 16767, 16596, 12600, 9319, 4984,
+    12820, 12947, 10572, 28726, 13162, 11542, 12323, 17162, 28743, 9518, 6357, 10693, 28785, 11323, 12850, 9954,
+    12389, 12562, 10505, 17251, 12682, 11460, 28820, 11712, 16700, 10480, 9084, 11479, 13170, 9089, 17203, 6453,
+    28828, 10115, 12588, 10816, 28772, 28764, 17320, 5562, 16992, 10512, 28793, 12776, 28757, 10277, 9601, 13051,
+    12358, 32856, 11402, 8722, 9003, 11750, 16394, 12792, 12351, 12960, 11998, 28780, 28782, 13088, 16825, 9075,
+    16637, 32859, 17140, 11114, 28770, 13162, 10458, 28737, 9364, 28704, 17070, 28711, 16973, 12538, 16570, 8423,
+    13152, 13066, 28804, 8424, 17309, 6121, 10435, 11212, 11544, 32896, 5428, 13185, 16903, 10992, 32858, 10023,
+    12323, 28682, 17240, 13170, 6139, 17151, 17051, 28707, 32921, 17147, 11990, 28673, 13050, 16941, 9388, 12319,
+    12562, 12930, 10216, 17331, 13164, 28750, 17092, 8480, 28779, 8720, 10713, 12539, 16805, 28773, 28824, 17111,
+    12792, 32876, 28691, 17061, 9012, 32896, 28779, 10730, 28793, 8234, 10883, 13079, 32868, 32829, 17410, 10628,
+    17399, 12464, 28734, 12307, 11182, 5621, 28792, 17162, 32845, 28782, 12689, 32929, 6112, 11344, 11884, 12393,
+    16688, 28807, 9377, 28761, 13091, 32895, 11657, 28819, 28722, 12371, 10706, 9336, 32916, 16764, 4370, 12539,
+    8359, 5916, 32816, 13170, 11458, 9986, 12948, 11944, 9377, 12452, 10153, 16603, 13144, 28720, 17410, 28702,
+    13089, 28775, 16665, 8903, 16835, 12636, 8420, 28805, 12438, 17189, 11481, 6356, 9796, 12465, 5309, 11371,
+    28694, 17399, 6276, 9088, 8308, 12443, 17151, 28708, 17083, 12716, 28696, 10451, 12811, 11348, 5991, 32794,
+    13062, 28683, 12414, 28784, 32884, 12942, 16846, 13160, 17078, 28712, 13159, 16584, 32829, 17136, 8812, 12957,
+    11170, 32859, 16776, 11445, 4984, 17065, 28764, 13174, 16688, 28807, 13066, 5756, 12912, 28731, 13043, 16688,
+    28786, 11774, 13031, 10926, 28775, 8688, 28724, 12496, 28803, 28751, 16529, 8870, 28772, 32827, 28710, 9047,
+    17015, 13104, 13090, 28742, 5495, 11245, 28779, 32921, 9388, 16630, 28676, 13223, 12869, 13063, 12876, 12403,
+    32845, 16846, 12648, 13052, 12439, 11357, 28733, 32881, 17332, 12920, 17172, 9198, 8650, 12990, 12942, 28752,
+    28719, 5992, 17094, 12047, 9410, 13027, 32773, 4123, 9308, 17164, 32786, 16396, 12476, 28688, 16437, 12298,
+    9021, 12768, 17229, 9409, 28684, 28709, 11589, 8600, 9833, 12717, 10375, 28720, 9865, 13126, 28731, 12054,
+    13055, 28777, 28743, 13135, 17061, 32884, 28718, 9265, 12827, 17210, 6120, 32936, 11102, 12371, 28766, 12347,
+    28720, 8250, 12539, 16902, 5899, 28720, 12503, 8931, 28778, 11053, 6361, 16684, 28712, 28816, 8786, 9885,
+    5842, 16557, 12730, 9358, 12456, 11401, 17378, 28825, 28718, 12840, 12596, 28775, 16762, 5240, 12969, 17332,
+    13208, 28801, 12970, 28696, 8786, 28728, 12561, 12631, 9906, 28799, 11993, 32781, 6246, 32883, 11965, 12862,
+    5624, 28827, 32931, 32832, 28717, 9386, 5150, 12054, 28782, 12371, 12349, 12996, 9408, 32828, 32785, 12840,
+    8767, 17219, 20488, 12444, 28677, 32881, 8789, 9235, 13002, 20490, 12635, 9386, 8762, 6122, 32839, 10376,
+    12504, 28723, 20483, 28800, 17287, 28770, 11626, 12597, 11780, 28783, 12023, 17330, 28780, 28788, 28757, 32822,
+    13159, 10868, 16436, 28817, 8321, 12717, 28698, 16698, 28721, 12827, 11346, 8786, 13200, 16778, 28690, 8476,
+    5628, 12348, 9308, 17172, 32802, 4282, 28813, 17071, 10998, 13073, 12007, 17094, 13091, 4307, 6234, 28801,
+    9407, 28804, 32859, 13170, 16643, 28828, 28716, 12539, 6287, 12922, 12669, 9609, 12581, 10692, 28774, 17093,
+    12370, 9084, 20486, 28816, 28826, 28794, 17004, 28817, 12851, 28729, 8421, 10945, 16855, 8779, 10869, 17229,
+    16856, 11774, 32857, 12583, 32845, 12587, 9364, 28675, 11626, 10150, 10963, 17189, 8723, 9089, 10262, 28777,
+    28783, 8480, 11560, 28780, 12803, 17410, 28751, 5462, 10814, 12825, 13092, 12660, 12073, 13211, 17154, 9068,
+    12705, 28680, 17330, 12886, 12527, 17071, 9854, 28827, 11352, 12741, 12718, 16856, 13079, 8799, 28723, 17316,
+    28792, 32786, 10806, 16936, 8636, 28828, 13091, 11944, 11470, 10579, 13125, 28817, 12899, 12717, 10255, 28731,
+    16666, 8312, 16992, 17003, 6166, 13174, 28753, 32936, 5752, 12383, 28814, 20488, 10377, 8897, 8957, 17211,
+    9861, 12468, 28754, 28802, 8723, 12875, 16958, 11750, 12295, 12552, 16973, 28680, 13160, 12353, 28784, 10219,
+    13062, 12716, 12397, 28761, 28765, 10805, 11622, 11626, 28763, 32883, 5190, 32787, 11779, 12299, 12514, 12969,
+    20486, 28717, 8477, 12442, 16756, 28728, 12720, 5043, 32937, 10108, 17320, 8964, 32878, 12508, 9814, 28723,
+    12021, 9663, 9021, 28683, 13211, 28728, 28813, 12668, 28728, 12302, 28752, 9854, 17090, 6399, 13066, 12756,
+    12996, 17411, 5878, 32869, 32819, 12724, 32856, 28722, 4636, 17150, 9740, 6167, 28720, 32794, 28788, 10801,
+    12706, 8966, 17250, 16778, 9022, 28770, 9555, 12597, 28803, 9320, 9090, 6328, 28754, 28686, 28777, 17016,
+    12954, 12430, 17226, 12766, 4699, 28770, 12715, 12597, 28770, 16830, 12810, 11721, 13079, 4846, 8723, 28750,
+    13066, 11745, 11735, 28700, 4699, 28763, 28746, 11005, 32779, 4766, 11115, 28716, 12895, 11358, 28788, 28781,
+    12919, 10880, 9682, 8778, 8949, 28751, 5592, 8779, 16597, 17159, 12007, 28731, 10536, 12897, 12766, 28787,
+    28769, 12756, 11665, 11671, 28712, 12396, 6448, 28752, 11470, 8810, 12816, 9497, 32911, 32787, 6217, 12536,
+    32932, 9657, 8794, 16846, 28760, 16778, 12958, 12546, 12479, 12876, 5093, 12764, 32812, 9672, 8785, 6394,
+    28742, 10514, 13028, 10583, 6342, 32787, 13111, 9375, 6464, 17407, 10713, 32936, 28704, 11757, 32935, 13068,
+    12078, 4994, 16887, 17155, 32933, 11860, 12667, 10546, 17081, 16834, 28714, 10809, 13209, 28776, 28751, 17319,
+    12946, 12618, 32895, 17174, 32856, 16541, 17010, 20486, 28766, 12967, 28808, 10883, 13135, 28699, 16756, 28685,
+    11947, 28781, 10812, 28807, 9349, 12909, 12742, 12611, 9405, 4569, 32878, 28762, 9985, 32820, 28762, 12756,
+    11859, 10868, 32824, 9899, 12715, 12012, 12635, 28700, 10844, 12293, 17003, 11358, 12899, 32884, 16923, 8995,
+    28781, 10539, 5362, 9673, 17138, 13032, 13205, 17070, 12634, 28773, 28712, 28806, 13101, 28790, 9518, 32894,
+    12691, 11180, 28780, 32793, 28708, 32898, 20481, 6138, 32876, 13126, 12670, 11998, 20486, 5921, 11544, 32885,
+    32903, 13183, 11645, 9091, 13162, 12513, 28686, 16844, 32827, 16937, 12588, 6051, 12454, 10881, 28825, 12431,
+    20490, 17252, 12684, 8778, 16835, 28703, 11938, 13062, 12876, 8467, 12403, 12933, 10062, 8800, 28681, 8845,
+    28694, 32786, 12609, 13197, 11921, 12948, 9986, 12752, 9045, 12537, 11943, 11932, 32794, 10806, 28760, 9404,
+    28761, 17094, 12431, 28745, 12872, 17409, 9311, 28736, 28688, 28797, 16463, 12526, 12079, 5929, 12822, 28719,
+    13173, 8981, 16687, 13157, 16777, 28790, 28826, 12599, 12811, 9388, 11081, 6200, 6204, 28801, 32781, 10520,
+    32909, 13210, 16699, 28723, 9301, 10434, 9058, 17220, 12791, 28797, 12796, 17229, 11026, 12054, 28805, 12732,
+    13148, 28719, 13103, 10573, 13055, 6298, 17013, 12395, 12840, 28794, 9555, 8658, 17083, 12918, 10284, 4917,
+    9488, 6356, 32897, 32856, 32885, 13195, 17399, 28724, 17374, 12359, 11304, 10213, 32774, 4154, 17111, 10178,
+    13187, 11180, 17086, 12320, 32871, 28704, 12835, 28673, 20490, 28794, 28784, 17140, 11860, 32907, 28817, 12011,
+    12537, 16934, 12670, 8696, 5285, 6087, 12707, 28686, 9917, 13104, 28817, 32897, 9891, 13027, 28708, 28808,
+    28678, 17160, 11860, 10816, 12946, 28684, 32872, 12348, 17366, 16457, 32816, 16519, 13128, 32843, 10536, 28735,
+    10282, 16765, 32891, 11645, 28818, 12319, 28724, 6298, 12348, 16550, 9988, 28784, 28795, 32786, 32910, 5578,
+    12840, 11347, 32916, 12774, 28771, 12450, 28783, 28682, 13188, 8490, 28816, 5106, 11311, 28817, 10815, 16420,
+    20487, 17397, 16994, 16735, 13140, 16933, 10155, 12900, 32934, 32853, 9620, 6220, 12335, 17014, 12959, 8489,
+    10271, 17267, 9386, 12471, 28709, 32773, 8502, 12634, 11712, 12874, 28731, 28676, 28677, 8272, 11759, 9870,
+    9905, 28779, 12000, 12329, 13199, 28681, 28738, 12704, 12684, 12924, 13140, 28773, 32911, 17059, 12828, 10459,
+    32910, 28791, 12048, 12776, 13104, 17203, 13223, 12495, 32910, 16903, 20489, 32819, 12825, 28772, 8776, 6394,
+    12414, 12958, 12453, 5640, 12715, 12715, 6298, 32831, 9618, 28767, 28800, 11310, 17281, 12886, 20487, 28720,
+    16722, 12960, 32830, 10845, 28718, 28695, 9388, 17369, 32891, 17220, 13104, 32875, 12924, 10413, 28717, 11691,
+    32821, 13020, 5929, 17085, 32829, 16981, 16558, 11395, 5497, 11459, 13163, 28718, 28748, 11443, 28808, 13217,
+    32815, 10552, 11910, 9377, 32842, 32879, 13220, 12382, 11341, 16564, 12311, 17307, 12702, 28814, 28768, 5474,
+    8571, 28678, 28735, 6122, 28795, 10561, 28809, 10706, 12319, 12453, 12740, 17145, 4387, 12932, 32928, 12454,
+    17220, 28759, 9375, 12926, 32869, 11088, 28816, 8803, 11379, 32807, 5824, 32786, 12780, 8776, 8768, 12599,
+    10816, 17138, 16418, 12333, 28758, 13103, 28735, 11713, 12996, 17068, 12933, 20490, 5621, 8445, 10405, 13078,
+    16685, 12765, 12825, 28724, 17015, 11297, 28774, 17240, 8899, 12811, 28820, 17059, 28800, 12476, 12454, 11366,
+    32859, 5590, 10795, 12863, 16699, 9367, 12631, 32872, 11839, 32929, 28799, 5093, 12628, 28766, 11567, 11169,
+    12876, 4459, 13221, 9115, 16594, 13126, 10217, 11153, 12369, 16535, 12416, 11355, 12357, 32891, 10689, 28790,
+    5579, 28702, 16913, 6454, 10569, 8720, 16699, 12755, 13040, 16910, 6380, 28789, 4594, 12693, 9681, 5491,
+    12798, 17159, 13113, 9010, 17367, 16403, 8554, 32831, 28784, 10192, 20486, 9618, 9320, 28708, 6358, 9703,
+    28802, 11769, 12840, 28802, 16857, 8410, 28781, 12937, 12297, 12453, 17076, 17299, 9320, 16508, 28769, 9321,
+    11543, 28698, 10872, 13019, 17162, 12714, 9610, 12068, 28775, 28772, 12732, 12851, 28777, 12859, 28695, 11561,
+    28802, 28727, 10497, 32872, 16621, 9088, 32894, 28720, 28823, 28816, 28699, 8722, 12691, 16472, 10115, 17138,
+    16457, 17050, 32910, 12414, 12438, 13221, 11585, 11304, 6223, 32812, 10929, 32828, 12492, 28772, 12353, 4971,
+    10897, 9239, 17241, 17072, 11114, 13125, 12647, 12996, 17383, 32778, 4541, 28708, 17171, 16931, 4699, 28752,
+    32859, 12561, 12767, 17267, 11179, 28811, 28717, 28675, 16734, 32854, 9861, 12670, 4364, 9219, 32885, 12396,
+    20483, 28786, 28699, 11428, 17016, 32786, 6425, 32779, 4845, 17228, 11451, 11953, 5046, 11469, 28706, 28828,
+    32859, 28767, 12970, 12994, 12502, 16835, 28791, 10252, 12077, 20485, 6401, 8666, 28791, 28792, 11100, 13090,
+    28718, 5523, 11052, 16597, 12996, 16966, 13077, 4468, 32908, 5592, 12739, 17399, 12802, 13055, 32833, 12921,
+    11048, 10009, 28793, 28779, 9956, 5166, 6228, 9197, 16506, 11779, 12874, 10356, 8790, 12920, 17397, 28722,
+    11081, 12996, 20481, 28747, 16413, 11010, 12012, 12703, 11954, 12963, 28723, 13027, 28678, 6232, 9741, 32776,
+    4262, 28717, 11886, 12492, 10098, 28746, 9727, 28784, 16621, 28824, 28782, 9059, 4993, 13115, 12490, 28686,
+    10283, 13175, 6410, 9388, 28767, 11304, 17157, 12971, 10998, 28701, 9592, 16577, 12888, 6015, 10812, 12766,
+    12432, 28825, 28689, 5644, 28822, 13066, 13210, 28691, 12672, 10407, 6343, 12969, 12516, 32839, 16773, 9022,
+    5674, 5621, 9114, 11346, 6411, 12442, 5318, 28682, 17331, 9066, 17170, 12933, 17014, 28723, 9113, 11414,
+    10281, 10648, 11779, 11414, 17367, 13175, 13038, 11448, 6009, 9956, 17305, 32884, 8870, 17189, 28824, 10537,
+    11296, 32858, 13049, 12957, 4513, 12441, 28786, 28686, 32885, 28743, 32929, 28748, 32903, 28755, 12708, 9068,
+    11710, 12358, 11713, 9233, 9657, 32881, 28705, 16814, 12395, 16695, 13169, 11356, 11355, 28813, 32807, 9929,
+    13127, 32933, 12048, 10399, 32772, 16624, 12292, 16851, 9750, 20483, 12526, 5789, 6380, 28709, 5091, 8503,
+    10832, 12731, 8254, 28763, 17410, 13067, 12653, 5709, 8600, 28825, 8920, 28708, 10789, 9474, 10153, 9376,
+    28746, 11887, 16744, 12767, 5099, 11924, 16618, 12466, 9319, 28724, 13211, 12744, 12768, 9899, 8814, 11372,
+    12384, 11725, 28712, 12984, 12669, 16551, 12012, 10872, 28710, 12623, 8657, 12610, 11938, 28778, 8920, 17208,
+    13207, 16858, 8384, 28732, 9077, 16903, 12624, 12751, 16844, 28751, 13054, 12715, 17093, 12642, 28741, 10580,
+    12347, 9112, 8618, 32931, 17174, 10798, 28762, 11170, 12660, 12516, 12515, 12526, 12814, 11111, 17409, 12912,
+    12859, 12528, 12324, 12875, 10370, 32884, 12347, 9358, 20489, 10873, 17397, 28725, 17173, 9248, 5265, 16479,
+    12057, 28781, 12996, 13101, 12359, 12792, 9956, 9891, 16958, 13188, 12740, 16924, 32878, 12912, 28776, 12671,
+    10878, 28744, 12432, 17013, 11131, 11268, 13006, 16463, 12909, 32858, 12749, 16518, 16983, 12596, 32937, 13182,
+    28797, 8759, 28703, 8397, 8637, 28752, 32885, 13210, 28729, 28741, 10647, 28732, 12681, 32937, 16753, 12943,
+    17290, 13200, 28732, 16856, 12452, 17091, 11589, 12996, 12672, 17331, 28784, 17173, 16884, 13164, 17061, 12379,
+    12814, 11640, 12670, 12407, 12023, 11859, 5626, 11345, 12672, 12067, 4636, 12672, 5276, 11058, 10514, 12811,
+    8366, 12579, 16856, 12874, 12408, 28775, 12304, 12621, 28699, 28697, 28676, 13102, 16835, 28768, 8655, 28826,
+    32807, 11883, 13101, 8985, 13198, 11170, 13127, 28786, 16959, 11410, 4122, 8877, 12419, 28686, 8772, 32790,
+    17235, 13164, 28695, 32923, 28762, 28813, 13030, 17157, 28743, 11843, 12510, 17095, 16846, 28727, 12418, 10812,
+    12822, 16688, 8723, 17308, 12348, 17383, 12936, 13200, 13199, 11387, 10648, 28754, 28807, 11708, 12444, 12707,
+    16858, 10774, 32804, 4555, 12336, 16400, 8790, 16806, 10451, 28754, 11925, 8424, 28694, 32871, 10946, 10751,
+    13128, 28787, 8277, 10535, 12958, 28688, 17317, 8609, 16552, 12617, 16761, 32785, 11303, 10583, 5161, 32807,
+    17342, 28706, 9415, 9255, 13159, 32910, 8879, 13210, 13127, 5929, 17095, 12600, 10399, 5862, 12827, 12508,
+    11308, 28735, 17016, 17206, 8477, 20486, 28762, 12319, 6181, 17068, 32903, 16598, 28738, 17070, 12835, 28796,
+    4156, 28744, 11182, 28803, 28710, 9014, 32786, 11470, 12624, 10072, 12884, 16685, 9740, 17387, 28760, 17149,
+    11654, 32777, 8556, 8478, 17268, 28773, 28757, 11699, 12691, 13067, 16834, 12995, 12888, 10463, 20484, 12947,
+    28788, 9468, 16508, 13038, 12537, 17174, 16816, 10670, 16754, 8765, 28803, 32910, 28694, 12921, 10947, 12419,
+    11603, 10274, 28781, 8487, 28681, 12385, 13128, 28754, 10414, 32786, 28756, 17320, 12791, 6314, 13220, 9068,
+    16923, 28712, 13200, 12868, 28708, 32795, 4108, 28720, 12407, 32784, 11144, 32935, 13062, 8979, 17003, 8720,
+    28779, 12799, 16438, 16656, 12429, 12863, 5620, 12336, 9367, 8489, 17211, 12922, 12960, 12381, 13188, 12456,
+    32923, 13089, 20483, 11750, 28734, 12983, 28727, 12659, 12599, 17059, 5625, 20482, 20487, 13136, 32845, 28763,
+    10805, 28710, 12881, 5340, 12811, 8404, 9320, 12858, 20488, 28703, 16825, 12669, 11780, 28823, 10882, 11029,
+    12359, 28720, 11379, 16729, 32917, 11144, 6225, 17369, 6411, 16595, 13027, 12452, 11832, 12540, 17080, 10283,
+    5204, 32910, 6122, 12994, 11369, 12581, 28745, 28744, 12935, 12657, 28822, 9676, 32838, 13101, 16517, 28743,
+    8250, 12732, 12343, 11910, 28779, 12775, 16530, 12884, 8405, 13184, 8899, 32911, 28807, 28784, 12479, 6465,
+    12564, 13038, 12347, 16500, 28824, 6448, 28699, 28815, 17299, 17015, 12359, 28697, 28807, 12717, 11603, 28807,
+    10507, 32798, 16625, 28673, 11984, 9657, 6218, 11087, 28811, 28813, 11991, 10597, 17016, 28753, 4125, 28784,
+    32929, 28698, 17227, 5250, 12539, 12741, 32929, 9502, 12335, 28760, 32820, 32806, 5551, 28819, 28753, 10431,
+    13124, 11540, 11355, 16779, 8517, 16492, 17141, 28815, 20490, 12756, 16429, 11843, 9451, 12432, 16607, 12873,
+    13032, 10044, 4153, 17343, 8410, 11769, 12959, 16492, 28740, 11595, 12936, 11328, 13224, 16778, 13139, 10369,
+    10307, 12587, 32833, 16735, 28709, 12571, 12316, 8617, 13078, 6363, 13152, 12981, 17309, 28783, 12606, 6326,
+    12324, 9089, 12768, 13089, 12680, 10719, 28733, 28803, 12596, 6038, 11469, 32803, 8581, 13196, 9601, 12497,
+    32830, 9562, 16615, 8786, 10283, 10646, 4781, 32882, 28808, 6232, 12323, 13211, 28769, 12648, 32921, 12548,
+    17032, 16958, 13170, 6296, 12963, 13090, 6394, 16931, 28825, 11780, 16699, 32852, 6218, 12515, 28768, 12678,
+    17240, 8467, 12417, 28754, 17013, 32833, 11703, 12720, 17266, 32911, 9386, 16483, 20484, 13092, 11907, 12837,
+    12381, 8667, 12528, 28701, 4585, 28737, 8424, 28790, 12416, 13219, 9890, 12403, 28826, 12984, 17217, 16745,
+    13186, 12586, 16830, 12540, 28727, 28794, 8349, 10218, 12346, 6426, 32922, 16684, 4716, 12732, 12948, 12684,
+    16636, 4700, 5478, 8635, 12392, 12600, 12484, 9010, 16856, 6364, 9375, 13037, 13198, 28772, 11448, 9729,
+    28711, 28697, 8759, 12360, 28795, 6181, 32802, 8240, 12669, 16937, 12600, 17378, 28744, 28793, 16904, 9022,
+    11481, 12932, 10285, 12427, 6187, 16621, 32895, 6051, 12717, 10945, 16992, 12930, 28801, 32816, 9301, 17226,
+    17151, 13029, 28741, 17228, 10992, 17061, 28795, 13137, 12740, 12672, 10514, 20487, 28742, 11296, 12743, 16663,
+    13222, 11969, 12848, 12774, 12024, 28740, 5788, 12633, 11993, 28767, 5991, 20485, 9919, 28701, 32842, 8642,
+    13185, 8779, 12504, 12922, 13145, 11402, 12768, 28812, 8393, 6009, 12406, 17071, 12983, 28783, 13198, 12442,
+    12958, 16618, 11389, 17157, 28771, 10812, 17083, 17159, 32922, 12576, 12767, 13056, 13224, 10569, 20484, 13056,
+    11693, 16767, 8205, 12804, 28710, 11181, 12574, 28765, 9377, 16983, 12041, 9986, 12416, 9666, 13028, 28731,
+    9248, 12576, 16570, 5561, 8815, 12508, 8964, 12520, 10759, 17314, 12768, 9952, 28784, 32847, 32910, 5273,
+    28725, 12523, 5579, 32778, 4476, 11414, 28795, 12984, 12839, 9151, 11749, 17061, 10243, 12324, 12765, 12942,
+    32870, 8723, 12439, 6181, 16440, 11734, 9675, 10730, 17410, 17140, 17367, 32909, 10878, 12768, 28717, 32884,
+    12432, 6380, 10844, 28711, 28761, 28806, 16474, 16499, 12429, 28800, 16413, 17108, 12382, 9752, 16728, 6357,
+    12428, 8584, 11312, 16908, 28820, 32937, 11999, 5166, 12899, 12843, 11075, 12399, 13051, 6411, 28815, 28674,
+    13222, 16663, 13176, 28680, 8883, 13043, 12679, 8650, 12753, 11607, 12550, 11429, 11688, 16974, 6173, 12440,
+    32898, 13185, 28699, 13073, 12588, 12441, 9321, 12991, 12668, 28717, 13128, 16959, 9554, 12909, 28674, 32824,
+    11769, 9333, 9618, 20483, 9282, 32815, 13147, 16479, 9795, 4634, 11179, 28769, 12295, 4151, 9256, 28775,
+    32911, 12049, 13162, 32855, 16755, 13008, 28770, 16492, 10394, 16746, 10264, 12634, 6035, 17229, 28708, 28824,
+    12395, 9456, 12720, 28750, 28782, 12970, 12755, 28679, 16462, 32858, 8779, 28689, 28692, 13125, 32924, 8874,
+    28811, 28734, 32916, 12827, 12946, 32829, 32932, 12947, 12755, 12407, 16767, 9563, 12988, 6423, 12860, 12899,
+    13042, 32828, 32793, 16858, 12863, 11168, 12539, 9219, 5889, 10797, 6440, 28778, 9617, 28680, 17395, 13017,
+    12323, 9954, 17411, 5069, 13186, 12390, 5645, 12731, 12762, 6225, 32775, 8529, 32921, 16672, 12370, 11574,
+    12332, 11243, 9087, 16440, 11710, 13197, 32934, 28711, 9564, 12528, 12647, 8604, 12764, 28750, 28677, 13185,
+    16457, 9837, 6462, 12717, 9796, 28799, 11327, 28718, 12379, 5658, 8341, 28734, 8722, 6139, 32833, 11057,
+    4869, 12551, 9154, 12801, 16540, 28686, 12516, 16700, 16608, 10281, 32841, 13018, 12983, 17264, 11931, 11029,
+    28791, 28813, 12539, 12715, 20489, 16742, 10273, 28799, 13055, 8759, 12599, 9255, 28723, 16606, 28753, 32856,
+    13004, 32781, 5722, 16856, 20485, 17398, 12838, 8404, 32903, 28804, 20490, 12538, 12564, 9388, 32895, 9376,
+    28820, 12871, 16616, 11640, 28684, 13217, 17072, 11748, 10318, 17388, 17246, 12753, 16922, 11096, 20490, 28764,
+    12672, 28781, 9068, 28706, 4149, 6222, 32772, 4111, 16686, 12634, 32784, 12599, 4529, 9478, 12562, 16755,
+    28714, 32922, 12861, 28748, 9262, 28813, 9230, 13080, 5338, 13198, 28677, 32781, 5854, 8515, 32879, 12837,
+    28756, 32880, 32872, 13197, 10161, 16835, 16437, 28788, 32803, 10609, 13162, 32781, 11787, 28736, 11475, 12002,
+    16816, 28811, 17188, 12948, 13002, 9309, 12539, 28769, 28827, 17160, 4148, 32872, 12420, 13172, 13161, 12646,
+    6399, 12610, 28746, 16461, 17411, 28814, 28807, 12811, 32793, 12381, 12540, 11764, 8920, 32923, 9263, 12656,
+    13208, 17229, 20489, 11768, 12046, 12360, 10553, 16594, 5084, 12563, 8790, 12000, 12041, 4145, 16966, 5449,
+    32885, 12414, 28802, 13079, 17408, 17253, 32859, 10678, 12444, 17013, 9576, 28819, 28772, 32865, 9601, 12540,
+    8250, 9357, 10758, 17253, 28804, 17398, 28820, 13211, 12310, 17319, 28827, 9311, 17399, 11015, 6185, 32933,
+    12934, 11444, 32871, 32897, 9999, 16734, 5361, 17089, 17246, 32778, 4533, 17091, 28780, 10138, 28790, 10676,
+    12462, 13088, 12564, 12948, 28693, 12012, 12635, 28685, 9980, 6059, 12408, 9111, 17210, 10908, 11774, 16728,
+    12945, 9734, 12371, 28756, 12876, 11755, 9088, 28757, 10879, 5607, 13139, 11013, 11603, 8721, 12583, 12656,
+    28691, 10872, 10804, 12971, 6168, 28780, 13221, 12960, 9616, 9665, 8779, 17068, 10115, 12420, 16966, 28720,
+    12428, 28760, 5478, 12752, 12333, 16937, 32775, 4176, 4966, 12828, 12672, 6440, 11144, 28688, 28820, 13078,
+    16537, 9371, 12299, 32779, 11278, 28820, 12540, 12526, 11709, 5608, 28797, 17252, 11711, 6297, 16676, 12983,
+    16459, 12972, 32827, 28755, 16856, 16530, 16858, 32832, 28754, 8685, 12984, 11556, 8787, 28740, 32924, 12680,
+    9109, 28676, 13056, 12405, 28790, 12487, 13209, 10461, 6361, 12564, 16776, 28788, 32791, 28743, 16835, 6453,
+    13040, 5640, 28813, 32884, 8666, 12896, 5274, 8658, 10415, 16541, 11065, 12616, 28771, 17083, 11779, 28792,
+    32911, 9869, 12380, 5628, 11946, 10477, 12808, 16616, 9517, 28774, 12539, 10451, 10115, 28785, 32898, 28770,
+    11843, 28760, 6422, 9319, 13193, 12816, 20490, 13221, 28785, 12852, 12648, 32781, 8746, 20489, 16700, 28784,
+    12682, 28724, 20486, 12912, 8789, 9674, 8813, 28749, 13139, 9365, 32787, 28720, 12074, 16710, 12703, 12983,
+    9387, 9301, 17148, 12714, 17264, 12347, 32934, 28732, 12645, 13212, 12931, 10767, 12067, 28738, 12802, 16427,
+    16620, 17072, 17360, 28744, 13074, 9011, 8477, 9608, 13076, 10670, 12401, 28740, 28713, 10348, 12875, 12433,
+    12935, 16834, 13043, 32787, 12948, 17398, 32896, 12488, 13103, 9310, 6286, 17161, 28760, 16709, 12852, 12346,
+    5463, 28732, 12951, 17083, 20481, 28724, 11873, 13176, 16643, 28714, 8815, 4674, 28682, 13223, 13114, 4888,
+    12753, 11115, 16395, 28737, 28710, 6051, 5630, 16529, 12920, 9609, 9181, 10329, 28821, 28741, 12667, 28756,
+    4279, 28763, 10454, 28686, 9554, 13209, 12605, 10711, 32929, 32882, 12300, 17000, 28803, 28707, 13116, 12658,
+    28828, 28716, 28766, 12776, 32801, 9998, 28812, 8674, 12011, 28795, 12838, 11476, 11167, 10698, 32870, 28817,
+    28698, 16735, 17328, 16779, 5724, 8982, 28778, 9801, 28713, 12775, 12992, 13182, 28782, 9018, 28681, 13223,
+    28715, 17079, 9733, 10396, 12646, 17151, 16616, 13223, 12624, 9086, 32935, 17296, 12671, 28741, 11480, 17298,
+    16973, 5574, 11780, 12741, 28792, 8285, 11358, 9464, 16825, 10280, 12551, 13040, 4869, 28712, 32781, 6025,
+    16903, 16598, 16695, 8788, 12583, 32884, 12078, 9106, 28717, 12741, 16903, 6457, 32918, 28725, 32858, 10365,
+    9791, 16844, 10458, 13205, 11373, 28807, 9347, 12027, 9254, 5491, 12955, 28813, 16882, 17015, 13008, 10498,
+    9516, 5712, 16924, 32801, 12484, 9618, 28718, 28806, 28766, 12887, 28704, 28806, 11990, 28710, 28806, 12958,
+    32824, 11057, 11341, 10452, 17160, 12728, 32813, 11779, 12715, 28778, 28717, 16420, 4633, 9088, 10742, 28744,
+    16609, 12427, 11908, 12689, 28720, 9767, 13218, 17398, 28799, 8321, 12946, 17393, 9374, 11466, 12972, 12753,
+    9051, 11468, 12550, 16463, 12864, 32825, 9466, 28681, 16778, 8314, 8424, 12426, 32845, 10429, 32787, 6457,
+    6134, 13073, 32872, 16755, 32884, 13056, 9008, 28812, 8367, 32805, 10126, 12312, 28743, 5756, 16700, 11939,
+    10457, 11339, 12504, 28780, 12946, 9256, 12468, 16593, 12680, 28764, 32870, 4932, 28753, 12924, 12980, 12935,
+    28680, 28689, 16656, 8272, 17014, 6232, 11412, 9842, 32921, 28712, 12054, 12981, 9827, 8413, 28806, 12444,
+    13127, 13160, 12620, 28692, 12576, 28718, 13176, 6210, 28690, 13152, 12695, 28808, 9553, 28727, 9350, 17360,
+    12538, 32936, 5047, 11780, 10515, 10491, 10861, 13089, 28801, 12861, 10072, 11670, 12811, 12907, 13152, 13171,
+    6315, 5057, 11041, 9366, 12864, 17157, 28798, 8664, 32819, 20486, 28711, 32911, 28673, 10812, 4472, 6408,
+    28826, 12827, 9867, 28696, 9088, 10832, 12815, 16816, 9088, 28757, 28742, 16621, 9011, 12560, 9255, 28802,
+    8424, 16777, 12622, 17241, 28821, 4873, 10207, 12924, 20488, 32923, 9624, 20486, 16834, 28719, 28724, 13183,
+    32844, 16929, 5521, 16558, 13100, 12850, 12538, 6067, 28719, 12861, 12912, 13181, 13221, 5460, 16903, 28762,
+    28824, 9687, 16595, 8468, 28781, 5833, 28718, 13208, 12538, 32885, 16508, 28766, 32809, 9994, 8506, 12861,
+    8964, 8769, 32918, 9265, 28818, 10496, 12414, 28738, 10992, 9860, 9656, 9235, 12966, 10539, 17210, 28789,
+    9684, 9089, 17226, 32806, 9574, 28783, 28798, 6440, 28734, 13065, 28743, 28691, 28673, 12932, 13008, 12984,
+    28704, 9219, 16776, 28803, 10804, 32845, 12425, 16993, 17375, 12910, 28735, 16621, 12047, 11170, 32854, 32816,
+    28694, 11111, 12623, 6328, 28732, 8513, 28684, 12068, 11931, 17241, 12648, 32828, 12693, 16399, 9265, 16923,
+    10584, 32852, 28822, 12971, 28732, 10496, 12837, 10274, 12596, 9665, 8414, 12695, 9636, 11576, 10582, 32910,
+    32894, 12800, 32789, 13195, 12682, 10647, 12768, 16619, 12041, 12850, 28675, 5362, 12461, 28811, 13115, 16704,
+    12372, 6014, 12563, 10495, 5619, 32787, 12307, 12047, 8479, 28708, 12787, 11042, 12372, 28789, 12811, 6119,
+    28722, 28746, 10378, 9762, 9388, 4636, 12729, 10459, 10878, 11702, 16763, 28682, 32909, 16620, 4352, 20483,
+    17150, 4315, 10240, 11954, 6204, 12894, 28751, 28778, 12933, 16858, 6349, 17045, 32822, 4253, 5814, 16742,
+    28686, 28711, 28809, 12456, 28771, 5339, 13147, 11999, 32809, 28745, 20482, 13089, 16553, 28815, 12624, 32810,
+    32891, 28794, 17325, 16655, 5348, 28763, 12323, 13125, 10757, 16618, 8702, 32936, 32931, 28681, 12706, 12429,
+    12983, 12891, 16895, 16762, 28677, 10669, 28796, 28794, 28716, 16585, 9555, 13128, 12900, 12635, 12372, 12912,
+    28757, 20485, 9863, 13051, 5620, 13091, 13078, 12886, 20485, 10946, 8521, 9010, 11413, 12776, 28810, 13044,
+    28812, 32929, 28825, 12413, 28705, 28758, 17174, 13185, 12764, 28813, 32829, 32929, 10537, 5666, 11180, 32909,
+    9077, 16700, 12633, 13056, 28707, 9365, 10162, 12960, 9618, 28792, 28705, 32843, 12684, 20486, 12648, 12503,
+    10751, 8621, 5081, 16856, 16458, 13019, 17261, 28775, 28827, 17308, 10871, 28790, 9898, 32929, 9617, 17081,
+    11426, 32814, 13079, 9863, 32911, 11401, 32905, 10216, 11170, 28807, 28739, 32924, 12461, 10832, 28707, 11355,
+    13175, 8935, 32858, 8239, 12912, 12921, 16542, 32934, 8722, 8313, 28750, 32924, 8779, 12533, 5179, 28706,
+    6411, 28686, 12802, 13026, 28805, 16615, 6028, 12822, 12026, 17376, 12729, 13185, 28784, 9388, 8722, 28807,
+    12406, 11074, 13211, 10505, 28674, 12634, 12390, 13063, 12431, 8212, 32841, 11470, 4192, 28813, 9610, 12780,
+    12558, 28724, 28817, 11657, 16636, 12551, 32858, 28736, 5444, 9124, 16569, 32937, 13032, 28814, 8487, 11657,
+    12550, 28694, 6234, 11257, 12079, 28779, 17119, 16694, 32769, 4099, 12311, 10240, 32776, 4228, 13115, 9317,
+    12443, 12407, 12744, 13209, 10803, 16446, 12320, 9683, 12549, 9127, 11477, 28720, 13217, 13212, 11170, 17240,
+    9098, 12665, 28789, 28686, 8478, 12837, 12635, 6343, 28821, 12379, 32884, 6314, 13050, 28802, 12564, 13185,
+    16665, 11728, 28809, 12539, 12779, 20481, 10803, 9076, 11942, 17089, 17220, 28737, 12719, 28823, 10444, 12827,
+    32931, 32844, 17399, 28711, 13018, 16777, 9609, 8788, 32770, 8492, 28817, 32891, 10860, 16937, 16583, 12864,
+    5272, 12995, 6153, 10757, 28761, 10514, 32832, 12792, 13128, 11027, 12299, 28794, 12534, 5641, 28703, 10514,
+    8955, 20486, 11657, 8789, 28787, 12768, 17189, 12895, 32859, 11009, 28796, 13198, 13067, 32936, 11926, 10742,
+    28777, 28817, 16699, 12538, 5573, 12648, 17229, 13043, 28820, 32841, 12958, 28783, 32804, 8296, 17157, 6376,
+    11611, 28786, 6003, 10747, 11144, 5925, 13044, 13098, 17157, 32872, 17217, 12811, 12428, 32898, 28735, 9563,
+    32844, 12754, 16621, 11902, 32780, 10763, 13055, 12388, 16698, 10553, 11075, 10247, 32774, 8507, 17138, 32770,
+    16464, 12586, 12079, 13197, 13223, 12884, 17068, 12073, 12571, 28710, 17157, 6411, 13140, 8344, 8277, 8957,
+    32852, 28764, 10812, 28716, 11310, 12391, 13182, 12917, 28739, 12063, 17405, 4248, 12822, 16700, 28803, 16519,
+    17169, 20481, 16421, 12400, 13080, 10208, 12623, 28697, 10869, 4305, 28718, 32882, 32896, 6401, 32792, 32904,
+    9453, 11712, 9427, 32880, 13087, 28694, 17174, 28703, 12978, 13037, 12875, 8870, 28785, 9021, 10883, 12705,
+    28723, 11341, 20481, 11041, 32898, 5109, 17374, 12688, 12885, 12696, 13223, 32807, 11966, 9337, 11644, 12992,
+    16525, 12453, 17343, 12465, 28765, 17383, 28720, 10216, 16593, 11340, 32909, 32872, 13221, 5832, 16698, 28751,
+    9564, 17268, 8568, 16917, 28767, 12792, 10489, 10459, 28681, 28767, 13114, 28703, 17095, 32777, 10595, 28770,
+    11096, 12812, 20488, 12299, 32810, 12300, 16474, 20483, 12846, 16983, 12388, 12959, 16477, 12792, 11387, 32774,
+    16475, 12537, 28811, 12429, 28826, 11114, 10216, 28747, 10924, 12074, 13194, 8491, 16846, 16429, 8510, 12610,
+    32891, 12468, 16530, 10669, 6234, 12980, 16398, 9571, 16779, 12968, 4509, 28718, 6152, 17158, 20488, 9916,
+    11387, 32781, 10819, 12611, 12941, 28711, 12917, 17196, 12078, 11993, 28750, 17082, 5476, 12936, 28699, 12432,
+    13223, 28688, 4297, 10400, 6235, 32813, 12774, 32832, 12369, 6059, 5460, 12929, 12422, 28720, 32934, 20484,
+    16858, 12432, 11656, 12334, 17409, 12478, 8787, 12848, 9174, 20488, 11689, 11105, 32871, 12563, 28701, 13224,
+    5490, 17393, 12838, 11999, 10813, 12755, 9356, 12001, 16721, 12518, 17010, 6151, 8880, 32796, 32772, 8496,
+    28820, 28681, 16608, 32929, 12681, 11528, 17000, 9687, 28793, 28730, 28700, 12857, 5666, 28710, 28761, 8702,
+    4348, 12898, 28723, 10490, 12587, 13222, 28680, 32777, 4360, 12873, 12516, 10677, 10844, 32898, 9019, 9377,
+    28757, 11866, 16688, 12875, 5024, 16830, 32816, 10968, 8566, 8573, 11689, 28687, 5836, 5579, 9593, 8211,
+    28811, 28815, 16820, 11778, 28688, 28681, 28732, 16854, 16508, 12851, 13011, 10530, 10460, 32884, 11855, 17161,
+    11676, 16776, 28712, 12840, 12310, 12912, 11341, 17361, 10227, 32865, 28818, 28825, 8597, 10562, 10559, 6216,
+    16834, 12357, 12802, 32859, 20490, 17308, 16618, 28680, 32820, 16857, 9088, 13175, 32898, 16846, 8704, 16541,
+    32876, 4535, 12900, 11953, 32791, 9943, 12000, 9591, 28827, 8414, 9927, 10676, 12681, 17240, 12992, 12658,
+    8795, 12648, 12307, 32797, 32785, 11931, 12528, 28726, 8375, 12407, 12875, 10284, 28690, 32820, 12669, 8423,
+    5992, 9321, 16607, 28793, 16476, 12492, 32908, 17043, 8854, 32853, 12721, 32922, 12635, 20486, 17296, 10976,
+    11143, 12407, 13211, 32911, 12888, 5969, 28720, 12593, 9767, 28804, 12566, 13054, 28770, 16979, 12810, 11380,
+    10335, 28714, 32923, 9172, 4405, 16681, 8759, 8621, 28707, 28826, 28820, 9086, 9357, 28810, 16828, 6217,
+    28712, 28721, 28754, 5816, 13054, 12474, 10264, 28810, 28826, 32787, 12540, 28719, 32827, 8210, 12456, 16767,
+    6255, 28711, 9529, 6222, 12540, 11786, 28763, 28772, 12600, 10882, 12904, 12731, 32885, 9234, 12910, 28743,
+    16616, 6455, 10215, 12895, 32936, 10845, 12540, 28685, 12557, 17015, 12972, 28789, 12956, 28711, 9066, 11480,
+    12910, 16835, 32830, 12754, 13055, 5623, 10437, 12454, 12899, 28819, 17217, 9209, 12380, 28701, 17388, 16846,
+    11466, 32922, 28784, 10403, 28827, 6022, 16856, 28730, 13104, 12564, 6117, 11003, 28694, 28804, 12047, 28740,
+    17157, 28823, 4976, 6222, 17332, 4132, 13067, 16667, 12295, 10285, 11480, 16778, 12706, 13077, 8777, 28785,
+    12078, 28815, 12347, 17002, 12491, 9516, 16449, 12682, 12333, 6209, 12935, 28761, 16397, 10553, 28771, 28754,
+    12482, 11727, 28828, 11709, 9486, 13162, 9376, 12849, 20487, 6440, 13089, 32823, 4587, 11709, 11180, 16934,
+    28711, 13111, 12684, 28675, 17320, 32840, 16649, 6234, 32819, 13134, 32832, 11686, 28819, 13223, 28682, 11672,
+    12749, 12503, 6355, 9584, 32859, 10208, 12918, 32889, 16924, 11144, 12887, 10797, 20486, 28713, 32816, 12634,
+    12359, 28745, 28721, 12837, 28721, 12335, 28743, 12707, 28744, 28698, 13200, 32804, 8291, 5730, 12371, 12514,
+    28715, 10812, 9620, 12824, 10450, 28723, 12480, 6408, 12548, 12329, 28757, 32771, 4103, 17057, 16765, 32910,
+    12528, 12947, 28827, 16528, 13208, 17375, 10150, 13113, 16855, 12777, 17172, 12984, 9844, 17218, 13004, 11446,
+    12825, 12803, 13090, 12612, 12298, 9903, 28802, 8854, 11386, 8488, 32859, 12765, 9388, 4558, 12947, 9968,
+    9985, 5077, 28783, 9854, 28720, 11433, 11387, 17320, 28736, 28769, 17066, 16587, 28813, 32924, 12647, 8208,
+    12648, 20482, 6356, 28817, 4984, 32869, 9564, 32779, 4838, 28693, 6466, 9006, 32872, 5432, 12969, 28744,
+    28790, 28818, 12490, 28808, 4129, 28696, 10515, 8916, 12536, 9518, 11640, 6402, 5005, 28760, 13100, 32801,
+    16640, 13005, 12379, 17143, 6226, 12002, 8739, 9403, 12666, 28732, 13068, 12459, 12653, 32876, 32889, 12430,
+    6024, 13042, 8235, 13079, 28723, 11111, 12646, 16589, 16744, 16795, 32934, 32792, 28796, 28819, 5226, 16699,
+    11780, 12364, 6356, 6454, 12041, 10282, 11644, 12936, 28769, 17235, 9209, 16779, 28722, 17241, 28824, 9037,
+    32806, 11517, 12539, 12768, 11451, 28808, 6361, 17282, 8864, 17309, 11925, 9616, 10976, 28708, 13211, 12981,
+    9386, 12624, 8320, 12408, 32831, 13066, 12756, 4785, 16509, 32806, 5141, 28812, 6348, 10992, 12408, 12516,
+    28717, 11971, 12549, 12636, 6218, 32804, 4501, 32794, 9078, 17282, 28730, 32792, 17360, 13061, 28771, 13037,
+    12959, 13221, 9397, 16412, 16672, 28688, 16451, 32921, 28761, 5562, 16746, 32824, 16855, 11338, 13163, 13103,
+    28711, 6134, 16542, 4906, 16505, 20486, 11686, 32820, 11198, 28677, 12384, 28814, 28819, 9383, 11088, 11956,
+    11564, 12820, 17074, 12633, 12523, 17241, 13044, 13128, 16542, 10369, 12852, 12660, 9020, 28785, 32777, 4455,
+    12658, 28765, 13088, 13008, 11646, 13005, 12583, 12876, 12972, 28731, 12645, 12948, 12730, 17398, 17237, 28784,
+    28731, 11639, 12537, 12776, 11713, 12376, 9246, 16413, 28718, 10946, 12707, 6174, 13196, 17225, 28806, 16519,
+    32780, 5181, 32916, 12688, 16500, 28684, 12501, 28717, 5077, 11843, 17032, 17010, 28808, 28782, 32923, 12996,
+    28742, 28699, 20489, 10580, 5369, 28691, 8390, 11128, 8487, 11481, 32832, 16776, 12440, 8424, 10433, 28779,
+    13050, 4891, 17296, 32910, 11429, 32792, 16642, 16913, 10101, 28724, 28775, 12668, 16961, 12732, 8816, 11640,
+    13067, 28784, 6307, 16764, 9375, 32812, 17171, 28761, 4133, 17199, 12816, 13187, 9402, 28699, 13054, 5296,
+    16514, 10849, 12912, 32840, 9854, 16824, 11097, 17111, 12389, 13199, 5658, 8364, 28680, 9665, 9691, 12756,
+    32882, 16887, 28755, 10513, 8261, 12473, 17319, 32828, 12429, 12691, 20481, 12467, 28784, 12368, 28796, 12900,
+    28687, 28818, 11181, 9674, 17089, 17404, 28749, 32896, 16620, 8851, 12476, 8446, 28720, 12705, 12803, 28778,
+    28802, 4432, 12415, 9401, 28758, 5047, 17094, 12784, 4364, 12813, 12872, 8709, 12624, 8769, 8533, 28723,
+    12633, 17139, 13224, 28793, 11466, 13113, 17410, 12416, 28805, 17069, 8966, 12466, 16534, 12640, 12672, 16582,
+    11769, 6143, 16491, 8778, 32820, 28674, 12699, 28700, 9388, 10022, 12873, 9087, 32774, 4134, 13137, 6218,
+    32811, 28799, 12316, 6052, 16750, 16655, 9675, 5663, 12887, 6013, 17341, 13099, 12936, 16508, 6224, 20486,
+    5618, 28812, 32866, 13024, 16506, 10282, 16804, 8351, 17252, 9918, 16535, 12430, 32937, 28771, 9666, 28716,
+    28781, 8277, 9398, 16743, 12395, 4650, 8683, 11199, 28805, 17208, 12756, 17251, 12731, 12756, 13185, 12838,
+    28696, 28810, 6440, 13085, 16685, 8395, 6095, 8789, 9516, 12730, 12779, 16993, 6440, 11245, 28726, 10799,
+    12395, 12888, 12384, 28674, 28742, 12962, 32884, 28803, 13126, 13103, 16858, 10143, 16530, 9707, 32854, 13172,
+    8787, 9302, 6181, 13222, 17102, 32854, 4136, 11545, 32936, 28686, 12780, 32871, 10718, 12297, 6440, 11181,
+    32804, 12736, 12768, 4699, 10568, 11436, 16632, 12826, 12610, 13170, 32779, 8923, 9385, 6446, 8778, 28706,
+    11588, 12936, 28802, 9883, 12394, 16447, 11902, 32851, 12707, 32874, 13020, 28810, 12009, 9555, 5432, 13149,
+    28826, 28702, 28765, 11992, 12935, 6142, 12358, 17150, 11743, 8409, 13211, 32770, 32782, 12358, 12387, 20490,
+    6152, 17375, 32771, 8494, 12535, 17377, 28724, 16765, 8995, 11872, 28674, 17174, 20486, 28702, 5297, 28769,
+    5626, 4900, 28788, 12703, 28686, 13140, 16614, 10677, 28760, 32923, 12824, 17187, 13128, 28826, 16681, 12311,
+    16457, 32841, 17406, 17152, 17029, 9377, 12801, 28758, 28815, 13112, 28701, 17399, 28677, 12386, 12706, 13027,
+    13031, 9388, 5967, 16851, 9248, 9396, 32857, 12729, 11744, 12348, 8378, 6315, 12359, 28748, 16982, 32779,
+    11016, 13221, 12384, 20490, 28818, 10407, 9308, 6454, 12933, 10647, 8709, 32896, 6350, 13019, 11731, 28805,
+    32840, 28717, 12312, 12538, 6218, 12401, 12487, 9386, 32917, 28677, 9780, 28689, 12504, 12817, 28770, 12391,
+    10460, 9986, 12827, 13174, 32776, 4299, 6059, 28744, 12295, 13136, 10450, 9310, 12328, 13100, 32811, 10676,
+    32932, 28769, 12980, 28739, 28777, 5509, 17081, 12799, 11776, 11392, 12669, 11480, 28712, 16658, 12528, 12374,
+    11327, 8981, 16656, 11098, 28740, 10285, 28721, 13092, 12400, 28735, 11458, 10479, 28810, 10059, 12300, 12320,
+    16542, 12992, 5607, 9394, 28741, 12995, 28775, 32818, 10988, 13101, 28802, 32934, 5476, 28745, 28814, 32883,
+    28743, 16979, 17314, 28824, 28818, 12598, 5159, 28827, 12294, 28680, 9775, 16982, 12876, 6433, 12648, 9373,
+    17385, 28677, 4953, 12438, 28796, 17071, 28720, 12719, 13159, 6037, 17003, 8899, 16847, 16667, 5111, 12635,
+    28758, 16459, 20483, 10704, 9985, 28677, 12946, 12854, 28702, 8490, 17082, 16762, 28746, 16779, 8723, 12798,
+    9631, 11943, 8321, 9385, 13038, 28772, 12509, 32857, 10268, 12870, 13212, 13168, 13103, 12452, 28827, 12056,
+    10281, 16700, 12699, 17211, 5663, 10991, 12958, 28772, 12884, 10450, 4285, 28711, 12788, 12078, 9019, 28766,
+    32921, 12419, 13056, 12415, 28741, 16673, 9986, 9012, 17014, 5064, 12742, 28793, 12876, 16858, 13008, 12741,
+    17399, 16825, 28818, 11756, 17141, 11244, 8367, 12504, 11838, 28673, 8771, 9393, 17071, 13099, 10083, 13004,
+    5921, 11943, 28777, 12826, 11262, 9265, 9198, 12352, 9011, 28779, 28819, 13126, 11851, 12722, 17409, 16840,
+    12657, 28782, 12361, 8395, 12340, 12347, 11708, 11930, 17398, 16402, 8384, 12815, 12347, 16716, 12972, 12620,
+    13210, 11765, 16450, 17158, 13125, 6166, 12700, 4779, 32893, 28743, 4977, 12407, 5644, 9392, 28697, 12969,
+    32817, 28734, 17331, 32889, 9675, 11955, 12047, 28785, 32771, 16466, 5562, 10754, 13138, 9839, 4942, 28728,
+    9300, 9321, 12924, 16616, 12079, 12696, 12795, 32923, 32780, 9567, 13212, 16914, 9546, 32845, 8367, 12519,
+    11392, 5089, 11681, 16401, 28790, 12679, 12598, 12312, 12874, 12362, 9366, 28687, 12492, 12516, 12447, 12599,
+    13126, 12331, 28735, 8358, 32896, 9285, 10198, 12668, 28705, 28741, 28721, 28760, 9002, 17253, 13172, 10883,
+    9318, 28701, 28802, 28788, 28708, 32908, 32895, 28808, 8912, 16598, 9946, 8871, 12884, 11986, 5098, 32790,
+    12918, 28731, 8458, 13210, 28783, 28770, 28813, 10394, 12390, 12363, 32851, 12352, 10729, 13142, 9390, 6022,
+    13150, 9546, 13073, 11973, 6440, 17331, 11993, 16727, 16756, 12523, 12796, 6408, 28709, 12960, 12375, 9332,
+    9262, 12527, 17045, 20484, 16712, 12921, 5781, 12535, 11370, 28686, 28701, 12583, 12849, 4933, 12802, 17144,
+    10260, 12969, 11262, 9294, 28808, 10814, 13099, 8603, 12320, 10108, 32858, 13186, 12403, 12875, 11873, 32920,
+    9794, 32916, 16912, 28768, 32841, 32789, 28742, 11608, 8667, 16500, 28740, 12790, 12660, 9964, 12873, 9311,
+    6365, 16528, 28729, 32884, 10856, 28820, 28739, 16845, 16655, 16533, 12876, 12764, 28761, 28720, 13223, 12933,
+    28795, 12599, 12988, 17083, 11779, 12861, 8716, 11475, 17252, 5369, 28700, 12405, 12935, 10095, 10805, 32774,
+    8509, 10285, 28804, 32908, 32791, 5099, 12955, 28755, 12671, 12307, 13194, 16482, 12823, 28743, 12894, 28822,
+    16429, 13175, 32833, 12970, 12425, 28772, 16699, 12693, 28816, 17295, 9808, 13200, 12495, 12967, 28732, 17347,
+    12682, 12393, 16845, 12076, 17031, 9728, 10154, 11449, 4137, 16538, 12859, 28686, 28717, 28801, 28685, 11589,
+    11780, 13126, 16693, 12372, 8720, 28701, 17332, 32936, 17159, 9003, 13056, 6215, 28823, 17342, 17075, 10452,
+    28783, 5849, 16437, 32833, 12993, 6186, 16752, 12336, 12634, 32829, 28722, 28764, 10513, 4141, 13103, 12598,
+    28770, 5368, 10459, 28825, 12370, 28806, 17016, 28781, 11999, 28819, 16741, 9320, 10759, 12335, 12660, 11741,
+    16448, 12360, 32896, 17071, 32911, 16446, 9010, 17162, 16616, 17230, 16777, 12970, 12572, 17308, 12984, 12443,
+    12947, 5227, 17159, 12384, 9104, 28706, 12995, 28800, 28750, 11895, 28827, 11465, 16715, 8764, 13200, 28767,
+    12994, 10781, 16947, 12424, 12298, 12443, 5276, 11647, 9198, 12634, 16696, 32825, 8351, 12874, 16857, 17160,
+    32813, 16460, 17068, 12888, 8421, 32841, 28748, 12079, 10991, 8912, 8769, 8490, 10215, 9524, 13032, 5836,
+    28753, 28709, 11380, 16535, 10634, 13152, 17398, 28761, 10706, 5076, 32936, 4161, 12406, 28794, 13068, 13087,
+    9068, 28681, 12390, 20485, 8883, 13102, 12447, 11437, 10459, 28825, 16618, 13020, 11019, 32781, 8731, 28765,
+    28793, 10217, 16777, 16429, 12355, 28821, 28760, 28826, 12828, 12767, 28745, 12360, 16913, 12587, 17230, 28744,
+    17149, 10579, 28805, 9103, 28782, 11297, 16749, 11059, 13170, 11626, 5432, 16413, 12876, 11656, 28764, 4351,
+    28705, 17083, 28686, 28680, 17332, 11902, 32884, 13066, 12441, 10757, 16598, 16846, 28712, 6362, 28823, 12543,
+    28771, 10271, 9088, 28809, 12527, 28818, 12932, 28697, 28709, 28771, 12387, 13007, 12764, 11040, 12503, 9321,
+    12440, 10138, 12008, 13188, 20481, 9517, 11056, 17090, 9068, 12778, 12364, 28717, 28710, 13205, 9102, 11864,
+    16658, 11905, 13126, 16440, 28751, 12405, 5899, 9219, 32933, 11596, 4636, 12611, 32825, 12360, 16833, 12851,
+    28807, 12389, 16771, 28806, 8722, 32793, 32923, 4984, 11182, 12300, 32934, 13055, 11945, 17002, 6354, 13205,
+    13186, 10862, 8397, 28816, 12919, 28692, 10450, 32936, 11313, 9951, 11403, 16832, 17061, 28688, 12731, 4128,
+    12861, 12346, 32924, 12704, 12744, 16865, 28804, 9600, 12306, 13210, 11993, 10153, 10782, 12766, 12534, 17080,
+    12041, 28677, 28765, 12996, 11814, 11669, 28715, 12732, 12862, 12634, 12310, 6122, 13169, 17147, 28751, 10692,
+    13138, 12883, 16857, 8666, 32871, 32854, 9099, 17346, 12891, 10245, 8789, 28729, 8650, 12956, 16858, 32929,
+    11902, 12558, 17000, 28770, 17016, 16982, 12348, 12647, 12455, 16698, 10818, 16857, 11395, 12764, 28722, 11908,
+    17016, 8214, 12619, 28773, 9682, 13211, 12612, 28792, 10757, 9023, 9265, 12047, 11901, 32794, 12839, 13187,
+    13066, 12873, 12396, 9256, 4306, 12310, 4891, 12923, 12401, 17069, 28729, 28693, 5368, 12434, 11390, 28702,
+    32881, 17368, 10707, 11861, 13212, 17171, 12503, 13150, 16772, 8817, 5152, 10497, 13102, 32788, 11873, 5467,
+    17140, 16597, 12756, 32896, 5462, 32771, 8793, 28820, 20484, 17162, 28761, 12941, 8283, 13151, 13092, 32885,
+    13188, 12935, 12324, 12444, 12539, 4608, 16778, 10255, 28771, 12753, 8805, 13097, 12383, 11020, 32771, 12313,
+    28684, 32937, 10284, 13126, 32872, 16807, 13174, 13018, 28680, 12590, 28680, 12378, 17078, 28726, 28722, 12730,
+    28786, 4928, 11049, 12911, 32880, 13042, 8278, 12563, 8368, 13200, 28758, 12743, 32802, 16646, 11116, 12851,
+    5489, 28715, 28685, 17203, 16579, 12055, 8778, 12778, 12297, 12448, 6399, 28821, 17147, 12596, 32794, 32840,
+    12899, 28766, 12407, 10449, 32870, 8555, 12635, 32780, 5155, 16855, 12703, 32790, 17091, 12646, 13041, 13152,
+    9020, 28733, 12847, 8804, 12358, 11607, 28754, 8777, 10552, 13091, 9473, 32817, 10160, 8664, 32771, 16545,
+    28800, 28791, 32924, 28677, 12742, 12982, 12324, 6445, 12078, 28761, 17158, 28825, 16658, 12711, 6204, 12822,
+    32819, 10262, 20489, 13164, 10850, 12992, 20486, 12993, 28779, 16835, 12811, 11451, 32896, 28722, 10579, 12562,
+    8831, 13127, 16425, 28728, 16649, 8250, 28790, 32924, 32779, 11315, 28692, 32804, 12724, 4126, 12730, 20482,
+    28723, 9319, 16913, 12600, 12564, 32778, 4522, 16676, 9600, 12527, 16733, 11351, 12623, 13122, 12979, 12394,
+    5898, 0, 12695, 17092, 11277, 10411, 13194, 32827, 13042, 12401, 12335, 12822, 28781, 32790, 12435, 5916,
+    28734, 17094, 28742, 28770, 12009, 12598, 32931, 12707, 17002, 28762, 11072, 17078, 6379, 28815, 12799, 12822,
+    11748, 16430, 5106, 12979, 12748, 13065, 13055, 32857, 28692, 8703, 17358, 12718, 4304, 28828, 28722, 12322,
+    12394, 16399, 28794, 28822, 32882, 12947, 28722, 12380, 9539, 8300, 13222, 28828, 8767, 28764, 12982, 10760,
+    28813, 12807, 0, 16662, 12372, 12551, 11712, 12486, 11149, 32870, 28709, 6315, 8648, 8948, 17408, 12391,
+    17173, 28799, 8489, 17151, 32776, 4247, 12356, 32896, 11784, 28796, 28814, 32820, 17208, 32805, 8328, 32880,
+    5469, 9010, 6139, 9367, 8681, 28779, 28759, 16598, 16518, 20487, 32840, 20482, 17251, 12978, 9170, 16674,
+    28680, 16729, 10801, 12346, 32877, 5498, 10805, 32796, 8198, 8986, 16406, 10766, 12593, 13088, 12779, 32832,
+    9586, 32776, 10314, 11885, 12935, 0, 12994, 9608, 5922, 8876, 17360, 28787, 13008, 9473, 12983, 16849,
+    8312, 32910, 13030, 32891, 11395, 13092, 32794, 28827, 6298, 10855, 13067, 17275, 28693, 8355, 16756, 28709,
+    4999, 8582, 28801, 4333, 11413, 13205, 11682, 28713, 12815, 12618, 9648, 28768, 12880, 28769, 12743, 10198,
+    8702, 28765, 12441, 17150, 28796, 4769, 20484, 8713, 10263, 13066, 28791, 13020, 32898, 28692, 12075, 16668,
+    8332, 9020, 11384, 10594, 5104, 12403, 28762, 12959, 12911, 8220, 10444, 12991, 16844, 10216, 13138, 17095,
+    12671, 28726, 32884, 12824, 12447, 12612, 28778, 16619, 16598, 28743, 12511, 16451, 16992, 32791, 13065, 8593,
+    13054, 5475, 32778, 4590, 12724, 12899, 17155, 32792, 6189, 28812, 32856, 17331, 16667, 11304, 10807, 11064,
+    32929, 17016, 13210, 17000, 0, 4651, 6180, 12605, 12947, 16936, 6186, 12670, 11310, 32858, 16588, 9657,
+    0, 12428, 12995, 10572, 17249, 8776, 12708, 28798, 16830, 11436, 6185, 5878, 32867, 17163, 8994, 28764,
+    13136, 11978, 28706, 17158, 20481, 10789, 12943, 28705, 17286, 16664, 28743, 28682, 10274, 32796, 16390, 32870,
+    5077, 28781, 11410, 12395, 12310, 32937, 6036, 8952, 12666, 12850, 11357, 9673, 9376, 28715, 12383, 12501,
+    32937, 28693, 17081, 28812, 20488, 12852, 0, 10892, 11179, 12981, 28693, 20490, 16934, 32797, 8497, 12564,
+    9291, 8643, 5579, 17150, 6243, 16835, 16541, 12552, 13090, 17211, 17410, 9377, 28761, 13211, 28688, 13164,
+    12874, 13089, 16568, 6044, 12855, 8876, 12358, 32794, 28745, 9956, 28733, 8778, 13079, 32891, 32793, 12383,
+    12346, 28683, 17071, 16519, 12659, 10757, 11171, 17404, 16676, 8356, 20487, 32924, 32777, 4318, 11561, 13066,
+    16439, 17407, 10191, 17173, 6387, 11991, 28738, 0, 9075, 28674, 17397, 12936, 8695, 20488, 13223, 6215,
+    28795, 12816, 6296, 32857, 28788, 28742, 20490, 6139, 17014, 4170, 12993, 12851, 28698, 12946, 12408, 28739,
+    16458, 11998, 16449, 11907, 12487, 12840, 9532, 28805, 10217, 12982, 28775, 12720, 17375, 12720, 17090, 28817,
+    32936, 16429, 0, 17004, 17210, 32812, 17375, 12376, 32778, 16501, 12918, 10122, 16914, 17253, 12400, 32780,
+    5230, 32937, 28735, 32800, 4139, 28757, 32866, 12861, 9216, 28797, 28813, 9182, 16912, 13125, 28821, 10871,
+    12695, 8215, 17081, 12341, 12996, 12496, 17151, 12671, 28714, 28744, 28736, 16607, 28776, 28673, 32935, 13102,
+    5406, 16490, 8470, 12468, 13104, 16687, 28750, 32898, 10677, 12454, 12946, 9377, 11692, 8820, 12407, 28694,
+    17089, 13139, 12439, 12684, 12525, 12456, 12413, 12714, 28805, 8860, 28743, 17174, 11686, 17157, 28797, 16524,
+    6433, 12971, 17095, 32845, 16400, 28772, 12341, 6021, 32936, 9684, 16892, 11439, 28828, 28722, 11346, 17319,
+    4143, 16974, 28802, 28689, 5378, 32885, 28788, 28686, 11115, 9919, 12694, 12955, 12621, 17016, 32857, 10283,
+    8321, 8417, 28801, 20486, 20487, 12049, 28722, 9780, 28700, 4307, 12874, 12588, 11470, 17253, 28801, 12514,
+    32924, 8519, 17015, 16858, 16768, 8591, 9584, 12855, 12581, 8788, 16615, 12623, 28689, 13196, 28814, 28725,
+    12683, 12842, 13040, 9496, 11750, 28745, 11105, 28737, 9291, 32883, 28708, 12669, 12610, 28801, 32786, 13159,
+    17211, 8513, 11613, 10116, 12875, 32884, 32790, 9067, 12824, 16609, 28809, 16451, 12739, 12335, 4366, 28715,
+    17094, 28820, 5591, 8687, 11158, 17151, 16528, 12780, 28737, 6439, 10713, 28769, 16724, 16845, 10599, 12401,
+    6189, 17252, 11543, 28684, 28701, 10806, 32920, 28734, 16763, 16657, 9502, 28743, 9385, 6444, 32797, 12291,
+    8490, 12968, 6354, 28827, 12464, 5496, 13128, 28700, 12371, 13056, 12335, 9984, 16666, 0, 32937, 16840,
+    10274, 8487, 32903, 5231, 10552, 11436, 11648, 9272, 32852, 16585, 17376, 11686, 4935, 28674, 9077, 9350,
+    12820, 28707, 13110, 10882, 0, 5105, 11480, 12454, 16528, 10255, 16509, 17398, 16884, 13126, 16607, 28786,
+    32779, 8626, 28816, 28796, 8311, 12535, 5656, 12636, 12299, 5110, 12875, 28789, 32797, 28673, 16542, 9532,
+    16858, 6022, 28808, 12372, 12318, 6224, 12420, 8309, 16541, 12827, 5833, 28824, 12636, 9709, 28783, 28815,
+    28797, 28809, 10515, 12934, 8790, 12994, 17066, 12522, 28758, 28744, 8779, 12731, 11180, 13043, 0, 12729,
+    5391, 28681, 9564, 17399, 32884, 12492, 10859, 5379, 12012, 9153, 12491, 28715, 17332, 28825, 12040, 9376,
+    9005, 12934, 28690, 12300, 8468, 28693, 28753, 17090, 32910, 20486, 10648, 32935, 6442, 28805, 17003, 16700,
+    12910, 5626, 11909, 32844, 11414, 28815, 28814, 16499, 12596, 8349, 0, 12656, 20481, 17308, 28680, 28689,
+    28724, 28712, 12646, 12791, 32889, 10647, 12436, 17174, 28790, 8417, 32772, 16468, 10753, 28684, 9059, 10883,
+    17395, 17253, 10369, 8216, 9609, 28687, 10247, 8751, 17211, 32797, 16469, 11121, 10399, 28803, 12664, 32805,
+    4839, 12813, 32871, 32923, 28682, 8613, 32797, 28685, 32772, 8498, 12405, 12537, 16776, 28709, 16937, 12382,
+    11151, 11160, 12982, 32801, 9125, 28825, 32921, 5211, 16822, 28758, 11054, 9066, 32817, 6430, 28804, 32891,
+    28695, 11443, 16785, 17032, 11887, 9009, 9591, 10757, 8540, 0, 17168, 16451, 9219, 8363, 12561, 5115,
+    10647, 16857, 13186, 28729, 11779, 11609, 16530, 10490, 16561, 20484, 28687, 10844, 5504, 11777, 12669, 11152,
+    6105, 12437, 11735, 9518, 32807, 11854, 16999, 10208, 12403, 28781, 32807, 5965, 10459, 11309, 11640, 28761,
+    16880, 12588, 12732, 28731, 32909, 11490, 28782, 12594, 28695, 10946, 17230, 28814, 20486, 12495, 8745, 12523,
+    17142, 0, 11640, 12742, 12452, 28745, 28815, 28779, 10788, 11993, 13186, 13127, 32921, 10559, 20481, 5629,
+    32839, 28715, 10451, 13147, 28807, 13061, 28734, 6190, 12864, 11601, 9307, 12862, 12606, 10757, 12768, 9255,
+    16934, 12729, 11694, 28761, 11478, 16697, 28788, 28804, 11393, 16815, 8344, 12538, 11267, 12974, 11780, 16500,
+    5369, 28794, 17240, 28716, 8790, 8949, 32910, 10992, 6357, 8349, 12587, 17138, 16663, 28712, 16851, 28780,
+    16857, 17089, 17385, 17068, 12672, 12683, 9984, 28684, 28817, 0, 12618, 16795, 28694, 28741, 12562, 9432,
+    28802, 28690, 8217, 12513, 12353, 32859, 11657, 12936, 28822, 28811, 13055, 12359, 16937, 9054, 16858, 28791,
+    11443, 12408, 8487, 10217, 17287, 28702, 9641, 13055, 32911, 12911, 16576, 11414, 12753, 28710, 20490, 28703,
+    9808, 28767, 20489, 32937, 11768, 28770, 28795, 10504, 9173, 13127, 5794, 20489, 13068, 12959, 28792, 17073,
+    16755, 12452, 32818, 13038, 12599, 17220, 12984, 32772, 8797, 4163, 28707, 28754, 8429, 12334, 11451, 12731,
+    9376, 10789, 32798, 9093, 12448, 32807, 8756, 8459, 9264, 16540, 16893, 16700, 12943, 5090, 5928, 28674,
+    32807, 9335, 10285, 5361, 0, 11901, 12321, 32889, 12899, 9709, 28761, 32798, 12326, 13078, 10076, 10755,
+    12646, 5462, 16683, 28771, 28687, 28772, 13224, 20486, 12962, 9525, 8987, 12778, 12984, 10692, 0, 8366,
+    5286, 13199, 6448, 32919, 12912, 12336, 32772, 12337, 9546, 28729, 0, 20486, 16777, 5192, 5942, 16825,
+    8491, 11404, 6466, 10274, 11737, 12777, 12467, 6357, 12755, 17230, 28798, 10076, 20490, 28802, 13212, 13116,
+    13135, 28718, 8351, 12884, 32798, 12338, 12324, 17240, 5092, 32831, 28690, 12742, 9618, 0, 8434, 9086,
+    12360, 28757, 6049, 32848, 9610, 0, 12672, 13055, 12539, 12741, 13186, 16608, 17038, 32885, 11262, 11291,
+    12974, 12588, 10254, 28804, 10580, 11088, 16619, 28760, 28778, 16910, 28683, 5660, 28806, 28709, 10554, 8516,
+    13101, 28801, 32872, 12631, 12947, 16541, 16846, 11460, 6454, 12682, 16694, 12367, 8722, 28709, 12539, 16479,
+    28709, 13216, 8631, 17145, 12742, 13173, 9846, 28756, 5048, 17038, 6187, 12925, 13197, 0, 12744, 28750,
+    28741, 17110, 13208, 11841, 12598, 12672, 16851, 11978, 11906, 10726, 9387, 28709, 5068, 12317, 17410, 17354,
+    10872, 8358, 28789, 11414, 16846, 12549, 20481, 28715, 11686, 12860, 0, 12296, 13116, 13197, 16620, 12679,
+    10816, 8218, 11947, 28710, 13064, 9053, 28791, 6218, 0, 8689, 12395, 16993, 28745, 13210, 13055, 16815,
+    12675, 32772, 9096, 11967, 11944, 13019, 12714, 6235, 28732, 11327, 13007, 13067, 10496, 13174, 32872, 5766,
+    32832, 11778, 12719, 16856, 13102, 32893, 28674, 11451, 10218, 20489, 9861, 28725, 12384, 10759, 28801, 28771,
+    9296, 12573, 9069, 4604, 12360, 28696, 32794, 10938, 32916, 11893, 12348, 28755, 12336, 32807, 9346, 5673,
+    10772, 8763, 12513, 10859, 11169, 28708, 28748, 8458, 8221, 5462, 12971, 12846, 8314, 10998, 11152, 32870,
+    11161, 12802, 17076, 12448, 12334, 12599, 28768, 28716, 13128, 13116, 28826, 20488, 32794, 11936, 9610, 16825,
+    11413, 12670, 5339, 20485, 12068, 11860, 32813, 28682, 20483, 6445, 13054, 16608, 13065, 28722, 12814, 17374,
+    12305, 16845, 28798, 0, 9633, 28696, 10283, 11244, 28794, 12779, 13224, 32872, 10862, 28805, 12657, 12935,
+    28742, 13125, 11450, 12300, 12771, 32827, 12848, 9986, 10569, 28697, 12810, 28721, 32837, 13161, 12647, 28814,
+    9012, 28814, 6411, 16461, 12456, 17186, 0, 12403, 28688, 17226, 11075, 28732, 8854, 13185, 6365, 12442,
+    12001, 12393, 16517, 12414, 6187, 28705, 32778, 4601, 32884, 12624, 28776, 10311, 8270, 32909, 11604, 4854,
+    32798, 28687, 17404, 28722, 9089, 28688, 8812, 11451, 28676, 9555, 0, 11712, 32781, 8770, 20484, 17093,
+    16606, 28733, 28723, 20483, 16989, 9253, 28762, 12344, 4878, 9256, 9105, 5340, 4362, 28686, 5561, 11738,
+    28755, 6218, 8854, 13055, 12864, 12982, 4460, 16846, 0, 11979, 12874, 16807, 12908, 8721, 28791, 12948,
+    28680, 12557, 13176, 8421, 28763, 12708, 13055, 12660, 28685, 12646, 28807, 13209, 0, 13016, 9002, 8483,
+    12527, 28802, 28783, 9089, 17173, 32872, 28725, 32820, 17290, 6364, 10747, 32934, 12936, 12501, 28699, 9208,
+    0, 9387, 12766, 11713, 28702, 9070, 9563, 32937, 8600, 28822, 9283, 12862, 5607, 4113, 12327, 8472,
+    9022, 13088, 16516, 12599, 10407, 12365, 12393, 20483, 32776, 8550, 12441, 32778, 4507, 0, 8368, 9657,
+    8703, 16665, 16846, 10735, 16973, 28722, 28808, 16621, 9110, 32917, 12931, 0, 28725, 12924, 28772, 28706,
+    6327, 9321, 20486, 17172, 12768, 9208, 8667, 12549, 12623, 9253, 17314, 4114, 28675, 12440, 11910, 13170,
+    10186, 12827, 32856, 5070, 12342, 10705, 17045, 12671, 8723, 11041, 9686, 12045, 11902, 10871, 28734, 12648,
+    28723, 9311, 32837, 11703, 12746, 12963, 32773, 8500, 5431, 10710, 17398, 12852, 0, 8531, 13162, 12076,
+    16463, 6440, 28824, 11387, 32869, 12776, 16793, 5449, 12370, 11742, 13186, 32816, 16490, 12479, 11955, 16893,
+    28778, 13039, 20490, 17095, 6101, 12456, 28819, 12809, 28735, 10415, 13102, 16404, 10079, 16973, 32781, 5685,
+    28797, 5484, 32794, 12366, 9158, 12342, 28729, 6055, 28689, 13209, 12747, 5270, 12310, 9632, 11703, 28709,
+    10444, 12377, 28740, 28735, 13182, 28693, 13099, 11034, 12298, 28739, 11279, 8469, 4117, 12351, 12370, 28814,
+    17241, 32807, 12022, 0, 12893, 13063, 32854, 9301, 11936, 16935, 4506, 13044, 32883, 28707, 28772, 13126,
+    28675, 13150, 9851, 12296, 32773, 4119, 32837, 32898, 28720, 17123, 28764, 12767, 16491, 13125, 28722, 10872,
+    12345, 12329, 17230, 12744, 28724, 16884, 9964, 28804, 9073, 0, 28774, 12780, 8397, 16858, 28685, 32816,
+    4990, 32846, 20490, 16851, 28680, 0, 28746, 8451, 12838, 12348, 11686, 10706, 28702, 11171, 28724, 16667,
+    10856, 28793, 12503, 0, 10490, 13030, 17174, 32794, 12576, 11692, 32910, 4479, 32820, 17089, 32818, 16623,
+    16394, 16959, 28697, 12811, 12347, 28689, 28813, 12875, 12620, 28703, 12587, 12744, 12706, 9965, 5782, 12443,
+    12300, 13176, 13018, 8790, 32855, 28752, 4992, 12598, 12957, 28747, 12657, 32859, 28722, 9627, 8297, 9111,
+    12512, 10767, 28722, 10648, 12538, 12353, 32857, 13055, 32859, 12694, 12715, 12030, 9916, 9608, 17138, 5092,
+    28789, 13125, 9600, 28684, 12822, 12576, 32866, 12684, 12716, 12768, 12654, 20481, 20488, 12608, 28765, 12335,
+    11686, 0, 28678, 10408, 8782, 16959, 28803, 12562, 16924, 4207, 28697, 28809, 8390, 12995, 11824, 11182,
+    13020, 0, 11939, 11059, 10796, 10399, 0, 28700, 12730, 13145, 10561, 12712, 11183, 16529, 9130, 12907,
+    12586, 32832, 12647, 13149, 17165, 28791, 12540, 10648, 11470, 0, 12752, 28693, 4983, 13068, 32894, 12780,
+    12875, 11158, 20490, 28726, 10505, 28779, 12680, 4729, 9919, 28820, 32921, 28744, 28742, 32923, 28726, 12480,
+    17203, 28706, 16966, 6448, 28744, 12537, 12911, 17138, 12078, 28753, 28764, 10859, 10582, 32773, 8801, 17068,
+    12720, 32779, 11185, 13091, 13174, 11066, 12636, 6223, 28813, 10399, 12077, 6402, 16697, 28699, 16446, 11475,
+    16479, 12909, 12034, 8620, 16988, 16558, 28827, 8451, 28710, 32854, 28682, 16584, 12731, 28776, 8658, 12335,
+    28745, 12538, 12600, 16855, 11522, 13193, 32870, 11712, 16606, 6402, 8772, 10975, 10561, 17162, 17331, 5899,
+    5104, 32817, 12875, 9078, 9481, 12935, 13126, 12714, 11095, 9365, 12669, 8696, 28759, 0, 11985, 12983,
+    12371, 11562, 28750, 5281, 12935, 13056, 12584, 13159, 28696, 8453, 16688, 5624, 11481, 5276, 10012, 10882,
+    11543, 11691, 28798, 32896, 12874, 28769, 0, 16676, 17072, 16765, 28727, 12929, 12599, 12816, 12802, 11561,
+    10152, 10148, 8851, 11460, 28692, 28760, 12034, 12703, 28703, 5339, 28802, 9744, 11341, 4203, 12921, 17332,
+    12332, 0, 5104, 11056, 10281, 28783, 16795, 8784, 32780, 5283, 11168, 11347, 12343, 28778, 32780, 8705,
+    16451, 10285, 16626, 12304, 9263, 11182, 11755, 12416, 4694, 12886, 12714, 10711, 4152, 13220, 10830, 28686,
+    28825, 16858, 16698, 0, 28814, 12308, 12768, 9626, 12419, 10407, 8919, 32792, 4707, 32871, 16404, 12419,
+    28785, 11268, 28791, 9815, 12753, 12799, 28791, 12863, 9710, 12993, 13126, 17377, 28779, 11902, 12298, 6181,
+    9310, 10281, 9649, 12994, 32923, 16529, 32885, 16563, 9555, 12934, 12550, 5493, 16743, 11035, 28780, 32833,
+    32922, 28784, 28741, 28822, 32872, 32820, 28733, 11780, 12477, 11155, 12586, 32802, 8539, 32872, 28676, 12941,
+    16661, 12297, 17082, 28821, 11347, 13056, 28693, 16700, 28693, 11475, 10881, 12799, 16404, 6168, 10711, 32840,
+    11480, 12753, 8760, 9012, 12982, 12609, 9712, 16931, 28692, 12323, 20481, 12934, 12586, 0, 11386, 16993,
+    12898, 13173, 32781, 13093, 32884, 9555, 12055, 12684, 12336, 0, 6362, 10806, 12803, 12574, 13184, 32781,
+    5696, 16998, 11129, 11567, 9948, 12731, 12707, 32823, 28723, 32895, 4157, 32911, 5105, 0, 28820, 8479,
+    13126, 17072, 16699, 32921, 9387, 16439, 32911, 16439, 5362, 28734, 6013, 12574, 10512, 12885, 13186, 9852,
+    10191, 28813, 20490, 10787, 28801, 12646, 11742, 16595, 11291, 9066, 13196, 12624, 28708, 11457, 8461, 32798,
+    28710, 0, 9610, 9574, 11746, 11939, 12914, 12754, 12320, 17014, 28766, 28715, 12863, 28739, 12442, 17305,
+    28772, 17343, 12474, 9376, 28783, 12991, 12767, 0, 12466, 13068, 12827, 28730, 10730, 8630, 28817, 16481,
+    13223, 32813, 17217, 16815, 6439, 28707, 10284, 0, 16756, 32794, 13198, 8468, 28747, 5110, 5657, 28790,
+    11668, 10113, 28793, 28749, 28696, 12557, 0, 5629, 9955, 16766, 11181, 32816, 11291, 6409, 12575, 12486,
+    16584, 11355, 13196, 12957, 28794, 20490, 12078, 17399, 11769, 6100, 16925, 12930, 13152, 13013, 9817, 12480,
+    20486, 5642, 11480, 13211, 11334, 13194, 0, 12708, 8667, 32832, 11341, 32872, 12768, 32908, 28794, 11457,
+    16559, 12497, 32789, 12701, 32788, 13044, 9174, 12046, 11567, 12742, 32933, 12837, 12420, 32871, 28815, 10776,
+    13224, 17305, 12564, 8491, 17200, 6121, 11448, 0, 11080, 16728, 4425, 4680, 9376, 10494, 13186, 12864,
+    12692, 28683, 11639, 28707, 6139, 28814, 12453, 12575, 32804, 4584, 12835, 0, 12732, 11308, 12917, 9609,
+    12012, 8912, 28737, 28815, 32819, 20482, 12479, 28678, 5411, 12659, 9758, 9367, 5771, 5099, 6447, 12777,
+    8752, 17332, 10546, 32897, 32924, 32897, 17161, 32895, 12731, 5142, 32815, 16430, 6015, 10150, 17083, 32872,
+    16819, 12392, 12336, 12671, 32820, 9076, 16508, 12884, 10803, 12563, 32781, 11783, 28799, 17062, 13181, 10516,
+    32792, 28768, 28734, 28818, 28801, 17201, 0, 9358, 12515, 12850, 9854, 10760, 6297, 16846, 13212, 11939,
+    32911, 28713, 12393, 10844, 9687, 6455, 28689, 0, 9377, 10183, 17386, 6315, 4880, 9126, 11945, 32923,
+    11308, 12651, 12635, 11075, 12527, 16844, 12400, 10849, 12756, 32794, 16999, 32774, 8511, 6362, 0, 28734,
+    28674, 13116, 28792, 9665, 28820, 17408, 16843, 12539, 13027, 12514, 13187, 8423, 16779, 10216, 4588, 9363,
+    0, 28744, 32897, 10377, 12659, 12588, 20485, 28696, 32792, 9078, 16966, 8257, 12573, 13081, 17202, 28713,
+    8745, 12425, 12408, 32877, 12299, 28743, 9845, 13080, 11105, 16588, 12073, 13037, 8470, 28765, 28728, 13162,
+    9020, 13198, 13079, 16540, 32884, 20485, 12466, 12755, 16627, 28674, 12622, 11483, 8790, 11693, 16920, 9387,
+    28795, 17141, 13193, 32823, 6054, 13151, 8218, 9355, 17325, 10435, 0, 16767, 16687, 10693, 32883, 12839,
+    13075, 6015, 12348, 16952, 11586, 11984, 6379, 11143, 12947, 12359, 11177, 9892, 5417, 5621, 5435, 12711,
+    20484, 10218, 13043, 17399, 28821, 12747, 11092, 4727, 12744, 11989, 9309, 17151, 20482, 6043, 0, 12041,
+    10759, 12851, 17111, 12996, 6233, 10641, 12708, 28780, 9342, 12382, 10730, 8722, 11460, 28737, 9919, 0,
+    17141, 28726, 11822, 32904, 20485, 17331, 28735, 28825, 12755, 32883, 32805, 9244, 10365, 13224, 17308, 16722,
+    8577, 11778, 32883, 12348, 28777, 28780, 20490, 11956, 32855, 32858, 0, 12864, 9618, 28741, 32870, 0,
+    9480, 16700, 12814, 12740, 28753, 10568, 8455, 10389, 6154, 32792, 10215, 32824, 12372, 12812, 8816, 16726,
+    32835, 8620, 9970, 28694, 11646, 20486, 12295, 28716, 32896, 4634, 13217, 32922, 28735, 28826, 9310, 8571,
+    9953, 12790, 28771, 28712, 12595, 16776, 11412, 16846, 12576, 8720, 32803, 9462, 8722, 32883, 9517, 12479,
+    32825, 10069, 28681, 9115, 17235, 28827, 28760, 32846, 5542, 0, 12753, 12755, 12300, 12904, 9696, 28690,
+    16440, 28689, 5659, 0, 32880, 16879, 8480, 11640, 17012, 10940, 32884, 13198, 28718, 11460, 12526, 9618,
+    12468, 32830, 13054, 28710, 28691, 12648, 0, 11748, 17253, 16678, 8378, 0, 17150, 12570, 12645, 17308,
+    11901, 12587, 16808, 12432, 8468, 16937, 9175, 32854, 12559, 13198, 12775, 12466, 28722, 16688, 28776, 9701,
+    12667, 12038, 17325, 13008, 5935, 16842, 9078, 13067, 4630, 11096, 13152, 8696, 12764, 28790, 12646, 16530,
+    12982, 12063, 9983, 10423, 13103, 0, 16737, 17281, 28822, 0, 9982, 28679, 12749, 6037, 12629, 28718,
+    10925, 28700, 11048, 16588, 0, 4888, 28765, 17082, 12467, 10190, 32791, 13068, 12730, 13020, 11742, 28825,
+    16753, 13170, 12311, 5657, 13080, 10553, 10264, 12688, 28714, 16609, 28719, 12983, 17409, 12851, 9507, 11907,
+    28719, 8314, 12334, 12465, 28702, 12539, 13005, 12420, 12824, 13217, 32819, 12706, 12830, 10271, 16628, 12316,
+    13031, 13068, 12840, 9965, 28787, 12453, 28791, 11180, 0, 12744, 5928, 13018, 5222, 12828, 32827, 11779,
+    16518, 12718, 11633, 32817, 16673, 9981, 13197, 9152, 13220, 28680, 16857, 17081, 28722, 12991, 32832, 12412,
+    16672, 12049, 28788, 28689, 28745, 28764, 12077, 13223, 28800, 12504, 11386, 11050, 12419, 17171, 9076, 5651,
+    6060, 9089, 32885, 16657, 28782, 11944, 11161, 32828, 17408, 12860, 4270, 12720, 28779, 12073, 12464, 13188,
+    32898, 28764, 10909, 0, 28814, 8279, 10415, 12550, 5006, 12536, 17398, 0, 5928, 11677, 12803, 12540,
+    13137, 10281, 28794, 28735, 13050, 12600, 12332, 32820, 11788, 16903, 13037, 17330, 13018, 11633, 20485, 10435,
+    4467, 0, 6181, 8491, 17014, 12478, 13078, 11709, 12960, 12862, 9543, 28741, 12309, 12984, 16858, 0,
+    11945, 12599, 12839, 8400, 9555, 0, 17239, 10838, 11180, 6359, 12079, 9601, 12631, 12959, 10789, 11747,
+    8414, 32898, 12871, 28698, 28700, 16597, 17093, 12672, 12984, 32774, 4142, 16742, 12437, 12730, 10254, 10249,
+    10730, 12418, 28796, 12540, 9860, 10489, 28819, 12524, 32885, 28705, 28727, 11152, 8613, 32801, 9129, 10452,
+    6049, 0, 6226, 12813, 28729, 28792, 28792, 10706, 28722, 6224, 28731, 9702, 9218, 12528, 12600, 28685,
+    12382, 28742, 9365, 13200, 28737, 9916, 0, 11939, 12983, 32909, 0, 6181, 32885, 13211, 5007, 17095,
+    0, 28690, 10452, 28682, 32833, 5497, 16418, 12643, 13062, 16535, 28824, 28716, 32799, 4124, 12959, 5478,
+    17070, 10546, 12958, 28707, 0, 16912, 12418, 28794, 10573, 12811, 28748, 32807, 8435, 8778, 28689, 32898,
+    32880, 0, 28780, 32799, 16395, 0, 9657, 10872, 4806, 12957, 12876, 11137, 13125, 11703, 28772, 32804,
+    10935, 16656, 11088, 10546, 12922, 13223, 9365, 20485, 0, 9301, 16879, 32874, 28707, 0, 12919, 13087,
+    28711, 9375, 12586, 12526, 11029, 28726, 12835, 12073, 5461, 12511, 10208, 28742, 17161, 12322, 12552, 32817,
+    13221, 32806, 5206, 12924, 0, 12443, 12648, 16808, 20481, 11939, 28720, 17124, 6439, 17014, 9377, 28789,
+    28808, 12946, 11596, 12618, 10844, 28780, 12606, 9909, 28795, 16617, 12552, 12576, 32881, 28810, 16922, 12930,
+    11414, 28750, 32833, 12322, 12911, 8759, 10570, 9022, 0, 28804, 16449, 28718, 0, 13089, 0, 10077,
+    16604, 12571, 32839, 12501, 28757, 12716, 28708, 32897, 32923, 28821, 11842, 9675, 32773, 8504, 32844, 28710,
+    16953, 28814, 16699, 10848, 6356, 16616, 12588, 16858, 11944, 32820, 17296, 28678, 12608, 28714, 9674, 20484,
+    12972, 8995, 12384, 10991, 6152, 0, 28828, 12923, 8721, 28754, 28805, 12539, 12444, 12588, 28772, 12818,
+    9563, 12680, 10642, 28788, 28699, 9687, 32799, 8505, 16687, 28818, 12453, 5693, 28806, 16593, 28726, 16461,
+    5466, 12909, 12040, 28712, 5591, 13004, 16767, 10177, 32774, 9107, 0, 12813, 5093, 13066, 28691, 20483,
+    12467, 16620, 28719, 28768, 16742, 6365, 12359, 12008, 28813, 8423, 28821, 28725, 32799, 12292, 12897, 16609,
+    32853, 17168, 11434, 12319, 12585, 28722, 32859, 11821, 12436, 10868, 20490, 28750, 28806, 13126, 8620, 16886,
+    12078, 12907, 6211, 11844, 10815, 28722, 6038, 28815, 12448, 12812, 12528, 17251, 11466, 11999, 17404, 10123,
+    12431, 28725, 28724, 28767, 16966, 9919, 32869, 11147, 9839, 9894, 12356, 17282, 12607, 17320, 28826, 12784,
+    5111, 17253, 11440, 11358, 11990, 17162, 6205, 28803, 20485, 12596, 10130, 32773, 4127, 13115, 11694, 5091,
+    32906, 5574, 11860, 32886, 12876, 28808, 12703, 0, 10153, 11413, 8788, 28679, 13104, 12616, 9385, 11050,
+    12717, 17332, 13013, 16578, 28811, 5540, 6180, 11393, 9904, 12752, 28804, 6044, 11358, 28708, 32907, 12912,
+    16821, 12839, 0, 28748, 8312, 0, 12345, 13221, 9075, 12711, 12539, 13092, 32897, 12370, 32846, 28808,
+    16751, 12672, 20490, 13112, 10816, 28819, 13126, 8688, 17230, 9087, 0, 28699, 28680, 10582, 16535, 28697,
+    9809, 13224, 28823, 11441, 12947, 0, 11947, 6221, 11114, 12944, 16858, 12932, 12336, 0, 28808, 20481,
+    4173, 12859, 10883, 6408, 0, 16966, 28773, 12744, 28791, 12413, 20485, 10670, 12369, 12298, 6185, 32831,
+    11262, 12995, 0, 28687, 9294, 17093, 17281, 16745, 0, 9087, 10806, 9856, 11309, 12732, 10481, 12391,
+    11544, 13055, 8744, 9861, 28779, 28683, 28711, 17037, 9419, 0, 12799, 10282, 11713, 17003, 12876, 5099,
+    12899, 32876, 32868, 0, 28788, 11161, 16538, 9017, 17281, 32853, 32816, 16699, 32924, 12681, 17094, 28763,
+    17393, 0, 28751, 13031, 28804, 5054, 17228, 8621, 12802, 28680, 8779, 9616, 16830, 32799, 16474, 10776,
+    16643, 28771, 17411, 28805, 32808, 20482, 12862, 32777, 8558, 0, 12055, 28737, 0, 5276, 28697, 32909,
+    12725, 16973, 12828, 20488, 12874, 12790, 12911, 10537, 0, 28729, 6355, 8951, 17014, 28770, 16935, 12810,
+    17002, 16903, 28768, 8894, 28748, 16895, 11182, 28759, 16607, 5138, 20483, 17315, 28686, 28753, 28767, 17405,
+    0, 12895, 0, 28719, 16831, 28788, 28717, 17365, 13017, 17172, 32865, 32936, 28792, 28796, 17160, 6436,
+    6448, 12607, 11954, 10794, 32791, 17406, 10815, 9639, 10832, 6344, 12079, 10997, 28748, 28732, 20490, 9609,
+    32924, 28680, 28791, 8954, 4984, 9578, 12995, 8661, 28781, 9345, 28744, 12991, 10676, 32809, 20482, 13221,
+    32885, 12864, 5499, 9483, 12483, 32799, 12399, 28802, 11429, 9809, 32774, 8808, 28776, 12806, 10698, 28720,
+    16920, 11247, 0, 13169, 10145, 17397, 0, 16539, 28804, 16845, 11160, 8533, 32916, 13101, 10514, 8713,
+    11648, 8790, 28827, 32883, 32871, 10704, 32898, 9385, 28748, 9863, 28743, 12359, 0, 9892, 16979, 8490,
+    28695, 28739, 13079, 28777, 12874, 5548, 9970, 6291, 0, 17094, 6360, 32885, 12342, 11497, 12419, 4757,
+    0, 13128, 9162, 17149, 28695, 9846, 12971, 10247, 12391, 11373, 11479, 11977, 12600, 28828, 16461, 10812,
+    12971, 13008, 28804, 11334, 16688, 32898, 12372, 32924, 28786, 8470, 16700, 28803, 10145, 9684, 9893, 13128,
+    0, 13182, 9277, 32816, 28739, 12731, 13212, 16936, 32857, 12811, 28758, 8250, 28717, 13042, 28702, 9620,
+    10975, 12504, 32779, 12841, 12520, 32916, 6122, 13039, 11114, 28739, 0, 10697, 17001, 16584, 12551, 28683,
+    12334, 13056, 28790, 8555, 9974, 10853, 32884, 16419, 5345, 16846, 11648, 28705, 10843, 8788, 16913, 12924,
+    32806, 5169, 17354, 8225, 12576, 16909, 28730, 28676, 28827, 16412, 11708, 12837, 28677, 32878, 16700, 12526,
+    17092, 32909, 28786, 5831, 8574, 17409, 0, 17014, 13050, 17309, 9176, 28694, 12730, 12416, 16774, 16608,
+    12404, 9965, 9846, 28798, 28719, 0, 12965, 11295, 0, 12617, 9584, 6439, 16740, 13210, 16756, 28818,
+    12981, 13128, 17080, 11111, 8712, 0, 32852, 28680, 13006, 12634, 8471, 0, 10976, 9059, 16857, 12646,
+    28812, 12357, 17319, 28780, 9365, 32923, 28762, 28774, 17387, 16699, 10208, 32935, 8900, 13222, 8757, 12720,
+    32791, 9057, 16694, 9077, 0, 12731, 12468, 28680, 20485, 5070, 8699, 8936, 12617, 9077, 32934, 17115,
+    32865, 12528, 16763, 28694, 17408, 11764, 28746, 10733, 6439, 11152, 13029, 16901, 13019, 12730, 16756, 8317,
+    8966, 17083, 28723, 16696, 9292, 12804, 28803, 32774, 4146, 28762, 0, 12948, 0, 13091, 12468, 0,
+    10278, 12822, 32810, 20482, 12730, 12548, 5949, 13017, 13125, 13223, 0, 11733, 13062, 11332, 28780, 0,
+    11476, 16539, 16528, 13170, 0, 17319, 32793, 28690, 0, 32871, 13027, 16571, 17268, 10537, 12659, 13090,
+    11902, 13092, 12924, 12480, 17252, 11765, 13199, 16542, 9643, 28792, 10670, 12734, 0, 11034, 12322, 32908,
+    32894, 32898, 17330, 0, 9481, 16736, 5614, 28706, 10760, 28810, 28805, 12791, 12790, 13039, 12984, 28723,
+    9374, 0, 28795, 16618, 32774, 8514, 12852, 9181, 10364, 12922, 8413, 12732, 12802, 12996, 10832, 28734,
+    12310, 16998, 9962, 8966, 28695, 12432, 11357, 9816, 16936, 28803, 28681, 0, 12298, 16445, 28740, 17059,
+    12814, 10101, 11902, 11166, 12644, 28692, 12573, 12919, 0, 12790, 13104, 4893, 17013, 17320, 9665, 16857,
+    12861, 16428, 28818, 9982, 9801, 16743, 11086, 17252, 12886, 17208, 5117, 28750, 0, 10375, 16779, 12324,
+    28697, 11993, 10218, 20481, 28691, 28725, 12753, 11756, 11908, 17193, 32857, 12420, 5362, 0, 32815, 10800,
+    10145, 32883, 13064, 5461, 13211, 12852, 13174, 17059, 32841, 10562, 9554, 11899, 4711, 12507, 5591, 17172,
+    28825, 28728, 12945, 5368, 13149, 13186, 28819, 12671, 0, 11561, 4331, 8843, 12982, 12911, 12838, 5489,
+    28779, 12456, 10573, 28758, 16895, 11939, 12766, 13053, 9319, 17230, 9739, 28822, 10570, 32931, 13128, 0,
+    17279, 17241, 11131, 8256, 8477, 8419, 4328, 12332, 32897, 28810, 12646, 9037, 5362, 28783, 32937, 28802,
+    9302, 28767, 28741, 17138, 12575, 10740, 13163, 28696, 12740, 32922, 12576, 32898, 16779, 32910, 12694, 16767,
+    5483, 12526, 0, 12357, 13114, 17168, 13149, 11768, 28794, 32798, 32810, 12875, 4430, 10868, 20490, 28752,
+    28707, 9058, 5656, 9264, 13171, 9088, 9657, 5489, 13079, 16699, 9954, 12538, 10158, 12586, 13194, 28794,
+    5612, 12584, 28773, 17154, 13110, 12826, 12002, 32803, 10596, 9721, 20483, 17089, 8788, 8424, 8854, 28795,
+    28798, 16519, 10280, 28700, 32811, 20482, 32819, 12695, 8357, 9862, 4716, 12683, 13136, 12581, 13092, 10882,
+    5483, 32928, 8875, 0, 32936, 12754, 6325, 17004, 8611, 0, 12744, 12464, 13104, 16540, 16973, 9983,
+    17210, 0, 32879, 12356, 10414, 0, 32780, 5140, 28678, 12907, 10552, 16614, 16530, 28777, 28710, 10273,
+    13136, 17159, 16923, 28698, 28753, 28711, 12496, 10945, 28719, 10814, 6038, 32911, 0, 8414, 4394, 17217,
+    32872, 12960, 12790, 10584, 12407, 17384, 10514, 12464, 11412, 17229, 16894, 28691, 9974, 32793, 16507, 9225,
+    11976, 12788, 13043, 12439, 0, 12622, 12600, 13182, 28725, 12849, 12778, 9619, 0, 8301, 16429, 12540,
+    20487, 16666, 0, 10870, 12502, 17332, 8386, 0, 12905, 28733, 12008, 32778, 10894, 10223, 28698, 8693,
+    13149, 9319, 12407, 11102, 28818, 12394, 0, 8978, 28784, 11376, 16507, 32793, 12814, 10377, 10584, 13212,
+    12929, 12442, 17268, 17174, 11926, 12896, 4971, 12492, 10231, 9088, 11956, 17057, 12958, 6034, 10760, 6310,
+    16931, 5617, 13127, 0, 32897, 32773, 9100, 11711, 13123, 12828, 28784, 13044, 12510, 28730, 12803, 12683,
+    0, 28704, 28687, 6276, 11901, 13205, 13199, 9919, 9153, 10161, 20490, 28723, 11485, 9948, 12504, 12491,
+    32774, 4150, 12708, 5045, 12838, 28761, 12748, 17015, 12540, 16807, 11149, 28791, 32870, 0, 12860, 28696,
+    0, 8491, 4984, 12670, 16615, 13124, 12610, 28699, 13074, 0, 12370, 28735, 32799, 9101, 12498, 12696,
+    13027, 4727, 10263, 16751, 0, 11941, 9302, 11169, 8881, 0, 12934, 17319, 11333, 28767, 4849, 10196,
+    13102, 32825, 16621, 28746, 12965, 11985, 32774, 9406, 17150, 13053, 32906, 8461, 28680, 32833, 6139, 32892,
+    11594, 12569, 28711, 28711, 12628, 13164, 13222, 28772, 10371, 12515, 12298, 20488, 9900, 8307, 17307, 17136,
+    28689, 12992, 12839, 10208, 5455, 17251, 8940, 17065, 16900, 28685, 9376, 0, 8312, 6044, 9986, 20486,
+    9366, 16698, 32894, 12779, 8611, 12683, 16843, 17320, 28781, 12839, 10474, 12491, 12068, 12372, 20490, 28744,
+    12611, 17315, 16700, 0, 28795, 9809, 12804, 9181, 11942, 9682, 28704, 8414, 12970, 12942, 17036, 28675,
+    11750, 9203, 4998, 12994, 5664, 16607, 8245, 9011, 12431, 0, 9517, 32888, 11404, 17252, 12079, 28807,
+    0, 28797, 11378, 12792, 13019, 8909, 12528, 0, 13127, 13056, 32799, 12328, 0, 28685, 0, 12551,
+    12875, 0, 28675, 28769, 32903, 28729, 12958, 13176, 8775, 17326, 28747, 9088, 32819, 10861, 10218, 16430,
+    12758, 12911, 16852, 12468, 0, 12907, 28694, 17081, 10898, 28734, 12645, 13044, 12840, 12036, 6145, 5407,
+    11169, 28794, 28766, 28780, 10159, 12804, 12648, 12444, 12864, 4813, 28681, 28700, 8320, 11152, 12347, 0,
+    5585, 9056, 5929, 28791, 28736, 5937, 28675, 16596, 0, 12779, 12057, 12983, 17149, 12669, 6116, 12960,
+    8648, 9862, 10881, 28799, 12932, 16642, 11971, 0, 12599, 28675, 32845, 16609, 10872, 9153, 10064, 0,
+    28725, 12864, 10247, 8953, 12383, 16449, 12935, 5616, 13065, 9138, 32846, 28698, 16684, 9240, 11191, 12037,
+    12389, 28694, 12792, 13053, 20490, 32774, 9690, 28740, 32923, 12981, 28778, 6298, 0, 8765, 28799, 28739,
+    16438, 28732, 12959, 6283, 0, 8283, 28769, 12729, 12874, 9068, 10284, 12863, 32871, 17174, 17240, 5613,
+    28698, 17170, 11675, 28715, 11748, 28814, 28821, 6426, 28800, 5557, 9366, 11105, 16936, 13155, 11727, 12906,
+    0, 6211, 13005, 32779, 4995, 13152, 0, 12612, 0, 13092, 0, 16834, 9317, 8721, 10806, 0,
+    11182, 11647, 8307, 11272, 5191, 11347, 28811, 28683, 4921, 12612, 9089, 12942, 12896, 9686, 12309, 28780,
+    32781, 6062, 28722, 12836, 11843, 9280, 11180, 13218, 12944, 12322, 17320, 17080, 28804, 16527, 12336, 9811,
+    17173, 10584, 10553, 13124, 28759, 9006, 28799, 16858, 10247, 13032, 11655, 13032, 10516, 0, 16700, 20484,
+    5194, 17236, 12600, 32801, 10022, 5289, 28815, 11609, 11764, 17218, 32799, 12340, 17318, 12073, 0, 12540,
+    0, 12971, 12064, 32780, 5219, 8687, 12655, 8469, 13044, 8774, 12732, 28758, 28735, 16592, 9879, 16729,
+    9619, 16804, 28726, 17089, 10348, 6172, 28715, 28691, 12971, 12040, 9579, 17398, 16420, 28817, 8469, 28820,
+    8256, 13029, 12564, 12514, 11640, 12759, 12464, 28793, 0, 16925, 12732, 28694, 8283, 10842, 16857, 0,
+    28820, 8708, 10583, 12508, 20488, 9473, 12696, 28720, 12573, 12528, 9003, 28773, 9985, 12635, 4815, 8582,
+    9844, 12971, 8620, 11387, 28747, 8232, 32833, 6015, 32907, 4432, 4736, 9366, 16596, 12812, 28733, 11104,
+    12415, 8779, 16665, 0, 12295, 10833, 28699, 28818, 28680, 12720, 13020, 32794, 28795, 13181, 0, 17095,
+    32780, 5506, 0, 16953, 32803, 12640, 10264, 32846, 11700, 16540, 16935, 8790, 17331, 12863, 12391, 0,
+    12695, 17307, 9585, 0, 11262, 13038, 17249, 4592, 12549, 16614, 12881, 6209, 0, 11945, 12074, 32846,
+    8318, 0, 11603, 0, 16685, 16508, 13212, 11925, 8882, 13067, 28806, 28782, 12359, 16542, 0, 5640,
+    13175, 9561, 32804, 4648, 11978, 13104, 16857, 13152, 12923, 10653, 11151, 16729, 9036, 4649, 9077, 12886,
+    16598, 9497, 16528, 0, 6350, 9510, 16449, 32804, 12333, 5665, 12792, 28697, 28777, 9718, 8491, 6444,
+    12864, 17153, 9389, 20482, 11970, 9077, 28700, 28755, 5627, 28733, 11603, 28705, 4269, 28734, 32843, 12299,
+    16588, 0, 8894, 32894, 8612, 20484, 28731, 12947, 32924, 11646, 8438, 8582, 12728, 32921, 28705, 9538,
+    6057, 13193, 0, 12514, 12403, 8621, 28748, 16577, 28674, 12736, 32911, 11479, 0, 28744, 9077, 12789,
+    13074, 12334, 12382, 16657, 11112, 5658, 28704, 11448, 0, 32923, 10151, 5356, 32846, 17317, 0, 17369,
+    16833, 13120, 8777, 9948, 9245, 28725, 13079, 11431, 32859, 28701, 10264, 28828, 13184, 11144, 12358, 16518,
+    0, 17309, 8721, 11970, 28810, 12958, 32773, 9391, 32793, 28748, 0, 11368, 6327, 10545, 0, 8957,
+    9194, 12628, 32792, 10137, 12708, 11059, 10246, 28814, 5431, 13185, 8779, 10285, 8480, 28719, 32778, 4647,
+    32792, 17008, 16419, 16592, 13188, 28694, 9948, 16621, 16663, 12369, 12532, 17411, 32922, 16821, 16450, 11481,
+    16833, 4591, 17072, 13195, 16992, 12360, 12562, 8960, 10837, 9266, 32844, 28828, 28686, 16435, 17317, 28772,
+    28821, 0, 17149, 10842, 0, 12657, 10583, 28794, 17093, 0, 11843, 17253, 16588, 12558, 16736, 12528,
+    8919, 16913, 12515, 28697, 12370, 8418, 12852, 17296, 13103, 32773, 12373, 9863, 12357, 9015, 6362, 4716,
+    28784, 16914, 9478, 12948, 12684, 28701, 11013, 28809, 28684, 0, 12936, 0, 16674, 12852, 6348, 12431,
+    28818, 32773, 9395, 16983, 6411, 5894, 16677, 28725, 32780, 16520, 12910, 12767, 12894, 5584, 12641, 8769,
+    9245, 12466, 11585, 13065, 28776, 10893, 12720, 28723, 9356, 16698, 0, 20485, 12739, 12333, 12504, 28683,
+    0, 28719, 9619, 0, 5560, 17016, 0, 28806, 13200, 0, 11700, 28767, 0, 9683, 28688, 12905,
+    0, 28807, 11150, 0, 17062, 9522, 11769, 28826, 12821, 13224, 8789, 0, 4205, 28720, 0, 10759,
+    17387, 13038, 28682, 12765, 12528, 0, 4662, 28736, 12720, 11466, 28700, 0, 12896, 11457, 28695, 28768,
+    0, 17080, 20490, 28823, 10580, 12831, 6465, 28694, 8952, 17374, 20484, 12720, 9986, 8788, 28813, 12854,
+    20484, 12824, 11042, 12624, 32935, 12310, 20482, 6181, 12780, 12403, 12975, 0, 12684, 9985, 28695, 12010,
+    28822, 12814, 12551, 0, 8788, 10207, 13030, 16807, 9986, 11985, 12984, 32815, 16613, 16807, 0, 28784,
+    28797, 28678, 12737, 12835, 0, 28768, 16629, 12363, 13188, 12852, 12816, 0, 28757, 0, 28688, 5186,
+    12408, 28688, 12611, 16813, 16519, 11645, 6145, 28732, 8489, 28687, 28733, 12880, 0, 28733, 9593, 6352,
+    12347, 28751, 20487, 12348, 0, 11767, 28684, 12358, 0, 16684, 10255, 16778, 11571, 16840, 28769, 32872,
+    12587, 17361, 12651, 28687, 5425, 20483, 0, 16840, 32866, 28674, 13091, 5229, 28674, 16665, 28762, 13128,
+    17252, 5988, 28816, 16665, 12660, 28784, 0, 13101, 16778, 32837, 32857, 0, 12311, 28818, 16528, 13031,
+    28811, 16821, 12491, 12920, 32855, 4589, 16607, 16458, 11161, 16683, 8418, 0, 28720, 10751, 11341, 8491,
+    12479, 11190, 32816, 32856, 16631, 12375, 0, 12538, 28735, 12714, 6210, 9068, 5793, 28756, 12600, 28734,
+    16588, 13099, 5427, 17361, 12720, 28820, 16779, 16764, 12931, 16686, 12001, 8489, 12299, 9686, 32799, 16631,
+    13152, 17248, 17367, 12715, 32844, 12765, 12623, 32807, 8457, 28761, 13184, 13113, 17273, 32934, 28803, 28682,
+    0, 28818, 12323, 32806, 12964, 17084, 20487, 12300, 13125, 17053, 32833, 12393, 28695, 0, 16514, 32876,
+    32931, 4508, 11000, 28762, 11171, 0, 12747, 28783, 32935, 17410, 0, 12681, 12747, 12372, 12528, 17068,
+    28772, 13077, 17124, 16632, 12387, 11178, 10347, 32773, 9399, 16840, 9537, 16756, 17314, 20483, 28815, 12716,
+    12382, 28775, 32774, 12421, 28772, 16953, 28722, 28747, 0, 8981, 16856, 9606, 12334, 0, 17360, 13164,
+    0, 11050, 12334, 32907, 17068, 5491, 28820, 12476, 8998, 13206, 28751, 28770, 28764, 12810, 8760, 11777,
+    28725, 12359, 28769, 13001, 5497, 32831, 11822, 10642, 10414, 9291, 16518, 12646, 8950, 12067, 12756, 12719,
+    32792, 12299, 0, 20488, 12300, 12862, 13116, 28762, 12857, 0, 11042, 10655, 28728, 12599, 13196, 11457,
+    17015, 8422, 9674, 5075, 16530, 9067, 13116, 9510, 12497, 10572, 8404, 32799, 9400, 28724, 8716, 16761,
+    12512, 12743, 28736, 9975, 16529, 32815, 32789, 9529, 13125, 12585, 32920, 17229, 11837, 32781, 5790, 6457,
+    0, 32779, 4991, 28825, 17211, 12439, 32799, 12364, 8661, 12827, 12513, 10285, 16857, 16816, 4357, 12600,
+    13008, 9055, 8778, 32880, 28736, 16778, 28761, 16509, 12767, 16618, 12922, 9965, 8479, 4249, 12311, 12324,
+    12456, 9762, 28811, 10677, 17329, 0, 5497, 9817, 11056, 32917, 11404, 28790, 12656, 8490, 0, 16992,
+    16841, 5449, 10583, 12356, 9588, 10757, 11056, 0, 28773, 5921, 12945, 10941, 12527, 6349, 0, 28750,
+    28759, 28819, 28721, 28788, 0, 9088, 17216, 6293, 10078, 28772, 16506, 10743, 12498, 20481, 28681, 16607,
+    10498, 17185, 5938, 11088, 17262, 28686, 10878, 28765, 17141, 16855, 9383, 6306, 17246, 13073, 13200, 11273,
+    12708, 6149, 12559, 28726, 28782, 0, 5864, 0, 32875, 28695, 10413, 28679, 12647, 28676, 12972, 11781,
+    16530, 12656, 0, 12356, 0, 6462, 32882, 20481, 0, 20486, 0, 5629, 12480, 28682, 16925, 13176,
+    28725, 0, 28794, 28682, 12912, 32893, 12900, 12466, 28828, 12584, 28741, 28727, 10941, 0, 28755, 12811,
+    11668, 12575, 32908, 12643, 28796, 32852, 28773, 10976, 10072, 12420, 5505, 17404, 32799, 12376, 8919, 11732,
+    12752, 0, 12513, 9592, 5499, 32895, 32781, 11798, 8379, 17147, 28776, 16613, 13068, 8306, 28716, 12345,
+    32872, 12930, 12535, 28728, 9547, 17140, 11738, 9089, 32832, 0, 12947, 12560, 12991, 12659, 16748, 16824,
+    32812, 20482, 12502, 13030, 0, 12585, 12586, 16937, 9021, 8773, 8367, 0, 28744, 5491, 8853, 28817,
+    28752, 28721, 12680, 11768, 17295, 0, 5367, 16485, 12797, 6314, 16606, 16775, 5758, 28751, 12309, 11732,
+    0, 13089, 9441, 28770, 16518, 12599, 17250, 28736, 5680, 16778, 16617, 12346, 28744, 28740, 11404, 11929,
+    28763, 12996, 5491, 10580, 16449, 12788, 12923, 5411, 17398, 12511, 16449, 10284, 11486, 32803, 9163, 6240,
+    28740, 12765, 11765, 0, 8723, 28709, 20481, 8718, 5042, 12026, 12777, 13113, 16845, 32867, 28683, 4710,
+    12968, 0, 8712, 17209, 13208, 20485, 12605, 28761, 9671, 28734, 12307, 16440, 0, 28804, 0, 11349,
+    12715, 28796, 8903, 16834, 4472, 12792, 10218, 12935, 17078, 10803, 0, 12930, 12597, 6376, 0, 9663,
+    28673, 0, 28702, 10365, 16766, 4329, 11465, 16835, 12696, 12537, 11355, 28798, 28683, 12900, 0, 17203,
+    11778, 32852, 11765, 0, 13080, 8491, 12776, 6401, 16993, 10816, 11409, 32800, 8213, 12045, 12477, 32888,
+    13200, 32878, 17345, 0, 13000, 28755, 13006, 13212, 12803, 17408, 4961, 16460, 12561, 6457, 12535, 12600,
+    8613, 28756, 10992, 0, 12647, 13053, 32800, 16399, 0, 17023, 28753, 0, 10861, 9640, 0, 10404,
+    12586, 12516, 12932, 11088, 28687, 9517, 13174, 11056, 11930, 12077, 13028, 28678, 16983, 0, 11775, 0,
+    9640, 28798, 12945, 6394, 0, 9773, 28795, 9219, 10253, 28725, 5627, 12057, 28795, 13187, 16854, 11936,
+    11865, 28679, 9347, 11358, 12796, 12360, 8666, 12836, 10190, 12701, 12951, 13020, 12918, 8755, 4798, 12942,
+    6324, 17344, 28796, 17399, 12550, 28692, 28720, 32922, 28749, 6419, 12969, 16686, 10487, 9059, 28726, 13184,
+    16539, 10803, 12537, 32818, 0, 12611, 12692, 5658, 11930, 13092, 11776, 12466, 11710, 5342, 16541, 28806,
+    9350, 32937, 0, 13103, 0, 20481, 17235, 12502, 32780, 12961, 10120, 13185, 9153, 9601, 0, 32843,
+    32934, 11647, 13032, 17002, 10528, 9060, 11395, 0, 12490, 32794, 12824, 0, 28681, 16459, 16539, 28801,
+    17170, 13174, 10513, 0, 9010, 11425, 5048, 28674, 5592, 8768, 32920, 10440, 28700, 17399, 13128, 28796,
+    5154, 32774, 9694, 16621, 11975, 13066, 17357, 11611, 16992, 28756, 9907, 9080, 32818, 12859, 5626, 11387,
+    28678, 13199, 13031, 12419, 12619, 0, 17229, 32922, 0, 16894, 10806, 11981, 12828, 10415, 8405, 10601,
+    10157, 4410, 13218, 32800, 8512, 28725, 11102, 12319, 10274, 32892, 12767, 6320, 12946, 0, 9347, 12468,
+    28789, 28800, 0, 12554, 28761, 5462, 20486, 32866, 0, 17369, 9263, 17014, 12057, 12835, 28756, 32817,
+    11245, 4472, 6294, 28684, 20483, 32776, 9433, 0, 11756, 12676, 12384, 17002, 0, 11699, 28786, 12872,
+    0, 11253, 12521, 9622, 12012, 28766, 12679, 12660, 28680, 16675, 12299, 32788, 12336, 0, 32893, 16406,
+    16620, 16576, 32830, 28802, 28751, 13078, 17092, 12008, 8368, 9593, 32852, 0, 9087, 28697, 32898, 12463,
+    5556, 0, 12875, 8473, 12920, 8777, 9052, 10042, 32917, 12567, 32794, 8898, 12479, 28774, 13044, 12671,
+    10398, 28685, 12344, 12312, 16607, 11902, 28770, 28759, 10394, 12971, 28827, 12876, 12515, 20489, 11871, 11150,
+    5431, 12826, 12381, 10899, 17059, 9518, 13152, 13156, 12767, 8704, 4498, 17141, 11291, 28686, 32873, 5449,
+    28729, 8477, 12996, 28718, 9219, 11168, 28820, 12008, 28788, 16843, 17161, 0, 13223, 4818, 0, 28679,
+    12731, 10693, 8763, 0, 11866, 16461, 28733, 9002, 10215, 12396, 12905, 28763, 8648, 12772, 13197, 17185,
+    0, 9019, 32791, 28743, 0, 12960, 32916, 11312, 9003, 12836, 13044, 10088, 12728, 0, 28780, 11297,
+    12822, 12776, 28763, 16911, 32800, 9108, 16674, 12896, 28817, 32872, 11115, 12563, 16447, 12401, 0, 17124,
+    0, 16697, 32774, 9698, 28726, 11002, 17094, 11482, 9804, 5340, 0, 11708, 32780, 11484, 13100, 28803,
+    16833, 28772, 32819, 12767, 32831, 12635, 16436, 12753, 8484, 28806, 28808, 0, 10434, 28679, 13027, 6065,
+    0, 13031, 12049, 16987, 12754, 8919, 12778, 11355, 13043, 28763, 12544, 9555, 5558, 10212, 0, 32805,
+    9259, 17151, 0, 9728, 12296, 12971, 32805, 16670, 28730, 28778, 16687, 10562, 32839, 17162, 0, 13207,
+    17188, 11953, 12379, 28814, 0, 17111, 9078, 28779, 32780, 9268, 11224, 32855, 0, 16462, 20487, 5663,
+    20484, 12041, 0, 13077, 0, 28740, 9021, 6059, 10160, 9556, 16688, 12646, 8734, 17013, 12971, 9076,
+    28756, 28685, 13198, 12942, 6022, 12467, 32801, 12507, 12849, 28720, 28690, 0, 4551, 10545, 13174, 11778,
+    32839, 0, 6233, 0, 13103, 28735, 11414, 12810, 9638, 16937, 17325, 10762, 0, 13148, 9639, 10797,
+    0, 5102, 28750, 32802, 9739, 12995, 17331, 13196, 28717, 11111, 0, 28727, 32800, 12329, 10163, 8870,
+    12336, 28825, 13019, 32813, 20483, 8368, 9198, 17394, 10152, 9468, 9254, 32896, 17320, 0, 12659, 32843,
+    16530, 28714, 0, 12485, 13197, 32799, 16710, 13103, 8754, 10859, 12995, 28799, 12462, 28825, 16539, 8482,
+    32884, 0, 13082, 28717, 13050, 17375, 13116, 5607, 32800, 12341, 28820, 12562, 28779, 11999, 12451, 11764,
+    10572, 5318, 8781, 11654, 13019, 17250, 13020, 28742, 11686, 28741, 17299, 32781, 6242, 16688, 10859, 0,
+    28809, 0, 9077, 28803, 0, 17050, 12869, 17239, 4144, 12329, 11413, 12847, 28689, 0, 13076, 8359,
+    5934, 9518, 11273, 0, 12599, 32781, 5936, 10204, 4801, 13164, 16633, 8217, 0, 13054, 0, 11060,
+    11907, 5621, 0, 11096, 32863, 17219, 16721, 10262, 28746, 13064, 10850, 9077, 16526, 13107, 17295, 12047,
+    10845, 12816, 28718, 28748, 9908, 5092, 16700, 17011, 16648, 17263, 0, 28740, 12852, 0, 12799, 5111,
+    12967, 12645, 28733, 0, 9787, 17050, 10674, 0, 8721, 9610, 17082, 11648, 28798, 16634, 16400, 10506,
+    9983, 11010, 12525, 9297, 10883, 9074, 16497, 28800, 13062, 13066, 32854, 12995, 11469, 9771, 28763, 10191,
+    9564, 12395, 0, 10239, 11171, 10413, 32780, 5241, 12672, 32910, 13205, 11774, 4452, 5185, 16760, 20489,
+    10488, 0, 17168, 8397, 6466, 12299, 9879, 16515, 12011, 10450, 17319, 0, 28808, 32781, 8780, 11158,
+    16854, 20485, 8621, 12063, 0, 17298, 12564, 32859, 28796, 10853, 12768, 28708, 28695, 16426, 9377, 32908,
+    11465, 16462, 12500, 8975, 0, 6051, 0, 28719, 10251, 12429, 9318, 12792, 28823, 0, 11724, 13073,
+    12550, 28795, 9620, 28680, 12540, 13115, 8250, 0, 17241, 28716, 16635, 12293, 11654, 11993, 0, 28786,
+    28735, 11289, 10205, 16605, 4291, 16966, 16887, 12574, 10764, 11010, 10973, 32780, 5128, 28803, 8787, 28677,
+    9217, 32846, 9649, 9919, 12503, 6402, 16698, 12799, 11182, 0, 10711, 32909, 11158, 5111, 11374, 32803,
+    8276, 12468, 28697, 28739, 10254, 10504, 32781, 11791, 0, 28758, 13043, 28752, 17252, 16618, 28684, 13007,
+    28773, 12054, 11679, 5276, 0, 28804, 28731, 11468, 10742, 12502, 28797, 9909, 17282, 10490, 28798, 11114,
+    11991, 0, 8760, 0, 13209, 28795, 12828, 16742, 12992, 9331, 12956, 12701, 6189, 11703, 20484, 0,
+    12715, 10444, 12549, 10881, 6446, 28816, 12935, 6407, 12852, 8333, 12684, 28710, 0, 11692, 9593, 32909,
+    17174, 17089, 6376, 28713, 13040, 6257, 28695, 12731, 12692, 8480, 12586, 10692, 17151, 0, 28754, 11713,
+    28766, 16675, 12797, 28753, 28778, 0, 13133, 28806, 10775, 12504, 28784, 32780, 11062, 11312, 12917, 12876,
+    28743, 17168, 0, 12077, 16766, 32936, 0, 9367, 28675, 10868, 28770, 16846, 10573, 12804, 8704, 12788,
+    9620, 28796, 0, 8477, 12007, 11590, 9310, 28817, 6232, 12900, 32832, 13151, 28820, 11443, 28808, 28752,
+    0, 10513, 4891, 12683, 5658, 12945, 16697, 10882, 28726, 10273, 28800, 0, 11449, 12514, 28760, 17053,
+    28818, 16664, 13053, 13025, 16529, 28750, 28796, 32832, 11668, 16925, 17151, 12058, 16609, 12810, 28807, 0,
+    11611, 17207, 28778, 0, 17282, 28725, 5453, 13114, 0, 28706, 16834, 0, 12814, 20484, 12588, 20487,
+    13016, 28741, 0, 32903, 8785, 11158, 12863, 12322, 8759, 10974, 28721, 32920, 12702, 16463, 9985, 17110,
+    9832, 28796, 13079, 16699, 28756, 13005, 12790, 10728, 32923, 12658, 5644, 32884, 32800, 16635, 12468, 28748,
+    17162, 8384, 11759, 0, 5997, 12731, 12672, 13104, 12573, 11449, 28747, 12862, 17288, 11167, 28763, 28698,
+    12876, 10443, 0, 12660, 12672, 32898, 0, 12767, 9676, 12730, 13116, 0, 12607, 10074, 12573, 10743,
+    9984, 28782, 28772, 28750, 9087, 6394, 8479, 28701, 12514, 12959, 13139, 32866, 13096, 17290, 0, 10760,
+    11387, 17357, 0, 12312, 6400, 13004, 6235, 28808, 10220, 10705, 16636, 12305, 13164, 12359, 9533, 12551,
+    16663, 28752, 11657, 12456, 9649, 16835, 10250, 32819, 0, 32884, 32865, 11345, 13062, 10845, 0, 28730,
+    16421, 11590, 11219, 11967, 28745, 32800, 4155, 12548, 0, 10540, 0, 20481, 32800, 8218, 17378, 17207,
+    28754, 13029, 17349, 0, 8966, 5075, 17004, 10504, 9320, 0, 28681, 12809, 6362, 12754, 16855, 0,
+    11386, 32857, 32911, 32881, 8760, 28682, 0, 8424, 11096, 17355, 32800, 8517, 6446, 12920, 13017, 28779,
+    28780, 12884, 16608, 32802, 8254, 12847, 12515, 9387, 12768, 0, 12357, 0, 28713, 17375, 0, 12924,
+    28808, 0, 28785, 12972, 13031, 16746, 28810, 16603, 0, 12789, 12515, 10862, 17048, 0, 12825, 0,
+    32833, 9078, 10584, 16845, 28815, 10414, 0, 11603, 12501, 0, 32845, 0, 12873, 9375, 11778, 6129,
+    28716, 12849, 17388, 0, 32923, 28753, 11609, 16846, 10496, 0, 32857, 11056, 32923, 12382, 12438, 12989,
+    16910, 0, 9012, 0, 11544, 9129, 17173, 17204, 12634, 9001, 8470, 11572, 12991, 20483, 9666, 0,
+    16906, 32934, 32781, 11847, 12728, 12571, 9021, 0, 28690, 10279, 12480, 28784, 0, 12864, 12876, 13094,
+    11308, 12426, 16734, 12970, 12796, 32800, 9114, 11764, 12874, 11480, 13152, 32895, 12598, 8267, 32859, 9493,
+    12479, 16637, 12365, 17072, 28759, 11748, 9983, 28806, 9601, 9853, 6168, 32922, 32800, 9413, 0, 28712,
+    28694, 13123, 8480, 28777, 0, 17384, 10582, 10882, 9169, 32898, 12994, 5762, 5496, 12419, 12396, 6439,
+    11008, 28779, 17406, 20486, 28794, 12716, 12700, 0, 10269, 32807, 5797, 11161, 12850, 11425, 28722, 28689,
+    0, 9197, 28749, 12671, 10378, 6189, 5657, 11180, 12647, 12297, 0, 17172, 12682, 10868, 32895, 16745,
+    13113, 16932, 16858, 16972, 0, 9973, 8779, 11355, 12635, 10579, 12978, 28773, 11046, 28750, 5625, 10742,
+    5070, 12898, 12504, 32820, 28780, 17095, 0, 32869, 0, 11764, 32916, 32800, 9699, 13080, 16854, 28793,
+    12300, 28721, 12489, 12524, 10546, 17044, 0, 12659, 32916, 16752, 10534, 8963, 11909, 8414, 16945, 13032,
+    12561, 17320, 13151, 9609, 12419, 12828, 13068, 17151, 10283, 6211, 11587, 10278, 9235, 28688, 9360, 28759,
+    13065, 10457, 0, 11750, 17174, 16690, 16456, 0, 12503, 0, 8723, 17174, 32933, 9388, 11427, 32871,
+    9068, 8719, 32857, 12655, 13079, 12612, 0, 12585, 11087, 32800, 12412, 28684, 0, 6399, 12851, 10273,
+    28797, 28807, 12910, 8713, 9087, 11780, 10262, 0, 17209, 10850, 12811, 11639, 11742, 9231, 32807, 12300,
+    10676, 11167, 12776, 12468, 16593, 9365, 6168, 12503, 12492, 32800, 12424, 32898, 17162, 0, 10803, 5657,
+    11954, 9941, 17351, 28802, 0, 12839, 28790, 17160, 11342, 13089, 28729, 0, 12790, 0, 32833, 6045,
+    13193, 11742, 32911, 0, 28807, 0, 12394, 9601, 12945, 16621, 28716, 12822, 0, 10115, 28785, 28694,
+    8789, 12536, 28760, 8470, 13068, 13004, 28760, 11213, 32896, 32898, 28761, 0, 12729, 0, 8787, 12713,
+    12719, 28819, 28774, 12768, 28827, 17352, 32884, 20486, 13008, 12912, 12743, 28776, 32793, 16541, 32842, 32920,
+    0, 28791, 32775, 4160, 28808, 6343, 28745, 12647, 13097, 10552, 12910, 0, 13207, 9916, 13173, 16980,
+    12786, 28747, 10008, 13209, 0, 12969, 12792, 12695, 12930, 10208, 10205, 12462, 13068, 17298, 9020, 12898,
+    10044, 13080, 28815, 28812, 9372, 11748, 28734, 8424, 12972, 6122, 16883, 32826, 32789, 9248, 11956, 0,
+    6150, 10705, 13193, 28794, 16648, 11780, 13211, 12336, 20489, 0, 12959, 28779, 17030, 12606, 12838, 5495,
+    12765, 8789, 28778, 0, 8478, 17083, 0, 28727, 13162, 28738, 11182, 12428, 13073, 12452, 12839, 12487,
+    32816, 8479, 11460, 6037, 12631, 12694, 16570, 13187, 11908, 12407, 11991, 32922, 11947, 6056, 9001, 8233,
+    9302, 10871, 12479, 12809, 32921, 32807, 6309, 17082, 5108, 8469, 13026, 28718, 12603, 16569, 12678, 12813,
+    10283, 4347, 0, 12617, 12513, 0, 32853, 20489, 28801, 0, 20484, 12743, 17211, 10947, 9666, 11468,
+    28708, 9480, 8366, 9786, 0, 11939, 12549, 17319, 4332, 12309, 12058, 12791, 12942, 10206, 13112, 12744,
+    28762, 9807, 12067, 32775, 16480, 8739, 0, 10552, 17330, 32921, 8710, 9874, 12895, 28748, 10751, 32815,
+    12575, 0, 12616, 17129, 16492, 17123, 12574, 12393, 0, 28703, 16845, 10748, 32778, 8596, 12007, 13066,
+    10990, 11993, 28704, 10456, 28786, 12378, 17411, 10436, 28731, 28790, 9780, 0, 4382, 11774, 12588, 0,
+    28718, 28801, 0, 32778, 8592, 13187, 11481, 16647, 10947, 12917, 0, 10458, 12920, 32801, 8224, 6164,
+    16993, 28742, 28752, 0, 28806, 4678, 32859, 32923, 32936, 17281, 12657, 13018, 28771, 28717, 28761, 17265,
+    28784, 16681, 10872, 13170, 17010, 32790, 12546, 11349, 13193, 17252, 16990, 10751, 28802, 17286, 11543, 12692,
+    10670, 12670, 13207, 32801, 12294, 17251, 32832, 32804, 8604, 5048, 13211, 11481, 32819, 13187, 11228, 9818,
+    11735, 28741, 8964, 12779, 17124, 4758, 28768, 17320, 8909, 8422, 32921, 11340, 10743, 0, 17367, 0,
+    11712, 5064, 9918, 11910, 17093, 16451, 12993, 0, 12551, 0, 11606, 0, 8490, 12792, 28719, 11047,
+    12598, 32923, 32778, 4639, 16642, 12366, 11985, 12312, 28789, 16692, 17374, 13053, 10284, 9255, 11058, 12913,
+    32883, 5620, 28748, 28728, 28752, 0, 9247, 28675, 17083, 13172, 0, 12907, 0, 11769, 13092, 0,
+    12696, 28687, 6050, 10261, 10202, 0, 12984, 12996, 32788, 9985, 10882, 28763, 12814, 12968, 11303, 9846,
+    16779, 12994, 12669, 16881, 28750, 28685, 6180, 0, 28780, 16858, 9620, 10790, 20485, 0, 28808, 11050,
+    20490, 13087, 0, 11115, 10969, 12766, 0, 32890, 0, 28806, 5665, 28731, 11481, 28733, 5093, 0,
+    9240, 13116, 12729, 8787, 28774, 5325, 32898, 13161, 12924, 13068, 11991, 28806, 12442, 12971, 12419, 28705,
+    8788, 6400, 9012, 12552, 4842, 11643, 32842, 16937, 17172, 17217, 0, 0, 8583, 8887, 32878, 11447,
+    17094, 6185, 20485, 9554, 12547, 16570, 13115, 20481, 8329, 12720, 12572, 0, 0, 17092, 28741, 16648,
+    12367, 17246, 0, 0, 8853, 9041, 10494, 28785, 28787, 16935, 13018, 28748, 13027, 0, 9934, 28739,
+    11780, 16529, 10198, 0, 12792, 10828, 0, 28760, 6380, 8649, 28711, 17011, 13146, 11685, 17174, 10206,
+    9173, 32881, 13025, 12646, 32898, 10199, 9088, 17241, 9750, 28743, 12516, 17032, 32820, 28745, 9551, 10545,
+    0, 8479, 0, 12686, 9085, 10215, 10093, 9618, 16925, 11932, 5629, 17062, 10207, 10845, 12516, 13016,
+    11182, 0, 12563, 13127, 17147, 11985, 16993, 16858, 28821, 12996, 16618, 16427, 11712, 32922, 17201, 13044,
+    12407, 12884, 16846, 6055, 8296, 13116, 12406, 17285, 12563, 28739, 13212, 16857, 9635, 28795, 32830, 6299,
+    10812, 20486, 0, 10461, 10862, 16900, 9087, 11223, 32779, 4735, 28688, 13112, 28680, 16778, 11750, 28719,
+    13186, 11648, 10452, 32869, 12773, 9311, 13198, 32896, 9089, 16895, 9077, 32892, 20485, 0, 28805, 0,
+    12671, 13104, 9809, 10758, 28769, 0, 17320, 12839, 0, 12754, 13139, 28723, 8313, 13099, 6439, 12538,
+    13197, 16909, 16406, 0, 8678, 12825, 0, 9387, 12968, 28810, 16845, 17140, 28737, 12883, 32903, 10507,
+    12509, 16746, 0, 6121, 12826, 0, 16746, 12782, 13127, 13053, 32840, 0, 16857, 13005, 9846, 12872,
+    16492, 12707, 8777, 0, 8852, 5106, 13037, 13116, 28754, 13043, 13187, 28720, 0, 9745, 11148, 32845,
+    13176, 12370, 9387, 17078, 0, 5619, 20484, 10697, 9601, 16754, 28756, 28675, 0, 28694, 16420, 6184,
+    4754, 12996, 16755, 12775, 13065, 13103, 28790, 16658, 11596, 0, 4311, 9627, 11632, 28799, 9001, 16687,
+    12726, 16909, 28706, 12869, 28792, 12764, 13042, 12492, 10511, 13199, 17411, 28783, 11685, 13172, 10270, 16736,
+    9684, 0, 17240, 10734, 12416, 28675, 28769, 17148, 10990, 12540, 12933, 13115, 13127, 13208, 9846, 9562,
+    13136, 28796, 12588, 28693, 32844, 12682, 9377, 17237, 28763, 28713, 12600, 9973, 8421, 16838, 16743, 28823,
+    8910, 9264, 12838, 0, 0, 17168, 32846, 9955, 0, 0, 8368, 28728, 0, 28716, 8790, 12641,
+    16542, 13212, 8470, 8955, 28794, 12803, 32806, 16523, 9022, 32817, 12730, 28722, 8318, 13210, 4567, 16519,
+    6398, 13055, 12852, 13136, 9302, 9059, 13157, 11102, 11767, 9919, 6221, 17010, 32906, 9209, 5455, 12407,
+    28708, 8459, 28680, 12079, 6393, 12707, 11478, 13002, 32793, 0, 8964, 13182, 32775, 12481, 0, 12839,
+    12920, 0, 20487, 13148, 11926, 17083, 12719, 0, 11075, 28797, 5483, 32791, 9618, 10844, 0, 9975,
+    0, 12426, 12995, 0, 12391, 5645, 16924, 17253, 32828, 28726, 17161, 0, 13208, 12073, 28813, 28694,
+    0, 12993, 28791, 32818, 13104, 12995, 17079, 10506, 9564, 9684, 13055, 12900, 12670, 28678, 12420, 0,
+    28793, 17282, 6051, 32929, 28810, 13040, 9666, 11932, 9165, 9022, 9337, 28726, 4847, 0, 10023, 10559,
+    17288, 28717, 10573, 13156, 12371, 11056, 8719, 28673, 6397, 8769, 28728, 13128, 12767, 9152, 11640, 6271,
+    12958, 0, 11780, 13224, 11391, 13067, 9534, 32805, 4903, 8788, 4819, 16805, 6443, 12766, 12960, 0,
+    5645, 12556, 12504, 11403, 17331, 12672, 12730, 12955, 8899, 12803, 12617, 32790, 16936, 13163, 12324, 13194,
+    28746, 12624, 16614, 32858, 11889, 12504, 11244, 12575, 17072, 11115, 28770, 0, 12597, 16606, 11436, 12444,
+    12888, 12862, 12876, 8491, 12358, 11262, 28719, 28762, 28724, 4699, 32844, 28694, 10481, 12431, 12515, 12919,
+    0, 11374, 12838, 28698, 28808, 0, 13216, 17203, 10759, 9430, 12863, 28678, 12767, 8777, 13067, 13221,
+    12383, 16665, 12708, 12923, 13027, 0, 28826, 8423, 0, 12691, 12814, 9890, 12465, 4266, 28771, 28797,
+    0, 10254, 12335, 32837, 9302, 5611, 28755, 28800, 17147, 12319, 12777, 13096, 10803, 10776, 8364, 12696,
+    9612, 8479, 0, 0, 11480, 12620, 12040, 13035, 32803, 8570, 0, 12981, 0, 10806, 16855, 13151,
+    9663, 28777, 9586, 16419, 12588, 16420, 32922, 0, 28751, 12874, 28810, 12919, 16463, 9609, 28751, 9765,
+    17332, 17016, 13127, 0, 9293, 8490, 13222, 11843, 0, 10815, 12820, 9350, 28717, 9002, 12310, 12574,
+    12885, 11442, 11700, 20485, 10450, 28678, 11561, 11413, 9451, 17228, 28796, 12826, 5356, 0, 13172, 9728,
+    17378, 4517, 16528, 10872, 9992, 4954, 10497, 12970, 11590, 8414, 9088, 28679, 16925, 0, 9446, 12450,
+    28828, 28707, 0, 16578, 16698, 32906, 4472, 32911, 17367, 28684, 28799, 11058, 0, 13219, 8343, 13185,
+    10757, 5077, 16810, 0, 0, 10365, 20486, 0, 8581, 8711, 0, 13199, 0, 12803, 17173, 28809,
+    17157, 11075, 6456, 28819, 16936, 12407, 12936, 17078, 28766, 12552, 32872, 10141, 12900, 12010, 28819, 0,
+    8468, 17160, 28799, 32937, 12970, 17330, 0, 0, 17309, 12371, 12791, 13090, 13185, 12979, 10284, 8977,
+    9311, 10881, 8613, 11590, 32894, 32935, 12802, 11684, 17003, 5480, 28769, 0, 12840, 11114, 6457, 0,
+    16658, 10317, 9198, 0, 12576, 13068, 32934, 12683, 6356, 8368, 16448, 32867, 32830, 12768, 11657, 12679,
+    5674, 0, 32817, 0, 12995, 28796, 12803, 17173, 17091, 9219, 13044, 12600, 12702, 10262, 28784, 12936,
+    17398, 17117, 12551, 11458, 0, 5610, 11901, 32872, 5898, 10560, 10571, 17377, 12767, 28752, 0, 28788,
+    12480, 6180, 10608, 12791, 12454, 32819, 12910, 12718, 6059, 32872, 17220, 32870, 0, 17398, 0, 28770,
+    12564, 12549, 0, 10034, 16619, 6226, 13003, 13211, 17011, 17318, 12948, 0, 28770, 17095, 10406, 13068,
+    28719, 5295, 9506, 13210, 6235, 8420, 13217, 13056, 28787, 12079, 5584, 28752, 6103, 28712, 16450, 17388,
+    28789, 28742, 0, 17070, 12540, 17331, 12851, 12456, 11413, 32818, 13151, 6232, 0, 16588, 12729, 6009,
+    0, 32885, 0, 16463, 12466, 13103, 12969, 10683, 9657, 28781, 28715, 32936, 0, 12887, 12657, 13128,
+    12768, 9068, 0, 12775, 17361, 0, 28811, 28691, 0, 32935, 28729, 9367, 11160, 12875, 32885, 8637,
+    28748, 10623, 16834, 32904, 0, 0, 17095, 11102, 13223, 10271, 0, 12539, 28714, 32884, 32807, 12348,
+    28819, 0, 9686, 13217, 32833, 0, 10906, 28828, 16779, 28761, 28782, 9620, 0, 9948, 11631, 0,
+    16697, 12826, 8384, 12741, 11901, 13175, 8285, 8397, 9686, 28736, 12741, 28683, 0, 8682, 12068, 16930,
+    4822, 11181, 0, 32857, 12598, 0, 28772, 17003, 6401, 12789, 13188, 0, 6038, 11672, 12636, 28753,
+    6216, 4954, 12648, 28799, 9374, 32794, 13222, 12887, 8957, 17325, 17093, 11745, 9948, 28757, 12873, 28761,
+    12538, 0, 5785, 6387, 16925, 13076, 13187, 11457, 6217, 12707, 5079, 17100, 8285, 28828, 0, 11906,
+    28800, 12816, 32897, 10715, 32846, 12617, 8431, 28709, 28769, 12378, 13200, 17020, 10774, 28782, 12767, 28737,
+    16776, 12679, 28725, 8446, 13049, 10921, 9315, 0, 12744, 0, 11401, 9138, 0, 0, 0, 28757,
+    17332, 13075, 28762, 12660, 17365, 12517, 0, 5805, 12999, 0, 17361, 11741, 0, 32857, 12392, 9837,
+    0, 10836, 12863, 16677, 4346, 32896, 16777, 12596, 0, 32790, 11703, 13102, 9653, 9664, 32885, 13089,
+    13187, 28770, 32815, 10394, 12691, 32920, 16937, 16901, 6365, 12931, 28796, 8368, 12910, 12002, 13200, 9366,
+    0, 28719, 17168, 16755, 32777, 8572, 0, 0, 0, 32908, 16604, 11257, 11441, 32923, 9619, 28817,
+    9575, 6350, 17367, 28819, 0, 17092, 10578, 32780, 5173, 10138, 9388, 11703, 17298, 16540, 10878, 20486,
+    28674, 13073, 11005, 0, 0, 12732, 12443, 5679, 12384, 10682, 16779, 28732, 11099, 10366, 32778, 10979,
+    11073, 28753, 32918, 17369, 12330, 12775, 28808, 12840, 32907, 0, 12982, 28799, 12562, 11410, 11561, 17406,
+    28765, 12825, 9262, 32845, 12966, 32789, 28714, 12756, 13039, 12968, 28742, 12002, 16958, 12540, 17220, 28737,
+    12848, 28742, 13115, 13128, 8912, 13212, 28737, 17061, 9153, 28741, 8789, 9673, 28812, 4342, 0, 0,
+    12845, 11842, 12828, 28736, 17082, 12741, 0, 28715, 12787, 16606, 32904, 8982, 0, 12943, 10647, 32866,
+    11860, 9320, 12063, 28759, 11943, 12396, 32802, 12544, 28825, 0, 0, 10539, 9263, 17288, 11468, 28734,
+    12935, 13164, 9003, 6355, 12372, 28784, 16937, 28751, 12452, 12767, 8957, 8778, 32909, 11903, 0, 10415,
+    5059, 12324, 11984, 17361, 13039, 28761, 12382, 9593, 11443, 16505, 0, 0, 8326, 10761, 12444, 12921,
+    12714, 16895, 12476, 9655, 28762, 13155, 0, 0, 32937, 12479, 11741, 28767, 13158, 12309, 10553, 16526,
+    28771, 10836, 13031, 0, 13114, 32894, 11672, 12764, 10395, 4549, 28777, 32817, 28806, 9664, 12864, 8789,
+    16835, 16844, 32846, 12454, 13126, 28758, 8666, 8704, 12975, 13148, 8487, 0, 28758, 20487, 17230, 9684,
+    8480, 4693, 12633, 10374, 9986, 12582, 16686, 12732, 0, 28828, 12501, 12995, 12044, 32876, 0, 17089,
+    32936, 9057, 11429, 17004, 12791, 0, 9059, 17041, 12635, 12681, 17332, 17398, 4954, 8769, 10785, 10273,
+    11988, 0, 12984, 9676, 6235, 12987, 13044, 12441, 11940, 0, 17249, 13031, 28819, 16978, 0, 9666,
+    0, 0, 11056, 11414, 0, 17236, 6401, 12675, 8253, 11392, 28702, 28682, 16857, 0, 28689, 9008,
+    12760, 12971, 28711, 12540, 12634, 0, 0, 6009, 28760, 28770, 9684, 12810, 10284, 8766, 12921, 17132,
+    28694, 10561, 9446, 8650, 17253, 13212, 28796, 12002, 12404, 4817, 8313, 17404, 28802, 12384, 32868, 12828,
+    0, 32820, 32818, 12996, 16846, 9300, 11777, 32805, 4852, 9985, 8721, 11702, 28742, 28823, 12815, 0,
+    28767, 28814, 0, 32854, 28776, 10816, 17109, 32853, 12491, 0, 9256, 11104, 11910, 4947, 12444, 13030,
+    17404, 12820, 10859, 11158, 6275, 28795, 6400, 0, 16912, 9087, 28822, 11001, 11073, 28785, 28817, 9839,
+    12619, 12078, 11084, 13103, 9636, 6438, 5846, 28766, 0, 11985, 12042, 12324, 11956, 28740, 0, 9301,
+    13003, 6456, 12780, 32830, 0, 28716, 10144, 5047, 0, 12011, 17230, 12771, 11700, 12538, 0, 17282,
+    11608, 28805, 28760, 11938, 17014, 28781, 17093, 13135, 11028, 12837, 12815, 5519, 9258, 28782, 13066, 9078,
+    17150, 28787, 12360, 6139, 16674, 32852, 0, 17361, 32846, 8775, 12584, 0, 13222, 10570, 17124, 8368,
+    12993, 16619, 10581, 28790, 13007, 9301, 4855, 12812, 0, 13159, 28748, 11863, 13074, 8790, 16620, 0,
+    5462, 10584, 8966, 16844, 11449, 10862, 16729, 13101, 12816, 16845, 28689, 12827, 5075, 12815, 28730, 12792,
+    10460, 13104, 0, 6346, 12682, 4270, 17168, 9809, 12581, 17369, 10158, 16521, 8466, 12912, 12348, 10106,
+    17203, 6364, 0, 10880, 17218, 12515, 0, 0, 32832, 28756, 12684, 32934, 12847, 28789, 17002, 17209,
+    32803, 9167, 11160, 11686, 12418, 32883, 16500, 9862, 13054, 10570, 12900, 28714, 12609, 8790, 32833, 28734,
+    28809, 8490, 9900, 12907, 0, 10803, 12462, 12522, 0, 16771, 28820, 32802, 4306, 8251, 10598, 11984,
+    12594, 9518, 12871, 12873, 11324, 12588, 16729, 0, 12451, 12657, 9502, 28694, 13126, 12416, 0, 17081,
+    28775, 9473, 17168, 16765, 32935, 12775, 28702, 17003, 28715, 32896, 10641, 11288, 28674, 12404, 4594, 0,
+    32937, 17057, 17095, 17296, 16421, 0, 32790, 8577, 11395, 10397, 28811, 16492, 8445, 12777, 12348, 6022,
+    16814, 28728, 12920, 28796, 11413, 16766, 16500, 0, 11161, 32804, 8617, 0, 10805, 12672, 20488, 5139,
+    28795, 12640, 10507, 12647, 0, 12741, 28719, 9021, 0, 10242, 8491, 0, 10389, 13198, 12664, 10437,
+    12912, 32830, 8412, 12919, 0, 13030, 0, 11169, 8689, 6298, 12405, 8849, 11443, 12819, 28699, 32789,
+    28790, 9285, 11346, 32791, 28742, 17170, 5025, 0, 28801, 12498, 11158, 4977, 12058, 13116, 13173, 32885,
+    12333, 28679, 10896, 28680, 11080, 9687, 32909, 8470, 28785, 12359, 12671, 5477, 17147, 0, 28756, 9295,
+    12416, 28796, 17299, 13064, 0, 11466, 28735, 28701, 0, 12408, 12345, 9010, 12568, 28808, 10940, 17409,
+    28683, 13077, 10775, 12372, 12972, 17136, 17305, 12786, 17082, 16438, 5449, 12515, 5585, 17063, 16766, 11901,
+    12790, 12979, 13026, 28768, 10274, 28729, 16421, 28763, 32806, 11555, 9321, 11657, 4954, 0, 12983, 17013,
+    11561, 28761, 16463, 8412, 28681, 16743, 9599, 12743, 9900, 28683, 11179, 9256, 16700, 12575, 4471, 13016,
+    8988, 9376, 0, 13074, 28750, 16779, 0, 12504, 10425, 28760, 10497, 0, 16665, 12009, 8713, 9591,
+    32853, 32888, 0, 12679, 6440, 13145, 6466, 12465, 0, 12418, 12703, 16845, 9020, 32859, 12615, 17083,
+    17092, 28682, 12468, 17364, 11469, 16845, 12657, 28781, 8665, 8349, 11872, 0, 12312, 32820, 12767, 28815,
+    5650, 12960, 9357, 12616, 0, 32909, 12754, 28740, 10573, 17308, 28705, 17078, 32807, 5729, 12406, 0,
+    16855, 17247, 13136, 28770, 12994, 10394, 11074, 32792, 10582, 16440, 12884, 16857, 0, 10861, 12883, 16677,
+    0, 20486, 17315, 28689, 13169, 13194, 28771, 32919, 0, 9686, 16993, 9610, 32844, 10444, 0, 32814,
+    16588, 16966, 12707, 9307, 0, 9972, 12294, 8963, 0, 28684, 13209, 28722, 16989, 0, 5767, 16598,
+    9884, 13113, 28696, 28748, 28742, 12311, 0, 12442, 0, 8491, 12849, 11728, 28734, 9348, 12849, 0,
+    10513, 12644, 28775, 12703, 5666, 9687, 17123, 28771, 16674, 8343, 17050, 12300, 0, 12332, 10742, 28749,
+    9809, 32910, 10676, 28819, 10506, 5626, 11938, 13163, 28738, 0, 0, 32794, 8234, 12330, 17315, 0,
+    28799, 10138, 17287, 10710, 10870, 11553, 32923, 28823, 10571, 17240, 10413, 11105, 12843, 32905, 28688, 11102,
+    8547, 12886, 16971, 0, 13151, 13124, 28681, 12708, 6454, 12972, 16619, 0, 28824, 28798, 28819, 12489,
+    12586, 28807, 20481, 32870, 28760, 9459, 8865, 12871, 16583, 10444, 12753, 17230, 11289, 9939, 12584, 13151,
+    10103, 16698, 12621, 12695, 17043, 10698, 13162, 0, 28708, 13185, 10444, 11555, 5814, 28746, 9555, 12475,
+    12525, 12041, 0, 16461, 12522, 0, 12669, 12552, 13134, 8470, 10274, 12853, 17052, 13077, 0, 32792,
+    28748, 16776, 0, 12635, 8790, 11413, 9153, 0, 28754, 0, 12430, 10108, 12844, 12465, 11010, 28723,
+    32817, 28688, 8595, 17123, 9263, 28716, 28782, 28802, 17253, 11759, 12791, 0, 28761, 12608, 12646, 10331,
+    12645, 0, 16835, 11713, 16499, 12730, 9649, 17128, 28739, 20487, 17388, 28720, 0, 12768, 0, 10746,
+    13055, 9256, 28778, 28809, 28808, 13091, 17250, 0, 0, 0, 10532, 6463, 0, 12630, 32870, 0,
+    9364, 12408, 32904, 0, 28786, 0, 6465, 32846, 6297, 17378, 28782, 12663, 8404, 10240, 6133, 12875,
+    28733, 0, 12659, 10775, 8927, 28743, 8760, 5228, 32894, 5200, 32934, 16428, 28756, 17002, 8475, 0,
+    20488, 10001, 16993, 13078, 13114, 16822, 13113, 16606, 17247, 8322, 12414, 16608, 17399, 0, 17056, 28741,
+    12564, 12348, 16607, 13029, 17299, 32911, 11111, 11078, 0, 28750, 28800, 13091, 32893, 11701, 9736, 8359,
+    28788, 12419, 0, 9816, 12706, 12955, 8368, 6463, 11692, 11892, 12358, 6399, 28769, 16435, 6004, 4977,
+    13017, 28796, 0, 9467, 9630, 13211, 11985, 11780, 12923, 10079, 8427, 0, 13027, 28732, 32864, 9319,
+    10543, 11343, 28681, 12836, 9656, 10455, 32843, 8234, 32868, 12342, 13116, 9387, 0, 6457, 12323, 4983,
+    9365, 10923, 28769, 12574, 12964, 28700, 28739, 0, 0, 32871, 20490, 16608, 9861, 17320, 28681, 13038,
+    0, 16571, 0, 0, 6004, 0, 12993, 11074, 16526, 28722, 17053, 0, 8271, 32921, 0, 12381,
+    32816, 16913, 13152, 13128, 12648, 28795, 11469, 8344, 16936, 0, 0, 12897, 11946, 16990, 12490, 6454,
+    11971, 11572, 17135, 0, 13008, 16596, 12416, 9013, 12822, 12983, 5899, 32793, 13032, 9620, 17362, 0,
+    10676, 11410, 11956, 11181, 13221, 12478, 20484, 0, 17317, 28744, 0, 12430, 16983, 0, 12575, 28776,
+    11158, 16741, 11293, 11476, 28814, 11742, 5651, 6445, 12297, 9350, 28785, 12958, 32817, 13128, 0, 11724,
+    9553, 28697, 12418, 11645, 13055, 13005, 28813, 11295, 5495, 0, 16767, 16743, 0, 0, 13103, 5077,
+    8965, 5836, 16979, 0, 11460, 17378, 10989, 16756, 11302, 16451, 12995, 13131, 10546, 17329, 13197, 11481,
+    0, 11712, 28736, 0, 12336, 10975, 5796, 0, 6309, 11758, 12816, 32793, 17062, 11182, 28705, 16462,
+    12862, 0, 16451, 11047, 28703, 12944, 9610, 11160, 12907, 0, 0, 5890, 11865, 13199, 8470, 16485,
+    0, 16618, 12906, 32843, 12743, 11888, 28749, 4611, 28734, 16664, 32859, 28808, 12576, 12672, 32789, 17409,
+    0, 17360, 0, 12983, 10975, 0, 10545, 17361, 11750, 11654, 0, 28706, 32917, 17236, 17307, 16988,
+    11377, 10079, 16588, 12077, 10246, 5992, 9160, 28825, 11470, 10780, 11756, 12540, 10338, 12624, 28827, 11181,
+    11003, 0, 12849, 16594, 8414, 9608, 12488, 5064, 12906, 16514, 12862, 11519, 0, 11768, 28739, 28715,
+    10252, 13133, 16695, 0, 5622, 8414, 32781, 11809, 10493, 0, 16923, 12944, 10504, 28701, 16988, 11648,
+    13116, 9481, 12862, 12828, 16998, 12896, 0, 16856, 17282, 0, 13104, 12066, 12904, 9956, 32820, 9899,
+    0, 5076, 28687, 12584, 28797, 8713, 12972, 9566, 12945, 28694, 6020, 9022, 17207, 13019, 10094, 10198,
+    12875, 12372, 12684, 0, 28714, 12870, 0, 13038, 28798, 12947, 12549, 11566, 16598, 28824, 0, 32911,
+    12924, 28692, 11458, 13221, 16998, 28714, 12382, 28781, 32909, 12732, 6120, 9815, 0, 11449, 28726, 16959,
+    12464, 32841, 12420, 11608, 11700, 10883, 5461, 11594, 13114, 12406, 0, 12027, 11149, 11079, 8955, 10882,
+    12996, 10271, 12452, 20483, 11341, 4694, 12443, 9812, 16977, 0, 28703, 12504, 16774, 0, 10505, 10197,
+    8882, 16608, 12755, 11262, 16971, 20483, 0, 28785, 10190, 8773, 11170, 28766, 10569, 0, 12644, 28789,
+    28692, 0, 11955, 12755, 12323, 28683, 9617, 32898, 28806, 28714, 10701, 10611, 9900, 10108, 28706, 32794,
+    12971, 0, 9311, 12824, 11451, 28754, 12780, 12527, 9319, 12729, 8664, 28771, 8758, 10264, 28766, 32894,
+    12991, 12739, 12540, 9021, 11413, 12957, 12451, 16621, 5657, 10347, 28739, 0, 16620, 0, 12864, 13019,
+    28758, 0, 11158, 28761, 12467, 0, 16530, 28684, 16953, 10879, 0, 28768, 11518, 8358, 0, 0,
+    4470, 9515, 16621, 13114, 6363, 12564, 28769, 8722, 28695, 9308, 11985, 32857, 10204, 12872, 28703, 28738,
+    6223, 28755, 10704, 0, 5970, 12952, 0, 13139, 9007, 17290, 10642, 16972, 28741, 9553, 12076, 8723,
+    13067, 16620, 0, 13140, 12523, 13198, 12371, 17368, 11152, 9908, 5356, 4982, 0, 28680, 12501, 12876,
+    11460, 6394, 8902, 28793, 8359, 13205, 12583, 12384, 12777, 11312, 0, 12417, 11357, 12898, 17118, 12538,
+    0, 28712, 8752, 9319, 32777, 17019, 12671, 0, 13159, 20481, 6321, 13074, 12585, 12911, 20485, 28797,
+    12576, 17281, 0, 11386, 32790, 28682, 11985, 5431, 28808, 12522, 32911, 11657, 12791, 0, 0, 0,
+    16845, 8423, 32844, 16445, 11386, 16621, 8712, 32794, 8649, 9358, 0, 16886, 20489, 9078, 16461, 4267,
+    12298, 11775, 9919, 12418, 0, 12689, 10525, 0, 10095, 10705, 11102, 17385, 12591, 12537, 13080, 12616,
+    12668, 9050, 12041, 13044, 12066, 0, 16851, 12420, 12607, 12296, 16577, 0, 28687, 32897, 0, 17397,
+    12754, 28751, 12011, 16451, 12768, 9808, 5992, 28726, 0, 16696, 32843, 0, 12874, 0, 12752, 10459,
+    0, 12728, 9263, 10138, 12906, 12312, 9386, 0, 10137, 12839, 10149, 12809, 28683, 32779, 4792, 28793,
+    12662, 32855, 9547, 20484, 28706, 28689, 12872, 9830, 28681, 28744, 12767, 9320, 9374, 10360, 8470, 17150,
+    11443, 4562, 28712, 13176, 28715, 16833, 12321, 12643, 32891, 10882, 11602, 16778, 28823, 10670, 9085, 32804,
+    4597, 0, 16451, 13147, 28694, 9065, 12477, 12859, 17397, 32923, 17010, 11602, 16834, 0, 17199, 0,
+    12408, 8268, 16518, 32922, 12839, 12444, 12490, 13092, 6186, 12785, 10216, 28791, 6172, 17123, 0, 28745,
+    28768, 10010, 6402, 28733, 11379, 28810, 0, 8445, 16895, 12561, 0, 32903, 12527, 8479, 11602, 4693,
+    0, 12936, 13140, 6362, 32776, 4277, 9263, 8351, 9267, 12825, 8489, 16677, 12418, 28758, 9742, 10240,
+    5269, 12887, 13080, 17309, 11383, 12898, 32817, 12970, 12863, 12467, 8473, 12716, 0, 5050, 9649, 0,
+    12957, 10698, 11304, 9687, 12758, 13199, 12366, 17159, 16541, 28701, 12527, 13220, 8703, 11759, 0, 10814,
+    28715, 9387, 0, 9593, 0, 9374, 28735, 10546, 28675, 0, 6165, 12739, 0, 4812, 17081, 28773,
+    13031, 0, 32776, 4232, 11301, 11171, 17045, 12611, 16855, 17115, 12008, 16930, 0, 0, 16539, 12980,
+    32924, 10733, 28757, 0, 16844, 5618, 28685, 11393, 16650, 0, 8704, 0, 0, 16541, 16574, 0,
+    8949, 12055, 12064, 8704, 5422, 0, 28756, 8953, 9948, 10176, 20481, 28819, 0, 17230, 0, 32878,
+    28799, 12597, 9365, 32865, 13038, 12948, 13185, 0, 10414, 28805, 28806, 17408, 10848, 17241, 10706, 20490,
+    9686, 28706, 9256, 12907, 32911, 28718, 0, 28793, 12847, 28794, 10271, 11600, 9909, 10846, 4481, 16764,
+    16823, 12512, 32805, 9528, 4627, 12836, 8489, 4482, 28827, 0, 28686, 5438, 32872, 28757, 10976, 0,
+    17247, 13221, 28817, 16519, 9358, 11571, 32923, 16857, 28696, 16931, 12873, 11710, 11852, 9388, 9779, 16588,
+    16913, 28769, 9027, 0, 9068, 13024, 32794, 9420, 0, 28791, 0, 9504, 13085, 13007, 13120, 12631,
+    17014, 9089, 12964, 0, 12058, 11032, 13206, 32842, 11645, 28808, 11769, 0, 10872, 0, 11609, 13125,
+    12706, 4728, 28820, 28804, 0, 12592, 16588, 0, 13209, 12583, 9901, 16823, 28673, 9609, 28828, 0,
+    17411, 12430, 4400, 9606, 10816, 0, 0, 8559, 28707, 16779, 28792, 16456, 11181, 16699, 13050, 28681,
+    32803, 4435, 17124, 28717, 0, 12575, 16650, 16779, 0, 5478, 0, 11640, 13062, 9385, 8423, 16935,
+    0, 8478, 17217, 10556, 0, 28745, 8720, 10271, 10287, 32779, 4731, 0, 8405, 32922, 0, 32868,
+    5341, 11647, 12749, 10049, 28777, 28673, 28764, 9089, 12068, 10274, 9963, 0, 20487, 13098, 8606, 8884,
+    12732, 12671, 12583, 32791, 16857, 11003, 28722, 13188, 12468, 4822, 12564, 8956, 28796, 10850, 8314, 12755,
+    28739, 32833, 16936, 10927, 17141, 13219, 28756, 9010, 9246, 13140, 28750, 32807, 10228, 12055, 12785, 32937,
+    28736, 0, 0, 12527, 0, 9213, 28710, 12067, 0, 16542, 12078, 8305, 0, 10560, 8490, 13176,
+    12012, 13044, 8490, 11295, 13026, 9319, 32792, 11838, 17162, 9944, 16966, 10816, 0, 0, 13061, 12312,
+    12935, 12690, 32933, 11275, 6387, 17329, 12992, 8665, 12658, 16760, 11442, 0, 28690, 0, 9655, 28725,
+    9860, 0, 13056, 16530, 28766, 6172, 16666, 12391, 16685, 13104, 6365, 0, 17351, 0, 9067, 8486,
+    28705, 13019, 12002, 0, 28695, 0, 0, 16463, 32895, 16842, 28788, 12668, 16677, 11637, 13217, 12850,
+    12800, 12600, 12443, 20482, 9539, 12958, 13018, 12455, 28714, 16542, 12696, 13200, 0, 12513, 8460, 32814,
+    17147, 11149, 10410, 0, 28749, 10274, 16675, 0, 12930, 13001, 4871, 32845, 17281, 0, 32780, 11510,
+    6178, 8779, 0, 0, 9919, 12454, 10255, 16450, 10115, 11774, 16824, 12390, 28736, 28760, 10391, 12885,
+    6173, 0, 6216, 16609, 16518, 13018, 32805, 4797, 0, 12392, 12659, 12727, 28734, 12311, 6429, 16505,
+    10511, 17408, 32789, 0, 12490, 16825, 28818, 28779, 28729, 16588, 16922, 12356, 12408, 12684, 12823, 11668,
+    6178, 16615, 28682, 13006, 0, 12790, 32807, 8734, 0, 9974, 12756, 12320, 12455, 11111, 0, 13137,
+    28790, 12933, 0, 4883, 17285, 0, 10593, 12584, 0, 28692, 0, 28701, 32896, 13026, 9674, 0,
+    32817, 12336, 12872, 16988, 28774, 9318, 0, 16620, 28683, 12833, 12504, 28801, 13224, 28707, 9913, 8284,
+    17320, 0, 12888, 13054, 0, 16429, 32807, 8773, 0, 9367, 0, 13020, 16541, 28783, 9388, 17078,
+    9642, 12660, 32881, 16581, 12676, 10741, 12839, 0, 12354, 11049, 28718, 0, 0, 12969, 8778, 16621,
+    32830, 12526, 12336, 32936, 9634, 0, 17004, 12959, 11840, 10506, 16989, 28707, 16568, 28805, 12755, 12672,
+    8968, 0, 0, 13188, 32793, 28799, 28708, 5035, 28711, 5513, 13212, 13186, 32815, 28805, 12466, 12942,
+    16539, 12812, 9617, 20483, 17123, 8957, 16416, 12838, 8689, 16857, 13056, 28744, 10742, 28796, 12335, 17160,
+    12381, 8667, 28798, 9898, 16813, 11637, 12756, 11795, 4429, 32865, 13170, 32924, 0, 28805, 0, 17083,
+    28730, 28807, 12693, 8233, 9683, 0, 0, 12832, 0, 9302, 12528, 17082, 0, 5042, 11765, 16686,
+    8402, 0, 8722, 28704, 13198, 6393, 12891, 5265, 5962, 9685, 28697, 10676, 9375, 16830, 10457, 0,
+    0, 8666, 28673, 12346, 0, 0, 28678, 0, 12772, 12516, 28756, 28773, 8864, 12957, 12792, 8921,
+    9885, 28719, 0, 32792, 8788, 0, 28771, 0, 0, 28817, 16541, 16855, 12310, 0, 13147, 12528,
+    28771, 0, 28771, 13171, 12622, 6355, 9946, 28747, 9078, 6393, 28790, 9375, 4646, 16979, 20489, 28808,
+    12836, 9385, 28801, 13031, 12503, 0, 28694, 0, 4981, 8370, 12660, 12840, 16970, 6398, 13068, 28736,
+    11041, 16700, 13004, 17198, 0, 28710, 28709, 0, 16505, 13020, 12823, 12703, 13027, 13080, 13185, 16542,
+    28760, 12955, 17332, 17393, 11741, 12477, 32840, 8468, 12298, 28815, 6234, 9975, 8555, 0, 12311, 17161,
+    12945, 9385, 28776, 12910, 13150, 0, 10572, 28705, 16746, 10862, 17131, 12076, 20485, 9896, 12443, 28695,
+    13172, 6439, 28750, 16462, 8666, 12549, 12671, 9663, 28758, 0, 28725, 9538, 28682, 12536, 8424, 10191,
+    8480, 13126, 11004, 16658, 28725, 6020, 5808, 5658, 12455, 10145, 28696, 6394, 28817, 9245, 8469, 20489,
+    9985, 9358, 0, 6226, 32869, 12562, 5664, 12710, 8488, 12402, 10702, 0, 28739, 0, 0, 32878,
+    0, 0, 32788, 16908, 0, 0, 28802, 10968, 10804, 17083, 5326, 16518, 16411, 13103, 12756, 13122,
+    28731, 0, 9982, 12824, 12680, 0, 8490, 10507, 16463, 28736, 5618, 12591, 12586, 10561, 32892, 28710,
+    0, 28699, 12528, 28673, 0, 0, 10239, 13194, 4398, 12344, 12816, 12959, 5735, 12840, 10976, 10437,
+    9649, 13209, 16620, 9914, 12842, 9350, 16579, 12694, 12309, 0, 0, 12906, 13042, 17171, 0, 12574,
+    5334, 0, 28674, 16854, 28737, 8379, 17070, 28710, 12964, 13224, 12767, 0, 9264, 16649, 12443, 17387,
+    17408, 10495, 8778, 17314, 28776, 13200, 8723, 32924, 28785, 0, 16855, 10451, 11438, 32893, 17072, 28807,
+    8760, 12869, 8491, 28723, 10258, 28791, 11907, 17395, 16990, 28720, 11893, 12806, 12576, 17407, 17120, 4595,
+    0, 8368, 6432, 28810, 6457, 32806, 8717, 28792, 10461, 9686, 8491, 9584, 0, 11115, 10116, 13187,
+    28821, 10451, 0, 5069, 12732, 8453, 16643, 12873, 12776, 16698, 16588, 17016, 17068, 0, 32854, 0,
+    13224, 28784, 6435, 12960, 17004, 32815, 9089, 12527, 13083, 16966, 4983, 12609, 16517, 16443, 0, 0,
+    0, 16675, 12309, 9672, 8489, 12408, 13102, 11479, 28751, 12058, 17138, 8699, 9564, 10880, 28787, 9376,
+    28793, 12396, 32882, 13123, 4905, 0, 12707, 0, 12958, 28782, 0, 0, 16930, 10757, 12831, 16457,
+    12311, 16448, 6178, 32905, 0, 0, 12748, 8704, 32919, 9442, 10676, 28732, 17060, 16538, 32859, 10834,
+    0, 13050, 17151, 6354, 13200, 0, 28759, 28819, 9299, 9948, 12382, 13094, 6218, 12801, 12712, 0,
+    0, 28787, 13053, 9004, 16577, 9055, 28819, 32793, 11794, 9482, 12597, 12540, 16675, 11306, 12634, 32805,
+    8662, 16959, 17329, 13199, 11275, 16688, 13185, 10115, 17326, 0, 9357, 32820, 28760, 0, 8779, 28792,
+    11056, 10271, 28804, 17411, 0, 28804, 6115, 13212, 13052, 5114, 32792, 32780, 11526, 10370, 0, 8789,
+    9320, 9629, 16609, 6174, 13092, 28718, 16840, 13124, 10378, 13026, 28691, 28722, 12347, 11337, 4773, 8966,
+    12321, 8764, 12680, 32932, 11275, 16879, 17001, 0, 0, 11766, 11040, 11179, 32872, 32937, 0, 28764,
+    13223, 28804, 28683, 28818, 11004, 12311, 28759, 10413, 28779, 0, 13042, 17410, 9366, 0, 10975, 13116,
+    28775, 0, 16808, 11132, 17236, 13062, 17094, 4390, 28802, 12969, 13186, 16921, 13152, 0, 5135, 4700,
+    12464, 32884, 28704, 0, 11712, 0, 28822, 28774, 17218, 10162, 12599, 12742, 28751, 28751, 32937, 9926,
+    28765, 12420, 17147, 28775, 10793, 32805, 9229, 12539, 28764, 28819, 9981, 20486, 4197, 0, 10449, 28686,
+    9609, 12299, 11245, 12679, 13159, 0, 28828, 12707, 13062, 12078, 17378, 28791, 11523, 12528, 13222, 28694,
+    11457, 9675, 28777, 16507, 6292, 10881, 28680, 12874, 5675, 12477, 12563, 28722, 32920, 12468, 4258, 12336,
+    17202, 28744, 17305, 16454, 5488, 13092, 12356, 13169, 16989, 28726, 16673, 0, 16462, 0, 11181, 28814,
+    8713, 12538, 28772, 28770, 16774, 10394, 12533, 13184, 13169, 10517, 10859, 20487, 12942, 16539, 12515, 13010,
+    0, 11741, 0, 9585, 12810, 20485, 9348, 17016, 8490, 0, 12908, 12720, 32805, 12832, 0, 16998,
+    0, 12528, 32846, 32841, 28759, 0, 16448, 0, 0, 8704, 0, 9908, 0, 12550, 9311, 10813,
+    8294, 12064, 28687, 13196, 16539, 32885, 0, 12919, 11092, 13174, 8453, 12657, 12599, 28765, 16981, 9491,
+    12384, 17078, 0, 8700, 13089, 5978, 12660, 12775, 11984, 5339, 12492, 0, 11872, 8715, 9962, 12967,
+    32883, 8788, 12528, 12574, 12898, 0, 5105, 10878, 17203, 0, 12782, 11088, 12358, 13162, 17396, 13020,
+    16895, 28790, 13195, 0, 9263, 32854, 0, 9021, 12931, 16665, 16602, 16461, 12623, 6208, 12510, 0,
+    5617, 13018, 9641, 0, 28685, 28827, 28714, 12741, 8993, 13065, 13174, 28736, 32840, 5489, 17168, 4243,
+    17159, 10431, 8769, 32869, 10730, 0, 10868, 0, 10570, 0, 28791, 16807, 9020, 0, 11899, 11929,
+    10458, 28788, 17226, 12456, 8401, 32780, 11548, 13217, 0, 12718, 32803, 12332, 16597, 8422, 11894, 28753,
+    11937, 16621, 8756, 11112, 9563, 5740, 11909, 0, 6189, 17173, 8881, 16598, 16687, 8682, 10577, 17141,
+    28713, 0, 10255, 32791, 28826, 11102, 12899, 17071, 17226, 10868, 28818, 28726, 13187, 11724, 11899, 13128,
+    16462, 28753, 0, 28813, 16981, 13044, 13159, 32818, 0, 28724, 13102, 11177, 32895, 16853, 28816, 13073,
+    12616, 5827, 12943, 12996, 13063, 12574, 0, 10815, 13220, 9676, 13102, 11479, 13210, 9620, 32794, 28736,
+    17095, 17009, 0, 12888, 28728, 12837, 4825, 8475, 12420, 12348, 4405, 8760, 16618, 12950, 17331, 0,
+    28823, 0, 16440, 16814, 32807, 11792, 13101, 13138, 11029, 12344, 13102, 10816, 13128, 0, 8916, 5672,
+    0, 28812, 12635, 0, 20485, 13139, 17068, 9649, 13222, 8491, 0, 0, 11909, 12814, 32904, 16778,
+    0, 0, 12653, 28703, 11443, 28808, 5664, 0, 17010, 12588, 12989, 0, 12923, 13181, 10670, 17150,
+    10492, 28739, 32936, 11159, 28812, 11470, 16507, 17171, 17095, 8423, 16914, 17016, 11712, 11167, 13005, 5672,
+    28713, 6101, 0, 9987, 12551, 16903, 32840, 16539, 13150, 28771, 12736, 9479, 11312, 12632, 0, 6049,
+    12871, 17141, 13112, 28738, 11328, 12705, 28807, 9862, 16598, 12591, 0, 28698, 0, 16667, 28742, 11340,
+    16914, 0, 12322, 0, 17251, 32910, 8278, 0, 13158, 13224, 12720, 5987, 0, 10393, 13051, 12539,
+    6347, 0, 16517, 32829, 9967, 0, 4368, 28795, 4571, 16429, 12907, 17094, 12933, 0, 28766, 6000,
+    28819, 9346, 0, 0, 12538, 28740, 11087, 12876, 28823, 0, 4904, 0, 13075, 12589, 28818, 0,
+    12813, 16532, 12563, 16765, 32892, 11401, 12749, 0, 13101, 8389, 4396, 12347, 10758, 0, 12441, 16909,
+    9044, 12515, 12624, 13041, 12540, 28736, 13114, 0, 16579, 28736, 16753, 12450, 11181, 4596, 17081, 12395,
+    16448, 32852, 8600, 0, 8776, 28825, 0, 17411, 12864, 12945, 16649, 11401, 9846, 9971, 9890, 11384,
+    12600, 10958, 0, 12647, 12652, 12672, 8662, 12564, 16588, 28787, 0, 12968, 12900, 6357, 13224, 0,
+    28816, 12851, 9309, 5591, 12876, 28735, 8464, 13200, 10271, 11114, 8655, 12761, 12944, 32910, 12816, 0,
+    11092, 28746, 32866, 6448, 12321, 4337, 12958, 12766, 9271, 10429, 10450, 13140, 32881, 0, 28793, 5619,
+    0, 12539, 6018, 0, 4825, 12635, 0, 0, 12395, 9640, 16462, 12564, 0, 28787, 17072, 17331,
+    0, 28796, 13050, 9363, 16597, 0, 17230, 10247, 28818, 0, 32843, 28771, 13050, 17315, 32817, 9607,
+    12876, 11947, 5004, 10546, 6400, 8854, 10545, 17360, 9686, 16899, 0, 13104, 12533, 0, 28764, 9264,
+    16584, 11056, 12590, 11780, 13043, 10669, 12522, 12658, 12814, 8755, 0, 17365, 16517, 16923, 28771, 16420,
+    0, 0, 13050, 0, 28707, 13049, 0, 12885, 12748, 32841, 32930, 9377, 12920, 5056, 28731, 12582,
+    28706, 16456, 17013, 28737, 8953, 10400, 28814, 5608, 12972, 12909, 9900, 0, 9539, 10539, 28756, 28743,
+    0, 9980, 6063, 16923, 9311, 12696, 12344, 0, 12308, 28746, 17014, 12633, 5661, 0, 16675, 0,
+    17361, 16936, 12392, 10882, 17091, 32794, 0, 20486, 16618, 11063, 9366, 16892, 12921, 28766, 12970, 32936,
+    11898, 17325, 17004, 13222, 6390, 0, 0, 28726, 16666, 5927, 11047, 28712, 16518, 32816, 9973, 9372,
+    8662, 11440, 0, 17318, 0, 13151, 28683, 0, 9780, 0, 32805, 4784, 11003, 0, 0, 12868,
+    11686, 0, 9974, 32807, 6247, 12483, 10563, 12644, 20488, 10968, 11105, 28674, 8395, 10370, 9727, 13017,
+    11625, 10444, 0, 10815, 0, 28736, 11873, 12643, 12847, 9514, 11779, 28710, 12719, 0, 0, 0,
+    32921, 0, 17016, 16440, 4983, 10561, 12537, 17149, 16449, 0, 8750, 13152, 28795, 0, 28772, 12732,
+    12683, 12959, 0, 0, 12652, 0, 28744, 17159, 20484, 28792, 9666, 12732, 0, 32866, 28772, 17127,
+    5674, 0, 16982, 32843, 12636, 32870, 0, 17174, 28786, 12561, 11573, 10859, 5205, 0, 28765, 0,
+    28740, 17248, 0, 10505, 8910, 13113, 0, 28729, 0, 28727, 16606, 9219, 17240, 0, 28695, 10677,
+    11331, 13006, 20482, 12995, 6021, 8648, 10198, 0, 9641, 16699, 11939, 28682, 28718, 20481, 28796, 17229,
+    16585, 32819, 12731, 10714, 12547, 10831, 32871, 12492, 5104, 17316, 16696, 12660, 6123, 32807, 5941, 10177,
+    8649, 16936, 11481, 28769, 10803, 12587, 32931, 12744, 9620, 12563, 12382, 32871, 11935, 10207, 0, 13159,
+    12359, 32937, 12779, 28827, 11835, 9550, 16925, 12936, 16539, 12719, 13146, 16677, 0, 12863, 9386, 12832,
+    12801, 11895, 28738, 32874, 12803, 28765, 17080, 28792, 12748, 16770, 12611, 6213, 32917, 0, 28820, 17054,
+    16450, 32827, 28768, 28764, 17329, 9375, 10092, 32814, 11142, 4999, 13116, 0, 9539, 0, 28683, 0,
+    13092, 12600, 12476, 12657, 11413, 0, 12311, 32854, 6455, 4254, 16683, 32871, 6466, 28775, 6181, 16461,
+    4849, 32858, 11476, 32869, 0, 32854, 28797, 5482, 12049, 12872, 0, 10804, 13076, 5496, 5009, 12323,
+    0, 12392, 0, 17016, 12619, 12574, 20489, 28724, 0, 11130, 11303, 32805, 8654, 11742, 13028, 13142,
+    9904, 0, 12619, 32819, 9330, 10714, 0, 17136, 17281, 13004, 11865, 9077, 10551, 32794, 11769, 17064,
+    0, 12468, 12718, 0, 17239, 12453, 0, 28784, 28783, 16991, 17409, 0, 0, 13103, 32937, 13137,
+    10748, 16936, 20488, 16729, 28707, 32866, 8401, 12818, 12885, 12991, 11104, 0, 9563, 12958, 10115, 0,
+    16542, 17050, 32832, 28715, 4997, 12581, 0, 28765, 11639, 16457, 28684, 10843, 5096, 11556, 28687, 13056,
+    9657, 12432, 28809, 32888, 32779, 11193, 0, 10677, 12924, 16680, 12299, 28740, 11644, 10216, 20485, 32904,
+    16887, 12801, 12588, 16500, 28706, 0, 16835, 32842, 32897, 12984, 12869, 8474, 8667, 10023, 17239, 11394,
+    12996, 0, 12299, 5611, 10008, 20483, 9020, 17091, 0, 9434, 12611, 12652, 9152, 12462, 28742, 12619,
+    28692, 10788, 0, 0, 16462, 9553, 13039, 9502, 32817, 9130, 16805, 0, 9910, 32875, 13077, 32934,
+    20482, 17238, 28736, 11051, 16576, 12923, 12814, 0, 28710, 0, 12910, 6239, 11387, 28787, 0, 0,
+    12918, 12765, 32862, 17158, 6050, 13212, 11443, 12624, 28805, 28750, 8413, 32887, 0, 12428, 12691, 0,
+    12884, 12308, 28790, 10503, 32793, 32932, 32905, 8617, 28797, 6409, 17305, 11928, 12728, 28808, 6351, 28796,
+    10504, 16698, 12885, 12513, 10673, 13064, 32831, 16605, 12792, 32859, 17200, 12918, 5291, 4499, 0, 0,
+    16665, 8306, 9011, 0, 0, 11114, 11401, 28683, 17239, 0, 16885, 9376, 5496, 16919, 28774, 28752,
+    12609, 12359, 0, 28769, 0, 9785, 12540, 13008, 28824, 10704, 28719, 28786, 32817, 16609, 0, 0,
+    16449, 6393, 9665, 32791, 11346, 10881, 11910, 12607, 0, 32924, 9892, 28675, 0, 0, 12791, 28718,
+    13068, 12819, 12876, 32872, 11328, 5026, 16959, 0, 16529, 10975, 16693, 0, 0, 0, 6038, 12819,
+    12600, 10208, 12616, 11414, 11309, 28820, 8349, 12972, 13090, 12816, 10490, 12371, 28699, 6357, 28716, 12002,
+    0, 0, 16846, 12779, 16933, 10881, 9067, 13138, 10648, 12077, 28711, 9686, 9385, 12547, 32793, 11391,
+    8368, 17083, 16439, 8479, 5769, 12756, 0, 13120, 10972, 32819, 8480, 10049, 28800, 28825, 9674, 10779,
+    16461, 9021, 28700, 16988, 0, 28804, 12574, 12312, 10411, 9674, 28709, 28684, 16514, 4804, 5583, 11703,
+    32840, 32859, 12550, 28753, 17062, 13041, 8555, 17134, 28739, 28740, 12585, 12588, 0, 17122, 0, 10561,
+    12632, 12799, 11985, 17162, 10285, 10741, 17399, 10151, 32805, 8632, 12960, 9012, 28719, 28818, 11779, 0,
+    8424, 11991, 16450, 12012, 12767, 32888, 0, 8489, 12988, 16541, 11768, 9012, 17236, 16658, 8283, 28680,
+    9387, 8314, 28752, 32888, 12807, 0, 16893, 12564, 32856, 10507, 12632, 10794, 17161, 10282, 9374, 28807,
+    10859, 11539, 6205, 0, 10159, 12921, 32867, 0, 32872, 16621, 0, 28700, 0, 6217, 0, 8314,
+    9029, 17411, 13115, 10573, 0, 12968, 10870, 9017, 28776, 28820, 10406, 10504, 10215, 28757, 13198, 12728,
+    8750, 13066, 28681, 0, 13183, 12827, 12509, 17202, 11047, 11177, 0, 12039, 0, 12703, 17151, 28695,
+    0, 13062, 28760, 10583, 10445, 13127, 6226, 28817, 11657, 0, 4285, 28698, 0, 12923, 9318, 12947,
+    12918, 20485, 8318, 9745, 10969, 28731, 11442, 12944, 9863, 12958, 10860, 10879, 13149, 16930, 11309, 13067,
+    12918, 13210, 28779, 9571, 32780, 11492, 28772, 12862, 13078, 12855, 17004, 8965, 11309, 16609, 13124, 0,
+    11460, 0, 11829, 12727, 10116, 12079, 20488, 9816, 5318, 12851, 9948, 13146, 32820, 6437, 10974, 11093,
+    28785, 11096, 10862, 32781, 5940, 12971, 4722, 8231, 0, 10539, 0, 9666, 12719, 13221, 12736, 6463,
+    0, 12609, 13128, 32865, 12790, 16569, 16541, 16832, 5855, 28796, 11169, 11169, 0, 16846, 17309, 12619,
+    12669, 17354, 8555, 10794, 0, 11872, 28757, 10529, 13099, 12912, 28798, 5066, 12840, 6355, 8920, 16971,
+    28824, 0, 5768, 12787, 11346, 0, 8956, 9471, 0, 13168, 28741, 6188, 17093, 32884, 0, 28718,
+    13026, 8957, 16618, 10504, 12636, 8694, 12900, 12575, 5674, 9177, 0, 0, 11711, 16609, 4901, 17202,
+    12702, 17043, 10206, 13197, 0, 10794, 9641, 10496, 28754, 17409, 12765, 0, 9056, 9366, 28695, 28738,
+    12552, 10572, 32916, 11602, 10560, 0, 28724, 28692, 28709, 16583, 8750, 8966, 17004, 12692, 11703, 16911,
+    12969, 4728, 0, 0, 0, 12896, 12311, 8405, 12515, 12359, 0, 17250, 0, 0, 12324, 8256,
+    12948, 28816, 12585, 11302, 16587, 6344, 16539, 10197, 32916, 16598, 9641, 13209, 12619, 12486, 28814, 0,
+    11782, 13005, 17094, 10448, 9472, 12611, 16801, 11093, 32806, 5381, 6395, 0, 16492, 16459, 16430, 28756,
+    0, 11161, 12660, 8489, 12624, 28804, 12430, 12742, 0, 0, 10572, 5496, 12478, 16688, 11491, 32865,
+    0, 0, 12732, 12752, 9173, 12767, 16700, 0, 11149, 0, 8756, 0, 13148, 12873, 5944, 11982,
+    12936, 0, 11713, 12502, 12639, 11003, 5620, 16754, 11710, 5728, 5674, 0, 12619, 9371, 11742, 12562,
+    12381, 10676, 12390, 28794, 17305, 0, 28695, 11093, 28706, 17393, 28681, 13199, 10215, 11748, 32794, 10546,
+    16835, 28741, 12333, 28734, 12355, 8925, 6117, 12743, 13222, 32792, 17317, 28720, 9240, 9986, 28694, 12922,
+    12345, 0, 5928, 0, 16722, 0, 13028, 8658, 28800, 13038, 10787, 9077, 8913, 12789, 12984, 4321,
+    32791, 0, 28686, 16979, 28682, 8790, 0, 17282, 9445, 13004, 12544, 28791, 13150, 28704, 6410, 0,
+    13159, 12694, 28785, 28743, 12581, 12408, 13042, 10178, 32793, 0, 8352, 0, 12975, 12899, 5357, 12372,
+    10108, 28744, 17238, 0, 8571, 10704, 9264, 0, 10483, 0, 0, 28822, 12972, 28744, 6207, 28699,
+    13161, 12996, 28749, 5794, 9891, 12527, 12860, 0, 12735, 16462, 16582, 0, 6050, 28739, 0, 0,
+    8485, 0, 5993, 28768, 8424, 9010, 17308, 9294, 11457, 10214, 11844, 5098, 4552, 28730, 5802, 12300,
+    9897, 0, 12587, 5074, 12511, 12465, 0, 12529, 9645, 12683, 0, 12996, 4530, 16596, 28810, 28803,
+    16448, 12996, 12488, 9650, 32846, 16528, 10507, 0, 16920, 8312, 10619, 12710, 32909, 12540, 0, 12684,
+    0, 28739, 17219, 16618, 13195, 16950, 9131, 12791, 13028, 28679, 0, 0, 0, 0, 28809, 12934,
+    28728, 8876, 9022, 0, 13150, 16430, 9256, 5943, 28805, 16412, 4612, 0, 11333, 0, 12368, 28765,
+    28703, 28773, 12599, 13126, 13051, 13002, 28727, 12732, 0, 11702, 9357, 11171, 0, 28810, 5792, 10198,
+    13092, 12596, 12690, 10254, 32910, 16588, 9906, 13114, 12767, 0, 11779, 0, 5952, 9081, 12691, 13164,
+    28770, 16901, 12597, 16440, 0, 28674, 13078, 32817, 6180, 32807, 5848, 0, 10489, 16972, 16536, 9816,
+    0, 17388, 12563, 0, 0, 12912, 12564, 32779, 4803, 13113, 10546, 28696, 13176, 9909, 9974, 11269,
+    0, 8478, 12065, 16674, 13212, 28805, 17319, 32867, 28781, 5674, 12369, 17346, 28748, 12863, 10917, 12805,
+    6394, 16830, 0, 11414, 16667, 4844, 9675, 0, 12943, 8424, 10407, 13079, 10872, 28787, 13104, 12816,
+    11180, 0, 10659, 0, 28803, 28698, 32920, 11338, 11712, 9892, 6040, 0, 12348, 32820, 9510, 0,
+    16597, 12516, 9429, 6068, 28815, 13102, 28686, 17410, 17195, 28740, 13193, 28737, 12588, 0, 4983, 12636,
+    12552, 28722, 10393, 16444, 9146, 8423, 0, 16983, 8421, 32919, 6056, 10705, 12406, 28705, 12420, 0,
+    5673, 6345, 12787, 5589, 12983, 10136, 0, 0, 28733, 16699, 10741, 28826, 0, 20486, 8621, 0,
+    13064, 16753, 16498, 12299, 4885, 0, 28797, 11608, 17252, 13038, 13067, 17249, 12322, 0, 6261, 11478,
+    12982, 32921, 12975, 28717, 0, 12957, 5366, 28808, 12562, 0, 8666, 0, 28753, 12809, 10569, 16845,
+    0, 10263, 17278, 0, 17281, 28700, 13091, 11301, 32911, 9388, 0, 6144, 0, 0, 9674, 9648,
+    17173, 8655, 13159, 0, 28699, 12405, 10958, 16621, 0, 28674, 6186, 0, 0, 0, 9012, 0,
+    17172, 28750, 16766, 17197, 32833, 0, 0, 0, 9286, 12501, 6168, 12510, 0, 17194, 16720, 5613,
+    0, 5370, 8712, 11180, 0, 32828, 28735, 12391, 9263, 13125, 12552, 28789, 12506, 28679, 32846, 0,
+    12331, 0, 28694, 12850, 13088, 8956, 11954, 11301, 28734, 8962, 0, 16621, 0, 0, 11040, 12696,
+    12897, 32819, 32816, 11481, 12840, 17253, 8399, 32937, 0, 12415, 12634, 28798, 9676, 0, 16497, 16844,
+    13127, 12731, 0, 5971, 12768, 12380, 12984, 12320, 12843, 16571, 13018, 8723, 11690, 17016, 0, 0,
+    6463, 12619, 9919, 8850, 12924, 13028, 12360, 10699, 5098, 28715, 0, 0, 28801, 17378, 12659, 4977,
+    16965, 11170, 0, 28694, 11778, 12706, 0, 0, 12846, 13068, 11685, 0, 11601, 6444, 0, 17095,
+    16460, 28740, 32777, 4428, 12299, 8336, 8893, 9986, 28677, 11479, 5618, 28812, 13136, 9507, 0, 16587,
+    0, 17009, 12702, 11742, 12359, 10142, 0, 13136, 28709, 28700, 8733, 5747, 12983, 16620, 28704, 12395,
+    13212, 0, 0, 11169, 28757, 16604, 12456, 0, 32804, 4661, 12393, 16912, 12971, 12384, 12659, 12692,
+    6056, 12636, 10560, 13051, 0, 10253, 32807, 5701, 12780, 13056, 0, 12936, 12357, 16743, 11045, 17367,
+    16756, 0, 9918, 28815, 12585, 32895, 8723, 13101, 28739, 6466, 11476, 6391, 12959, 6393, 16571, 12323,
+    28697, 0, 28768, 32846, 12839, 13176, 13205, 4645, 28825, 11768, 28686, 17117, 0, 12569, 0, 17281,
+    0, 32924, 12755, 10736, 10187, 0, 4728, 12967, 13042, 32911, 0, 13134, 11447, 12924, 12696, 32937,
+    13173, 12492, 12968, 0, 12491, 9083, 12527, 16421, 0, 28748, 10281, 8942, 0, 12552, 12973, 11034,
+    28722, 16435, 32793, 5207, 12540, 0, 10049, 12912, 12899, 32816, 0, 32793, 17374, 28824, 0, 32792,
+    32831, 0, 9292, 0, 11947, 0, 9892, 0, 28730, 12728, 0, 9301, 11630, 12909, 0, 0,
+    28822, 32846, 16682, 28739, 32846, 11169, 8722, 9009, 28725, 28758, 8787, 12791, 6186, 13068, 10569, 28725,
+    32793, 12357, 0, 0, 20485, 9078, 11779, 9071, 9245, 4677, 6186, 10390, 13019, 20488, 12504, 12442,
+    0, 11756, 6365, 0, 11956, 28756, 11750, 6436, 9319, 16620, 12946, 10637, 28694, 0, 8752, 13188,
+    9375, 28739, 16650, 11756, 12690, 6049, 16588, 12525, 0, 28778, 13187, 28759, 8491, 12064, 16677, 13103,
+    12864, 0, 12792, 17151, 13097, 16853, 16687, 16698, 16736, 16666, 9388, 0, 16776, 12983, 16764, 12396,
+    10285, 12895, 13207, 0, 12465, 28783, 12617, 13044, 13054, 16687, 12011, 0, 0, 12658, 0, 13017,
+    28734, 10836, 12690, 17059, 9058, 12826, 28705, 16509, 0, 12526, 0, 0, 10860, 12310, 13091, 9059,
+    0, 17174, 12752, 28762, 12707, 5072, 6410, 16666, 12641, 0, 12370, 28757, 0, 8424, 8704, 12324,
+    0, 0, 11459, 5530, 13223, 0, 12382, 8307, 10327, 28789, 11757, 12420, 12972, 0, 12571, 16608,
+    28815, 5494, 0, 32882, 8680, 4931, 28719, 16700, 12586, 8667, 20486, 0, 11759, 16932, 13032, 12512,
+    8767, 12816, 0, 28817, 10670, 11946, 0, 12366, 12786, 13209, 12298, 8768, 0, 28816, 13199, 13116,
+    8917, 6179, 0, 13016, 12874, 17387, 32792, 16619, 12613, 28675, 28718, 12833, 16816, 11442, 10615, 12667,
+    10362, 13063, 32884, 8419, 6123, 12825, 8351, 9320, 0, 16777, 9503, 13174, 28791, 11442, 28764, 0,
+    28828, 9816, 5483, 0, 9930, 11135, 5585, 28685, 13173, 32896, 5042, 28704, 28778, 0, 0, 0,
+    12752, 13078, 8959, 0, 0, 12079, 28792, 0, 12996, 11188, 28717, 16767, 12737, 28769, 13187, 12012,
+    11999, 28715, 10512, 12683, 9547, 0, 32855, 0, 6410, 11382, 8619, 16542, 28816, 10557, 0, 0,
+    10545, 11439, 32817, 4820, 32846, 16447, 12586, 0, 12792, 16825, 8689, 9020, 11953, 0, 0, 4512,
+    12299, 16596, 0, 0, 11838, 0, 32807, 16534, 28753, 8393, 8366, 12522, 8776, 10573, 12552, 10363,
+    12058, 28771, 16683, 0, 16518, 5922, 17359, 28684, 17248, 13113, 5650, 0, 28734, 9517, 0, 4311,
+    6393, 16686, 32794, 12040, 12765, 12002, 10208, 32794, 28737, 0, 28704, 0, 0, 12467, 12593, 0,
+    28827, 16840, 17220, 11384, 0, 17330, 16542, 10191, 5042, 8461, 12870, 8577, 12899, 0, 28689, 28705,
+    16462, 12898, 12730, 9909, 10272, 32844, 12959, 13019, 17082, 6448, 0, 8649, 5055, 12645, 11187, 0,
+    8997, 10978, 13076, 9547, 17229, 13102, 6145, 16440, 5363, 12836, 32856, 12972, 12958, 28710, 10430, 17228,
+    11600, 20489, 28716, 4708, 4632, 11956, 11999, 16909, 6354, 6043, 17298, 9965, 0, 0, 17332, 4949,
+    6179, 12632, 28703, 4567, 13019, 12394, 12574, 0, 12058, 0, 32779, 4762, 0, 10247, 0, 12503,
+    12777, 11489, 9209, 8658, 9846, 12695, 0, 12001, 0, 0, 12751, 32882, 8707, 13104, 13107, 17395,
+    16430, 10392, 10869, 13030, 0, 32898, 32937, 13211, 11478, 12383, 9310, 10044, 12970, 10872, 28726, 12839,
+    32870, 28683, 13103, 13139, 0, 0, 0, 16778, 32778, 10680, 12981, 12335, 32929, 32923, 0, 8491,
+    13042, 12359, 5059, 8488, 0, 11780, 32846, 12512, 12606, 0, 17132, 28725, 13159, 12799, 0, 32792,
+    0, 10316, 10751, 28798, 12586, 8996, 13208, 28682, 13222, 32793, 9375, 12696, 11468, 0, 8657, 28708,
+    8405, 16461, 0, 8832, 9778, 28694, 28717, 12725, 32794, 28744, 16530, 28764, 13206, 8479, 20485, 28732,
+    9366, 0, 20482, 13163, 12825, 10956, 5746, 17409, 28768, 12678, 12984, 8411, 13149, 0, 13027, 13088,
+    0, 16695, 10607, 11767, 11378, 28792, 9255, 16694, 13113, 0, 12984, 16886, 32840, 5327, 0, 13217,
+    4309, 8707, 0, 12000, 28788, 9445, 11168, 32780, 8714, 10751, 4966, 28743, 0, 11595, 28703, 13104,
+    0, 28676, 0, 12384, 4949, 12960, 11539, 0, 0, 12310, 16856, 16578, 28781, 32894, 0, 17209,
+    28784, 8272, 17332, 28777, 13107, 9349, 17009, 32835, 8957, 28792, 28735, 5334, 32802, 8548, 11254, 0,
+    17331, 13054, 16920, 8489, 9918, 10803, 9193, 28773, 16608, 9068, 12408, 16993, 12730, 11182, 16449, 28801,
+    16835, 17410, 9462, 32794, 32777, 10602, 16519, 28720, 10843, 12679, 8402, 28755, 16972, 9975, 0, 16900,
+    0, 8483, 5830, 5003, 0, 32893, 32830, 0, 32894, 32857, 9062, 12668, 0, 10759, 0, 28736,
+    28748, 32777, 4379, 28800, 16519, 0, 10524, 32883, 6021, 10461, 10184, 5654, 9809, 12077, 17044, 12528,
+    9564, 12671, 28743, 12492, 32845, 28806, 28732, 12518, 0, 28770, 12826, 10400, 16451, 12607, 12357, 5858,
+    4822, 12058, 10206, 12672, 0, 8787, 11780, 28735, 11907, 16831, 28751, 0, 12468, 28691, 28684, 12346,
+    12709, 5461, 5922, 28791, 12587, 11252, 11050, 16965, 11889, 13169, 13015, 11434, 28820, 32924, 28817, 8788,
+    10412, 17388, 32819, 9907, 9428, 5351, 12441, 12296, 12310, 17157, 0, 16657, 0, 9086, 12667, 11246,
+    13103, 6214, 9227, 0, 28751, 6178, 9144, 8920, 28681, 12702, 28798, 16540, 11142, 9915, 28731, 32820,
+    0, 12921, 12947, 13212, 0, 28749, 9606, 12972, 12636, 12900, 13138, 13065, 13186, 11947, 28820, 12764,
+    12515, 28762, 17195, 8643, 16498, 32781, 6066, 0, 12322, 6386, 12719, 16845, 16831, 28778, 12064, 4536,
+    28715, 8712, 16517, 16677, 0, 12767, 6043, 0, 0, 8413, 12453, 10405, 32910, 16843, 32896, 5987,
+    0, 8779, 28774, 32846, 10264, 12489, 8476, 16672, 32843, 4602, 9252, 13116, 10152, 12994, 0, 12335,
+    0, 28760, 12512, 12935, 28683, 0, 0, 12930, 9974, 12636, 10145, 16427, 9003, 28768, 9511, 0,
+    16815, 12612, 9087, 28726, 0, 0, 11741, 28768, 12310, 28727, 12984, 28715, 16605, 9986, 13175, 9779,
+    12551, 0, 12744, 28695, 28781, 8776, 5340, 28739, 32933, 6015, 11746, 11984, 12634, 28758, 28797, 5481,
+    28725, 16908, 28791, 16844, 12360, 12065, 12346, 0, 28802, 12587, 13222, 0, 11146, 0, 16777, 11387,
+    9984, 17332, 9615, 8703, 6390, 32780, 5294, 17122, 8712, 5613, 12960, 12622, 28734, 4311, 10497, 10741,
+    13098, 12946, 28749, 0, 17393, 32908, 0, 17220, 0, 0, 28727, 4786, 12593, 10437, 11599, 9265,
+    12845, 0, 0, 12683, 13115, 5567, 12789, 10072, 32803, 4404, 11989, 6180, 28760, 17082, 0, 9545,
+    8413, 11776, 16755, 12453, 10872, 0, 16774, 12947, 16616, 28714, 32855, 11906, 12432, 11136, 8478, 12359,
+    16879, 20481, 12699, 28722, 12462, 17358, 9724, 8334, 9348, 9311, 28691, 9253, 17279, 16538, 12311, 17219,
+    28731, 28680, 17220, 12523, 10517, 9147, 12451, 28688, 11713, 10750, 13018, 28696, 32868, 16808, 16932, 16959,
+    11031, 0, 10659, 12559, 6353, 9619, 16539, 16763, 0, 28752, 28724, 32919, 10871, 11712, 9510, 16609,
+    9209, 5069, 28683, 32790, 28689, 13106, 11603, 16895, 11711, 28761, 10112, 16854, 0, 12444, 0, 13020,
+    9077, 17072, 28730, 8584, 8721, 12035, 12692, 28807, 12827, 16903, 8790, 28699, 0, 0, 13124, 0,
+    12680, 12802, 12916, 16460, 20486, 32897, 0, 8701, 16825, 28759, 0, 0, 13067, 17347, 8621, 12944,
+    0, 17161, 12687, 0, 32856, 32892, 13052, 32910, 13128, 16664, 12668, 28677, 5572, 10758, 13066, 9972,
+    28727, 28822, 0, 28708, 32937, 28759, 12795, 28767, 17387, 28730, 10365, 9315, 17062, 4700, 6145, 5666,
+    0, 28714, 0, 13114, 28673, 12725, 12395, 0, 0, 10815, 5569, 32879, 8395, 12515, 10108, 9008,
+    0, 0, 17407, 10872, 28828, 28755, 0, 0, 12864, 12994, 12079, 12502, 32936, 28753, 12456, 12826,
+    32881, 11546, 12996, 13090, 9649, 11767, 12534, 4633, 28735, 16831, 28739, 0, 0, 0, 12987, 32855,
+    17021, 28758, 32859, 5874, 32856, 32906, 12588, 6048, 12610, 17378, 12788, 0, 9517, 12550, 9982, 12633,
+    9965, 17161, 11114, 32857, 12776, 5658, 17290, 16526, 8456, 12575, 0, 12775, 13020, 28805, 0, 0,
+    32908, 12921, 9377, 10703, 16539, 28681, 0, 32858, 28820, 8475, 28719, 0, 12693, 32855, 12932, 12798,
+    28746, 8485, 11844, 12348, 8453, 9088, 8338, 12418, 17251, 10736, 28726, 11984, 12645, 0, 28822, 10797,
+    0, 12764, 0, 28693, 6321, 32819, 0, 12900, 5987, 0, 12755, 12741, 28720, 11114, 10270, 12979,
+    28707, 5001, 28827, 0, 28685, 32882, 17309, 13041, 0, 28705, 10145, 16461, 28789, 16762, 12911, 28693,
+    10578, 0, 9649, 5479, 12825, 0, 17141, 32843, 28737, 13104, 8788, 11357, 28828, 9547, 28822, 11980,
+    17299, 0, 12456, 0, 5361, 12893, 0, 0, 28717, 10072, 0, 17298, 28736, 16542, 28760, 20487,
+    20482, 12369, 16462, 17101, 17132, 8414, 12828, 28781, 17251, 32781, 11825, 10716, 0, 12936, 12851, 12706,
+    28748, 10582, 8760, 0, 28684, 13092, 13207, 16834, 0, 28826, 17384, 12360, 0, 8658, 28680, 17094,
+    28786, 9385, 12944, 0, 0, 28696, 0, 0, 32801, 10011, 28678, 32870, 12912, 20487, 10215, 28781,
+    28817, 6437, 0, 0, 28678, 9343, 0, 12801, 12948, 13149, 0, 0, 10550, 8552, 16936, 9975,
+    17318, 28821, 32892, 10373, 5584, 32894, 9743, 32828, 5264, 5809, 5998, 0, 0, 10760, 12867, 12440,
+    11777, 12563, 11469, 12549, 12789, 16461, 12979, 8478, 13005, 0, 11684, 16735, 10532, 11468, 20483, 17387,
+    12848, 16912, 10805, 12507, 16857, 16930, 13222, 16596, 20483, 12414, 16825, 28814, 0, 5894, 11413, 17218,
+    13089, 0, 0, 28827, 28707, 11410, 11993, 16570, 8461, 5705, 12777, 11678, 16729, 12826, 12871, 11014,
+    12415, 5907, 9948, 16965, 28736, 17377, 28779, 8776, 13053, 12968, 11059, 12429, 17387, 12056, 0, 0,
+    12592, 12932, 12730, 0, 28738, 9468, 13042, 8790, 0, 11104, 9789, 32776, 10296, 4401, 32872, 0,
+    17384, 0, 28742, 12356, 16506, 28732, 28733, 17124, 12848, 8993, 11937, 0, 8582, 13092, 12514, 0,
+    10563, 0, 9217, 28775, 20487, 8776, 28742, 28802, 12394, 32936, 16767, 28743, 9022, 16540, 11170, 12622,
+    0, 28778, 32819, 12922, 5292, 12827, 28680, 13188, 28723, 6411, 12010, 16833, 5894, 10240, 28817, 10428,
+    12707, 17072, 0, 12348, 6410, 28769, 0, 0, 8784, 16507, 13158, 13089, 0, 16428, 28774, 12045,
+    28730, 10114, 16972, 0, 4598, 32872, 10144, 28783, 17282, 32885, 16597, 32897, 12566, 12695, 12762, 12931,
+    28691, 11059, 6431, 0, 28675, 9301, 0, 12455, 0, 16852, 13066, 12886, 28784, 12623, 9817, 32804,
+    9214, 17376, 10150, 12575, 17044, 32781, 6238, 10853, 5911, 12953, 28772, 32858, 0, 10750, 32831, 16608,
+    28726, 32818, 20486, 28761, 12908, 16778, 28737, 32921, 32831, 28689, 32891, 12720, 17398, 28711, 13079, 9854,
+    10853, 0, 0, 0, 12431, 28771, 9059, 13115, 0, 12010, 28747, 12850, 28785, 12468, 28715, 12324,
+    12619, 12919, 9984, 9078, 12682, 0, 10412, 12768, 10506, 17014, 12732, 13200, 32842, 28750, 16856, 12537,
+    12645, 12899, 12644, 0, 8768, 17151, 28734, 0, 16942, 10994, 28827, 16515, 10883, 32814, 5987, 12799,
+    0, 5946, 12789, 17241, 6210, 28771, 0, 9011, 32819, 12552, 12755, 12346, 0, 28795, 32846, 4280,
+    12560, 9518, 8768, 12825, 12873, 32885, 28771, 28800, 11700, 6389, 28713, 16755, 28741, 32845, 12887, 12816,
+    8359, 9085, 12809, 13223, 0, 20484, 28778, 12887, 0, 20490, 16463, 12946, 0, 10806, 5767, 13220,
+    32909, 16699, 0, 0, 12038, 5486, 32921, 12713, 13064, 0, 17230, 32906, 13199, 9348, 11240, 32793,
+    28815, 12645, 16925, 0, 11152, 0, 12323, 0, 10571, 12681, 10460, 0, 28740, 11057, 12851, 10506,
+    12828, 0, 12848, 11182, 12931, 32778, 4681, 16965, 0, 28722, 5069, 8940, 8847, 28759, 17364, 11934,
+    32843, 28745, 12623, 12324, 28815, 0, 32794, 13077, 13017, 9618, 0, 0, 16925, 28822, 10514, 0,
+    11182, 6394, 28820, 32893, 32884, 13220, 0, 4343, 10444, 10407, 0, 32858, 0, 0, 12336, 13025,
+    11435, 5763, 32894, 17172, 11785, 5608, 9038, 13077, 16698, 9917, 16852, 17094, 12633, 16462, 0, 17016,
+    8750, 16698, 8466, 13140, 12858, 28799, 5590, 28826, 11481, 12395, 0, 12977, 13016, 0, 13005, 11935,
+    17246, 17123, 10461, 12514, 13086, 12825, 12396, 32861, 17072, 13078, 10254, 12778, 0, 9492, 32806, 5573,
+    0, 10816, 28774, 16720, 0, 10114, 0, 4880, 0, 5928, 0, 12501, 32826, 28785, 10709, 28802,
+    9845, 0, 5665, 28812, 10583, 9142, 12312, 0, 16902, 12323, 0, 32895, 28824, 13073, 12552, 0,
+    17251, 12972, 0, 11833, 12768, 28793, 11267, 11778, 28797, 5666, 0, 17009, 13146, 0, 28748, 12717,
+    28771, 28709, 12832, 16497, 9361, 16824, 12492, 20484, 11395, 0, 32805, 9827, 0, 6440, 12680, 28816,
+    5254, 6232, 13150, 12443, 28769, 28747, 32846, 6349, 0, 12624, 5168, 9908, 32898, 10843, 17299, 11171,
+    17128, 16700, 28781, 0, 28825, 9672, 17239, 0, 10745, 28746, 0, 10539, 10217, 9367, 6078, 28812,
+    28727, 32869, 8745, 6301, 12500, 28793, 28756, 17298, 12916, 12708, 28674, 17092, 20484, 9773, 28770, 10449,
+    16980, 32775, 9716, 17240, 13128, 16446, 12789, 28802, 28676, 16683, 0, 28717, 13088, 0, 0, 8390,
+    12730, 28781, 0, 8789, 12898, 13032, 0, 12671, 0, 9355, 0, 0, 12767, 16606, 6320, 12852,
+    9853, 32829, 0, 28793, 28754, 0, 11769, 10852, 12788, 28818, 28717, 17162, 12320, 5361, 17386, 9619,
+    28690, 17398, 10072, 11275, 9421, 11938, 10710, 28683, 12516, 12478, 17241, 28750, 12860, 28725, 28718, 11611,
+    11469, 9481, 12776, 0, 13091, 9320, 12331, 16991, 17135, 12956, 12466, 17411, 12944, 0, 13113, 17093,
+    0, 32781, 6302, 28715, 16999, 9964, 12418, 17308, 12031, 11468, 0, 32868, 11043, 0, 28805, 28712,
+    9217, 28769, 13019, 32845, 16495, 0, 28755, 5458, 32820, 8712, 16526, 28740, 9675, 12804, 12489, 9686,
+    0, 28692, 12741, 11479, 28814, 17253, 8332, 0, 12358, 12935, 13055, 0, 10583, 17053, 17410, 6328,
+    12947, 0, 10161, 32909, 0, 12694, 16700, 11341, 10159, 10161, 13102, 11303, 11866, 17219, 0, 0,
+    28798, 12956, 11414, 12922, 16893, 9218, 0, 12574, 10483, 28746, 0, 32778, 8886, 17317, 0, 28743,
+    13067, 13186, 12994, 8719, 0, 12968, 0, 9561, 28780, 12408, 28779, 0, 28819, 10043, 12907, 0,
+    0, 11713, 0, 16607, 0, 0, 12427, 16852, 0, 12717, 0, 32820, 12837, 0, 8777, 11111,
+    16842, 0, 4983, 0, 16966, 12812, 12905, 12850, 0, 12476, 17015, 0, 11779, 12588, 10450, 32892,
+    32885, 12918, 12801, 6411, 17061, 11105, 10448, 0, 0, 28687, 12717, 32905, 16750, 9181, 17251, 28741,
+    17162, 0, 9387, 12896, 17149, 28801, 12416, 10160, 12935, 13120, 10748, 28755, 11779, 12947, 0, 10160,
+    12516, 16530, 28721, 0, 8440, 12813, 12348, 28777, 12597, 12790, 11414, 12678, 0, 28737, 5491, 13198,
+    12576, 28818, 12659, 5494, 10215, 9816, 32897, 9918, 28797, 13054, 12562, 10198, 13158, 12432, 0, 28719,
+    28760, 0, 28691, 28797, 11655, 28715, 11402, 16433, 12468, 12909, 12360, 13029, 13079, 13000, 13066, 11441,
+    17330, 17279, 32933, 0, 8359, 11346, 13112, 12563, 16844, 28768, 32937, 32872, 12907, 28734, 0, 0,
+    16778, 10832, 8320, 6044, 12575, 28777, 12947, 0, 28822, 28802, 28757, 28768, 0, 12515, 0, 0,
+    11694, 13212, 9059, 12431, 13198, 12800, 12522, 9357, 17004, 28742, 12633, 12852, 6456, 12708, 28788, 28763,
+    13043, 0, 11402, 28772, 28769, 10883, 12718, 5563, 10584, 28802, 9900, 5911, 12947, 0, 11047, 28779,
+    28809, 28717, 17331, 17080, 13066, 28792, 0, 9321, 12491, 16858, 13163, 32910, 0, 20481, 12738, 12774,
+    0, 13054, 32881, 11713, 12824, 10199, 8577, 12955, 11113, 0, 28828, 10197, 12809, 10203, 0, 28819,
+    12502, 12936, 13211, 28720, 28753, 12431, 10516, 17297, 0, 0, 8477, 11552, 12336, 13051, 13146, 10576,
+    0, 16856, 11711, 17309, 32856, 0, 12522, 16540, 0, 13186, 9599, 0, 5496, 12661, 6130, 16933,
+    0, 12812, 13024, 10198, 32846, 8676, 5657, 11087, 13174, 32895, 0, 10735, 6466, 28761, 4919, 12908,
+    12887, 0, 12923, 6463, 17369, 17196, 0, 13043, 12708, 12591, 6189, 17092, 16429, 13210, 17123, 16729,
+    16844, 32840, 16914, 0, 13211, 11829, 8577, 11240, 11161, 17062, 0, 8852, 28742, 0, 13146, 28814,
+    11115, 32828, 28818, 13066, 13032, 12032, 10168, 12716, 0, 11774, 10198, 12860, 12502, 13128, 5672, 20488,
+    11713, 10512, 10198, 13164, 28775, 32807, 6133, 28760, 32893, 11467, 0, 0, 9909, 12662, 0, 8582,
+    12452, 13020, 0, 11837, 16857, 12948, 12396, 17172, 13067, 10209, 9088, 16696, 13146, 32820, 4561, 17094,
+    0, 13063, 0, 0, 0, 10322, 16687, 28776, 28726, 32869, 11114, 28722, 0, 4597, 5159, 28791,
+    0, 13119, 12933, 12826, 28751, 12932, 32871, 32934, 0, 6226, 9479, 28683, 17139, 13112, 0, 0,
+    8480, 0, 28826, 5657, 17069, 16743, 0, 8910, 16588, 13041, 0, 0, 20489, 13077, 12568, 11161,
+    12515, 28751, 12922, 13027, 28736, 28776, 12665, 10475, 8576, 9686, 28710, 28767, 12551, 12706, 11866, 17318,
+    10252, 13077, 0, 4651, 28677, 17094, 12299, 4571, 0, 4411, 11349, 0, 11171, 9917, 8790, 9317,
+    28737, 12909, 16607, 12310, 12907, 12512, 12381, 12432, 12801, 11838, 12993, 28730, 12826, 9956, 0, 13197,
+    12881, 12757, 9980, 12995, 9067, 28819, 28813, 17090, 28768, 6233, 17250, 11169, 12756, 13112, 12921, 0,
+    8904, 17238, 28739, 12921, 20489, 28807, 17387, 28694, 11729, 28754, 12944, 12540, 12768, 0, 12571, 28693,
+    9687, 20488, 0, 5620, 0, 32833, 12945, 6058, 32807, 8738, 0, 5441, 11574, 9641, 10012, 28732,
+    0, 12712, 0, 11767, 10539, 20487, 13054, 28772, 11057, 9340, 12838, 13172, 32846, 32908, 17332, 16696,
+    12864, 28674, 13017, 13054, 0, 12924, 11756, 12442, 0, 0, 12761, 9744, 28783, 32933, 8461, 10642,
+    12648, 28787, 12960, 0, 17094, 9687, 12621, 20490, 10509, 11171, 16621, 28767, 16686, 16539, 32779, 4902,
+    9676, 20487, 16437, 12656, 0, 12684, 32803, 9761, 11470, 10414, 0, 0, 6117, 16542, 28749, 9510,
+    12504, 13050, 0, 13160, 28796, 16922, 13172, 9598, 0, 12936, 28783, 11159, 6455, 28790, 12681, 9300,
+    6130, 12585, 10869, 0, 13074, 16777, 13006, 0, 0, 9042, 28815, 17309, 0, 17037, 9676, 28745,
+    12648, 0, 32911, 0, 0, 28782, 8720, 32838, 10806, 11348, 16937, 4263, 10580, 11105, 12488, 16509,
+    9972, 0, 28790, 32864, 10713, 12808, 10546, 32856, 28806, 11412, 32805, 12844, 13118, 4722, 17002, 28796,
+    16730, 32828, 5461, 6344, 17014, 0, 16577, 9983, 0, 12598, 20488, 28684, 10582, 28809, 8779, 16778,
+    11639, 13183, 13040, 10941, 12767, 12668, 10152, 0, 0, 17250, 13038, 0, 28747, 0, 13205, 0,
+    28775, 0, 12622, 9367, 13075, 12534, 13126, 16953, 32911, 12780, 10806, 8847, 32881, 6308, 0, 10882,
+    0, 12380, 28747, 0, 12684, 5825, 28729, 0, 0, 12562, 28680, 12780, 0, 12948, 0, 4514,
+    12392, 10270, 9585, 12584, 0, 32777, 4345, 28772, 12558, 32829, 5674, 12844, 28772, 12586, 12815, 12442,
+    17151, 10997, 32932, 9377, 12497, 12636, 8993, 11113, 28778, 0, 28810, 16935, 12947, 12462, 0, 11386,
+    8474, 32790, 12828, 0, 28770, 12855, 10583, 11385, 17131, 9928, 12633, 12744, 13008, 12766, 11645, 11953,
+    0, 28769, 8700, 11391, 28716, 28768, 12995, 28726, 0, 12677, 12827, 12946, 12381, 5613, 13197, 28814,
+    0, 0, 0, 13134, 11479, 4694, 32909, 10274, 9204, 4204, 13175, 28771, 11797, 12428, 6365, 28755,
+    12372, 12551, 16993, 0, 12960, 13116, 6226, 32829, 13037, 16925, 10859, 17297, 4609, 10551, 28744, 16937,
+    0, 0, 8367, 10080, 16857, 13030, 8993, 12648, 12576, 0, 9007, 13194, 32881, 28750, 12732, 12780,
+    11042, 12538, 9264, 8865, 11181, 10271, 10262, 0, 10580, 16980, 0, 0, 9983, 11972, 16515, 12732,
+    12405, 8395, 12980, 32833, 16986, 12441, 10284, 0, 0, 17174, 28778, 13223, 12946, 0, 32844, 32884,
+    0, 6152, 16857, 16856, 12512, 0, 4678, 12502, 32933, 12564, 16989, 0, 0, 12944, 17121, 6234,
+    0, 28754, 28817, 12532, 12552, 11115, 10738, 10814, 16485, 10878, 12981, 0, 12909, 17410, 32897, 16505,
+    12802, 16816, 20485, 12384, 28735, 13088, 10449, 12010, 16412, 28809, 9007, 11759, 12922, 11467, 12896, 32885,
+    17328, 0, 0, 0, 0, 0, 12558, 16736, 0, 9686, 8389, 13092, 28718, 0, 12825, 9164,
+    12656, 9970, 32845, 28784, 8359, 8409, 12360, 16438, 13124, 10517, 13031, 28767, 9510, 17353, 11248, 0,
+    12825, 17062, 28716, 10568, 12980, 32896, 10261, 0, 12910, 5666, 20488, 0, 28814, 17229, 11152, 0,
+    20490, 16879, 12960, 0, 13188, 32909, 28756, 12641, 5105, 12898, 16677, 17328, 16822, 13052, 12946, 10844,
+    9505, 6272, 28742, 12827, 32920, 9663, 9204, 11149, 11844, 28678, 11656, 28687, 8621, 0, 16808, 28785,
+    12574, 0, 4933, 13148, 11769, 32869, 12780, 11404, 32907, 12476, 11036, 16588, 11864, 11177, 13052, 13032,
+    10883, 32917, 28754, 12707, 32857, 6217, 32897, 0, 28711, 10160, 28690, 17281, 32827, 0, 10816, 10569,
+    12492, 10559, 0, 10507, 10550, 28777, 5512, 12705, 17072, 17248, 16771, 13042, 5629, 11033, 11648, 28782,
+    0, 0, 32894, 11332, 12752, 0, 0, 28689, 10850, 12732, 12907, 13068, 12562, 10262, 32807, 8783,
+    12942, 11479, 28772, 0, 16530, 5346, 13164, 0, 9547, 32827, 13209, 17239, 12380, 13027, 16924, 12551,
+    0, 0, 0, 28817, 17082, 28771, 0, 28798, 10560, 13001, 13176, 28793, 0, 16406, 8344, 0,
+    12564, 6327, 0, 16597, 16491, 12827, 13126, 11239, 28808, 0, 28711, 12531, 12792, 0, 0, 5525,
+    13035, 0, 17239, 6223, 32818, 10577, 13223, 28709, 8658, 12380, 0, 0, 12766, 0, 28732, 12910,
+    5674, 8712, 13064, 12536, 11182, 12593, 32826, 8954, 13054, 16924, 20489, 32845, 0, 13030, 32789, 12355,
+    0, 9985, 9175, 12880, 0, 12907, 10191, 28719, 12311, 11981, 12057, 12921, 16676, 12874, 12934, 32911,
+    6455, 28729, 17241, 10274, 12778, 6299, 13176, 28774, 28825, 11331, 9012, 16654, 11149, 16619, 11005, 17191,
+    0, 0, 10578, 9975, 0, 32791, 12783, 0, 28823, 0, 0, 28808, 16934, 10883, 28772, 28792,
+    0, 28709, 12983, 8663, 12066, 0, 10861, 0, 11349, 0, 0, 32907, 11611, 11768, 12504, 11170,
+    17399, 12516, 0, 11160, 28750, 16598, 12438, 9941, 32843, 32897, 12369, 6180, 8790, 32917, 8480, 12068,
+    32846, 10816, 9011, 6179, 28697, 0, 9218, 32882, 9019, 11703, 13008, 28752, 11850, 32885, 28739, 16764,
+    32933, 11181, 0, 28756, 6393, 0, 17397, 0, 0, 10837, 28724, 32833, 32870, 0, 9687, 16766,
+    28759, 20483, 4311, 32806, 12952, 9664, 28742, 32883, 0, 11105, 28700, 12012, 10198, 12576, 0, 32908,
+    0, 12593, 28790, 0, 12371, 16992, 12888, 0, 0, 28718, 13136, 5368, 13187, 0, 8278, 12419,
+    5482, 0, 0, 0, 12894, 12912, 5612, 0, 32924, 9076, 32780, 5436, 6408, 0, 12358, 0,
+    32843, 28803, 9662, 5672, 11853, 8769, 28784, 12009, 13041, 16664, 9364, 8931, 9430, 12598, 28682, 28761,
+    17251, 17015, 11404, 13062, 13184, 5143, 28820, 10606, 12491, 17396, 12418, 0, 5629, 28780, 12731, 16412,
+    28773, 12857, 16831, 16744, 28683, 12619, 9542, 12934, 32904, 5673, 17174, 17170, 28693, 0, 5103, 11711,
+    8929, 12828, 8723, 10870, 20485, 9209, 12804, 9863, 0, 17014, 28743, 32893, 8570, 28785, 28683, 9311,
+    28805, 16597, 28762, 4720, 28780, 8359, 13174, 13184, 10347, 0, 0, 12826, 17286, 0, 0, 28764,
+    10573, 28739, 10507, 16509, 13066, 12863, 12702, 28758, 16696, 17161, 0, 20485, 17053, 8689, 17219, 13079,
+    28679, 17083, 28790, 10285, 8478, 11161, 16530, 5099, 8876, 32919, 28693, 16451, 12039, 28782, 28720, 9984,
+    28721, 9274, 10271, 12692, 0, 20487, 0, 9180, 12882, 10642, 16756, 16969, 0, 9587, 9671, 12740,
+    9986, 0, 17238, 11978, 16686, 16673, 8338, 11954, 28715, 12049, 28681, 0, 16880, 12403, 10853, 12876,
+    16688, 0, 6411, 0, 12777, 12564, 12384, 32868, 16607, 13159, 0, 28790, 0, 17040, 11479, 13186,
+    16825, 6356, 0, 28801, 8606, 12322, 28792, 11170, 16696, 28682, 12622, 12585, 28780, 20481, 8413, 28691,
+    12396, 11574, 0, 0, 0, 11573, 0, 16813, 12875, 28775, 28755, 8283, 32934, 12344, 9388, 4972,
+    0, 0, 12360, 10570, 16700, 12444, 32794, 4463, 0, 11947, 12947, 16667, 12358, 0, 13188, 17411,
+    20487, 32923, 0, 0, 12323, 16914, 28704, 13016, 12768, 0, 28807, 17230, 10191, 5845, 10153, 6277,
+    28686, 17083, 28810, 11297, 0, 28719, 8964, 12876, 11992, 0, 0, 10489, 9089, 12779, 0, 9599,
+    13014, 10705, 12596, 0, 12684, 0, 0, 28718, 17071, 12845, 12056, 9687, 12860, 16823, 11849, 12703,
+    12728, 13030, 11775, 8613, 28760, 10443, 8364, 28717, 12346, 11638, 0, 12360, 12503, 28807, 13186, 28789,
+    16920, 10999, 28783, 28792, 6293, 28773, 0, 32883, 11759, 28813, 17083, 0, 13051, 0, 10443, 0,
+    12571, 17329, 28692, 12809, 6365, 9088, 9620, 16895, 32807, 6071, 12695, 9568, 16918, 13136, 16676, 28819,
+    17332, 13077, 10162, 28810, 11333, 28769, 6466, 0, 32819, 0, 8678, 28743, 11954, 28732, 12494, 9310,
+    28723, 0, 12924, 11115, 28742, 32885, 4728, 10563, 4913, 12766, 28705, 16989, 8256, 12512, 16688, 9863,
+    0, 10642, 17319, 10880, 0, 11115, 12647, 10153, 10483, 5075, 10782, 28804, 0, 28709, 9538, 8677,
+    17250, 13160, 28811, 0, 0, 17123, 16766, 10549, 28728, 13062, 9778, 32936, 11059, 10742, 0, 0,
+    12323, 11385, 5075, 12799, 11152, 17045, 0, 17317, 32807, 8474, 16913, 12900, 5052, 11742, 0, 28810,
+    28794, 9907, 13208, 12585, 16519, 13112, 13036, 17239, 32895, 12923, 6022, 28821, 10539, 0, 8653, 13200,
+    12955, 10606, 9426, 12312, 12731, 6438, 8713, 12408, 16460, 0, 13164, 13091, 28763, 16744, 17062, 10457,
+    0, 6444, 0, 9851, 12480, 28776, 13031, 10414, 13149, 11171, 28775, 0, 5454, 0, 0, 12333,
+    0, 13076, 13104, 28823, 17252, 16525, 32858, 6226, 0, 20486, 32898, 9516, 12392, 12684, 12813, 12522,
+    0, 32777, 8567, 13043, 32814, 16983, 8958, 13054, 0, 0, 32792, 13042, 0, 16509, 12786, 12540,
+    28822, 16650, 11629, 0, 17378, 12550, 20485, 17238, 0, 12041, 28757, 13115, 28737, 28731, 28780, 13079,
+    12996, 13035, 12756, 13159, 0, 28824, 16621, 17061, 10853, 11005, 12715, 17348, 8737, 12768, 17331, 16499,
+    0, 11648, 17006, 17016, 32816, 10860, 12528, 28774, 0, 5293, 16904, 12907, 12631, 12868, 11703, 28785,
+    28744, 16877, 13176, 11648, 11611, 10905, 5672, 12924, 28676, 32895, 0, 11477, 13100, 0, 8549, 16936,
+    5653, 32846, 17141, 12468, 9350, 11171, 28716, 13200, 12407, 12813, 16982, 12972, 4628, 16604, 12804, 12696,
+    17239, 13137, 32831, 16732, 10551, 28676, 8778, 28736, 32818, 12947, 16921, 20490, 9973, 20482, 0, 0,
+    16822, 0, 0, 13188, 0, 17308, 13054, 12636, 28809, 16666, 16699, 28791, 0, 16886, 16688, 13145,
+    8366, 16937, 8461, 28825, 11538, 12591, 12358, 16763, 13032, 0, 12636, 12672, 5367, 13014, 12864, 8917,
+    9089, 13169, 16420, 28730, 5055, 0, 10274, 0, 12521, 9292, 12607, 13019, 16697, 12408, 12874, 28711,
+    12475, 32804, 4516, 0, 28799, 12945, 6050, 32780, 11499, 11779, 28826, 12789, 28818, 0, 32780, 5343,
+    10934, 16406, 0, 0, 0, 12463, 0, 16528, 11274, 8479, 0, 16793, 17001, 28739, 28711, 12537,
+    16440, 0, 10669, 28758, 10348, 12996, 17250, 17298, 8575, 4467, 13125, 12737, 32859, 12383, 13188, 12702,
+    0, 9767, 0, 11938, 12804, 0, 9010, 32819, 16456, 8312, 0, 16845, 10882, 13170, 32806, 9290,
+    12971, 12668, 8344, 32920, 32803, 10636, 6021, 28698, 16413, 4759, 6365, 11135, 0, 32885, 16450, 0,
+    0, 6150, 10108, 8956, 28713, 12667, 9544, 28815, 28708, 32931, 10558, 28791, 9852, 32793, 11167, 28770,
+    28756, 10406, 8782, 0, 32791, 8613, 10101, 6151, 13039, 10659, 0, 4911, 11479, 12440, 0, 32779,
+    11249, 8555, 0, 0, 28675, 9510, 13127, 28730, 12406, 16774, 32818, 28744, 11152, 0, 0, 20486,
+    32865, 32792, 12763, 0, 12732, 6116, 16736, 28715, 0, 11468, 0, 12336, 0, 6261, 0, 16519,
+    13161, 28745, 28800, 8745, 16450, 32781, 5903, 0, 9180, 13050, 32922, 28763, 16428, 6457, 12867, 16825,
+    12693, 28809, 13200, 11597, 10516, 16509, 0, 8663, 10882, 16539, 5010, 9564, 0, 12816, 0, 12828,
+    16729, 28736, 12728, 10285, 32898, 12764, 28692, 17356, 12619, 10935, 16697, 12467, 10872, 9066, 28772, 0,
+    0, 13162, 0, 17211, 32804, 4566, 0, 6206, 9918, 12763, 8419, 0, 12347, 28774, 32869, 10115,
+    8953, 4401, 16755, 5334, 20489, 28679, 32853, 0, 0, 0, 16814, 32863, 10499, 9077, 4728, 28784,
+    8582, 5951, 9219, 28801, 12945, 12407, 6226, 5347, 12575, 12702, 0, 12922, 9561, 16430, 28731, 16592,
+    28757, 12077, 11503, 28738, 8982, 12980, 28710, 11096, 20489, 12617, 12065, 32833, 11984, 10674, 0, 0,
+    0, 11900, 0, 28810, 12550, 9852, 12692, 16722, 32920, 12525, 28781, 12799, 8662, 16507, 12863, 12799,
+    8416, 8367, 12634, 8402, 12528, 12347, 28762, 32924, 0, 12331, 12923, 12585, 11768, 0, 12942, 9337,
+    28769, 12696, 0, 16529, 0, 9914, 11205, 28705, 10161, 17388, 32844, 0, 28741, 11632, 0, 17308,
+    17173, 10032, 12765, 12911, 9214, 11938, 0, 16498, 12691, 16509, 28825, 12406, 12636, 13102, 9575, 0,
+    0, 12576, 12468, 11768, 12648, 0, 13006, 8721, 0, 8966, 0, 28696, 12360, 12935, 11711, 28745,
+    0, 6408, 12039, 12812, 13224, 0, 0, 28802, 8367, 11778, 11757, 28725, 16462, 12798, 13210, 28768,
+    17229, 28730, 28712, 32816, 9294, 12570, 0, 28800, 12882, 8356, 13004, 12346, 10199, 12550, 0, 4526,
+    16605, 12550, 10859, 16541, 12335, 28711, 10758, 6409, 0, 11777, 12788, 28728, 6048, 12987, 10161, 20486,
+    6384, 4447, 28685, 17407, 12799, 28688, 11037, 32864, 12844, 12611, 28816, 12431, 0, 0, 28731, 32856,
+    16858, 28730, 28710, 12467, 11007, 16675, 12677, 0, 28749, 16449, 13043, 5656, 6466, 5302, 28781, 9086,
+    12943, 13174, 32830, 0, 0, 0, 8977, 16621, 28797, 11678, 32919, 12311, 12911, 10173, 11955, 17095,
+    17173, 11171, 6446, 5105, 8786, 0, 0, 0, 12744, 12311, 10997, 16946, 0, 9619, 12356, 0,
+    28746, 12947, 32855, 10742, 13091, 11295, 28743, 28813, 12490, 10406, 9889, 9064, 12694, 28760, 20489, 9585,
+    0, 4724, 12381, 12359, 8440, 13188, 0, 20489, 0, 8709, 0, 0, 13224, 9076, 10516, 9599,
+    17411, 12766, 4977, 13167, 0, 0, 32895, 28784, 28716, 16914, 16436, 8905, 8367, 28729, 0, 12670,
+    0, 11137, 10273, 9044, 13027, 10457, 0, 10218, 12369, 28714, 32867, 0, 16852, 4626, 0, 8700,
+    28736, 12850, 8750, 12078, 5361, 6276, 32815, 16923, 17378, 32806, 5182, 17347, 0, 12430, 12076, 12612,
+    28775, 5672, 0, 12743, 32930, 12814, 12455, 13036, 16588, 17318, 12563, 12383, 12704, 28769, 12323, 12356,
+    12706, 13163, 28814, 17251, 20486, 28821, 32906, 11169, 12916, 11470, 17239, 17318, 10255, 11909, 6145, 17095,
+    13176, 28721, 10442, 16914, 9254, 5547, 5098, 11041, 13066, 12656, 0, 32793, 12659, 12057, 12932, 5628,
+    12312, 0, 20487, 9665, 28736, 9510, 8985, 6081, 9608, 0, 9076, 5349, 16891, 16718, 28717, 9878,
+    16835, 0, 12814, 10545, 12751, 10239, 9362, 12994, 13163, 32778, 4492, 32776, 10288, 12010, 32897, 6402,
+    8957, 32815, 9010, 8874, 11339, 4436, 11197, 32896, 12526, 11059, 28751, 0, 10545, 16458, 4448, 12934,
+    16831, 12917, 16854, 10573, 10159, 8621, 12547, 11790, 8713, 5485, 9248, 12681, 32819, 8564, 28816, 10460,
+    0, 12663, 6210, 28816, 16999, 11976, 16608, 28762, 5927, 28704, 28784, 9481, 0, 28728, 17250, 8954,
+    12800, 11181, 4563, 5673, 28767, 12393, 5857, 12872, 32792, 17010, 0, 28733, 8666, 16463, 12915, 8604,
+    10882, 8611, 13103, 11181, 10882, 0, 10788, 20484, 12776, 28827, 12780, 12779, 0, 9863, 13209, 10063,
+    10400, 11268, 12944, 5198, 28703, 4494, 28807, 28719, 16698, 0, 16756, 12644, 13152, 17378, 28736, 16913,
+    28808, 16606, 28726, 13019, 16974, 12321, 0, 13084, 28814, 11547, 5995, 8663, 4721, 11296, 13208, 0,
+    5385, 28675, 8765, 13056, 10501, 0, 32805, 12346, 10503, 9860, 5590, 28743, 5844, 8999, 5548, 5364,
+    17201, 12681, 10451, 28774, 0, 32911, 17082, 9915, 10495, 10207, 13029, 17368, 13209, 0, 5557, 13208,
+    0, 9953, 12647, 4705, 32804, 12759, 32806, 12987, 12773, 12790, 28741, 12920, 0, 0, 0, 11777,
+    9685, 10206, 32865, 10883, 6466, 12682, 16858, 0, 12394, 28772, 16688, 17138, 28827, 32779, 4814, 0,
+    13085, 28796, 32819, 0, 28764, 10494, 12888, 0, 16540, 17094, 28705, 8641, 11694, 4284, 16845, 0,
+    28819, 28753, 12705, 28701, 12563, 12058, 8777, 0, 9003, 11104, 9421, 0, 0, 12432, 28726, 12740,
+    28796, 9480, 9226, 28725, 10215, 8776, 12444, 12683, 12322, 0, 12372, 32840, 9137, 0, 16921, 5113,
+    0, 28817, 28783, 17236, 16778, 12057, 32829, 12845, 8413, 10271, 12933, 12835, 32806, 9314, 16892, 0,
+    0, 10115, 28800, 0, 12574, 0, 12886, 5619, 6151, 13077, 16495, 16843, 28794, 0, 8657, 10573,
+    11411, 12563, 28736, 8396, 12967, 6299, 0, 0, 17194, 12456, 12300, 9780, 12790, 9044, 11479, 0,
+    9965, 12002, 10498, 28699, 11900, 0, 32820, 11182, 10273, 12778, 10371, 10197, 0, 10401, 16754, 16937,
+    0, 12652, 10214, 9975, 17319, 4678, 12850, 12887, 11768, 13087, 28746, 16924, 28811, 9502, 16763, 28756,
+    32820, 28674, 28718, 8723, 12524, 16530, 28787, 9321, 9900, 9387, 28764, 0, 9975, 32852, 0, 28821,
+    12695, 8910, 5999, 12581, 13162, 5674, 28813, 12429, 4467, 10883, 0, 32870, 9377, 0, 12563, 28748,
+    0, 12464, 10145, 28700, 28696, 13200, 12907, 12531, 11080, 12933, 28799, 9918, 28709, 8617, 8701, 32828,
+    32845, 28771, 8404, 10264, 12643, 17237, 11056, 13089, 28718, 0, 0, 0, 12607, 28746, 9219, 28739,
+    20481, 0, 9561, 28799, 28825, 28738, 28815, 28798, 12010, 12919, 28691, 12511, 32882, 0, 8487, 9021,
+    32806, 11493, 8479, 11993, 16508, 11759, 17252, 0, 12490, 0, 16428, 12716, 9909, 20487, 11740, 12380,
+    28752, 32870, 12777, 0, 12500, 12748, 12864, 5702, 12605, 9828, 32793, 12791, 4689, 13028, 32931, 11871,
+    12694, 9058, 16983, 28743, 9646, 28811, 11395, 0, 12840, 9539, 8854, 0, 9022, 8325, 12537, 28678,
+    0, 10669, 28723, 12885, 0, 16677, 0, 32907, 0, 12944, 28814, 0, 16438, 0, 6124, 0,
+    8458, 0, 12621, 12729, 17061, 4395, 12768, 10263, 32820, 20482, 12672, 0, 28677, 28743, 28745, 16536,
+    0, 13125, 28721, 0, 10515, 0, 12078, 0, 12739, 8654, 0, 9672, 10158, 8767, 0, 28762,
+    0, 12368, 0, 4661, 12612, 12923, 9962, 0, 12551, 16685, 4307, 28806, 9370, 32921, 0, 12652,
+    28789, 0, 10582, 12000, 32781, 5947, 32846, 5452, 32883, 9862, 11630, 9502, 32893, 12358, 28820, 9473,
+    10183, 28687, 12296, 13131, 13200, 0, 8750, 12540, 0, 0, 0, 12552, 9610, 16666, 28736, 9294,
+    0, 11451, 13074, 12359, 8947, 0, 9984, 12923, 9676, 0, 9381, 12599, 11779, 16843, 0, 13076,
+    28745, 13036, 0, 0, 32846, 32776, 10303, 12067, 10814, 12516, 17309, 16509, 32895, 8875, 11404, 12640,
+    8355, 12390, 11274, 12515, 12623, 8942, 28735, 12851, 17140, 12864, 4593, 12381, 9429, 0, 28757, 5095,
+    28799, 16579, 0, 0, 9246, 0, 12612, 5402, 28793, 12932, 17360, 0, 12490, 16666, 12331, 11481,
+    9890, 12572, 12552, 9954, 32856, 32804, 8318, 12834, 16462, 17226, 20481, 12911, 13053, 28798, 8481, 12952,
+    0, 12320, 28759, 16687, 0, 16815, 0, 11937, 0, 12300, 12587, 32791, 16498, 9618, 0, 28780,
+    13007, 0, 12348, 28817, 13152, 11742, 10263, 12324, 12899, 13019, 4581, 32845, 16856, 28686, 13003, 0,
+    0, 10285, 17044, 0, 12655, 12584, 11339, 11778, 9087, 16675, 8349, 28780, 12948, 32923, 0, 12432,
+    12525, 0, 16537, 17174, 13075, 6327, 13176, 13034, 16677, 11050, 6225, 10883, 11113, 32791, 12779, 12405,
+    11267, 0, 12705, 0, 8897, 32881, 9884, 28788, 16933, 12708, 11114, 0, 20481, 0, 12969, 12864,
+    12712, 0, 32832, 0, 12585, 0, 4843, 32894, 28816, 9354, 5514, 12552, 12597, 12395, 12899, 12549,
+    8620, 13097, 32780, 5528, 10860, 28739, 12957, 13220, 28689, 12477, 12298, 12815, 0, 12079, 12859, 28743,
+    5672, 16597, 17253, 11135, 12812, 32781, 6070, 0, 28719, 28770, 28725, 10562, 8669, 0, 8363, 12792,
+    5555, 13006, 12383, 16696, 12978, 8642, 28750, 28706, 13220, 6392, 12067, 12299, 12561, 10881, 0, 17010,
+    12778, 12886, 0, 9675, 9620, 28687, 10580, 0, 12751, 28757, 10285, 28731, 28719, 5489, 0, 13198,
+    28764, 12300, 17309, 28742, 32831, 28828, 12568, 16893, 0, 16687, 12384, 9685, 12526, 12322, 32920, 11182,
+    28744, 11570, 28817, 0, 32904, 11204, 10254, 0, 28685, 17249, 12514, 28760, 13128, 32805, 8363, 16436,
+    32777, 4413, 32854, 28755, 12808, 8777, 16842, 12696, 0, 12995, 5267, 0, 0, 16933, 12068, 9585,
+    5922, 12864, 10777, 11224, 12885, 0, 0, 16833, 12312, 11312, 20481, 11404, 8657, 0, 32806, 8409,
+    11500, 28709, 0, 8694, 28683, 16607, 0, 0, 8904, 13031, 16697, 28704, 17014, 6050, 0, 6208,
+    0, 12465, 32920, 8957, 0, 11775, 8957, 28821, 17174, 17306, 11192, 9938, 17407, 0, 6151, 16528,
+    12620, 11180, 11357, 10563, 12948, 16891, 13019, 0, 10583, 20489, 28757, 0, 28820, 16841, 10377, 0,
+    12552, 13210, 20484, 28753, 17249, 32908, 12576, 13140, 9816, 5619, 13224, 0, 11866, 12983, 11574, 11657,
+    28809, 32833, 16970, 12700, 13197, 5110, 8719, 28818, 28682, 28713, 10253, 12863, 9000, 6364, 12456, 10371,
+    0, 10371, 8666, 32905, 11411, 11800, 28743, 5384, 11894, 28706, 12058, 10108, 0, 11657, 0, 16899,
+    17386, 28746, 28825, 0, 17042, 12470, 28728, 13032, 12537, 11112, 9001, 10669, 16895, 0, 17052, 0,
+    12525, 13137, 13053, 13031, 6073, 0, 12528, 0, 12615, 16527, 16609, 32918, 28748, 16619, 28758, 0,
+    28773, 12742, 28741, 16437, 13020, 9281, 20482, 0, 9350, 32845, 10274, 12561, 28819, 12466, 9011, 8721,
+    13019, 5290, 13039, 17352, 28729, 16698, 10261, 32816, 28709, 9846, 12319, 10747, 13209, 28750, 17238, 0,
+    12645, 12994, 0, 11040, 11545, 4721, 16539, 13005, 13188, 28695, 6019, 6456, 10565, 13019, 9445, 13043,
+    17359, 28793, 0, 9964, 17091, 5232, 16496, 12796, 12908, 28706, 12893, 9965, 0, 8720, 13176, 32907,
+    12787, 11305, 11057, 0, 12408, 12520, 9915, 0, 11414, 32803, 4367, 0, 32806, 8708, 12848, 28818,
+    32806, 5288, 16451, 16658, 32937, 10584, 12420, 28767, 32869, 5951, 28745, 6173, 17396, 16461, 0, 10968,
+    0, 13221, 11012, 8990, 32807, 9325, 13065, 9962, 12862, 0, 0, 28788, 6282, 12500, 8890, 0,
+    10553, 0, 0, 12718, 28712, 12296, 5563, 0, 10413, 12600, 28810, 11041, 16677, 17396, 16460, 0,
+    12513, 16463, 16999, 5121, 16530, 0, 12696, 32819, 12586, 16935, 12587, 11358, 28698, 13220, 12299, 11046,
+    13185, 0, 9670, 12058, 32794, 9593, 13149, 28772, 17132, 0, 32937, 12923, 5757, 16824, 16972, 0,
+    13158, 0, 28751, 0, 12801, 16462, 0, 28780, 32781, 5741, 0, 32917, 0, 8901, 0, 0,
+    12530, 5334, 28678, 13138, 11870, 0, 11161, 10108, 10793, 13158, 12713, 17038, 8920, 13148, 12876, 0,
+    9327, 0, 10281, 11836, 9609, 8704, 9055, 32868, 20484, 32831, 12444, 12956, 16891, 8787, 16460, 12623,
+    17272, 6327, 12984, 12558, 32781, 6077, 13148, 28789, 0, 8477, 28758, 9379, 11655, 0, 13210, 32883,
+    17388, 0, 8412, 13186, 0, 28755, 11872, 11778, 9477, 16434, 13206, 11441, 5893, 17397, 6464, 0,
+    20486, 17253, 11709, 0, 8713, 12468, 0, 28685, 10371, 11268, 12792, 0, 10705, 20484, 12863, 16673,
+    9666, 32793, 16540, 28704, 28750, 0, 13161, 28783, 28746, 0, 28682, 0, 16775, 28749, 28730, 12658,
+    13077, 0, 13041, 0, 6235, 9687, 0, 12946, 28809, 0, 9601, 9563, 11114, 12683, 28828, 9909,
+    0, 6392, 16983, 8783, 4949, 9387, 28816, 13173, 16540, 4790, 0, 28717, 12587, 32918, 12809, 6181,
+    16756, 32858, 12299, 28791, 0, 9386, 0, 12307, 4962, 10515, 12355, 13055, 4659, 12488, 28821, 28783,
+    0, 0, 13162, 12909, 9986, 32815, 9086, 10871, 12912, 9984, 28692, 8667, 4721, 11333, 12502, 12588,
+    0, 5097, 32857, 9676, 16419, 0, 0, 12836, 0, 11307, 13040, 11395, 10107, 16813, 0, 17062,
+    28717, 12055, 16774, 0, 13079, 12900, 17386, 10570, 0, 0, 10814, 0, 0, 0, 5490, 12537,
+    10404, 28727, 17052, 0, 16519, 10105, 10246, 0, 0, 12609, 12948, 28751, 12651, 0, 8321, 32820,
+    28707, 12908, 0, 8779, 28722, 28728, 0, 9930, 9501, 16739, 13006, 0, 8478, 28693, 12378, 0,
+    17168, 8423, 8758, 0, 32831, 0, 0, 16974, 11413, 0, 12333, 11837, 12587, 9246, 12919, 4230,
+    12331, 12360, 13065, 10461, 16995, 12479, 12886, 0, 12886, 6385, 8368, 12492, 0, 12586, 12953, 0,
+    0, 9265, 11777, 0, 12898, 11159, 12718, 0, 16509, 16676, 16572, 16914, 17070, 0, 32790, 10283,
+    12011, 28688, 10581, 10699, 5483, 28724, 32781, 5847, 17053, 32832, 10260, 11167, 28682, 13005, 28724, 28819,
+    10793, 12695, 11611, 11159, 17329, 32846, 0, 0, 0, 0, 13117, 17309, 9984, 9676, 28716, 28785,
+    0, 28745, 16919, 0, 12894, 17296, 28697, 9964, 13090, 12077, 0, 28679, 32839, 0, 28809, 13173,
+    12747, 8256, 12310, 12502, 17016, 12705, 12321, 0, 12624, 10490, 28760, 5169, 17202, 8423, 28710, 9892,
+    11775, 12360, 32894, 32844, 9537, 0, 0, 28821, 12394, 32892, 10760, 8934, 8272, 0, 10483, 11657,
+    12442, 32896, 9954, 0, 10872, 28762, 9243, 32806, 12299, 12934, 8881, 13053, 32895, 12395, 8457, 12921,
+    6151, 32780, 11488, 12922, 4977, 6430, 12011, 13115, 28819, 32833, 10788, 12695, 13075, 17306, 28710, 0,
+    11087, 10581, 9348, 10562, 16518, 17229, 10599, 12393, 0, 12790, 10222, 16490, 12944, 12948, 0, 28727,
+    5613, 0, 9502, 10057, 11092, 28755, 28684, 11466, 12863, 12587, 0, 13065, 12416, 28718, 16697, 10188,
+    28730, 9861, 0, 4325, 28709, 0, 8611, 16447, 6466, 32932, 12300, 16762, 12587, 0, 32884, 32807,
+    13119, 4450, 9310, 5590, 12816, 13109, 0, 13020, 28796, 28822, 28776, 16440, 32820, 11413, 11203, 13164,
+    5563, 16433, 16509, 0, 32858, 13222, 28728, 9386, 8451, 9376, 12732, 0, 0, 12312, 11266, 28690,
+    10274, 32833, 11776, 10871, 5583, 5093, 8721, 12312, 28719, 32832, 13019, 16778, 12718, 28823, 32804, 8590,
+    17082, 13028, 11480, 9640, 16460, 17387, 12719, 0, 11029, 10072, 12719, 9619, 17330, 10782, 8413, 12057,
+    11386, 11460, 12599, 10813, 11573, 12336, 0, 11549, 6249, 0, 10898, 12838, 28777, 12354, 0, 10208,
+    0, 6262, 0, 9525, 12766, 4671, 16816, 12731, 8451, 12539, 11103, 8787, 0, 11105, 6408, 16451,
+    0, 12334, 32867, 16539, 11789, 32882, 16841, 28696, 5651, 0, 11013, 10461, 11864, 12671, 6290, 12886,
+    9685, 16438, 12563, 5755, 0, 16620, 32845, 28787, 0, 12008, 0, 13207, 17315, 0, 17219, 9676,
+    28690, 13137, 8277, 13032, 11657, 9000, 16459, 12829, 12756, 12548, 10584, 13088, 28733, 12719, 0, 13087,
+    28705, 28769, 12343, 12852, 28786, 9003, 4418, 28787, 11638, 12945, 12744, 9062, 9675, 16650, 13211, 13087,
+    0, 11291, 28776, 6080, 9540, 12945, 28673, 13208, 16688, 28697, 32788, 28674, 8465, 8777, 12597, 10313,
+    32817, 11081, 0, 11851, 0, 9766, 9247, 11112, 11348, 28797, 5565, 12705, 11059, 13138, 9446, 0,
+    32895, 8709, 9675, 0, 0, 16440, 0, 6189, 11404, 32781, 5881, 12624, 12648, 5661, 6447, 5674,
+    12359, 28747, 16508, 5647, 16518, 13068, 0, 32919, 0, 16577, 16525, 12636, 17220, 11927, 12717, 5591,
+    13150, 12717, 12923, 13218, 12960, 0, 9610, 12575, 16924, 28794, 32858, 12324, 0, 32845, 20488, 11403,
+    12875, 12429, 12956, 10511, 0, 28761, 10363, 10583, 28766, 12550, 0, 12009, 0, 10843, 8400, 13152,
+    11703, 12815, 8285, 8779, 11641, 10983, 20483, 12406, 13089, 32920, 0, 12984, 8468, 17229, 11349, 0,
+    0, 0, 28727, 12504, 6275, 28822, 16462, 0, 10776, 0, 28765, 8917, 17004, 6021, 12057, 10648,
+    6000, 17248, 6464, 0, 16766, 9388, 0, 4717, 0, 12933, 17318, 16541, 32818, 20482, 0, 28787,
+    10517, 0, 8532, 13158, 0, 0, 17159, 20485, 12707, 8941, 12299, 12520, 13029, 8718, 10814, 13053,
+    28685, 28782, 12466, 13195, 0, 10814, 32919, 17023, 0, 28800, 4709, 10318, 16542, 8721, 12751, 11147,
+    13168, 10399, 12957, 9517, 8713, 6463, 11357, 28693, 0, 16654, 0, 11596, 0, 6320, 12719, 0,
+    28740, 0, 28726, 12298, 0, 12333, 0, 17318, 28720, 10849, 10506, 8574, 28802, 32805, 4821, 12971,
+    17398, 11142, 11701, 0, 9765, 9665, 12588, 12876, 0, 0, 0, 13020, 10609, 13044, 0, 28699,
+    32779, 5080, 12669, 28692, 12711, 28705, 10272, 12834, 10436, 0, 16684, 6284, 28750, 12633, 28816, 32818,
+    12347, 0, 8657, 10947, 9981, 28710, 16439, 5621, 6455, 9547, 12537, 32781, 6126, 32937, 0, 13064,
+    12619, 13006, 12776, 0, 0, 8769, 8423, 32791, 0, 16974, 17409, 12586, 28675, 10975, 0, 12564,
+    11767, 28784, 11113, 12371, 0, 12066, 13187, 32843, 8401, 12670, 0, 10983, 17384, 28688, 12712, 13115,
+    11606, 0, 9649, 13115, 0, 12479, 11591, 12755, 0, 16518, 12597, 28696, 17169, 10436, 12871, 5927,
+    28699, 0, 8784, 28828, 12979, 4341, 12588, 10115, 12323, 6235, 13064, 12887, 20484, 11148, 28764, 32845,
+    13132, 12719, 11257, 9620, 28708, 12347, 28759, 32858, 13175, 13163, 0, 0, 12719, 5042, 12778, 28681,
+    0, 28714, 8760, 16608, 28820, 11685, 28784, 28782, 12807, 32844, 12561, 0, 28761, 28717, 12311, 13027,
+    11404, 17122, 28795, 28745, 12539, 0, 0, 13020, 17237, 10079, 8643, 12851, 9077, 0, 28736, 17090,
+    32804, 8595, 28685, 28761, 0, 12744, 28738, 32833, 17211, 32924, 32794, 0, 8965, 10814, 0, 0,
+    12416, 12993, 0, 11796, 32936, 12408, 28739, 12815, 12372, 12454, 32833, 8470, 28758, 8881, 12959, 5271,
+    4286, 16676, 13145, 28799, 6044, 13221, 16440, 9656, 17394, 11983, 12765, 13138, 17061, 28791, 0, 16698,
+    28811, 28807, 32814, 4196, 8966, 12300, 0, 6145, 10600, 0, 28724, 16578, 28733, 9555, 17043, 10571,
+    28798, 32802, 8544, 10152, 13150, 28674, 13174, 12319, 12728, 9003, 8905, 13139, 16524, 12863, 11778, 28713,
+    12815, 12813, 11956, 0, 17241, 17035, 16684, 12648, 17399, 12988, 32907, 0, 13019, 28710, 12813, 9015,
+    28800, 12467, 0, 28680, 0, 16735, 6411, 13053, 8391, 11379, 5048, 5104, 12836, 11902, 0, 11701,
+    10870, 32856, 0, 0, 12871, 6050, 5905, 12321, 13195, 12876, 32885, 0, 12871, 0, 5175, 5629,
+    9795, 10273, 28725, 0, 12539, 28721, 17016, 9452, 0, 6055, 11759, 28699, 16925, 28673, 0, 6042,
+    32859, 12715, 0, 10578, 13025, 32804, 9186, 6183, 11478, 32832, 16990, 5928, 32935, 16619, 28780, 10204,
+    10506, 32845, 12588, 0, 12417, 13171, 8719, 12515, 32832, 13004, 28747, 10870, 9675, 12760, 17239, 12468,
+    28763, 13016, 8768, 13175, 0, 12299, 13015, 8583, 13006, 12897, 0, 28684, 9908, 0, 17230, 8854,
+    16835, 11956, 32878, 28785, 16843, 28693, 4818, 11702, 10262, 10995, 12587, 12744, 12675, 0, 28822, 16831,
+    8745, 11404, 28752, 0, 32815, 8648, 0, 12731, 17013, 0, 28694, 28809, 11739, 28761, 12468, 8966,
+    32804, 16425, 12503, 12311, 20489, 0, 9676, 11302, 0, 13160, 10079, 9301, 16814, 5390, 8480, 4603,
+    9076, 20485, 16437, 0, 12720, 5900, 16721, 16697, 17150, 0, 17091, 16846, 9831, 11627, 17387, 0,
+    28822, 11647, 28716, 0, 16462, 28753, 12528, 28718, 17171, 28676, 12852, 12653, 11114, 28758, 12672, 11113,
+    12693, 17299, 0, 8905, 28806, 32792, 28723, 0, 0, 12635, 0, 13138, 0, 12816, 16931, 0,
+    9826, 0, 9209, 0, 12812, 28707, 8566, 12011, 12570, 9259, 5069, 12768, 32780, 5136, 28766, 17042,
+    12695, 12576, 11703, 10814, 0, 16845, 12648, 10410, 28774, 13140, 11442, 12525, 16998, 5174, 13218, 28681,
+    0, 11478, 9637, 17409, 12408, 9310, 12653, 13078, 12455, 9035, 12907, 28750, 12801, 9219, 0, 17062,
+    8491, 28821, 13062, 5666, 28726, 8905, 0, 13032, 12075, 10610, 8643, 11301, 16590, 5340, 10787, 12719,
+    0, 0, 10832, 12029, 11985, 16744, 12331, 16983, 0, 5515, 12527, 28692, 12911, 10260, 0, 9657,
+    11349, 32781, 8753, 11469, 13020, 12900, 28717, 17081, 0, 9507, 10300, 0, 32905, 11693, 12672, 12749,
+    12550, 9253, 9665, 28812, 16499, 13122, 9089, 12467, 32865, 9008, 9964, 32907, 0, 11061, 13198, 9963,
+    13147, 12780, 13042, 16753, 0, 8618, 12067, 12850, 0, 0, 8713, 8721, 0, 0, 6015, 11656,
+    0, 6326, 10161, 28759, 12546, 9246, 0, 11113, 0, 16681, 28748, 0, 12789, 12874, 0, 16454,
+    28759, 9087, 9684, 11459, 17317, 28814, 0, 9618, 28717, 9478, 10741, 13106, 4552, 12346, 28813, 13164,
+    13219, 13185, 6319, 16518, 6318, 12465, 9022, 9780, 32870, 28732, 0, 11523, 10501, 10909, 17240, 28791,
+    4310, 4822, 12659, 12815, 32853, 12629, 11131, 13055, 17201, 9685, 5076, 16671, 28744, 28688, 12527, 12002,
+    9246, 10879, 13043, 12600, 11338, 16736, 17092, 5499, 12509, 28733, 6411, 0, 13127, 12898, 32802, 12343,
+    6234, 9625, 12768, 5006, 28676, 12381, 16799, 12615, 0, 8422, 16440, 28763, 16772, 28759, 13099, 11131,
+    16893, 12657, 13205, 0, 16451, 12427, 10563, 0, 28674, 9301, 0, 5645, 28800, 9676, 8713, 16459,
+    13207, 0, 9318, 28708, 0, 12641, 5655, 17384, 32866, 32846, 17326, 28675, 11459, 6464, 8368, 0,
+    11470, 28685, 0, 12909, 4565, 13172, 20488, 0, 12455, 0, 0, 11556, 12596, 0, 11040, 0,
+    0, 11982, 16587, 12684, 16677, 8364, 13188, 16437, 10145, 12691, 13151, 0, 28746, 16903, 0, 12311,
+    12897, 0, 9642, 0, 28673, 17331, 16700, 10443, 32804, 10908, 0, 11863, 32794, 0, 4532, 5619,
+    9648, 16775, 17320, 32845, 17299, 11178, 6225, 32868, 12532, 12453, 11161, 9012, 28723, 0, 0, 28793,
+    13137, 0, 0, 10969, 17408, 0, 6457, 12909, 11355, 9982, 13185, 6396, 12048, 0, 32779, 11200,
+    0, 28797, 8758, 10497, 0, 32819, 12833, 17159, 12868, 17053, 0, 28691, 16736, 4722, 28786, 32879,
+    4722, 10312, 0, 10516, 12897, 16736, 12694, 11460, 28681, 13107, 4440, 12323, 12322, 16779, 16658, 0,
+    0, 10577, 11381, 10880, 0, 10199, 12936, 9180, 28704, 17385, 12707, 9264, 0, 0, 0, 12673,
+    0, 11947, 0, 16516, 5971, 12408, 28807, 13211, 32922, 0, 0, 0, 28692, 12787, 32794, 13075,
+    10872, 11201, 11049, 13077, 28785, 28692, 11469, 12695, 0, 12527, 17016, 9204, 0, 8390, 13020, 12624,
+    12298, 17016, 17274, 0, 4567, 5206, 28718, 0, 6234, 13095, 9252, 8435, 9387, 16767, 28808, 28718,
+    0, 0, 9016, 16796, 12623, 12991, 12467, 9043, 16413, 8256, 32781, 6253, 28762, 0, 10437, 5070,
+    9918, 11556, 12300, 10880, 0, 28730, 5298, 0, 9620, 12647, 0, 6318, 12593, 8402, 32931, 16996,
+    12730, 28762, 11374, 12064, 6234, 12945, 28722, 17411, 0, 4405, 16598, 0, 0, 12440, 10881, 17091,
+    0, 8442, 32816, 28785, 9067, 17329, 28687, 16603, 9180, 11600, 12948, 0, 5765, 11741, 0, 12682,
+    11757, 10784, 0, 8282, 0, 0, 5592, 11713, 0, 28757, 16617, 12521, 11901, 11413, 10603, 6023,
+    0, 12532, 16529, 17072, 13160, 0, 32790, 28717, 5298, 12299, 17299, 28776, 0, 4826, 11348, 8853,
+    5900, 13077, 28824, 12965, 13076, 8606, 28737, 9649, 12463, 0, 11845, 12631, 12382, 16686, 12708, 13185,
+    4821, 13151, 0, 8555, 9085, 12970, 32840, 12525, 12899, 28733, 0, 8575, 0, 13004, 13026, 12297,
+    6438, 0, 12803, 5894, 12068, 28774, 0, 16658, 12592, 0, 0, 12696, 16667, 28819, 11179, 8356,
+    0, 32829, 0, 11733, 16529, 8876, 12576, 8760, 8356, 16982, 9180, 13016, 11336, 0, 0, 12791,
+    16461, 12885, 12065, 12780, 20482, 0, 16608, 12297, 28690, 9321, 32924, 28707, 0, 12912, 12969, 0,
+    6134, 13068, 28773, 8903, 9204, 11082, 28716, 28823, 0, 32830, 32844, 12705, 11469, 10285, 8988, 13029,
+    9261, 32778, 10901, 0, 28767, 12318, 28759, 4567, 12671, 17016, 17328, 12359, 0, 9292, 0, 9182,
+    16822, 8606, 12367, 32794, 12298, 5498, 12345, 16700, 5767, 6457, 9986, 0, 8643, 16752, 11479, 10931,
+    12300, 16852, 11268, 13197, 28752, 28677, 8941, 12348, 28787, 28735, 9067, 10880, 28711, 32828, 28754, 12309,
+    28796, 32934, 28711, 0, 16773, 5928, 13039, 4722, 9215, 0, 16596, 12837, 13076, 12311, 12522, 0,
+    12312, 12695, 12617, 9252, 5674, 0, 12552, 32919, 0, 8356, 13222, 32819, 12935, 12359, 13116, 0,
+    9153, 12743, 9068, 5488, 0, 9374, 11938, 32817, 28812, 11954, 12539, 5118, 10153, 8491, 28687, 28762,
+    11636, 16687, 9017, 0, 8321, 12404, 8296, 13050, 28710, 0, 28717, 9089, 28768, 16932, 32790, 11566,
+    13151, 28695, 28818, 28730, 12759, 0, 10255, 32845, 17250, 12610, 28813, 16698, 0, 9079, 32930, 12346,
+    0, 32794, 16437, 28679, 16901, 0, 12857, 6432, 5993, 0, 16854, 12660, 0, 8643, 12744, 12743,
+    10670, 0, 0, 28739, 6426, 12663, 0, 17319, 4917, 0, 9374, 5027, 10050, 28793, 32794, 0,
+    12335, 0, 0, 28720, 28811, 28796, 32920, 28768, 0, 28754, 17069, 4912, 28777, 11637, 12708, 16822,
+    12597, 0, 28736, 28807, 9249, 13088, 4434, 12717, 32820, 10880, 11410, 0, 12712, 9816, 0, 28758,
+    12947, 28810, 12816, 12863, 6265, 11142, 28783, 0, 28747, 11766, 13137, 12696, 0, 0, 12658, 5615,
+    0, 28704, 28780, 12839, 8663, 13043, 10583, 16763, 13185, 6402, 9562, 17377, 11470, 12476, 5521, 0,
+    4937, 10641, 9589, 4560, 5761, 16514, 0, 8663, 11480, 0, 12690, 0, 0, 28726, 0, 6457,
+    0, 16587, 28811, 5797, 10539, 12876, 28795, 16722, 8774, 17252, 32922, 32802, 10321, 16607, 12868, 9211,
+    28722, 0, 28798, 8935, 10969, 11955, 28725, 8701, 13169, 0, 8667, 0, 11711, 0, 16618, 12355,
+    16458, 9479, 0, 10389, 0, 12864, 28679, 0, 16992, 16858, 9931, 0, 9313, 16509, 12392, 11573,
+    16903, 8344, 0, 32777, 4397, 12684, 11079, 8571, 11976, 11680, 0, 8790, 28704, 11179, 6168, 17016,
+    12808, 11654, 0, 16534, 13221, 11430, 5392, 13066, 11498, 11141, 28707, 28696, 28804, 12778, 4570, 5389,
+    28824, 12988, 12407, 0, 0, 28705, 0, 9359, 6014, 0, 0, 32793, 28722, 28727, 12652, 9874,
+    11759, 8721, 10514, 10882, 16491, 8688, 28777, 32864, 0, 9539, 8278, 0, 12614, 0, 12786, 12076,
+    16892, 17388, 32879, 0, 28697, 28723, 28810, 0, 0, 28722, 12856, 0, 4356, 32897, 0, 32919,
+    28761, 6402, 12347, 8995, 0, 0, 10759, 20485, 5771, 28706, 12953, 28785, 12988, 9780, 28685, 12960,
+    16910, 28737, 17361, 16598, 13167, 28738, 12756, 12384, 12336, 8654, 28756, 0, 10348, 0, 28679, 28719,
+    12396, 0, 28756, 32857, 0, 12320, 12358, 16763, 28719, 10406, 12528, 16919, 32806, 8388, 9473, 28786,
+    13172, 9508, 5648, 0, 0, 5650, 0, 32804, 8599, 28721, 16763, 4666, 10453, 11700, 10573, 32780,
+    5387, 16774, 8881, 16688, 16588, 6214, 17009, 28747, 9892, 6303, 16895, 28805, 9315, 12667, 13065, 4557,
+    10263, 32831, 17035, 28695, 20485, 32792, 8395, 8701, 28763, 0, 8778, 28740, 0, 16766, 12640, 28807,
+    8366, 13184, 16643, 13068, 8488, 9684, 12823, 28737, 12570, 12300, 8701, 9363, 9234, 28737, 0, 0,
+    8922, 8757, 32818, 28822, 32792, 0, 9146, 13031, 16675, 8916, 12002, 0, 11480, 28714, 16508, 28715,
+    10554, 6344, 32919, 11777, 0, 32908, 0, 0, 6021, 16692, 12312, 13019, 8489, 32919, 9348, 12856,
+    5070, 0, 6215, 13174, 32868, 9044, 8916, 28734, 28810, 10610, 12463, 0, 4864, 28695, 16904, 28674,
+    28763, 5950, 12011, 16886, 6049, 16744, 12715, 12848, 17094, 28699, 32843, 9310, 17329, 28710, 12406, 28763,
+    12538, 9552, 0, 0, 10199, 28693, 16904, 16666, 0, 11956, 12924, 20487, 0, 12347, 0, 4414,
+    12607, 0, 8682, 12780, 12076, 28681, 12595, 5113, 8954, 12753, 11712, 12309, 11909, 8363, 12715, 16700,
+    32831, 28739, 12736, 12476, 6059, 16509, 16450, 32878, 12984, 12478, 0, 32922, 28789, 9554, 0, 17358,
+    17227, 13182, 28790, 8466, 10218, 12694, 8904, 20481, 10159, 0, 28801, 5235, 28775, 12382, 0, 28753,
+    13113, 12679, 10714, 13056, 16439, 10545, 12560, 28699, 16698, 28809, 12900, 11339, 12562, 0, 12704, 32878,
+    0, 17399, 17411, 32868, 8663, 9862, 16607, 32895, 0, 0, 13199, 11631, 16688, 12646, 0, 17072,
+    10076, 32844, 0, 9263, 28759, 0, 6232, 28755, 0, 0, 0, 12778, 32814, 6075, 0, 9315,
+    28750, 28770, 11910, 12585, 28683, 0, 9371, 12861, 17148, 8717, 16685, 13152, 0, 0, 10383, 10871,
+    12931, 10582, 17043, 12034, 12370, 12002, 11012, 16463, 13127, 6392, 9056, 0, 0, 12684, 13128, 28746,
+    11182, 13140, 12323, 28758, 13187, 5097, 28723, 4767, 32805, 11194, 10284, 12826, 12489, 16440, 28711, 32805,
+    5058, 8745, 12744, 5331, 0, 28800, 0, 0, 4302, 12790, 16852, 0, 28731, 28795, 17038, 6076,
+    16538, 17083, 4807, 12538, 12011, 12703, 32802, 10310, 0, 28822, 28760, 12466, 28793, 12564, 8426, 12977,
+    0, 0, 5489, 28781, 16699, 8475, 16540, 12836, 9354, 17249, 6437, 28695, 5648, 28720, 8854, 8409,
+    9082, 12742, 0, 5362, 12040, 8898, 28683, 0, 8364, 0, 0, 0, 0, 20482, 0, 10656,
+    13083, 0, 0, 16761, 12919, 0, 9656, 0, 32933, 8650, 13198, 32871, 32777, 10591, 32780, 8670,
+    6427, 12799, 12836, 11170, 8993, 17328, 12860, 17079, 9358, 9500, 0, 28706, 0, 11057, 28679, 12789,
+    9907, 28785, 6408, 28747, 12348, 28767, 8919, 32831, 0, 5585, 16983, 9206, 10414, 28785, 32843, 12549,
+    5291, 12486, 16857, 12651, 10554, 32845, 28692, 12540, 28706, 0, 10852, 16527, 12719, 0, 28815, 9501,
+    28754, 17093, 10998, 12600, 16992, 5613, 0, 13052, 28725, 16509, 20482, 5771, 16924, 17397, 28734, 20484,
+    6357, 9208, 11777, 28707, 12756, 0, 0, 13164, 16657, 32935, 9647, 0, 10409, 5037, 5764, 28699,
+    32845, 0, 12887, 12371, 5070, 32819, 9860, 32882, 9673, 20487, 32806, 5511, 16529, 0, 12039, 16509,
+    0, 4774, 10483, 28774, 10451, 0, 11451, 5234, 0, 12514, 9375, 10497, 32870, 8270, 12778, 16697,
+    28681, 28730, 0, 16886, 16914, 10758, 0, 0, 12360, 0, 28800, 16924, 0, 12078, 12960, 9984,
+    28735, 8368, 28798, 12299, 5233, 12456, 16833, 12049, 16541, 11356, 32893, 28822, 12586, 0, 9685, 0,
+    13007, 0, 16821, 5070, 16829, 28773, 28681, 20484, 28707, 28745, 16517, 10446, 28773, 12718, 9363, 32806,
+    8401, 0, 32817, 5350, 0, 12310, 28724, 11443, 16619, 12297, 28676, 28708, 17072, 16988, 16766, 0,
+    11348, 8915, 8466, 0, 32829, 10514, 5524, 12058, 32793, 12408, 5763, 5383, 6326, 9242, 12648, 5077,
+    0, 12679, 0, 28733, 0, 0, 28738, 8570, 28682, 8750, 20488, 17092, 16936, 32879, 9907, 11593,
+    0, 32919, 0, 0, 17072, 0, 16525, 12920, 16617, 8479, 28673, 5300, 8479, 12886, 0, 28759,
+    0, 0, 32883, 0, 0, 12700, 4464, 8458, 28807, 12348, 17210, 12861, 8360, 28693, 28699, 5076,
+    17377, 28770, 16766, 10400, 11049, 0, 0, 12617, 16924, 0, 28712, 11095, 13119, 17195, 0, 0,
+    10804, 28704, 28720, 32791, 16542, 12862, 28748, 16912, 12899, 28695, 0, 5104, 12779, 12525, 28822, 32838,
+    12708, 16778, 8362, 32930, 28762, 12343, 16608, 28817, 0, 12444, 12919, 13115, 32807, 9361, 12384, 20482,
+    17151, 13146, 12766, 9900, 9073, 12396, 0, 12850, 28778, 10697, 32781, 5759, 32779, 4898, 12308, 32845,
+    0, 12767, 12027, 0, 20485, 12775, 10263, 5508, 12862, 16901, 28686, 12840, 12743, 12321, 11274, 0,
+    0, 12823, 0, 13209, 17210, 28690, 0, 5362, 17151, 9898, 9916, 12930, 10505, 28785, 0, 12467,
+    16873, 28739, 16998, 12612, 0, 12324, 0, 12323, 17203, 12796, 11302, 32858, 32896, 12848, 0, 28746,
+    11573, 9610, 28704, 12495, 0, 12741, 28730, 0, 0, 16519, 12297, 0, 9728, 28749, 17289, 0,
+    12539, 32807, 5954, 32930, 10787, 28761, 17000, 16749, 12623, 28761, 28793, 9446, 6256, 28782, 5880, 12930,
+    13103, 28709, 10797, 8733, 32855, 5948, 20486, 16777, 16760, 12456, 8957, 0, 12632, 10378, 11184, 13212,
+    32829, 32829, 0, 12864, 5461, 8790, 11799, 12991, 32933, 0, 32869, 0, 13090, 12490, 16771, 32884,
+    0, 28701, 12671, 5628, 9593, 0, 13113, 28684, 6042, 28758, 11767, 12683, 28825, 12863, 28799, 0,
+    12666, 0, 8489, 0, 11638, 9003, 0, 12390, 28755, 10191, 0, 5628, 32845, 28798, 17044, 8446,
+    10853, 9800, 9852, 28734, 12311, 13080, 17352, 32884, 32838, 12067, 16430, 17044, 11889, 16617, 10789, 9198,
+    4614, 16925, 0, 11972, 8704, 0, 28739, 10218, 28748, 0, 12802, 28770, 28758, 12815, 12899, 5278,
+    0, 0, 28719, 16925, 28693, 16746, 8634, 12320, 11086, 28712, 0, 10342, 12727, 0, 28754, 6321,
+    12585, 12945, 17014, 12942, 9919, 9750, 11096, 32898, 0, 0, 0, 28718, 4977, 10412, 10787, 12533,
+    10954, 10837, 12952, 20485, 12762, 5282, 12713, 0, 13102, 11647, 0, 0, 9011, 12504, 13043, 32794,
+    28785, 0, 28748, 32845, 10861, 0, 0, 0, 12406, 28724, 12405, 12402, 32841, 0, 12909, 16585,
+    28739, 0, 28723, 16462, 12762, 0, 12539, 5851, 0, 28735, 0, 28676, 0, 32815, 12419, 12607,
+    28683, 28759, 11777, 0, 9918, 32816, 0, 12076, 0, 11506, 10621, 28797, 32844, 9834, 9288, 4625,
+    6382, 8706, 12887, 6386, 0, 11086, 9503, 9083, 12346, 8265, 12600, 28687, 0, 0, 28688, 32870,
+    5098, 16700, 0, 11933, 32844, 13017, 17410, 12420, 16666, 9343, 9381, 28673, 28824, 0, 0, 0,
+    0, 0, 16665, 16540, 28707, 0, 12839, 8955, 11898, 17132, 11102, 0, 28763, 0, 32842, 0,
+    9365, 10751, 17309, 12621, 4600, 12827, 16509, 12893, 0, 0, 9336, 32779, 5051, 32816, 17250, 0,
+    12670, 10553, 28685, 13196, 32775, 9989, 16696, 8451, 28795, 9321, 0, 0, 12742, 11142, 28752, 10759,
+    0, 16935, 12550, 8408, 0, 32856, 12406, 13163, 11678, 13020, 17396, 0, 12391, 0, 16750, 32792,
+    0, 16541, 12528, 0, 28825, 12298, 0, 28722, 32806, 5156, 5809, 12621, 32862, 13164, 32897, 6440,
+    13006, 16778, 28773, 32845, 12588, 6151, 8910, 0, 20483, 28745, 0, 4877, 12408, 0, 12384, 28719,
+    12621, 5109, 0, 32865, 17387, 32794, 12908, 13103, 17306, 0, 32807, 9380, 13039, 20485, 10671, 17128,
+    10378, 4652, 16539, 13043, 12948, 8350, 12420, 10746, 12584, 0, 0, 8465, 16912, 28762, 0, 8643,
+    0, 11703, 11151, 16907, 20489, 32885, 5672, 28694, 28699, 32897, 16755, 13152, 13182, 12444, 12621, 0,
+    8480, 0, 13186, 28763, 0, 12501, 10261, 32846, 0, 17062, 12067, 9662, 12777, 8760, 12334, 0,
+    11742, 17044, 0, 12479, 0, 0, 9253, 16459, 0, 6216, 10531, 28724, 28786, 12587, 0, 5501,
+    32937, 11151, 5955, 9964, 11152, 17049, 0, 28730, 28826, 11394, 16700, 10835, 32879, 28727, 0, 5418,
+    11693, 9518, 11531, 12465, 16412, 28719, 28797, 16516, 12419, 8365, 10743, 28781, 13120, 9381, 0, 12916,
+    13221, 0, 4853, 12585, 13120, 9044, 12920, 20481, 17399, 12368, 13150, 12344, 10713, 10199, 16461, 0,
+    0, 0, 12372, 11777, 0, 28807, 11459, 11393, 16911, 28755, 8255, 11045, 0, 32805, 9251, 9147,
+    0, 28692, 11404, 32832, 12575, 5710, 11678, 6069, 17307, 12828, 28757, 16461, 10459, 13092, 6002, 0,
+    13194, 0, 16598, 12924, 11340, 16833, 16420, 12703, 32831, 16767, 28699, 12562, 0, 0, 16449, 10490,
+    5750, 6210, 13150, 17150, 0, 11004, 28763, 28729, 16685, 11956, 11303, 12933, 32859, 17361, 12944, 13074,
+    11631, 12624, 28795, 13085, 0, 8478, 0, 13208, 12038, 28793, 6383, 28774, 28817, 16462, 17388, 11134,
+    12823, 12982, 0, 12528, 13007, 8358, 12595, 12893, 16698, 12624, 32780, 5544, 0, 11693, 11042, 12467,
+    9311, 12058, 28786, 10071, 8301, 32846, 0, 5829, 28817, 4962, 12694, 10882, 16974, 17069, 0, 0,
+    12468, 12549, 12583, 12957, 10792, 12514, 12956, 13220, 0, 16620, 0, 0, 0, 9620, 13150, 28809,
+    16816, 0, 13158, 8759, 13006, 0, 12560, 0, 13206, 8382, 12669, 16463, 0, 28745, 28775, 10852,
+    5157, 28816, 28739, 12509, 0, 12779, 12909, 0, 17071, 12884, 10582, 8461, 32789, 16541, 5585, 13148,
+    28820, 16799, 0, 6349, 13091, 16519, 28738, 8553, 28816, 0, 0, 0, 12984, 12600, 0, 28752,
+    9745, 12574, 17081, 12616, 0, 0, 28809, 17169, 4471, 0, 9955, 5982, 11676, 9760, 12057, 28684,
+    10415, 20487, 13043, 17377, 8368, 16735, 13135, 8314, 10371, 6245, 10570, 28746, 12530, 11683, 9897, 5717,
+    28817, 8421, 0, 16974, 0, 8774, 11709, 0, 16899, 0, 16571, 12982, 5311, 12322, 28728, 28752,
+    4776, 12621, 16935, 10860, 8314, 28713, 0, 28681, 12924, 16609, 13043, 17409, 32806, 12347, 10852, 12558,
+    0, 12756, 6189, 28755, 9342, 0, 13101, 16697, 28701, 28773, 12588, 10215, 28769, 16450, 28762, 16899,
+    11311, 10670, 16850, 28676, 12453, 12528, 28722, 11349, 8749, 5536, 28728, 12632, 12859, 28699, 10561, 10497,
+    0, 16447, 11104, 12753, 5076, 11985, 28773, 16608, 12888, 16746, 0, 16841, 16788, 9367, 28691, 0,
+    12467, 11443, 12343, 16832, 6258, 5928, 0, 20486, 28735, 10681, 12983, 10400, 0, 0, 12324, 10713,
+    28743, 5674, 17289, 0, 0, 8790, 6225, 13029, 20487, 10456, 28770, 12308, 12600, 12357, 11712, 16832,
+    16746, 28799, 17093, 4882, 32896, 28806, 12907, 0, 16460, 6051, 0, 9319, 12934, 0, 9022, 8469,
+    28741, 0, 0, 0, 16907, 10698, 12828, 12646, 10968, 0, 8384, 11566, 12789, 28776, 16597, 12720,
+    13019, 6189, 11151, 0, 28737, 0, 28748, 11340, 9593, 12915, 28797, 11435, 17248, 12777, 12574, 12406,
+    12729, 12851, 9089, 11647, 28675, 10969, 10077, 12297, 0, 6049, 12587, 16905, 28715, 17407, 16767, 10968,
+    16617, 12803, 11356, 9750, 13164, 16924, 12454, 12780, 0, 32820, 4966, 32870, 17093, 9631, 12407, 9384,
+    11274, 0, 12582, 12608, 28734, 6209, 28696, 0, 16528, 28800, 0, 5841, 32778, 17098, 16621, 9509,
+    0, 20489, 28713, 0, 32857, 17132, 9078, 0, 12324, 12573, 32819, 28706, 0, 10751, 16516, 11167,
+    12599, 0, 11450, 0, 28747, 12915, 17172, 10791, 0, 17253, 0, 10515, 5427, 10198, 0, 32868,
+    0, 0, 8957, 17082, 17038, 9081, 32935, 12312, 6179, 17116, 32898, 6127, 12716, 16937, 28811, 16450,
+    12419, 28719, 0, 13104, 16779, 16676, 32781, 8761, 0, 11633, 12681, 0, 32806, 9275, 12826, 16993,
+    12563, 9619, 9087, 17202, 32869, 16769, 16666, 0, 12394, 17377, 28787, 11095, 12499, 12825, 17369, 0,
+    28781, 12528, 12920, 8623, 0, 6232, 6447, 32869, 12871, 13139, 5629, 10343, 16746, 28746, 17218, 32856,
+    12967, 13115, 28767, 12049, 32794, 0, 10714, 5368, 28729, 16761, 28696, 10250, 32793, 0, 8962, 0,
+    28682, 32881, 12800, 17227, 0, 11458, 12847, 11170, 5368, 0, 28747, 13139, 11386, 0, 0, 12894,
+    9311, 8788, 28809, 10787, 13052, 0, 16460, 17306, 28823, 6364, 0, 11089, 10494, 16887, 32937, 0,
+    9954, 0, 17289, 11460, 6014, 0, 8955, 12079, 12966, 9975, 12690, 12726, 0, 16913, 12531, 28809,
+    12812, 4976, 12741, 8712, 0, 10206, 28725, 17158, 13036, 32930, 28789, 8422, 32805, 11256, 12396, 9211,
+    32879, 12540, 32896, 32856, 5708, 0, 0, 0, 12789, 13079, 5620, 32829, 6466, 12527, 0, 28696,
+    0, 28691, 28753, 4867, 16621, 8789, 0, 28703, 28691, 0, 5922, 17299, 28798, 28783, 10816, 0,
+    13119, 0, 8664, 16890, 28794, 10813, 12429, 13112, 16755, 12633, 10184, 12691, 0, 11639, 16853, 12788,
+    0, 9620, 12075, 28809, 28827, 0, 10837, 12837, 12900, 9593, 11202, 0, 10273, 12323, 0, 28689,
+    12513, 0, 12887, 11602, 13053, 0, 8723, 11086, 12946, 12810, 4614, 28715, 0, 9058, 28756, 12886,
+    16586, 12972, 0, 20485, 12751, 17407, 8768, 32853, 12575, 12503, 0, 12840, 0, 12609, 9863, 17003,
+    13013, 8723, 12731, 16844, 0, 0, 9356, 5019, 12526, 16528, 13074, 17220, 20483, 32872, 0, 0,
+    17238, 0, 28772, 32897, 5351, 0, 12443, 10254, 0, 16430, 0, 0, 28760, 11469, 28750, 0,
+    17309, 17082, 12683, 12587, 32881, 9057, 12977, 10400, 8390, 12707, 13063, 17014, 16825, 9309, 9985, 0,
+    32832, 13218, 10760, 12630, 0, 9085, 11410, 0, 12298, 0, 5994, 28729, 0, 17129, 13175, 12369,
+    11780, 0, 16588, 0, 0, 12694, 12695, 16912, 32894, 11685, 11136, 12713, 28754, 10861, 16925, 28755,
+    12756, 9000, 0, 28717, 28716, 28819, 11734, 0, 13065, 12804, 13088, 28755, 32937, 16536, 32807, 13096,
+    13005, 8766, 32807, 8439, 9687, 12548, 4869, 28712, 0, 28742, 28758, 28797, 13017, 8491, 12976, 12297,
+    5032, 12563, 10414, 11872, 12000, 28745, 13198, 28745, 28823, 16991, 9367, 32897, 12324, 12808, 8920, 6053,
+    8966, 16597, 12948, 28817, 28787, 17377, 28694, 11702, 12714, 12744, 0, 28709, 12706, 8709, 28708, 0,
+    28741, 12598, 28755, 8452, 8790, 10847, 28785, 28710, 28737, 12719, 16776, 28708, 0, 5770, 12478, 11759,
+    8491, 16927, 0, 17059, 0, 8776, 17150, 10915, 10189, 0, 0, 10364, 28745, 11654, 0, 13016,
+    28715, 10156, 0, 16686, 28748, 12979, 28788, 12707, 16765, 12406, 11334, 0, 8422, 10862, 12718, 17228,
+    16890, 12562, 12755, 0, 12477, 12611, 17011, 12632, 28734, 28723, 0, 12888, 32931, 5583, 0, 16977,
+    8962, 9846, 0, 32871, 12695, 16943, 9617, 6447, 10515, 9961, 32859, 11866, 10711, 0, 11749, 17239,
+    10568, 32932, 9619, 16992, 12888, 8745, 5048, 12561, 11303, 0, 28755, 17220, 11225, 10567, 0, 28821,
+    16935, 10700, 0, 11357, 5583, 13054, 28708, 8413, 0, 10456, 5310, 12465, 12810, 12684, 28731, 16619,
+    0, 13220, 12689, 0, 13140, 17237, 8722, 0, 16451, 11145, 12670, 12696, 9352, 16856, 17116, 0,
+    6457, 28731, 13035, 32934, 28797, 12960, 10735, 0, 13107, 10205, 17273, 0, 0, 0, 12383, 0,
+    4640, 9388, 6217, 5011, 16835, 17081, 0, 16779, 0, 10544, 8790, 17411, 11387, 5459, 12575, 11931,
+    17037, 17171, 28776, 4682, 5673, 12621, 9908, 0, 6180, 10871, 32804, 10957, 9517, 28748, 5649, 16779,
+    12010, 10759, 12480, 0, 12884, 9620, 11356, 16619, 0, 0, 0, 0, 11204, 12682, 12394, 13151,
+    17129, 0, 4982, 13209, 28797, 9970, 28798, 0, 0, 6278, 9964, 13008, 12828, 0, 13034, 10788,
+    28742, 0, 10815, 5323, 32865, 28752, 8775, 5906, 12696, 28791, 0, 17090, 12645, 12334, 0, 4975,
+    8965, 10378, 5097, 12814, 8779, 12836, 0, 0, 11956, 0, 11703, 0, 28785, 0, 12322, 5105,
+    0, 4842, 12716, 0, 12682, 28677, 17394, 11838, 16835, 0, 12885, 13137, 12864, 0, 8666, 32881,
+    32831, 12587, 0, 17227, 4880, 0, 12907, 28750, 13095, 13127, 12946, 13100, 28823, 11451, 17376, 8711,
+    16541, 12586, 0, 8768, 10194, 32833, 12813, 0, 16451, 28690, 0, 0, 0, 0, 32820, 0,
+    12311, 16492, 11403, 10115, 4296, 17149, 17050, 13114, 11339, 12915, 11730, 0, 11710, 0, 12812, 11530,
+    12382, 12984, 11113, 9000, 17004, 28755, 32883, 28679, 13014, 0, 20488, 8359, 10162, 12443, 12828, 32803,
+    9172, 12935, 10862, 11802, 11765, 17072, 0, 16925, 9178, 28754, 17386, 9041, 11759, 0, 17159, 0,
+    13208, 0, 13016, 32882, 12420, 28740, 10814, 0, 13044, 9863, 28707, 10558, 10281, 0, 11294, 0,
+    12840, 0, 12479, 16933, 9917, 11050, 12956, 10017, 0, 10281, 12513, 8994, 28695, 13209, 0, 16529,
+    16429, 12683, 32922, 16919, 16779, 10206, 4295, 0, 0, 16858, 9075, 9564, 11683, 28735, 12837, 12564,
+    12612, 13182, 17002, 12528, 9919, 13019, 0, 28739, 10517, 28679, 16934, 0, 12564, 11684, 16767, 13151,
+    9892, 16578, 13080, 12968, 12551, 28735, 0, 0, 12984, 13052, 0, 13135, 11947, 8317, 8470, 28714,
+    12468, 28788, 0, 12057, 17080, 12548, 12573, 10558, 13075, 13182, 0, 28809, 12886, 28728, 13139, 28754,
+    0, 13146, 32898, 12348, 16765, 12633, 12620, 32853, 10517, 12942, 10872, 28799, 12456, 0, 0, 28810,
+    28755, 12839, 16926, 13140, 10505, 10852, 0, 9321, 28784, 13074, 9199, 13101, 0, 0, 12407, 32856,
+    16767, 0, 5662, 0, 32841, 10780, 10507, 10566, 12575, 28693, 13207, 0, 11899, 12408, 9593, 6431,
+    0, 9608, 11265, 13041, 17047, 12779, 32794, 10114, 28699, 11171, 28715, 16844, 8414, 12516, 0, 0,
+    12587, 12432, 12621, 9310, 12466, 13194, 11402, 12885, 5911, 32872, 12574, 5433, 12408, 20484, 0, 12587,
+    20483, 32924, 16855, 11930, 17052, 32794, 28752, 11521, 9066, 9059, 9965, 11992, 0, 17001, 16528, 13137,
+    0, 16529, 9656, 32934, 10554, 13210, 13063, 0, 32820, 4895, 16838, 11460, 8745, 13194, 32894, 17297,
+    16527, 28729, 10448, 10564, 9918, 12934, 16937, 28720, 12624, 17099, 28765, 0, 11168, 16842, 28733, 12707,
+    9059, 13174, 5433, 16527, 8768, 0, 13158, 12371, 13040, 11846, 8488, 10160, 9386, 12935, 0, 8469,
+    11657, 11458, 12648, 16697, 8458, 0, 12862, 28772, 0, 16886, 12467, 13068, 12695, 0, 11388, 12966,
+    12622, 12056, 12430, 0, 28819, 9078, 4727, 32906, 11006, 5360, 0, 28806, 12574, 13181, 12562, 0,
+    28719, 5678, 0, 11953, 12048, 16989, 13101, 32934, 0, 12755, 28751, 28746, 8768, 13051, 12683, 0,
+    0, 28708, 12509, 28690, 17368, 12408, 13176, 13051, 0, 12934, 32832, 0, 0, 9618, 0, 28783,
+    28735, 11467, 28744, 11633, 6108, 28778, 0, 10742, 12959, 28821, 8422, 9686, 0, 9971, 28764, 20483,
+    28734, 12568, 0, 28726, 0, 0, 12852, 0, 11411, 28790, 16657, 9075, 0, 16900, 0, 9619,
+    8274, 12002, 5455, 9022, 28795, 17062, 6411, 16700, 28789, 10272, 12383, 16934, 4412, 8722, 0, 5921,
+    32883, 28751, 12468, 11395, 11703, 0, 0, 0, 11340, 10457, 9809, 6132, 8421, 16608, 16903, 12009,
+    13013, 8422, 10578, 8667, 8424, 11607, 17250, 11780, 11766, 11357, 28727, 0, 11345, 32846, 28805, 0,
+    5570, 5811, 4982, 8904, 28747, 0, 0, 5106, 0, 0, 12900, 12609, 10882, 13007, 12875, 13139,
+    5970, 11302, 11441, 12453, 8461, 5662, 13140, 13175, 12516, 0, 0, 0, 16618, 28790, 28750, 0,
+    0, 12607, 28752, 0, 4469, 17282, 0, 12696, 9088, 12946, 13161, 0, 12372, 0, 28680, 11679,
+    9687, 12970, 11518, 0, 6393, 9986, 10184, 28750, 12923, 0, 12778, 12624, 9377, 13199, 12816, 11655,
+    17161, 0, 0, 12705, 0, 11502, 13205, 10413, 17083, 17141, 28827, 12501, 12899, 0, 12656, 6409,
+    16778, 17071, 20484, 0, 12624, 0, 28747, 12839, 0, 12563, 11611, 0, 13187, 0, 10198, 11750,
+    12799, 8480, 28712, 10711, 12407, 28790, 28735, 8831, 28769, 0, 0, 12703, 0, 32826, 28683, 0,
+    28760, 28762, 0, 9012, 16858, 28726, 9142, 28793, 0, 0, 0, 32893, 9255, 28822, 28802, 4805,
+    12696, 9984, 9388, 12810, 12585, 32894, 8460, 13076, 28740, 6355, 0, 16462, 16980, 12905, 32832, 11168,
+    0, 0, 28710, 13066, 17161, 20486, 12960, 28728, 16921, 9309, 0, 16948, 17083, 12804, 0, 28750,
+    12827, 10191, 28781, 8986, 0, 8584, 11603, 28703, 11655, 0, 12896, 17298, 16922, 5444, 12763, 16450,
+    12899, 11638, 13035, 32906, 12683, 28716, 32868, 28787, 17012, 0, 28741, 11701, 11115, 6235, 16537, 10581,
+    0, 17411, 12537, 28781, 16621, 13206, 32844, 32936, 0, 12456, 16662, 12309, 0, 28811, 9068, 28815,
+    13199, 28807, 12632, 12549, 8775, 32930, 4721, 17129, 17000, 0, 12708, 5620, 12729, 12808, 12897, 32843,
+    9649, 0, 12056, 17016, 28770, 16697, 10517, 11592, 28715, 10190, 13064, 0, 0, 0, 13092, 28727,
+    0, 12598, 12588, 11836, 0, 10206, 11356, 6465, 28750, 4688, 10789, 12515, 12476, 28778, 10152, 10257,
+    16834, 28749, 32906, 28760, 0, 9085, 12611, 11004, 6211, 28746, 12744, 9065, 12720, 11468, 28746, 10549,
+    16539, 11767, 16845, 0, 12551, 0, 0, 0, 9908, 0, 13172, 6319, 12033, 11413, 9064, 12560,
+    12839, 28691, 16688, 0, 0, 0, 10581, 12777, 16451, 0, 28684, 12670, 10505, 11684, 6364, 28695,
+    12372, 12492, 12682, 9654, 5993, 0, 28760, 0, 11901, 11460, 0, 0, 10160, 8367, 10414, 0,
+    28730, 10449, 13062, 0, 13031, 5076, 10965, 4752, 12041, 0, 0, 5076, 28828, 10370, 32802, 16947,
+    0, 0, 4976, 11477, 6347, 5068, 16463, 10393, 12672, 28727, 9248, 13140, 28750, 32865, 0, 11780,
+    0, 28730, 12888, 12996, 10837, 16932, 4955, 13043, 28727, 0, 10378, 12956, 9686, 17014, 11304, 17059,
+    13077, 10635, 32804, 4710, 17094, 4955, 28747, 0, 12037, 9657, 6440, 17352, 13030, 0, 28810, 12680,
+    13169, 32868, 6409, 5105, 6410, 0, 5920, 16925, 12564, 0, 0, 13188, 0, 11450, 17386, 12777,
+    0, 4628, 0, 9686, 6233, 0, 0, 10710, 0, 13007, 6079, 12684, 0, 28822, 20485, 12766,
+    16993, 0, 0, 12776, 9917, 0, 12778, 32833, 28800, 12648, 0, 12536, 16588, 16447, 6174, 28770,
+    10881, 16980, 6151, 12995, 11813, 17219, 12924, 16765, 5894, 11255, 10451, 12574, 9686, 5920, 11709, 32929,
+    6042, 8313, 11938, 8478, 0, 28808, 10255, 0, 32842, 28747, 11757, 10870, 9059, 28696, 12560, 5786,
+    12744, 11263, 9982, 12741, 12914, 13029, 9512, 12384, 9265, 9685, 12915, 12532, 6020, 16880, 0, 0,
+    10584, 17158, 5825, 17138, 11274, 10933, 17308, 13171, 11171, 10813, 12995, 11993, 8789, 28754, 13100, 12588,
+    0, 10283, 12908, 11385, 13104, 10371, 5454, 17250, 0, 8768, 11983, 12813, 12744, 10714, 12570, 16736,
+    6456, 17014, 0, 0, 12576, 28746, 6216, 10566, 16540, 11143, 0, 17128, 0, 12536, 9666, 13116,
+    28757, 0, 17016, 10744, 32885, 32794, 5042, 9687, 13182, 0, 16815, 13078, 0, 12812, 4465, 11740,
+    12684, 0, 20485, 10868, 13175, 32935, 28773, 12826, 12790, 0, 32842, 11231, 28821, 0, 12596, 12641,
+    5351, 9852, 16885, 32818, 12894, 12911, 13157, 9545, 28785, 28704, 8966, 12703, 6169, 12689, 9204, 28739,
+    12513, 0, 0, 12923, 8469, 12716, 28743, 12779, 5360, 4721, 0, 12551, 0, 0, 16823, 12607,
+    28770, 10580, 12816, 13148, 11170, 11644, 0, 9985, 28740, 11088, 11739, 10108, 0, 9808, 12713, 12887,
+    9075, 10160, 13212, 13044, 12551, 16982, 28733, 28808, 0, 10199, 11601, 11740, 8712, 12430, 9430, 0,
+    16667, 17132, 5584, 28699, 28726, 13116, 16524, 10461, 8489, 11304, 0, 13089, 9974, 28713, 16835, 32843,
+    28709, 17240, 8549, 16842, 8712, 12740, 28765, 12705, 0, 0, 0, 10482, 28821, 12907, 0, 11401,
+    32934, 28812, 0, 10514, 10667, 12780, 13183, 11167, 8480, 12912, 10482, 16983, 17280, 16923, 16498, 13217,
+    11113, 32817, 9002, 32910, 8703, 12836, 28820, 0, 17273, 0, 28742, 28753, 16974, 28705, 16779, 12799,
+    12917, 12785, 0, 11160, 11477, 13165, 0, 28773, 12573, 12812, 9241, 28799, 28784, 12032, 28791, 0,
+    6141, 12526, 10285, 9377, 28717, 0, 0, 16924, 16463, 0, 0, 12671, 28741, 0, 28775, 8351,
+    12884, 11687, 12852, 9019, 0, 28797, 4519, 0, 28766, 28727, 0, 28734, 12312, 10149, 9935, 12847,
+    28727, 32840, 0, 0, 17140, 28715, 9853, 0, 5657, 17368, 0, 0, 6172, 4955, 11046, 0,
+    0, 8657, 0, 12595, 8461, 13220, 32935, 5838, 8848, 12803, 9852, 28793, 5662, 28740, 12569, 0,
+    12500, 0, 16993, 28784, 0, 12657, 0, 28681, 0, 12502, 13195, 10444, 13076, 16846, 0, 17317,
+    10283, 0, 12467, 4358, 32907, 12942, 12791, 32871, 0, 28690, 8282, 12536, 0, 0, 8364, 12000,
+    28760, 0, 16779, 12572, 11328, 9388, 0, 12000, 28726, 13104, 12803, 28767, 0, 32792, 12756, 17248,
+    9935, 28792, 17049, 13114, 9563, 12011, 11357, 13017, 0, 0, 12576, 32827, 10557, 0, 9518, 32933,
+    28737, 11340, 9674, 17010, 11937, 0, 10152, 12791, 17129, 16742, 9318, 28760, 9619, 10160, 10298, 12958,
+    10748, 16436, 12648, 16934, 13006, 10679, 28773, 5211, 8576, 0, 16530, 13103, 17326, 28745, 0, 10551,
+    28737, 6394, 11827, 9218, 28808, 12934, 12383, 17229, 8488, 11291, 11344, 12380, 28764, 16885, 12645, 28811,
+    9956, 0, 8778, 9387, 11983, 9088, 17309, 28682, 0, 28805, 13062, 12860, 0, 12995, 20486, 13080,
+    12564, 9088, 28779, 32865, 0, 12904, 32875, 32820, 10413, 11656, 12607, 6360, 32843, 16982, 9010, 28751,
+    28796, 17226, 0, 0, 16777, 12485, 13172, 17387, 28821, 28706, 28677, 5478, 0, 17385, 32830, 10872,
+    0, 6050, 0, 12717, 28730, 12850, 11009, 0, 28817, 16492, 6222, 16620, 12702, 0, 6305, 28703,
+    0, 0, 12427, 13137, 0, 10976, 4966, 16835, 12490, 0, 9307, 13008, 9388, 16888, 17057, 6179,
+    11983, 11349, 32853, 4363, 11385, 28684, 32917, 16735, 12916, 17096, 12777, 16885, 12886, 5490, 28680, 28818,
+    0, 28698, 10115, 9367, 16530, 12658, 32883, 10483, 12948, 28790, 9085, 11602, 0, 11115, 12549, 9255,
+    12659, 5495, 28782, 12972, 10216, 0, 10584, 28815, 12607, 11946, 0, 9683, 28733, 0, 12515, 16825,
+    12713, 10437, 8666, 12504, 28820, 9590, 0, 0, 0, 32868, 12819, 8779, 12503, 9385, 0, 8600,
+    12680, 28739, 9294, 12540, 12656, 32804, 9790, 12574, 5672, 0, 5546, 12611, 28727, 9239, 0, 13090,
+    32806, 5301, 10482, 17173, 0, 12695, 12454, 28788, 28719, 10648, 28785, 16542, 12918, 28693, 0, 12658,
+    12798, 0, 12475, 12547, 16999, 0, 16982, 17408, 28765, 0, 12576, 0, 0, 10668, 6439, 28776,
+    28770, 0, 16980, 28683, 5620, 10012, 17004, 0, 12491, 9510, 0, 12981, 0, 9387, 12462, 28703,
+    28761, 0, 12728, 12479, 12743, 28788, 17388, 0, 12705, 12538, 12826, 12585, 10364, 6365, 0, 0,
+    17161, 13036, 9744, 0, 16989, 12482, 9377, 8412, 17083, 12859, 0, 10868, 16451, 13004, 12048, 10816,
+    0, 17249, 0, 12932, 20484, 10101, 32844, 32803, 10658, 16509, 8322, 13139, 13007, 12900, 12428, 0,
+    12630, 11638, 12945, 0, 32846, 16751, 0, 10584, 12540, 16757, 0, 10285, 12406, 17332, 11895, 16604,
+    13115, 32829, 11813, 11349, 12955, 13004, 0, 32816, 12561, 0, 28811, 28728, 9974, 10947, 28811, 0,
+    11004, 0, 17095, 10496, 13138, 32846, 5666, 12552, 17397, 0, 0, 10348, 10572, 5433, 12586, 12600,
+    4210, 13008, 0, 12813, 6233, 12600, 9791, 13197, 0, 28737, 8721, 32937, 10254, 0, 16855, 12379,
+    11414, 12713, 10254, 28828, 6050, 9593, 8414, 28760, 0, 28783, 0, 28770, 16928, 12597, 12984, 10210,
+    8899, 10747, 11312, 12548, 12848, 13038, 16688, 28784, 0, 10750, 10115, 8461, 17190, 9563, 8491, 12564,
+    0, 28742, 11603, 5545, 10215, 28691, 9914, 12944, 6456, 11627, 28740, 13206, 10957, 13092, 10515, 16844,
+    12684, 11709, 32844, 5591, 10922, 8704, 0, 16825, 12982, 12875, 16934, 11539, 0, 12561, 0, 28794,
+    11312, 8397, 28773, 8367, 16917, 5695, 28675, 28820, 32819, 6021, 0, 12472, 16448, 8667, 28683, 28725,
+    12767, 12658, 0, 9192, 12907, 10468, 32831, 13140, 9350, 13037, 13183, 4949, 5076, 13196, 0, 0,
+    13139, 0, 12947, 10206, 13031, 13044, 0, 0, 12415, 5563, 12682, 0, 8367, 16972, 13031, 8368,
+    10456, 0, 0, 11093, 0, 13160, 12899, 12916, 13079, 13004, 28703, 12960, 13164, 32937, 13007, 12432,
+    16845, 12633, 9657, 28684, 17049, 11046, 12540, 9321, 28683, 10797, 20487, 20490, 4785, 11049, 12657, 17044,
+    28817, 28786, 13171, 8479, 12778, 0, 11050, 13008, 28740, 13152, 12776, 11639, 28757, 9578, 11104, 13031,
+    10517, 10969, 32853, 12728, 12780, 32820, 12079, 28768, 0, 0, 12536, 28750, 32906, 12312, 0, 5993,
+    11872, 12996, 0, 16886, 12861, 16935, 28729, 12874, 0, 9495, 0, 17003, 13019, 9022, 0, 11264,
+    9649, 10412, 0, 9982, 10190, 12754, 28717, 32842, 0, 13184, 12741, 0, 11900, 11627, 13195, 17329,
+    28766, 32818, 12588, 13032, 16989, 0, 28769, 17060, 12552, 12883, 0, 0, 32935, 28773, 13185, 11656,
+    0, 12611, 0, 13164, 11004, 6325, 10482, 10879, 0, 9387, 12958, 28682, 0, 0, 0, 28807,
+    16539, 28820, 17405, 12861, 0, 17116, 0, 9280, 11009, 0, 12528, 10490, 0, 0, 9376, 13124,
+    13152, 0, 12756, 11004, 13140, 13166, 0, 16900, 16972, 12849, 9357, 10247, 9350, 0, 13128, 0,
+    9601, 0, 12683, 11642, 5987, 0, 16778, 12671, 20486, 11104, 0, 28756, 10698, 12551, 16598, 9975,
+    0, 17283, 28824, 28704, 9809, 11386, 0, 13111, 5433, 6107, 32794, 11096, 28706, 11357, 12708, 32831,
+    0, 0, 0, 10285, 28782, 13221, 5360, 9609, 8966, 12996, 28755, 12699, 10969, 12474, 13174, 32910,
+    12647, 4728, 0, 5657, 0, 28719, 8778, 17002, 12647, 0, 11009, 17139, 32881, 32897, 11627, 5368,
+    9600, 12336, 13197, 13176, 0, 13055, 16992, 9676, 0, 12696, 28733, 12426, 0, 11953, 13207, 5358,
+    12556, 17172, 10792, 28775, 5076, 17004, 8875, 0, 0, 10696, 11648, 9962, 16685, 13136, 9366, 0,
+    13138, 13164, 8712, 16440, 11143, 13006, 10996, 6181, 12636, 17174, 0, 32923, 10206, 0, 28745, 0,
+    12647, 28684, 16656, 12491, 12907, 0, 28782, 9610, 5254, 0, 13126, 12767, 20485, 5663, 17202, 9620,
+    17116, 12840, 9684, 0, 11179, 0, 13090, 13161, 10735, 0, 32814, 12614, 11602, 0, 32792, 28701,
+    28709, 28742, 8605, 8478, 9300, 10805, 11131, 0, 0, 11633, 9320, 12465, 28720, 11180, 10568, 12795,
+    11627, 12907, 32820, 12407, 10759, 13079, 13150, 28713, 10152, 12912, 0, 0, 13145, 4983, 28710, 0,
+    10290, 12872, 8788, 0, 11983, 28822, 5107, 4983, 12372, 28747, 4976, 32907, 12900, 8453, 9674, 12049,
+    11975, 17122, 0, 12888, 28752, 9011, 11091, 0, 28704, 9019, 0, 10251, 28781, 8477, 28727, 28824,
+    6189, 0, 28711, 17062, 0, 32842, 12443, 28718, 0, 0, 11893, 5900, 11148, 12754, 0, 5885,
+    11058, 13007, 5096, 12916, 12490, 8911, 28786, 0, 9954, 0, 6398, 0, 20482, 12552, 17004, 17173,
+    28745, 28730, 5563, 8903, 28771, 5620, 12621, 17327, 9073, 0, 12393, 12887, 12540, 17328, 0, 28750,
+    11171, 9618, 0, 16935, 9386, 0, 28707, 12492, 17159, 12040, 0, 9265, 8466, 16437, 28703, 28756,
+    10814, 16879, 6205, 28762, 12474, 17376, 13102, 12917, 17149, 32846, 0, 16540, 11648, 0, 12828, 12564,
+    10283, 12849, 17052, 17387, 6234, 6319, 11602, 13078, 12635, 5427, 0, 16515, 9321, 5557, 16808, 6217,
+    32869, 17015, 9563, 0, 10254, 12693, 12772, 28691, 9384, 9310, 9685, 28786, 17238, 28721, 10850, 12384,
+    9388, 5570, 0, 11267, 0, 28761, 0, 9384, 8786, 17385, 16909, 12814, 0, 4827, 16892, 4424,
+    32906, 9281, 10199, 12552, 17202, 9321, 12635, 0, 6219, 28803, 0, 10571, 0, 11565, 28761, 8424,
+    11905, 4860, 17359, 12671, 0, 11673, 12804, 9846, 12753, 12480, 28730, 9780, 0, 12296, 17095, 4800,
+    11608, 0, 13005, 16919, 28714, 28758, 12384, 28747, 9833, 0, 0, 20484, 9554, 16845, 13205, 10797,
+    28720, 16966, 17202, 12792, 0, 28733, 4616, 0, 11690, 12897, 32804, 8610, 12564, 13186, 12575, 28728,
+    9892, 12453, 9320, 6205, 0, 13100, 11012, 17080, 0, 28708, 8405, 0, 11091, 0, 10411, 0,
+    32895, 28759, 28764, 12703, 28782, 4525, 10237, 0, 12596, 8271, 32820, 9043, 12646, 12549, 13006, 6226,
+    17036, 17003, 0, 12983, 4293, 12703, 12656, 17238, 8422, 16615, 9676, 32828, 9517, 28796, 10878, 16617,
+    13036, 32815, 8787, 12852, 12624, 10743, 0, 28679, 28728, 0, 11090, 28715, 0, 12617, 9219, 16578,
+    0, 13219, 8489, 10805, 28680, 12079, 13116, 0, 12712, 0, 0, 12995, 12693, 32870, 16738, 32807,
+    6003, 28762, 12862, 32845, 16585, 17238, 28808, 13157, 28759, 11937, 28762, 12583, 28692, 28673, 28803, 12479,
+    11872, 12490, 8941, 10189, 0, 13128, 28794, 10459, 0, 5620, 28711, 9341, 28796, 0, 0, 6050,
+    28747, 28792, 10217, 11984, 13148, 0, 12992, 5098, 28748, 11182, 5649, 12321, 12691, 0, 12360, 28824,
+    12611, 32865, 12563, 28763, 28675, 4520, 28765, 16621, 12669, 13185, 10447, 17070, 12040, 0, 32883, 12611,
+    0, 4775, 6356, 10215, 17016, 16833, 10676, 6427, 12670, 12799, 12689, 17016, 0, 28823, 11702, 17015,
+    12576, 10502, 11177, 0, 0, 13033, 12465, 12540, 10975, 12807, 10263, 20488, 32859, 17201, 10507, 16767,
+    16846, 10782, 17053, 12455, 8957, 28679, 11003, 17220, 12731, 6056, 6457, 12396, 6365, 28747, 17045, 17043,
+    12718, 0, 11593, 12802, 32846, 16446, 17249, 28739, 16979, 13160, 13008, 12406, 0, 0, 11436, 13137,
+    8934, 28719, 9857, 16772, 0, 0, 12429, 16676, 0, 13164, 12440, 12511, 32845, 0, 5074, 4728,
+    12840, 6226, 0, 28689, 16983, 12864, 28822, 13212, 28811, 12945, 10704, 13008, 16825, 16904, 0, 28796,
+    10414, 12058, 17286, 11296, 6299, 11953, 11375, 28810, 12605, 0, 13173, 28730, 28784, 0, 32906, 11058,
+    9833, 32805, 9233, 13164, 28806, 12754, 10116, 20488, 6319, 28775, 10975, 12657, 5584, 0, 6123, 8368,
+    11673, 28678, 32896, 16937, 12371, 9022, 12600, 13219, 12478, 12906, 17385, 0, 12852, 10510, 32911, 17411,
+    13152, 28772, 6143, 12480, 0, 11685, 28776, 28806, 12456, 32885, 11430, 9089, 4876, 11686, 12684, 9384,
+    12477, 6279, 11778, 11003, 17170, 12418, 12896, 12550, 0, 11442, 11356, 8927, 12456, 9219, 0, 0,
+    16676, 6327, 12824, 32895, 0, 12058, 12564, 11685, 12882, 12849, 0, 17072, 0, 11447, 12691, 0,
+    16971, 10443, 12597, 0, 0, 0, 5655, 28695, 17171, 12623, 11271, 6054, 12420, 0, 17122, 9816,
+    13037, 28755, 0, 6058, 11684, 16987, 0, 12622, 28731, 5894, 10781, 32814, 12848, 11594, 12984, 28782,
+    0, 6151, 12066, 12539, 28775, 11403, 9608, 28755, 12684, 12701, 32864, 0, 13032, 8470, 10558, 28783,
+    16776, 28797, 8414, 28728, 28762, 10567, 0, 10740, 28713, 12632, 16902, 0, 10751, 13039, 13037, 32819,
+    32845, 28774, 4728, 12526, 0, 11480, 12692, 0, 12969, 10107, 12467, 6042, 0, 12983, 12932, 0,
+    0, 9087, 12780, 13138, 0, 8767, 8713, 13019, 11302, 12970, 9863, 13018, 10118, 28704, 10583, 28808,
+    0, 28716, 12619, 12527, 13139, 10750, 12609, 12454, 12516, 0, 28763, 16699, 13158, 10197, 16993, 12336,
+    11160, 13164, 12765, 8667, 9087, 9895, 32920, 0, 13112, 0, 28729, 9088, 11844, 17329, 12672, 28762,
+    9986, 5366, 11383, 0, 32933, 16854, 0, 32871, 32871, 13148, 9900, 9853, 12851, 13090, 32820, 0,
+    10142, 11647, 9863, 8704, 12933, 13159, 0, 6189, 0, 9078, 11602, 32880, 13101, 12797, 28759, 12468,
+    12551, 0, 28763, 10443, 9059, 12852, 0, 11768, 0, 0, 10797, 10285, 12900, 10973, 6217, 0,
+    11050, 28728, 10778, 13005, 10758, 8422, 8854, 0, 28696, 0, 12788, 0, 11566, 16529, 5097, 12552,
+    32922, 11296, 0, 10076, 32831, 0, 17253, 6171, 9986, 13076, 12800, 12392, 12837, 12959, 12600, 10787,
+    6217, 11459, 20481, 10452, 12635, 17158, 0, 32832, 12550, 28721, 10493, 10254, 17003, 10813, 10736, 13126,
+    0, 17228, 13220, 13150, 12300, 12660, 28798, 28741, 0, 12586, 28747, 0, 28810, 6216, 0, 5461,
+    9909, 0, 13145, 0, 5461, 0, 9068, 10579, 28775, 11600, 12742, 12651, 10703, 0, 12564, 12489,
+    0, 6393, 13017, 16461, 11889, 13162, 28722, 12381, 0, 9828, 12972, 16527, 11999, 13006, 17411, 17388,
+    13064, 17038, 0, 11889, 17200, 12862, 17241, 12576, 28798, 9208, 16523, 0, 17395, 28798, 9863, 11779,
+    28786, 10191, 32871, 32858, 13031, 13019, 11076, 13212, 12694, 5071, 16983, 32930, 12778, 10567, 17000, 28757,
+    17317, 0, 12744, 10145, 0, 28695, 0, 32791, 10781, 32924, 11292, 0, 11741, 0, 9367, 0,
+    28738, 10281, 12048, 11086, 28746, 0, 32937, 0, 11086, 0, 28822, 6399, 11442, 12876, 13080, 28718,
+    17014, 9375, 11035, 13210, 12971, 13091, 28758, 28749, 5455, 28750, 6059, 0, 16541, 32906, 28805, 12910,
+    32931, 17002, 12932, 17398, 9619, 0, 0, 28701, 0, 12617, 11151, 0, 13169, 12524, 0, 12959,
+    17121, 5461, 10861, 12864, 28759, 32897, 32841, 12942, 10739, 28786, 13138, 10483, 12559, 5591, 0, 0,
+    28745, 0, 17359, 0, 0, 5928, 28762, 28690, 5921, 20488, 12608, 9021, 13136, 10321, 17350, 0,
+    12837, 17200, 0, 0, 12906, 9244, 32867, 28740, 0, 13090, 16902, 13087, 0, 12644, 11910, 9853,
+    17219, 0, 9592, 28715, 0, 28713, 9684, 28708, 0, 0, 12468, 16901, 11080, 12934, 0, 16921,
+    6039, 10780, 10262, 0, 0, 0, 10079, 12755, 0, 28720, 11271, 28740, 17016, 9608, 32846, 28690,
+    11703, 11480, 28807, 6356, 8768, 10377, 13109, 0, 9809, 0, 12910, 12527, 16843, 13152, 16428, 9684,
+    0, 5656, 9068, 32922, 11403, 16586, 12944, 11735, 12621, 12731, 28706, 16458, 0, 32833, 12407, 0,
+    0, 0, 9388, 28766, 32919, 0, 17170, 12898, 0, 9984, 8362, 28681, 28826, 8713, 0, 6180,
+    12548, 12660, 12489, 9375, 28779, 17396, 5411, 12618, 8322, 8739, 28727, 8722, 0, 0, 0, 8789,
+    0, 12575, 9265, 0, 28774, 12898, 0, 10072, 9021, 6465, 10505, 28741, 0, 13136, 10714, 6304,
+    12851, 6144, 13223, 11712, 28762, 0, 17203, 10814, 16930, 9219, 0, 0, 6044, 8314, 17249, 13080,
+    17195, 0, 11442, 12040, 12455, 12960, 17022, 13090, 28792, 13172, 12560, 13127, 0, 8490, 28726, 5803,
+    0, 5366, 9517, 5655, 28746, 9948, 11573, 28707, 12431, 10281, 12478, 10803, 0, 5743, 11005, 32871,
+    28765, 11357, 5628, 28791, 8723, 12680, 0, 0, 16965, 0, 17018, 13052, 12346, 12803, 0, 28821,
+    13137, 8937, 11601, 13208, 16948, 32792, 11746, 9974, 12394, 13097, 28821, 28732, 28691, 28720, 8584, 0,
+    0, 11926, 12645, 11569, 32788, 13159, 11186, 13145, 28732, 0, 9218, 0, 11412, 0, 12729, 13172,
+    28733, 17011, 9816, 32818, 4964, 11570, 28687, 0, 10451, 28796, 10835, 11085, 9909, 28708, 4711, 28676,
+    28781, 5922, 17132, 12067, 11895, 11478, 8488, 10359, 13167, 0, 0, 13101, 0, 0, 0, 28674,
+    11182, 11984, 13210, 28748, 12791, 6456, 4629, 5613, 12617, 6356, 10981, 0, 12992, 0, 32905, 28702,
+    8489, 28784, 12684, 12752, 12876, 28771, 12908, 12574, 0, 13169, 13224, 12995, 13068, 12708, 13007, 16598,
+    12455, 32804, 4688, 11478, 28741, 28762, 0, 9547, 32867, 0, 28693, 0, 0, 11767, 10977, 10232,
+    0, 0, 10213, 0, 11433, 0, 0, 17013, 16430, 28766, 28764, 10430, 12620, 0, 0, 6051,
+    0, 17360, 16777, 32820, 0, 0, 28782, 0, 32794, 12622, 0, 17277, 12919, 5284, 8414, 9917,
+    10576, 28733, 0, 17149, 12478, 17280, 12668, 8658, 10547, 28762, 5101, 12932, 11170, 28681, 0, 10216,
+    12336, 11403, 12717, 28825, 0, 12028, 32904, 5654, 16911, 16439, 12983, 8965, 11758, 12348, 17328, 28787,
+    0, 12547, 12763, 6393, 20488, 17147, 12839, 12860, 12790, 6059, 0, 12888, 0, 12930, 10247, 9067,
+    0, 11136, 20484, 9816, 28748, 11460, 12526, 11240, 12908, 16529, 11402, 12562, 0, 12523, 32831, 5059,
+    8549, 12804, 0, 0, 12684, 16887, 0, 10750, 12993, 12408, 11758, 28739, 11978, 28696, 9034, 13114,
+    9958, 9854, 32794, 12466, 12993, 16733, 0, 32907, 12972, 16755, 32846, 6348, 6019, 12695, 13054, 13019,
+    13017, 32869, 0, 16964, 6188, 12443, 12346, 28685, 28758, 0, 28763, 11273, 11478, 12320, 6019, 0,
+    0, 0, 9321, 12575, 16458, 8490, 0, 0, 0, 13151, 28748, 12514, 28759, 0, 9935, 11702,
+    9334, 28730, 17080, 10489, 0, 12701, 28727, 32866, 12983, 10142, 12700, 28728, 32857, 11683, 0, 0,
+    32856, 28722, 9860, 12691, 4519, 16667, 28749, 9948, 9862, 17060, 11988, 10574, 0, 0, 16607, 16447,
+    11864, 9916, 12692, 11741, 17078, 10107, 28679, 12383, 12513, 9877, 5820, 11742, 10881, 13187, 9002, 9089,
+    0, 0, 32879, 0, 13032, 12552, 13003, 12528, 12715, 9028, 0, 11049, 28795, 0, 0, 12801,
+    0, 0, 28728, 13197, 28753, 12609, 28690, 6179, 16904, 12598, 9814, 11989, 13222, 12707, 11404, 17117,
+    12860, 12058, 0, 10184, 6391, 0, 12694, 10736, 6146, 16914, 10705, 16996, 16571, 13164, 28821, 10025,
+    12624, 12788, 11740, 17008, 12972, 20487, 12969, 12648, 32872, 0, 6148, 6410, 0, 28700, 28763, 16934,
+    0, 12983, 13008, 28749, 28815, 13114, 16420, 10184, 16874, 12797, 28759, 5395, 13064, 10783, 16991, 12791,
+    9763, 11057, 12557, 13168, 12835, 32858, 28809, 12787, 12539, 28683, 12406, 0, 12809, 13026, 16913, 32779,
+    4770, 10145, 9553, 13136, 28795, 9751, 12788, 28757, 13007, 11702, 0, 28797, 0, 28698, 0, 12356,
+    0, 0, 10881, 12488, 12594, 20484, 12823, 0, 12623, 0, 13116, 0, 10475, 0, 10852, 6465,
+    0, 9772, 28673, 12956, 28777, 12456, 9309, 28820, 0, 8846, 13169, 13151, 12715, 0, 28785, 9676,
+    0, 6047, 10214, 11412, 16845, 9853, 9851, 28746, 8250, 0, 12790, 11035, 16904, 28745, 12392, 12079,
+    6434, 28786, 12623, 0, 12636, 32778, 4583, 28786, 6234, 8314, 6438, 10085, 0, 16731, 10244, 9917,
+    9965, 16620, 0, 13087, 12792, 13007, 9078, 11872, 16845, 13115, 28677, 10202, 0, 0, 12515, 17226,
+    5585, 8424, 0, 12076, 0, 28778, 16451, 0, 9210, 12478, 8491, 12528, 11938, 0, 13018, 0,
+    5442, 13184, 12426, 12660, 11939, 17004, 9969, 0, 28709, 17307, 12381, 9900, 28708, 9358, 5113, 32842,
+    16964, 32780, 5120, 28678, 16846, 11890, 0, 28827, 32924, 0, 8721, 13152, 8300, 16801, 6235, 12001,
+    10796, 10554, 6150, 0, 0, 17394, 12552, 0, 9265, 9166, 0, 28692, 10838, 13208, 28754, 12630,
+    10048, 13063, 13088, 9919, 12900, 0, 12555, 12588, 12491, 0, 11656, 11937, 28806, 28773, 11159, 10343,
+    28810, 16516, 11983, 12910, 0, 8422, 12900, 0, 11134, 12730, 16620, 12996, 0, 12726, 0, 12828,
+    0, 16832, 10107, 28758, 16773, 13080, 8480, 10117, 32911, 12623, 17375, 13103, 28752, 10870, 28796, 12949,
+    12898, 0, 11440, 5674, 16585, 28805, 5672, 13194, 16609, 12946, 12476, 12066, 9965, 28702, 12519, 28706,
+    8956, 9676, 6234, 0, 10804, 10633, 28675, 0, 0, 12692, 0, 13168, 10804, 0, 12690, 16530,
+    9149, 12525, 0, 10563, 0, 28676, 10282, 0, 0, 0, 4933, 10173, 8469, 0, 17015, 32855,
+    0, 12910, 12824, 9211, 16620, 28708, 11158, 13075, 0, 0, 5614, 16515, 11095, 6320, 16499, 28748,
+    11137, 17398, 11758, 10913, 17007, 16914, 12489, 10796, 9889, 17139, 13100, 9984, 8665, 8490, 12898, 16937,
+    13076, 16509, 9685, 16530, 0, 0, 11702, 16758, 12001, 17278, 0, 12479, 12611, 12960, 9676, 12943,
+    0, 12888, 28767, 32898, 10272, 16754, 10839, 16609, 12621, 5023, 12863, 6327, 12612, 12899, 28773, 5261,
+    28676, 8883, 28793, 28797, 12696, 16428, 6431, 12792, 12419, 9087, 12792, 28712, 12474, 32831, 8479, 9792,
+    12827, 0, 10270, 9344, 13052, 0, 16756, 6355, 28681, 9387, 28805, 8255, 10193, 9955, 11459, 13074,
+    17158, 0, 12786, 0, 12623, 0, 12689, 6454, 32855, 10095, 12551, 28684, 5922, 28763, 13223, 12555,
+    28673, 9555, 0, 28794, 13008, 0, 28754, 12934, 6147, 0, 0, 12622, 28764, 8613, 0, 12886,
+    0, 13028, 12684, 17297, 0, 8789, 9808, 9675, 13104, 9560, 32866, 11095, 0, 28768, 4466, 10584,
+    28797, 28754, 12503, 0, 12980, 11049, 13006, 28763, 12847, 12432, 0, 16746, 11480, 17150, 9861, 32905,
+    12875, 28771, 0, 0, 28767, 28689, 28730, 32905, 8464, 28704, 0, 9320, 5490, 11901, 17282, 12333,
+    28678, 13124, 0, 17016, 0, 28805, 0, 28807, 16937, 6353, 9725, 16858, 12840, 10758, 32831, 10580,
+    9367, 8339, 0, 9975, 28818, 28797, 13052, 0, 13064, 5171, 28790, 0, 12454, 16857, 6465, 0,
+    0, 11768, 28801, 8777, 8366, 10880, 28785, 28754, 12077, 16925, 12785, 8389, 0, 13224, 9386, 12527,
+    16925, 12528, 4686, 12876, 20483, 11467, 0, 10451, 16571, 28820, 0, 11955, 11402, 0, 11348, 8991,
+    10878, 0, 16933, 0, 12896, 0, 11348, 16914, 16438, 16763, 13176, 16913, 13140, 5026, 12887, 6234,
+    28771, 13092, 6391, 12886, 0, 12620, 13090, 12980, 16923, 11477, 9343, 9985, 6320, 0, 10212, 8703,
+    12903, 8789, 0, 16537, 9862, 32892, 11402, 0, 9898, 12980, 16767, 0, 17081, 12442, 0, 13149,
+    32820, 12575, 0, 0, 6061, 10516, 12786, 10451, 0, 8702, 6465, 9618, 5314, 10861, 28796, 0,
+    32831, 12407, 8458, 0, 10497, 28674, 13185, 28746, 28822, 13128, 28725, 12744, 0, 28750, 12622, 0,
+    0, 28759, 16743, 9248, 28746, 12499, 28826, 0, 12672, 17083, 0, 32793, 20485, 28683, 16923, 17360,
+    16855, 0, 16779, 9287, 12900, 16935, 16912, 13014, 0, 5665, 0, 32930, 17248, 5628, 9422, 0,
+    32908, 0, 32846, 0, 13007, 12576, 0, 5249, 28759, 28739, 12430, 9900, 0, 16619, 11394, 12780,
+    0, 16411, 9964, 12610, 0, 28695, 0, 28723, 10274, 11224, 12683, 5113, 0, 16463, 17388, 5651,
+    9386, 20481, 11974, 0, 17131, 0, 0, 17015, 5498, 10532, 12655, 16878, 17399, 32777, 8560, 12066,
+    8986, 6386, 12504, 12690, 32831, 0, 12525, 11777, 12310, 9879, 10044, 28749, 28820, 12588, 0, 10861,
+    12513, 17170, 12480, 28748, 32807, 5910, 28823, 0, 9211, 10870, 13197, 32859, 12943, 0, 28757, 6456,
+    17219, 32919, 0, 12456, 17247, 6388, 17399, 12606, 28725, 0, 0, 13121, 10581, 16824, 16752, 12528,
+    16808, 12583, 11411, 28822, 10340, 10246, 16509, 5320, 28826, 13139, 12707, 12488, 0, 11956, 9311, 32846,
+    13020, 9350, 12455, 6455, 12420, 13100, 10272, 13063, 6455, 10543, 12511, 0, 8920, 28690, 0, 16579,
+    12498, 5628, 12612, 0, 12480, 13040, 12598, 12695, 12428, 16620, 10207, 10019, 0, 32794, 12513, 16539,
+    5318, 0, 11435, 9863, 28733, 9376, 32883, 12605, 0, 0, 8554, 12576, 12074, 13020, 28820, 32937,
+    0, 13063, 28767, 0, 9357, 12300, 32817, 12786, 28755, 0, 12076, 9807, 0, 0, 28691, 13020,
+    4193, 28714, 13113, 28798, 11230, 13007, 12309, 0, 12740, 0, 13040, 12754, 28786, 11758, 32776, 4240,
+    11648, 13224, 0, 28713, 9248, 12945, 0, 10814, 12666, 0, 32859, 6454, 8710, 13027, 12455, 12885,
+    9962, 28726, 10116, 0, 32917, 12624, 0, 0, 17363, 11655, 16575, 12534, 9814, 32904, 12803, 0,
+    12778, 13002, 32843, 9203, 12322, 12971, 0, 0, 6117, 17016, 20485, 6058, 11610, 32804, 9201, 28793,
+    0, 28735, 28762, 28756, 0, 0, 32892, 12572, 4960, 11443, 28808, 12791, 28715, 12039, 10758, 12931,
+    32918, 12643, 9879, 13224, 10348, 11900, 0, 0, 28823, 0, 12778, 12708, 16842, 0, 9076, 10861,
+    10100, 8316, 0, 9183, 32842, 0, 28686, 16935, 12718, 8366, 16500, 0, 0, 0, 12480, 16598,
+    28773, 0, 0, 10132, 28756, 11710, 32833, 17388, 11867, 28732, 12671, 9002, 17274, 16824, 12732, 0,
+    12994, 0, 4875, 12561, 8666, 28746, 0, 8650, 28818, 16657, 12742, 12420, 0, 16676, 9204, 5673,
+    9845, 12900, 8477, 13150, 0, 28747, 10101, 12623, 6466, 10658, 32870, 10123, 16934, 17210, 5713, 13210,
+    9655, 28686, 0, 0, 12418, 16755, 0, 0, 10869, 12888, 11394, 13196, 28718, 12595, 28797, 11103,
+    16880, 32931, 28787, 32832, 28762, 6211, 5170, 8711, 0, 13140, 12512, 0, 11701, 12066, 0, 28755,
+    13054, 32911, 8348, 28717, 8256, 12000, 13150, 0, 10553, 8284, 0, 0, 0, 16808, 12786, 28786,
+    10280, 0, 12660, 32843, 12996, 0, 12695, 16816, 28746, 16736, 0, 0, 10137, 12584, 0, 0,
+    9871, 11527, 9657, 0, 9859, 11226, 11955, 0, 12039, 12756, 0, 0, 17241, 9983, 28797, 9913,
+    12893, 0, 8918, 9972, 11956, 0, 12656, 0, 0, 16833, 28707, 12887, 28820, 12528, 16745, 0,
+    28731, 17407, 13090, 12778, 0, 13091, 0, 8488, 12631, 12641, 0, 10497, 28681, 28797, 5498, 9963,
+    0, 8790, 12008, 10327, 13144, 6058, 11380, 16778, 8307, 28700, 28731, 16924, 6058, 8350, 0, 0,
+    9685, 10516, 13196, 12683, 32778, 4703, 32775, 9997, 6326, 17247, 11112, 12034, 11956, 8778, 16579, 0,
+    11871, 0, 28747, 8720, 28791, 28805, 0, 12958, 9908, 13089, 13175, 16933, 0, 0, 12391, 11647,
+    8366, 4656, 13151, 32776, 9732, 12466, 0, 28809, 0, 28768, 12972, 10272, 12751, 16754, 12756, 8744,
+    17359, 16571, 28805, 8488, 13151, 0, 9377, 17411, 12612, 28683, 12547, 0, 5324, 28715, 12892, 16599,
+    28726, 32844, 12888, 32793, 13090, 0, 0, 0, 12612, 17386, 12752, 13184, 20484, 28700, 4924, 28696,
+    28753, 6410, 9248, 16737, 10047, 32842, 16449, 13162, 28732, 6293, 16421, 16857, 10932, 12737, 9547, 32846,
+    8948, 12480, 13051, 13161, 16430, 12786, 10426, 12503, 16936, 10845, 0, 12631, 11394, 8787, 0, 0,
+    16518, 11702, 12852, 28676, 0, 32833, 0, 12840, 8711, 0, 0, 11953, 28702, 13020, 10345, 10655,
+    0, 0, 8947, 17307, 12443, 11776, 11411, 13102, 6350, 8737, 16519, 9510, 28759, 0, 8658, 0,
+    11177, 8696, 8313, 28777, 12357, 12595, 17036, 17289, 28680, 9386, 5978, 12588, 13196, 12585, 9252, 13074,
+    17162, 8786, 10068, 12420, 10207, 0, 17377, 10862, 13147, 16778, 28690, 28749, 12851, 0, 16430, 16677,
+    16579, 12466, 9241, 16775, 5971, 0, 13128, 9897, 28696, 12971, 0, 16509, 0, 12516, 0, 10561,
+    32844, 12611, 32777, 10651, 12032, 12560, 5053, 13182, 0, 28712, 6447, 28733, 28732, 28798, 13161, 9654,
+    13158, 16527, 32794, 13157, 28746, 9607, 0, 32779, 5029, 0, 12612, 28690, 0, 28732, 0, 10941,
+    0, 0, 28818, 12773, 28720, 12055, 28814, 28694, 6225, 28729, 8919, 13149, 8972, 32898, 0, 0,
+    13148, 11458, 12571, 10954, 16936, 10872, 0, 32789, 16688, 12624, 16853, 12512, 16674, 11655, 13011, 0,
+    8752, 13148, 12432, 0, 0, 0, 0, 32895, 0, 0, 10996, 13126, 12727, 13176, 4862, 11992,
+    28764, 0, 0, 5332, 0, 32781, 6104, 0, 9778, 12595, 0, 17171, 9963, 28809, 16776, 32884,
+    10570, 16933, 8956, 12835, 0, 0, 12476, 9648, 17359, 9386, 0, 16606, 12879, 16952, 11450, 32840,
+    28734, 12847, 28749, 13031, 12336, 12343, 28681, 0, 0, 13063, 12933, 10860, 0, 10137, 0, 0,
+    12751, 12592, 0, 28733, 12511, 13184, 28782, 12780, 0, 12560, 12456, 11402, 12066, 12864, 12308, 10641,
+    4308, 11871, 0, 0, 12526, 0, 9077, 12454, 0, 0, 16833, 28726, 32816, 12456, 12009, 9293,
+    28691, 28739, 28690, 0, 9383, 8960, 16675, 28760, 10879, 0, 6455, 16578, 6225, 28689, 16440, 12466,
+    12933, 12466, 10183, 28777, 6225, 16935, 16459, 12744, 32833, 13092, 8881, 8689, 9687, 17241, 28684, 12888,
+    12572, 10389, 5427, 10580, 16518, 16440, 28773, 12075, 13051, 12667, 0, 8620, 0, 12569, 12480, 16843,
+    28795, 0, 9964, 13066, 28680, 13152, 9011, 28746, 28823, 9979, 8404, 12444, 8283, 12407, 28703, 12576,
+    16658, 9473, 16686, 16823, 0, 10553, 0, 12321, 4426, 9684, 0, 16841, 20481, 17282, 12945, 32819,
+    8995, 12333, 0, 16658, 8411, 16935, 0, 10218, 0, 13196, 13220, 20484, 0, 28809, 0, 0,
+    12706, 16642, 12887, 28704, 0, 9860, 0, 12672, 9318, 8307, 16449, 8307, 28725, 28687, 12357, 12393,
+    6464, 28692, 13151, 12871, 16933, 12355, 12756, 12432, 28731, 16587, 13207, 6364, 0, 12502, 32827, 0,
+    32779, 11189, 13092, 0, 12474, 17131, 28825, 32896, 9954, 0, 9675, 0, 6447, 16764, 0, 16417,
+    28777, 12612, 0, 0, 16450, 0, 16688, 0, 4303, 0, 28785, 0, 13063, 11404, 5557, 12321,
+    16934, 28733, 0, 10882, 10311, 28768, 8643, 12557, 12725, 32827, 12760, 0, 12504, 9472, 12380, 0,
+    28808, 16451, 0, 12079, 0, 12478, 0, 0, 0, 0, 12648, 28820, 12335, 0, 16677, 0,
+    12332, 0, 28788, 12670, 0, 11105, 12354, 13007, 20484, 13013, 28697, 28705, 16831, 9250, 10315, 12569,
+    5527, 0, 0, 9294, 28809, 16648, 13063, 12835, 12562, 12380, 12649, 32791, 0, 12639, 32790, 9539,
+    9263, 9606, 28701, 9475, 0, 16564, 9501, 13100, 0, 12381, 28781, 9179, 13159, 0, 32846, 17275,
+    28801, 12056, 12367, 8947, 0, 8947, 0, 8491, 8998, 0, 32804, 9207, 16700, 8790, 28704, 6364,
+    5265, 8405, 12960, 0, 16903, 0, 32884, 28708, 16598, 32790, 28723, 28696, 28789, 28732, 16418, 8654,
+    0, 4906, 32833, 0, 32885, 32856, 8616, 6433, 12635, 32791, 16439, 16936, 32895, 20485, 32933, 12825,
+    12335, 28739, 0, 17016, 8355, 0, 0, 12532, 0, 32817, 12551, 16687, 12593, 13104, 12367, 12631,
+    11304, 0, 0, 12717, 16529, 28809, 20485, 13012, 9973, 9175, 12321, 12882, 0, 12456, 0, 0,
+    11693, 32918, 13111, 32829, 17090, 0, 8924, 8961, 28711, 12732, 28776, 0, 0, 16519, 8404, 4629,
+    28681, 28737, 32791, 13017, 10881, 11775, 28748, 0, 32832, 28788, 0, 12307, 10573, 12593, 12368, 16460,
+    12298, 12718, 12312, 11757, 11993, 17289, 11838, 0, 0, 0, 8278, 11757, 5426, 12598, 0, 0,
+    12392, 28735, 12922, 12427, 0, 17169, 12932, 12322, 0, 12404, 10162, 0, 16992, 10869, 32869, 0,
+    16666, 6410, 8301, 0, 28751, 12064, 13127, 16814, 28730, 13128, 9204, 32816, 11077, 8643, 0, 13136,
+    32880, 16439, 32936, 12653, 9941, 17004, 10028, 12991, 32917, 32831, 16658, 0, 28735, 12562, 28714, 16744,
+    28706, 10234, 0, 10936, 5556, 17289, 20482, 12499, 9614, 28692, 8555, 32923, 12381, 32881, 16767, 28673,
+    28728, 32781, 5996, 16807, 16676, 5821, 13157, 10869, 11159, 28691, 28809, 12456, 8354, 0, 9947, 0,
+    28776, 28775, 0, 28734, 28739, 12322, 12067, 28801, 28725, 10224, 28703, 4883, 8361, 28709, 0, 8618,
+    28744, 9179, 28700, 13148, 0, 12725, 13183, 32775, 4195, 12934, 10759, 28706, 12455, 16992, 28774, 16448,
+    12968, 16792, 13138, 32856, 12548, 12593, 16597, 8544, 5553, 17053, 11757, 16537, 28821, 0, 12725, 8320,
+    8450, 0, 4403, 17376, 0, 12690, 0, 17140, 28685, 13001, 0, 32911, 5238, 9543, 12888, 17070,
+    16579, 0, 28698, 0, 28727, 16609, 17282, 16821, 0, 12932, 16666, 32791, 12814, 12345, 12383, 20481,
+    9585, 4408, 13102, 0, 0, 0, 32881, 0, 12335, 12371, 13020, 17160, 12888, 16541, 12456, 5034,
+    16685, 16595, 16685, 9585, 28729, 28683, 12309, 0, 12382, 9687, 11538, 28675, 28679, 16586, 0, 28818,
+    11866, 10461, 0, 16991, 12360, 12298, 0, 5234, 12356, 0, 32778, 9185, 11954, 0, 32793, 12033,
+    16528, 12516, 12801, 0, 6433, 12812, 9010, 0, 32932, 28685, 16439, 17001, 17410, 28787, 28707, 10582,
+    32869, 5008, 32806, 8700, 0, 12706, 16430, 13206, 9508, 10460, 12909, 11910, 12334, 0, 16854, 28741,
+    32781, 6280, 12735, 0, 12588, 10516, 0, 0, 0, 16598, 0, 4926, 0, 12707, 8468, 9687,
+    28800, 0, 8313, 16588, 13183, 16522, 12824, 16450, 13008, 0, 28821, 12909, 28740, 12312, 0, 0,
+    32833, 5377, 28822, 0, 12358, 32937, 0, 4884, 20486, 13042, 10759, 5382, 9969, 28754, 28726, 0,
+    12760, 12432, 0, 9686, 0, 4451, 12532, 32833, 32920, 0, 12467, 20488, 5867, 28818, 0, 0,
+    28734, 0, 4897, 0, 12406, 20485, 16598, 12894, 28788, 12408, 12897, 0, 0, 0, 9050, 13154,
+    32893, 12630, 16831, 0, 10528, 0, 32818, 32882, 0, 0, 6447, 9583, 12814, 0, 8759, 5280,
+    12000, 0, 13212, 11954, 16993, 8745, 9241, 28688, 12802, 0, 0, 9915, 0, 12335, 12055, 12323,
+    28694, 8612, 20488, 12967, 28687, 16524, 0, 28695, 8766, 32854, 11487, 5037, 5904, 28726, 8660, 6394,
+    11566, 12921, 13171, 8490, 28726, 0, 16746, 20489, 32816, 32792, 32844, 16528, 9354, 13008, 12621, 0,
+    32806, 8418, 0, 8418, 32793, 12945, 17299, 12359, 5373, 9204, 6447, 28807, 32780, 5502, 0, 17071,
+    9343, 28737, 0, 28759, 28746, 12634, 28818, 11749, 16666, 8955, 12582, 0, 11358, 8584, 32868, 28751,
+    0, 0, 32838, 12856, 8577, 32895, 4268, 0, 17071, 12933, 0, 28688, 5391, 12881, 12714, 28678,
+    0, 0, 32780, 5376, 32804, 10919, 5972, 28724, 12348, 32818, 12921, 32829, 28811, 13217, 0, 0,
+    0, 16577, 13152, 8988, 0, 8777, 12910, 0, 12394, 28747, 28822, 28716, 28677, 0, 0, 12000,
+    0, 16991, 12768, 0, 5299, 8664, 0, 8487, 4452, 17411, 32820, 12372, 12630, 11749, 10461, 10760,
+    28776, 0, 28775, 10114, 12359, 32857, 28751, 11232, 11469, 10061, 32932, 12921, 32817, 20486, 13198, 12309,
+    5201, 4689, 12921, 28800, 11823, 28750, 32872, 28799, 12322, 13043, 9815, 0, 4612, 0, 13171, 5237,
+    9058, 16913, 10751, 9374, 12396, 9799, 9777, 12924, 0, 17150, 12372, 12300, 28731, 16448, 16853, 6116,
+    0, 16746, 0, 0, 0, 12382, 12920, 12866, 12468, 11603, 16607, 10239, 12515, 12945, 9854, 16993,
+    0, 0, 12810, 32833, 13002, 12489, 16687, 32780, 5517, 0, 0, 12406, 32872, 28693, 16451, 10162,
+    32933, 9581, 12528, 12706, 28760, 28821, 12833, 0, 16854, 12611, 0, 0, 8767, 28819, 12564, 17149,
+    12772, 5388, 12429, 9061, 32932, 12991, 16527, 17002, 17327, 9067, 10515, 12432, 16779, 0, 0, 12468,
+    10918, 12846, 28786, 9303, 0, 0, 13139, 9516, 9019, 0, 32932, 13042, 12815, 13139, 5329, 10151,
+    32780, 8697, 8759, 32882, 11115, 10460, 12502, 28705, 32805, 5009, 11358, 4859, 16439, 12976, 10507, 28700,
+    11946, 28789, 16754, 32932, 8973, 0, 32801, 4213, 20489, 8636, 17219, 20484, 17012, 0, 12057, 0,
+    28799, 9265, 12945, 13030, 32935, 12347, 0, 17160, 17081, 32932, 12311, 8547, 17001, 10498, 12335, 10815,
+    28786, 12395, 11403, 8955, 11105, 10284, 28756, 28773, 9586, 11779, 8711, 10162, 28774, 17408, 17071, 28676,
+    0, 0, 16688, 8419, 0, 12815, 0, 16764, 12408, 12442, 17409, 8656, 32819, 10853, 12065, 28707,
+    10377, 28707, 0, 13148, 17219, 10402, 13092, 0, 28828, 8966, 12826, 12504, 9558, 10797, 17080, 6064,
+    17395, 12923, 0, 28761, 28707, 4209, 0, 32882, 8702, 12813, 5830, 13209, 13196, 17248, 12945, 16519,
+    20487, 28774, 12706, 32802, 9440, 12372, 12487, 28789, 13110, 28699, 10264, 6457, 0, 28750, 28712, 28760,
+    0, 10806, 13065, 0, 5760, 10816, 0, 28809, 0, 0, 10208, 28774, 0, 12911, 28775, 28760,
+    12587, 10452, 16617, 28764, 32829, 12742, 17132, 10217, 13183, 5113, 13140, 12407, 11105, 32932, 10217, 12911,
+    16458, 0, 6455, 32883, 32793, 12922, 28810, 0, 0, 9293, 16852, 28822, 9262, 12827, 0, 32934,
+    20489, 0, 11648, 17408, 0, 32882, 10521, 0, 10515, 32896, 0, 16914, 0, 28766, 9365, 0,
+    32883, 10517, 12923, 12859, 12678, 0, 13040, 0, 9191, 0, 10090, 10814, 28828, 0, 28778, 0,
+    28684, 9049, 0, 9802, 12048, 17229, 0, 16538, 12610, 32801, 8532, 12048, 13116, 0, 16617, 0,
+    10974, 17159, 11902, 13029, 17132, 16609, 16619, 9806, 0, 32852, 12300, 28821, 32846, 20481, 28795, 5850,
+    12718, 28772, 11356, 0, 12988, 12034, 0, 0, 16460, 17162, 9321, 28730, 5301, 10517, 12620, 0,
+    12921, 16652, 16418, 28675, 13029, 11113, 12535, 32855, 12948, 32932, 0, 32869, 0, 0, 6181, 12068,
+    0, 12923, 28777, 28809, 10158, 12922, 16999, 12826, 32858, 9672, 10161, 28762, 10507, 13064, 11749, 5268,
+    0, 32897, 0, 28785, 9024, 16605, 32853, 12967, 32794, 16540, 32807, 8764, 10751, 0, 13159, 16983,
+    13014, 9862, 17015, 13218, 28673, 28690, 0, 28739, 17082, 28751, 8695, 28737, 28699, 32807, 8465, 0,
+    16760, 9342, 17369, 0, 9293, 28678, 9564, 16514, 0, 12615, 10517, 32846, 17052, 16993, 28676, 32896,
+    10573, 0, 16850, 28782, 11358, 9048, 28762, 12934, 16538, 12965, 17405, 13183, 16685, 0, 12522, 0,
+    10517, 20489, 28677, 10871, 12814, 9300, 32794, 0, 0, 10804, 32807, 5766, 12360, 13031, 0, 16460,
+    12731, 0, 28695, 5420, 5490, 8776, 12720, 28756, 28779, 12693, 5532, 10563, 17220, 17013, 13065, 28813,
+    11412, 0, 12570, 28766, 5703, 0, 9680, 0, 12359, 12988, 11404, 28790, 10507, 16463, 12320, 12670,
+    6234, 17290, 0, 16460, 12548, 12958, 17014, 11775, 10516, 12311, 8456, 32859, 12976, 12475, 0, 10562,
+    10461, 0, 28773, 9032, 0, 32935, 13001, 28727, 9685, 5826, 8462, 12978, 17161, 0, 32858, 0,
+    11105, 16688, 17353, 12677, 4407, 12664, 10554, 11412, 10861, 16620, 12603, 17013, 0, 0, 12727, 32894,
+    0, 12405, 28700, 10049, 16618, 17015, 17239, 0, 32867, 17071, 0, 10806, 0, 28699, 17082, 9480,
+    10861, 11954, 32884, 16745, 10507, 0, 12300, 16852, 12524, 0, 32853, 9644, 13140, 17158, 28821, 8739,
+    28739, 11470, 20484, 16621, 17229, 10813, 28758, 17091, 0, 12708, 12816, 28719, 13140, 0, 0, 8319,
+    16852, 12345, 16530, 32775, 9993, 12464, 16618, 11946, 0, 28732, 0, 13099, 12897, 9726, 10870, 16616,
+    12324, 11096, 12816, 8423, 11412, 32781, 9623, 10196, 12643, 13030, 17083, 28700, 28819, 0, 9049, 9056,
+    8272, 17012, 12344, 8446, 12684, 5531, 0, 28800, 17160, 12588, 0, 10562, 17160, 13031, 12620, 0,
+    13160, 32859, 9565, 28705, 9900, 12600, 28743, 12773, 16460, 12618, 28798, 9150, 32806, 5535, 0, 28683,
+    0, 0, 12708, 0, 13164, 0, 0, 9547, 10273, 0, 28743, 28762, 10806, 28748, 12540, 0,
+    17354, 0, 11403, 10582, 28770, 32817, 17014, 17239, 12394, 0, 11511, 32932, 9256, 0, 17001, 0,
+    8349, 17093, 12749, 13041, 13053, 12720, 12824, 11403, 32896, 10273, 16824, 12717, 12815, 28774, 28705, 12636,
+    12934, 0, 12360, 11657, 28734, 5829, 16753, 8658, 17228, 0, 20488, 10273, 0, 0, 13183, 13144,
+    0, 12311, 16753, 12695, 32909, 16619, 17132, 12680, 16675, 8920, 13218, 13065, 12534, 10106, 17172, 0,
+    8304, 8460, 12408, 11105, 16619, 9971, 32907, 12622, 0, 28677, 0, 32794, 0, 12923, 10516, 10285,
+    20481, 17219, 11822, 12719, 32909, 12492, 16518, 12944, 10077, 32841, 12609, 0, 13043, 28750, 17376, 8965,
+    0, 16774, 8656, 17247, 28762, 0, 12804, 17318, 0, 28695, 0, 17319, 28709, 9082, 8774, 32895,
+    17160, 17150, 12348, 16696, 13076, 12608, 0, 32883, 28802, 12933, 28812, 32872, 5933, 12548, 28786, 17173,
+    32908, 0, 16751, 11403, 0, 11104, 12694, 16541, 0, 12816, 32893, 10699, 0, 0, 9377, 8484,
+    0, 16539, 12777, 11170, 28790, 28724, 0, 17082, 12048, 17386, 0, 6236, 0, 0, 0, 16515,
+    11291, 17353, 0, 0, 32780, 5132, 0, 0, 0, 0, 6235, 17141, 13164, 32843, 0, 28790,
+    0, 9072, 11348, 0, 12079, 4981, 16598, 32907, 10815, 13131, 0, 12408, 4789, 0, 28778, 0,
+    0, 12816, 6456, 4212, 32794, 5589, 11711, 12454, 20484, 13152, 32801, 12472, 8918, 17252, 0, 12947,
+    0, 28700, 11702, 11848, 17307, 28822, 32776, 4251, 10517, 32872, 28749, 28812, 12979, 11294, 11114, 28811,
+    28718, 32892, 0, 5962, 32906, 16775, 12575, 28731, 12415, 0, 13076, 17298, 10563, 10862, 32872, 12804,
+    17081, 8666, 10862, 12873, 0, 0, 12630, 28778, 12324, 12780, 17318, 16910, 11161, 9465, 17095, 0,
+    32934, 0, 28807, 32871, 12966, 12804, 9057, 11657, 12738, 12833, 12703, 17161, 0, 10024, 11411, 28760,
+    12804, 13123, 32843, 17083, 28731, 0, 28787, 10776, 9846, 13041, 13121, 9317, 10871, 11837, 17239, 17012,
+    12923, 0, 0, 9645, 0, 0, 12383, 28676, 12816, 12744, 11643, 32817, 11114, 10159, 17083, 28679,
+    5203, 28772, 12859, 28788, 13064, 10573, 6251, 8875, 12587, 28733, 12487, 10553, 10573, 10264, 0, 8694,
+    16448, 5074, 16540, 16586, 8475, 0, 17290, 32897, 4922, 0, 9862, 16935, 28825, 11468, 0, 12524,
+    17307, 28800, 11460, 17368, 10780, 28796, 32793, 28747, 9287, 12396, 13029, 0, 0, 32789, 32781, 6088,
+    12360, 9182, 12875, 17160, 9884, 11404, 28703, 16695, 9964, 0, 10911, 10554, 32778, 4654, 0, 0,
+    17241, 0, 11181, 9293, 12504, 28794, 0, 5953, 6235, 12620, 5427, 9264, 12897, 11712, 28824, 28692,
+    8402, 12624, 28801, 16429, 8664, 11655, 6411, 5719, 8965, 16727, 0, 32838, 16754, 0, 5266, 10849,
+    11170, 12897, 32806, 9305, 0, 11703, 28762, 0, 28724, 17307, 16874, 32936, 12408, 10881, 17004, 0,
+    20488, 9057, 11115, 16729, 10517, 28687, 12760, 13222, 9552, 16607, 8868, 28828, 17092, 17091, 12499, 32831,
+    32906, 8485, 12931, 32806, 9279, 12582, 16430, 9751, 0, 5873, 12406, 32859, 28682, 11297, 32872, 8942,
+    9815, 10813, 12923, 17361, 17219, 28684, 9648, 16687, 11079, 8384, 9658, 17361, 12336, 32907, 4853, 10584,
+    17307, 0, 11348, 16500, 0, 28751, 12355, 8911, 11480, 12924, 0, 32829, 12656, 8766, 0, 28805,
+    10447, 12897, 28729, 12912, 28771, 12323, 16506, 10584, 9510, 28726, 12346, 10621, 0, 0, 8486, 11143,
+    32856, 16430, 0, 0, 28695, 16540, 16541, 9503, 0, 0, 11769, 9182, 10625, 11712, 0, 28803,
+    28742, 11712, 0, 11148, 12514, 13163, 8424, 32855, 16744, 8422, 13219, 13123, 12395, 12537, 12911, 10360,
+    12715, 0, 16825, 0, 6365, 10870, 12573, 17016, 8621, 28692, 9210, 17218, 10264, 17308, 0, 6402,
+    10197, 9845, 9260, 0, 0, 0, 12943, 8619, 10100, 0, 0, 0, 17093, 10011, 10246, 0,
+    10584, 9075, 8358, 17238, 12624, 0, 17308, 16609, 16509, 32817, 16886, 10814, 0, 9900, 0, 9241,
+    16413, 10284, 32842, 16451, 5539, 16824, 28803, 9372, 0, 11712, 9743, 28691, 11334, 17093, 28812, 0,
+    13065, 28808, 13218, 16621, 0, 4655, 16892, 10145, 16462, 17229, 12465, 17298, 10347, 12911, 0, 10371,
+    17318, 0, 16515, 12588, 0, 28701, 28761, 28687, 0, 16778, 9915, 0, 0, 0, 10572, 16900,
+    17298, 9481, 16621, 9780, 0, 6410, 16449, 12550, 32872, 13077, 13076, 28699, 28795, 12594, 16462, 28745,
+    17388, 32898, 10260, 11274, 17092, 28714, 8350, 13134, 12679, 6456, 9771, 0, 9809, 10642, 16834, 0,
+    28773, 9059, 0, 12500, 28809, 11712, 0, 16953, 17162, 4452, 6448, 0, 0, 11103, 9788, 9964,
+    12695, 12644, 12455, 10205, 28675, 11170, 10714, 8942, 12755, 12720, 11702, 10160, 16924, 12381, 28728, 11113,
+    28809, 12358, 0, 32820, 0, 8734, 20482, 16913, 28770, 20486, 10400, 0, 16767, 11468, 5249, 12585,
+    9908, 17172, 0, 5484, 28806, 13152, 12429, 0, 16835, 0, 13209, 12584, 8358, 12656, 0, 12335,
+    20489, 0, 11468, 0, 28696, 0, 20487, 11339, 11694, 9510, 12923, 13032, 0, 32791, 32817, 17241,
+    17298, 9281, 32807, 11832, 32857, 10285, 0, 9356, 6267, 28692, 11460, 8365, 8722, 9217, 6465, 12764,
+    17299, 17298, 13199, 13032, 0, 4694, 9218, 16841, 28750, 11590, 32885, 0, 12632, 28825, 11955, 16991,
+    32870, 10941, 16858, 13077, 32867, 0, 11112, 12622, 12369, 8621, 9260, 0, 0, 4700, 10563, 28703,
+    28743, 11012, 12888, 9481, 12791, 32872, 4391, 28779, 32794, 5196, 17132, 10459, 0, 0, 28706, 0,
+    12312, 0, 10751, 0, 12633, 6465, 12852, 12912, 28814, 16421, 32794, 28696, 28806, 8991, 28786, 12368,
+    0, 10871, 8422, 10346, 11479, 32818, 12957, 17092, 12297, 28719, 13029, 10218, 0, 12654, 0, 5614,
+    28741, 0, 11468, 12644, 32891, 32791, 28679, 11112, 9481, 20484, 28768, 28803, 12634, 0, 9012, 12012,
+    32846, 13077, 11469, 11468, 28808, 12840, 17016, 28748, 0, 12846, 12465, 20482, 28731, 10162, 12594, 12644,
+    8786, 12660, 0, 28704, 0, 28673, 17368, 17306, 0, 9981, 13052, 28677, 0, 11348, 12756, 0,
+    10953, 8489, 0, 12899, 12439, 0, 28746, 6465, 12644, 8619, 16764, 8920, 0, 12010, 13040, 0,
+    16832, 0, 12888, 12479, 16439, 8359, 12865, 32844, 0, 10816, 28790, 13066, 8382, 6465, 17250, 32920,
+    8367, 11169, 16485, 12432, 32826, 28703, 9598, 4706, 17097, 5412, 0, 6270, 8359, 9142, 0, 8956,
+    0, 32892, 0, 10941, 16999, 0, 12563, 0, 11955, 28811, 28804, 11759, 28717, 0, 0, 13052,
+    6456, 6226, 12852, 9481, 13162, 11479, 12948, 12740, 32803, 16653, 9358, 28696, 17320, 0, 28805, 8322,
+    11032, 8460, 0, 16617, 0, 6456, 0, 0, 28807, 9088, 0, 16609, 12310, 0, 17318, 0,
+    0, 28793, 6038, 12740, 16774, 5907, 8689, 16666, 8350, 28806, 28675, 0, 28703, 28740, 5315, 16841,
+    10101, 13042, 0, 12644, 5498, 16527, 0, 11355, 11910, 28684, 13017, 28681, 5049, 28812, 13015, 32833,
+    6447, 10470, 12309, 13146, 13219, 12624, 0, 0, 12574, 32806, 5443, 13007, 12828, 9298, 12931, 11459,
+    28814, 20485, 5490, 13162, 8757, 28815, 12840, 28771, 16608, 17095, 13044, 16922, 0, 0, 17408, 8470,
+    5877, 16540, 28762, 4956, 6439, 13162, 11568, 13196, 10881, 16676, 0, 28812, 11802, 12885, 28762, 12834,
+    12840, 28734, 0, 0, 12466, 0, 28718, 13209, 0, 16756, 12864, 11647, 12984, 0, 28758, 32880,
+    16772, 17330, 16440, 5423, 0, 13097, 12886, 16834, 10583, 12347, 8964, 12852, 28706, 28728, 13160, 11246,
+    11178, 28816, 12588, 12763, 17249, 16983, 16755, 12443, 0, 10460, 13184, 17237, 16540, 8739, 6168, 0,
+    12707, 28741, 28679, 13001, 4868, 0, 12658, 12847, 32923, 12620, 12500, 28744, 12532, 0, 12800, 13044,
+    0, 0, 0, 28696, 17172, 32840, 0, 28716, 0, 16755, 5732, 20485, 17094, 0, 4750, 0,
+    12057, 17395, 28696, 6325, 17158, 12456, 12660, 28735, 9075, 4493, 10272, 13163, 6233, 20490, 28797, 12407,
+    11758, 28765, 13151, 5344, 9593, 5021, 10583, 12528, 32793, 0, 16524, 6170, 11180, 0, 16699, 0,
+    16767, 20481, 16658, 13211, 0, 20485, 0, 12632, 10476, 0, 0, 0, 0, 16686, 28726, 6018,
+    32911, 0, 12874, 12824, 12717, 28722, 13111, 17052, 5021, 28748, 0, 0, 0, 12716, 28733, 13146,
+    9318, 28759, 11712, 5481, 8704, 4704, 0, 8760, 13000, 16699, 17016, 0, 6464, 16667, 13196, 9204,
+    10880, 0, 12983, 13208, 12575, 12360, 9750, 9963, 0, 11777, 12754, 28723, 12909, 12808, 8703, 0,
+    12546, 0, 8367, 28771, 0, 12600, 32920, 0, 0, 28812, 0, 17218, 11573, 28808, 12906, 12525,
+    28780, 20490, 9955, 13174, 16541, 0, 0, 8319, 12503, 12897, 13174, 5437, 5444, 8322, 32857, 6019,
+    0, 0, 13019, 0, 28720, 0, 12346, 0, 32922, 0, 12976, 8688, 12621, 0, 5926, 0,
+    12002, 11218, 10377, 5450, 10183, 28735, 10616, 8695, 12779, 17174, 0, 10951, 5213, 11807, 12849, 12645,
+    28812, 9719, 9503, 6457, 5584, 17151, 10426, 13212, 28788, 0, 12800, 16902, 16765, 28778, 10675, 32802,
+    4269, 16843, 0, 11479, 11216, 8405, 5556, 12563, 0, 16666, 28717, 13075, 12396, 12705, 10377, 12467,
+    13196, 32781, 5958, 12875, 13031, 16734, 0, 12823, 17320, 13019, 4948, 28771, 13103, 12888, 12561, 9974,
+    10344, 8452, 8619, 12972, 12010, 17253, 10145, 0, 0, 10455, 12693, 16687, 0, 28706, 8719, 0,
+    12703, 13019, 10583, 12348, 16991, 12527, 9654, 28724, 5041, 11955, 32806, 5405, 32920, 32833, 6457, 12812,
+    12372, 12466, 0, 4915, 0, 0, 0, 16687, 12823, 12779, 12572, 28684, 12706, 32842, 8720, 10879,
+    10584, 16537, 12467, 12776, 9195, 32934, 0, 0, 5313, 10071, 10914, 12432, 5798, 0, 28760, 11768,
+    6225, 5426, 4727, 16527, 28680, 12647, 12078, 17289, 28779, 12694, 12816, 11170, 28786, 0, 10548, 11759,
+    10159, 12001, 10974, 0, 32884, 9320, 16816, 32807, 9353, 13014, 11759, 5313, 32780, 8675, 16598, 12057,
+    28818, 28768, 28720, 13044, 13097, 17299, 8649, 6211, 4955, 10476, 12993, 0, 0, 13080, 12920, 11768,
+    12300, 12524, 12954, 32881, 16529, 12465, 11478, 8488, 9552, 12002, 16729, 16755, 12634, 0, 0, 12681,
+    16542, 0, 12990, 13184, 32806, 5350, 11112, 17016, 5556, 0, 0, 9975, 11302, 0, 12464, 0,
+    28810, 12407, 12002, 28682, 0, 32885, 0, 8710, 0, 0, 12713, 17253, 16667, 0, 13176, 0,
+    13113, 12667, 16912, 12586, 8421, 16621, 28748, 0, 13176, 10583, 8583, 12456, 13208, 0, 4702, 28770,
+    0, 28765, 6274, 16515, 32867, 13121, 0, 11768, 12728, 32805, 5020, 16823, 0, 5555, 12730, 10137,
+    0, 0, 12791, 9956, 32919, 10247, 28684, 11469, 12850, 12706, 12396, 11759, 12906, 0, 16463, 32781,
+    8735, 0, 12444, 0, 11059, 12751, 0, 0, 9981, 0, 10882, 0, 16833, 28724, 28801, 0,
+    13137, 9270, 10183, 28789, 17330, 6410, 12691, 8358, 16767, 28726, 16894, 32921, 11993, 0, 0, 28760,
+    11050, 6151, 9863, 10282, 0, 0, 9349, 12057, 12444, 28726, 4404, 28679, 12076, 32845, 4673, 16843,
+    11654, 16460, 0, 12659, 0, 28691, 28748, 11647, 12049, 12897, 28809, 9294, 17388, 6179, 0, 10426,
+    13183, 12372, 10116, 0, 12467, 32923, 28761, 13051, 0, 8657, 13030, 0, 0, 12871, 9863, 10472,
+    6401, 0, 12629, 9780, 5798, 16934, 16736, 0, 5557, 16528, 0, 0, 28732, 12478, 28721, 10152,
+    12881, 0, 17161, 28783, 8424, 28676, 0, 0, 12332, 16729, 28693, 10750, 9357, 12802, 6411, 16894,
+    12336, 10879, 0, 10197, 12549, 0, 13211, 9563, 13197, 12669, 13014, 0, 16834, 11481, 10078, 12486,
+    28691, 5041, 0, 16997, 11767, 28707, 28692, 32802, 10297, 11710, 6350, 9364, 13139, 12076, 12297, 0,
+    17060, 0, 0, 32843, 0, 8307, 20488, 0, 17037, 8583, 12467, 12608, 28734, 0, 32872, 13156,
+    11537, 11778, 32789, 32918, 11272, 12624, 16657, 8667, 0, 16439, 12744, 28746, 12695, 12732, 28728, 12491,
+    32818, 12464, 10506, 0, 12540, 0, 16863, 0, 12002, 28712, 12920, 13063, 13103, 0, 4658, 0,
+    13197, 13140, 0, 17062, 12011, 32911, 10904, 17369, 0, 32778, 4548, 12001, 11478, 32868, 0, 13185,
+    8488, 4613, 12513, 0, 28799, 17218, 5666, 12049, 12057, 0, 20484, 13138, 28810, 5312, 16756, 28748,
+    28785, 5487, 10325, 10805, 0, 11178, 12501, 28695, 9076, 17062, 12636, 12468, 32804, 4672, 32818, 9817,
+    10439, 13104, 0, 10050, 11769, 12777, 0, 6092, 28749, 9033, 28693, 10264, 16843, 16579, 8412, 28748,
+    12011, 13210, 12595, 12441, 0, 12418, 17329, 0, 12576, 0, 8758, 13102, 8421, 12311, 0, 10071,
+    16595, 28721, 0, 5499, 28760, 12815, 28726, 9365, 0, 12991, 0, 9003, 9750, 13007, 13080, 8947,
+    12791, 0, 16460, 0, 12959, 12825, 32930, 12324, 12707, 0, 16700, 0, 16816, 17190, 8469, 0,
+    0, 9675, 28691, 0, 10355, 12719, 4606, 16688, 16922, 16439, 32853, 12859, 10472, 28712, 0, 9388,
+    28785, 12690, 5000, 0, 8284, 13196, 8703, 12346, 13210, 20489, 11516, 10183, 10813, 12477, 32922, 11767,
+    12002, 0, 13020, 12468, 12774, 12611, 9211, 11599, 0, 17151, 17331, 0, 0, 10571, 11133, 8469,
+    12858, 28799, 10127, 12406, 0, 12618, 12454, 32871, 16843, 0, 28746, 11955, 17329, 0, 12563, 28760,
+    12561, 8284, 12635, 12358, 10515, 0, 0, 0, 6218, 5986, 13115, 0, 12984, 0, 5426, 9843,
+    16778, 17160, 8314, 13006, 9058, 6232, 13008, 0, 12395, 10815, 9615, 0, 13199, 0, 12048, 12860,
+    10239, 12701, 16460, 10214, 28786, 16746, 10385, 5270, 0, 28797, 0, 0, 12696, 28737, 32906, 12572,
+    5893, 8643, 12921, 28753, 0, 0, 8478, 5589, 9376, 12815, 28679, 12727, 16571, 16854, 12692, 12905,
+    9917, 28780, 16607, 28691, 0, 28715, 10788, 0, 16902, 10106, 16778, 0, 5252, 0, 32805, 12867,
+    20487, 28765, 12468, 32918, 0, 8477, 11909, 16777, 16676, 11611, 0, 0, 12896, 28740, 20487, 5813,
+    16461, 16765, 28759, 8721, 12726, 16421, 12609, 8949, 32884, 12010, 16620, 12561, 0, 17397, 28776, 12909,
+    0, 12885, 0, 0, 16776, 12550, 11114, 10562, 10503, 0, 0, 12599, 9674, 0, 12573, 9919,
+    28824, 0, 5813, 4944, 28796, 6115, 0, 13040, 9899, 16746, 28736, 12520, 28742, 0, 12899, 0,
+    28705, 32859, 16428, 0, 12905, 0, 17004, 12840, 32896, 12011, 12503, 0, 0, 12355, 8459, 28711,
+    5404, 32779, 10418, 28777, 9540, 12576, 13111, 16542, 13160, 8956, 8993, 12797, 12552, 11535, 11168, 12834,
+    28722, 12896, 12779, 5966, 10207, 28752, 16542, 5039, 4377, 0, 11087, 28686, 0, 13132, 16779, 13108,
+    6048, 32831, 12572, 13200, 16911, 0, 9298, 0, 12788, 32894, 12667, 12839, 13053, 0, 11332, 28741,
+    10440, 10760, 12694, 16777, 8656, 12067, 17069, 0, 16841, 9074, 17386, 10099, 0, 12778, 9384, 16598,
+    17376, 11638, 28756, 13200, 16893, 28746, 0, 28720, 12683, 28793, 4630, 0, 0, 12993, 10049, 0,
+    13186, 17377, 13175, 12977, 5674, 20489, 0, 13220, 9256, 28804, 10430, 28787, 12441, 0, 12561, 13148,
+    8469, 20486, 12886, 9915, 10486, 28763, 0, 12406, 17396, 11458, 0, 28739, 8963, 12742, 0, 13188,
+    28755, 28758, 13099, 32871, 12078, 32805, 4965, 17082, 28786, 32780, 5188, 17306, 8947, 12595, 28726, 16530,
+    13020, 0, 32866, 32807, 12336, 9861, 0, 0, 12001, 4444, 10070, 32828, 11766, 28743, 16719, 6093,
+    5386, 0, 6059, 10636, 12922, 28678, 10274, 0, 13158, 4468, 0, 12920, 6177, 0, 12763, 0,
+    12331, 0, 6320, 0, 10528, 9012, 13092, 17247, 9148, 28793, 11057, 13018, 0, 12560, 8759, 0,
+    20484, 12077, 12371, 9975, 6292, 12324, 12881, 10133, 0, 0, 12595, 12380, 0, 20485, 16497, 32792,
+    13196, 12847, 0, 0, 9219, 28673, 12489, 12476, 5893, 11657, 17387, 13139, 28760, 0, 12310, 8994,
+    8961, 0, 0, 12066, 10247, 13116, 32870, 10555, 17012, 28679, 28739, 32807, 6271, 13152, 0, 32898,
+    10879, 8956, 12527, 0, 8786, 6293, 5986, 16922, 13158, 32791, 28691, 13127, 12058, 9218, 17002, 12887,
+    17150, 12787, 0, 0, 16685, 32778, 4496, 32909, 12933, 12572, 12708, 0, 6299, 8304, 0, 12467,
+    0, 0, 13028, 28703, 8767, 10862, 28681, 28791, 12527, 13150, 5330, 0, 28788, 12335, 4630, 4662,
+    0, 12360, 16528, 28717, 0, 0, 0, 12696, 28680, 11240, 28802, 10506, 0, 13031, 11701, 17377,
+    9605, 12885, 10385, 12491, 0, 12467, 32871, 28799, 32872, 11297, 13043, 28795, 16619, 12407, 17092, 13158,
+    17386, 20481, 32908, 12383, 5812, 11932, 5900, 17386, 8703, 28726, 0, 16924, 10571, 12984, 16530, 12310,
+    12431, 28799, 8777, 32924, 28798, 9293, 9654, 12924, 13053, 16776, 0, 28693, 11195, 0, 32918, 10253,
+    0, 16894, 12503, 9906, 11178, 32880, 6292, 12420, 9908, 13150, 12407, 0, 0, 17328, 32896, 28703,
+    0, 16595, 13092, 32793, 0, 17170, 10184, 0, 16542, 12320, 0, 0, 9956, 0, 20489, 17081,
+    16933, 16435, 8487, 12346, 12922, 17012, 12959, 0, 0, 4787, 0, 10253, 0, 12839, 0, 28818,
+    32844, 8738, 12384, 11654, 12454, 0, 28813, 10516, 5964, 10958, 16439, 6289, 12732, 10239, 10138, 16700,
+    9559, 0, 0, 28745, 17331, 5099, 6216, 28818, 9956, 28778, 11113, 28676, 17387, 28679, 12503, 13164,
+    10782, 12516, 11161, 0, 0, 8956, 0, 28765, 0, 12978, 16854, 16527, 32794, 9860, 12787, 0,
+    16857, 12562, 32861, 4433, 12513, 16429, 32853, 12909, 16925, 16910, 12572, 12443, 13152, 12079, 12612, 12546,
+    17397, 12027, 0, 8999, 28711, 8421, 28817, 17332, 0, 12824, 0, 0, 0, 28754, 28704, 0,
+    17003, 9817, 28729, 10264, 16737, 28703, 12852, 0, 0, 28691, 12393, 11900, 16450, 17082, 28782, 32778,
+    4559, 8665, 32859, 13017, 0, 28786, 12778, 5892, 12936, 8420, 32842, 13041, 9965, 0, 4449, 28741,
+    12876, 8468, 16685, 32838, 12732, 28754, 6293, 6233, 13025, 28710, 16699, 12480, 12792, 8686, 28741, 8708,
+    13208, 28694, 8490, 0, 32869, 5058, 12419, 16541, 12986, 28704, 12321, 28747, 12879, 12947, 12753, 0,
+    28781, 28784, 12308, 8313, 11081, 13016, 8420, 0, 20487, 0, 0, 0, 0, 12947, 12564, 12835,
+    10581, 10862, 12526, 0, 12596, 0, 20487, 11766, 12439, 28731, 9861, 17407, 28804, 12360, 32827, 0,
+    10213, 12691, 28745, 11477, 16901, 12693, 28811, 0, 20489, 0, 10188, 32882, 13220, 32893, 28811, 17037,
+    28825, 12857, 0, 8359, 16923, 6058, 20489, 28723, 13224, 17061, 28824, 13041, 16737, 9917, 0, 16911,
+    0, 17161, 12646, 28810, 10327, 28773, 17378, 17377, 0, 12514, 17378, 0, 13207, 0, 12380, 0,
+    16756, 8470, 17387, 28705, 28779, 0, 12570, 0, 28683, 12310, 17132, 12075, 16833, 12654, 8695, 28744,
+    9181, 0, 12912, 11458, 0, 0, 9854, 32831, 0, 9503, 16451, 12813, 28714, 28705, 12312, 0,
+    10218, 4437, 0, 9597, 13066, 12677, 13112, 11631, 10782, 0, 5103, 9210, 32820, 17396, 32790, 10465,
+    0, 9540, 0, 0, 12669, 11812, 6457, 12665, 0, 12612, 12792, 13151, 9374, 9589, 9620, 11034,
+    16754, 12619, 32793, 12816, 0, 12787, 11312, 12382, 8905, 16509, 0, 16762, 9384, 0, 28730, 28789,
+    9010, 17317, 28822, 0, 10969, 0, 28747, 9508, 0, 9906, 13171, 13006, 0, 9049, 28812, 28688,
+    0, 8656, 13136, 5552, 5498, 13108, 12742, 11268, 0, 32805, 8636, 11430, 0, 0, 28759, 13137,
+    10505, 0, 12702, 12439, 0, 16700, 8485, 0, 28769, 20481, 9642, 17399, 12773, 9898, 28789, 32833,
+    6326, 12336, 20483, 12767, 32807, 9340, 0, 6411, 0, 10283, 10879, 12860, 9349, 0, 17378, 12692,
+    0, 5393, 13101, 28707, 12406, 0, 9686, 16449, 0, 17396, 12860, 13172, 0, 32792, 9074, 0,
+    13195, 12683, 28756, 11674, 12585, 32872, 32843, 9247, 28784, 12813, 16539, 12761, 0, 12875, 0, 11169,
+    32865, 0, 0, 12677, 13139, 12909, 9916, 12504, 28695, 32806, 11533, 11333, 10283, 10797, 12900, 13148,
+    0, 32844, 28814, 0, 12790, 0, 8789, 0, 0, 10028, 0, 16451, 5103, 28737, 17378, 32871,
+    0, 12312, 0, 17316, 0, 9915, 9210, 13087, 12359, 13053, 13137, 0, 0, 12408, 5362, 5772,
+    10572, 8357, 6344, 12693, 13103, 6325, 16807, 10489, 17407, 6173, 13152, 5192, 11059, 10269, 8720, 0,
+    12718, 12368, 17171, 28824, 12467, 0, 10489, 0, 28732, 12592, 0, 0, 8365, 9369, 0, 13025,
+    12756, 32863, 10013, 0, 0, 32885, 8278, 12372, 13138, 12754, 9973, 10451, 10264, 16853, 28753, 17092,
+    16530, 6324, 11539, 0, 9673, 8283, 0, 17386, 0, 9321, 13005, 16914, 13016, 12883, 17411, 0,
+    28797, 12639, 32857, 12656, 28679, 0, 12980, 0, 0, 0, 6465, 12750, 8874, 9985, 0, 12525,
+    0, 5889, 5483, 11834, 32904, 9767, 32846, 10583, 8694, 9384, 16821, 0, 8555, 0, 12815, 12370,
+    13044, 28763, 12297, 13043, 8778, 16880, 10197, 17092, 11300, 20484, 5460, 0, 0, 12849, 9020, 28825,
+    10518, 9472, 28746, 0, 4462, 9057, 0, 0, 12407, 8914, 28725, 11358, 32904, 8476, 32872, 8621,
+    10582, 16775, 16931, 9179, 12814, 0, 0, 17398, 16507, 12333, 32881, 12348, 0, 8767, 12743, 12298,
+    12456, 0, 9293, 0, 16913, 5073, 0, 0, 11210, 28827, 10191, 0, 6209, 28728, 10541, 9948,
+    11693, 28692, 5869, 11769, 17090, 11332, 28766, 13110, 10461, 0, 0, 9373, 5384, 28688, 17131, 12944,
+    13160, 28721, 12967, 20481, 28679, 12735, 10750, 16767, 28753, 28733, 0, 28730, 12504, 28758, 0, 12345,
+    17149, 0, 6410, 12696, 32818, 10740, 12804, 5016, 12932, 13222, 17247, 12887, 16687, 0, 28808, 0,
+    9676, 9981, 10862, 0, 16846, 28728, 16823, 9909, 28674, 12444, 16596, 11161, 12789, 0, 16540, 10786,
+    0, 9986, 0, 12792, 5909, 12824, 28755, 8411, 12695, 28800, 9049, 12527, 12322, 8785, 0, 17326,
+    0, 0, 0, 9963, 32828, 4896, 5650, 17376, 0, 28747, 12548, 0, 13077, 9310, 11177, 10806,
+    13110, 13056, 12336, 13020, 13162, 17378, 20481, 0, 9683, 0, 11896, 0, 12785, 12432, 28755, 5308,
+    0, 12444, 8390, 0, 5113, 4409, 32883, 28788, 11159, 13220, 12967, 16529, 9012, 11972, 28737, 16619,
+    12466, 13150, 0, 13110, 12380, 12998, 12358, 32780, 5510, 0, 0, 0, 28799, 16541, 16923, 6111,
+    32779, 8659, 17386, 16908, 0, 12897, 0, 12455, 8788, 11039, 28750, 0, 12538, 28776, 0, 17080,
+    8961, 0, 12790, 11209, 32872, 11050, 9919, 28679, 0, 9613, 0, 8710, 12777, 13100, 0, 9058,
+    12430, 16507, 28822, 28789, 8354, 0, 16596, 32841, 12743, 32893, 12977, 32883, 12791, 10269, 9985, 12562,
+    10516, 13067, 12395, 5529, 0, 0, 17160, 32780, 5398, 0, 32830, 17036, 0, 28777, 10815, 28777,
+    0, 0, 11379, 17299, 0, 28791, 11533, 9517, 9216, 6225, 9973, 12336, 17409, 12480, 32907, 0,
+    0, 0, 28817, 28714, 12863, 10364, 0, 6117, 5365, 13206, 12826, 8767, 32857, 17248, 28759, 9675,
+    12298, 10279, 28748, 32858, 10880, 28728, 32936, 0, 16853, 5585, 0, 0, 28718, 28695, 12348, 0,
+    12452, 0, 11758, 0, 20488, 0, 17072, 12645, 0, 12622, 12528, 32854, 8785, 0, 9983, 12612,
+    11872, 12813, 11114, 5069, 28682, 13175, 13175, 12312, 5070, 12896, 5307, 28682, 0, 28698, 32852, 16935,
+    28747, 9615, 11312, 28746, 12527, 28727, 10583, 12468, 13076, 10061, 12358, 17151, 0, 16823, 8424, 12826,
+    0, 13123, 9773, 0, 5098, 11469, 9302, 17408, 0, 4711, 8759, 12535, 0, 11312, 12360, 10996,
+    11567, 20481, 12804, 32895, 28676, 0, 9777, 28821, 0, 11595, 0, 17072, 8919, 5650, 28746, 12910,
+    9017, 8964, 12456, 28812, 28692, 0, 8710, 0, 0, 12703, 5070, 8752, 32883, 32859, 9661, 28676,
+    16777, 0, 28797, 28735, 11937, 28690, 0, 10796, 11179, 12323, 0, 12428, 28763, 0, 28748, 28741,
+    0, 0, 12577, 12980, 10751, 12740, 28807, 28818, 11182, 32833, 28696, 28782, 0, 0, 28744, 10531,
+    12791, 0, 28689, 16449, 12464, 12970, 28808, 16931, 12801, 13025, 17407, 12609, 28730, 32818, 5184, 28673,
+    11358, 0, 12668, 0, 12467, 9909, 0, 28697, 20487, 28797, 16618, 16936, 28724, 0, 13008, 11151,
+    8965, 0, 12936, 0, 12074, 0, 13016, 0, 28749, 28730, 32884, 28729, 12933, 12911, 32898, 5982,
+    16964, 13041, 10582, 9582, 10797, 4963, 13187, 8486, 9962, 0, 12715, 0, 28781, 9762, 0, 0,
+    10582, 5458, 16937, 16936, 12431, 28748, 0, 8310, 4940, 13163, 16904, 28764, 13029, 11235, 17396, 8776,
+    12946, 9852, 32933, 6001, 32933, 13098, 11268, 32871, 12488, 11096, 9667, 12480, 8964, 28760, 0, 28802,
+    28818, 4977, 9892, 8698, 8486, 12323, 28744, 12633, 13088, 28743, 28798, 28784, 28699, 32880, 0, 32843,
+    0, 28706, 13056, 17162, 0, 12946, 0, 13162, 0, 28689, 0, 11105, 0, 10735, 28758, 12667,
+    16932, 13195, 32846, 16765, 16519, 11657, 12826, 8423, 17229, 0, 20482, 0, 0, 0, 12657, 9073,
+    0, 0, 0, 12971, 6456, 16778, 16673, 12671, 12438, 6015, 13159, 5374, 28794, 8666, 12827, 12717,
+    10841, 11598, 9068, 28691, 13029, 12367, 12957, 10781, 28777, 0, 16462, 10145, 0, 0, 12811, 32933,
+    0, 16674, 12549, 9022, 16948, 0, 13163, 9449, 0, 17406, 16766, 32884, 28679, 13171, 8776, 16914,
+    11394, 0, 9905, 4829, 9002, 12863, 0, 28777, 16463, 12578, 12299, 13032, 6456, 5362, 28758, 16904,
+    28781, 0, 16578, 16460, 10437, 12887, 10637, 5209, 0, 0, 28797, 17115, 0, 6402, 16963, 28767,
+    8751, 9918, 12525, 10732, 0, 28700, 28750, 16500, 17123, 10781, 28729, 12860, 9686, 16752, 16775, 12514,
+    10742, 11034, 28779, 13067, 13171, 9653, 4629, 12474, 0, 28707, 32896, 16664, 0, 32819, 0, 12465,
+    8711, 12480, 28783, 11775, 17282, 16571, 0, 32894, 0, 8712, 10734, 4553, 12610, 0, 0, 5869,
+    0, 28701, 8620, 0, 11140, 6145, 9562, 32807, 5716, 17229, 12554, 0, 10517, 0, 16429, 28715,
+    32896, 11648, 10457, 28745, 13168, 13182, 13056, 28761, 0, 0, 9358, 13099, 0, 0, 10419, 12827,
+    16620, 28688, 28749, 28747, 20487, 32920, 0, 16814, 17062, 16846, 0, 0, 10111, 11413, 9914, 0,
+    0, 12049, 0, 0, 13195, 0, 8667, 12551, 9076, 32845, 10936, 16540, 13050, 16993, 0, 11012,
+    28740, 12395, 32907, 0, 0, 28740, 0, 11030, 0, 9294, 0, 9388, 12486, 11080, 11161, 12570,
+    32897, 20484, 12488, 17220, 9982, 28811, 0, 32893, 10816, 0, 12887, 12983, 12552, 28800, 10759, 10759,
+    12813, 16438, 16460, 6321, 8312, 0, 0, 28774, 8637, 17082, 6048, 12802, 28786, 0, 0, 32789,
+    0, 12522, 11311, 9173, 12598, 10413, 28746, 10400, 16674, 28757, 16620, 10171, 0, 13116, 0, 8459,
+    12677, 12706, 17376, 12466, 28732, 12885, 12442, 0, 12923, 12719, 8345, 32807, 6287, 10143, 12923, 17082,
+    0, 0, 16778, 32897, 12592, 12873, 0, 32921, 9887, 0, 12360, 12742, 17141, 11413, 8412, 28747,
+    0, 8577, 16923, 8911, 12718, 10572, 12744, 13077, 0, 16530, 12610, 0, 28709, 28724, 8784, 12345,
+    12903, 0, 8982, 0, 32820, 17211, 11776, 9387, 28766, 16935, 10371, 28811, 32937, 8918, 0, 32883,
+    12900, 12921, 28752, 11931, 12936, 10104, 0, 16919, 12664, 16516, 16900, 32831, 17162, 8987, 0, 9619,
+    13015, 28715, 17149, 0, 12405, 28745, 17004, 0, 28810, 8905, 12932, 10736, 28736, 12847, 11634, 28780,
+    4851, 13044, 11892, 0, 9892, 11494, 6175, 9809, 4598, 32842, 11152, 6171, 9086, 32846, 32906, 32930,
+    16934, 10450, 0, 20485, 12982, 12802, 0, 0, 28823, 12888, 0, 16597, 11404, 12815, 11768, 13041,
+    13017, 12886, 13176, 17161, 12345, 17129, 0, 28769, 28729, 17228, 8721, 0, 28704, 8459, 8957, 9872,
+    12454, 0, 0, 6017, 9771, 28822, 28728, 0, 13030, 0, 5543, 32865, 10498, 32842, 0, 9011,
+    6321, 17008, 28806, 8583, 17015, 12455, 13163, 10195, 10378, 13122, 0, 0, 0, 12066, 28709, 17002,
+    8533, 9671, 11312, 12442, 6447, 0, 28753, 12888, 8995, 28737, 28823, 13042, 12760, 13163, 10553, 28688,
+    10458, 0, 32820, 10842, 12516, 0, 8414, 17238, 13206, 10207, 8666, 28779, 10378, 0, 16935, 12528,
+    28689, 17080, 28821, 10280, 28721, 8322, 9641, 9164, 28679, 17326, 13151, 28729, 5111, 12527, 28746, 13152,
+    12500, 9983, 13007, 16438, 12802, 9853, 28675, 10760, 0, 12911, 9049, 0, 0, 17048, 13032, 12370,
+    9983, 16779, 28798, 13053, 4977, 32869, 0, 9217, 16460, 0, 11778, 11008, 6188, 12440, 0, 8769,
+    5674, 16458, 0, 12587, 28685, 9687, 20481, 32844, 13184, 10371, 28729, 13152, 9010, 12647, 28724, 0,
+    11703, 0, 28726, 12345, 32885, 13042, 0, 32793, 12920, 16898, 17037, 17348, 12731, 12696, 0, 28781,
+    16564, 12430, 4976, 13171, 8987, 0, 6244, 0, 12312, 28686, 12912, 13098, 12815, 11830, 32781, 5932,
+    11303, 16929, 28716, 12844, 12982, 8546, 28738, 11141, 10322, 0, 13174, 28706, 4497, 0, 9063, 13116,
+    12599, 12804, 8577, 0, 9985, 0, 0, 9678, 9265, 32777, 9455, 10145, 32843, 10217, 9953, 0,
+    0, 11712, 13133, 12953, 13182, 28769, 28806, 11778, 12576, 0, 12885, 13157, 10583, 10539, 12792, 5628,
+    28681, 6263, 0, 16608, 32870, 11778, 0, 0, 10880, 12665, 0, 8918, 28785, 17210, 0, 9975,
+    12563, 28776, 28825, 16447, 12683, 0, 0, 0, 13148, 0, 12395, 32908, 17250, 9879, 5922, 32780,
+    5199, 0, 32857, 12357, 12729, 32840, 11378, 9686, 12828, 28805, 10490, 13207, 8965, 12785, 8463, 10498,
+    0, 0, 0, 28728, 17411, 10498, 0, 6321, 28705, 12694, 10583, 9051, 0, 32794, 11041, 0,
+    13067, 13032, 13188, 0, 17093, 0, 28796, 28750, 13173, 5340, 12323, 0, 9547, 0, 9264, 0,
+    12780, 6014, 28716, 6349, 0, 0, 28761, 32779, 4747, 32793, 0, 28708, 0, 28730, 12418, 9681,
+    0, 28712, 20488, 16421, 0, 20484, 0, 16981, 0, 17172, 28728, 9592, 10206, 8396, 28804, 10794,
+    0, 16463, 6043, 12011, 11394, 28728, 0, 16696, 12917, 12075, 10572, 0, 8658, 0, 0, 9019,
+    12828, 0, 9598, 12972, 5628, 12813, 28826, 4932, 28740, 6235, 12576, 12393, 0, 10274, 0, 28756,
+    32872, 0, 11677, 9089, 11246, 0, 32832, 9241, 12681, 0, 0, 20487, 9444, 12981, 28787, 9230,
+    0, 13175, 12056, 8390, 28684, 16959, 17308, 20482, 28769, 8368, 0, 0, 32885, 12588, 12887, 12406,
+    0, 12886, 10853, 16992, 8470, 0, 13200, 16577, 12704, 0, 32937, 12684, 32832, 28767, 0, 11096,
+    13008, 28788, 11450, 8664, 0, 11005, 12396, 0, 28718, 11219, 0, 0, 11703, 28783, 0, 0,
+    32885, 0, 0, 28809, 17249, 17070, 12680, 12888, 0, 12664, 0, 12804, 8840, 12917, 28729, 10668,
+    32789, 12526, 17405, 16699, 17299, 12779, 4720, 0, 28798, 28729, 8905, 11610, 0, 0, 13053, 10495,
+    4527, 12068, 12924, 16897, 28773, 0, 12324, 0, 4327, 20482, 32818, 12681, 28699, 10816, 13005, 32833,
+    32830, 12917, 9984, 4700, 0, 16608, 5883, 32830, 0, 0, 11170, 20484, 0, 11826, 12804, 0,
+    12623, 12646, 28823, 28721, 11112, 0, 9881, 0, 4719, 0, 17195, 11656, 10980, 8337, 16857, 11340,
+    13113, 12936, 0, 4916, 16606, 13005, 6235, 28759, 9610, 13022, 28822, 12792, 12800, 12681, 11694, 28822,
+    12681, 28767, 28767, 32804, 16504, 12888, 0, 12777, 28809, 0, 12467, 10837, 13006, 13056, 0, 10947,
+    0, 12707, 8767, 11340, 12828, 28797, 11469, 32880, 6085, 11395, 5662, 12366, 32868, 12760, 12684, 12681,
+    17149, 11733, 16427, 10967, 16694, 8440, 12955, 28742, 12680, 0, 13209, 6015, 28759, 0, 12695, 8842,
+    12862, 9620, 4974, 0, 12552, 0, 4816, 13076, 0, 17253, 12828, 9078, 16889, 16673, 16687, 16695,
+    8445, 17162, 28809, 12587, 28823, 4852, 8995, 12845, 0, 12946, 11479, 12296, 11838, 5059, 6447, 0,
+    12886, 9016, 0, 12924, 12359, 4700, 10283, 32807, 8484, 0, 0, 10042, 17010, 12587, 9555, 5584,
+    16597, 32871, 8359, 0, 0, 28727, 5490, 28748, 32856, 0, 0, 12419, 10781, 11412, 28767, 28785,
+    0, 0, 4955, 0, 12840, 16903, 28702, 12682, 12716, 0, 12705, 11611, 8423, 12516, 10844, 11136,
+    0, 13068, 16858, 8889, 20485, 28738, 4975, 13014, 32898, 12708, 5490, 5048, 5455, 6411, 0, 10199,
+    17317, 16778, 28772, 28774, 32871, 0, 11390, 12900, 28773, 9257, 12612, 10852, 0, 16594, 16440, 17080,
+    16766, 12058, 12395, 8883, 10581, 13115, 28746, 0, 28718, 28721, 16696, 9985, 0, 0, 32898, 10087,
+    10559, 16485, 0, 0, 0, 28745, 12619, 32879, 12765, 0, 0, 9619, 10519, 0, 28750, 5499,
+    28779, 11694, 16519, 28734, 28746, 17091, 12718, 9610, 16530, 11256, 9086, 6466, 9803, 28714, 0, 28809,
+    13103, 10461, 12480, 28762, 6041, 28812, 12912, 0, 16653, 12296, 17014, 17014, 11412, 32832, 28742, 0,
+    11080, 12607, 5620, 6447, 11656, 0, 0, 10584, 28798, 28801, 12452, 12778, 12672, 0, 12766, 0,
+    10379, 11460, 32917, 0, 0, 0, 9008, 12752, 9687, 11602, 13114, 11144, 11496, 17012, 10572, 4741,
+    0, 10066, 28698, 0, 0, 12371, 5726, 0, 12584, 16463, 28748, 9547, 10271, 11607, 6144, 11564,
+    6188, 8892, 12620, 11104, 5666, 4459, 16695, 11460, 28708, 12851, 17004, 9686, 16525, 12586, 9779, 28711,
+    0, 12468, 12443, 9675, 0, 0, 32907, 16808, 12704, 17308, 0, 10245, 9301, 0, 5582, 28762,
+    28745, 28820, 10370, 10936, 32897, 6144, 28719, 12430, 11160, 11160, 12814, 16518, 10816, 0, 0, 12417,
+    5351, 10448, 12720, 9619, 0, 28773, 8883, 8784, 12612, 28695, 4378, 0, 8779, 12607, 10266, 17273,
+    12623, 16508, 0, 11451, 16904, 28713, 17015, 0, 8488, 8410, 28792, 8650, 12982, 8322, 9254, 5048,
+    9962, 17150, 13187, 28772, 16447, 17004, 32807, 8743, 10881, 8982, 32931, 28793, 32820, 28762, 12728, 9377,
+    10657, 28711, 0, 0, 4700, 0, 16845, 0, 0, 10838, 32807, 6111, 16529, 0, 0, 0,
+    0, 0, 8613, 9518, 10758, 16586, 28731, 28737, 12521, 11891, 8480, 13020, 28799, 4749, 12441, 0,
+    10392, 8405, 10667, 11955, 8487, 32833, 16801, 12587, 8413, 17093, 32815, 10573, 12800, 0, 10796, 28732,
+    16746, 13037, 12980, 8790, 11049, 12463, 10552, 28773, 6306, 16901, 8373, 16588, 0, 28705, 12777, 5036,
+    12739, 12720, 13151, 0, 11694, 0, 10153, 0, 28687, 28721, 16904, 9848, 0, 11357, 0, 0,
+    0, 12466, 32906, 12456, 11685, 12684, 0, 17410, 0, 5452, 6365, 9909, 12323, 12580, 28746, 13133,
+    6189, 11565, 8477, 28739, 5993, 20481, 0, 12765, 0, 4973, 0, 32856, 0, 10208, 13090, 12785,
+    17081, 13085, 0, 11639, 10955, 11478, 9068, 16421, 6013, 28702, 32830, 12960, 8413, 0, 12836, 0,
+    0, 12430, 12954, 20489, 0, 12551, 11113, 0, 17148, 12453, 6056, 11059, 16928, 12960, 8650, 11479,
+    28674, 0, 11180, 10285, 0, 10862, 10966, 11611, 11311, 13075, 9832, 13162, 11311, 0, 0, 17275,
+    0, 0, 5922, 4949, 32857, 11451, 12002, 9357, 12465, 32919, 11909, 13044, 13158, 5672, 0, 0,
+    11113, 0, 0, 13140, 12406, 16910, 28737, 0, 9088, 10969, 13037, 10377, 32806, 16444, 0, 12355,
+    17307, 12623, 28821, 6466, 5563, 4955, 12597, 5433, 12862, 0, 0, 13139, 9863, 12779, 13220, 9963,
+    12599, 12813, 9016, 12417, 0, 11412, 28704, 0, 10844, 16860, 13056, 13140, 0, 10198, 6180, 8665,
+    12702, 6074, 28760, 16411, 12533, 0, 13102, 12826, 12503, 12576, 11179, 9320, 11758, 13133, 32846, 11356,
+    28729, 32846, 28731, 16462, 8284, 8405, 17190, 12049, 5581, 28694, 0, 12334, 11639, 12882, 13007, 13171,
+    28691, 32841, 17290, 17319, 17329, 13221, 16696, 17079, 12600, 0, 10559, 16619, 11246, 6364, 28763, 10796,
+    28770, 13127, 10406, 13221, 28697, 10254, 11759, 12684, 12732, 12982, 8343, 12884, 0, 13150, 10582, 0,
+    8882, 13116, 0, 0, 5461, 11611, 16978, 9321, 9265, 16745, 12719, 0, 12943, 6217, 8945, 12766,
+    12953, 16449, 16855, 28805, 6431, 12676, 11179, 16425, 12564, 10254, 9067, 0, 32920, 0, 28760, 11909,
+    28678, 32830, 32937, 13173, 12705, 9515, 9610, 0, 10703, 17378, 0, 16445, 11143, 17275, 13068, 12656,
+    8966, 17238, 32864, 28790, 12798, 0, 16855, 12780, 0, 8453, 0, 20485, 0, 8957, 0, 0,
+    0, 32894, 0, 8461, 20481, 17252, 5690, 20481, 28800, 28727, 28694, 16778, 12705, 5608, 12848, 12874,
+    6059, 12381, 0, 13019, 10675, 28714, 5900, 0, 6387, 11656, 10151, 0, 0, 0, 10806, 17284,
+    28748, 0, 12408, 9002, 12741, 12912, 10568, 5256, 0, 28740, 5920, 12406, 0, 10216, 0, 16925,
+    8933, 16542, 12455, 0, 10205, 11677, 11348, 9854, 0, 11328, 32931, 0, 5113, 9917, 16991, 11103,
+    11733, 28757, 12900, 11374, 13185, 9343, 12533, 0, 0, 8957, 12611, 16596, 12744, 0, 10879, 12798,
+    6440, 9908, 11554, 12551, 16696, 12597, 28685, 13176, 28787, 32853, 0, 13161, 12840, 17410, 11545, 12299,
+    12706, 17013, 12693, 32841, 13174, 28753, 16540, 11460, 11702, 9450, 11844, 32909, 12788, 13004, 6401, 13135,
+    11992, 5969, 28779, 13197, 28722, 11143, 20485, 6096, 16517, 17308, 10263, 11395, 12618, 12067, 17387, 0,
+    13173, 28719, 13208, 8284, 32803, 4393, 9311, 0, 9019, 12586, 0, 9863, 17387, 11034, 16992, 0,
+    11545, 10805, 0, 12967, 10452, 17250, 0, 28750, 12674, 8580, 0, 28795, 12922, 28758, 0, 13101,
+    13175, 12964, 17274, 32828, 12971, 0, 12372, 0, 32820, 16665, 11152, 10882, 28761, 28768, 0, 10568,
+    9474, 11096, 12979, 9388, 0, 17190, 11413, 28776, 13197, 12704, 12993, 32934, 28708, 9011, 0, 10861,
+    0, 12994, 11178, 8422, 4451, 28730, 9088, 28792, 28722, 16605, 0, 8439, 28723, 28795, 0, 13187,
+    10106, 5859, 13138, 12931, 11956, 32791, 28786, 10532, 0, 32907, 28798, 0, 28764, 16925, 8367, 0,
+    12642, 12623, 28688, 0, 0, 12876, 13067, 0, 20488, 8688, 12620, 0, 9084, 12609, 32838, 0,
+    12694, 6217, 11160, 12888, 12343, 0, 0, 6448, 6398, 12057, 28709, 28742, 12320, 16527, 32880, 0,
+    16508, 0, 12946, 9912, 0, 17159, 0, 28788, 17397, 12404, 0, 17062, 12769, 28674, 9078, 0,
+    5917, 17069, 0, 0, 28808, 12994, 28718, 12875, 4673, 13114, 0, 16694, 16887, 17141, 28719, 17174,
+    16992, 28751, 0, 5795, 32807, 6084, 4826, 10538, 12077, 5628, 0, 6004, 5608, 12800, 32855, 10796,
+    9058, 5113, 0, 16542, 12419, 32908, 10760, 9066, 32791, 5568, 16674, 17220, 28744, 6320, 16618, 28758,
+    8461, 9078, 0, 28749, 0, 12466, 0, 5563, 0, 0, 28737, 13076, 32906, 11411, 12533, 0,
+    11404, 12620, 12756, 9146, 12738, 0, 0, 12984, 12672, 13199, 11270, 0, 28697, 0, 0, 8681,
+    12607, 12699, 0, 0, 5920, 0, 9687, 0, 8723, 5993, 9685, 32841, 0, 28738, 0, 0,
+    9853, 0, 16844, 12488, 6441, 0, 32893, 0, 9665, 12358, 12324, 0, 0, 32905, 5585, 28828,
+    32780, 8969, 12848, 11701, 8488, 11057, 28776, 12312, 17329, 9261, 8882, 8790, 9388, 16686, 12993, 10516,
+    12608, 28757, 32918, 9367, 5459, 11702, 8790, 12920, 28756, 9685, 12768, 13137, 0, 0, 11750, 11750,
+    8768, 16983, 8396, 0, 12720, 0, 8785, 6131, 12309, 28731, 17150, 17071, 12935, 0, 17368, 11777,
+    20489, 28699, 12933, 12698, 0, 0, 12792, 28695, 17161, 28703, 0, 28753, 28747, 28798, 32818, 17173,
+    12624, 12048, 16922, 0, 12982, 12298, 8612, 28778, 12932, 0, 0, 10862, 12768, 0, 28746, 16767,
+    12909, 5366, 0, 16677, 28681, 12455, 28771, 32880, 13079, 0, 0, 9514, 13173, 16894, 0, 12611,
+    28698, 16914, 28760, 6123, 0, 32893, 28731, 0, 11655, 9649, 13159, 12816, 11865, 17237, 0, 11673,
+    0, 17237, 12968, 9604, 11402, 12514, 13002, 6432, 17016, 11872, 12922, 8423, 12408, 0, 9862, 20487,
+    12444, 0, 28776, 0, 13209, 0, 13209, 0, 11167, 12717, 10706, 11058, 6317, 8712, 10852, 0,
+    5588, 28714, 9854, 11865, 13004, 9941, 0, 28693, 12816, 8760, 17211, 28727, 16992, 0, 0, 10550,
+    0, 0, 0, 4272, 4765, 13063, 11114, 12794, 16894, 17081, 11946, 28752, 28730, 16595, 12451, 12621,
+    16767, 9011, 28726, 12874, 0, 9610, 28798, 13147, 12480, 5828, 0, 13065, 12811, 12933, 32885, 17171,
+    12716, 32864, 8649, 0, 0, 0, 9377, 6189, 0, 10460, 12858, 12560, 0, 13126, 16825, 13007,
+    11297, 10162, 0, 28748, 16618, 16526, 28676, 13091, 12570, 11831, 0, 12564, 0, 28750, 11780, 0,
+    0, 12766, 8577, 13011, 11701, 12647, 0, 28683, 0, 28710, 12910, 32898, 12360, 12822, 32855, 32864,
+    16854, 12067, 32869, 0, 12503, 32879, 0, 0, 11947, 13174, 28806, 5216, 9299, 12600, 32937, 12971,
+    6402, 12031, 11151, 12417, 0, 10563, 16912, 28753, 20489, 12665, 10880, 28729, 0, 5979, 0, 9059,
+    12358, 10675, 11750, 0, 12671, 28724, 12538, 32831, 12077, 10750, 12838, 32931, 17269, 12525, 28752, 4727,
+    17249, 12780, 32845, 28750, 12788, 16697, 5251, 9685, 0, 16934, 0, 10713, 12618, 12968, 16775, 28763,
+    13087, 12945, 12863, 10443, 12766, 32905, 8784, 17227, 8491, 0, 12609, 28729, 12719, 13176, 12931, 0,
+    12823, 16607, 9076, 13092, 13079, 12345, 0, 16825, 6205, 0, 0, 17229, 32866, 8621, 9986, 9952,
+    11013, 28752, 11057, 28763, 13077, 0, 5099, 11169, 0, 12384, 16914, 32781, 5817, 12077, 5137, 13184,
+    12502, 12720, 17052, 32794, 20488, 13147, 28824, 11776, 8321, 6188, 10813, 12588, 12899, 28750, 12692, 32881,
+    5149, 11411, 0, 11993, 17378, 0, 0, 9862, 0, 0, 17169, 6408, 4707, 12442, 11179, 9821,
+    12444, 11632, 6448, 32898, 0, 11656, 10869, 28784, 28754, 32794, 5665, 28689, 28783, 13207, 11567, 17308,
+    0, 17090, 8786, 5900, 17069, 12432, 0, 9089, 28800, 28821, 12620, 10487, 12660, 13164, 28731, 32932,
+    9564, 9684, 9657, 0, 12370, 12931, 6225, 13136, 12755, 6058, 11711, 11297, 12550, 5987, 0, 11793,
+    28818, 32819, 12943, 32905, 16700, 13104, 0, 13008, 28693, 9386, 0, 11081, 9619, 6233, 12996, 12694,
+    0, 0, 20489, 12923, 11430, 32854, 17053, 8777, 28720, 12851, 9059, 9672, 0, 12395, 9561, 8767,
+    12646, 17330, 32780, 8679, 28702, 0, 12792, 13101, 13125, 0, 11572, 13066, 32869, 12935, 11112, 13209,
+    28751, 10515, 11632, 12825, 12634, 0, 17241, 12850, 0, 9674, 13132, 13114, 12647, 0, 28720, 0,
+    0, 0, 9444, 10104, 12540, 28808, 9367, 32779, 4958, 8719, 11168, 10189, 9046, 12996, 13212, 12490,
+    0, 0, 17095, 0, 0, 17160, 12848, 32829, 13005, 12753, 28744, 17318, 12825, 10815, 28752, 0,
+    10060, 28752, 17070, 9674, 12959, 28797, 0, 17002, 12611, 12943, 0, 12989, 0, 16755, 12379, 8964,
+    0, 0, 12659, 0, 28730, 28801, 12823, 0, 12922, 11103, 11402, 32832, 0, 9776, 20486, 28781,
+    12580, 0, 13084, 13211, 0, 5666, 17196, 17320, 12432, 32906, 11013, 6344, 8478, 9603, 11404, 9089,
+    13115, 13020, 0, 12621, 10461, 11978, 4528, 10837, 10253, 10782, 8554, 28752, 13221, 12646, 32790, 32897,
+    28799, 11272, 12729, 0, 0, 12923, 0, 0, 17148, 28696, 11136, 12956, 9861, 11713, 13075, 0,
+    28762, 16923, 28685, 12898, 11701, 9956, 12851, 6015, 0, 0, 11081, 0, 17012, 28713, 32930, 12682,
+    0, 6427, 4556, 28800, 11105, 0, 12702, 8789, 0, 16617, 0, 12465, 0, 28753, 9900, 16779,
+    32894, 11114, 0, 12756, 12300, 0, 12598, 28763, 10760, 0, 0, 12799, 28773, 13140, 10713, 12491,
+    11103, 16616, 0, 9853, 0, 11115, 0, 12912, 12588, 28802, 32892, 17217, 0, 32804, 4542, 0,
+    0, 13051, 28732, 17328, 12894, 5673, 8751, 32859, 10405, 28752, 12068, 12057, 12431, 11476, 28769, 0,
+    11403, 32922, 0, 6020, 28729, 13053, 9085, 28728, 13078, 10497, 28676, 11136, 32885, 32911, 6464, 28753,
+    0, 13006, 10554, 12596, 5210, 16515, 17316, 12852, 0, 16924, 17316, 10713, 13041, 28797, 9985, 28815,
+    12691, 12011, 11767, 16901, 0, 17297, 10517, 17079, 0, 32844, 12694, 28824, 10461, 13221, 0, 12588,
+    5665, 12575, 32906, 0, 6466, 12930, 0, 0, 16656, 12921, 12798, 12811, 0, 16437, 0, 17248,
+    9809, 12970, 16896, 28732, 12360, 12802, 9265, 32936, 0, 12920, 4728, 0, 16876, 28745, 17211, 0,
+    32905, 8347, 0, 11311, 11893, 0, 11394, 5629, 11348, 32880, 28702, 4658, 0, 0, 10411, 13019,
+    20490, 0, 10812, 13127, 10161, 28794, 0, 0, 12814, 9450, 13150, 12467, 13122, 32792, 12696, 12559,
+    0, 16585, 11103, 12789, 10442, 0, 16608, 12799, 11430, 12957, 28757, 10272, 28747, 32858, 16608, 12920,
+    12828, 9977, 0, 28824, 10218, 8277, 17090, 11467, 0, 8920, 0, 12717, 12822, 6233, 32854, 17131,
+    8491, 0, 12384, 6455, 12787, 12372, 32922, 28693, 12612, 8580, 28693, 11103, 0, 12719, 11910, 9899,
+    10208, 12923, 0, 11804, 5771, 12682, 9918, 12477, 12678, 11403, 32892, 28765, 0, 16595, 8413, 6058,
+    0, 28763, 12478, 9647, 28789, 0, 28767, 0, 16825, 11460, 11711, 4621, 32883, 16845, 28747, 0,
+    10498, 12910, 17239, 12468, 12417, 5629, 28714, 12863, 0, 28763, 0, 17308, 11478, 12824, 0, 9012,
+    16530, 8906, 17053, 28752, 0, 32791, 32779, 4909, 13054, 28679, 12586, 28807, 16904, 17396, 12660, 10572,
+    0, 12658, 12539, 12456, 0, 0, 6381, 0, 28724, 32871, 0, 28752, 13127, 8936, 11387, 6464,
+    11161, 4955, 10415, 5113, 0, 0, 28761, 0, 12948, 20487, 0, 13196, 5665, 9358, 0, 28788,
+    6148, 11757, 11778, 10079, 0, 16952, 0, 9363, 0, 12044, 6466, 16933, 11311, 13079, 0, 0,
+    12358, 0, 12431, 0, 12058, 28810, 28764, 0, 8489, 0, 28805, 12789, 0, 10443, 16937, 9918,
+    0, 12548, 17004, 11610, 17015, 12930, 28758, 0, 13112, 17092, 9963, 0, 12972, 13220, 28690, 28699,
+    10881, 28673, 13138, 12905, 32868, 9666, 32779, 4872, 10208, 12671, 0, 9983, 12322, 13027, 11095, 12311,
+    16923, 28726, 9975, 8437, 32897, 10217, 11013, 0, 17041, 32918, 0, 28689, 16932, 16779, 13051, 11394,
+    12896, 13152, 0, 13075, 0, 28821, 11780, 10199, 0, 12684, 0, 12442, 17249, 6189, 0, 28753,
+    0, 0, 16846, 4692, 28727, 12648, 20490, 10322, 28688, 16903, 0, 11477, 28812, 13052, 12852, 11477,
+    13136, 8577, 17290, 28684, 28736, 12033, 28738, 0, 12887, 32898, 28710, 0, 12492, 0, 0, 32845,
+    16527, 28769, 17397, 10796, 16922, 28775, 12609, 28741, 13221, 28770, 10274, 10561, 12868, 12369, 6322, 0,
+    11633, 0, 17407, 28674, 0, 0, 0, 12311, 12665, 12612, 0, 10217, 0, 32910, 9387, 32820,
+    12994, 12611, 28774, 32859, 11180, 0, 16911, 8790, 0, 4571, 32832, 11311, 0, 0, 6464, 11571,
+    13125, 12828, 28810, 0, 12900, 12502, 12982, 10706, 9508, 0, 12396, 28681, 0, 12645, 13007, 32781,
+    5801, 13076, 13063, 28779, 12384, 0, 11610, 10562, 0, 13115, 28807, 12521, 6456, 12924, 6174, 9089,
+    0, 13042, 12672, 28746, 0, 28817, 13040, 28751, 12574, 12531, 11954, 13164, 12323, 16650, 6059, 11679,
+    12887, 13184, 11757, 11088, 10153, 28786, 12984, 0, 12463, 12811, 28730, 10283, 0, 32932, 28801, 12541,
+    28760, 0, 13136, 13002, 28716, 10982, 28788, 6235, 17328, 13219, 12956, 32790, 6058, 11759, 28812, 0,
+    9657, 11947, 0, 12359, 16933, 0, 28819, 32918, 0, 12514, 0, 12804, 12761, 17316, 5106, 17306,
+    12368, 32820, 0, 12891, 13044, 0, 17408, 10852, 9263, 17377, 16683, 0, 13043, 0, 12972, 32819,
+    0, 0, 10796, 0, 0, 32845, 9862, 0, 16585, 16921, 28716, 9984, 12864, 28792, 0, 13199,
+    9089, 28782, 28774, 9918, 12875, 12067, 13092, 0, 0, 17410, 28820, 0, 9796, 8410, 0, 12347,
+    10500, 0, 13172, 28744, 11538, 0, 12634, 20488, 12683, 16642, 32805, 12298, 12563, 13043, 17203, 0,
+    0, 0, 0, 0, 28725, 13196, 8965, 16790, 12479, 12731, 12467, 8242, 11900, 12343, 0, 13183,
+    0, 12814, 0, 5658, 8319, 11729, 10075, 11909, 10343, 13092, 9986, 5453, 16935, 12552, 0, 6464,
+    11758, 5078, 8424, 12683, 11414, 12419, 28697, 0, 11349, 32867, 0, 8392, 16944, 9921, 12588, 28781,
+    0, 12668, 0, 12864, 0, 11311, 28796, 0, 6401, 9964, 12431, 12444, 17169, 0, 13050, 12701,
+    28815, 12683, 28785, 13146, 12871, 12360, 11095, 0, 12836, 0, 12930, 17169, 0, 12837, 10631, 28724,
+    5460, 11312, 13040, 10869, 11946, 10581, 12932, 11694, 32792, 0, 12525, 0, 12692, 32805, 8342, 10107,
+    0, 28796, 12321, 17408, 5665, 0, 17386, 0, 12946, 9916, 11049, 13114, 12779, 12407, 11693, 0,
+    13040, 10584, 0, 0, 0, 11869, 9607, 6448, 5585, 28798, 0, 0, 9663, 11412, 10860, 32904,
+    12944, 12066, 11257, 13007, 0, 0, 11956, 10583, 0, 0, 8620, 12576, 32930, 17397, 0, 10581,
+    11766, 0, 0, 11058, 12491, 6211, 0, 5580, 0, 16931, 10881, 12696, 13219, 0, 17013, 0,
+    10270, 0, 12839, 0, 17211, 11357, 5901, 6268, 32820, 9965, 28812, 10346, 11180, 10244, 0, 5656,
+    28809, 12524, 13062, 12797, 6149, 28790, 9948, 0, 0, 16910, 0, 9301, 13076, 9973, 28806, 0,
+    13064, 28773, 12546, 12888, 32827, 0, 17289, 11168, 11357, 0, 12944, 8962, 9321, 9066, 12464, 28800,
+    12788, 10274, 11694, 0, 10517, 17328, 10573, 9479, 12995, 32836, 11459, 12944, 32814, 13089, 8625, 16491,
+    0, 12643, 17408, 28759, 11436, 16832, 13143, 0, 28808, 0, 13088, 8650, 17307, 0, 9975, 28680,
+    9918, 12319, 10049, 17354, 12380, 28701, 12502, 12347, 32846, 9003, 28783, 10838, 10861, 28822, 13091, 6149,
+    0, 32846, 10734, 10584, 4570, 0, 12982, 16934, 10563, 16755, 0, 17289, 11776, 32869, 9562, 28739,
+    0, 12549, 11757, 12983, 6464, 11610, 32922, 12708, 12048, 12670, 0, 5629, 10805, 0, 16419, 13172,
+    11095, 12924, 12028, 17132, 16855, 20482, 5126, 0, 0, 28698, 9861, 10562, 32819, 6149, 12816, 16845,
+    6226, 10516, 12573, 0, 17083, 8712, 32936, 0, 11095, 5070, 9685, 0, 13025, 0, 8667, 10805,
+    12690, 11104, 12548, 13007, 12719, 8890, 28682, 13068, 12454, 10562, 12888, 12799, 0, 11181, 0, 28750,
+    5922, 13151, 12720, 32830, 0, 16666, 10078, 8723, 28711, 13016, 12058, 9087, 9676, 5498, 12786, 32853,
+    32908, 32935, 9388, 12728, 13020, 9008, 28705, 10380, 12336, 10048, 12490, 0, 0, 16936, 12808, 0,
+    11702, 28709, 12701, 8739, 12504, 12001, 11033, 17327, 10343, 0, 16753, 0, 28738, 9963, 6188, 17387,
+    32905, 16683, 8384, 0, 10583, 9982, 0, 28734, 17316, 28785, 0, 28785, 28698, 12766, 0, 12692,
+    0, 16676, 12489, 12684, 13115, 5207, 8322, 0, 10582, 17004, 6465, 17410, 0, 0, 28715, 11640,
+    0, 10870, 11601, 0, 28773, 0, 28815, 10571, 20489, 16672, 8655, 16846, 11451, 28680, 28784, 8449,
+    9376, 8881, 0, 17159, 5665, 0, 16814, 12690, 11686, 0, 12754, 10814, 0, 16974, 10514, 9986,
+    32779, 4743, 11478, 11450, 12792, 11179, 12816, 10160, 0, 0, 32919, 16537, 9211, 12664, 12909, 16919,
+    8366, 13199, 8650, 10573, 12432, 8936, 13044, 32906, 28808, 13160, 28732, 0, 0, 0, 8905, 28810,
+    13030, 5525, 10284, 28749, 9088, 12009, 12797, 16822, 16700, 0, 13188, 11954, 9892, 8611, 6058, 12671,
+    0, 12056, 0, 0, 16933, 0, 13171, 13056, 16687, 28788, 28792, 0, 6408, 28759, 12932, 10584,
+    0, 9600, 13062, 12788, 13212, 12497, 10580, 12515, 0, 16964, 0, 0, 0, 32793, 4653, 12623,
+    12480, 12612, 0, 12488, 28734, 28777, 0, 28679, 11767, 16571, 9049, 12995, 13011, 28759, 12990, 12655,
+    28761, 12727, 12439, 6365, 12611, 32805, 5036, 13195, 13187, 32936, 12076, 12525, 28762, 10079, 8787, 13161,
+    28679, 12647, 32864, 0, 12787, 5852, 0, 12684, 12657, 5042, 6364, 12455, 0, 13173, 0, 12780,
+    32856, 12760, 12702, 6465, 0, 16832, 12875, 0, 12465, 6234, 0, 28706, 13149, 8965, 32898, 16536,
+    28758, 6058, 0, 12573, 16542, 12671, 13162, 0, 16978, 16437, 16815, 8620, 16542, 12621, 11868, 8789,
+    13221, 6464, 0, 16831, 0, 6433, 12912, 10113, 12067, 0, 6188, 13068, 0, 16913, 6188, 4853,
+    32868, 12848, 28770, 16743, 10406, 12299, 12897, 8487, 28776, 13174, 10703, 6049, 10998, 17309, 12586, 28786,
+    28797, 28736, 12780, 12900, 9817, 16913, 12798, 10506, 28798, 32895, 13218, 12334, 12492, 12379, 12957, 0,
+    0, 12516, 32909, 28799, 17328, 5815, 0, 8461, 28817, 28759, 9043, 13074, 0, 5028, 9975, 0,
+    12664, 28776, 16834, 12468, 17220, 32937, 0, 5269, 12454, 12432, 11611, 28703, 9287, 28729, 9973, 13052,
+    28798, 16586, 10570, 12372, 28746, 11240, 12741, 10472, 12048, 12804, 8351, 16685, 28675, 12453, 8965, 9676,
+    8910, 6447, 32806, 5328, 12068, 11333, 12947, 0, 28682, 0, 13027, 0, 12075, 0, 20487, 0,
+    12514, 12427, 0, 0, 16986, 28700, 32921, 16721, 10212, 12922, 16430, 13092, 12551, 0, 12780, 12948,
+    0, 20482, 0, 12672, 13097, 0, 9474, 32845, 13162, 28709, 17150, 12379, 12815, 9863, 17121, 28673,
+    17241, 13196, 12933, 0, 32833, 9960, 10737, 12753, 9181, 5426, 0, 17253, 9676, 0, 28774, 4194,
+    32885, 0, 12467, 28757, 16525, 12028, 28794, 16497, 17241, 0, 28736, 12526, 12065, 32802, 4241, 32819,
+    0, 13222, 12588, 12528, 12760, 32919, 28692, 0, 20486, 5328, 0, 11414, 28784, 9256, 0, 11777,
+    32880, 32869, 5830, 13064, 0, 0, 20488, 12574, 12406, 16575, 13098, 13175, 5334, 13116, 32924, 12334,
+    12612, 32792, 0, 12672, 28797, 0, 12576, 0, 11481, 17387, 13151, 28692, 5483, 16855, 0, 4504,
+    17398, 16835, 12856, 8760, 28792, 0, 32853, 28678, 12648, 0, 12895, 32870, 13210, 16430, 9076, 11274,
+    0, 10554, 12717, 10584, 0, 11956, 11296, 0, 12346, 11268, 28789, 13091, 32779, 4755, 16949, 16993,
+    12576, 0, 9184, 17384, 28733, 28766, 32836, 12307, 8711, 17081, 12556, 17327, 0, 9684, 0, 16413,
+    4389, 9968, 11779, 0, 16451, 8995, 0, 0, 0, 28703, 13044, 32917, 9863, 0, 10263, 20487,
+    12792, 17140, 4344, 9915, 9343, 0, 17282, 32863, 12299, 17378, 9084, 32806, 5524, 28742, 0, 5203,
+    5319, 9984, 12501, 12848, 28735, 28718, 12887, 12895, 16841, 12904, 0, 20484, 28678, 8788, 8694, 16869,
+    11501, 17348, 28817, 13008, 12790, 12523, 0, 0, 32807, 8430, 0, 0, 8605, 12874, 0, 12335,
+    28745, 0, 11379, 10077, 12629, 12573, 0, 12583, 20482, 0, 16435, 12888, 9749, 11058, 12540, 0,
+    0, 12443, 0, 28780, 28769, 0, 5368, 0, 13152, 8357, 12864, 10327, 32882, 10781, 0, 0,
+    12608, 0, 20490, 5656, 28786, 16500, 0, 6448, 0, 13075, 6364, 32846, 17002, 28720, 28732, 0,
+    28732, 16513, 17015, 6188, 13162, 4726, 12859, 32820, 28789, 8696, 0, 0, 16767, 0, 12837, 12684,
+    0, 0, 9305, 28728, 32933, 12763, 12549, 12299, 12010, 10095, 0, 12908, 17170, 12551, 32818, 6189,
+    28680, 28744, 0, 16974, 10870, 6432, 16536, 13023, 0, 6327, 0, 10212, 8444, 0, 10136, 0,
+    12630, 16774, 13208, 28786, 9916, 28817, 9808, 0, 28675, 0, 0, 17328, 11749, 4885, 0, 9210,
+    28677, 17397, 28794, 28819, 9311, 12049, 6321, 17315, 10902, 12981, 12582, 13161, 0, 0, 16869, 16587,
+    4613, 11895, 9814, 10182, 9528, 0, 28789, 11358, 11004, 0, 12707, 0, 32806, 5421, 13159, 0,
+    28789, 8757, 5270, 11932, 12065, 16746, 0, 12922, 28776, 12931, 10582, 9749, 13173, 12695, 12402, 11385,
+    12803, 0, 28674, 13174, 0, 0, 11086, 13052, 0, 0, 10327, 8390, 16794, 6392, 12874, 13032,
+    32815, 4980, 11870, 0, 8475, 12635, 9016, 16931, 17317, 12334, 11777, 10207, 0, 0, 12719, 16737,
+    0, 9263, 10515, 16865, 12726, 28746, 0, 17290, 11169, 9064, 12521, 12881, 12534, 16767, 28687, 8313,
+    12772, 28729, 0, 0, 10920, 12516, 11443, 28808, 8351, 28711, 0, 28745, 5682, 11909, 4292, 9853,
+    10617, 28821, 17172, 12600, 32831, 0, 9309, 12463, 32844, 5825, 0, 16937, 9503, 10326, 0, 12558,
+    9955, 11059, 9947, 0, 12504, 28809, 12406, 13008, 12415, 32803, 8575, 8948, 4867, 12574, 9210, 0,
+    32828, 32818, 0, 13139, 16737, 28675, 0, 13194, 32803, 4446, 0, 16867, 8424, 9474, 12335, 13032,
+    28703, 28786, 12065, 0, 28688, 20488, 11601, 16597, 28690, 0, 11567, 13064, 16509, 0, 12677, 13175,
+    28729, 12827, 28736, 11806, 0, 0, 28723, 0, 9747, 11085, 9985, 11870, 13020, 13032, 12076, 28731,
+    12492, 13020, 4543, 11992, 12524, 10515, 28703, 6015, 16603, 12876, 0, 13079, 6041, 12642, 0, 0,
+    5012, 12653, 32804, 4608, 0, 11946, 28789, 32844, 13139, 12790, 13020, 4866, 13164, 28802, 32883, 28822,
+    5018, 13152, 12970, 28681, 0, 6402, 13176, 12947, 9515, 0, 12682, 12311, 0, 12895, 0, 12863,
+    13128, 12393, 4451, 0, 12643, 11274, 16597, 12677, 10239, 13152, 8232, 28756, 32777, 10613, 11632, 28814,
+    28706, 0, 11550, 17377, 16621, 4667, 11477, 28728, 32802, 8245, 8453, 11035, 11909, 28768, 28798, 17228,
+    5396, 12334, 13042, 0, 13092, 16854, 17327, 13147, 0, 16609, 28770, 0, 12814, 12897, 13151, 0,
+    8460, 6465, 28819, 12010, 12708, 32897, 13194, 17016, 12066, 0, 0, 0, 8919, 0, 0, 13184,
+    28817, 12474, 10102, 10218, 9285, 5652, 10815, 16693, 5862, 32910, 13007, 17376, 20484, 12455, 16463, 17317,
+    28711, 12738, 9675, 28722, 0, 12749, 4673, 10272, 12407, 12406, 12430, 13042, 0, 8988, 28733, 5687,
+    12076, 11992, 28698, 32802, 12556, 13008, 6357, 12878, 0, 16753, 4388, 0, 5238, 12333, 8468, 8365,
+    5828, 13174, 0, 9038, 13068, 0, 8948, 0, 12739, 13151, 28758, 12615, 5368, 0, 13208, 0,
+    28681, 12786, 0, 9649, 16540, 0, 0, 28679, 12347, 17406, 13126, 12976, 16982, 12049, 0, 9068,
+    16873, 0, 12738, 11910, 17170, 9986, 5674, 11334, 0, 8655, 28753, 17407, 10870, 16596, 12923, 11595,
+    0, 0, 11567, 0, 32844, 0, 8605, 8696, 16777, 10206, 16517, 0, 28753, 28746, 0, 16677,
+    28803, 0, 0, 8760, 4450, 0, 5212, 8413, 8994, 12899, 28741, 0, 12594, 6440, 12846, 11985,
+    9306, 11894, 16492, 0, 5980, 16729, 28825, 0, 12359, 9770, 11349, 28756, 32896, 0, 17319, 28704,
+    9955, 12717, 4925, 5303, 28801, 12516, 0, 13025, 10797, 12354, 4405, 32897, 11572, 0, 12371, 0,
+    0, 12066, 13024, 16853, 0, 0, 12367, 11136, 0, 9180, 0, 9067, 16513, 0, 0, 16966,
+    10883, 4977, 9947, 16440, 13016, 8583, 6448, 20489, 28809, 0, 28819, 0, 32820, 28711, 0, 12065,
+    0, 28817, 12300, 12034, 13163, 12395, 16459, 0, 4670, 9606, 9019, 28811, 12767, 16767, 5484, 6145,
+    4614, 12703, 11403, 8485, 16966, 0, 8606, 0, 32905, 28826, 10255, 10697, 32911, 12980, 9861, 10517,
+    0, 13151, 13127, 13196, 12826, 32831, 13207, 12775, 28810, 12336, 12880, 16588, 12879, 0, 28740, 12979,
+    17252, 0, 0, 9367, 12816, 12323, 0, 12612, 0, 28728, 11480, 0, 32817, 16667, 8319, 32907,
+    0, 28821, 12881, 16541, 0, 0, 12456, 16935, 11946, 4672, 12743, 17083, 11112, 0, 28718, 16602,
+    0, 0, 12888, 28822, 17070, 13187, 10108, 12741, 12753, 12713, 11902, 0, 13128, 13138, 0, 10078,
+    28737, 28795, 5304, 6210, 11182, 9687, 12516, 28767, 12407, 9247, 17406, 11683, 9554, 0, 16932, 0,
+    0, 28732, 17005, 0, 16460, 0, 4468, 10573, 6043, 28757, 0, 16605, 12608, 28729, 9256, 0,
+    11657, 8883, 28737, 12612, 0, 13090, 0, 0, 12858, 13052, 13147, 28708, 16902, 0, 12484, 17115,
+    0, 9287, 12667, 28701, 10247, 13030, 12716, 10731, 32896, 9018, 17377, 9287, 28692, 13152, 32818, 32845,
+    12934, 12395, 28712, 10099, 11478, 13040, 12480, 20490, 13152, 12528, 9247, 12427, 16823, 28773, 12501, 28750,
+    12504, 12379, 8613, 0, 12672, 0, 12863, 28758, 9425, 20482, 4910, 0, 0, 5629, 12310, 0,
+    9466, 28725, 32802, 12579, 13001, 12970, 28735, 32843, 16980, 28691, 16647, 0, 12074, 12444, 0, 16537,
+    13164, 12516, 12559, 16406, 8396, 0, 13052, 0, 28822, 12648, 0, 12395, 0, 16795, 0, 0,
+    9072, 32790, 12000, 11694, 8396, 12804, 8404, 17091, 16496, 17123, 0, 11610, 13112, 12713, 9964, 12797,
+    17376, 13176, 0, 13053, 6173, 13174, 9353, 6145, 0, 12584, 0, 5698, 8863, 0, 28686, 8410,
+    9518, 17220, 8490, 0, 32897, 4555, 12763, 0, 0, 0, 12812, 0, 12788, 16980, 28781, 13141,
+    0, 12763, 13041, 0, 9615, 17240, 28674, 17082, 16429, 10563, 12524, 11758, 28803, 6327, 28678, 28674,
+    0, 9981, 28703, 12779, 28759, 9606, 11004, 0, 12523, 12455, 6259, 9075, 12332, 10947, 32844, 10705,
+    0, 6150, 0, 16832, 12848, 17002, 28709, 10268, 8594, 12967, 11214, 28729, 13089, 0, 0, 11655,
+    0, 12562, 0, 0, 16989, 12606, 28732, 12595, 28712, 11181, 28692, 13115, 13223, 13026, 8322, 12837,
+    0, 12923, 16815, 12827, 28678, 0, 0, 12455, 8584, 12383, 20481, 11160, 12814, 9564, 12834, 28703,
+    8478, 12809, 12660, 9182, 0, 17061, 28703, 0, 0, 28707, 4210, 12741, 32867, 12312, 28799, 12868,
+    10400, 0, 13036, 28737, 28797, 9235, 28728, 12560, 0, 12379, 16609, 11215, 32800, 16789, 0, 8730,
+    28768, 10572, 4685, 28687, 9075, 0, 13017, 28748, 28820, 0, 12740, 9815, 0, 10162, 12704, 0,
+    10100, 12632, 32845, 13111, 8346, 8488, 0, 12658, 0, 17332, 28806, 8329, 12308, 0, 28703, 0,
+    10378, 12681, 28815, 12033, 12451, 0, 12873, 0, 10571, 10278, 9863, 12715, 28809, 16824, 9724, 10384,
+    9175, 9001, 0, 32779, 8629, 12453, 0, 8719, 16676, 8994, 16972, 5830, 28780, 9147, 28693, 0,
+    11440, 28729, 12912, 28706, 32801, 16868, 12635, 28736, 12966, 12900, 4957, 13076, 32804, 9192, 28679, 12653,
+    0, 28708, 9628, 32845, 0, 6235, 16618, 13220, 28685, 0, 9130, 16744, 0, 0, 0, 12924,
+    8446, 16873, 9748, 8949, 28769, 0, 12359, 10407, 32793, 16648, 12534, 10563, 10437, 8710, 0, 13162,
+    17049, 8964, 9001, 28717, 12907, 12536, 0, 9474, 17275, 12417, 28795, 13218, 9518, 16439, 17250, 5923,
+    13067, 6235, 13085, 11274, 9082, 10949, 8488, 16597, 0, 0, 16766, 8618, 9089, 12594, 12888, 10572,
+    10581, 16664, 8301, 32817, 17004, 28785, 10618, 11514, 11159, 9671, 12428, 12041, 12704, 16746, 0, 10483,
+    16450, 11939, 0, 0, 0, 0, 12504, 12642, 9343, 0, 28742, 10416, 12645, 9955, 12503, 16815,
+    0, 11684, 32833, 13139, 4948, 16429, 32846, 9087, 0, 28740, 11079, 5361, 17368, 32817, 20482, 10517,
+    0, 12666, 28742, 12336, 16587, 0, 13140, 0, 12076, 0, 5810, 12576, 12749, 16538, 12655, 28690,
+    12683, 6466, 9800, 12886, 16511, 10487, 5666, 12874, 12729, 0, 16542, 0, 12762, 13031, 28820, 10152,
+    16753, 4614, 12384, 0, 28760, 16618, 12492, 10061, 12803, 8719, 12370, 12503, 10466, 11239, 5037, 0,
+    8665, 13075, 12539, 0, 9544, 9835, 12575, 12575, 28716, 13151, 13104, 17171, 16834, 0, 13128, 12335,
+    12573, 17368, 28795, 16596, 9777, 12999, 28761, 16695, 0, 0, 10650, 12049, 9685, 17369, 4778, 0,
+    8655, 12767, 16823, 20487, 13120, 0, 0, 9971, 28819, 0, 28681, 4701, 0, 0, 12347, 28822,
+    28729, 12324, 12521, 12489, 12347, 17091, 11379, 28719, 0, 0, 16530, 11246, 0, 32844, 8987, 9620,
+    0, 8919, 11170, 12346, 0, 12762, 5646, 32829, 0, 32805, 4756, 28712, 9981, 0, 16620, 12463,
+    12429, 0, 12751, 0, 0, 32846, 32852, 0, 5010, 32806, 8673, 8751, 12310, 28719, 9311, 10285,
+    8277, 12752, 12344, 0, 0, 9309, 28726, 0, 17093, 0, 0, 9974, 28822, 13001, 5591, 28819,
+    12359, 12936, 28750, 20485, 9002, 9547, 32793, 28773, 10354, 28727, 11234, 11865, 9986, 0, 28745, 28803,
+    9065, 0, 0, 10797, 10881, 0, 4700, 17253, 0, 28684, 20484, 11041, 10426, 17328, 10948, 12523,
+    32841, 10097, 12420, 10026, 12478, 0, 8657, 17250, 9934, 12408, 4720, 12944, 16842, 32833, 0, 16587,
+    16538, 12536, 0, 13145, 10213, 8658, 0, 9372, 0, 0, 13080, 10216, 12606, 11595, 0, 28799,
+    8711, 28733, 28785, 16697, 12561, 17003, 28691, 12562, 28768, 16815, 12682, 5552, 17396, 4948, 32842, 8584,
+    0, 9917, 13041, 28726, 9915, 12917, 9019, 12394, 32819, 32806, 5264, 12972, 13138, 12384, 4423, 0,
+    0, 0, 0, 0, 0, 12537, 28693, 5861, 32893, 0, 13184, 0, 0, 5068, 0, 28794,
+    28773, 10582, 32846, 12396, 28815, 28822, 10759, 28694, 8751, 10472, 0, 16931, 16904, 16698, 0, 12068,
+    20486, 5329, 32843, 8703, 5413, 16586, 0, 11096, 0, 8665, 9898, 12041, 6092, 16485, 11779, 12455,
+    12499, 0, 13076, 0, 16818, 32819, 11050, 11340, 4242, 0, 8610, 28823, 28821, 0, 16443, 13152,
+    11179, 8920, 11356, 12324, 12846, 16439, 12575, 0, 0, 12012, 11246, 0, 12881, 11566, 12980, 12900,
+    12644, 0, 9287, 32803, 9157, 28787, 9772, 28789, 17149, 12383, 20481, 13099, 0, 16529, 11266, 0,
+    28806, 16461, 13005, 0, 12049, 6411, 6401, 4944, 28730, 0, 17061, 12503, 10495, 0, 28821, 10967,
+    9852, 0, 28786, 0, 28752, 5645, 12408, 28683, 28818, 0, 12359, 12871, 12776, 11866, 12630, 0,
+    28716, 0, 12876, 12405, 12777, 0, 17248, 17318, 11767, 4610, 17149, 9586, 9963, 28731, 16915, 28698,
+    10370, 12348, 12777, 13091, 12954, 28747, 12066, 0, 28708, 0, 9669, 17410, 12813, 28828, 28820, 12873,
+    17013, 0, 32829, 16519, 16588, 0, 28711, 0, 16930, 17298, 13043, 0, 32806, 5394, 5490, 10665,
+    10947, 13099, 12439, 4301, 28697, 12552, 10040, 10415, 12584, 10804, 13146, 8702, 16699, 4975, 13176, 13008,
+    28785, 28772, 10310, 9598, 13111, 9948, 28787, 0, 10183, 16902, 0, 10563, 12668, 0, 17172, 0,
+    12898, 28702, 0, 16885, 0, 9003, 8919, 17080, 9318, 11739, 9656, 28737, 0, 16579, 0, 28723,
+    12750, 20483, 28800, 11734, 0, 16843, 16824, 17002, 28753, 9642, 12743, 5067, 13155, 17003, 12407, 0,
+    12607, 12432, 10924, 9009, 12382, 12828, 12852, 28680, 32920, 8666, 9620, 16696, 17093, 9089, 10861, 0,
+    0, 12420, 28766, 28676, 0, 0, 9247, 0, 12499, 17080, 12648, 11468, 32840, 12501, 0, 28737,
+    0, 28747, 12076, 8966, 28713, 9210, 9205, 12960, 9349, 16539, 0, 12406, 11573, 12897, 9009, 0,
+    0, 10648, 12681, 0, 32792, 12606, 28751, 20482, 5853, 12538, 0, 28788, 8412, 13006, 0, 10512,
+    13036, 16609, 12521, 28673, 17230, 0, 28745, 32775, 10015, 12765, 9478, 9666, 0, 32882, 28823, 8367,
+    28727, 8420, 28793, 0, 0, 13218, 32844, 20481, 0, 17299, 28777, 11104, 12562, 8358, 13108, 12463,
+    12371, 13200, 13027, 12585, 9564, 0, 12678, 0, 12478, 0, 28679, 28828, 10028, 4784, 0, 12655,
+    6466, 11573, 12320, 16885, 0, 0, 12871, 0, 11590, 12074, 0, 12723, 17132, 12312, 5022, 28750,
+    4303, 5657, 0, 32806, 9284, 0, 12983, 16776, 16685, 16807, 0, 28758, 0, 12873, 12893, 12557,
+    12607, 12346, 9681, 0, 11479, 0, 12672, 0, 0, 4974, 0, 0, 17385, 0, 4662, 16829,
+    12621, 12573, 9839, 0, 0, 17121, 28785, 11479, 12552, 13111, 5536, 13175, 17070, 10739, 12682, 11871,
+    16856, 0, 6144, 28828, 13163, 0, 28727, 10255, 28774, 10028, 0, 11469, 5451, 0, 12802, 12552,
+    11713, 28821, 13114, 4700, 28680, 12994, 8469, 0, 10066, 0, 12552, 0, 16413, 12777, 0, 17274,
+    9954, 13151, 12669, 0, 11545, 0, 16807, 9679, 0, 13079, 12737, 12790, 8476, 8412, 32819, 12034,
+    16606, 12984, 0, 9207, 0, 9779, 20486, 12834, 11565, 28773, 12455, 6457, 32870, 16449, 28700, 0,
+    32833, 28735, 28730, 12323, 0, 0, 5017, 4986, 0, 6091, 0, 12870, 9518, 10271, 0, 13173,
+    16695, 0, 32936, 10377, 0, 28773, 0, 0, 32833, 0, 0, 12468, 0, 12657, 0, 12492,
+    12683, 12627, 8447, 11532, 0, 0, 28788, 9986, 32924, 12576, 4914, 0, 0, 12369, 4722, 0,
+    28691, 11038, 12480, 0, 0, 16913, 12765, 16909, 0, 10947, 13108, 13173, 28734, 28719, 17407, 28675,
+    10108, 32781, 5692, 0, 5067, 6268, 16697, 28757, 12723, 9814, 16766, 12504, 11246, 11113, 11982, 4955,
+    0, 0, 5359, 32924, 9846, 12564, 28822, 12804, 12728, 9564, 20488, 0, 12624, 28685, 9320, 11758,
+    17309, 6038, 17307, 10437, 0, 0, 8994, 12683, 0, 5550, 28800, 12500, 28734, 12777, 8403, 0,
+    0, 9051, 32827, 10436, 12792, 28719, 32932, 0, 0, 16779, 0, 0, 12881, 17394, 13116, 28729,
+    12977, 32779, 11211, 17070, 0, 12785, 16676, 11328, 11702, 4629, 0, 28776, 13209, 16492, 12693, 12888,
+    12966, 6151, 10482, 28790, 12779, 10891, 0, 28824, 10311, 28777, 10218, 13151, 28784, 0, 10714, 0,
+    0, 0, 12380, 12764, 32832, 8321, 0, 0, 5829, 28711, 4977, 32919, 0, 16688, 12768, 12874,
+    28825, 0, 28766, 32803, 9178, 10461, 0, 9264, 6386, 28774, 12884, 0, 12552, 12954, 17116, 11740,
+    0, 9618, 12948, 0, 4988, 28704, 0, 0, 28825, 11412, 0, 16777, 0, 17369, 9219, 11412,
+    28765, 9067, 32790, 0, 5433, 0, 17407, 11565, 16764, 32935, 16535, 0, 28773, 0, 0, 8992,
+    12857, 10516, 8725, 0, 0, 28749, 12972, 9609, 0, 16779, 17280, 16616, 13174, 10254, 0, 9474,
+    16893, 12396, 0, 0, 12991, 5563, 32781, 6264, 12696, 5309, 5277, 10105, 5982, 0, 5985, 0,
+    12634, 16658, 9646, 12058, 0, 4881, 12520, 17190, 12623, 16430, 16855, 10338, 12730, 20486, 32846, 16450,
+    32779, 4987, 17083, 28718, 16460, 12488, 12911, 0, 32936, 0, 16621, 10551, 5721, 32807, 5861, 28692,
+    16597, 12403, 12034, 16450, 0, 13146, 12515, 0, 13006, 17003, 32789, 32871, 9380, 9057, 17140, 8988,
+    28724, 0, 16962, 0, 6432, 16529, 12320, 5359, 8785, 6123, 0, 28788, 12371, 0, 28737, 9766,
+    11656, 9349, 32815, 12419, 12934, 0, 12982, 0, 5699, 10699, 12884, 16813, 32846, 10797, 28711, 28773,
+    0, 12344, 16538, 0, 12697, 17375, 0, 9240, 9321, 32818, 12552, 13043, 12322, 13164, 0, 0,
+    28687, 9816, 17228, 0, 5185, 28735, 12468, 12032, 0, 13149, 12650, 0, 20484, 12419, 12943, 17329,
+    9601, 12515, 32791, 0, 11038, 0, 12369, 10141, 6109, 0, 13152, 12892, 13064, 13224, 9021, 28732,
+    0, 28712, 0, 13115, 11767, 8353, 9812, 12827, 11330, 0, 10272, 28729, 0, 13029, 9917, 0,
+    10853, 0, 16687, 0, 5892, 28708, 8467, 32909, 13114, 0, 28727, 0, 8992, 5433, 28746, 5103,
+    13014, 10816, 10279, 5919, 0, 13121, 12297, 8404, 13224, 0, 28684, 12012, 17394, 10517, 12814, 0,
+    9067, 0, 12636, 28828, 32807, 10527, 32780, 5279, 12684, 6288, 10178, 12427, 0, 17117, 0, 9983,
+    9986, 9601, 17014, 17378, 9085, 28802, 0, 13185, 0, 13030, 12514, 9073, 28794, 0, 5261, 16700,
+    28792, 12501, 8357, 16699, 0, 9286, 32897, 9891, 8479, 28737, 9472, 12742, 0, 11459, 12746, 16869,
+    9356, 12894, 9181, 28737, 17190, 8775, 0, 9844, 13004, 8992, 28755, 28738, 12332, 13029, 5433, 9684,
+    13004, 12490, 9536, 12911, 28816, 0, 12993, 5985, 4728, 12576, 11811, 10998, 9749, 17329, 0, 5482,
+    11777, 12780, 12693, 16449, 11152, 12798, 12521, 16756, 13176, 16997, 28692, 0, 28816, 32858, 12610, 8718,
+    28736, 9474, 6089, 12334, 11114, 17162, 28714, 0, 32843, 12756, 4292, 11298, 12619, 16538, 12345, 12693,
+    16737, 0, 8652, 12463, 11768, 12799, 17170, 13208, 0, 16463, 12672, 0, 6143, 12528, 17327, 8865,
+    0, 12922, 12840, 28736, 12764, 5889, 12296, 12309, 13223, 28762, 0, 12743, 28810, 8476, 28703, 32864,
+    0, 12642, 8915, 6381, 11627, 0, 6123, 10406, 9986, 9374, 32896, 17330, 9687, 12381, 28812, 13028,
+    28683, 12767, 12656, 12895, 10880, 17329, 28827, 32911, 9898, 13176, 4989, 5608, 10489, 12648, 16902, 9210,
+    0, 10675, 16951, 0, 12990, 10218, 12504, 5487, 13130, 12468, 0, 20482, 28771, 17017, 4544, 0,
+    16997, 8767, 12573, 16537, 12405, 17369, 28786, 0, 13044, 0, 12873, 5609, 10285, 32791, 28693, 11758,
+    28720, 17399, 12876, 16970, 10639, 0, 0, 12550, 28784, 12858, 0, 13109, 28802, 12396, 32906, 16869,
+    9685, 12634, 10786, 12895, 28779, 0, 0, 0, 12534, 12432, 0, 0, 10108, 0, 12527, 28808,
+    0, 17290, 16722, 16596, 9980, 11545, 9384, 0, 12910, 9377, 12431, 17238, 9749, 13211, 12924, 0,
+    12924, 13132, 0, 4923, 9147, 32841, 10387, 28730, 17241, 6010, 0, 12558, 0, 16439, 0, 28758,
+    13052, 5645, 9642, 10443, 12077, 12898, 12752, 6012, 5590, 17082, 0, 0, 16904, 0, 8713, 17053,
+    0, 12792, 16498, 9089, 9349, 0, 0, 28827, 28674, 12010, 9547, 11509, 17228, 0, 16597, 12490,
+    11627, 10702, 28745, 5649, 0, 5252, 10187, 8632, 32820, 12789, 4794, 32780, 5372, 28686, 0, 8664,
+    12077, 12671, 16539, 0, 0, 28759, 12874, 0, 10937, 28673, 16542, 0, 28755, 10578, 0, 12415,
+    16607, 32840, 28710, 0, 16834, 11039, 9256, 12065, 12994, 16427, 8658, 28807, 16779, 8469, 28822, 9210,
+    17240, 12318, 10136, 12592, 0, 0, 12622, 12712, 5178, 28736, 10538, 0, 0, 11131, 28823, 0,
+    8876, 12419, 0, 16737, 8776, 13175, 0, 10583, 10263, 16461, 11759, 5727, 0, 0, 12067, 0,
+    8365, 12523, 16606, 12824, 0, 28691, 0, 0, 12356, 5403, 0, 0, 28719, 16925, 32793, 6393,
+    8284, 16603, 4982, 8491, 10617, 12991, 0, 0, 17013, 17007, 28747, 9376, 12372, 10066, 0, 9342,
+    9503, 13174, 12077, 5674, 28781, 28728, 28678, 5918, 0, 9376, 28731, 8368, 11673, 16850, 0, 11377,
+    9941, 8584, 12333, 0, 12726, 12881, 0, 8910, 0, 12632, 9779, 10840, 32906, 17093, 28807, 12372,
+    11865, 12622, 16426, 32820, 12345, 9263, 12684, 10975, 16911, 12011, 6402, 0, 12300, 0, 0, 28728,
+    16509, 11335, 12906, 9215, 32908, 8338, 12599, 12346, 16450, 9609, 12969, 12808, 0, 28727, 0, 10095,
+    12527, 10816, 12804, 12479, 8320, 16833, 0, 0, 0, 0, 8278, 28757, 0, 32791, 32833, 12896,
+    0, 0, 12706, 8912, 0, 8476, 12881, 28725, 32819, 17196, 0, 28723, 9808, 12515, 0, 0,
+    16647, 12307, 9586, 32859, 5961, 28731, 12563, 0, 10916, 9373, 0, 13159, 12371, 11740, 9814, 12694,
+    12647, 0, 12431, 32816, 12668, 0, 0, 0, 10326, 28729, 9908, 0, 28735, 0, 32924, 32909,
+    12540, 0, 13031, 0, 12586, 28753, 11594, 11299, 16516, 0, 0, 12324, 0, 10975, 13167, 11138,
+    5014, 9674, 8702, 0, 8284, 6299, 0, 4310, 0, 9320, 32910, 0, 12299, 12780, 10502, 0,
+    12346, 28743, 6011, 12898, 0, 0, 28703, 28767, 5488, 12677, 6123, 13067, 11713, 28729, 12001, 9251,
+    32820, 13028, 16578, 13167, 12935, 12309, 28679, 0, 6059, 9674, 0, 10132, 12348, 12540, 8966, 17013,
+    0, 10539, 28695, 28711, 28702, 12716, 0, 28697, 13137, 16745, 16850, 0, 28724, 0, 16438, 16935,
+    9021, 10538, 28713, 5306, 5375, 11673, 0, 12660, 9845, 12533, 32846, 28680, 16997, 0, 0, 0,
+    6086, 11530, 0, 16440, 12743, 6205, 11758, 28703, 0, 13077, 13014, 4564, 13087, 32777, 4386, 20486,
+    12486, 28690, 17172, 28701, 11039, 6456, 32841, 32869, 0, 28822, 0, 8963, 12558, 0, 10786, 13051,
+    0, 12300, 4409, 28715, 0, 17171, 12881, 13137, 10027, 9020, 12527, 0, 0, 9377, 17354, 12575,
+    12382, 9479, 0, 32789, 12994, 12357, 0, 9171, 9301, 10079, 9909, 16844, 0, 12773, 32864, 12947,
+    8413, 17042, 5931, 16987, 8966, 11349, 11673, 12357, 0, 28745, 28701, 28691, 17377, 32858, 9011, 13017,
+    13220, 4742, 0, 0, 9376, 0, 0, 28759, 10734, 12812, 8713, 8489, 28757, 28783, 8606, 17269,
+    0, 0, 28777, 8880, 13221, 10740, 12415, 13168, 10339, 0, 0, 12322, 0, 0, 0, 12725,
+    5500, 12526, 16586, 6299, 0, 11349, 0, 28798, 0, 0, 0, 10274, 13015, 5656, 12636, 9068,
+    12742, 32910, 9684, 16579, 5010, 9216, 0, 28774, 0, 0, 0, 9203, 17378, 17299, 28678, 5930,
+    11337, 5499, 11085, 28734, 0, 0, 28682, 20488, 0, 16820, 32937, 10583, 9219, 12395, 0, 8610,
+    17015, 8667, 32780, 5305, 0, 12383, 0, 17249, 0, 28759, 0, 10614, 12936, 0, 32846, 0,
+    9374, 17219, 12978, 12440, 0, 11002, 10214, 0, 12720, 12546, 17307, 16609, 0, 0, 12789, 12321,
+    12892, 17250, 0, 9239, 0, 16866, 0, 0, 20484, 12551, 28678, 13145, 11033, 13164, 0, 9384,
+    32842, 0, 8390, 9917, 17317, 9342, 9387, 0, 0, 11039, 9066, 0, 28727, 16746, 8253, 11955,
+    12718, 8395, 9746, 9962, 28824, 12636, 16675, 28677, 0, 4409, 12677, 13151, 5499, 28794, 0, 11469,
+    28732, 28782, 11139, 0, 5590, 10241, 8403, 9833, 9479, 13111, 17060, 13188, 0, 13104, 11171, 28682,
+    32881, 10489, 16880, 8454, 0, 11711, 0, 5488, 13160, 12407, 16745, 32936, 8882, 0, 0, 16987,
+    9909, 13115, 9089, 5258, 16913, 16826, 9217, 0, 28679, 12773, 16438, 13138, 12785, 12299, 32778, 10912,
+    12356, 28741, 0, 0, 10217, 8606, 28680, 10132, 12659, 17388, 0, 32819, 12816, 32831, 0, 0,
+    16440, 9854, 0, 17253, 0, 12335, 0, 0, 6381, 28804, 13140, 28807, 6277, 17387, 12600, 0,
+    11050, 9918, 32932, 28693, 9845, 28763, 0, 28682, 12516, 13109, 11430, 6410, 9216, 0, 9287, 10191,
+    0, 28748, 28743, 0, 28809, 16462, 28809, 9600, 12824, 11140, 8307, 12001, 0, 12382, 12773, 9971,
+    0, 0, 28746, 11816, 12527, 9946, 17269, 0, 5629, 9302, 0, 28673, 5591, 5102, 9750, 10245,
+    0, 17318, 28758, 10452, 28788, 9563, 0, 32818, 16429, 13017, 17251, 12468, 9909, 0, 12906, 32780,
+    8672, 0, 16451, 32817, 0, 0, 10460, 28692, 17271, 28786, 28788, 16619, 12612, 6257, 13001, 0,
+    11808, 32854, 12718, 32820, 12647, 13076, 13160, 28727, 9859, 0, 12726, 12896, 0, 12441, 12826, 0,
+    5840, 12394, 0, 28722, 8278, 28823, 4447, 12696, 9615, 0, 32842, 13026, 10284, 16686, 0, 17332,
+    0, 0, 13077, 10620, 8988, 13018, 12888, 11208, 4443, 28768, 0, 13086, 16754, 0, 32844, 11571,
+    32820, 6344, 0, 20482, 11844, 12299, 16800, 0, 13016, 12654, 13140, 0, 28687, 12676, 9452, 12922,
+    0, 9972, 10273, 13136, 9452, 9503, 11539, 28824, 0, 32830, 0, 13184, 32843, 0, 11169, 0,
+    12582, 13184, 8612, 10284, 12394, 12308, 12395, 28721, 9509, 12730, 6465, 9684, 12707, 28757, 8423, 12431,
+    28823, 28760, 13123, 0, 16508, 0, 0, 9515, 17298, 0, 13164, 0, 32829, 13056, 16500, 0,
+    20482, 28757, 12408, 16588, 8583, 8619, 28747, 9074, 28774, 12381, 0, 0, 12861, 0, 12404, 28736,
+    32922, 28716, 0, 8882, 0, 6381, 0, 9306, 0, 12676, 0, 10191, 11171, 12861, 20485, 17377,
+    6145, 16617, 20484, 12635, 0, 32830, 28681, 13126, 9979, 11478, 0, 32924, 28692, 28813, 9000, 9686,
+    0, 12405, 10326, 32819, 0, 0, 0, 12405, 12773, 10327, 8423, 4572, 8911, 12750, 28758, 6381,
+    13104, 12552, 17408, 0, 12899, 0, 6326, 0, 32842, 20484, 6466, 8470, 20487, 17141, 8583, 8612,
+    0, 9540, 0, 10482, 28815, 28688, 9838, 0, 0, 12545, 11468, 8942, 0, 10247, 13195, 9287,
+    10785, 6385, 9614, 12677, 32781, 5700, 0, 0, 9601, 0, 12677, 12324, 0, 5959, 17408, 12654,
+    16809, 0, 16699, 0, 9934, 16421, 0, 16461, 13127, 10498, 28724, 9503, 0, 0, 12833, 0,
+    0, 8656, 12716, 0, 12300, 28717, 4609, 20484, 5910, 12582, 16745, 17330, 12503, 0, 0, 11470,
+    10238, 0, 16658, 9312, 10584, 5433, 12801, 11083, 9067, 28728, 5629, 12968, 10621, 16516, 11648, 5830,
+    11758, 28814, 11844, 28824, 9592, 0, 16904, 28776, 9503, 13020, 28749, 8619, 16677, 6326, 8467, 28745,
+    13099, 8350, 12407, 12564, 32869, 13220, 32911, 12642, 32911, 16677, 28716, 12696, 4613, 32895, 9261, 0,
+    5927, 0, 10516, 20487, 17317, 28747, 17210, 0, 0, 0, 16438, 8911, 0, 9287, 12358, 0,
+    13091, 6410, 13221, 28681, 0, 0, 10714, 13125, 8619, 28772, 12706, 0, 10804, 6428, 12773, 12370,
+    12407, 0, 12441, 9671, 0, 12443, 8718, 32791, 32828, 11635, 28712, 28722, 10153, 13211, 5249, 11638,
+    11512, 0, 0, 9365, 0, 9474, 16856, 16991, 12932, 17250, 16872, 28810, 8768, 0, 17012, 16763,
+    10270, 17275, 9558, 12996, 28828, 9336, 32846, 12332, 12370, 12610, 0, 0, 12718, 12744, 10178, 10882,
+    10920, 16685, 0, 0, 12825, 12732, 28748, 32818, 16676, 32840, 11694, 12813, 28729, 9973, 10806, 32820,
+    12417, 28694, 8995, 28763, 13012, 28692, 16439, 0, 0, 12880, 12922, 9891, 12322, 0, 0, 16528,
+    32819, 0, 17139, 12415, 12468, 12478, 12834, 16438, 9059, 32815, 13128, 0, 16745, 28759, 28700, 9606,
+    9982, 12443, 32923, 16982, 0, 12764, 11711, 4868, 0, 12716, 17228, 0, 0, 8777, 12636, 0,
+    17158, 32842, 17280, 0, 0, 11636, 8745, 13123, 10350, 11504, 4868, 17061, 4451, 4669, 5957, 13136,
+    12456, 9642, 32805, 4927, 12984, 11395, 28738, 16755, 32881, 0, 0, 9798, 28690, 32781, 9324, 0,
+    12654, 12499, 32854, 0, 9654, 0, 8357, 32803, 10620, 16587, 17174, 11889, 16766, 9351, 0, 8912,
+    12814, 0, 10883, 9614, 0, 12431, 11871, 13136, 12921, 28691, 12618, 12468, 17332, 12813, 0, 16736,
+    0, 8758, 17160, 12718, 28720, 20486, 0, 0, 8612, 28693, 8396, 4689, 0, 0, 16963, 12499,
+    0, 11628, 12634, 11729, 28746, 0, 8365, 28762, 0, 9919, 8948, 16756, 16686, 8718, 12899, 12575,
+    0, 17150, 12718, 16993, 0, 0, 17388, 0, 17386, 0, 10842, 12432, 12604, 28719, 8948, 12642,
+    12700, 32931, 11141, 12057, 12408, 17309, 4928, 16447, 11142, 9065, 16774, 32882, 28749, 32893, 9801, 17140,
+    9009, 9875, 28750, 11779, 13115, 10759, 0, 6327, 16439, 32830, 6387, 11844, 0, 0, 9646, 20487,
+    8695, 0, 8419, 16684, 12750, 12583, 8396, 8411, 4452, 32931, 0, 11572, 10919, 10626, 12408, 12921,
+    28724, 17008, 28724, 6226, 11729, 9596, 13075, 0, 9540, 16744, 8757, 9595, 12489, 12444, 0, 28810,
+    8255, 12825, 28698, 0, 12666, 20484, 10836, 12814, 11312, 32923, 9247, 12599, 0, 0, 28708, 10460,
+    13134, 4928, 9664, 12548, 10293, 9800, 11033, 4943, 12707, 9050, 0, 28818, 8285, 28788, 32843, 20487,
+    0, 28706, 32867, 12947, 8612, 28736, 32830, 12948, 16518, 8619, 0, 6392, 0, 12858, 11141, 16606,
+    17081, 28717, 5955, 12312, 11778, 0, 0, 12792, 28780, 17298, 0, 12719, 32777, 10352, 6212, 28789,
+    17359, 16852, 8769, 0, 12655, 10563, 9602, 0, 0, 13175, 9838, 16451, 32894, 16519, 13123, 6047,
+    10507, 28723, 0, 9681, 10760, 12814, 12001, 12789, 28688, 0, 28748, 32793, 17219, 9615, 13123, 16440,
+    9815, 28774, 13150, 12355, 8912, 12909, 10853, 0, 16698, 0, 28766, 0, 0, 10110, 0, 0,
+    13012, 11059, 13080, 12815, 0, 32894, 28730, 12610, 12762, 0, 11135, 17150, 11926, 5253, 4336, 17228,
+    12395, 28686, 12825, 12933, 28804, 10507, 0, 12912, 12370, 8695, 28721, 0, 12803, 5399, 12720, 0,
+    28677, 10760, 11329, 0, 32832, 28753, 12012, 28781, 32806, 5312, 12600, 11468, 10207, 28810, 0, 0,
+    32794, 9600, 10507, 10161, 11105, 0, 0, 10264, 13056, 16462, 9316, 28705, 13198, 17141, 8365, 28747,
+    32820, 12814, 12999, 0, 28759, 17071, 4884, 32932, 12751, 16608, 28784, 13030, 0, 0, 0, 12526,
+    13116, 28730, 17220, 9316, 9067, 9586, 12804, 0, 16459, 16450, 12564, 0, 12526, 13114, 10143, 28727,
+    0, 12647, 8358, 8641, 13043, 10234, 0, 16685, 32885, 12921, 0, 12834, 8460, 5405, 12921, 32883,
+    17227, 13212, 17139, 12792, 0, 12372, 0, 32845, 16459, 12466, 17069, 12610, 0, 11358, 16887, 8657,
+    32846, 10758, 9947, 12755, 0, 16528, 8751, 12945, 11972, 0, 17081, 28715, 8657, 12679, 28794, 12900,
+    32819, 0, 10498, 9615, 0, 17150, 0, 12527, 17004, 5482, 0, 9654, 0, 28701, 11358, 12480,
+    28707, 12621, 6410, 28738, 0, 16620, 9086, 12715, 28762, 0, 0, 6046, 10736, 11673, 13064, 12908,
+    11357, 10554, 16685, 0, 11223, 13173, 17219, 8964, 13210, 8397, 0, 28754, 16684, 28770, 11694, 10400,
+    12407, 0, 28680, 0, 12310, 9018, 8489, 8722, 16765, 12659, 9050, 28800, 9563, 28708, 28800, 5397,
+    10805, 32906, 12932, 0, 12049, 12743, 0, 0, 32878, 16774, 12945, 5628, 12828, 0, 28800, 12396,
+    12719, 13052, 8403, 12826, 0, 8480, 9681, 5673, 13222, 0, 0, 0, 10815, 28816, 16834, 10713,
+    12681, 12803, 20481, 0, 10806, 17148, 28752, 0, 12420, 11311, 9020, 28730, 32846, 0, 11105, 0,
+    12779, 0, 12815, 8486, 12922, 0, 13200, 8411, 9919, 8757, 12966, 28777, 6150, 8412, 9986, 13147,
+    32932, 0, 13000, 13042, 17081, 12659, 12372, 28785, 32906, 12859, 28804, 12384, 13001, 0, 12299, 28683,
+    11035, 0, 28822, 12989, 12790, 9009, 10199, 10805, 12621, 13196, 20489, 9001, 8489, 9978, 0, 13188,
+    12743, 5316, 16923, 11711, 0, 0, 12794, 0, 8420, 12717, 28782, 0, 12078, 12455, 5862, 12574,
+    10078, 16912, 10516, 0, 17159, 28762, 12944, 28789, 13175, 28696, 12731, 32846, 0, 11356, 0, 12827,
+    16699, 0, 0, 0, 0, 13064, 32909, 32896, 16924, 12815, 28738, 17004, 10143, 0, 12610, 0,
+    11114, 0, 12491, 32830, 20484, 13188, 11413, 12622, 0, 12732, 28753, 16621, 0, 28769, 0, 12989,
+    11105, 13041, 0, 28728, 17079, 8696, 32820, 0, 8848, 12610, 8765, 12823, 0, 9089, 12527, 17139,
+    0, 0, 9986, 5534, 28762, 0, 6205, 28738, 32846, 13147, 0, 28798, 0, 12491, 12348, 12672,
+    9294, 16774, 32793, 0, 8570, 0, 12408, 6226, 0, 9044, 16608, 0, 0, 0, 17162, 0,
+    28804, 5532, 17117, 9349, 17210, 28795, 16923, 12312, 9647, 16914, 12611, 28747, 8368, 28788, 32793, 32907,
+    28791, 0, 5498, 17411, 0, 0, 28820, 0, 20487, 12396, 28776, 12916, 12923, 11104, 32781, 5865,
+    17220, 16539, 0, 0, 10804, 0, 0, 28712, 0, 5421, 0, 12815, 8898, 12396, 0, 28705,
+    12910, 0, 13176, 16933, 12324, 0, 17082, 17397, 6365, 13020, 12911, 8741, 0, 32923, 32907, 32918,
+    0, 10995, 17239, 28749, 0, 9044, 9317, 16880, 0, 28759, 12911, 17229, 12947, 0, 12533, 9906,
+    12708, 28709, 8412, 8677, 0, 28760, 28758, 10516, 17227, 12691, 28790, 10048, 9363, 13152, 0, 0,
+    11095, 9618, 17328, 12978, 16808, 0, 28774, 28742, 16459, 10404, 12559, 32841, 0, 17069, 12513, 0,
+    32933, 28724, 0, 12490, 17015, 16657, 12978, 9909, 12708, 0, 32831, 12765, 0, 28779, 28742, 9355,
+    17227, 0, 0, 32845, 6260, 10078, 17298, 12923, 0, 0, 9687, 12609, 0, 5536, 17170, 20484,
+    11058, 11977, 12575, 13041, 0, 16858, 10870, 10815, 0, 10375, 0, 8787, 0, 28745, 12924, 17253,
+    9659, 13040, 12608, 12944, 28721, 16922, 12924, 10208, 9363, 12690, 9050, 10206, 0, 16912, 13029, 17053,
+    11694, 0, 16902, 12656, 17348, 20485, 8445, 9564, 0, 11703, 12419, 0, 12669, 9508, 9211, 8775,
+    13152, 8421, 20489, 9563, 16460, 28802, 28707, 9670, 10573, 11412, 9047, 0, 0, 16609, 12563, 5673,
+    28811, 13041, 28739, 32924, 8476, 28691, 10283, 28744, 28769, 17083, 17201, 10285, 13112, 12502, 11355, 32905,
+    32924, 16983, 0, 28800, 11767, 10438, 10563, 12823, 11468, 0, 10189, 11869, 12408, 0, 28714, 10106,
+    8452, 10872, 16698, 9984, 0, 12971, 12477, 9022, 0, 0, 0, 12816, 0, 0, 32829, 10779,
+    12934, 5871, 32839, 17061, 11711, 16776, 0, 12611, 16910, 28729, 28772, 12451, 12609, 0, 12767, 0,
+    13099, 13041, 0, 12727, 8459, 20483, 0, 28745, 17092, 28708, 11413, 0, 10142, 17332, 11267, 6456,
+    13014, 0, 16914, 28783, 0, 9846, 10572, 10215, 13031, 10554, 11712, 10736, 9686, 0, 10750, 0,
+    16903, 0, 28820, 17317, 12417, 0, 0, 16756, 10782, 9545, 13149, 12066, 16619, 10699, 0, 10157,
+    11656, 0, 0, 0, 8467, 0, 32895, 11712, 17148, 16777, 32807, 6260, 11058, 12609, 10459, 0,
+    12696, 17014, 0, 12068, 16597, 0, 17093, 28747, 9609, 11910, 9564, 32892, 9050, 12776, 12454, 6410,
+    12441, 28722, 17117, 10758, 5873, 32844, 9974, 8667, 28825, 5498, 10736, 10143, 32880, 11522, 12720, 12384,
+    9816, 0, 32879, 11078, 0, 12990, 0, 0, 11160, 10696, 0, 12033, 8470, 0, 17239, 0,
+    16935, 10973, 16700, 0, 12515, 0, 0, 13043, 12610, 17218, 12705, 13224, 0, 17227, 12704, 5030,
+    0, 12982, 9078, 13065, 13020, 5361, 9642, 16538, 0, 0, 0, 12800, 12444, 12612, 13200, 0,
+    8766, 12611, 11049, 28719, 12905, 11380, 12708, 32924, 8476, 0, 0, 12715, 11081, 13077, 12076, 5873,
+    32897, 17117, 11610, 12408, 28731, 5886, 0, 0, 12935, 13223, 0, 12901, 12812, 13196, 12574, 12622,
+    28743, 12896, 0, 28740, 11311, 28794, 8758, 17079, 12408, 11451, 32859, 9074, 17060, 28730, 32936, 0,
+    0, 13076, 12979, 28717, 28819, 32806, 8383, 4721, 0, 11711, 32831, 12720, 9823, 11169, 13043, 0,
+    0, 0, 6226, 28789, 0, 0, 28769, 5498, 0, 12823, 0, 8766, 0, 17114, 28763, 12682,
+    13075, 12934, 10862, 12778, 0, 11703, 12384, 17307, 16920, 12444, 0, 10245, 28816, 5073, 28784, 32859,
+    12659, 10274, 0, 10273, 5673, 13014, 0, 8480, 0, 0, 32818, 0, 11411, 16697, 28794, 11161,
+    0, 13128, 12360, 28795, 32857, 9892, 0, 0, 12612, 12444, 0, 10196, 12981, 17003, 5666, 12873,
+    0, 28747, 12624, 12945, 28750, 13164, 0, 5651, 12372, 17211, 32937, 16894, 13163, 0, 0, 28779,
+    28760, 0, 10195, 0, 17388, 12932, 12538, 28786, 9900, 12010, 17299, 11103, 10264, 16991, 32906, 10805,
+    17139, 32841, 0, 28775, 13019, 16767, 9065, 12895, 0, 10838, 0, 17171, 8467, 28720, 11871, 12816,
+    5099, 16918, 32905, 10572, 0, 10211, 13137, 28787, 16447, 16856, 17139, 12634, 10393, 11693, 28827, 12706,
+    0, 9382, 0, 0, 12768, 13020, 0, 0, 13077, 9907, 0, 12312, 12887, 13151, 12491, 5665,
+    8460, 20481, 0, 12716, 10871, 10415, 0, 0, 8322, 12886, 12420, 10485, 16698, 0, 0, 17241,
+    13223, 32780, 5321, 13130, 12300, 0, 0, 16756, 13007, 13030, 0, 17171, 16920, 5885, 12513, 16886,
+    0, 17044, 16765, 28811, 28810, 28755, 12420, 0, 28814, 12498, 5888, 0, 11469, 12897, 17298, 0,
+    5629, 11049, 13162, 11380, 0, 16937, 0, 0, 17052, 12944, 28747, 9817, 0, 10078, 11394, 0,
+    12862, 28819, 13016, 12991, 28774, 12863, 28812, 28754, 12599, 10294, 0, 11729, 28691, 32878, 17015, 13150,
+    12487, 16935, 6100, 10412, 32843, 9899, 28812, 0, 28704, 16540, 12539, 0, 11750, 12715, 0, 17149,
+    8414, 5454, 10758, 12802, 28699, 6365, 28753, 16542, 10427, 12898, 9665, 0, 12924, 11657, 28725, 0,
+    16904, 16920, 0, 12919, 0, 13224, 9610, 9182, 11170, 12408, 28811, 13184, 12924, 32845, 0, 16449,
+    0, 0, 0, 16597, 28745, 10188, 11459, 13044, 0, 6100, 10881, 0, 9202, 0, 9892, 11701,
+    11468, 10441, 28816, 0, 0, 11004, 28812, 6188, 16993, 16778, 0, 12431, 5455, 12700, 12690, 17411,
+    0, 11611, 17307, 6411, 12695, 12994, 9985, 0, 11356, 28738, 11596, 28749, 11012, 16823, 12885, 13065,
+    12755, 28728, 0, 12345, 28773, 11610, 17249, 9075, 0, 10459, 8920, 17241, 17002, 9309, 28747, 12322,
+    9971, 11178, 0, 11684, 12527, 0, 11459, 11348, 12500, 16918, 10213, 0, 12309, 12633, 0, 10449,
+    13136, 28782, 0, 10782, 0, 0, 17148, 5113, 0, 0, 0, 12488, 0, 28808, 17080, 28747,
+    0, 0, 0, 12576, 12943, 0, 12970, 9917, 0, 0, 0, 10108, 16913, 0, 12713, 10283,
+    11012, 0, 12804, 16923, 12647, 10483, 11058, 0, 28738, 0, 10451, 12538, 9619, 11411, 11180, 28759,
+    32930, 0, 0, 28761, 0, 0, 13161, 11566, 9238, 12936, 16765, 28768, 16858, 0, 13161, 0,
+    9900, 28796, 11356, 12742, 28766, 4615, 0, 0, 28801, 9853, 12787, 13116, 10583, 17275, 0, 12659,
+    16737, 32833, 0, 16924, 11926, 0, 17131, 11240, 17249, 12900, 8786, 28744, 28759, 6456, 10750, 0,
+    0, 0, 9681, 28750, 28684, 11947, 16904, 12514, 13020, 12693, 0, 0, 0, 0, 5498, 6266,
+    0, 17126, 11450, 0, 11170, 13063, 0, 0, 4939, 5454, 8470, 10273, 8422, 17250, 12764, 28730,
+    12861, 11460, 11104, 13224, 12610, 17079, 17318, 11394, 12852, 28743, 32845, 0, 28720, 10162, 0, 4609,
+    28747, 11679, 10075, 17308, 16766, 10514, 5651, 17318, 6233, 12501, 0, 13132, 32844, 0, 10274, 17210,
+    5105, 12575, 0, 0, 9515, 12784, 11710, 32891, 10285, 17237, 6059, 0, 0, 28784, 0, 0,
+    12490, 16779, 12885, 9068, 8665, 16990, 11458, 0, 9320, 13212, 11058, 17002, 12478, 13025, 12873, 0,
+    12720, 32930, 12864, 0, 17000, 32867, 32920, 16912, 17306, 0, 28750, 28801, 0, 16921, 5334, 16925,
+    9984, 16776, 11049, 11095, 10207, 0, 0, 0, 12887, 0, 13016, 12634, 10497, 28727, 11710, 13015,
+    12773, 10251, 28768, 5666, 12610, 10584, 12682, 10699, 16542, 6364, 9955, 5068, 16924, 28691, 9715, 28807,
+    12563, 12549, 0, 28729, 6457, 0, 0, 28758, 9675, 32838, 0, 6272, 16570, 12919, 12981, 17353,
+    9564, 11304, 10713, 17211, 0, 0, 9972, 0, 28800, 32918, 0, 4863, 13175, 12550, 12670, 0,
+    6014, 28757, 28721, 5106, 12584, 10743, 0, 10860, 8869, 10805, 28678, 32878, 11303, 28690, 11750, 12432,
+    11701, 9857, 28806, 12741, 28757, 11507, 0, 17316, 32844, 0, 12787, 0, 28730, 11810, 13006, 8487,
+    28678, 0, 0, 9387, 28703, 0, 10709, 0, 12902, 0, 17170, 16922, 12778, 28768, 12538, 12691,
+    0, 6411, 0, 0, 13122, 0, 0, 12586, 11441, 11478, 0, 12318, 17015, 11458, 0, 11041,
+    6457, 0, 0, 12822, 16794, 12441, 10869, 0, 16934, 0, 16490, 0, 12971, 28679, 16700, 17407,
+    13015, 12780, 11151, 11768, 12874, 12655, 0, 11265, 10207, 8322, 9078, 12933, 11180, 0, 12430, 0,
+    6466, 16999, 12356, 0, 16895, 12480, 17131, 12527, 10483, 11178, 11012, 28759, 16982, 32923, 10750, 11168,
+    16953, 0, 13152, 0, 9388, 12705, 12863, 0, 11167, 12695, 10244, 13121, 6144, 28784, 0, 12822,
+    28763, 12608, 13163, 10788, 0, 12670, 10260, 12585, 11768, 17297, 12895, 28703, 0, 0, 12515, 28726,
+    0, 11178, 12669, 0, 32858, 16853, 10203, 8703, 0, 12683, 17127, 28789, 8293, 28755, 12345, 10195,
+    0, 12995, 8322, 9964, 0, 11768, 12695, 28679, 12765, 11478, 0, 12611, 10561, 28727, 28785, 9087,
+    10361, 12539, 17045, 28777, 0, 10503, 10252, 0, 28721, 16766, 5340, 12767, 0, 16887, 17210, 8713,
+    16515, 17297, 11088, 0, 0, 6044, 12880, 28774, 10838, 5105, 12801, 28704, 0, 13131, 5360, 12945,
+    28727, 32930, 13039, 9956, 13133, 4959, 0, 12393, 12824, 0, 28739, 12491, 11479, 5621, 16936, 17071,
+    28750, 16430, 13018, 13008, 12585, 13127, 0, 11947, 0, 9078, 32844, 11467, 13039, 5973, 9064, 0,
+    10495, 17226, 16959, 9687, 12780, 0, 13068, 13007, 12456, 0, 0, 0, 28743, 16777, 12632, 11758,
+    13030, 17410, 10269, 28677, 13076, 32867, 13086, 12321, 11348, 11767, 16529, 13044, 16965, 12779, 10218, 9685,
+    0, 13133, 10211, 12972, 17250, 0, 6447, 12444, 12635, 28675, 32794, 17408, 16965, 13018, 17161, 9973,
+    10137, 13098, 16764, 11467, 13133, 28822, 0, 12802, 10668, 13110, 4201, 20489, 13197, 17015, 12702, 9248,
+    12420, 0, 5490, 12479, 9510, 5628, 12717, 0, 5921, 9141, 0, 28786, 4631, 16833, 12702, 0,
+    11947, 0, 32832, 12001, 0, 5048, 12815, 12919, 11180, 0, 32923, 17306, 0, 12716, 11776, 12681,
+    0, 0, 0, 11759, 28699, 12455, 9972, 0, 8965, 0, 28823, 6016, 0, 13063, 6225, 10218,
+    10405, 13197, 6409, 10116, 8621, 28719, 8920, 0, 0, 0, 0, 0, 11477, 16991, 11947, 4949,
+    10405, 17015, 10967, 0, 13133, 12797, 17317, 10191, 11239, 12681, 9377, 0, 0, 0, 13197, 5498,
+    28680, 12894, 0, 16677, 0, 0, 9620, 12814, 0, 9666, 17316, 0, 11113, 16659, 8295, 12972,
+    0, 12716, 12788, 5591, 12396, 0, 17132, 28757, 0, 28729, 6409, 17012, 10967, 12621, 12744, 32930,
+    11539, 0, 17331, 12887, 0, 9972, 0, 12490, 12766, 0, 16904, 10561, 0, 0, 6044, 0,
+    13185, 17320, 12798, 10276, 11552, 5113, 16920, 32922, 32933, 9377, 9076, 13184, 16911, 0, 9990, 20488,
+    0, 11246, 5651, 28785, 0, 12695, 12492, 0, 32933, 12450, 12960, 8956, 32832, 12561, 9255, 6234,
+    12779, 11749, 13185, 0, 11251, 12391, 12475, 13187, 0, 0, 9310, 0, 12684, 0, 0, 13007,
+    0, 28729, 13086, 11757, 13175, 0, 13008, 28722, 11693, 28748, 8383, 12524, 28785, 13174, 5065, 9002,
+    32816, 0, 0, 0, 28781, 12383, 0, 32832, 0, 28758, 12011, 5628, 32870, 13175, 28820, 12960,
+    11238, 0, 13039, 12694, 10666, 28776, 12452, 12993, 0, 0, 4748, 32896, 13185, 32868, 0, 12888,
+    0, 32867, 17411, 0, 13055, 17410, 17132, 0, 16835, 12330, 13006, 12643, 13175, 0, 10751, 12514,
+    5362, 28809, 0, 28745, 28718, 12814, 32830, 12009, 12632, 0, 28722, 13207, 13114, 4259, 9265, 17053,
+    10860, 0, 0, 0, 13004, 11479, 5455, 9975, 5340, 13007, 6402, 16450, 9862, 28773, 10869, 0,
+    32910, 10570, 9463, 0, 0, 0, 13197, 9601, 0, 17230, 12572, 9003, 11694, 9907, 13173, 6465,
+    28769, 0, 13029, 4683, 12001, 0, 17195, 11821, 11341, 12847, 0, 28747, 0, 0, 12010, 28764,
+    0, 9564, 0, 28798, 12969, 0, 12670, 9076, 0, 12551, 28785, 16767, 13196, 10852, 13086, 16904,
+    28694, 28801, 0, 5427, 8711, 12001, 9687, 5333, 10964, 5987, 10507, 6350, 28794, 10282, 12381, 11656,
+    12873, 11693, 28773, 13125, 28746, 13111, 17219, 8712, 13067, 0, 32884, 11401, 9675, 9067, 11776, 12739,
+    28752, 17151, 11050, 0, 0, 0, 32854, 0, 10279, 28778, 13092, 9311, 10966, 11476, 8920, 0,
+    28758, 0, 9022, 11013, 17169, 28797, 32904, 4955, 10796, 10845, 32885, 5657, 12595, 12696, 13111, 10162,
+    11563, 12777, 11168, 28739, 8949, 9983, 9555, 0, 9676, 10070, 0, 12942, 28743, 0, 28760, 13138,
+    20489, 12909, 10880, 0, 11160, 28785, 12575, 10203, 10553, 12540, 12598, 0, 16835, 9021, 0, 12475,
+    9907, 28757, 12706, 0, 28741, 8412, 9338, 9853, 0, 13197, 12740, 10561, 28691, 0, 0, 10138,
+    11694, 11151, 11909, 8665, 17091, 28732, 0, 9955, 28802, 5440, 32868, 13218, 13197, 12623, 0, 13175,
+    13164, 0, 28758, 28785, 10476, 6117, 0, 12671, 16686, 13208, 12780, 13091, 6350, 10814, 28789, 17196,
+    4630, 12660, 16451, 0, 10460, 10571, 13219, 10654, 16462, 12575, 9265, 0, 12672, 0, 16756, 13152,
+    32884, 0, 9563, 9510, 10640, 0, 10759, 28806, 10507, 0, 0, 12840, 9218, 0, 10269, 12002,
+    28809, 12456, 12515, 0, 17329, 28774, 11992, 0, 9907, 28745, 0, 10264, 10415, 10581, 0, 9982,
+    12622, 28766, 13007, 28775, 12501, 12492, 12359, 12066, 0, 9773, 13015, 9973, 28714, 11450, 0, 9900,
+    28816, 0, 28678, 8621, 0, 32804, 10388, 0, 5444, 11567, 11709, 13020, 16895, 28762, 10232, 0,
+    16835, 28735, 5975, 0, 12000, 12540, 0, 28757, 11160, 28739, 6225, 16924, 9376, 0, 13185, 11013,
+    28795, 17173, 0, 0, 32780, 5566, 12684, 12804, 0, 12936, 0, 0, 16951, 11778, 12943, 10553,
+    0, 8322, 13195, 12499, 0, 13200, 0, 0, 12572, 13005, 11143, 10952, 11766, 32932, 17332, 12790,
+    32920, 13171, 16878, 28797, 28810, 12432, 13091, 28703, 10939, 6013, 0, 12767, 9676, 0, 10638, 12550,
+    0, 17011, 9387, 10649, 28782, 0, 8787, 28717, 0, 16992, 12479, 0, 0, 12994, 11602, 11412,
+    13039, 11451, 0, 0, 10050, 28691, 11640, 28800, 10050, 5806, 8956, 12922, 12672, 0, 9675, 11412,
+    12823, 6051, 13182, 28703, 9087, 0, 28809, 10153, 8491, 0, 8919, 5666, 9618, 28726, 28731, 9957,
+    10386, 12690, 13208, 16737, 5571, 17327, 0, 12536, 0, 9255, 13138, 28758, 0, 11374, 12067, 12515,
+    28706, 11538, 13138, 16446, 28811, 12774, 9211, 0, 17149, 32898, 12780, 6218, 12934, 16842, 32934, 28822,
+    17095, 12456, 11640, 10360, 32934, 12513, 8665, 28716, 0, 0, 28713, 12514, 9891, 12643, 12058, 32893,
+    10482, 0, 12690, 4234, 13183, 10461, 12739, 12691, 10100, 0, 11766, 13164, 10100, 12067, 0, 0,
+    13028, 12908, 9807, 0, 8322, 6140, 0, 9211, 12610, 28810, 16887, 12396, 9955, 10137, 32803, 4323,
+    16924, 16937, 28751, 12444, 5041, 16824, 11656, 9516, 6365, 16824, 0, 28719, 10136, 13039, 28772, 12561,
+    0, 12671, 0, 0, 32892, 16832, 13194, 28739, 32853, 0, 16833, 8650, 10476, 16845, 0, 0,
+    12562, 0, 10217, 0, 12564, 10551, 12886, 12300, 0, 6357, 28751, 28737, 17190, 17296, 0, 17369,
+    12455, 12780, 0, 12824, 28764, 28738, 0, 17148, 8405, 28808, 28698, 12888, 0, 12492, 0, 9918,
+    17305, 9561, 0, 13220, 17308, 13195, 12511, 17080, 12691, 12955, 0, 28717, 12790, 0, 28714, 32818,
+    0, 28823, 28774, 0, 32859, 12550, 0, 0, 10283, 17396, 12432, 32872, 28793, 28714, 8738, 12584,
+    4298, 16697, 0, 28739, 11413, 28788, 12768, 6050, 10199, 13066, 17159, 28736, 11436, 0, 28703, 9263,
+    0, 0, 10577, 5902, 12720, 0, 28751, 17070, 13014, 10507, 12609, 28785, 28756, 11311, 0, 9687,
+    11238, 12076, 12572, 0, 32862, 28796, 12550, 0, 13219, 32844, 8880, 12479, 28806, 16993, 12065, 11466,
+    32932, 0, 9255, 28762, 28757, 13008, 28748, 5041, 12716, 8285, 9066, 0, 28731, 8421, 28774, 0,
+    0, 0, 11545, 12744, 32777, 10587, 12632, 12539, 13171, 10570, 0, 11144, 12909, 10356, 12563, 12504,
+    10275, 12720, 13209, 20485, 0, 28674, 17079, 28675, 12527, 13023, 13052, 12898, 0, 0, 8461, 0,
+    0, 12009, 0, 13195, 11866, 11678, 12477, 16686, 5040, 32880, 17309, 0, 11545, 9350, 0, 0,
+    17236, 17161, 12467, 28771, 17296, 12467, 5113, 12000, 0, 9086, 10144, 0, 0, 0, 0, 0,
+    17274, 0, 6440, 0, 0, 10570, 17326, 32833, 12347, 28691, 0, 11058, 12971, 0, 12919, 12323,
+    16914, 0, 9665, 10751, 13147, 32830, 28809, 5333, 0, 17238, 28824, 12717, 11946, 32910, 12480, 0,
+    12467, 12077, 10172, 11866, 10516, 12545, 6408, 0, 16767, 11939, 12075, 0, 9684, 5894, 28784, 6401,
+    28757, 0, 9387, 11236, 17328, 0, 6116, 10135, 28681, 17219, 10971, 0, 16813, 13112, 12943, 9888,
+    16460, 28786, 8468, 12707, 9686, 12816, 11932, 12875, 17327, 13116, 11103, 0, 12948, 0, 10158, 11742,
+    4980, 11477, 0, 16529, 12667, 0, 11466, 28738, 0, 12882, 28691, 12650, 16828, 0, 0, 0,
+    0, 12418, 16517, 12078, 0, 10240, 12622, 9501, 11679, 10151, 28772, 9862, 0, 9386, 16823, 28714,
+    8949, 12079, 10459, 28824, 8404, 0, 12504, 13126, 0, 12575, 16932, 12851, 0, 11749, 16964, 32827,
+    11268, 12479, 12624, 10538, 13158, 0, 17148, 16910, 13224, 10246, 16932, 0, 28736, 11955, 13138, 32832,
+    10309, 17368, 0, 0, 11894, 0, 0, 8616, 9657, 16598, 0, 0, 0, 13008, 28733, 28762,
+    12701, 0, 0, 12682, 12563, 10343, 12612, 12075, 0, 9077, 5333, 16579, 0, 12564, 12935, 12524,
+    16920, 11435, 13031, 9680, 12672, 0, 0, 12803, 13091, 10207, 32872, 11404, 0, 12692, 6114, 16962,
+    11679, 9182, 13092, 32819, 8964, 5993, 10589, 13090, 5691, 0, 0, 16776, 12359, 0, 28737, 12745,
+    10852, 12786, 9498, 32791, 11333, 32833, 16856, 13063, 0, 9088, 28822, 5332, 28802, 12516, 0, 32790,
+    12478, 12698, 0, 9535, 32894, 0, 8711, 0, 0, 0, 10272, 12754, 10760, 12516, 17274, 17227,
+    28812, 5666, 0, 12906, 0, 13150, 13140, 13008, 0, 16965, 9964, 0, 13183, 9965, 0, 12883,
+    32892, 32778, 8614, 12562, 28685, 17079, 11567, 28739, 0, 28813, 9964, 0, 9086, 12066, 12708, 0,
+    13043, 16925, 32779, 8651, 17148, 10488, 12790, 6123, 13160, 20486, 32905, 0, 0, 0, 28732, 0,
+    9815, 13116, 0, 17396, 11113, 9676, 13104, 12295, 12768, 0, 12779, 12696, 0, 0, 12492, 12849,
+    28823, 0, 28751, 0, 13140, 13171, 32867, 28803, 0, 0, 11435, 0, 9471, 28809, 17315, 11749,
+    8477, 10196, 13219, 12334, 28774, 0, 0, 28803, 0, 6454, 0, 9012, 13219, 32879, 12332, 9240,
+    13221, 13092, 12924, 28824, 12695, 12793, 16620, 10205, 12704, 0, 11632, 12074, 0, 16829, 9900, 10538,
+    17150, 0, 0, 8647, 12898, 13065, 16615, 0, 28749, 0, 0, 11470, 28692, 0, 17012, 17386,
+    13195, 28781, 28735, 11476, 9657, 28746, 13138, 0, 32833, 13139, 17315, 0, 28727, 0, 12539, 12996,
+    20486, 10796, 0, 16992, 12551, 0, 12752, 0, 12383, 5900, 16982, 32898, 8394, 0, 10488, 11357,
+    9318, 12899, 8358, 17079, 9318, 0, 0, 0, 12491, 17016, 12526, 0, 10161, 10240, 11296, 0,
+    13138, 5993, 0, 32778, 4643, 0, 13065, 0, 13031, 16911, 10517, 9089, 12586, 28824, 17319, 12551,
+    9555, 6349, 17014, 32871, 13008, 0, 16450, 12801, 12696, 4445, 11181, 10274, 0, 11436, 11985, 28758,
+    16463, 13014, 16406, 32863, 0, 13019, 16833, 6386, 12791, 28774, 16518, 11537, 10264, 32819, 11902, 32815,
+    13194, 0, 0, 17354, 12813, 12454, 4981, 0, 0, 32893, 12850, 12443, 16914, 17308, 32867, 17081,
+    28693, 10759, 0, 0, 17368, 11459, 28813, 0, 28816, 28707, 28745, 4335, 9367, 28819, 10159, 10319,
+    28745, 9240, 0, 13159, 16587, 13182, 11610, 6410, 17269, 11536, 0, 17241, 9906, 0, 28828, 0,
+    16646, 12295, 16991, 10580, 5099, 8946, 0, 11103, 0, 9909, 11160, 9862, 28714, 10114, 12903, 12491,
+    17252, 5499, 0, 16461, 17289, 12659, 10713, 0, 11946, 6448, 28765, 28809, 28787, 0, 0, 16439,
+    13018, 4726, 10861, 6300, 12706, 28819, 8555, 16505, 28764, 12454, 9817, 16737, 12792, 13032, 28761, 28825,
+    0, 13126, 32793, 12756, 6350, 0, 9301, 0, 0, 28786, 28798, 10153, 0, 12792, 0, 12618,
+    28738, 12694, 0, 0, 0, 13125, 12684, 9673, 12876, 12548, 13138, 0, 16894, 9180, 12444, 13076,
+    0, 28760, 28811, 6463, 12816, 8292, 0, 13171, 0, 32867, 0, 0, 20484, 28693, 28758, 12500,
+    10238, 16779, 20481, 17237, 0, 12924, 0, 0, 28704, 16658, 8313, 12406, 12618, 0, 8421, 28691,
+    28759, 17253, 0, 0, 0, 10255, 0, 8778, 17140, 8407, 4566, 12704, 28810, 12836, 0, 9515,
+    17070, 0, 16933, 28691, 0, 12324, 17061, 10871, 28746, 12906, 17131, 4691, 28734, 16991, 17173, 10199,
+    12552, 12534, 12959, 10107, 12618, 6410, 17170, 13014, 12911, 11939, 9962, 12489, 16439, 4402, 12908, 0,
+    12358, 0, 8319, 0, 5986, 0, 17410, 28787, 13140, 10264, 17327, 11411, 32898, 12468, 9241, 12706,
+    12609, 13128, 0, 10563, 28691, 12899, 28755, 10382, 0, 5106, 12680, 28749, 0, 12503, 28816, 16677,
+    10078, 12694, 12924, 9365, 28821, 0, 9965, 12664, 0, 13067, 0, 28774, 4447, 0, 10114, 16923,
+    32805, 4740, 5986, 12706, 17269, 12527, 8356, 32937, 28797, 11567, 10238, 28825, 10582, 0, 12737, 10573,
+    32870, 28735, 12680, 0, 17148, 16596, 12540, 12587, 13168, 5830, 12898, 12490, 4885, 28828, 10527, 0,
+    32802, 10337, 0, 11356, 8405, 17196, 9915, 0, 32780, 5414, 12898, 13140, 16868, 0, 0, 0,
+    12574, 8319, 32843, 12622, 32859, 16528, 0, 28746, 8612, 13139, 12960, 28702, 8477, 17095, 0, 0,
+    28706, 0, 28804, 32867, 10113, 10199, 9376, 12490, 16936, 9748, 12910, 0, 12766, 0, 4908, 16462,
+    12347, 0, 12550, 17013, 0, 12791, 32870, 17308, 0, 10205, 28731, 0, 12912, 8460, 16839, 16461,
+    12686, 9817, 6466, 10093, 16421, 13067, 17196, 0, 8479, 12492, 4944, 13207, 12879, 9365, 20488, 12789,
+    17132, 11694, 28754, 0, 28820, 17091, 9908, 12731, 10751, 0, 10998, 6188, 13026, 6427, 6113, 13007,
+    12790, 0, 0, 12310, 12552, 0, 12776, 12694, 28764, 12690, 0, 0, 0, 28680, 0, 12898,
+    9357, 32818, 0, 17079, 0, 28799, 0, 0, 0, 0, 28731, 12796, 11567, 0, 12357, 0,
+    0, 9909, 0, 0, 32832, 12514, 8665, 13171, 32917, 0, 32880, 28786, 0, 0, 0, 28749,
+    9687, 28773, 8963, 28674, 0, 6455, 5371, 32930, 11595, 10109, 0, 0, 9373, 28706, 28720, 0,
+    0, 12514, 12610, 11734, 8256, 0, 5984, 0, 6225, 16922, 0, 12900, 12348, 0, 12480, 32872,
+    0, 28796, 28703, 0, 12781, 32923, 12011, 0, 10246, 6293, 12936, 28790, 0, 12348, 12610, 28690,
+    13139, 12880, 28715, 9597, 12464, 9991, 12334, 0, 8422, 11160, 11729, 0, 16934, 9086, 28821, 0,
+    10860, 10853, 12910, 12670, 11769, 0, 32910, 0, 0, 32839, 32842, 28824, 17326, 8376, 10285, 12347,
+    0, 12726, 10582, 0, 0, 16763, 8882, 0, 11977, 10588, 28815, 0, 10217, 0, 12931, 11985,
+    11151, 17385, 9553, 32816, 12515, 10236, 12635, 11459, 8870, 9590, 10143, 0, 12623, 9918, 0, 0,
+    9861, 13184, 10621, 16617, 28731, 32844, 28819, 16992, 0, 17307, 12894, 16616, 0, 28728, 5924, 12075,
+    20484, 12611, 0, 5457, 0, 8701, 11686, 12610, 12564, 0, 16848, 28731, 10182, 10217, 0, 12531,
+    8749, 17140, 8612, 12885, 12624, 16842, 12936, 0, 0, 17070, 6226, 8696, 10674, 0, 9051, 28816,
+    17395, 0, 4664, 8988, 11395, 0, 0, 0, 17309, 6427, 17083, 12055, 12944, 28732, 6145, 13111,
+    17117, 0, 12866, 11632, 17169, 6456, 9175, 0, 10736, 12527, 20481, 8786, 6058, 5395, 0, 8964,
+    12895, 12503, 0, 28732, 0, 9067, 12904, 9560, 0, 12888, 6173, 0, 32778, 10886, 12636, 12880,
+    12696, 32921, 0, 10261, 17320, 17406, 12467, 0, 16621, 12534, 17159, 0, 0, 0, 10880, 11977,
+    13032, 9480, 12902, 16687, 0, 12851, 10920, 13023, 0, 8703, 12479, 0, 11931, 0, 12551, 9309,
+    28733, 8853, 13127, 13140, 0, 28792, 16517, 13146, 32833, 10584, 0, 12492, 12798, 0, 9507, 28732,
+    28722, 11394, 8689, 4864, 12826, 28741, 9306, 12611, 0, 0, 12948, 10161, 11902, 4383, 9802, 11450,
+    10973, 16963, 20490, 11926, 0, 0, 12416, 28773, 0, 12788, 8319, 32828, 32819, 8453, 28738, 6402,
+    8637, 10270, 28721, 0, 12731, 0, 20481, 0, 12368, 9298, 0, 0, 0, 0, 8414, 0,
+    10205, 10524, 13196, 11481, 0, 10217, 28788, 9899, 0, 0, 4722, 11229, 20484, 12503, 0, 16937,
+    32781, 5839, 17169, 12881, 12792, 11844, 12395, 16541, 0, 16507, 32904, 32830, 12732, 0, 28797, 0,
+    17210, 32892, 11179, 0, 9560, 0, 10698, 12797, 12642, 12479, 9974, 0, 13155, 6173, 28827, 9919,
+    12383, 16440, 13026, 0, 0, 12347, 9085, 12524, 11977, 12619, 8320, 12516, 17326, 0, 28815, 10111,
+    28812, 12762, 0, 0, 12788, 0, 12740, 13028, 17196, 12584, 9541, 11480, 0, 9342, 12779, 10144,
+    12478, 11181, 9314, 0, 17306, 17290, 0, 0, 12612, 10343, 11115, 16440, 32862, 0, 0, 0,
+    4668, 5787, 12516, 28738, 0, 16597, 0, 28692, 0, 12012, 16687, 13044, 28757, 17044, 9181, 32817,
+    13210, 12074, 0, 12307, 16579, 5249, 0, 13172, 9919, 0, 0, 12897, 10245, 0, 10673, 9947,
+    12442, 0, 9002, 16980, 8777, 28776, 9682, 13018, 12621, 13162, 9598, 10114, 0, 17289, 28811, 16417,
+    8460, 11401, 28676, 16858, 0, 28785, 32831, 32921, 12528, 12612, 17116, 8350, 12738, 12442, 28819, 10412,
+    0, 12322, 0, 10158, 32776, 9134, 8256, 32922, 9817, 0, 28777, 28810, 28821, 28736, 9657, 13223,
+    12887, 0, 0, 28710, 0, 12545, 12516, 0, 0, 13162, 13209, 0, 0, 17014, 8711, 5614,
+    9862, 8948, 28685, 13030, 0, 12491, 12383, 9906, 8760, 11169, 16430, 9986, 12308, 0, 10153, 0,
+    17316, 28795, 9555, 12612, 5926, 13032, 0, 13186, 6210, 28811, 10149, 0, 4918, 9286, 12874, 10861,
+    0, 11004, 0, 20485, 16933, 12998, 28747, 5614, 17331, 0, 12839, 10592, 9560, 0, 16892, 11096,
+    16448, 28681, 12002, 12368, 16894, 0, 0, 9500, 13044, 11481, 8289, 0, 32845, 13140, 11648, 0,
+    17012, 0, 8695, 9048, 9685, 28675, 28821, 0, 12297, 12333, 12490, 9780, 10267, 32842, 0, 17228,
+    8768, 16816, 9560, 12344, 17139, 12064, 12789, 32832, 12514, 0, 8359, 28718, 17069, 12911, 16754, 12010,
+    10263, 0, 13017, 28692, 8403, 12533, 16832, 16509, 11411, 0, 12466, 13220, 12654, 10515, 9088, 13173,
+    0, 12595, 12696, 12502, 0, 9845, 28707, 17239, 13197, 16451, 0, 32918, 0, 0, 12476, 4924,
+    6189, 8487, 32841, 17174, 0, 0, 28698, 12516, 12558, 32924, 0, 12516, 0, 13054, 8405, 0,
+    0, 28732, 12873, 0, 16779, 0, 32868, 28714, 20487, 16766, 12694, 4644, 17013, 10342, 32778, 10890,
+    0, 12560, 11035, 32872, 12612, 0, 6401, 0, 9983, 12408, 0, 0, 8487, 17069, 10860, 28749,
+    11769, 0, 32794, 11768, 12453, 11894, 4732, 12504, 0, 8285, 10582, 16519, 0, 12933, 17091, 28690,
+    12576, 12512, 0, 32805, 8627, 13218, 9022, 10270, 9182, 12454, 13030, 17012, 0, 0, 0, 0,
+    12009, 0, 16686, 8490, 13029, 13173, 12766, 28693, 0, 12573, 28707, 13208, 10272, 6188, 12608, 28692,
+    12750, 12333, 0, 0, 12501, 9022, 0, 0, 0, 6464, 0, 17037, 9343, 0, 0, 17012,
+    0, 0, 10284, 0, 9540, 0, 0, 0, 0, 0, 28823, 0, 8946, 12906, 12372, 8388,
+    13175, 11956, 28824, 12729, 32845, 0, 9666, 28820, 11380, 28726, 8695, 4722, 32833, 17275, 0, 5684,
+    12992, 12708, 28686, 0, 10151, 13064, 32779, 4894, 0, 28749, 16440, 9018, 4723, 28749, 0, 9598,
+    9816, 11057, 17169, 0, 8656, 0, 28725, 0, 0, 10264, 32845, 12515, 16936, 13160, 28821, 28715,
+    8695, 10214, 10699, 11144, 0, 28776, 28714, 0, 13000, 12344, 0, 9965, 12384, 0, 12576, 16779,
+    28734, 28737, 9687, 12798, 28823, 28756, 12336, 16812, 12611, 28690, 0, 0, 16910, 12492, 17275, 0,
+    8466, 0, 0, 28736, 32781, 10221, 12624, 28749, 10274, 28715, 0, 0, 5015, 28782, 16922, 10997,
+    8752, 12028, 13208, 0, 32872, 0, 12828, 12076, 0, 9846, 13163, 12923, 12396, 11168, 32818, 0,
+    12322, 28734, 12308, 28762, 0, 0, 17384, 0, 11749, 0, 9668, 0, 6059, 10442, 9586, 11596,
+    12010, 13063, 13171, 28734, 12309, 9863, 10853, 12490, 28809, 0, 9907, 12028, 12503, 10586, 16755, 13149,
+    9293, 11711, 12478, 0, 0, 12696, 28749, 12900, 8964, 4940, 0, 28782, 0, 12899, 0, 4638,
+    8451, 10708, 12418, 0, 0, 12504, 20483, 8962, 12511, 16858, 32869, 10050, 12683, 9963, 16528, 13013,
+    11955, 32780, 5124, 32807, 5981, 32793, 0, 13008, 12900, 16874, 28728, 0, 0, 28749, 13140, 4468,
+    0, 5456, 0, 12056, 0, 12605, 28690, 10205, 0, 13008, 12620, 16620, 28678, 9859, 28758, 0,
+    12912, 0, 0, 12572, 16688, 16519, 9751, 0, 16697, 0, 9955, 0, 28770, 10571, 10505, 9286,
+    11267, 11679, 8285, 32924, 17330, 16450, 0, 0, 0, 0, 12984, 13123, 10099, 12492, 12516, 0,
+    10640, 28701, 0, 10838, 0, 12885, 10870, 28776, 9863, 16430, 12510, 28775, 12479, 9075, 10086, 5649,
+    4841, 10884, 10449, 13146, 13172, 0, 16971, 9802, 11013, 16650, 28731, 9946, 13164, 8398, 0, 28691,
+    0, 12396, 0, 0, 0, 17125, 17353, 16806, 28774, 17306, 28680, 10302, 0, 12894, 0, 12480,
+    9655, 12730, 10388, 11208, 28733, 16839, 32870, 0, 17043, 32805, 8647, 16527, 12491, 12585, 28729, 12534,
+    0, 16775, 0, 32846, 16606, 17013, 16579, 17046, 0, 10488, 0, 12575, 12420, 0, 0, 28821,
+    0, 0, 0, 10214, 5105, 8460, 13211, 16674, 10071, 12893, 12546, 10283, 13152, 0, 10460, 12763,
+    0, 13123, 16935, 28747, 12357, 10853, 10284, 9182, 9975, 0, 0, 13020, 0, 32817, 12657, 12428,
+    13026, 8420, 12696, 28681, 28751, 16816, 0, 12028, 10135, 0, 11169, 0, 12683, 12922, 12813, 0,
+    0, 0, 12321, 12057, 28820, 17052, 32831, 13031, 12695, 28678, 28682, 12665, 13140, 8406, 12490, 28798,
+    12742, 28762, 16974, 12551, 12489, 10132, 12666, 0, 11894, 16921, 16450, 12028, 4571, 9670, 12726, 12594,
+    12809, 12862, 0, 0, 9898, 0, 13220, 0, 12527, 8949, 9000, 9508, 12416, 9919, 0, 0,
+    28765, 28734, 9845, 6433, 12598, 9255, 16843, 0, 0, 0, 9294, 16667, 10280, 20483, 28733, 0,
+    8963, 10152, 32844, 32807, 8749, 11334, 11503, 0, 17044, 13156, 6211, 13024, 13223, 0, 16775, 0,
+    9897, 17394, 13147, 0, 0, 0, 28726, 11380, 16528, 10263, 16871, 16459, 12899, 11992, 16834, 12057,
+    17405, 13018, 12420, 4722, 12562, 11005, 8709, 12500, 16650, 32805, 4810, 13183, 0, 0, 5729, 0,
+    32832, 12346, 8480, 28725, 0, 12920, 4468, 13212, 17289, 16937, 10412, 0, 12580, 5455, 8646, 12761,
+    0, 0, 32867, 16756, 0, 12528, 16499, 28809, 16700, 10200, 0, 12863, 12431, 12504, 20488, 16450,
+    12787, 12599, 0, 28819, 9972, 13099, 16858, 0, 4823, 9906, 0, 13068, 13206, 17194, 10198, 12813,
+    0, 28756, 9662, 12489, 5484, 0, 13053, 28749, 13149, 0, 16605, 11894, 28786, 9985, 9679, 28787,
+    13055, 9768, 0, 16965, 12931, 12648, 28728, 13001, 4947, 16837, 11458, 16844, 11215, 10199, 28744, 8693,
+    28775, 12563, 8954, 28819, 13220, 12789, 11436, 12465, 13146, 12078, 9218, 0, 17306, 10246, 12480, 10376,
+    9378, 12309, 28799, 13184, 10071, 0, 32843, 12488, 13164, 28760, 12611, 12654, 28753, 28774, 8965, 0,
+    10116, 16982, 12754, 0, 0, 0, 0, 11573, 28702, 0, 16924, 0, 0, 32831, 12791, 32861,
+    12572, 16816, 8649, 28784, 8368, 8918, 12906, 16699, 0, 12571, 8486, 0, 12631, 11993, 12355, 28716,
+    28747, 28723, 11866, 0, 12827, 13174, 12763, 0, 6188, 0, 13220, 8421, 17140, 0, 28774, 12501,
+    0, 10114, 16764, 13140, 9021, 4463, 16775, 0, 0, 32833, 13065, 12444, 12692, 0, 10245, 9064,
+    0, 28773, 11477, 28750, 0, 0, 12849, 9509, 28777, 17290, 12824, 28774, 8281, 0, 12549, 12778,
+    0, 12910, 0, 9001, 12801, 9975, 32860, 8368, 5614, 8343, 12792, 12612, 16775, 6350, 20481, 12801,
+    32841, 0, 10750, 10277, 12491, 10467, 5021, 13196, 0, 13152, 10217, 6463, 0, 4835, 16685, 28785,
+    8723, 12789, 9687, 32830, 17398, 11459, 11931, 28773, 10251, 16517, 11266, 12575, 28788, 16991, 11338, 32871,
+    0, 12431, 16873, 28747, 0, 6350, 0, 17307, 12297, 0, 9662, 0, 10838, 12871, 0, 16529,
+    10940, 4928, 5254, 0, 11436, 16675, 16932, 0, 0, 8789, 0, 0, 13210, 12499, 0, 32918,
+    10968, 10797, 12789, 16974, 12846, 12538, 10067, 0, 10263, 0, 13154, 16755, 9665, 13139, 12594, 0,
+    9662, 0, 16971, 16854, 12492, 0, 12516, 12487, 13212, 12564, 16462, 12416, 16903, 17386, 17348, 0,
+    0, 13020, 11679, 32829, 0, 11178, 12573, 0, 28679, 9972, 10424, 0, 28759, 8664, 10442, 28810,
+    12655, 32857, 32833, 9947, 12534, 9905, 11049, 16463, 12693, 13032, 17368, 12798, 12475, 5868, 8955, 28758,
+    6021, 28682, 4711, 16766, 16612, 9388, 12514, 10336, 13128, 12956, 8365, 10625, 0, 0, 12657, 8941,
+    0, 9003, 0, 16685, 28828, 9012, 8479, 16744, 12696, 32872, 12798, 0, 11311, 10471, 0, 8994,
+    11137, 12705, 4614, 9862, 12428, 28786, 0, 10796, 10153, 11349, 32842, 0, 5038, 12694, 0, 12056,
+    10159, 12599, 13147, 17171, 5676, 10442, 0, 0, 28823, 8766, 11947, 10871, 12859, 11534, 12419, 10371,
+    28733, 32807, 5686, 0, 5552, 12610, 20481, 8619, 16999, 10091, 12741, 12666, 11087, 8712, 28751, 16898,
+    10029, 12743, 0, 17203, 10443, 16914, 0, 12405, 12850, 17396, 28704, 28748, 12908, 4675, 16450, 5541,
+    0, 0, 13149, 0, 0, 13015, 12534, 10860, 9974, 12442, 10788, 28762, 28786, 12786, 13149, 10072,
+    0, 0, 0, 9009, 12694, 0, 0, 13183, 12451, 12919, 9048, 0, 12719, 13160, 4965, 10924,
+    11179, 12538, 0, 4452, 0, 28703, 11217, 12345, 0, 0, 16675, 12396, 0, 28715, 0, 12552,
+    0, 9256, 10253, 12659, 12408, 5837, 28689, 11946, 5270, 9084, 13171, 11095, 10503, 12695, 28759, 0,
+    0, 12790, 5866, 0, 17270, 32846, 12910, 16605, 0, 12871, 10285, 12048, 10468, 16766, 0, 9671,
+    9800, 0, 0, 0, 12420, 0, 28790, 0, 28800, 8955, 0, 6211, 16527, 12666, 4869, 0,
+    13140, 0, 9051, 8396, 0, 12348, 12514, 9986, 12994, 0, 5621, 9377, 0, 0, 0, 28815,
+    0, 12396, 10039, 0, 16746, 0, 0, 32843, 32882, 11910, 10234, 17169, 12347, 12371, 11087, 8366,
+    32831, 0, 28707, 9844, 5525, 16430, 8350, 0, 12420, 0, 0, 13195, 32820, 32870, 9051, 12604,
+    17275, 12887, 17241, 13040, 28678, 8664, 8322, 9947, 9553, 12479, 28722, 28714, 4694, 5313, 4955, 12334,
+    28815, 13224, 0, 0, 8995, 10253, 0, 12886, 13160, 12300, 32895, 12681, 28751, 4274, 13040, 16756,
+    28816, 28679, 0, 12762, 16766, 9683, 9066, 5884, 12451, 12440, 0, 0, 0, 0, 0, 12475,
+    10626, 28742, 28799, 16895, 6277, 13171, 0, 32829, 11349, 16767, 12894, 0, 9836, 9321, 8405, 32867,
+    32932, 12440, 28816, 16675, 16756, 28773, 13151, 8397, 0, 8710, 10161, 0, 28709, 17396, 8688, 13116,
+    12608, 32871, 28758, 12706, 0, 8788, 32883, 12467, 16777, 12418, 0, 28825, 0, 12813, 13163, 32932,
+    13030, 12704, 28768, 8767, 12384, 11513, 13183, 12675, 5650, 28823, 0, 11233, 0, 0, 6144, 12477,
+    12694, 0, 11300, 16766, 10633, 13161, 8307, 0, 0, 12479, 0, 8720, 32820, 12690, 32854, 13121,
+    12525, 0, 0, 28695, 28767, 11050, 9965, 0, 12870, 16874, 4605, 13111, 16667, 6385, 28777, 28785,
+    32892, 0, 12333, 13219, 12898, 0, 0, 0, 10758, 12996, 10844, 8359, 0, 12487, 0, 9514,
+    12551, 13027, 28708, 0, 11114, 0, 9751, 12801, 0, 10217, 12778, 12480, 8965, 12438, 0, 5499,
+    16509, 13172, 10506, 0, 17398, 0, 0, 32807, 5784, 0, 10280, 16736, 20483, 0, 9838, 0,
+    11955, 28696, 13031, 0, 16895, 9676, 12858, 0, 12635, 0, 12516, 17327, 10559, 28747, 12564, 12957,
+    0, 10517, 0, 32846, 0, 32853, 10039, 16924, 28798, 28759, 28785, 12771, 10562, 0, 0, 13019,
+    32882, 12608, 5329, 12779, 0, 12491, 13150, 9973, 10932, 10786, 28735, 12642, 0, 32832, 9883, 9674,
+    13183, 12786, 28738, 12604, 8413, 9020, 10235, 32845, 28801, 12430, 9801, 12815, 12475, 8695, 12960, 9300,
+    12394, 20481, 10816, 0, 12994, 32779, 4856, 0, 12729, 4932, 8285, 0, 10238, 11477, 11143, 17172,
+    16664, 12500, 28808, 9883, 11240, 16853, 9882, 11387, 28679, 12604, 12984, 8752, 0, 12960, 8711, 17327,
+    9058, 16677, 5254, 12965, 10626, 11246, 12886, 9051, 11253, 32870, 0, 9985, 28797, 12954, 10515, 12779,
+    28714, 12034, 0, 32934, 0, 0, 17002, 12705, 0, 12804, 0, 5878, 11084, 0, 9065, 17141,
+    32846, 10451, 0, 28783, 9509, 13223, 0, 17409, 10714, 17395, 12630, 10751, 12420, 12453, 0, 13076,
+    0, 9308, 11349, 9358, 13006, 6433, 28820, 12526, 0, 12718, 20484, 0, 12706, 11085, 12993, 17038,
+    28749, 28760, 10551, 16440, 28772, 0, 12791, 0, 5754, 12404, 9509, 11515, 28754, 0, 16912, 9365,
+    0, 0, 12511, 10571, 10216, 17272, 9308, 8766, 16608, 0, 0, 32781, 5779, 0, 16973, 32830,
+    28766, 16777, 13125, 5106, 0, 0, 12516, 20488, 5453, 0, 17299, 5334, 0, 4781, 16903, 12605,
+    32790, 12611, 13132, 28775, 0, 16964, 8606, 28827, 10925, 28765, 9593, 0, 5340, 9610, 12846, 9003,
+    9254, 13124, 12443, 9983, 9480, 0, 13042, 28729, 16767, 0, 17327, 12609, 12587, 10131, 12822, 16767,
+    28774, 16696, 0, 28745, 28786, 0, 5891, 12701, 0, 12684, 6090, 0, 0, 16667, 10925, 0,
+    9056, 11647, 28756, 28749, 11357, 13028, 28753, 28789, 28821, 12490, 16528, 12620, 13001, 12814, 0, 10461,
+    8487, 9802, 0, 10998, 12692, 32931, 13006, 0, 16451, 12779, 0, 16529, 9642, 13030, 11357, 16463,
+    12465, 17228, 13039, 0, 28827, 12919, 0, 20484, 28762, 0, 9009, 0, 11469, 12911, 5427, 28712,
+    5813, 28778, 0, 12489, 0, 13140, 0, 28759, 16903, 0, 28817, 17369, 8765, 11978, 12404, 9311,
+    17072, 8955, 5440, 12444, 5582, 16920, 12523, 28729, 16763, 0, 12899, 28731, 8758, 0, 28828, 28782,
+    12429, 13077, 12991, 28679, 12456, 0, 0, 0, 12583, 11403, 9293, 20484, 28678, 28720, 9858, 11523,
+    12075, 0, 32891, 0, 6177, 12298, 12802, 11341, 12515, 28737, 10343, 20484, 13086, 12780, 0, 17060,
+    17161, 0, 12921, 13150, 28790, 12623, 16500, 28719, 16528, 16695, 9550, 12777, 28801, 0, 28759, 12564,
+    10852, 12719, 16914, 12478, 5966, 9891, 17131, 10573, 5536, 12064, 16667, 5778, 0, 9009, 6385, 16992,
+    28730, 32930, 12478, 12001, 16779, 10805, 8404, 8751, 28821, 0, 10095, 17320, 0, 28752, 0, 16914,
+    12655, 0, 0, 0, 0, 12671, 0, 0, 9975, 0, 10414, 12823, 12525, 17211, 4621, 0,
+    10246, 0, 11978, 0, 8452, 12921, 9907, 9808, 28785, 0, 28753, 0, 0, 16451, 16667, 12816,
+    0, 32807, 6095, 12772, 0, 5455, 0, 0, 0, 16993, 11539, 12885, 10216, 12612, 28717, 13005,
+    11572, 11648, 32936, 12600, 0, 0, 32820, 32831, 32856, 0, 12889, 28773, 8620, 0, 5491, 17407,
+    10273, 0, 17162, 0, 16895, 9815, 0, 13147, 32937, 12719, 12576, 5965, 10544, 0, 0, 12780,
+    12706, 32819, 0, 17083, 11151, 12815, 12504, 0, 11341, 0, 8350, 0, 16525, 0, 12684, 0,
+    0, 13020, 0, 12564, 0, 16777, 0, 12382, 32857, 16463, 0, 12957, 12873, 10451, 32859, 9551,
+    0, 28753, 28786, 12444, 11403, 17211, 10498, 32872, 32791, 12767, 11517, 12539, 28690, 16914, 0, 0,
+    0, 12990, 16993, 6181, 16778, 12538, 16925, 13132, 16463, 16438, 0, 8420, 12719, 0, 10261, 12869,
+    0, 11304, 28774, 10544, 13068, 0, 28785, 10713, 20483, 28745, 17131, 9551, 0, 11115, 12335, 9559,
+    0, 12767, 6288, 12814, 0, 0, 12379, 12513, 16686, 10758, 17227, 12382, 28773, 11413, 12442, 28716,
+    13090, 9896, 9293, 16935, 0, 28732, 6225, 16439, 17226, 10208, 10272, 32829, 10581, 12815, 32936, 12978,
+    17052, 32884, 0, 12582, 12609, 13136, 12876, 32831, 12492, 0, 0, 0, 20487, 0, 0, 5674,
+    17230, 16922, 28794, 0, 12826, 11909, 0, 12612, 0, 12910, 12720, 0, 5908, 17274, 28678, 0,
+    10255, 9009, 32844, 9084, 12731, 0, 9377, 0, 12620, 8453, 12430, 13052, 11096, 12431, 32921, 9358,
+    5243, 13055, 0, 0, 28716, 12886, 16903, 12444, 0, 32804, 4529, 12696, 12645, 12612, 0, 8751,
+    17169, 12557, 13150, 9066, 0, 0, 17327, 9374, 0, 28799, 11152, 17131, 0, 13133, 12534, 13176,
+    28790, 0, 28727, 12609, 0, 0, 0, 28695, 0, 32833, 16719, 16776, 13043, 17148, 11545, 10789,
+    0, 11551, 9317, 16461, 12516, 12931, 16463, 0, 28736, 28732, 16463, 32841, 9140, 28731, 17090, 17162,
+    0, 11057, 0, 0, 5113, 0, 12420, 9685, 12336, 11058, 9384, 0, 12944, 9675, 32833, 0,
+    28676, 9946, 0, 0, 8470, 28791, 28802, 28699, 32919, 28721, 16497, 0, 12593, 12708, 13054, 0,
+    11481, 10505, 12516, 5966, 32804, 8311, 10281, 0, 10713, 9175, 9364, 0, 5900, 5540, 10436, 12886,
+    10255, 17001, 6321, 0, 6394, 13067, 12630, 0, 0, 5212, 0, 0, 28730, 16777, 32832, 9973,
+    28724, 12516, 0, 9555, 28702, 13187, 12893, 0, 10162, 12564, 17239, 12551, 0, 5245, 10881, 17014,
+    0, 16426, 28728, 5540, 13067, 0, 6226, 0, 28745, 16527, 9936, 0, 0, 16621, 9973, 17083,
+    13054, 11656, 12312, 11088, 8948, 28755, 0, 12954, 0, 8853, 32832, 13019, 17079, 32937, 12383, 0,
+    5048, 0, 28809, 0, 32885, 4613, 32937, 0, 9610, 12899, 17249, 11401, 12407, 0, 28779, 12803,
+    0, 8994, 13133, 0, 9057, 8276, 6386, 0, 11414, 9387, 12621, 17162, 32817, 0, 12347, 28732,
+    6176, 8320, 16924, 12935, 28713, 16922, 28797, 11769, 0, 6288, 28688, 0, 0, 0, 16462, 0,
+    16596, 0, 9981, 10514, 0, 0, 9373, 11656, 12647, 0, 10916, 0, 11112, 0, 0, 9908,
+    0, 12942, 12611, 13052, 0, 9559, 28811, 0, 12620, 8461, 12719, 12670, 28796, 12455, 0, 9074,
+    32910, 13039, 11180, 32830, 9084, 10573, 28729, 5993, 0, 5541, 9067, 13075, 12684, 8330, 0, 12346,
+    28810, 0, 28708, 28810, 0, 17317, 28723, 0, 9618, 32910, 17003, 5665, 9940, 12408, 17210, 0,
+    13032, 28804, 0, 10789, 9074, 13042, 17211, 20481, 0, 16975, 28769, 9349, 28776, 9544, 5415, 0,
+    10216, 4865, 13050, 28727, 10804, 12300, 10872, 0, 13144, 0, 0, 0, 10805, 13020, 0, 11356,
+    5491, 0, 0, 10284, 0, 13089, 0, 0, 0, 8356, 28779, 32833, 16597, 12611, 17173, 0,
+    0, 0, 0, 9086, 28797, 12587, 12936, 9923, 0, 17001, 0, 16933, 17316, 32858, 0, 17236,
+    12394, 32879, 0, 9316, 5799, 32779, 5013, 5877, 0, 32828, 12768, 12075, 12779, 12540, 12815, 17217,
+    28682, 16911, 12900, 9620, 16778, 12936, 9474, 13079, 0, 12828, 9355, 12707, 28698, 0, 13041, 16698,
+    0, 12420, 17297, 6123, 9975, 0, 6128, 32872, 12322, 0, 32846, 28769, 0, 12371, 0, 0,
+    0, 0, 32908, 0, 12562, 0, 12378, 11394, 17012, 8775, 9474, 12696, 9075, 0, 11012, 12510,
+    12814, 16978, 0, 8766, 13063, 0, 12642, 0, 16649, 13051, 28791, 12943, 9181, 13032, 11678, 17069,
+    0, 32833, 16683, 28791, 12923, 28723, 10804, 16913, 28750, 0, 12708, 13055, 16806, 28712, 0, 5212,
+    11160, 11640, 12966, 0, 17148, 0, 32790, 0, 0, 0, 28692, 9620, 12931, 17095, 20486, 5665,
+    16925, 8787, 28735, 8695, 9854, 12993, 11700, 12432, 28698, 12405, 13066, 8878, 16904, 0, 8918, 9449,
+    0, 0, 0, 32842, 11467, 6059, 0, 12768, 5075, 28745, 32919, 5725, 0, 9917, 28750, 12682,
+    17236, 12578, 16416, 0, 12750, 28749, 13175, 28819, 0, 13162, 0, 5196, 6099, 12405, 9356, 11001,
+    12857, 12876, 12654, 8306, 12467, 12476, 16779, 12511, 9540, 12935, 28773, 10233, 0, 0, 11610, 16500,
+    9940, 12540, 0, 11702, 10066, 12911, 13150, 8609, 0, 0, 12738, 10338, 4868, 16984, 32814, 12372,
+    11978, 11694, 8911, 16870, 12606, 28690, 5665, 10243, 0, 0, 0, 0, 5658, 16725, 28685, 12996,
+    32832, 9779, 11394, 4554, 28724, 6464, 0, 0, 8656, 0, 12348, 11694, 6234, 0, 8994, 16596,
+    12943, 11042, 9770, 17079, 12420, 0, 32778, 4579, 28700, 0, 12970, 10285, 0, 12689, 0, 12512,
+    12489, 11610, 0, 28769, 0, 13161, 16542, 10563, 16449, 0, 12688, 32904, 12383, 0, 0, 9057,
+    0, 13144, 6316, 28785, 9619, 13042, 12465, 13078, 9986, 12816, 8882, 0, 12608, 12429, 0, 28732,
+    5021, 17238, 13032, 16698, 0, 0, 12750, 8256, 32805, 8337, 17320, 12919, 16902, 8357, 16595, 13125,
+    0, 9489, 11897, 8452, 0, 12696, 13163, 9078, 12897, 0, 9540, 10872, 9470, 11012, 0, 0,
+    13163, 5658, 32779, 8644, 10872, 16440, 12429, 0, 9651, 16824, 12075, 8766, 28749, 11451, 12838, 10750,
+    0, 12480, 0, 28722, 28784, 12731, 6272, 16447, 28738, 11610, 0, 10514, 11181, 13151, 11603, 17369,
+    5394, 0, 16516, 0, 16463, 12573, 0, 11103, 0, 12298, 8656, 17094, 12638, 16935, 8918, 0,
+    12671, 12785, 16438, 11767, 0, 0, 13140, 10998, 0, 0, 0, 8786, 12700, 10796, 12510, 13011,
+    0, 0, 9450, 10572, 10570, 28684, 0, 13007, 12478, 16587, 0, 0, 11273, 0, 28785, 12298,
+    11815, 0, 28773, 0, 12580, 17251, 0, 9068, 0, 0, 11169, 16806, 32872, 5658, 10027, 10304,
+    8476, 16880, 10497, 28782, 4641, 0, 0, 10048, 0, 17203, 12738, 0, 11775, 9451, 16672, 11042,
+    8357, 0, 16500, 12432, 0, 0, 16675, 0, 0, 5113, 16579, 0, 12524, 17290, 16808, 28715,
+    12300, 13075, 10285, 0, 11450, 0, 6218, 12600, 8452, 11610, 28758, 0, 9518, 4983, 0, 11603,
+    10151, 13173, 12888, 28772, 6456, 9652, 4556, 16811, 17249, 28808, 9376, 11709, 0, 16500, 0, 32778,
+    12733, 32817, 0, 28728, 13116, 16756, 0, 12492, 11374, 20486, 8908, 16935, 12643, 0, 12684, 16885,
+    13007, 11095, 17306, 4582, 8452, 12690, 0, 11711, 12525, 12787, 10160, 9383, 0, 10882, 10027, 11459,
+    13137, 9203, 0, 5367, 13078, 8946, 8911, 28737, 0, 9653, 9211, 9051, 12607, 12379, 0, 28727,
+    0, 17307, 16823, 0, 16429, 16965, 0, 0, 32845, 9660, 12919, 28809, 6181, 0, 0, 28715,
+    0, 20486, 4673, 12632, 11946, 16460, 0, 11693, 32791, 10882, 13224, 28769, 9586, 11939, 28797, 10804,
+    28703, 8919, 0, 10268, 13127, 32833, 16872, 28734, 8403, 17158, 13161, 28796, 0, 32790, 12838, 6427,
+    11451, 10813, 11459, 13043, 0, 12384, 9816, 28748, 11655, 0, 0, 12930, 0, 4408, 28759, 0,
+    28721, 12644, 4808, 11159, 11268, 13110, 6226, 28698, 9960, 10030, 0, 16684, 8702, 0, 8642, 11590,
+    12587, 9203, 28749, 0, 12451, 16438, 12467, 28706, 32869, 12786, 0, 12478, 28765, 12739, 16992, 16820,
+    8965, 11779, 16517, 0, 28708, 0, 16858, 13208, 11700, 13157, 12997, 13020, 0, 28738, 13056, 28773,
+    17237, 0, 11179, 0, 32780, 5116, 32805, 11218, 10376, 32862, 9372, 0, 12311, 17251, 28814, 28727,
+    8348, 16765, 12702, 10057, 5400, 0, 13148, 10972, 9418, 0, 6181, 13137, 9773, 17174, 4927, 11159,
+    28706, 16902, 6058, 17158, 28824, 0, 17061, 9797, 6051, 12765, 12331, 10672, 12824, 4938, 0, 9586,
+    20488, 0, 0, 32919, 11167, 11112, 13127, 6365, 12478, 10073, 5259, 0, 11477, 28812, 16824, 0,
+    13157, 32830, 0, 5253, 12561, 16911, 11013, 0, 16494, 16609, 28789, 5362, 10538, 0, 12573, 28690,
+    8411, 8918, 28721, 28677, 10144, 0, 0, 0, 12706, 12777, 12395, 8366, 0, 13148, 12744, 8702,
+    28747, 0, 8994, 10161, 0, 12924, 28817, 16536, 0, 8665, 11179, 32833, 11272, 0, 13164, 32805,
+    8348, 12610, 13068, 12886, 0, 10488, 9686, 0, 9907, 17315, 10046, 32859, 5253, 0, 5313, 32778,
+    4480, 0, 9241, 12693, 13151, 0, 0, 13188, 28703, 12977, 0, 12768, 12369, 11514, 5993, 0,
+    0, 16675, 17320, 0, 17250, 16934, 0, 5406, 8403, 0, 17140, 12384, 12576, 28758, 28811, 10970,
+    9286, 11159, 0, 28772, 0, 0, 12539, 10553, 12514, 32892, 13111, 0, 9382, 0, 16839, 0,
+    11450, 5628, 9956, 11478, 0, 9836, 0, 9863, 0, 13149, 0, 17289, 16937, 0, 32777, 10629,
+    13185, 10580, 16538, 32845, 0, 9862, 0, 10502, 16991, 11777, 10441, 16609, 12802, 16766, 10151, 28811,
+    0, 28678, 0, 9661, 17289, 0, 12684, 0, 28772, 0, 0, 12767, 0, 13110, 10194, 13163,
+    10969, 0, 28690, 9003, 13074, 32818, 0, 6277, 28730, 0, 28723, 12475, 0, 9328, 12972, 10883,
+    28775, 28756, 0, 0, 28802, 12500, 12440, 0, 0, 11410, 0, 16431, 11450, 16779, 0, 28827,
+    12912, 16756, 28732, 0, 28736, 11817, 16982, 12694, 0, 0, 12490, 12404, 11767, 9480, 10282, 0,
+    0, 0, 0, 0, 12299, 9853, 9913, 16598, 0, 28774, 0, 28781, 12311, 6233, 9616, 8712,
+    13184, 0, 0, 8954, 0, 0, 10162, 8458, 32916, 0, 8987, 12612, 28764, 32911, 28721, 28769,
+    8396, 12489, 28681, 12897, 12515, 9676, 12884, 28749, 28702, 12348, 9802, 12666, 6401, 16766, 16606, 11478,
+    32921, 9382, 10043, 10508, 5956, 16765, 28821, 0, 28798, 13074, 12780, 28792, 0, 11457, 5322, 12323,
+    13151, 9917, 16992, 13187, 11387, 32843, 16832, 32867, 0, 9217, 16616, 16449, 16517, 12475, 32868, 4376,
+    0, 32805, 11207, 12444, 12801, 11572, 9065, 12491, 12416, 0, 28748, 10488, 17140, 9382, 0, 13068,
+    0, 11946, 10545, 6364, 17070, 0, 32807, 11816, 12978, 0, 12602, 12790, 12791, 28730, 11450, 12704,
+    17053, 0, 11686, 13186, 8411, 0, 12654, 12451, 12716, 12905, 12684, 13113, 10341, 17090, 28718, 32881,
+    12678, 13068, 10584, 12576, 6401, 16934, 10090, 17132, 0, 9666, 28769, 16507, 0, 0, 28698, 10203,
+    28765, 0, 12876, 17140, 0, 13074, 12896, 16579, 10284, 0, 12695, 0, 28678, 6401, 0, 0,
+    32870, 12834, 9956, 9806, 0, 20487, 12467, 12875, 8470, 28775, 32869, 17174, 0, 12395, 12812, 28745,
+    4458, 17269, 13208, 28808, 10878, 0, 6020, 12418, 28796, 12648, 28748, 32924, 12944, 32879, 11476, 32831,
+    12056, 0, 28825, 10035, 16922, 0, 16921, 17196, 0, 20482, 11819, 12845, 12415, 32921, 9073, 5253,
+    4622, 16462, 12669, 0, 0, 12780, 12431, 28739, 11058, 32880, 32817, 10415, 0, 16874, 28731, 32936,
+    11765, 0, 10460, 10285, 16765, 10164, 10282, 28732, 9773, 0, 5813, 0, 8613, 13163, 17354, 28815,
+    12455, 5651, 11385, 12825, 12774, 28826, 12572, 9480, 0, 16756, 9751, 12768, 0, 0, 11104, 0,
+    6447, 13112, 10124, 12612, 17410, 32807, 5872, 0, 12800, 11750, 12455, 11758, 17296, 28702, 11777, 0,
+    9247, 10624, 16763, 20490, 13172, 13211, 0, 11777, 12479, 32919, 0, 12369, 12920, 10580, 12780, 9840,
+    28722, 0, 0, 5406, 12429, 12074, 32917, 0, 13198, 17247, 32936, 12754, 0, 11171, 6020, 20490,
+    28707, 32831, 12909, 12548, 13006, 11756, 12618, 0, 17228, 11349, 0, 12490, 32842, 28716, 5614, 12908,
+    13187, 32922, 8701, 16894, 0, 17072, 5563, 8439, 9837, 12864, 0, 9217, 12888, 32832, 9801, 12897,
+    12954, 0, 4932, 12502, 0, 0, 28764, 4869, 12430, 13186, 12732, 12654, 12547, 9210, 0, 6394,
+    32781, 5775, 13210, 16461, 11947, 8365, 12560, 28768, 17406, 11601, 28757, 12419, 16755, 10852, 11466, 12849,
+    11349, 0, 0, 28747, 0, 0, 8397, 0, 20485, 9665, 12996, 16993, 12803, 0, 28709, 12984,
+    8744, 16993, 0, 20487, 28728, 10923, 28803, 8467, 5872, 12468, 6381, 16911, 9850, 17330, 16519, 13150,
+    32918, 32853, 9975, 32844, 0, 12858, 12490, 32846, 0, 12515, 17195, 32893, 12079, 12689, 13198, 5533,
+    6454, 0, 10375, 10759, 0, 13008, 12513, 0, 12516, 8769, 6150, 9262, 9859, 8453, 12562, 5674,
+    0, 28717, 8955, 0, 28723, 12618, 9917, 17331, 0, 17151, 0, 28745, 28721, 0, 13086, 0,
+    17061, 11750, 16894, 9817, 0, 9946, 9254, 11443, 9883, 10751, 13218, 16776, 16693, 8307, 0, 12750,
+    17328, 13147, 12455, 0, 16696, 11412, 10144, 5254, 12372, 0, 0, 11395, 16485, 12533, 12561, 0,
+    13164, 11221, 11947, 16753, 28684, 12560, 0, 5499, 10403, 10460, 16776, 12743, 16765, 0, 28767, 13211,
+    11678, 5254, 12813, 8911, 28748, 9020, 28738, 32923, 32917, 11749, 32841, 16700, 17328, 9671, 12000, 11765,
+    12300, 17070, 32777, 9156, 28721, 13209, 6427, 12870, 12876, 32911, 8467, 0, 16607, 0, 4663, 0,
+    0, 20485, 12943, 8656, 12368, 0, 11349, 17149, 10262, 13001, 28791, 12523, 0, 28757, 0, 0,
+    13172, 28733, 13056, 0, 12682, 8883, 12826, 16538, 0, 8467, 0, 9308, 16658, 13161, 5024, 8650,
+    12761, 8385, 0, 10461, 10415, 32819, 28702, 11450, 32884, 28825, 0, 0, 12455, 11050, 6357, 0,
+    0, 8307, 6181, 16461, 12773, 12502, 0, 28729, 0, 4824, 0, 8584, 11656, 16755, 10081, 17219,
+    13173, 13156, 11611, 12717, 0, 32868, 0, 28700, 5317, 12453, 0, 16823, 0, 12701, 11993, 9086,
+    12001, 8613, 16846, 9293, 0, 12078, 0, 13162, 0, 11766, 12846, 10150, 13040, 0, 17002, 4864,
+    11657, 32855, 10452, 12324, 17002, 11058, 0, 12431, 32918, 8995, 12692, 32807, 5755, 11224, 13138, 16746,
+    28714, 28752, 0, 12478, 17332, 16620, 12900, 0, 9854, 12480, 0, 12467, 12418, 9012, 0, 13222,
+    8748, 13019, 32917, 12682, 8710, 16991, 17080, 0, 12778, 32870, 12012, 12753, 32820, 12455, 9300, 0,
+    12610, 9387, 13008, 17384, 28730, 6094, 0, 12468, 0, 0, 0, 12953, 5666, 17361, 17377, 12526,
+    10116, 16763, 5541, 10714, 32870, 0, 32830, 28786, 8411, 12310, 0, 28689, 5870, 16778, 12785, 32881,
+    0, 10167, 0, 13206, 0, 12407, 4441, 9974, 12870, 0, 0, 12394, 0, 12609, 28787, 32880,
+    11780, 17003, 13025, 16766, 32872, 32854, 12706, 16832, 0, 9564, 12787, 32911, 17330, 28753, 0, 12646,
+    0, 8702, 12826, 12784, 10253, 9861, 0, 0, 10162, 0, 12622, 0, 28714, 16586, 0, 13016,
+    32816, 12582, 10246, 10162, 32935, 12347, 0, 12466, 28736, 8468, 0, 13187, 9439, 4933, 0, 13092,
+    0, 12717, 8612, 0, 10814, 12491, 32781, 5974, 9681, 12454, 32937, 0, 0, 28713, 8450, 12612,
+    9863, 9687, 12480, 28787, 28724, 9884, 28676, 16576, 13008, 4461, 11050, 28737, 28789, 0, 0, 8962,
+    11777, 5316, 28716, 32806, 11506, 0, 12719, 28689, 11395, 0, 16983, 28694, 12384, 5629, 13007, 16696,
+    28786, 0, 28738, 0, 5538, 13138, 10517, 0, 12487, 0, 13207, 0, 28737, 16587, 13211, 12550,
+    13006, 0, 0, 9687, 0, 0, 0, 9452, 10486, 0, 0, 17280, 12478, 0, 11992, 0,
+    12761, 12076, 11480, 9937, 16587, 12604, 16736, 12905, 28821, 10204, 12944, 12393, 0, 0, 32793, 0,
+    0, 16617, 16578, 28828, 28724, 12516, 10544, 0, 17388, 12418, 28749, 0, 16774, 32833, 12419, 13194,
+    0, 12789, 12312, 17411, 12896, 13040, 9908, 8583, 11113, 8411, 28776, 0, 32857, 28823, 16923, 9897,
+    17003, 0, 9956, 28760, 8466, 16859, 12642, 12467, 11297, 0, 13028, 28680, 0, 13188, 0, 28778,
+    5666, 12792, 13063, 0, 12346, 12453, 11349, 28729, 32845, 12595, 12491, 32857, 8758, 0, 0, 11611,
+    28800, 16922, 12730, 12306, 0, 12696, 10071, 13039, 10261, 13123, 9975, 28727, 8719, 12802, 8344, 32775,
+    16861, 32815, 12371, 9955, 9979, 10323, 32932, 12431, 20484, 32905, 32883, 13222, 10132, 32792, 28739, 0,
+    28810, 12718, 4860, 16816, 10264, 12357, 0, 12391, 11611, 12560, 28741, 28720, 8882, 32818, 13199, 8632,
+    16579, 9907, 12516, 0, 16974, 0, 9317, 9551, 0, 9845, 12890, 12970, 12706, 16857, 9851, 0,
+    0, 0, 9452, 0, 17053, 0, 12900, 11775, 16523, 9287, 0, 28731, 12077, 9084, 13121, 9983,
+    17013, 28727, 0, 12959, 16853, 9851, 28775, 12320, 0, 12694, 8752, 0, 10161, 20482, 4410, 12770,
+    6083, 9687, 28749, 9452, 28798, 4490, 12333, 28787, 16508, 16667, 17410, 10516, 12321, 5499, 11648, 28785,
+    0, 32897, 8583, 12382, 12465, 12582, 0, 12575, 16674, 12792, 12908, 16667, 12840, 0, 13128, 28749,
+    17159, 16620, 0, 28737, 6392, 10272, 0, 10269, 17376, 13041, 12405, 0, 28783, 0, 17307, 13223,
+    32854, 0, 12705, 16500, 17071, 16541, 0, 28798, 16463, 9619, 20488, 0, 12990, 0, 12620, 10196,
+    20488, 0, 12612, 12479, 9973, 12405, 12792, 0, 13223, 12743, 28678, 9684, 32819, 28763, 32791, 12704,
+    12802, 12419, 0, 32833, 10515, 8419, 12909, 4572, 11013, 0, 0, 0, 9900, 12444, 0, 0,
+    12419, 0, 11395, 10263, 0, 12420, 12921, 0, 12931, 12395, 16429, 0, 16779, 12790, 8285, 17397,
+    12646, 12815, 28798, 10869, 4827, 0, 0, 16699, 9068, 6084, 28808, 0, 13109, 17228, 20483, 17396,
+    12612, 32805, 9223, 0, 28809, 0, 8358, 11956, 13152, 0, 12920, 0, 28773, 0, 28773, 32934,
+    12620, 0, 17002, 10571, 28782, 5499, 16684, 28778, 12370, 9319, 12772, 13043, 12370, 32883, 0, 6387,
+    6438, 8785, 16924, 0, 12943, 10066, 10506, 11430, 11702, 0, 12297, 0, 12911, 28762, 12935, 0,
+    0, 10860, 0, 12504, 0, 12499, 11312, 0, 16773, 8883, 0, 12771, 13220, 28775, 32857, 32857,
+    12008, 12068, 9779, 11521, 0, 0, 28800, 17377, 13139, 8419, 10571, 28799, 12921, 12707, 12800, 13158,
+    17091, 10061, 0, 17405, 13221, 0, 28707, 12420, 12946, 12981, 0, 0, 13019, 28765, 12718, 13020,
+    28759, 16688, 28820, 9914, 13176, 11992, 8350, 8397, 20485, 10234, 13075, 12811, 13148, 12815, 9777, 12076,
+    12858, 16527, 0, 0, 6299, 16508, 10207, 17250, 13005, 17228, 28774, 9559, 10360, 11170, 16913, 9916,
+    5877, 0, 10563, 12678, 0, 5814, 9947, 11179, 28826, 0, 0, 32871, 0, 12041, 13219, 32830,
+    28825, 12502, 32842, 16746, 0, 32857, 9557, 0, 8583, 0, 0, 0, 13218, 6189, 10498, 28798,
+    17399, 12990, 17004, 13029, 32896, 10880, 0, 0, 6387, 9074, 0, 0, 32846, 10797, 32833, 17014,
+    12671, 12801, 0, 0, 0, 32909, 0, 28789, 10218, 12527, 9952, 28746, 8766, 17062, 4693, 12381,
+    13150, 0, 0, 13042, 12480, 12887, 0, 12465, 11435, 17397, 12825, 28712, 9592, 9939, 28738, 10274,
+    12324, 12934, 12785, 9591, 20488, 32872, 32881, 0, 12523, 17411, 9961, 16430, 10542, 9686, 28727, 8486,
+    28776, 10153, 9321, 0, 12911, 10218, 13133, 16607, 0, 8713, 11380, 9175, 9975, 12875, 9175, 0,
+    11403, 16776, 12539, 32908, 0, 16609, 12432, 12877, 0, 28738, 28693, 28707, 32842, 16621, 28828, 4447,
+    12693, 0, 9919, 6465, 12965, 4676, 12994, 0, 8584, 0, 12064, 0, 6189, 17013, 0, 0,
+    28702, 32924, 28798, 13219, 13140, 17386, 9918, 10562, 28810, 11179, 0, 32832, 5970, 17399, 11734, 16937,
+    12480, 0, 0, 17082, 32871, 28711, 28728, 17139, 0, 12514, 32806, 10471, 0, 12534, 5244, 0,
+    9364, 17141, 28765, 13064, 0, 32843, 17001, 17316, 32843, 16439, 0, 16508, 12549, 12420, 32894, 6349,
+    8912, 5876, 0, 28802, 0, 8390, 12610, 13075, 16754, 12480, 12825, 12383, 0, 32935, 0, 12667,
+    12825, 0, 12911, 17071, 0, 12899, 28785, 12442, 8775, 5245, 16923, 10805, 5968, 5821, 12840, 10517,
+    12501, 11596, 0, 28712, 12682, 12417, 12420, 13052, 6226, 0, 0, 32906, 13110, 5425, 9597, 4630,
+    11902, 0, 0, 12358, 5242, 17306, 0, 0, 28826, 9321, 12900, 16755, 17053, 11459, 0, 9604,
+    8988, 0, 28736, 9605, 28754, 16993, 28782, 0, 13066, 9594, 12773, 0, 0, 12978, 12908, 10252,
+    9204, 0, 13013, 17409, 28770, 0, 16993, 12908, 6099, 28749, 28729, 12492, 9560, 16688, 32843, 28748,
+    10554, 9056, 28749, 0, 12776, 32871, 0, 12921, 32833, 0, 12383, 12919, 9956, 10043, 16983, 16754,
+    0, 17150, 16754, 0, 13151, 12875, 12463, 13143, 12432, 16935, 9262, 32935, 16808, 32909, 28810, 12468,
+    12491, 0, 0, 12763, 0, 11711, 0, 10797, 12624, 12488, 0, 28775, 13018, 10255, 0, 17071,
+    13218, 28754, 12492, 0, 17148, 10260, 0, 12504, 8785, 12995, 0, 8883, 12564, 28810, 32908, 0,
+    6277, 32816, 32872, 9307, 13051, 12900, 12428, 12312, 28738, 12887, 0, 32872, 32921, 0, 0, 12432,
+    11013, 17394, 9964, 13028, 10880, 12911, 9373, 13114, 32936, 12396, 12906, 12678, 0, 9666, 12550, 13064,
+    28715, 10090, 17409, 8490, 11348, 10199, 9560, 9666, 0, 0, 16459, 0, 0, 10853, 0, 11113,
+    17016, 0, 16939, 0, 10870, 20482, 32906, 0, 28734, 28791, 0, 5260, 12442, 12631, 9806, 8350,
+    12900, 10264, 12611, 32909, 0, 12468, 12480, 9619, 13067, 0, 12048, 0, 0, 9564, 28703, 12444,
+    17081, 9904, 28827, 12479, 9552, 17230, 12870, 17410, 16779, 0, 0, 8966, 0, 0, 9965, 12689,
+    12910, 13051, 12898, 11059, 0, 28797, 10573, 12792, 12789, 0, 17375, 13019, 17172, 0, 11481, 12549,
+    12419, 28702, 13041, 17079, 16925, 12432, 0, 12672, 16880, 8774, 0, 6365, 17219, 28742, 12551, 9316,
+    10328, 6365, 0, 13040, 0, 28826, 16619, 13161, 28822, 17094, 10581, 16699, 13029, 0, 13012, 0,
+    17161, 10197, 0, 10216, 9676, 11412, 28706, 0, 32853, 32806, 5248, 12559, 28715, 17240, 0, 28782,
+    11729, 0, 12880, 12444, 0, 13012, 12431, 10263, 11169, 0, 12720, 12490, 32909, 12055, 12895, 9598,
+    13006, 10939, 0, 16517, 16815, 0, 12791, 13184, 28813, 32829, 28756, 16537, 0, 4630, 0, 12654,
+    5424, 32908, 11479, 10090, 11105, 13041, 0, 28814, 28812, 28821, 0, 16744, 28677, 9300, 32792, 28775,
+    9254, 12573, 9255, 12935, 17376, 13063, 6174, 12934, 0, 9909, 12478, 12513, 12079, 12480, 6402, 0,
+    9806, 10813, 9355, 13055, 12360, 9919, 28764, 13043, 12666, 12947, 28703, 0, 28774, 0, 12683, 4625,
+    32805, 4879, 10190, 0, 0, 9516, 0, 16936, 9808, 0, 6277, 8619, 0, 28724, 0, 0,
+    12696, 5247, 32843, 11395, 5248, 12573, 0, 0, 17012, 12347, 8397, 16538, 0, 28746, 10196, 28701,
+    5804, 8285, 8779, 28777, 16857, 17162, 28722, 9913, 0, 4202, 12936, 0, 13147, 5704, 28770, 32905,
+    17003, 32910, 32794, 28756, 0, 13206, 0, 32802, 9141, 12936, 12479, 9900, 28819, 0, 28729, 0,
+    0, 12774, 32911, 12672, 12512, 0, 10078, 32832, 13029, 4885, 0, 17398, 12767, 13115, 12791, 10126,
+    12683, 12887, 28759, 9953, 32833, 0, 32790, 32859, 0, 0, 10263, 10563, 28679, 28691, 0, 12912,
+    0, 9779, 12900, 9686, 16597, 10279, 9386, 17053, 0, 10582, 17239, 28748, 9842, 28811, 28810, 32918,
+    0, 9660, 5674, 0, 0, 0, 0, 28701, 10272, 17407, 16438, 0, 13078, 4885, 0, 11113,
+    32853, 28737, 9983, 12912, 12418, 32897, 12701, 11451, 20485, 10562, 0, 0, 16660, 16426, 16823, 12408,
+    13090, 10422, 0, 13098, 28773, 0, 12882, 9685, 32910, 16697, 10113, 13019, 17162, 0, 17160, 12442,
+    28738, 32858, 12894, 12692, 28779, 32858, 11750, 32820, 16755, 8883, 0, 0, 28738, 0, 0, 28720,
+    10112, 10583, 12487, 0, 0, 13137, 0, 9817, 10883, 13018, 0, 17001, 16963, 17249, 17169, 10144,
+    0, 0, 0, 9772, 13020, 0, 10869, 12396, 32904, 13032, 28821, 32922, 0, 0, 10862, 12603,
+    12900, 0, 5772, 10441, 11152, 0, 12797, 11803, 16596, 13020, 28702, 0, 12610, 12707, 12700, 12395,
+    9323, 16459, 9676, 28702, 8460, 16459, 0, 12334, 12624, 0, 28749, 0, 0, 8397, 12408, 0,
+    13079, 28738, 10584, 12788, 32855, 28679, 12372, 0, 0, 0, 28745, 0, 0, 8919, 28812, 0,
+    10573, 32830, 0, 11451, 12534, 11972, 12503, 13174, 12551, 8331, 0, 28687, 0, 11910, 16913, 0,
+    28746, 28786, 28745, 13055, 12982, 5270, 10161, 32814, 9019, 12718, 12489, 32884, 28737, 0, 0, 0,
+    0, 12372, 28725, 0, 0, 12894, 16667, 8485, 28725, 11411, 10572, 16647, 10148, 12427, 17171, 17329,
+    13041, 16650, 16695, 0, 13145, 12562, 12372, 17093, 12935, 12739, 0, 28721, 12720, 28737, 16779, 16700,
+    12726, 0, 17375, 28767, 0, 16935, 12996, 9985, 16688, 11403, 13065, 28797, 12441, 0, 17241, 0,
+    12847, 12803, 12796, 17172, 9181, 0, 28695, 0, 12428, 13160, 28755, 0, 16934, 0, 10554, 12750,
+    13218, 10814, 10612, 13139, 13076, 13052, 12828, 28814, 28678, 9309, 0, 28813, 9684, 28814, 28815, 10282,
+    32880, 10285, 11656, 16753, 12750, 0, 32859, 28788, 0, 12990, 16429, 11910, 28723, 28815, 10078, 12933,
+    12309, 9801, 0, 28740, 28732, 12910, 12309, 32919, 16753, 13101, 0, 12563, 12443, 16893, 9986, 0,
+    0, 0, 12792, 0, 0, 0, 16904, 13042, 0, 28748, 9247, 12608, 12900, 10181, 0, 11297,
+    0, 0, 0, 8656, 0, 13098, 28821, 0, 12420, 8320, 20486, 16902, 13079, 10039, 0, 28717,
+    28772, 0, 12492, 12431, 0, 16676, 20485, 17320, 16518, 16976, 13052, 0, 28789, 0, 11713, 28803,
+    10582, 12624, 10285, 10284, 32859, 11713, 0, 13079, 12503, 28790, 12604, 0, 12904, 11470, 16459, 9985,
+    0, 28801, 0, 0, 0, 11113, 10910, 0, 0, 28763, 9300, 5025, 0, 0, 0, 16921,
+    9985, 10372, 0, 10153, 28730, 11702, 12693, 13163, 32870, 0, 11910, 11171, 13042, 5409, 8963, 12444,
+    12900, 12336, 13172, 12444, 12523, 0, 28776, 28763, 28796, 32844, 17237, 10626, 4744, 9051, 17307, 8649,
+    5673, 5099, 4799, 6364, 13151, 0, 10052, 0, 12501, 0, 0, 13000, 13075, 12862, 13000, 32872,
+    0, 12452, 0, 28736, 9552, 13079, 10782, 8245, 0, 28710, 0, 12636, 0, 0, 12716, 28757,
+    32872, 13012, 0, 12716, 8584, 4930, 16775, 32871, 10190, 0, 32910, 10871, 5025, 10554, 17405, 28706,
+    9985, 0, 28697, 12754, 12484, 12359, 11817, 0, 12545, 0, 5262, 28694, 12619, 10583, 10861, 6448,
+    0, 0, 0, 0, 5814, 0, 12394, 28730, 17095, 12464, 13134, 11160, 11947, 0, 12936, 17061,
+    13014, 12427, 9364, 0, 28796, 0, 12681, 13151, 0, 28762, 0, 0, 4619, 0, 12780, 0,
+    0, 10107, 12729, 16767, 9905, 28748, 9467, 12696, 0, 10506, 11223, 12834, 0, 12499, 32830, 0,
+    12816, 11701, 17092, 12716, 13000, 17320, 11818, 12849, 5075, 13157, 10675, 28740, 11633, 13075, 16767, 32868,
+    0, 9918, 20485, 28787, 9083, 10572, 32833, 0, 10051, 12504, 12604, 5269, 8311, 13163, 12600, 17171,
+    16775, 0, 12479, 12476, 0, 16777, 13148, 12812, 28803, 6402, 10406, 9974, 17241, 0, 0, 17319,
+    10150, 0, 28688, 13068, 0, 9884, 32828, 8404, 11222, 16992, 28814, 28700, 6233, 10925, 20490, 16936,
+    16676, 28813, 11768, 11702, 13162, 13156, 0, 13122, 13032, 28766, 9884, 10626, 12718, 9854, 13173, 0,
+    0, 11104, 0, 17140, 0, 0, 0, 12490, 9384, 28718, 10272, 17070, 0, 0, 0, 0,
+    28768, 13150, 0, 10282, 0, 9546, 12380, 28730, 12077, 12480, 9382, 9509, 12552, 0, 9382, 12366,
+    0, 9001, 8403, 0, 32864, 16666, 0, 12802, 0, 10862, 8628, 12933, 13115, 32883, 10974, 0,
+    12612, 28709, 12979, 8543, 17297, 0, 12420, 16745, 12502, 12384, 12444, 12491, 0, 8452, 32832, 32893,
+    28814, 17252, 12477, 10284, 12790, 8424, 28803, 0, 28813, 0, 28812, 16517, 0, 0, 12924, 28685,
+    20484, 10584, 0, 11470, 32911, 0, 9914, 13144, 8918, 16968, 0, 12358, 0, 8710, 0, 5317,
+    0, 0, 0, 16901, 8994, 10374, 10406, 10066, 9916, 5026, 4678, 16523, 0, 17091, 0, 10925,
+    17002, 8687, 16937, 0, 12490, 32921, 0, 11805, 9858, 28701, 11459, 0, 0, 13161, 12812, 11268,
+    9809, 12693, 4727, 13091, 9779, 0, 28774, 4489, 12900, 28720, 13077, 0, 0, 28700, 0, 0,
+    12619, 10282, 0, 6465, 28693, 11137, 11467, 32898, 16887, 28813, 13149, 16529, 28702, 17171, 12323, 0,
+    9670, 16699, 9546, 0, 0, 8420, 0, 9941, 0, 10237, 17252, 5367, 10376, 13080, 0, 16598,
+    12056, 8752, 12886, 16687, 10484, 11534, 32832, 32831, 20490, 9916, 12371, 28758, 12442, 28774, 13014, 13172,
+    0, 12696, 0, 10185, 13187, 12622, 10199, 0, 12778, 0, 10882, 12936, 28691, 12702, 10805, 9618,
+    0, 28813, 0, 16439, 0, 12990, 0, 11481, 9814, 12791, 0, 16587, 28768, 12702, 11395, 10879,
+    12797, 13056, 17298, 12764, 12823, 13044, 12887, 0, 28825, 11534, 12792, 28774, 28751, 0, 28751, 5823,
+    13013, 10880, 12478, 28682, 28749, 0, 5026, 12465, 28731, 0, 10460, 17252, 10443, 12788, 0, 10405,
+    12001, 13176, 32779, 4739, 28696, 12633, 32792, 13183, 12707, 0, 9364, 16619, 0, 32863, 0, 10405,
+    11932, 12466, 17320, 17071, 12359, 9979, 17095, 13156, 4982, 12657, 10208, 0, 28714, 32930, 13030, 16677,
+    17000, 20490, 12476, 10583, 12490, 0, 0, 12693, 12477, 9610, 10584, 17001, 32931, 0, 0, 11758,
+    12371, 17410, 0, 11470, 0, 0, 0, 9909, 11596, 12454, 0, 12336, 20486, 10226, 12693, 12416,
+    12634, 12430, 17159, 28809, 11468, 28814, 12479, 28731, 12728, 9317, 12787, 28701, 0, 13163, 12693, 28757,
+    12897, 12683, 0, 6448, 0, 13152, 0, 8949, 9009, 32793, 9942, 0, 8480, 13005, 0, 16990,
+    32923, 28754, 5196, 12419, 16982, 0, 0, 10415, 28718, 12478, 11181, 4725, 28770, 28789, 16981, 16969,
+    9899, 0, 0, 10213, 16460, 28674, 28714, 0, 16904, 17113, 12789, 10516, 12418, 28731, 5491, 10522,
+    28753, 8452, 32859, 0, 32818, 17328, 4468, 28799, 9577, 10208, 17174, 0, 0, 28689, 9066, 0,
+    9917, 17039, 12514, 12454, 13004, 20487, 12790, 0, 0, 28679, 13031, 16756, 11223, 0, 0, 9916,
+    28738, 28704, 13056, 12812, 0, 32918, 9909, 16620, 0, 11479, 0, 0, 0, 0, 12360, 9854,
+    0, 16756, 32881, 10098, 11035, 6410, 0, 0, 13152, 12910, 13186, 13174, 12478, 17410, 13174, 12502,
+    0, 10543, 17253, 28815, 28819, 0, 16617, 0, 12619, 9961, 28754, 9970, 9982, 0, 0, 0,
+    12575, 32858, 12371, 17230, 12966, 12576, 12898, 0, 16923, 12502, 11758, 11042, 13121, 12524, 13042, 0,
+    13176, 28765, 9839, 10216, 12420, 28696, 32856, 28813, 11633, 5318, 12752, 32862, 12623, 0, 13174, 13186,
+    0, 0, 16923, 13134, 28745, 28773, 12791, 8432, 11776, 12348, 16991, 12574, 16617, 0, 12526, 0,
+    13186, 13163, 12299, 8489, 17016, 32918, 32831, 12720, 16921, 0, 12892, 12694, 32833, 12644, 10159, 13054,
+    11596, 6044, 9018, 9971, 0, 0, 13128, 12559, 8920, 0, 10248, 12610, 12538, 13173, 17174, 0,
+    16777, 12491, 0, 10542, 13150, 17227, 10883, 32871, 16834, 28785, 0, 32882, 12898, 17016, 8658, 9387,
+    28697, 32923, 17410, 12892, 0, 17320, 16700, 6456, 0, 32844, 5401, 12791, 0, 28777, 6112, 0,
+    13098, 11520, 13151, 0, 0, 9262, 32820, 9971, 13208, 13211, 11358, 13067, 12911, 28747, 12826, 10880,
+    0, 17329, 32846, 9020, 12740, 0, 0, 0, 5498, 28785, 0, 28814, 32780, 5257, 28820, 12599,
+    28799, 11778, 9852, 0, 12897, 28780, 0, 0, 32891, 0, 32804, 4624, 12695, 0, 0, 16924,
+    28731, 9057, 10178, 10274, 32883, 32918, 16774, 12903, 0, 10483, 0, 0, 12432, 0, 12633, 12790,
+    10269, 12443, 0, 0, 13053, 12791, 32897, 0, 0, 0, 0, 28752, 10497, 6174, 10488, 9891,
+    28754, 5876, 17218, 17253, 9018, 28756, 13163, 28802, 32907, 0, 9685, 9657, 32883, 9973, 28714, 32923,
+    13164, 10452, 16461, 16697, 0, 13127, 8758, 5484, 12692, 0, 12683, 0, 12486, 16767, 6465, 10197,
+    17239, 17411, 13151, 0, 0, 0, 5526, 12420, 0, 32885, 16914, 28736, 9610, 0, 28749, 0,
+    0, 11137, 0, 11179, 0, 0, 28802, 0, 0, 17060, 32910, 16530, 0, 5454, 5491, 0,
+    10205, 10255, 16778, 9174, 0, 0, 13222, 12001, 28773, 13198, 8880, 12695, 10027, 12562, 10205, 0,
+    12791, 13032, 0, 9905, 12370, 13040, 0, 0, 28796, 13184, 5688, 9451, 32807, 5808, 12491, 13068,
+    10116, 0, 17131, 0, 0, 10585, 13173, 32872, 13065, 13015, 11776, 28713, 9653, 28715, 13075, 12557,
+    0, 12625, 9654, 0, 12498, 28702, 32924, 16923, 5585, 10813, 12467, 9851, 0, 0, 0, 12345,
+    28733, 12431, 10545, 9451, 9675, 28733, 8610, 0, 17253, 0, 5970, 16500, 28808, 16820, 16895, 11910,
+    0, 0, 0, 0, 0, 28715, 13161, 28780, 32921, 8775, 0, 11137, 12936, 17395, 32866, 0,
+    17331, 0, 32858, 17331, 28792, 0, 0, 11095, 9300, 12431, 12695, 12608, 13188, 16812, 9609, 9203,
+    0, 12966, 0, 16500, 12996, 28822, 9373, 12720, 9955, 13023, 0, 28812, 12779, 13009, 11766, 12791,
+    32932, 13210, 17241, 4587, 20490, 32867, 0, 0, 0, 0, 0, 9373, 12994, 0, 0, 0,
+    0, 16878, 0, 17331, 0, 6174, 6020, 9203, 13212, 0, 12515, 17385, 16779, 0, 13026, 16903,
+    10044, 0, 13188, 0, 32846, 10885, 0, 9940, 32885, 13212, 28712, 13031, 10462, 16595, 0, 9619,
+    17052, 10263, 16974, 0, 12559, 0, 13080, 9909, 0, 12732, 20490, 13016, 16827, 12606, 10252, 11779,
+    0, 0, 8647, 16914, 0, 8315, 6097, 17013, 28733, 0, 28714, 11766, 12897, 11304, 12298, 0,
+    32896, 11758, 16737, 32935, 28828, 28725, 17003, 0, 0, 0, 0, 9956, 0, 16923, 9151, 12621,
+    28749, 32879, 16982, 17369, 28822, 10233, 0, 12451, 0, 0, 12779, 12899, 0, 12681, 12468, 5422,
+    17240, 28719, 8405, 9648, 12513, 16778, 28747, 0, 12935, 28800, 0, 12708, 12545, 0, 16438, 0,
+    13187, 28788, 9620, 12009, 32892, 28689, 12571, 12683, 20481, 12720, 16698, 0, 0, 12934, 16618, 13018,
+    12488, 9807, 0, 28790, 0, 8445, 10563, 13132, 12696, 10278, 12066, 28801, 0, 28770, 12432, 12811,
+    11992, 5621, 9982, 0, 13080, 12954, 8348, 0, 0, 8748, 13026, 32867, 32908, 28813, 0, 0,
+    12515, 13056, 10590, 12309, 9980, 13110, 11700, 16925, 10218, 12623, 12467, 11414, 0, 0, 9499, 16609,
+    0, 0, 13030, 11049, 10789, 28737, 10284, 13016, 12504, 12487, 12876, 17332, 0, 9918, 16991, 32884,
+    12708, 12919, 10259, 0, 12576, 9919, 9960, 0, 12980, 0, 0, 9963, 12624, 17328, 0, 13018,
+    16745, 32845, 13127, 9985, 28790, 0, 28730, 10815, 28787, 11144, 12431, 5551, 13200, 12696, 8615, 28731,
+    12706, 0, 32909, 17241, 12804, 13078, 10505, 28813, 16974, 28762, 0, 12779, 9085, 17159, 13132, 0,
+    9648, 9813, 12930, 12694, 0, 9981, 6189, 8775, 8313, 10116, 0, 13224, 0, 12068, 0, 13211,
+    13019, 12792, 17083, 11410, 0, 0, 11451, 16617, 0, 17004, 0, 17330, 28812, 10089, 16925, 12943,
+    28815, 10161, 10460, 12935, 28732, 12348, 10888, 12671, 10320, 9349, 11955, 32936, 16800, 32935, 11710, 4793,
+    8255, 13040, 12343, 0, 12705, 12079, 16463, 12791, 12418, 13087, 9805, 9918, 13012, 28693, 12610, 12475,
+    28808, 28824, 10214, 13025, 16699, 12066, 17251, 0, 0, 28733, 0, 28697, 28714, 28678, 0, 8647,
+    28724, 13220, 13200, 32879, 12875, 8491, 12705, 12462, 0, 13211, 28802, 13067, 12075, 0, 17377, 12624,
+    13016, 5683, 28758, 32884, 28686, 20490, 12812, 28808, 12792, 12451, 4568, 28696, 28813, 16461, 0, 12695,
+    28703, 0, 12704, 0, 28804, 0, 5927, 4406, 0, 5225, 0, 8490, 28677, 13211, 0, 10571,
+    13023, 12618, 10252, 10261, 10630, 12521, 12533, 28689, 12812, 17161, 32908, 0, 28767, 16541, 12372, 28713,
+    0, 0, 12512, 13026, 8917, 12908, 9089, 28709, 0, 8554, 12334, 32910, 0, 28801, 28762, 9956,
+    9964, 12653, 12463, 32841, 0, 0, 28791, 9383, 28787, 28691, 0, 13029, 16606, 16932, 13055, 12608,
+    11435, 12049, 0, 9919, 0, 16499, 0, 32829, 28737, 16538, 12405, 13200, 13040, 11710, 32924, 28811,
+    32879, 12582, 11341, 10272, 11693, 13054, 16699, 12823, 13017, 16932, 16854, 13152, 9254, 13220, 11470, 28733,
+    13188, 10279, 28753, 8775, 32806, 8693, 0, 0, 16722, 28778, 0, 0, 0, 12539, 28791, 28738,
+    28772, 0, 32904, 0, 17399, 9984, 13078, 9241, 0, 28696, 16649, 13143, 13127, 4545, 9983, 12788,
+    0, 0, 12911, 0, 32830, 12524, 9796, 32778, 10928, 0, 6100, 0, 0, 9982, 32909, 11776,
+    6433, 32878, 13220, 8640, 0, 0, 11700, 9182, 16498, 32859, 12624, 17309, 12418, 0, 0, 12899,
+    0, 0, 8478, 13221, 28811, 9666, 8313, 10274, 11710, 10270, 0, 0, 32908, 12790, 0, 0,
+    13212, 17297, 32919, 32831, 0, 28692, 12540, 0, 32871, 13145, 10544, 9514, 12516, 12947, 13128, 11450,
+    13223, 28810, 0, 12898, 9975, 0, 9973, 12504, 32869, 0, 12418, 16675, 12936, 12056, 28754, 0,
+    0, 0, 16913, 0, 12622, 0, 0, 0, 28731, 9964, 12624, 13018, 8284, 10077, 0, 9648,
+    0, 12857, 10144, 13066, 10572, 11768, 13219, 0, 10862, 10259, 0, 32858, 10157, 28813, 16526, 20486,
+    11012, 12478, 28768, 10149, 16936, 9861, 9815, 12771, 16437, 16874, 12608, 12993, 10261, 12948, 17299, 12570,
+    0, 10014, 10176, 0, 28824, 12947, 12547, 12571, 28734, 12417, 0, 16620, 28736, 0, 32793, 16571,
+    28784, 32830, 28816, 11467, 10264, 0, 9751, 10872, 13176, 16421, 0, 28723, 5927, 12839, 0, 13007,
+    8364, 12444, 4857, 32776, 12553, 10562, 12404, 13223, 28785, 13161, 32880, 8874, 11833, 12655, 5211, 12490,
+    12665, 9965, 12786, 0, 0, 9965, 17396, 9548, 0, 0, 0, 0, 0, 9591, 32842, 17368,
+    0, 12823, 20481, 0, 12716, 5621, 28722, 8488, 0, 4203, 28737, 8338, 28738, 20485, 0, 12936,
+    9954, 12572, 28733, 9802, 10514, 12706, 12503, 28732, 12343, 12800, 8963, 28707, 12717, 0, 11103, 12573,
+    11469, 28813, 28767, 32776, 10330, 10267, 0, 28682, 8358, 32830, 9801, 12500, 0, 28826, 13157, 6232,
+    0, 28674, 0, 9902, 28827, 12571, 13054, 10515, 11394, 16430, 0, 8284, 0, 12512, 12487, 0,
+    0, 11168, 9815, 28827, 10044, 12683, 16974, 10460, 12440, 12893, 6409, 13148, 0, 17407, 0, 28772,
+    28708, 9307, 10036, 8948, 8882, 0, 12538, 9616, 10334, 17241, 12416, 17386, 11206, 0, 32910, 0,
+    32856, 12606, 0, 0, 12298, 9182, 0, 12468, 0, 10285, 12786, 32804, 16661, 9986, 28786, 12601,
+    32817, 11910, 9590, 32844, 13184, 12904, 12695, 0, 12812, 8785, 0, 10571, 8344, 16461, 32892, 17385,
+    12717, 12441, 32793, 11470, 32885, 12478, 12694, 9248, 12515, 0, 0, 10562, 28729, 0, 12726, 16745,
+    13157, 8787, 10100, 11050, 11208, 28814, 11219, 12696, 16538, 9516, 0, 0, 0, 11443, 12379, 0,
+    28716, 0, 12418, 16516, 10199, 9891, 16911, 8963, 9899, 13173, 28791, 0, 6218, 13148, 0, 16824,
+    12582, 0, 28749, 6433, 8358, 0, 16776, 9553, 28768, 12431, 8321, 0, 10050, 0, 0, 12777,
+    0, 6463, 13137, 8284, 12888, 12404, 5395, 28754, 13063, 32778, 4617, 28731, 0, 0, 32790, 0,
+    0, 32931, 9386, 5302, 32868, 13067, 11334, 11820, 17409, 0, 0, 10515, 8366, 12444, 4826, 12334,
+    12888, 5208, 12491, 12490, 12762, 0, 16605, 9978, 0, 12298, 12920, 0, 13078, 9545, 12441, 0,
+    0, 28732, 4572, 6409, 12502, 9961, 17053, 0, 0, 0, 17172, 12516, 8988, 10515, 12676, 12297,
+    12430, 0, 12525, 28791, 0, 10153, 32844, 0, 12633, 13122, 28827, 9000, 10207, 9001, 10273, 8709,
+    10100, 12442, 12499, 11895, 9513, 0, 0, 12490, 9983, 28809, 12369, 17411, 32859, 13224, 12635, 0,
+    13027, 8911, 12610, 13175, 0, 0, 0, 12527, 32871, 13032, 0, 9974, 16779, 16824, 9838, 0,
+    0, 0, 12645, 0, 12430, 28690, 4946, 28726, 0, 16604, 16904, 28747, 0, 0, 13028, 32781,
+    5783, 9261, 5522, 0, 11710, 0, 28788, 16925, 12802, 8710, 17203, 32807, 8450, 0, 28776, 0,
+    11457, 28803, 0, 0, 28725, 32905, 8357, 8703, 11237, 11734, 10804, 28744, 0, 12580, 0, 9307,
+    10625, 13067, 10282, 10358, 0, 13068, 8942, 8576, 28720, 17410, 9850, 32879, 8744, 12600, 17174, 28751,
+    28826, 0, 12772, 32857, 12727, 28752, 10883, 28766, 0, 13223, 9965, 28797, 17114, 0, 28825, 0,
+    28730, 8350, 28813, 32898, 0, 12924, 5499, 16937, 10216, 16779, 11219, 10872, 28825, 32933, 11171, 5416,
+    28738, 11334, 11095, 13100, 0, 28712, 9549, 0, 13032, 17172, 17236, 12666, 0, 4858, 28703, 6357,
+    0, 0, 32910, 0, 0, 4690, 12430, 28763, 0, 10869, 0, 8689, 12441, 28703, 0, 28798,
+    0, 28732, 12309, 12527, 11756, 0, 12936, 9918, 17328, 28823, 17376, 20483, 0, 9687, 0, 12454,
+    32776, 4288, 12624, 32872, 32869, 12335, 28826, 5665, 28813, 9261, 17320, 12624, 17012, 8388, 17158, 5333,
+    0, 28755, 9299, 12443, 10924, 0, 0, 9880, 11749, 0, 28808, 12800, 16578, 17001, 0, 28762,
+    16952, 0, 0, 16528, 12936, 12440, 32933, 28755, 28747, 6285, 0, 6188, 10050, 28676, 17016, 12706,
+    13150, 12492, 12778, 10487, 9610, 11411, 28814, 16765, 12811, 0, 12977, 32803, 10359, 0, 17409, 0,
+    9773, 9001, 13162, 0, 11910, 11820, 4885, 28702, 5484, 28755, 13040, 8711, 12694, 8689, 12432, 12762,
+    0, 0, 0, 6299, 5134, 4539, 13068, 12778, 28686, 17376, 0, 5418, 16674, 11168, 17330, 10263,
+    0, 11088, 9255, 28765, 9906, 0, 12695, 12800, 0, 12823, 17252, 0, 28802, 5736, 4833, 0,
+    28680, 0, 32867, 32832, 9299, 13161, 9308, 17052, 12456, 12336, 0, 10208, 12612, 11380, 4692, 0,
+    10280, 28816, 28778, 12516, 28714, 12869, 13187, 0, 0, 28826, 0, 17411, 10882, 20481, 0, 16440,
+    28747, 8420, 12335, 16686, 12704, 16763, 11058, 12946, 28790, 11479, 12475, 10469, 0, 20490, 16421, 12479,
+    12444, 12608, 28679, 12920, 12899, 0, 12864, 11749, 11012, 0, 12357, 12869, 0, 28797, 10334, 0,
+    0, 8446, 28827, 32923, 0, 0, 9387, 12606, 32920, 10047, 11049, 9607, 16936, 13172, 11348, 11895,
+    13211, 13021, 0, 12688, 13088, 8702, 0, 16766, 28773, 0, 28767, 13100, 32894, 11953, 12524, 0,
+    12502, 12540, 0, 10272, 12718, 8689, 16451, 28757, 32883, 28801, 10797, 9317, 28758, 12430, 12920, 4885,
+    28745, 5666, 0, 12432, 12727, 0, 32883, 12576, 9685, 17150, 16935, 11012, 0, 0, 11977, 9607,
+    0, 16767, 9317, 0, 0, 12454, 32871, 28719, 9687, 12503, 10506, 11766, 9299, 5410, 12643, 0,
+    10273, 13160, 11749, 12559, 16895, 13086, 28799, 0, 16832, 32867, 9356, 16448, 28825, 12870, 13024, 17174,
+    5454, 11821, 11357, 28747, 0, 28741, 12519, 17095, 12648, 17169, 12623, 16587, 12575, 0, 0, 12516,
+    12371, 16737, 28809, 28798, 9619, 9343, 13039, 28782, 28675, 17409, 28820, 16967, 28731, 11507, 28755, 16974,
+    0, 0, 28749, 9263, 0, 5498, 12571, 13187, 12347, 17227, 28815, 0, 9975, 13219, 12034, 0,
+    28714, 5738, 28730, 12513, 0, 5666, 28685, 10153, 13199, 9018, 12420, 13020, 12824, 12452, 11096, 32910,
+    0, 12862, 12573, 32911, 16737, 10150, 0, 13050, 32818, 28733, 9318, 0, 9309, 12454, 0, 8752,
+    12417, 0, 12492, 0, 28775, 28788, 0, 17003, 17081, 12366, 11151, 9616, 0, 11992, 12599, 16842,
+    12923, 28681, 9854, 17211, 11476, 0, 12513, 17410, 28786, 0, 12372, 9909, 16936, 4266, 4538, 0,
+    12932, 32878, 8403, 13040, 32857, 32921, 28789, 12417, 16605, 10805, 28775, 0, 0, 17139, 12888, 9073,
+    13149, 12921, 16733, 9807, 17289, 12803, 12419, 0, 0, 12296, 10259, 0, 32780, 8690, 32832, 9553,
+    0, 28754, 28756, 28768, 10713, 0, 11457, 28774, 16800, 0, 17218, 13199, 4289, 5498, 13139, 28732,
+    12776, 16924, 12418, 12432, 9050, 0, 12012, 0, 0, 13032, 9316, 28821, 12454, 0, 16695, 0,
+    32893, 32870, 13063, 0, 0, 12743, 28815, 16578, 28745, 13137, 17332, 28822, 28722, 32820, 28722, 9130,
+    5800, 4518, 12524, 0, 13195, 11224, 13020, 16912, 9318, 0, 16991, 11946, 28789, 10258, 16648, 11458,
+    12741, 17012, 12828, 28763, 12774, 0, 0, 11481, 0, 11756, 4982, 12559, 0, 32838, 13195, 17174,
+    16925, 17306, 12514, 12991, 12695, 0, 32819, 10218, 28801, 32779, 4788, 16694, 32790, 16924, 8984, 10805,
+    4540, 13198, 12643, 12708, 16620, 16777, 9064, 12404, 16842, 0, 0, 28713, 8867, 12636, 0, 9844,
+    13075, 28706, 0, 13153, 0, 12895, 17385, 17218, 32780, 10165, 0, 0, 8532, 28763, 6364, 10516,
+    28731, 32922, 0, 11518, 28735, 10581, 0, 28736, 32911, 11312, 11633, 4294, 0, 0, 12890, 16925,
+    12395, 12815, 32817, 28776, 20487, 10562, 10505, 28775, 5270, 13199, 4684, 28815, 32907, 0, 32776, 10292,
+    12503, 9050, 6455, 16651, 8266, 9682, 16578, 28756, 8598, 6174, 12931, 0, 12575, 4768, 32882, 32896,
+    28686, 28778, 8468, 0, 0, 10272, 17210, 12887, 0, 13194, 28714, 13140, 0, 20481, 0, 17408,
+    20483, 20490, 0, 10268, 13152, 0, 0, 9955, 12791, 13172, 16925, 12718, 9972, 10489, 28779, 13008,
+    9674, 28725, 0, 12480, 9018, 0, 12739, 12605, 12874, 12372, 12355, 16914, 8876, 11095, 28802, 16516,
+    28685, 11152, 6085, 12948, 0, 28679, 0, 28819, 12430, 5367, 32817, 9479, 17230, 12500, 10813, 0,
+    12420, 8743, 0, 0, 16932, 0, 28754, 28766, 12774, 28701, 12907, 8949, 28742, 32911, 16895, 0,
+    32846, 12428, 8460, 10869, 28748, 9896, 13149, 0, 28716, 0, 12440, 28708, 32831, 12479, 32805, 8333,
+    12407, 0, 0, 28731, 0, 13002, 4934, 32844, 8606, 12683, 28815, 28739, 32820, 28723, 12394, 12909,
+    0, 16808, 12708, 32779, 8633, 13068, 11756, 12583, 10107, 12489, 11178, 12885, 0, 9021, 17082, 28697,
+    0, 10228, 12521, 32895, 28724, 0, 4442, 8433, 10571, 28687, 11779, 9647, 12382, 12814, 12300, 9216,
+    12308, 12431, 12504, 28755, 16650, 0, 12429, 12067, 12827, 11709, 0, 10581, 0, 32857, 9944, 12463,
+    13066, 32858, 17329, 10255, 0, 12934, 20484, 0, 28714, 12358, 17385, 11769, 9065, 28810, 8641, 12444,
+    0, 28828, 16499, 11137, 12989, 10229, 12689, 9833, 0, 32937, 4454, 0, 0, 28721, 9941, 32858,
+    12612, 28824, 8612, 32885, 11096, 12452, 12681, 11647, 0, 13223, 13066, 12761, 9940, 28703, 32935, 0,
+    12908, 0, 9945, 12492, 17001, 28753, 32922, 9513, 16413, 32858, 0, 10127, 16762, 0, 10301, 12456,
+    28754, 12501, 0, 12324, 12378, 0, 12804, 13040, 13162, 16428, 17062, 12984, 10572, 0, 11999, 9174,
+    11999, 16787, 12792, 9796, 10144, 0, 28675, 13198, 9843, 16579, 12705, 8938, 0, 28735, 0, 0,
+    8413, 12456, 13067, 13198, 0, 13150, 0, 32833, 13199, 16687, 32801, 4200, 17409, 0, 0, 28702,
+    8856, 12600, 0, 9647, 32790, 0, 12990, 12693, 32909, 16569, 12800, 28759, 28765, 12626, 9984, 8452,
+    0, 20482, 12979, 11694, 12910, 0, 12370, 32858, 6096, 8942, 28697, 28801, 0, 12510, 12002, 6211,
+    8467, 9616, 10208, 16418, 12706, 12321, 16853, 28788, 9545, 28734, 28785, 0, 16777, 0, 0, 6447,
+    17253, 12898, 11710, 0, 9959, 28756, 32908, 0, 8650, 9561, 16806, 0, 8588, 9919, 28797, 10096,
+    28691, 0, 12464, 10217, 16974, 17230, 13210, 0, 28703, 12311, 12803, 32933, 13080, 10131, 8774, 12464,
+    12945, 0, 16463, 12012, 13140, 8342, 16934, 0, 17331, 12308, 28713, 28760, 16935, 28699, 28787, 28673,
+    28774, 28679, 0, 4415, 16842, 28723, 28789, 0, 10043, 8919, 8696, 12372, 13018, 13077, 0, 11104,
+    10507, 17094, 12688, 11954, 0, 10581, 9616, 0, 17151, 13052, 0, 28786, 9261, 28698, 9885, 0,
+    0, 10887, 0, 32803, 10060, 8314, 9849, 11013, 16765, 12492, 16586, 10208, 0, 4810, 0, 28764,
+    11151, 16974, 17331, 28789, 28790, 32933, 28797, 0, 12802, 13116, 28755, 17094, 28801, 0, 32778, 8607,
+    16438, 9776, 12705, 11701, 0, 12405, 28776, 13056, 9909, 9616, 16695, 0, 32794, 0, 13183, 32911,
+    9357, 12857, 28824, 12075, 32869, 0, 12678, 32779, 8622, 0, 13211, 32897, 32859, 13055, 0, 12693,
+    12895, 0, 0, 13164, 13209, 32894, 16445, 12455, 12347, 11404, 0, 11603, 0, 32934, 12954, 0,
+    28764, 28797, 32885, 12936, 28788, 28799, 28827, 0, 9620, 28738, 28828, 12600, 11161, 32792, 28777, 8486,
+    28802, 28785, 28797, 28755, 0, 11171, 17239, 12077, 10283, 0, 8230, 12068, 9078, 13064, 9852, 0,
+    9985, 13055, 9986, 12512, 13211, 28736, 13043, 32884, 16569, 9372, 12491, 28710, 28752, 0, 0, 0,
+    28791, 32924, 11710, 28765, 12827, 13024, 0, 4463, 28759, 13053, 32792, 12564, 6225, 9591, 17399, 13078,
+    9779, 16517, 28764, 32884, 12308, 0, 28766, 12431, 0, 13160, 8686, 0, 28828, 0, 12074, 0,
+    17170, 16458, 28825, 9877, 20487, 17297, 13080, 13055, 12378, 9383, 10282, 9933, 10571, 5830, 12623, 28778,
+    17162, 13200, 12898, 0, 12622, 13077, 13171, 28814, 12935, 13219, 28709, 28767, 16490, 16823, 28801, 32867,
+    10279, 32935, 11693, 16508, 9839, 12813, 16684, 12612, 32935, 9357, 12705, 28762, 0, 0, 0, 0,
+    0, 28737, 16696, 0, 8859, 17229, 16853, 0, 32790, 0, 32854, 9373, 20489, 9983, 0, 0,
+    32885, 12418, 0, 11647, 0, 13067, 12801, 12693, 28803, 0, 0, 12827, 13013, 0, 28822, 0,
+    9971, 0, 0, 0, 13077, 28823, 32917, 28790, 10879, 28718, 32869, 17151, 28814, 9607, 0, 0,
+    0, 0, 12682, 16605, 28802, 0, 13026, 11467, 12935, 13150, 12622, 0, 12443, 0, 16904, 12480,
+    8591, 32859, 28788, 0, 0, 10255, 28826, 9084, 0, 32909, 10161, 17290, 0, 12500, 12876, 32885,
+    13007, 28804, 28760, 13016, 28799, 0, 28801, 9262, 9384, 0, 0, 0, 17015, 0, 9686, 28779,
+    28754, 0, 12694, 0, 0, 12802, 13039, 12610, 13029, 28711, 28800, 20481, 0, 32909, 28740, 0,
+    11404, 9286, 0, 12443, 28710, 16936, 28787, 0, 9383, 13188, 28823, 32805, 16513, 12900, 12708, 28685,
+    0, 0, 16790, 12935, 28789, 5227, 4233, 13221, 9945, 12983, 13223, 11168, 28781, 0, 28702, 17319,
+    8718, 10872, 13219, 16853, 8469, 0, 32882, 28822, 0, 16538, 16937, 0, 28677, 9655, 13054, 16936,
+    28789, 16574, 28807, 0, 0, 28822, 28779, 5269, 11458, 0, 32884, 0, 13206, 13151, 6409, 28800,
+    9218, 0, 28811, 10581, 17388, 0, 5130, 12335, 9382, 32881, 32805, 16434, 0, 0, 13078, 13224,
+    13055, 0, 0, 28825, 32909, 10506, 28679, 32869, 13188, 13028, 0, 10177, 0, 12888, 12356, 0,
+    17237, 12064, 28766, 6101, 28766, 16933, 28786, 0, 5193, 12384, 4483, 28822, 0, 28686, 28777, 10056,
+    12008, 17004, 11413, 16684, 8389, 17211, 28789, 28828, 5927, 10714, 0, 16448, 12516, 28792, 17173, 0,
+    32858, 17252, 9655, 0, 28678, 10284, 12936, 12947, 5731, 32935, 0, 5422, 12627, 28776, 12622, 12716,
+    17332, 12934, 0, 28702, 9895, 28720, 28812, 32871, 12369, 12612, 28789, 12068, 32937, 13188, 32869, 28767,
+    12574, 28788, 28791, 17013, 12718, 0, 10498, 12367, 28735, 12718, 6466, 12489, 32868, 0, 0, 10879,
+    28735, 9974, 9674, 12574, 13055, 17239, 0, 32894, 12792, 12780, 0, 10307, 16420, 16937, 17289, 28819,
+    10714, 12812, 16779, 10218, 28790, 12621, 0, 28826, 12297, 0, 17250, 12935, 28801, 10199, 0, 10816,
+    8281, 28733, 28748, 0, 9863, 12622, 28787, 12296, 0, 0, 0, 13109, 10760, 0, 12324, 0,
+    0, 0, 16913, 13160, 0, 28774, 28814, 20489, 32869, 16512, 12611, 28809, 9021, 17132, 0, 20485,
+    0, 13156, 32910, 11458, 17309, 5499, 28711, 32935, 16937, 11349, 32871, 32905, 32918, 17095, 13066, 12802,
+    10889, 0, 13008, 0, 0, 12562, 17173, 5549, 16887, 16935, 10714, 28776, 28685, 8742, 0, 4586,
+    0, 13200, 0, 11932, 12707, 28708, 9933, 0, 10199, 0, 11895, 0, 10162, 12804, 28798, 28756,
+    10376, 10452, 0, 13008, 0, 28739, 32867, 10272, 28791, 5263, 12815, 28708, 12510, 0, 0, 0,
+    0, 13183, 10582, 0, 28808, 28821, 16444, 11713, 12492, 0, 0, 0, 0, 8435, 9546, 28710,
+    0, 6457, 28778, 28779, 12612, 32910, 12909, 0, 28790, 16806, 28763, 0, 12396, 10273, 0, 12579,
+    13024, 32781, 5707, 12934, 9974, 12432, 12948, 0, 6409, 13015, 13077, 0, 28790, 0, 0, 28803,
+    0, 17015, 10114, 12910, 28726, 17320, 13172, 28747, 12308, 13078, 9655, 11703, 0, 0, 0, 0,
+    0, 32859, 13164, 8941, 28799, 12815, 9152, 11765, 32909, 28698, 12934, 32898, 4985, 13029, 0, 17318,
+    12898, 17230, 13162, 10872, 9919, 32885, 28813, 0, 12803, 8491, 10300, 4836, 5745, 13223, 28686, 13152,
+    16720, 28766, 5026, 12594, 16499, 9935, 0, 6401, 28776, 9085, 32858, 0, 12694, 0, 17230, 13150,
+    9771, 12720, 32931, 0, 12297, 28810, 28802, 28813, 0, 28820, 28774, 17151, 16921, 0, 10272, 28812,
+    12707, 0, 0, 28778, 17072, 17410, 28823, 0, 20490, 0, 10280, 32894, 17405, 0, 28709, 10182,
+    8565, 16458, 13030, 10144, 28728, 32896, 6394, 17095, 17253, 28786, 0, 16428, 32885, 32935, 5270, 12563,
+    0, 28812, 28678, 28822, 0, 12465, 0, 9983, 0, 0, 20482, 17083, 28803, 28685, 0, 17094,
+    12610, 0, 12563, 0, 12456, 9682, 0, 4614, 12948, 0, 10573, 13195, 5629, 16765, 0, 28677,
+    17012, 0, 12777, 32918, 28785, 17247, 12911, 0, 8891, 32898, 17237, 17394, 32791, 0, 17319, 0,
+    12828, 32898, 0, 9217, 28815, 9914, 13174, 28676, 28766, 12936, 17384, 16595, 28765, 32920, 17297, 12515,
+    12719, 12682, 12708, 12311, 10153, 28788, 9647, 28752, 17299, 0, 16644, 8244, 16974, 13067, 0, 9373,
+    8645, 28813, 9309, 32911, 28823, 13163, 5818, 9663, 32855, 12504, 32884, 28754, 9908, 16923, 0, 13140,
+    0, 12803, 9355, 12924, 20487, 0, 13064, 28673, 13164, 12056, 32931, 28702, 11806, 0, 28775, 28813,
+    0, 32910, 13151, 12947, 17082, 0, 0, 8343, 28774, 12346, 16844, 0, 0, 28803, 28713, 11115,
+    13194, 13128, 28815, 0, 8992, 13152, 10217, 32801, 9424, 17299, 0, 32832, 12455, 13149, 0, 16642,
+    17252, 32936, 17069, 0, 9682, 0, 11357, 28768, 0, 28825, 28709, 0, 8543, 28735, 28825, 8292,
+    11467, 4235, 28727, 9918, 9950, 12358, 12815, 11402, 13018, 28763, 11469, 5753, 12402, 28826, 0, 6357,
+    17095, 8829, 0, 11470, 13140, 32882, 12804, 32803, 16496, 17162, 13127, 0, 32803, 8262, 16459, 17408,
+    20482, 12935, 28733, 13207, 0, 28814, 32866, 9682, 12300, 13079, 5484, 12804, 28708, 28811, 10882, 12622,
+    0, 17252, 16526, 9423, 17387, 32781, 5677, 32921, 13206, 32907, 11479, 13056, 12344, 10218, 9972, 28749,
+    28723, 28766, 16448, 28814, 32911, 28828, 32776, 4236, 28697, 17316, 28688, 11469, 0, 28767, 32898, 32778,
+    4488, 11411, 0, 0, 13109, 12379, 28733, 16643, 28698, 32921, 0, 28687, 12343, 0, 32858, 12884,
+    32828, 13223, 32803, 8561, 11479, 32838, 11057, 32911, 17052, 4261, 0, 0, 13028, 13020, 12480, 12492,
+    28698, 32838, 28826, 0, 9188, 32777, 8857, 13121, 32909, 20487, 16616, 4738, 28738, 0, 28686, 12924,
+    11766, 9766, 0, 16485, 16577, 12378, 13044, 0, 16537, 13039, 28803, 17015, 12486, 28722, 28778, 8747,
+    8869, 28700, 12432, 0, 17016, 10157, 28813, 12331, 28779, 11481, 13065, 4486, 17405, 10162, 28698, 12946,
+    28813, 11182, 0, 28749, 10216, 32776, 8541, 12708, 32778, 4500, 16654, 12565, 12404, 6410, 0, 32789,
+    0, 8866, 16503, 12332, 0, 32790, 9672, 12825, 12306, 0, 13051, 20490, 0, 28689, 0, 12708,
+    12321, 28698, 9941, 11178, 12624, 6233, 9431, 0, 11655, 32895, 12323, 16434, 8599, 17095, 10255, 10285,
+    12402, 9648, 17218, 12491, 12322, 8830, 0, 32896, 0, 13122, 0, 11759, 11757, 10515, 16794, 12420,
+    13224, 16576, 32815, 16584, 8544, 13183, 28710, 17251, 16800, 28788, 28802, 12612, 11402, 8598, 11115, 28809,
+    9220, 10562, 11778, 28686, 16992, 11985, 12622, 32896, 11470, 32778, 4484, 0, 17411, 32791, 17174, 32907,
+    28687, 8532, 12948, 28787, 28690, 0, 10883, 8872, 12624, 16421, 16795, 13185, 28767, 0, 28787, 0,
+    28687, 12903, 12419, 28762, 13186, 13086, 28775, 11414, 0, 16620, 11171, 28709, 17174, 12321, 12674, 10218,
+    0, 11414, 12569, 13064, 12936, 9364, 28710, 28721, 16654, 12308, 28768, 9174, 28803, 28673, 0, 28685,
+    28827, 28791, 8377, 12804, 28687, 32869, 12454, 32885, 9189, 16812, 13056, 9437, 8635, 28768, 6457, 13068,
+    11152, 32827, 20484, 8603, 20484, 28799, 0, 0, 8636, 32807, 8729, 11657, 12417, 10218, 32911, 0,
+    32827, 0, 10273, 12403, 16649, 28788, 17082, 12296, 8846, 13195, 28821, 0, 13065, 13031, 6261, 8928,
+    32789, 9953, 12403, 32792, 28710, 0, 20488, 8844, 16436, 13163, 8940, 32789, 0, 0, 17001, 0,
+    9428, 32790, 16498, 9833, 12594, 28734, 28773, 0, 9383, 12828, 28767, 10871, 0, 0, 16856, 0,
+    28688, 9772, 12331, 13065, 28727, 12520, 13151, 13146, 10195, 16455, 0, 28821, 11779, 17290, 20488, 4503,
+    12707, 9899, 12770, 28726, 13176, 0, 28734, 16669, 16435, 17331, 32936, 28779, 13075, 17253, 11477, 0,
+    16498, 28749, 28768, 13195, 0, 28712, 10584, 16663, 28697, 0, 0, 16674, 0, 17015, 17384, 28778,
+    28815, 17332, 28755, 28675, 28800, 12320, 16936, 28676, 10018, 12568, 0, 0, 28827, 28713, 32779, 8638,
+    28788, 28709, 10506, 8576, 28690, 13064, 32802, 4295, 13055, 10283, 12486, 12011, 12464, 32920, 28816, 13019,
+    0, 12708, 28700, 13188, 28776, 17160, 17072, 32778, 4511, 0, 0, 12555, 28696, 13199, 11775, 10023,
+    32818, 16514, 13065, 10571, 28763, 13030, 12594, 28734, 16801, 28715, 32924, 17016, 28776, 16586, 12343, 13149,
+    13198, 16657, 0, 9772, 28815, 28776, 28792, 17250, 28803, 16601, 0, 0, 16805, 13066, 0, 32791,
+    17319, 32842, 13018, 28801, 10870, 13116, 12002, 12308, 12814, 32907, 28726, 4753, 0, 10882, 28686, 0,
+    0, 16778, 13187, 28804, 13092, 11757, 12624, 28728, 0, 0, 12498, 9200, 9152, 28697, 12816, 28827,
+    13187, 13008, 28722, 17218, 12370, 8337, 32781, 8726, 28751, 9152, 0, 13043, 0, 28710, 0, 28715,
+    12568, 12000, 13007, 12370, 32935, 12346, 10573, 28735, 12622, 0, 16499, 28812, 16657, 12720, 32814, 4576,
+    32859, 32844, 16665, 10554, 16600, 20490, 0, 28737, 12324, 11780, 16421, 32896, 10815, 10272, 17320, 11656,
+    0, 28749, 8976, 16436, 4574, 13078, 16667, 8280, 5119, 32780, 5177, 28713, 32934, 32923, 17015, 0,
+    17297, 28727, 17252, 9876, 10871, 12012, 6402, 20481, 0, 12708, 13032, 11460, 0, 32792, 4409, 16759,
+    28777, 16878, 28753, 28715, 12545, 28780, 0, 28802, 12358, 13162, 28738, 12465, 9648, 16665, 32894, 28744,
+    12487, 12492, 28790, 0, 9682, 4394, 28792, 0, 32911, 9451, 28706, 16811, 16679, 16445, 17411, 28798,
+    32819, 13218, 13149, 12696, 13199, 32830, 12804, 0, 5878, 8879, 16516, 10562, 32910, 12606, 17092, 28768,
+    17217, 5499, 12431, 8970, 10054, 9174, 12708, 0, 0, 10554, 16516, 12477, 0, 0, 28738, 0,
+    9075, 9043, 12912, 16812, 0, 9508, 4677, 16421, 20482, 8581, 4869, 12067, 0, 13056, 28765, 8642,
+    32843, 8605, 11467, 12696, 28756, 0, 20487, 28685, 8311, 0, 17083, 28738, 12324, 17093, 0, 17015,
+    17014, 9216, 12012, 8357, 12513, 16508, 32816, 12487, 0, 8918, 12696, 0, 12689, 0, 32885, 0,
+    8320, 16602, 0, 20490, 28751, 12368, 9591, 9984, 11776, 17062, 12500, 0, 11012, 8343, 11115, 28734,
+    13206, 9807, 28693, 11768, 12455, 32791, 0, 0, 13066, 0, 4807, 32859, 0, 28822, 10308, 12816,
+    9545, 17083, 9299, 12466, 0, 28780, 13212, 28786, 28701, 32924, 28801, 16445, 12945, 11170, 17004, 0,
+    0, 28789, 0, 13078, 0, 12738, 12870, 32924, 0, 16579, 17354, 32923, 17151, 12516, 0, 0,
+    32780, 5223, 32859, 12623, 12696, 32898, 0, 0, 0, 10283, 32804, 10089, 9838, 20490, 28747, 0,
+    17249, 16439, 32818, 13206, 0, 12996, 0, 28811, 28697, 28777, 9956, 17332, 17330, 32934, 9546, 28828,
+    28762, 0, 28815, 9980, 4837, 12466, 28749, 16934, 9805, 28759, 10039, 12439, 28710, 0, 16789, 28735,
+    28673, 11769, 8912, 32806, 8682, 12321, 9552, 13080, 13077, 13186, 13139, 0, 0, 9516, 5776, 0,
+    28820, 13175, 10572, 28823, 12612, 6448, 12571, 12604, 28804, 12718, 13022, 12358, 11115, 8858, 8949, 16430,
+    28745, 0, 28727, 12382, 0, 16914, 12488, 0, 13053, 0, 17309, 32819, 9480, 13222, 28802, 9773,
+    28822, 4453, 32880, 12658, 13207, 32923, 0, 9341, 13198, 17162, 0, 32830, 16938, 12846, 10263, 32831,
+    12456, 17329, 9862, 28691, 0, 0, 0, 8387, 10626, 12912, 32856, 32884, 32911, 12704, 13211, 0,
+    28677, 0, 28690, 16982, 6234, 5189, 10338, 4685, 12501, 16503, 12055, 17320, 28729, 32897, 9210, 10112,
+    12417, 0, 32791, 12360, 4456, 6455, 32907, 0, 12381, 32924, 12715, 0, 28799, 9240, 9546, 12548,
+    12078, 28812, 16766, 0, 12311, 12705, 9509, 5026, 13151, 12919, 12803, 16829, 32937, 12011, 4874, 4625,
+    0, 0, 0, 12845, 16447, 13077, 0, 32856, 12501, 17094, 9882, 0, 12948, 12624, 12467, 8786,
+    12852, 9813, 13122, 28693, 12908, 12688, 17394, 13200, 10094, 0, 28811, 12795, 28752, 0, 20489, 17332,
+    8963, 12465, 0, 0, 16936, 17162, 0, 32911, 0, 28690, 0, 0, 32898, 28778, 0, 12519,
+    17320, 4693, 32818, 0, 12908, 10065, 9986, 28679, 28779, 11161, 0, 13055, 10925, 28780, 0, 12667,
+    32802, 9150, 28792, 0, 0, 12068, 12935, 0, 32936, 10255, 13030, 13212, 8688, 13161, 12622, 13137,
+    5210, 12429, 32779, 4936, 32779, 16510, 17060, 32858, 10045, 16526, 17148, 10146, 12324, 12923, 0, 32790,
+    11480, 12622, 12931, 28768, 17240, 0, 12612, 28804, 12882, 28787, 5409, 28762, 12689, 12739, 12687, 10095,
+    13143, 12489, 12825, 10259, 0, 0, 0, 0, 6411, 8321, 28757, 4879, 12784, 11171, 12502, 28788,
+    8390, 28804, 8883, 10342, 0, 32832, 28789, 10131, 0, 12784, 17297, 12503, 9808, 9849, 8987, 0,
+    12466, 28789, 13077, 28678, 13134, 13210, 16428, 32868, 0, 16684, 0, 12442, 28680, 12383, 32803, 4462,
+    9794, 6457, 28814, 8476, 32884, 0, 28703, 28785, 28828, 32819, 10516, 5218, 13066, 4945, 0, 5025,
+    0, 32781, 9025, 8403, 13162, 12383, 0, 28820, 13198, 13055, 0, 0, 0, 4189, 12623, 0,
+    12430, 0, 0, 0, 12972, 0, 0, 12547, 5408, 0, 32806, 5224, 20484, 16527, 0, 32789,
+    28745, 12324, 17013, 17361, 32897, 13200, 12012, 17241, 0, 17079, 12892, 32835, 0, 28800, 32921, 12395,
+    12785, 8548, 12783, 10553, 32897, 32923, 32894, 8861, 17174, 17299, 9884, 16765, 11467, 28733, 12574, 10265,
+    12576, 5411, 0, 12559, 0, 28676, 28775, 28674, 9858, 10065, 32936, 12549, 12479, 17004, 8351, 20490,
+    32813, 0, 11035, 32807, 16691, 28676, 17332, 0, 0, 17298, 13080, 16453, 10806, 12300, 28724, 0,
+    12727, 13080, 8340, 32827, 28700, 16564, 0, 32845, 11057, 32781, 5711, 0, 28792, 0, 32832, 28711,
+    12408, 0, 11480, 16504, 20482, 32781, 5715, 0, 10415, 0, 9905, 11220, 16448, 13056, 0, 28711,
+    28792, 12077, 12687, 0, 16832, 12489, 28711, 32872, 28764, 0, 16991, 13032, 28778, 0, 32777, 4330,
+    11481, 16535, 10132, 12404, 28776, 0, 16457, 11413, 9042, 11480, 32872, 11469, 28685, 16687, 32833, 28766,
+    17253, 12443, 0, 12480, 10584, 32924, 28673, 12893, 9561, 16426, 9128, 32934, 0, 0, 10066, 9845,
+    28676, 13113, 0, 32921, 8263, 17398, 28764, 12882, 28699, 13031, 28725, 11468, 13162, 11103, 12922, 0,
+    10332, 16421, 12501, 9136, 12500, 13160, 16456, 16936, 12357, 12419, 0, 9779, 0, 12933, 20489, 8371,
+    28826, 17331, 12479, 10883, 28767, 17172, 28825, 11057, 10166, 12934, 8446, 28759, 17411, 17094, 17332, 0,
+    28673, 12898, 17014, 12801, 0, 28774, 28704, 12623, 10162, 0, 12564, 28780, 32781, 5733, 28673, 32804,
+    12297, 0, 5317, 12823, 28828, 28756, 12783, 0, 13200, 17062, 0, 17332, 12394, 12688, 0, 28780,
+    12489, 0, 12503, 9859, 12672, 12828, 9885, 13212, 9553, 8412, 32819, 12946, 12622, 0, 16426, 8732,
+    28768, 11356, 13150, 13183, 0, 11481, 0, 28823, 12309, 12924, 8420, 32814, 13200, 10452, 13200, 12573,
+    0, 11112, 8785, 16617, 0, 0, 13053, 28710, 17329, 28736, 8848, 17297, 28824, 4239, 8710, 0,
+    32832, 0, 13054, 13211, 28824, 12393, 16937, 17250, 0, 10113, 28709, 0, 12324, 12336, 10121, 28723,
+    10044, 13224, 17151, 12419, 9224, 0, 32858, 0, 16575, 0, 10182, 20488, 16937, 32936, 11358, 28685,
+    16770, 0, 12372, 28679, 12348, 0, 9817, 0, 0, 12790, 28721, 28702, 12816, 12606, 32936, 32933,
+    13008, 12408, 13080, 9332, 13162, 9309, 11518, 0, 16924, 12515, 28735, 16591, 0, 28691, 17240, 0,
+    17387, 12784, 0, 13200, 0, 28815, 0, 13198, 28701, 32898, 32882, 28722, 0, 16527, 8898, 10127,
+    28688, 0, 16911, 11779, 12321, 9908, 9890, 10144, 9839, 16593, 12296, 32924, 28710, 11467, 12378, 17397,
+    32892, 12348, 17406, 17151, 4734, 13044, 16922, 28810, 0, 0, 11394, 16537, 9843, 0, 20489, 32802,
+    9145, 17253, 16925, 0, 12610, 28691, 12360, 17173, 17296, 28788, 0, 9429, 20482, 9309, 6457, 12516,
+    13032, 5540, 28768, 28777, 5265, 12404, 28804, 12079, 0, 11735, 16727, 4198, 32937, 12477, 32790, 9917,
+    0, 32884, 4495, 0, 32937, 9717, 28736, 0, 8743, 16569, 0, 0, 9985, 28785, 10038, 28826,
+    13080, 9935, 11712, 16570, 28738, 13212, 17093, 12852, 8744, 12707, 12417, 8569, 0, 0, 28818, 16925,
+    13163, 10190, 17251, 0, 11993, 12356, 28707, 0, 0, 0, 0, 12603, 28677, 5749, 12922, 9516,
+    12295, 28778, 13044, 12719, 0, 16427, 0, 12479, 17095, 9616, 4772, 17399, 12611, 28724, 12624, 12623,
+    8628, 8459, 8848, 28679, 0, 16732, 17001, 32832, 0, 17330, 11466, 8875, 32885, 28775, 12405, 28812,
+    13224, 13223, 32884, 8895, 11655, 17387, 32905, 32791, 0, 5127, 12065, 28722, 9839, 12360, 4357, 16426,
+    32829, 28828, 17318, 17411, 17241, 16936, 17095, 16585, 5751, 12846, 13224, 28688, 32856, 12078, 12946, 12683,
+    13161, 0, 16887, 28790, 0, 10204, 12455, 12383, 28702, 13138, 28800, 0, 13220, 0, 4745, 12334,
+    0, 12815, 9975, 32804, 8300, 9050, 20490, 8605, 32918, 0, 17172, 0, 13043, 13149, 13163, 28749,
+    16993, 0, 9908, 8976, 12075, 12443, 28731, 12718, 17174, 13067, 16506, 17162, 12012, 0, 0, 8320,
+    32820, 0, 11523, 0, 13223, 10507, 32883, 28824, 0, 28816, 12922, 13211, 28678, 28796, 10037, 8452,
+    28713, 8335, 28675, 16914, 28700, 12324, 0, 12863, 0, 32780, 5151, 0, 32910, 11780, 16459, 12492,
+    0, 0, 0, 13012, 17162, 28809, 16902, 0, 8459, 17406, 0, 12602, 17387, 11402, 28815, 28824,
+    0, 0, 12899, 12468, 32830, 11766, 28827, 28792, 32898, 0, 11181, 0, 9051, 28687, 28712, 12945,
+    28702, 9648, 32896, 16824, 5255, 0, 13080, 32792, 32934, 28816, 12430, 13207, 28700, 0, 32907, 13077,
+    0, 16697, 32884, 0, 17173, 0, 28709, 0, 12323, 11735, 12406, 6096, 12002, 32833, 16461, 16594,
+    9662, 8549, 32780, 8668, 20490, 11059, 10021, 10190, 10584, 0, 28804, 17330, 8285, 0, 28721, 12551,
+    12492, 16676, 28763, 13004, 16571, 28721, 12298, 0, 28690, 13221, 28779, 0, 28698, 13028, 0, 12419,
+    28803, 0, 0, 16803, 0, 28768, 5877, 32870, 13002, 12556, 28826, 9342, 12945, 11159, 17409, 28812,
+    0, 0, 17330, 13078, 28775, 5971, 16777, 8918, 28763, 17332, 16650, 8255, 0, 12888, 16459, 0,
+    13013, 6085, 32934, 28779, 9904, 17002, 32778, 10082, 9356, 13017, 32870, 32908, 13042, 17409, 11978, 12405,
+    32909, 11713, 17399, 0, 32778, 4515, 8963, 0, 0, 32897, 28752, 10204, 13210, 28816, 12393, 16800,
+    32792, 17083, 0, 17253, 0, 28804, 12827, 13155, 16446, 0, 16428, 13051, 0, 13211, 17331, 16801,
+    17240, 8475, 28703, 17095, 9546, 11769, 9051, 9451, 9908, 13056, 12936, 9065, 12348, 12923, 8873, 9074,
+    32934, 13224, 32816, 17253, 28763, 20488, 12911, 12416, 32870, 28797, 9838, 12569, 10016, 12464, 8875, 8305,
+    32935, 5879, 32781, 8724, 13211, 28788, 16924, 12618, 0, 16913, 16571, 28786, 12444, 12719, 12078, 32898,
+    28816, 28733, 0, 12665, 16894, 28827, 28752, 8581, 0, 28796, 11655, 16413, 12994, 0, 28687, 28691,
+    9885, 0, 16621, 12611, 28762, 8459, 12610, 10305, 0, 5822, 16507, 32937, 28679, 0, 32816, 28827,
+    9912, 16816, 32833, 32816, 12501, 10233, 0, 12560, 16429, 12569, 8605, 9949, 12476, 10065, 12012, 16587,
+    12440, 12332, 32803, 4422, 0, 4420, 11992, 10584, 0, 0, 12077, 4573, 12078, 12369, 28732, 8909,
+    32789, 12441, 28811, 32911, 28703, 4425, 28825, 11657, 28687, 0, 32937, 9607, 9665, 32871, 16586, 32922,
+    0, 0, 12384, 0, 0, 0, 4933, 13056, 4383, 28804, 0, 32924, 8904, 8381, 9951, 28810,
+    12801, 9767, 9666, 10255, 12485, 9655, 28774, 12335, 13176, 0, 28756, 4795, 12429, 32871, 28698, 0,
+    16587, 8383, 17251, 9308, 0, 4271, 28713, 0, 9969, 0, 0, 28733, 0, 0, 16657, 20489,
+    12442, 16508, 16779, 32924, 17320, 9383, 11766, 13149, 0, 12407, 12009, 13139, 12576, 11181, 12900, 28808,
+    4416, 28756, 9620, 12623, 16507, 0, 16516, 17309, 0, 28730, 0, 12815, 8453, 32871, 9813, 10816,
+    8383, 8989, 16775, 0, 28816, 32793, 8642, 13200, 0, 0, 0, 8943, 13029, 11693, 28736, 32792,
+    8441, 17090, 13198, 10572, 28710, 12520, 16937, 16586, 17015, 0, 28826, 12456, 0, 0, 16936, 12521,
+    12078, 0, 0, 12922, 12498, 0, 10289, 9151, 10583, 13017, 32777, 4375, 8608, 12308, 32792, 0,
+    11750, 12815, 16853, 4296, 9764, 9787, 4811, 0, 4811, 5410, 12783, 9973, 12463, 0, 12298, 12466,
+    10234, 12521, 8476, 12336, 0, 32790, 12934, 12078, 8941, 4238, 12479, 28674, 28686, 12367, 13212, 12344,
+    0, 12876, 0, 16650, 10554, 9970, 0, 0, 0, 12948, 12519, 12636, 12892, 9947, 12463, 28768,
+    8784, 12521, 0, 11765, 16575, 20488, 0, 16507, 16700, 0, 0, 28718, 12331, 0, 28789, 13176,
+    0, 16499, 0, 0, 16413, 0, 0, 9430, 28791, 9953, 9847, 11480, 28790, 12296, 12463, 28824,
+    0, 13188, 11523, 0, 12480, 11159, 9795, 9202, 0, 16649, 16499, 12402, 0, 32922, 13176, 13161,
+    13186, 8575, 0, 8941, 32788, 0, 10264, 13055, 13172, 28701, 28804, 32807, 16455, 12908, 9084, 28721,
+    12321, 12420, 0, 32898, 28735, 12720, 12933, 16498, 8841, 0, 12396, 12394, 13173, 0, 16448, 9561,
+    32779, 9820, 9796, 13025, 16451, 8907, 0, 10573, 0, 8264, 12919, 12344, 13224, 11182, 8980, 6233,
+    12569, 32778, 4537, 11171, 8263, 13222, 0, 12500, 8486, 13043, 11479, 9793, 11358, 17093, 32936, 11178,
+    13016, 17004, 12335, 12443, 4208, 16691, 12300, 32872, 28766, 5410, 32922, 0, 11413, 32832, 16427, 0,
+    11181, 0, 9655, 9440, 32805, 8641, 16752, 12402, 0, 28813, 9666, 0, 32775, 4199, 20487, 9425,
+    0, 0, 9663, 0, 0, 28698, 32820, 32791, 8341, 28718, 28791, 28774, 6235, 12300, 16576, 32924,
+    28685, 28677, 12443, 8842, 13219, 28757, 0, 0, 32920, 16406, 0, 16801, 0, 28725, 12515, 12431,
+    13224, 0, 10190, 16429, 8909, 8266, 28711, 12356, 11404, 16610, 12945, 16434, 8411, 32794, 5211, 8562,
+    8387, 10806, 0, 12708, 8342, 0, 5195, 0, 28713, 28678, 8875, 9917, 13044, 10229, 16717, 4637,
+    16932, 4832, 12359, 28702, 16564, 12496, 0, 9190, 12441, 16448, 28710, 12009, 12948, 16437, 20484, 12791,
+    12720, 17172, 12708, 28735, 0, 0, 0, 8531, 32806, 8394, 9945, 11470, 20490, 17228, 9425, 28713,
+    28733, 12297, 12439, 12564, 16937, 5537, 16490, 8888, 8388, 10872, 8337, 32791, 0, 32777, 8563, 6276,
+    12683, 28674, 32829, 8321, 13139, 17016, 13068, 0, 28703, 8983, 0, 28697, 0, 32793, 9159, 12479,
+    12515, 9985, 12355, 0, 12784, 0, 32778, 4575, 0, 0, 12299, 28698, 16779, 13080, 8562, 28756,
+    32937, 9307, 4290, 0, 0, 11993, 12912, 8394, 17319, 12390, 12516, 12816, 16420, 9890, 32775, 4191,
+    4840, 11105, 17369, 28800, 0, 17160, 28812, 12357, 12067, 0, 5180, 0, 0, 32803, 4380, 12378,
+    28702, 16664, 9599, 0, 28721, 28713, 12785, 9974, 0, 32804, 12345, 28698, 13172, 32781, 5689, 16797,
+    32802, 9135, 0, 0, 32818, 8553, 0, 17160, 12008, 12320, 32791, 0, 28804, 28701, 10882, 10815,
+    16684, 28804, 28812, 0, 12804, 0, 0, 32801, 9723, 0, 9941, 12467, 11182, 16800, 28803, 32790,
+    32775, 9417, 0, 12343, 12779, 0, 0, 6101, 32937, 28698, 0, 10872, 0, 17251, 0, 28776,
+    0, 0, 16516, 9133, 0, 0, 6409, 8926, 0, 28826, 17252, 11522, 12308, 12336, 13186, 17320,
+    16419, 0, 0, 17248, 28676, 32791, 0, 0, 12924, 28811, 0, 13043, 28823, 0, 0, 17092,
+    32777, 16493, 17406, 13065, 28735, 12720, 16424, 9132, 0, 0, 28686, 0, 0, 5172, 0, 0,
+    32839, 9972, 13224, 9226, 9443, 0, 28810, 0, 12455, 12504, 0, 0, 0, 0, 12370, 8436,
+    0, 17330, 0, 11749, 28673, 0, 0, 16526, 12297, 0, 28699, 13223, 0, 13186, 0, 16577,
+    16605, 0, 17174, 0, 0, 0, 0, 13031, 16424, 0, 0, 12384, 0, 0, 9980, 0,
+    0, 0, 0, 8939, 0, 0, 28826, 13187, 0, 0, 28685, 12348, 12418, 28721, 0, 32833,
+    13079, 0, 32806, 8687, 13224, 16536, 13077, 13008, 9940, 17395, 0, 12912, 8288, 11778, 9832, 16448,
+    20483, 28732, 0, 0, 0, 0, 0, 28811, 0, 11817, 28800, 0, 16937, 0, 0, 0,
+    16458, 16536, 16605, 11161, 0, 0, 0, 6464, 12900, 0, 0, 13043, 13042, 28791, 12408, 17092,
+    8459, 0, 8324, 13211, 8449, 0, 0, 10581, 16604, 9984, 0, 0, 0, 0, 0, 0,
+    0, 28689, 0, 0, 0, 0, 12077, 0, 0, 0, 9383, 0, 32806, 9269, 0, 12912,
+    0, 32818, 13064, 0, 8639, 0, 16444, 0, 0, 10177, 0, 0, 0, 0, 0, 11806,
+    0, 0, 0, 0, 8323, 28813, 0, 0, 32921, 16836, 0, 0, 17354, 0, 16448, 11769,
+    0, 0, 0, 0, 9065, 0, 28768, 0, 11182, 0, 0, 0, 0, 12924, 28690, 0,
+    0, 0, 0, 0, 0, 28791, 0, 0, 4730, 28791, 32920, 0, 0, 11780, 0, 0,
+    8977, 0, 12419, 0, 10871, 28709, 0, 8637, 0, 28814, 13122, 10584, 0, 13110, 28827, 0,
+    28823, 0, 0, 11161, 0, 32832, 0, 0, 9940, 9272, 0, 0, 0, 0, 32833, 0,
+    32806, 8374, 17395, 0, 28826, 0, 0, 0, 10881, 0, 13040, 0, 8389, 0, 0, 0,
+    10274, 0, 0, 0, 0, 0, 8674, 11470, 0, 0, 11481, 0, 0, 12504, 0, 28821,
+    28720, 0, 0, 0, 12012, 0, 13144, 0, 0, 32819, 0, 0, 0, 17399, 9976, 0,
+    13183, 0, 0, 0, 0, 0, 12011, 0, 0, 0, 0, 0, 0, 0, 0, 9682,
+    0, 0, 0, 0, 17368, 13176, 0, 0, 12492, 0, 0, 12078, 0, 0, 0, 0,
+    0, 0, 0, 0, 28813, 0, 12348, 0, 0, 0, 6457, 0, 28816, 0, 10872, 32806,
+    5125, 28803, 28811, 0, 5878, 0, 0, 28827, 20490, 0, 0, 0, 0, 0, 0, 0,
+    0, 17331, 16526, 0, 0, 0, 12078, 0, 0, 0, 0, 12431, 12324, 0, 0, 0,
+    0, 17253, 0, 12708, 28713, 13002, 0, 0, 0, 0, 0, 17016, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 28814, 0, 13209, 13198, 0, 0, 5129, 0, 0, 0, 0,
+    0, 0, 0, 32781, 8740, 0, 0, 0, 0, 0, 0, 11992, 0, 0, 0, 0,
+    12924, 0, 0, 32781, 5748, 10573, 12936, 0, 9043, 12804, 13187, 12419, 0, 16538, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13079, 0, 0, 10883, 12443, 0, 0, 0, 28824,
+    0, 10573, 13164, 5160, 0, 32910, 32924, 0, 0, 0, 0, 0, 16537, 0, 17409, 0,
+    0, 0, 13086, 12576, 5756, 0, 0, 13160, 0, 0, 0, 0, 8443, 0, 0, 0,
+    0, 0, 0, 0, 0, 28677, 9043, 28674, 0, 11778, 0, 0, 0, 28780, 32794, 0,
+    0, 0, 13044, 13145, 0, 0, 0, 0, 0, 16775, 0, 0, 0, 0, 0, 0,
+    0, 28708, 0, 0, 0, 13122, 0, 0, 0, 0, 0, 0, 28697, 0, 13134, 0,
+    0, 28724, 0, 28767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13199, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 16537, 0, 0, 0, 0, 0, 0, 20490, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13111, 0, 0, 0, 0, 9663, 9920,
+    13212, 0, 17378, 0, 0, 13174, 0, 0, 0, 0, 10582, 0, 0, 0, 8486, 0,
+    0, 13198, 0, 0, 17327, 0, 13188, 0, 0, 0, 0, 0, 16937, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 13144, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32807, 5742, 16773, 0, 12079, 0, 0, 0, 0, 0, 0, 32898, 0, 0,
+    0, 0, 0, 0, 0, 13175, 8443, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13032, 20483, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16455, 0, 0, 0, 0, 9043, 0,
+    13162, 0, 0, 0, 0, 0, 28824, 0, 0, 0, 0, 0, 32833, 0, 0, 0,
+    0, 0, 0, 0, 0, 28768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 12312, 12456, 0, 0, 0, 0, 0, 0, 0, 17332, 0,
+    0, 0, 0, 0, 0, 28823, 0, 0, 0, 0, 0, 0, 0, 0, 32923, 0,
+    0, 28756, 28821, 0, 0, 0, 0, 28825, 0, 0, 0, 28812, 0, 0, 0, 0,
+    0, 0, 28822, 0, 0, 0, 28812, 0, 0, 16612, 0, 13224, 0, 0, 0, 0,
+    0, 0, 0, 17369, 0, 0, 0, 0, 28677, 0, 0, 0, 0, 0, 0, 0,
+    0, 28698, 0, 0, 28816, 0, 0, 0, 0, 0, 0, 0, 0, 13210, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13008, 0, 0, 0, 13175, 0,
+    0, 0, 32820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8453, 17331, 0, 0, 0, 0, 0, 0, 0, 17327, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 11822, 0, 0, 0, 13186, 0, 0, 0, 13032, 0, 0,
+    8744, 0, 0, 12504, 0, 0, 0, 0, 0, 28685, 0, 0, 0, 28677, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13163, 0, 0, 0, 0, 32924, 0, 0, 0, 0, 0,
+    13157, 9326, 0, 11956, 0, 0, 13122, 0, 0, 0, 0, 0, 12372, 0, 17406, 0,
+    0, 0, 0, 0, 0, 0, 0, 32794, 0, 0, 0, 0, 0, 13148, 0, 0,
+    0, 0, 28697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32911,
+    13221, 9040, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 28674, 0, 17399, 0, 0, 0, 0, 0, 0, 0, 9934, 0, 0, 28822,
+    0, 0, 0, 0, 0, 12011, 17253, 0, 0, 28823, 0, 0, 0, 0, 28673, 0,
+    0, 0, 0, 0, 0, 12065, 0, 0, 0, 0, 0, 0, 17398, 0, 0, 0,
+    8425, 17388, 0, 0, 0, 0, 28822, 0, 0, 0, 0, 0, 0, 0, 0, 12432,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5734, 0, 0, 0, 0, 0, 28687, 0, 0, 0, 0, 12456, 13212, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13186, 0, 0, 0, 0, 0, 0, 0, 0, 13176, 0, 0, 0, 13110,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13223, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13176, 0, 0,
+    0, 13020, 13222, 0, 0, 0, 0, 0, 12079, 0, 0, 0, 0, 0, 11956, 0,
+    0, 0, 17388, 13008, 0, 0, 0, 0, 13207, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13224, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 12058, 0, 0, 0, 0, 0, 0, 28768,
+    0, 0, 0, 0, 28825, 0, 0, 0, 0, 13080, 12068, 0, 0, 0, 0, 13200,
+    0, 11778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 17397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28768, 0, 12078, 0, 13212, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 28826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13032, 0, 0, 0, 0, 0, 13198, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 13122, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28821, 13020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12058, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 17331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 28732, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13109, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17409, 0, 12012, 0,
+    0, 28823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13134, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17377, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 12010, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 17399, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28816, 0, 0, 0, 0, 13176, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13224, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32924, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13212, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 17378, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17399, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 17409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28821,
+};
+
+const uint16_t omp::HandEvaluatorBase::FLUSH_LOOKUP[] {
+    24577, 24578, 24579, 24580, 24581, 24582, 24583, 24584, 24585, 24586, 24587, 24588, 24589, 24590, 24591, 24592,
+    24593, 24594, 24595, 24596, 24597, 24598, 24599, 24600, 24601, 24602, 24603, 24604, 24605, 24606, 24607, 36866,
+    24608, 24609, 24610, 24611, 24612, 24613, 24614, 24615, 24616, 24617, 24618, 24619, 24620, 24621, 24622, 24623,
+    24624, 24625, 24626, 24627, 24628, 24629, 24630, 24631, 24632, 24633, 24634, 24635, 24636, 24637, 36867, 36867,
+    24638, 24639, 24640, 24641, 24642, 24643, 24644, 24645, 24646, 24647, 24648, 24649, 24650, 24651, 24652, 24653,
+    24654, 24655, 24656, 24657, 24658, 24659, 24660, 24661, 24662, 24663, 24664, 24665, 24666, 24667, 24668, 36866,
+    24669, 24670, 24671, 24672, 24673, 24674, 24675, 24676, 24677, 24678, 24679, 24680, 24681, 24682, 24683, 24683,
+    24684, 24685, 24686, 24687, 24688, 24689, 24690, 24690, 24691, 24692, 24693, 24693, 36868, 36868, 36868, 36868,
+    24694, 24695, 24696, 24697, 24698, 24699, 24700, 24701, 24702, 24703, 24704, 24705, 24706, 24707, 24708, 24709,
+    24710, 24711, 24712, 24713, 24714, 24715, 24716, 24717, 24718, 24719, 24720, 24721, 24722, 24723, 24724, 36866,
+    24725, 24726, 24727, 24728, 24729, 24730, 24731, 24732, 24733, 24734, 24735, 24736, 24737, 24738, 24739, 24739,
+    24740, 24741, 24742, 24743, 24744, 24745, 24746, 24746, 24747, 24748, 24749, 24749, 24750, 24750, 36867, 36867,
+    24751, 24752, 24753, 24754, 24755, 24756, 24757, 24758, 24759, 24760, 24761, 24762, 24763, 24764, 24765, 24765,
+    24766, 24767, 24768, 24769, 24770, 24771, 24772, 24772, 24773, 24774, 24775, 24775, 24776, 24776, 24776, 36866,
+    24777, 24778, 24779, 24780, 24781, 24782, 24783, 24783, 24784, 24785, 24786, 24786, 24787, 24787, 24787, 24787,
+    24788, 24789, 24790, 24790, 24791, 24791, 24791, 24791, 36869, 36869, 36869, 36869, 36869, 36869, 36869, 0,
+    24792, 24793, 24794, 24795, 24796, 24797, 24798, 24799, 24800, 24801, 24802, 24803, 24804, 24805, 24806, 24807,
+    24808, 24809, 24810, 24811, 24812, 24813, 24814, 24815, 24816, 24817, 24818, 24819, 24820, 24821, 24822, 36866,
+    24823, 24824, 24825, 24826, 24827, 24828, 24829, 24830, 24831, 24832, 24833, 24834, 24835, 24836, 24837, 24837,
+    24838, 24839, 24840, 24841, 24842, 24843, 24844, 24844, 24845, 24846, 24847, 24847, 24848, 24848, 36867, 36867,
+    24849, 24850, 24851, 24852, 24853, 24854, 24855, 24856, 24857, 24858, 24859, 24860, 24861, 24862, 24863, 24863,
+    24864, 24865, 24866, 24867, 24868, 24869, 24870, 24870, 24871, 24872, 24873, 24873, 24874, 24874, 24874, 36866,
+    24875, 24876, 24877, 24878, 24879, 24880, 24881, 24881, 24882, 24883, 24884, 24884, 24885, 24885, 24885, 24885,
+    24886, 24887, 24888, 24888, 24889, 24889, 24889, 24889, 24890, 24890, 24890, 24890, 36868, 36868, 36868, 0,
+    24891, 24892, 24893, 24894, 24895, 24896, 24897, 24898, 24899, 24900, 24901, 24902, 24903, 24904, 24905, 24905,
+    24906, 24907, 24908, 24909, 24910, 24911, 24912, 24912, 24913, 24914, 24915, 24915, 24916, 24916, 24916, 36866,
+    24917, 24918, 24919, 24920, 24921, 24922, 24923, 24923, 24924, 24925, 24926, 24926, 24927, 24927, 24927, 24927,
+    24928, 24929, 24930, 24930, 24931, 24931, 24931, 24931, 24932, 24932, 24932, 24932, 24932, 24932, 36867, 0,
+    24933, 24934, 24935, 24936, 24937, 24938, 24939, 24939, 24940, 24941, 24942, 24942, 24943, 24943, 24943, 24943,
+    24944, 24945, 24946, 24946, 24947, 24947, 24947, 24947, 24948, 24948, 24948, 24948, 24948, 24948, 24948, 0,
+    24949, 24950, 24951, 24951, 24952, 24952, 24952, 24952, 24953, 24953, 24953, 24953, 24953, 24953, 24953, 0,
+    36870, 36870, 36870, 36870, 36870, 36870, 36870, 0, 36870, 36870, 36870, 0, 36870, 0, 0, 0,
+    24954, 24955, 24956, 24957, 24958, 24959, 24960, 24961, 24962, 24963, 24964, 24965, 24966, 24967, 24968, 24969,
+    24970, 24971, 24972, 24973, 24974, 24975, 24976, 24977, 24978, 24979, 24980, 24981, 24982, 24983, 24984, 36866,
+    24985, 24986, 24987, 24988, 24989, 24990, 24991, 24992, 24993, 24994, 24995, 24996, 24997, 24998, 24999, 24999,
+    25000, 25001, 25002, 25003, 25004, 25005, 25006, 25006, 25007, 25008, 25009, 25009, 25010, 25010, 36867, 36867,
+    25011, 25012, 25013, 25014, 25015, 25016, 25017, 25018, 25019, 25020, 25021, 25022, 25023, 25024, 25025, 25025,
+    25026, 25027, 25028, 25029, 25030, 25031, 25032, 25032, 25033, 25034, 25035, 25035, 25036, 25036, 25036, 36866,
+    25037, 25038, 25039, 25040, 25041, 25042, 25043, 25043, 25044, 25045, 25046, 25046, 25047, 25047, 25047, 25047,
+    25048, 25049, 25050, 25050, 25051, 25051, 25051, 25051, 25052, 25052, 25052, 25052, 36868, 36868, 36868, 0,
+    25053, 25054, 25055, 25056, 25057, 25058, 25059, 25060, 25061, 25062, 25063, 25064, 25065, 25066, 25067, 25067,
+    25068, 25069, 25070, 25071, 25072, 25073, 25074, 25074, 25075, 25076, 25077, 25077, 25078, 25078, 25078, 36866,
+    25079, 25080, 25081, 25082, 25083, 25084, 25085, 25085, 25086, 25087, 25088, 25088, 25089, 25089, 25089, 25089,
+    25090, 25091, 25092, 25092, 25093, 25093, 25093, 25093, 25094, 25094, 25094, 25094, 25094, 25094, 36867, 0,
+    25095, 25096, 25097, 25098, 25099, 25100, 25101, 25101, 25102, 25103, 25104, 25104, 25105, 25105, 25105, 25105,
+    25106, 25107, 25108, 25108, 25109, 25109, 25109, 25109, 25110, 25110, 25110, 25110, 25110, 25110, 25110, 0,
+    25111, 25112, 25113, 25113, 25114, 25114, 25114, 25114, 25115, 25115, 25115, 25115, 25115, 25115, 25115, 0,
+    25116, 25116, 25116, 25116, 25116, 25116, 25116, 0, 36869, 36869, 36869, 0, 36869, 0, 0, 0,
+    25117, 25118, 25119, 25120, 25121, 25122, 25123, 25124, 25125, 25126, 25127, 25128, 25129, 25130, 25131, 25131,
+    25132, 25133, 25134, 25135, 25136, 25137, 25138, 25138, 25139, 25140, 25141, 25141, 25142, 25142, 25142, 36866,
+    25143, 25144, 25145, 25146, 25147, 25148, 25149, 25149, 25150, 25151, 25152, 25152, 25153, 25153, 25153, 25153,
+    25154, 25155, 25156, 25156, 25157, 25157, 25157, 25157, 25158, 25158, 25158, 25158, 25158, 25158, 36867, 0,
+    25159, 25160, 25161, 25162, 25163, 25164, 25165, 25165, 25166, 25167, 25168, 25168, 25169, 25169, 25169, 25169,
+    25170, 25171, 25172, 25172, 25173, 25173, 25173, 25173, 25174, 25174, 25174, 25174, 25174, 25174, 25174, 0,
+    25175, 25176, 25177, 25177, 25178, 25178, 25178, 25178, 25179, 25179, 25179, 25179, 25179, 25179, 25179, 0,
+    25180, 25180, 25180, 25180, 25180, 25180, 25180, 0, 25180, 25180, 25180, 0, 36868, 0, 0, 0,
+    25181, 25182, 25183, 25184, 25185, 25186, 25187, 25187, 25188, 25189, 25190, 25190, 25191, 25191, 25191, 25191,
+    25192, 25193, 25194, 25194, 25195, 25195, 25195, 25195, 25196, 25196, 25196, 25196, 25196, 25196, 25196, 0,
+    25197, 25198, 25199, 25199, 25200, 25200, 25200, 25200, 25201, 25201, 25201, 25201, 25201, 25201, 25201, 0,
+    25202, 25202, 25202, 25202, 25202, 25202, 25202, 0, 25202, 25202, 25202, 0, 25202, 0, 0, 0,
+    25203, 25204, 25205, 25205, 25206, 25206, 25206, 25206, 25207, 25207, 25207, 25207, 25207, 25207, 25207, 0,
+    25208, 25208, 25208, 25208, 25208, 25208, 25208, 0, 25208, 25208, 25208, 0, 25208, 0, 0, 0,
+    36871, 36871, 36871, 36871, 36871, 36871, 36871, 0, 36871, 36871, 36871, 0, 36871, 0, 0, 0,
+    36871, 36871, 36871, 0, 36871, 0, 0, 0, 36871, 0, 0, 0, 0, 0, 0, 0,
+    25209, 25210, 25211, 25212, 25213, 25214, 25215, 25216, 25217, 25218, 25219, 25220, 25221, 25222, 25223, 25224,
+    25225, 25226, 25227, 25228, 25229, 25230, 25231, 25232, 25233, 25234, 25235, 25236, 25237, 25238, 25239, 36866,
+    25240, 25241, 25242, 25243, 25244, 25245, 25246, 25247, 25248, 25249, 25250, 25251, 25252, 25253, 25254, 25254,
+    25255, 25256, 25257, 25258, 25259, 25260, 25261, 25261, 25262, 25263, 25264, 25264, 25265, 25265, 36867, 36867,
+    25266, 25267, 25268, 25269, 25270, 25271, 25272, 25273, 25274, 25275, 25276, 25277, 25278, 25279, 25280, 25280,
+    25281, 25282, 25283, 25284, 25285, 25286, 25287, 25287, 25288, 25289, 25290, 25290, 25291, 25291, 25291, 36866,
+    25292, 25293, 25294, 25295, 25296, 25297, 25298, 25298, 25299, 25300, 25301, 25301, 25302, 25302, 25302, 25302,
+    25303, 25304, 25305, 25305, 25306, 25306, 25306, 25306, 25307, 25307, 25307, 25307, 36868, 36868, 36868, 0,
+    25308, 25309, 25310, 25311, 25312, 25313, 25314, 25315, 25316, 25317, 25318, 25319, 25320, 25321, 25322, 25322,
+    25323, 25324, 25325, 25326, 25327, 25328, 25329, 25329, 25330, 25331, 25332, 25332, 25333, 25333, 25333, 36866,
+    25334, 25335, 25336, 25337, 25338, 25339, 25340, 25340, 25341, 25342, 25343, 25343, 25344, 25344, 25344, 25344,
+    25345, 25346, 25347, 25347, 25348, 25348, 25348, 25348, 25349, 25349, 25349, 25349, 25349, 25349, 36867, 0,
+    25350, 25351, 25352, 25353, 25354, 25355, 25356, 25356, 25357, 25358, 25359, 25359, 25360, 25360, 25360, 25360,
+    25361, 25362, 25363, 25363, 25364, 25364, 25364, 25364, 25365, 25365, 25365, 25365, 25365, 25365, 25365, 0,
+    25366, 25367, 25368, 25368, 25369, 25369, 25369, 25369, 25370, 25370, 25370, 25370, 25370, 25370, 25370, 0,
+    25371, 25371, 25371, 25371, 25371, 25371, 25371, 0, 36869, 36869, 36869, 0, 36869, 0, 0, 0,
+    25372, 25373, 25374, 25375, 25376, 25377, 25378, 25379, 25380, 25381, 25382, 25383, 25384, 25385, 25386, 25386,
+    25387, 25388, 25389, 25390, 25391, 25392, 25393, 25393, 25394, 25395, 25396, 25396, 25397, 25397, 25397, 36866,
+    25398, 25399, 25400, 25401, 25402, 25403, 25404, 25404, 25405, 25406, 25407, 25407, 25408, 25408, 25408, 25408,
+    25409, 25410, 25411, 25411, 25412, 25412, 25412, 25412, 25413, 25413, 25413, 25413, 25413, 25413, 36867, 0,
+    25414, 25415, 25416, 25417, 25418, 25419, 25420, 25420, 25421, 25422, 25423, 25423, 25424, 25424, 25424, 25424,
+    25425, 25426, 25427, 25427, 25428, 25428, 25428, 25428, 25429, 25429, 25429, 25429, 25429, 25429, 25429, 0,
+    25430, 25431, 25432, 25432, 25433, 25433, 25433, 25433, 25434, 25434, 25434, 25434, 25434, 25434, 25434, 0,
+    25435, 25435, 25435, 25435, 25435, 25435, 25435, 0, 25435, 25435, 25435, 0, 36868, 0, 0, 0,
+    25436, 25437, 25438, 25439, 25440, 25441, 25442, 25442, 25443, 25444, 25445, 25445, 25446, 25446, 25446, 25446,
+    25447, 25448, 25449, 25449, 25450, 25450, 25450, 25450, 25451, 25451, 25451, 25451, 25451, 25451, 25451, 0,
+    25452, 25453, 25454, 25454, 25455, 25455, 25455, 25455, 25456, 25456, 25456, 25456, 25456, 25456, 25456, 0,
+    25457, 25457, 25457, 25457, 25457, 25457, 25457, 0, 25457, 25457, 25457, 0, 25457, 0, 0, 0,
+    25458, 25459, 25460, 25460, 25461, 25461, 25461, 25461, 25462, 25462, 25462, 25462, 25462, 25462, 25462, 0,
+    25463, 25463, 25463, 25463, 25463, 25463, 25463, 0, 25463, 25463, 25463, 0, 25463, 0, 0, 0,
+    25464, 25464, 25464, 25464, 25464, 25464, 25464, 0, 25464, 25464, 25464, 0, 25464, 0, 0, 0,
+    36870, 36870, 36870, 0, 36870, 0, 0, 0, 36870, 0, 0, 0, 0, 0, 0, 0,
+    25465, 25466, 25467, 25468, 25469, 25470, 25471, 25472, 25473, 25474, 25475, 25476, 25477, 25478, 25479, 25479,
+    25480, 25481, 25482, 25483, 25484, 25485, 25486, 25486, 25487, 25488, 25489, 25489, 25490, 25490, 25490, 36866,
+    25491, 25492, 25493, 25494, 25495, 25496, 25497, 25497, 25498, 25499, 25500, 25500, 25501, 25501, 25501, 25501,
+    25502, 25503, 25504, 25504, 25505, 25505, 25505, 25505, 25506, 25506, 25506, 25506, 25506, 25506, 36867, 0,
+    25507, 25508, 25509, 25510, 25511, 25512, 25513, 25513, 25514, 25515, 25516, 25516, 25517, 25517, 25517, 25517,
+    25518, 25519, 25520, 25520, 25521, 25521, 25521, 25521, 25522, 25522, 25522, 25522, 25522, 25522, 25522, 0,
+    25523, 25524, 25525, 25525, 25526, 25526, 25526, 25526, 25527, 25527, 25527, 25527, 25527, 25527, 25527, 0,
+    25528, 25528, 25528, 25528, 25528, 25528, 25528, 0, 25528, 25528, 25528, 0, 36868, 0, 0, 0,
+    25529, 25530, 25531, 25532, 25533, 25534, 25535, 25535, 25536, 25537, 25538, 25538, 25539, 25539, 25539, 25539,
+    25540, 25541, 25542, 25542, 25543, 25543, 25543, 25543, 25544, 25544, 25544, 25544, 25544, 25544, 25544, 0,
+    25545, 25546, 25547, 25547, 25548, 25548, 25548, 25548, 25549, 25549, 25549, 25549, 25549, 25549, 25549, 0,
+    25550, 25550, 25550, 25550, 25550, 25550, 25550, 0, 25550, 25550, 25550, 0, 25550, 0, 0, 0,
+    25551, 25552, 25553, 25553, 25554, 25554, 25554, 25554, 25555, 25555, 25555, 25555, 25555, 25555, 25555, 0,
+    25556, 25556, 25556, 25556, 25556, 25556, 25556, 0, 25556, 25556, 25556, 0, 25556, 0, 0, 0,
+    25557, 25557, 25557, 25557, 25557, 25557, 25557, 0, 25557, 25557, 25557, 0, 25557, 0, 0, 0,
+    25557, 25557, 25557, 0, 25557, 0, 0, 0, 36869, 0, 0, 0, 0, 0, 0, 0,
+    25558, 25559, 25560, 25561, 25562, 25563, 25564, 25564, 25565, 25566, 25567, 25567, 25568, 25568, 25568, 25568,
+    25569, 25570, 25571, 25571, 25572, 25572, 25572, 25572, 25573, 25573, 25573, 25573, 25573, 25573, 25573, 0,
+    25574, 25575, 25576, 25576, 25577, 25577, 25577, 25577, 25578, 25578, 25578, 25578, 25578, 25578, 25578, 0,
+    25579, 25579, 25579, 25579, 25579, 25579, 25579, 0, 25579, 25579, 25579, 0, 25579, 0, 0, 0,
+    25580, 25581, 25582, 25582, 25583, 25583, 25583, 25583, 25584, 25584, 25584, 25584, 25584, 25584, 25584, 0,
+    25585, 25585, 25585, 25585, 25585, 25585, 25585, 0, 25585, 25585, 25585, 0, 25585, 0, 0, 0,
+    25586, 25586, 25586, 25586, 25586, 25586, 25586, 0, 25586, 25586, 25586, 0, 25586, 0, 0, 0,
+    25586, 25586, 25586, 0, 25586, 0, 0, 0, 25586, 0, 0, 0, 0, 0, 0, 0,
+    25587, 25588, 25589, 25589, 25590, 25590, 25590, 25590, 25591, 25591, 25591, 25591, 25591, 25591, 25591, 0,
+    25592, 25592, 25592, 25592, 25592, 25592, 25592, 0, 25592, 25592, 25592, 0, 25592, 0, 0, 0,
+    25593, 25593, 25593, 25593, 25593, 25593, 25593, 0, 25593, 25593, 25593, 0, 25593, 0, 0, 0,
+    25593, 25593, 25593, 0, 25593, 0, 0, 0, 25593, 0, 0, 0, 0, 0, 0, 0,
+    36872, 36872, 36872, 36872, 36872, 36872, 36872, 0, 36872, 36872, 36872, 0, 36872, 0, 0, 0,
+    36872, 36872, 36872, 0, 36872, 0, 0, 0, 36872, 0, 0, 0, 0, 0, 0, 0,
+    36872, 36872, 36872, 0, 36872, 0, 0, 0, 36872, 0, 0, 0, 0, 0, 0, 0,
+    36872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    25594, 25595, 25596, 25597, 25598, 25599, 25600, 25601, 25602, 25603, 25604, 25605, 25606, 25607, 25608, 25609,
+    25610, 25611, 25612, 25613, 25614, 25615, 25616, 25617, 25618, 25619, 25620, 25621, 25622, 25623, 25624, 36866,
+    25625, 25626, 25627, 25628, 25629, 25630, 25631, 25632, 25633, 25634, 25635, 25636, 25637, 25638, 25639, 25639,
+    25640, 25641, 25642, 25643, 25644, 25645, 25646, 25646, 25647, 25648, 25649, 25649, 25650, 25650, 36867, 36867,
+    25651, 25652, 25653, 25654, 25655, 25656, 25657, 25658, 25659, 25660, 25661, 25662, 25663, 25664, 25665, 25665,
+    25666, 25667, 25668, 25669, 25670, 25671, 25672, 25672, 25673, 25674, 25675, 25675, 25676, 25676, 25676, 36866,
+    25677, 25678, 25679, 25680, 25681, 25682, 25683, 25683, 25684, 25685, 25686, 25686, 25687, 25687, 25687, 25687,
+    25688, 25689, 25690, 25690, 25691, 25691, 25691, 25691, 25692, 25692, 25692, 25692, 36868, 36868, 36868, 0,
+    25693, 25694, 25695, 25696, 25697, 25698, 25699, 25700, 25701, 25702, 25703, 25704, 25705, 25706, 25707, 25707,
+    25708, 25709, 25710, 25711, 25712, 25713, 25714, 25714, 25715, 25716, 25717, 25717, 25718, 25718, 25718, 36866,
+    25719, 25720, 25721, 25722, 25723, 25724, 25725, 25725, 25726, 25727, 25728, 25728, 25729, 25729, 25729, 25729,
+    25730, 25731, 25732, 25732, 25733, 25733, 25733, 25733, 25734, 25734, 25734, 25734, 25734, 25734, 36867, 0,
+    25735, 25736, 25737, 25738, 25739, 25740, 25741, 25741, 25742, 25743, 25744, 25744, 25745, 25745, 25745, 25745,
+    25746, 25747, 25748, 25748, 25749, 25749, 25749, 25749, 25750, 25750, 25750, 25750, 25750, 25750, 25750, 0,
+    25751, 25752, 25753, 25753, 25754, 25754, 25754, 25754, 25755, 25755, 25755, 25755, 25755, 25755, 25755, 0,
+    25756, 25756, 25756, 25756, 25756, 25756, 25756, 0, 36869, 36869, 36869, 0, 36869, 0, 0, 0,
+    25757, 25758, 25759, 25760, 25761, 25762, 25763, 25764, 25765, 25766, 25767, 25768, 25769, 25770, 25771, 25771,
+    25772, 25773, 25774, 25775, 25776, 25777, 25778, 25778, 25779, 25780, 25781, 25781, 25782, 25782, 25782, 36866,
+    25783, 25784, 25785, 25786, 25787, 25788, 25789, 25789, 25790, 25791, 25792, 25792, 25793, 25793, 25793, 25793,
+    25794, 25795, 25796, 25796, 25797, 25797, 25797, 25797, 25798, 25798, 25798, 25798, 25798, 25798, 36867, 0,
+    25799, 25800, 25801, 25802, 25803, 25804, 25805, 25805, 25806, 25807, 25808, 25808, 25809, 25809, 25809, 25809,
+    25810, 25811, 25812, 25812, 25813, 25813, 25813, 25813, 25814, 25814, 25814, 25814, 25814, 25814, 25814, 0,
+    25815, 25816, 25817, 25817, 25818, 25818, 25818, 25818, 25819, 25819, 25819, 25819, 25819, 25819, 25819, 0,
+    25820, 25820, 25820, 25820, 25820, 25820, 25820, 0, 25820, 25820, 25820, 0, 36868, 0, 0, 0,
+    25821, 25822, 25823, 25824, 25825, 25826, 25827, 25827, 25828, 25829, 25830, 25830, 25831, 25831, 25831, 25831,
+    25832, 25833, 25834, 25834, 25835, 25835, 25835, 25835, 25836, 25836, 25836, 25836, 25836, 25836, 25836, 0,
+    25837, 25838, 25839, 25839, 25840, 25840, 25840, 25840, 25841, 25841, 25841, 25841, 25841, 25841, 25841, 0,
+    25842, 25842, 25842, 25842, 25842, 25842, 25842, 0, 25842, 25842, 25842, 0, 25842, 0, 0, 0,
+    25843, 25844, 25845, 25845, 25846, 25846, 25846, 25846, 25847, 25847, 25847, 25847, 25847, 25847, 25847, 0,
+    25848, 25848, 25848, 25848, 25848, 25848, 25848, 0, 25848, 25848, 25848, 0, 25848, 0, 0, 0,
+    25849, 25849, 25849, 25849, 25849, 25849, 25849, 0, 25849, 25849, 25849, 0, 25849, 0, 0, 0,
+    36870, 36870, 36870, 0, 36870, 0, 0, 0, 36870, 0, 0, 0, 0, 0, 0, 0,
+    25850, 25851, 25852, 25853, 25854, 25855, 25856, 25857, 25858, 25859, 25860, 25861, 25862, 25863, 25864, 25864,
+    25865, 25866, 25867, 25868, 25869, 25870, 25871, 25871, 25872, 25873, 25874, 25874, 25875, 25875, 25875, 36866,
+    25876, 25877, 25878, 25879, 25880, 25881, 25882, 25882, 25883, 25884, 25885, 25885, 25886, 25886, 25886, 25886,
+    25887, 25888, 25889, 25889, 25890, 25890, 25890, 25890, 25891, 25891, 25891, 25891, 25891, 25891, 36867, 0,
+    25892, 25893, 25894, 25895, 25896, 25897, 25898, 25898, 25899, 25900, 25901, 25901, 25902, 25902, 25902, 25902,
+    25903, 25904, 25905, 25905, 25906, 25906, 25906, 25906, 25907, 25907, 25907, 25907, 25907, 25907, 25907, 0,
+    25908, 25909, 25910, 25910, 25911, 25911, 25911, 25911, 25912, 25912, 25912, 25912, 25912, 25912, 25912, 0,
+    25913, 25913, 25913, 25913, 25913, 25913, 25913, 0, 25913, 25913, 25913, 0, 36868, 0, 0, 0,
+    25914, 25915, 25916, 25917, 25918, 25919, 25920, 25920, 25921, 25922, 25923, 25923, 25924, 25924, 25924, 25924,
+    25925, 25926, 25927, 25927, 25928, 25928, 25928, 25928, 25929, 25929, 25929, 25929, 25929, 25929, 25929, 0,
+    25930, 25931, 25932, 25932, 25933, 25933, 25933, 25933, 25934, 25934, 25934, 25934, 25934, 25934, 25934, 0,
+    25935, 25935, 25935, 25935, 25935, 25935, 25935, 0, 25935, 25935, 25935, 0, 25935, 0, 0, 0,
+    25936, 25937, 25938, 25938, 25939, 25939, 25939, 25939, 25940, 25940, 25940, 25940, 25940, 25940, 25940, 0,
+    25941, 25941, 25941, 25941, 25941, 25941, 25941, 0, 25941, 25941, 25941, 0, 25941, 0, 0, 0,
+    25942, 25942, 25942, 25942, 25942, 25942, 25942, 0, 25942, 25942, 25942, 0, 25942, 0, 0, 0,
+    25942, 25942, 25942, 0, 25942, 0, 0, 0, 36869, 0, 0, 0, 0, 0, 0, 0,
+    25943, 25944, 25945, 25946, 25947, 25948, 25949, 25949, 25950, 25951, 25952, 25952, 25953, 25953, 25953, 25953,
+    25954, 25955, 25956, 25956, 25957, 25957, 25957, 25957, 25958, 25958, 25958, 25958, 25958, 25958, 25958, 0,
+    25959, 25960, 25961, 25961, 25962, 25962, 25962, 25962, 25963, 25963, 25963, 25963, 25963, 25963, 25963, 0,
+    25964, 25964, 25964, 25964, 25964, 25964, 25964, 0, 25964, 25964, 25964, 0, 25964, 0, 0, 0,
+    25965, 25966, 25967, 25967, 25968, 25968, 25968, 25968, 25969, 25969, 25969, 25969, 25969, 25969, 25969, 0,
+    25970, 25970, 25970, 25970, 25970, 25970, 25970, 0, 25970, 25970, 25970, 0, 25970, 0, 0, 0,
+    25971, 25971, 25971, 25971, 25971, 25971, 25971, 0, 25971, 25971, 25971, 0, 25971, 0, 0, 0,
+    25971, 25971, 25971, 0, 25971, 0, 0, 0, 25971, 0, 0, 0, 0, 0, 0, 0,
+    25972, 25973, 25974, 25974, 25975, 25975, 25975, 25975, 25976, 25976, 25976, 25976, 25976, 25976, 25976, 0,
+    25977, 25977, 25977, 25977, 25977, 25977, 25977, 0, 25977, 25977, 25977, 0, 25977, 0, 0, 0,
+    25978, 25978, 25978, 25978, 25978, 25978, 25978, 0, 25978, 25978, 25978, 0, 25978, 0, 0, 0,
+    25978, 25978, 25978, 0, 25978, 0, 0, 0, 25978, 0, 0, 0, 0, 0, 0, 0,
+    25979, 25979, 25979, 25979, 25979, 25979, 25979, 0, 25979, 25979, 25979, 0, 25979, 0, 0, 0,
+    25979, 25979, 25979, 0, 25979, 0, 0, 0, 25979, 0, 0, 0, 0, 0, 0, 0,
+    36871, 36871, 36871, 0, 36871, 0, 0, 0, 36871, 0, 0, 0, 0, 0, 0, 0,
+    36871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    25980, 25981, 25982, 25983, 25984, 25985, 25986, 25987, 25988, 25989, 25990, 25991, 25992, 25993, 25994, 25994,
+    25995, 25996, 25997, 25998, 25999, 26000, 26001, 26001, 26002, 26003, 26004, 26004, 26005, 26005, 26005, 36866,
+    26006, 26007, 26008, 26009, 26010, 26011, 26012, 26012, 26013, 26014, 26015, 26015, 26016, 26016, 26016, 26016,
+    26017, 26018, 26019, 26019, 26020, 26020, 26020, 26020, 26021, 26021, 26021, 26021, 26021, 26021, 36867, 0,
+    26022, 26023, 26024, 26025, 26026, 26027, 26028, 26028, 26029, 26030, 26031, 26031, 26032, 26032, 26032, 26032,
+    26033, 26034, 26035, 26035, 26036, 26036, 26036, 26036, 26037, 26037, 26037, 26037, 26037, 26037, 26037, 0,
+    26038, 26039, 26040, 26040, 26041, 26041, 26041, 26041, 26042, 26042, 26042, 26042, 26042, 26042, 26042, 0,
+    26043, 26043, 26043, 26043, 26043, 26043, 26043, 0, 26043, 26043, 26043, 0, 36868, 0, 0, 0,
+    26044, 26045, 26046, 26047, 26048, 26049, 26050, 26050, 26051, 26052, 26053, 26053, 26054, 26054, 26054, 26054,
+    26055, 26056, 26057, 26057, 26058, 26058, 26058, 26058, 26059, 26059, 26059, 26059, 26059, 26059, 26059, 0,
+    26060, 26061, 26062, 26062, 26063, 26063, 26063, 26063, 26064, 26064, 26064, 26064, 26064, 26064, 26064, 0,
+    26065, 26065, 26065, 26065, 26065, 26065, 26065, 0, 26065, 26065, 26065, 0, 26065, 0, 0, 0,
+    26066, 26067, 26068, 26068, 26069, 26069, 26069, 26069, 26070, 26070, 26070, 26070, 26070, 26070, 26070, 0,
+    26071, 26071, 26071, 26071, 26071, 26071, 26071, 0, 26071, 26071, 26071, 0, 26071, 0, 0, 0,
+    26072, 26072, 26072, 26072, 26072, 26072, 26072, 0, 26072, 26072, 26072, 0, 26072, 0, 0, 0,
+    26072, 26072, 26072, 0, 26072, 0, 0, 0, 36869, 0, 0, 0, 0, 0, 0, 0,
+    26073, 26074, 26075, 26076, 26077, 26078, 26079, 26079, 26080, 26081, 26082, 26082, 26083, 26083, 26083, 26083,
+    26084, 26085, 26086, 26086, 26087, 26087, 26087, 26087, 26088, 26088, 26088, 26088, 26088, 26088, 26088, 0,
+    26089, 26090, 26091, 26091, 26092, 26092, 26092, 26092, 26093, 26093, 26093, 26093, 26093, 26093, 26093, 0,
+    26094, 26094, 26094, 26094, 26094, 26094, 26094, 0, 26094, 26094, 26094, 0, 26094, 0, 0, 0,
+    26095, 26096, 26097, 26097, 26098, 26098, 26098, 26098, 26099, 26099, 26099, 26099, 26099, 26099, 26099, 0,
+    26100, 26100, 26100, 26100, 26100, 26100, 26100, 0, 26100, 26100, 26100, 0, 26100, 0, 0, 0,
+    26101, 26101, 26101, 26101, 26101, 26101, 26101, 0, 26101, 26101, 26101, 0, 26101, 0, 0, 0,
+    26101, 26101, 26101, 0, 26101, 0, 0, 0, 26101, 0, 0, 0, 0, 0, 0, 0,
+    26102, 26103, 26104, 26104, 26105, 26105, 26105, 26105, 26106, 26106, 26106, 26106, 26106, 26106, 26106, 0,
+    26107, 26107, 26107, 26107, 26107, 26107, 26107, 0, 26107, 26107, 26107, 0, 26107, 0, 0, 0,
+    26108, 26108, 26108, 26108, 26108, 26108, 26108, 0, 26108, 26108, 26108, 0, 26108, 0, 0, 0,
+    26108, 26108, 26108, 0, 26108, 0, 0, 0, 26108, 0, 0, 0, 0, 0, 0, 0,
+    26109, 26109, 26109, 26109, 26109, 26109, 26109, 0, 26109, 26109, 26109, 0, 26109, 0, 0, 0,
+    26109, 26109, 26109, 0, 26109, 0, 0, 0, 26109, 0, 0, 0, 0, 0, 0, 0,
+    26109, 26109, 26109, 0, 26109, 0, 0, 0, 26109, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26110, 26111, 26112, 26113, 26114, 26115, 26116, 26116, 26117, 26118, 26119, 26119, 26120, 26120, 26120, 26120,
+    26121, 26122, 26123, 26123, 26124, 26124, 26124, 26124, 26125, 26125, 26125, 26125, 26125, 26125, 26125, 0,
+    26126, 26127, 26128, 26128, 26129, 26129, 26129, 26129, 26130, 26130, 26130, 26130, 26130, 26130, 26130, 0,
+    26131, 26131, 26131, 26131, 26131, 26131, 26131, 0, 26131, 26131, 26131, 0, 26131, 0, 0, 0,
+    26132, 26133, 26134, 26134, 26135, 26135, 26135, 26135, 26136, 26136, 26136, 26136, 26136, 26136, 26136, 0,
+    26137, 26137, 26137, 26137, 26137, 26137, 26137, 0, 26137, 26137, 26137, 0, 26137, 0, 0, 0,
+    26138, 26138, 26138, 26138, 26138, 26138, 26138, 0, 26138, 26138, 26138, 0, 26138, 0, 0, 0,
+    26138, 26138, 26138, 0, 26138, 0, 0, 0, 26138, 0, 0, 0, 0, 0, 0, 0,
+    26139, 26140, 26141, 26141, 26142, 26142, 26142, 26142, 26143, 26143, 26143, 26143, 26143, 26143, 26143, 0,
+    26144, 26144, 26144, 26144, 26144, 26144, 26144, 0, 26144, 26144, 26144, 0, 26144, 0, 0, 0,
+    26145, 26145, 26145, 26145, 26145, 26145, 26145, 0, 26145, 26145, 26145, 0, 26145, 0, 0, 0,
+    26145, 26145, 26145, 0, 26145, 0, 0, 0, 26145, 0, 0, 0, 0, 0, 0, 0,
+    26146, 26146, 26146, 26146, 26146, 26146, 26146, 0, 26146, 26146, 26146, 0, 26146, 0, 0, 0,
+    26146, 26146, 26146, 0, 26146, 0, 0, 0, 26146, 0, 0, 0, 0, 0, 0, 0,
+    26146, 26146, 26146, 0, 26146, 0, 0, 0, 26146, 0, 0, 0, 0, 0, 0, 0,
+    26146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26147, 26148, 26149, 26149, 26150, 26150, 26150, 26150, 26151, 26151, 26151, 26151, 26151, 26151, 26151, 0,
+    26152, 26152, 26152, 26152, 26152, 26152, 26152, 0, 26152, 26152, 26152, 0, 26152, 0, 0, 0,
+    26153, 26153, 26153, 26153, 26153, 26153, 26153, 0, 26153, 26153, 26153, 0, 26153, 0, 0, 0,
+    26153, 26153, 26153, 0, 26153, 0, 0, 0, 26153, 0, 0, 0, 0, 0, 0, 0,
+    26154, 26154, 26154, 26154, 26154, 26154, 26154, 0, 26154, 26154, 26154, 0, 26154, 0, 0, 0,
+    26154, 26154, 26154, 0, 26154, 0, 0, 0, 26154, 0, 0, 0, 0, 0, 0, 0,
+    26154, 26154, 26154, 0, 26154, 0, 0, 0, 26154, 0, 0, 0, 0, 0, 0, 0,
+    26154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36873, 36873, 36873, 36873, 36873, 36873, 36873, 0, 36873, 36873, 36873, 0, 36873, 0, 0, 0,
+    36873, 36873, 36873, 0, 36873, 0, 0, 0, 36873, 0, 0, 0, 0, 0, 0, 0,
+    36873, 36873, 36873, 0, 36873, 0, 0, 0, 36873, 0, 0, 0, 0, 0, 0, 0,
+    36873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36873, 36873, 36873, 0, 36873, 0, 0, 0, 36873, 0, 0, 0, 0, 0, 0, 0,
+    36873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26155, 26156, 26157, 26158, 26159, 26160, 26161, 26162, 26163, 26164, 26165, 26166, 26167, 26168, 26169, 36865,
+    26170, 26171, 26172, 26173, 26174, 26175, 26176, 26177, 26178, 26179, 26180, 26181, 26182, 26183, 26184, 36866,
+    26185, 26186, 26187, 26188, 26189, 26190, 26191, 26192, 26193, 26194, 26195, 26196, 26197, 26198, 26199, 36865,
+    26200, 26201, 26202, 26203, 26204, 26205, 26206, 26206, 26207, 26208, 26209, 26209, 26210, 26210, 36867, 36867,
+    26211, 26212, 26213, 26214, 26215, 26216, 26217, 26218, 26219, 26220, 26221, 26222, 26223, 26224, 26225, 36865,
+    26226, 26227, 26228, 26229, 26230, 26231, 26232, 26232, 26233, 26234, 26235, 26235, 26236, 26236, 26236, 36866,
+    26237, 26238, 26239, 26240, 26241, 26242, 26243, 26243, 26244, 26245, 26246, 26246, 26247, 26247, 26247, 36865,
+    26248, 26249, 26250, 26250, 26251, 26251, 26251, 26251, 26252, 26252, 26252, 26252, 36868, 36868, 36868, 0,
+    26253, 26254, 26255, 26256, 26257, 26258, 26259, 26260, 26261, 26262, 26263, 26264, 26265, 26266, 26267, 36865,
+    26268, 26269, 26270, 26271, 26272, 26273, 26274, 26274, 26275, 26276, 26277, 26277, 26278, 26278, 26278, 36866,
+    26279, 26280, 26281, 26282, 26283, 26284, 26285, 26285, 26286, 26287, 26288, 26288, 26289, 26289, 26289, 36865,
+    26290, 26291, 26292, 26292, 26293, 26293, 26293, 26293, 26294, 26294, 26294, 26294, 26294, 26294, 36867, 0,
+    26295, 26296, 26297, 26298, 26299, 26300, 26301, 26301, 26302, 26303, 26304, 26304, 26305, 26305, 26305, 36865,
+    26306, 26307, 26308, 26308, 26309, 26309, 26309, 26309, 26310, 26310, 26310, 26310, 26310, 26310, 26310, 0,
+    26311, 26312, 26313, 26313, 26314, 26314, 26314, 26314, 26315, 26315, 26315, 26315, 26315, 26315, 26315, 0,
+    26316, 26316, 26316, 26316, 26316, 26316, 26316, 0, 36869, 36869, 36869, 0, 36869, 0, 0, 0,
+    26317, 26318, 26319, 26320, 26321, 26322, 26323, 26324, 26325, 26326, 26327, 26328, 26329, 26330, 26331, 36865,
+    26332, 26333, 26334, 26335, 26336, 26337, 26338, 26338, 26339, 26340, 26341, 26341, 26342, 26342, 26342, 36866,
+    26343, 26344, 26345, 26346, 26347, 26348, 26349, 26349, 26350, 26351, 26352, 26352, 26353, 26353, 26353, 36865,
+    26354, 26355, 26356, 26356, 26357, 26357, 26357, 26357, 26358, 26358, 26358, 26358, 26358, 26358, 36867, 0,
+    26359, 26360, 26361, 26362, 26363, 26364, 26365, 26365, 26366, 26367, 26368, 26368, 26369, 26369, 26369, 36865,
+    26370, 26371, 26372, 26372, 26373, 26373, 26373, 26373, 26374, 26374, 26374, 26374, 26374, 26374, 26374, 0,
+    26375, 26376, 26377, 26377, 26378, 26378, 26378, 26378, 26379, 26379, 26379, 26379, 26379, 26379, 26379, 0,
+    26380, 26380, 26380, 26380, 26380, 26380, 26380, 0, 26380, 26380, 26380, 0, 36868, 0, 0, 0,
+    26381, 26382, 26383, 26384, 26385, 26386, 26387, 26387, 26388, 26389, 26390, 26390, 26391, 26391, 26391, 36865,
+    26392, 26393, 26394, 26394, 26395, 26395, 26395, 26395, 26396, 26396, 26396, 26396, 26396, 26396, 26396, 0,
+    26397, 26398, 26399, 26399, 26400, 26400, 26400, 26400, 26401, 26401, 26401, 26401, 26401, 26401, 26401, 0,
+    26402, 26402, 26402, 26402, 26402, 26402, 26402, 0, 26402, 26402, 26402, 0, 26402, 0, 0, 0,
+    26403, 26404, 26405, 26405, 26406, 26406, 26406, 26406, 26407, 26407, 26407, 26407, 26407, 26407, 26407, 0,
+    26408, 26408, 26408, 26408, 26408, 26408, 26408, 0, 26408, 26408, 26408, 0, 26408, 0, 0, 0,
+    26409, 26409, 26409, 26409, 26409, 26409, 26409, 0, 26409, 26409, 26409, 0, 26409, 0, 0, 0,
+    36870, 36870, 36870, 0, 36870, 0, 0, 0, 36870, 0, 0, 0, 0, 0, 0, 0,
+    26410, 26411, 26412, 26413, 26414, 26415, 26416, 26417, 26418, 26419, 26420, 26421, 26422, 26423, 26424, 36865,
+    26425, 26426, 26427, 26428, 26429, 26430, 26431, 26431, 26432, 26433, 26434, 26434, 26435, 26435, 26435, 36866,
+    26436, 26437, 26438, 26439, 26440, 26441, 26442, 26442, 26443, 26444, 26445, 26445, 26446, 26446, 26446, 36865,
+    26447, 26448, 26449, 26449, 26450, 26450, 26450, 26450, 26451, 26451, 26451, 26451, 26451, 26451, 36867, 0,
+    26452, 26453, 26454, 26455, 26456, 26457, 26458, 26458, 26459, 26460, 26461, 26461, 26462, 26462, 26462, 36865,
+    26463, 26464, 26465, 26465, 26466, 26466, 26466, 26466, 26467, 26467, 26467, 26467, 26467, 26467, 26467, 0,
+    26468, 26469, 26470, 26470, 26471, 26471, 26471, 26471, 26472, 26472, 26472, 26472, 26472, 26472, 26472, 0,
+    26473, 26473, 26473, 26473, 26473, 26473, 26473, 0, 26473, 26473, 26473, 0, 36868, 0, 0, 0,
+    26474, 26475, 26476, 26477, 26478, 26479, 26480, 26480, 26481, 26482, 26483, 26483, 26484, 26484, 26484, 36865,
+    26485, 26486, 26487, 26487, 26488, 26488, 26488, 26488, 26489, 26489, 26489, 26489, 26489, 26489, 26489, 0,
+    26490, 26491, 26492, 26492, 26493, 26493, 26493, 26493, 26494, 26494, 26494, 26494, 26494, 26494, 26494, 0,
+    26495, 26495, 26495, 26495, 26495, 26495, 26495, 0, 26495, 26495, 26495, 0, 26495, 0, 0, 0,
+    26496, 26497, 26498, 26498, 26499, 26499, 26499, 26499, 26500, 26500, 26500, 26500, 26500, 26500, 26500, 0,
+    26501, 26501, 26501, 26501, 26501, 26501, 26501, 0, 26501, 26501, 26501, 0, 26501, 0, 0, 0,
+    26502, 26502, 26502, 26502, 26502, 26502, 26502, 0, 26502, 26502, 26502, 0, 26502, 0, 0, 0,
+    26502, 26502, 26502, 0, 26502, 0, 0, 0, 36869, 0, 0, 0, 0, 0, 0, 0,
+    26503, 26504, 26505, 26506, 26507, 26508, 26509, 26509, 26510, 26511, 26512, 26512, 26513, 26513, 26513, 36865,
+    26514, 26515, 26516, 26516, 26517, 26517, 26517, 26517, 26518, 26518, 26518, 26518, 26518, 26518, 26518, 0,
+    26519, 26520, 26521, 26521, 26522, 26522, 26522, 26522, 26523, 26523, 26523, 26523, 26523, 26523, 26523, 0,
+    26524, 26524, 26524, 26524, 26524, 26524, 26524, 0, 26524, 26524, 26524, 0, 26524, 0, 0, 0,
+    26525, 26526, 26527, 26527, 26528, 26528, 26528, 26528, 26529, 26529, 26529, 26529, 26529, 26529, 26529, 0,
+    26530, 26530, 26530, 26530, 26530, 26530, 26530, 0, 26530, 26530, 26530, 0, 26530, 0, 0, 0,
+    26531, 26531, 26531, 26531, 26531, 26531, 26531, 0, 26531, 26531, 26531, 0, 26531, 0, 0, 0,
+    26531, 26531, 26531, 0, 26531, 0, 0, 0, 26531, 0, 0, 0, 0, 0, 0, 0,
+    26532, 26533, 26534, 26534, 26535, 26535, 26535, 26535, 26536, 26536, 26536, 26536, 26536, 26536, 26536, 0,
+    26537, 26537, 26537, 26537, 26537, 26537, 26537, 0, 26537, 26537, 26537, 0, 26537, 0, 0, 0,
+    26538, 26538, 26538, 26538, 26538, 26538, 26538, 0, 26538, 26538, 26538, 0, 26538, 0, 0, 0,
+    26538, 26538, 26538, 0, 26538, 0, 0, 0, 26538, 0, 0, 0, 0, 0, 0, 0,
+    26539, 26539, 26539, 26539, 26539, 26539, 26539, 0, 26539, 26539, 26539, 0, 26539, 0, 0, 0,
+    26539, 26539, 26539, 0, 26539, 0, 0, 0, 26539, 0, 0, 0, 0, 0, 0, 0,
+    36871, 36871, 36871, 0, 36871, 0, 0, 0, 36871, 0, 0, 0, 0, 0, 0, 0,
+    36871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26540, 26541, 26542, 26543, 26544, 26545, 26546, 26547, 26548, 26549, 26550, 26551, 26552, 26553, 26554, 36865,
+    26555, 26556, 26557, 26558, 26559, 26560, 26561, 26561, 26562, 26563, 26564, 26564, 26565, 26565, 26565, 36866,
+    26566, 26567, 26568, 26569, 26570, 26571, 26572, 26572, 26573, 26574, 26575, 26575, 26576, 26576, 26576, 36865,
+    26577, 26578, 26579, 26579, 26580, 26580, 26580, 26580, 26581, 26581, 26581, 26581, 26581, 26581, 36867, 0,
+    26582, 26583, 26584, 26585, 26586, 26587, 26588, 26588, 26589, 26590, 26591, 26591, 26592, 26592, 26592, 36865,
+    26593, 26594, 26595, 26595, 26596, 26596, 26596, 26596, 26597, 26597, 26597, 26597, 26597, 26597, 26597, 0,
+    26598, 26599, 26600, 26600, 26601, 26601, 26601, 26601, 26602, 26602, 26602, 26602, 26602, 26602, 26602, 0,
+    26603, 26603, 26603, 26603, 26603, 26603, 26603, 0, 26603, 26603, 26603, 0, 36868, 0, 0, 0,
+    26604, 26605, 26606, 26607, 26608, 26609, 26610, 26610, 26611, 26612, 26613, 26613, 26614, 26614, 26614, 36865,
+    26615, 26616, 26617, 26617, 26618, 26618, 26618, 26618, 26619, 26619, 26619, 26619, 26619, 26619, 26619, 0,
+    26620, 26621, 26622, 26622, 26623, 26623, 26623, 26623, 26624, 26624, 26624, 26624, 26624, 26624, 26624, 0,
+    26625, 26625, 26625, 26625, 26625, 26625, 26625, 0, 26625, 26625, 26625, 0, 26625, 0, 0, 0,
+    26626, 26627, 26628, 26628, 26629, 26629, 26629, 26629, 26630, 26630, 26630, 26630, 26630, 26630, 26630, 0,
+    26631, 26631, 26631, 26631, 26631, 26631, 26631, 0, 26631, 26631, 26631, 0, 26631, 0, 0, 0,
+    26632, 26632, 26632, 26632, 26632, 26632, 26632, 0, 26632, 26632, 26632, 0, 26632, 0, 0, 0,
+    26632, 26632, 26632, 0, 26632, 0, 0, 0, 36869, 0, 0, 0, 0, 0, 0, 0,
+    26633, 26634, 26635, 26636, 26637, 26638, 26639, 26639, 26640, 26641, 26642, 26642, 26643, 26643, 26643, 36865,
+    26644, 26645, 26646, 26646, 26647, 26647, 26647, 26647, 26648, 26648, 26648, 26648, 26648, 26648, 26648, 0,
+    26649, 26650, 26651, 26651, 26652, 26652, 26652, 26652, 26653, 26653, 26653, 26653, 26653, 26653, 26653, 0,
+    26654, 26654, 26654, 26654, 26654, 26654, 26654, 0, 26654, 26654, 26654, 0, 26654, 0, 0, 0,
+    26655, 26656, 26657, 26657, 26658, 26658, 26658, 26658, 26659, 26659, 26659, 26659, 26659, 26659, 26659, 0,
+    26660, 26660, 26660, 26660, 26660, 26660, 26660, 0, 26660, 26660, 26660, 0, 26660, 0, 0, 0,
+    26661, 26661, 26661, 26661, 26661, 26661, 26661, 0, 26661, 26661, 26661, 0, 26661, 0, 0, 0,
+    26661, 26661, 26661, 0, 26661, 0, 0, 0, 26661, 0, 0, 0, 0, 0, 0, 0,
+    26662, 26663, 26664, 26664, 26665, 26665, 26665, 26665, 26666, 26666, 26666, 26666, 26666, 26666, 26666, 0,
+    26667, 26667, 26667, 26667, 26667, 26667, 26667, 0, 26667, 26667, 26667, 0, 26667, 0, 0, 0,
+    26668, 26668, 26668, 26668, 26668, 26668, 26668, 0, 26668, 26668, 26668, 0, 26668, 0, 0, 0,
+    26668, 26668, 26668, 0, 26668, 0, 0, 0, 26668, 0, 0, 0, 0, 0, 0, 0,
+    26669, 26669, 26669, 26669, 26669, 26669, 26669, 0, 26669, 26669, 26669, 0, 26669, 0, 0, 0,
+    26669, 26669, 26669, 0, 26669, 0, 0, 0, 26669, 0, 0, 0, 0, 0, 0, 0,
+    26669, 26669, 26669, 0, 26669, 0, 0, 0, 26669, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26670, 26671, 26672, 26673, 26674, 26675, 26676, 26676, 26677, 26678, 26679, 26679, 26680, 26680, 26680, 36865,
+    26681, 26682, 26683, 26683, 26684, 26684, 26684, 26684, 26685, 26685, 26685, 26685, 26685, 26685, 26685, 0,
+    26686, 26687, 26688, 26688, 26689, 26689, 26689, 26689, 26690, 26690, 26690, 26690, 26690, 26690, 26690, 0,
+    26691, 26691, 26691, 26691, 26691, 26691, 26691, 0, 26691, 26691, 26691, 0, 26691, 0, 0, 0,
+    26692, 26693, 26694, 26694, 26695, 26695, 26695, 26695, 26696, 26696, 26696, 26696, 26696, 26696, 26696, 0,
+    26697, 26697, 26697, 26697, 26697, 26697, 26697, 0, 26697, 26697, 26697, 0, 26697, 0, 0, 0,
+    26698, 26698, 26698, 26698, 26698, 26698, 26698, 0, 26698, 26698, 26698, 0, 26698, 0, 0, 0,
+    26698, 26698, 26698, 0, 26698, 0, 0, 0, 26698, 0, 0, 0, 0, 0, 0, 0,
+    26699, 26700, 26701, 26701, 26702, 26702, 26702, 26702, 26703, 26703, 26703, 26703, 26703, 26703, 26703, 0,
+    26704, 26704, 26704, 26704, 26704, 26704, 26704, 0, 26704, 26704, 26704, 0, 26704, 0, 0, 0,
+    26705, 26705, 26705, 26705, 26705, 26705, 26705, 0, 26705, 26705, 26705, 0, 26705, 0, 0, 0,
+    26705, 26705, 26705, 0, 26705, 0, 0, 0, 26705, 0, 0, 0, 0, 0, 0, 0,
+    26706, 26706, 26706, 26706, 26706, 26706, 26706, 0, 26706, 26706, 26706, 0, 26706, 0, 0, 0,
+    26706, 26706, 26706, 0, 26706, 0, 0, 0, 26706, 0, 0, 0, 0, 0, 0, 0,
+    26706, 26706, 26706, 0, 26706, 0, 0, 0, 26706, 0, 0, 0, 0, 0, 0, 0,
+    26706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26707, 26708, 26709, 26709, 26710, 26710, 26710, 26710, 26711, 26711, 26711, 26711, 26711, 26711, 26711, 0,
+    26712, 26712, 26712, 26712, 26712, 26712, 26712, 0, 26712, 26712, 26712, 0, 26712, 0, 0, 0,
+    26713, 26713, 26713, 26713, 26713, 26713, 26713, 0, 26713, 26713, 26713, 0, 26713, 0, 0, 0,
+    26713, 26713, 26713, 0, 26713, 0, 0, 0, 26713, 0, 0, 0, 0, 0, 0, 0,
+    26714, 26714, 26714, 26714, 26714, 26714, 26714, 0, 26714, 26714, 26714, 0, 26714, 0, 0, 0,
+    26714, 26714, 26714, 0, 26714, 0, 0, 0, 26714, 0, 0, 0, 0, 0, 0, 0,
+    26714, 26714, 26714, 0, 26714, 0, 0, 0, 26714, 0, 0, 0, 0, 0, 0, 0,
+    26714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26715, 26715, 26715, 26715, 26715, 26715, 26715, 0, 26715, 26715, 26715, 0, 26715, 0, 0, 0,
+    26715, 26715, 26715, 0, 26715, 0, 0, 0, 26715, 0, 0, 0, 0, 0, 0, 0,
+    26715, 26715, 26715, 0, 26715, 0, 0, 0, 26715, 0, 0, 0, 0, 0, 0, 0,
+    26715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36872, 36872, 36872, 0, 36872, 0, 0, 0, 36872, 0, 0, 0, 0, 0, 0, 0,
+    36872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26716, 26717, 26718, 26719, 26720, 26721, 26722, 26723, 26724, 26725, 26726, 26727, 26728, 26729, 26730, 36865,
+    26731, 26732, 26733, 26734, 26735, 26736, 26737, 26737, 26738, 26739, 26740, 26740, 26741, 26741, 26741, 36866,
+    26742, 26743, 26744, 26745, 26746, 26747, 26748, 26748, 26749, 26750, 26751, 26751, 26752, 26752, 26752, 36865,
+    26753, 26754, 26755, 26755, 26756, 26756, 26756, 26756, 26757, 26757, 26757, 26757, 26757, 26757, 36867, 0,
+    26758, 26759, 26760, 26761, 26762, 26763, 26764, 26764, 26765, 26766, 26767, 26767, 26768, 26768, 26768, 36865,
+    26769, 26770, 26771, 26771, 26772, 26772, 26772, 26772, 26773, 26773, 26773, 26773, 26773, 26773, 26773, 0,
+    26774, 26775, 26776, 26776, 26777, 26777, 26777, 26777, 26778, 26778, 26778, 26778, 26778, 26778, 26778, 0,
+    26779, 26779, 26779, 26779, 26779, 26779, 26779, 0, 26779, 26779, 26779, 0, 36868, 0, 0, 0,
+    26780, 26781, 26782, 26783, 26784, 26785, 26786, 26786, 26787, 26788, 26789, 26789, 26790, 26790, 26790, 36865,
+    26791, 26792, 26793, 26793, 26794, 26794, 26794, 26794, 26795, 26795, 26795, 26795, 26795, 26795, 26795, 0,
+    26796, 26797, 26798, 26798, 26799, 26799, 26799, 26799, 26800, 26800, 26800, 26800, 26800, 26800, 26800, 0,
+    26801, 26801, 26801, 26801, 26801, 26801, 26801, 0, 26801, 26801, 26801, 0, 26801, 0, 0, 0,
+    26802, 26803, 26804, 26804, 26805, 26805, 26805, 26805, 26806, 26806, 26806, 26806, 26806, 26806, 26806, 0,
+    26807, 26807, 26807, 26807, 26807, 26807, 26807, 0, 26807, 26807, 26807, 0, 26807, 0, 0, 0,
+    26808, 26808, 26808, 26808, 26808, 26808, 26808, 0, 26808, 26808, 26808, 0, 26808, 0, 0, 0,
+    26808, 26808, 26808, 0, 26808, 0, 0, 0, 36869, 0, 0, 0, 0, 0, 0, 0,
+    26809, 26810, 26811, 26812, 26813, 26814, 26815, 26815, 26816, 26817, 26818, 26818, 26819, 26819, 26819, 36865,
+    26820, 26821, 26822, 26822, 26823, 26823, 26823, 26823, 26824, 26824, 26824, 26824, 26824, 26824, 26824, 0,
+    26825, 26826, 26827, 26827, 26828, 26828, 26828, 26828, 26829, 26829, 26829, 26829, 26829, 26829, 26829, 0,
+    26830, 26830, 26830, 26830, 26830, 26830, 26830, 0, 26830, 26830, 26830, 0, 26830, 0, 0, 0,
+    26831, 26832, 26833, 26833, 26834, 26834, 26834, 26834, 26835, 26835, 26835, 26835, 26835, 26835, 26835, 0,
+    26836, 26836, 26836, 26836, 26836, 26836, 26836, 0, 26836, 26836, 26836, 0, 26836, 0, 0, 0,
+    26837, 26837, 26837, 26837, 26837, 26837, 26837, 0, 26837, 26837, 26837, 0, 26837, 0, 0, 0,
+    26837, 26837, 26837, 0, 26837, 0, 0, 0, 26837, 0, 0, 0, 0, 0, 0, 0,
+    26838, 26839, 26840, 26840, 26841, 26841, 26841, 26841, 26842, 26842, 26842, 26842, 26842, 26842, 26842, 0,
+    26843, 26843, 26843, 26843, 26843, 26843, 26843, 0, 26843, 26843, 26843, 0, 26843, 0, 0, 0,
+    26844, 26844, 26844, 26844, 26844, 26844, 26844, 0, 26844, 26844, 26844, 0, 26844, 0, 0, 0,
+    26844, 26844, 26844, 0, 26844, 0, 0, 0, 26844, 0, 0, 0, 0, 0, 0, 0,
+    26845, 26845, 26845, 26845, 26845, 26845, 26845, 0, 26845, 26845, 26845, 0, 26845, 0, 0, 0,
+    26845, 26845, 26845, 0, 26845, 0, 0, 0, 26845, 0, 0, 0, 0, 0, 0, 0,
+    26845, 26845, 26845, 0, 26845, 0, 0, 0, 26845, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26846, 26847, 26848, 26849, 26850, 26851, 26852, 26852, 26853, 26854, 26855, 26855, 26856, 26856, 26856, 36865,
+    26857, 26858, 26859, 26859, 26860, 26860, 26860, 26860, 26861, 26861, 26861, 26861, 26861, 26861, 26861, 0,
+    26862, 26863, 26864, 26864, 26865, 26865, 26865, 26865, 26866, 26866, 26866, 26866, 26866, 26866, 26866, 0,
+    26867, 26867, 26867, 26867, 26867, 26867, 26867, 0, 26867, 26867, 26867, 0, 26867, 0, 0, 0,
+    26868, 26869, 26870, 26870, 26871, 26871, 26871, 26871, 26872, 26872, 26872, 26872, 26872, 26872, 26872, 0,
+    26873, 26873, 26873, 26873, 26873, 26873, 26873, 0, 26873, 26873, 26873, 0, 26873, 0, 0, 0,
+    26874, 26874, 26874, 26874, 26874, 26874, 26874, 0, 26874, 26874, 26874, 0, 26874, 0, 0, 0,
+    26874, 26874, 26874, 0, 26874, 0, 0, 0, 26874, 0, 0, 0, 0, 0, 0, 0,
+    26875, 26876, 26877, 26877, 26878, 26878, 26878, 26878, 26879, 26879, 26879, 26879, 26879, 26879, 26879, 0,
+    26880, 26880, 26880, 26880, 26880, 26880, 26880, 0, 26880, 26880, 26880, 0, 26880, 0, 0, 0,
+    26881, 26881, 26881, 26881, 26881, 26881, 26881, 0, 26881, 26881, 26881, 0, 26881, 0, 0, 0,
+    26881, 26881, 26881, 0, 26881, 0, 0, 0, 26881, 0, 0, 0, 0, 0, 0, 0,
+    26882, 26882, 26882, 26882, 26882, 26882, 26882, 0, 26882, 26882, 26882, 0, 26882, 0, 0, 0,
+    26882, 26882, 26882, 0, 26882, 0, 0, 0, 26882, 0, 0, 0, 0, 0, 0, 0,
+    26882, 26882, 26882, 0, 26882, 0, 0, 0, 26882, 0, 0, 0, 0, 0, 0, 0,
+    26882, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26883, 26884, 26885, 26885, 26886, 26886, 26886, 26886, 26887, 26887, 26887, 26887, 26887, 26887, 26887, 0,
+    26888, 26888, 26888, 26888, 26888, 26888, 26888, 0, 26888, 26888, 26888, 0, 26888, 0, 0, 0,
+    26889, 26889, 26889, 26889, 26889, 26889, 26889, 0, 26889, 26889, 26889, 0, 26889, 0, 0, 0,
+    26889, 26889, 26889, 0, 26889, 0, 0, 0, 26889, 0, 0, 0, 0, 0, 0, 0,
+    26890, 26890, 26890, 26890, 26890, 26890, 26890, 0, 26890, 26890, 26890, 0, 26890, 0, 0, 0,
+    26890, 26890, 26890, 0, 26890, 0, 0, 0, 26890, 0, 0, 0, 0, 0, 0, 0,
+    26890, 26890, 26890, 0, 26890, 0, 0, 0, 26890, 0, 0, 0, 0, 0, 0, 0,
+    26890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26891, 26891, 26891, 26891, 26891, 26891, 26891, 0, 26891, 26891, 26891, 0, 26891, 0, 0, 0,
+    26891, 26891, 26891, 0, 26891, 0, 0, 0, 26891, 0, 0, 0, 0, 0, 0, 0,
+    26891, 26891, 26891, 0, 26891, 0, 0, 0, 26891, 0, 0, 0, 0, 0, 0, 0,
+    26891, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26891, 26891, 26891, 0, 26891, 0, 0, 0, 26891, 0, 0, 0, 0, 0, 0, 0,
+    26891, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26892, 26893, 26894, 26895, 26896, 26897, 26898, 26898, 26899, 26900, 26901, 26901, 26902, 26902, 26902, 36865,
+    26903, 26904, 26905, 26905, 26906, 26906, 26906, 26906, 26907, 26907, 26907, 26907, 26907, 26907, 26907, 0,
+    26908, 26909, 26910, 26910, 26911, 26911, 26911, 26911, 26912, 26912, 26912, 26912, 26912, 26912, 26912, 0,
+    26913, 26913, 26913, 26913, 26913, 26913, 26913, 0, 26913, 26913, 26913, 0, 26913, 0, 0, 0,
+    26914, 26915, 26916, 26916, 26917, 26917, 26917, 26917, 26918, 26918, 26918, 26918, 26918, 26918, 26918, 0,
+    26919, 26919, 26919, 26919, 26919, 26919, 26919, 0, 26919, 26919, 26919, 0, 26919, 0, 0, 0,
+    26920, 26920, 26920, 26920, 26920, 26920, 26920, 0, 26920, 26920, 26920, 0, 26920, 0, 0, 0,
+    26920, 26920, 26920, 0, 26920, 0, 0, 0, 26920, 0, 0, 0, 0, 0, 0, 0,
+    26921, 26922, 26923, 26923, 26924, 26924, 26924, 26924, 26925, 26925, 26925, 26925, 26925, 26925, 26925, 0,
+    26926, 26926, 26926, 26926, 26926, 26926, 26926, 0, 26926, 26926, 26926, 0, 26926, 0, 0, 0,
+    26927, 26927, 26927, 26927, 26927, 26927, 26927, 0, 26927, 26927, 26927, 0, 26927, 0, 0, 0,
+    26927, 26927, 26927, 0, 26927, 0, 0, 0, 26927, 0, 0, 0, 0, 0, 0, 0,
+    26928, 26928, 26928, 26928, 26928, 26928, 26928, 0, 26928, 26928, 26928, 0, 26928, 0, 0, 0,
+    26928, 26928, 26928, 0, 26928, 0, 0, 0, 26928, 0, 0, 0, 0, 0, 0, 0,
+    26928, 26928, 26928, 0, 26928, 0, 0, 0, 26928, 0, 0, 0, 0, 0, 0, 0,
+    26928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26929, 26930, 26931, 26931, 26932, 26932, 26932, 26932, 26933, 26933, 26933, 26933, 26933, 26933, 26933, 0,
+    26934, 26934, 26934, 26934, 26934, 26934, 26934, 0, 26934, 26934, 26934, 0, 26934, 0, 0, 0,
+    26935, 26935, 26935, 26935, 26935, 26935, 26935, 0, 26935, 26935, 26935, 0, 26935, 0, 0, 0,
+    26935, 26935, 26935, 0, 26935, 0, 0, 0, 26935, 0, 0, 0, 0, 0, 0, 0,
+    26936, 26936, 26936, 26936, 26936, 26936, 26936, 0, 26936, 26936, 26936, 0, 26936, 0, 0, 0,
+    26936, 26936, 26936, 0, 26936, 0, 0, 0, 26936, 0, 0, 0, 0, 0, 0, 0,
+    26936, 26936, 26936, 0, 26936, 0, 0, 0, 26936, 0, 0, 0, 0, 0, 0, 0,
+    26936, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26937, 26937, 26937, 26937, 26937, 26937, 26937, 0, 26937, 26937, 26937, 0, 26937, 0, 0, 0,
+    26937, 26937, 26937, 0, 26937, 0, 0, 0, 26937, 0, 0, 0, 0, 0, 0, 0,
+    26937, 26937, 26937, 0, 26937, 0, 0, 0, 26937, 0, 0, 0, 0, 0, 0, 0,
+    26937, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26937, 26937, 26937, 0, 26937, 0, 0, 0, 26937, 0, 0, 0, 0, 0, 0, 0,
+    26937, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26937, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26938, 26939, 26940, 26940, 26941, 26941, 26941, 26941, 26942, 26942, 26942, 26942, 26942, 26942, 26942, 0,
+    26943, 26943, 26943, 26943, 26943, 26943, 26943, 0, 26943, 26943, 26943, 0, 26943, 0, 0, 0,
+    26944, 26944, 26944, 26944, 26944, 26944, 26944, 0, 26944, 26944, 26944, 0, 26944, 0, 0, 0,
+    26944, 26944, 26944, 0, 26944, 0, 0, 0, 26944, 0, 0, 0, 0, 0, 0, 0,
+    26945, 26945, 26945, 26945, 26945, 26945, 26945, 0, 26945, 26945, 26945, 0, 26945, 0, 0, 0,
+    26945, 26945, 26945, 0, 26945, 0, 0, 0, 26945, 0, 0, 0, 0, 0, 0, 0,
+    26945, 26945, 26945, 0, 26945, 0, 0, 0, 26945, 0, 0, 0, 0, 0, 0, 0,
+    26945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26946, 26946, 26946, 26946, 26946, 26946, 26946, 0, 26946, 26946, 26946, 0, 26946, 0, 0, 0,
+    26946, 26946, 26946, 0, 26946, 0, 0, 0, 26946, 0, 0, 0, 0, 0, 0, 0,
+    26946, 26946, 26946, 0, 26946, 0, 0, 0, 26946, 0, 0, 0, 0, 0, 0, 0,
+    26946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26946, 26946, 26946, 0, 26946, 0, 0, 0, 26946, 0, 0, 0, 0, 0, 0, 0,
+    26946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    26946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36874, 36874, 36874, 36874, 36874, 36874, 36874, 0, 36874, 36874, 36874, 0, 36874, 0, 0, 0,
+    36874, 36874, 36874, 0, 36874, 0, 0, 0, 36874, 0, 0, 0, 0, 0, 0, 0,
+    36874, 36874, 36874, 0, 36874, 0, 0, 0, 36874, 0, 0, 0, 0, 0, 0, 0,
+    36874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36874, 36874, 36874, 0, 36874, 0, 0, 0, 36874, 0, 0, 0, 0, 0, 0, 0,
+    36874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36874, 36874, 36874, 0, 36874, 0, 0, 0, 36874, 0, 0, 0, 0, 0, 0, 0,
+    36874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36874,
+};
@@ -0,0 +1,5201 @@
+#include "HandEvaluator.h"
+
+// Non-flush lookup table for the evaluator (FiveCardLookupLayout, size 83116 + 1 padding).
+// Generated by HandEvaluatorT::outputLookupTables().
+const uint16_t omp::FiveCardLookupLayout::LOOKUP[] {
+    32798, 16625, 28673, 32850, 32772, 16879, 32850, 32770, 32784, 12402, 12366, 32798, 28709, 28674, 16473, 17409,
+    12521, 12507, 28735, 28712, 28721, 32775, 4291, 16794, 16729, 16716, 12532, 32815, 32787, 32850, 8842, 32796,
+    16390, 12402, 16808, 8823, 32799, 8206, 8829, 28710, 12559, 32826, 28724, 16865, 9713, 12463, 12427, 32827,
+    12426, 32803, 8276, 32855, 12534, 20482, 10022, 32828, 28679, 28687, 12296, 32826, 16878, 12558, 16736, 20485,
+    12320, 12403, 28697, 28761, 16737, 28738, 8854, 28724, 8582, 10349, 4473, 12487, 10028, 9126, 16564, 16729,
+    12536, 12344, 9478, 16804, 10349, 10311, 12461, 12558, 12524, 12584, 28710, 28735, 28739, 28761, 8277, 28688,
+    8555, 12582, 32771, 8546, 28738, 32855, 9472, 12687, 12606, 16807, 9182, 28733, 28757, 16973, 12641, 28691,
+    28675, 12344, 8889, 28758, 12644, 28713, 28722, 32777, 12332, 8847, 12679, 28685, 28715, 12333, 28725, 16500,
+    32843, 12501, 12714, 4635, 12714, 12679, 8613, 9179, 28692, 9188, 28680, 12714, 28716, 12690, 28688, 17045,
+    32788, 28769, 32863, 12393, 28734, 17045, 28692, 10621, 17045, 10663, 12297, 32804, 4648, 4635, 12441, 12513,
+    28725, 28676, 16666, 9503, 16728, 16745, 4662, 10077, 9494, 9208, 28770, 4608, 12585, 16667, 16981, 28772,
+    28714, 12357, 32812, 32776, 28747, 28770, 9772, 12585, 28749, 12293, 28733, 12689, 9807, 16821, 16800, 32802,
+    8553, 12450, 28734, 12345, 12608, 9758, 12400, 12403, 10688, 16825, 9492, 32774, 20485, 12451, 8915, 32787,
+    32789, 28685, 20486, 8619, 12775, 16509, 32851, 28705, 32840, 32773, 28681, 12339, 12309, 16578, 10338, 10712,
+    10326, 12596, 12737, 16655, 32857, 20487, 28717, 32857, 12488, 12322, 12593, 12382, 12334, 10688, 10647, 32776,
+    4725, 28698, 9832, 12535, 16981, 17038, 32842, 8876, 12810, 12775, 12437, 28715, 8583, 9245, 12746, 4890,
+    28717, 28689, 12729, 11005, 28693, 11005, 28709, 12358, 28686, 8289, 28693, 12752, 11005, 12310, 8613, 9525,
+    12310, 12677, 12370, 16814, 12753, 9518, 28758, 16737, 12735, 12321, 8320, 32792, 12393, 8528, 32830, 9547,
+    9420, 28713, 28735, 12425, 12716, 28701, 12751, 8284, 16755, 12741, 4969, 12752, 12568, 9230, 12598, 16596,
+    28673, 12586, 8350, 32857, 4609, 9219, 9851, 16393, 10646, 28687, 28726, 8358, 28747, 16676, 4311, 9547,
+    28771, 28740, 12298, 28680, 12525, 28676, 32777, 12644, 28717, 16439, 12305, 10044, 32805, 4879, 12358, 16518,
+    8559, 32854, 28723, 16736, 10749, 28781, 9211, 32775, 12646, 9812, 16667, 12378, 16745, 12634, 32801, 16483,
+    10436, 32826, 10946, 8367, 5077, 10407, 20484, 5077, 12606, 10998, 8657, 16409, 32802, 16646, 8904, 8658,
+    12509, 16893, 12402, 5042, 16509, 12403, 12394, 12465, 9515, 28674, 32818, 32788, 28785, 5062, 5086, 16904,
+    12354, 28716, 12320, 12641, 12682, 28673, 12586, 5055, 8367, 28784, 12729, 32790, 32791, 9745, 28735, 28722,
+    12694, 12670, 4567, 10159, 8660, 8640, 10705, 12346, 9524, 12678, 32831, 12669, 32825, 12514, 9831, 12513,
+    32890, 9209, 12344, 28715, 32890, 28769, 28677, 5068, 10756, 12452, 10710, 10756, 10756, 12656, 8260, 8643,
+    12330, 28688, 32829, 5077, 12778, 28741, 12776, 12730, 12717, 28705, 9844, 32842, 9807, 28736, 12546, 32791,
+    28728, 32789, 16425, 28710, 12486, 5112, 16676, 28717, 12809, 16663, 12369, 12716, 4853, 12883, 12831, 16814,
+    32838, 11022, 28698, 9476, 32816, 28697, 16676, 8356, 12857, 4342, 28724, 28742, 28674, 32880, 16596, 12872,
+    32924, 10444, 11275, 32787, 12742, 16981, 28693, 32789, 12334, 16437, 28685, 12332, 10153, 28678, 28704, 12356,
+    28771, 4722, 12880, 12466, 28721, 28717, 32836, 9727, 16646, 12295, 12861, 16913, 16491, 28694, 28747, 11012,
+    28742, 12848, 28682, 12882, 12790, 12846, 5090, 10706, 32799, 12399, 17123, 28690, 28690, 32774, 11310, 12717,
+    12669, 11310, 32858, 12597, 12861, 16505, 32858, 28733, 28787, 11055, 16602, 32806, 16444, 12343, 12787, 12861,
+    4696, 28689, 5185, 28697, 12929, 28680, 16840, 8366, 28724, 16427, 12929, 12419, 28687, 12437, 16588, 28765,
+    16841, 32855, 28697, 32855, 9588, 28788, 28674, 32857, 12358, 12873, 17069, 28699, 8682, 32805, 8328, 8696,
+    9766, 9757, 9285, 12838, 11347, 12311, 9522, 32843, 12371, 12718, 12850, 12870, 12691, 8292, 12497, 16607,
+    28694, 28723, 16606, 32866, 8994, 11323, 5354, 11310, 28735, 5369, 5369, 12850, 12928, 16765, 32842, 20486,
+    12438, 12513, 28705, 10444, 16388, 12587, 5334, 11262, 4984, 12395, 16485, 12621, 12539, 9418, 32815, 32856,
+    5354, 28722, 8364, 10490, 4864, 10677, 16753, 16844, 12299, 16449, 12395, 5353, 12429, 12429, 12609, 12331,
+    12821, 4890, 28713, 12574, 16734, 12659, 32780, 12416, 12658, 32845, 12595, 28704, 28702, 32845, 28711, 12467,
+    16450, 16655, 5462, 32805, 12298, 12438, 28704, 12536, 12941, 12730, 12941, 11334, 12419, 16494, 12941, 12856,
+    12907, 12941, 8940, 32815, 28709, 12383, 8655, 12346, 32780, 28718, 5471, 9833, 10444, 28828, 11057, 12669,
+    28793, 12860, 28794, 20487, 16608, 32818, 10078, 5077, 10795, 32829, 12560, 28798, 16687, 28742, 28783, 12695,
+    28828, 28736, 9300, 12333, 32896, 9560, 10725, 12383, 32805, 12821, 12393, 16677, 9012, 11286, 10795, 12680,
+    28793, 32850, 9562, 12608, 32778, 32840, 16763, 28794, 12443, 32889, 28795, 28795, 12919, 16606, 17215, 32783,
+    12657, 10755, 32792, 16902, 16677, 28705, 28706, 28727, 12335, 17130, 12371, 28749, 5203, 12778, 12298, 20488,
+    32823, 10749, 10398, 20483, 8876, 16841, 28796, 32894, 9198, 9617, 28797, 8694, 12755, 16530, 16630, 28676,
+    12752, 32775, 16519, 16642, 28773, 28709, 16528, 8718, 16846, 28764, 28705, 9319, 10802, 12599, 12347, 11101,
+    16767, 28735, 12731, 8244, 16754, 11101, 12508, 17196, 12299, 28723, 5336, 12491, 28725, 12742, 9617, 10078,
+    16686, 16406, 32789, 10693, 12584, 9319, 12586, 12311, 16607, 16530, 28794, 12407, 12290, 12821, 12395, 28673,
+    32803, 8262, 10157, 9740, 32793, 28722, 5627, 5627, 4203, 5627, 4327, 32775, 12608, 32890, 5391, 9232,
+    8722, 28733, 11094, 17082, 16518, 10756, 12797, 12343, 11310, 32819, 32816, 28793, 16902, 17130, 8722, 9305,
+    17069, 4635, 20486, 12391, 28783, 17145, 16563, 9216, 32776, 12319, 32829, 12868, 10725, 32870, 11101, 12460,
+    28674, 12836, 9235, 12788, 20482, 5295, 28715, 8292, 9562, 12512, 32776, 28781, 28698, 9320, 28738, 28781,
+    28788, 32869, 12359, 16657, 9235, 32804, 16504, 28725, 12403, 16729, 12311, 32840, 32842, 28765, 28737, 12537,
+    12356, 32789, 12644, 16604, 9256, 28736, 16816, 5561, 32802, 4241, 32793, 5671, 5493, 5671, 5614, 16921,
+    16846, 32845, 32901, 28699, 5671, 32901, 8721, 32839, 8667, 16427, 32804, 16661, 11354, 32845, 10496, 32801,
+    10022, 32890, 12910, 8695, 16575, 12656, 12873, 17072, 5207, 8582, 32845, 28749, 8643, 17210, 9022, 32858,
+    8696, 5047, 12563, 32843, 28717, 12838, 16821, 9292, 12755, 16451, 8312, 28749, 12345, 16804, 12705, 28678,
+    32871, 4450, 28698, 28691, 11057, 28705, 16571, 32900, 16420, 12755, 8723, 5462, 9617, 12369, 16761, 10043,
+    16765, 12453, 12464, 9253, 17076, 28697, 28728, 16686, 12463, 12887, 12431, 12488, 12839, 12887, 16688, 12851,
+    9610, 8910, 10797, 28702, 12754, 11275, 28686, 16467, 12322, 16742, 9321, 12488, 12875, 10512, 28769, 12875,
+    32843, 28745, 12515, 20483, 28798, 4970, 11364, 12836, 12885, 28728, 28794, 9446, 16530, 4651, 32908, 28790,
+    28782, 16922, 28699, 20483, 12622, 28828, 16657, 12418, 12428, 12851, 12873, 16687, 8410, 28694, 5497, 9908,
+    12647, 12634, 12354, 10802, 28717, 4671, 12633, 28710, 12298, 12752, 9315, 17151, 32778, 12678, 12379, 17161,
+    28802, 28762, 28783, 10090, 5628, 10195, 13003, 28683, 28694, 28770, 12928, 12597, 8414, 16754, 17215, 5657,
+    16564, 8666, 16830, 11094, 28743, 10987, 12886, 9545, 9816, 28693, 12992, 12875, 32934, 10218, 11399, 16586,
+    9806, 4376, 11574, 12514, 12398, 16491, 5275, 32772, 12874, 12520, 12416, 32785, 32830, 32787, 28743, 12683,
+    28705, 8951, 28725, 12981, 8608, 11290, 12969, 8414, 16924, 28676, 11560, 9151, 16513, 8658, 12954, 12992,
+    12418, 12491, 11101, 12318, 9540, 16751, 28694, 16767, 13026, 28677, 28794, 28713, 12413, 12981, 8405, 28754,
+    28711, 32804, 4501, 10749, 28676, 9620, 9247, 17215, 32779, 16499, 12851, 12460, 12297, 16507, 32884, 28770,
+    13049, 10505, 12428, 13049, 32805, 11023, 28685, 17156, 5518, 32812, 17127, 10816, 16492, 8661, 12982, 10811,
+    28673, 12850, 9011, 12357, 16518, 12516, 28743, 9041, 12883, 9640, 32884, 32859, 16752, 12958, 8263, 28698,
+    9934, 28771, 28725, 11646, 4382, 12659, 5650, 12396, 5601, 12970, 12886, 9347, 10487, 16844, 11622, 12839,
+    28674, 5087, 12432, 28794, 12958, 13048, 12324, 12330, 16771, 32814, 9795, 8941, 12801, 17234, 10546, 28793,
+    28793, 10546, 9342, 17234, 8745, 28733, 17234, 12406, 12861, 16539, 28794, 8540, 12659, 9649, 32902, 16846,
+    28735, 16697, 9254, 12336, 16855, 9051, 28713, 12360, 5913, 32804, 12297, 28793, 32909, 16617, 16957, 32804,
+    8604, 32859, 9349, 16609, 9953, 12371, 28752, 11048, 12391, 12947, 28734, 16697, 12860, 32776, 12659, 12684,
+    8455, 32792, 12827, 28704, 16764, 12767, 10452, 13061, 12976, 13027, 13061, 5823, 16697, 8760, 12731, 10544,
+    28674, 32788, 10851, 11055, 20482, 10851, 10851, 28716, 32779, 16556, 12845, 12971, 17233, 10546, 16777, 10664,
+    28697, 8469, 12872, 12886, 8721, 28743, 28743, 12371, 5900, 28793, 12995, 6022, 13037, 5919, 17088, 28770,
+    28702, 12588, 8903, 13004, 8704, 12971, 12957, 16856, 10452, 13060, 28771, 6006, 8341, 12395, 5144, 12855,
+    11661, 32858, 12684, 16461, 12983, 11303, 12431, 12959, 9366, 16885, 12983, 9320, 4697, 13007, 8769, 12875,
+    12755, 10261, 32781, 8982, 32807, 12336, 16619, 12834, 10483, 12987, 12432, 12516, 9932, 20484, 16615, 10023,
+    9584, 12335, 12635, 12969, 16767, 16591, 12607, 5210, 16801, 10858, 10858, 28711, 16855, 5766, 12343, 5275,
+    28787, 6022, 12755, 16607, 12442, 12780, 10806, 28705, 9946, 32892, 10162, 10213, 16805, 12971, 12654, 12300,
+    20483, 32789, 16765, 6057, 9434, 28690, 12887, 12308, 5472, 16609, 9965, 9673, 8473, 12921, 28717, 12302,
+    8699, 16912, 28757, 11698, 8722, 8458, 12311, 12756, 9917, 16857, 9610, 8395, 16617, 28754, 28776, 16576,
+    8424, 28752, 11157, 12566, 12839, 12744, 12336, 12596, 12496, 11595, 28680, 9673, 9172, 4890, 4800, 32845,
+    8776, 12957, 12647, 28680, 12631, 12347, 12851, 9833, 9077, 9729, 16697, 8778, 10788, 16990, 12696, 6138,
+    16698, 5462, 16665, 6092, 12988, 12439, 12993, 16404, 28797, 12576, 28683, 9376, 32793, 10187, 12311, 12324,
+    6123, 12300, 9077, 8413, 28689, 32856, 11109, 17124, 32924, 16973, 12392, 8778, 28702, 9374, 12455, 10743,
+    17167, 12368, 32859, 32897, 10213, 9580, 10263, 9970, 10867, 9319, 32867, 12636, 12803, 28707, 10503, 8409,
+    28796, 20486, 12537, 17181, 8779, 28711, 12360, 32794, 16684, 32855, 28796, 13071, 13071, 13005, 13071, 12598,
+    12660, 9917, 6224, 12467, 8480, 28695, 10802, 32937, 6224, 32793, 17051, 6224, 5106, 28794, 8779, 12982,
+    16677, 10459, 28783, 6200, 8531, 28758, 12381, 5563, 9247, 6196, 12660, 32866, 11397, 16793, 12728, 12314,
+    17232, 10546, 13015, 16490, 20488, 12538, 9676, 12731, 10943, 28781, 16681, 12311, 12621, 13048, 17171, 16775,
+    8466, 32907, 12348, 9377, 28772, 12588, 28705, 10706, 28763, 12791, 32891, 8446, 16775, 12384, 12455, 8642,
+    32820, 12336, 32844, 28809, 32854, 4699, 28809, 8524, 28805, 12875, 16754, 16846, 12714, 28697, 12588, 32800,
+    9712, 32807, 8430, 16546, 9219, 28709, 8779, 16514, 28714, 10554, 28775, 28808, 11166, 9072, 10271, 11166,
+    9042, 13005, 6022, 11691, 5858, 9335, 32833, 28769, 12372, 16688, 9021, 8685, 16539, 8365, 16530, 12766,
+    12852, 10310, 17294, 28806, 8440, 12605, 28806, 12345, 16913, 20487, 8658, 16857, 28742, 28760, 10086, 12475,
+    28748, 12739, 6043, 9662, 10827, 12396, 8719, 12417, 11304, 28682, 28686, 6163, 16579, 12848, 16563, 32833,
+    9664, 13047, 28809, 13048, 32781, 13007, 11544, 11698, 32856, 12864, 16982, 12864, 11455, 12439, 9147, 13006,
+    16540, 28713, 12864, 16487, 28808, 12306, 28680, 28724, 28717, 12379, 28769, 8424, 8442, 28807, 17303, 10851,
+    32788, 9636, 28676, 32815, 20482, 12537, 12369, 9683, 12480, 28699, 11365, 8781, 12983, 11430, 28727, 9421,
+    8769, 32901, 28806, 28699, 12828, 6257, 16472, 8779, 28725, 11652, 28771, 16894, 9385, 12630, 5088, 12970,
+    9320, 9137, 16775, 12971, 11464, 12852, 32845, 12344, 12852, 12732, 32928, 11155, 28800, 17000, 28676, 9516,
+    32805, 11322, 28673, 28805, 32864, 28811, 12645, 8788, 11455, 11221, 32898, 28775, 32801, 9125, 12560, 16495,
+    12485, 28697, 16542, 8301, 16858, 6363, 12335, 6363, 12864, 32779, 12958, 16785, 12591, 20482, 6363, 10789,
+    16666, 8540, 8760, 32797, 6328, 13059, 6187, 13060, 12333, 4398, 28693, 12527, 6335, 13043, 10795, 28740,
+    28704, 12394, 28743, 12660, 16726, 17130, 32836, 16579, 12396, 12360, 12723, 5836, 12959, 10749, 10982, 8478,
+    9337, 8490, 28694, 32794, 28694, 5091, 28674, 28712, 32805, 10126, 12983, 28725, 17313, 12471, 28771, 28805,
+    12346, 12981, 16778, 12959, 16647, 12307, 28677, 10760, 11399, 28777, 16406, 8713, 9011, 6152, 16829, 12552,
+    12780, 10922, 4727, 28721, 12922, 6297, 9842, 12473, 16542, 28682, 10860, 16478, 28796, 16856, 12920, 4367,
+    17244, 16857, 6407, 28794, 6315, 12403, 6032, 12814, 5473, 10161, 28782, 9553, 12790, 12402, 28716, 12660,
+    5317, 9784, 12671, 32831, 32909, 17308, 32788, 9387, 9492, 13003, 5770, 16588, 12660, 28781, 28771, 5992,
+    9078, 10044, 10482, 20482, 17217, 28805, 12610, 12859, 32779, 20481, 9517, 12992, 5275, 4868, 9366, 8965,
+    28677, 12311, 8298, 32830, 16893, 10334, 28705, 12756, 6387, 12309, 9683, 12587, 32818, 12344, 12606, 10882,
+    12623, 11048, 16755, 32832, 32775, 28705, 28809, 12384, 28683, 28695, 9687, 9687, 8710, 6415, 11602, 8593,
+    9377, 6152, 12756, 12671, 12324, 32781, 13006, 12748, 9387, 12888, 12645, 17150, 28705, 28740, 28697, 28745,
+    11347, 10677, 10569, 9388, 5433, 6356, 9675, 9375, 11448, 9955, 8788, 12382, 16621, 28690, 17169, 16694,
+    12885, 12300, 16773, 9609, 32777, 10498, 28806, 6452, 28807, 32791, 8790, 8790, 11354, 16675, 28722, 12636,
+    20482, 5021, 28717, 5276, 5602, 16694, 8433, 9534, 28687, 12852, 12874, 32858, 12672, 28783, 28782, 16687,
+    28783, 4890, 12694, 12372, 12319, 10749, 12648, 32853, 10866, 28695, 32773, 32792, 11455, 9744, 32786, 6007,
+    12928, 16756, 12852, 32854, 9676, 28675, 28755, 12754, 9529, 9388, 11170, 11257, 16424, 32814, 28810, 28757,
+    28795, 17067, 16735, 16542, 16673, 9089, 12310, 8883, 32871, 8359, 12396, 28730, 12933, 28733, 12508, 17293,
+    6321, 32831, 10452, 28685, 28716, 32908, 28812, 12767, 10774, 12354, 8730, 5914, 12360, 32903, 6401, 12657,
+    12323, 8667, 9642, 13060, 8779, 16779, 9533, 9012, 12852, 16615, 17081, 12439, 12396, 16568, 10582, 6362,
+    16391, 16775, 28828, 9686, 12731, 32776, 28704, 13007, 6460, 28706, 28686, 12849, 12522, 11058, 28722, 28797,
+    28687, 9791, 17239, 11124, 12490, 28677, 28800, 16416, 13040, 12995, 32911, 5937, 12959, 28769, 8491, 6203,
+    16925, 16578, 8758, 28810, 32913, 32914, 28796, 32914, 28678, 16720, 12440, 32914, 5577, 8200, 32914, 11111,
+    12294, 12430, 28806, 12660, 6386, 12586, 28805, 28695, 28752, 9941, 16667, 12461, 8577, 6057, 8992, 9686,
+    32774, 11463, 9003, 12787, 11272, 11055, 28673, 6050, 32881, 16981, 5592, 12554, 12696, 16537, 16910, 12780,
+    12945, 11474, 32797, 28673, 11474, 12408, 9077, 28709, 11421, 8565, 32877, 28681, 20483, 28686, 32794, 11354,
+    32857, 10749, 16964, 32833, 11400, 5254, 32936, 28729, 16761, 12730, 28755, 10706, 12672, 32805, 12832, 8789,
+    28784, 16621, 28808, 32858, 20483, 28711, 8720, 12799, 16845, 32774, 10712, 11460, 16527, 28709, 8712, 16535,
+    5638, 9300, 16429, 32865, 12701, 16649, 32934, 17156, 16603, 32844, 16773, 28826, 28690, 17308, 12622, 10811,
+    28811, 11157, 16541, 12384, 5313, 32791, 32781, 28725, 6085, 11717, 11472, 32829, 9364, 9320, 6350, 10490,
+    9375, 12692, 6328, 32922, 10107, 10676, 28784, 12741, 12996, 28734, 12568, 12996, 28743, 32890, 12706, 28793,
+    16858, 28726, 32781, 16657, 28803, 10756, 12956, 4970, 6406, 8499, 9388, 12984, 20486, 12312, 28721, 9861,
+    12485, 17043, 28723, 6180, 16485, 12456, 16983, 11105, 12984, 8993, 16478, 12984, 32856, 28734, 12821, 9087,
+    8710, 9320, 9437, 32789, 12660, 11048, 10802, 16979, 16764, 12347, 8301, 32935, 12826, 12427, 6448, 8420,
+    10460, 8621, 12430, 28805, 28706, 8401, 12960, 32794, 32828, 12537, 13070, 9160, 8904, 32794, 12296, 32884,
+    32918, 32794, 20486, 5462, 16846, 12312, 28754, 12383, 12797, 10279, 28736, 11753, 17150, 12960, 11763, 28694,
+    28710, 12960, 32856, 32780, 12972, 8683, 11268, 32871, 8704, 28811, 12958, 5088, 32831, 5592, 12358, 32814,
+    32844, 11754, 6342, 20483, 12990, 12788, 9983, 9272, 13097, 12310, 12462, 16936, 8490, 12714, 13112, 32858,
+    32878, 12984, 11873, 28773, 13135, 12383, 4503, 28687, 32895, 17146, 17045, 5835, 28713, 9580, 11837, 13135,
+    32801, 9790, 13056, 12414, 6451, 11003, 13124, 13146, 16428, 11880, 12588, 17011, 28713, 11859, 32806, 9269,
+    5448, 11812, 8250, 12516, 9853, 32809, 20482, 12742, 28690, 32828, 28689, 28806, 4270, 12972, 11844, 13061,
+    32896, 12899, 28808, 32877, 28696, 12585, 4783, 16734, 32807, 11883, 12732, 32806, 5472, 13136, 28725, 13101,
+    9974, 28805, 10279, 13007, 32792, 13145, 11180, 9385, 12332, 10460, 28720, 28707, 28800, 12414, 12876, 28764,
+    12399, 11420, 11917, 16530, 28674, 28696, 12378, 17224, 16973, 11771, 11772, 17081, 11772, 5362, 32844, 9983,
+    32872, 13126, 10976, 12972, 16936, 13126, 11945, 16542, 28709, 11945, 16490, 11473, 11917, 28772, 16698, 28700,
+    32918, 32902, 11055, 12971, 12822, 6299, 12333, 11916, 13087, 6057, 4269, 32832, 28698, 16742, 11005, 13089,
+    11413, 28708, 11398, 12540, 8549, 28686, 32790, 9265, 17077, 28772, 28773, 28781, 9607, 11011, 11297, 16912,
+    28807, 13126, 16895, 20483, 12875, 16577, 16764, 28721, 28721, 28796, 11310, 13131, 12312, 5749, 28701, 28698,
+    32846, 32801, 16640, 12840, 28757, 12731, 11144, 9388, 12587, 16858, 32907, 28744, 12610, 12459, 16766, 17082,
+    32805, 12844, 8600, 28709, 11951, 8733, 10706, 12503, 32853, 28794, 28782, 13108, 12597, 28690, 8591, 12367,
+    12312, 11747, 12356, 12732, 9656, 9386, 16528, 28793, 9087, 12633, 13114, 12540, 8782, 32781, 12292, 11479,
+    32785, 13100, 12405, 32901, 32829, 12958, 16934, 32778, 5915, 28711, 28689, 12615, 28680, 12418, 10771, 28772,
+    11354, 28784, 11754, 8984, 6265, 12695, 16904, 28684, 32891, 17131, 9608, 6137, 11673, 11080, 11354, 28676,
+    28696, 10750, 12815, 13008, 12648, 28797, 5929, 12982, 9585, 13048, 32812, 12960, 8312, 16719, 32909, 12322,
+    13115, 28685, 12477, 20487, 8789, 10782, 5112, 9982, 9616, 12983, 28726, 28684, 8993, 10023, 16403, 12331,
+    12660, 10795, 28723, 8301, 16540, 5185, 32832, 32774, 6417, 32869, 8713, 11972, 9152, 28795, 9879, 17243,
+    13090, 28741, 13163, 13134, 32807, 11920, 32843, 32896, 8700, 28703, 16805, 12533, 6033, 16497, 9377, 28684,
+    12556, 11762, 12006, 12006, 13074, 12006, 12005, 17220, 32805, 16434, 32790, 12452, 13103, 17124, 13159, 6198,
+    12753, 12720, 28801, 28796, 11609, 28723, 11997, 11338, 32841, 16935, 11399, 17318, 28753, 28702, 28691, 28796,
+    12724, 11310, 17138, 12658, 12526, 16924, 13115, 20490, 10797, 16698, 17068, 28744, 17216, 28737, 28720, 28783,
+    9007, 4722, 8551, 12624, 32778, 10802, 9964, 12929, 12744, 32812, 32908, 11105, 16767, 13060, 12839, 28765,
+    16665, 12779, 32787, 12886, 16830, 11414, 16447, 11395, 28801, 8422, 12960, 12465, 28704, 12956, 11341, 13124,
+    8790, 12503, 13103, 6035, 12646, 32855, 28694, 10227, 13076, 12576, 11910, 5878, 12983, 12360, 9342, 32926,
+    28809, 12960, 17000, 8952, 32928, 28783, 6452, 28759, 11653, 13174, 11944, 11873, 16850, 12928, 12295, 12342,
+    28794, 12743, 12536, 12850, 9943, 13077, 32884, 28683, 17137, 12886, 13170, 5650, 11171, 16786, 28684, 28697,
+    17067, 13203, 12755, 16732, 13203, 12816, 28802, 10263, 8250, 12420, 12443, 28781, 5103, 28764, 28694, 12403,
+    28702, 13048, 10437, 17199, 32776, 9078, 12887, 32926, 10795, 12291, 28757, 28783, 13138, 28787, 11056, 16519,
+    5112, 28745, 8790, 10811, 12612, 28685, 6187, 32826, 12480, 12850, 28686, 5813, 28713, 16776, 28771, 9620,
+    16435, 12935, 12346, 11055, 6139, 20481, 12392, 28735, 28683, 16420, 32820, 32777, 16974, 8343, 12415, 32846,
+    28774, 32804, 8300, 12682, 8424, 5491, 12851, 8459, 12742, 10795, 32833, 16639, 16405, 10212, 13126, 11873,
+    8424, 12588, 28793, 16483, 13174, 20487, 12459, 8277, 28723, 6152, 13192, 28701, 28732, 17151, 28775, 8723,
+    12621, 32858, 13115, 12941, 28771, 13124, 11990, 28774, 28754, 9641, 16485, 28712, 12336, 12860, 16656, 28674,
+    32902, 4311, 12860, 12357, 11055, 12053, 17230, 11379, 12053, 12052, 6231, 16696, 16777, 11115, 11408, 11347,
+    12593, 32882, 20485, 10614, 28753, 11759, 32832, 11997, 28806, 11932, 5618, 17209, 32803, 4404, 28689, 5835,
+    10415, 9163, 8234, 9918, 13179, 12396, 28783, 12972, 12923, 16539, 12453, 28694, 12851, 12303, 10866, 28739,
+    11963, 5592, 13041, 13192, 28807, 12947, 4252, 8414, 12767, 28730, 9676, 12995, 32842, 12720, 12864, 17088,
+    28788, 13104, 8584, 12312, 28696, 28680, 28698, 28698, 12406, 9686, 13114, 12912, 9377, 16594, 12839, 32833,
+    16779, 11157, 12483, 28696, 28722, 28757, 16530, 8981, 28742, 10489, 12348, 9727, 9965, 12656, 10490, 6057,
+    16461, 8980, 11950, 28680, 9209, 12874, 12005, 5592, 12900, 28716, 16541, 8636, 32884, 12354, 13137, 17225,
+    12394, 5462, 9584, 16937, 28816, 13008, 12060, 12863, 11348, 6187, 12367, 28725, 16981, 28695, 11595, 28699,
+    11479, 12773, 10229, 8469, 9291, 12982, 32778, 12381, 12454, 16568, 11161, 9941, 16470, 11923, 12324, 12837,
+    12959, 12597, 5627, 32898, 12388, 32831, 16858, 28684, 28724, 32774, 6312, 12815, 12334, 11574, 10706, 9945,
+    32850, 16721, 16528, 32777, 28805, 12972, 8832, 28763, 28728, 12598, 13072, 32832, 13066, 12068, 12539, 12004,
+    9474, 9076, 6149, 11157, 28676, 16621, 5106, 17170, 28828, 12725, 12970, 28805, 16931, 16585, 12633, 8533,
+    13007, 13060, 9181, 11990, 13113, 12382, 11962, 11596, 12312, 11208, 9321, 32845, 10349, 6231, 12713, 10851,
+    32817, 8566, 32898, 11609, 28717, 32883, 32818, 12732, 28770, 28674, 12597, 28707, 8474, 16831, 10962, 32778,
+    28692, 16737, 5730, 13077, 6297, 28726, 5671, 10115, 32856, 32806, 12952, 10066, 13100, 16858, 32883, 16912,
+    13055, 32793, 11677, 8787, 9284, 12802, 10862, 11759, 5484, 17239, 17012, 16857, 12624, 10877, 12444, 4459,
+    13102, 13137, 28725, 32870, 16825, 12537, 11806, 12932, 9779, 20482, 12561, 12580, 13070, 28750, 6462, 16834,
+    12934, 12644, 17124, 12405, 9377, 8576, 12731, 11458, 8787, 17150, 9077, 28749, 8798, 12840, 12671, 32788,
+    4635, 13104, 12743, 6189, 12933, 5915, 16846, 28746, 13128, 17306, 28708, 12992, 13134, 12511, 12876, 28794,
+    28727, 12635, 17106, 20485, 28724, 12372, 17224, 10208, 16846, 32877, 10723, 16508, 28793, 10743, 32856, 9386,
+    9000, 12636, 13180, 11150, 17067, 28763, 16458, 9387, 28677, 28729, 12605, 28690, 12049, 20482, 13138, 28752,
+    9933, 5664, 12920, 28740, 12611, 8417, 11387, 9068, 28684, 28766, 5062, 32793, 12929, 32842, 28705, 28696,
+    12309, 8768, 28707, 8583, 28706, 10687, 28757, 16463, 12764, 28757, 17171, 5628, 12718, 8790, 16696, 10459,
+    11703, 32902, 9675, 17051, 28803, 16598, 13007, 12407, 12300, 12486, 11079, 28684, 12360, 13092, 13102, 16746,
+    12958, 32920, 28678, 17294, 32927, 9229, 16671, 17000, 28811, 12455, 28756, 13200, 9802, 28771, 16846, 32877,
+    10046, 28712, 12315, 8357, 8490, 16491, 28718, 28705, 17081, 10047, 32793, 11407, 12310, 28709, 28703, 12383,
+    6044, 12504, 12648, 13038, 32843, 11110, 12971, 28805, 9575, 10789, 12839, 12466, 6057, 9022, 12524, 12645,
+    28805, 11042, 12867, 28758, 32807, 11125, 13127, 11640, 12598, 13066, 32857, 12501, 28758, 13031, 10976, 28806,
+    11646, 9657, 9452, 20481, 17219, 12634, 9256, 9287, 12396, 16728, 16674, 12347, 11050, 11603, 6447, 12298,
+    28707, 11712, 28694, 8555, 32777, 16981, 6457, 28810, 28781, 28806, 13019, 12430, 11653, 16578, 12643, 8490,
+    32773, 8787, 5166, 11058, 12441, 11464, 17235, 28698, 12863, 8599, 13214, 12773, 28744, 28684, 9963, 12696,
+    16485, 13215, 8583, 6059, 28756, 13104, 5648, 12972, 12324, 12070, 9180, 16587, 11681, 12485, 12478, 17245,
+    11451, 11755, 11178, 12821, 9366, 32851, 28680, 28741, 32910, 12681, 16621, 32788, 11105, 8993, 12406, 28697,
+    6450, 28709, 11652, 12324, 20484, 28704, 32803, 9157, 28795, 9683, 6187, 16408, 6174, 9497, 28746, 9446,
+    32857, 28806, 12535, 16606, 32801, 9723, 12753, 4566, 6187, 11399, 17071, 9385, 17051, 17058, 13222, 28805,
+    12994, 16807, 16973, 12838, 12588, 12590, 28734, 12307, 17250, 11042, 9554, 9169, 17167, 16858, 32807, 6071,
+    12357, 32915, 8278, 28704, 11609, 28758, 12400, 11434, 28681, 16542, 28697, 28793, 16449, 16419, 4970, 8319,
+    16579, 28681, 28698, 10150, 17045, 28716, 12310, 16858, 32871, 28821, 12596, 12922, 9088, 11699, 16925, 28821,
+    12480, 16937, 10497, 28697, 4984, 12851, 32819, 10645, 20485, 28755, 12646, 12852, 16832, 16688, 12417, 28809,
+    9854, 28820, 16517, 32857, 11692, 28744, 9089, 32817, 12707, 11857, 12770, 5460, 32793, 28760, 12484, 10852,
+    17058, 12563, 10797, 20481, 12962, 28805, 12359, 28699, 28817, 28818, 16519, 12737, 12777, 9037, 11697, 28818,
+    11144, 12840, 9586, 16674, 28708, 28783, 10816, 11282, 11653, 12756, 17094, 12427, 12454, 17067, 28737, 28806,
+    13048, 32824, 5088, 28819, 28798, 12545, 28700, 32813, 28794, 9564, 11166, 28808, 13006, 16778, 4716, 6457,
+    9466, 32819, 16603, 9386, 17003, 32859, 4394, 28808, 16728, 10584, 32936, 32910, 12821, 12348, 9087, 12464,
+    28796, 17382, 8702, 17382, 17380, 11460, 32840, 16455, 12815, 28704, 17382, 20482, 10573, 12480, 8533, 28714,
+    12067, 8234, 32933, 28694, 9468, 6215, 10805, 32819, 6452, 12646, 11952, 10944, 12970, 8778, 12742, 11354,
+    12748, 11180, 32831, 13030, 9534, 6321, 28694, 9499, 28683, 28752, 28795, 28703, 12455, 10583, 28797, 16844,
+    28758, 13055, 16507, 28784, 9539, 9162, 16605, 16973, 13173, 12995, 32816, 28823, 8491, 17088, 32818, 13136,
+    13042, 12852, 16851, 12872, 28727, 6448, 28709, 28726, 8648, 9385, 32780, 9430, 6218, 32781, 12659, 12586,
+    17381, 4410, 10841, 28812, 8790, 12355, 8533, 8615, 28716, 16779, 12984, 8368, 12730, 6057, 17156, 4266,
+    8739, 9053, 11507, 13043, 16518, 4443, 10811, 17093, 16548, 28736, 16491, 12947, 5491, 28759, 12852, 16420,
+    16584, 6231, 28818, 16584, 28775, 11353, 16779, 8584, 12837, 28721, 32803, 8570, 12660, 16655, 11400, 11182,
+    32778, 28687, 28817, 32877, 16606, 28817, 5664, 13072, 8919, 8788, 10005, 16895, 13103, 6224, 10516, 32801,
+    16404, 13207, 16649, 8250, 28724, 32829, 12695, 9022, 32935, 32832, 9656, 32854, 4999, 8763, 6057, 12587,
+    12061, 16508, 28714, 28767, 11908, 9235, 10563, 6230, 16733, 12600, 16549, 28711, 9358, 32846, 28808, 9320,
+    20481, 11157, 28733, 32855, 32833, 13008, 6181, 6410, 8647, 28704, 12707, 8445, 32816, 12348, 12416, 12451,
+    13030, 28685, 12755, 12506, 6451, 8687, 11140, 5369, 17312, 12438, 28692, 4689, 28728, 5592, 13125, 12619,
+    12536, 32906, 12323, 28742, 9815, 12474, 9617, 28757, 5411, 17045, 11110, 17172, 8397, 6407, 16965, 12500,
+    9738, 12802, 13185, 28693, 28722, 12972, 13170, 8300, 9319, 12703, 13198, 20490, 16517, 28782, 28760, 8931,
+    13224, 17214, 12928, 11137, 8413, 13049, 4984, 28785, 12557, 12479, 12429, 10795, 12608, 9912, 12790, 10569,
+    12702, 13030, 32820, 28767, 4944, 17373, 16530, 28693, 6354, 11449, 13072, 10414, 12432, 9723, 9591, 28723,
+    8988, 28737, 10570, 12940, 28795, 11646, 12419, 28682, 32781, 9377, 6418, 10407, 13180, 12692, 17338, 6328,
+    11261, 17146, 28682, 5592, 28706, 12887, 8939, 28797, 13138, 12929, 28708, 20482, 20483, 17038, 12803, 12418,
+    16688, 11395, 12585, 28708, 28805, 8272, 8532, 17174, 12333, 28796, 32879, 9064, 12837, 16451, 28735, 16536,
+    8665, 28818, 13196, 13200, 8789, 28822, 16439, 13139, 11403, 11347, 10862, 28683, 4587, 11005, 10795, 10802,
+    12371, 16642, 12369, 12383, 5541, 6328, 28722, 28794, 13102, 20481, 28740, 12515, 28725, 11702, 8266, 16790,
+    28783, 13150, 28810, 11094, 10579, 12343, 12940, 11908, 10810, 13061, 16934, 12972, 16846, 12470, 32923, 11094,
+    5576, 12297, 16571, 9306, 9620, 32780, 28779, 13103, 16843, 11410, 28797, 12810, 13110, 8479, 28697, 17314,
+    6363, 28807, 28708, 28795, 16643, 13115, 9321, 12728, 12729, 12474, 12981, 16609, 16420, 28827, 16449, 28737,
+    9824, 28738, 11048, 12636, 28776, 32897, 32883, 9003, 32846, 11750, 28685, 28702, 10877, 12941, 8751, 32816,
+    17077, 6461, 17410, 17245, 16530, 12300, 28733, 16405, 12047, 28822, 28794, 32802, 12556, 11393, 13170, 28818,
+    16419, 17366, 9473, 9654, 8249, 12528, 6433, 6085, 9387, 12839, 12321, 8238, 8789, 12408, 28748, 10450,
+    5497, 12426, 11094, 17156, 16658, 12312, 12970, 32779, 28673, 9463, 32839, 16852, 20483, 12516, 28761, 32820,
+    16491, 13091, 12391, 17015, 12347, 13065, 28813, 12732, 5194, 12426, 13068, 9780, 17015, 28705, 13056, 5664,
+    11733, 28734, 28692, 12864, 12580, 8788, 12869, 32793, 9168, 28744, 9965, 32780, 12840, 28687, 8605, 9314,
+    11654, 9619, 12348, 28795, 12068, 32829, 32845, 17247, 28820, 12899, 16609, 17174, 12063, 12859, 17302, 17093,
+    9169, 11409, 28686, 5072, 28805, 12381, 12516, 17171, 13113, 17011, 32900, 10281, 12672, 12732, 11347, 11474,
+    11176, 11910, 8966, 12358, 11101, 16937, 8397, 12010, 28777, 32819, 12473, 12814, 32819, 11473, 17411, 28787,
+    17037, 12647, 28757, 9983, 12345, 12675, 8904, 11070, 16858, 28706, 28683, 16536, 12802, 13077, 8552, 28803,
+    12957, 28828, 17088, 13064, 8307, 16684, 8625, 12415, 11470, 28806, 11171, 20482, 12345, 13092, 9666, 6400,
+    28777, 28683, 28783, 12851, 13102, 16609, 11778, 13031, 4605, 28695, 10867, 11873, 16735, 13102, 28705, 8721,
+    28782, 32831, 12968, 17409, 28815, 16526, 9676, 12839, 6462, 5268, 12720, 12019, 16604, 9514, 12431, 17245,
+    32780, 32818, 12884, 16619, 4728, 11275, 12600, 28731, 16699, 28817, 16577, 28723, 12970, 32831, 12648, 12329,
+    16992, 12597, 12306, 10264, 16692, 12312, 17406, 12971, 11653, 12993, 4452, 12672, 13151, 6059, 10706, 12999,
+    32815, 12839, 28812, 12983, 16877, 5497, 8779, 28809, 13128, 6459, 13003, 12417, 12407, 8752, 17308, 32906,
+    13180, 28757, 12849, 16564, 11754, 8355, 12564, 32849, 28801, 12771, 11768, 13091, 13138, 12801, 16706, 12756,
+    12336, 10802, 17146, 5639, 13080, 28673, 12321, 9800, 16775, 28756, 12929, 28725, 13015, 5420, 13126, 32881,
+    28804, 12708, 11459, 12384, 9358, 12310, 10871, 13186, 16695, 13114, 12981, 13187, 32777, 8467, 12394, 28689,
+    13103, 12743, 8852, 32779, 12058, 9375, 13149, 17323, 28785, 9952, 12503, 16746, 28696, 8479, 12958, 32832,
+    28695, 12298, 28694, 12862, 11475, 12333, 9089, 11175, 16990, 28759, 9579, 4473, 32777, 10498, 28765, 12898,
+    32915, 12821, 12942, 32794, 17070, 12840, 13113, 28817, 10284, 20487, 16856, 12467, 13013, 12499, 11993, 9059,
+    12348, 28713, 17124, 28783, 11699, 13020, 12357, 12456, 17251, 28724, 10743, 12658, 16636, 28737, 8848, 13072,
+    16727, 17130, 32859, 12632, 32843, 28689, 12911, 12526, 12547, 12312, 12762, 17253, 16990, 12371, 32859, 12994,
+    12839, 32879, 8790, 8453, 12660, 17156, 28822, 28722, 6433, 9280, 4357, 28700, 12396, 12503, 32850, 10208,
+    32777, 17077, 28696, 9836, 13181, 28735, 28783, 28753, 28754, 10880, 10567, 12319, 16530, 28793, 10743, 9609,
+    12379, 12825, 12993, 9671, 6328, 11976, 17353, 8667, 32868, 28811, 12526, 10625, 5915, 10749, 28695, 11779,
+    16445, 10252, 12347, 16776, 11945, 16420, 12863, 32923, 8848, 16735, 11696, 11755, 28706, 10652, 13154, 16801,
+    32916, 9228, 9367, 6460, 10862, 32890, 16506, 32807, 10826, 12071, 16853, 10583, 32901, 16506, 9956, 16737,
+    8752, 32859, 17016, 16853, 8271, 32793, 28768, 12076, 16973, 16538, 8667, 28801, 13060, 13114, 8875, 10581,
+    32881, 12584, 9226, 12648, 28695, 12480, 28807, 10962, 8768, 6187, 12920, 4473, 12681, 17395, 28809, 13091,
+    13007, 9619, 6022, 5169, 4529, 6158, 8848, 12972, 12453, 32890, 12384, 13089, 28737, 12395, 28807, 28692,
+    12327, 12670, 32780, 12729, 9585, 28683, 12840, 28766, 13193, 16741, 9564, 28723, 16586, 28734, 4635, 12455,
+    12062, 28781, 11646, 12587, 28821, 9126, 13199, 17027, 5234, 17253, 12715, 13152, 28770, 16682, 28765, 10924,
+    12971, 8612, 28806, 9517, 28777, 28763, 8470, 28734, 28674, 13188, 32778, 28674, 12804, 28767, 28718, 28807,
+    32778, 8779, 17234, 32806, 8700, 28676, 11332, 10858, 28756, 10028, 28721, 11908, 11125, 6231, 16621, 9561,
+    8389, 32818, 9918, 12708, 12384, 5672, 28702, 28722, 12864, 12067, 8898, 13115, 12888, 4303, 16667, 5929,
+    12719, 32851, 9641, 12645, 8692, 10191, 16807, 28737, 11707, 13128, 10461, 12342, 12557, 13137, 9720, 12011,
+    4948, 12633, 12682, 28701, 32855, 28687, 5794, 32839, 20481, 12466, 17241, 32858, 12960, 8549, 12535, 12761,
+    28706, 28721, 12061, 11697, 12454, 10583, 28805, 9656, 28698, 12744, 13171, 10444, 28687, 8489, 16598, 9386,
+    8424, 32807, 8756, 28724, 28721, 10459, 32866, 12752, 12539, 16697, 28734, 28698, 12071, 13179, 12811, 11952,
+    20490, 28680, 28776, 6230, 13114, 9182, 16516, 12356, 12821, 12984, 16440, 16754, 16519, 13200, 16857, 28699,
+    12407, 28673, 32833, 12695, 6400, 11773, 10281, 28692, 32927, 12983, 17339, 10264, 12682, 9012, 32891, 9097,
+    9207, 28793, 8359, 12346, 12393, 28683, 10757, 12972, 9310, 16760, 12754, 12882, 12983, 12660, 28759, 16621,
+    32833, 9196, 12336, 13008, 32869, 11951, 12979, 13090, 10407, 28691, 28737, 8658, 10483, 17220, 12883, 12744,
+    32859, 8301, 12384, 9146, 9773, 17113, 20481, 16621, 28805, 8295, 28775, 12357, 28770, 12597, 12586, 12300,
+    12872, 28798, 12051, 11908, 11390, 12971, 17322, 28795, 5361, 16490, 8321, 11150, 13224, 32877, 11349, 10664,
+    13127, 28803, 32801, 8229, 9683, 28724, 13032, 16756, 32838, 28674, 12588, 16745, 4263, 12683, 32792, 17216,
+    10173, 13191, 17068, 5063, 32883, 12723, 28745, 8537, 32814, 12068, 8752, 28772, 17260, 32877, 32794, 13212,
+    11939, 16535, 32842, 12426, 5929, 12871, 13116, 16577, 12870, 32802, 12790, 9977, 4698, 9889, 32805, 5087,
+    32858, 28724, 8848, 12607, 8788, 16825, 13115, 13137, 12309, 28734, 16411, 8621, 12335, 10712, 17159, 32855,
+    13031, 12756, 9599, 17216, 12825, 11115, 32781, 12863, 12018, 13125, 16656, 12575, 32804, 8590, 9168, 13152,
+    10663, 28705, 20486, 9687, 9040, 12888, 32777, 16751, 12682, 28734, 12360, 12408, 6230, 12765, 28818, 32789,
+    10579, 12348, 32857, 12390, 13113, 12883, 32775, 28696, 28693, 12598, 8479, 11607, 13128, 28802, 5981, 28777,
+    9706, 28689, 10402, 28719, 28734, 12355, 4951, 6224, 10667, 11455, 28819, 6456, 8383, 32924, 12383, 28795,
+    12452, 9294, 12511, 13049, 16597, 12852, 10811, 17236, 28770, 28818, 16993, 17303, 16700, 28773, 13115, 12765,
+    28781, 12821, 16620, 28686, 12324, 12849, 10876, 28750, 9169, 5654, 12598, 28761, 32856, 8403, 9636, 12605,
+    32854, 12539, 9686, 11646, 10688, 17373, 5664, 16439, 10677, 12909, 28811, 28806, 12707, 8982, 32826, 5536,
+    12775, 17130, 6465, 28819, 10815, 28710, 16937, 16648, 13018, 28747, 11707, 11478, 16932, 28776, 9925, 11347,
+    28689, 28793, 12049, 20488, 10962, 16684, 16446, 28697, 10407, 28766, 17071, 16582, 9685, 12862, 13056, 12062,
+    8389, 13204, 8789, 32816, 28771, 10065, 8412, 12477, 11454, 16854, 32846, 6446, 12732, 5275, 10506, 16515,
+    12741, 28818, 28804, 28787, 12034, 10483, 17004, 17366, 10712, 28805, 28799, 12932, 10966, 32877, 12703, 32929,
+    11778, 5629, 17000, 13044, 28780, 9088, 13053, 13061, 17217, 28686, 11110, 28806, 12648, 32827, 28721, 17326,
+    12400, 12838, 12840, 28771, 16446, 32890, 28805, 28798, 28741, 32895, 6328, 6409, 12309, 12322, 12687, 9083,
+    16394, 12489, 12351, 11992, 12754, 16772, 12683, 11035, 17106, 12804, 13091, 4955, 10976, 12695, 28770, 28714,
+    20485, 12864, 10770, 12671, 13056, 28707, 16981, 12754, 12883, 28744, 32877, 9075, 28783, 12380, 12755, 13031,
+    28732, 10158, 12047, 16492, 10748, 28683, 5497, 12947, 8423, 5454, 28718, 12885, 12456, 12072, 11059, 16440,
+    9563, 28787, 12887, 28679, 16608, 32877, 28674, 12848, 13116, 10450, 10712, 8874, 13019, 32818, 9862, 10876,
+    5491, 32829, 5554, 17004, 28796, 28700, 28795, 10712, 28694, 6465, 32774, 9686, 10858, 13139, 12454, 28744,
+    13101, 28793, 28775, 9564, 12756, 12393, 20489, 17323, 13198, 8992, 16835, 12927, 16973, 9387, 12873, 28683,
+    8667, 6418, 12851, 16621, 32933, 12350, 5077, 12810, 9687, 12870, 8981, 28751, 11150, 6313, 9265, 32833,
+    12755, 10444, 12783, 32780, 11005, 13005, 28722, 8604, 4758, 9280, 9388, 16542, 11599, 16914, 17045, 32820,
+    9796, 16614, 28794, 12756, 12383, 28681, 28775, 17172, 16621, 12348, 12525, 13176, 10270, 17051, 12821, 11631,
+    10371, 32830, 16990, 11353, 16609, 11758, 9319, 12888, 16542, 28818, 28785, 12300, 6180, 8802, 12852, 28757,
+    16898, 5674, 5627, 28774, 11952, 13049, 13074, 28742, 28749, 12876, 32827, 32831, 9676, 12872, 32796, 32772,
+    6185, 11323, 32842, 12838, 32793, 28793, 17156, 28824, 4187, 28817, 12645, 17130, 12403, 28704, 10461, 12918,
+    17167, 8845, 13224, 32893, 32890, 20486, 12861, 28694, 10867, 12766, 28782, 32776, 32828, 12395, 28695, 12939,
+    10998, 13135, 32780, 12755, 13185, 12671, 10410, 13112, 12701, 9474, 28688, 8491, 17157, 32781, 28771, 28789,
+    17013, 28772, 28722, 13124, 10812, 4258, 12323, 28730, 9561, 10011, 32801, 8528, 16541, 10806, 32807, 8465,
+    13104, 32844, 16437, 28788, 28795, 12692, 17011, 28759, 9355, 12311, 13171, 28793, 16413, 9975, 5429, 16488,
+    28790, 28696, 17091, 8912, 13042, 28790, 9743, 9085, 12668, 12642, 12659, 28822, 16608, 28801, 10490, 11413,
+    28768, 12813, 9488, 12318, 10196, 32828, 12779, 12851, 28723, 28797, 13006, 12582, 20485, 32780, 28764, 28705,
+    12335, 28701, 8405, 28745, 28763, 13176, 12927, 13003, 12432, 12730, 17011, 13182, 32793, 17184, 8491, 17213,
+    12062, 9900, 16621, 9547, 10704, 10452, 9491, 13184, 28684, 12992, 12356, 12706, 12405, 28805, 28803, 16457,
+    32882, 8918, 28771, 12864, 10816, 10198, 12743, 10815, 13168, 28794, 8786, 12840, 28716, 28740, 28723, 13028,
+    10513, 11275, 17160, 9981, 10975, 6048, 32870, 28695, 11111, 10741, 28813, 10851, 13215, 28729, 9965, 28808,
+    10285, 17160, 16844, 8658, 16776, 12299, 28737, 12839, 12756, 32932, 16620, 9057, 17001, 10460, 11955, 28714,
+    17132, 12990, 8423, 10756, 12369, 8423, 12345, 17401, 10751, 5076, 28793, 16412, 9673, 12738, 28794, 17083,
+    28694, 13208, 32910, 11353, 28771, 12393, 11657, 11310, 6051, 9592, 10580, 13139, 12451, 28676, 16988, 11618,
+    28807, 28693, 16655, 11048, 32920, 28826, 12406, 11908, 12073, 13078, 12939, 28819, 12486, 10797, 28783, 9685,
+    9131, 28742, 16596, 8469, 5603, 12440, 10810, 8678, 17122, 12515, 16993, 28684, 8778, 12872, 32837, 12802,
+    10741, 28705, 9620, 13181, 13091, 6152, 13067, 16990, 17162, 28734, 32914, 28817, 11470, 32820, 11997, 28694,
+    12862, 12588, 12960, 16657, 8277, 9617, 9890, 28816, 12368, 12058, 10208, 28700, 12598, 11040, 11753, 28760,
+    16462, 17124, 16658, 13102, 28701, 16855, 13204, 12379, 8344, 10743, 8489, 11354, 8865, 5411, 12957, 11914,
+    16530, 28697, 8723, 16856, 6209, 12480, 32826, 17146, 28822, 12579, 12408, 12442, 4860, 5563, 28766, 12929,
+    9984, 8491, 13131, 28800, 12660, 8722, 12295, 11395, 16440, 28819, 12659, 10553, 12318, 11403, 28793, 12371,
+    28759, 9551, 28733, 28714, 28699, 16794, 32773, 32790, 12564, 13179, 28683, 16490, 17313, 17387, 5893, 13072,
+    12684, 11100, 28767, 12929, 16484, 28767, 8490, 12941, 16505, 11686, 11109, 16778, 5497, 28742, 12912, 16694,
+    12452, 11752, 12655, 12356, 32776, 16990, 12718, 13193, 28713, 28706, 32804, 4555, 12910, 9022, 28726, 12982,
+    28811, 5592, 10217, 11347, 32890, 28818, 28794, 28779, 28761, 16615, 16537, 32926, 17215, 12382, 17000, 8609,
+    10513, 16609, 12904, 28707, 8744, 5929, 13125, 12394, 10571, 12898, 8767, 28805, 13164, 11042, 32936, 32788,
+    12657, 4618, 12659, 13216, 12573, 17299, 10749, 10264, 12527, 13078, 13145, 12892, 28729, 12430, 8620, 12345,
+    10498, 9355, 9358, 12403, 13030, 12441, 17077, 12886, 12756, 13152, 12984, 17288, 32789, 32870, 32852, 17326,
+    28721, 13003, 9610, 28792, 12587, 12467, 12598, 28698, 28794, 5914, 13223, 28807, 9673, 13191, 17196, 28700,
+    12624, 32820, 16884, 5106, 28795, 11560, 28807, 12941, 12647, 12477, 17088, 12535, 12741, 5669, 9375, 28708,
+    11574, 28711, 6442, 11763, 9321, 28752, 12598, 12936, 12587, 28751, 28804, 8491, 17059, 28772, 10190, 17288,
+    10517, 12969, 12647, 4954, 12596, 13005, 17060, 11951, 10116, 17309, 28683, 28783, 16541, 16448, 28758, 16563,
+    17089, 12631, 12692, 12659, 13047, 28719, 28762, 11469, 12369, 28702, 16438, 17295, 16777, 13140, 28733, 9620,
+    16913, 9666, 8405, 32802, 8539, 12609, 9373, 6234, 12995, 12348, 11048, 32845, 28759, 6031, 12304, 13128,
+    10648, 13080, 12443, 16656, 32872, 13047, 11114, 16850, 12703, 11622, 28675, 11707, 11633, 9854, 9610, 12395,
+    5664, 10554, 12399, 16462, 13103, 9089, 28723, 8809, 28706, 12731, 28750, 8403, 12648, 28696, 11392, 8723,
+    13008, 9850, 6218, 12504, 13003, 5614, 17060, 17324, 4716, 28751, 11951, 11144, 5671, 10749, 12755, 32917,
+    32859, 8423, 10399, 12443, 28675, 28696, 12992, 32869, 28705, 12804, 12958, 12948, 12393, 32902, 28683, 12933,
+    17093, 17173, 9619, 28774, 32858, 12669, 32820, 11997, 28689, 28721, 12431, 16527, 9673, 11465, 28794, 28736,
+    12972, 16485, 12923, 11996, 32793, 10944, 17092, 16620, 13059, 12899, 5106, 9051, 28819, 12430, 9375, 28702,
+    32872, 12539, 28752, 6159, 9531, 10262, 13191, 6389, 12672, 20484, 17228, 11574, 28690, 12804, 12660, 9167,
+    12461, 10838, 12647, 28708, 6400, 5582, 17045, 28737, 16653, 12296, 28722, 17162, 16541, 6272, 28751, 32820,
+    12066, 32927, 16856, 13103, 28758, 28717, 12840, 13071, 11763, 28689, 9619, 28825, 11169, 32901, 9067, 12840,
+    6407, 12752, 28771, 28742, 17374, 11406, 12392, 17015, 17308, 11393, 32794, 32849, 13192, 32831, 28793, 16541,
+    17296, 9762, 28771, 28721, 16682, 12526, 10789, 28817, 9088, 13032, 9916, 10246, 32933, 8737, 9666, 28683,
+    13139, 8892, 11181, 12777, 10760, 9255, 11666, 28783, 9533, 11012, 28727, 12828, 28812, 12766, 16698, 12658,
+    17095, 12396, 13127, 13041, 13146, 12730, 32898, 10254, 12894, 13041, 32820, 9562, 16700, 11574, 28744, 12495,
+    13092, 16502, 11713, 10517, 12497, 8658, 16447, 28713, 17162, 28772, 11574, 12312, 12984, 12429, 12648, 32776,
+    28696, 17368, 12756, 28759, 32820, 11137, 17160, 16887, 32857, 5900, 12564, 32858, 17251, 13180, 5143, 13115,
+    28805, 12660, 32849, 28741, 8478, 28772, 9673, 20488, 9657, 11657, 28779, 8667, 13076, 9022, 17294, 10260,
+    28712, 12046, 11466, 16684, 28739, 12538, 8489, 12959, 12539, 28806, 28785, 28815, 11652, 5074, 32892, 28802,
+    11609, 17092, 32814, 20482, 17051, 6152, 10758, 28828, 32818, 32794, 16587, 28722, 9964, 16779, 8233, 13049,
+    12467, 12684, 12863, 13058, 28731, 8767, 8778, 12319, 32928, 32868, 12635, 12456, 12456, 12331, 12551, 12840,
+    12994, 17166, 20488, 12672, 11181, 5113, 4473, 16980, 16762, 10865, 28806, 6138, 12863, 10582, 6056, 28749,
+    6453, 10706, 12300, 16430, 6022, 12441, 13140, 28743, 13059, 9687, 12658, 32790, 9367, 32815, 12382, 16920,
+    12431, 28770, 28703, 10560, 12969, 32902, 28740, 28779, 12598, 12826, 12836, 32857, 20485, 11403, 12477, 13216,
+    11464, 13192, 9683, 32803, 4339, 8368, 12623, 16707, 28796, 28824, 13158, 9310, 28794, 9975, 28685, 12512,
+    5425, 11180, 16775, 12862, 9385, 13139, 13104, 12392, 12538, 12884, 28769, 12599, 12072, 12764, 11573, 6410,
+    17290, 28709, 11702, 8594, 11775, 32883, 17298, 16858, 9899, 11110, 17148, 9375, 12428, 12348, 11906, 6200,
+    12918, 12406, 16542, 13202, 28755, 11291, 12919, 11895, 11646, 28707, 8322, 9986, 10563, 11304, 11073, 28698,
+    13061, 4658, 17210, 28702, 12821, 13103, 12312, 12768, 28712, 5275, 32815, 12571, 17287, 11164, 4390, 32814,
+    12360, 11393, 28807, 28707, 17387, 12804, 16594, 12464, 10804, 13092, 12461, 16834, 11646, 28753, 28786, 12960,
+    28677, 12346, 16814, 32902, 12319, 28813, 28741, 12930, 32898, 16463, 13102, 8917, 12943, 12732, 17402, 5455,
+    16458, 12777, 11161, 28819, 13052, 13030, 12670, 9088, 12816, 28753, 12658, 28793, 28795, 28693, 12876, 28677,
+    8480, 12653, 32921, 28820, 13012, 12756, 28686, 10160, 11468, 12898, 16507, 28752, 12356, 6466, 12729, 12861,
+    12395, 12660, 13018, 16595, 13032, 6454, 5076, 17012, 10858, 9675, 32818, 13163, 28781, 10851, 16435, 32882,
+    17016, 11706, 28825, 32872, 12636, 11409, 28817, 12737, 12694, 17079, 13092, 16620, 16687, 12356, 10271, 8322,
+    16405, 20487, 16834, 10554, 32826, 17009, 32909, 13076, 28771, 16671, 28702, 12946, 32779, 12355, 9241, 11393,
+    28727, 28828, 12507, 13063, 9517, 10881, 12369, 11470, 11609, 12648, 17151, 16857, 17158, 5900, 20485, 6152,
+    12730, 12658, 12319, 32927, 32872, 13018, 17000, 12540, 11692, 16654, 32923, 11400, 5658, 28686, 13164, 9739,
+    11768, 5920, 13056, 13127, 11481, 8491, 13175, 8294, 12354, 28687, 12766, 12599, 28696, 16409, 12754, 32928,
+    6440, 13063, 17000, 28707, 12645, 12749, 12358, 6021, 10789, 12438, 13019, 16445, 11418, 12008, 8790, 28774,
+    17253, 6230, 12883, 12358, 8337, 6187, 8248, 10572, 20483, 16753, 16542, 32903, 17009, 20482, 16909, 28800,
+    11447, 11150, 28697, 6049, 12765, 12624, 17404, 17287, 11163, 28777, 9497, 9246, 11653, 16540, 11430, 12941,
+    11075, 10867, 6339, 10795, 28775, 12915, 8898, 12777, 11088, 8721, 11892, 9846, 8490, 11157, 32896, 10008,
+    32818, 16693, 12849, 11873, 13112, 17011, 12981, 8911, 12462, 16518, 17411, 12941, 17373, 12744, 10882, 16463,
+    13079, 8779, 12539, 12599, 28745, 12754, 12960, 12959, 28761, 32884, 12876, 32817, 12393, 28769, 12884, 28797,
+    5491, 28827, 10159, 9388, 17392, 8285, 10272, 9485, 13061, 12883, 12862, 28673, 9198, 12444, 8789, 32845,
+    6405, 28752, 12864, 12959, 32849, 12425, 16773, 11873, 12428, 12536, 5804, 12872, 11088, 4714, 28751, 28675,
+    16440, 28769, 12868, 6335, 12594, 6448, 16461, 12984, 28818, 9600, 11165, 6456, 32806, 5639, 10663, 28794,
+    32913, 9771, 11400, 12979, 10272, 17359, 13071, 12732, 12772, 28694, 16745, 28784, 17004, 9388, 8929, 12431,
+    4452, 28677, 11561, 12621, 17293, 11166, 9534, 11094, 32907, 32803, 17026, 28761, 16576, 28706, 17174, 4827,
+    12922, 16436, 10027, 16722, 12684, 28728, 32897, 16621, 4473, 12647, 12394, 13092, 28765, 17082, 10816, 16542,
+    28762, 6224, 32828, 4860, 13203, 13137, 12599, 12473, 12991, 12508, 8621, 9660, 28763, 12429, 10579, 8949,
+    28682, 10985, 12323, 5491, 13068, 28691, 13061, 32818, 20482, 28688, 28720, 9375, 9218, 6231, 12906, 11603,
+    9600, 28709, 12696, 8571, 32896, 28753, 12427, 11779, 12321, 9969, 13219, 9923, 28807, 8880, 16628, 12454,
+    10563, 9012, 9302, 12730, 9217, 11058, 12994, 9377, 28710, 12359, 32850, 13193, 12833, 17026, 12868, 8234,
+    28702, 13137, 17216, 28750, 12600, 12756, 11463, 12893, 12571, 9590, 13135, 12960, 28783, 28700, 28720, 28827,
+    28692, 6051, 28763, 8547, 12658, 9203, 28724, 16484, 11111, 9675, 12876, 8814, 8949, 28701, 10986, 32791,
+    9562, 16456, 16421, 16820, 9610, 8402, 12559, 16410, 9459, 8610, 16571, 28754, 11873, 12743, 32933, 12972,
+    13065, 13185, 9264, 8410, 28752, 12347, 6363, 13209, 16537, 13017, 13101, 12053, 28702, 12732, 28702, 32817,
+    8389, 28724, 12347, 16525, 16405, 12011, 10285, 12688, 16459, 12648, 12492, 5206, 28793, 12584, 12461, 16542,
+    16519, 10349, 16609, 12465, 13122, 10197, 12996, 11991, 12307, 16448, 13172, 20484, 12911, 8790, 13072, 16957,
+    28761, 12598, 32818, 17082, 28688, 28827, 17298, 16460, 28675, 11763, 10663, 28752, 16619, 4473, 10743, 28800,
+    28681, 12344, 28817, 8402, 12596, 17313, 16745, 32854, 16833, 10811, 4635, 32832, 6445, 6406, 12443, 9264,
+    11584, 10646, 12679, 12429, 16743, 12780, 28769, 9445, 17069, 16552, 6407, 6328, 17319, 12525, 12695, 13126,
+    10664, 12491, 28794, 28818, 12619, 16461, 32935, 17398, 12358, 32870, 28811, 16858, 32829, 12839, 12957, 9271,
+    9563, 12360, 8322, 28719, 16438, 11480, 8621, 28772, 16451, 11993, 13135, 12007, 11439, 12516, 12872, 12299,
+    12597, 32841, 28770, 28791, 12585, 13210, 12774, 10867, 6051, 28693, 17288, 9959, 5093, 8620, 16677, 6387,
+    12012, 11879, 10882, 8423, 16395, 12478, 17003, 6057, 11468, 28727, 9984, 28709, 13113, 8677, 13020, 12768,
+    10877, 12670, 17211, 6317, 32880, 16775, 4408, 17161, 32830, 16760, 13101, 4530, 12323, 12358, 10962, 28753,
+    12299, 17381, 11042, 12408, 12669, 28797, 5481, 12996, 10805, 12383, 32908, 17244, 12540, 6465, 17252, 32885,
+    13006, 11048, 13018, 12420, 12744, 10945, 28696, 12583, 16463, 32804, 10986, 28825, 12912, 13102, 8696, 12299,
+    16752, 17051, 12791, 12838, 10963, 8760, 12371, 16524, 9982, 12728, 12477, 11654, 28799, 12394, 28821, 9276,
+    12521, 12720, 10517, 12348, 17409, 12498, 32794, 12501, 9131, 32788, 16834, 12768, 28725, 9508, 4968, 11385,
+    32919, 16957, 16697, 6354, 4296, 9302, 12834, 12754, 32882, 10208, 16764, 9681, 4259, 12463, 12923, 13126,
+    11769, 9672, 28781, 5925, 32828, 28713, 17174, 12567, 16588, 28704, 28825, 12883, 28723, 12658, 28818, 6410,
+    12344, 12524, 13192, 12293, 28805, 28784, 32859, 32846, 32857, 5629, 32855, 17251, 8314, 12872, 11161, 9365,
+    11319, 28818, 10664, 12796, 28795, 12983, 13139, 17132, 28784, 6033, 28756, 16845, 9619, 12983, 16686, 32775,
+    12008, 12347, 6452, 12540, 12596, 12960, 8554, 12536, 12839, 9708, 20485, 28694, 32866, 12527, 13019, 11478,
+    28795, 12643, 12597, 11873, 13073, 11011, 16936, 10507, 9202, 12960, 12311, 28743, 28747, 9076, 10481, 4697,
+    28753, 16835, 28738, 12312, 11883, 5061, 13103, 28747, 13061, 28713, 28719, 9241, 12360, 28806, 28683, 28790,
+    32897, 12821, 32830, 6400, 10872, 28693, 12981, 13178, 28772, 11859, 28800, 12957, 28789, 12647, 12054, 16720,
+    16598, 12502, 5113, 11319, 32914, 28743, 12840, 13140, 16845, 4698, 32814, 13212, 9630, 28705, 12307, 10776,
+    11692, 28782, 12486, 28795, 13163, 13089, 28714, 28684, 4716, 32804, 4542, 6456, 12840, 32819, 12006, 28686,
+    12995, 12883, 13003, 28750, 28772, 5163, 10963, 9012, 16700, 12909, 11474, 32779, 11692, 28709, 12497, 8565,
+    11056, 13175, 28723, 12454, 16462, 11955, 10270, 12872, 12498, 9174, 17403, 9467, 13156, 9580, 12545, 12513,
+    11758, 28705, 13218, 28750, 11158, 12739, 12897, 9451, 11699, 13124, 12513, 17295, 16421, 28796, 32818, 32913,
+    32934, 12849, 12969, 6168, 12491, 9554, 5598, 28700, 16538, 28715, 16421, 28807, 9807, 13169, 6181, 9488,
+    12600, 32935, 12909, 17372, 11708, 32890, 8204, 9808, 28687, 13198, 8949, 32791, 12765, 10254, 28779, 6446,
+    12378, 16812, 28760, 28734, 32915, 11412, 12837, 16500, 8321, 10326, 9012, 12732, 12861, 13214, 28793, 9358,
+    13092, 32802, 9145, 16819, 32859, 12646, 9676, 28763, 12474, 16406, 16621, 13190, 12838, 32792, 28795, 28775,
+    28691, 12576, 8723, 16922, 4526, 8284, 28711, 12404, 12395, 32792, 12452, 9203, 13127, 16990, 13090, 12441,
+    32790, 12984, 13088, 5599, 32872, 28733, 12513, 9975, 12657, 28716, 12677, 28691, 28774, 11465, 9302, 28744,
+    12611, 4390, 16604, 12055, 6021, 8719, 28693, 12988, 12850, 12903, 12464, 11699, 16456, 28731, 20481, 11761,
+    9049, 13008, 10712, 16824, 16688, 9903, 17130, 12996, 12659, 10867, 16745, 12833, 13115, 16677, 12873, 12683,
+    16855, 10407, 28743, 12996, 8470, 13032, 12453, 16427, 28674, 8351, 32779, 28759, 16711, 12947, 28744, 16530,
+    16937, 10789, 8920, 12341, 12358, 12012, 28813, 13179, 28751, 6224, 5665, 12864, 11656, 16507, 20485, 12660,
+    13221, 28695, 10505, 28704, 17002, 16451, 32877, 10282, 32924, 6453, 12620, 9664, 32818, 12655, 32824, 12395,
+    28749, 28820, 12681, 16596, 12891, 9078, 16479, 28812, 17178, 12525, 28723, 12821, 10664, 28796, 28774, 32779,
+    13140, 12322, 32846, 12587, 12803, 28811, 12076, 12450, 13020, 11955, 12347, 17384, 12016, 12047, 12773, 28722,
+    12399, 12479, 8439, 10803, 13180, 12317, 12395, 16774, 9686, 17246, 8348, 8769, 16930, 28795, 11989, 12323,
+    12491, 12791, 28770, 28793, 12810, 8351, 17130, 16982, 17320, 8620, 10376, 9616, 16617, 11166, 10749, 13181,
+    16461, 32819, 12503, 12552, 8804, 10879, 13209, 6313, 17252, 9948, 11261, 12972, 12322, 12984, 10116, 13066,
+    6156, 13090, 17137, 8335, 16621, 13003, 28817, 8757, 28690, 28771, 9425, 13191, 9423, 12754, 4970, 11945,
+    12669, 12755, 9319, 12756, 6364, 12960, 12358, 8931, 8805, 28726, 12506, 12609, 12775, 28757, 8842, 32776,
+    32937, 12885, 17106, 12718, 12838, 9617, 11393, 9673, 8254, 32805, 10724, 9896, 10114, 5077, 11460, 5599,
+    9609, 16605, 28675, 28796, 28765, 12969, 12395, 12415, 13172, 5578, 8562, 32803, 8561, 28680, 13180, 16971,
+    13161, 12634, 28774, 32845, 6231, 12801, 16686, 11908, 13192, 12644, 8666, 6374, 12765, 11456, 11323, 17214,
+    6453, 12929, 12487, 12882, 12960, 8722, 17332, 8778, 10108, 12420, 17016, 32801, 4213, 13149, 13163, 13215,
+    28685, 13172, 12636, 13193, 12992, 12693, 17332, 8424, 12798, 32932, 32889, 16530, 28721, 32857, 28710, 13188,
+    8547, 28750, 10755, 12311, 28689, 28739, 32791, 28698, 9685, 28744, 11409, 28758, 11275, 12384, 12778, 9011,
+    12522, 13223, 17390, 12509, 28676, 16421, 12810, 28700, 32895, 16904, 12538, 8491, 8790, 5640, 32904, 12046,
+    12766, 16799, 13155, 11005, 5665, 8597, 8435, 12814, 13115, 13124, 11011, 11952, 10533, 10704, 11023, 28795,
+    9745, 13150, 12336, 12591, 13003, 10050, 28736, 28775, 12648, 11275, 28821, 8367, 32858, 28758, 28693, 16764,
+    8577, 12732, 28733, 17411, 32839, 11048, 28786, 12359, 8696, 12958, 16745, 32907, 9371, 28807, 28699, 32934,
+    11456, 8377, 11873, 28687, 10877, 9012, 10810, 17124, 28758, 28812, 16542, 10371, 28753, 12371, 12802, 10743,
+    9481, 28676, 12660, 8870, 12969, 32846, 11177, 12662, 13127, 28786, 9051, 16898, 12982, 28822, 9664, 12874,
+    28772, 32858, 28686, 11362, 28713, 28754, 28704, 16700, 12384, 10533, 10640, 28721, 12359, 28682, 13090, 11114,
+    32793, 12982, 32800, 16478, 12453, 28824, 28784, 4597, 28814, 28677, 28826, 5578, 28819, 28723, 32831, 32858,
+    12644, 20484, 13164, 28733, 32919, 11401, 13121, 13181, 32806, 8693, 17011, 9529, 11617, 13104, 8769, 5106,
+    5112, 12571, 16588, 13091, 28816, 17367, 32806, 5602, 8532, 12512, 10285, 12028, 10388, 12400, 28785, 28744,
+    5369, 16456, 16555, 28742, 12815, 32878, 9657, 12827, 12408, 16530, 32890, 13210, 32810, 13091, 13003, 10496,
+    12908, 8758, 12480, 17324, 28725, 13043, 12416, 10877, 8920, 4869, 11109, 10851, 8948, 9366, 16686, 16654,
+    12992, 5603, 12861, 9686, 32819, 9131, 8678, 28801, 10713, 5497, 32794, 13128, 12862, 12441, 12455, 12348,
+    13203, 12394, 16855, 32837, 12776, 9254, 12360, 12049, 12348, 8548, 11581, 12600, 8712, 28681, 28695, 10217,
+    10941, 12938, 16459, 28747, 28712, 12945, 16463, 17369, 6051, 17216, 11980, 16745, 16937, 12078, 28675, 28754,
+    11275, 12660, 32811, 8789, 12740, 13181, 11088, 12395, 12490, 11978, 6038, 28710, 32827, 8723, 12931, 12719,
+    12439, 13138, 10860, 9311, 12741, 28798, 28800, 11610, 12940, 16462, 4955, 8637, 11310, 12382, 13041, 20483,
+    16450, 28678, 12756, 28697, 13044, 28683, 28695, 13140, 28725, 28703, 9083, 5664, 13116, 32884, 5356, 9255,
+    17146, 32815, 12569, 28747, 28811, 28794, 12372, 28706, 5497, 13202, 28696, 32822, 12380, 28803, 28677, 11150,
+    17223, 13102, 28698, 8491, 28818, 28682, 9051, 16643, 32883, 28755, 28826, 32902, 28677, 8490, 9179, 20484,
+    12677, 11618, 13023, 28704, 28701, 13005, 32815, 13104, 17388, 9824, 16697, 5430, 28678, 13204, 20484, 11301,
+    12502, 13125, 8491, 28718, 28683, 5113, 12300, 12993, 12731, 20490, 28737, 12346, 32790, 32927, 16688, 28822,
+    12659, 16778, 11657, 9210, 32820, 12756, 16655, 11596, 28818, 13031, 28676, 16854, 32915, 12442, 4188, 16440,
+    13062, 9656, 12943, 9614, 12984, 28695, 12357, 12461, 28685, 9673, 28794, 12660, 11105, 11712, 13185, 12547,
+    16798, 28674, 17141, 10795, 28731, 6320, 12513, 9664, 32915, 10513, 28765, 32840, 13116, 13010, 6195, 16766,
+    13091, 12959, 12864, 12984, 16856, 28803, 16815, 11393, 12324, 9366, 12753, 32806, 8374, 16600, 32827, 17077,
+    12053, 12648, 28710, 12441, 17319, 12368, 12778, 5670, 12599, 8778, 11748, 16914, 12826, 28705, 9555, 12443,
+    16683, 16698, 28706, 9068, 12971, 8414, 28707, 16540, 12750, 4432, 9666, 12922, 32780, 28773, 12907, 8713,
+    12586, 9617, 13104, 6402, 17372, 12844, 16774, 9022, 17209, 12521, 28713, 17324, 12370, 17174, 12404, 28756,
+    17209, 28827, 32895, 12956, 5668, 12640, 9686, 11894, 16696, 32868, 32934, 32844, 13104, 4292, 28692, 12491,
+    6058, 12532, 32845, 32815, 17216, 17148, 12463, 17003, 12346, 11103, 32828, 16527, 28798, 10758, 11748, 28735,
+    20485, 8722, 9225, 28827, 28714, 16508, 16539, 32870, 13124, 12296, 16586, 32915, 12298, 28683, 16686, 17288,
+    28715, 28777, 5105, 12441, 32932, 28712, 17252, 28722, 12072, 28707, 8811, 4364, 28678, 4650, 11609, 8354,
+    28732, 12456, 28771, 11101, 13158, 9375, 32805, 9229, 32850, 32845, 12756, 10259, 12744, 12443, 5835, 28688,
+    8993, 32843, 12886, 11398, 17225, 12503, 11755, 12812, 12959, 17173, 13049, 11059, 12840, 12932, 9673, 6159,
+    11954, 4544, 32832, 32816, 5016, 11392, 12814, 11991, 28710, 28807, 12755, 11161, 11902, 32818, 20483, 9021,
+    12336, 32920, 28735, 11365, 9204, 12575, 17306, 16506, 32804, 12736, 12970, 28685, 28779, 13149, 12527, 11946,
+    28678, 12660, 16615, 16666, 16912, 11574, 11170, 12588, 11404, 16737, 28713, 16656, 12394, 32851, 16541, 12922,
+    9319, 17148, 8405, 10827, 17079, 5673, 12420, 17250, 9440, 12931, 8480, 16541, 28708, 28733, 12358, 9664,
+    6369, 28739, 17366, 12556, 9007, 28674, 12839, 16537, 28819, 4389, 12535, 6298, 13104, 32846, 16530, 9832,
+    12432, 16698, 32911, 16576, 5453, 8777, 32801, 8523, 16687, 12644, 28685, 13140, 28686, 28822, 16413, 28701,
+    8480, 12837, 32807, 6271, 13077, 13027, 6196, 10267, 8314, 9610, 13048, 5671, 12402, 28766, 13061, 16540,
+    9145, 32775, 32780, 11003, 13116, 12485, 13006, 32817, 32885, 8475, 28819, 12708, 9376, 12708, 10516, 16686,
+    28686, 12596, 28743, 28735, 12514, 8605, 17282, 4431, 12994, 16621, 12981, 12503, 28805, 8789, 28680, 9919,
+    12358, 4715, 12360, 13008, 9885, 8250, 12485, 11945, 11735, 13115, 8266, 4983, 12356, 8899, 10349, 11110,
+    12382, 9844, 32803, 12628, 28707, 12779, 28695, 17161, 12583, 32837, 16731, 8445, 32804, 10687, 16700, 16491,
+    17079, 16617, 9967, 11952, 28737, 28807, 20488, 9068, 32832, 17411, 32871, 32813, 9610, 9153, 32936, 9047,
+    28776, 17004, 32816, 8611, 17407, 8299, 28695, 28698, 28795, 32885, 28752, 13028, 28715, 12740, 8478, 11952,
+    5582, 8480, 28719, 12610, 13222, 5556, 12297, 28733, 12635, 28716, 17239, 28706, 32802, 12295, 9583, 16463,
+    12393, 28682, 28708, 10662, 28734, 32778, 20484, 11400, 13039, 8300, 11768, 13127, 12647, 32840, 11908, 5104,
+    12335, 12347, 12574, 32805, 5009, 28780, 12597, 9308, 6138, 13215, 9050, 12893, 32849, 28801, 28771, 13055,
+    12656, 12839, 12727, 16430, 17202, 28715, 13155, 9787, 12684, 32818, 6152, 32817, 16745, 28817, 16528, 12854,
+    9385, 9174, 12309, 13065, 8479, 11408, 32804, 10895, 16436, 28676, 32833, 17174, 17027, 32842, 32854, 28756,
+    32817, 17105, 8480, 16825, 6446, 8880, 32844, 12706, 10825, 16553, 12394, 8790, 9620, 6334, 28743, 32836,
+    12307, 13060, 9599, 8710, 12971, 13200, 13104, 6314, 28770, 28790, 10560, 12394, 8621, 32911, 13150, 28680,
+    6453, 28708, 12657, 12660, 12295, 32780, 12390, 17167, 6007, 16698, 10760, 11998, 11092, 11453, 11708, 10867,
+    12872, 12514, 32807, 6338, 32781, 12600, 28681, 28734, 16463, 12959, 12322, 16820, 9874, 32789, 13049, 6394,
+    12340, 16508, 16460, 16619, 28800, 8490, 12536, 16840, 16515, 8789, 13006, 8395, 28720, 12347, 16833, 9515,
+    10857, 8650, 9897, 28815, 12299, 12760, 12320, 28807, 12957, 4889, 6152, 13134, 12780, 12394, 13193, 28700,
+    32810, 20482, 32779, 32842, 32780, 17025, 28697, 20484, 10431, 10569, 12063, 9448, 8965, 8957, 4817, 28725,
+    10987, 17233, 9128, 28806, 13067, 12656, 32792, 28679, 9256, 10583, 12970, 28787, 32805, 4852, 17404, 12356,
+    28699, 13206, 32806, 11667, 28700, 4714, 16578, 16621, 5088, 32907, 28697, 17011, 12744, 11706, 16581, 28724,
+    13091, 32937, 12999, 32833, 12367, 12978, 28783, 13184, 28774, 17250, 13120, 8579, 28685, 8384, 10721, 12347,
+    28704, 16451, 28717, 28736, 10876, 28756, 12372, 4243, 13104, 16667, 9562, 12864, 28782, 10845, 16835, 10208,
+    9686, 9077, 17382, 32846, 12346, 32805, 4863, 16828, 9965, 8306, 11411, 8822, 9264, 9377, 32851, 12837,
+    17411, 32826, 32803, 12332, 12296, 28720, 12840, 5301, 28821, 12657, 28713, 9552, 9909, 12310, 28683, 12803,
+    28674, 9258, 6387, 16925, 10871, 12775, 16426, 8949, 17002, 12959, 16519, 12535, 9358, 9528, 20484, 16406,
+    8789, 8413, 16914, 12078, 28695, 28688, 10431, 17171, 11698, 9631, 13039, 16440, 12536, 12959, 16405, 10573,
+    32868, 28760, 10866, 8248, 12426, 6337, 9994, 12067, 28818, 9449, 28775, 16843, 8907, 11024, 28758, 12414,
+    11404, 17200, 12295, 28766, 11285, 12741, 16728, 8787, 9458, 17398, 12636, 12578, 12432, 9285, 32792, 12586,
+    9089, 28681, 12732, 12851, 16578, 8977, 12455, 12660, 11175, 28727, 9050, 16656, 28687, 32867, 8716, 6463,
+    10645, 17295, 28716, 10712, 28695, 12848, 4955, 12299, 32816, 16500, 11150, 32865, 17292, 13121, 17391, 12852,
+    16621, 28725, 16643, 9356, 11169, 17241, 5275, 16684, 20486, 28718, 9264, 28817, 28709, 13092, 8642, 12704,
+    12384, 16687, 28725, 12540, 12381, 13175, 32898, 12466, 32856, 11281, 12383, 9291, 17259, 13112, 17062, 9218,
+    28694, 16593, 16696, 28822, 28710, 28778, 10238, 28710, 16973, 16846, 12332, 6375, 20481, 12588, 9272, 16853,
+    16429, 28805, 28812, 28742, 8367, 8752, 11165, 28684, 5900, 5729, 16991, 9661, 16764, 9563, 12407, 28713,
+    32794, 16699, 28674, 17313, 28764, 13140, 12852, 12946, 9021, 11322, 12322, 10771, 16688, 17051, 17167, 28805,
+    13037, 9058, 20485, 11465, 28787, 12850, 9574, 9608, 8696, 17051, 28802, 12716, 12706, 12838, 11462, 12754,
+    28773, 28738, 11459, 28681, 28744, 8490, 16957, 17130, 28749, 16687, 28827, 12947, 8704, 8689, 12899, 13080,
+    12311, 16844, 12862, 12883, 13072, 32842, 12548, 28732, 12624, 12597, 12755, 12462, 11713, 6178, 12504, 9302,
+    12295, 12814, 28783, 12800, 13089, 12307, 10706, 16529, 10646, 9365, 28771, 12680, 28761, 28764, 9617, 28732,
+    12659, 9078, 10435, 12840, 12525, 12920, 9564, 10664, 12490, 20486, 16674, 12444, 9608, 16461, 28721, 10860,
+    12335, 17058, 12909, 12849, 16515, 12466, 12300, 13101, 11424, 12382, 16858, 12428, 28742, 28721, 12635, 32880,
+    11259, 28682, 16913, 12705, 16676, 12588, 28676, 5226, 28765, 8779, 32881, 17111, 13181, 12802, 16530, 11151,
+    5473, 9685, 10184, 10730, 8620, 12921, 12646, 10546, 28757, 28808, 6407, 28706, 8713, 11011, 5447, 9103,
+    17288, 28754, 28700, 9386, 8414, 6406, 28774, 11877, 17407, 28711, 28759, 11318, 9657, 28677, 17030, 16843,
+    13209, 16593, 11756, 9563, 32856, 28765, 8422, 13218, 32923, 12812, 32857, 12669, 5507, 8965, 17181, 20482,
+    28721, 28692, 32807, 8474, 13007, 9088, 5636, 17058, 12461, 32923, 17124, 9870, 28693, 11275, 11449, 12776,
+    12851, 12909, 12670, 12319, 12755, 10563, 32935, 32855, 16443, 13188, 32846, 10712, 12648, 10282, 17331, 12360,
+    12743, 12744, 11456, 17169, 12400, 28753, 9337, 11011, 9617, 32800, 28705, 10482, 9089, 32793, 28805, 6339,
+    12641, 28756, 11068, 28818, 17304, 10375, 13079, 5355, 28705, 32866, 8459, 28807, 28766, 28699, 16755, 16428,
+    32786, 9285, 5113, 16845, 28809, 32877, 32911, 11029, 11005, 17015, 8424, 16451, 12526, 8456, 28745, 9086,
+    28709, 12572, 8527, 12635, 8549, 9330, 16922, 13026, 8722, 12426, 12311, 12459, 16676, 12384, 28709, 32911,
+    12323, 28681, 9012, 12072, 16751, 11011, 32816, 11159, 4657, 16733, 12537, 16542, 13135, 12803, 12646, 12790,
+    28684, 12561, 12000, 8712, 10976, 9021, 8255, 12372, 12814, 11261, 13088, 17137, 8657, 5047, 12391, 28752,
+    16656, 28682, 17032, 17067, 5369, 6363, 16448, 12969, 8870, 12300, 12567, 32898, 12528, 12561, 16746, 16492,
+    9051, 28817, 17124, 28794, 32805, 11285, 6457, 13020, 16773, 10877, 12396, 28784, 13101, 12803, 12743, 8904,
+    17067, 17392, 16657, 12670, 12737, 28722, 6234, 12996, 4519, 13102, 17311, 28784, 12825, 28725, 12539, 12406,
+    13210, 16530, 9387, 16587, 8491, 28738, 9179, 32890, 32794, 6400, 17402, 13091, 8788, 12390, 12645, 12633,
+    5112, 32820, 32775, 11873, 20483, 12939, 32806, 11069, 12300, 8947, 12324, 11953, 9276, 12763, 13090, 28711,
+    12624, 12563, 8894, 32937, 12500, 20484, 8987, 28784, 12502, 10007, 12395, 28783, 16564, 12876, 16446, 12346,
+    28717, 28794, 12657, 12928, 12984, 28735, 12538, 9311, 28716, 28720, 13080, 12319, 16821, 28686, 12324, 12886,
+    9003, 28723, 28687, 17306, 12802, 20484, 12593, 9934, 28683, 11245, 16925, 16772, 12658, 13210, 10322, 10862,
+    28784, 32931, 12863, 9175, 32880, 16418, 32794, 12450, 11779, 5928, 12323, 12309, 10771, 11176, 9645, 11347,
+    28807, 32819, 12416, 9479, 11055, 11176, 28763, 10026, 28688, 13056, 8723, 4811, 10069, 12370, 12406, 12850,
+    9388, 28760, 32920, 32779, 28704, 12642, 12682, 28765, 28761, 32881, 28818, 28695, 8712, 11286, 28674, 12665,
+    4368, 28698, 28818, 17130, 12634, 4984, 12804, 28740, 16664, 11478, 28691, 28740, 13088, 11583, 12836, 12357,
+    4571, 12621, 12918, 6292, 11450, 28699, 28727, 28685, 28819, 28737, 12911, 12824, 17281, 16435, 12472, 12381,
+    28782, 32818, 12384, 6357, 11048, 12548, 28771, 12940, 28712, 28820, 28771, 32924, 32857, 12838, 11559, 12706,
+    32797, 12291, 5953, 28674, 12720, 28745, 32817, 12923, 11748, 12850, 9656, 12415, 8600, 9709, 10490, 17316,
+    5339, 13140, 17137, 17014, 16935, 13200, 12549, 32820, 28707, 16586, 17067, 13191, 9358, 28731, 17399, 9302,
+    11070, 12784, 13089, 6461, 12803, 28736, 12992, 4899, 16818, 12964, 28809, 17209, 12490, 9294, 8610, 28770,
+    28737, 10460, 28696, 28728, 32846, 12635, 9279, 12443, 11182, 12026, 28692, 28673, 28701, 12825, 16650, 12683,
+    12310, 13104, 11747, 12761, 12659, 17002, 28795, 10273, 17146, 12599, 28825, 6456, 8711, 12940, 12054, 28683,
+    12368, 28783, 11620, 10218, 16736, 9533, 12635, 16688, 5669, 10725, 28675, 16437, 11764, 13181, 12958, 16570,
+    13176, 28797, 5915, 16519, 9011, 9562, 28754, 9544, 9054, 11275, 12754, 10240, 17070, 5592, 12755, 28770,
+    28818, 12587, 11057, 16687, 28814, 16755, 8737, 16551, 13066, 5063, 28710, 12982, 20488, 32915, 12885, 5834,
+    16675, 16541, 9619, 8356, 12641, 9974, 12484, 10582, 16854, 8988, 28697, 12862, 12948, 28710, 12564, 9729,
+    9022, 28794, 16841, 8307, 32816, 8667, 10533, 13170, 8694, 28781, 28678, 16451, 16617, 9857, 10461, 12464,
+    12477, 17329, 5627, 12427, 16540, 28794, 28782, 28736, 28697, 11094, 28782, 5796, 28683, 32850, 12927, 13103,
+    12393, 11722, 12647, 17209, 8365, 32778, 6033, 12636, 12755, 28756, 17004, 12992, 8917, 12887, 10811, 12440,
+    28766, 13135, 12623, 12623, 28825, 16460, 16618, 17077, 12862, 17224, 11088, 28712, 9617, 11024, 13041, 28819,
+    8831, 28695, 32831, 13124, 13130, 32824, 32826, 6008, 9664, 13115, 12812, 32937, 12293, 12682, 8723, 9142,
+    28712, 16587, 9366, 17308, 5807, 12912, 28795, 5497, 6464, 32788, 16459, 16758, 9306, 8479, 32833, 12707,
+    5606, 32794, 12744, 28817, 28682, 12683, 28717, 11663, 12737, 17225, 32798, 28710, 8722, 12299, 5560, 12360,
+    8965, 12378, 13185, 28676, 9907, 12334, 11574, 32832, 8769, 17278, 13029, 12041, 11373, 28761, 13138, 4820,
+    28710, 10796, 32802, 12331, 10533, 17378, 11754, 28721, 10218, 11627, 4473, 11944, 12299, 16596, 12384, 28673,
+    13180, 10517, 9217, 28790, 9609, 28770, 9583, 10504, 28712, 12300, 5627, 11126, 13138, 8912, 12432, 28706,
+    9358, 32790, 11110, 16662, 12309, 13193, 11859, 12732, 9289, 9020, 12857, 11101, 16532, 32789, 13102, 16608,
+    9022, 6439, 5664, 5275, 12909, 8882, 10283, 28727, 28777, 8893, 32933, 13047, 6243, 12064, 32794, 28796,
+    32805, 11234, 12972, 6137, 5900, 10883, 16528, 12509, 9600, 32885, 13079, 28722, 13102, 11991, 9762, 17027,
+    16609, 32792, 32902, 16857, 28744, 10804, 16934, 28675, 32778, 8777, 6466, 9517, 5752, 10370, 16620, 8674,
+    5671, 20488, 12441, 16440, 12439, 12468, 12479, 12401, 11873, 28813, 12067, 28677, 12743, 16667, 8773, 12571,
+    12635, 32911, 28710, 12981, 28688, 8275, 32902, 32898, 12647, 12347, 11921, 5253, 11664, 16450, 12957, 28677,
+    28717, 32850, 5562, 12419, 13192, 9043, 12383, 11411, 17012, 28821, 12429, 28692, 9321, 20484, 28772, 28819,
+    11094, 17324, 32884, 28821, 13091, 12875, 32806, 5312, 9029, 9682, 10208, 12312, 8995, 32881, 16461, 16649,
+    4752, 12007, 28821, 6193, 17091, 17399, 12572, 28748, 28737, 12508, 11110, 13208, 12441, 10349, 28683, 12970,
+    17224, 12297, 32819, 17411, 32779, 11711, 28755, 16845, 5329, 11182, 12946, 13203, 12886, 16498, 11480, 16902,
+    9078, 32843, 12984, 8912, 9750, 12762, 12439, 12323, 28729, 12863, 11773, 12888, 12813, 32848, 32794, 6022,
+    12824, 28735, 6391, 12597, 16432, 32846, 10563, 12426, 12864, 12824, 5394, 8752, 9683, 12634, 12407, 13114,
+    8919, 28694, 12561, 28801, 17156, 16688, 10264, 32844, 16695, 9534, 8359, 28807, 16699, 13038, 28678, 32869,
+    28712, 8479, 8739, 12468, 9281, 32937, 32832, 9635, 9773, 17159, 12079, 28722, 12657, 5063, 9168, 8739,
+    16746, 4635, 16697, 28720, 8424, 12851, 13068, 11935, 12958, 10620, 12328, 5433, 8788, 28727, 11574, 12762,
+    32905, 12825, 28818, 10572, 10857, 10285, 28806, 12827, 13002, 28731, 8358, 13192, 17004, 28729, 12502, 12803,
+    12780, 8830, 12797, 28756, 12347, 11609, 16920, 9022, 9104, 5929, 28733, 32900, 12600, 11749, 17403, 16614,
+    20482, 9665, 12768, 4890, 8488, 12983, 28735, 17160, 32859, 12696, 12345, 16911, 16935, 28721, 8368, 12788,
+    28707, 13084, 12586, 12765, 28686, 28680, 28683, 12632, 32827, 12969, 17398, 6152, 16619, 32893, 6436, 10273,
+    28693, 11024, 12958, 12369, 28791, 9078, 8402, 8470, 5525, 10515, 28738, 11780, 4953, 11408, 17332, 10347,
+    12487, 32870, 12839, 16492, 13220, 12728, 16609, 5836, 5195, 32776, 13116, 4971, 12355, 28722, 10311, 12360,
+    8337, 28719, 16825, 5835, 9481, 32837, 4713, 28776, 12380, 11260, 17088, 16448, 28681, 12604, 16736, 12352,
+    28757, 28714, 28734, 12297, 9189, 16575, 12671, 11402, 12503, 32803, 9178, 32897, 9367, 17411, 32816, 28680,
+    10642, 28704, 12370, 16676, 28706, 32781, 16677, 9907, 8665, 16775, 8422, 28708, 11713, 11653, 12608, 6122,
+    9592, 17403, 16772, 16402, 12644, 28817, 5455, 16716, 32790, 6457, 28820, 28806, 10831, 12792, 12642, 9619,
+    12381, 12967, 12956, 9087, 12520, 28743, 11312, 32894, 16777, 28781, 5898, 10953, 16675, 12453, 28735, 9265,
+    28804, 28686, 12585, 16855, 12995, 13197, 12355, 12393, 28751, 8760, 9366, 16832, 28699, 28707, 9680, 16524,
+    16955, 11421, 32909, 6161, 12982, 12980, 16698, 10431, 28719, 12840, 12959, 12499, 9600, 16835, 8321, 16430,
+    32791, 28699, 12863, 28673, 28686, 13056, 12660, 13187, 16540, 13176, 8956, 12730, 17385, 12791, 11692, 8789,
+    5355, 12396, 28788, 9130, 12875, 12862, 16540, 13047, 28823, 28806, 12767, 17241, 8966, 28740, 6057, 32779,
+    32832, 9772, 16699, 12732, 10941, 28783, 13149, 8790, 12374, 12510, 32881, 12335, 12647, 12658, 16620, 28790,
+    12547, 28780, 32869, 11260, 32832, 32864, 32828, 32840, 32839, 9562, 10858, 12471, 28771, 9367, 12636, 13204,
+    28718, 12785, 16956, 12336, 12630, 12441, 16807, 28742, 9384, 12630, 13133, 16643, 16529, 9240, 13032, 32859,
+    12369, 10769, 10252, 12335, 11328, 17094, 12588, 13152, 12994, 32838, 12744, 28735, 8920, 8936, 28823, 10482,
+    9089, 16641, 11708, 9529, 5473, 8881, 28679, 13072, 9087, 8667, 13116, 17309, 12460, 12491, 9058, 9956,
+    11698, 5447, 10150, 8777, 28735, 10662, 32817, 32781, 16577, 28707, 28698, 8353, 32845, 6229, 9376, 28778,
+    12297, 12360, 12455, 9770, 28709, 28686, 8503, 11321, 16766, 8480, 16463, 13059, 16608, 8397, 28771, 9854,
+    28793, 32794, 13063, 4727, 16416, 12450, 11157, 28694, 11282, 12552, 28736, 28761, 12995, 16457, 13199, 12840,
+    12743, 5433, 11992, 12977, 16542, 32792, 13007, 20481, 10255, 13092, 5355, 28818, 12971, 11224, 17167, 4890,
+    12753, 28726, 11150, 8367, 12321, 12982, 13116, 12310, 10915, 8916, 12955, 8480, 28828, 10924, 32806, 8682,
+    9666, 28809, 12847, 28812, 9554, 12359, 32807, 6199, 32883, 10686, 8995, 28758, 32813, 12948, 28727, 16775,
+    28685, 16698, 10070, 12422, 28694, 12480, 12971, 28760, 17088, 12443, 28723, 16815, 6058, 16557, 28807, 28684,
+    28737, 8584, 32789, 12804, 28682, 17240, 20486, 20484, 28802, 10961, 10232, 32922, 28782, 17091, 8786, 13072,
+    10857, 8413, 28815, 12298, 12646, 12736, 32859, 28803, 28715, 32777, 16620, 32844, 28723, 28822, 5473, 8760,
+    17306, 8650, 12920, 10184, 28705, 16463, 28794, 11182, 17013, 28726, 9018, 32871, 16594, 28730, 28690, 12659,
+    28740, 17185, 28750, 9635, 12580, 16700, 6404, 5274, 9554, 12946, 12500, 9608, 28735, 16517, 8452, 32831,
+    16843, 8762, 9636, 28730, 5318, 12948, 12563, 6152, 16676, 11707, 9256, 6328, 12573, 9310, 16421, 12575,
+    8635, 12573, 12895, 16776, 13215, 9218, 16504, 6008, 12858, 8703, 12743, 11166, 8275, 28720, 16696, 13097,
+    12864, 8458, 12995, 13149, 28799, 28677, 9009, 16675, 28692, 9078, 28717, 16529, 9480, 32855, 6167, 11454,
+    28686, 10452, 32807, 6032, 9018, 17295, 32794, 16537, 28713, 12478, 12987, 32772, 13055, 12292, 16935, 12465,
+    17050, 17302, 16767, 11449, 17166, 12717, 10861, 10213, 17038, 28736, 28745, 28751, 10865, 17339, 12056, 20481,
+    10875, 8662, 8467, 12660, 16594, 28800, 12418, 6445, 28685, 12575, 9310, 16856, 10877, 8368, 17303, 12453,
+    10413, 10816, 32851, 32843, 9917, 12744, 5920, 8972, 9021, 17062, 28709, 17016, 8683, 12509, 28728, 12972,
+    32832, 28769, 11648, 8468, 9592, 12874, 12863, 28819, 12816, 13216, 28736, 12684, 6400, 32830, 9439, 12535,
+    16413, 11114, 13224, 13163, 12306, 12825, 5344, 32833, 10421, 9319, 9745, 32937, 32825, 10430, 6341, 16607,
+    28697, 4715, 32815, 12995, 12524, 32787, 12870, 11465, 28820, 16576, 6338, 28798, 6295, 12501, 28770, 12851,
+    28761, 16451, 28758, 13135, 28759, 28701, 10876, 9561, 32805, 4965, 16621, 28808, 16413, 20487, 12707, 12731,
+    13067, 8343, 12574, 12460, 11010, 9620, 10284, 12384, 28736, 28788, 6363, 28805, 10925, 28684, 28673, 28681,
+    13139, 32780, 28706, 28681, 12643, 8945, 8686, 13090, 13212, 28792, 12718, 28706, 16420, 32920, 28743, 12419,
+    11176, 12440, 11558, 13113, 12401, 17162, 9765, 12360, 9073, 11284, 17312, 12837, 12294, 32787, 8424, 12040,
+    12815, 6447, 12756, 10742, 12636, 10987, 10579, 12333, 16956, 10712, 12077, 28772, 8994, 28707, 16925, 6110,
+    32775, 8994, 17058, 13123, 28820, 28729, 12888, 32805, 11218, 28744, 9711, 17367, 17294, 12596, 28806, 16538,
+    28755, 10489, 11004, 12332, 6400, 17058, 9396, 11855, 12067, 12407, 10644, 12480, 28708, 4969, 6407, 11750,
+    12863, 16461, 13019, 16404, 28706, 12586, 28819, 12850, 28704, 13224, 11175, 12323, 11795, 9712, 5448, 11678,
+    12851, 28782, 32833, 32911, 17245, 12741, 12852, 8395, 28704, 5556, 11719, 5633, 32911, 16779, 12624, 16912,
+    12623, 5170, 12467, 16844, 32867, 6464, 13089, 8368, 28806, 12347, 8414, 28809, 10449, 16923, 28795, 9385,
+    12702, 12803, 28817, 16449, 32869, 16688, 12443, 11235, 13114, 32851, 12744, 11152, 11240, 12712, 12982, 32818,
+    10771, 8632, 12659, 8994, 28779, 5460, 32780, 17251, 11176, 32866, 32797, 16469, 9608, 16542, 11464, 10078,
+    12563, 8357, 32805, 9223, 12011, 12840, 12535, 13003, 12491, 17391, 32936, 28813, 12956, 17004, 28761, 5313,
+    5448, 13123, 10405, 10285, 13013, 32937, 13025, 28750, 13216, 17137, 10677, 10677, 32814, 10743, 16542, 28712,
+    28743, 16752, 20486, 12323, 8812, 12431, 12972, 28725, 9635, 28783, 16412, 12454, 8713, 11627, 16728, 12348,
+    16647, 12936, 32856, 13016, 10180, 16463, 16756, 12969, 8461, 10184, 9599, 9089, 20482, 12888, 12058, 13089,
+    32915, 12356, 16606, 13212, 28732, 12971, 13044, 28819, 12753, 28700, 28735, 6008, 13067, 10975, 12408, 10459,
+    12319, 12693, 8490, 6461, 28740, 16609, 8533, 12563, 12371, 28730, 8931, 13030, 9554, 12787, 28750, 28686,
+    32875, 13173, 12872, 13164, 11070, 12356, 12755, 8470, 12425, 9211, 16415, 11766, 28713, 12852, 16676, 11414,
+    12966, 11580, 17253, 8491, 13101, 9088, 12707, 28776, 28683, 32789, 9617, 12369, 10188, 16655, 12368, 12907,
+    8688, 16715, 10152, 12984, 32880, 12309, 11345, 28760, 12424, 32857, 12799, 16451, 28692, 12789, 28705, 10976,
+    12588, 12323, 8905, 28740, 16527, 13160, 11759, 12408, 9078, 17174, 12323, 11537, 28742, 13161, 16447, 12369,
+    16983, 12443, 28749, 13114, 12846, 16700, 6261, 32843, 28771, 11673, 8722, 28679, 28816, 12970, 20488, 16450,
+    8491, 12744, 13171, 12504, 17410, 12754, 11011, 12862, 28706, 5916, 10240, 16770, 12354, 32780, 10152, 28721,
+    32859, 12515, 28775, 13113, 12928, 17220, 12444, 28705, 32915, 12883, 10782, 16648, 32817, 17093, 28682, 12478,
+    12444, 13068, 12490, 28681, 28704, 28723, 28765, 16854, 16977, 12359, 12729, 9673, 12550, 11261, 16845, 12971,
+    12864, 16563, 16620, 13183, 28817, 8469, 5990, 28678, 8488, 16411, 28732, 12620, 32851, 12444, 32846, 9317,
+    16783, 28819, 32797, 28685, 12348, 28717, 16489, 12058, 12824, 12849, 10701, 8255, 13124, 9012, 28712, 16673,
+    9586, 4744, 13024, 32843, 16687, 16412, 28723, 20484, 28762, 12535, 32855, 8778, 32775, 12312, 28827, 13080,
+    12635, 6464, 12996, 8413, 5253, 28726, 16530, 16831, 28779, 12984, 28696, 6448, 12404, 28676, 12324, 32817,
+    12001, 9265, 9563, 8320, 16762, 28685, 32841, 12536, 12960, 12670, 28774, 16856, 12448, 12936, 9674, 9656,
+    8702, 11323, 5112, 17180, 16542, 28825, 8954, 12320, 12940, 10407, 5046, 12828, 11748, 10584, 11081, 12837,
+    28767, 12336, 12551, 9078, 32842, 8576, 32890, 32887, 12960, 5064, 9068, 12940, 12996, 28704, 32780, 8305,
+    28722, 28686, 16835, 9874, 9003, 12019, 32820, 28740, 12914, 8489, 28791, 4982, 28708, 16857, 32877, 28692,
+    16990, 6136, 13055, 13089, 13163, 13172, 12516, 16925, 5406, 28818, 28712, 28741, 16666, 17392, 10572, 12706,
+    32777, 12658, 8663, 28740, 5986, 28744, 28771, 10661, 17388, 5625, 9764, 9342, 16620, 16552, 10712, 12922,
+    32785, 5540, 6205, 9986, 11087, 13100, 12744, 32819, 13111, 17130, 20481, 16846, 28816, 8453, 32883, 12990,
+    28676, 10749, 28771, 12918, 32878, 11773, 28797, 6029, 28805, 9552, 13079, 28710, 20482, 12766, 12468, 12664,
+    28735, 11858, 32866, 12919, 28799, 13043, 28686, 13139, 9012, 28817, 9021, 11949, 13125, 16507, 16892, 12755,
+    12837, 16697, 13187, 28793, 28714, 8723, 12635, 12918, 28684, 28735, 28707, 12452, 12298, 32883, 5106, 32813,
+    28673, 20483, 10197, 9619, 13017, 8775, 12363, 17223, 28751, 32793, 28685, 9780, 28720, 13091, 16516, 10494,
+    8957, 12451, 12821, 28693, 12930, 9320, 5448, 28826, 12298, 8319, 11762, 28702, 32794, 5835, 12330, 13184,
+    12861, 8469, 8276, 12515, 12743, 28783, 8723, 16750, 12479, 4891, 12753, 13126, 8602, 12928, 12845, 28722,
+    6115, 12954, 4259, 28692, 32866, 11919, 28795, 12079, 9076, 12886, 9239, 32924, 32930, 28766, 16755, 17000,
+    12611, 13090, 8779, 12454, 11757, 4889, 28705, 9463, 12822, 32878, 12384, 12563, 11990, 28707, 32793, 12972,
+    28683, 28807, 16462, 32820, 28785, 11945, 20486, 17201, 32806, 17263, 9554, 28827, 9385, 11773, 12297, 12960,
+    32807, 8435, 10826, 9276, 9654, 28765, 28782, 17327, 28708, 12850, 11070, 12310, 16752, 5338, 12646, 5835,
+    16523, 5834, 17093, 9265, 12852, 16763, 28700, 28723, 9084, 32818, 32794, 10872, 5356, 5047, 5670, 13180,
+    12955, 9429, 28783, 12381, 28782, 11539, 9656, 32775, 16981, 13032, 12646, 8750, 9384, 28684, 10161, 32858,
+    16727, 28755, 5577, 20485, 8440, 28708, 12382, 8461, 28700, 12980, 12527, 10881, 10021, 32781, 28683, 12391,
+    28676, 28754, 12851, 28709, 28771, 8701, 28698, 28795, 9264, 8711, 16571, 16752, 12539, 16609, 13115, 9674,
+    9610, 8569, 9020, 12948, 28696, 16696, 12648, 12611, 12450, 16803, 28693, 12396, 11888, 11995, 32829, 12556,
+    28793, 4368, 12384, 12729, 16844, 13176, 32792, 28797, 12386, 12983, 8704, 16776, 32927, 12946, 12334, 12320,
+    9311, 11991, 12826, 28817, 9366, 28681, 8255, 10743, 32832, 16595, 13091, 11093, 10758, 11967, 32781, 10215,
+    12647, 32793, 12442, 13125, 12405, 28710, 12839, 28800, 12387, 13003, 10293, 12324, 28708, 32791, 12993, 12539,
+    28695, 28811, 32794, 13192, 10211, 28828, 20485, 28794, 13102, 28682, 32815, 10562, 16846, 8600, 32788, 12931,
+    16428, 12921, 12405, 10513, 16696, 12448, 11769, 12395, 12383, 28727, 8467, 16524, 32777, 10057, 12822, 11180,
+    13135, 28823, 28715, 13207, 8882, 32830, 12416, 5592, 11573, 12969, 28706, 32817, 12012, 11954, 28697, 11348,
+    32842, 12996, 13124, 12873, 9373, 9620, 12344, 12732, 28775, 16974, 32842, 32793, 11574, 8491, 32907, 12912,
+    10621, 16688, 20481, 9076, 16463, 9663, 13115, 5909, 28674, 17387, 12670, 13038, 28747, 11523, 12407, 12654,
+    28696, 12929, 9878, 9686, 11353, 8222, 13092, 32793, 28747, 28690, 12866, 12728, 12900, 8852, 28677, 17010,
+    8612, 28707, 9321, 9046, 28741, 32793, 28722, 5663, 12622, 5159, 12359, 28742, 12360, 13048, 11703, 13098,
+    32844, 16858, 17091, 28679, 12731, 12607, 13109, 10056, 32928, 13085, 20489, 8876, 10815, 16923, 28684, 12048,
+    5339, 28744, 16619, 12943, 16527, 28744, 11560, 13103, 12368, 12838, 32930, 13104, 12362, 28723, 28687, 28735,
+    12939, 12632, 32891, 12827, 32879, 12319, 6094, 12705, 28720, 28719, 20486, 17332, 28806, 9057, 17004, 12994,
+    8920, 28698, 12957, 17225, 10563, 32815, 20484, 13111, 8637, 28713, 8689, 9302, 16845, 28801, 12455, 32777,
+    11267, 28799, 16620, 12489, 10920, 8480, 17260, 16743, 32879, 8641, 32907, 11109, 10688, 6050, 6421, 28777,
+    10806, 4361, 13204, 12750, 11996, 12885, 28704, 6292, 32897, 12812, 28753, 12659, 8911, 16933, 12992, 32911,
+    10816, 9298, 12396, 28736, 16650, 28772, 12838, 9540, 12585, 12597, 10551, 12454, 12740, 28793, 16667, 12731,
+    28694, 13060, 12508, 9559, 8414, 6112, 4698, 28741, 32936, 13140, 6117, 12450, 13020, 12455, 13116, 5704,
+    28721, 12672, 8966, 4890, 13060, 4716, 13025, 17399, 9302, 17011, 11103, 11310, 16776, 28822, 9022, 9740,
+    8414, 28741, 12324, 13091, 17411, 10960, 12524, 8656, 12823, 28716, 13126, 12575, 16564, 12347, 28740, 28699,
+    32814, 10513, 11369, 13016, 32851, 9067, 28787, 28705, 9182, 13104, 28821, 10845, 13104, 12773, 16788, 9429,
+    28705, 12431, 12739, 12828, 12343, 28698, 16697, 16570, 11341, 8305, 32924, 16753, 32843, 13119, 16727, 16440,
+    17106, 12535, 32794, 28786, 9554, 32777, 28692, 11407, 10724, 13116, 32858, 8467, 12683, 12308, 28790, 28783,
+    20483, 16419, 13112, 11720, 32819, 5835, 9546, 10810, 4864, 12765, 32924, 12657, 8479, 10561, 13018, 8569,
+    28765, 12062, 32872, 9620, 13044, 12342, 28694, 28800, 9033, 12983, 9656, 8655, 13078, 12496, 12392, 9067,
+    28795, 28817, 16800, 16786, 12646, 12500, 4289, 28715, 13092, 16489, 28743, 12012, 28815, 13054, 11286, 28711,
+    11705, 13092, 8787, 28722, 4468, 13104, 9234, 9815, 12768, 12297, 12439, 17027, 5596, 28673, 32815, 28740,
+    10254, 16578, 12405, 8723, 32797, 32785, 12682, 9517, 28736, 12981, 12648, 32791, 12658, 32833, 12656, 9088,
+    16779, 10437, 28777, 8962, 9211, 32884, 11400, 11500, 9081, 9376, 5026, 4715, 8966, 13006, 12752, 12983,
+    12789, 12489, 6101, 8381, 32805, 4797, 28745, 12356, 6332, 5068, 12850, 28681, 13212, 8390, 11652, 32852,
+    13128, 16632, 9547, 12786, 32851, 16683, 16620, 12645, 12335, 13224, 28783, 28707, 12599, 28775, 32859, 28783,
+    12959, 5245, 10866, 11460, 28738, 28713, 10430, 10734, 9218, 5621, 28690, 9657, 28727, 28801, 9676, 9985,
+    10251, 12535, 11651, 9562, 28789, 12636, 9597, 28693, 12742, 9955, 28799, 6138, 28733, 11720, 28765, 10254,
+    20485, 28676, 8658, 12920, 20488, 12659, 11094, 28691, 32793, 8358, 28695, 16671, 12310, 16596, 10941, 10987,
+    32829, 9608, 32818, 12600, 9428, 28740, 32807, 6162, 10262, 28707, 12778, 12648, 16855, 28706, 8779, 12479,
+    8460, 17072, 17240, 8667, 12763, 17061, 9144, 20490, 9563, 11880, 16463, 17257, 28690, 13049, 16983, 12065,
+    12983, 28791, 12383, 11105, 8786, 12875, 16439, 16606, 28712, 12049, 5059, 5621, 13114, 16557, 17377, 28740,
+    12680, 8713, 8403, 12598, 16498, 12298, 28718, 28820, 12586, 28683, 28684, 28782, 13136, 13212, 28800, 20485,
+    10743, 11574, 13104, 32832, 9211, 28807, 11165, 12813, 4971, 16516, 10881, 13176, 12814, 28822, 28767, 17001,
+    28688, 12971, 12430, 10398, 16699, 28696, 12828, 6009, 11889, 11165, 8405, 32872, 28733, 28720, 32805, 9238,
+    12358, 32802, 12343, 28682, 32868, 12499, 9982, 16766, 17150, 10477, 28722, 16427, 8491, 5207, 28802, 12346,
+    11779, 28824, 28811, 12383, 12455, 5045, 8521, 12426, 28749, 28741, 28764, 28674, 9292, 16450, 28809, 12413,
+    5951, 32845, 28739, 13028, 10693, 9302, 32881, 5112, 16620, 17140, 16779, 12838, 32840, 8367, 28728, 6276,
+    8422, 10621, 8452, 28828, 32830, 28678, 10437, 12756, 11647, 12727, 32793, 12371, 12993, 9503, 16656, 8272,
+    28813, 28788, 12548, 32793, 16919, 6020, 28674, 28684, 12488, 16693, 5703, 9675, 5360, 16686, 8414, 12861,
+    9713, 4613, 4976, 12690, 11042, 12347, 28794, 28673, 17237, 10264, 13049, 11156, 6328, 9376, 17398, 28785,
+    11457, 9892, 32880, 6397, 16981, 32871, 13114, 12682, 16666, 9387, 20481, 11640, 6051, 8619, 28679, 12814,
+    16687, 9685, 17305, 11810, 32856, 32816, 8956, 28705, 17093, 32833, 11646, 28692, 8742, 28820, 28806, 13209,
+    10085, 13200, 10184, 9662, 9685, 12420, 8438, 17081, 8712, 9018, 28818, 12883, 12443, 10552, 9077, 28736,
+    32864, 12800, 28683, 32832, 6372, 16771, 10482, 5836, 12527, 13059, 28719, 32781, 28784, 13067, 10515, 16925,
+    12923, 12648, 12936, 32839, 12864, 10920, 13112, 17183, 9341, 11250, 12859, 9601, 12959, 28751, 8917, 32781,
+    10690, 13076, 16958, 5834, 12648, 5044, 13008, 28791, 28775, 12956, 6022, 12849, 32816, 13216, 6232, 12909,
+    10037, 10205, 10533, 16598, 28766, 11441, 12307, 28768, 8703, 28800, 8779, 16524, 16438, 6152, 13061, 12983,
+    12524, 12862, 10406, 12298, 10647, 5459, 28735, 6229, 5433, 16677, 16773, 12395, 10830, 12602, 9908, 12719,
+    12525, 13078, 11963, 12668, 17373, 4884, 32928, 6235, 8451, 12972, 8254, 10285, 6406, 8419, 4727, 28806,
+    13092, 32832, 12395, 16845, 28769, 11711, 8423, 16585, 10823, 28789, 13087, 12574, 10263, 28737, 28798, 13019,
+    12643, 12334, 12515, 12318, 9664, 9022, 5270, 12533, 5337, 28696, 17004, 32813, 8404, 16463, 28793, 32781,
+    8620, 4971, 28688, 12311, 11011, 12864, 9366, 16741, 13098, 12731, 10468, 16621, 8338, 12768, 5603, 9919,
+    5347, 9579, 28818, 17011, 32841, 13198, 32885, 28772, 12744, 16845, 4917, 11161, 17068, 5446, 12840, 4933,
+    16699, 12958, 11223, 12405, 16540, 32859, 28813, 28716, 11448, 5037, 12294, 28695, 6355, 28715, 5046, 16779,
+    17301, 28751, 12539, 8882, 12756, 10845, 12680, 16616, 16608, 8918, 10860, 11177, 28789, 9089, 28751, 28681,
+    16451, 12528, 12540, 12462, 10851, 32846, 11290, 12324, 12528, 17209, 8723, 11286, 16529, 32866, 28673, 12968,
+    17235, 12332, 10276, 12669, 28751, 13210, 8663, 28744, 17137, 12573, 8776, 28681, 20485, 13124, 28724, 8351,
+    28703, 10579, 12461, 16609, 28763, 12443, 13104, 32792, 12334, 28799, 12636, 32787, 12307, 28741, 12936, 8612,
+    28682, 8769, 12452, 12440, 28817, 6328, 13113, 28709, 8778, 16484, 12753, 28825, 16621, 6225, 16643, 20486,
+    12907, 9376, 12459, 16749, 9514, 28800, 28819, 28694, 12936, 28737, 10693, 13092, 9838, 12345, 12526, 17295,
+    28740, 12766, 9146, 32801, 4185, 12636, 28729, 28784, 12672, 9001, 28755, 12658, 17110, 11449, 32851, 12672,
+    20482, 13068, 32806, 11621, 10728, 9366, 12405, 32776, 12617, 28744, 11243, 12983, 32855, 32883, 12584, 28685,
+    12516, 16981, 8359, 9019, 9021, 11523, 28701, 17410, 12360, 28680, 12584, 12535, 16688, 12348, 12646, 13176,
+    28693, 12384, 12659, 12483, 12462, 28762, 12741, 4630, 13113, 8720, 10881, 12933, 13188, 16854, 28733, 32852,
+    12632, 28724, 11275, 32802, 16489, 17366, 16595, 8480, 32841, 32801, 8532, 12573, 12348, 28784, 11164, 8366,
+    32857, 12918, 12669, 12534, 28815, 28772, 32846, 12309, 28787, 28816, 16901, 8649, 9059, 28774, 16643, 8234,
+    8723, 11465, 12790, 13175, 12452, 32807, 5729, 12539, 12924, 12372, 12474, 12887, 10516, 12538, 6144, 28676,
+    16764, 16652, 16418, 13090, 16527, 12465, 9182, 20481, 16592, 11175, 28764, 20486, 28719, 13003, 4303, 11005,
+    12420, 16446, 17371, 10584, 8250, 32798, 12326, 28733, 11027, 28712, 28775, 16700, 5329, 12557, 16763, 32855,
+    6439, 5338, 12596, 9472, 12633, 12370, 17331, 13043, 17031, 16459, 16844, 16579, 12371, 12732, 13103, 12667,
+    8704, 12755, 12814, 12815, 16746, 12874, 16754, 28774, 12537, 12358, 9648, 8683, 28699, 12969, 16608, 32909,
+    12537, 32868, 32908, 4885, 10961, 16767, 9204, 32898, 28825, 9003, 13138, 28740, 32780, 12376, 8702, 20485,
+    32794, 16858, 12333, 12639, 32843, 5866, 28679, 9319, 8711, 12873, 9311, 12946, 16688, 16529, 16597, 12381,
+    9264, 28735, 12583, 4767, 12645, 16742, 28743, 12321, 6407, 12860, 12012, 28682, 17309, 8453, 16667, 10377,
+    32804, 9207, 13005, 12727, 12395, 16530, 6218, 8358, 12851, 17004, 32798, 28675, 20481, 28828, 28765, 4980,
+    28696, 16430, 28780, 28745, 9311, 12753, 28772, 12444, 17288, 32858, 12940, 4962, 32806, 11368, 5971, 32791,
+    16683, 8384, 12980, 28765, 9648, 11769, 16584, 5106, 17104, 9554, 13089, 12763, 10991, 28742, 16649, 12971,
+    12497, 12689, 28808, 12763, 8777, 16461, 5112, 12984, 16562, 5858, 8936, 32891, 9311, 32882, 32826, 12407,
+    5878, 8424, 10823, 10757, 32780, 12407, 28817, 8314, 11050, 17388, 9018, 13092, 12861, 12862, 9664, 8461,
+    13159, 16772, 28795, 4727, 12825, 12599, 28681, 16519, 28802, 12646, 11456, 28684, 11409, 16593, 12948, 9240,
+    12336, 6405, 5337, 12742, 12684, 8350, 9402, 4940, 28782, 12822, 12660, 8966, 17304, 16829, 12550, 16935,
+    12418, 16608, 17071, 17314, 6453, 16540, 9664, 13125, 12980, 17016, 9552, 9555, 28678, 12304, 16540, 28699,
+    11822, 17140, 12956, 9555, 32937, 12622, 9728, 13159, 6199, 28741, 12766, 13040, 12378, 8965, 28713, 12740,
+    28788, 11655, 28727, 12551, 11585, 9446, 17222, 12384, 13029, 5666, 16450, 5112, 8461, 32802, 9135, 8460,
+    32872, 28674, 28711, 16519, 10532, 16474, 8769, 28693, 9601, 5449, 17397, 5410, 11456, 16857, 9620, 12894,
+    32801, 8233, 12906, 12348, 13175, 10507, 11122, 17147, 12839, 32857, 32921, 13041, 32790, 11367, 12859, 32807,
+    5910, 11341, 6445, 4873, 16608, 32868, 28751, 17209, 11042, 8314, 12312, 17141, 12312, 11984, 28817, 5093,
+    5113, 12372, 8361, 11653, 12767, 11882, 4975, 28778, 12780, 32777, 12576, 12515, 11950, 32820, 32870, 17043,
+    11673, 6041, 12980, 28785, 20485, 9870, 28682, 10498, 12407, 9198, 13126, 12682, 17011, 12984, 12360, 13090,
+    12984, 13075, 28678, 16424, 16699, 32928, 9603, 32831, 9890, 6357, 28678, 11094, 28722, 28815, 28694, 4774,
+    12294, 12600, 12826, 8468, 28794, 8478, 12588, 11544, 32798, 12338, 28788, 11522, 12924, 5670, 10845, 12378,
+    28708, 11747, 28705, 28699, 16488, 12563, 16505, 8742, 12347, 8995, 9593, 17225, 11481, 12564, 10507, 11723,
+    9933, 28675, 16525, 12898, 12372, 12873, 28730, 12382, 10477, 32920, 28799, 12599, 12587, 9339, 32937, 12957,
+    32858, 16462, 12929, 12933, 11585, 8241, 17078, 28705, 5491, 28805, 13092, 5499, 28746, 9331, 13222, 32790,
+    17139, 12496, 6144, 5989, 16596, 12756, 11369, 28798, 17069, 12743, 16528, 16767, 9089, 17203, 28685, 28763,
+    12910, 16619, 17062, 11769, 12827, 12449, 12849, 13044, 12720, 9687, 32928, 8469, 12789, 17000, 12439, 32933,
+    32918, 16922, 12826, 6117, 11873, 28701, 12527, 17216, 32854, 20483, 17001, 10207, 16727, 32909, 5427, 13173,
+    12970, 11358, 12813, 28725, 32780, 16450, 12932, 8588, 9294, 13137, 16463, 8722, 9310, 13210, 12611, 32896,
+    5921, 16450, 11144, 10582, 12852, 12860, 12960, 12934, 12611, 8790, 32819, 32846, 13039, 4350, 10795, 12358,
+    12547, 10481, 9022, 11541, 16553, 28788, 16528, 32810, 13137, 28719, 12443, 12767, 12671, 28712, 16756, 12891,
+    12467, 28707, 17140, 5455, 13100, 28712, 28778, 12899, 12922, 13179, 32774, 16697, 10207, 9444, 28807, 9496,
+    20487, 32857, 12408, 9358, 5621, 12825, 16845, 9084, 32814, 6205, 32828, 5491, 17225, 16700, 12624, 28707,
+    13164, 32870, 10776, 28795, 5621, 16699, 17141, 8479, 16577, 16506, 13038, 9683, 10581, 16450, 8368, 16680,
+    12299, 12755, 10094, 28822, 12392, 9593, 28696, 9906, 17407, 28675, 13222, 13221, 10282, 12503, 12777, 8919,
+    5992, 10489, 12392, 13176, 9065, 12371, 13026, 12587, 28767, 6163, 17174, 28743, 11953, 10273, 28736, 16673,
+    12571, 32858, 32779, 32937, 28729, 32882, 9384, 12839, 11921, 12612, 12551, 8788, 13104, 8422, 17082, 32857,
+    13048, 28793, 17220, 13016, 12654, 16528, 28810, 10415, 28801, 13056, 13170, 12417, 13006, 9068, 16742, 11779,
+    17240, 12408, 28786, 5829, 32826, 12299, 17411, 17388, 16801, 28757, 32813, 8485, 28747, 12348, 28819, 5585,
+    12396, 12679, 8827, 20484, 8489, 16541, 28721, 9321, 8421, 5433, 28676, 28791, 32881, 13020, 16525, 8460,
+    32885, 9089, 12538, 9088, 8787, 28697, 12731, 12405, 32903, 11766, 16609, 28811, 12970, 12307, 32924, 12382,
+    12384, 12364, 12765, 28717, 13066, 10459, 12395, 32833, 9386, 8421, 12632, 32780, 12717, 5635, 12443, 32844,
+    5562, 28770, 12980, 12585, 32780, 12562, 28703, 28709, 5562, 8533, 32833, 12672, 17160, 16737, 16688, 10178,
+    6100, 17288, 28737, 9761, 10815, 10561, 11990, 9319, 28688, 28779, 12597, 32846, 5991, 11395, 32891, 10584,
+    32816, 16541, 28719, 28684, 28745, 28695, 28805, 8321, 28718, 10815, 8848, 6009, 9891, 11544, 16673, 11349,
+    9164, 28811, 28761, 10452, 6167, 12862, 16699, 32807, 6375, 6163, 28776, 12335, 12992, 16973, 11475, 10079,
+    8935, 28774, 8982, 17398, 5954, 12597, 10859, 28721, 11842, 5971, 32859, 8883, 4609, 16903, 9247, 16998,
+    12825, 28744, 8321, 12840, 28768, 16536, 12336, 13100, 13178, 28710, 10365, 32786, 16429, 17332, 8513, 11400,
+    32908, 9515, 28758, 16688, 8721, 17304, 11902, 12540, 8422, 32908, 16658, 16688, 12345, 28744, 10963, 10261,
+    8779, 10787, 28709, 13100, 12316, 8779, 9683, 16615, 11304, 28764, 9940, 16742, 10882, 8476, 11095, 12768,
+    9905, 12441, 16767, 16642, 17041, 12992, 12751, 8613, 12336, 12660, 28758, 11991, 9964, 32870, 28725, 9985,
+    28719, 5461, 10829, 12912, 28787, 12780, 12324, 9138, 12012, 20481, 12526, 12851, 16595, 12773, 17227, 32882,
+    32897, 9085, 13002, 8365, 12420, 28725, 16542, 10285, 12945, 28707, 16700, 13126, 10845, 12720, 9219, 11534,
+    28684, 8957, 32910, 12888, 32870, 11755, 13150, 6288, 13014, 11115, 28798, 13026, 10872, 12598, 9403, 28804,
+    9981, 9919, 9077, 28676, 12612, 12744, 8277, 12979, 4863, 28678, 8657, 12395, 13190, 8468, 13206, 10569,
+    11692, 13077, 32858, 12396, 5063, 17094, 13049, 12935, 32781, 17250, 4418, 28718, 8957, 8253, 6372, 13199,
+    12851, 28824, 16911, 28754, 28741, 11086, 28677, 32858, 11372, 28784, 12764, 12366, 12309, 12538, 12816, 9828,
+    8368, 12670, 12909, 28673, 28729, 6235, 16613, 28681, 10725, 17235, 20485, 32837, 11178, 12307, 8478, 8490,
+    11409, 17410, 5046, 12753, 28821, 8966, 9066, 12967, 16397, 32870, 28795, 32815, 28759, 11671, 12040, 12897,
+    28695, 5064, 12486, 28775, 32816, 9022, 16508, 12370, 8666, 13195, 28707, 12296, 17336, 32898, 32918, 11212,
+    6121, 12816, 28720, 16813, 17229, 28805, 10583, 17410, 28752, 13078, 28811, 8299, 12970, 13164, 12993, 28734,
+    17162, 9918, 17249, 16779, 28787, 32789, 16880, 32911, 28722, 16657, 13000, 4928, 13053, 12668, 11176, 28744,
+    12600, 12742, 12651, 28814, 12464, 12514, 12049, 12646, 11114, 11171, 9424, 8488, 12971, 10845, 9501, 28805,
+    9265, 12922, 10562, 16808, 12947, 28748, 11686, 9076, 17217, 16463, 8982, 12982, 16645, 16411, 13204, 11589,
+    12333, 9656, 9862, 8788, 32935, 12766, 6446, 11648, 28797, 28717, 4699, 28706, 11024, 5924, 28818, 16525,
+    11699, 9425, 9948, 20481, 9579, 16764, 10554, 8664, 9124, 5906, 16496, 6420, 11640, 8941, 16509, 5083,
+    9609, 12828, 11358, 9377, 28674, 32846, 12466, 16657, 9066, 12816, 17305, 32776, 28799, 12960, 12631, 12982,
+    28752, 12648, 11858, 12880, 6057, 32833, 5309, 12600, 28794, 10881, 28699, 20489, 28742, 28688, 8397, 32883,
+    17190, 8562, 28803, 10581, 9058, 12600, 32908, 12862, 13011, 13128, 32794, 32859, 16542, 28708, 8233, 28779,
+    13065, 16425, 12636, 28775, 13017, 8768, 12747, 10837, 16398, 13207, 6462, 12742, 16569, 9342, 20484, 28766,
+    32922, 11144, 12587, 8452, 12552, 5884, 28793, 5355, 17151, 9068, 9537, 12323, 12552, 28717, 17150, 16476,
+    16459, 32843, 16529, 16700, 12836, 20481, 17241, 12743, 16850, 9657, 11115, 16816, 9243, 32791, 16538, 13062,
+    12860, 28774, 32806, 10770, 12910, 10507, 6204, 28682, 12995, 9077, 13086, 13185, 32885, 9083, 13053, 16764,
+    8918, 16700, 10177, 11699, 12007, 13133, 16395, 9600, 28710, 12454, 16518, 13205, 32885, 13104, 17220, 28806,
+    28805, 8767, 10932, 8712, 32794, 12744, 28783, 9367, 17004, 16686, 11998, 12786, 10862, 9971, 10729, 28714,
+    10270, 13124, 32778, 28700, 12886, 32896, 16762, 9021, 9388, 17319, 16756, 13029, 9075, 32859, 32929, 28700,
+    12046, 16667, 28710, 13066, 12936, 11449, 11144, 28692, 28675, 9452, 16620, 11152, 12456, 8787, 6058, 6218,
+    12752, 16440, 16643, 12636, 5920, 32935, 28764, 28795, 28727, 32923, 9586, 11657, 10477, 28737, 11729, 28764,
+    12624, 11456, 20490, 11111, 16754, 4410, 13103, 32884, 28826, 9974, 8667, 16754, 12508, 17081, 28722, 16542,
+    11844, 8214, 28720, 17304, 32893, 28757, 13116, 11069, 28767, 8583, 28722, 12707, 8776, 5718, 10882, 17003,
+    12828, 12995, 11428, 9904, 9182, 4953, 13090, 32910, 28705, 12439, 8702, 28741, 4924, 28783, 16834, 28809,
+    8768, 28799, 9683, 10153, 8658, 10815, 9386, 12631, 32820, 13053, 12079, 17252, 16778, 32779, 9608, 28684,
+    16462, 9620, 11028, 9376, 16700, 9666, 32827, 28757, 13221, 17171, 12753, 9610, 12405, 9965, 12982, 10570,
+    28687, 10871, 12768, 5578, 17082, 32791, 32780, 4628, 28711, 28765, 28698, 17366, 9087, 17061, 9554, 28806,
+    11865, 16519, 16542, 28804, 6422, 17229, 28754, 11174, 16519, 12631, 16684, 11443, 8778, 28826, 8713, 8423,
+    12334, 20489, 28761, 13126, 6167, 12467, 12380, 28796, 28702, 13078, 20483, 12827, 9719, 8211, 13160, 6189,
+    12672, 11838, 12383, 13136, 32820, 11456, 11449, 32817, 9265, 13078, 32802, 4269, 6231, 13054, 28692, 20484,
+    9575, 12336, 10284, 9481, 10153, 28701, 4394, 9075, 8461, 6343, 8423, 12549, 28701, 32920, 13078, 12407,
+    16734, 12772, 11960, 12319, 12443, 12584, 13140, 12054, 28757, 12520, 8879, 10934, 13032, 28802, 32794, 9985,
+    16541, 28687, 10514, 16427, 17304, 16992, 12359, 32911, 5276, 12486, 28734, 17273, 17172, 9968, 12624, 13196,
+    28723, 12852, 16801, 28692, 17094, 32777, 5084, 28759, 16492, 16846, 11683, 13174, 13008, 16765, 9022, 8721,
+    16643, 16593, 8605, 12924, 11161, 16542, 13054, 11926, 32919, 12320, 28786, 17157, 32780, 10938, 13137, 9195,
+    9173, 28713, 6357, 28720, 8400, 13089, 16508, 4694, 12598, 13208, 4636, 28677, 11176, 8510, 8956, 28696,
+    28813, 6363, 16663, 32842, 28818, 4953, 13115, 9852, 10664, 28805, 9377, 4707, 12660, 12647, 12075, 12357,
+    28813, 28805, 28693, 12452, 4971, 12596, 13209, 11884, 32921, 16700, 12655, 13029, 5432, 16694, 13181, 32859,
+    32781, 16586, 12655, 28735, 12468, 8491, 8995, 13224, 12597, 28805, 12840, 16601, 12345, 9557, 8789, 13040,
+    12299, 13102, 28763, 12984, 12911, 4698, 12863, 12860, 13017, 12876, 16519, 32778, 32829, 13222, 11480, 10691,
+    16449, 8665, 32778, 8489, 17173, 9985, 9294, 28693, 12954, 32897, 6328, 28796, 28722, 9293, 28701, 16399,
+    28823, 28682, 32806, 13102, 8207, 9387, 28711, 12898, 32910, 10571, 11369, 11059, 12730, 12548, 12360, 13116,
+    13136, 12863, 11470, 12751, 12391, 8488, 12466, 28719, 9265, 32776, 32878, 12540, 12574, 9631, 16515, 32852,
+    32830, 28673, 11470, 10561, 28814, 28818, 12828, 28726, 32885, 11742, 12852, 4678, 10963, 12669, 6298, 12382,
+    12718, 12959, 12456, 10538, 5274, 12669, 16439, 13216, 32846, 9248, 28675, 9234, 16700, 9385, 28735, 32814,
+    16914, 8956, 12968, 10477, 12320, 9385, 12751, 28741, 12765, 10976, 20483, 8412, 12912, 10426, 12708, 13100,
+    4971, 32792, 8411, 12972, 9088, 10963, 20488, 16518, 28718, 12947, 12526, 13052, 16694, 16700, 28680, 10925,
+    11414, 4952, 28781, 9078, 9248, 13056, 9985, 12466, 16914, 13164, 12943, 28722, 20484, 11559, 9037, 28808,
+    12346, 17319, 9320, 17095, 10882, 8790, 17062, 10369, 28680, 17332, 17185, 11747, 9349, 8665, 10280, 13078,
+    12982, 12981, 12777, 16990, 17315, 28733, 13152, 9546, 28707, 32857, 8657, 16492, 28724, 32828, 17251, 28752,
+    12537, 16700, 6325, 6411, 11458, 28706, 11621, 9310, 12466, 28827, 8490, 9983, 16958, 28786, 11924, 13032,
+    28761, 32856, 28789, 11920, 9265, 16412, 17306, 4933, 17032, 28784, 32883, 13086, 28784, 20487, 12767, 28805,
+    4891, 12670, 12825, 12561, 12527, 9376, 28725, 28827, 28743, 8366, 12368, 5242, 12344, 12970, 20487, 9294,
+    12323, 13163, 28787, 28764, 13111, 13222, 17388, 5559, 28768, 6462, 8461, 28707, 28711, 13146, 28673, 16664,
+    6448, 8467, 12722, 17252, 13217, 16609, 12947, 13054, 12480, 12835, 6446, 5026, 11181, 17003, 4636, 9059,
+    12766, 13139, 6218, 28763, 8703, 28696, 12431, 11181, 28800, 17211, 12636, 12600, 12731, 28783, 32858, 28720,
+    13113, 5270, 17059, 28811, 12354, 10729, 28734, 12444, 5897, 16588, 32826, 20481, 11664, 28783, 10806, 10805,
+    32915, 16756, 28826, 28707, 28821, 10883, 4210, 12547, 32775, 12634, 12835, 12671, 32788, 9301, 6425, 28737,
+    16846, 9687, 28806, 9264, 12311, 12379, 6424, 32806, 9574, 32820, 12960, 8768, 12766, 9930, 8470, 12528,
+    10273, 28775, 28680, 11956, 32936, 28718, 10827, 17092, 10183, 6411, 20486, 16615, 13102, 12813, 6462, 12518,
+    16459, 16519, 9664, 9388, 28818, 11242, 4954, 11475, 13204, 16992, 16684, 11726, 12612, 9974, 12596, 6009,
+    28815, 20490, 32852, 28706, 12658, 16843, 6008, 28780, 12311, 16855, 28793, 12631, 12382, 28722, 11842, 8760,
+    4143, 8751, 9451, 28783, 28748, 28735, 10284, 12540, 28820, 10183, 16619, 17070, 12765, 11860, 17174, 8573,
+    16642, 28715, 8769, 12442, 11780, 28679, 16776, 12526, 32804, 9192, 28814, 4636, 12909, 16578, 28684, 11126,
+    12406, 12607, 28746, 17159, 17031, 12636, 16843, 16913, 10023, 16844, 11750, 8387, 16810, 17147, 28809, 11178,
+    16746, 8404, 8581, 32819, 28677, 11181, 11457, 9152, 28823, 28742, 13122, 16687, 17392, 32819, 12536, 17051,
+    5547, 10881, 32898, 20490, 12047, 16805, 28781, 12646, 17305, 16677, 11126, 9985, 28763, 20486, 28720, 12599,
+    12670, 11884, 32921, 28690, 32807, 5965, 11999, 12670, 17269, 28694, 12873, 9043, 5338, 10078, 28806, 28708,
+    12645, 13126, 20484, 12537, 6411, 32814, 10669, 32921, 32856, 12371, 16835, 5356, 13127, 17249, 28751, 10946,
+    11709, 16462, 32878, 8405, 12658, 28714, 11480, 8412, 28704, 16582, 12537, 28727, 28741, 32885, 17367, 12828,
+    12462, 12984, 12754, 9169, 17251, 9078, 28795, 28745, 8321, 32920, 11764, 16665, 8306, 13102, 20488, 8696,
+    8270, 17399, 12451, 17058, 12838, 32816, 28730, 12420, 8711, 11119, 16462, 12820, 11170, 17051, 28816, 11750,
+    8412, 9218, 32798, 28687, 13077, 32805, 17184, 13001, 28754, 32812, 12559, 12384, 17078, 10878, 12353, 12682,
+    28689, 12827, 8956, 11011, 11481, 11180, 9302, 28797, 8720, 28777, 28766, 12595, 20486, 8491, 13200, 9311,
+    28794, 28780, 12335, 17203, 11925, 32817, 12849, 28794, 12536, 11481, 12742, 12408, 12297, 12454, 20482, 28794,
+    28818, 11755, 17383, 32818, 17240, 28745, 5227, 32781, 11358, 17393, 12923, 17405, 12835, 32827, 12466, 28770,
+    32852, 10458, 5579, 5432, 16924, 28789, 12822, 28677, 28675, 12776, 32814, 12560, 12598, 13056, 16981, 28807,
+    12980, 17329, 12449, 32898, 32779, 10199, 13128, 16685, 16491, 9863, 32871, 12660, 13116, 32866, 11327, 12319,
+    28682, 9020, 32853, 11947, 12995, 8965, 12816, 17137, 4804, 32775, 28753, 8414, 12595, 12380, 12324, 32889,
+    10706, 11011, 12394, 12458, 12392, 9265, 12972, 10755, 32911, 12536, 28807, 17299, 11945, 5603, 28760, 11998,
+    11102, 11177, 12911, 12778, 17383, 32897, 9681, 13149, 6036, 12851, 9020, 11769, 28705, 32895, 12714, 12924,
+    17220, 6381, 28746, 17331, 9018, 28697, 16405, 28760, 12342, 9853, 11841, 17045, 28691, 12840, 10063, 17237,
+    12682, 13078, 20482, 5898, 28723, 17253, 32837, 5112, 12934, 13042, 4759, 17001, 12475, 32806, 9275, 10806,
+    28688, 10255, 5916, 12742, 13161, 28732, 11908, 12774, 28724, 12701, 32854, 20487, 11460, 12802, 28684, 32816,
+    20485, 28809, 11768, 12418, 32870, 9563, 28737, 8453, 12766, 13087, 32815, 32831, 12404, 32807, 12348, 12967,
+    28770, 28696, 10458, 12776, 11042, 9012, 12692, 11902, 12861, 17409, 9075, 28755, 9656, 11469, 9022, 8767,
+    16598, 5664, 13042, 12959, 12980, 13104, 8766, 5605, 28687, 32935, 11888, 13103, 28724, 8489, 17240, 6411,
+    32883, 8815, 11888, 32802, 8254, 11404, 12933, 16879, 9086, 13030, 5449, 12382, 12666, 12960, 11776, 28747,
+    9680, 12503, 11029, 16568, 28779, 12778, 9367, 11779, 12703, 28751, 11952, 28803, 12648, 12623, 12923, 11005,
+    10760, 12743, 16895, 13115, 16808, 12851, 32843, 28799, 16937, 32831, 28795, 13222, 11779, 12923, 12443, 12476,
+    13091, 32819, 9230, 9294, 13136, 12928, 28696, 32931, 5562, 28699, 28762, 17004, 28828, 12330, 13102, 32911,
+    10580, 28716, 12707, 11245, 10496, 13067, 28827, 28784, 12982, 9384, 10407, 13142, 12960, 9377, 16973, 12007,
+    16621, 8839, 28780, 28737, 17410, 5627, 13193, 11113, 32891, 12885, 28761, 16835, 12695, 6310, 28746, 12550,
+    12815, 12839, 32820, 16621, 16936, 13020, 5629, 20486, 12972, 16423, 13140, 32777, 28799, 11993, 13197, 12666,
+    17045, 5462, 11542, 13103, 12826, 16477, 32928, 16699, 10440, 12718, 8966, 12669, 9058, 16754, 32933, 10071,
+    12441, 9131, 5658, 16606, 28819, 12480, 5579, 28765, 28781, 28798, 12876, 28754, 13003, 12404, 9182, 20483,
+    12744, 13125, 5916, 28673, 16412, 32809, 32819, 8506, 12418, 16981, 28798, 32881, 16816, 28674, 28719, 12300,
+    32831, 16609, 10414, 16704, 12359, 12918, 28718, 12460, 12564, 12940, 12524, 12334, 32878, 28717, 8229, 13127,
+    28793, 32903, 11304, 10480, 9089, 9076, 28787, 28740, 8767, 28711, 10101, 12489, 28695, 12668, 32813, 5990,
+    10208, 9962, 8836, 28676, 28726, 28741, 28772, 28709, 32773, 12876, 12812, 32934, 13200, 12835, 20486, 12838,
+    13127, 9561, 28731, 12966, 32801, 10011, 28771, 16824, 28734, 16752, 12643, 10976, 12783, 28711, 32858, 9089,
+    16845, 28688, 16667, 12762, 6225, 12369, 28711, 13204, 12336, 8552, 12576, 28814, 8738, 28777, 10206, 16459,
+    12012, 12671, 9743, 9011, 8759, 28726, 11290, 28745, 12079, 11899, 12371, 12824, 28750, 12372, 16857, 6440,
+    13049, 28741, 11114, 17230, 5561, 13115, 10203, 16735, 13041, 11059, 12634, 16845, 28815, 9885, 16935, 28820,
+    16484, 16846, 8919, 5579, 13056, 12874, 32809, 16426, 20482, 8786, 28743, 10528, 13199, 32936, 5916, 16537,
+    12755, 28705, 28806, 28793, 32789, 8759, 12936, 28801, 12336, 28781, 10458, 28741, 13199, 28788, 10273, 28710,
+    28685, 12622, 12850, 16462, 9619, 9673, 11777, 32858, 28728, 10039, 12672, 32872, 28802, 32807, 9331, 17330,
+    9386, 16993, 32857, 12047, 16872, 12599, 9789, 11290, 11425, 8351, 12753, 5991, 13204, 28790, 12739, 17072,
+    10584, 11341, 8423, 13224, 16856, 9648, 12604, 12786, 5897, 12660, 8768, 5563, 11873, 8314, 9554, 4947,
+    28700, 28772, 12000, 16891, 12647, 8778, 9570, 9321, 10506, 12885, 28763, 9480, 13090, 12659, 13200, 12959,
+    16618, 9182, 8720, 16596, 28799, 11603, 12858, 8322, 28773, 16766, 10816, 28788, 12348, 8422, 11047, 17071,
+    8423, 12484, 10211, 28694, 28828, 12707, 28782, 10626, 32870, 11780, 12634, 16709, 12959, 12600, 12646, 12957,
+    12971, 28798, 12515, 32891, 13044, 28710, 8469, 12063, 12959, 16688, 8460, 4720, 5670, 12755, 12427, 11058,
+    28736, 13211, 10691, 28812, 28728, 28683, 17230, 12381, 12047, 8713, 28734, 12307, 28729, 13176, 12768, 9890,
+    11939, 12527, 28676, 9467, 12941, 32917, 20481, 10506, 12715, 12779, 17155, 28779, 12899, 32921, 12659, 9087,
+    13123, 12861, 10809, 10831, 16849, 28689, 16462, 10400, 16904, 16440, 13222, 32895, 17095, 17203, 12882, 16777,
+    9384, 12452, 5254, 17072, 12919, 32844, 28730, 12740, 12743, 16603, 9374, 12995, 12025, 9181, 16858, 8918,
+    16710, 8722, 32880, 4721, 28775, 28722, 12503, 12598, 4202, 28766, 10572, 28722, 12777, 16607, 12305, 28688,
+    28759, 11402, 28805, 16699, 8956, 11657, 32802, 9141, 12681, 11703, 17411, 10925, 28796, 12863, 17150, 8769,
+    28784, 12545, 12742, 12443, 5899, 12930, 28683, 17013, 12671, 28722, 9801, 9874, 8812, 10963, 28736, 12068,
+    9375, 13054, 12464, 9358, 12871, 32790, 17109, 12528, 12068, 13056, 9634, 28787, 16699, 10496, 10145, 11481,
+    10263, 10851, 32908, 16627, 28674, 12886, 16699, 12860, 17398, 9350, 12419, 32910, 12811, 9077, 8965, 32802,
+    10337, 13065, 32832, 12967, 28765, 12598, 11108, 12863, 11013, 8920, 28816, 13135, 13152, 32858, 8964, 32820,
+    8767, 28758, 4952, 28758, 5621, 9599, 13185, 16539, 8480, 9111, 28763, 16660, 16426, 10207, 6051, 28756,
+    12719, 9075, 28709, 5627, 12318, 8311, 12824, 9265, 9319, 13038, 12993, 17123, 32933, 12460, 17299, 32871,
+    8533, 13223, 28787, 10742, 28684, 10861, 12751, 16698, 12358, 12456, 28815, 13101, 11409, 28717, 12672, 12686,
+    28678, 5496, 10093, 12718, 10853, 28817, 16700, 8790, 13135, 12942, 12526, 13104, 17330, 17081, 17264, 28767,
+    8723, 13220, 32932, 10477, 10471, 28791, 12932, 9164, 16856, 5064, 28720, 13208, 9248, 16682, 11765, 16756,
+    28815, 28783, 28782, 13004, 12078, 10457, 11246, 11657, 12486, 12935, 28775, 9981, 28735, 28807, 16607, 13216,
+    28673, 12766, 12574, 13114, 16598, 12887, 16934, 9321, 28696, 17219, 16518, 28761, 12847, 8424, 4932, 13019,
+    17384, 12768, 13005, 12716, 9377, 12294, 16535, 32907, 8461, 11640, 13197, 32789, 8404, 28678, 28677, 9173,
+    11469, 8976, 28780, 12345, 11423, 16450, 9655, 9729, 8331, 28784, 28687, 28785, 32910, 13080, 11161, 12658,
+    9058, 12670, 12587, 12873, 16517, 12851, 6291, 28713, 8304, 32936, 28677, 13092, 13063, 10815, 13211, 5916,
+    12539, 11443, 32839, 28808, 6166, 12852, 28722, 11627, 11152, 9110, 8664, 16835, 32807, 11424, 12706, 12443,
+    11102, 11105, 28696, 12527, 16450, 28802, 16937, 32937, 10584, 11691, 8477, 12345, 12468, 17086, 28818, 12455,
+    12684, 11626, 12057, 12563, 32936, 28801, 12312, 28795, 9018, 32906, 13073, 28730, 8767, 20484, 12803, 12599,
+    28779, 12600, 10871, 32910, 12402, 12920, 4676, 32794, 12873, 28710, 32859, 12576, 5621, 32788, 10845, 32869,
+    10814, 9553, 9125, 8703, 13219, 12391, 28743, 16411, 28683, 11371, 12885, 12369, 9683, 32814, 11404, 8528,
+    28770, 12456, 10560, 9367, 13217, 16410, 28756, 32918, 12461, 32908, 28826, 6339, 28761, 28767, 12583, 28817,
+    13216, 17062, 9318, 12347, 12344, 28745, 32807, 6421, 9086, 5929, 12671, 12600, 10832, 32919, 11460, 16413,
+    16846, 11114, 10517, 10349, 13224, 12068, 12407, 9955, 6357, 17160, 6276, 13091, 8788, 12835, 32898, 12454,
+    9631, 32851, 13091, 5664, 20481, 28807, 10872, 13194, 12442, 28742, 32920, 13078, 9665, 5253, 16579, 12768,
+    16687, 11155, 28775, 16892, 12440, 32830, 12995, 8789, 28819, 28802, 28686, 28732, 28683, 32930, 12535, 12442,
+    28678, 12672, 16765, 11694, 32852, 32848, 12347, 12492, 9975, 13053, 12462, 11625, 16755, 16655, 17087, 12886,
+    9780, 10880, 11144, 8314, 12680, 9577, 16564, 28680, 12528, 12876, 9666, 32858, 16400, 12378, 13080, 11768,
+    11589, 11150, 28757, 11391, 12432, 12391, 28777, 11860, 16450, 17367, 32776, 13103, 9367, 16763, 16924, 16649,
+    12429, 28815, 17264, 6457, 28746, 28737, 20485, 10398, 10049, 9655, 12428, 9387, 32934, 10869, 28722, 28676,
+    11131, 5406, 13005, 10583, 28712, 10881, 12912, 12599, 8759, 8414, 28692, 9262, 28731, 32790, 10862, 8515,
+    32859, 12357, 6223, 6422, 8404, 28739, 20485, 28793, 10684, 17235, 12756, 13222, 12970, 8702, 13027, 32894,
+    9332, 32801, 9998, 32882, 12775, 8422, 28753, 12679, 10693, 28676, 12570, 5196, 16899, 9619, 16778, 28716,
+    12755, 12295, 8777, 9219, 12359, 28784, 12764, 28821, 10669, 12357, 28701, 28743, 28680, 17383, 28674, 9733,
+    9375, 32881, 12657, 17408, 12887, 11179, 9459, 9675, 12776, 8322, 12945, 12728, 28703, 17383, 13176, 4887,
+    28824, 12803, 10138, 16895, 28693, 12779, 13223, 28772, 10400, 28715, 12981, 10610, 8314, 28703, 16541, 8480,
+    5540, 17351, 16571, 16419, 28748, 12983, 10541, 16744, 17399, 32832, 28824, 16775, 28766, 28812, 12791, 16833,
+    6394, 16825, 9020, 28764, 12935, 28700, 12727, 12335, 13128, 16666, 32870, 13007, 12636, 13188, 13171, 13043,
+    28716, 16808, 28688, 17092, 12595, 10340, 12420, 12870, 16990, 28704, 16463, 13149, 17102, 13092, 28755, 17072,
+    28764, 12536, 32894, 32779, 16914, 12775, 28825, 16509, 28820, 12383, 16856, 32820, 17111, 12357, 13030, 17246,
+    16579, 28774, 13116, 10563, 11130, 12864, 28825, 32896, 17249, 32831, 28789, 32819, 10968, 5628, 9373, 6187,
+    12727, 9862, 32883, 12620, 12560, 28728, 12513, 32924, 16428, 9068, 28785, 28743, 16743, 8480, 13006, 32805,
+    8337, 28736, 12683, 16835, 13173, 12753, 16762, 32817, 28726, 28708, 11357, 9088, 32934, 28791, 12420, 10431,
+    28807, 28696, 9317, 12609, 16832, 28819, 12598, 12431, 17251, 12382, 32895, 20484, 6218, 17378, 17236, 28786,
+    12658, 4625, 8966, 8358, 28713, 28770, 28702, 12597, 6448, 17092, 17320, 9256, 12540, 12041, 16958, 28813,
+    11180, 9386, 13066, 8956, 9218, 28761, 12370, 11161, 20486, 28718, 12774, 12358, 12876, 32810, 9300, 16474,
+    8965, 6315, 20486, 28701, 5096, 17304, 12863, 28681, 12348, 32792, 28826, 28690, 8477, 8488, 16628, 12316,
+    28711, 12840, 12971, 9281, 13184, 11694, 6453, 28728, 10560, 17091, 28826, 17014, 13161, 28756, 12742, 12668,
+    6203, 28684, 28755, 12908, 28724, 10269, 28773, 28828, 10845, 16558, 5064, 28742, 11436, 11113, 9022, 28826,
+    32859, 28694, 11245, 28826, 13176, 6167, 28726, 8453, 32859, 10285, 12347, 16858, 28811, 28804, 16677, 28745,
+    28728, 28807, 9973, 11565, 10132, 11542, 17016, 28770, 13073, 12597, 8364, 10563, 4699, 5891, 6224, 9367,
+    13077, 11470, 10875, 11884, 12754, 12983, 4699, 9675, 8650, 28810, 12837, 12624, 12568, 4879, 28824, 4151,
+    6298, 9845, 13004, 28675, 28709, 16602, 8576, 28701, 12883, 12503, 17394, 12729, 10001, 17092, 17309, 12464,
+    28770, 8779, 12597, 28808, 12633, 12414, 16755, 13223, 10216, 12828, 12885, 12476, 10820, 32807, 11723, 8321,
+    32829, 17314, 28785, 16691, 12300, 17160, 12960, 10162, 8489, 9736, 9985, 12672, 28802, 11160, 28827, 28696,
+    16430, 12392, 11180, 16762, 32908, 16919, 32777, 13123, 12849, 32852, 12850, 11545, 28742, 12510, 9467, 10477,
+    13079, 12968, 32791, 32916, 11181, 28741, 8217, 28707, 10692, 5339, 16728, 28694, 28751, 12372, 13187, 9077,
+    10874, 9571, 9892, 12432, 28729, 9859, 12935, 16461, 9563, 13175, 16806, 12885, 12837, 16980, 8905, 8313,
+    12579, 12861, 28767, 12756, 28808, 32870, 11174, 17299, 13123, 12996, 12762, 16958, 9309, 13186, 16673, 6357,
+    12948, 28804, 13078, 28776, 8790, 12659, 9580, 12888, 12945, 12308, 12381, 10184, 28745, 9773, 12406, 9600,
+    12596, 9608, 13088, 12335, 12741, 12864, 28819, 28721, 17110, 16621, 32869, 8779, 12417, 10647, 28698, 32781,
+    10727, 5916, 12527, 28809, 28757, 11622, 32852, 10779, 16843, 12684, 8414, 32897, 12670, 12850, 9497, 10584,
+    32896, 28773, 28821, 13185, 9294, 8517, 6446, 12852, 11648, 8957, 28720, 28778, 16687, 4636, 12346, 12647,
+    9113, 8713, 16463, 9676, 13174, 12297, 16835, 8480, 12667, 13041, 8827, 12358, 9067, 5356, 5991, 17411,
+    11656, 12761, 16528, 12600, 32924, 9089, 32881, 28719, 12371, 11469, 12347, 13044, 32851, 10397, 16567, 17010,
+    5896, 28798, 16823, 12635, 32829, 12624, 8964, 32844, 28704, 12893, 20486, 9665, 17174, 5300, 16618, 13111,
+    16761, 6363, 9518, 28737, 13044, 12755, 12404, 13067, 12920, 12535, 5430, 8882, 12360, 32793, 11860, 12861,
+    28826, 10844, 28762, 32816, 12574, 9011, 8955, 20481, 17001, 16767, 6462, 8422, 11103, 28704, 17408, 13090,
+    11095, 10946, 10375, 9906, 28692, 12022, 32841, 12537, 12528, 17403, 28681, 28711, 28697, 10160, 6394, 28736,
+    28683, 16992, 16569, 4572, 20484, 12779, 13031, 28790, 16608, 10852, 12707, 28747, 16595, 9114, 11244, 17083,
+    32811, 12768, 12316, 10559, 12495, 12572, 17388, 8612, 12835, 8722, 12910, 12850, 16451, 28819, 12356, 32934,
+    12562, 8645, 12454, 13019, 28788, 12786, 10480, 32839, 8759, 12766, 6120, 28759, 32842, 28817, 12571, 12306,
+    28801, 12864, 13126, 12598, 12478, 17250, 12779, 11066, 9897, 32924, 12943, 9601, 12776, 16834, 8445, 9256,
+    4954, 28765, 13172, 16567, 11910, 12402, 17032, 17240, 12348, 13221, 17014, 28742, 16737, 28814, 32788, 12672,
+    32831, 5644, 8748, 20490, 28774, 28781, 28704, 12562, 16426, 4244, 6356, 20489, 17399, 28813, 12756, 17304,
+    12766, 5583, 11886, 11966, 32937, 8421, 9518, 28717, 5969, 11144, 12912, 11965, 28728, 12516, 12513, 10271,
+    9115, 12874, 9673, 32876, 32803, 12344, 16936, 11747, 12372, 12907, 16884, 12874, 17016, 12573, 32799, 16395,
+    12382, 10580, 12729, 12450, 16699, 32818, 17083, 16934, 11774, 11160, 9946, 9807, 8883, 12600, 8424, 16620,
+    13185, 10208, 16438, 8478, 10071, 13161, 12996, 12334, 28789, 28760, 6357, 16406, 28828, 32819, 12846, 9655,
+    32883, 13198, 16541, 16677, 12612, 12923, 16959, 12370, 32815, 32832, 12538, 10997, 6457, 28827, 10693, 12395,
+    12704, 16816, 32780, 11656, 28823, 28817, 28808, 17251, 12936, 32937, 10992, 28727, 32869, 32775, 32855, 11470,
+    9384, 9384, 16844, 17319, 4335, 12021, 28701, 12946, 10648, 11394, 28789, 12816, 9011, 12562, 12776, 20486,
+    17093, 28814, 9377, 4977, 5093, 12391, 28687, 17329, 5189, 28761, 6410, 12704, 12774, 12456, 16778, 12001,
+    28817, 17378, 28719, 9407, 9676, 20484, 4984, 12820, 8790, 12502, 12514, 28799, 12680, 10619, 28756, 9219,
+    10198, 20483, 12910, 28785, 11475, 5814, 28782, 16667, 8480, 10435, 10399, 12682, 13170, 28792, 12713, 5368,
+    16505, 11750, 11224, 12918, 32923, 28684, 12442, 9844, 12365, 28706, 32840, 28688, 16688, 4612, 32896, 10407,
+    11304, 32934, 12873, 28722, 28743, 8702, 12329, 32838, 32820, 12947, 12968, 11544, 28770, 12343, 16980, 12335,
+    12837, 9599, 17111, 28782, 12800, 17252, 12859, 5098, 16588, 17375, 10730, 28770, 12491, 10458, 10883, 32776,
+    12751, 32916, 12404, 32789, 17003, 13164, 28674, 12395, 4467, 12754, 11769, 12323, 10947, 16530, 28786, 12527,
+    10705, 13205, 13195, 16887, 28726, 32780, 16777, 8720, 28712, 32822, 20485, 32854, 12922, 28730, 28711, 12984,
+    11944, 12023, 13152, 9311, 12572, 12840, 8488, 17318, 32802, 4256, 13103, 28752, 28737, 12395, 10318, 12872,
+    28739, 12007, 28700, 12491, 9320, 11560, 8487, 16700, 12619, 28752, 10426, 9685, 28732, 6448, 9320, 8703,
+    11863, 32857, 12809, 9478, 8657, 9038, 16614, 11954, 20481, 12358, 12599, 28714, 28780, 28694, 28749, 16609,
+    32806, 11584, 20485, 11615, 32854, 13137, 32793, 10789, 12872, 28718, 9301, 12980, 4689, 28778, 32803, 10609,
+    10240, 12691, 13080, 17264, 12967, 20488, 28716, 12335, 28736, 12703, 9010, 28774, 13101, 13090, 6276, 12406,
+    17397, 32831, 11779, 10064, 13005, 28683, 28714, 32799, 8505, 28677, 17174, 16684, 5041, 16854, 12492, 12381,
+    16966, 28719, 10883, 28718, 28714, 16776, 28740, 9059, 11245, 13068, 28801, 32921, 12576, 12852, 12324, 17308,
+    5084, 17332, 8787, 12609, 12384, 16767, 10572, 28781, 12739, 28795, 12552, 12585, 8489, 12924, 28764, 12634,
+    28763, 12451, 12703, 12377, 12551, 32923, 9017, 9685, 32846, 16482, 11947, 32799, 12292, 13205, 28820, 28812,
+    32803, 4422, 12425, 12355, 10974, 12648, 11622, 32818, 12636, 16911, 12671, 6364, 12862, 28815, 12298, 28792,
+    17330, 32936, 28826, 32855, 5992, 12461, 32917, 12636, 28819, 5112, 28742, 11088, 28693, 12767, 8439, 28697,
+    12335, 12704, 8752, 10908, 10407, 12539, 17189, 32893, 6234, 12828, 11094, 11074, 11713, 17066, 17161, 32870,
+    9383, 8281, 16853, 32839, 12600, 10756, 5561, 9656, 9086, 17298, 11939, 28718, 28698, 12840, 12715, 32799,
+    16474, 8460, 13013, 10144, 12394, 5579, 12417, 9044, 12408, 9358, 20483, 9409, 12932, 12820, 16904, 12840,
+    28793, 9058, 8870, 28760, 12372, 12742, 20481, 28720, 13170, 8413, 12731, 32779, 12371, 13197, 9067, 12996,
+    32922, 12682, 6040, 11044, 16676, 13089, 13128, 28692, 9609, 8247, 9915, 28811, 12442, 12297, 12863, 32911,
+    11745, 13127, 13211, 12670, 12054, 5993, 16602, 28717, 12514, 17194, 20481, 12846, 11122, 12837, 28784, 17237,
+    28791, 28769, 11667, 13157, 5077, 12820, 32871, 12955, 17189, 16857, 17329, 11179, 9088, 8767, 5274, 8777,
+    6122, 28770, 11303, 10458, 11626, 9844, 10183, 10158, 12623, 9321, 10816, 11468, 28701, 10477, 16461, 5562,
+    13148, 11054, 10234, 16621, 4811, 11385, 11774, 5643, 10797, 17146, 16698, 9316, 9388, 12466, 6440, 12012,
+    13104, 12635, 32931, 16843, 9862, 28762, 5821, 12369, 28794, 12563, 13187, 11543, 5077, 11115, 12595, 9947,
+    13209, 13224, 9821, 6144, 28814, 32903, 13098, 8423, 12347, 32856, 11561, 28678, 9301, 28754, 16642, 11924,
+    16934, 32845, 17331, 10767, 8941, 28778, 28761, 28789, 12816, 28725, 17003, 28823, 28781, 28782, 12859, 9608,
+    11998, 16874, 12355, 5369, 13056, 9619, 10796, 12766, 28715, 12816, 12994, 28775, 9374, 16855, 12560, 11765,
+    9021, 9310, 17016, 8384, 8480, 11011, 6162, 32781, 28716, 32889, 32856, 13127, 16417, 16887, 9751, 9021,
+    16815, 10754, 9410, 12528, 8478, 11171, 32910, 8777, 28708, 8776, 16515, 9350, 17174, 13079, 17162, 16529,
+    11671, 9388, 28749, 9909, 9676, 13035, 32806, 11517, 12923, 9675, 8479, 32880, 28682, 10415, 12994, 32898,
+    28758, 9616, 28765, 28766, 10460, 17154, 10384, 8774, 17077, 13086, 9009, 16965, 12683, 12372, 13199, 28736,
+    11779, 28751, 12023, 8759, 28795, 11938, 10160, 28697, 12960, 12670, 8397, 8723, 28781, 8314, 12671, 28814,
+    32878, 13056, 12699, 32909, 12926, 28689, 28681, 10376, 12705, 11943, 12800, 32881, 28728, 32922, 8954, 5462,
+    28761, 16699, 9801, 16835, 16637, 28694, 28822, 28825, 12389, 11910, 12672, 6200, 28770, 20486, 10504, 12390,
+    28725, 10872, 11309, 28712, 12047, 12078, 12408, 9022, 11075, 28699, 28796, 28673, 9356, 28805, 32820, 12996,
+    28707, 28744, 8405, 12383, 28781, 16973, 11443, 13100, 10152, 12360, 12812, 12954, 28770, 12755, 12810, 12007,
+    12054, 32869, 28787, 12672, 32889, 28695, 28774, 11303, 32908, 10114, 10196, 11005, 12658, 28779, 28767, 12320,
+    9618, 28726, 12432, 28710, 9066, 16834, 12348, 9970, 12778, 28683, 17239, 11308, 32798, 32810, 32885, 32911,
+    11179, 28723, 17031, 6009, 17238, 20490, 32908, 9900, 12851, 28824, 12621, 12046, 28757, 28764, 16746, 5369,
+    13054, 16776, 12767, 8924, 9676, 13196, 12726, 10512, 12938, 4878, 13217, 28769, 13126, 28788, 32804, 16425,
+    9219, 8722, 8424, 9534, 28684, 12836, 28731, 28827, 12742, 32859, 32778, 32791, 9008, 32859, 11413, 32880,
+    9086, 12320, 12918, 12994, 12971, 17173, 28682, 28694, 12707, 16694, 6021, 28747, 6121, 28710, 28692, 11750,
+    28827, 28789, 12393, 12476, 5645, 5037, 12540, 6342, 28775, 6204, 16463, 6139, 32846, 10946, 10558, 13003,
+    20481, 28720, 8787, 28769, 28817, 8478, 12969, 12768, 32908, 16413, 12789, 28769, 9663, 12408, 32856, 16696,
+    12416, 28709, 17145, 8688, 28724, 16643, 12845, 28781, 8488, 12012, 12927, 16776, 12467, 8720, 16903, 12635,
+    28737, 8453, 12659, 28819, 28765, 12886, 12540, 10498, 17059, 12401, 10415, 11998, 28826, 9358, 28701, 12969,
+    10883, 12068, 13113, 32856, 10274, 10524, 12473, 12438, 10028, 9020, 13223, 28767, 28719, 12672, 11626, 11100,
+    12078, 11544, 17016, 32881, 8384, 12537, 12960, 9412, 10000, 12564, 16590, 28692, 28808, 13159, 12514, 9377,
+    13135, 13086, 12983, 12715, 11054, 16807, 28685, 16856, 5521, 10496, 5992, 16734, 11872, 16763, 9657, 11692,
+    12368, 9516, 13006, 11759, 17095, 9735, 32794, 12670, 28773, 28774, 12441, 9862, 8490, 12542, 28814, 12910,
+    16459, 11234, 9275, 12504, 28682, 17410, 17093, 12731, 12872, 28679, 11412, 28782, 6095, 16992, 9767, 17138,
+    13101, 9077, 11087, 28715, 16855, 10282, 5462, 9355, 32820, 11645, 4933, 32909, 12922, 8701, 12939, 12959,
+    12639, 17076, 12077, 11107, 28827, 13210, 12328, 17140, 32811, 12828, 9197, 16846, 17138, 12012, 32856, 17070,
+    13220, 8368, 12612, 12660, 28719, 12893, 9413, 12417, 12765, 16821, 28702, 10536, 9388, 28787, 28807, 28798,
+    13126, 5922, 6038, 11708, 12348, 28775, 9495, 28761, 28730, 16903, 12429, 12537, 12587, 12452, 11182, 17162,
+    17071, 12684, 13138, 6298, 5929, 12715, 12067, 12811, 8914, 8477, 28720, 32937, 28704, 28803, 16779, 13206,
+    11352, 11703, 12073, 13027, 12884, 13184, 32833, 28807, 32843, 17037, 10199, 13223, 32820, 28764, 11408, 20486,
+    6101, 10451, 28751, 12503, 28683, 16981, 10217, 13044, 5329, 12767, 28768, 17367, 12703, 28678, 8303, 32856,
+    28743, 9898, 16522, 28791, 28821, 12334, 11013, 12611, 12682, 4722, 32895, 28788, 17369, 11048, 8479, 28762,
+    12443, 11358, 5462, 9918, 12735, 11100, 13044, 10706, 12918, 17086, 32855, 12443, 13188, 9388, 32881, 12715,
+    12557, 8424, 17068, 9375, 12924, 11304, 9233, 12756, 13140, 28727, 13176, 8786, 11392, 9414, 12041, 17393,
+    13078, 12959, 13223, 17003, 16529, 6296, 20484, 12802, 17059, 16596, 13140, 16778, 12298, 10414, 28747, 16765,
+    20486, 17208, 11304, 17253, 12540, 28766, 12372, 32807, 17342, 12811, 8882, 17061, 16413, 32867, 28779, 28718,
+    12410, 28782, 9386, 12363, 16993, 12352, 12635, 10801, 13104, 17203, 5106, 12442, 32793, 10997, 8487, 12936,
+    12543, 12411, 5892, 12779, 11392, 12982, 12384, 12564, 16776, 28793, 13104, 8778, 11347, 12537, 11657, 28820,
+    12799, 12440, 28760, 32804, 8311, 12767, 12648, 10271, 9349, 28789, 8776, 32906, 12778, 11702, 9308, 13044,
+    12803, 28827, 28813, 16937, 32923, 12944, 16508, 12622, 28764, 12323, 28776, 28804, 28681, 12408, 5592, 32779,
+    16451, 28806, 17253, 28693, 28707, 11357, 32794, 16621, 12648, 16667, 20487, 32932, 12756, 11389, 16990, 28678,
+    13188, 16699, 12870, 12981, 10773, 9695, 6122, 9365, 28777, 28798, 32807, 11966, 17138, 12983, 6028, 10851,
+    12888, 17399, 12802, 16779, 17068, 9375, 13110, 12864, 28823, 10789, 20488, 11701, 10262, 28717, 9264, 10515,
+    12475, 32832, 13066, 12599, 9083, 28749, 32858, 12799, 28699, 12528, 11108, 28744, 17001, 17141, 28806, 12670,
+    5621, 12944, 28680, 5166, 10334, 13018, 12366, 12827, 12718, 16856, 9377, 11608, 8437, 12606, 12875, 12423,
+    12852, 6411, 16417, 5497, 12936, 17070, 28777, 16406, 32891, 28815, 12744, 12996, 28826, 32789, 12792, 16596,
+    10814, 28727, 5666, 32871, 11429, 12488, 16411, 11691, 28759, 12324, 9317, 17087, 5106, 12539, 9773, 32929,
+    8411, 13078, 28760, 10858, 28789, 8861, 12296, 9666, 17162, 16699, 32870, 20481, 12659, 28761, 32906, 9076,
+    11088, 10246, 17411, 6315, 11607, 12934, 12370, 9374, 28778, 9300, 5929, 32905, 12671, 17317, 28673, 28717,
+    12876, 17272, 12587, 11150, 12023, 28789, 28817, 32918, 32929, 12550, 10208, 28756, 32811, 20482, 16621, 12684,
+    17267, 32791, 5561, 9321, 28735, 12679, 28741, 12648, 8841, 12405, 11355, 12434, 9089, 28775, 8896, 28820,
+    17399, 16504, 11304, 10459, 28801, 9509, 12731, 12668, 11780, 8476, 28675, 28828, 16858, 16761, 28750, 32869,
+    12970, 11657, 10515, 28827, 8263, 28743, 6234, 16728, 4634, 11058, 10505, 28817, 9580, 11854, 12454, 28770,
+    16924, 10560, 28735, 12803, 17229, 28770, 17203, 10394, 12323, 12840, 28742, 9087, 32891, 6298, 16698, 11156,
+    32895, 28708, 5756, 28784, 13217, 13079, 17229, 17167, 10218, 9382, 28798, 13185, 32935, 28755, 32806, 11506,
+    13199, 12480, 16449, 13046, 13116, 28674, 11428, 32884, 13125, 28790, 12683, 13140, 17331, 32858, 28732, 11332,
+    28685, 32936, 6457, 9755, 10506, 9321, 32858, 17395, 17147, 16591, 32929, 17172, 6217, 10684, 12420, 13183,
+    12930, 4207, 28699, 17094, 28676, 12874, 32799, 9101, 8424, 12775, 12539, 28782, 11355, 17141, 17374, 28700,
+    12528, 12516, 28783, 10264, 17211, 28812, 28761, 12983, 28802, 32829, 12930, 12764, 28673, 11651, 8832, 12790,
+    32923, 13135, 13090, 5629, 11358, 9553, 28730, 32845, 17226, 28820, 32929, 28755, 28815, 20482, 16856, 13027,
+    9078, 8490, 13088, 10514, 32882, 11859, 32781, 32903, 8739, 28693, 11532, 32814, 28806, 5621, 11411, 10365,
+    8760, 13029, 13138, 28805, 12492, 28766, 28799, 32845, 5592, 12679, 28818, 12300, 28814, 9068, 16993, 9682,
+    13175, 13101, 9388, 11413, 13079, 11802, 12850, 13058, 10101, 17367, 6385, 12668, 17157, 6343, 8957, 12969,
+    17161, 28702, 12864, 16584, 10282, 28723, 9012, 12672, 17083, 6380, 5196, 28698, 4634, 28768, 13013, 28792,
+    28781, 12930, 28677, 12467, 12942, 16824, 16798, 17078, 28680, 32790, 28820, 12561, 16492, 28817, 11691, 10760,
+    28810, 9193, 17087, 8790, 28703, 17157, 13049, 32935, 12920, 11921, 32777, 9021, 5244, 10812, 16857, 11115,
+    6186, 28771, 12863, 17409, 16958, 12840, 10497, 13054, 16858, 11650, 12498, 4363, 32896, 28706, 8787, 10076,
+    16688, 16923, 32799, 12328, 8898, 12382, 12348, 17303, 32858, 20490, 8986, 28708, 11058, 17383, 28790, 28732,
+    32832, 28756, 12696, 9319, 28790, 28709, 28801, 12375, 20482, 28716, 32936, 32935, 12636, 28804, 9684, 5829,
+    13144, 28695, 13067, 32907, 12357, 13145, 16857, 9387, 28724, 6185, 11657, 32903, 8779, 32774, 10514, 12764,
+    28803, 13038, 11478, 13188, 32883, 32820, 6430, 8600, 28701, 16621, 13115, 12489, 28755, 9604, 12957, 13101,
+    28772, 28679, 5612, 32792, 16463, 32794, 28753, 16438, 12993, 8876, 13222, 11102, 12730, 17038, 13038, 6356,
+    10505, 9636, 28713, 12522, 32937, 11480, 11156, 17157, 9180, 9592, 11691, 11603, 12660, 9203, 28769, 10812,
+    8912, 20484, 11740, 12790, 5592, 8779, 28793, 4704, 32846, 16492, 28821, 28735, 28735, 28801, 10342, 28804,
+    28742, 10274, 9909, 5982, 13079, 5318, 12592, 11925, 10246, 11860, 12633, 28775, 12475, 11401, 8723, 17329,
+    4774, 28706, 32896, 8577, 28781, 8606, 28818, 28782, 28686, 32803, 4462, 8316, 12634, 17095, 9975, 12630,
+    17166, 11701, 28782, 17083, 6084, 12612, 12407, 10166, 10864, 12624, 28818, 6284, 10452, 32858, 32934, 28758,
+    9239, 28826, 12875, 17327, 12420, 12657, 11703, 17319, 16446, 11758, 12664, 32843, 16667, 16751, 28802, 28712,
+    13030, 12775, 32910, 9248, 8973, 5621, 12405, 9086, 5658, 16858, 12539, 8905, 13164, 8604, 9058, 12672,
+    28793, 10640, 9358, 12764, 32817, 28701, 12684, 28823, 10426, 32819, 4598, 12814, 28685, 16406, 28824, 28715,
+    12706, 16462, 11156, 28826, 28673, 28699, 28703, 28737, 10376, 28798, 32935, 9853, 4889, 11748, 12332, 11115,
+    12756, 28693, 9320, 28806, 11387, 17383, 12345, 16844, 28717, 11180, 13064, 10431, 8348, 28828, 17108, 16700,
+    20488, 32910, 32804, 10388, 9687, 12548, 16444, 16779, 6465, 11755, 28752, 17013, 32856, 13056, 28675, 28767,
+    11017, 17082, 12814, 12936, 9388, 28673, 32820, 28810, 5878, 17252, 5041, 17287, 12996, 4196, 28782, 5658,
+    13212, 16779, 28711, 12466, 28699, 12619, 28733, 16479, 28750, 16858, 10114, 32802, 8544, 12396, 12760, 12876,
+    28680, 9367, 12057, 9970, 8790, 16754, 28769, 12600, 28702, 4913, 8249, 32816, 28675, 10132, 13054, 16970,
+    28675, 12708, 28762, 12596, 6051, 10939, 6464, 28697, 32817, 12996, 13027, 11937, 28724, 10369, 9265, 9264,
+    10646, 9552, 17162, 28740, 12875, 16438, 9518, 13087, 12477, 16904, 9845, 28802, 13103, 11404, 13038, 10853,
+    20489, 11111, 12680, 12958, 28740, 28801, 20481, 12996, 11708, 28761, 28752, 11603, 6461, 12632, 32830, 10553,
+    28800, 12552, 28771, 28677, 10283, 16519, 20487, 9616, 13062, 13104, 6233, 28758, 32819, 20482, 17032, 32804,
+    9186, 28791, 20481, 12336, 20486, 32815, 9255, 13018, 12540, 17162, 28700, 10144, 12295, 11712, 13125, 6235,
+    20490, 9984, 28750, 28810, 11243, 28682, 12600, 4716, 28709, 28806, 28688, 13128, 32871, 10702, 12381, 16412,
+    17089, 9456, 28708, 6181, 12730, 16595, 28799, 12768, 12610, 13185, 10992, 12564, 12477, 32910, 9859, 12960,
+    5574, 11414, 28791, 12669, 12935, 12804, 28754, 16760, 13031, 32807, 8444, 17060, 28775, 28720, 32818, 11448,
+    6181, 9337, 12672, 11401, 10945, 20482, 13114, 10411, 28742, 12609, 28771, 12744, 32908, 28741, 12994, 28799,
+    28711, 28779, 32823, 12740, 12636, 13043, 16746, 28711, 28730, 12682, 12803, 10870, 11180, 11410, 28824, 28748,
+    28740, 10965, 12574, 28816, 10183, 8650, 12753, 9367, 10539, 11887, 10571, 12579, 13053, 12658, 12868, 9280,
+    13067, 11709, 10992, 8927, 9088, 12513, 28706, 12791, 11843, 16991, 9554, 11758, 12455, 12414, 12599, 32792,
+    13073, 16843, 32780, 28727, 13136, 32828, 12645, 28691, 32884, 16700, 32792, 5338, 9256, 32781, 12435, 13078,
+    4955, 17120, 28739, 28807, 11144, 10946, 12467, 11411, 28722, 12684, 28809, 9111, 10581, 28801, 17161, 11654,
+    13089, 16734, 28782, 12540, 13078, 28733, 20486, 28784, 13054, 17341, 28692, 16527, 16428, 28799, 28744, 12371,
+    12804, 12573, 17211, 13124, 13101, 11436, 9087, 13065, 16763, 11757, 13050, 13020, 12911, 4891, 8531, 16440,
+    8310, 17013, 12412, 10447, 8964, 28827, 28745, 28733, 11173, 17241, 9292, 16958, 17016, 16490, 11414, 11169,
+    9318, 13040, 5449, 13053, 11654, 28702, 9230, 10162, 16598, 10868, 32898, 12549, 28787, 6363, 11998, 12647,
+    12333, 16440, 13187, 28733, 5574, 9159, 28811, 5249, 16528, 12559, 28728, 28723, 9815, 13074, 9311, 10065,
+    6402, 16538, 13221, 9265, 13197, 8390, 12323, 16713, 28784, 12495, 6051, 28754, 12668, 28791, 28713, 16459,
+    17299, 13052, 9728, 28772, 28718, 12527, 12768, 12872, 13090, 32909, 6394, 32898, 12983, 4636, 17251, 20484,
+    13062, 5047, 12668, 10872, 12372, 28696, 12477, 5468, 32859, 32872, 28770, 12816, 12597, 20481, 13127, 16450,
+    32804, 12345, 12467, 28709, 11414, 12387, 32829, 28717, 12687, 4699, 28710, 12489, 16824, 10448, 13062, 12871,
+    6297, 5099, 12537, 13042, 28738, 12347, 32852, 12947, 6232, 28794, 28776, 17408, 32849, 28750, 12754, 6315,
+    6181, 12624, 28760, 32824, 16936, 13054, 10160, 13086, 28711, 12860, 28801, 28720, 16935, 9916, 17308, 6187,
+    13137, 12936, 12906, 12743, 11955, 8479, 9675, 16608, 13169, 28743, 28748, 16594, 12838, 12837, 8358, 12968,
+    28812, 9974, 11469, 32910, 17296, 9198, 28805, 12945, 16858, 12562, 8977, 28825, 17398, 28812, 16921, 12896,
+    12764, 28812, 28717, 10582, 16524, 12730, 16937, 16808, 9020, 12897, 13170, 11413, 8779, 12583, 9302, 32872,
+    13180, 32833, 12849, 12922, 11969, 16922, 17308, 17173, 16934, 10282, 11701, 16882, 17290, 28765, 13042, 28726,
+    13196, 20481, 11954, 9387, 20485, 12763, 12308, 16611, 10871, 12564, 11938, 8419, 12783, 12347, 8351, 32924,
+    28806, 12536, 16523, 9377, 11327, 12599, 12612, 13064, 28758, 12311, 12668, 5432, 12720, 12756, 9945, 12551,
+    28813, 12935, 8404, 16682, 12371, 10482, 20485, 12923, 28793, 32807, 16455, 13159, 12689, 9235, 32842, 8703,
+    8467, 16778, 16920, 9655, 12560, 28781, 11466, 20481, 12840, 12720, 12707, 32829, 32924, 12634, 32907, 16485,
+    13073, 12515, 11694, 9016, 12635, 17246, 17091, 10879, 17187, 6411, 9441, 28783, 10710, 28809, 10872, 9892,
+    12371, 12851, 13156, 10721, 8322, 9555, 12671, 12680, 28812, 13085, 9386, 13147, 11302, 12719, 9908, 9562,
+    13128, 12648, 16714, 13159, 6232, 32803, 9163, 28804, 32817, 32885, 28722, 12438, 9059, 12353, 11170, 12384,
+    6218, 12334, 8252, 28678, 32839, 12347, 17095, 28783, 4636, 16612, 20483, 28750, 10162, 28743, 28717, 10868,
+    12299, 28803, 13211, 10444, 28815, 28706, 13170, 6394, 28712, 28717, 28772, 16778, 11747, 8981, 13126, 16519,
+    17188, 12026, 12404, 28804, 16648, 12367, 12624, 13073, 12396, 12551, 28824, 10878, 11443, 28808, 32936, 28720,
+    16935, 17004, 16856, 9702, 16825, 28754, 17299, 12436, 8768, 10198, 12667, 12536, 17123, 9088, 28751, 28711,
+    28760, 11026, 9310, 9636, 13092, 12550, 12864, 28808, 11065, 28748, 11160, 8779, 6453, 10692, 8650, 5607,
+    17128, 17230, 17173, 12657, 32843, 28814, 8987, 11020, 10746, 28729, 28814, 13160, 16834, 12527, 9197, 12467,
+    8422, 12827, 12667, 6233, 12791, 6402, 12610, 12538, 5476, 17174, 11944, 12764, 17171, 12955, 28816, 13091,
+    28789, 5269, 32885, 28783, 28677, 11029, 12634, 10992, 8721, 8296, 12467, 12658, 16800, 12446, 5628, 13031,
+    8255, 16535, 12343, 32935, 4891, 28792, 4784, 9562, 12708, 28693, 28691, 8723, 20487, 8703, 28798, 12876,
+    6440, 8476, 28803, 28788, 20482, 28708, 9563, 5607, 11469, 12598, 16558, 28697, 9357, 28710, 12324, 16597,
+    28724, 28743, 6328, 11942, 12521, 16935, 8358, 12968, 28698, 12876, 9518, 32818, 16923, 13091, 16857, 32872,
+    32799, 12340, 16421, 12595, 16631, 12375, 16650, 8667, 12548, 6440, 9019, 6454, 6384, 32916, 28765, 32894,
+    10068, 12463, 28792, 28755, 32898, 5422, 12538, 28783, 28680, 12447, 12636, 28681, 5640, 8696, 16579, 10729,
+    28827, 17095, 28682, 16530, 32790, 17246, 10992, 12688, 16560, 28675, 10554, 16756, 12455, 17001, 12430, 28713,
+    28726, 13000, 9600, 12560, 32832, 28824, 16856, 13199, 32921, 12562, 11029, 16772, 17014, 28727, 28826, 12754,
+    13197, 9350, 32911, 6357, 9302, 13114, 28689, 12825, 9382, 6328, 4700, 32895, 28727, 16688, 9555, 12707,
+    32910, 10108, 12358, 12883, 12897, 32823, 10528, 13188, 4157, 4407, 20484, 8667, 10882, 32819, 11735, 13210,
+    8759, 10434, 28692, 5651, 12383, 9796, 28707, 28700, 32837, 9955, 28754, 32918, 9388, 9321, 28739, 32936,
+    12048, 17331, 17320, 32933, 17394, 12068, 9555, 17150, 5922, 10533, 8450, 6440, 5498, 12861, 28813, 28795,
+    13111, 10506, 28820, 12849, 28763, 32854, 20490, 32882, 8269, 28795, 17111, 13188, 12730, 12714, 16458, 17320,
+    13221, 28704, 11748, 17095, 16618, 28751, 8468, 28682, 5986, 16450, 11481, 13008, 12875, 6394, 28731, 12693,
+    12811, 12539, 5093, 8640, 28714, 12432, 28752, 16959, 28771, 12791, 12732, 8790, 12418, 12859, 12751, 11291,
+    28742, 9772, 12052, 28706, 28717, 5274, 28825, 5857, 5478, 28755, 8452, 10234, 32924, 32817, 28778, 12574,
+    9181, 12454, 12526, 11990, 12563, 10341, 16983, 13188, 13092, 10378, 9600, 12972, 9367, 17309, 12969, 9654,
+    17174, 12822, 9388, 28689, 16675, 13185, 32805, 8342, 9947, 9601, 17343, 6457, 28811, 10238, 16700, 12466,
+    17252, 16923, 11774, 12714, 17343, 5579, 11764, 9318, 17061, 12875, 16461, 12850, 12980, 12429, 28815, 28727,
+    10730, 28785, 16518, 8765, 9953, 28703, 17081, 12749, 12992, 12768, 12647, 12933, 10115, 32832, 28811, 17050,
+    28691, 9320, 28711, 12872, 12551, 32923, 12383, 17174, 17320, 5276, 9019, 16753, 4523, 28817, 8414, 11573,
+    12874, 12634, 6119, 10444, 16667, 8423, 12418, 28811, 9310, 4623, 10343, 10444, 10459, 16675, 11385, 12561,
+    16620, 13152, 28728, 16616, 12912, 12516, 12659, 28811, 17003, 12443, 32819, 11601, 13042, 5478, 16944, 12948,
+    28775, 5076, 12934, 9860, 13195, 12635, 32793, 28768, 9374, 12967, 12382, 16518, 32820, 28802, 13115, 32893,
+    9365, 6447, 9956, 9033, 10742, 32891, 16857, 28718, 11910, 13197, 13200, 32823, 10742, 12958, 8218, 32856,
+    28783, 16761, 12509, 12982, 12852, 9609, 11596, 12538, 10747, 13184, 9975, 11476, 12525, 5432, 12330, 4404,
+    12993, 5498, 10415, 5833, 9563, 32921, 8852, 12753, 13181, 9580, 28802, 12660, 12657, 16688, 9051, 9745,
+    16722, 9028, 4229, 11010, 28753, 17189, 12586, 16777, 9656, 12717, 12562, 16755, 5927, 16534, 12586, 5475,
+    16420, 12729, 16751, 12995, 17051, 11040, 17061, 12629, 28688, 28751, 17290, 28724, 8620, 11779, 9319, 28690,
+    8816, 4931, 12890, 28721, 16519, 11601, 12450, 12720, 16517, 16880, 10852, 12504, 12994, 9657, 32825, 32876,
+    8571, 32922, 16983, 32813, 12801, 12835, 20481, 8769, 12648, 11075, 8225, 12646, 11902, 10152, 12873, 32799,
+    16631, 5657, 28760, 11978, 12371, 28814, 16755, 28818, 11041, 32777, 9263, 5836, 12559, 9129, 28707, 13193,
+    16743, 12731, 13031, 12297, 28812, 16619, 28774, 11481, 12861, 11670, 5993, 12539, 12715, 13196, 6457, 9010,
+    32916, 9366, 32793, 13139, 17189, 10264, 16618, 13182, 12876, 13019, 32829, 11341, 17374, 32876, 11780, 12838,
+    5579, 13115, 6310, 28732, 28811, 8267, 17330, 16832, 9067, 8424, 11373, 9121, 9021, 8650, 12833, 12996,
+    20481, 12486, 28740, 32788, 28694, 9859, 32791, 10019, 10563, 32817, 17140, 10904, 12513, 32878, 11435, 28680,
+    28733, 16686, 32936, 13103, 12366, 28698, 8554, 9446, 13043, 9896, 17062, 16755, 12752, 12935, 28743, 28720,
+    4625, 28771, 4984, 13102, 28735, 32876, 16492, 28750, 9174, 9808, 28691, 28681, 8404, 12681, 16835, 28750,
+    12526, 12297, 20490, 32818, 5368, 10584, 28766, 28750, 16695, 32910, 28756, 32936, 16846, 11386, 9309, 6044,
+    32936, 28747, 28717, 17004, 12296, 12497, 28800, 13205, 12754, 12360, 12002, 32923, 28765, 9287, 12984, 13171,
+    12811, 28826, 12563, 12905, 10976, 12431, 12870, 12838, 13211, 28773, 12454, 9021, 12884, 11908, 28735, 11344,
+    8658, 13198, 12439, 13089, 12345, 9234, 16541, 10450, 11358, 32804, 9201, 28772, 32934, 32924, 12917, 11373,
+    12896, 28824, 16820, 8479, 10815, 8402, 12012, 10557, 16492, 12587, 10115, 12744, 20487, 28772, 8285, 28784,
+    32791, 12822, 28701, 12732, 32872, 9265, 20483, 12670, 5489, 32875, 11939, 10413, 28694, 12934, 8526, 17217,
+    6179, 10573, 20490, 12918, 5077, 28783, 12539, 16825, 13185, 12820, 32857, 16438, 11999, 17066, 13065, 9178,
+    13056, 5674, 32909, 28817, 28714, 28785, 13188, 16857, 8468, 9564, 6457, 9381, 16593, 12945, 32794, 8825,
+    11340, 10751, 6204, 12720, 11602, 11345, 12441, 28784, 12740, 17045, 11873, 12552, 28807, 9301, 12054, 5644,
+    12442, 12453, 28679, 16700, 9280, 12715, 10713, 28743, 13222, 32824, 12503, 9337, 8816, 13164, 8414, 13212,
+    5077, 32889, 12311, 28780, 28735, 28782, 5495, 20489, 32937, 12646, 13152, 28812, 12634, 12672, 12552, 12765,
+    13173, 28772, 5608, 16609, 10403, 16542, 12981, 12443, 9655, 9319, 20483, 32883, 11578, 28733, 28807, 6448,
+    12970, 10822, 17173, 12298, 8317, 20490, 12909, 16856, 9897, 12406, 6179, 16835, 28761, 9664, 12442, 13182,
+    13056, 28790, 11953, 32805, 12867, 9609, 10812, 16450, 11168, 8359, 10496, 28816, 13197, 12992, 32855, 12636,
+    11543, 28755, 28818, 12851, 28680, 12933, 12979, 12822, 32837, 28743, 11050, 16891, 28813, 11909, 12319, 12968,
+    13104, 10131, 28826, 16620, 28811, 28795, 28734, 5490, 32869, 28695, 28706, 16566, 16609, 8769, 8491, 9665,
+    28693, 17206, 32858, 12587, 28781, 12996, 8779, 11999, 16419, 12811, 17131, 11372, 28769, 8790, 28777, 28793,
+    16492, 11710, 10750, 12920, 20488, 12920, 17136, 10371, 16937, 11991, 5623, 12466, 28820, 12455, 17065, 13028,
+    17145, 9141, 5624, 17160, 11627, 12822, 11352, 28746, 12926, 11953, 28731, 10815, 5818, 32896, 16735, 8993,
+    12918, 32924, 12873, 11991, 17253, 12934, 28794, 10150, 20486, 8477, 12076, 28773, 28699, 12837, 17332, 32937,
+    28780, 17095, 9683, 12994, 28768, 12540, 28810, 20489, 17161, 12994, 11111, 9298, 8487, 28817, 12948, 12708,
+    17083, 9618, 9384, 11131, 9854, 12347, 6314, 5369, 28781, 12945, 12969, 17150, 16761, 9068, 10414, 12576,
+    8488, 13065, 9858, 12933, 5620, 9126, 12063, 32922, 12564, 6379, 11093, 4721, 16609, 12417, 12971, 28790,
+    13080, 32929, 8788, 10583, 9665, 6343, 8295, 12799, 5625, 8839, 32923, 13115, 28742, 13195, 12923, 16825,
+    11052, 12058, 11589, 11355, 13127, 16525, 8423, 32931, 32820, 8838, 11384, 13055, 9059, 17325, 28804, 17059,
+    13054, 28684, 11053, 28761, 28805, 6029, 9077, 12041, 16912, 32891, 12811, 9265, 12336, 10801, 12657, 17076,
+    20486, 10757, 13162, 32858, 13080, 9564, 12047, 6315, 16937, 16681, 6376, 9610, 17082, 32896, 11672, 28790,
+    10271, 8789, 12693, 32825, 16530, 32820, 9115, 13007, 32870, 9066, 32937, 32898, 12420, 11386, 28695, 12586,
+    16650, 8255, 12547, 28756, 28708, 12995, 8490, 10536, 11042, 28812, 28800, 16993, 12586, 16857, 12899, 28827,
+    11105, 28693, 12823, 12564, 5592, 28731, 12324, 28769, 12624, 12814, 17081, 12647, 9657, 17138, 13127, 28790,
+    13151, 11346, 28743, 17062, 10443, 17068, 11058, 17330, 28701, 6036, 28812, 10364, 28818, 17398, 17083, 10535,
+    28801, 28807, 28768, 11346, 32894, 13041, 16442, 28704, 16987, 20489, 13128, 12474, 12498, 28716, 32825, 17217,
+    28752, 12981, 11310, 32774, 10101, 13050, 32803, 10658, 12432, 12814, 28816, 9077, 28823, 13209, 20489, 12731,
+    32781, 17155, 28783, 11100, 11640, 8305, 20488, 17248, 13128, 10809, 10740, 0, 12768, 20487, 12557, 28691,
+    28690, 32858, 28718, 28805, 32816, 12384, 12526, 12561, 11088, 0, 32857, 9981, 17082, 12972, 17083, 11341,
+    12419, 5738, 6427, 12480, 12981, 28812, 28749, 12995, 32856, 12041, 12420, 9075, 28753, 28763, 16857, 32911,
+    5462, 17004, 10871, 28796, 10161, 13088, 13185, 8779, 13056, 13211, 6139, 11098, 11105, 12576, 16699, 28782,
+    12528, 17366, 17071, 12467, 0, 9896, 8667, 17225, 28764, 10755, 32929, 9068, 28744, 17208, 32884, 9202,
+    32897, 17230, 11115, 13080, 20489, 8444, 12491, 32872, 8786, 12011, 12827, 16937, 11355, 12468, 28783, 16767,
+    13217, 32804, 4584, 28789, 9022, 32869, 10812, 13161, 28738, 6205, 32880, 10957, 32934, 28757, 10832, 32908,
+    8759, 13223, 16767, 12431, 28680, 13004, 32897, 9078, 12958, 13037, 16777, 28784, 28681, 12717, 28787, 9386,
+    11275, 12431, 12941, 32924, 13149, 17161, 28719, 12501, 32868, 16774, 12929, 12912, 28713, 11266, 9377, 10816,
+    17161, 12803, 28771, 13123, 5658, 32898, 16450, 9385, 16485, 10546, 4949, 28744, 5663, 16699, 6122, 13224,
+    17010, 16643, 8723, 8843, 32935, 12969, 17072, 17003, 17010, 12971, 8769, 32934, 13040, 0, 12815, 6021,
+    13223, 12930, 32929, 17211, 12623, 17000, 13123, 32807, 9630, 8757, 13113, 32825, 28808, 17145, 12516, 9160,
+    12389, 17406, 9320, 12825, 5626, 12927, 13065, 12624, 12539, 10805, 10844, 9238, 28790, 28806, 12958, 12888,
+    32863, 16902, 12073, 10803, 12668, 9575, 10849, 32908, 28827, 12074, 13006, 9985, 11392, 11644, 12886, 28778,
+    16992, 32792, 9665, 10348, 20485, 32845, 17241, 12852, 28781, 13078, 28761, 13210, 11171, 11477, 16824, 12576,
+    13210, 28788, 10674, 11429, 10191, 28779, 17377, 5369, 10537, 16903, 16846, 28687, 12588, 28775, 12525, 11395,
+    8723, 12996, 10234, 10149, 9003, 6152, 12516, 12336, 12426, 12372, 8897, 12548, 16846, 12078, 12359, 5875,
+    32828, 17071, 8769, 28828, 28771, 32909, 8752, 28751, 11392, 12501, 17151, 16846, 11169, 12986, 17220, 9947,
+    10844, 12389, 28740, 16855, 13084, 12942, 32774, 10199, 16700, 10832, 28722, 10254, 17267, 9701, 8621, 12332,
+    28714, 12473, 13041, 10208, 16776, 13152, 12441, 13038, 28682, 17383, 32904, 12635, 17076, 13029, 10759, 12490,
+    28821, 28816, 12660, 28707, 12401, 12494, 9077, 17157, 9610, 12434, 11688, 17083, 12058, 12451, 28800, 10812,
+    11574, 12732, 12588, 16936, 17266, 9610, 12401, 12516, 12521, 6218, 9311, 12435, 13223, 12983, 12825, 32859,
+    12478, 28702, 12875, 16858, 16742, 20486, 10973, 8490, 6426, 13020, 9087, 5825, 32923, 13217, 16699, 12958,
+    20488, 28745, 13103, 9961, 9947, 12463, 17318, 28708, 28692, 28732, 12336, 12068, 28788, 16779, 28701, 11690,
+    28700, 17374, 8779, 28758, 17241, 32779, 8277, 12920, 12344, 12583, 17240, 32868, 28759, 28743, 28723, 11608,
+    5929, 13013, 12075, 12312, 28759, 12502, 12596, 16993, 17320, 32884, 10583, 12728, 12755, 17121, 9839, 10552,
+    28684, 32820, 12417, 12631, 11640, 10739, 8789, 10871, 20486, 16983, 32885, 16685, 12731, 12667, 28704, 17157,
+    16767, 28763, 28807, 12780, 28678, 17393, 12756, 12548, 12443, 32924, 12525, 9441, 8721, 28744, 0, 11115,
+    12444, 16778, 12947, 28696, 17241, 28743, 17399, 28759, 32910, 32818, 9674, 12970, 8768, 6220, 5929, 32858,
+    17409, 28677, 32894, 9336, 13100, 12538, 32814, 12332, 16632, 12387, 13126, 32859, 32932, 11387, 16699, 20487,
+    12647, 28679, 12393, 28819, 28736, 12476, 8935, 32778, 13089, 12655, 12321, 32896, 12539, 28743, 11889, 5658,
+    16587, 32833, 4693, 9367, 5730, 12525, 12336, 12455, 12528, 12364, 8778, 28710, 28755, 32872, 11900, 28778,
+    32910, 12467, 6022, 16575, 9815, 6380, 12669, 12824, 17240, 11114, 17375, 12311, 32934, 13005, 17281, 6410,
+    32817, 17230, 12465, 28821, 9011, 28744, 16598, 10945, 0, 11038, 16614, 11170, 17160, 13090, 32903, 11358,
+    28826, 16914, 13138, 6222, 32924, 8620, 10963, 12921, 12648, 32831, 12671, 8424, 17387, 6380, 32871, 32818,
+    17410, 9089, 28799, 17241, 10562, 28826, 20490, 28707, 13200, 9682, 11640, 12921, 11645, 13044, 17241, 12321,
+    12875, 12772, 12790, 13139, 28787, 11387, 28820, 10856, 12732, 28821, 12370, 28722, 12812, 17060, 12412, 28772,
+    13100, 16621, 32812, 11414, 12376, 32831, 13221, 16537, 20483, 32885, 4884, 11749, 10435, 12049, 11414, 11657,
+    32807, 8450, 9687, 28749, 28807, 32859, 16880, 12406, 9068, 28712, 9961, 8820, 8948, 17268, 4947, 9852,
+    28689, 9555, 9369, 12946, 12413, 13067, 8358, 13078, 11640, 28818, 28784, 12401, 5557, 11144, 9984, 13055,
+    32774, 6425, 16729, 28821, 8351, 28688, 12732, 32934, 10816, 12828, 28765, 16621, 28808, 10730, 12322, 10233,
+    5570, 32896, 13223, 12704, 12581, 10815, 32792, 12972, 28708, 28710, 16621, 13139, 28721, 12394, 13079, 28722,
+    11708, 12335, 8831, 13175, 11937, 17375, 16700, 17235, 6186, 10271, 11713, 12033, 32924, 12382, 28806, 11766,
+    6408, 20482, 16500, 13079, 28673, 11713, 13031, 17229, 11691, 11170, 28781, 8628, 17085, 8966, 12012, 11395,
+    11442, 17139, 28734, 12312, 6228, 28787, 16856, 11403, 12420, 28678, 32929, 32872, 4212, 10515, 17029, 32790,
+    28723, 10517, 8899, 16801, 11447, 20488, 9502, 16823, 12426, 28825, 28700, 13061, 32924, 28750, 28712, 32776,
+    28784, 28818, 11603, 12436, 28749, 12600, 13088, 9088, 28819, 16429, 12827, 32827, 12555, 28820, 28813, 32932,
+    12455, 13067, 10845, 9383, 11686, 9599, 13208, 17171, 16400, 11170, 12341, 17361, 20481, 13176, 28709, 9166,
+    12320, 11029, 0, 11646, 13055, 16662, 8617, 28767, 9561, 13079, 10348, 16450, 11727, 28723, 13224, 32922,
+    17082, 10260, 6022, 0, 12488, 17172, 6361, 32885, 13054, 28760, 16857, 12380, 13073, 17062, 13046, 28754,
+    28816, 32937, 10505, 12871, 12893, 11448, 13078, 12907, 17367, 13056, 12523, 10569, 28675, 12859, 9964, 28767,
+    28676, 5427, 20489, 28776, 13113, 28805, 11611, 13006, 12878, 13152, 16585, 12667, 32791, 10569, 28827, 10112,
+    11749, 10581, 32921, 9666, 28779, 28690, 9088, 20483, 12803, 28791, 11171, 9087, 28825, 10570, 4781, 12598,
+    12864, 13055, 8789, 10803, 32884, 13008, 12936, 16596, 12372, 12515, 8584, 8982, 4953, 11167, 28820, 28718,
+    8490, 16830, 28689, 11448, 12657, 8349, 11144, 12346, 12539, 32806, 9284, 8995, 13080, 28715, 13079, 16406,
+    13102, 13169, 28812, 12779, 5900, 16656, 9917, 12947, 28728, 12383, 0, 12795, 4715, 28697, 16909, 28734,
+    28697, 12668, 8332, 17089, 17161, 16825, 28772, 5212, 13195, 8696, 17393, 28691, 12371, 12405, 12756, 11451,
+    28808, 6223, 28679, 17295, 13112, 8216, 17008, 28687, 12633, 12994, 12359, 9846, 28756, 28813, 10514, 12583,
+    16825, 11449, 12888, 5064, 11481, 32909, 13143, 12816, 32859, 28809, 10437, 17397, 6411, 12996, 28687, 12371,
+    12419, 28712, 12450, 8696, 20488, 28699, 28759, 16825, 12740, 28715, 12551, 6051, 12672, 12345, 12576, 9265,
+    8422, 17406, 12728, 13136, 13041, 13099, 12935, 17157, 28817, 12515, 16683, 32788, 5418, 6218, 16687, 28806,
+    12028, 16858, 12936, 32910, 8412, 12419, 12657, 32829, 12700, 28806, 28764, 12912, 6224, 5421, 28740, 9446,
+    13040, 12876, 10263, 28805, 28749, 11925, 9890, 17399, 11860, 28736, 10429, 20486, 28720, 10583, 28820, 12012,
+    17092, 0, 12876, 9451, 6047, 11465, 10579, 10857, 12900, 13041, 16577, 9599, 28767, 28771, 9264, 11470,
+    32776, 13224, 13186, 12780, 13125, 12598, 32806, 5421, 12356, 9517, 28791, 32804, 17105, 16779, 32904, 9174,
+    12780, 6181, 8358, 28704, 12489, 32857, 8301, 11926, 13116, 0, 11403, 17016, 12550, 16812, 28717, 12394,
+    0, 16937, 13044, 8581, 11843, 13053, 28780, 17250, 6226, 28771, 10872, 13004, 28808, 28730, 13138, 28816,
+    12768, 16641, 12324, 12744, 28719, 12393, 17282, 10281, 12843, 12645, 28713, 12948, 17409, 10882, 5057, 4699,
+    28788, 32871, 16428, 12307, 10647, 28793, 32852, 32780, 5894, 10281, 28783, 5578, 11843, 28804, 16858, 12322,
+    6408, 28685, 10720, 12730, 8790, 6150, 28689, 11738, 12996, 28734, 12564, 12527, 11480, 11387, 9562, 32791,
+    28684, 17319, 11035, 32777, 12776, 12657, 16961, 9388, 4724, 9767, 11713, 17166, 9088, 9294, 32922, 10880,
+    4888, 12753, 32924, 20490, 9377, 12334, 12660, 13073, 11657, 10072, 28699, 8744, 12390, 16656, 28760, 12395,
+    17404, 16880, 32799, 9400, 8767, 9554, 12323, 32883, 10138, 32884, 6445, 16528, 9676, 28734, 8667, 16538,
+    28734, 16594, 12438, 12691, 0, 11992, 16816, 11779, 17240, 28808, 13198, 6232, 4889, 10563, 28805, 5640,
+    9248, 10583, 9089, 12729, 16765, 16833, 13026, 28716, 12441, 12911, 13111, 12562, 12320, 28782, 6399, 12323,
+    32818, 16524, 12671, 11873, 28757, 12646, 8899, 12537, 28828, 12356, 16858, 17409, 10584, 28694, 12306, 28776,
+    12346, 28741, 17315, 17252, 32871, 16767, 12899, 28677, 32851, 10442, 17014, 28679, 16845, 16899, 17093, 11330,
+    12921, 28827, 16598, 12655, 28794, 28812, 8986, 17016, 12335, 12632, 17399, 28803, 17239, 28723, 0, 9879,
+    12753, 12689, 5137, 9905, 12513, 12535, 28719, 16608, 32791, 20489, 16825, 28778, 10861, 10258, 12369, 28695,
+    28754, 32872, 16823, 8301, 16755, 12345, 11741, 32922, 28754, 10400, 12367, 28767, 28700, 8995, 10862, 9264,
+    17314, 9808, 32841, 32818, 28752, 9388, 13159, 0, 28758, 12657, 28742, 10159, 32922, 28720, 16746, 13055,
+    12852, 12527, 32859, 12300, 32923, 12775, 28828, 13018, 16925, 8217, 12310, 12353, 28720, 32788, 28713, 12779,
+    17342, 13169, 9385, 28744, 12646, 10143, 11373, 28821, 28681, 28733, 10647, 10368, 12862, 11746, 13066, 28687,
+    11936, 17007, 12826, 8366, 12599, 10571, 28716, 13211, 11480, 13150, 20490, 17395, 5273, 13029, 8421, 32921,
+    17406, 8703, 12610, 11171, 9863, 12741, 5482, 13068, 28674, 6328, 32922, 32830, 32922, 10968, 12895, 10431,
+    12516, 9600, 28769, 10840, 12730, 12785, 12576, 9555, 9010, 9578, 13041, 32851, 5092, 28813, 17170, 9914,
+    9310, 0, 32922, 13210, 32792, 11843, 16834, 32793, 12671, 28720, 6318, 13194, 13150, 16854, 28807, 28732,
+    12012, 11244, 13221, 8351, 32893, 28752, 28802, 28755, 12535, 5431, 28695, 32780, 12696, 28783, 16858, 10261,
+    11262, 12647, 12743, 12540, 12379, 12658, 12979, 0, 5449, 9919, 11971, 6440, 9059, 12496, 10878, 28712,
+    8957, 9562, 11585, 32827, 9037, 32841, 12580, 28761, 12742, 13089, 6446, 13079, 6174, 12981, 16608, 17251,
+    13144, 20490, 5674, 13039, 10079, 12403, 12751, 12536, 11905, 32864, 12439, 28684, 28760, 13116, 16884, 13056,
+    12372, 9984, 0, 10729, 32790, 28709, 11480, 8516, 6457, 12702, 12526, 12815, 12960, 12860, 16683, 11470,
+    13116, 8667, 13077, 28688, 32838, 16914, 10991, 28758, 28720, 32845, 28687, 28745, 28796, 6235, 12970, 28684,
+    11316, 13056, 32842, 11181, 12874, 16921, 4449, 28737, 4556, 32832, 16959, 12599, 12767, 32820, 13091, 13116,
+    13030, 12465, 16835, 12308, 12814, 17031, 11984, 12311, 9002, 28770, 8657, 10406, 11709, 12732, 9388, 28759,
+    12792, 28704, 16843, 6440, 28681, 13145, 10202, 11647, 12563, 12754, 11748, 28735, 10648, 13018, 10396, 16937,
+    28685, 12549, 28782, 32833, 32806, 5224, 13114, 32788, 13223, 28784, 10537, 13068, 17230, 28730, 12624, 28775,
+    28689, 28716, 17309, 16460, 32911, 28703, 32922, 9059, 17378, 12599, 28744, 8414, 28742, 9954, 16538, 28813,
+    17250, 16974, 12848, 13068, 8460, 28767, 5339, 11028, 13187, 12802, 0, 13056, 28815, 13056, 10399, 32916,
+    10758, 5636, 12633, 12384, 17368, 28722, 10882, 12695, 9702, 13008, 16903, 10832, 9033, 12849, 32883, 17308,
+    28720, 32780, 12780, 9388, 16541, 13103, 12814, 5469, 28730, 16526, 28774, 9311, 11780, 10114, 16460, 10461,
+    28747, 28824, 12776, 16437, 13151, 11475, 11907, 13159, 28744, 10991, 13127, 9665, 32898, 28758, 28822, 28753,
+    16446, 11780, 16775, 28714, 12318, 28705, 28812, 8347, 32781, 12972, 12753, 9068, 28800, 9709, 28747, 5273,
+    32937, 28792, 12744, 17298, 12948, 12414, 12370, 13212, 12948, 9540, 28757, 12616, 12719, 10433, 16755, 12705,
+    12605, 11470, 11989, 28693, 16765, 28821, 11028, 12863, 16754, 9618, 12538, 28755, 28744, 17037, 8372, 0,
+    9256, 12951, 13102, 28814, 13068, 28782, 12935, 13182, 16761, 28724, 16959, 16515, 12815, 28754, 8870, 13068,
+    8720, 12587, 28682, 11262, 17148, 16413, 17111, 12744, 12911, 8656, 17317, 16598, 32780, 28780, 28692, 11131,
+    12876, 28716, 16765, 28680, 12647, 28805, 17282, 11780, 16835, 28696, 12899, 0, 10648, 5047, 12789, 12873,
+    16676, 16923, 32780, 5432, 9302, 12756, 12574, 9320, 28726, 10670, 28735, 12680, 12984, 28725, 32930, 12982,
+    11151, 28761, 28716, 28748, 16440, 11468, 12355, 10507, 28709, 28730, 8600, 9075, 12406, 32815, 9900, 28797,
+    6411, 28755, 28692, 13004, 9971, 32792, 16846, 28822, 9372, 8966, 12629, 13170, 13187, 9263, 10399, 28783,
+    9780, 5432, 28796, 28724, 28755, 13089, 32854, 10730, 8620, 4387, 28786, 13171, 28792, 12600, 12077, 32799,
+    12364, 16695, 11326, 16756, 13187, 9075, 13186, 11907, 28826, 12852, 5898, 13194, 28725, 0, 12766, 16885,
+    13139, 11990, 0, 12619, 13176, 9347, 12968, 13211, 16561, 5916, 9003, 12790, 28754, 10698, 13175, 12669,
+    28796, 12437, 12883, 17079, 11581, 13199, 28717, 12731, 12510, 12775, 32780, 28697, 12607, 17320, 12495, 4173,
+    8434, 13079, 12360, 8667, 10127, 17318, 13170, 12414, 12413, 13128, 13199, 11993, 11245, 28728, 16966, 5562,
+    13103, 28761, 12548, 11902, 28772, 16806, 8767, 9010, 28709, 28742, 16479, 28734, 13175, 32865, 20486, 11991,
+    28727, 9843, 12873, 16667, 16962, 16436, 0, 28791, 10539, 12741, 0, 32829, 12348, 10648, 10902, 28712,
+    28695, 12837, 10369, 28699, 8878, 28673, 16406, 20481, 32794, 11747, 12312, 11998, 17174, 9367, 8488, 10676,
+    16793, 10668, 5583, 28711, 10883, 13187, 12698, 12516, 28792, 5477, 9914, 12537, 8368, 9510, 16694, 17268,
+    13187, 17253, 13172, 6465, 13185, 12982, 28802, 10676, 10079, 20486, 11945, 32911, 8306, 12791, 28750, 12585,
+    13199, 11291, 12884, 17032, 16854, 8423, 16527, 8995, 10530, 28817, 12333, 13031, 10115, 28706, 28691, 12334,
+    8609, 28760, 9561, 8424, 28702, 28739, 28739, 28714, 28752, 12935, 12767, 32792, 13115, 16509, 9239, 4209,
+    5339, 28729, 28737, 16618, 9509, 28693, 28750, 13198, 8367, 16979, 9293, 12875, 9665, 32802, 9440, 11902,
+    32799, 12376, 28752, 9620, 28736, 16446, 12888, 12635, 6456, 28675, 28715, 16609, 16846, 0, 11908, 8461,
+    4977, 10947, 12539, 32842, 28750, 32911, 28774, 12575, 12635, 12956, 32820, 10704, 4410, 28785, 28820, 32866,
+    13140, 20485, 28734, 12308, 16564, 28728, 6067, 12798, 12596, 13199, 0, 16667, 12582, 12551, 12049, 16421,
+    12714, 12799, 12654, 20482, 16451, 12703, 12808, 28756, 11779, 6314, 9310, 13102, 8468, 9068, 32807, 12300,
+    8225, 11668, 12046, 11871, 12788, 32812, 20482, 16595, 10776, 28677, 12078, 6440, 11380, 32777, 28741, 8411,
+    12822, 13075, 9191, 12432, 13198, 8489, 10706, 12741, 12711, 17162, 13055, 32779, 16966, 28716, 5832, 16700,
+    32921, 32898, 13126, 17148, 5098, 32846, 28802, 28825, 9609, 12958, 13078, 12931, 28703, 12753, 12359, 10205,
+    32844, 11758, 0, 12862, 16542, 9309, 12483, 12513, 12708, 28693, 12935, 11072, 6026, 28678, 13151, 12414,
+    12369, 9555, 28820, 17368, 16592, 9555, 32874, 12357, 28716, 11953, 5834, 8955, 11074, 12911, 12911, 12861,
+    10411, 11291, 28828, 32885, 16825, 11009, 28706, 6117, 9088, 10533, 28761, 28722, 32882, 28715, 12436, 12047,
+    8367, 12714, 32781, 12491, 12810, 11713, 12750, 12632, 4983, 12799, 12899, 8777, 13150, 13080, 9340, 10781,
+    17326, 12646, 10454, 12657, 10274, 16855, 8367, 13116, 16462, 28717, 16753, 11556, 11075, 12468, 13164, 28705,
+    12431, 10253, 11481, 11596, 32891, 12720, 9076, 8664, 17297, 32924, 11479, 5529, 12807, 8453, 28680, 5455,
+    28763, 16514, 28824, 9555, 13030, 28733, 11588, 28753, 28779, 5099, 32805, 8647, 12935, 20481, 12407, 12840,
+    32818, 12968, 17079, 8988, 12656, 28804, 12474, 12778, 13092, 5110, 8656, 5362, 32875, 9366, 12947, 0,
+    9510, 28759, 5238, 20490, 32936, 10711, 12934, 13127, 32923, 16989, 28756, 12476, 5104, 4868, 11990, 32800,
+    8213, 13088, 10216, 12646, 16616, 28754, 16937, 10450, 12312, 28691, 17378, 5644, 12324, 28809, 12347, 4459,
+    28789, 5109, 10830, 10245, 6426, 32780, 28681, 0, 12416, 8357, 9078, 10976, 28820, 12347, 11304, 12611,
+    8621, 13198, 13054, 11080, 12623, 12742, 13092, 28783, 12078, 28709, 11467, 12317, 13205, 11310, 28742, 10747,
+    12612, 17399, 9965, 8282, 32854, 9089, 10757, 28809, 0, 11769, 16857, 9563, 17397, 32800, 16399, 12815,
+    16541, 11759, 12732, 0, 11413, 28754, 9306, 28794, 16586, 28718, 12917, 16508, 32877, 12861, 16756, 5104,
+    8218, 32781, 28710, 12776, 16609, 16542, 12586, 10781, 12993, 32898, 12850, 5111, 17172, 8936, 28675, 16933,
+    12819, 8453, 12897, 11041, 13200, 13066, 16857, 28806, 0, 28733, 28790, 8667, 0, 28792, 6139, 12297,
+    32936, 11339, 12917, 28706, 16684, 28727, 32896, 28723, 17347, 11327, 28705, 12012, 12755, 28822, 9059, 12467,
+    12899, 12874, 12703, 16903, 10479, 12875, 11129, 28714, 12047, 12064, 11895, 12995, 12379, 13210, 9617, 28811,
+    16767, 28741, 12464, 5358, 13205, 12659, 28793, 12742, 28813, 28722, 28826, 11624, 12448, 17253, 28777, 12870,
+    12609, 10831, 11756, 28828, 12452, 12714, 16999, 28698, 10204, 5368, 17147, 0, 28810, 16777, 32781, 6037,
+    12682, 12869, 12502, 12323, 10407, 28718, 0, 12372, 16686, 12995, 8768, 9038, 12898, 12898, 8722, 10490,
+    8722, 5111, 28692, 12624, 8940, 9908, 17320, 9376, 32937, 13211, 32831, 13067, 9011, 16998, 28752, 11561,
+    12858, 12984, 32870, 32887, 17360, 12955, 8941, 28761, 5899, 28752, 32884, 28768, 32820, 8769, 11871, 32778,
+    12980, 17161, 13163, 28817, 20486, 10713, 9686, 12300, 17329, 17083, 16596, 12993, 9884, 32880, 12300, 10787,
+    9012, 12407, 12838, 12714, 28793, 20489, 12799, 28768, 12671, 10711, 11470, 12311, 9374, 10191, 11589, 28744,
+    12636, 28803, 28804, 28680, 13188, 28794, 16858, 8847, 16570, 28812, 12041, 17196, 16542, 16966, 8790, 12983,
+    6134, 32896, 32896, 10198, 12587, 11130, 28825, 28816, 28760, 10490, 28739, 12002, 12392, 28708, 10860, 6371,
+    28792, 32777, 28821, 12442, 12778, 28757, 16973, 11308, 9299, 17078, 17360, 6166, 8695, 8883, 28793, 28793,
+    28787, 28675, 13100, 17346, 12484, 16932, 5563, 28754, 28705, 28815, 12970, 32911, 28701, 28718, 12680, 28765,
+    28794, 12852, 28753, 5562, 12946, 9618, 17094, 10711, 17045, 32871, 12372, 12695, 12527, 28753, 0, 13223,
+    8411, 12427, 28818, 12776, 32868, 8449, 10215, 5836, 12381, 16696, 12501, 11048, 0, 28710, 16427, 16946,
+    16687, 12824, 12515, 12850, 5619, 28676, 20483, 28796, 28774, 32898, 8488, 10115, 16776, 13128, 28770, 10490,
+    28760, 10882, 32827, 16846, 11130, 12418, 16775, 12731, 12540, 12078, 12012, 28801, 8722, 28741, 10215, 16844,
+    5405, 16982, 32869, 12741, 16845, 0, 8776, 20485, 12863, 8736, 32819, 0, 28716, 28795, 6296, 32828,
+    17083, 32884, 17169, 6350, 32800, 8512, 9086, 5869, 12516, 9321, 0, 16846, 12648, 32833, 12659, 12357,
+    12671, 28698, 12380, 12705, 12705, 17275, 0, 10806, 9067, 32838, 28791, 5992, 12936, 9376, 12332, 12343,
+    32800, 12293, 16650, 32903, 28825, 9964, 32866, 11843, 28824, 16688, 28808, 13216, 16588, 12763, 28745, 28723,
+    32853, 28814, 12991, 13104, 8491, 12851, 12408, 28765, 12308, 13111, 28795, 28759, 12982, 12384, 10255, 12992,
+    28801, 12731, 28715, 16540, 12370, 32893, 13121, 9068, 32800, 9108, 9487, 9365, 28741, 5591, 12671, 16832,
+    12876, 12983, 12550, 16742, 11647, 5624, 20484, 12714, 28746, 10513, 16845, 12612, 12827, 28771, 28703, 28707,
+    28812, 8397, 12862, 13111, 28825, 12403, 12348, 11999, 12751, 12525, 12599, 8234, 9879, 28719, 12441, 16688,
+    20487, 12811, 5452, 12910, 12297, 8688, 32924, 10789, 17410, 13210, 12367, 32908, 12526, 10816, 12876, 12512,
+    28684, 12407, 12755, 12744, 20487, 12598, 8461, 9610, 0, 16541, 28720, 17331, 17090, 13188, 9248, 32907,
+    17138, 6038, 12538, 13134, 32816, 12934, 9618, 8478, 28826, 12645, 6122, 11308, 9778, 0, 17388, 10882,
+    8917, 5656, 12822, 0, 12075, 28761, 11386, 28792, 12540, 16858, 12851, 28766, 32792, 12907, 11312, 12509,
+    9376, 10458, 10677, 16457, 28769, 12562, 12828, 32910, 11677, 16664, 13199, 12513, 28824, 32935, 5497, 10513,
+    17003, 9376, 28761, 4285, 10044, 28815, 8722, 12360, 12623, 17374, 28742, 28804, 9745, 12851, 12333, 20487,
+    10145, 10444, 12507, 28825, 17150, 16594, 8446, 28679, 12429, 13210, 0, 10176, 28693, 12876, 28825, 28702,
+    17332, 12606, 12514, 9075, 12982, 32800, 12329, 12765, 9618, 12861, 9828, 11088, 20490, 9860, 6387, 12427,
+    8634, 17162, 32805, 4821, 6410, 9386, 11609, 32876, 11386, 8976, 13221, 12720, 28701, 12992, 28768, 9854,
+    9663, 8490, 12670, 12681, 9468, 32799, 16710, 13091, 17360, 28685, 28819, 9365, 11521, 17308, 28724, 12077,
+    11676, 28707, 12720, 5663, 17057, 12669, 28786, 32789, 28820, 32895, 13135, 16439, 13205, 32800, 12341, 32934,
+    12777, 9686, 17002, 11640, 28676, 10797, 10976, 32911, 28781, 0, 16620, 28823, 12851, 11151, 5922, 4357,
+    32937, 12618, 12765, 28770, 28715, 12810, 9532, 32877, 9086, 12336, 12958, 13037, 32857, 12419, 16894, 12378,
+    0, 32936, 11626, 28760, 28769, 10496, 16699, 28826, 12861, 12464, 13101, 4984, 16835, 12929, 28808, 0,
+    28693, 12331, 28794, 17081, 28673, 28699, 16634, 16400, 28755, 13075, 10370, 10247, 28761, 28699, 11341, 12835,
+    16484, 28691, 13041, 28721, 13200, 10459, 12404, 12922, 12990, 4984, 6433, 16506, 28817, 11347, 32820, 32790,
+    28779, 10245, 28755, 12383, 28768, 13123, 12824, 16563, 28739, 32781, 28710, 13174, 12982, 11639, 28808, 5899,
+    10805, 10159, 28755, 16993, 12850, 10107, 12755, 12520, 12730, 28784, 12552, 28772, 8310, 20485, 12612, 28769,
+    10090, 9078, 13223, 12575, 11601, 5074, 10757, 13224, 10514, 12978, 9618, 12335, 4700, 32893, 9862, 12430,
+    9839, 28794, 12609, 9657, 10496, 10759, 28783, 8598, 11357, 12696, 28739, 9518, 12587, 9806, 17066, 16635,
+    12293, 12918, 17045, 8487, 16620, 11838, 28775, 12320, 11053, 16673, 9564, 28683, 28708, 28705, 16698, 28704,
+    9766, 12941, 9516, 11429, 17331, 10760, 5928, 0, 16571, 11851, 16530, 13224, 9265, 13092, 11682, 10848,
+    17297, 9673, 32820, 12897, 28705, 9012, 8404, 11639, 12739, 28789, 5658, 17411, 10546, 28750, 32889, 16748,
+    12079, 0, 16698, 5077, 13112, 5970, 12634, 28827, 9618, 6209, 28692, 6205, 28815, 32820, 5657, 8734,
+    11393, 8489, 32897, 32791, 11992, 32919, 16674, 32936, 32807, 5784, 32845, 11855, 28771, 28801, 12774, 12765,
+    20481, 8778, 11768, 12730, 10760, 11346, 11608, 16650, 5876, 11686, 20481, 10677, 10126, 10844, 13196, 28718,
+    28682, 28743, 28684, 32895, 12550, 28772, 12336, 0, 8722, 5928, 28721, 12756, 17366, 16997, 32937, 12882,
+    32891, 10849, 16436, 11404, 28698, 10552, 13211, 28742, 10757, 9842, 13116, 28754, 12958, 9665, 0, 16778,
+    9610, 28753, 11467, 4984, 12408, 12897, 28817, 8459, 12767, 17150, 28827, 6151, 13164, 28822, 10262, 12588,
+    13212, 10850, 10450, 11147, 20486, 11182, 32922, 28707, 28813, 17093, 12299, 6187, 17240, 10546, 28722, 0,
+    17217, 8249, 9019, 28772, 10859, 28705, 12756, 11413, 28744, 10973, 17143, 0, 28778, 16540, 13100, 8778,
+    16462, 12564, 6466, 5620, 13043, 11433, 5462, 28799, 12527, 12528, 28726, 12799, 16777, 6049, 12669, 8666,
+    17376, 12539, 6180, 32934, 10197, 12366, 13123, 12342, 6218, 17004, 12861, 5487, 5496, 12839, 10844, 12408,
+    12449, 11143, 5390, 32858, 28744, 28735, 16964, 28789, 28741, 6054, 17072, 10552, 28794, 0, 28805, 6216,
+    10568, 9900, 17068, 17159, 17151, 17208, 9265, 6204, 8704, 8778, 8778, 10814, 13031, 12838, 16752, 32857,
+    12719, 32804, 9491, 9388, 17399, 12296, 28827, 6215, 12701, 12744, 12912, 10800, 28801, 12822, 0, 17410,
+    12588, 17171, 32800, 16635, 28749, 11149, 20487, 10107, 17081, 16460, 0, 16779, 12814, 9373, 11842, 12671,
+    32857, 28728, 32858, 32855, 13212, 12692, 32856, 12659, 17168, 16903, 28763, 10404, 11059, 32882, 11657, 17211,
+    12504, 12465, 11161, 16700, 12609, 5073, 20486, 12996, 4800, 17074, 17151, 17378, 6348, 12874, 6344, 6056,
+    17208, 12418, 32870, 13043, 12489, 32866, 16537, 17399, 32833, 32854, 10568, 12730, 32856, 28810, 9074, 13042,
+    17331, 28770, 16542, 12598, 12957, 11713, 10799, 17248, 5626, 11413, 8367, 17240, 28826, 28786, 12876, 28805,
+    5106, 12429, 13138, 17275, 28811, 12885, 11056, 12864, 16617, 9952, 28727, 28678, 5626, 13147, 13065, 13161,
+    8480, 28753, 9385, 32884, 12635, 28741, 28788, 10706, 16542, 28746, 12487, 12744, 28783, 28812, 28781, 12971,
+    28827, 13126, 8987, 11439, 17066, 12600, 28805, 13056, 28677, 13037, 28791, 32807, 12022, 12984, 11855, 9607,
+    9564, 11328, 8470, 17220, 12537, 12468, 12996, 32889, 28725, 13079, 17230, 8491, 12619, 12368, 28764, 10754,
+    16936, 9182, 11096, 12478, 28821, 16912, 28679, 16937, 17388, 12811, 32819, 0, 12548, 13111, 12502, 32862,
+    28726, 17281, 13211, 28684, 17211, 10451, 0, 5626, 12862, 32884, 10513, 13145, 32896, 12715, 11443, 11967,
+    12646, 6298, 16650, 9684, 10553, 28754, 12948, 11351, 12690, 28825, 0, 12442, 20487, 28725, 12538, 32929,
+    17399, 10672, 17000, 11708, 28825, 12897, 12580, 16823, 12588, 10806, 32807, 16691, 12996, 12345, 17138, 28800,
+    16499, 6221, 6355, 9385, 12918, 17286, 17068, 17230, 17155, 28763, 17332, 17124, 17016, 28823, 12731, 32857,
+    10808, 12562, 8524, 16700, 12594, 28772, 12309, 17409, 11054, 5178, 6354, 12413, 10281, 32924, 28678, 12864,
+    13186, 12416, 12419, 9984, 11841, 20489, 16941, 12840, 28768, 32829, 9385, 17314, 12538, 17190, 5663, 12924,
+    13126, 12898, 28765, 17144, 5462, 10018, 28780, 28796, 28683, 16858, 32820, 12941, 9077, 16879, 0, 16974,
+    13042, 12465, 17281, 32802, 4295, 28728, 11646, 16449, 17208, 28826, 12908, 12309, 12511, 12827, 32929, 28814,
+    9873, 17000, 20483, 12689, 28782, 6357, 16542, 20486, 12555, 12676, 16808, 17082, 17150, 11644, 10801, 28785,
+    28761, 17404, 13092, 6430, 12571, 32830, 17235, 32856, 20484, 12606, 12779, 12946, 12695, 5369, 13138, 10871,
+    12779, 28676, 13025, 10789, 12728, 10459, 10281, 16483, 32937, 12862, 11689, 6327, 8911, 17318, 10816, 13212,
+    12425, 28761, 12477, 6359, 12333, 11640, 28708, 16526, 13055, 32869, 13038, 32885, 17398, 12623, 5369, 13016,
+    17148, 12864, 4939, 16858, 10151, 17375, 12552, 17318, 9200, 12365, 12743, 20483, 12960, 28719, 0, 12417,
+    28714, 12907, 28714, 12683, 5608, 17162, 10757, 28709, 28751, 12377, 12528, 28802, 13127, 12935, 12816, 16636,
+    12305, 28790, 17075, 8343, 9516, 28743, 32868, 13099, 9387, 28729, 13039, 11160, 9350, 12453, 16745, 12454,
+    12922, 10199, 32909, 28787, 13176, 9672, 12778, 4835, 13099, 6185, 16682, 28717, 11166, 12694, 8665, 16481,
+    12490, 32813, 17155, 28770, 6439, 10504, 13004, 8965, 6433, 11689, 16539, 17081, 32895, 12983, 13125, 28733,
+    8723, 12539, 13074, 10553, 4827, 8650, 13027, 9919, 28719, 16932, 32907, 11393, 28781, 10579, 12413, 13125,
+    12448, 12919, 12923, 12946, 6360, 12336, 12754, 16438, 13002, 32896, 11414, 6436, 17218, 28702, 10247, 11171,
+    28743, 12934, 32831, 16615, 28778, 8779, 12969, 28797, 32909, 10254, 28730, 13127, 28691, 12944, 28760, 17079,
+    10215, 16461, 12784, 10027, 10714, 28769, 32908, 16516, 12396, 28816, 17147, 9962, 28737, 10130, 12696, 12501,
+    13124, 5765, 12379, 0, 28779, 28681, 6439, 13042, 32800, 4155, 28793, 13126, 28684, 32859, 28678, 16617,
+    32885, 28729, 9386, 28799, 28715, 28817, 28802, 28801, 12983, 11414, 12930, 8963, 12609, 12946, 11731, 28747,
+    28757, 12790, 28680, 17399, 12920, 28702, 6439, 12600, 12370, 11341, 32814, 17157, 28734, 28796, 8790, 11105,
+    28798, 12558, 32790, 6222, 6181, 12394, 6466, 28743, 28803, 17296, 6444, 12528, 12982, 0, 17071, 12319,
+    12885, 12923, 12633, 12934, 9633, 11709, 9477, 28713, 10497, 13053, 12630, 12420, 12864, 10699, 11691, 28823,
+    12684, 28742, 28769, 9321, 32801, 12472, 9203, 12851, 28771, 11686, 16856, 20482, 17220, 16735, 10461, 11414,
+    11475, 12539, 6189, 32894, 16820, 16461, 32871, 11893, 17132, 17134, 4612, 8760, 12779, 8477, 9856, 32885,
+    12897, 12527, 12415, 10561, 28778, 10573, 16642, 12366, 11451, 17078, 17211, 6224, 0, 28820, 6217, 16746,
+    12468, 9281, 16846, 12660, 12563, 11712, 10552, 9465, 11694, 28675, 13127, 13122, 17226, 6402, 16879, 13043,
+    17203, 17014, 6222, 10516, 11355, 32937, 12732, 32788, 12900, 32826, 4660, 11466, 12417, 28791, 10516, 10969,
+    8790, 8703, 17014, 6019, 10859, 13136, 13019, 28685, 9684, 28716, 12599, 16808, 13128, 9930, 9941, 11446,
+    12960, 28691, 11059, 6022, 32895, 0, 17119, 10805, 28696, 9618, 16857, 12816, 17087, 10027, 10918, 10569,
+    12464, 16605, 20489, 12598, 5499, 28791, 11154, 11694, 9666, 13053, 11047, 5666, 9451, 13055, 10514, 12695,
+    10759, 11971, 10205, 28792, 9853, 28705, 16527, 11755, 8788, 12826, 12575, 17240, 11737, 0, 28715, 8887,
+    16754, 12947, 12839, 28687, 32805, 8348, 28801, 12695, 12875, 16753, 10205, 11686, 11703, 28798, 28732, 9908,
+    12687, 5629, 12918, 28697, 32905, 28804, 16811, 11930, 12648, 11926, 28783, 9246, 16500, 0, 9620, 10812,
+    10161, 8955, 28778, 9022, 16695, 8445, 12299, 32937, 12790, 32932, 12816, 10803, 17001, 28682, 12886, 11893,
+    28741, 32832, 6356, 4306, 5170, 9885, 13079, 11742, 9826, 16518, 8491, 9596, 5621, 12610, 17376, 9620,
+    9203, 12311, 12924, 8823, 28708, 12707, 6361, 6223, 32801, 9129, 12995, 17159, 12413, 9672, 17093, 8227,
+    16457, 28687, 28802, 16429, 13127, 16857, 10859, 13087, 17296, 32831, 28785, 8283, 10115, 16519, 12934, 17050,
+    28795, 32884, 12695, 12791, 17149, 11480, 11346, 28686, 32910, 11872, 28791, 28696, 11779, 13031, 11161, 0,
+    10552, 16418, 13055, 12318, 20489, 28722, 11387, 28680, 4307, 0, 32779, 12791, 20483, 32882, 13007, 12455,
+    9085, 8422, 16542, 16562, 28775, 16735, 12414, 12581, 12816, 10496, 13018, 28726, 12437, 11887, 32828, 9963,
+    12982, 6356, 12498, 11111, 12511, 10070, 17014, 12297, 9308, 32884, 28822, 28753, 28673, 6022, 13187, 9975,
+    11901, 20482, 0, 13028, 4468, 32790, 11939, 17016, 8228, 28723, 12354, 28711, 9773, 32911, 12971, 12920,
+    12888, 12605, 12852, 12477, 11161, 12567, 16895, 6187, 28766, 28792, 11466, 12428, 11692, 10599, 32934, 12765,
+    17089, 17002, 17172, 11448, 9791, 28814, 10872, 11899, 11901, 9502, 13079, 28826, 16773, 28761, 0, 8348,
+    13149, 12489, 17251, 12608, 28755, 11936, 10489, 10274, 32800, 8218, 20486, 16666, 13102, 5496, 16767, 13025,
+    12802, 12487, 12666, 17080, 6218, 28828, 32904, 28807, 16585, 12501, 32804, 12724, 12833, 32911, 32859, 20489,
+    9316, 12864, 28732, 13061, 10515, 9202, 11457, 17253, 9218, 16509, 13027, 9601, 13016, 11451, 12394, 16736,
+    12500, 12480, 13092, 28696, 17229, 12716, 5744, 32885, 17305, 28786, 6326, 9674, 5629, 28808, 28801, 28734,
+    11939, 32871, 11901, 28741, 11460, 0, 12828, 13133, 13169, 12743, 4456, 13079, 13110, 13039, 12420, 17089,
+    13104, 13199, 13101, 32921, 11480, 13207, 17308, 12935, 16593, 28737, 5460, 32859, 28706, 12336, 12322, 12642,
+    28681, 6408, 9293, 28698, 11158, 10365, 17171, 32869, 9122, 28699, 6362, 5207, 13103, 16857, 12417, 11410,
+    9827, 12449, 13127, 20490, 16841, 11414, 9546, 12768, 12774, 8469, 12347, 12660, 16429, 11748, 8368, 28688,
+    28721, 28804, 28800, 28805, 28766, 28781, 16729, 28794, 8349, 16675, 12419, 12689, 17290, 16925, 10095, 28712,
+    28756, 11460, 4634, 12311, 8935, 10122, 16598, 4677, 11114, 13092, 0, 28771, 32880, 10855, 12492, 13078,
+    16858, 12441, 9473, 13193, 6365, 12882, 8789, 9517, 32800, 8517, 0, 9808, 10263, 13127, 0, 28824,
+    32907, 32924, 28802, 13220, 28709, 12912, 8582, 12311, 10579, 17195, 32898, 9281, 11985, 17343, 10856, 16427,
+    13055, 12924, 17309, 13050, 12804, 6224, 13066, 32831, 16935, 10218, 16874, 28790, 12056, 28727, 16687, 32898,
+    12822, 11764, 28692, 12738, 6362, 28733, 10883, 12645, 28814, 28673, 10072, 8553, 8363, 12784, 10035, 11941,
+    32895, 32923, 12784, 12775, 0, 12948, 12982, 9751, 10260, 13005, 12576, 0, 13054, 10131, 4472, 10561,
+    32871, 6399, 32791, 0, 9561, 12764, 12466, 16816, 8948, 16735, 10860, 28748, 32853, 12560, 6186, 12785,
+    17287, 28796, 13176, 12576, 12672, 9964, 12547, 9387, 10881, 17325, 4651, 12523, 9909, 0, 4888, 9975,
+    16858, 12756, 13053, 32791, 9020, 28790, 32792, 12354, 20485, 8987, 16944, 17089, 28700, 8351, 32916, 12616,
+    12449, 32775, 13163, 12876, 12948, 16779, 12430, 11404, 10272, 11115, 16508, 16792, 10624, 16606, 28761, 11180,
+    12684, 8544, 17165, 5531, 13067, 12862, 13181, 13062, 12453, 11686, 16594, 8584, 10632, 20486, 17319, 12863,
+    11518, 12030, 28791, 28731, 32891, 28794, 28693, 32880, 12525, 13185, 28779, 8718, 28698, 32833, 17095, 12989,
+    12679, 9219, 28680, 28775, 16937, 8790, 11945, 28828, 11744, 16932, 11235, 28694, 28802, 12383, 9858, 28748,
+    28791, 0, 12668, 12851, 12501, 12996, 13056, 11478, 13055, 28780, 12384, 12358, 10544, 12644, 17169, 9291,
+    32897, 10794, 6181, 4634, 10268, 17329, 16854, 0, 8620, 12717, 12672, 12456, 9809, 5926, 12479, 12540,
+    28770, 17411, 10394, 32828, 32778, 16439, 8229, 28686, 28710, 11956, 28814, 6445, 28766, 32793, 28763, 13055,
+    0, 10504, 28826, 16695, 17083, 12593, 13002, 16762, 11181, 28765, 12570, 13038, 28727, 17202, 13053, 28681,
+    17252, 13128, 12332, 13077, 12780, 12383, 12729, 17094, 12935, 10072, 13193, 12696, 5975, 12885, 10261, 11712,
+    28752, 0, 28736, 28688, 17297, 10172, 12034, 28680, 13019, 12708, 12430, 12824, 13029, 12945, 6381, 10038,
+    17015, 10698, 32807, 5824, 12491, 9050, 12730, 28787, 11413, 32780, 0, 10610, 12560, 28791, 17319, 11152,
+    11451, 9002, 9888, 6152, 12672, 16699, 12764, 16744, 20490, 12036, 11341, 28778, 12603, 13198, 9481, 16895,
+    10123, 9254, 12063, 11942, 28818, 11093, 12616, 13054, 13074, 9839, 28742, 10862, 12360, 28788, 16858, 28813,
+    10554, 28815, 10364, 32872, 17251, 8743, 10001, 11764, 12947, 5411, 0, 10231, 28739, 9684, 9935, 9729,
+    13015, 12504, 13199, 13067, 12900, 9255, 17320, 8618, 28740, 12827, 16608, 10101, 0, 17173, 12644, 10281,
+    17168, 13188, 10177, 9736, 5620, 12936, 11467, 20490, 10868, 9065, 32923, 11171, 12947, 12346, 12444, 12792,
+    4710, 32845, 5081, 17094, 28753, 13170, 12372, 16858, 13136, 10570, 16657, 28781, 12038, 8788, 28691, 9009,
+    17252, 11943, 11902, 12634, 10670, 13152, 13080, 32859, 12045, 32898, 13176, 11746, 12855, 28791, 9675, 13186,
+    8417, 10872, 11357, 11765, 32833, 13139, 4711, 9388, 28807, 12390, 28756, 12419, 16527, 12780, 12067, 16835,
+    17015, 12948, 11457, 12744, 28797, 6445, 0, 11742, 13101, 8942, 28736, 28791, 10563, 16569, 12073, 28807,
+    8491, 32848, 12966, 28719, 17305, 28804, 12370, 32827, 12393, 12323, 12910, 10883, 28721, 0, 12971, 9663,
+    11780, 12379, 9387, 0, 10560, 28787, 13145, 16658, 4602, 12320, 28807, 10584, 28741, 12744, 4971, 32924,
+    11902, 12586, 12740, 11257, 32828, 28674, 28711, 32911, 28820, 8720, 12040, 28711, 17095, 12581, 11443, 11480,
+    11943, 12444, 28786, 13066, 16840, 10264, 32885, 12380, 5231, 11182, 12670, 12430, 11475, 0, 12045, 28766,
+    20484, 13212, 8307, 28690, 13020, 12946, 32934, 12586, 10969, 16658, 12624, 5046, 17014, 17330, 10872, 12403,
+    16587, 16583, 0, 16607, 16835, 0, 28818, 16934, 28744, 5466, 8666, 20485, 16677, 12679, 17282, 6440,
+    12369, 12864, 16676, 28705, 32804, 8296, 32909, 32790, 12073, 6402, 28756, 13056, 12466, 12876, 32859, 10435,
+    5272, 13170, 9955, 5106, 13044, 28787, 28775, 9554, 28759, 28731, 12564, 32932, 17173, 28777, 28703, 11182,
+    11679, 13119, 12309, 8450, 12936, 13030, 32897, 16774, 4181, 11742, 10217, 20489, 17411, 28771, 9545, 12573,
+    10569, 12458, 10400, 11295, 28775, 10573, 12335, 6226, 17111, 17253, 12408, 12622, 12510, 12910, 10582, 9057,
+    10730, 8491, 0, 16663, 16815, 6357, 17376, 12646, 16983, 0, 9253, 16620, 13158, 28688, 12766, 13211,
+    32936, 28774, 12959, 32883, 32780, 28709, 0, 8757, 32916, 28733, 5574, 16570, 13194, 9686, 20488, 12579,
+    12888, 28808, 28811, 12681, 12443, 4394, 28682, 28828, 12704, 12455, 12512, 6402, 8947, 32868, 8973, 32815,
+    11939, 32792, 13163, 12001, 32898, 12078, 12501, 32833, 28674, 12845, 12406, 8766, 10872, 11177, 12835, 32844,
+    16593, 28785, 28786, 28729, 28779, 28801, 17253, 16816, 4906, 12547, 12708, 32775, 11780, 32934, 11947, 13151,
+    10285, 32895, 11253, 32794, 28798, 12573, 28750, 11907, 16620, 0, 28735, 17095, 10283, 10217, 4848, 8488,
+    16517, 8605, 12837, 12391, 4393, 32884, 12656, 12947, 16700, 10692, 13008, 16530, 12393, 9986, 10437, 28695,
+    32813, 20483, 28802, 32841, 17094, 28729, 28818, 16421, 12860, 32805, 8355, 20490, 11984, 13150, 8490, 9011,
+    9525, 28781, 13152, 28807, 16519, 28761, 0, 9256, 28681, 16597, 12689, 28804, 11769, 12515, 12982, 13090,
+    11989, 12945, 8883, 28720, 11701, 28750, 16699, 28785, 12008, 32897, 13056, 32820, 0, 28802, 17315, 12049,
+    28778, 32930, 10346, 17161, 13186, 12741, 12468, 16844, 32800, 9114, 16843, 16925, 16846, 28821, 20489, 11442,
+    13196, 13181, 16530, 12515, 12963, 28718, 16462, 8899, 12559, 28726, 12933, 9853, 17308, 11779, 12804, 16974,
+    28805, 5093, 11939, 8486, 11171, 17320, 10941, 13205, 0, 9003, 28766, 0, 12360, 12058, 12076, 13116,
+    16843, 11945, 10581, 12898, 10474, 28777, 28725, 28771, 12552, 17407, 12752, 12539, 8368, 17110, 12755, 12584,
+    13198, 32898, 17239, 9517, 16895, 6454, 28680, 28676, 16608, 12643, 6365, 16637, 12365, 16851, 9547, 16607,
+    12298, 32884, 9617, 28792, 6448, 9219, 12838, 13217, 12513, 32911, 28772, 5574, 32920, 32934, 16992, 0,
+    12586, 10116, 12078, 12549, 9319, 13089, 16614, 32801, 12342, 28710, 11690, 28810, 9054, 13125, 28707, 0,
+    12008, 13067, 10517, 28692, 12391, 16824, 32819, 28737, 9302, 16674, 17358, 12585, 8650, 20490, 16518, 13170,
+    12935, 17308, 16530, 28822, 32908, 13193, 28773, 28802, 28815, 28804, 5410, 12898, 11902, 11246, 17251, 32816,
+    28731, 12855, 16851, 11640, 12309, 11436, 8451, 28780, 12348, 12679, 16755, 16937, 0, 11291, 13104, 28772,
+    8459, 28803, 5042, 28743, 13128, 28799, 16536, 9585, 16540, 28695, 8650, 12668, 13158, 11095, 12456, 12524,
+    8919, 28697, 12324, 28792, 32893, 16440, 20484, 28744, 11279, 16685, 12728, 8375, 8912, 13020, 9954, 4716,
+    28779, 12490, 17236, 28721, 16934, 13198, 8414, 11435, 32793, 28770, 17320, 10394, 28737, 16681, 13056, 11766,
+    28745, 9256, 32885, 11244, 28791, 32833, 0, 16528, 28700, 12418, 28777, 16952, 28742, 12549, 28734, 12643,
+    32856, 16530, 12848, 12575, 20489, 17150, 32898, 28817, 16676, 11780, 8397, 11902, 12739, 8694, 32936, 13126,
+    11235, 12390, 9518, 5557, 28819, 12974, 32803, 10359, 10368, 12894, 12911, 10233, 12801, 32885, 28785, 32921,
+    16727, 12920, 12732, 32800, 9413, 16451, 28772, 8721, 28698, 13040, 11993, 12960, 6350, 12680, 16450, 28688,
+    4961, 32820, 0, 12765, 10776, 28820, 28729, 28744, 28807, 16663, 28761, 28817, 13115, 13150, 0, 12764,
+    16766, 12320, 9356, 9687, 16541, 13210, 8368, 20486, 28771, 5665, 17240, 8453, 28802, 11907, 28808, 10767,
+    28823, 12836, 28777, 0, 9951, 12839, 12874, 0, 28726, 4692, 32933, 9608, 12956, 0, 6349, 28748,
+    32780, 28719, 13068, 9078, 9985, 0, 9059, 32924, 11944, 5611, 9002, 5092, 8666, 12335, 13126, 28784,
+    8713, 10049, 32885, 11476, 12405, 17325, 0, 9074, 17360, 6254, 28789, 12616, 12607, 32791, 12544, 28679,
+    28680, 12864, 12742, 12055, 17081, 17095, 28677, 9002, 12296, 8772, 0, 16529, 17030, 32870, 28739, 32853,
+    28725, 6466, 28713, 17174, 28783, 12076, 12383, 10573, 10203, 12360, 28795, 10991, 12634, 9022, 13030, 9373,
+    17016, 28783, 13156, 12972, 28743, 12040, 28804, 28693, 12370, 12658, 8418, 12502, 28738, 12705, 6101, 13125,
+    13055, 12826, 0, 11369, 28745, 16756, 12382, 20489, 12680, 12046, 4885, 4891, 32897, 28706, 12947, 12690,
+    4551, 28828, 28815, 11066, 32911, 28768, 10570, 13186, 8405, 10670, 0, 32793, 12957, 9311, 0, 12371,
+    17196, 11778, 28805, 12859, 16666, 28780, 13030, 12713, 12298, 32780, 28763, 12875, 11939, 11768, 28773, 0,
+    28715, 8384, 32853, 0, 32852, 8667, 28682, 17016, 9939, 0, 11756, 20488, 9897, 32895, 28697, 12079,
+    11992, 32846, 12441, 16904, 12732, 16746, 6466, 8751, 16855, 12908, 28777, 32882, 17330, 8228, 28716, 11479,
+    10990, 28814, 0, 12551, 12299, 28814, 28677, 20481, 6218, 28748, 12617, 12707, 10240, 13188, 9263, 5047,
+    11019, 28719, 12953, 28776, 28746, 28765, 12919, 5091, 16857, 5276, 8826, 17410, 13056, 10698, 9264, 17332,
+    12874, 32872, 16900, 12460, 32911, 10274, 9780, 28762, 12599, 28761, 12981, 12956, 12776, 16925, 10472, 9593,
+    16906, 13182, 13151, 11778, 12728, 5339, 10153, 28780, 13128, 10766, 16993, 28792, 9620, 10969, 16451, 9809,
+    13113, 12670, 32910, 13187, 12009, 9608, 13182, 32923, 10992, 13198, 16607, 9364, 32800, 9699, 13158, 12804,
+    9358, 8650, 8964, 13188, 32893, 28717, 13128, 13171, 10670, 28758, 0, 10760, 10759, 32937, 13211, 8704,
+    32907, 5064, 10806, 16746, 12787, 12862, 32935, 28790, 12802, 12859, 9070, 9019, 28811, 12599, 8483, 9365,
+    5426, 12528, 28717, 17140, 12474, 8713, 28751, 12804, 11262, 12467, 8404, 17070, 9310, 16856, 6393, 6235,
+    11999, 13200, 0, 12046, 10697, 9816, 8397, 9044, 11741, 28726, 0, 13137, 12682, 13198, 0, 17375,
+    12775, 17116, 32780, 5276, 12600, 0, 9348, 28691, 12742, 28751, 12977, 9600, 11746, 20490, 16909, 28728,
+    28783, 8759, 12764, 13030, 32805, 5036, 28725, 13028, 10747, 13176, 12011, 13198, 11169, 20486, 12800, 12588,
+    0, 6134, 28699, 13042, 9563, 12766, 13197, 6287, 32794, 8759, 28768, 9846, 13042, 32871, 28774, 28732,
+    28693, 5449, 28749, 32800, 12412, 5276, 20486, 13200, 12672, 9940, 12073, 12647, 12874, 13145, 13211, 28683,
+    0, 12731, 5025, 16930, 11985, 12068, 28716, 12333, 28707, 5991, 28784, 17237, 13186, 12648, 12729, 5894,
+    16607, 17185, 10883, 16842, 8667, 32793, 17095, 5432, 6009, 12804, 16698, 16451, 10369, 12041, 8965, 11326,
+    9948, 8459, 12490, 0, 13110, 13051, 9310, 11358, 12079, 8775, 10208, 0, 12823, 10537, 8478, 28680,
+    16688, 32932, 13224, 12991, 12312, 12537, 11545, 11779, 16428, 28680, 12975, 12467, 28823, 8491, 11735, 12348,
+    16880, 8745, 28821, 28785, 16776, 32921, 11245, 0, 10283, 10498, 11565, 10208, 11046, 17032, 32933, 32872,
+    13091, 6172, 13161, 5152, 0, 12872, 13221, 13212, 12561, 17360, 32872, 10274, 28727, 16808, 10832, 28694,
+    16891, 12957, 11103, 28796, 0, 10836, 10218, 13127, 9355, 12536, 32937, 17315, 12768, 9518, 28716, 12743,
+    12407, 9664, 28818, 12359, 28798, 0, 10207, 16966, 6310, 11955, 28717, 12861, 11543, 5642, 11222, 12837,
+    8827, 28707, 16595, 9366, 12933, 32853, 32853, 0, 9021, 12461, 28791, 11561, 12560, 8779, 16538, 16534,
+    0, 17377, 28763, 32897, 9020, 16886, 5477, 6081, 0, 11534, 13186, 10378, 28746, 12384, 32832, 28798,
+    12671, 16540, 16535, 12730, 13212, 13114, 5850, 11481, 0, 28718, 16695, 0, 12804, 12731, 32800, 12424,
+    6129, 16823, 12607, 16595, 28740, 28679, 11296, 0, 16925, 13068, 16845, 28680, 0, 9002, 8752, 8949,
+    28749, 10992, 10490, 28771, 8723, 12754, 13221, 32844, 5328, 8782, 12967, 9657, 28772, 28818, 13222, 0,
+    8919, 16846, 12508, 17410, 32832, 12611, 12499, 9601, 8457, 12883, 0, 12802, 32872, 12418, 9626, 12994,
+    4721, 32807, 8764, 32896, 16909, 9358, 16658, 0, 28748, 28748, 32872, 12872, 6122, 0, 17365, 9740,
+    12492, 28827, 10061, 0, 8853, 5317, 32872, 5643, 32871, 17072, 20484, 12002, 17326, 16814, 28715, 32800,
+    12447, 9846, 28819, 28744, 9468, 9809, 9809, 12647, 13091, 28694, 16858, 28730, 12739, 11984, 13186, 9777,
+    8787, 12635, 5606, 16619, 28684, 28678, 28740, 11932, 16936, 10516, 32920, 13222, 12653, 16988, 17411, 8912,
+    16687, 28726, 9264, 9067, 12678, 16755, 17188, 0, 16744, 12826, 13120, 0, 8421, 10781, 28787, 12806,
+    32830, 16529, 28677, 9152, 0, 9973, 10145, 17122, 10582, 11702, 8470, 17241, 17264, 17219, 28783, 10741,
+    12381, 32865, 0, 12055, 0, 32865, 10734, 12568, 8903, 20483, 11333, 13221, 9649, 28819, 8448, 16699,
+    9683, 16499, 9562, 28739, 8480, 9066, 17317, 13223, 8618, 28751, 16973, 11131, 32872, 28717, 28792, 5076,
+    12381, 16421, 17082, 10676, 9264, 0, 12480, 16618, 28717, 13175, 12755, 17094, 0, 16966, 17384, 10862,
+    28812, 12909, 9066, 28820, 28755, 32907, 12744, 0, 12312, 28737, 5821, 10450, 8760, 16724, 9617, 28729,
+    8788, 28789, 16519, 12420, 0, 17159, 32814, 28827, 8665, 8422, 12752, 6123, 13210, 32833, 32923, 9071,
+    12749, 10488, 12465, 11978, 13128, 16979, 5480, 9986, 28700, 13152, 13187, 4884, 20487, 5607, 28726, 28766,
+    28796, 13068, 17268, 28713, 16753, 9011, 12827, 20486, 5833, 28813, 12359, 12713, 8832, 12910, 8722, 12991,
+    28804, 0, 12711, 11040, 32827, 28737, 32805, 4943, 12768, 28783, 20483, 12379, 28793, 28743, 28781, 10239,
+    11476, 12932, 0, 13079, 16988, 12634, 16542, 12875, 10516, 13092, 16621, 16980, 12852, 12910, 8658, 5111,
+    12695, 6121, 12924, 10205, 8655, 12064, 32935, 10975, 16925, 17003, 9620, 12620, 16854, 16767, 0, 8787,
+    6139, 16776, 12323, 17171, 12380, 5070, 5649, 8460, 12707, 12802, 11588, 9878, 28680, 10705, 6112, 13164,
+    32911, 6293, 28705, 11327, 28819, 10145, 10274, 5584, 28817, 32831, 16756, 12691, 16697, 12850, 17409, 12897,
+    28823, 11561, 32921, 13188, 8343, 6306, 12526, 28730, 17369, 11906, 12863, 20488, 13152, 28814, 0, 9193,
+    17237, 12648, 11266, 28746, 0, 9088, 28827, 32830, 28758, 32865, 28819, 6189, 8424, 16699, 28738, 12809,
+    8468, 32781, 5104, 17398, 28744, 28681, 28791, 12885, 12468, 17052, 28808, 16966, 20487, 12753, 13078, 6465,
+    12431, 28716, 28783, 8423, 9377, 12838, 12646, 11756, 28771, 11034, 10740, 9965, 10162, 5613, 12993, 28767,
+    12596, 12526, 16916, 12694, 12791, 16614, 12526, 6346, 9620, 6037, 5997, 16845, 32820, 12703, 28709, 12712,
+    12382, 12074, 17331, 28819, 28781, 13110, 32883, 9302, 9264, 16835, 0, 12597, 28730, 16991, 12466, 28818,
+    12732, 17123, 12574, 12886, 11481, 16461, 11561, 11788, 10115, 28706, 9012, 5105, 32872, 17050, 0, 12067,
+    12711, 12646, 11340, 32805, 9827, 13164, 16519, 12894, 12958, 9518, 16449, 9088, 12861, 11295, 20490, 5110,
+    11657, 28707, 32885, 16998, 28734, 12744, 12810, 11701, 32865, 12868, 28675, 12561, 11822, 12490, 13052, 12765,
+    17253, 6422, 6440, 0, 9627, 12548, 28735, 10998, 5830, 5836, 28727, 0, 28731, 11012, 12683, 12995,
+    9085, 20490, 28813, 28740, 28801, 28813, 12799, 10152, 12600, 12645, 9076, 10216, 8414, 12480, 12992, 0,
+    16727, 0, 32838, 12790, 9357, 5899, 8470, 12790, 12968, 28694, 17003, 28693, 17124, 8421, 28766, 8250,
+    28826, 12799, 10794, 6037, 0, 5461, 28799, 17016, 0, 10264, 12562, 17172, 28695, 13005, 17368, 32855,
+    10191, 8868, 0, 32897, 12479, 28814, 28673, 11520, 5362, 11648, 17048, 16419, 12707, 0, 17332, 13031,
+    6409, 5489, 9685, 28800, 13134, 12720, 5607, 0, 4392, 12708, 32934, 12600, 28769, 28739, 10883, 9076,
+    28761, 12419, 16447, 13222, 12659, 32881, 28744, 12907, 5898, 9687, 28682, 32777, 9366, 10677, 11694, 28693,
+    12359, 28793, 17091, 16700, 13211, 13144, 12804, 12936, 12550, 13173, 32932, 32801, 8224, 16506, 10741, 11595,
+    16740, 13221, 28773, 5099, 32869, 16620, 13184, 28786, 17014, 12540, 0, 12336, 12573, 16450, 5111, 12921,
+    32845, 10019, 8723, 16586, 12491, 12838, 12968, 13217, 5610, 12838, 16801, 9281, 5483, 10490, 13054, 5828,
+    8554, 11347, 13003, 8688, 28824, 0, 32846, 17013, 16508, 12455, 8410, 13078, 16999, 9430, 16462, 6009,
+    32857, 16530, 32875, 28813, 10413, 0, 28761, 9302, 28772, 11042, 9656, 9302, 28696, 17059, 11008, 16649,
+    17151, 12732, 0, 20487, 17200, 9059, 6139, 17149, 8530, 17091, 9480, 9367, 9022, 17411, 10788, 28780,
+    11056, 16992, 12969, 10414, 28731, 28721, 28698, 28736, 28751, 12660, 28700, 32866, 32924, 16498, 10198, 32829,
+    9863, 10976, 9376, 28760, 11268, 11161, 11160, 16935, 12360, 32880, 12648, 32876, 12408, 10742, 17393, 12959,
+    6426, 0, 12995, 5980, 9201, 28762, 20482, 12681, 12731, 16515, 13196, 12790, 11685, 9319, 9319, 13018,
+    12587, 32878, 12322, 28763, 12612, 17375, 12719, 28759, 17056, 17263, 11631, 28721, 12714, 13224, 32872, 28797,
+    8414, 28816, 28768, 12958, 16427, 12900, 9666, 28748, 12466, 28728, 32856, 0, 28784, 12408, 4678, 10457,
+    5970, 12538, 17361, 10360, 20481, 32855, 13212, 28770, 32832, 12810, 16583, 5461, 28761, 0, 17397, 10759,
+    10976, 17367, 6054, 9059, 9948, 11341, 9578, 28777, 28795, 20487, 12715, 28765, 10490, 6202, 13077, 32884,
+    10255, 9311, 32876, 16858, 32856, 6235, 17080, 11822, 11384, 0, 12887, 28795, 13088, 9089, 12681, 9428,
+    32846, 0, 12837, 8424, 0, 12731, 10743, 0, 6043, 12468, 17387, 13092, 0, 12824, 4984, 17161,
+    13066, 12331, 13063, 13174, 17361, 4693, 10160, 10451, 28767, 10748, 12790, 28801, 32909, 12838, 12465, 12660,
+    16745, 16412, 16541, 9375, 28785, 12822, 13030, 17159, 10507, 13224, 28764, 28781, 12682, 8777, 28770, 16498,
+    12810, 16835, 28721, 12862, 10284, 28820, 28721, 12533, 5617, 0, 12480, 28788, 5616, 12828, 8787, 16686,
+    8337, 4669, 13212, 32911, 5627, 12960, 28783, 16698, 0, 32888, 0, 28772, 17059, 28800, 17068, 16937,
+    12851, 28693, 28727, 17149, 32841, 28674, 32833, 5591, 28729, 32814, 16756, 11929, 5491, 17209, 16514, 8278,
+    16895, 28700, 12296, 12827, 10511, 11801, 32778, 28702, 16725, 28716, 11104, 5497, 28720, 13224, 17404, 12981,
+    17207, 5658, 16609, 10803, 0, 16427, 11656, 8966, 8480, 12766, 32801, 12294, 11702, 28693, 11378, 11376,
+    28761, 5660, 13222, 28700, 6173, 6217, 12924, 12716, 12822, 8480, 12646, 12956, 12838, 10199, 6235, 10504,
+    16439, 0, 6376, 12756, 28799, 32846, 12918, 17124, 12743, 11042, 4525, 17250, 12600, 13077, 28827, 16858,
+    32801, 9119, 28825, 28694, 12731, 32898, 28786, 9673, 13100, 5899, 16608, 12970, 13019, 28820, 9302, 28716,
+    28758, 32898, 12803, 20487, 8854, 32923, 28776, 12394, 16983, 28795, 11843, 12922, 32779, 32845, 13161, 12767,
+    17138, 12590, 12333, 0, 6145, 6378, 12730, 17093, 12336, 13124, 12358, 28790, 28813, 28818, 16420, 28695,
+    28772, 13139, 17080, 8382, 5627, 32881, 32845, 8778, 12407, 16778, 12766, 10206, 13006, 17331, 10539, 28751,
+    0, 32793, 16436, 6455, 12875, 17298, 12930, 12979, 0, 17062, 32858, 17009, 16684, 11086, 11779, 13054,
+    13014, 32885, 13152, 12672, 11427, 12981, 11594, 20490, 16845, 32883, 8487, 12683, 28762, 28741, 10813, 12982,
+    12834, 5658, 12988, 32857, 10247, 17387, 0, 32857, 12838, 0, 12990, 28763, 16698, 16463, 11341, 12588,
+    5619, 0, 12754, 12942, 10836, 5591, 12824, 16666, 6210, 12494, 11460, 0, 32857, 28720, 12720, 16937,
+    9664, 28739, 32911, 0, 12538, 32884, 12907, 28797, 32867, 17307, 28715, 0, 12972, 6021, 12924, 32794,
+    0, 12367, 12970, 12899, 13091, 32855, 12571, 28814, 20486, 16672, 11349, 28712, 12612, 12923, 32836, 0,
+    28716, 32844, 28740, 17250, 32789, 32928, 32872, 11468, 16619, 10552, 28779, 12984, 12312, 8986, 5657, 9884,
+    8769, 12715, 20486, 32871, 0, 32781, 12849, 28794, 11059, 28804, 12942, 13018, 0, 12597, 10436, 28742,
+    0, 32794, 28820, 0, 12767, 28777, 32801, 12330, 28744, 5656, 12537, 6343, 13113, 17015, 16604, 12779,
+    13027, 28718, 11112, 9555, 8413, 28784, 10757, 28773, 16616, 8962, 28766, 10274, 6347, 12929, 28827, 5620,
+    12444, 12468, 32878, 20485, 12299, 5887, 16992, 11312, 8379, 8479, 0, 12390, 5491, 12561, 13164, 28791,
+    12369, 17068, 16937, 13035, 8648, 28698, 8488, 0, 17251, 32898, 11970, 12982, 5928, 12355, 28683, 28694,
+    5048, 32781, 10215, 17208, 0, 13030, 16937, 8789, 9686, 12049, 8234, 28748, 12342, 12971, 11860, 17141,
+    32846, 5499, 16687, 6015, 12811, 12551, 20486, 32777, 28700, 10800, 6457, 32790, 12732, 13138, 32857, 10247,
+    16619, 11355, 16779, 32921, 17151, 12563, 0, 10218, 28739, 28708, 0, 6234, 28778, 12959, 0, 9068,
+    12899, 11102, 10545, 32816, 12360, 0, 12811, 0, 28705, 28738, 28798, 12360, 32893, 12839, 12077, 12487,
+    6143, 0, 28758, 9364, 12774, 9657, 17008, 12572, 4999, 16924, 17147, 28790, 9674, 20489, 17226, 13056,
+    6049, 11409, 12930, 32857, 28772, 17409, 13146, 5424, 28813, 28795, 10247, 5626, 12603, 28743, 12575, 28753,
+    0, 11358, 32922, 12068, 10842, 11056, 12611, 12822, 10842, 9975, 32819, 6349, 9527, 12696, 17398, 32817,
+    12528, 0, 12919, 28795, 12528, 12648, 9686, 28739, 20490, 5663, 12407, 12058, 8778, 28758, 9627, 8980,
+    12825, 13044, 9366, 8411, 13144, 12924, 12828, 0, 13065, 28763, 0, 12537, 28772, 17154, 10669, 8719,
+    12576, 9676, 12079, 16640, 12294, 16641, 12306, 17316, 10803, 28825, 11639, 0, 10584, 8490, 28731, 10843,
+    16540, 28782, 9928, 32884, 8769, 9971, 16856, 32920, 0, 10262, 9077, 6172, 17410, 6055, 12920, 28802,
+    9685, 9375, 28744, 28809, 13209, 10513, 10285, 9371, 28752, 11387, 28802, 10243, 12922, 28825, 20485, 0,
+    12041, 0, 4310, 32779, 20490, 12395, 0, 12360, 5664, 17078, 32884, 12826, 12564, 17235, 12310, 5592,
+    17094, 5626, 11096, 17052, 0, 16766, 28796, 16736, 10806, 10282, 28819, 12840, 16911, 32923, 12804, 0,
+    17203, 12792, 16925, 13099, 28808, 0, 8779, 8779, 32903, 12744, 12572, 0, 16514, 28776, 12763, 12945,
+    28728, 11766, 12667, 32921, 13125, 32937, 28810, 13067, 10552, 11114, 28768, 0, 11056, 28745, 11386, 12562,
+    10161, 12402, 12984, 10099, 13037, 12647, 4295, 12641, 17407, 28805, 32918, 12600, 12768, 13032, 12576, 32839,
+    32895, 32919, 4630, 32815, 11088, 32864, 4565, 28694, 8479, 28679, 17009, 13224, 5658, 0, 11387, 0,
+    28770, 16578, 12599, 32793, 16587, 10271, 12561, 13140, 28747, 12959, 17090, 13044, 11750, 12528, 17211, 5491,
+    11603, 28687, 0, 32867, 12707, 28784, 32880, 0, 12825, 13089, 0, 5291, 10843, 0, 16755, 20490,
+    12620, 11401, 16676, 28796, 11699, 13088, 32892, 11012, 12528, 0, 12468, 32903, 6056, 28755, 10758, 20488,
+    6379, 12719, 13112, 8480, 11778, 20490, 32920, 10406, 10692, 13073, 17217, 12919, 28806, 12648, 28796, 12863,
+    0, 12813, 13163, 32868, 12618, 12468, 12763, 0, 17161, 12720, 13027, 28790, 10759, 28821, 32859, 8787,
+    0, 13199, 12983, 28801, 0, 17052, 10743, 16529, 8769, 13099, 28681, 8963, 17151, 8367, 0, 12767,
+    12971, 12875, 11440, 0, 28778, 17053, 11150, 12731, 11355, 17010, 28724, 16922, 12930, 12588, 11102, 4891,
+    10751, 12732, 12635, 28719, 28815, 16516, 0, 6465, 11387, 32882, 17053, 5629, 12718, 28818, 12814, 13050,
+    13125, 28679, 13146, 28744, 12551, 9480, 0, 12924, 10459, 8956, 5462, 10844, 13209, 12588, 12027, 12996,
+    0, 12396, 12680, 32802, 8240, 0, 32781, 28726, 13050, 28824, 11741, 11609, 9252, 17229, 9376, 12924,
+    9036, 13027, 16993, 12995, 12942, 0, 32911, 28828, 10218, 16992, 0, 17014, 17110, 12994, 10254, 9985,
+    17295, 32794, 9802, 13150, 10728, 11005, 32857, 8478, 28778, 12670, 16858, 0, 9728, 10559, 0, 13080,
+    17149, 11059, 12430, 17279, 12334, 32839, 13196, 8769, 11640, 13073, 17083, 12379, 28810, 10861, 8957, 13008,
+    28708, 0, 17011, 11648, 32802, 16410, 28796, 11223, 28687, 9087, 12863, 32884, 11778, 16522, 10816, 12659,
+    11767, 28816, 13038, 17141, 17320, 11947, 17162, 28766, 9687, 6185, 0, 17071, 12912, 12767, 17149, 11603,
+    11700, 32923, 28723, 13062, 0, 17217, 16445, 32778, 0, 8480, 10281, 12912, 5929, 9078, 11609, 12067,
+    11058, 13185, 0, 12672, 11910, 10553, 28819, 10850, 13001, 12900, 8666, 16774, 28746, 28814, 12572, 17253,
+    13099, 9367, 11465, 9665, 20489, 12762, 17282, 16858, 32911, 13146, 12432, 11863, 28814, 17002, 12924, 9198,
+    12532, 8491, 10998, 12804, 12478, 12599, 6352, 28681, 16756, 28755, 28801, 12970, 0, 12971, 28746, 20485,
+    6051, 13169, 5621, 6022, 28764, 12456, 11646, 28678, 28806, 20489, 17406, 8758, 12959, 16856, 6443, 17080,
+    28769, 17170, 12847, 8769, 8368, 17150, 28802, 12539, 32794, 9616, 12635, 12875, 8734, 12933, 9001, 32924,
+    5361, 28788, 12994, 32868, 12995, 12708, 28799, 12368, 13127, 32908, 11654, 28741, 12440, 16700, 11447, 6394,
+    28807, 0, 13161, 28751, 9051, 28779, 0, 12790, 11374, 12873, 11758, 20483, 10812, 17080, 28724, 0,
+    12496, 10507, 10370, 11938, 6057, 12346, 28805, 13090, 10859, 20484, 10262, 0, 11956, 10850, 28802, 0,
+    32935, 28806, 28754, 9204, 28791, 32910, 17411, 12959, 0, 13209, 8710, 11778, 11611, 12439, 11507, 13078,
+    9050, 8790, 32920, 32882, 12539, 32909, 16883, 10845, 12429, 12516, 16685, 13091, 9088, 32829, 28802, 12311,
+    8479, 11144, 12552, 16911, 17162, 12874, 32895, 12864, 6152, 32858, 32903, 10285, 11152, 32819, 10207, 0,
+    28780, 32845, 11866, 0, 12732, 12011, 16858, 0, 0, 12839, 13149, 0, 12777, 28768, 11111, 9217,
+    28715, 12945, 17331, 12622, 17081, 11892, 17220, 12911, 9068, 28828, 9077, 28739, 17168, 0, 13043, 28688,
+    12935, 28734, 17092, 32934, 10868, 9087, 17002, 10853, 16857, 13066, 6439, 13053, 16664, 12768, 12672, 11590,
+    12671, 9662, 12300, 8986, 12899, 12816, 28703, 12725, 9684, 10197, 11114, 28746, 10879, 4458, 20490, 6394,
+    17219, 0, 16604, 20484, 32897, 13042, 17241, 12910, 12452, 16937, 12588, 12762, 28815, 28778, 6400, 32857,
+    12058, 0, 12335, 6327, 28784, 12336, 9900, 28789, 11414, 12414, 32909, 9377, 0, 32935, 28816, 11150,
+    13224, 6438, 12512, 12396, 28683, 11115, 28767, 16570, 16542, 11686, 8414, 32831, 17236, 12600, 16621, 12946,
+    11349, 9986, 28817, 28779, 13211, 0, 0, 16693, 6226, 8613, 12540, 12768, 13053, 9377, 28789, 9779,
+    13128, 13209, 28777, 11158, 28751, 12010, 0, 10796, 11105, 16621, 11712, 32870, 6393, 10815, 17093, 0,
+    0, 0, 12479, 11955, 6181, 11457, 11161, 17288, 11167, 0, 0, 28807, 10538, 12564, 28828, 32935,
+    12972, 17411, 12768, 28690, 13139, 17141, 16688, 12864, 32818, 12370, 9909, 12839, 16823, 17071, 32911, 12611,
+    11178, 13079, 16598, 17203, 12011, 17094, 28813, 9064, 28723, 13162, 12701, 5552, 8480, 11713, 12372, 32907,
+    28827, 13043, 12538, 28757, 28782, 28828, 28813, 13089, 13002, 6411, 17296, 16902, 12995, 12993, 9313, 0,
+    17229, 12863, 5794, 12945, 13073, 13103, 13158, 12692, 17345, 0, 10107, 6446, 32859, 8790, 5993, 32776,
+    12502, 11448, 32916, 11700, 13039, 12631, 13008, 12995, 13124, 9255, 10153, 11732, 12720, 12932, 12300, 11865,
+    11158, 12525, 28810, 12923, 28791, 0, 13198, 12609, 12058, 12540, 11640, 11095, 13055, 17230, 32906, 6232,
+    0, 11654, 17172, 10579, 12440, 28828, 28696, 12610, 16412, 11955, 17094, 10859, 10878, 12622, 0, 0,
+    13067, 28807, 0, 11648, 0, 13050, 32846, 0, 28804, 9850, 13104, 8491, 17408, 12368, 28744, 12547,
+    17196, 12297, 0, 12887, 32922, 12828, 5943, 0, 13211, 17173, 5621, 17282, 11466, 11657, 12797, 9986,
+    28801, 9563, 32792, 32924, 13104, 13006, 11404, 28747, 20488, 28722, 10217, 16515, 8271, 13113, 32898, 0,
+    10487, 12858, 20483, 10669, 0, 12884, 11901, 13150, 13044, 32937, 28796, 12788, 32922, 13062, 10845, 13080,
+    0, 17394, 12600, 32898, 12900, 10862, 10218, 6399, 6362, 10931, 11906, 11358, 32840, 0, 12686, 8489,
+    11449, 10093, 11692, 10400, 16745, 12396, 17089, 32908, 12000, 12550, 11993, 17290, 13140, 6275, 12592, 13138,
+    13067, 16741, 32916, 0, 16621, 11403, 13065, 32935, 12297, 13005, 12922, 8876, 8988, 0, 32794, 17168,
+    13076, 11769, 32923, 6189, 32923, 8918, 28790, 11357, 12944, 13062, 20483, 12078, 28768, 9321, 28808, 0,
+    12972, 28787, 28801, 4442, 12681, 20490, 28696, 5614, 28806, 11328, 10573, 0, 32897, 5254, 11700, 16420,
+    17314, 10816, 32934, 6408, 28802, 28686, 10255, 12032, 32885, 9767, 32924, 11395, 12312, 12884, 28786, 6362,
+    28788, 28716, 12336, 28810, 12538, 0, 13149, 10968, 17332, 13091, 28797, 11764, 12430, 0, 11443, 28808,
+    0, 28693, 8910, 11404, 11930, 11929, 12947, 13044, 28706, 32807, 8734, 0, 0, 11449, 28808, 8612,
+    0, 32844, 12782, 13055, 12394, 10872, 16935, 13224, 0, 32859, 11158, 28825, 12899, 10542, 9215, 16687,
+    0, 13019, 28809, 11871, 9513, 17172, 17253, 17230, 17162, 11171, 12967, 11543, 0, 12522, 0, 13068,
+    12935, 28778, 28703, 16594, 16754, 13103, 11901, 13055, 0, 12432, 8490, 8491, 16729, 11413, 12984, 13031,
+    16439, 0, 28730, 28806, 16722, 28779, 11161, 12552, 9388, 6400, 12972, 6446, 28804, 28714, 28715, 10481,
+    5478, 17269, 28806, 0, 10760, 12852, 28782, 0, 12467, 13079, 32936, 11115, 28791, 8577, 12393, 6454,
+    16697, 12876, 13043, 12653, 9601, 28684, 16814, 0, 17014, 17246, 12455, 12719, 16500, 13113, 10868, 11570,
+    13019, 9619, 17011, 16516, 8571, 9087, 8942, 11774, 11457, 10570, 13053, 0, 12876, 28761, 13079, 28684,
+    10776, 0, 28803, 0, 12664, 9545, 0, 13067, 28689, 17173, 4471, 28725, 32872, 0, 12994, 28826,
+    12405, 12936, 6439, 10554, 16650, 32936, 16595, 12672, 17004, 32791, 9251, 16688, 8419, 13068, 11764, 12679,
+    12383, 8485, 17168, 12684, 0, 16446, 32907, 28779, 10127, 17171, 10868, 12600, 12995, 32934, 16953, 32937,
+    8719, 9839, 17159, 8745, 12852, 13147, 17332, 6232, 10861, 6462, 10814, 12428, 16852, 0, 28796, 28679,
+    12345, 0, 16538, 13174, 9089, 9843, 12995, 9058, 10881, 16858, 17091, 28810, 0, 28793, 32910, 28770,
+    6051, 10394, 28807, 28744, 28795, 11901, 32898, 11414, 9387, 9261, 9354, 28813, 12492, 13175, 0, 17320,
+    9089, 12996, 11167, 16974, 28804, 16923, 10284, 13113, 12992, 12309, 6059, 13128, 16588, 8995, 32916, 12660,
+    9510, 32818, 32933, 12672, 11075, 4307, 0, 0, 10806, 12432, 9975, 13222, 11991, 16675, 28723, 12576,
+    9935, 9150, 12611, 8767, 12581, 28775, 28796, 11774, 17095, 12681, 13066, 16588, 9516, 0, 28819, 28697,
+    13210, 0, 17162, 12876, 9686, 32897, 12348, 0, 28804, 0, 12935, 12592, 10882, 0, 17227, 8349,
+    8621, 28745, 17331, 16762, 28799, 8555, 13219, 11906, 4400, 16673, 6381, 13103, 17170, 10138, 11756, 9675,
+    11703, 16911, 11113, 11457, 10261, 28808, 32803, 4435, 17239, 28680, 9472, 12419, 0, 28801, 11160, 12371,
+    12984, 16682, 28681, 28725, 12648, 28791, 12717, 16766, 6019, 12515, 0, 13019, 9179, 13212, 13054, 0,
+    12007, 9964, 8364, 28700, 12562, 28702, 8304, 13159, 16666, 8312, 13064, 12078, 13175, 12768, 10137, 28677,
+    17173, 32909, 12480, 13102, 8606, 4799, 9890, 32776, 12936, 0, 28692, 11742, 17160, 0, 10882, 12299,
+    0, 17319, 28701, 0, 9914, 0, 28688, 13193, 0, 13041, 17309, 16833, 12043, 28785, 28780, 28774,
+    6121, 12562, 28733, 28698, 13211, 12540, 13052, 0, 12345, 16857, 13066, 9213, 17377, 12450, 11180, 8777,
+    9263, 28779, 12779, 10213, 12912, 0, 12959, 13076, 4213, 12391, 0, 16876, 28826, 8390, 16835, 10114,
+    28771, 28674, 0, 16684, 0, 32897, 6427, 5401, 5075, 28702, 10878, 16412, 8395, 12724, 28737, 13185,
+    9917, 10285, 32807, 9335, 32816, 28737, 16779, 6189, 11182, 11679, 13126, 32778, 28809, 0, 12559, 32791,
+    12368, 16677, 28808, 16462, 13222, 28686, 28705, 0, 11982, 0, 13115, 28695, 12466, 32815, 11206, 12037,
+    32840, 16830, 32921, 17252, 12392, 4846, 8555, 32911, 13188, 12780, 9539, 17318, 12948, 12454, 13004, 17095,
+    13115, 16932, 17174, 9377, 28761, 28734, 8789, 28809, 12444, 13164, 32830, 17094, 16675, 13020, 17315, 12358,
+    16597, 4472, 12844, 0, 28725, 13170, 13031, 12678, 20484, 20485, 13064, 13200, 12381, 16658, 28759, 16790,
+    12335, 12624, 11902, 8243, 12651, 28687, 12679, 11953, 17298, 6235, 16518, 10283, 28679, 0, 17298, 0,
+    17251, 11402, 32830, 11275, 16578, 12482, 28744, 11908, 12040, 32919, 9377, 10151, 9020, 8354, 28697, 12836,
+    0, 13064, 17320, 13197, 13044, 11656, 13187, 12828, 32934, 32911, 0, 28803, 0, 0, 13122, 12680,
+    0, 0, 11627, 28736, 11481, 0, 28770, 32916, 10394, 28710, 13028, 12684, 16588, 28680, 12835, 5200,
+    12408, 32829, 12381, 16463, 11939, 5302, 32833, 32816, 12897, 16852, 20490, 13044, 28786, 16606, 11480, 17240,
+    17241, 28677, 12309, 11181, 9219, 16604, 13170, 0, 12485, 12298, 0, 28717, 4700, 12369, 0, 28814,
+    32922, 28743, 0, 28814, 32802, 10297, 11748, 11341, 9056, 13078, 11468, 28770, 16492, 10573, 9387, 9357,
+    11468, 0, 32791, 12522, 9686, 12427, 17332, 28711, 12747, 32872, 12575, 28678, 12875, 28690, 12597, 28825,
+    8899, 8709, 11902, 11999, 28759, 9153, 12828, 8359, 13051, 28813, 16735, 12693, 12382, 12491, 28753, 28782,
+    12512, 16642, 6211, 12571, 8687, 13115, 13066, 12372, 28677, 17173, 28689, 28731, 28701, 32805, 9244, 16790,
+    11985, 16608, 16953, 16499, 28678, 13224, 32778, 13193, 28694, 32857, 28734, 11769, 0, 9778, 11742, 28776,
+    12540, 12725, 32922, 11989, 16686, 12656, 16517, 6411, 28803, 17015, 0, 10584, 32792, 12832, 16573, 12765,
+    20484, 17409, 12960, 17352, 10642, 16727, 12538, 9089, 32804, 9790, 12663, 12044, 0, 0, 4905, 12621,
+    28726, 13163, 32852, 17170, 0, 16831, 16512, 32922, 9564, 11412, 16428, 10870, 13140, 28737, 5491, 28803,
+    0, 12404, 8919, 16616, 16822, 13092, 8868, 13068, 12887, 0, 16430, 11470, 17249, 28725, 28737, 12395,
+    8577, 28768, 28748, 16440, 8954, 12600, 12585, 28696, 11750, 10347, 12321, 11182, 4785, 28814, 11160, 28786,
+    8620, 12359, 10870, 13127, 32918, 28735, 28715, 9952, 16953, 32805, 8662, 11131, 0, 11765, 11436, 20485,
+    0, 9687, 28808, 28748, 28775, 28736, 12573, 28716, 17095, 11672, 16617, 28710, 9582, 13152, 28734, 28686,
+    16541, 32793, 16506, 28712, 12346, 8368, 0, 9685, 32807, 8738, 10642, 0, 16778, 32859, 32923, 17319,
+    9750, 32859, 12502, 9674, 12311, 12472, 32898, 11545, 28714, 13068, 13067, 8470, 28787, 28681, 10655, 12406,
+    10883, 28717, 13151, 12432, 12936, 12765, 28720, 10693, 12547, 13123, 9510, 12752, 8698, 13008, 12540, 12572,
+    13173, 12465, 12415, 28710, 6394, 12454, 8344, 12552, 6454, 20484, 17218, 12996, 12585, 16754, 28768, 12370,
+    6466, 28784, 10882, 6456, 16596, 8970, 10397, 16834, 0, 28728, 13127, 12498, 12996, 17016, 11777, 12830,
+    0, 28720, 8876, 28826, 28680, 32779, 11169, 28774, 6277, 0, 16509, 0, 8912, 12972, 20485, 28777,
+    16958, 9479, 11477, 11956, 13198, 6350, 9593, 6205, 12802, 12595, 28679, 0, 12749, 17395, 17325, 12298,
+    0, 17252, 12356, 13107, 8313, 12002, 10071, 16446, 13139, 28770, 32923, 12597, 13116, 28673, 10941, 8790,
+    16753, 8964, 10647, 9495, 20482, 9152, 0, 12479, 4699, 16746, 9929, 10348, 28694, 13032, 8606, 0,
+    12040, 28681, 12334, 16816, 11182, 0, 8704, 13007, 28679, 12560, 13079, 11991, 16667, 28768, 5672, 0,
+    28699, 8789, 12396, 12334, 12419, 17174, 28735, 5054, 13187, 11160, 28814, 12683, 8306, 9585, 12345, 13104,
+    16518, 4677, 12311, 8397, 16617, 9216, 17174, 4842, 10207, 0, 28820, 0, 12408, 0, 10883, 12764,
+    16448, 16615, 28696, 17357, 10138, 28815, 8400, 12596, 12726, 4954, 12466, 32806, 8717, 10279, 5453, 28680,
+    16778, 17325, 9078, 16763, 10647, 12611, 13128, 0, 9256, 16667, 8306, 13164, 12551, 8700, 9655, 13198,
+    28674, 16833, 10862, 11985, 12465, 9292, 12633, 11780, 5006, 28796, 9983, 28717, 32844, 12738, 0, 12549,
+    13044, 12761, 0, 12047, 4636, 9607, 0, 13205, 10764, 32831, 13187, 12936, 13182, 11231, 11910, 0,
+    9986, 8745, 28685, 16528, 4954, 8665, 12894, 20486, 28769, 28719, 16461, 8955, 11780, 8367, 17318, 12616,
+    32923, 32853, 4203, 9647, 32911, 0, 12730, 28756, 28694, 9553, 13140, 16795, 12634, 32867, 5433, 28738,
+    32920, 12343, 28704, 0, 16616, 17174, 17016, 12010, 9675, 13188, 8485, 12952, 16677, 0, 0, 9355,
+    0, 13221, 0, 12719, 12615, 28730, 10229, 28716, 0, 0, 12308, 9686, 32921, 0, 6272, 12704,
+    0, 28690, 12008, 12728, 12815, 0, 32818, 12063, 10946, 12960, 12514, 28769, 11574, 17190, 32869, 0,
+    17251, 11104, 12515, 9945, 17239, 16658, 8358, 12764, 28683, 0, 17109, 32832, 12715, 10670, 28769, 28799,
+    9320, 12454, 17320, 28682, 32923, 0, 16722, 16833, 8368, 16745, 13157, 32780, 32936, 13224, 12054, 9890,
+    13194, 9300, 17253, 12323, 9002, 16661, 12297, 28683, 16649, 17037, 13103, 0, 10989, 9898, 12366, 17072,
+    17230, 13194, 12453, 12934, 28685, 12669, 8957, 13148, 12508, 17320, 17367, 12936, 12372, 17319, 28735, 0,
+    11020, 13050, 4237, 12671, 9675, 28808, 16498, 11946, 28789, 8621, 5484, 17250, 0, 12621, 11481, 12623,
+    32920, 13127, 28722, 11767, 5431, 9740, 17374, 12815, 11864, 11289, 12063, 28784, 12073, 32803, 12296, 16696,
+    16529, 32806, 5206, 5449, 12634, 9601, 8419, 16694, 12708, 17357, 13052, 10240, 13209, 13137, 12508, 12729,
+    13199, 16608, 32922, 28694, 5608, 0, 11985, 9007, 32818, 13174, 9649, 28715, 0, 13127, 12705, 28796,
+    28752, 12679, 10990, 17185, 13208, 12696, 8712, 13053, 0, 13020, 16449, 12415, 28715, 5064, 12312, 32830,
+    16838, 12963, 10545, 16834, 0, 13199, 16527, 12857, 0, 28726, 28824, 12693, 28780, 10997, 16686, 17252,
+    12847, 32923, 8630, 10813, 16855, 0, 9497, 28790, 13221, 13138, 16539, 9350, 0, 32777, 28713, 17330,
+    12812, 28770, 9980, 10394, 13210, 28790, 0, 12767, 11457, 5478, 9586, 32779, 28684, 28801, 11842, 10528,
+    9089, 28794, 10173, 5665, 28699, 32908, 8397, 12873, 0, 16539, 28819, 9600, 9293, 11860, 9365, 10079,
+    10775, 17071, 12688, 28731, 8964, 12501, 4933, 9010, 11027, 28720, 17396, 9281, 9497, 12335, 11395, 9889,
+    10255, 0, 12443, 0, 12475, 20487, 6020, 9256, 11059, 12657, 16528, 11182, 28739, 32858, 28694, 28815,
+    17411, 28803, 16451, 9591, 0, 12775, 12995, 28776, 0, 8338, 9021, 28692, 32897, 12612, 13164, 16883,
+    28808, 16695, 13197, 10008, 13173, 12474, 17358, 12444, 0, 11262, 12468, 10774, 12462, 12634, 28796, 16851,
+    28688, 13211, 0, 32896, 8255, 28686, 20490, 11112, 9641, 17162, 10859, 12456, 28733, 12407, 17161, 32853,
+    16411, 13126, 12343, 12617, 28706, 12741, 17083, 28818, 12555, 28780, 32806, 10471, 32921, 11779, 16618, 10431,
+    20481, 11947, 12630, 5469, 17083, 9593, 32852, 12766, 10079, 17332, 11479, 28697, 12428, 32864, 12671, 16726,
+    28762, 32836, 28824, 32833, 11074, 9308, 12784, 12587, 8756, 28796, 16597, 32920, 11262, 12990, 13210, 9010,
+    11244, 6152, 28703, 5556, 12803, 28739, 13206, 28768, 28683, 17396, 12466, 12368, 12991, 8478, 5449, 11262,
+    17331, 32791, 13150, 13186, 11910, 16528, 13175, 0, 12333, 13080, 12324, 0, 11775, 5425, 28707, 28693,
+    13186, 12791, 12584, 12384, 9786, 0, 13116, 13068, 28673, 0, 11780, 0, 8477, 16886, 28703, 11073,
+    5356, 11050, 28748, 13197, 32794, 28719, 28786, 12729, 12068, 5427, 12430, 0, 28771, 0, 11481, 0,
+    13128, 12616, 28776, 32859, 9020, 12965, 10698, 8463, 28779, 12803, 12607, 28804, 12671, 8420, 0, 9809,
+    16440, 0, 28827, 12008, 12499, 28750, 10923, 0, 12010, 28780, 16615, 0, 32919, 5431, 16451, 12657,
+    28748, 0, 12767, 12874, 28816, 28713, 16845, 28759, 11294, 0, 0, 12492, 8712, 20481, 28678, 16451,
+    9320, 12604, 9975, 5356, 13200, 13188, 8718, 9002, 12079, 28679, 9639, 5476, 0, 9846, 12359, 11332,
+    11460, 8919, 12504, 28827, 10975, 0, 5356, 28792, 12432, 13128, 0, 12584, 9345, 28812, 32918, 10670,
+    28807, 20490, 28748, 11356, 0, 28702, 8772, 12617, 0, 32831, 28746, 12839, 8853, 17367, 12871, 12972,
+    5431, 17365, 20483, 12298, 8750, 12598, 13080, 28768, 0, 28751, 16539, 0, 28742, 12898, 28756, 9846,
+    28703, 8469, 9255, 8711, 28762, 11769, 11529, 0, 10108, 12732, 13217, 28719, 12503, 32789, 16988, 28823,
+    12767, 12512, 12394, 16852, 8727, 10704, 9666, 32865, 8422, 12596, 28719, 13150, 16756, 9019, 28768, 28794,
+    28826, 12964, 0, 32895, 11768, 28739, 12691, 16604, 16451, 16901, 9311, 0, 5579, 0, 9778, 10780,
+    17013, 16461, 9056, 10698, 28717, 9365, 28801, 0, 13080, 13200, 11544, 28789, 12716, 12875, 12754, 28697,
+    16913, 0, 13211, 4977, 5113, 12404, 16756, 32807, 5941, 0, 32777, 17193, 10145, 12619, 16448, 11710,
+    5076, 13163, 12906, 12767, 12719, 28769, 11673, 11728, 13210, 0, 10804, 0, 10676, 12610, 13097, 16542,
+    28768, 32807, 9340, 8470, 12872, 32792, 12767, 17365, 0, 28739, 28732, 16598, 5560, 17330, 8765, 17090,
+    12504, 13136, 17297, 28735, 5499, 4728, 13173, 13217, 17410, 9546, 12710, 0, 0, 12801, 12702, 28721,
+    9321, 17361, 28694, 0, 16683, 12730, 28689, 32840, 0, 11713, 0, 16621, 28708, 12343, 16979, 9086,
+    12504, 32871, 28786, 12635, 9256, 12778, 12055, 0, 0, 12592, 12787, 12692, 12703, 28719, 12067, 28736,
+    0, 16767, 32831, 11079, 11778, 28710, 12308, 17331, 0, 28806, 28802, 9682, 4983, 28735, 28770, 0,
+    12585, 5092, 12957, 32781, 32816, 0, 10583, 0, 32859, 28740, 16688, 13222, 12946, 28743, 12312, 13003,
+    11311, 17369, 5612, 12898, 8478, 13221, 12884, 32794, 28817, 11003, 13116, 32936, 12966, 8461, 12934, 13211,
+    10975, 20484, 28705, 17378, 11467, 10515, 0, 10410, 28771, 0, 28819, 16457, 11668, 12066, 16774, 9066,
+    28784, 8365, 28815, 0, 12935, 10106, 12883, 10882, 28731, 0, 8774, 12443, 11003, 28756, 12806, 12993,
+    12419, 0, 28811, 16698, 32829, 28819, 10239, 13134, 28824, 12955, 20483, 0, 6408, 16971, 16530, 0,
+    12945, 12310, 12609, 0, 12730, 0, 28825, 11063, 0, 12333, 16988, 13175, 12658, 13222, 8757, 8752,
+    13080, 11756, 32858, 16854, 0, 5786, 12849, 0, 0, 12564, 12971, 9879, 0, 4983, 16451, 17043,
+    12372, 13067, 32793, 17332, 5362, 12719, 32854, 0, 11168, 32807, 6247, 12525, 12898, 11289, 28746, 6205,
+    13114, 17369, 28706, 10699, 16677, 28793, 9358, 10796, 16988, 28728, 9909, 28705, 13075, 9601, 0, 28757,
+    12797, 17361, 28720, 9609, 32911, 12480, 13116, 12968, 12465, 12886, 32846, 10444, 12753, 0, 9308, 12906,
+    9919, 0, 28783, 12776, 13157, 28743, 0, 0, 28827, 16698, 10741, 12645, 12863, 12788, 8643, 5276,
+    9555, 10143, 12420, 5992, 12468, 11295, 12526, 16458, 10144, 9057, 0, 28728, 17329, 12719, 9672, 0,
+    6116, 13148, 4452, 8713, 0, 32807, 8773, 9655, 5483, 13076, 12636, 0, 28813, 9350, 12610, 12849,
+    28794, 5076, 17071, 12466, 0, 9250, 12372, 28675, 28782, 12790, 11460, 8470, 12672, 28704, 5455, 12479,
+    12646, 0, 11703, 17329, 17388, 12012, 8667, 6299, 16857, 28794, 28787, 20486, 0, 0, 28793, 9799,
+    17384, 12850, 32911, 5368, 10775, 8766, 12872, 17117, 12516, 28797, 5483, 11430, 8423, 11040, 28785, 13218,
+    16766, 12882, 28769, 28807, 8460, 9078, 12300, 9077, 11561, 12077, 8359, 12837, 10158, 32845, 0, 12456,
+    16598, 16777, 9310, 20481, 28679, 16854, 8470, 0, 12537, 12872, 0, 10284, 12512, 11075, 12549, 0,
+    32871, 16998, 10413, 12992, 5318, 0, 8477, 12983, 17361, 9862, 8256, 16966, 12659, 13088, 11470, 0,
+    16529, 28755, 28796, 0, 9059, 32843, 12978, 12600, 17361, 12440, 28675, 32827, 0, 28733, 11121, 9470,
+    28730, 12312, 0, 8787, 8460, 12836, 11059, 5489, 0, 13209, 9387, 12838, 12079, 12703, 28743, 28794,
+    12852, 0, 28778, 12947, 17369, 0, 12477, 6165, 10806, 28749, 17404, 28806, 10676, 13220, 12719, 0,
+    28778, 12957, 12636, 0, 12718, 12864, 12360, 16966, 12861, 10882, 17397, 12380, 28726, 9302, 10378, 12638,
+    8768, 8775, 6344, 28716, 16966, 20490, 11010, 9319, 12958, 12514, 13221, 32922, 28747, 16972, 13138, 28828,
+    16525, 11425, 0, 28820, 17228, 11668, 12573, 28750, 0, 12489, 17211, 28774, 16587, 12895, 28760, 0,
+    32858, 16855, 16998, 12049, 10191, 12067, 16834, 12991, 10676, 12444, 0, 28820, 8704, 28813, 6120, 17044,
+    12755, 28746, 0, 9496, 12850, 10882, 0, 12336, 13042, 12359, 12561, 11556, 12712, 32872, 8789, 28727,
+    12669, 28739, 17398, 12713, 9617, 12658, 11999, 16766, 12597, 12658, 32911, 12873, 4955, 28816, 12432, 12852,
+    12058, 6401, 28795, 28773, 5368, 10115, 28757, 17198, 11668, 12696, 28760, 28690, 17160, 11742, 8883, 13122,
+    17332, 12585, 12815, 16980, 12946, 17240, 11128, 16620, 28788, 16463, 32866, 12971, 28804, 16966, 17228, 28704,
+    9319, 6009, 32778, 8424, 8722, 9358, 28808, 16448, 28691, 32872, 17199, 32937, 8777, 12715, 28767, 16542,
+    5489, 12502, 32881, 12077, 11675, 10705, 11080, 13222, 9087, 16694, 12839, 13026, 9366, 28749, 10284, 17252,
+    16620, 17410, 12573, 0, 16823, 17409, 16779, 9919, 8946, 28753, 8613, 10862, 10975, 13109, 12668, 16619,
+    12812, 16925, 0, 12324, 12804, 12862, 28771, 9427, 28751, 11041, 12463, 16914, 0, 0, 5585, 0,
+    28807, 0, 17171, 13221, 28750, 28723, 12729, 12809, 16746, 12754, 13092, 12969, 12810, 12488, 11794, 16998,
+    12996, 12792, 28804, 10705, 8789, 0, 8788, 0, 12077, 17160, 8470, 10115, 17129, 12884, 5618, 10736,
+    28760, 17397, 28687, 0, 10748, 28730, 8414, 8568, 11377, 0, 12428, 12827, 17241, 28821, 28750, 13158,
+    13200, 4676, 28775, 12917, 17394, 5674, 4983, 28776, 16825, 13078, 12509, 10272, 12598, 6139, 9078, 10455,
+    32911, 5618, 12979, 11637, 10458, 12809, 20486, 12785, 16799, 10743, 13218, 32843, 13148, 12849, 10882, 28774,
+    12799, 5461, 5650, 10711, 28817, 28800, 32866, 12427, 16620, 12839, 8723, 0, 13123, 11766, 0, 28723,
+    16832, 12816, 12509, 10160, 9067, 0, 28724, 12514, 9951, 5077, 16936, 13140, 16608, 28813, 28799, 0,
+    28735, 0, 9086, 16894, 0, 9724, 28770, 6297, 16981, 0, 12753, 12550, 0, 17404, 16461, 20483,
+    9918, 0, 5108, 12442, 16835, 32802, 4282, 12714, 12838, 16855, 10444, 9383, 10743, 11479, 9555, 12653,
+    8274, 11383, 20483, 11035, 9601, 12503, 6170, 0, 11047, 28724, 13128, 0, 16765, 16989, 8905, 11594,
+    13150, 0, 12634, 8966, 6261, 28719, 32833, 16609, 12660, 16902, 12587, 12453, 11637, 6209, 28706, 32839,
+    28690, 9479, 12774, 28784, 20487, 13018, 11587, 17123, 28740, 12540, 0, 10160, 0, 11042, 12646, 10742,
+    28748, 10482, 11302, 32781, 12647, 20481, 12766, 11303, 9384, 32922, 28747, 32855, 9374, 11010, 12392, 12948,
+    0, 8428, 16990, 12453, 0, 20483, 12513, 28806, 16664, 28688, 9387, 5406, 28691, 9948, 4571, 28723,
+    12332, 28814, 0, 12917, 12947, 0, 9262, 0, 28719, 28814, 12011, 0, 17124, 28810, 0, 12909,
+    12396, 10457, 28679, 9817, 10743, 10450, 0, 0, 16764, 32876, 12500, 13007, 5651, 11425, 0, 28773,
+    12491, 28717, 11384, 9286, 17205, 12681, 13128, 28814, 11600, 12971, 6315, 28744, 12897, 28747, 8882, 8469,
+    0, 16839, 0, 11759, 28824, 32830, 11046, 12440, 0, 0, 4822, 9388, 12756, 13026, 16765, 11308,
+    28741, 0, 11672, 17384, 11087, 11340, 9386, 28683, 11056, 9246, 12958, 0, 28741, 9919, 16930, 28823,
+    12528, 28793, 10493, 11041, 0, 28770, 12489, 12810, 16880, 28761, 13002, 12792, 0, 32894, 0, 0,
+    13026, 12761, 12730, 28690, 32843, 11386, 20487, 12523, 12888, 5111, 8612, 9948, 9607, 12969, 12647, 32890,
+    28808, 12584, 12992, 12429, 28740, 12298, 16777, 5535, 9853, 28715, 4825, 12850, 16463, 9907, 11151, 16844,
+    8778, 13076, 12430, 0, 12606, 8359, 12707, 12935, 32921, 28792, 0, 12372, 28781, 12820, 10492, 28794,
+    28695, 16815, 32891, 12780, 9087, 17398, 0, 16500, 0, 28785, 17328, 5625, 16620, 16677, 8364, 0,
+    9318, 0, 28738, 12695, 0, 12756, 12382, 32846, 12971, 11735, 17015, 17056, 28796, 8911, 8469, 6037,
+    0, 0, 32871, 16990, 17369, 12732, 12659, 20483, 16700, 12528, 28826, 12513, 9012, 16616, 12822, 12839,
+    6348, 9601, 9609, 0, 11355, 28696, 9077, 16430, 0, 28782, 12917, 9375, 32911, 12755, 9366, 0,
+    12575, 13018, 12009, 8424, 0, 28795, 9656, 8723, 9808, 13136, 32898, 32845, 11602, 10283, 12408, 12826,
+    32844, 12527, 20490, 11694, 13024, 12976, 13015, 32781, 28759, 16541, 20490, 12744, 17147, 32878, 8966, 11005,
+    12574, 12647, 8713, 16778, 0, 5077, 0, 11713, 28799, 28721, 12370, 12947, 8789, 11637, 12467, 12312,
+    28698, 10496, 8254, 12370, 10495, 12453, 12648, 0, 28780, 0, 12660, 17057, 32910, 0, 28702, 10215,
+    28726, 8722, 0, 13224, 6172, 9241, 12528, 0, 11727, 12552, 11201, 12983, 28815, 28794, 13052, 17135,
+    28825, 0, 28712, 12371, 28773, 17209, 16857, 28776, 10504, 5495, 9975, 13208, 16846, 12660, 28751, 12907,
+    28826, 5591, 12563, 10451, 11102, 28761, 17009, 12636, 0, 13032, 16570, 10803, 12860, 0, 12863, 17378,
+    8760, 0, 4984, 12959, 0, 9077, 8769, 28729, 28795, 10546, 8351, 28762, 10511, 5619, 9985, 28700,
+    16541, 28695, 28784, 32896, 32878, 5496, 12597, 6021, 20490, 0, 0, 28791, 5760, 28794, 11712, 13112,
+    20486, 9022, 11105, 10706, 17068, 12743, 10246, 0, 0, 11346, 16617, 17078, 13134, 12549, 11837, 17411,
+    28771, 28806, 13066, 32807, 11792, 13224, 28776, 12743, 17148, 11682, 0, 12551, 12777, 6178, 12852, 17136,
+    11047, 28702, 12632, 10976, 9564, 12907, 9974, 17065, 12002, 0, 12575, 12393, 9914, 0, 10848, 0,
+    10285, 5298, 0, 17388, 6049, 0, 28752, 11429, 10489, 0, 13004, 17207, 12840, 11275, 28731, 6208,
+    28742, 28805, 28790, 12911, 10513, 0, 12359, 32867, 0, 28796, 12792, 11142, 12820, 28781, 20489, 9672,
+    28694, 12880, 32921, 12574, 5106, 0, 10450, 17408, 0, 16541, 28808, 32888, 17220, 28786, 16619, 16609,
+    12899, 13120, 17409, 9320, 12575, 9683, 11606, 9375, 28828, 9563, 12969, 16672, 28810, 16529, 0, 11056,
+    11171, 0, 17082, 12681, 13087, 10204, 12515, 17124, 11056, 0, 17147, 13004, 0, 11391, 12418, 11102,
+    28749, 12379, 12930, 5077, 10757, 12907, 8490, 13031, 0, 17228, 12813, 0, 5460, 16895, 9077, 0,
+    0, 11925, 9908, 16846, 28706, 8788, 10967, 17079, 5657, 12705, 28681, 12501, 10198, 12852, 11978, 16912,
+    28750, 28681, 11387, 16835, 0, 16672, 12571, 0, 32866, 32819, 28805, 11385, 28745, 16764, 9087, 28718,
+    12488, 11393, 9021, 8489, 11481, 12888, 12693, 16845, 28757, 13133, 13029, 5621, 8480, 0, 32781, 13207,
+    0, 17083, 0, 0, 12791, 9385, 11758, 32833, 12408, 13198, 10677, 0, 28769, 0, 16936, 11627,
+    9085, 9022, 12599, 11724, 0, 20483, 12525, 13017, 11451, 12714, 12468, 9972, 13187, 28791, 32794, 12539,
+    13224, 28708, 9972, 12779, 12528, 17124, 12359, 28785, 12874, 12920, 28806, 28813, 11840, 32908, 28742, 10415,
+    16764, 10213, 6215, 17094, 12981, 10757, 28741, 0, 13027, 17078, 28708, 9975, 5626, 32867, 12765, 9311,
+    16745, 9606, 12563, 11386, 28816, 12875, 20487, 12660, 12920, 11685, 9607, 11103, 9598, 11970, 9917, 0,
+    12864, 32833, 0, 9665, 8788, 0, 11724, 16777, 16606, 12981, 8490, 28805, 10513, 5462, 0, 12704,
+    12900, 9813, 32929, 28742, 28724, 17411, 20482, 12839, 0, 11724, 10189, 6178, 11275, 12669, 9385, 17150,
+    12970, 0, 6347, 9387, 12767, 20489, 13027, 28796, 11438, 32781, 0, 28781, 16649, 17203, 13087, 6055,
+    11102, 32935, 0, 8769, 17003, 12706, 0, 12611, 10460, 28741, 0, 0, 17209, 13211, 28676, 6365,
+    16436, 16982, 16733, 28743, 28733, 28775, 0, 0, 13112, 28786, 16538, 13013, 28813, 28693, 17281, 12539,
+    12623, 13008, 10803, 9564, 0, 28827, 11440, 16895, 9919, 16973, 12851, 17072, 6321, 28682, 9337, 0,
+    0, 32931, 12706, 0, 11643, 10806, 16914, 28793, 12531, 16903, 8491, 10254, 12994, 12847, 17013, 17141,
+    28813, 20485, 12820, 8490, 12682, 0, 17203, 16621, 17332, 32910, 12058, 0, 0, 12635, 8423, 12694,
+    12670, 8300, 28707, 16778, 32855, 17011, 6429, 12395, 16855, 28719, 28773, 28691, 28677, 32920, 28739, 9385,
+    28796, 13126, 11104, 20486, 12873, 12995, 13209, 11779, 12756, 13160, 17226, 10803, 13114, 10556, 17081, 6354,
+    17239, 13004, 10560, 16993, 9021, 13032, 0, 17061, 28805, 10843, 28769, 6184, 16778, 32936, 13211, 0,
+    12672, 32903, 12767, 0, 13188, 0, 0, 10706, 6390, 6044, 12919, 0, 0, 16619, 28696, 0,
+    16895, 10262, 13020, 16459, 0, 0, 0, 6022, 17011, 0, 16586, 32934, 12912, 28696, 16698, 11179,
+    6021, 12969, 12840, 13089, 12942, 17173, 13222, 10546, 8424, 28796, 12575, 8789, 8778, 12934, 9984, 13114,
+    32894, 32838, 28706, 17147, 28814, 8250, 32889, 12343, 12444, 12811, 10845, 0, 28752, 28684, 10753, 6435,
+    5814, 17153, 13114, 16430, 12672, 0, 9311, 0, 20481, 32934, 12396, 17010, 32805, 4771, 0, 12058,
+    28697, 28771, 9619, 12953, 11056, 12988, 11685, 9321, 16963, 12695, 28777, 12671, 9356, 11393, 17045, 17157,
+    32818, 0, 28823, 10759, 13220, 28802, 32904, 11703, 13027, 10262, 12528, 0, 10850, 16688, 11099, 0,
+    32907, 13054, 6350, 11088, 12768, 12980, 12792, 6393, 13162, 13128, 12700, 10498, 9385, 28717, 12342, 12919,
+    17011, 10497, 32858, 12538, 32846, 12863, 28749, 12384, 28760, 32882, 12391, 13038, 8470, 11148, 10489, 12780,
+    10414, 28712, 0, 12708, 12885, 28695, 12971, 10452, 17387, 10072, 16542, 6180, 12552, 13092, 28760, 11309,
+    28718, 28790, 12958, 10552, 17095, 32816, 20482, 12900, 0, 12825, 5367, 11967, 6216, 32882, 32904, 12552,
+    6437, 6217, 17078, 13198, 12078, 0, 12489, 11732, 32832, 10284, 28761, 28778, 12719, 32924, 28704, 0,
+    12012, 28710, 0, 10546, 10161, 0, 12826, 10751, 10460, 13128, 12498, 12671, 5461, 32885, 17330, 28781,
+    11728, 0, 10176, 0, 11609, 16542, 0, 9348, 28777, 9152, 28776, 9985, 5658, 11401, 0, 11645,
+    10502, 13038, 12592, 32934, 0, 28789, 17002, 28735, 8480, 12972, 13000, 5664, 17201, 32883, 12796, 16420,
+    28796, 0, 28699, 6439, 12672, 12851, 13139, 12516, 17141, 16814, 8962, 10271, 9218, 28789, 28751, 17072,
+    0, 11640, 20485, 8440, 28789, 0, 12636, 8280, 8635, 6221, 16825, 12683, 32883, 17174, 11898, 32807,
+    9929, 12572, 17168, 0, 16857, 10883, 0, 5672, 17161, 12851, 0, 13050, 12875, 13212, 12564, 13212,
+    17083, 12910, 11711, 12683, 0, 11115, 28715, 0, 12576, 0, 0, 0, 8466, 16665, 9384, 28773,
+    13211, 32934, 9056, 9077, 9634, 11645, 11738, 32906, 13092, 28750, 12876, 11050, 28763, 28807, 16856, 12767,
+    12840, 13038, 17032, 9902, 17280, 9038, 28741, 13158, 12622, 0, 17288, 11392, 32895, 8491, 12813, 28731,
+    0, 32910, 28675, 28810, 13050, 12512, 32841, 0, 28789, 12919, 0, 28679, 28778, 28698, 9377, 28678,
+    28811, 8490, 6180, 9021, 13061, 6397, 0, 32846, 17229, 0, 0, 12899, 10343, 17229, 12823, 10430,
+    28720, 28815, 9778, 16459, 28721, 0, 11204, 13101, 32894, 32904, 17168, 9445, 28677, 0, 17282, 28757,
+    12886, 10573, 17147, 32882, 16879, 32897, 13113, 16579, 32920, 11182, 12755, 8359, 8977, 17288, 17131, 13062,
+    11930, 12551, 12636, 13049, 13222, 11645, 13092, 8272, 32870, 13073, 10850, 11102, 17281, 5099, 9618, 6355,
+    32818, 16808, 11893, 10569, 4728, 0, 12538, 28714, 0, 13114, 4807, 11442, 0, 11111, 0, 0,
+    17286, 9386, 12707, 12466, 32935, 12933, 6218, 17003, 11149, 28823, 10560, 12945, 12573, 10271, 9919, 0,
+    10578, 10363, 11608, 9516, 12452, 8854, 28678, 0, 16846, 12718, 9076, 12933, 32830, 0, 8722, 12876,
+    10497, 12799, 11312, 0, 12581, 11633, 28819, 12885, 4711, 32828, 0, 6355, 28704, 16430, 13102, 12972,
+    12501, 28808, 32892, 17070, 20489, 11692, 0, 28714, 32921, 28769, 0, 12852, 11821, 9000, 20486, 32923,
+    28804, 17410, 16922, 32896, 10859, 17288, 20488, 6223, 16911, 0, 20483, 16463, 0, 10561, 0, 12960,
+    28790, 17078, 32904, 17285, 12453, 28746, 17169, 12372, 28801, 8961, 13050, 11899, 11975, 16621, 11149, 11936,
+    11443, 17003, 9666, 0, 10217, 17298, 11545, 16779, 16658, 0, 0, 28691, 0, 0, 12684, 28725,
+    16934, 9610, 6356, 12780, 16778, 11971, 12803, 11686, 16666, 16529, 12492, 12514, 12512, 11928, 12407, 12946,
+    10162, 8368, 9684, 12550, 28784, 12874, 16506, 32793, 17281, 16832, 28819, 0, 12751, 0, 13103, 12396,
+    0, 10284, 12860, 28795, 11777, 12672, 28772, 13102, 9845, 9778, 11481, 12873, 13005, 9863, 12322, 28684,
+    28726, 9386, 0, 10218, 4965, 32869, 0, 9088, 11410, 16693, 12372, 11404, 10131, 11158, 10514, 16857,
+    17062, 32909, 8788, 13039, 12490, 10116, 10382, 12942, 17168, 17376, 11713, 28757, 12420, 28725, 12756, 11104,
+    10868, 6022, 28769, 11105, 32908, 11102, 12586, 11468, 13158, 11401, 17141, 10184, 13113, 12748, 28790, 17083,
+    8657, 17289, 9674, 13124, 0, 11197, 28801, 32858, 16445, 9088, 28719, 11981, 17354, 17004, 16657, 10812,
+    0, 12370, 16993, 17230, 28676, 9849, 13159, 28772, 11686, 6438, 28792, 9986, 12454, 17170, 12563, 6446,
+    11654, 12657, 28699, 13055, 12623, 4849, 12732, 28676, 13101, 6357, 32831, 17230, 16857, 12775, 11158, 28711,
+    28816, 28725, 8778, 28744, 12420, 28680, 28790, 0, 13102, 13169, 12768, 0, 28819, 11413, 12618, 17004,
+    28819, 12298, 0, 0, 32933, 0, 0, 8905, 0, 0, 28825, 12310, 28696, 32903, 6400, 28802,
+    13147, 12840, 13053, 32910, 17141, 9857, 0, 28673, 13039, 16526, 28747, 28762, 6398, 12741, 28807, 0,
+    11936, 28780, 0, 10859, 0, 10280, 17161, 10437, 12862, 4944, 6362, 12935, 28704, 13138, 6410, 28729,
+    11058, 6439, 5443, 10481, 28751, 0, 17320, 11741, 12393, 4998, 28802, 12995, 8999, 17083, 11443, 28808,
+    12894, 17001, 9983, 9376, 13020, 17282, 17230, 13074, 16914, 12002, 12659, 0, 32907, 0, 28766, 12309,
+    28785, 28762, 28827, 32937, 6261, 0, 28767, 0, 17290, 11899, 32897, 0, 17218, 13186, 0, 12744,
+    12569, 0, 10816, 12707, 10776, 8665, 8489, 12552, 12321, 28781, 12761, 9618, 11181, 13090, 12779, 0,
+    12390, 13151, 12599, 0, 11657, 32884, 10562, 11160, 16529, 28725, 11449, 20490, 10561, 0, 17012, 12479,
+    12695, 13077, 12355, 4826, 9609, 12551, 13029, 11252, 0, 17236, 13078, 12882, 11395, 16857, 17282, 32934,
+    12923, 12768, 9545, 12516, 11982, 13102, 9985, 12540, 6443, 17093, 6401, 12773, 28760, 10553, 12743, 0,
+    28686, 12876, 12563, 12908, 13073, 8469, 12551, 13176, 0, 12540, 13027, 6123, 16700, 10859, 16485, 12923,
+    12444, 11115, 17305, 4305, 8909, 9383, 28816, 10573, 28694, 11158, 13030, 0, 0, 10816, 28775, 13197,
+    0, 28703, 12515, 11449, 0, 17002, 28819, 28708, 11049, 17314, 12995, 28738, 12564, 12780, 17089, 10815,
+    13076, 0, 20486, 10813, 28740, 16654, 28754, 28697, 11075, 28683, 10502, 16933, 10264, 0, 10207, 16843,
+    32936, 12827, 13207, 17004, 17287, 12840, 9261, 11410, 0, 12894, 28815, 0, 28684, 28782, 9666, 28707,
+    0, 6363, 28767, 12900, 32844, 12935, 0, 32777, 10570, 9965, 8413, 32906, 28818, 16959, 9003, 28797,
+    11700, 28758, 12522, 11413, 28791, 0, 0, 32896, 9895, 11451, 16411, 0, 12882, 17211, 16584, 11502,
+    13114, 28710, 13074, 20484, 16527, 0, 28716, 16429, 11713, 32867, 11889, 28807, 5168, 9089, 6394, 13041,
+    28774, 17168, 10161, 10805, 0, 12591, 28800, 16587, 12527, 12696, 0, 12552, 28802, 0, 12454, 17014,
+    28735, 17162, 12296, 10668, 9982, 9219, 28742, 0, 13152, 12935, 8712, 28677, 13052, 32815, 12516, 9510,
+    0, 28788, 11158, 11114, 11741, 12467, 11872, 11112, 0, 12924, 12716, 13136, 11648, 0, 32820, 20482,
+    8283, 0, 32859, 12310, 13065, 32897, 0, 0, 8703, 12662, 0, 12612, 0, 13169, 16425, 10264,
+    10862, 32819, 12799, 17236, 13053, 28795, 0, 9676, 8708, 12947, 4562, 28681, 28779, 10570, 13042, 8621,
+    10758, 12540, 16650, 9089, 12695, 28798, 16665, 20487, 32804, 4597, 11657, 28696, 32869, 12864, 11476, 28741,
+    0, 12768, 13088, 9599, 11745, 12600, 28774, 17015, 16537, 11901, 0, 12635, 28785, 11160, 32792, 16830,
+    17238, 11768, 6357, 32872, 0, 28687, 17168, 16585, 0, 5656, 11937, 13074, 17247, 13166, 12908, 11938,
+    0, 16609, 0, 8949, 8318, 0, 28747, 9153, 0, 12960, 12720, 0, 0, 17093, 12310, 16697,
+    28779, 12515, 10263, 28822, 17280, 13198, 8721, 11443, 0, 0, 28798, 32855, 13006, 6399, 11404, 6411,
+    28776, 11712, 0, 13104, 12550, 16729, 17290, 13181, 12418, 6223, 17397, 17014, 17236, 12758, 9900, 28720,
+    0, 0, 13005, 16621, 0, 28703, 16491, 12581, 13065, 6400, 11700, 12980, 12779, 28685, 12510, 28705,
+    13066, 28744, 28697, 6440, 17148, 10872, 32856, 12574, 9064, 28712, 28826, 28680, 13054, 28751, 8869, 16421,
+    16588, 17305, 4307, 9538, 17045, 16500, 5712, 28785, 11872, 32780, 32885, 16807, 8307, 16756, 0, 11078,
+    13062, 12581, 13051, 12621, 32828, 12334, 5105, 6463, 0, 32885, 28762, 8312, 13168, 12652, 12406, 10274,
+    8953, 28808, 17296, 6454, 0, 10199, 12971, 32792, 10730, 9502, 12308, 17241, 12780, 11938, 11495, 12984,
+    12465, 0, 0, 16518, 0, 17249, 10414, 0, 10283, 12828, 8599, 28673, 12749, 13124, 13091, 0,
+    28727, 32911, 0, 0, 12380, 10871, 12624, 9657, 9563, 6445, 0, 10280, 13163, 10072, 0, 17253,
+    28722, 28806, 28760, 4822, 0, 9984, 0, 9686, 28719, 8617, 5402, 16614, 16519, 16993, 0, 0,
+    11901, 12491, 9246, 13091, 28714, 16666, 17062, 28772, 9983, 32895, 32916, 8960, 28825, 11943, 16448, 12758,
+    28691, 17072, 13103, 17079, 0, 11182, 28694, 17247, 13067, 9609, 28781, 0, 9507, 17315, 0, 17162,
+    32792, 12451, 0, 28824, 11466, 9620, 0, 0, 10659, 8461, 28798, 12916, 6189, 0, 17016, 12892,
+    13030, 12982, 8671, 28736, 9510, 32791, 16596, 32804, 4661, 28771, 6232, 28724, 11029, 6392, 11741, 9017,
+    11539, 13170, 12310, 6365, 12540, 13017, 11985, 11742, 5751, 11984, 11170, 17092, 6456, 0, 20490, 28771,
+    32917, 0, 8953, 9049, 17308, 16436, 16677, 12825, 8349, 11170, 12724, 0, 4405, 9584, 16825, 17013,
+    10570, 17171, 0, 9078, 8621, 16814, 11779, 16679, 16445, 10871, 12566, 12344, 6362, 8902, 10178, 12335,
+    12395, 17094, 28675, 0, 16439, 32780, 12417, 11137, 13103, 0, 10255, 12372, 28777, 0, 0, 10572,
+    17306, 12632, 8648, 0, 12653, 28810, 28682, 16999, 0, 11988, 8942, 9891, 13159, 16528, 9089, 28727,
+    17092, 10868, 17315, 12500, 20487, 17290, 16932, 28677, 16507, 0, 32933, 0, 9773, 11394, 28779, 32828,
+    17247, 10392, 0, 12539, 28711, 16936, 28767, 9063, 0, 10788, 12996, 11160, 6226, 11672, 11985, 20490,
+    28789, 9676, 10283, 16686, 11759, 28741, 11443, 32780, 28812, 12564, 0, 17325, 13101, 10861, 11180, 16667,
+    32829, 12975, 9973, 12550, 16729, 9006, 12563, 16765, 28725, 12516, 28799, 32894, 6117, 0, 12780, 28690,
+    0, 16685, 28688, 12833, 12996, 32805, 4996, 0, 12592, 17320, 0, 10503, 17351, 10327, 28733, 9905,
+    9076, 12617, 13220, 13181, 12347, 4401, 9947, 28798, 32779, 28707, 28750, 13223, 9038, 16677, 28733, 28828,
+    17002, 16446, 9830, 12679, 8582, 10956, 6463, 12647, 12749, 12936, 11999, 17092, 10580, 28674, 28762, 9217,
+    11171, 32910, 10232, 11566, 13076, 11167, 9309, 32841, 11769, 17173, 28694, 17309, 16753, 12552, 0, 28819,
+    0, 12814, 11750, 0, 13103, 13002, 11694, 6454, 0, 9066, 28769, 28795, 28714, 13128, 5894, 9503,
+    13164, 16507, 8689, 28770, 4949, 12549, 12311, 12462, 0, 8940, 10760, 12855, 4598, 10878, 10049, 10670,
+    28771, 10049, 0, 9950, 12921, 28796, 11742, 10215, 8957, 12451, 8480, 28827, 8655, 12583, 0, 28735,
+    16451, 13056, 16463, 5793, 13151, 11748, 0, 32804, 9214, 16686, 8402, 28739, 28781, 12500, 28739, 8619,
+    11907, 9585, 0, 8790, 28758, 32792, 11774, 28689, 0, 10882, 0, 10683, 9816, 13077, 32807, 8457,
+    28732, 32930, 28778, 16685, 17000, 28773, 28718, 12775, 28744, 28718, 12833, 6463, 12540, 12948, 12965, 8752,
+    0, 8688, 28722, 9958, 16519, 8935, 10637, 9618, 0, 0, 13159, 0, 12690, 16759, 0, 12690,
+    28714, 16528, 12525, 11182, 17318, 20486, 9078, 8694, 17095, 4716, 12405, 0, 28750, 11358, 11160, 12564,
+    13101, 16666, 0, 9672, 16666, 0, 12848, 12741, 12536, 12996, 9321, 28773, 11985, 28736, 17150, 12465,
+    28818, 0, 5513, 8650, 10758, 11775, 0, 17378, 12312, 0, 32844, 11991, 12706, 12942, 10273, 5629,
+    8649, 28795, 16509, 0, 12815, 12299, 10945, 0, 0, 8689, 28778, 28819, 8957, 0, 8232, 12765,
+    11742, 10398, 32807, 5981, 11049, 20490, 32871, 17299, 32780, 12718, 9256, 32871, 32802, 8245, 8555, 12680,
+    0, 28817, 12600, 16699, 17299, 17315, 9518, 10882, 10498, 0, 32806, 5381, 10543, 12797, 0, 9965,
+    16686, 13198, 0, 9471, 11181, 9672, 12727, 11476, 9219, 28748, 6448, 28744, 0, 0, 9663, 12513,
+    9647, 12868, 10693, 12786, 28787, 9177, 16461, 5047, 32819, 0, 12788, 8786, 11181, 13090, 13091, 13127,
+    16993, 0, 0, 0, 28746, 4971, 12607, 0, 0, 11844, 12418, 16618, 16824, 10584, 4883, 13114,
+    10391, 8351, 12776, 28692, 32911, 10946, 12324, 28673, 17148, 28784, 13186, 28748, 28710, 17081, 17280, 8368,
+    28704, 12333, 0, 28726, 11780, 13055, 20484, 17325, 16993, 11469, 13171, 16588, 12068, 10881, 12946, 0,
+    16587, 17016, 5045, 0, 8418, 28724, 11469, 12667, 20485, 28761, 13080, 10515, 0, 10434, 5205, 32936,
+    28725, 16460, 17004, 12776, 9374, 16608, 4470, 32827, 10370, 12587, 16430, 17174, 16606, 32814, 28786, 17151,
+    6298, 16463, 32817, 8703, 28703, 0, 8570, 11181, 16526, 17249, 32793, 28761, 16675, 0, 11756, 0,
+    0, 12863, 5035, 0, 28814, 8366, 17111, 11993, 8285, 28715, 9672, 11451, 28797, 6409, 28742, 12962,
+    0, 32917, 13193, 11750, 12848, 10168, 11769, 12392, 28784, 4977, 12832, 13116, 0, 12679, 12008, 12311,
+    0, 32843, 0, 13019, 13036, 10079, 28681, 13115, 13012, 28712, 32777, 20484, 32829, 12706, 32936, 0,
+    0, 28698, 32791, 13162, 0, 0, 12912, 17079, 9240, 16530, 12972, 11288, 6433, 32922, 12311, 8854,
+    16513, 11180, 16450, 6327, 8682, 12827, 0, 8957, 16807, 28793, 0, 16718, 28713, 28770, 12557, 10394,
+    13150, 0, 0, 16700, 0, 28685, 28761, 0, 0, 5092, 16908, 9593, 28773, 13004, 28727, 32815,
+    13020, 32820, 12384, 4472, 0, 32793, 0, 8390, 13223, 28769, 16756, 4700, 0, 16920, 32884, 5042,
+    6456, 12964, 10365, 13170, 12912, 16606, 0, 8787, 28707, 32845, 8966, 8564, 16586, 0, 28690, 4720,
+    28753, 28694, 6365, 8666, 12752, 16844, 10437, 12426, 28802, 10138, 0, 8704, 16535, 16851, 16665, 13185,
+    32934, 12775, 32820, 12348, 13205, 12742, 0, 6392, 9547, 28725, 13206, 16755, 12847, 12791, 28681, 8613,
+    13116, 12802, 9208, 16485, 32917, 16538, 16749, 9255, 17023, 11034, 28715, 32909, 12312, 9153, 9169, 11759,
+    28720, 0, 10775, 32781, 9517, 11985, 12742, 12599, 16959, 12510, 5569, 28693, 6457, 0, 16766, 0,
+    28687, 12741, 16834, 28718, 16449, 12391, 9219, 11944, 16518, 32777, 11476, 9606, 28683, 11245, 10538, 10285,
+    8491, 12827, 0, 28703, 11479, 12924, 28734, 13114, 28786, 12431, 5069, 12300, 17162, 12729, 9907, 0,
+    32816, 12041, 0, 13186, 28692, 10883, 8957, 28809, 12300, 28715, 12984, 12479, 9263, 0, 8713, 13198,
+    0, 9640, 13056, 32922, 0, 12320, 16538, 12747, 5327, 10882, 16439, 16789, 32792, 32894, 28682, 12672,
+    0, 16834, 32806, 12964, 28771, 12064, 12502, 28778, 12419, 28806, 12993, 12370, 13163, 17195, 9055, 12067,
+    32817, 12055, 0, 17003, 11765, 16536, 12599, 28818, 16764, 28737, 8858, 28681, 16835, 28675, 0, 16779,
+    6456, 8755, 8666, 8404, 12975, 28727, 11074, 0, 0, 10061, 11985, 28790, 28749, 16587, 28719, 28804,
+    9226, 32827, 9773, 16608, 13137, 10207, 9665, 12599, 16895, 12443, 28716, 28685, 12800, 32867, 16774, 17326,
+    17230, 12984, 28752, 11029, 5339, 16726, 9777, 9615, 8704, 16530, 8764, 12815, 10775, 13104, 28695, 11412,
+    9348, 0, 6038, 17358, 16959, 12948, 16503, 28779, 16766, 12811, 28817, 28779, 12707, 32794, 28798, 0,
+    17360, 12380, 5334, 28683, 8771, 28690, 13068, 13188, 12538, 9263, 28674, 12884, 0, 17174, 16539, 0,
+    10370, 12803, 28795, 4992, 12622, 28828, 13185, 20485, 12900, 12576, 11910, 12836, 28746, 12444, 4818, 20487,
+    12310, 28736, 28689, 10804, 5613, 12680, 11657, 28733, 8713, 28746, 0, 8477, 28744, 8648, 0, 12956,
+    0, 28762, 13162, 16983, 17361, 13185, 28756, 8368, 28742, 9492, 28726, 12752, 5483, 28768, 17408, 12703,
+    9055, 0, 12503, 16457, 28760, 16461, 13116, 16687, 12360, 12058, 28779, 12311, 0, 32792, 0, 16754,
+    0, 0, 4700, 0, 13198, 12028, 28769, 0, 9915, 0, 11273, 28759, 0, 0, 0, 11328,
+    10370, 28796, 16460, 0, 13208, 16462, 17364, 28704, 0, 17359, 12643, 9263, 16851, 5361, 13007, 13066,
+    5791, 32779, 0, 12393, 28707, 16774, 12066, 32806, 5156, 12537, 9019, 32870, 20481, 11411, 5640, 8658,
+    32805, 9259, 9601, 13186, 17141, 28825, 32863, 9348, 28769, 12968, 12988, 16618, 10676, 13194, 32779, 9984,
+    13223, 28772, 8405, 28756, 28714, 32894, 32843, 0, 12836, 9571, 11947, 13186, 12561, 20488, 17409, 13138,
+    0, 9301, 12669, 12321, 12538, 16539, 0, 6455, 4722, 16893, 6226, 28747, 12055, 13080, 16991, 16844,
+    13148, 12605, 12617, 12588, 0, 13210, 28726, 16688, 12064, 10115, 0, 0, 28741, 28728, 28760, 12875,
+    13199, 8475, 0, 12348, 8423, 13092, 16447, 17331, 28766, 32923, 10994, 5644, 0, 0, 13112, 28762,
+    9877, 5367, 13198, 5098, 28730, 0, 5478, 13116, 32827, 0, 0, 13164, 12568, 9321, 16936, 28792,
+    0, 28754, 11702, 17269, 8920, 0, 8576, 13187, 0, 12477, 28815, 28734, 16755, 32836, 17360, 9687,
+    12624, 12691, 9387, 16491, 12982, 0, 0, 28792, 8773, 0, 11368, 28759, 10997, 12537, 12468, 28687,
+    10670, 5451, 17365, 0, 28676, 32780, 12417, 9263, 12380, 28772, 28754, 4949, 32806, 11555, 32820, 0,
+    32936, 0, 12743, 28683, 28708, 10448, 0, 9042, 10862, 9071, 9816, 0, 12765, 0, 8904, 0,
+    20490, 32934, 28757, 28718, 17384, 10281, 9059, 10572, 0, 4722, 5855, 5069, 32832, 12429, 12478, 12932,
+    12596, 13209, 32819, 32866, 6327, 28719, 12993, 0, 28678, 0, 0, 13161, 11888, 12691, 10852, 12658,
+    16901, 12064, 16529, 16541, 13217, 28755, 28682, 9676, 17172, 16609, 28706, 32924, 10151, 16526, 5987, 16523,
+    17094, 12562, 28792, 0, 12669, 0, 12787, 12774, 8475, 5103, 17329, 13199, 0, 0, 28744, 12058,
+    16771, 12922, 8768, 16447, 28748, 10125, 13157, 12711, 13195, 9854, 32818, 12619, 28737, 13032, 11378, 28745,
+    8477, 11585, 17329, 0, 9297, 16649, 0, 8393, 32872, 17329, 12967, 6235, 12778, 12765, 28818, 28771,
+    28776, 9892, 9841, 13148, 6130, 9641, 17015, 0, 9387, 0, 9343, 28723, 17171, 13217, 32863, 10456,
+    28745, 5836, 0, 9320, 28817, 11544, 28771, 16696, 10378, 17367, 16700, 12295, 12702, 6365, 5809, 12885,
+    13200, 12993, 9518, 8482, 32802, 8249, 9609, 11267, 16878, 12041, 0, 10171, 12619, 28695, 0, 13209,
+    10674, 12787, 11151, 12068, 13140, 16539, 0, 10044, 12860, 12692, 9461, 6234, 12525, 16672, 0, 10108,
+    28718, 28733, 5478, 13175, 20484, 11712, 32865, 8721, 9887, 17093, 12309, 12559, 0, 17329, 12585, 32865,
+    0, 0, 12645, 13134, 12606, 11300, 16673, 28774, 12801, 12872, 28746, 12807, 28739, 16462, 0, 9371,
+    16578, 0, 28700, 12884, 13104, 5992, 20481, 11328, 10676, 16737, 28804, 16719, 16509, 0, 32804, 8291,
+    12887, 10676, 10444, 12827, 32777, 28700, 0, 32780, 16853, 28736, 16766, 13092, 5827, 9140, 0, 8453,
+    0, 10216, 28804, 28771, 13107, 17194, 11678, 10191, 12863, 10444, 4983, 12513, 28720, 17162, 0, 0,
+    12798, 0, 13223, 13056, 12599, 32936, 0, 16618, 28699, 0, 16979, 16497, 12321, 28819, 5361, 0,
+    0, 10198, 0, 16979, 12473, 10580, 16972, 16667, 9807, 28786, 28758, 11625, 17173, 12788, 12838, 0,
+    28696, 28740, 17123, 28820, 12810, 28708, 32837, 11328, 4278, 12731, 0, 0, 8548, 17172, 16972, 17393,
+    12012, 12415, 12395, 28722, 12563, 10704, 4773, 0, 16542, 12732, 9068, 12067, 10786, 0, 28814, 10813,
+    9302, 9463, 16426, 10407, 32845, 12695, 10878, 5098, 12527, 17012, 8712, 28713, 12904, 0, 5104, 0,
+    12772, 0, 6133, 28720, 13004, 12895, 28702, 13005, 8474, 9649, 9310, 0, 0, 12312, 32792, 12636,
+    28730, 8412, 0, 13183, 32831, 0, 10145, 28781, 28756, 12078, 0, 12588, 0, 0, 32854, 0,
+    0, 0, 10494, 12636, 10705, 5440, 11296, 8784, 16529, 12074, 12034, 16920, 32884, 28688, 20481, 0,
+    10831, 17374, 0, 0, 28796, 12799, 16674, 11555, 28734, 16539, 12742, 10206, 12443, 28695, 32794, 8367,
+    16778, 12466, 12501, 6015, 12382, 28797, 9256, 17319, 4462, 0, 17192, 32885, 12703, 17250, 9012, 11333,
+    10458, 28760, 0, 16542, 13152, 12804, 12809, 10264, 16777, 16972, 12076, 13137, 20488, 5987, 12563, 0,
+    13163, 12730, 13163, 11112, 12694, 12714, 5459, 28740, 8389, 12791, 17201, 16598, 28787, 28705, 12540, 8776,
+    12346, 6000, 8776, 12503, 10539, 20488, 16936, 17361, 9971, 9264, 5608, 17044, 9559, 0, 11159, 6210,
+    0, 12598, 17393, 11129, 0, 13212, 9649, 28726, 28748, 28700, 6122, 28826, 13186, 0, 10152, 28718,
+    10327, 0, 28771, 28718, 16769, 9357, 16700, 11136, 28784, 10240, 12066, 0, 0, 28724, 13224, 9308,
+    32780, 9318, 8982, 12486, 11130, 9892, 28711, 28730, 0, 17252, 17072, 16579, 12680, 10412, 12348, 28759,
+    16855, 12562, 8479, 12634, 12430, 0, 8760, 12645, 28808, 10407, 28699, 12587, 12564, 13164, 13092, 12828,
+    28734, 5612, 12077, 28766, 0, 28706, 12799, 9839, 10108, 28819, 16657, 17195, 10450, 0, 12576, 13188,
+    13028, 28822, 28828, 13188, 28694, 13207, 11301, 12971, 0, 12810, 9077, 8424, 28770, 9665, 16980, 12897,
+    12785, 5619, 28750, 28741, 9919, 0, 0, 28811, 9564, 12809, 16537, 28758, 16462, 0, 6277, 16855,
+    0, 9265, 11004, 17262, 12466, 11010, 6235, 28816, 16972, 12372, 28750, 11435, 9365, 8723, 10709, 12672,
+    28765, 16430, 0, 9649, 28812, 12562, 28710, 28817, 16687, 28735, 28719, 28703, 32911, 10703, 28763, 11340,
+    6004, 12755, 28694, 0, 10710, 8682, 12693, 11301, 13220, 12798, 17044, 0, 0, 0, 9327, 16462,
+    12776, 10504, 10451, 0, 12430, 9617, 28810, 11045, 28817, 12300, 0, 12764, 12586, 16855, 9085, 28718,
+    28795, 0, 5364, 8760, 28818, 0, 32807, 8783, 28674, 0, 32917, 16867, 12665, 5496, 16682, 0,
+    0, 12887, 5613, 13200, 10145, 12620, 5212, 8777, 13222, 28693, 11337, 17138, 10412, 12659, 28724, 9241,
+    12741, 0, 28808, 12850, 5494, 8722, 12839, 28807, 9747, 9674, 5245, 11450, 11047, 32844, 17151, 10449,
+    11478, 16429, 13224, 28759, 0, 20485, 28703, 28805, 28712, 0, 28750, 0, 5762, 12504, 12312, 16844,
+    28820, 28781, 6349, 13064, 16620, 12574, 12369, 28763, 6314, 13103, 32807, 5797, 12852, 0, 8723, 12930,
+    0, 8368, 0, 16516, 0, 5585, 16616, 32842, 28680, 0, 28786, 16462, 5591, 28749, 12659, 0,
+    12504, 9387, 0, 6455, 32866, 32854, 8267, 12677, 28710, 5110, 16767, 16538, 32777, 12876, 28793, 0,
+    0, 32794, 0, 28763, 13172, 20489, 0, 12657, 10152, 0, 12466, 32935, 0, 28760, 8789, 17253,
+    0, 16779, 12619, 28684, 13224, 0, 10677, 0, 28780, 0, 17387, 17090, 0, 12491, 12899, 32781,
+    13003, 5488, 28760, 0, 13014, 11275, 10497, 0, 9085, 32872, 12791, 28727, 6376, 5922, 11598, 9360,
+    32867, 16584, 12917, 9573, 16982, 10214, 28820, 6315, 10198, 5650, 12407, 12683, 13004, 32884, 10444, 12916,
+    12958, 8788, 32880, 32793, 12671, 28825, 28791, 9319, 16912, 28809, 13174, 9385, 0, 16989, 0, 12518,
+    12969, 28751, 28719, 0, 17237, 17375, 0, 5657, 16895, 0, 32874, 12563, 12730, 11306, 12959, 28735,
+    17386, 20485, 12755, 16974, 16693, 10714, 32855, 17123, 0, 10711, 12907, 9265, 12803, 9388, 9918, 10742,
+    28681, 13120, 8489, 0, 12717, 11307, 12527, 32924, 28828, 6380, 5494, 0, 12837, 12732, 0, 12296,
+    28742, 6043, 12823, 0, 0, 10539, 13115, 28742, 12874, 12810, 28718, 9387, 28756, 12803, 10116, 0,
+    32828, 0, 12801, 12945, 32844, 13017, 12682, 28765, 0, 0, 16517, 16999, 8424, 5617, 9616, 17399,
+    10264, 12586, 28824, 28807, 28822, 32781, 8722, 10490, 9130, 0, 32891, 12609, 17411, 8930, 16541, 5496,
+    0, 28819, 10757, 32857, 12708, 13024, 12684, 16648, 17059, 5894, 32880, 17015, 16981, 12612, 28729, 12851,
+    12380, 12705, 12453, 10162, 16698, 10760, 28770, 13106, 10459, 28748, 0, 10198, 16460, 9357, 12818, 0,
+    28760, 0, 13091, 17057, 10793, 13173, 16777, 32881, 10788, 0, 28715, 10512, 0, 17129, 12916, 12777,
+    9609, 10198, 9375, 10751, 12900, 10748, 20487, 12537, 16844, 0, 16764, 0, 10793, 12660, 12742, 20486,
+    0, 13095, 28740, 10510, 12718, 0, 12730, 16621, 9609, 9664, 32909, 28825, 12920, 0, 16844, 10557,
+    17202, 0, 0, 17206, 32843, 12552, 12622, 6048, 13120, 0, 12587, 32817, 20482, 16447, 32854, 12819,
+    8713, 11953, 0, 28818, 4678, 16993, 28748, 12467, 11382, 12515, 6299, 10272, 6431, 5658, 28713, 13044,
+    28776, 28798, 9686, 11684, 28822, 17149, 12467, 12696, 16529, 8769, 12780, 12619, 11595, 0, 0, 32893,
+    32820, 28773, 11850, 9862, 28820, 28787, 28739, 10759, 12612, 28777, 32846, 12622, 32843, 16974, 9606, 12909,
+    4611, 9674, 32887, 12744, 16687, 32854, 32855, 17136, 11092, 12360, 28750, 10215, 11087, 28773, 32866, 5486,
+    13223, 0, 0, 13017, 10750, 12575, 17320, 5211, 12414, 17226, 0, 16588, 12780, 0, 0, 28751,
+    32828, 32876, 12619, 10413, 0, 28701, 12442, 11087, 12814, 16990, 0, 16693, 12538, 28747, 12563, 12599,
+    10677, 0, 11343, 10498, 32807, 6309, 0, 9021, 28694, 0, 5625, 0, 10789, 32883, 0, 10461,
+    28717, 4364, 6179, 32888, 16694, 8440, 20489, 32805, 4756, 10750, 12439, 28684, 12001, 28806, 12504, 11600,
+    10976, 9674, 17409, 28736, 17001, 6205, 28707, 4294, 12839, 32883, 17378, 28817, 5462, 32857, 9687, 28789,
+    10546, 10512, 11312, 0, 17080, 13196, 28777, 12730, 12754, 0, 32776, 11309, 11050, 6168, 9321, 0,
+    5590, 5922, 16578, 11434, 12945, 0, 12707, 10546, 5928, 0, 9307, 0, 12884, 16506, 0, 13183,
+    0, 5620, 28749, 20487, 8396, 28798, 20487, 28775, 11639, 16677, 32833, 12970, 28764, 0, 0, 12766,
+    5672, 0, 12406, 32891, 10843, 32892, 12587, 8955, 12312, 32806, 16680, 8424, 11644, 10758, 12850, 17072,
+    12622, 11391, 16895, 5657, 11057, 32855, 28742, 13027, 12825, 5495, 10215, 32875, 12849, 9210, 0, 13127,
+    11088, 16770, 12491, 28784, 8768, 0, 32817, 12551, 32801, 12484, 28809, 28680, 6216, 11410, 0, 20486,
+    28752, 13104, 17002, 12958, 28743, 6043, 17253, 28789, 28788, 6145, 10268, 32846, 12958, 12563, 10054, 32856,
+    28761, 32929, 32858, 8664, 0, 9606, 12427, 28816, 0, 12659, 12728, 28744, 16533, 12692, 0, 12885,
+    16903, 12620, 10794, 32794, 10247, 12743, 12765, 13152, 12819, 17410, 9087, 9466, 8965, 10247, 12682, 13173,
+    28809, 16778, 17309, 10545, 0, 17329, 12358, 17405, 12492, 11866, 12696, 28799, 20488, 12300, 32933, 0,
+    32816, 12744, 10504, 0, 17397, 16458, 11223, 32858, 11142, 16856, 28751, 12972, 11401, 0, 17202, 12468,
+    12634, 11480, 9652, 28794, 20487, 12432, 12996, 28683, 12732, 32856, 16778, 10507, 32894, 12931, 28800, 12819,
+    12910, 12982, 32879, 13209, 0, 16762, 0, 0, 9068, 17219, 8641, 12623, 16922, 13019, 28823, 12732,
+    6210, 0, 12696, 9833, 28753, 28748, 10271, 28810, 11441, 13004, 13027, 12696, 10043, 11829, 9328, 12718,
+    11829, 12528, 12943, 28769, 17209, 0, 13146, 9366, 6344, 13146, 28732, 13037, 9022, 10797, 28682, 20488,
+    9366, 12788, 9908, 16857, 12948, 28788, 11093, 0, 11843, 0, 10803, 0, 32888, 12718, 12468, 28728,
+    17158, 12993, 8491, 0, 12574, 0, 12804, 20489, 11272, 28695, 17218, 5928, 28828, 17316, 13091, 0,
+    13173, 8788, 0, 28750, 28711, 12756, 13163, 0, 11312, 16406, 13079, 0, 17004, 28725, 5017, 10550,
+    28756, 12636, 9926, 13050, 17144, 12921, 28711, 0, 32856, 9674, 12678, 28678, 8285, 11639, 11605, 28731,
+    10090, 28741, 0, 32888, 0, 9941, 28691, 0, 10262, 28743, 28764, 12588, 12732, 12382, 11103, 12968,
+    9235, 12552, 8790, 0, 6178, 11728, 13037, 28714, 13113, 12918, 13099, 0, 32858, 9806, 0, 6355,
+    11700, 28761, 0, 12814, 11712, 12509, 12636, 11054, 17093, 16541, 0, 28691, 13090, 12584, 8405, 12970,
+    17149, 13219, 9022, 12502, 28736, 11309, 0, 9372, 28750, 4285, 12779, 6384, 12312, 32871, 17157, 17218,
+    28695, 12814, 12415, 10546, 32894, 17281, 10560, 12504, 17279, 32882, 5674, 28697, 10760, 6217, 28756, 9003,
+    8779, 0, 0, 8880, 13102, 32820, 12549, 32898, 0, 12420, 28708, 8789, 17281, 0, 0, 10797,
+    32933, 5026, 9953, 28782, 12881, 11146, 0, 12864, 8787, 32779, 0, 12527, 11309, 28778, 12774, 17230,
+    11312, 11844, 0, 17075, 0, 32896, 12660, 28726, 17132, 32892, 11412, 16657, 28793, 28801, 28775, 9687,
+    9985, 10758, 8322, 28694, 12755, 11864, 12464, 17161, 6213, 28733, 13200, 8712, 12959, 9343, 28776, 8610,
+    12575, 6214, 32819, 6349, 6180, 28712, 0, 0, 12911, 28787, 11149, 8713, 17172, 10551, 9320, 9320,
+    13146, 11685, 12719, 0, 28757, 16530, 0, 12648, 20488, 16766, 9367, 10064, 9059, 0, 12599, 17080,
+    12813, 9687, 12683, 16596, 28798, 28802, 10262, 17354, 13195, 28708, 12077, 12707, 6386, 10844, 0, 17072,
+    16764, 8744, 32905, 6321, 28798, 0, 17220, 8926, 12851, 8309, 13053, 16924, 12660, 12909, 28723, 12485,
+    0, 12056, 0, 16856, 11387, 13073, 11143, 6055, 0, 12564, 17071, 13127, 12840, 9077, 12719, 11059,
+    10206, 5309, 28770, 10794, 10504, 12570, 10254, 11099, 12791, 32897, 28826, 12875, 12427, 28719, 13114, 10559,
+    16886, 16880, 28783, 10578, 17083, 5928, 16595, 12708, 13028, 6232, 12931, 12732, 9986, 28706, 4959, 16421,
+    12944, 12972, 13210, 0, 17208, 16827, 12886, 32904, 12623, 28801, 32858, 8647, 28778, 12607, 32923, 0,
+    12588, 12996, 12600, 12744, 12559, 28743, 12665, 28730, 0, 12319, 10801, 32839, 9811, 16529, 6393, 6181,
+    11093, 0, 12492, 11104, 11387, 10215, 12779, 17253, 0, 16699, 12755, 17010, 28766, 0, 28828, 12803,
+    28737, 32936, 11477, 17151, 17004, 6393, 12850, 32829, 13052, 11402, 12792, 8272, 0, 10815, 12887, 12531,
+    9791, 0, 16934, 12767, 28754, 11686, 0, 32828, 5663, 9367, 16750, 11603, 9984, 11639, 20488, 0,
+    12716, 12298, 28761, 8489, 11692, 28809, 12743, 16936, 17089, 13038, 0, 0, 28793, 17160, 16857, 9956,
+    12514, 10026, 28691, 12887, 11413, 8480, 12348, 11648, 4624, 32906, 28805, 12804, 28700, 8903, 12851, 11402,
+    28768, 28771, 32846, 0, 12695, 11608, 9796, 12380, 8751, 32871, 9078, 9021, 9682, 9844, 12671, 28744,
+    12946, 28703, 16586, 0, 6353, 28800, 28805, 28718, 32832, 13116, 32937, 0, 13096, 10506, 0, 32794,
+    28798, 10546, 13184, 28726, 13184, 0, 8790, 13007, 0, 17348, 8253, 10806, 28716, 6437, 13113, 32872,
+    16933, 11239, 8344, 10862, 17090, 16965, 9986, 6328, 12995, 11757, 12894, 32778, 8480, 8491, 12994, 12780,
+    12521, 11114, 32884, 32882, 0, 17369, 32843, 13211, 17281, 10578, 12404, 28677, 17237, 12612, 12536, 12791,
+    16880, 10853, 28707, 8788, 28763, 12728, 13174, 16925, 32870, 16925, 28745, 4661, 11158, 12463, 9561, 12954,
+    28740, 10575, 8424, 0, 13128, 8918, 0, 16429, 0, 32859, 13005, 10271, 12959, 12804, 16801, 12744,
+    8575, 11445, 17132, 28691, 9917, 12760, 13051, 13043, 16437, 9767, 10751, 12983, 10190, 12984, 12588, 12946,
+    12334, 0, 9833, 17014, 12544, 10514, 8674, 12827, 16857, 12406, 16729, 4463, 28799, 17239, 8942, 0,
+    28774, 12456, 0, 10114, 17236, 12334, 10216, 28737, 9851, 28761, 9387, 13063, 13055, 4853, 28802, 0,
+    0, 6277, 13001, 11402, 12077, 0, 10853, 32780, 9002, 12624, 0, 8876, 32791, 8942, 9078, 13136,
+    9817, 9218, 0, 28793, 16814, 28753, 12676, 12993, 12418, 12346, 8582, 0, 9246, 28742, 5666, 32882,
+    8285, 16823, 12576, 11701, 16894, 0, 13112, 8613, 6327, 28760, 12683, 28712, 13005, 32844, 16699, 9905,
+    10204, 12453, 0, 32922, 12430, 32894, 28823, 17162, 11105, 5665, 12995, 0, 10577, 0, 17090, 12935,
+    17091, 4932, 16596, 9349, 0, 0, 13103, 16507, 6361, 20485, 13063, 32885, 8966, 9908, 28800, 5192,
+    12588, 9260, 20488, 12366, 16450, 28802, 28729, 10852, 12467, 17092, 13062, 32843, 13053, 12800, 6058, 32802,
+    4306, 28743, 17377, 0, 12789, 17159, 12418, 4266, 28796, 17378, 0, 11441, 32894, 0, 9215, 11311,
+    16677, 12768, 28684, 32936, 28777, 9473, 11872, 32911, 12826, 9642, 11152, 11889, 16733, 8664, 12957, 12515,
+    6438, 6393, 8359, 12296, 8789, 12077, 0, 12513, 16421, 12912, 12772, 12336, 11937, 5666, 10272, 6356,
+    0, 16914, 12826, 0, 28743, 17131, 17386, 0, 12623, 16857, 16413, 0, 12431, 28821, 32831, 13224,
+    8359, 0, 0, 12334, 9817, 12640, 28742, 0, 12947, 16539, 28693, 11442, 6226, 17093, 28749, 6444,
+    0, 0, 11159, 12947, 16620, 11608, 28779, 28809, 28722, 16517, 6186, 4518, 0, 0, 0, 12440,
+    12511, 8689, 28699, 10132, 0, 10516, 0, 9851, 11295, 0, 10255, 6463, 12972, 12075, 12382, 17174,
+    0, 32909, 0, 16762, 10338, 16756, 28781, 8949, 12552, 0, 11177, 10576, 10869, 12606, 28690, 8853,
+    9845, 5962, 13103, 13210, 0, 0, 10796, 12612, 9299, 28675, 11866, 9089, 32859, 11204, 16428, 28750,
+    12767, 11414, 0, 13089, 12502, 11169, 17281, 0, 0, 28771, 10441, 9173, 0, 13019, 13067, 28732,
+    16485, 8995, 28715, 0, 12850, 0, 32896, 12299, 12801, 12540, 10570, 13075, 32846, 13019, 0, 12347,
+    16412, 17298, 0, 12688, 6100, 17238, 13029, 11357, 28681, 0, 28740, 0, 0, 17282, 12636, 12465,
+    32933, 11446, 28809, 28783, 12372, 12789, 16841, 9164, 28732, 0, 13066, 10869, 12924, 13159, 9388, 12704,
+    20490, 16756, 32898, 20489, 0, 12983, 0, 9676, 5745, 32830, 28686, 10868, 8256, 0, 11931, 12659,
+    11304, 9935, 12499, 13031, 13159, 16841, 11152, 11703, 11414, 13064, 28744, 9608, 12900, 12935, 28779, 12429,
+    11168, 9473, 28806, 11694, 12300, 28779, 0, 12860, 11685, 0, 0, 12366, 16462, 20482, 0, 0,
+    13019, 28744, 13149, 28687, 9000, 4432, 28791, 8779, 13054, 13113, 12804, 28735, 10571, 28675, 13044, 17220,
+    0, 12323, 11712, 11468, 32935, 0, 11103, 28730, 11458, 28824, 13079, 8713, 0, 32879, 28797, 11655,
+    32803, 12640, 17297, 12869, 12947, 17082, 13158, 16918, 11780, 10563, 32883, 28685, 5961, 12636, 6056, 28753,
+    10625, 12478, 17164, 16598, 6365, 28689, 12898, 13136, 6361, 12816, 8790, 11713, 16744, 28754, 0, 11694,
+    12856, 16508, 10377, 10582, 0, 0, 28793, 11711, 0, 32916, 13115, 9648, 12788, 17308, 12779, 0,
+    12031, 32806, 5182, 10483, 12852, 13219, 28735, 17297, 0, 11460, 8244, 32819, 12355, 12492, 11756, 13054,
+    11457, 12947, 10255, 11978, 0, 28790, 32869, 13101, 0, 13066, 0, 28716, 8619, 28801, 28744, 13164,
+    5212, 28755, 28731, 6186, 13019, 32803, 16417, 32859, 28713, 28772, 28819, 0, 32818, 0, 12972, 12936,
+    0, 13041, 28812, 16448, 11467, 12908, 17239, 17309, 6410, 5458, 11538, 12885, 12924, 5202, 11935, 12660,
+    32815, 17309, 12491, 28727, 12540, 12736, 6394, 10057, 16937, 17161, 16609, 32806, 5237, 12827, 12826, 5971,
+    9773, 17165, 12919, 28783, 10924, 13043, 16921, 5454, 16813, 17092, 6186, 17094, 4429, 17287, 12898, 12431,
+    17090, 28725, 28798, 32792, 0, 9983, 12540, 9676, 28775, 11467, 12358, 32923, 16530, 12504, 12478, 12984,
+    8490, 13103, 12473, 0, 12801, 17246, 32908, 28704, 0, 12563, 10870, 12510, 28810, 28814, 17411, 11934,
+    0, 13150, 10974, 28690, 12371, 28776, 8851, 12995, 13066, 0, 0, 32846, 0, 12404, 32779, 12415,
+    17405, 28761, 16577, 8785, 32884, 13031, 0, 12648, 16807, 12948, 6226, 0, 11900, 28805, 8285, 20484,
+    9304, 16617, 12900, 12948, 0, 28729, 32872, 13067, 17408, 12768, 11114, 11159, 17297, 11703, 12403, 28720,
+    17248, 13199, 12900, 9905, 28697, 28726, 6456, 8881, 17003, 28685, 0, 10273, 16807, 28817, 11938, 28697,
+    32815, 32897, 6440, 12996, 11171, 0, 11442, 12583, 6226, 28820, 16413, 13113, 17287, 11161, 12321, 17315,
+    11169, 28813, 12996, 12628, 32820, 9909, 16607, 28715, 16813, 9918, 16697, 16948, 0, 12322, 28687, 12368,
+    16743, 11114, 10579, 17020, 17116, 16500, 12864, 11953, 8985, 16688, 0, 28705, 10735, 12935, 11169, 28735,
+    13159, 9878, 17172, 8611, 16463, 16729, 13077, 12651, 32781, 9914, 17094, 16777, 16585, 10637, 10584, 9538,
+    0, 17172, 16665, 20481, 11713, 0, 28799, 13102, 28725, 12525, 5665, 10583, 5070, 28744, 11467, 12638,
+    28700, 9245, 12323, 9066, 0, 12431, 17411, 0, 0, 12444, 12756, 0, 32819, 28803, 12828, 16530,
+    10393, 9388, 12300, 13194, 6233, 8582, 12465, 6455, 16729, 12696, 11404, 12768, 17399, 12335, 9687, 16518,
+    0, 17317, 12812, 11470, 0, 9666, 6399, 0, 12767, 8620, 12581, 12854, 8322, 13067, 32807, 8439,
+    28704, 10138, 11748, 0, 13080, 6365, 12622, 10898, 32856, 16436, 13125, 12404, 0, 12870, 0, 0,
+    8876, 0, 6466, 16913, 12960, 13044, 32778, 11412, 16500, 9274, 28700, 12779, 6455, 11413, 12648, 4436,
+    11034, 10199, 32840, 8790, 12562, 13077, 28674, 6411, 16775, 17094, 11478, 12747, 12552, 17299, 11171, 8648,
+    10598, 28821, 0, 12406, 17237, 12591, 12562, 28674, 32778, 12976, 0, 12663, 9502, 10217, 28702, 9537,
+    0, 0, 8278, 12734, 12032, 16684, 11394, 12864, 12936, 0, 28698, 12038, 8606, 16451, 10317, 6116,
+    4594, 12334, 0, 16840, 0, 16822, 12953, 12546, 8351, 17348, 17309, 16508, 28731, 0, 12897, 12372,
+    16943, 32895, 0, 0, 9263, 6399, 0, 8272, 8946, 28745, 28713, 32804, 8617, 11630, 0, 16518,
+    0, 32923, 16607, 9215, 32904, 16937, 32872, 16597, 5059, 0, 12540, 0, 9663, 28720, 17317, 10608,
+    0, 12492, 32779, 0, 9300, 28736, 16674, 0, 12629, 4596, 12960, 12480, 28691, 12689, 32803, 11469,
+    20487, 28725, 9983, 28743, 11657, 13044, 13109, 32846, 13124, 12524, 9245, 16772, 32830, 11171, 12432, 9506,
+    0, 6448, 12831, 10580, 16588, 12834, 32779, 11013, 9506, 28828, 12912, 11701, 13140, 4467, 12323, 12759,
+    16537, 28723, 11476, 12322, 10282, 12507, 12464, 9616, 9084, 10162, 16588, 5798, 12948, 11610, 4682, 0,
+    12980, 6455, 17408, 12355, 16925, 0, 11741, 16437, 13079, 12643, 28698, 16438, 32793, 0, 12910, 12888,
+    13065, 32833, 12415, 12595, 28711, 12695, 32807, 9353, 12792, 28782, 9348, 11945, 12960, 0, 12936, 0,
+    10069, 28686, 12720, 13007, 0, 28760, 32840, 9468, 12710, 16508, 4309, 12569, 12989, 28814, 0, 12310,
+    17173, 13132, 9961, 28682, 12455, 12802, 16697, 0, 28703, 12970, 16840, 0, 10907, 13160, 11171, 0,
+    12347, 4689, 28729, 28691, 17346, 16578, 28755, 8282, 16517, 12976, 0, 0, 28815, 4822, 13169, 28702,
+    12512, 13006, 6466, 0, 0, 13030, 0, 0, 16893, 12311, 28745, 11240, 12934, 11766, 8936, 4880,
+    8953, 10283, 28682, 20488, 12420, 12696, 13128, 4630, 12684, 11756, 8716, 12847, 28703, 16816, 32777, 12312,
+    12491, 10362, 32911, 11181, 16767, 0, 0, 0, 28685, 13200, 28679, 5969, 28755, 12739, 12039, 8954,
+    8461, 17169, 16588, 17408, 5665, 28674, 11135, 12502, 12407, 28736, 12732, 13183, 28704, 0, 28810, 0,
+    0, 32832, 0, 28738, 0, 12299, 0, 9301, 28770, 12972, 10583, 12359, 8662, 12654, 0, 11947,
+    13126, 12336, 12358, 13090, 12442, 28678, 12299, 5589, 12357, 11984, 11947, 11190, 13029, 12756, 13174, 17095,
+    16677, 0, 0, 32817, 28740, 16449, 12623, 8751, 11907, 0, 0, 16519, 28695, 13164, 17253, 16606,
+    16458, 9675, 12960, 9286, 12920, 9953, 28756, 0, 12633, 32816, 0, 4983, 9652, 28711, 11774, 13077,
+    32931, 16839, 5334, 28762, 12310, 9051, 9068, 8693, 0, 16449, 0, 28801, 0, 0, 12843, 32829,
+    17347, 16845, 28681, 13148, 0, 12856, 17237, 10741, 12810, 12864, 28713, 6080, 0, 32919, 0, 20490,
+    28821, 12648, 13068, 0, 13184, 12864, 12550, 0, 16858, 12039, 12420, 0, 28808, 8643, 28698, 10583,
+    28705, 12432, 6208, 16840, 0, 0, 16831, 8666, 13171, 9022, 10347, 28799, 16517, 0, 10883, 0,
+    10363, 8715, 13092, 11478, 9547, 28673, 16588, 28682, 0, 16953, 16608, 28800, 28812, 17399, 8320, 11987,
+    0, 0, 8998, 10270, 9252, 32908, 28790, 0, 28798, 10367, 13175, 28812, 0, 12845, 12804, 16777,
+    4949, 10882, 28696, 12984, 28706, 0, 13115, 0, 12324, 13182, 16851, 10642, 17129, 28736, 10072, 12898,
+    28687, 5236, 0, 9860, 8658, 11759, 13126, 28819, 16891, 12708, 0, 0, 0, 9481, 28680, 28802,
+    11479, 11750, 12752, 32830, 28744, 9076, 0, 12622, 32917, 12312, 0, 11040, 16607, 11701, 16529, 28715,
+    12346, 12616, 28815, 0, 4709, 11954, 12382, 28783, 13196, 0, 13172, 12300, 9015, 12585, 0, 10735,
+    12882, 12010, 12311, 12859, 10371, 10507, 0, 28740, 12586, 0, 12489, 9562, 16526, 28692, 12924, 8966,
+    32792, 9372, 11182, 0, 28746, 11378, 13151, 32832, 16842, 28728, 12984, 16683, 11769, 16608, 16527, 0,
+    9292, 12516, 0, 0, 0, 12657, 32792, 10072, 12039, 4632, 32793, 16936, 28760, 32894, 9072, 28705,
+    32853, 9218, 0, 16686, 0, 28776, 12990, 28703, 28819, 0, 13040, 8667, 16686, 0, 9946, 10670,
+    17307, 12444, 12009, 9547, 28685, 12835, 13092, 10269, 0, 12444, 5042, 28818, 0, 28738, 11999, 9885,
+    12548, 17354, 12728, 12617, 32937, 12586, 20489, 28767, 4721, 10137, 28771, 16842, 4891, 17316, 0, 5267,
+    16925, 0, 12707, 13187, 9973, 8963, 28695, 0, 0, 28792, 16530, 12598, 9008, 32778, 12057, 28803,
+    28762, 11749, 0, 16518, 16959, 12311, 16833, 11303, 4954, 13208, 16607, 28741, 28777, 16846, 0, 0,
+    0, 12549, 0, 12011, 16463, 16894, 16886, 16893, 28785, 28788, 13103, 0, 12981, 28806, 28799, 32898,
+    11947, 28709, 12691, 8677, 10583, 0, 28768, 5042, 16825, 12499, 12836, 16683, 28708, 32793, 28817, 0,
+    8995, 16541, 12616, 0, 8717, 12680, 0, 12009, 32859, 12012, 8784, 0, 12444, 10348, 11956, 17364,
+    16909, 12888, 13197, 13205, 0, 9676, 0, 16736, 28789, 16448, 11947, 9255, 16677, 12575, 28713, 9264,
+    8359, 13008, 0, 0, 28708, 28727, 8395, 0, 12970, 13116, 28756, 0, 28748, 9846, 28763, 4966,
+    16776, 8912, 4700, 0, 12679, 13186, 12803, 13199, 11947, 12836, 16900, 0, 12514, 0, 12667, 28705,
+    13209, 28781, 12492, 13184, 17330, 12587, 12668, 12642, 10815, 9892, 0, 12597, 13092, 0, 10788, 10101,
+    10670, 5520, 10659, 9547, 12057, 16885, 9801, 9809, 9816, 16833, 0, 20484, 0, 10428, 9510, 0,
+    6299, 28822, 12538, 9059, 28770, 16835, 10400, 13056, 28779, 28743, 28720, 16519, 32832, 17326, 17095, 9364,
+    28715, 0, 12607, 28780, 12730, 13174, 0, 28749, 16597, 12776, 28724, 9026, 32776, 12002, 0, 32844,
+    12587, 16959, 0, 8658, 32789, 12684, 12836, 11768, 16825, 0, 13116, 28695, 12480, 12615, 16509, 28811,
+    9264, 0, 8720, 8920, 12764, 0, 6464, 12826, 16574, 12847, 8413, 9915, 13176, 9640, 28792, 32818,
+    16774, 28728, 0, 10648, 11539, 12416, 13211, 12488, 0, 28714, 6015, 5411, 28810, 28804, 13128, 0,
+    8405, 0, 12763, 9985, 12955, 0, 13030, 12049, 11552, 28717, 12764, 8965, 28714, 8783, 28717, 0,
+    0, 12515, 11954, 11240, 10969, 16619, 12610, 20490, 0, 4954, 28780, 10365, 0, 8755, 11769, 17328,
+    8758, 12012, 9838, 13018, 28686, 12585, 12492, 12860, 0, 12463, 16743, 13068, 0, 28685, 16843, 10105,
+    10997, 32933, 11105, 28815, 12587, 0, 12497, 16457, 4472, 0, 12836, 9373, 28710, 12550, 9649, 28742,
+    11325, 12634, 16579, 12432, 12951, 6465, 28771, 10365, 4633, 12780, 12056, 4955, 13188, 12311, 10735, 0,
+    12444, 12065, 10532, 12439, 28768, 28747, 12575, 17332, 0, 32794, 0, 32896, 32781, 9517, 0, 28781,
+    0, 12408, 11477, 0, 10554, 10284, 5567, 12634, 28733, 13175, 32794, 28708, 11240, 9638, 8760, 9762,
+    28817, 0, 0, 11992, 8613, 8904, 28738, 28683, 16618, 0, 12728, 16463, 28769, 10699, 12321, 0,
+    12848, 12570, 12612, 10475, 12909, 13151, 8365, 10371, 9350, 0, 0, 12886, 12408, 12645, 32838, 0,
+    28715, 8367, 4265, 13186, 28757, 13162, 13116, 16899, 9010, 13043, 16913, 9219, 28746, 8754, 16607, 28673,
+    12537, 5662, 0, 10669, 28800, 16893, 6004, 10284, 16844, 0, 28705, 0, 12442, 32803, 8271, 12708,
+    32780, 11331, 12677, 12871, 28686, 11028, 11478, 5477, 28773, 12430, 0, 11268, 32852, 20484, 9547, 28725,
+    11384, 0, 28774, 12561, 28800, 13044, 28683, 12395, 9347, 12899, 12905, 28785, 16609, 5987, 0, 0,
+    12965, 8847, 12383, 0, 0, 8911, 0, 11296, 13018, 11757, 17082, 11031, 0, 28820, 4977, 0,
+    9256, 9067, 12476, 16740, 12587, 8413, 4827, 12896, 16834, 12384, 0, 16419, 28746, 12502, 8658, 4983,
+    12729, 4807, 0, 12743, 32937, 16458, 5066, 12323, 12066, 0, 12466, 20481, 28715, 28730, 28730, 13076,
+    28781, 0, 32793, 10448, 28792, 8721, 32865, 28792, 12619, 13091, 12442, 9861, 13187, 12872, 12370, 32864,
+    0, 0, 28745, 0, 16834, 12972, 9816, 10968, 0, 32794, 0, 0, 10160, 12312, 12600, 28721,
+    32817, 12776, 9641, 12804, 0, 28762, 5427, 28797, 5482, 8920, 9301, 9984, 28782, 12045, 0, 0,
+    10669, 10675, 9003, 0, 28709, 8368, 8750, 12981, 28722, 12702, 17332, 5767, 20485, 12838, 0, 28691,
+    16765, 10196, 8720, 12887, 8446, 0, 0, 28724, 12840, 6117, 9348, 0, 9038, 5825, 28683, 28827,
+    9610, 10406, 16539, 28804, 4981, 10115, 12692, 32781, 12619, 6108, 28748, 9561, 16462, 0, 9900, 16686,
+    20482, 5572, 12420, 13172, 0, 12322, 32843, 0, 32794, 8721, 11712, 28715, 8621, 9056, 12766, 12803,
+    12647, 16973, 10573, 28674, 0, 13164, 0, 9846, 32923, 5316, 16721, 32833, 10145, 11088, 9619, 8412,
+    12979, 16903, 13220, 16825, 5349, 0, 32924, 13220, 12873, 12702, 5944, 0, 16648, 32819, 0, 17151,
+    12041, 32865, 28795, 32910, 11607, 6325, 0, 28778, 32854, 28739, 13172, 12703, 32846, 12370, 16698, 28758,
+    0, 12370, 12683, 28719, 5611, 10974, 12692, 28709, 5477, 8765, 16497, 12384, 13212, 16971, 28796, 9610,
+    0, 11293, 13114, 17009, 13208, 8422, 10145, 9954, 8966, 17122, 10012, 12585, 10273, 12827, 13152, 16608,
+    12528, 10741, 11080, 12462, 28699, 5453, 12512, 32833, 12077, 0, 0, 12550, 8473, 11257, 32793, 17043,
+    12970, 0, 16696, 28739, 10151, 10843, 0, 9744, 9043, 32931, 16677, 12476, 28787, 12468, 17193, 13185,
+    28796, 16426, 28683, 28739, 12743, 0, 13122, 28737, 10443, 28729, 11522, 5763, 16617, 12712, 9618, 4728,
+    16539, 9854, 11757, 12428, 16852, 6021, 9861, 32922, 0, 12597, 8750, 28820, 13188, 0, 12669, 28715,
+    28780, 16621, 12712, 28823, 12694, 16462, 12477, 32845, 28714, 9020, 5608, 12895, 0, 32832, 32884, 10198,
+    9010, 13054, 0, 12079, 28760, 16775, 12779, 28734, 28802, 16677, 16756, 8475, 12491, 28699, 5894, 0,
+    28818, 0, 0, 13222, 16462, 28736, 12799, 5557, 10780, 12561, 12623, 9791, 32833, 9975, 9317, 5584,
+    5613, 9962, 5907, 12875, 9608, 0, 12789, 0, 12979, 12431, 28749, 28769, 5075, 12383, 0, 32865,
+    28729, 12502, 12955, 11003, 9003, 8760, 0, 0, 0, 11142, 13149, 0, 17210, 11005, 9361, 16621,
+    17332, 12419, 0, 12527, 9649, 5612, 13224, 11268, 0, 12766, 9080, 0, 13137, 8333, 12886, 28710,
+    17386, 12808, 0, 28797, 8713, 12587, 12588, 0, 12898, 12551, 12490, 0, 28730, 9068, 16540, 28760,
+    13200, 28828, 12895, 12767, 28822, 9605, 12808, 32833, 12683, 13198, 0, 12979, 0, 28772, 16937, 8396,
+    12980, 12790, 13212, 16528, 16539, 0, 0, 11766, 16542, 28784, 12598, 12300, 5074, 0, 10115, 12694,
+    8957, 12670, 0, 32917, 9598, 9974, 11274, 10152, 28817, 6043, 16914, 12994, 11079, 4728, 11657, 13144,
+    17385, 9649, 17410, 8477, 9264, 28804, 0, 10205, 5987, 12744, 9175, 11333, 0, 10459, 32854, 10996,
+    0, 0, 16966, 12885, 17368, 17361, 0, 10239, 32842, 0, 12562, 16461, 0, 5894, 12586, 0,
+    0, 16656, 9564, 9065, 9908, 12955, 9350, 32781, 20488, 12600, 12799, 0, 0, 13080, 16917, 32806,
+    5573, 8760, 13199, 0, 16854, 12395, 5899, 17396, 17328, 11552, 0, 0, 0, 10413, 12468, 32845,
+    0, 17387, 8843, 28728, 13006, 10509, 12502, 13067, 17384, 9899, 11339, 28782, 12619, 32898, 0, 12826,
+    17174, 12765, 10240, 12705, 32843, 0, 16846, 0, 5362, 28750, 16585, 16542, 8721, 0, 12332, 13094,
+    0, 28763, 6250, 32897, 16936, 9649, 17410, 17388, 0, 0, 12958, 12935, 0, 32794, 16930, 17328,
+    12717, 28822, 8285, 13138, 0, 28691, 0, 28823, 28820, 17279, 16698, 13219, 12560, 0, 0, 32870,
+    11040, 9975, 5483, 10751, 32872, 12431, 10356, 8414, 5563, 13116, 20485, 9948, 12550, 5911, 0, 5367,
+    12957, 0, 28743, 16621, 28822, 8760, 8422, 8478, 12633, 0, 10539, 0, 5583, 0, 0, 12477,
+    12915, 0, 10450, 12713, 17330, 28769, 12773, 0, 12886, 16696, 28776, 12450, 9311, 16608, 9011, 12715,
+    28824, 0, 32801, 12507, 13003, 13186, 13210, 10413, 32845, 16619, 0, 10160, 28774, 12990, 10748, 16904,
+    0, 5489, 28691, 16856, 28808, 28731, 12992, 0, 12408, 8768, 12809, 28763, 28783, 8460, 16754, 32802,
+    9739, 28724, 28704, 8272, 12658, 11338, 8936, 12671, 0, 0, 28818, 17378, 10273, 12716, 12562, 5366,
+    9563, 5907, 28779, 20485, 28695, 9468, 12670, 13197, 0, 28751, 28775, 16603, 11267, 28752, 9366, 11307,
+    6284, 28819, 0, 11379, 17378, 17394, 16857, 6115, 12633, 9981, 0, 0, 0, 0, 5613, 16971,
+    10497, 28683, 0, 0, 11385, 12576, 13211, 16912, 32830, 12706, 28749, 28827, 17123, 28776, 28776, 32869,
+    8667, 0, 9067, 12717, 16697, 28698, 0, 10494, 16989, 11002, 12898, 8712, 12511, 16540, 12813, 12812,
+    12777, 17043, 9560, 10414, 12407, 12068, 12667, 5899, 12936, 8949, 5589, 11434, 12801, 16845, 16983, 0,
+    12789, 16621, 11047, 0, 28701, 9076, 10832, 12501, 12681, 12605, 32790, 13094, 10705, 5619, 9022, 28795,
+    13015, 0, 28741, 12732, 28798, 0, 4630, 12983, 17055, 16887, 0, 12552, 9012, 17124, 9480, 12813,
+    17061, 9601, 9088, 0, 0, 28782, 0, 20481, 0, 12681, 12360, 28769, 10837, 32876, 12801, 12980,
+    0, 20486, 16700, 9003, 0, 11709, 10793, 12995, 9664, 16799, 0, 9918, 17128, 0, 12809, 16492,
+    12792, 32856, 28822, 13135, 10745, 0, 5105, 8489, 12717, 0, 6117, 9802, 9909, 8964, 9907, 28815,
+    12551, 12660, 12813, 11339, 9075, 13124, 10514, 0, 0, 0, 16594, 8470, 28793, 16735, 6130, 12540,
+    13002, 32846, 17202, 17378, 8467, 28766, 16989, 12959, 8769, 9676, 12763, 9619, 28821, 0, 28729, 28716,
+    12390, 10759, 12907, 28696, 12519, 32775, 11655, 10458, 16931, 10748, 16930, 28750, 32846, 16454, 10198, 32896,
+    17123, 9085, 0, 0, 32857, 12408, 9149, 12934, 10742, 17407, 12444, 9918, 0, 12372, 10490, 6207,
+    10451, 17062, 0, 12899, 12076, 28694, 11087, 9948, 5618, 10458, 12780, 12876, 12453, 8486, 6437, 11007,
+    12320, 12820, 13161, 32856, 16499, 12550, 0, 12907, 28719, 0, 11092, 28766, 8920, 28785, 11379, 13173,
+    0, 12815, 0, 28720, 28817, 6173, 28716, 11056, 9357, 17138, 10457, 32820, 28788, 12478, 8423, 10788,
+    12479, 12944, 16698, 10501, 5772, 12887, 11273, 8478, 12983, 0, 12919, 32855, 5911, 32908, 10742, 17201,
+    5248, 12798, 0, 16683, 8723, 12837, 12899, 16459, 12672, 12908, 12873, 16428, 32791, 28782, 9022, 28809,
+    12956, 10550, 28788, 6303, 9357, 32845, 0, 11303, 12740, 9963, 11042, 9375, 13007, 11047, 8777, 11838,
+    0, 12587, 16855, 12918, 20485, 8480, 28742, 9675, 6015, 11633, 10262, 28790, 11181, 28796, 17082, 12512,
+    10457, 13161, 16856, 0, 0, 5672, 28729, 0, 16540, 12934, 13017, 28816, 12621, 28684, 28706, 32868,
+    28675, 28739, 0, 0, 28777, 32889, 12907, 12946, 28816, 28775, 12717, 12754, 12608, 12564, 13149, 12956,
+    6293, 28788, 32923, 12850, 20484, 16451, 13091, 0, 12372, 12718, 16542, 28721, 16902, 32820, 28734, 12906,
+    5461, 17053, 5926, 28732, 17150, 28757, 13032, 11828, 12551, 9663, 0, 32892, 13005, 9003, 12408, 6123,
+    8480, 20486, 11041, 9036, 12935, 28786, 5619, 6318, 11768, 16824, 28807, 20487, 12768, 28784, 28764, 12732,
+    28810, 16992, 13040, 13020, 0, 17250, 28730, 0, 17004, 0, 10713, 17053, 9685, 11701, 12659, 12849,
+    5025, 32884, 12454, 16931, 12588, 17150, 0, 11312, 0, 0, 10496, 17140, 0, 0, 8768, 11404,
+    28807, 12644, 17161, 17070, 10050, 12863, 28718, 12533, 9601, 12874, 17083, 12372, 12917, 17009, 11309, 28719,
+    12921, 0, 8723, 10206, 12922, 9906, 10794, 16698, 12622, 11180, 0, 0, 12876, 12932, 28788, 28702,
+    12575, 0, 20487, 8488, 32841, 12943, 12718, 11338, 28772, 28823, 13161, 12395, 13016, 12923, 28797, 10843,
+    6179, 32831, 28740, 12588, 32833, 10206, 12563, 11410, 12647, 32898, 13083, 0, 0, 32816, 32897, 28739,
+    11954, 12479, 17202, 17081, 28742, 13096, 0, 10217, 28680, 0, 12850, 0, 11432, 12932, 0, 12551,
+    11092, 0, 5661, 12944, 28714, 12718, 10545, 13039, 0, 13034, 12942, 0, 28772, 28726, 17131, 20487,
+    10151, 11573, 11137, 16893, 28691, 12504, 12520, 0, 32839, 11479, 16665, 28682, 13176, 12971, 10797, 0,
+    0, 12451, 32868, 6015, 17081, 28752, 11573, 32858, 6344, 0, 28679, 12696, 0, 28769, 10261, 16846,
+    20486, 28771, 12357, 10495, 28783, 12659, 12551, 8421, 13050, 13085, 11093, 13120, 12933, 12647, 0, 5629,
+    28800, 12944, 28684, 9386, 9675, 0, 8574, 13145, 12886, 16779, 0, 9964, 10206, 28774, 9012, 9765,
+    17003, 32894, 28731, 11386, 32870, 9619, 28741, 0, 12957, 10760, 0, 28763, 17274, 32794, 11654, 12719,
+    32880, 13197, 10553, 16982, 17330, 11638, 0, 11391, 0, 16845, 9884, 12624, 12727, 28805, 10545, 12563,
+    0, 12944, 8461, 6348, 5628, 6145, 12441, 12945, 12850, 12575, 11638, 28796, 5661, 16692, 13122, 28730,
+    10714, 12888, 32791, 13099, 9816, 9620, 32881, 28754, 10254, 16621, 12743, 28797, 0, 28760, 32868, 13152,
+    16832, 13056, 28750, 17089, 12960, 12932, 8405, 8643, 28827, 0, 13065, 32906, 0, 28816, 28754, 12792,
+    0, 17136, 5629, 12575, 12896, 32904, 13006, 17226, 0, 17064, 0, 0, 0, 13019, 11104, 8789,
+    17053, 0, 28765, 28771, 6151, 12564, 32826, 10516, 11104, 10862, 9077, 28794, 6143, 8478, 9253, 9147,
+    11059, 12801, 5129, 32858, 5674, 13019, 13211, 32895, 5673, 0, 10843, 10561, 10251, 28677, 28756, 9019,
+    10218, 9675, 0, 12815, 12824, 0, 0, 12496, 10549, 8777, 28778, 16656, 12588, 32888, 12981, 16991,
+    12576, 16571, 12552, 0, 12068, 11111, 0, 16846, 12803, 9965, 6021, 32789, 10106, 0, 6308, 13150,
+    0, 16700, 9823, 12563, 12439, 11606, 5674, 16778, 9685, 32882, 12825, 11685, 32867, 5672, 12632, 32906,
+    12408, 0, 12933, 4383, 12454, 13068, 12416, 32856, 11780, 12609, 13000, 13027, 9767, 12384, 32870, 0,
+    9382, 10859, 0, 5541, 12309, 0, 11679, 13110, 13124, 28809, 6309, 28784, 12863, 0, 5672, 32872,
+    0, 0, 12825, 17279, 0, 0, 10515, 12779, 13220, 0, 12918, 17229, 0, 0, 13035, 28820,
+    0, 8470, 16779, 12886, 28818, 10488, 9975, 12510, 12512, 11096, 10699, 16743, 17062, 17248, 11142, 16507,
+    0, 0, 28684, 28720, 28757, 9496, 0, 13078, 12852, 12932, 12552, 0, 0, 12852, 13146, 12863,
+    12720, 0, 12863, 12756, 28735, 9779, 0, 12934, 10306, 17228, 6319, 8479, 17062, 0, 10565, 0,
+    13074, 13091, 12944, 13039, 28767, 28702, 12631, 12528, 28777, 0, 17053, 28766, 0, 28789, 28683, 28810,
+    17397, 11178, 10973, 32803, 8282, 32883, 0, 0, 13005, 32893, 8555, 10871, 10850, 20487, 11346, 12780,
+    8489, 0, 16823, 0, 12468, 17149, 9975, 12852, 10815, 17241, 32820, 17220, 16775, 12932, 28676, 12516,
+    4780, 0, 0, 32868, 8256, 28767, 32894, 8778, 16536, 11413, 32817, 13146, 10560, 28800, 12908, 0,
+    12621, 13019, 13054, 28772, 12945, 32872, 13135, 28700, 16750, 32895, 9919, 11574, 28739, 6183, 13038, 13027,
+    28777, 6432, 12875, 10806, 32910, 11835, 12895, 13052, 0, 28771, 6050, 12919, 11639, 28701, 28680, 0,
+    5270, 9532, 6438, 13029, 28768, 16933, 12943, 12708, 12357, 28707, 0, 12576, 11574, 28772, 6055, 13008,
+    9022, 28677, 13036, 16613, 12575, 0, 13125, 17296, 32803, 10596, 28730, 0, 32895, 28727, 28792, 0,
+    9657, 12621, 0, 0, 28700, 12785, 13187, 9051, 32896, 11976, 4409, 16542, 28801, 6151, 11778, 0,
+    11149, 28793, 12588, 0, 12515, 9012, 8317, 28696, 12957, 8611, 17237, 0, 9088, 0, 20488, 12921,
+    12910, 0, 12900, 20481, 17080, 12984, 11357, 13014, 0, 10187, 28693, 10853, 28719, 0, 28807, 0,
+    28692, 9917, 12994, 12587, 28698, 0, 28791, 20482, 32923, 12874, 32933, 0, 28736, 11441, 11404, 6180,
+    28716, 12431, 28710, 11765, 0, 32846, 12899, 28786, 17238, 9984, 28806, 12322, 11349, 32870, 12840, 12994,
+    12420, 9508, 12734, 12455, 6050, 0, 10215, 12502, 28793, 11466, 32832, 12308, 0, 17014, 16936, 0,
+    17305, 32833, 13111, 10516, 10580, 12933, 32896, 13008, 16615, 16462, 32838, 11685, 32778, 9216, 32904, 5673,
+    11442, 9666, 0, 11645, 17010, 28807, 28734, 12310, 6464, 12906, 9320, 8948, 17238, 16699, 0, 11690,
+    10271, 12766, 0, 13062, 12404, 12922, 0, 28772, 12501, 8867, 0, 16895, 17151, 11685, 32932, 28703,
+    0, 12826, 32859, 0, 28778, 17239, 12755, 10208, 9086, 9984, 9838, 32866, 9358, 6357, 10553, 28776,
+    28742, 8470, 17219, 12564, 6022, 17069, 0, 10560, 12608, 9247, 12887, 20488, 0, 0, 10377, 13136,
+    10861, 32883, 28792, 12552, 28812, 13053, 32895, 20489, 0, 16779, 17010, 11160, 10264, 13017, 17072, 9685,
+    0, 12540, 32819, 6056, 0, 8598, 0, 16846, 11349, 13031, 0, 12480, 16756, 0, 12480, 0,
+    0, 0, 0, 20488, 32897, 12432, 12693, 11713, 10570, 12945, 12851, 10108, 28790, 32885, 28778, 8683,
+    17286, 0, 6390, 8479, 9986, 17082, 12575, 9087, 13087, 17241, 12898, 12764, 32933, 17052, 12816, 10568,
+    13088, 11657, 12077, 11702, 12995, 17015, 12695, 17004, 12040, 13018, 5159, 0, 11851, 16677, 28708, 10862,
+    28755, 17168, 12934, 28738, 11404, 12431, 16774, 12768, 12946, 0, 32871, 32884, 13197, 12359, 13052, 32898,
+    28713, 28783, 32805, 8641, 13076, 13064, 0, 10872, 6050, 10814, 0, 28794, 13194, 13016, 12946, 12768,
+    11709, 0, 0, 32934, 10271, 12527, 28764, 12799, 0, 12693, 13074, 0, 9320, 17151, 11648, 0,
+    0, 6217, 17151, 6151, 11703, 28778, 8758, 0, 13104, 11177, 0, 12394, 8787, 28806, 12764, 20487,
+    32779, 28810, 32908, 0, 28741, 0, 0, 32933, 12634, 13075, 32871, 11403, 0, 11844, 5265, 6225,
+    11105, 10271, 12946, 28779, 0, 8723, 0, 28798, 9078, 12623, 4307, 17083, 0, 6181, 17070, 17013,
+    11713, 9909, 13051, 13209, 12636, 28673, 16526, 28694, 11105, 17229, 0, 11757, 13007, 6177, 5970, 9473,
+    12456, 16461, 0, 17171, 12564, 13139, 28790, 13076, 13076, 17015, 11222, 13053, 10028, 6226, 28801, 12827,
+    28790, 32846, 13064, 9089, 28808, 0, 11442, 9377, 0, 17170, 28784, 28785, 0, 0, 20490, 16413,
+    6392, 28798, 10283, 12945, 28738, 12947, 12444, 32935, 16621, 16807, 12511, 12634, 32907, 0, 32818, 12640,
+    28733, 32933, 12767, 13038, 12959, 32937, 8693, 17238, 11976, 17015, 8695, 12381, 32884, 16684, 11900, 32833,
+    12900, 32884, 32833, 12500, 28735, 6463, 11776, 12605, 28749, 9088, 0, 28782, 11039, 16666, 28718, 28759,
+    11442, 11733, 13052, 28819, 12396, 10571, 12960, 28791, 6223, 12827, 12511, 0, 5666, 12495, 0, 11115,
+    6396, 28763, 0, 12720, 12627, 0, 9728, 28708, 11167, 32917, 13116, 32791, 10554, 32935, 0, 12486,
+    12369, 32937, 0, 9909, 28767, 9446, 12864, 12605, 28690, 17239, 13102, 11734, 8390, 28783, 12977, 13065,
+    0, 5317, 28675, 28752, 28807, 17083, 10870, 11115, 12923, 11167, 32829, 32907, 0, 13088, 5406, 28769,
+    11739, 9620, 32789, 13028, 28808, 8487, 9174, 11041, 32778, 32897, 16571, 0, 13132, 0, 10580, 11038,
+    28685, 10816, 13137, 17296, 12864, 32819, 9006, 13028, 12666, 12569, 4425, 28774, 13149, 4685, 0, 28755,
+    12002, 0, 12706, 0, 16588, 6457, 12417, 0, 12588, 9802, 9914, 0, 16657, 12947, 0, 32907,
+    0, 12647, 13223, 16421, 13039, 6444, 13064, 6356, 9509, 9198, 12298, 10860, 13020, 32897, 6365, 10878,
+    28706, 17015, 6364, 0, 11954, 10816, 6235, 12527, 10891, 12876, 13124, 0, 0, 17315, 8245, 0,
+    16819, 12900, 0, 32827, 12522, 16936, 16508, 28677, 0, 28693, 12628, 17170, 9152, 0, 16853, 9686,
+    28693, 32839, 0, 10870, 28725, 5770, 9153, 0, 0, 17249, 28675, 12490, 0, 12357, 12839, 13041,
+    6365, 0, 9973, 11115, 28688, 11466, 16821, 12647, 16657, 16451, 4591, 28721, 0, 11648, 12827, 11341,
+    28733, 0, 13221, 12464, 16499, 0, 12346, 0, 11713, 11460, 11864, 13088, 12762, 32805, 8363, 0,
+    0, 32780, 28742, 13158, 11742, 16588, 12960, 17299, 32779, 0, 28794, 12478, 16999, 0, 0, 28674,
+    32898, 0, 0, 32833, 16997, 11648, 11404, 11870, 17094, 0, 28802, 12664, 0, 16778, 0, 5488,
+    13148, 12309, 11765, 11177, 0, 8790, 0, 12405, 10495, 28741, 28675, 13020, 28741, 13015, 17378, 11611,
+    9386, 10583, 28705, 32779, 11931, 16822, 12466, 16619, 28783, 32817, 0, 6408, 0, 17249, 10048, 16773,
+    10871, 28750, 13026, 16463, 17239, 17317, 12370, 28696, 0, 13127, 0, 13138, 9676, 10343, 13042, 11611,
+    6456, 6277, 0, 13158, 11735, 28806, 0, 28687, 0, 28720, 13054, 12743, 6408, 0, 17318, 11459,
+    0, 28758, 32897, 13140, 10581, 17015, 0, 28719, 10569, 11469, 5490, 28815, 32897, 20489, 17239, 13065,
+    10881, 17307, 5487, 11479, 17228, 0, 12298, 10280, 0, 28706, 0, 13207, 8779, 0, 0, 28783,
+    9020, 8952, 12366, 10633, 6186, 0, 11976, 10870, 13077, 28732, 28720, 11981, 12690, 28736, 10573, 12525,
+    16579, 12322, 0, 12528, 28675, 0, 6463, 32885, 12744, 13089, 12732, 20484, 6446, 4806, 11775, 28817,
+    12911, 9211, 28723, 17299, 32872, 28791, 17290, 8344, 17159, 17015, 17317, 0, 12652, 28767, 8959, 0,
+    0, 13116, 28685, 13018, 6456, 8256, 8349, 0, 0, 13182, 10853, 32840, 12503, 16519, 20484, 16509,
+    17239, 8555, 11224, 8779, 0, 11982, 11152, 12842, 11939, 12416, 28774, 12923, 12321, 32911, 13151, 28815,
+    11179, 11171, 17171, 5590, 10572, 11900, 13054, 0, 13028, 28720, 28815, 16807, 10272, 32919, 8881, 12628,
+    6411, 0, 5621, 0, 11775, 12983, 16771, 13066, 16658, 8283, 4512, 12369, 0, 12300, 13055, 32831,
+    32806, 5288, 13116, 32917, 0, 11956, 28681, 28697, 9286, 12612, 10599, 28701, 28724, 0, 32817, 4594,
+    12786, 0, 28824, 6145, 12079, 11469, 9502, 32814, 20487, 20488, 12334, 13066, 8992, 0, 12371, 12705,
+    0, 28731, 32918, 0, 0, 11460, 28757, 17317, 28709, 28773, 8611, 12297, 12732, 0, 6465, 9321,
+    12748, 16665, 17169, 0, 28713, 12864, 16449, 17308, 28795, 28784, 10581, 0, 28698, 11932, 28716, 16821,
+    28683, 32911, 12516, 12828, 9539, 0, 16509, 11703, 28682, 9001, 12491, 32885, 0, 8318, 12299, 28743,
+    32919, 8453, 0, 12954, 0, 0, 16675, 13089, 16822, 32885, 11179, 10563, 9505, 10274, 16588, 9983,
+    10871, 0, 0, 10897, 16823, 5756, 32840, 32911, 4627, 0, 32819, 11983, 6457, 0, 28814, 8491,
+    12394, 12996, 0, 0, 16518, 32779, 13128, 16588, 0, 9047, 6226, 12768, 0, 13169, 10898, 8412,
+    12899, 10282, 8366, 16588, 10281, 12383, 9005, 12008, 11152, 12736, 32779, 9534, 0, 28736, 0, 6402,
+    11169, 10582, 0, 28787, 13043, 32840, 12636, 12335, 0, 28725, 12747, 8555, 12792, 6409, 0, 17406,
+    12720, 0, 9291, 17171, 28734, 16438, 16597, 10270, 0, 11938, 11478, 16440, 12652, 11746, 12382, 0,
+    9473, 0, 28688, 10573, 0, 32793, 0, 32872, 9502, 28743, 6174, 11741, 0, 28748, 28733, 12828,
+    12334, 10263, 16658, 11479, 12348, 8459, 28720, 28717, 28810, 13199, 8344, 28785, 8910, 13162, 0, 0,
+    32793, 13167, 28803, 16729, 13077, 28743, 0, 9349, 28769, 10862, 9750, 0, 8688, 28674, 32792, 0,
+    28692, 9085, 28686, 0, 8981, 32937, 8689, 28732, 8617, 32919, 0, 12995, 28776, 8707, 16935, 13159,
+    32820, 13184, 12768, 8954, 4401, 28736, 32898, 12311, 16569, 16440, 16777, 28782, 17094, 16814, 28724, 8956,
+    9089, 0, 28722, 8582, 16598, 9828, 13171, 12521, 6457, 0, 17173, 20487, 28743, 9296, 13115, 10860,
+    11180, 13146, 28745, 0, 8861, 0, 8661, 16430, 9975, 28709, 16722, 8554, 13018, 13169, 28812, 10621,
+    12748, 11758, 12522, 28768, 12463, 17016, 16778, 12832, 28828, 32920, 12900, 9503, 8467, 28709, 17318, 8663,
+    16507, 5541, 28781, 9982, 9539, 12559, 4311, 16499, 13091, 32829, 11759, 8665, 8256, 16666, 0, 28737,
+    32807, 5742, 11777, 12924, 9860, 12593, 12497, 16438, 16608, 13206, 8571, 0, 11171, 0, 12912, 12636,
+    16504, 12041, 8577, 16737, 28757, 28767, 28757, 9214, 11775, 0, 16571, 16509, 0, 12972, 12356, 11938,
+    12011, 11872, 11759, 12439, 8654, 16674, 0, 28802, 16451, 12396, 17013, 0, 11171, 10573, 32781, 4545,
+    28810, 17308, 0, 11777, 16871, 12513, 28823, 11776, 9796, 28716, 4296, 9473, 16620, 28724, 17316, 28682,
+    12455, 10606, 8899, 6410, 0, 17318, 13114, 17236, 13173, 17095, 4567, 11902, 17091, 16744, 12567, 8881,
+    13103, 28682, 12417, 8355, 11938, 12300, 12332, 32898, 8314, 9209, 0, 11897, 28756, 32819, 8401, 12333,
+    13087, 12522, 13170, 0, 17318, 11777, 0, 28757, 6098, 12522, 28682, 12640, 28818, 17318, 28725, 32919,
+    17347, 28769, 8470, 12331, 16743, 0, 28682, 12359, 16675, 16779, 8350, 13168, 12068, 16509, 16684, 20485,
+    12055, 12636, 11767, 11182, 28691, 11985, 28737, 16992, 12960, 12636, 13068, 16508, 16513, 8475, 16598, 16755,
+    28728, 16499, 28742, 10318, 0, 0, 17352, 16914, 0, 12344, 12299, 16448, 4436, 11711, 0, 28777,
+    0, 12477, 28791, 8916, 28812, 12392, 8555, 0, 0, 8788, 16437, 0, 8401, 28717, 12725, 0,
+    32843, 32920, 0, 12552, 0, 10905, 11944, 32803, 12663, 8689, 13114, 16736, 0, 11181, 0, 0,
+    32816, 32935, 28768, 0, 10609, 11777, 4463, 6466, 16449, 4563, 28823, 0, 28697, 9180, 8365, 8918,
+    16832, 28788, 16822, 0, 32840, 0, 16721, 28736, 8611, 13122, 6402, 12010, 0, 12532, 28712, 12736,
+    16686, 0, 0, 13091, 12486, 11181, 12595, 16608, 32832, 17250, 9437, 28692, 20485, 0, 17014, 8956,
+    28683, 13115, 28803, 12500, 12431, 11143, 12358, 9898, 0, 32804, 4566, 11956, 28733, 11139, 0, 10882,
+    12558, 16736, 8613, 28820, 28699, 32803, 8566, 32789, 28736, 17250, 12855, 9171, 13125, 12322, 28710, 10285,
+    12009, 0, 0, 12058, 0, 16609, 12572, 6464, 9980, 13076, 20489, 0, 0, 28818, 6466, 10882,
+    13128, 28813, 16430, 32803, 4380, 0, 0, 12652, 8451, 12040, 5003, 8665, 12759, 0, 12960, 28768,
+    16440, 12641, 0, 16517, 11956, 20482, 12299, 28681, 0, 10284, 0, 17326, 10881, 28792, 12010, 28736,
+    9204, 0, 28817, 0, 16437, 28710, 16586, 8910, 9014, 11197, 0, 4928, 12804, 32895, 0, 13172,
+    8357, 0, 8643, 28703, 0, 12666, 9218, 13208, 17331, 10222, 16440, 12531, 28705, 12382, 12308, 28698,
+    6457, 32780, 12384, 9015, 12984, 32780, 0, 28726, 12546, 12502, 0, 13187, 9051, 0, 12299, 0,
+    12406, 10415, 28726, 32807, 9346, 12593, 11769, 12002, 10414, 16676, 0, 0, 8465, 9478, 32789, 28702,
+    13184, 16607, 9175, 12936, 0, 32831, 12442, 8664, 13208, 32806, 8409, 32820, 0, 16948, 16797, 8320,
+    17298, 13054, 32794, 32776, 8553, 13175, 17174, 8584, 16948, 12629, 12297, 12748, 28701, 28775, 8356, 0,
+    12346, 28736, 8584, 12040, 16606, 11478, 20483, 12847, 4311, 32857, 0, 12490, 12455, 16745, 12867, 9539,
+    32907, 5009, 13174, 0, 0, 28710, 8375, 12593, 12440, 12381, 28774, 16671, 8784, 28686, 28697, 0,
+    8999, 5311, 11479, 4849, 8278, 12511, 32920, 28820, 32840, 16461, 12369, 9833, 28806, 28759, 12057, 4629,
+    6466, 0, 9255, 12384, 28735, 28706, 13056, 11778, 16605, 0, 0, 28780, 0, 12001, 32805, 8654,
+    13205, 12537, 28739, 28768, 9832, 12336, 16676, 12570, 20484, 0, 32804, 4688, 8384, 10606, 12527, 0,
+    13092, 0, 11468, 16605, 8456, 12407, 4688, 0, 0, 16744, 11956, 16541, 16608, 10460, 32843, 12057,
+    12911, 12572, 11907, 32794, 17352, 16609, 11778, 12858, 0, 17356, 13104, 9209, 32804, 10908, 0, 20481,
+    0, 32920, 13104, 11457, 12064, 32805, 8627, 12487, 10610, 8555, 12477, 5077, 32780, 12058, 8703, 16598,
+    28723, 28677, 0, 8402, 16744, 12347, 12456, 9898, 0, 16509, 0, 10112, 0, 28735, 28824, 0,
+    28685, 5233, 28694, 12720, 8451, 28696, 13128, 32829, 9507, 11759, 13152, 8763, 32846, 12561, 9182, 0,
+    9180, 11955, 16831, 17358, 28717, 8472, 9542, 28743, 4284, 6327, 10113, 16687, 32806, 8401, 0, 13198,
+    12322, 6326, 13173, 6457, 8618, 28822, 12359, 9248, 32937, 0, 32793, 28804, 28716, 8396, 28797, 13116,
+    28681, 16597, 13218, 9592, 0, 32872, 8532, 9817, 12802, 9088, 32828, 10100, 32819, 4567, 12066, 16795,
+    28689, 28822, 17253, 12407, 0, 28687, 16822, 12963, 16530, 12920, 16605, 12322, 12345, 12763, 12766, 28800,
+    32920, 0, 32870, 12011, 32814, 12790, 0, 0, 16824, 28743, 13184, 28792, 10909, 16654, 12308, 0,
+    16953, 28827, 0, 8321, 9555, 12309, 10134, 16894, 16853, 12319, 12380, 12857, 28760, 32793, 8752, 11768,
+    12547, 13164, 12358, 16449, 16596, 11984, 0, 10148, 12532, 0, 32780, 9860, 12584, 10815, 16766, 17332,
+    0, 32819, 9641, 28676, 16816, 9481, 16462, 5411, 12777, 12562, 0, 12922, 16776, 17375, 28744, 13208,
+    0, 5048, 9449, 32780, 17328, 16459, 10150, 0, 9616, 28710, 32790, 12570, 16736, 0, 13185, 32780,
+    28717, 0, 9315, 32857, 12578, 9007, 0, 12573, 0, 32906, 12475, 12930, 8364, 28711, 12346, 12011,
+    20488, 9008, 8756, 9854, 8397, 12644, 11993, 16603, 16437, 0, 28710, 0, 28820, 8890, 4694, 28699,
+    10498, 11768, 16500, 0, 28817, 0, 20489, 28739, 10468, 9636, 28718, 12456, 12641, 28758, 13196, 0,
+    28810, 0, 0, 4467, 12323, 0, 28753, 20481, 12681, 16924, 12396, 9204, 0, 32801, 9424, 4946,
+    9883, 4912, 16607, 16459, 16618, 13158, 4554, 28718, 28826, 12845, 0, 28734, 9639, 12835, 32803, 10636,
+    28709, 11114, 8543, 13223, 9828, 28674, 16815, 28756, 11231, 32778, 10789, 28746, 12563, 28747, 12336, 0,
+    0, 12894, 13020, 12798, 16765, 16774, 13151, 0, 28799, 13066, 12324, 17384, 12923, 32803, 16496, 8613,
+    12502, 12528, 0, 12944, 28705, 16450, 16514, 12336, 28768, 0, 12439, 32923, 16539, 8663, 12323, 12942,
+    12324, 5514, 8988, 12336, 11977, 28798, 0, 28750, 28726, 12740, 9017, 11769, 16451, 28735, 0, 12523,
+    28723, 9292, 11778, 12974, 11932, 16539, 28780, 12571, 32779, 0, 28780, 0, 28727, 10442, 32817, 4976,
+    16773, 16539, 16619, 9308, 32841, 32778, 12058, 28703, 28694, 12476, 28824, 28746, 28819, 8359, 12574, 16993,
+    16842, 32806, 9314, 32781, 12419, 28718, 17150, 9241, 8657, 12453, 28750, 0, 0, 0, 12623, 8584,
+    12323, 32933, 28738, 10935, 0, 16516, 0, 4471, 10642, 32895, 12419, 28745, 12560, 5951, 16983, 9002,
+    32908, 17072, 12952, 16677, 16887, 16438, 28817, 0, 0, 5978, 0, 10333, 12656, 9210, 16890, 10159,
+    0, 12512, 9962, 12462, 5340, 16687, 12668, 17394, 9510, 0, 28714, 0, 0, 13140, 12057, 10370,
+    16609, 11777, 16728, 16981, 28744, 28757, 11102, 0, 16688, 10348, 12585, 16462, 10273, 12002, 16816, 13163,
+    0, 32781, 0, 28780, 10393, 0, 16463, 28736, 12479, 28825, 13198, 28769, 28727, 28786, 28733, 9852,
+    12010, 13220, 0, 12428, 12295, 13219, 12300, 0, 16509, 12631, 28708, 8364, 0, 12656, 0, 32804,
+    4710, 16434, 32794, 12574, 12681, 10364, 8920, 11956, 16902, 9510, 12667, 12334, 16686, 0, 17359, 16462,
+    11527, 4700, 13030, 13082, 28825, 17081, 32806, 12987, 28740, 12544, 0, 12633, 10941, 12479, 12477, 0,
+    16763, 12632, 17329, 13220, 28737, 16824, 12405, 12775, 16462, 0, 17094, 12549, 0, 28725, 0, 32791,
+    11239, 11005, 0, 13186, 16462, 13040, 16696, 0, 8452, 8621, 32933, 0, 28715, 32871, 0, 28741,
+    9906, 12561, 5521, 17361, 0, 16608, 32794, 10138, 28747, 32781, 0, 12571, 16619, 13212, 0, 0,
+    8701, 0, 5672, 28737, 28734, 16935, 12586, 12741, 0, 0, 28820, 4552, 16530, 0, 0, 12729,
+    17387, 13054, 12049, 28689, 12465, 28745, 13001, 16530, 0, 0, 28691, 28715, 0, 10947, 12885, 0,
+    12978, 12752, 20485, 0, 10371, 12432, 28706, 0, 28788, 9318, 10127, 0, 12667, 12360, 13175, 13209,
+    16445, 32827, 4966, 28734, 28746, 9547, 28711, 0, 13176, 17092, 28745, 12312, 0, 9044, 5025, 17101,
+    16852, 0, 13032, 13065, 32804, 10957, 12478, 9843, 12312, 28695, 10183, 12965, 28685, 12911, 0, 12586,
+    16597, 12068, 0, 5042, 9655, 28773, 16765, 28673, 12394, 9294, 28769, 8367, 9553, 12559, 28715, 13044,
+    13080, 12380, 8421, 11393, 28701, 8658, 28761, 16843, 16835, 12562, 16485, 28822, 32826, 9555, 8666, 0,
+    0, 9017, 12859, 8285, 16459, 9142, 16825, 13209, 4721, 16752, 17386, 9042, 32794, 0, 17385, 12311,
+    0, 12922, 9590, 16621, 9935, 16677, 32779, 0, 12322, 0, 28802, 0, 32819, 28786, 0, 17360,
+    32803, 16653, 0, 28714, 8284, 8413, 12575, 0, 12382, 5978, 0, 0, 0, 32806, 5301, 28747,
+    20481, 8751, 12420, 32780, 0, 16952, 13080, 28776, 6457, 13028, 16886, 13116, 17386, 16687, 32843, 12975,
+    12455, 32832, 28797, 9318, 12740, 9315, 0, 6073, 17023, 9564, 28685, 8775, 32805, 5058, 0, 10182,
+    5767, 5093, 32789, 5093, 9517, 28718, 0, 10641, 16461, 16852, 12309, 9645, 13128, 32937, 5270, 12348,
+    12297, 0, 0, 28726, 13042, 32794, 12333, 17331, 13220, 28825, 0, 10430, 8483, 28816, 28742, 16601,
+    28727, 28754, 12836, 9760, 12848, 9513, 16618, 16537, 12312, 0, 13176, 32805, 11256, 10648, 12058, 28804,
+    16766, 0, 0, 0, 28692, 5965, 17396, 32894, 10507, 10389, 0, 12617, 9010, 12742, 16900, 0,
+    0, 28745, 12884, 8620, 0, 32828, 28718, 0, 12419, 11374, 12067, 0, 16982, 17377, 9354, 16530,
+    9953, 12894, 20486, 12523, 32781, 12336, 20482, 0, 28762, 10237, 0, 9809, 9370, 28748, 28701, 10399,
+    11265, 28695, 9309, 16698, 12720, 12583, 0, 0, 12001, 16692, 5555, 28730, 10983, 8745, 0, 5059,
+    12631, 5317, 11503, 0, 32794, 12885, 28683, 8942, 11413, 13211, 12607, 10940, 0, 16901, 12067, 12575,
+    13014, 12955, 12644, 16500, 12551, 0, 12614, 12575, 28674, 0, 28687, 32845, 32807, 5848, 5346, 12467,
+    12669, 13031, 9934, 16688, 16697, 28812, 11328, 28773, 0, 28690, 0, 16844, 28820, 16890, 0, 28680,
+    12828, 10947, 12549, 5351, 13004, 0, 28728, 10101, 28782, 13095, 12668, 11413, 0, 8710, 13019, 28750,
+    12776, 20485, 0, 12987, 13221, 9074, 28689, 16542, 5548, 32842, 4720, 0, 28752, 28756, 12599, 0,
+    28702, 9915, 10263, 32807, 16824, 9867, 9561, 28703, 28698, 0, 8712, 9301, 28743, 8965, 28747, 13004,
+    28710, 12967, 0, 9011, 12300, 12406, 28770, 5360, 12600, 12587, 9261, 10436, 16699, 28701, 28719, 0,
+    8774, 17388, 28712, 12574, 10939, 6051, 16463, 16440, 12528, 0, 12860, 9874, 12683, 9255, 13004, 16777,
+    5350, 0, 10377, 12359, 0, 0, 12740, 0, 32832, 13078, 9350, 0, 28725, 12008, 9056, 12633,
+    17396, 10400, 12549, 28714, 28784, 9350, 0, 0, 28748, 28824, 0, 8413, 0, 5478, 28725, 28728,
+    12684, 0, 28710, 28781, 16687, 12656, 13043, 9151, 16539, 16893, 17092, 12574, 16588, 28703, 12432, 0,
+    12451, 12408, 13086, 11633, 12467, 9780, 8783, 10184, 12383, 9044, 32794, 16892, 12432, 12552, 16907, 0,
+    28787, 9019, 16852, 28795, 0, 12871, 8351, 32844, 8750, 32872, 16540, 12886, 0, 16886, 28689, 0,
+    4977, 0, 32819, 0, 32843, 12596, 10483, 12777, 9780, 28817, 28691, 9064, 12670, 16541, 4721, 28736,
+    17369, 16530, 12691, 10517, 9044, 28746, 12869, 10371, 28745, 9962, 12312, 0, 28780, 28816, 0, 32906,
+    0, 0, 5351, 12753, 28684, 11182, 32781, 28746, 28761, 10573, 32831, 20484, 12309, 17396, 9058, 5993,
+    0, 17220, 0, 17102, 12871, 12416, 9682, 9554, 28754, 12955, 12615, 10718, 32907, 0, 32829, 0,
+    12515, 28705, 0, 10151, 12429, 28687, 28746, 10173, 0, 5608, 17319, 12679, 9362, 17387, 11161, 9618,
+    9885, 9618, 32898, 12406, 5098, 12526, 8421, 4981, 16845, 4722, 12871, 0, 12467, 9917, 8712, 12777,
+    9854, 0, 0, 0, 9889, 10997, 8689, 12646, 28812, 5672, 5570, 9219, 9301, 16598, 0, 12355,
+    0, 28730, 9081, 28699, 32780, 20481, 28703, 16698, 0, 10377, 17035, 28770, 0, 10400, 12500, 28823,
+    5048, 10969, 28719, 32908, 0, 8658, 12787, 6081, 12456, 16419, 4976, 8477, 10218, 9299, 28719, 28722,
+    12742, 0, 9930, 16519, 0, 17037, 6107, 17149, 0, 28746, 12635, 13152, 28822, 13221, 9084, 5097,
+    12816, 9517, 16700, 28728, 28814, 5645, 12912, 28747, 4793, 0, 10584, 9301, 17252, 12549, 32779, 16923,
+    4722, 12418, 0, 10697, 8732, 0, 16845, 12688, 0, 11040, 12489, 5948, 11137, 9350, 16739, 12775,
+    12729, 28823, 17353, 12900, 0, 9452, 0, 28675, 9083, 12347, 12482, 12979, 0, 4727, 12476, 28747,
+    0, 12645, 28785, 17174, 0, 6168, 12808, 12582, 32871, 8721, 28698, 12742, 0, 5921, 32853, 0,
+    16649, 11274, 9863, 13067, 12884, 28776, 8776, 12539, 16765, 12503, 12598, 8461, 0, 17014, 10995, 12741,
+    9379, 12717, 10451, 16699, 8475, 16500, 5893, 10152, 5270, 12711, 28821, 28738, 28760, 5070, 0, 12468,
+    12860, 28709, 16914, 8744, 32845, 12372, 13107, 0, 13040, 12617, 0, 13007, 12468, 0, 17251, 12836,
+    28799, 12587, 12515, 28772, 8957, 28729, 17080, 20485, 16598, 4572, 28691, 0, 11114, 10283, 28719, 28711,
+    0, 12596, 12851, 28773, 12885, 20481, 28762, 5454, 11539, 13014, 28818, 12784, 16429, 16825, 12703, 9909,
+    8359, 0, 16540, 28760, 32830, 11339, 5499, 16463, 12713, 28684, 9984, 28683, 5095, 12956, 5076, 28783,
+    8934, 28748, 12480, 28788, 13212, 12956, 0, 12658, 13224, 32842, 16687, 16901, 9309, 9954, 0, 5069,
+    5076, 28692, 16992, 9562, 13083, 4677, 13053, 10670, 5368, 8466, 0, 13004, 10483, 28767, 12453, 28798,
+    28696, 11538, 28805, 12011, 0, 28691, 0, 0, 12587, 0, 13014, 12792, 12708, 12807, 32844, 0,
+    10159, 16910, 16756, 0, 32919, 4728, 13162, 12597, 12779, 12956, 12777, 0, 0, 12771, 12808, 13052,
+    0, 0, 11049, 8667, 9816, 10883, 28795, 9011, 20481, 12432, 11104, 11268, 17251, 9862, 6116, 12885,
+    0, 28693, 12598, 5097, 0, 9618, 12587, 11404, 11590, 28695, 12516, 12683, 12551, 11267, 17320, 12478,
+    6256, 16450, 12799, 5584, 28715, 10240, 28677, 28701, 8350, 28737, 17397, 12360, 5489, 9649, 32831, 28750,
+    10759, 4785, 32831, 28699, 8459, 28797, 12778, 9973, 0, 0, 8786, 32937, 28740, 8413, 16910, 12588,
+    28803, 28715, 12562, 0, 28778, 8786, 32844, 5563, 12564, 28715, 0, 10969, 11274, 12914, 4366, 28693,
+    16439, 16460, 28758, 12635, 10414, 12695, 28813, 16526, 10229, 28734, 0, 12519, 28730, 16539, 32865, 12600,
+    0, 16855, 5585, 0, 0, 0, 16700, 28706, 12743, 5645, 28824, 10378, 9357, 12331, 12886, 9318,
+    5104, 5070, 32819, 5455, 12703, 9945, 13106, 12670, 0, 28760, 10456, 12300, 32864, 12588, 12539, 12836,
+    12680, 5987, 0, 28761, 12550, 17059, 10537, 28827, 16766, 16585, 12358, 16499, 0, 28797, 28682, 12779,
+    20486, 16835, 32781, 17194, 16919, 28814, 0, 10531, 0, 10278, 0, 9657, 6003, 9657, 8469, 32923,
+    9075, 10815, 5894, 16542, 16919, 0, 0, 16773, 0, 32845, 28696, 0, 9619, 9388, 9301, 9861,
+    28770, 9892, 16980, 28758, 12512, 0, 9059, 10832, 12948, 5587, 9066, 12862, 28819, 32845, 10406, 0,
+    0, 9892, 32778, 5368, 12551, 0, 9663, 11080, 0, 0, 13080, 28793, 9793, 32906, 12549, 0,
+    10483, 12608, 8469, 0, 13006, 17044, 12058, 12384, 12708, 16588, 0, 0, 0, 28745, 10199, 10787,
+    12888, 9384, 11556, 9381, 12897, 0, 10507, 5588, 0, 11813, 0, 6002, 11302, 28759, 0, 16525,
+    10409, 6038, 16540, 16699, 20484, 4982, 28753, 11182, 32845, 10378, 0, 28739, 12702, 0, 0, 8712,
+    28724, 28749, 13065, 12907, 9619, 32802, 10321, 10412, 12861, 10532, 9021, 28766, 28811, 12991, 12668, 13162,
+    8478, 32807, 6133, 12716, 9310, 11114, 28797, 5455, 0, 12419, 6132, 9479, 12695, 28827, 0, 10108,
+    28746, 12078, 8271, 12780, 9310, 8461, 12915, 11274, 28798, 28810, 17044, 11131, 28770, 12744, 10406, 12828,
+    9674, 12500, 16608, 12991, 13040, 12851, 28704, 6427, 28814, 11339, 8721, 0, 11412, 8786, 16437, 12468,
+    0, 16998, 8988, 13118, 9332, 0, 32845, 0, 4570, 28797, 10446, 5103, 8721, 12500, 6141, 0,
+    13007, 16988, 32855, 11086, 9863, 11296, 17377, 9685, 6290, 0, 0, 0, 12585, 16585, 12863, 0,
+    8683, 9089, 10160, 10787, 5362, 9480, 0, 12576, 0, 12946, 16541, 28764, 32869, 12693, 12912, 12527,
+    0, 28824, 16767, 16767, 9647, 13095, 12684, 28761, 11780, 12731, 12694, 0, 9655, 10159, 0, 16835,
+    12596, 9509, 12764, 12504, 20487, 10148, 10206, 28693, 12875, 12489, 12670, 12900, 12467, 12703, 5650, 12712,
+    0, 9907, 9802, 5076, 17409, 12899, 0, 28821, 12906, 28750, 9862, 12597, 28763, 10153, 0, 8713,
+    12444, 0, 9899, 16993, 11167, 9307, 12576, 28758, 10115, 12407, 28740, 32832, 0, 10108, 8721, 5104,
+    12713, 16903, 0, 13020, 12540, 12896, 12715, 5408, 17238, 32866, 11573, 9067, 0, 28757, 0, 0,
+    0, 32807, 13084, 12408, 28714, 28717, 28682, 9620, 0, 17061, 28720, 12561, 32794, 16912, 11799, 0,
+    0, 0, 12706, 13026, 12406, 12575, 0, 28781, 9981, 8934, 0, 13005, 12324, 28819, 16903, 12634,
+    12905, 28736, 12402, 10871, 28703, 5648, 9365, 32878, 28683, 13031, 0, 17384, 32818, 11274, 12790, 12694,
+    16794, 0, 28808, 32879, 32815, 5647, 0, 0, 0, 10191, 28759, 17268, 0, 12896, 8422, 12067,
+    8880, 12799, 0, 12852, 28678, 28797, 0, 12823, 10489, 11302, 0, 12765, 12836, 10562, 0, 16903,
+    0, 0, 32790, 5900, 28795, 13004, 0, 10218, 28777, 20490, 32777, 12992, 16927, 13007, 28741, 0,
+    32879, 9316, 0, 12864, 10152, 32846, 0, 11394, 0, 9676, 13006, 12942, 12609, 5109, 5922, 11702,
+    12623, 28684, 16683, 28745, 9085, 9918, 10505, 16578, 10414, 12916, 16992, 13097, 10190, 0, 0, 8787,
+    0, 10583, 11340, 9685, 17072, 9086, 17408, 12695, 28747, 0, 10837, 12538, 28752, 0, 0, 0,
+    12420, 32879, 32819, 11037, 0, 0, 8721, 28755, 10113, 12611, 9649, 12887, 9310, 10191, 28763, 13110,
+    10747, 28815, 9374, 32874, 9003, 12839, 16688, 12823, 9085, 17059, 8768, 12971, 12588, 17092, 0, 28763,
+    5585, 11152, 13018, 12321, 16928, 9817, 9367, 32894, 12684, 13181, 28739, 32892, 9795, 28823, 12621, 9684,
+    28758, 17406, 12450, 10758, 0, 5926, 13209, 0, 9374, 12777, 16539, 17319, 5613, 12971, 28681, 0,
+    32897, 28752, 0, 6021, 12312, 10835, 28764, 6408, 6305, 28750, 0, 28762, 10115, 8554, 12622, 10253,
+    28736, 0, 10787, 28684, 11566, 11566, 28724, 13162, 11334, 11631, 5656, 0, 0, 28763, 5993, 11112,
+    0, 12731, 16828, 5926, 10451, 28731, 32844, 32777, 16517, 16825, 0, 32829, 9956, 12947, 11136, 12655,
+    11041, 8768, 17001, 12621, 32805, 12334, 13195, 13006, 5113, 0, 16620, 9387, 10713, 0, 32818, 13145,
+    11340, 0, 12899, 12547, 11046, 0, 0, 12818, 11593, 0, 0, 10490, 28811, 17138, 28786, 8912,
+    28762, 12456, 12714, 0, 11311, 32817, 13007, 28730, 28718, 0, 11638, 28678, 11677, 17252, 16437, 16540,
+    0, 4545, 12719, 6299, 11086, 16972, 12778, 0, 9831, 12789, 12417, 12715, 0, 28747, 28747, 28717,
+    28733, 0, 17001, 11889, 12920, 0, 8777, 6319, 9078, 11134, 12572, 16904, 0, 32895, 10108, 6151,
+    0, 12713, 32846, 10169, 11832, 17072, 12010, 0, 12600, 12899, 12916, 16541, 12419, 0, 16989, 0,
+    10792, 12778, 13085, 32856, 28683, 10254, 0, 8314, 13164, 10539, 16620, 32844, 32878, 5653, 28764, 16974,
+    16935, 28758, 0, 12751, 0, 5620, 10711, 11379, 5111, 13008, 12455, 17044, 10852, 8478, 12912, 13102,
+    0, 17150, 0, 12715, 28793, 10215, 0, 12526, 12564, 12933, 12528, 0, 32833, 28810, 32869, 28682,
+    6426, 12826, 8790, 10705, 20482, 0, 12810, 0, 13198, 9656, 12684, 32856, 10561, 28774, 28727, 9601,
+    10208, 9974, 8338, 28678, 12466, 8488, 13119, 28706, 28691, 12408, 12620, 5106, 32779, 12585, 9035, 28776,
+    10714, 12587, 0, 11304, 32878, 0, 16999, 8657, 11683, 0, 8760, 12597, 5105, 6014, 6014, 13035,
+    28707, 13019, 12756, 32856, 0, 12809, 0, 0, 12705, 12648, 10853, 11012, 0, 12862, 17273, 28692,
+    16777, 28703, 11638, 28681, 0, 0, 9673, 12076, 28728, 12839, 8470, 11712, 0, 32819, 32933, 28750,
+    0, 32871, 28765, 20485, 0, 12502, 12621, 5590, 9375, 0, 17129, 12717, 32879, 10501, 11595, 32930,
+    11151, 6042, 0, 5490, 11309, 10284, 0, 0, 17052, 17201, 28776, 12813, 17014, 28807, 28753, 9676,
+    17081, 6042, 13066, 9684, 16695, 9078, 16541, 0, 16778, 11476, 5928, 12600, 12467, 0, 28749, 28737,
+    5524, 12791, 12719, 10758, 10505, 8479, 0, 9965, 12420, 5105, 11956, 12788, 32833, 0, 10861, 6344,
+    17203, 28808, 8394, 28720, 9050, 12719, 10190, 12813, 11603, 9610, 12875, 12900, 16931, 28693, 28810, 12068,
+    10549, 32845, 32868, 28698, 0, 6299, 28751, 11356, 16406, 0, 9445, 16983, 28787, 12744, 12492, 20487,
+    32869, 32857, 16795, 28760, 12935, 12980, 13097, 0, 9265, 32882, 16778, 0, 5629, 32845, 11684, 12942,
+    16922, 17229, 13138, 12899, 32868, 32803, 4367, 0, 0, 11678, 5541, 28806, 9676, 28685, 32897, 20487,
+    11104, 8863, 9076, 28776, 12455, 12672, 10215, 28795, 28798, 13087, 10191, 10794, 16462, 0, 0, 0,
+    5619, 6172, 12550, 12943, 12041, 5591, 28738, 9609, 0, 32930, 10204, 12888, 17000, 9429, 5110, 0,
+    0, 11434, 8423, 11311, 20486, 8488, 28737, 28787, 9975, 9384, 12825, 12464, 28722, 28758, 0, 9146,
+    20487, 9078, 12911, 0, 32833, 28714, 10514, 9908, 10837, 28788, 11142, 28709, 11728, 8594, 10789, 28731,
+    0, 16845, 12957, 0, 28748, 28683, 0, 8713, 12837, 10452, 0, 0, 0, 16498, 12659, 10788,
+    0, 32930, 12456, 0, 12899, 0, 16983, 0, 12947, 12840, 12742, 12689, 12621, 28818, 28706, 9965,
+    17289, 9900, 16914, 10514, 13062, 13008, 32869, 0, 0, 9321, 13017, 17226, 12864, 32868, 13139, 0,
+    10505, 12528, 13036, 6151, 17229, 6323, 9686, 28759, 28766, 0, 12716, 12958, 0, 6319, 28809, 13077,
+    12405, 10503, 13087, 17094, 28674, 12562, 0, 13006, 0, 32856, 32879, 32881, 28785, 28796, 28724, 20489,
+    28745, 32857, 9685, 32922, 10514, 13099, 32820, 32794, 9087, 0, 12840, 0, 10247, 10178, 28805, 12982,
+    11853, 12648, 32832, 32883, 28766, 12888, 12551, 32855, 13163, 11414, 10713, 16673, 0, 0, 12908, 0,
+    28743, 28809, 12886, 12564, 10566, 0, 12900, 12528, 32779, 0, 9891, 28776, 0, 8412, 16619, 32881,
+    9687, 12862, 0, 6431, 12620, 11386, 16697, 6216, 6321, 12588, 28720, 12624, 16974, 16924, 12384, 13066,
+    8489, 8479, 6210, 20487, 8789, 10759, 9897, 12456, 12972, 6048, 6320, 16999, 28719, 17411, 13138, 28761,
+    11709, 11633, 5672, 6173, 11838, 0, 11349, 16539, 16778, 5928, 12696, 0, 20488, 16517, 12812, 12058,
+    11459, 10254, 0, 0, 17072, 13172, 28760, 11171, 13100, 12983, 11355, 28684, 0, 17053, 12823, 9366,
+    8336, 16779, 17307, 0, 9320, 10497, 0, 0, 0, 11639, 0, 10261, 12908, 0, 11095, 13026,
+    9683, 10793, 12944, 10249, 12921, 12744, 9388, 0, 0, 17210, 32868, 11013, 6386, 9609, 12743, 8779,
+    28809, 16904, 9385, 9986, 13019, 32814, 11780, 8480, 9964, 32895, 12705, 32846, 13016, 9984, 0, 28760,
+    0, 17072, 11356, 12755, 12520, 12390, 28784, 28763, 16609, 28755, 9076, 12583, 6324, 6049, 17012, 12969,
+    16542, 0, 28713, 0, 0, 10868, 32838, 9618, 28787, 17280, 0, 28757, 0, 8713, 28785, 32872,
+    32895, 9986, 28786, 9343, 9367, 16923, 11838, 28754, 0, 9682, 11356, 11656, 17332, 5499, 0, 9974,
+    12708, 5673, 12408, 12623, 8574, 12320, 12790, 11404, 17151, 0, 13112, 32794, 0, 12416, 13006, 28799,
+    0, 0, 28790, 6383, 17309, 13115, 5591, 8722, 12705, 0, 12689, 10282, 28807, 12696, 13212, 13137,
+    0, 13032, 13053, 10199, 12801, 11685, 12465, 0, 12864, 16856, 10511, 0, 28798, 28719, 12552, 32881,
+    5628, 11971, 28678, 28769, 0, 28761, 0, 6179, 12405, 0, 8478, 0, 0, 16585, 13020, 13038,
+    32791, 12789, 10797, 0, 0, 16887, 32894, 17004, 5592, 12922, 12550, 13008, 11603, 11956, 17238, 5662,
+    17094, 0, 12945, 0, 9610, 6447, 12429, 0, 10853, 11167, 32933, 6053, 28750, 32871, 12812, 0,
+    8918, 28777, 12336, 16925, 12944, 12892, 20483, 10567, 28758, 10879, 12693, 0, 0, 12798, 28799, 32924,
+    6217, 28774, 17093, 11401, 28679, 13109, 12948, 0, 17220, 0, 28710, 12756, 12660, 0, 13053, 10797,
+    9917, 0, 9674, 32882, 6327, 12359, 9311, 32884, 4310, 0, 12699, 16925, 12792, 17159, 10849, 12528,
+    10814, 17083, 28755, 8491, 12971, 0, 13065, 17161, 12478, 11767, 9665, 12804, 12738, 9975, 10273, 0,
+    10461, 0, 10553, 16578, 10178, 5674, 28703, 17151, 9917, 0, 0, 9321, 4876, 0, 17411, 13016,
+    5666, 16947, 16935, 9838, 12406, 12418, 11096, 16448, 0, 17330, 6349, 11739, 10568, 32792, 12996, 8790,
+    0, 9891, 9088, 17398, 13020, 11702, 12802, 32883, 28707, 0, 8769, 0, 28680, 12945, 16936, 8680,
+    11356, 16616, 28789, 28773, 32935, 32895, 6211, 0, 6392, 32905, 32883, 11349, 28701, 11178, 28786, 32932,
+    16848, 0, 28753, 9321, 16779, 17158, 8749, 32869, 12540, 28795, 12944, 10852, 12599, 10813, 28824, 10815,
+    17369, 11357, 16429, 12336, 28748, 17411, 11050, 12900, 28777, 5674, 0, 10862, 0, 28681, 6217, 6437,
+    0, 32895, 11148, 16858, 11113, 11115, 12357, 11703, 16421, 28721, 28811, 32885, 13063, 0, 10572, 12840,
+    13014, 20485, 10552, 0, 12648, 16779, 32833, 12441, 32896, 28828, 13090, 13211, 16458, 0, 11709, 0,
+    12934, 0, 0, 6394, 13138, 0, 32884, 10584, 32908, 0, 28826, 28811, 0, 12689, 13164, 0,
+    28800, 9077, 11151, 32807, 11854, 0, 13027, 12827, 28755, 12296, 11152, 12910, 0, 12719, 12933, 12619,
+    12725, 13039, 12910, 11349, 28811, 20489, 9982, 0, 28828, 13100, 0, 13152, 17218, 32859, 6225, 11113,
+    0, 13007, 28796, 13028, 0, 10218, 0, 5674, 10815, 28784, 28745, 0, 28762, 32814, 13062, 12624,
+    0, 0, 17160, 6356, 28734, 12984, 12456, 28793, 12552, 17211, 16832, 0, 32895, 28735, 32897, 17171,
+    12346, 4593, 13196, 10281, 17072, 13137, 28751, 10871, 17237, 10814, 28736, 28759, 11410, 28747, 12027, 12828,
+    12027, 28719, 0, 10881, 17229, 0, 16894, 12392, 0, 12310, 12911, 0, 32804, 8318, 32871, 13149,
+    8440, 12946, 12068, 12719, 13114, 0, 12564, 17082, 0, 12356, 12827, 0, 28807, 0, 28686, 0,
+    13074, 6181, 11149, 16816, 28766, 5888, 11739, 12899, 0, 10326, 6050, 32897, 0, 10852, 0, 12516,
+    28748, 12815, 28747, 9657, 11411, 28778, 12934, 28692, 12504, 10208, 0, 28783, 0, 13149, 16737, 8949,
+    28807, 0, 17004, 10813, 13135, 16910, 10506, 32937, 10281, 11768, 28767, 13150, 12612, 9964, 5629, 9620,
+    16873, 0, 28799, 16429, 8752, 12933, 11972, 11414, 28772, 10703, 12677, 16527, 17159, 5674, 12839, 0,
+    5629, 0, 5928, 12648, 10814, 16858, 8386, 8382, 17151, 0, 32855, 12564, 13052, 10869, 0, 28798,
+    28778, 17218, 16776, 11654, 13101, 12803, 28732, 11167, 28751, 0, 28722, 20489, 12594, 4609, 0, 8723,
+    13041, 10860, 11357, 0, 0, 13158, 0, 12864, 16597, 9770, 8403, 13064, 16895, 13041, 12576, 10262,
+    10145, 16936, 11693, 0, 11404, 12515, 10517, 28809, 12599, 13151, 28752, 32867, 10255, 12504, 28751, 12576,
+    17411, 0, 13148, 0, 32896, 10814, 12720, 12624, 28767, 12946, 28790, 11655, 10263, 0, 28695, 17289,
+    0, 12420, 9908, 28758, 12636, 13101, 0, 28701, 0, 28739, 28679, 28762, 0, 12704, 8790, 10868,
+    13112, 12847, 8875, 11143, 12322, 0, 0, 11734, 6277, 10217, 13052, 16830, 28723, 17121, 12773, 12707,
+    4614, 12346, 10814, 12958, 0, 10739, 28786, 16934, 0, 0, 28773, 12789, 17091, 32885, 17052, 11893,
+    0, 11168, 0, 6327, 0, 28790, 9918, 32884, 12593, 0, 12310, 16588, 12695, 0, 32907, 11700,
+    11113, 11059, 12768, 12683, 9956, 8278, 0, 0, 0, 12888, 12696, 0, 32897, 16778, 8605, 13114,
+    10285, 12984, 12502, 17319, 20489, 8988, 12731, 0, 12527, 0, 32879, 12750, 10414, 0, 11414, 12768,
+    28755, 11170, 0, 32858, 20482, 28797, 0, 12306, 0, 11113, 6392, 13102, 28753, 16925, 12653, 9540,
+    12827, 17161, 13197, 28770, 0, 12815, 12298, 11701, 11147, 17083, 16744, 32937, 0, 13016, 12407, 28768,
+    12539, 9986, 11711, 4868, 12683, 0, 0, 12825, 8703, 12788, 13115, 0, 11168, 0, 12945, 28682,
+    16576, 11872, 28791, 0, 0, 10861, 0, 32920, 28681, 12403, 13055, 13113, 11866, 0, 8283, 8656,
+    32936, 11703, 8480, 10562, 32832, 0, 0, 9367, 28709, 16419, 8618, 16992, 11296, 11900, 0, 17196,
+    13092, 0, 28712, 0, 28770, 17252, 10517, 12492, 9306, 8854, 13043, 6225, 12636, 13139, 16527, 0,
+    9010, 28688, 17239, 16813, 10161, 0, 28724, 8283, 10878, 12344, 28709, 8307, 12321, 28733, 12904, 13065,
+    0, 17014, 13166, 12343, 0, 13104, 32781, 5021, 0, 11710, 32906, 28750, 16765, 12298, 16741, 13020,
+    0, 12032, 28704, 11081, 0, 0, 32791, 28758, 12850, 13100, 12540, 12905, 32777, 11115, 0, 10506,
+    11931, 13088, 12842, 10861, 28743, 0, 13218, 0, 12828, 13076, 0, 10281, 16595, 17093, 12652, 12804,
+    0, 32893, 0, 11458, 0, 28676, 28796, 0, 12896, 10759, 9502, 8752, 12780, 12923, 11712, 12581,
+    28772, 32918, 17093, 16935, 11458, 17306, 17174, 12984, 6232, 17070, 11403, 9905, 16666, 32789, 28800, 0,
+    0, 28750, 32898, 12659, 0, 16439, 10273, 6447, 0, 16503, 28699, 6364, 12066, 28705, 12591, 12744,
+    11169, 12594, 10572, 17239, 10806, 8491, 4436, 11450, 0, 9584, 16509, 16420, 11177, 11931, 9772, 0,
+    6440, 9539, 17241, 9974, 13076, 12503, 16669, 16435, 28711, 13054, 12010, 10461, 0, 9387, 11413, 17093,
+    6233, 13078, 12663, 28807, 12744, 8947, 28705, 11712, 12368, 13043, 0, 32814, 28696, 0, 9387, 12358,
+    16594, 9564, 12294, 4563, 8312, 0, 0, 13053, 32885, 8699, 9538, 28813, 28733, 28684, 12834, 13152,
+    28807, 8654, 8611, 10872, 4822, 0, 12573, 8256, 6233, 0, 6235, 12996, 0, 16831, 28810, 6409,
+    16430, 12491, 8312, 12346, 0, 0, 17172, 13042, 12644, 12332, 10012, 8414, 12744, 11058, 11042, 12799,
+    0, 11983, 6466, 17238, 0, 6360, 0, 6444, 16675, 8349, 8653, 0, 12310, 28812, 8851, 11953,
+    32816, 28805, 0, 0, 28673, 32793, 13115, 9744, 10577, 8961, 13158, 16725, 0, 13076, 6364, 17347,
+    10871, 12930, 12808, 0, 28736, 0, 10507, 10199, 4434, 0, 0, 0, 10603, 28791, 28685, 0,
+    4706, 17091, 13137, 12416, 16583, 32804, 12759, 0, 0, 8994, 13079, 12804, 10578, 11470, 16674, 17384,
+    28802, 28817, 12864, 28704, 11348, 12600, 32792, 16677, 0, 12394, 13101, 13065, 16830, 12552, 32779, 0,
+    12900, 0, 6357, 6235, 28738, 4560, 28708, 11170, 28741, 0, 8789, 12522, 17016, 8363, 12756, 12522,
+    28708, 0, 28784, 16587, 0, 12530, 11460, 12600, 16743, 13092, 28736, 16597, 12740, 16650, 32844, 9490,
+    13136, 9153, 9687, 16571, 6234, 13064, 28742, 0, 28737, 12322, 13186, 10160, 32793, 10580, 0, 0,
+    28747, 0, 11741, 28746, 32859, 0, 12404, 12468, 12558, 8953, 16766, 16499, 13161, 28774, 13042, 32790,
+    32930, 12574, 12828, 6410, 28772, 9388, 17249, 13074, 13088, 9452, 5820, 11656, 28676, 0, 6402, 32778,
+    0, 12624, 8790, 12942, 28791, 13078, 13152, 12322, 6439, 17408, 12514, 16536, 28814, 12057, 12719, 10497,
+    8927, 17309, 28716, 9614, 11901, 32885, 12663, 28705, 28756, 9816, 8643, 9012, 28756, 12657, 0, 28778,
+    28708, 12684, 28793, 0, 12845, 8662, 0, 9854, 13162, 8583, 17240, 9539, 16822, 0, 10648, 0,
+    16822, 12900, 32923, 8964, 0, 13076, 12357, 6438, 28791, 0, 12955, 10879, 0, 10881, 12675, 12731,
+    12383, 9252, 0, 0, 12796, 0, 28685, 28743, 13171, 9686, 12442, 8917, 0, 12038, 28688, 11767,
+    16609, 28770, 16685, 12816, 6448, 11759, 11479, 0, 28749, 8491, 11168, 8654, 5388, 8850, 28791, 28686,
+    10399, 16925, 16925, 16991, 13151, 16461, 32898, 10336, 0, 12383, 13043, 16763, 11765, 13077, 10872, 28738,
+    32793, 0, 12530, 12948, 11983, 12492, 17251, 13159, 8854, 8789, 32806, 9290, 28813, 12346, 12924, 0,
+    17071, 11477, 28677, 12843, 17171, 0, 17227, 12737, 12490, 0, 12897, 12478, 10871, 12392, 0, 12522,
+    0, 12669, 12612, 12947, 13075, 12558, 28695, 32792, 16527, 32793, 13167, 8701, 11946, 0, 8344, 0,
+    13205, 12844, 8344, 12870, 0, 17016, 10881, 16516, 12418, 28740, 9477, 28741, 28737, 6234, 13152, 0,
+    5290, 28681, 16852, 8313, 12924, 0, 10870, 16743, 32780, 0, 13140, 11938, 13163, 12651, 9350, 8577,
+    10157, 13079, 32933, 0, 28807, 28704, 11477, 10880, 9512, 12381, 12395, 0, 8643, 0, 16676, 11460,
+    16450, 13182, 28731, 9008, 28714, 0, 9969, 12593, 11679, 0, 12704, 9208, 11113, 0, 11470, 12462,
+    28741, 5665, 13077, 12348, 4403, 10872, 28716, 12629, 9585, 0, 16685, 32806, 8708, 10883, 0, 0,
+    12551, 12451, 16579, 9253, 0, 10582, 12394, 28690, 12593, 32791, 12323, 0, 0, 10183, 12828, 0,
+    0, 12532, 28722, 8663, 16598, 4405, 12404, 8962, 0, 32885, 13066, 11780, 0, 9051, 0, 32790,
+    17016, 11632, 12780, 8468, 9180, 12570, 0, 13128, 8700, 12672, 16843, 12950, 11395, 8366, 9175, 16586,
+    12563, 0, 32806, 8418, 28691, 16736, 12514, 32919, 32879, 9545, 9640, 0, 0, 0, 11956, 12346,
+    10487, 17070, 32790, 13113, 28817, 12497, 32793, 16658, 17309, 12442, 0, 13183, 12336, 11757, 12462, 10872,
+    12407, 8606, 12904, 9844, 0, 13194, 12629, 13043, 16430, 32793, 10880, 28769, 8416, 6409, 28747, 16766,
+    6234, 17016, 32917, 13090, 32793, 28692, 32831, 9244, 9553, 0, 16539, 10905, 0, 12947, 12707, 9246,
+    16687, 0, 13175, 10461, 9204, 0, 9507, 16777, 16667, 0, 6402, 12467, 16685, 13168, 12428, 11297,
+    12347, 28748, 32898, 0, 0, 12532, 28811, 0, 12395, 0, 0, 16676, 4451, 28743, 17016, 12978,
+    12856, 17007, 12760, 28746, 13224, 11180, 16620, 0, 6457, 11711, 0, 13174, 12037, 13041, 12427, 6105,
+    10506, 0, 9062, 28798, 0, 0, 12406, 28683, 12630, 0, 12948, 0, 9175, 0, 10190, 9346,
+    10880, 12405, 16873, 13104, 16831, 28719, 12441, 12884, 32818, 13111, 28797, 16658, 8362, 28746, 0, 13195,
+    12972, 12797, 0, 17173, 12310, 16658, 11946, 12503, 8612, 0, 10909, 5514, 13139, 28809, 11179, 11161,
+    10285, 8409, 12418, 13056, 0, 28735, 28687, 8284, 0, 11953, 12324, 28728, 16605, 16746, 12788, 0,
+    17318, 8390, 12803, 10284, 12443, 0, 32779, 0, 12345, 32856, 13050, 11460, 12864, 8421, 0, 13209,
+    28761, 12840, 9543, 32829, 12393, 8356, 11410, 5656, 0, 28748, 32920, 32885, 0, 6365, 0, 0,
+    9985, 4452, 10204, 32922, 8464, 16449, 20485, 16607, 16858, 17004, 9000, 13167, 16745, 16597, 0, 32817,
+    11767, 5813, 12666, 28727, 12988, 28689, 9750, 28806, 8356, 9642, 8320, 32804, 10919, 16462, 32932, 9908,
+    5340, 17001, 8777, 9800, 0, 12582, 13182, 28700, 28768, 0, 32920, 16696, 32807, 5872, 9799, 12394,
+    13090, 0, 4614, 9388, 8284, 11901, 28817, 0, 28797, 0, 28788, 13042, 0, 11436, 0, 12359,
+    11203, 32923, 17095, 12323, 28709, 11750, 8709, 16746, 13044, 16539, 16857, 11096, 32806, 5511, 13205, 28729,
+    8777, 0, 0, 12523, 28821, 4719, 0, 16458, 32883, 5211, 16933, 0, 0, 13115, 13062, 12322,
+    11713, 28707, 28737, 12583, 12867, 12583, 0, 11766, 12383, 32817, 17160, 8449, 11480, 17320, 13182, 28821,
+    9544, 0, 11169, 11385, 28798, 17014, 6210, 12696, 28689, 16666, 20484, 0, 11479, 0, 32922, 0,
+    0, 0, 12511, 16500, 0, 17013, 12762, 0, 10584, 12866, 16616, 32805, 4916, 12953, 8948, 16746,
+    28705, 28763, 12406, 17319, 0, 28765, 4926, 10861, 16841, 9049, 13194, 28727, 28814, 13152, 32919, 28739,
+    0, 0, 12000, 16950, 20484, 0, 13183, 10095, 10845, 16815, 12868, 10043, 12924, 4465, 32866, 5284,
+    16605, 9320, 28828, 16460, 9087, 12048, 10436, 9000, 8314, 9089, 16429, 12921, 9307, 0, 28703, 8993,
+    28813, 16451, 13056, 28718, 9808, 12324, 32803, 10060, 28704, 8955, 8883, 0, 13176, 12009, 12726, 12857,
+    12690, 16598, 0, 12984, 8656, 16456, 32920, 4826, 17386, 16449, 10561, 32828, 13068, 16677, 13103, 28701,
+    12909, 32815, 13194, 9049, 9776, 32817, 9545, 12670, 0, 13196, 11601, 16529, 11489, 12360, 16615, 12689,
+    13162, 0, 10095, 8709, 32919, 17252, 4867, 4466, 6189, 12678, 28695, 28822, 8476, 13163, 0, 20481,
+    12335, 28737, 5767, 0, 12716, 0, 8613, 28712, 10207, 32806, 11493, 16755, 28713, 13150, 0, 9808,
+    28809, 9348, 28749, 12359, 0, 12911, 0, 8920, 0, 9450, 13195, 17159, 11144, 13173, 12359, 17359,
+    0, 13174, 12948, 10582, 16746, 12045, 12970, 8451, 5844, 0, 6188, 9589, 0, 13103, 28778, 28725,
+    16832, 28798, 16453, 0, 4882, 8277, 8351, 28785, 12583, 11171, 9261, 16540, 28705, 13198, 8314, 12684,
+    13195, 28718, 12488, 16460, 13197, 28687, 16607, 11436, 12881, 8580, 5019, 4687, 12300, 28748, 28750, 16597,
+    12526, 12391, 17352, 10136, 16884, 0, 12406, 13068, 11780, 28723, 12879, 32780, 16695, 28828, 0, 12428,
+    12419, 28707, 4885, 12785, 16540, 16698, 8466, 12899, 0, 32852, 9846, 32841, 32816, 16778, 12778, 8718,
+    9293, 12559, 0, 12835, 13079, 13143, 12562, 0, 12812, 28730, 11956, 32910, 10348, 12936, 12408, 13163,
+    8657, 16438, 0, 10681, 28730, 32791, 28705, 9839, 0, 9852, 28678, 28787, 0, 12309, 0, 8750,
+    0, 12584, 0, 28713, 13032, 28727, 10805, 9055, 28715, 28746, 12526, 0, 13151, 16779, 0, 0,
+    0, 16932, 10648, 0, 13183, 8894, 12442, 17116, 16448, 8689, 0, 13024, 9248, 0, 12348, 10735,
+    28740, 32805, 9233, 9814, 0, 12839, 9263, 16609, 13139, 5893, 11778, 28679, 32792, 13187, 10101, 32885,
+    12056, 10658, 12539, 9068, 0, 9062, 12040, 12932, 12574, 28694, 16518, 12549, 0, 12984, 0, 28795,
+    16686, 9680, 32794, 16540, 10399, 11348, 32844, 0, 5763, 12347, 16685, 0, 8649, 10669, 13051, 32845,
+    12946, 28733, 6078, 20481, 4966, 16685, 12503, 8750, 11480, 9518, 9262, 28749, 12322, 8322, 12804, 9017,
+    11450, 9552, 16450, 11777, 0, 12039, 32778, 0, 12547, 32896, 12324, 0, 16688, 12511, 28818, 28775,
+    28749, 32794, 12002, 12443, 12991, 0, 8689, 12847, 12444, 4875, 28709, 9860, 12384, 0, 13032, 28750,
+    12894, 32896, 12891, 13007, 0, 17411, 10947, 11910, 13195, 5851, 28739, 28690, 32872, 0, 17306, 16937,
+    28760, 16858, 12501, 12595, 28726, 12656, 12514, 0, 0, 12631, 16621, 11778, 0, 9299, 0, 28820,
+    12488, 13199, 0, 0, 28681, 28760, 32935, 0, 13187, 12572, 32807, 9361, 0, 10655, 17092, 28769,
+    32781, 5532, 12667, 16833, 11759, 16658, 10250, 0, 12002, 9510, 12572, 10580, 5498, 13080, 12527, 17305,
+    12503, 32906, 28768, 32790, 12643, 16540, 0, 12667, 0, 16885, 32853, 12585, 16823, 11480, 32781, 13056,
+    8446, 0, 8957, 10100, 0, 8745, 20489, 0, 10099, 4964, 0, 0, 28790, 12466, 16617, 32922,
+    28710, 16925, 12513, 12801, 0, 0, 12607, 4630, 17082, 16509, 28823, 0, 0, 12835, 12323, 0,
+    16824, 28768, 12491, 13185, 0, 12763, 12561, 28745, 12595, 28773, 5771, 12672, 16697, 8458, 9919, 16824,
+    17083, 9294, 32909, 28737, 13144, 12476, 12048, 12336, 13152, 12384, 28714, 12988, 16952, 10941, 8666, 6401,
+    28724, 13122, 32934, 0, 16598, 8832, 28718, 13217, 28722, 9301, 0, 5536, 16886, 0, 8920, 0,
+    11955, 10954, 28733, 12729, 9441, 32806, 5535, 12455, 12560, 0, 0, 10667, 13140, 12987, 10641, 28715,
+    32781, 32923, 0, 0, 0, 0, 28717, 0, 10698, 12011, 28726, 12763, 13115, 17013, 12478, 0,
+    12344, 12786, 17369, 32864, 10184, 16842, 28728, 16834, 13199, 28721, 17162, 12347, 0, 32896, 0, 10137,
+    8956, 8484, 0, 9593, 12516, 12892, 8412, 12068, 10969, 0, 0, 17083, 13188, 9363, 0, 17091,
+    10389, 12562, 0, 12311, 12311, 28715, 28819, 12444, 16965, 12719, 8620, 13208, 16833, 13186, 13051, 32842,
+    12504, 9946, 28676, 12336, 12011, 28706, 12550, 0, 9193, 0, 13092, 16722, 11240, 16844, 12360, 0,
+    20485, 0, 8745, 16528, 8367, 8414, 4949, 9852, 0, 28727, 12848, 12884, 28719, 9147, 12965, 12548,
+    28824, 10563, 12536, 28702, 10347, 32907, 10072, 28760, 12977, 32794, 4962, 8392, 16440, 28739, 28681, 28694,
+    0, 16886, 28673, 28758, 0, 0, 28720, 9309, 8696, 16697, 10584, 16498, 17116, 0, 12348, 0,
+    0, 32820, 16541, 8366, 10735, 28747, 28761, 17253, 13068, 12560, 28729, 12848, 12502, 28821, 12523, 16445,
+    9687, 6327, 0, 12476, 12408, 10642, 0, 12371, 13145, 28779, 0, 16650, 17082, 32794, 0, 28728,
+    12885, 9593, 5545, 10371, 0, 17368, 16519, 28737, 12888, 6211, 8464, 0, 12048, 12815, 13219, 28673,
+    28695, 28792, 16427, 16899, 16908, 12408, 28758, 12475, 0, 6249, 28821, 28679, 28807, 5334, 12296, 28746,
+    12420, 6168, 0, 9002, 12348, 16900, 16746, 12585, 9913, 9218, 0, 0, 0, 12049, 0, 16621,
+    11255, 8704, 12586, 32843, 28773, 0, 0, 0, 17041, 12002, 28758, 8487, 12977, 4711, 5098, 17161,
+    11735, 13001, 9809, 8458, 6463, 12348, 12978, 13144, 16911, 32858, 12552, 28821, 8720, 32819, 16978, 9263,
+    8306, 12912, 32831, 28683, 16746, 16755, 4620, 28778, 13209, 0, 9073, 16618, 10630, 0, 16964, 8912,
+    32917, 16908, 10144, 4976, 8908, 10968, 8422, 17329, 16697, 28786, 5427, 12562, 9022, 32793, 0, 32919,
+    11866, 12694, 12077, 28741, 0, 5097, 12894, 12683, 0, 28693, 12966, 0, 12728, 28731, 9011, 9685,
+    0, 32934, 0, 0, 0, 28780, 17398, 10696, 0, 16755, 28819, 0, 16775, 10437, 8338, 16907,
+    12346, 9294, 12573, 10968, 5069, 12476, 17331, 12324, 10437, 32844, 9011, 13188, 28820, 17408, 11871, 8666,
+    10107, 16619, 12597, 0, 0, 32843, 12617, 5351, 12777, 9564, 16676, 12514, 11001, 9057, 12617, 9816,
+    12682, 32807, 9370, 13188, 28689, 28796, 28785, 0, 16439, 0, 11296, 28702, 28754, 0, 13055, 8405,
+    0, 28785, 12966, 28762, 11931, 32833, 12614, 0, 9862, 13187, 0, 28762, 4809, 13176, 11647, 32778,
+    28690, 0, 17093, 28728, 0, 0, 5332, 12408, 9982, 13066, 5860, 12587, 9050, 28733, 28726, 32779,
+    0, 5069, 17093, 8712, 0, 12691, 5557, 17385, 4976, 16540, 12383, 0, 28729, 0, 12574, 13209,
+    0, 11294, 12058, 12924, 13131, 28688, 8405, 9255, 5052, 16451, 28781, 32831, 12668, 28723, 12372, 9010,
+    11530, 28724, 32776, 11271, 10538, 0, 16919, 0, 28749, 13014, 10437, 28683, 16463, 5075, 8759, 16463,
+    32842, 16699, 12765, 13221, 9010, 16619, 6466, 9057, 0, 16886, 12617, 17385, 12012, 9073, 16577, 16619,
+    16779, 28790, 5873, 9892, 12778, 0, 28726, 12500, 13188, 9816, 0, 9853, 17385, 13133, 0, 28771,
+    8413, 10781, 9858, 16924, 9647, 12672, 12607, 28762, 28690, 28703, 28731, 12682, 0, 9608, 5645, 0,
+    32846, 0, 0, 28746, 5811, 0, 32924, 16765, 0, 0, 9019, 12455, 10299, 12712, 0, 9555,
+    8788, 16603, 28794, 8766, 0, 13220, 8576, 13011, 13028, 17394, 28686, 16756, 16901, 0, 16540, 16618,
+    0, 16982, 5556, 12489, 5433, 28776, 12371, 12679, 10780, 13164, 10274, 12848, 12076, 8713, 13008, 12860,
+    28714, 0, 28714, 28718, 9608, 17038, 17377, 28746, 11909, 9809, 5366, 17377, 9861, 12468, 0, 10142,
+    28775, 16746, 11947, 0, 9915, 16909, 9310, 5361, 0, 0, 0, 9318, 32845, 12456, 0, 12456,
+    5552, 12491, 0, 17190, 28707, 11978, 12408, 28770, 28730, 12585, 16688, 16917, 9480, 13212, 12515, 32794,
+    28779, 0, 9846, 12753, 16529, 32893, 13173, 11151, 12372, 16676, 0, 28800, 13030, 28689, 12891, 12778,
+    5830, 12645, 28821, 11105, 0, 0, 13077, 9554, 0, 13208, 17094, 9900, 32781, 0, 0, 12476,
+    12787, 12808, 32894, 28792, 10524, 17117, 0, 12767, 0, 13018, 10760, 10475, 8422, 10736, 5885, 16459,
+    0, 12893, 16778, 0, 12656, 9941, 12895, 9954, 12078, 9066, 12886, 28797, 12608, 32838, 13012, 28782,
+    5563, 4268, 0, 16914, 9648, 10204, 28797, 12646, 12528, 0, 32780, 12478, 12515, 17408, 12903, 28718,
+    4678, 0, 28787, 17015, 12444, 32838, 0, 32924, 28785, 28715, 12479, 28710, 16577, 10837, 0, 10285,
+    9334, 9022, 9908, 12467, 16764, 16621, 28759, 8774, 13221, 9900, 16540, 9239, 16795, 16918, 28673, 0,
+    12515, 32845, 9010, 11549, 12308, 17004, 12539, 8775, 8759, 12980, 12779, 11985, 0, 12563, 0, 5442,
+    28745, 9954, 12564, 6225, 16756, 9896, 32807, 9380, 12968, 32807, 5808, 8864, 12738, 9891, 11171, 0,
+    12432, 28781, 5911, 28729, 11224, 12524, 16845, 12812, 9364, 12563, 9043, 28714, 12551, 13115, 17378, 9654,
+    13078, 11035, 28826, 12468, 12956, 28714, 0, 17388, 13107, 28723, 16700, 0, 0, 0, 32906, 0,
+    17378, 10274, 9564, 0, 32794, 6108, 28797, 8424, 12451, 13005, 12000, 0, 28769, 12335, 9971, 28754,
+    12420, 28689, 12456, 11049, 11003, 12644, 0, 16505, 28733, 8276, 5070, 16937, 32924, 13116, 8768, 16936,
+    32827, 12487, 28698, 0, 0, 0, 12502, 28678, 28690, 17269, 11296, 0, 0, 12524, 13127, 28761,
+    13210, 11713, 12403, 8776, 32863, 12804, 12524, 28820, 28818, 12516, 9020, 32789, 10079, 5454, 12443, 6267,
+    12703, 12967, 12564, 17319, 32789, 28757, 28759, 12467, 9182, 0, 12608, 13224, 28684, 4726, 16530, 9182,
+    28688, 0, 12792, 0, 16586, 32820, 16854, 28740, 12848, 28739, 16902, 20483, 12588, 12644, 12491, 28758,
+    28696, 13221, 28825, 10676, 8636, 12876, 28692, 12828, 5583, 0, 12991, 0, 0, 0, 16700, 0,
+    17195, 0, 17388, 28824, 10736, 12312, 12979, 32865, 12588, 8486, 5584, 32805, 8636, 9619, 0, 32831,
+    17135, 17043, 17387, 0, 10378, 9075, 16923, 28676, 8468, 12740, 10108, 9620, 12618, 0, 12619, 28799,
+    28699, 28819, 4725, 16514, 28827, 16979, 9620, 0, 28690, 16894, 32827, 0, 6000, 16430, 0, 13005,
+    12514, 10781, 16619, 12669, 8321, 17252, 16779, 9815, 0, 28762, 17397, 12407, 11339, 0, 12574, 16937,
+    8979, 12861, 10497, 0, 6270, 28689, 16816, 10704, 28696, 12383, 12887, 16966, 12560, 28739, 12552, 0,
+    0, 5455, 28746, 10199, 12596, 28759, 10115, 17387, 0, 17050, 12380, 28741, 17072, 28708, 28680, 10060,
+    8939, 12703, 12858, 12499, 12991, 16855, 28826, 10975, 0, 9832, 0, 32898, 12574, 12703, 9058, 28823,
+    12611, 28707, 9666, 9969, 0, 28824, 12907, 5613, 17377, 0, 28687, 12514, 9776, 12850, 12887, 10521,
+    12606, 17273, 13206, 10442, 12712, 0, 28803, 12824, 0, 32865, 11592, 28774, 28797, 8414, 28707, 28679,
+    17250, 0, 9088, 12370, 12552, 12346, 5498, 12360, 9845, 12918, 28787, 32832, 12956, 5362, 16972, 0,
+    32897, 17239, 12887, 13136, 12825, 11080, 32865, 32781, 28780, 8358, 8767, 12852, 12514, 0, 17388, 32924,
+    4937, 12678, 32794, 5489, 17399, 0, 0, 12924, 28704, 9863, 28786, 17122, 0, 8777, 9592, 0,
+    17044, 28759, 12694, 12540, 12669, 8479, 0, 17043, 13176, 9854, 0, 32807, 13119, 0, 12466, 32807,
+    13096, 8468, 28781, 0, 12924, 12799, 12728, 0, 5922, 6142, 12504, 0, 16887, 12792, 13140, 16619,
+    32846, 9962, 10456, 0, 10975, 28795, 12564, 4728, 28788, 5830, 0, 12959, 0, 11346, 9675, 0,
+    0, 9320, 10412, 12838, 8768, 0, 16835, 11932, 0, 12968, 0, 12456, 0, 28752, 12430, 28758,
+    0, 12907, 16929, 12807, 11565, 13007, 12633, 9863, 12980, 28750, 12803, 13161, 32820, 16929, 0, 20483,
+    0, 13212, 12635, 32820, 12887, 9302, 12540, 0, 11703, 13005, 28740, 16760, 8284, 28727, 0, 12657,
+    12588, 12700, 11572, 0, 12915, 9916, 10975, 28695, 32844, 16777, 12691, 0, 11673, 28749, 10539, 32868,
+    20486, 16676, 5461, 28721, 11004, 32865, 28816, 12573, 28784, 12564, 6281, 11003, 13007, 9365, 8776, 12513,
+    12906, 5585, 9907, 16776, 11380, 10246, 17397, 13010, 13109, 16767, 16921, 11926, 0, 8378, 16835, 12359,
+    13014, 0, 17200, 8477, 0, 13006, 10145, 12860, 0, 10543, 9088, 28798, 12609, 28690, 12915, 28759,
+    17408, 0, 12612, 6042, 5496, 10443, 13025, 16843, 11136, 28818, 28746, 12599, 12480, 8966, 13126, 9375,
+    0, 10239, 0, 12550, 11005, 8469, 13003, 28782, 10198, 12837, 17122, 10539, 12864, 28808, 9336, 13007,
+    0, 12828, 6014, 13016, 10115, 11758, 11086, 28683, 9321, 12420, 10444, 13005, 12588, 6014, 16854, 16921,
+    0, 8719, 28746, 12909, 0, 5076, 16618, 0, 12431, 0, 0, 12563, 28786, 0, 12787, 12744,
+    13118, 16825, 12432, 32869, 12694, 12620, 12969, 10545, 10710, 0, 12909, 28705, 16843, 28714, 10451, 10233,
+    13176, 28730, 13116, 10489, 12776, 16972, 0, 11338, 16992, 9264, 11182, 11182, 0, 8966, 12492, 9540,
+    12898, 5368, 0, 10285, 9059, 28713, 12680, 17129, 11394, 9021, 12455, 12468, 10160, 11523, 16607, 10748,
+    28759, 12657, 28787, 17399, 16698, 10494, 5921, 28784, 9684, 32921, 28775, 9311, 8488, 12776, 0, 0,
+    0, 28733, 10407, 0, 12741, 9357, 5614, 8752, 0, 11301, 12504, 11340, 0, 0, 10206, 8656,
+    17151, 6147, 12396, 17388, 0, 0, 28770, 0, 16980, 28749, 0, 6020, 17047, 17049, 13019, 11345,
+    28684, 0, 11302, 28822, 28817, 0, 16989, 0, 12923, 9518, 13077, 12516, 32846, 12741, 12730, 28696,
+    12478, 28691, 8768, 0, 8461, 28736, 16450, 16989, 16569, 12887, 28763, 28710, 17128, 28794, 0, 12714,
+    9960, 12707, 12406, 12504, 12916, 12850, 5460, 8963, 12612, 28690, 10214, 0, 6381, 28703, 9012, 20487,
+    12497, 0, 28793, 0, 12308, 28799, 28736, 32868, 0, 12645, 6123, 20490, 0, 16490, 28759, 12504,
+    11433, 11573, 12897, 12660, 12621, 6123, 32892, 11411, 16728, 16777, 12753, 8966, 17013, 32922, 32853, 16904,
+    10407, 8776, 28684, 28748, 13015, 8860, 11004, 17053, 13162, 6143, 17407, 28806, 12444, 9076, 28726, 0,
+    12659, 12515, 10066, 0, 12755, 10152, 10493, 32833, 28822, 9758, 9963, 12503, 12527, 12862, 28775, 32884,
+    9948, 11009, 10214, 16930, 0, 0, 9012, 0, 12527, 10787, 28793, 12993, 0, 16989, 12419, 9779,
+    12487, 11430, 16834, 32794, 10449, 0, 17049, 28757, 16700, 16983, 11336, 0, 0, 28696, 12646, 9917,
+    9948, 8591, 0, 0, 28680, 11638, 0, 28783, 13121, 5461, 28781, 9919, 8713, 10160, 12907, 10742,
+    12658, 12826, 5590, 28809, 12671, 28689, 5971, 9182, 8722, 32832, 13219, 28726, 12707, 28782, 28809, 11010,
+    28827, 13123, 28751, 9918, 10152, 0, 12907, 6348, 16993, 12695, 16835, 28742, 28684, 32911, 16845, 28738,
+    12562, 12917, 28798, 16457, 0, 0, 17409, 12907, 16677, 5461, 12983, 9076, 28678, 12900, 9310, 0,
+    0, 10457, 12574, 9814, 12888, 10835, 11631, 28809, 0, 12916, 12992, 8667, 12480, 32865, 5620, 32897,
+    5655, 12464, 9256, 9919, 28742, 8368, 11004, 12824, 0, 17200, 10378, 32805, 16513, 11086, 12383, 12778,
+    28809, 12444, 13038, 28720, 32831, 11806, 32892, 12971, 9087, 9341, 11009, 13043, 8321, 10561, 10758, 0,
+    9293, 5488, 28827, 10193, 12960, 11813, 16903, 10460, 28781, 5591, 12778, 12504, 32779, 0, 10263, 10160,
+    13176, 12688, 16913, 0, 32820, 12407, 12826, 28714, 28821, 12874, 0, 17044, 0, 28763, 32793, 0,
+    12811, 16913, 6101, 12609, 8314, 0, 28791, 0, 0, 12672, 28718, 12612, 16835, 12789, 13056, 17049,
+    12479, 28797, 12919, 0, 12454, 8414, 28782, 12393, 12739, 0, 12742, 9518, 32778, 12743, 10451, 13162,
+    0, 0, 0, 32846, 12405, 11303, 11645, 17396, 28681, 9972, 28763, 12396, 16894, 12585, 28746, 13207,
+    0, 0, 11676, 12563, 9367, 20485, 12887, 0, 12713, 12888, 32859, 17147, 28748, 5656, 0, 0,
+    9021, 32802, 12544, 12930, 12504, 20490, 10758, 0, 0, 32857, 28816, 28692, 0, 16778, 11142, 0,
+    0, 11833, 28739, 12452, 12825, 16440, 17060, 28732, 6293, 9854, 13146, 12635, 11985, 13035, 12899, 0,
+    13172, 0, 9386, 12454, 0, 17226, 28771, 28807, 13124, 10191, 9241, 0, 8787, 6431, 13017, 11004,
+    10198, 11972, 5113, 12551, 9077, 28773, 6151, 0, 12715, 28684, 17410, 0, 8723, 17275, 4864, 5655,
+    0, 5113, 5719, 16620, 4549, 10359, 6319, 17202, 16904, 12575, 0, 11683, 9377, 16844, 0, 12801,
+    12378, 0, 10838, 11303, 0, 12420, 0, 13034, 0, 32807, 5716, 10497, 0, 28702, 16777, 32856,
+    32833, 32879, 12331, 12872, 20487, 32875, 0, 10413, 0, 9686, 12995, 16924, 16577, 10505, 12621, 0,
+    32781, 8420, 9618, 28753, 10573, 12984, 12899, 0, 10792, 17203, 17078, 28781, 16912, 10206, 10206, 13080,
+    32790, 12622, 0, 0, 12550, 12491, 16430, 0, 9908, 0, 6216, 0, 9022, 28754, 8769, 11091,
+    12788, 10714, 0, 0, 10976, 0, 10253, 9686, 9687, 12610, 16845, 16845, 5672, 17057, 10803, 28752,
+    12418, 12754, 0, 0, 17202, 12892, 12716, 13187, 12321, 12777, 12896, 28749, 9320, 16700, 12922, 0,
+    11637, 32844, 32794, 16924, 0, 28730, 16444, 32871, 12321, 0, 12888, 9685, 12692, 12635, 8368, 11149,
+    12763, 17128, 16779, 28765, 12780, 32882, 5651, 17131, 0, 10746, 10788, 6209, 9687, 0, 13219, 10750,
+    11087, 10544, 28748, 16932, 12526, 12823, 16912, 28771, 32869, 12819, 0, 12492, 28796, 10504, 12539, 0,
+    12066, 28717, 0, 9332, 12528, 12849, 12828, 10569, 28799, 17202, 0, 12419, 11091, 0, 28751, 12611,
+    0, 12466, 12908, 12610, 11386, 0, 10558, 32780, 11644, 11975, 32867, 0, 10503, 17207, 12658, 0,
+    28696, 6386, 12456, 32920, 12346, 17132, 28785, 9965, 12635, 12456, 10512, 11848, 32855, 17274, 20487, 28804,
+    12823, 28763, 28809, 0, 12648, 28766, 11684, 28719, 12432, 28730, 16779, 5620, 12443, 10451, 11636, 28763,
+    0, 13200, 16673, 0, 9078, 0, 11304, 11862, 28771, 0, 0, 16932, 12908, 16914, 32866, 17149,
+    10558, 11093, 11600, 16433, 17202, 17219, 10751, 12932, 13017, 12960, 9444, 6223, 32866, 11045, 11087, 9386,
+    17306, 13175, 0, 12792, 16856, 28776, 28682, 0, 16854, 12919, 9862, 0, 9965, 0, 12622, 32829,
+    10758, 16982, 0, 0, 28777, 0, 12623, 11779, 10247, 32904, 10177, 32885, 28695, 9337, 5657, 0,
+    0, 11340, 0, 12504, 17210, 16764, 12778, 32845, 16993, 12498, 28754, 11602, 11303, 12715, 12970, 13112,
+    0, 0, 10566, 28684, 9021, 28739, 12367, 32929, 10512, 28789, 28806, 0, 11090, 16904, 0, 0,
+    10284, 12906, 6321, 0, 28752, 28773, 28735, 12896, 28797, 12756, 13008, 32807, 11832, 32858, 4528, 12600,
+    8876, 12792, 6433, 9895, 5628, 11272, 0, 0, 0, 10218, 20487, 12908, 10254, 12528, 12896, 0,
+    11440, 13087, 11768, 16925, 10796, 0, 12296, 0, 0, 28785, 11050, 5620, 10814, 28696, 17080, 0,
+    28742, 10791, 12983, 10545, 12067, 28797, 12621, 0, 16933, 12813, 13037, 0, 12943, 13124, 16974, 12564,
+    28828, 12552, 32906, 0, 10804, 12875, 13020, 17354, 12825, 0, 13115, 12534, 16665, 8778, 0, 13198,
+    28797, 12756, 13036, 28762, 12431, 17407, 12694, 28750, 32880, 0, 0, 0, 16429, 17202, 0, 6276,
+    28775, 16923, 12622, 13037, 11095, 9674, 13019, 9916, 32892, 0, 0, 12598, 9285, 0, 32930, 12519,
+    32905, 28804, 9175, 9216, 0, 12693, 0, 11141, 12694, 13113, 11348, 16914, 11639, 32936, 9900, 9367,
+    28794, 28675, 0, 8480, 0, 6215, 17013, 12800, 32883, 28788, 0, 9068, 9003, 16515, 0, 12886,
+    10161, 11088, 13090, 12718, 0, 8778, 28728, 9087, 11095, 0, 32820, 0, 16775, 10850, 0, 28685,
+    12863, 0, 32870, 0, 28741, 0, 12452, 28740, 17131, 12791, 13007, 12791, 12992, 28720, 13018, 16450,
+    32932, 12852, 12887, 9089, 0, 0, 28778, 12875, 17158, 0, 16745, 0, 32843, 5869, 12957, 12943,
+    0, 0, 0, 28797, 5498, 0, 0, 12744, 13219, 8642, 13148, 10514, 13020, 6222, 32868, 13100,
+    10116, 11602, 13008, 8789, 5620, 5673, 11358, 4538, 13044, 12683, 0, 17002, 11050, 12368, 0, 16991,
+    12417, 9311, 28685, 13138, 0, 0, 13157, 9687, 11349, 0, 0, 11441, 12790, 28720, 0, 28675,
+    17053, 13156, 0, 6214, 28784, 0, 12813, 28810, 10280, 16540, 0, 0, 13006, 9319, 12708, 32905,
+    16857, 12900, 0, 13148, 0, 13037, 12683, 0, 11844, 0, 28777, 16620, 16992, 28692, 11974, 0,
+    8723, 17227, 0, 12851, 0, 6464, 28766, 10247, 16925, 11114, 28730, 12839, 28788, 8424, 5498, 11836,
+    12959, 0, 16983, 0, 12718, 28788, 17140, 11864, 0, 0, 28731, 28690, 28764, 12718, 17070, 32855,
+    12816, 12622, 28734, 0, 11312, 28814, 16754, 16992, 0, 12598, 28758, 9376, 0, 12993, 17218, 12754,
+    10280, 12717, 9358, 12402, 0, 4644, 10162, 0, 12438, 16736, 0, 17010, 28759, 10806, 28762, 28675,
+    13037, 28700, 32779, 12885, 12900, 11143, 16461, 20483, 17016, 16767, 12969, 9181, 10844, 9983, 13137, 28776,
+    10461, 28738, 6355, 12456, 9089, 16609, 16779, 10551, 17004, 12562, 28810, 0, 11703, 5628, 0, 10262,
+    32885, 20488, 10461, 12344, 28797, 11103, 6353, 28720, 0, 28692, 28794, 28706, 0, 11685, 32895, 10750,
+    12500, 28693, 28801, 12931, 10515, 12995, 12995, 20484, 9801, 10247, 0, 0, 16856, 17002, 10559, 10568,
+    11693, 17278, 12624, 6151, 17090, 10759, 28712, 0, 5665, 13112, 32880, 13151, 5663, 10554, 12802, 28810,
+    28766, 9430, 28793, 28756, 9375, 13150, 8946, 10567, 0, 6050, 6050, 9197, 9863, 17159, 0, 0,
+    0, 13175, 5673, 8470, 16412, 12659, 10284, 12311, 0, 32807, 8729, 13031, 12489, 0, 11596, 0,
+    32779, 28811, 28765, 28738, 12886, 11749, 5674, 12814, 13051, 12800, 28767, 28730, 12717, 0, 11386, 0,
+    0, 8570, 16991, 28766, 0, 12780, 11690, 6327, 13019, 11158, 32781, 5629, 12706, 10262, 32794, 12058,
+    10852, 17286, 12972, 0, 12828, 16463, 0, 12933, 13224, 20483, 32817, 10805, 28787, 0, 28767, 16934,
+    0, 13184, 5211, 6355, 12706, 12932, 17220, 12660, 32793, 9084, 16856, 12504, 32871, 28732, 11357, 12888,
+    12921, 9591, 28822, 32859, 11402, 28721, 16592, 28718, 11159, 28731, 11356, 12852, 10553, 10461, 11702, 0,
+    13052, 9376, 0, 6180, 32932, 11349, 10883, 17001, 0, 13040, 0, 10553, 16935, 17395, 0, 11096,
+    0, 10576, 32870, 13174, 0, 28764, 11866, 13139, 12622, 12576, 28734, 28746, 8357, 32895, 0, 32937,
+    32932, 11357, 13074, 0, 32854, 8489, 0, 32859, 12490, 12707, 32846, 11104, 12731, 32858, 0, 12670,
+    13100, 32854, 28797, 20486, 12864, 11602, 0, 28755, 32856, 0, 17361, 28788, 9986, 0, 32869, 32893,
+    28686, 12456, 11394, 0, 28766, 9307, 6217, 0, 0, 17004, 28738, 12032, 32909, 12480, 9377, 17348,
+    17070, 0, 0, 0, 11872, 13139, 32805, 9528, 16575, 12944, 6391, 11403, 5809, 10815, 11571, 6058,
+    11159, 28753, 0, 9985, 13028, 11442, 9685, 10048, 16936, 28800, 32931, 13051, 12801, 28776, 0, 28708,
+    20488, 17282, 20486, 17061, 13064, 16762, 0, 12932, 11779, 0, 12551, 11610, 12524, 11112, 13007, 11608,
+    12932, 13135, 28800, 12972, 10274, 28751, 0, 28767, 12996, 28741, 28758, 0, 11759, 17407, 11946, 8486,
+    9684, 10860, 5628, 8963, 12321, 13051, 32906, 28741, 13054, 17053, 16933, 0, 10216, 0, 12533, 9078,
+    12540, 9975, 11357, 10281, 16982, 12813, 12876, 0, 32932, 13052, 9088, 17001, 12643, 13164, 0, 11443,
+    28808, 13101, 0, 8489, 0, 12690, 13140, 12612, 12525, 13075, 13224, 32841, 0, 32846, 12420, 16839,
+    0, 12558, 11442, 12958, 11058, 16527, 0, 16933, 32869, 11701, 9211, 0, 0, 11710, 13197, 10216,
+    11104, 0, 12754, 0, 28747, 16463, 13031, 6234, 0, 10861, 12934, 12815, 6356, 16991, 12922, 12336,
+    0, 28696, 12576, 0, 12612, 17158, 12885, 10847, 32791, 11930, 12695, 0, 28739, 10813, 16993, 0,
+    12391, 12523, 0, 12945, 12693, 28806, 11177, 16933, 0, 11411, 11740, 28690, 10461, 28823, 13147, 9321,
+    28808, 28826, 0, 6174, 12718, 13170, 12912, 0, 11395, 11709, 0, 0, 20482, 10066, 10751, 16434,
+    11394, 0, 28718, 0, 0, 10845, 12933, 17350, 0, 12576, 28822, 11447, 28791, 0, 12623, 11657,
+    28708, 8584, 9357, 0, 28759, 28686, 0, 17309, 10578, 12786, 9779, 32882, 0, 28827, 28819, 32882,
+    13151, 12958, 32872, 17015, 11740, 28761, 0, 9067, 28759, 6356, 12552, 10162, 28740, 32906, 28754, 28728,
+    28760, 16457, 20487, 9153, 16604, 10584, 13064, 12588, 16505, 32856, 32923, 16935, 13064, 17170, 0, 0,
+    10216, 16454, 12624, 11459, 6058, 10870, 0, 10517, 6056, 28750, 12959, 12920, 17289, 32791, 16936, 28824,
+    0, 13126, 17411, 12815, 11411, 0, 0, 0, 9964, 28776, 0, 8283, 12624, 10507, 10860, 12732,
+    11655, 28809, 12593, 28758, 0, 8789, 0, 17247, 12814, 17219, 12780, 9973, 6393, 13032, 9814, 8278,
+    28809, 28791, 10861, 12708, 0, 12921, 5074, 32882, 17331, 12948, 6180, 28751, 0, 17159, 12911, 17247,
+    17071, 11450, 9087, 12933, 28764, 10814, 10162, 10460, 8307, 11395, 16992, 8366, 0, 12407, 32893, 28789,
+    12696, 12921, 16604, 0, 17409, 28679, 12756, 32818, 17016, 0, 12744, 0, 13063, 12392, 13157, 10274,
+    0, 12923, 32777, 6149, 16744, 12588, 17132, 10284, 12876, 10272, 12888, 0, 0, 0, 11403, 32870,
+    28800, 28711, 11711, 11710, 11984, 32895, 8779, 13100, 10759, 0, 10880, 13148, 13051, 0, 8789, 0,
+    11412, 10516, 0, 12888, 12521, 28807, 12528, 12624, 12828, 17238, 0, 11655, 12923, 12652, 9377, 0,
+    8962, 17002, 12888, 0, 8618, 0, 20489, 9388, 8853, 28750, 12852, 11898, 0, 0, 6454, 12719,
+    32893, 12463, 9978, 0, 28762, 0, 17228, 0, 11161, 0, 12814, 12759, 16779, 10872, 13074, 28786,
+    9317, 0, 11271, 0, 8575, 6393, 8789, 28773, 28765, 32932, 28788, 13092, 0, 11937, 17248, 28827,
+    11611, 12922, 12921, 28737, 4815, 0, 11412, 28702, 6225, 16935, 28799, 12921, 0, 12307, 11458, 6364,
+    28781, 13090, 16596, 0, 11402, 32893, 12704, 10870, 12921, 28709, 0, 8739, 17282, 10870, 10263, 11358,
+    0, 12720, 12392, 11905, 0, 0, 8942, 32882, 0, 12813, 28786, 9918, 8903, 0, 28685, 16831,
+    13063, 5666, 32830, 12715, 16922, 8648, 12621, 11656, 0, 12756, 9686, 28739, 0, 17297, 0, 11983,
+    13042, 28755, 13000, 28800, 12960, 9388, 12396, 12933, 0, 17282, 28721, 32932, 11208, 9675, 11648, 0,
+    0, 13196, 17094, 9682, 11113, 10197, 17132, 5752, 0, 8490, 28735, 32820, 10578, 0, 12381, 0,
+    12468, 12732, 32906, 12033, 6235, 16983, 16598, 16675, 28679, 5366, 11656, 28794, 11358, 13019, 17238, 0,
+    12501, 32846, 9900, 0, 13224, 6455, 6226, 0, 10507, 11983, 12296, 13134, 12815, 12648, 5322, 12900,
+    13158, 10217, 12695, 12502, 13040, 10879, 11160, 0, 16913, 9260, 12800, 17289, 0, 12441, 13090, 17251,
+    13064, 13089, 12945, 28750, 12792, 0, 28775, 12515, 28748, 13064, 17013, 9546, 0, 13148, 6393, 11467,
+    12892, 6447, 13159, 0, 28805, 16529, 17297, 12811, 0, 28774, 0, 12600, 28808, 12934, 28730, 16936,
+    8790, 28697, 12720, 11702, 12611, 20485, 28724, 28811, 12708, 32936, 10516, 12945, 8363, 16936, 0, 0,
+    12923, 32827, 0, 9000, 0, 12924, 11984, 28756, 13169, 16934, 16617, 17230, 9973, 10515, 28798, 0,
+    28684, 32883, 10580, 13161, 0, 0, 10579, 9762, 13031, 11403, 12382, 12720, 28684, 28731, 8379, 13076,
+    28710, 12720, 0, 10806, 9321, 12983, 32792, 10343, 10061, 11648, 13172, 12958, 0, 0, 28766, 0,
+    13173, 12524, 28723, 5258, 10516, 6394, 20489, 10563, 0, 9863, 12983, 6364, 12718, 13133, 16778, 8709,
+    10881, 17014, 32918, 9182, 28682, 9777, 12840, 0, 11467, 17169, 17160, 11775, 10255, 12972, 10217, 32920,
+    28813, 10869, 10815, 28689, 0, 12851, 6409, 10217, 9388, 28696, 0, 12396, 28760, 13169, 11749, 28710,
+    0, 32790, 12320, 10861, 12489, 13224, 28795, 13042, 9386, 28761, 6399, 0, 12804, 16790, 32830, 12334,
+    12934, 16936, 11105, 9073, 9048, 13168, 16421, 32805, 11194, 0, 9965, 0, 13065, 6225, 0, 0,
+    0, 12429, 28800, 13065, 6188, 12826, 28812, 0, 17012, 12581, 10273, 0, 16574, 12534, 0, 17219,
+    13052, 28785, 0, 0, 6410, 12816, 9516, 0, 12768, 17289, 28774, 28740, 20485, 10562, 28734, 13053,
+    17012, 17015, 9815, 12876, 0, 28812, 16578, 0, 10218, 6365, 32841, 6189, 0, 12726, 0, 9367,
+    10668, 10870, 17252, 0, 8491, 8881, 8916, 28756, 13159, 10853, 10870, 28769, 9510, 12428, 0, 6409,
+    0, 28782, 10517, 28820, 0, 0, 12996, 16752, 28686, 0, 32840, 17238, 6234, 0, 10861, 28680,
+    16428, 12909, 6455, 8993, 16613, 11459, 17250, 0, 11872, 11988, 0, 10563, 12592, 12996, 32907, 32923,
+    0, 11413, 12321, 6226, 28716, 0, 10264, 0, 12442, 8876, 13182, 28760, 8621, 9377, 20489, 5291,
+    28810, 8307, 28693, 11403, 28735, 0, 17162, 0, 20482, 0, 10815, 9885, 9356, 0, 12935, 6234,
+    12816, 12681, 0, 20485, 17320, 32781, 13029, 32931, 12744, 12357, 12622, 28767, 17013, 0, 13160, 12431,
+    28773, 10285, 12593, 13065, 8358, 32806, 8388, 28800, 12960, 32872, 10517, 13126, 13127, 12396, 20486, 9175,
+    6447, 12522, 0, 0, 10967, 8606, 32906, 0, 11768, 13053, 0, 16529, 28746, 12923, 16858, 10980,
+    0, 16439, 9687, 17015, 11983, 9629, 13063, 11946, 32931, 6456, 28812, 17071, 17015, 0, 10190, 0,
+    32884, 17253, 10507, 12725, 16512, 12760, 12359, 32867, 12707, 10050, 11356, 9262, 9215, 28819, 6059, 12923,
+    8418, 12320, 0, 8956, 12761, 12312, 0, 12454, 12816, 10924, 8947, 32859, 13183, 12636, 0, 10584,
+    17141, 0, 28805, 8255, 10871, 28812, 16666, 16831, 17071, 0, 0, 13008, 32898, 4824, 11114, 11096,
+    6364, 0, 0, 11757, 17249, 28779, 8355, 6411, 12664, 0, 11113, 28700, 0, 0, 12576, 16420,
+    6234, 13152, 0, 13092, 12405, 9986, 17239, 32917, 12759, 10581, 0, 11569, 12683, 0, 10516, 28797,
+    5059, 6234, 28795, 13008, 16959, 0, 0, 11776, 28798, 11902, 6234, 13029, 13127, 10100, 28687, 17307,
+    28798, 8643, 8784, 28815, 13041, 17330, 13032, 11757, 28694, 12708, 0, 12671, 16778, 17297, 12039, 10571,
+    0, 13041, 8319, 0, 12345, 12487, 9265, 8490, 12958, 13076, 16824, 12725, 10573, 10059, 28751, 28818,
+    28702, 0, 16965, 13020, 0, 12680, 13043, 17353, 0, 10272, 32872, 28753, 10572, 28748, 17227, 8853,
+    28730, 11170, 0, 28788, 11703, 5024, 0, 0, 0, 10554, 9775, 10562, 13043, 28784, 0, 28802,
+    0, 11895, 12474, 9543, 12702, 0, 9388, 32922, 28706, 16420, 9750, 6456, 17171, 16455, 6447, 10216,
+    28749, 13196, 4700, 0, 10871, 17317, 0, 17239, 28702, 9872, 0, 0, 0, 17290, 28807, 28733,
+    12779, 12727, 10862, 0, 11776, 12556, 32932, 13211, 28720, 10089, 17091, 8875, 11256, 28794, 28822, 11467,
+    11749, 28768, 17307, 8349, 0, 17290, 10405, 10869, 13020, 10264, 12594, 0, 28748, 28774, 11114, 28821,
+    12489, 12593, 32859, 12357, 0, 13089, 9805, 9772, 11779, 0, 0, 13065, 0, 28706, 16420, 0,
+    12371, 17249, 17053, 17353, 0, 17158, 12322, 5008, 28797, 9750, 28703, 28706, 12588, 10813, 28713, 12540,
+    32937, 8256, 0, 0, 5234, 28709, 12523, 8605, 10282, 13064, 17072, 28728, 12454, 16666, 17174, 28694,
+    12465, 17016, 12684, 0, 13159, 0, 16736, 10605, 0, 0, 10517, 13031, 28779, 16983, 12348, 0,
+    12299, 8284, 13169, 16744, 6019, 28739, 32906, 13019, 13171, 28751, 12396, 13032, 16729, 13206, 12311, 9301,
+    12009, 32846, 0, 10880, 10264, 9585, 12320, 28769, 28743, 8468, 32780, 0, 0, 9839, 12856, 28695,
+    11954, 8359, 28770, 5351, 17014, 32820, 12641, 28709, 17411, 8694, 16667, 0, 9546, 16978, 28785, 10584,
+    13020, 12789, 0, 8618, 28728, 8307, 12682, 5238, 5383, 28816, 13029, 17399, 8583, 0, 28701, 10573,
+    6448, 11766, 17360, 0, 11938, 16528, 11013, 12804, 17318, 0, 10862, 12468, 0, 6235, 17307, 10582,
+    12804, 28728, 16746, 12335, 17072, 10573, 28694, 11478, 9254, 16845, 10584, 12824, 0, 11775, 16924, 16529,
+    13139, 11402, 16437, 12654, 6411, 13128, 17092, 16449, 12000, 13054, 8649, 12600, 13172, 0, 0, 20484,
+    11993, 12952, 8420, 9814, 4613, 0, 28828, 13076, 10283, 16992, 8395, 12432, 13008, 5384, 9383, 16755,
+    9262, 17229, 28782, 28768, 12055, 8942, 12521, 28750, 12523, 28768, 13032, 11001, 13207, 13224, 6402, 32804,
+    4672, 12726, 0, 12888, 6465, 0, 20485, 0, 16650, 10572, 12737, 12564, 12000, 28736, 0, 8619,
+    16617, 12359, 6455, 12463, 11999, 13184, 10572, 8357, 12064, 28756, 12778, 13184, 10871, 6235, 12408, 12408,
+    0, 13162, 10274, 28739, 9044, 11169, 16499, 28686, 8584, 0, 12972, 8486, 20481, 32805, 5020, 8947,
+    0, 28726, 32846, 5798, 17317, 10584, 13148, 28684, 17151, 0, 12708, 0, 10573, 17359, 11758, 32893,
+    0, 12924, 28717, 5203, 0, 12564, 32919, 10273, 13051, 11477, 28805, 9252, 28733, 28791, 28737, 12348,
+    28780, 13102, 8694, 28745, 9618, 0, 12503, 12582, 9260, 0, 12513, 32828, 17298, 13041, 17298, 9851,
+    17307, 8577, 11460, 12900, 12612, 16696, 8451, 9796, 16451, 13207, 8490, 10581, 10573, 0, 8350, 0,
+    12852, 0, 17013, 12056, 0, 32793, 12406, 16824, 13115, 12575, 12323, 13183, 16598, 13151, 6456, 12546,
+    28786, 13152, 17411, 28744, 0, 28690, 16934, 9362, 28716, 8419, 13195, 12380, 12595, 13210, 6365, 8854,
+    11170, 0, 12532, 0, 16737, 28764, 8920, 28825, 11104, 12476, 0, 32840, 10880, 0, 12593, 12048,
+    28726, 20485, 0, 13077, 12881, 32806, 9305, 9816, 11312, 0, 32923, 4405, 12309, 0, 12048, 13104,
+    0, 0, 12444, 0, 0, 11180, 0, 32884, 10582, 9309, 8465, 10284, 12560, 8717, 11468, 16756,
+    11468, 20485, 12503, 0, 17360, 13139, 10322, 13184, 16658, 0, 0, 12490, 12900, 12001, 12588, 12911,
+    8577, 10284, 12740, 8313, 12867, 0, 13032, 32781, 11273, 8342, 0, 0, 0, 12335, 13184, 4662,
+    12056, 0, 9771, 13076, 16541, 0, 13183, 13171, 0, 32830, 32918, 32842, 0, 28809, 0, 28805,
+    12311, 8583, 9209, 12881, 12564, 9204, 0, 12665, 5452, 12475, 9429, 10107, 32792, 12772, 17308, 0,
+    17249, 0, 32871, 0, 13188, 28821, 12009, 11712, 12455, 13218, 12765, 17093, 12331, 0, 16667, 13183,
+    10881, 12966, 13079, 6465, 32910, 10283, 12603, 28818, 12499, 12478, 28807, 28693, 13210, 8319, 28689, 11767,
+    16874, 5312, 0, 28705, 16526, 0, 32898, 10343, 4859, 11480, 16498, 9480, 0, 12336, 10872, 28756,
+    0, 16595, 12834, 12704, 12499, 9318, 10563, 32831, 0, 16598, 0, 32936, 9858, 9751, 13092, 0,
+    0, 13032, 13197, 9984, 0, 9217, 0, 12749, 0, 12681, 12407, 9298, 0, 28768, 8666, 5367,
+    13151, 28707, 13184, 13077, 12479, 28721, 28768, 11910, 16841, 0, 16439, 28721, 32819, 12405, 28743, 8650,
+    17318, 32829, 8897, 28770, 12792, 16982, 12690, 12382, 5261, 11910, 12407, 32828, 20483, 0, 17329, 13184,
+    0, 12419, 28725, 12588, 11545, 11554, 17318, 10144, 16463, 9558, 28687, 9211, 12864, 32831, 5409, 17172,
+    11413, 0, 10625, 11780, 13162, 9241, 0, 28687, 16948, 11478, 9320, 12298, 4409, 13175, 16744, 32846,
+    0, 0, 28702, 12001, 28711, 28737, 28707, 17363, 32840, 4915, 0, 12380, 28732, 8695, 12487, 6466,
+    9210, 0, 12429, 12048, 12516, 16767, 0, 13104, 12945, 17149, 10637, 13212, 0, 0, 9057, 13162,
+    13210, 6456, 16765, 5037, 11955, 9648, 12525, 28682, 12965, 0, 28705, 28739, 9860, 28785, 16509, 0,
+    13217, 9947, 17331, 5005, 12571, 16658, 13196, 0, 16507, 0, 4629, 0, 0, 9978, 16753, 13103,
+    12751, 0, 8460, 12465, 16598, 28699, 32815, 32872, 10583, 17319, 28820, 32924, 0, 16436, 0, 10049,
+    32919, 0, 28819, 28763, 12526, 12912, 8620, 17299, 32818, 0, 0, 10760, 32793, 10355, 16815, 9216,
+    32806, 5405, 17359, 12524, 32870, 10642, 32802, 16947, 0, 0, 10532, 0, 28739, 0, 8656, 16729,
+    11758, 32781, 28758, 17332, 11910, 16658, 12477, 32806, 8687, 0, 0, 10374, 0, 12655, 8484, 0,
+    12464, 12857, 13196, 0, 12298, 12000, 0, 6456, 28749, 10635, 8321, 16458, 0, 13160, 10936, 12965,
+    9657, 0, 17328, 28692, 10636, 16852, 8420, 12585, 17080, 12561, 17327, 16461, 0, 12335, 28682, 8583,
+    16621, 28724, 0, 0, 8457, 0, 28736, 12358, 11450, 4628, 28744, 17252, 0, 12499, 17003, 6465,
+    16449, 12358, 16605, 13152, 11479, 16438, 17238, 11180, 12491, 11469, 11478, 32921, 5032, 5993, 6004, 11955,
+    4467, 0, 32814, 12895, 16588, 9056, 0, 8695, 11955, 12396, 0, 0, 28809, 28737, 32781, 17150,
+    28759, 16530, 28724, 12944, 9815, 12845, 8775, 12407, 10881, 20484, 12442, 28676, 12631, 9589, 0, 0,
+    12300, 8365, 12786, 11703, 12791, 32883, 10517, 11219, 12407, 11992, 0, 0, 12392, 13151, 28675, 10415,
+    10203, 12751, 12655, 4673, 13044, 0, 12797, 13160, 10583, 12324, 12786, 12690, 8613, 8390, 12525, 32920,
+    8949, 0, 11759, 16965, 17249, 12526, 4942, 28681, 0, 0, 28749, 13200, 11104, 16852, 28752, 0,
+    9211, 9644, 28805, 12788, 32818, 12359, 16620, 9248, 0, 0, 11478, 28676, 4944, 12876, 0, 9898,
+    12768, 0, 13185, 17328, 0, 11479, 12595, 12466, 17196, 0, 13025, 11759, 16618, 11702, 16509, 28693,
+    12395, 5393, 13219, 12476, 9881, 16518, 13174, 0, 28760, 17328, 12490, 11479, 16687, 28764, 12840, 12504,
+    0, 16598, 16606, 0, 0, 13183, 8358, 13016, 12524, 9852, 11778, 0, 11180, 0, 17081, 32804,
+    10935, 13209, 16688, 16853, 8366, 12066, 28691, 12430, 13150, 0, 32831, 16620, 0, 28675, 28774, 13208,
+    28765, 10114, 8709, 12526, 9041, 12464, 13029, 0, 5055, 12716, 0, 0, 16440, 12420, 16439, 12786,
+    9884, 11611, 13208, 17378, 0, 32819, 9860, 0, 12667, 13224, 4630, 0, 12299, 8774, 12595, 9293,
+    9373, 0, 16953, 0, 9008, 12430, 12658, 13218, 10583, 16982, 13043, 10070, 9248, 0, 10385, 0,
+    12995, 20482, 16823, 12322, 0, 13020, 13128, 0, 28811, 0, 4468, 17061, 12984, 12986, 16879, 5614,
+    28747, 11572, 32828, 16756, 28688, 0, 32794, 0, 0, 12010, 0, 12705, 32919, 28736, 12560, 8461,
+    16530, 28765, 11759, 11777, 12828, 0, 32937, 0, 12656, 9613, 9648, 16808, 6235, 13176, 28789, 12432,
+    17014, 12559, 0, 8870, 9510, 28695, 12894, 12489, 0, 11777, 13091, 28707, 8865, 13174, 12049, 0,
+    28679, 0, 12789, 16687, 5315, 0, 12943, 13018, 12500, 13041, 13002, 11956, 0, 12812, 5209, 16737,
+    4694, 8366, 28709, 32779, 8774, 0, 9356, 0, 12835, 17308, 32791, 8711, 28700, 16688, 9218, 11947,
+    16458, 0, 17330, 28749, 8621, 28735, 17376, 12847, 5812, 9986, 13208, 28683, 13116, 12859, 17369, 16506,
+    12688, 28714, 28694, 12516, 12478, 16936, 12894, 0, 20482, 28679, 0, 17385, 12465, 16776, 17162, 17140,
+    28737, 8956, 28803, 9044, 20481, 12632, 16530, 13197, 16448, 32803, 4354, 12527, 32920, 0, 12453, 28810,
+    9964, 13140, 20482, 12488, 0, 12858, 0, 28691, 28760, 12536, 12910, 0, 12776, 16685, 28760, 28766,
+    32791, 0, 17375, 0, 0, 8459, 28768, 16608, 12467, 0, 0, 16667, 28689, 12443, 12049, 0,
+    28734, 28804, 8745, 32846, 0, 12324, 32842, 5334, 13218, 32896, 28716, 16528, 5964, 8665, 28721, 0,
+    5539, 12934, 6123, 28787, 13211, 28698, 32859, 0, 10217, 5268, 13174, 5347, 9388, 12057, 0, 8404,
+    0, 0, 9057, 13174, 28749, 0, 0, 12075, 12893, 9354, 16767, 28708, 0, 9642, 13150, 16439,
+    28786, 13065, 0, 13160, 16607, 28754, 9362, 28709, 28699, 12378, 6020, 28715, 12076, 28679, 12478, 9349,
+    12002, 5252, 28725, 12656, 8632, 8919, 16767, 17395, 11993, 10951, 0, 9138, 9906, 28779, 12076, 17361,
+    0, 0, 12905, 32842, 12488, 0, 16765, 16529, 9082, 28760, 0, 12299, 12057, 16539, 28750, 0,
+    10050, 0, 17408, 28724, 9294, 12348, 9010, 12076, 16460, 32790, 0, 0, 0, 0, 9860, 12896,
+    12792, 9010, 10563, 9019, 0, 9377, 20485, 0, 4948, 13222, 9906, 12667, 13103, 0, 0, 10940,
+    16530, 12559, 0, 28758, 8869, 10947, 6189, 12525, 17082, 9919, 17034, 16541, 12406, 0, 12371, 0,
+    12408, 13044, 9610, 28739, 5324, 5404, 9481, 32852, 12514, 0, 12977, 20481, 11778, 16777, 0, 0,
+    28674, 0, 12859, 20484, 12465, 10641, 12001, 0, 12584, 10233, 13151, 17377, 28715, 10285, 12690, 12418,
+    0, 28726, 12468, 12001, 12535, 16833, 6150, 12345, 32805, 10425, 0, 12586, 12572, 28823, 8421, 10436,
+    16506, 11777, 13096, 9211, 28740, 28729, 28692, 12467, 28746, 12515, 12002, 0, 32923, 0, 12632, 0,
+    8711, 28718, 12695, 13024, 12310, 10101, 12895, 10389, 10659, 12977, 16541, 28702, 13015, 12586, 13208, 28747,
+    12835, 16509, 12432, 0, 0, 11768, 9900, 28763, 28784, 13104, 4694, 10016, 16451, 12801, 12953, 0,
+    13224, 12066, 0, 17174, 16695, 12431, 9915, 12595, 12561, 16571, 11758, 5040, 0, 16430, 5270, 0,
+    12954, 5048, 12010, 16542, 12512, 6427, 28784, 12078, 12537, 9898, 0, 10437, 4976, 0, 28691, 13065,
+    8476, 28679, 12720, 12636, 16530, 0, 8351, 13107, 28745, 16607, 9960, 17241, 8326, 32816, 12360, 9074,
+    0, 16816, 12786, 32936, 0, 32843, 32852, 12584, 0, 12528, 10422, 32781, 0, 4718, 12727, 10348,
+    8751, 11778, 8367, 12480, 16750, 5548, 12701, 0, 12763, 28718, 4719, 28777, 12682, 5829, 12419, 0,
+    12656, 8786, 10954, 12535, 9481, 9653, 12468, 0, 16686, 28735, 11822, 9248, 10958, 16586, 12391, 12681,
+    10465, 10138, 28679, 12692, 17329, 12057, 12707, 0, 0, 8759, 12358, 0, 13013, 10161, 0, 5069,
+    13160, 0, 0, 9343, 5666, 5165, 12548, 0, 9386, 8458, 20482, 28824, 9720, 0, 28740, 28800,
+    28711, 10101, 16696, 12695, 12644, 32839, 9481, 28726, 12990, 8359, 12610, 8549, 10400, 4966, 12320, 0,
+    10668, 28688, 28750, 12778, 16696, 0, 12816, 17170, 28746, 9294, 17368, 13176, 12848, 32905, 10436, 12656,
+    16734, 5982, 12900, 8314, 8366, 28773, 5437, 16541, 17368, 0, 12010, 9510, 17022, 10472, 0, 10072,
+    28740, 32830, 9894, 10101, 0, 12607, 12644, 16528, 9517, 0, 12953, 13014, 12504, 17386, 11264, 20484,
+    9555, 0, 16619, 28733, 12752, 12312, 17196, 0, 0, 8666, 32791, 32833, 16816, 32779, 13197, 12670,
+    28728, 28799, 10515, 0, 28702, 16825, 32820, 16440, 9547, 13140, 0, 8621, 12584, 32792, 32804, 9196,
+    5048, 12681, 28735, 9593, 9372, 0, 12979, 32911, 12645, 9383, 9915, 0, 5877, 5048, 32936, 9563,
+    10947, 10284, 28741, 5070, 0, 10441, 0, 0, 12467, 0, 28823, 28719, 28707, 16449, 12444, 9073,
+    12720, 10042, 8460, 17376, 10967, 12057, 0, 28769, 8658, 13104, 12360, 12727, 4210, 13199, 0, 5098,
+    0, 28745, 17290, 8704, 8486, 28737, 12763, 0, 13055, 28746, 13115, 12379, 28702, 13210, 0, 8720,
+    28683, 0, 28718, 8957, 28741, 17411, 12979, 12539, 16540, 0, 28818, 12967, 11239, 12574, 12336, 0,
+    12859, 8322, 9979, 28822, 0, 5360, 0, 12359, 0, 28694, 12550, 28824, 12536, 12067, 16696, 28818,
+    0, 9972, 32794, 12766, 0, 12456, 10181, 12077, 10218, 28759, 0, 9011, 16815, 0, 12978, 8785,
+    12766, 16834, 32807, 6084, 11820, 28712, 0, 0, 28767, 32842, 12754, 16521, 28782, 10371, 16542, 8666,
+    10199, 9364, 28722, 12549, 9616, 6096, 13079, 11611, 0, 28691, 8421, 12655, 28776, 16900, 28730, 9192,
+    16897, 8712, 16598, 28722, 28695, 0, 5158, 12525, 12656, 0, 0, 10983, 16722, 12611, 12372, 16440,
+    17062, 8965, 12777, 12528, 16842, 12066, 9610, 0, 0, 0, 9809, 20488, 9593, 0, 17398, 28713,
+    9445, 13013, 12528, 0, 9962, 12394, 0, 5331, 32845, 16908, 5889, 0, 0, 0, 12849, 28797,
+    28748, 12360, 12538, 9002, 9350, 8367, 12575, 8620, 16608, 16853, 12539, 12847, 8571, 4973, 12300, 12348,
+    0, 13173, 12777, 8759, 0, 0, 16844, 28782, 10252, 12077, 11759, 13112, 8704, 9892, 12538, 16619,
+    16449, 13040, 32794, 0, 11657, 12562, 0, 32845, 12312, 12681, 8405, 17396, 12681, 12563, 16756, 17150,
+    0, 8487, 12360, 17369, 17396, 9956, 8767, 0, 9019, 28708, 16892, 32844, 0, 12430, 28755, 12751,
+    12814, 12777, 32872, 10274, 4530, 0, 5999, 11767, 17386, 28737, 28761, 6402, 12752, 4977, 12860, 12885,
+    16889, 12467, 11533, 12526, 32853, 32831, 32779, 9780, 32818, 13207, 8957, 11805, 0, 0, 13122, 16619,
+    9547, 16921, 10781, 9962, 9254, 0, 8477, 8388, 0, 10735, 0, 0, 0, 11034, 0, 6085,
+    0, 9058, 28727, 0, 13092, 11648, 0, 28780, 28703, 5069, 9954, 16893, 0, 5645, 0, 4955,
+    28706, 0, 12384, 8657, 28691, 12682, 12536, 16460, 0, 8666, 32844, 0, 28709, 11291, 8784, 0,
+    8658, 13220, 0, 4975, 5048, 11268, 0, 9678, 20486, 10184, 17395, 9321, 17035, 28824, 5340, 32794,
+    6059, 28679, 28781, 32842, 12871, 13014, 12479, 28801, 5068, 28747, 16621, 9564, 28773, 16540, 17081, 0,
+    11246, 28822, 0, 0, 12576, 12002, 0, 28748, 11257, 6387, 12444, 8720, 8389, 12348, 16722, 12884,
+    5070, 32853, 11802, 8421, 0, 16607, 12440, 0, 0, 12563, 0, 16700, 8485, 5557, 16450, 16519,
+    5220, 12456, 8405, 12575, 16824, 8477, 13197, 8752, 0, 0, 28799, 9075, 10476, 11034, 17397, 17004,
+    8776, 9020, 12480, 0, 28691, 0, 12048, 0, 28736, 11333, 0, 16571, 0, 16886, 8571, 0,
+    0, 0, 13108, 8920, 8785, 32833, 11769, 32806, 5350, 11374, 12538, 9219, 9309, 10404, 0, 32776,
+    9318, 12323, 0, 9074, 10776, 12564, 0, 8874, 0, 16892, 16845, 12752, 5362, 17015, 0, 28681,
+    28753, 28729, 12848, 12874, 28820, 0, 0, 16935, 12778, 28761, 0, 12528, 32806, 5443, 28818, 9547,
+    12618, 0, 11105, 28682, 32857, 12066, 9780, 9002, 12787, 9219, 0, 5982, 32853, 0, 6274, 9003,
+    28737, 12586, 0, 12576, 9962, 17241, 10283, 0, 12468, 12355, 12779, 12679, 11268, 0, 28773, 13136,
+    28730, 12893, 28796, 32830, 17036, 32830, 12456, 0, 0, 28680, 17037, 8759, 0, 16460, 11152, 16518,
+    9517, 0, 10996, 13116, 28746, 12956, 0, 28706, 16457, 9593, 17407, 13020, 12480, 9263, 12503, 0,
+    5483, 32781, 12780, 28818, 16779, 0, 16971, 12691, 17410, 5557, 17386, 28770, 17407, 10400, 12680, 4981,
+    11590, 0, 0, 5048, 10106, 5563, 13032, 0, 20482, 10440, 12804, 0, 0, 12633, 12468, 12959,
+    12645, 0, 10076, 0, 17377, 28749, 17330, 5340, 28822, 8704, 9311, 8422, 12980, 0, 28697, 0,
+    17131, 12609, 13212, 13020, 12886, 16542, 5893, 12792, 10750, 28747, 17387, 5557, 12743, 10969, 8784, 0,
+    16766, 0, 0, 9234, 12587, 0, 16462, 0, 4728, 13098, 12408, 8666, 12970, 12619, 28674, 0,
+    0, 0, 28729, 5362, 11411, 12703, 9620, 0, 10996, 0, 28760, 10104, 12407, 12731, 12489, 16516,
+    28797, 0, 10699, 28704, 0, 28732, 32833, 0, 11374, 8487, 12669, 0, 5099, 0, 5096, 10781,
+    17038, 28751, 8767, 13108, 8322, 11374, 13222, 10526, 9321, 12588, 0, 12991, 28772, 0, 12702, 28706,
+    0, 16846, 0, 0, 32843, 11479, 16928, 0, 13211, 8412, 32924, 28815, 12836, 16604, 10371, 8712,
+    8477, 17116, 12967, 8424, 28782, 16993, 8413, 17386, 13098, 8413, 5097, 12692, 12967, 28707, 16900, 12933,
+    17386, 16892, 12836, 9375, 28729, 12406, 0, 17407, 0, 10443, 8933, 9610, 0, 12596, 13018, 10077,
+    12585, 28761, 0, 9981, 28748, 0, 10674, 0, 12704, 8965, 12691, 9809, 0, 16901, 9780, 28773,
+    0, 0, 11545, 12028, 17387, 28747, 12704, 12624, 12887, 10539, 0, 11655, 12608, 12684, 8469, 11267,
+    0, 16816, 8785, 0, 8966, 12715, 12742, 12395, 12905, 17396, 32844, 13004, 0, 13110, 28773, 12981,
+    17378, 0, 28728, 11080, 10998, 5921, 0, 0, 10523, 9068, 12779, 12897, 32844, 12700, 0, 12693,
+    12656, 12504, 17016, 6283, 0, 12896, 12418, 11590, 13007, 16457, 12684, 9853, 0, 12618, 12620, 16919,
+    12480, 0, 32911, 17036, 11538, 16619, 32879, 0, 16963, 0, 4977, 12658, 10066, 0, 32854, 9517,
+    16853, 10188, 5584, 0, 12754, 5581, 12798, 0, 0, 8405, 0, 28762, 9892, 12669, 12764, 12982,
+    13151, 9219, 6402, 12564, 9863, 16697, 28817, 0, 12883, 9779, 10973, 10447, 0, 9620, 12787, 9058,
+    12468, 28679, 12863, 12788, 11564, 0, 9374, 12430, 16766, 9058, 12800, 12318, 9374, 10969, 32871, 28692,
+    0, 12780, 0, 0, 12967, 5070, 0, 13152, 12367, 28727, 6127, 17250, 17052, 0, 0, 0,
+    13151, 10106, 13219, 0, 9365, 13099, 5900, 10483, 12849, 10538, 16699, 0, 13014, 0, 9265, 10782,
+    28680, 12796, 28711, 13223, 12752, 28747, 10111, 17387, 0, 5922, 9610, 12993, 12632, 0, 12609, 17332,
+    12885, 10377, 28687, 0, 11436, 16894, 32807, 6003, 12526, 12693, 28760, 12634, 12408, 9814, 28728, 12754,
+    12860, 5073, 12443, 0, 0, 0, 11590, 0, 17002, 8388, 12672, 16537, 10406, 10780, 11567, 0,
+    11332, 28784, 13121, 12883, 11297, 0, 12837, 17050, 9981, 9608, 0, 5993, 8296, 9665, 28710, 0,
+    0, 0, 11378, 10543, 28767, 16440, 17407, 20481, 8658, 0, 9665, 12707, 0, 0, 13185, 0,
+    0, 11556, 28716, 0, 12396, 16921, 5904, 12718, 13004, 12785, 32833, 28797, 12875, 6043, 28785, 8786,
+    11780, 10079, 12438, 12849, 0, 4727, 0, 10143, 0, 8713, 12442, 17398, 32807, 6287, 11274, 12549,
+    10377, 20483, 16843, 32937, 12731, 32833, 0, 13146, 0, 8681, 9863, 12576, 12599, 32846, 12468, 28714,
+    10974, 9058, 32845, 28773, 12610, 9310, 16965, 8776, 12468, 9899, 12684, 6350, 0, 9916, 28750, 11032,
+    28696, 0, 8368, 28673, 32881, 0, 0, 20481, 32845, 5993, 32863, 32919, 12455, 12489, 12768, 12552,
+    9256, 11804, 10882, 13199, 16460, 11057, 0, 9012, 0, 16894, 9600, 11564, 16536, 6013, 12549, 28774,
+    28732, 0, 9682, 9089, 0, 10736, 12706, 32872, 10078, 12981, 9384, 16514, 10674, 28804, 0, 0,
+    13005, 12897, 11339, 8957, 9219, 16664, 12586, 9687, 12525, 0, 0, 12814, 11545, 9861, 0, 12979,
+    0, 0, 12804, 12694, 12816, 12608, 10377, 16925, 0, 28731, 12647, 16913, 13055, 12766, 28809, 10285,
+    0, 0, 12811, 12743, 9367, 28746, 0, 16929, 28754, 16697, 0, 10439, 6168, 12888, 0, 16902,
+    9321, 0, 10675, 8469, 12671, 9022, 0, 12777, 8621, 6116, 12379, 12779, 9986, 32910, 0, 6038,
+    20485, 12971, 12468, 0, 9085, 12886, 13196, 6015, 0, 28748, 0, 0, 12513, 12407, 32845, 32829,
+    9620, 0, 12561, 10539, 5365, 11161, 32853, 9684, 9619, 12729, 32868, 28679, 0, 28739, 0, 12755,
+    12714, 11085, 0, 8875, 28730, 28718, 16833, 0, 16462, 9817, 9067, 9941, 11297, 10411, 9649, 12994,
+    17195, 28679, 12994, 16767, 9675, 9684, 16924, 32865, 8405, 9012, 32820, 12875, 28810, 0, 0, 0,
+    16541, 9863, 4781, 11334, 10378, 8957, 12799, 17395, 32931, 28772, 0, 0, 11356, 32804, 4529, 12892,
+    0, 0, 28689, 9908, 13087, 12503, 5649, 10837, 28729, 0, 0, 9076, 0, 4270, 8760, 12703,
+    0, 12754, 12620, 8722, 9685, 0, 10974, 6014, 8314, 12807, 9357, 0, 0, 12899, 17269, 16429,
+    32781, 11297, 12611, 12684, 13032, 12884, 16542, 6015, 32803, 9167, 0, 6168, 32842, 0, 5919, 28762,
+    12419, 5920, 5481, 6145, 6013, 10778, 28769, 0, 0, 17048, 9984, 28728, 16972, 28696, 10178, 12840,
+    28738, 13020, 11348, 0, 12810, 5101, 6013, 11272, 12694, 9666, 12503, 0, 0, 5654, 16620, 11837,
+    28740, 28718, 5261, 10782, 0, 12849, 6134, 28704, 11677, 6291, 12905, 9891, 12791, 9674, 8413, 16694,
+    16720, 32863, 12993, 0, 32846, 4728, 12468, 12396, 0, 32826, 5484, 0, 12933, 8768, 0, 28771,
+    12467, 28750, 9142, 13087, 28724, 12479, 28764, 12896, 11566, 8424, 8470, 11136, 11046, 28696, 11826, 9086,
+    8965, 13025, 28748, 12656, 12587, 12780, 17319, 28798, 32883, 12702, 0, 10214, 12885, 11345, 28709, 12525,
+    16497, 11304, 0, 5584, 13017, 28674, 0, 10145, 10782, 0, 0, 16925, 28769, 11171, 13016, 16843,
+    12431, 16912, 28702, 28789, 32856, 0, 11273, 20485, 10448, 16699, 11008, 28774, 28681, 12848, 0, 28729,
+    6142, 32820, 5585, 13005, 32869, 12503, 9863, 16492, 12418, 28770, 28808, 10406, 17069, 9649, 9003, 8621,
+    12616, 12537, 28817, 0, 12715, 0, 28684, 28674, 28774, 13006, 32931, 0, 0, 0, 12839, 16978,
+    0, 32846, 5076, 0, 0, 0, 20487, 8760, 9376, 10378, 28737, 8966, 28777, 28728, 16778, 0,
+    12945, 4983, 10145, 12753, 12480, 12694, 10456, 9619, 17252, 0, 11358, 0, 10152, 8760, 12905, 13020,
+    0, 10703, 16934, 0, 12527, 17122, 28803, 12526, 11344, 11594, 9264, 4983, 28704, 12798, 16904, 9909,
+    32832, 12957, 8490, 12683, 9012, 28758, 5650, 6293, 10789, 0, 10413, 12896, 11081, 28763, 12632, 12851,
+    11009, 0, 0, 28701, 0, 13015, 16996, 12742, 11302, 0, 16463, 20487, 12789, 0, 0, 28782,
+    0, 16525, 9684, 12799, 8704, 0, 10711, 12646, 12490, 8488, 32866, 28826, 0, 12741, 12431, 0,
+    11057, 9078, 28821, 28745, 17211, 12970, 17050, 12898, 28809, 6293, 16542, 32905, 28714, 12372, 28722, 28683,
+    12743, 9336, 28728, 8332, 0, 12358, 12810, 0, 12622, 6018, 28757, 17273, 28782, 11041, 0, 9265,
+    16880, 10813, 8957, 13172, 0, 5589, 10413, 11105, 12498, 12455, 0, 5490, 12886, 8743, 10486, 17092,
+    12636, 28682, 13099, 12576, 13007, 28701, 32815, 12540, 11096, 12861, 12011, 28716, 11593, 16922, 8790, 5495,
+    28763, 13007, 0, 6427, 12620, 12780, 8721, 11573, 13212, 0, 28731, 12567, 0, 16937, 12765, 16858,
+    28824, 9909, 10969, 28745, 10458, 9358, 0, 12917, 0, 12917, 12406, 32843, 9666, 32878, 28789, 10787,
+    0, 12729, 28752, 32792, 12684, 0, 10750, 32854, 16999, 0, 17129, 28703, 12792, 0, 32856, 12862,
+    5111, 12922, 0, 0, 0, 10116, 16683, 12599, 32935, 13044, 11010, 28693, 28685, 28713, 10177, 32855,
+    17348, 12528, 11402, 12754, 10198, 5196, 0, 12467, 0, 28760, 13026, 12333, 32845, 12897, 12715, 28716,
+    9086, 16924, 17052, 9358, 28746, 5368, 16429, 28730, 28690, 8991, 9365, 11340, 17060, 6144, 28746, 16846,
+    13007, 9388, 9068, 16904, 11134, 8721, 10269, 28691, 16413, 10573, 0, 28769, 28718, 16586, 9908, 17052,
+    28786, 28692, 0, 0, 0, 12703, 28782, 12431, 10812, 9974, 16451, 12441, 11012, 12917, 9963, 12600,
+    10451, 32778, 10206, 9973, 13026, 32930, 5490, 12849, 12404, 12896, 28748, 5461, 9955, 12440, 10495, 10414,
+    16914, 16700, 16913, 0, 28742, 12875, 11348, 28723, 5922, 32857, 11049, 0, 12791, 12912, 12744, 28753,
+    6320, 9686, 10713, 0, 0, 0, 0, 12609, 10507, 8966, 0, 0, 16778, 12491, 0, 9904,
+    28728, 0, 9965, 17329, 9088, 12432, 32903, 10214, 32844, 10548, 9918, 13018, 13077, 32857, 17230, 28757,
+    12811, 0, 0, 32879, 13123, 9963, 28720, 9237, 0, 12429, 12431, 5589, 12706, 17239, 12079, 0,
+    17139, 10255, 5490, 28728, 9917, 6042, 0, 0, 16913, 12467, 9676, 32911, 11633, 0, 10490, 11057,
+    12622, 28717, 12823, 11012, 32858, 12742, 6171, 12504, 0, 8478, 11012, 32894, 11111, 32792, 0, 9367,
+    12621, 12822, 0, 10760, 12575, 13018, 17411, 16934, 28797, 0, 0, 11358, 13007, 28816, 12917, 12778,
+    0, 0, 8676, 0, 0, 10502, 0, 12623, 10161, 12636, 12944, 16844, 28726, 5498, 8424, 6017,
+    28754, 17201, 5113, 28696, 12968, 8423, 20484, 17016, 0, 9955, 12551, 11693, 16922, 8414, 0, 17090,
+    10206, 0, 0, 10794, 8479, 28739, 28781, 32868, 13160, 12778, 6173, 11355, 0, 28754, 0, 12742,
+    6431, 5458, 28703, 17299, 11450, 11833, 5925, 12823, 17160, 12716, 0, 0, 12320, 17387, 12957, 0,
+    11340, 0, 0, 13025, 28677, 28811, 0, 0, 16621, 12888, 16931, 8423, 0, 12419, 5620, 0,
+    12708, 6171, 11480, 0, 0, 10245, 0, 0, 10460, 28759, 28798, 16914, 6151, 20487, 6211, 12402,
+    13016, 9717, 0, 16914, 0, 12300, 10483, 9948, 28809, 0, 0, 0, 12862, 28735, 12455, 16570,
+    0, 32815, 12612, 16913, 20487, 11836, 13183, 6058, 6179, 28720, 32892, 9982, 28731, 11133, 16969, 0,
+    9862, 10510, 17014, 16923, 28696, 28816, 32846, 16923, 16429, 10215, 6321, 13044, 13152, 8265, 0, 28687,
+    9854, 32858, 13088, 11159, 12792, 11469, 11570, 12683, 0, 28789, 13135, 17071, 12623, 17158, 12923, 16778,
+    17040, 0, 28748, 10838, 12792, 17061, 16846, 28709, 0, 8733, 5655, 32892, 0, 12812, 16815, 0,
+    17002, 9059, 0, 32855, 0, 11137, 10039, 5490, 6320, 0, 0, 9963, 17210, 32892, 10253, 20485,
+    12684, 28746, 12588, 16585, 28730, 10758, 0, 28714, 10504, 0, 13101, 0, 0, 12655, 12792, 32908,
+    28754, 9918, 10804, 12604, 11311, 10283, 12813, 12813, 28764, 20485, 11889, 9956, 10153, 10506, 9387, 12472,
+    28828, 11642, 12468, 0, 12612, 28819, 17160, 11837, 17207, 28799, 12598, 9975, 10178, 8768, 10815, 11733,
+    13157, 8488, 12612, 9265, 28809, 0, 13139, 12706, 17274, 28775, 32880, 28825, 12415, 13138, 12443, 12573,
+    8995, 11601, 12943, 32881, 10626, 10796, 28798, 5498, 10505, 9891, 0, 16777, 8489, 13148, 0, 11059,
+    13164, 9467, 12432, 0, 11311, 11348, 16684, 8389, 12582, 11729, 12718, 28730, 12813, 11694, 11311, 0,
+    0, 10443, 0, 0, 13066, 12886, 11383, 0, 13111, 9683, 28773, 16855, 12717, 13125, 13100, 9965,
+    5725, 6211, 9676, 5628, 28769, 0, 12933, 10199, 12826, 12683, 28712, 5657, 12924, 0, 28745, 0,
+    12851, 12751, 12334, 32792, 17089, 13006, 12636, 10544, 0, 13112, 12792, 0, 16463, 12381, 16923, 5662,
+    0, 6350, 10714, 8423, 12611, 28726, 16923, 28797, 32846, 8788, 16766, 28765, 28772, 28728, 13138, 9021,
+    13100, 28736, 0, 32930, 16924, 8245, 12942, 28710, 20487, 13163, 32867, 12802, 12802, 8313, 32937, 6019,
+    13037, 28767, 0, 9900, 0, 5075, 11168, 0, 12804, 13091, 16904, 10426, 11643, 0, 17227, 17219,
+    28697, 0, 9514, 10253, 0, 8657, 12696, 11956, 32872, 12790, 17210, 10796, 32920, 0, 12456, 0,
+    17218, 17210, 12468, 6184, 28706, 12792, 11733, 20487, 10269, 28741, 13008, 8723, 6233, 11600, 0, 28797,
+    9956, 0, 13053, 0, 28764, 0, 13017, 0, 11059, 28808, 12945, 10452, 32870, 28777, 10162, 28764,
+    0, 17071, 11639, 11104, 17218, 9973, 0, 8490, 0, 16676, 11148, 16536, 12600, 10506, 12771, 12755,
+    11844, 13019, 12432, 12824, 11356, 0, 17132, 10554, 13114, 12480, 28682, 0, 28789, 0, 10751, 11656,
+    13015, 6320, 13209, 9618, 32883, 28715, 12545, 32904, 13116, 28695, 6049, 11402, 12300, 28764, 9984, 16933,
+    11602, 10849, 16700, 17132, 12600, 0, 10550, 17275, 0, 4857, 10218, 6148, 12564, 16811, 28808, 11844,
+    6321, 10254, 11654, 11572, 32904, 5673, 11693, 13137, 12537, 28766, 17090, 17052, 28777, 32839, 12922, 12480,
+    13017, 9443, 12420, 8722, 12480, 28773, 9388, 10813, 5628, 12478, 11684, 10461, 6349, 0, 16855, 28748,
+    6320, 28730, 0, 17149, 12564, 0, 12683, 10844, 28759, 28712, 28776, 12932, 16577, 0, 5192, 0,
+    10247, 11105, 12564, 28765, 10558, 9685, 0, 12467, 0, 12622, 8311, 12731, 9956, 16921, 11602, 12587,
+    12792, 12743, 12420, 8480, 0, 11394, 11442, 32893, 8628, 5928, 12871, 10804, 10759, 13125, 12717, 28816,
+    12982, 11143, 0, 28758, 8723, 12920, 28762, 0, 12826, 10559, 12887, 12944, 28806, 6432, 12887, 28747,
+    16992, 28788, 13126, 0, 28824, 11148, 6179, 13037, 0, 28808, 28786, 28828, 32845, 11712, 12921, 0,
+    28786, 12900, 0, 13064, 11170, 10841, 10262, 32921, 12694, 28755, 28745, 0, 9979, 8383, 11159, 13114,
+    32806, 12347, 11451, 12824, 8882, 28781, 9068, 0, 16460, 0, 11602, 0, 32932, 0, 0, 28823,
+    0, 0, 0, 12360, 11654, 28800, 28755, 10183, 12887, 9076, 10552, 11143, 0, 12960, 12813, 10879,
+    12875, 0, 17080, 0, 32818, 28795, 28766, 32904, 28810, 11639, 9676, 10806, 0, 12696, 16845, 11112,
+    12873, 12852, 0, 17072, 16843, 28788, 0, 28787, 11685, 11358, 12931, 0, 12031, 0, 0, 17158,
+    17149, 28815, 13039, 13091, 6324, 0, 32932, 10813, 12932, 17001, 11630, 0, 0, 0, 32883, 28764,
+    9088, 13050, 11710, 32892, 0, 10568, 13063, 12900, 8918, 11481, 28788, 0, 6020, 0, 17141, 6225,
+    16462, 28689, 28709, 12802, 8637, 0, 10254, 28744, 28681, 0, 11312, 28760, 28823, 13029, 6056, 0,
+    0, 0, 11357, 6216, 12910, 20489, 0, 32893, 28812, 9087, 28719, 8412, 0, 11050, 0, 0,
+    28740, 10516, 13158, 16855, 0, 20483, 12839, 28689, 0, 16463, 12948, 9974, 10516, 28724, 12719, 0,
+    11394, 16564, 12944, 8988, 12738, 10285, 32833, 6050, 11394, 0, 28748, 12983, 0, 17002, 12576, 17411,
+    12355, 13171, 11113, 6326, 13157, 0, 28776, 13174, 12993, 28785, 0, 17220, 0, 17072, 9168, 10836,
+    11403, 9009, 12982, 0, 12533, 32898, 10878, 12612, 28821, 28755, 16418, 12887, 6464, 13040, 0, 17080,
+    13199, 13148, 12826, 12028, 28732, 6180, 28784, 11059, 32881, 0, 28707, 12527, 17298, 0, 16935, 13068,
+    0, 32841, 16935, 9388, 12708, 10324, 17309, 0, 12500, 12815, 17151, 0, 0, 28760, 12027, 0,
+    11312, 10797, 0, 28803, 11640, 10572, 10806, 17229, 28759, 10805, 28687, 10279, 13008, 12599, 0, 12295,
+    16579, 17238, 12624, 13150, 28711, 13043, 9307, 32793, 8488, 17092, 10217, 12647, 10553, 0, 17151, 9986,
+    10207, 17219, 11143, 28777, 28731, 0, 12815, 11610, 9983, 6325, 0, 0, 16935, 12910, 13006, 17277,
+    32820, 6217, 17228, 16777, 12876, 9675, 16934, 32817, 12984, 0, 0, 17160, 10077, 12563, 12624, 13053,
+    12432, 12911, 12946, 11135, 11891, 13044, 8479, 12813, 13139, 17280, 11177, 16537, 10452, 12912, 11468, 11395,
+    0, 11348, 28790, 12815, 32937, 28825, 0, 10869, 12948, 12608, 28801, 9218, 10568, 0, 16965, 17230,
+    32936, 12393, 32804, 8305, 12671, 28772, 10264, 0, 12804, 0, 28777, 17238, 12827, 16933, 16936, 13062,
+    8987, 0, 11151, 8489, 0, 0, 0, 28684, 13006, 32884, 17160, 12707, 32777, 17070, 16751, 0,
+    12702, 16924, 16846, 32918, 0, 28732, 0, 0, 11702, 6232, 12826, 16936, 13115, 11161, 12617, 9984,
+    20487, 8930, 11992, 12959, 12392, 10506, 0, 32895, 10814, 11701, 12876, 28767, 13031, 32884, 6217, 17072,
+    20489, 20488, 28677, 11412, 28730, 28703, 0, 0, 32846, 0, 28706, 28762, 13067, 17218, 0, 12586,
+    12533, 6188, 10405, 13065, 4827, 0, 10562, 12924, 13029, 13019, 0, 13064, 11932, 12959, 16462, 0,
+    12840, 32907, 32857, 12720, 11931, 9985, 10805, 0, 8649, 13092, 9687, 13116, 11096, 32841, 12574, 5628,
+    13187, 17083, 0, 12558, 28724, 28743, 11900, 17229, 13158, 12519, 0, 0, 0, 28793, 16595, 12622,
+    28753, 0, 0, 12477, 28805, 10751, 11403, 12923, 12863, 0, 32802, 9150, 12079, 12827, 17062, 12780,
+    4666, 0, 0, 0, 0, 13043, 13139, 0, 12815, 17092, 0, 17229, 9919, 10553, 32896, 0,
+    12933, 12438, 28767, 0, 12665, 9986, 5253, 17319, 6391, 32790, 28820, 0, 11113, 16935, 16911, 17251,
+    20483, 12827, 13160, 16665, 10516, 28751, 6439, 12588, 9853, 13137, 11656, 0, 0, 0, 28737, 32907,
+    17285, 17320, 8403, 10860, 20483, 16734, 0, 32909, 32933, 17247, 9964, 32871, 17229, 32897, 16936, 0,
+    5621, 12633, 13068, 17012, 0, 10816, 28808, 8491, 28732, 0, 11179, 0, 28732, 0, 28805, 11741,
+    16428, 9376, 28793, 12991, 11648, 9684, 12840, 12780, 28781, 13150, 9794, 8490, 17282, 16937, 13020, 28699,
+    12684, 4864, 0, 16767, 28821, 12635, 12708, 16766, 28750, 28781, 0, 17003, 12984, 11177, 32905, 10140,
+    13183, 28722, 17141, 0, 9197, 0, 9552, 17220, 9386, 17252, 0, 9985, 0, 11161, 6225, 32933,
+    13149, 12514, 6233, 12696, 28765, 8788, 10263, 13090, 12720, 28732, 10517, 0, 6188, 17082, 0, 10545,
+    11358, 32906, 13162, 9676, 6188, 32883, 10264, 28811, 0, 17092, 0, 0, 17171, 12936, 9862, 13147,
+    8344, 28809, 11112, 13053, 10871, 32896, 13151, 13029, 11112, 28721, 13175, 5927, 10870, 12934, 6438, 28767,
+    13074, 16536, 12382, 20489, 0, 17117, 11909, 32897, 32840, 17162, 11741, 32906, 12592, 6398, 16492, 0,
+    9278, 8489, 0, 13051, 11035, 13140, 13030, 28806, 8779, 8278, 12996, 17247, 8340, 0, 28709, 0,
+    16524, 0, 12588, 28792, 12780, 32859, 28684, 13052, 8283, 11114, 12804, 10713, 0, 6401, 10573, 12524,
+    13020, 0, 17172, 0, 13195, 16658, 13019, 28795, 32884, 12323, 10182, 0, 12826, 11459, 0, 11113,
+    0, 0, 32920, 5892, 28817, 6393, 12708, 12792, 11450, 5270, 0, 13149, 12464, 13030, 11458, 8790,
+    9940, 11904, 28720, 12888, 12548, 12297, 12923, 10806, 11312, 6398, 11182, 0, 28816, 12563, 0, 12643,
+    0, 32776, 0, 28823, 32862, 13212, 0, 28812, 11170, 12569, 32872, 11412, 13127, 32937, 8910, 17092,
+    12521, 32896, 11458, 13187, 17082, 0, 9878, 0, 0, 12852, 17240, 10879, 12333, 11152, 28790, 0,
+    0, 32833, 16650, 17228, 17306, 11413, 12440, 13063, 28779, 28740, 8318, 0, 10451, 12463, 0, 12549,
+    11334, 11610, 0, 11694, 0, 16695, 17229, 11459, 32936, 6455, 12444, 12895, 0, 9309, 0, 28704,
+    16499, 0, 0, 9605, 0, 12972, 20488, 32918, 10284, 12672, 13079, 12393, 12827, 12501, 13185, 9518,
+    32896, 13040, 0, 16698, 12660, 0, 13077, 17015, 28732, 0, 20488, 12575, 32923, 28772, 28800, 6364,
+    11712, 6364, 12429, 0, 28771, 10879, 0, 12536, 11740, 10563, 28751, 17160, 10862, 13041, 12857, 11978,
+    13163, 9686, 28809, 10815, 16463, 13007, 0, 16428, 17014, 28747, 32845, 12321, 12786, 28761, 11611, 12322,
+    16527, 9796, 13052, 0, 32842, 11655, 13030, 12624, 0, 10879, 20487, 0, 28808, 12996, 12547, 11178,
+    17082, 13055, 8403, 6447, 11984, 0, 20481, 6447, 9374, 10143, 28811, 0, 0, 17083, 6456, 11712,
+    16911, 8789, 6401, 0, 28762, 32805, 4903, 5484, 17290, 13042, 11647, 12033, 13088, 32846, 12033, 9975,
+    9686, 13068, 0, 10572, 13042, 17238, 12610, 32791, 0, 17220, 11479, 11768, 11657, 16833, 0, 0,
+    32897, 0, 13197, 12562, 0, 0, 0, 32832, 0, 10571, 9591, 0, 0, 17299, 8854, 17082,
+    8775, 6447, 11656, 8961, 12888, 28797, 11160, 10272, 28703, 13171, 10284, 32908, 13077, 20482, 12430, 17117,
+    12720, 28698, 13113, 12743, 28780, 16607, 9687, 13163, 9687, 0, 12852, 8964, 0, 11872, 8366, 12600,
+    0, 0, 32820, 8342, 17015, 28797, 16439, 16858, 10573, 5455, 28786, 13062, 10880, 11178, 28749, 11984,
+    28786, 17093, 12694, 11900, 17161, 0, 0, 12324, 12696, 12653, 13182, 28764, 6226, 12780, 28788, 17332,
+    13044, 28817, 12776, 12651, 12888, 16744, 0, 32871, 11703, 13159, 0, 0, 32885, 13043, 0, 9501,
+    11766, 17092, 0, 0, 0, 13151, 11693, 0, 28725, 11404, 0, 0, 0, 13020, 12488, 11469,
+    0, 9208, 5726, 12780, 28815, 32897, 12048, 32917, 12539, 12707, 28821, 0, 13171, 12828, 12815, 32827,
+    11152, 11937, 10274, 11170, 12404, 8618, 12576, 0, 0, 9018, 32777, 0, 16571, 32820, 28682, 16509,
+    0, 0, 16814, 17299, 11712, 32845, 32816, 17332, 28769, 17014, 28744, 8831, 0, 12034, 11159, 0,
+    13100, 0, 0, 13164, 10880, 10311, 12501, 11235, 28676, 28706, 12911, 0, 9687, 0, 17171, 12380,
+    11179, 0, 8904, 13149, 28692, 32777, 17052, 0, 12756, 13042, 32937, 17093, 16571, 28767, 9509, 9553,
+    28768, 12332, 11775, 0, 13075, 11712, 28681, 0, 32898, 28812, 12065, 13136, 12888, 17307, 28734, 28806,
+    12828, 28704, 13187, 11901, 13197, 11161, 10583, 0, 0, 28748, 28676, 32819, 28718, 12393, 28721, 32790,
+    13053, 28795, 28796, 10816, 12370, 16421, 28828, 9501, 13139, 8966, 0, 11160, 13207, 0, 0, 12357,
+    28807, 13080, 6447, 11451, 28779, 11469, 12451, 13075, 16448, 11460, 32840, 13101, 12852, 13075, 16662, 10283,
+    0, 0, 11780, 13044, 0, 5269, 12972, 28773, 0, 0, 28673, 4302, 17172, 28686, 13171, 12552,
+    0, 28782, 16428, 32816, 0, 0, 28679, 8616, 13103, 32802, 10310, 10274, 12684, 16461, 9002, 28711,
+    32806, 5328, 13127, 13137, 0, 0, 0, 17249, 12079, 0, 11012, 10582, 0, 0, 13152, 10285,
+    0, 6235, 0, 0, 0, 12371, 28821, 12466, 13008, 13195, 10582, 28754, 12871, 6448, 0, 6225,
+    12298, 12310, 8362, 17226, 13076, 13183, 13199, 28675, 0, 17013, 28764, 12417, 16450, 13139, 6456, 32777,
+    0, 13138, 12041, 32791, 28742, 8955, 28765, 17162, 12898, 17289, 8711, 10880, 9500, 28736, 0, 0,
+    16587, 16605, 28725, 0, 17016, 28685, 28782, 12334, 17330, 28811, 12443, 9245, 9088, 0, 9206, 16746,
+    13090, 12924, 28735, 17091, 17388, 0, 10562, 28820, 12322, 16937, 16670, 12298, 8916, 13103, 11459, 9031,
+    13089, 13102, 0, 28799, 28767, 0, 28810, 17299, 0, 28732, 13032, 0, 16509, 13152, 28809, 8881,
+    17307, 11611, 16439, 0, 12592, 12924, 28794, 0, 0, 32869, 12813, 12075, 8947, 5377, 11170, 11909,
+    0, 8278, 5772, 13113, 0, 13175, 0, 13020, 12419, 17378, 13184, 12664, 0, 0, 12762, 12532,
+    0, 32872, 11767, 0, 0, 13128, 5805, 28791, 17299, 0, 0, 0, 8905, 12299, 32832, 0,
+    12310, 17250, 6410, 28681, 0, 16822, 12002, 9835, 0, 0, 13211, 8611, 0, 16736, 0, 0,
+    16537, 12404, 0, 10853, 13015, 16596, 28779, 17061, 0, 12038, 28736, 13102, 13174, 11909, 28821, 9180,
+    32792, 9915, 0, 32922, 28821, 16658, 0, 16829, 4598, 11469, 9985, 28756, 0, 16517, 12383, 32920,
+    8961, 28806, 12570, 13152, 28714, 17330, 12908, 11013, 4906, 12664, 17318, 10882, 16932, 28692, 0, 12629,
+    11057, 12664, 10582, 13209, 12333, 28821, 9955, 12392, 13148, 13127, 16586, 10246, 4567, 0, 16721, 0,
+    0, 28736, 9204, 12383, 0, 16736, 13090, 13206, 32780, 8910, 11469, 16822, 28756, 32859, 12856, 12760,
+    28709, 0, 12379, 20482, 12355, 0, 28806, 12332, 12612, 13089, 6235, 0, 6401, 0, 28756, 0,
+    8881, 0, 6401, 16430, 16519, 16721, 0, 16437, 12543, 13008, 0, 28748, 28722, 0, 16497, 5809,
+    13076, 16831, 0, 12381, 5651, 28692, 0, 0, 11768, 12391, 0, 17140, 17248, 0, 17317, 12947,
+    12479, 0, 11703, 28805, 8307, 12498, 32885, 13211, 12456, 28768, 16858, 0, 11946, 8905, 16801, 12516,
+    6411, 0, 13078, 13162, 8554, 20482, 32806, 5394, 28768, 11179, 28821, 16857, 0, 12760, 0, 28717,
+    16527, 8706, 0, 28806, 12573, 32817, 4504, 9618, 13103, 6402, 5237, 9075, 9964, 4658, 8446, 16597,
+    13150, 12406, 32829, 17326, 8854, 20483, 0, 32817, 4821, 28703, 32792, 12828, 12039, 8344, 13116, 0,
+    9662, 6411, 0, 0, 16840, 16607, 0, 10909, 10872, 17249, 28675, 28736, 13195, 8894, 0, 32919,
+    0, 28734, 12996, 4655, 0, 6448, 11946, 32820, 11479, 28694, 32793, 13194, 9175, 0, 11946, 17093,
+    8356, 12346, 0, 8997, 0, 12456, 4917, 17298, 9202, 28693, 12653, 12322, 0, 8854, 0, 10584,
+    12760, 12453, 0, 9089, 28726, 0, 11955, 9084, 11768, 12653, 12828, 16527, 28784, 12744, 12068, 16595,
+    12924, 12324, 0, 6466, 13055, 16744, 16933, 13176, 10581, 4818, 12393, 0, 10144, 12044, 8947, 0,
+    32871, 12594, 16831, 8999, 11778, 0, 6189, 9209, 8648, 28732, 12570, 17307, 12298, 12546, 28677, 8707,
+    12334, 16435, 8663, 0, 8577, 8942, 12975, 8342, 16439, 12610, 0, 0, 0, 28821, 0, 32898,
+    28716, 0, 9479, 11115, 20482, 16509, 12040, 12010, 0, 16685, 8395, 16699, 17173, 0, 13020, 32817,
+    9089, 8905, 16440, 0, 10050, 0, 28734, 12311, 12498, 11468, 28808, 12665, 20484, 32918, 0, 8708,
+    9209, 0, 28785, 12595, 10845, 13184, 28812, 28724, 12546, 9972, 0, 28712, 13158, 0, 12749, 4570,
+    10071, 0, 12358, 28675, 32832, 28760, 0, 0, 11780, 16808, 0, 12569, 9259, 0, 32898, 32827,
+    28730, 0, 16753, 0, 11778, 0, 0, 17396, 12749, 13148, 0, 0, 11750, 16816, 11768, 0,
+    0, 13140, 0, 28691, 0, 11759, 10561, 12345, 9260, 9641, 0, 28716, 16753, 17354, 8409, 11955,
+    0, 12010, 12690, 9246, 0, 10327, 12299, 17376, 11460, 0, 32780, 28706, 0, 9049, 28732, 12380,
+    9544, 0, 8655, 0, 28717, 16822, 0, 9211, 0, 0, 17308, 9203, 12948, 12944, 28699, 28714,
+    12960, 9181, 0, 16447, 12719, 9051, 12666, 10245, 8453, 20481, 28726, 17095, 8655, 12335, 0, 8909,
+    28718, 28705, 0, 0, 8917, 0, 12677, 0, 0, 0, 16451, 12876, 12453, 28809, 12732, 32790,
+    32843, 16729, 17249, 11478, 12612, 16753, 13004, 11460, 12077, 16430, 8786, 0, 0, 28727, 17253, 16763,
+    10322, 10544, 13206, 11759, 8390, 16763, 12370, 13172, 8364, 0, 8577, 11769, 16526, 13185, 11820, 12048,
+    0, 9063, 0, 0, 5010, 13160, 12396, 5238, 28819, 16755, 16617, 32781, 12727, 0, 17332, 16619,
+    0, 8583, 0, 8420, 0, 8655, 13140, 0, 12074, 13140, 0, 28745, 8468, 13174, 12695, 8701,
+    17239, 12665, 32806, 9297, 16460, 8701, 13174, 8344, 12751, 0, 0, 20487, 28713, 17360, 13044, 11778,
+    12696, 5006, 4571, 13140, 0, 13206, 13054, 9240, 12415, 17228, 11627, 28746, 12526, 13020, 10584, 13043,
+    0, 9508, 28708, 0, 13127, 8402, 12550, 16841, 5021, 28821, 16438, 0, 0, 0, 12334, 28719,
+    4913, 13199, 12418, 28822, 11460, 11758, 11955, 12335, 32923, 28789, 11758, 0, 16737, 12011, 10881, 16603,
+    28673, 0, 13128, 10326, 8689, 4672, 16526, 28718, 32832, 0, 12390, 0, 16518, 16841, 28675, 0,
+    0, 13197, 32844, 16527, 28756, 28727, 16755, 9084, 0, 0, 0, 12480, 12355, 10617, 32803, 4446,
+    0, 0, 4700, 12396, 9016, 12048, 32806, 8379, 5039, 9503, 28674, 9298, 16519, 32919, 12356, 13028,
+    0, 13148, 8357, 11180, 12677, 12761, 0, 32921, 12420, 28729, 28686, 12333, 13221, 0, 28824, 8232,
+    28828, 12668, 0, 9972, 5033, 0, 11523, 0, 28733, 17328, 11603, 12002, 32779, 9860, 12295, 0,
+    5674, 0, 11776, 28748, 9287, 12334, 16865, 12976, 0, 16509, 0, 17250, 28747, 13196, 16869, 12534,
+    11780, 11413, 16447, 0, 11218, 16616, 9247, 12347, 8313, 28750, 0, 13173, 0, 12405, 9287, 0,
+    16808, 10882, 16609, 0, 9315, 16936, 13140, 28746, 28735, 12439, 16688, 9749, 0, 12888, 12324, 0,
+    12048, 11993, 12558, 12011, 0, 12765, 32841, 0, 28814, 9663, 12002, 5297, 12743, 0, 16460, 8883,
+    9474, 10916, 0, 28824, 12427, 11909, 13198, 16737, 16460, 11481, 0, 8390, 9017, 16737, 4955, 16737,
+    32828, 32804, 12333, 0, 0, 12868, 17378, 0, 28721, 32837, 13182, 17305, 0, 9474, 0, 12828,
+    28767, 28746, 28737, 11131, 10364, 13208, 5210, 9287, 8410, 0, 28724, 9181, 12335, 0, 12654, 28682,
+    12642, 4451, 20484, 0, 5298, 9016, 16685, 8709, 28711, 8270, 9503, 8613, 12381, 0, 8446, 12312,
+    12572, 11780, 0, 0, 0, 32804, 4608, 0, 11657, 4466, 12500, 5313, 9210, 12642, 9210, 0,
+    32844, 17329, 12966, 12696, 12623, 17174, 9771, 0, 32838, 16746, 28680, 9515, 13151, 12310, 0, 12921,
+    28820, 32843, 9342, 12405, 28704, 4452, 0, 12345, 0, 17275, 16509, 13197, 32791, 16508, 0, 8955,
+    16529, 9292, 0, 0, 28722, 28685, 9048, 8869, 4711, 8434, 28783, 17376, 16440, 13040, 0, 0,
+    12309, 0, 10734, 28733, 28703, 4673, 16460, 16529, 16608, 12299, 32819, 12465, 28699, 16592, 9562, 20483,
+    16460, 12431, 12429, 13175, 13209, 16677, 4468, 9620, 12785, 17406, 9049, 12009, 12057, 12773, 0, 0,
+    16619, 0, 28702, 16609, 0, 10049, 16449, 11215, 10207, 28679, 0, 8664, 12631, 9218, 28741, 0,
+    9898, 28704, 32920, 8599, 12740, 9073, 20481, 8650, 9300, 9217, 32807, 8484, 12406, 16609, 8667, 0,
+    13220, 12738, 28739, 10098, 17378, 12611, 8410, 28675, 9247, 12300, 20486, 0, 4629, 8285, 12728, 0,
+    32846, 20485, 28718, 16463, 13173, 10137, 0, 9342, 28688, 10883, 0, 12633, 0, 0, 16538, 9981,
+    11496, 12786, 0, 13209, 0, 16850, 12358, 0, 12057, 12359, 0, 8749, 0, 28792, 28739, 9057,
+    4341, 17253, 16833, 0, 10272, 28725, 11033, 28741, 13161, 10105, 12644, 16767, 4923, 8358, 9248, 32845,
+    28818, 17397, 0, 12395, 12594, 0, 32806, 5524, 32780, 28819, 0, 12058, 0, 12572, 0, 0,
+    9518, 12452, 12879, 28695, 10049, 32819, 28707, 13152, 0, 16873, 16675, 8964, 9072, 8365, 9001, 8365,
+    10936, 0, 12534, 0, 17327, 12430, 0, 12846, 11956, 12524, 28745, 32804, 8595, 12405, 0, 8636,
+    0, 28739, 8764, 0, 8883, 0, 28747, 28758, 8664, 28719, 17169, 0, 8359, 10947, 10659, 12632,
+    0, 20484, 6387, 0, 16459, 12594, 12464, 10699, 4883, 0, 9510, 11777, 0, 11182, 9008, 16919,
+    10637, 0, 12428, 12310, 0, 28690, 0, 17332, 13025, 12643, 10947, 0, 0, 12727, 10393, 10393,
+    13092, 0, 28823, 16597, 28695, 12324, 0, 0, 0, 17410, 4468, 16925, 9892, 28698, 9586, 8403,
+    8613, 17328, 9852, 28703, 28733, 13016, 17368, 10436, 28816, 12666, 8621, 10346, 9173, 16764, 10356, 28822,
+    28776, 9600, 13121, 13208, 12655, 12452, 13212, 0, 16537, 20489, 9800, 8446, 8681, 12880, 32830, 0,
+    9481, 8489, 28804, 28694, 0, 12881, 0, 10098, 0, 4614, 8451, 0, 12384, 10958, 8702, 0,
+    28784, 9383, 10138, 17190, 32819, 0, 12077, 8775, 28713, 0, 12860, 28704, 28697, 28744, 12881, 9353,
+    12360, 12647, 10958, 10958, 0, 0, 12573, 12858, 28687, 9063, 28691, 17117, 28676, 11759, 12067, 12057,
+    12644, 12395, 12848, 20489, 10936, 12562, 13200, 0, 12984, 0, 5525, 0, 0, 12786, 0, 11230,
+    28719, 12407, 9518, 0, 28810, 9546, 16530, 12001, 16598, 28679, 32793, 10429, 9049, 28703, 0, 12988,
+    10695, 8956, 13221, 0, 16542, 28737, 5797, 12669, 28730, 8367, 8466, 11219, 12977, 12762, 12336, 32807,
+    5954, 20481, 0, 28706, 16885, 8444, 16597, 12876, 20481, 28705, 32922, 9586, 28726, 12065, 9564, 10947,
+    0, 16618, 5798, 28750, 12395, 17386, 12551, 12705, 0, 28720, 10584, 28750, 32852, 12526, 10345, 32845,
+    5308, 12607, 5306, 5251, 0, 0, 11333, 0, 28711, 5058, 5608, 16446, 28759, 28824, 12336, 12656,
+    12066, 9615, 10472, 0, 12894, 12801, 12011, 16842, 11402, 12535, 12466, 8702, 8703, 11516, 16607, 0,
+    0, 32819, 32833, 28681, 16462, 16901, 28820, 28812, 28703, 12812, 0, 9593, 10103, 8657, 32858, 16440,
+    0, 4976, 12789, 32845, 0, 0, 9002, 16598, 9089, 0, 12066, 0, 8710, 0, 0, 10476,
+    0, 12895, 32777, 0, 0, 16616, 16759, 12584, 32792, 10104, 13209, 0, 0, 32818, 13097, 17386,
+    12584, 16676, 9001, 0, 5426, 28733, 12537, 0, 32781, 12658, 28773, 8704, 12466, 0, 9646, 0,
+    5861, 0, 0, 0, 12359, 6394, 32830, 28740, 28763, 10075, 8919, 17409, 0, 0, 16460, 12798,
+    32882, 0, 8711, 32843, 32801, 4200, 0, 28721, 28772, 32807, 5861, 0, 20485, 5483, 16699, 0,
+    12077, 28803, 9564, 16569, 0, 32870, 28731, 0, 16463, 0, 12847, 0, 12788, 12624, 28727, 32868,
+    13208, 13209, 8920, 5444, 17247, 28780, 0, 12360, 12846, 0, 4720, 8404, 13212, 16418, 0, 0,
+    28823, 16910, 5813, 16885, 28786, 10969, 9972, 12300, 12360, 12586, 28762, 17387, 12383, 12419, 0, 12681,
+    28744, 28775, 9615, 12859, 12383, 16887, 28681, 16776, 9899, 12728, 12681, 32830, 13064, 10137, 16779, 5422,
+    12607, 0, 28824, 5862, 16681, 12324, 17405, 17411, 0, 8721, 0, 12324, 5359, 0, 12777, 0,
+    28730, 0, 28739, 17378, 13212, 8446, 8719, 28699, 0, 28673, 16833, 4977, 12598, 13221, 16853, 5950,
+    28691, 12683, 0, 12777, 32852, 12597, 13220, 16676, 0, 9853, 12528, 12777, 13176, 13044, 8720, 12466,
+    12954, 10648, 12417, 28722, 0, 28799, 5966, 12587, 0, 13103, 32820, 16449, 0, 0, 8367, 16540,
+    9906, 12535, 12002, 13063, 0, 0, 12887, 12057, 9861, 28731, 8719, 12550, 16910, 28728, 4975, 8452,
+    9130, 0, 20484, 13222, 28746, 16699, 4974, 0, 4975, 28736, 8759, 9311, 0, 28775, 0, 28710,
+    0, 4974, 8404, 12585, 0, 12716, 10880, 0, 0, 0, 16607, 0, 0, 16767, 28785, 16699,
+    20485, 12428, 9082, 17411, 12539, 9019, 12682, 12826, 12308, 12969, 8765, 5551, 8966, 32794, 16685, 12618,
+    8459, 12456, 16901, 0, 32839, 12537, 28708, 28723, 12668, 13099, 8666, 16608, 9265, 5048, 9283, 16936,
+    0, 13147, 0, 12300, 8666, 0, 10105, 32792, 12668, 17378, 32845, 12999, 0, 9343, 13157, 9809,
+    8704, 32910, 32843, 8870, 28823, 9601, 12323, 0, 0, 9564, 13128, 28737, 12670, 12797, 32864, 5563,
+    11511, 0, 8421, 32817, 9349, 32820, 0, 20482, 28711, 13104, 11270, 13148, 8957, 9861, 0, 12618,
+    0, 28822, 9381, 0, 28772, 16893, 9009, 0, 16700, 28823, 12788, 13221, 5070, 12777, 0, 28822,
+    10675, 0, 5433, 17386, 0, 28761, 12504, 9309, 17378, 10076, 11179, 10077, 0, 10870, 32843, 8600,
+    28748, 0, 20486, 10207, 10699, 28703, 16800, 11999, 0, 0, 9083, 12884, 12343, 12633, 0, 13221,
+    0, 0, 9020, 12336, 28757, 5645, 17387, 28745, 12608, 5426, 16913, 12859, 8920, 20486, 0, 0,
+    32820, 28794, 28742, 28799, 11246, 12308, 13174, 9020, 9020, 12312, 12336, 0, 13220, 12680, 0, 10573,
+    20484, 28678, 9321, 9082, 12418, 28690, 12660, 28757, 13078, 9019, 0, 13224, 13011, 9654, 28757, 12408,
+    12766, 0, 9915, 0, 10869, 17368, 0, 17038, 12539, 32921, 28738, 9915, 0, 28749, 28773, 32805,
+    8632, 5366, 9671, 11291, 5067, 32858, 12442, 13001, 32793, 16966, 32819, 9899, 17396, 16911, 0, 0,
+    12698, 12297, 5536, 12598, 10974, 0, 8883, 32853, 0, 9564, 12551, 11567, 11034, 17132, 32806, 5551,
+    12418, 17115, 12490, 16964, 0, 28738, 12596, 9593, 12431, 10733, 28749, 8637, 12753, 12488, 12874, 32920,
+    28731, 17115, 9601, 12691, 0, 12935, 16901, 12874, 28749, 10732, 12618, 0, 10443, 8712, 0, 20481,
+    16755, 28731, 17397, 16698, 11182, 5555, 0, 12607, 0, 10573, 12503, 10108, 28707, 8475, 12713, 12671,
+    5340, 0, 0, 9809, 28738, 6091, 17361, 8704, 10376, 5962, 12488, 12900, 5426, 17131, 12575, 5433,
+    0, 12683, 28679, 13109, 32781, 28768, 28798, 0, 12488, 9265, 8919, 0, 6041, 32864, 28710, 11632,
+    12646, 11050, 28785, 16538, 12967, 12396, 10078, 12608, 28694, 32924, 12884, 28822, 12694, 13014, 16835, 9861,
+    0, 10113, 10077, 10239, 12794, 16894, 16697, 5645, 12787, 12444, 28760, 0, 8413, 8639, 10106, 12668,
+    5075, 12335, 12701, 16460, 0, 0, 0, 16450, 0, 20482, 12619, 0, 12524, 11032, 9817, 12608,
+    16854, 4410, 13160, 0, 12503, 12324, 12739, 12787, 12946, 0, 13015, 12609, 12670, 0, 0, 12692,
+    0, 28695, 12489, 0, 0, 6259, 16542, 28762, 28738, 28820, 32830, 0, 16887, 0, 12489, 9861,
+    9669, 0, 12767, 0, 28773, 12478, 17406, 0, 12909, 12676, 28720, 12618, 12644, 8467, 28696, 12396,
+    17038, 0, 0, 9954, 32781, 12779, 0, 12408, 9555, 0, 5585, 12609, 32781, 32864, 0, 12779,
+    0, 0, 9675, 28797, 12633, 0, 5959, 8468, 28762, 28722, 28773, 12885, 9724, 32871, 16688, 28752,
+    0, 28695, 11539, 11539, 32831, 12701, 16825, 5359, 0, 28747, 13221, 9147, 12330, 11775, 0, 10675,
+    17396, 11522, 28818, 28781, 28771, 28747, 12797, 12968, 11304, 16777, 12691, 12525, 17398, 28688, 12848, 0,
+    28724, 16618, 12692, 13185, 16688, 10107, 16920, 12514, 28712, 32790, 28816, 28708, 0, 10583, 16974, 12513,
+    9954, 13014, 28717, 12788, 32855, 10538, 8469, 0, 12609, 12693, 28807, 16767, 12798, 28757, 9853, 16853,
+    9907, 17396, 9985, 5099, 9854, 16825, 16971, 11769, 0, 12898, 11333, 8621, 12609, 12772, 16986, 0,
+    28827, 12432, 0, 12538, 0, 0, 10750, 10706, 11136, 12788, 12991, 0, 0, 12324, 9058, 16664,
+    10208, 28707, 12728, 10506, 17320, 11816, 16674, 12359, 17121, 32794, 10489, 10443, 9671, 0, 13032, 28799,
+    10738, 8595, 8322, 28776, 0, 0, 0, 0, 0, 12797, 28755, 16825, 12898, 9909, 28679, 10713,
+    6145, 12991, 9899, 10531, 12796, 17407, 12657, 12490, 4728, 12811, 11590, 16894, 28798, 16579, 13151, 0,
+    28824, 12789, 0, 9963, 8785, 9011, 12788, 9907, 12456, 0, 8423, 10186, 8873, 17377, 16618, 16450,
+    0, 16677, 0, 12767, 10704, 9766, 16778, 8469, 20486, 16459, 12550, 0, 28706, 28786, 9256, 11334,
+    11379, 16620, 12479, 28737, 16618, 20482, 10189, 16777, 0, 32924, 12822, 16929, 12502, 32819, 0, 0,
+    12695, 0, 0, 12904, 12740, 28754, 0, 28819, 20485, 12321, 0, 8367, 12586, 9011, 12444, 16767,
+    32865, 12713, 0, 12611, 6210, 20481, 0, 0, 16507, 0, 0, 5987, 8338, 13030, 12789, 9681,
+    10443, 12429, 9971, 0, 28797, 28762, 0, 0, 10189, 28712, 16834, 28697, 0, 9318, 0, 8423,
+    12324, 16980, 0, 0, 9374, 11374, 12768, 28769, 10239, 28759, 13018, 5889, 16776, 0, 0, 0,
+    10155, 13090, 0, 8368, 9954, 12611, 13116, 5585, 5269, 12658, 0, 12980, 12947, 28730, 28751, 9972,
+    16980, 0, 16991, 10705, 6381, 16854, 16541, 0, 17122, 12968, 0, 28691, 12490, 0, 11297, 28729,
+    13198, 0, 11297, 13108, 8404, 11379, 12777, 28729, 4728, 12549, 12468, 20481, 0, 28696, 0, 0,
+    0, 4810, 11545, 28826, 32937, 0, 10782, 16540, 0, 13004, 11673, 6014, 10411, 11545, 12848, 28719,
+    0, 13004, 8776, 28793, 16438, 12809, 12869, 0, 0, 9020, 0, 28702, 28720, 13085, 17408, 12741,
+    9666, 12863, 16972, 28673, 10161, 12799, 32854, 11002, 6117, 0, 0, 0, 28730, 28694, 12850, 17397,
+    0, 0, 13206, 6038, 0, 16931, 6100, 0, 0, 0, 8478, 11004, 11590, 11632, 11004, 12791,
+    10158, 0, 0, 12620, 0, 16987, 0, 9916, 28693, 32856, 9679, 12575, 12982, 12754, 0, 11299,
+    9681, 0, 9681, 8487, 0, 16541, 11334, 28795, 0, 0, 12621, 10239, 16989, 9862, 12540, 0,
+    28762, 12906, 9916, 13108, 12808, 12994, 28738, 6306, 17139, 12659, 32892, 12898, 12981, 11274, 28813, 9384,
+    12994, 12395, 5614, 0, 6268, 8476, 32780, 28703, 16854, 28763, 17269, 32846, 0, 11567, 12564, 11297,
+    10705, 0, 0, 28751, 0, 16904, 9059, 28679, 0, 0, 11712, 32781, 9011, 9916, 5365, 12658,
+    0, 12849, 10012, 13208, 0, 10740, 5922, 17353, 32855, 28754, 28803, 28752, 6293, 12515, 0, 13019,
+    0, 0, 16904, 5102, 16997, 28674, 9963, 13218, 6271, 12055, 16931, 12323, 9916, 0, 0, 9744,
+    12574, 13023, 12809, 5591, 13109, 28738, 12896, 12703, 0, 32854, 12611, 5585, 16921, 28730, 0, 5918,
+    0, 28729, 28690, 9963, 0, 28754, 10786, 11673, 10205, 0, 32803, 9761, 17003, 9012, 0, 0,
+    11470, 11632, 12527, 0, 28740, 11349, 12600, 0, 12527, 11081, 0, 9066, 28763, 10497, 28753, 12563,
+    10455, 28751, 28814, 9955, 5368, 9908, 12899, 12875, 6012, 0, 12323, 12671, 0, 16924, 32855, 0,
+    16688, 0, 6012, 17148, 17123, 28687, 28742, 13015, 28731, 28752, 13120, 12931, 16608, 0, 28752, 9684,
+    0, 13029, 8713, 16966, 11273, 28799, 28714, 9666, 12647, 11039, 13164, 10212, 12907, 6299, 0, 9321,
+    8487, 12620, 12790, 13110, 9916, 11806, 11136, 17408, 11274, 28768, 28716, 11274, 9684, 0, 0, 0,
+    9916, 0, 11012, 12456, 13005, 12703, 11648, 12875, 0, 0, 6015, 28774, 0, 28711, 0, 28738,
+    0, 10214, 0, 5460, 28731, 0, 10837, 28783, 17217, 28794, 11085, 28811, 0, 0, 12768, 17069,
+    28794, 11603, 28740, 28685, 0, 11348, 0, 12956, 12968, 28820, 13222, 9564, 6173, 9089, 12504, 28786,
+    9086, 10191, 12888, 6381, 0, 13119, 6015, 8422, 0, 12455, 0, 0, 28798, 13017, 9918, 11430,
+    16903, 32908, 6123, 11302, 0, 0, 28731, 0, 9674, 16542, 11081, 12717, 28795, 11380, 10212, 12874,
+    9387, 9674, 17079, 11632, 11086, 0, 12799, 9085, 13164, 10713, 9376, 12646, 12586, 12609, 12575, 16463,
+    20481, 28752, 0, 12503, 28682, 12791, 12621, 28774, 0, 9981, 12907, 10853, 28719, 32807, 5701, 5368,
+    13133, 6168, 6011, 0, 12527, 28680, 28754, 10742, 11679, 0, 12996, 16932, 16931, 9918, 0, 12850,
+    0, 0, 9919, 5922, 28750, 13018, 9302, 0, 0, 0, 11136, 11387, 0, 6286, 10706, 10812,
+    10244, 12873, 11780, 28723, 0, 0, 12682, 10834, 32781, 9948, 0, 17174, 10206, 12705, 11954, 0,
+    0, 9684, 28773, 10883, 28692, 9377, 10153, 0, 5629, 10457, 10545, 12588, 16914, 8779, 5113, 28772,
+    9963, 0, 28679, 9918, 10713, 0, 6344, 13174, 12958, 28805, 12659, 13085, 16931, 0, 10714, 28788,
+    12811, 28700, 0, 28739, 16912, 16618, 9311, 0, 28745, 0, 10378, 6432, 13024, 0, 10500, 11678,
+    0, 11633, 28734, 0, 12900, 28753, 8542, 8424, 32857, 9948, 0, 0, 28730, 17123, 10838, 11152,
+    32937, 10713, 13019, 28767, 0, 9909, 12492, 0, 32870, 12731, 12696, 11041, 16923, 5655, 20488, 12716,
+    28765, 28698, 0, 9955, 10284, 6381, 9919, 16991, 17408, 32930, 10759, 0, 12620, 11311, 12823, 12767,
+    0, 12811, 17132, 12982, 9376, 0, 12456, 0, 12671, 9900, 10751, 0, 0, 16846, 28769, 28764,
+    0, 28787, 12812, 12768, 12480, 28814, 28703, 11348, 16914, 12706, 12575, 12547, 0, 12634, 16726, 32835,
+    11356, 32869, 0, 10413, 0, 12295, 28763, 12957, 0, 32804, 0, 28809, 12814, 11311, 13130, 0,
+    32879, 12612, 0, 12480, 28774, 9862, 10273, 0, 28820, 32803, 9462, 11865, 9366, 16700, 0, 0,
+    32859, 8424, 28753, 32866, 6144, 12931, 12623, 11571, 28752, 9675, 0, 9984, 32870, 9657, 17140, 12989,
+    12516, 0, 17173, 12623, 6145, 17131, 9367, 8423, 0, 9675, 28807, 32868, 12972, 10092, 28746, 12788,
+    32936, 12384, 0, 28762, 8489, 12692, 12968, 11633, 28682, 10270, 13027, 0, 32904, 12612, 28809, 12931,
+    28746, 28737, 0, 12908, 10796, 0, 6181, 28790, 17139, 0, 0, 12672, 6148, 13023, 17149, 11013,
+    17069, 0, 12729, 17053, 0, 12516, 9973, 0, 0, 10152, 32870, 0, 13138, 5656, 28760, 16461,
+    11311, 11049, 0, 9376, 12887, 16856, 0, 28772, 0, 16779, 12873, 16974, 10495, 28785, 12672, 10450,
+    12930, 10796, 9956, 10415, 10796, 12930, 16834, 13079, 6210, 32792, 12756, 9358, 17006, 0, 28795, 13143,
+    17210, 28748, 17309, 17129, 10852, 17061, 0, 10511, 11171, 17148, 28704, 16923, 0, 0, 16778, 12705,
+    9955, 12931, 28784, 0, 12620, 12931, 0, 28748, 32934, 10071, 11599, 28716, 9955, 12994, 9917, 28757,
+    17203, 32885, 0, 32820, 11088, 28754, 0, 13098, 9963, 12696, 9975, 28747, 28740, 16413, 11866, 16982,
+    11311, 16728, 0, 28679, 16854, 10247, 16816, 0, 20488, 13017, 12503, 12500, 28822, 28781, 8778, 16672,
+    12487, 0, 28815, 16914, 11057, 12683, 17095, 11013, 0, 28708, 12972, 0, 0, 17080, 28755, 0,
+    11180, 28751, 12440, 9059, 28732, 0, 28738, 12480, 12440, 28820, 5628, 10153, 9553, 6211, 6432, 32880,
+    9862, 28803, 17052, 0, 12948, 0, 0, 32833, 11095, 6174, 12504, 9089, 28773, 12823, 0, 12634,
+    0, 10268, 12503, 9367, 12717, 11041, 13027, 5628, 0, 8469, 12564, 6432, 0, 8321, 28810, 16698,
+    13030, 16922, 28752, 28796, 13051, 11573, 28684, 0, 17079, 12943, 8440, 28708, 12348, 11572, 28689, 28731,
+    13146, 16992, 0, 9089, 0, 28759, 0, 0, 0, 12696, 12931, 16913, 28710, 0, 0, 20486,
+    28729, 10805, 13123, 0, 11573, 11348, 12492, 0, 0, 28774, 8461, 8911, 16937, 0, 11303, 12917,
+    0, 13043, 12520, 8424, 12621, 13036, 17060, 0, 13036, 12456, 20490, 6150, 28769, 32910, 20488, 12983,
+    12943, 11096, 11693, 12766, 13099, 28788, 12943, 0, 0, 11683, 10246, 11095, 6174, 0, 11647, 0,
+    11601, 28762, 0, 0, 5498, 12767, 12800, 13007, 10270, 12994, 17069, 28797, 0, 32818, 0, 17139,
+    17091, 32892, 12296, 17148, 32879, 9838, 12623, 13113, 11729, 0, 28798, 9086, 6149, 12732, 0, 12932,
+    11838, 11340, 16459, 6048, 9372, 9973, 28805, 17070, 13063, 32868, 5113, 0, 6174, 0, 12514, 9089,
+    11103, 16458, 9686, 12887, 0, 16773, 11838, 11112, 0, 32867, 13079, 8777, 6211, 8357, 12718, 17280,
+    28776, 0, 9965, 13027, 11821, 17159, 0, 12707, 13088, 28684, 8901, 9863, 28689, 0, 10260, 28800,
+    12931, 0, 0, 12311, 12823, 9982, 10495, 12623, 11638, 12704, 13087, 6149, 17211, 0, 5658, 0,
+    11103, 0, 17275, 13099, 12695, 10514, 28695, 17388, 12456, 0, 28761, 9964, 28754, 12864, 0, 0,
+    9982, 32931, 0, 9254, 28762, 28788, 28740, 12704, 17289, 12587, 11311, 28759, 17228, 0, 11057, 12504,
+    6350, 17008, 10161, 13086, 0, 12489, 0, 12444, 0, 12896, 28729, 17247, 32906, 10860, 10010, 28808,
+    0, 9076, 17079, 12944, 0, 28759, 12671, 0, 5490, 16924, 28764, 0, 0, 28810, 28710, 6177,
+    12933, 32776, 9982, 10842, 11684, 12888, 10751, 9022, 0, 11349, 9385, 9742, 28759, 17211, 28703, 12528,
+    0, 28708, 12814, 0, 8479, 10161, 16992, 12888, 6432, 9085, 28731, 16922, 32880, 12943, 12576, 11357,
+    0, 12576, 9981, 10797, 12943, 28754, 28701, 12501, 32892, 6321, 0, 12452, 16983, 0, 13115, 0,
+    12492, 12923, 28766, 16936, 12743, 11729, 11610, 12683, 12611, 6049, 0, 12944, 17151, 13076, 12871, 8769,
+    9676, 0, 12768, 11411, 0, 28747, 32911, 28747, 17061, 5673, 12573, 12800, 12874, 12839, 32905, 28799,
+    12750, 11926, 12814, 5674, 0, 17003, 0, 0, 28751, 11655, 5665, 32892, 10083, 9376, 32845, 10570,
+    12521, 17169, 12935, 12576, 16753, 16700, 11103, 0, 0, 10869, 11104, 32933, 32893, 28810, 9975, 32882,
+    28750, 0, 6150, 16413, 0, 32904, 0, 11141, 12931, 10278, 11050, 0, 0, 12463, 17070, 28794,
+    11312, 12811, 0, 11412, 5629, 17211, 12623, 16935, 28806, 6151, 12763, 0, 0, 0, 32817, 0,
+    8575, 11311, 0, 17132, 8656, 11357, 10805, 11096, 28701, 0, 0, 11103, 16763, 11394, 17132, 10280,
+    0, 0, 32885, 10136, 9964, 0, 16933, 11450, 13051, 0, 5666, 13123, 12802, 10173, 11440, 10760,
+    0, 9088, 4885, 6225, 17298, 9301, 0, 12900, 5662, 8777, 11894, 32884, 0, 11480, 12898, 28803,
+    0, 13099, 0, 12612, 9869, 11095, 12909, 5665, 11647, 12957, 9889, 0, 8702, 11972, 12922, 17141,
+    0, 13027, 17090, 13115, 11357, 0, 12419, 11894, 9984, 11686, 28755, 6433, 10162, 28771, 12430, 13136,
+    12912, 0, 6433, 17010, 0, 32893, 0, 13136, 13125, 10860, 16542, 12408, 12943, 12719, 32845, 9546,
+    17004, 0, 13125, 10461, 12984, 10759, 13102, 13016, 10271, 0, 16765, 12790, 5629, 9986, 13051, 13032,
+    0, 13028, 0, 32893, 5410, 10844, 9263, 0, 10199, 13066, 17159, 4933, 12802, 6216, 13114, 6058,
+    17227, 17071, 10814, 12528, 11610, 11050, 11468, 5673, 8966, 17253, 12898, 9607, 13063, 17227, 6364, 32870,
+    13223, 13005, 0, 16992, 0, 9087, 28750, 12671, 0, 12874, 12754, 0, 32936, 28795, 28764, 12814,
+    10515, 0, 0, 0, 11390, 28808, 11701, 10559, 8723, 12335, 0, 11926, 12995, 13031, 12909, 12766,
+    9388, 0, 0, 8788, 28750, 10507, 28800, 17004, 0, 12920, 32868, 10805, 12705, 12588, 28713, 13051,
+    10460, 0, 16933, 0, 16447, 17140, 28732, 12504, 16762, 6408, 6188, 20487, 0, 10498, 12803, 0,
+    12780, 32905, 12900, 12755, 12994, 8490, 17014, 0, 11780, 17149, 28731, 11844, 28780, 12838, 12932, 0,
+    13020, 11058, 13063, 0, 13155, 17237, 32872, 9619, 11394, 11143, 12932, 6391, 0, 9985, 12812, 13019,
+    0, 12815, 12672, 0, 10376, 17012, 13030, 28732, 28751, 5666, 12983, 6188, 32905, 17228, 12801, 12671,
+    12780, 17062, 32857, 13063, 5673, 13040, 12455, 11602, 10861, 10506, 28777, 16858, 12791, 11611, 0, 13075,
+    0, 0, 0, 13018, 12803, 32820, 0, 12647, 32907, 13063, 32932, 11607, 12922, 12898, 6233, 13063,
+    32871, 0, 0, 16935, 0, 0, 0, 0, 11152, 32931, 13207, 0, 13075, 10461, 0, 12813,
+    28787, 12791, 11865, 28774, 0, 12825, 17002, 6327, 12552, 0, 11711, 0, 17070, 16571, 0, 12908,
+    9964, 16700, 11865, 0, 28809, 0, 12923, 13137, 13052, 0, 0, 0, 0, 0, 0, 13062,
+    28792, 11778, 11866, 10760, 9918, 0, 13091, 28695, 17080, 0, 17094, 0, 32908, 0, 12944, 13140,
+    32845, 0, 13174, 12716, 0, 17169, 16421, 13158, 0, 28826, 13147, 0, 13002, 10869, 11894, 10208,
+    12838, 10271, 13104, 11402, 28823, 0, 32906, 0, 13043, 10452, 11868, 0, 17170, 16992, 32895, 6233,
+    11402, 16413, 9986, 28729, 13148, 12959, 17297, 10254, 28776, 6188, 0, 6392, 0, 12931, 6188, 28793,
+    0, 28822, 12719, 11395, 28691, 32869, 28752, 0, 0, 0, 0, 28772, 0, 16933, 32936, 0,
+    12357, 0, 12874, 12768, 16855, 11711, 12440, 16533, 17282, 32894, 0, 0, 28773, 32895, 17004, 12851,
+    28786, 10760, 28795, 0, 10272, 10577, 13074, 10714, 28774, 13195, 16430, 17169, 13064, 17150, 12011, 32894,
+    28819, 28790, 12911, 10869, 28769, 28750, 28754, 17150, 17159, 32882, 0, 0, 12672, 13126, 13008, 12933,
+    10814, 12612, 0, 12923, 0, 12824, 11694, 9089, 12516, 16879, 9676, 12706, 17062, 12888, 32870, 17150,
+    13008, 16605, 12429, 0, 12696, 16609, 6059, 12933, 11467, 13019, 13051, 12684, 11895, 17229, 28755, 10515,
+    0, 32883, 0, 0, 9068, 12420, 16808, 13051, 0, 16965, 10869, 12911, 0, 0, 0, 10570,
+    12636, 16913, 0, 13006, 28732, 28777, 32919, 28788, 16674, 12588, 28753, 12814, 28805, 13147, 11693, 32846,
+    16937, 32845, 12921, 12756, 28776, 12450, 0, 11895, 10554, 13116, 6225, 28770, 0, 10561, 11895, 9019,
+    12802, 10065, 12744, 32882, 16649, 17240, 0, 12912, 13167, 12033, 0, 0, 11059, 9983, 32880, 32869,
+    12684, 11443, 28808, 12970, 0, 0, 17289, 11168, 17141, 10208, 28680, 12923, 17081, 12477, 28753, 32846,
+    28772, 10879, 0, 5666, 11113, 10263, 17081, 12683, 11702, 11611, 13042, 28809, 17307, 12900, 28808, 17070,
+    17248, 10517, 9610, 13102, 12298, 12911, 13151, 12852, 10255, 9386, 12983, 17160, 6180, 32906, 17081, 13044,
+    12717, 6401, 9676, 10815, 20489, 0, 11477, 0, 0, 11871, 32858, 11105, 13155, 0, 11168, 32935,
+    11749, 8960, 0, 17228, 11168, 12612, 11451, 11739, 32817, 0, 11113, 17015, 0, 0, 11169, 12826,
+    0, 10461, 12647, 17013, 0, 16935, 11977, 13018, 9684, 16923, 0, 0, 5099, 20487, 0, 32906,
+    9387, 0, 9813, 9940, 12876, 17170, 11114, 28789, 17298, 0, 11870, 17162, 6447, 10870, 0, 0,
+    12576, 13127, 12944, 0, 11412, 28794, 0, 12945, 6058, 16911, 11895, 32895, 0, 0, 12782, 6226,
+    12876, 17316, 13041, 17072, 16936, 11178, 17237, 28677, 8788, 11869, 11932, 12779, 12720, 17062, 12552, 28744,
+    0, 28766, 28799, 0, 0, 0, 16833, 0, 17317, 0, 12432, 12719, 13029, 12924, 12783, 28684,
+    12660, 12792, 12372, 0, 11403, 0, 0, 11114, 0, 11870, 11451, 17149, 28742, 17141, 12895, 11767,
+    11404, 10861, 17228, 12932, 13008, 17071, 32820, 6225, 28788, 11312, 5674, 0, 32779, 6357, 0, 0,
+    12718, 9356, 0, 32896, 32805, 4784, 11412, 8467, 11059, 17220, 11468, 12934, 32872, 17284, 11412, 0,
+    0, 16904, 32872, 13150, 11412, 0, 11403, 12827, 28786, 28800, 0, 12540, 28714, 0, 12933, 13112,
+    17290, 11169, 10572, 10515, 0, 12922, 10570, 0, 28801, 28789, 28779, 28756, 12876, 16920, 10217, 10806,
+    11992, 12803, 11740, 13139, 10853, 11740, 0, 0, 28810, 12454, 13075, 11451, 28732, 0, 0, 0,
+    12816, 17141, 0, 28793, 17174, 13139, 12033, 13052, 13197, 13031, 9892, 16846, 32933, 13186, 17316, 32871,
+    6364, 12874, 13052, 16936, 12720, 28802, 17316, 0, 12923, 11946, 0, 13161, 0, 0, 12967, 17061,
+    13114, 6365, 0, 10516, 13147, 12684, 11711, 13053, 0, 11059, 17080, 11777, 17220, 0, 0, 6189,
+    28828, 6464, 0, 13006, 8998, 28759, 11403, 6409, 32918, 28732, 0, 16936, 32897, 11656, 13090, 28715,
+    0, 6410, 17082, 32816, 28809, 12982, 13151, 16650, 32932, 12720, 17013, 0, 10153, 13171, 12779, 12852,
+    10315, 12813, 12945, 32793, 13194, 32918, 5674, 16814, 12932, 12906, 9089, 12978, 10507, 32905, 28773, 28789,
+    12780, 10580, 28809, 12970, 11713, 13151, 12705, 32883, 11152, 11647, 13194, 13168, 17091, 11459, 6189, 28812,
+    16529, 6465, 6365, 12682, 0, 8282, 32881, 0, 12528, 13064, 0, 13064, 8910, 12744, 12827, 32920,
+    28704, 0, 5878, 12693, 0, 13104, 12800, 0, 12804, 28785, 12922, 28767, 28723, 0, 0, 10853,
+    0, 0, 12684, 12801, 8312, 11992, 0, 10273, 6447, 0, 17069, 17161, 11982, 10862, 0, 0,
+    5830, 0, 6233, 28770, 12755, 12814, 6398, 11872, 12648, 12720, 32907, 32935, 9975, 13052, 8789, 11480,
+    16587, 13222, 11413, 28679, 11114, 12515, 17241, 0, 12527, 13030, 28809, 16618, 12321, 28788, 16700, 11169,
+    12912, 17014, 12731, 6189, 0, 0, 10879, 11702, 0, 12755, 12898, 13114, 9926, 0, 0, 0,
+    12034, 0, 9890, 12479, 12863, 0, 13008, 28798, 17306, 6059, 28787, 0, 0, 9619, 17016, 9975,
+    0, 32924, 0, 28773, 10880, 12839, 13159, 12079, 8722, 12970, 12825, 28673, 32832, 16516, 10283, 28755,
+    10274, 28741, 0, 28760, 11992, 17307, 0, 28786, 4853, 5878, 0, 11937, 10517, 0, 0, 17092,
+    12660, 28679, 13221, 11152, 12010, 32859, 12804, 0, 28773, 12356, 10358, 9666, 28736, 12647, 28812, 8643,
+    4851, 11766, 13040, 32805, 9251, 28741, 12756, 10272, 4811, 17298, 28803, 0, 12888, 12816, 10581, 16657,
+    12622, 11404, 12540, 9607, 11757, 0, 6402, 11451, 28802, 0, 12528, 16597, 8945, 16813, 13128, 0,
+    13042, 12935, 32897, 16937, 12312, 28828, 16676, 16699, 11909, 0, 28758, 12648, 13151, 32918, 10562, 0,
+    0, 9909, 11151, 8307, 12792, 28703, 17015, 0, 11909, 0, 32871, 28797, 28704, 0, 17319, 28798,
+    9983, 10797, 12034, 13151, 17170, 28742, 10517, 0, 12393, 13115, 12648, 28809, 10870, 12623, 13128, 0,
+    16878, 12792, 0, 11477, 28812, 28702, 0, 12815, 12552, 28734, 28783, 0, 32817, 28811, 0, 9383,
+    13188, 4435, 10750, 17228, 9986, 0, 32907, 32931, 11413, 12474, 28762, 11468, 9971, 0, 9563, 10517,
+    11758, 13159, 28735, 28691, 0, 0, 12660, 16571, 12321, 0, 28810, 13077, 28704, 11776, 16420, 0,
+    0, 11702, 0, 11656, 16492, 10879, 10218, 17230, 17013, 0, 0, 0, 12554, 6448, 8606, 12960,
+    6234, 16737, 8281, 32840, 13168, 0, 12716, 0, 32897, 0, 11776, 0, 4405, 4885, 8667, 12576,
+    17252, 28779, 12621, 16846, 28814, 12034, 0, 0, 0, 13064, 0, 9180, 28824, 9918, 11178, 16904,
+    28705, 32846, 28809, 12513, 10584, 17250, 9986, 10862, 28711, 9255, 0, 13064, 10571, 12394, 17317, 11460,
+    13065, 9478, 9984, 8491, 9538, 0, 32917, 11711, 28780, 0, 12984, 32859, 0, 10285, 28685, 17316,
+    9807, 17308, 12561, 12844, 13126, 20489, 0, 12816, 8606, 20482, 28767, 11170, 0, 12863, 12632, 13159,
+    12012, 17397, 6410, 11412, 28726, 9516, 28781, 10554, 0, 0, 9986, 0, 0, 11954, 0, 28800,
+    28817, 12707, 28797, 0, 8653, 28778, 20485, 0, 13030, 12816, 32918, 13053, 13065, 11161, 10816, 16667,
+    8319, 12864, 13167, 12623, 0, 12720, 0, 16447, 0, 12533, 10322, 0, 13159, 28725, 0, 0,
+    13007, 16841, 12959, 13172, 16499, 4662, 16675, 20484, 28790, 0, 12395, 32911, 17016, 6464, 10216, 32780,
+    0, 12516, 13160, 0, 0, 0, 32841, 17014, 0, 13195, 32910, 17171, 12558, 10583, 0, 16922,
+    32792, 32908, 4409, 11946, 16936, 8941, 10284, 8688, 12935, 13041, 0, 12665, 11712, 28764, 9956, 13171,
+    12971, 9479, 0, 9986, 0, 8272, 10563, 12344, 13138, 12708, 12323, 16516, 12611, 32831, 0, 0,
+    0, 12737, 10972, 9985, 28702, 28737, 12009, 13020, 0, 12624, 28775, 12531, 0, 10581, 0, 32885,
+    32818, 28812, 0, 0, 17158, 12803, 10516, 0, 11939, 12074, 28675, 12310, 32828, 32897, 8606, 9452,
+    28727, 0, 0, 13115, 12492, 13008, 0, 12372, 13104, 12816, 32817, 0, 4910, 16420, 0, 0,
+    0, 12582, 17172, 13040, 32829, 13188, 0, 10880, 11946, 11909, 10870, 13140, 20488, 9766, 5391, 0,
+    12533, 11459, 12368, 11480, 13116, 9216, 12588, 17083, 17327, 0, 0, 17013, 10870, 0, 32921, 16500,
+    8489, 10871, 13026, 17307, 32924, 0, 0, 12300, 0, 10584, 12756, 16935, 28716, 32841, 13139, 0,
+    12600, 20488, 8490, 28727, 12675, 12840, 11758, 12357, 0, 0, 12923, 13090, 10573, 6410, 9687, 10583,
+    4409, 0, 8443, 4572, 28822, 12001, 16842, 8344, 0, 28689, 11992, 28677, 8882, 16700, 10573, 9479,
+    32937, 16588, 17240, 28767, 11478, 0, 11702, 4605, 16763, 13002, 12924, 32911, 0, 12660, 32906, 9061,
+    0, 12676, 12039, 13139, 11993, 0, 8319, 11196, 0, 28768, 16685, 0, 17251, 32830, 8790, 10218,
+    32818, 28821, 9863, 32898, 32896, 0, 16675, 16751, 0, 0, 6044, 17308, 8606, 17299, 12511, 0,
+    11481, 12696, 0, 10816, 0, 9290, 0, 9452, 16528, 32780, 13056, 10571, 0, 12750, 11180, 0,
+    11169, 0, 10563, 11478, 0, 11170, 0, 12882, 0, 12779, 32817, 28739, 0, 12381, 6448, 12624,
+    13020, 12382, 28756, 9216, 11477, 0, 12516, 32905, 12570, 17172, 17307, 0, 13044, 0, 28738, 17015,
+    13150, 12868, 28732, 9247, 6456, 28747, 0, 8583, 0, 12533, 12572, 28685, 13064, 32910, 12534, 28736,
+    28747, 32909, 12454, 12612, 4447, 0, 0, 12857, 12406, 13207, 0, 0, 12676, 0, 0, 0,
+    12499, 32792, 16438, 0, 12804, 17359, 32841, 11477, 32830, 12677, 8408, 6145, 0, 13089, 8999, 11469,
+    28813, 12558, 32829, 5728, 16526, 32830, 0, 11460, 11478, 9253, 12405, 28715, 0, 12604, 12897, 8911,
+    11750, 11954, 13029, 32884, 16448, 16447, 8284, 17318, 17354, 17308, 28813, 0, 11179, 0, 6465, 9879,
+    13173, 16737, 13076, 32842, 16517, 0, 0, 0, 28688, 28736, 11758, 12674, 13223, 9986, 17368, 11955,
+    0, 0, 12677, 6226, 11179, 12381, 8988, 20482, 13218, 13162, 8708, 11757, 16665, 8962, 10626, 12900,
+    9685, 9204, 17171, 12371, 17299, 28820, 10488, 10415, 12359, 0, 16744, 12510, 0, 13055, 11759, 6234,
+    6465, 20486, 9663, 28822, 17327, 4609, 10584, 0, 6235, 13028, 0, 8419, 13174, 13067, 32833, 0,
+    8313, 10582, 12948, 17250, 0, 28803, 13031, 11208, 16806, 32924, 28821, 12717, 28755, 0, 28691, 10135,
+    12648, 4451, 8912, 12717, 17015, 13185, 13039, 12057, 0, 28756, 8619, 0, 11470, 12464, 10881, 12912,
+    28808, 0, 16450, 13032, 28822, 12695, 28728, 12308, 28745, 13184, 10255, 32910, 16430, 12075, 28814, 28761,
+    9452, 12467, 28691, 0, 28721, 12825, 12887, 10270, 0, 16687, 13210, 0, 20487, 32869, 12546, 0,
+    11479, 12358, 12582, 28822, 12834, 12415, 11469, 13051, 28746, 11947, 17249, 12001, 28756, 32828, 13076, 0,
+    28809, 12773, 12768, 11207, 12976, 32842, 8717, 0, 28682, 4826, 9474, 28745, 0, 10870, 0, 28736,
+    16500, 12431, 28722, 28822, 13207, 4673, 12492, 0, 32806, 9279, 0, 13092, 11496, 17251, 32922, 12677,
+    16438, 16598, 6234, 28716, 28818, 28819, 12988, 10217, 17090, 12370, 12514, 12370, 4862, 17241, 9000, 17320,
+    11954, 17093, 12876, 0, 20484, 28810, 12383, 0, 0, 28722, 12642, 0, 4447, 0, 0, 16745,
+    6466, 12041, 11180, 12405, 9918, 12833, 10353, 9845, 9008, 28822, 0, 28748, 12828, 13196, 0, 32815,
+    12347, 12738, 0, 12479, 13091, 32780, 10581, 5207, 0, 32894, 17377, 28803, 0, 0, 13183, 9876,
+    6466, 13162, 12888, 0, 0, 13207, 8718, 32842, 20485, 12476, 32819, 8403, 9261, 0, 20484, 9474,
+    17317, 12001, 32843, 0, 32846, 12534, 6365, 0, 8612, 16463, 5302, 8745, 12417, 12065, 13162, 0,
+    11170, 16658, 17368, 16869, 28811, 0, 12654, 8883, 0, 12996, 13175, 32841, 32820, 9515, 12936, 16517,
+    0, 13164, 32841, 12773, 9287, 0, 0, 28717, 0, 0, 17361, 10881, 32807, 5766, 8396, 28692,
+    9749, 0, 9352, 13160, 13128, 12489, 6411, 16872, 28809, 0, 12620, 0, 32818, 11451, 12738, 10327,
+    0, 8882, 10584, 0, 0, 11993, 16529, 17174, 0, 12979, 16687, 0, 12779, 0, 32794, 10883,
+    32898, 12751, 28766, 8350, 16737, 16460, 28768, 28762, 28768, 17409, 0, 0, 0, 0, 0, 0,
+    10282, 16665, 13195, 8948, 0, 12526, 12394, 28727, 13151, 28707, 11910, 0, 13152, 16619, 17318, 20484,
+    12074, 0, 12571, 28746, 8278, 10617, 8718, 0, 13184, 4884, 13184, 6466, 12880, 0, 28791, 9604,
+    13184, 9503, 12466, 0, 0, 20481, 0, 32819, 4443, 0, 12750, 12688, 0, 0, 10094, 28699,
+    12427, 0, 16746, 9210, 0, 8657, 8948, 0, 11182, 8396, 13146, 28729, 12551, 12676, 9540, 0,
+    0, 28822, 16658, 12000, 9558, 9474, 8396, 10936, 9798, 32830, 0, 12594, 0, 17328, 9595, 10582,
+    9247, 16509, 4928, 13044, 12501, 13174, 16587, 9181, 9769, 11480, 17378, 12049, 0, 0, 0, 28711,
+    12492, 0, 11955, 0, 16508, 11779, 16579, 12299, 16526, 28732, 12750, 9316, 6058, 5037, 16518, 8650,
+    10584, 10920, 16677, 0, 0, 28692, 20484, 12858, 16764, 12381, 0, 8911, 13212, 32831, 9540, 12582,
+    12524, 17317, 8357, 32794, 0, 0, 9481, 9357, 28681, 0, 0, 0, 17328, 9813, 0, 9299,
+    12334, 0, 12780, 28700, 0, 11767, 28700, 13218, 12584, 8649, 13196, 13164, 0, 13195, 0, 12784,
+    13164, 6074, 0, 6411, 8718, 16440, 0, 5862, 0, 10506, 10130, 10153, 16430, 11767, 16518, 0,
+    12655, 0, 0, 13077, 0, 28746, 28692, 16756, 13152, 0, 0, 13162, 5026, 0, 0, 10327,
+    13152, 32781, 13219, 5036, 0, 32793, 0, 10584, 0, 12011, 0, 8942, 28729, 28724, 0, 12881,
+    13104, 10097, 32923, 8396, 8313, 0, 12899, 0, 28744, 16687, 4694, 16608, 28749, 0, 11171, 16587,
+    32911, 17328, 0, 8765, 28808, 12312, 5017, 6466, 0, 16448, 0, 12065, 17376, 5020, 4928, 12880,
+    12677, 17139, 0, 0, 12561, 12654, 12750, 4868, 0, 4452, 20484, 32919, 6465, 16914, 16540, 10872,
+    0, 9503, 28730, 9043, 8365, 12499, 17013, 13176, 11181, 9849, 9540, 0, 12488, 0, 11759, 13091,
+    16745, 28760, 32805, 4927, 0, 12666, 12739, 12407, 32807, 8743, 12610, 0, 16675, 0, 9287, 0,
+    28750, 12834, 8695, 12708, 9509, 28729, 9800, 13172, 8357, 0, 16519, 0, 32845, 12786, 9261, 32843,
+    16430, 8619, 28723, 12667, 0, 8612, 28768, 9596, 11224, 12858, 16518, 13068, 12960, 13172, 0, 16588,
+    12696, 12076, 32871, 12559, 32819, 28789, 28820, 9971, 28768, 16688, 9248, 13140, 32844, 0, 28754, 10253,
+    4866, 9586, 28724, 12690, 8285, 12693, 9614, 11480, 13184, 12393, 0, 0, 0, 32818, 32778, 0,
+    0, 28682, 12324, 16685, 12773, 12066, 12549, 0, 9211, 8359, 12584, 16597, 0, 32791, 13196, 0,
+    10583, 0, 28757, 0, 13161, 11777, 0, 4944, 0, 28821, 12077, 13044, 17249, 28683, 12514, 11768,
+    9852, 16528, 0, 17332, 0, 10283, 17317, 0, 20490, 12762, 13174, 32859, 11505, 10074, 0, 28818,
+    16937, 13149, 9838, 17377, 13208, 5252, 0, 9343, 8403, 13007, 9620, 12610, 17368, 28678, 28730, 8366,
+    20489, 28677, 12076, 0, 6457, 12298, 8719, 0, 13175, 12049, 0, 11956, 16439, 9984, 0, 5318,
+    16607, 12572, 28817, 16519, 4629, 16449, 28724, 0, 16886, 12524, 13210, 17250, 12058, 32800, 16789, 8322,
+    13175, 0, 12691, 28759, 28687, 16772, 11758, 12989, 9986, 32908, 16516, 12332, 28822, 0, 11348, 0,
+    8321, 10882, 10657, 28747, 12299, 11479, 12515, 0, 16449, 13175, 12881, 0, 17375, 12308, 0, 16449,
+    32820, 12076, 10419, 28705, 0, 32923, 12001, 11956, 9614, 28692, 13164, 8710, 9316, 12834, 28714, 9642,
+    10342, 9253, 10392, 12443, 0, 16677, 28813, 12526, 12049, 28759, 32820, 12740, 12792, 0, 12479, 16685,
+    32909, 9349, 12057, 16774, 0, 8920, 13196, 13152, 0, 12300, 8396, 12452, 12859, 16588, 0, 0,
+    8745, 9646, 0, 0, 16766, 16765, 16609, 17395, 13080, 28685, 0, 11228, 28780, 0, 28688, 16539,
+    12475, 4685, 0, 12846, 0, 12669, 12548, 8657, 0, 16676, 9815, 16951, 32832, 0, 0, 0,
+    16910, 13188, 12989, 8757, 8420, 28723, 12076, 9355, 16823, 5033, 28721, 28741, 13176, 16616, 0, 28719,
+    16774, 12740, 12418, 0, 4625, 13125, 10138, 0, 17398, 0, 0, 16597, 12066, 10639, 13040, 12906,
+    11777, 12523, 8751, 8920, 8411, 9773, 16461, 8919, 11470, 0, 0, 13029, 12598, 28693, 0, 8964,
+    28747, 11947, 8964, 12583, 8403, 5955, 28676, 28811, 9593, 9853, 12395, 9064, 9019, 0, 12678, 12419,
+    8757, 4468, 12834, 12348, 0, 4949, 17369, 8774, 13017, 16450, 8322, 13056, 28730, 0, 12066, 10387,
+    13175, 32790, 8949, 0, 28719, 28695, 11956, 12322, 16685, 32819, 0, 16700, 11956, 12667, 28822, 13139,
+    13199, 13209, 5325, 0, 12538, 16511, 9018, 0, 8704, 16766, 12323, 12419, 16439, 10236, 10099, 16953,
+    12360, 12847, 12689, 13013, 28817, 10095, 32818, 16823, 9044, 9615, 17070, 16617, 0, 8613, 28828, 8322,
+    5070, 8665, 17328, 0, 32779, 20484, 0, 16835, 9217, 13196, 28703, 17406, 11993, 0, 13173, 12076,
+    12564, 12431, 9808, 0, 12536, 11105, 10197, 0, 0, 28768, 0, 0, 13001, 12407, 16529, 0,
+    5534, 0, 8476, 4940, 12011, 32793, 0, 12595, 28745, 0, 28821, 10136, 9852, 8412, 11239, 13134,
+    4721, 0, 12774, 32781, 10070, 32922, 12058, 5771, 16686, 28760, 12078, 28817, 0, 12632, 0, 28818,
+    0, 0, 0, 17241, 8390, 28746, 9647, 9182, 32820, 0, 12444, 28713, 8995, 28745, 28691, 28828,
+    11955, 12763, 28773, 0, 12972, 32844, 20485, 28691, 12058, 0, 13174, 9363, 12894, 17377, 0, 16519,
+    16430, 13220, 28778, 5399, 9682, 16697, 12785, 12999, 16698, 28678, 12417, 16609, 0, 5042, 11058, 0,
+    16892, 16959, 12396, 0, 10100, 12632, 12527, 0, 0, 12010, 0, 4630, 5325, 0, 9380, 0,
+    32842, 8965, 0, 12932, 8351, 9898, 8583, 28706, 9294, 4977, 0, 8720, 12562, 9780, 9263, 0,
+    12848, 16824, 12396, 13128, 6257, 12979, 0, 9218, 13000, 10337, 9363, 28749, 0, 0, 13128, 10137,
+    9010, 0, 5048, 0, 13186, 9002, 32793, 12335, 16616, 5550, 28782, 28750, 28714, 16698, 9248, 10696,
+    12708, 10966, 28707, 10050, 0, 10050, 9861, 12656, 16529, 28712, 13055, 0, 16833, 8747, 0, 28729,
+    13185, 0, 12324, 12791, 0, 32924, 12777, 28769, 0, 28736, 28726, 12488, 13140, 12696, 0, 16541,
+    0, 28769, 11458, 9898, 13080, 0, 0, 28717, 28758, 9615, 28678, 17386, 13209, 0, 12536, 0,
+    16756, 8711, 12978, 10476, 13149, 9670, 0, 9906, 12656, 11240, 32833, 28695, 12893, 0, 0, 9050,
+    10360, 13115, 12923, 28745, 12574, 12408, 28716, 12681, 12012, 12707, 12643, 16842, 28682, 28678, 5536, 8405,
+    12682, 12690, 16677, 5362, 12396, 12766, 0, 10100, 12573, 10100, 12550, 10584, 17329, 0, 12691, 16443,
+    28821, 0, 0, 28792, 6260, 28695, 9211, 5829, 4948, 12067, 12384, 0, 12408, 28748, 11246, 10371,
+    28748, 12538, 12441, 17114, 16824, 12682, 16824, 9563, 0, 28770, 6100, 10506, 12561, 0, 0, 16900,
+    9907, 10483, 32807, 5888, 9294, 28772, 16754, 0, 0, 0, 12452, 10995, 9642, 12607, 32844, 9011,
+    12384, 0, 9659, 0, 28769, 12729, 32898, 13126, 0, 0, 4722, 0, 9809, 28722, 0, 0,
+    5873, 28715, 0, 12989, 8665, 17036, 12394, 0, 12514, 8421, 28690, 0, 12752, 0, 12455, 28794,
+    5334, 9517, 12683, 9897, 13002, 8485, 9648, 12615, 0, 32844, 28717, 28785, 8758, 5828, 13176, 0,
+    9547, 0, 10365, 12978, 12778, 12430, 0, 12885, 12575, 0, 16801, 12076, 9642, 17385, 10169, 11238,
+    13152, 9301, 16766, 13001, 16677, 12765, 9592, 9885, 16618, 8412, 9560, 32794, 8766, 28704, 17329, 0,
+    13162, 12645, 16918, 0, 0, 5340, 12702, 5812, 0, 8875, 16834, 28729, 8711, 0, 0, 4633,
+    8658, 32807, 6260, 32852, 9601, 12550, 12049, 28751, 0, 11246, 32846, 11170, 8758, 28696, 0, 9255,
+    8751, 9564, 16618, 0, 12813, 17369, 12323, 32833, 11013, 0, 28757, 16619, 28821, 11266, 10483, 28822,
+    20485, 0, 16993, 0, 12955, 0, 4977, 17387, 12573, 9044, 0, 13171, 11514, 10697, 12670, 0,
+    32924, 8711, 0, 16765, 16538, 8605, 12779, 10697, 9647, 12775, 17116, 0, 0, 32841, 13128, 0,
+    13014, 28704, 0, 28680, 0, 12067, 0, 5040, 32844, 16962, 0, 0, 5873, 9670, 0, 28777,
+    17406, 16909, 0, 9971, 28811, 8852, 5333, 12778, 9311, 8487, 0, 32828, 13182, 13186, 12598, 32832,
+    12539, 11246, 12622, 0, 28807, 10482, 28825, 28712, 9642, 12741, 10735, 9853, 28797, 0, 9846, 12443,
+    12455, 5871, 5454, 16767, 28688, 0, 12479, 28726, 11267, 0, 12452, 28683, 0, 12715, 0, 28762,
+    0, 0, 11267, 0, 0, 28731, 16964, 28785, 8766, 0, 5070, 12299, 9363, 28773, 0, 12683,
+    17253, 9255, 12408, 17411, 9003, 28822, 12671, 9074, 8758, 12563, 0, 0, 16695, 10472, 5433, 16834,
+    0, 17115, 0, 12789, 12753, 0, 0, 8703, 9350, 12432, 12955, 17115, 16619, 28759, 32878, 16743,
+    28737, 8642, 5453, 10733, 9680, 16918, 0, 28781, 9554, 16542, 12895, 12802, 12617, 16538, 0, 0,
+    0, 10075, 0, 9309, 0, 0, 10284, 32806, 5248, 13013, 9256, 32909, 32853, 28796, 28747, 16779,
+    0, 0, 12569, 13220, 32818, 5889, 5552, 0, 12600, 28762, 12332, 28734, 0, 9598, 11034, 9915,
+    17251, 28816, 0, 9985, 17328, 9974, 0, 11268, 28692, 28738, 0, 9913, 10967, 16774, 4425, 5361,
+    9050, 12079, 17320, 16920, 12501, 12920, 16765, 0, 0, 5361, 28819, 12691, 0, 8468, 6411, 9349,
+    0, 12777, 28738, 8469, 6268, 9065, 0, 28727, 12490, 13223, 16460, 10112, 11530, 0, 0, 0,
+    12068, 8767, 10998, 9816, 9816, 13014, 28708, 16920, 0, 16887, 0, 0, 12679, 16539, 16491, 9609,
+    32819, 12501, 8421, 12408, 28733, 12610, 28681, 0, 8745, 0, 16508, 0, 0, 16451, 16696, 12528,
+    16913, 12442, 0, 28722, 32832, 5454, 4356, 0, 9671, 0, 5332, 11333, 13052, 28785, 0, 0,
+    32844, 12618, 10699, 32924, 28823, 12514, 12848, 28693, 13207, 28683, 9610, 0, 28770, 16834, 10400, 9355,
+    9607, 28817, 8422, 0, 10110, 16963, 12886, 16910, 12800, 12787, 32832, 28700, 9318, 28680, 28762, 12300,
+    12492, 28822, 12610, 0, 0, 12618, 8413, 0, 5067, 9600, 0, 10142, 10498, 12538, 0, 10699,
+    10142, 32804, 8599, 5455, 9846, 28708, 28717, 12700, 8322, 28824, 0, 28729, 12384, 28734, 0, 12681,
+    28702, 6092, 0, 28749, 12456, 5885, 28678, 16697, 0, 0, 11374, 11757, 11632, 10141, 12420, 0,
+    28752, 8941, 16991, 17195, 0, 13221, 0, 5977, 20486, 12647, 0, 12837, 12502, 12430, 11379, 16767,
+    17326, 28736, 0, 0, 10240, 13013, 12823, 28820, 9681, 32830, 28816, 12741, 17386, 0, 0, 0,
+    13064, 17117, 9012, 12489, 0, 10143, 17117, 0, 32776, 10736, 12600, 12384, 28784, 12066, 10736, 0,
+    8874, 16540, 12623, 0, 12670, 28820, 0, 9955, 13176, 28729, 9085, 11182, 0, 12588, 28771, 0,
+    8476, 12794, 12610, 17117, 32807, 11805, 0, 16970, 0, 0, 16778, 0, 32935, 12359, 28824, 28762,
+    9051, 16609, 28783, 0, 0, 9066, 17013, 12695, 12406, 12823, 10736, 32794, 28787, 28821, 9962, 9318,
+    10108, 9318, 12540, 5099, 9084, 28738, 16756, 12702, 0, 13188, 12873, 0, 8604, 0, 32807, 6111,
+    28793, 0, 0, 10736, 0, 12619, 12065, 9681, 0, 0, 9021, 5444, 32937, 0, 32862, 5987,
+    16965, 12695, 12635, 28758, 10205, 11595, 12903, 0, 11678, 8414, 16461, 16922, 13223, 17407, 0, 28715,
+    13200, 12324, 28762, 9563, 16910, 0, 8667, 9649, 32864, 10405, 0, 0, 0, 0, 0, 8965,
+    12632, 12078, 12702, 32853, 5584, 10702, 0, 28738, 12955, 10238, 16777, 8368, 28762, 17052, 0, 16776,
+    32853, 9846, 13109, 12548, 10861, 10451, 13120, 16902, 5830, 9619, 10675, 0, 12895, 28809, 17015, 0,
+    12729, 12504, 32878, 16931, 11355, 0, 17229, 8760, 32896, 0, 16449, 13007, 12564, 32892, 0, 5649,
+    16462, 12492, 13221, 12619, 10405, 0, 0, 13220, 12693, 28751, 9971, 12798, 32819, 8767, 12873, 17015,
+    0, 0, 28821, 0, 32863, 0, 11565, 11035, 8641, 16621, 0, 12632, 12887, 0, 9961, 12754,
+    28701, 0, 32844, 28720, 16920, 12791, 11079, 5573, 0, 28787, 12584, 0, 13014, 10195, 0, 9067,
+    12873, 12708, 8453, 12883, 0, 9861, 4982, 12906, 10188, 6292, 12552, 28822, 9365, 0, 8478, 32883,
+    9609, 9892, 12468, 0, 10971, 0, 12798, 0, 28781, 12909, 0, 9954, 16767, 28757, 0, 12874,
+    0, 11012, 12408, 0, 12896, 32831, 17060, 16920, 17170, 12971, 12955, 0, 9350, 0, 16972, 9665,
+    17196, 9620, 28713, 12849, 9963, 28731, 12897, 13006, 12512, 11114, 13223, 12479, 28745, 0, 12814, 0,
+    8394, 11566, 4726, 10151, 9892, 0, 0, 17083, 28763, 12712, 0, 11377, 28786, 13099, 28738, 8322,
+    12000, 28727, 10078, 0, 12491, 12608, 10782, 17407, 13007, 12419, 17397, 10407, 16778, 10201, 5900, 10975,
+    10143, 12752, 32909, 13132, 17049, 0, 10375, 32830, 12695, 8461, 9970, 12803, 11539, 12704, 0, 12608,
+    9518, 12611, 0, 12863, 13068, 12526, 17388, 0, 32861, 0, 0, 32832, 6272, 12610, 10197, 16902,
+    0, 8468, 0, 12633, 0, 0, 28772, 12586, 12443, 13176, 12715, 0, 0, 0, 5921, 8414,
+    12552, 28757, 28799, 0, 28796, 10189, 12995, 13097, 9907, 16902, 28747, 9900, 13131, 11274, 10779, 28809,
+    12645, 28731, 28691, 0, 12396, 16518, 17117, 9021, 11821, 10975, 10158, 17387, 32854, 32924, 20485, 0,
+    11567, 12916, 12611, 0, 16775, 16779, 16824, 0, 6101, 0, 9666, 28719, 0, 12808, 4980, 9067,
+    0, 9367, 11594, 10406, 28749, 9564, 9077, 9862, 0, 10159, 10377, 4979, 12840, 0, 0, 11567,
+    0, 0, 5985, 0, 12455, 9962, 12516, 8487, 12619, 0, 16463, 16776, 28786, 11435, 12420, 9666,
+    9076, 0, 0, 10782, 0, 28704, 9862, 32846, 28789, 0, 28707, 12767, 0, 0, 0, 32918,
+    12790, 0, 32867, 9946, 12488, 12540, 8966, 17131, 0, 0, 11567, 32862, 28717, 6114, 28695, 12300,
+    17042, 28731, 12703, 9609, 0, 32863, 12492, 28760, 17408, 10149, 0, 9320, 5614, 0, 0, 11566,
+    12780, 13219, 11078, 0, 0, 0, 28759, 28715, 12778, 12788, 6014, 13007, 16991, 10673, 5910, 28740,
+    6293, 16777, 0, 12552, 13005, 12432, 12905, 17396, 12575, 0, 0, 12791, 13025, 9357, 13005, 16844,
+    0, 9676, 12742, 17319, 9086, 0, 28787, 0, 28679, 28684, 0, 6143, 28795, 13121, 12706, 10443,
+    8966, 16834, 28749, 12896, 32911, 12490, 0, 8477, 0, 13016, 12980, 12946, 12672, 28720, 11632, 10114,
+    10116, 9022, 12887, 0, 6349, 28780, 12790, 11081, 12836, 28731, 16597, 28797, 5484, 11088, 28731, 0,
+    0, 0, 28757, 4726, 0, 5984, 12623, 17274, 10488, 12348, 12895, 12780, 9817, 28825, 12906, 0,
+    5921, 13146, 12491, 16767, 11002, 12780, 12694, 0, 16779, 10159, 0, 0, 0, 12789, 28773, 6123,
+    13133, 0, 9086, 0, 28769, 28728, 12515, 12384, 12492, 10151, 28730, 0, 17226, 0, 12456, 0,
+    0, 10972, 12574, 32878, 10079, 17252, 6144, 0, 9618, 32864, 12897, 9068, 12574, 10196, 11004, 28693,
+    12919, 5113, 11304, 9900, 16930, 0, 9854, 12897, 6015, 8488, 0, 17407, 0, 12897, 0, 9357,
+    28782, 0, 12802, 10489, 0, 13224, 0, 13110, 12396, 28696, 9900, 17408, 28690, 10215, 0, 0,
+    10151, 9948, 28772, 12993, 6043, 12500, 0, 13146, 11766, 0, 12468, 28747, 12943, 0, 32781, 8405,
+    0, 0, 0, 0, 10061, 0, 9656, 9011, 10449, 12491, 0, 4933, 13133, 12742, 16439, 13022,
+    0, 10108, 28774, 9909, 12713, 12503, 16895, 8785, 5590, 17161, 12790, 12876, 0, 28802, 28730, 16440,
+    12694, 9777, 11012, 0, 6288, 0, 12431, 9219, 11000, 16856, 9863, 0, 0, 9666, 12906, 10274,
+    28798, 16779, 16895, 12694, 16779, 6145, 12648, 12822, 28749, 0, 0, 0, 11380, 0, 12916, 8787,
+    12489, 0, 12792, 28774, 28706, 13015, 12668, 8664, 0, 10789, 5105, 12896, 12612, 0, 0, 12608,
+    16778, 6173, 0, 0, 8413, 28727, 10245, 12756, 9219, 12633, 16914, 12551, 11334, 12429, 9909, 12693,
+    0, 9863, 5621, 0, 28716, 0, 10750, 12538, 12491, 28731, 32832, 9673, 0, 12906, 0, 10214,
+    6386, 13133, 13015, 12612, 12764, 0, 12886, 12499, 10485, 0, 32794, 10505, 0, 28773, 0, 12444,
+    17045, 11567, 12991, 12670, 0, 16989, 10459, 0, 28759, 5075, 12896, 32930, 9917, 0, 17000, 0,
+    0, 11356, 9386, 12516, 6144, 0, 17395, 12715, 32846, 28750, 16987, 8778, 10197, 12790, 8777, 12898,
+    11567, 10449, 0, 0, 11571, 0, 8786, 17092, 12994, 13018, 9384, 11274, 12671, 32881, 12372, 16983,
+    12612, 16913, 12585, 12981, 12549, 12575, 32841, 28759, 0, 10244, 12504, 17274, 11595, 12875, 0, 13164,
+    17274, 32854, 12791, 0, 12935, 12678, 12621, 12671, 12791, 32882, 0, 0, 17060, 17126, 10206, 10116,
+    8423, 12634, 13145, 11311, 17271, 12994, 0, 12612, 10206, 0, 11049, 10242, 12812, 32843, 32870, 9043,
+    17052, 12789, 0, 5105, 0, 0, 12753, 5461, 12480, 0, 0, 9955, 6432, 0, 28763, 0,
+    28757, 12563, 32827, 32832, 0, 16987, 12923, 32937, 5102, 10709, 12526, 5651, 5105, 17201, 5591, 12919,
+    0, 12515, 12912, 12550, 12403, 11273, 17044, 10838, 10838, 16570, 13133, 12800, 9256, 9909, 0, 28783,
+    28798, 28748, 12635, 10512, 10713, 10705, 9909, 10740, 0, 0, 0, 13031, 0, 17060, 12611, 12900,
+    13122, 8776, 28688, 12526, 0, 12824, 12719, 11356, 13152, 5103, 28692, 28784, 16904, 10750, 12608, 13086,
+    16990, 12767, 0, 5459, 12993, 12907, 12408, 10213, 10412, 12774, 13036, 12767, 0, 28823, 28759, 32794,
+    12983, 6044, 10459, 28738, 28784, 11041, 28764, 12809, 9376, 0, 10215, 12444, 10145, 11831, 9675, 28746,
+    12995, 12515, 17173, 8667, 9917, 5657, 17406, 32930, 32871, 16699, 17410, 0, 28798, 0, 0, 28792,
+    17131, 12682, 10245, 0, 10266, 12742, 11734, 32904, 10750, 9619, 12839, 9863, 0, 17127, 9917, 0,
+    12307, 9665, 16931, 12717, 6044, 5457, 12551, 11380, 11303, 9067, 11004, 0, 5367, 9067, 28741, 12612,
+    13019, 0, 6320, 5113, 0, 0, 11083, 13039, 28785, 8470, 32843, 11039, 16417, 16912, 5106, 9948,
+    0, 10191, 28786, 10553, 6386, 9972, 12622, 0, 12874, 9088, 9972, 12888, 5105, 0, 10804, 12516,
+    28801, 28792, 32867, 10881, 17139, 0, 10191, 0, 16904, 6145, 12610, 17053, 11679, 6385, 12768, 5588,
+    10838, 32891, 16845, 28762, 10449, 0, 28782, 9972, 8712, 0, 28765, 16779, 12612, 28768, 0, 17060,
+    9687, 17320, 16855, 0, 16924, 32781, 12444, 13135, 12931, 28758, 9687, 12753, 12716, 16999, 32934, 28799,
+    16936, 17095, 10214, 32898, 16846, 12370, 12623, 28729, 16914, 12861, 32924, 10743, 11049, 12837, 11167, 20486,
+    28747, 28798, 16913, 10460, 5927, 0, 10489, 28788, 17275, 10452, 13026, 10785, 13088, 32885, 11596, 10788,
+    32931, 28713, 0, 28762, 28791, 0, 10495, 13101, 9377, 0, 16997, 28726, 0, 9377, 28769, 0,
+    28732, 10191, 0, 0, 12730, 16766, 0, 11729, 0, 28772, 13145, 11304, 0, 12586, 16932, 12646,
+    17210, 6173, 0, 12576, 28747, 11709, 12527, 11180, 32923, 9686, 16856, 28785, 10786, 0, 0, 32858,
+    8768, 10503, 0, 13017, 28758, 17275, 11341, 0, 12527, 9377, 12970, 8713, 0, 12968, 10845, 0,
+    13017, 12564, 12870, 17139, 10246, 10497, 13008, 11636, 5490, 0, 0, 0, 12539, 0, 16924, 11931,
+    16925, 0, 13018, 28698, 11095, 16924, 12647, 12732, 13111, 12731, 10191, 28729, 28807, 0, 17309, 16776,
+    28750, 9919, 16924, 12528, 12635, 13063, 32845, 0, 8713, 32905, 12696, 0, 32930, 10261, 28681, 0,
+    10561, 16903, 0, 28763, 12716, 0, 0, 0, 9666, 13099, 11058, 16923, 0, 0, 12874, 4677,
+    12912, 12516, 17139, 12873, 12696, 28678, 10796, 12704, 0, 11050, 12861, 32870, 16621, 10759, 16923, 12702,
+    11435, 11638, 12684, 8760, 0, 9078, 12862, 13026, 0, 12942, 17148, 12899, 10805, 0, 9964, 10567,
+    0, 12672, 28677, 32833, 11049, 17132, 32869, 28714, 12695, 5591, 12707, 11571, 10842, 10751, 17210, 28750,
+    0, 0, 12824, 0, 13016, 0, 0, 13087, 0, 16982, 28679, 17174, 0, 9310, 0, 12693,
+    12948, 12549, 16578, 0, 12456, 12551, 28750, 12695, 12921, 12705, 10207, 11977, 13142, 0, 12815, 0,
+    0, 6387, 9982, 12504, 12800, 32879, 28757, 9068, 11085, 0, 9059, 16925, 32935, 0, 12792, 28754,
+    12622, 11710, 0, 17219, 28788, 10872, 10498, 0, 12812, 0, 11572, 9086, 12718, 12717, 11348, 10551,
+    11926, 12811, 10505, 28798, 28823, 17053, 13146, 10283, 16982, 17410, 0, 4931, 32911, 12824, 12321, 10461,
+    0, 32931, 17227, 12798, 17275, 16923, 12780, 5490, 12814, 13008, 17012, 12919, 32868, 32833, 6387, 11394,
+    0, 32930, 0, 10252, 12383, 11341, 8777, 12801, 17296, 17079, 0, 0, 0, 32881, 12803, 13138,
+    11141, 11050, 0, 0, 16991, 12552, 12888, 16983, 13036, 12792, 9972, 0, 12824, 10581, 17053, 0,
+    9956, 12706, 0, 10258, 12789, 9387, 28823, 8488, 0, 5498, 12468, 12791, 11610, 0, 9685, 0,
+    0, 17316, 10814, 28825, 0, 16700, 10869, 28731, 16779, 17061, 0, 0, 12551, 17132, 11059, 28725,
+    12909, 0, 10550, 28822, 13017, 32867, 28747, 10852, 9151, 0, 10814, 32934, 12814, 32880, 11441, 11348,
+    11710, 11349, 17227, 10460, 0, 5498, 11684, 10261, 13039, 0, 11142, 0, 28773, 0, 0, 0,
+    11684, 12984, 0, 0, 10517, 13132, 17141, 10253, 20487, 5673, 11466, 12921, 12575, 12921, 32780, 12428,
+    32906, 0, 32793, 9833, 9067, 0, 12981, 8490, 9974, 0, 28823, 8233, 12800, 11103, 5657, 0,
+    0, 13112, 0, 17410, 9956, 9974, 12910, 12378, 28794, 13172, 12683, 16462, 0, 9919, 32881, 12624,
+    32894, 0, 11013, 32859, 28793, 12802, 13137, 28797, 10760, 9146, 11640, 10281, 8479, 12309, 10253, 0,
+    12870, 12384, 12576, 12815, 8864, 32922, 12779, 12706, 12622, 12922, 11168, 0, 28762, 12671, 12404, 17228,
+    0, 13036, 13112, 9067, 16924, 0, 9674, 32790, 28810, 0, 11358, 11151, 32905, 32845, 28820, 0,
+    13123, 12706, 28743, 0, 12694, 28776, 5498, 0, 0, 5673, 12823, 12814, 12814, 0, 0, 0,
+    16934, 5628, 13138, 9089, 0, 17305, 0, 12696, 28708, 12706, 12492, 11703, 10270, 10852, 28709, 28784,
+    16505, 6408, 12719, 10545, 12719, 0, 0, 13127, 0, 0, 12405, 9675, 0, 12943, 12599, 13139,
+    16991, 28703, 0, 10460, 12718, 5971, 12694, 32923, 5666, 9973, 0, 10208, 0, 0, 28785, 11894,
+    28800, 10452, 28759, 11476, 12803, 12516, 9919, 10806, 28786, 13017, 9965, 12586, 12887, 12825, 0, 28808,
+    28732, 12932, 12900, 0, 16993, 0, 11401, 12359, 32906, 0, 0, 28800, 12980, 9965, 12563, 0,
+    28781, 32905, 9983, 17141, 12454, 12716, 0, 0, 28749, 13200, 17219, 17071, 13140, 12921, 32893, 0,
+    10217, 10806, 12887, 28765, 10561, 9685, 10759, 0, 32869, 9078, 13019, 0, 12634, 12779, 12825, 13103,
+    0, 11647, 11865, 12922, 0, 12887, 10498, 10190, 17161, 11894, 0, 12792, 11865, 9918, 10376, 10551,
+    17016, 8411, 12664, 0, 0, 0, 12920, 28708, 12702, 28699, 28755, 28673, 0, 28757, 0, 0,
+    11058, 0, 0, 8905, 12611, 12648, 0, 16902, 12814, 11693, 8336, 12932, 0, 12743, 12790, 0,
+    28788, 11602, 20482, 11144, 17151, 9376, 0, 13016, 13027, 10217, 28792, 5499, 28778, 11394, 8489, 0,
+    13017, 6188, 0, 13006, 16824, 28806, 13056, 28774, 10208, 0, 12561, 12990, 28745, 0, 0, 12863,
+    0, 6050, 28797, 10247, 11387, 12683, 0, 16934, 11977, 0, 32832, 17219, 0, 9356, 11395, 12636,
+    0, 0, 9986, 17008, 12719, 0, 6046, 12717, 12528, 20487, 0, 11441, 0, 10570, 17236, 11411,
+    17149, 0, 10666, 11358, 32858, 28799, 28758, 12802, 0, 12863, 13007, 0, 0, 0, 10507, 10507,
+    20486, 10578, 32907, 17376, 0, 0, 12760, 12826, 8489, 12693, 17219, 12932, 12993, 0, 28719, 11844,
+    11780, 13139, 0, 0, 13091, 17253, 28784, 28794, 12648, 12960, 12994, 12994, 11349, 12825, 12420, 12944,
+    13147, 0, 0, 13043, 28810, 10279, 11143, 13171, 10161, 10216, 11693, 11611, 13198, 32883, 4852, 12945,
+    0, 12620, 6151, 32884, 11610, 0, 32932, 11693, 28702, 12575, 10553, 0, 0, 12922, 12731, 16924,
+    12028, 6047, 9983, 6393, 9687, 12935, 12611, 6150, 10551, 16597, 0, 28690, 12825, 17002, 10207, 0,
+    0, 13041, 12659, 11140, 13055, 13039, 4296, 6058, 13182, 5629, 28679, 28788, 16845, 13147, 13140, 28703,
+    0, 17289, 9087, 0, 12552, 12706, 16935, 12911, 32921, 28679, 12659, 17237, 10217, 11058, 13020, 17080,
+    13062, 32803, 9172, 13031, 11105, 0, 12694, 10813, 13138, 28745, 0, 0, 6051, 0, 0, 12944,
+    12825, 10814, 0, 13147, 28742, 13080, 32853, 32780, 0, 0, 6050, 12766, 20484, 0, 12707, 13050,
+    0, 32894, 11866, 5499, 13039, 4955, 12755, 11866, 32933, 9965, 0, 16933, 12695, 28720, 0, 0,
+    8848, 12826, 5666, 28738, 9555, 13147, 32882, 17011, 0, 32883, 12527, 12922, 0, 0, 13140, 13008,
+    17004, 12767, 11647, 0, 32868, 20487, 0, 10460, 12612, 0, 0, 0, 8570, 0, 28756, 9089,
+    17003, 0, 12500, 11866, 13063, 12360, 12744, 32867, 0, 28751, 20490, 11694, 13194, 28796, 10280, 12900,
+    12708, 8665, 0, 28828, 17150, 28760, 13209, 12888, 28806, 16525, 12647, 10507, 12934, 0, 0, 0,
+    32893, 28732, 11701, 11104, 0, 0, 13126, 11740, 12932, 28809, 11648, 11710, 10806, 0, 32853, 28712,
+    0, 12815, 6233, 10853, 8898, 28808, 11104, 0, 9265, 17398, 12921, 17220, 12768, 10852, 11450, 11894,
+    0, 0, 0, 6225, 6059, 17141, 32924, 32870, 9675, 0, 0, 32841, 6440, 0, 12635, 5629,
+    17038, 17229, 32859, 10562, 0, 28764, 16857, 20486, 17228, 0, 0, 12923, 0, 12826, 12971, 20488,
+    9373, 17316, 32932, 9676, 11151, 16904, 0, 0, 0, 13138, 0, 0, 0, 6234, 10561, 28811,
+    10516, 16612, 20483, 0, 12996, 6218, 28731, 28794, 0, 0, 12492, 32935, 11357, 0, 0, 9985,
+    13125, 28801, 13042, 13104, 5666, 13030, 9984, 13150, 10461, 17014, 13175, 0, 12504, 16447, 17238, 0,
+    0, 12684, 28743, 17081, 12909, 13075, 0, 16991, 0, 32846, 28711, 16858, 12944, 11412, 0, 12684,
+    17160, 9376, 17315, 0, 0, 0, 11694, 11152, 0, 32872, 28823, 12504, 28721, 12899, 11977, 28781,
+    16858, 12825, 12659, 10507, 0, 9087, 8787, 0, 11778, 9986, 12490, 0, 13140, 13028, 0, 17219,
+    8285, 28679, 11113, 28748, 10998, 10066, 13063, 28824, 20489, 20484, 0, 12756, 11450, 4727, 13224, 28745,
+    0, 32896, 0, 0, 17170, 28785, 0, 28775, 16421, 13043, 13039, 0, 17326, 0, 12888, 9674,
+    9983, 28785, 9779, 9386, 6226, 10869, 10572, 6326, 13064, 28800, 13052, 10805, 32935, 13091, 13149, 17296,
+    12546, 13052, 28774, 10805, 0, 10162, 12534, 12539, 0, 16937, 0, 9078, 0, 28704, 12946, 0,
+    28782, 32936, 12780, 11702, 11168, 0, 12720, 11105, 0, 0, 0, 12707, 11711, 12923, 9387, 8778,
+    16737, 0, 6455, 11104, 11656, 17004, 6466, 0, 0, 28751, 28804, 0, 13042, 12815, 17297, 13224,
+    11477, 13200, 6357, 0, 28753, 12815, 12428, 0, 0, 10570, 11749, 12899, 16667, 28757, 28769, 13040,
+    0, 0, 4569, 32932, 11869, 13156, 28762, 0, 0, 0, 17220, 11756, 0, 0, 17016, 28727,
+    28700, 10580, 11161, 6364, 13139, 12931, 28787, 0, 12910, 4982, 16937, 0, 8278, 12666, 0, 8313,
+    17082, 11466, 28785, 0, 16903, 0, 17016, 12716, 0, 12816, 17219, 32906, 28809, 13147, 13064, 17159,
+    10880, 12499, 17239, 28786, 9515, 10853, 12790, 28803, 17410, 12403, 17190, 9016, 17238, 17282, 0, 12515,
+    0, 0, 32789, 11115, 0, 32816, 0, 17290, 32897, 12594, 12816, 6463, 11983, 0, 0, 6226,
+    11467, 0, 13075, 32898, 13041, 12720, 12416, 10881, 12791, 11451, 0, 0, 9917, 13149, 13031, 5674,
+    0, 12078, 10583, 16813, 0, 0, 32879, 16458, 28827, 12344, 12576, 13077, 0, 12475, 0, 0,
+    11954, 9935, 11105, 16922, 0, 13020, 13149, 12696, 17171, 9551, 10274, 32898, 0, 28743, 16934, 10625,
+    11711, 10815, 12650, 28760, 6410, 11656, 11477, 17307, 0, 12943, 0, 16744, 12546, 12873, 12369, 11412,
+    0, 20490, 0, 10283, 17161, 12804, 10862, 10577, 13065, 12672, 16596, 0, 0, 17012, 12623, 6394,
+    32859, 0, 11403, 11178, 12442, 12623, 16869, 10573, 4917, 11703, 0, 32907, 0, 32806, 8383, 12534,
+    9984, 0, 12792, 28809, 13020, 17012, 9722, 13160, 0, 32897, 17248, 8619, 28745, 0, 12297, 32934,
+    11395, 10816, 28762, 9749, 16570, 12911, 0, 6409, 0, 12816, 12479, 0, 32841, 0, 17308, 0,
+    11895, 10272, 12558, 9181, 13171, 12984, 0, 13031, 28746, 11759, 0, 0, 0, 0, 12897, 17411,
+    0, 12534, 12382, 13112, 16519, 28820, 11694, 0, 11902, 13031, 17091, 12792, 0, 17015, 28739, 12924,
+    17317, 13030, 32935, 28812, 13019, 12897, 12746, 10572, 28774, 17316, 17095, 10264, 12886, 11757, 12924, 10554,
+    12791, 12074, 0, 12744, 28691, 12875, 0, 17170, 28723, 11413, 9536, 0, 28816, 12442, 12404, 10870,
+    0, 0, 17014, 0, 6454, 11113, 0, 0, 28757, 12924, 16427, 10584, 4447, 0, 28764, 0,
+    12892, 0, 12456, 11459, 8480, 10264, 9210, 17173, 11459, 12511, 11459, 12551, 0, 13092, 8491, 28802,
+    0, 6455, 0, 17331, 0, 13139, 5010, 10274, 0, 0, 8652, 20484, 28746, 17348, 0, 17171,
+    12490, 10573, 16856, 10039, 32859, 0, 12606, 17015, 12924, 0, 0, 13126, 13159, 11703, 0, 12923,
+    28729, 32885, 32843, 13031, 10571, 0, 0, 0, 8612, 16456, 9686, 0, 0, 28718, 11160, 8649,
+    12604, 0, 16862, 0, 12720, 13065, 12880, 17004, 8438, 12851, 12964, 12000, 12792, 0, 28809, 28696,
+    9262, 0, 16448, 17298, 9551, 10582, 12486, 0, 32832, 10871, 11711, 12726, 0, 0, 12477, 0,
+    4445, 11711, 0, 16754, 13222, 17239, 32917, 0, 0, 0, 12407, 12846, 0, 0, 0, 8994,
+    28819, 10626, 6440, 28734, 32816, 13211, 17353, 12443, 28687, 0, 28782, 32920, 6448, 16657, 28717, 10880,
+    11712, 0, 16864, 0, 4924, 6234, 17095, 17015, 28688, 0, 28743, 28726, 0, 32924, 32898, 28821,
+    28688, 28682, 11956, 12912, 13112, 20484, 0, 12732, 13008, 16685, 28812, 16587, 0, 13029, 12676, 9450,
+    17250, 0, 10274, 12708, 0, 12828, 13041, 13140, 28725, 6465, 8350, 28755, 28746, 11476, 10325, 28821,
+    0, 12580, 0, 12431, 0, 11468, 0, 20487, 0, 16429, 10516, 8576, 6456, 17317, 8231, 9551,
+    16519, 16587, 12708, 16737, 11413, 0, 8994, 16821, 11749, 28743, 11459, 9904, 16569, 11170, 28759, 16500,
+    12055, 11939, 0, 28770, 17253, 10562, 0, 5014, 16868, 0, 10129, 0, 11703, 0, 28704, 28740,
+    9287, 32872, 13140, 10283, 0, 0, 8915, 16618, 11459, 28813, 0, 12516, 13125, 0, 8410, 28810,
+    4446, 0, 13043, 4556, 11711, 9748, 12826, 6365, 16687, 13052, 13043, 12382, 0, 17016, 0, 9838,
+    16858, 0, 4607, 20484, 8256, 12768, 28674, 12858, 9956, 12869, 10283, 0, 0, 0, 13168, 0,
+    0, 0, 12406, 0, 0, 0, 16800, 6457, 12971, 9472, 9009, 10218, 28687, 0, 12816, 0,
+    16583, 0, 28693, 12324, 28721, 12888, 12684, 9687, 28788, 17327, 16606, 13042, 6410, 10538, 0, 13076,
+    0, 32844, 0, 10282, 28810, 12308, 0, 12346, 12406, 28680, 12509, 12371, 11909, 28825, 28732, 0,
+    11871, 32792, 9657, 28810, 0, 8284, 12492, 9912, 16799, 12639, 13127, 12876, 12534, 12881, 8553, 32793,
+    12310, 13030, 0, 28815, 17298, 12381, 28758, 9745, 0, 0, 28728, 6410, 6410, 13116, 13128, 28771,
+    13091, 32779, 16677, 9592, 28757, 12407, 16677, 12333, 20490, 11750, 5523, 17318, 16735, 28732, 32793, 5993,
+    32923, 13194, 0, 17299, 12924, 12383, 10264, 11460, 10880, 11413, 11902, 0, 0, 12009, 13182, 12880,
+    16450, 16517, 8347, 9586, 0, 32791, 0, 28748, 0, 17308, 28757, 32918, 10216, 12370, 10581, 0,
+    11954, 13171, 12534, 4450, 16676, 9293, 12900, 12911, 0, 8320, 10285, 0, 28737, 0, 16519, 0,
+    32792, 11946, 12335, 0, 12451, 13020, 12064, 28776, 11776, 12611, 0, 12453, 0, 12726, 28704, 20484,
+    0, 0, 11742, 16528, 0, 9078, 11468, 16963, 17170, 28813, 12371, 12394, 11766, 12735, 32832, 17327,
+    11710, 13092, 28689, 32919, 12395, 0, 12993, 13173, 0, 32780, 32921, 17398, 32819, 11169, 28729, 0,
+    9935, 32844, 12622, 11939, 16869, 11469, 0, 0, 13159, 16527, 11909, 0, 0, 8320, 17173, 12846,
+    16579, 10404, 16596, 12879, 32859, 28810, 10563, 16874, 0, 12666, 16450, 12534, 11779, 16516, 12383, 0,
+    0, 9749, 10273, 16767, 0, 13054, 12395, 28803, 28780, 12618, 20485, 12487, 0, 0, 28811, 28732,
+    10327, 28819, 17354, 32843, 9751, 11749, 28811, 12996, 12846, 12878, 28721, 0, 28715, 12475, 13029, 10375,
+    0, 10554, 32817, 17013, 10274, 10111, 13008, 13152, 10243, 16736, 12498, 11470, 12321, 0, 0, 13196,
+    13218, 28812, 32828, 9560, 32842, 28818, 0, 11992, 16902, 0, 16500, 13138, 11481, 6410, 13017, 9474,
+    28784, 16857, 0, 13031, 0, 28680, 9612, 28735, 16440, 0, 16746, 32842, 0, 12568, 8350, 28737,
+    13175, 12332, 11947, 13183, 6466, 13020, 12972, 12924, 9247, 12642, 13030, 12561, 6411, 10106, 9204, 9586,
+    8963, 0, 13044, 10264, 9210, 0, 28812, 16421, 9801, 17318, 9597, 13139, 11758, 17095, 0, 28692,
+    28676, 0, 11180, 0, 10571, 0, 8420, 0, 13067, 28808, 12609, 8396, 32892, 11909, 28748, 0,
+    12056, 12708, 0, 12879, 9607, 12418, 16745, 0, 13139, 12785, 0, 0, 28745, 16665, 12075, 8702,
+    9597, 13044, 16873, 0, 10132, 13140, 0, 0, 12465, 9986, 0, 12415, 0, 9388, 9009, 9560,
+    28673, 17241, 12487, 0, 32842, 13195, 0, 4669, 12065, 0, 0, 0, 16605, 12310, 0, 12881,
+    13210, 9845, 17269, 9316, 0, 11910, 10274, 0, 9555, 12726, 17354, 12311, 0, 0, 12594, 28772,
+    32910, 8691, 12407, 12654, 4451, 0, 0, 9009, 12630, 0, 32832, 12416, 12383, 12691, 12576, 9503,
+    11479, 12504, 13207, 32829, 12954, 13080, 13172, 16874, 8408, 6448, 16444, 28682, 10039, 32844, 10150, 32803,
+    10620, 11181, 9564, 28693, 0, 11985, 0, 0, 4613, 0, 28678, 11115, 0, 8350, 11478, 0,
+    13020, 13195, 28815, 13185, 9751, 0, 32818, 12504, 0, 12604, 12383, 9854, 0, 16746, 10285, 8619,
+    8612, 32831, 8452, 0, 12432, 9859, 0, 0, 8948, 16674, 8343, 32870, 9605, 9286, 9254, 28701,
+    13161, 5249, 4614, 12001, 17317, 28768, 17326, 9653, 13162, 28678, 0, 28735, 12475, 12336, 11767, 12933,
+    12334, 32833, 16439, 0, 12075, 0, 9598, 16447, 4675, 11214, 10626, 9376, 12905, 17308, 28688, 32871,
+    28716, 12524, 12773, 0, 0, 12990, 28679, 12750, 28680, 28729, 11478, 8399, 10920, 28700, 12440, 28758,
+    20486, 0, 0, 12534, 0, 13174, 5862, 11759, 11035, 12896, 9509, 9540, 17330, 17330, 12407, 6457,
+    0, 12384, 12584, 12384, 10919, 16756, 11985, 0, 16696, 12936, 0, 6411, 13164, 12923, 0, 10142,
+    0, 12643, 12383, 10285, 4867, 0, 13104, 0, 0, 13128, 0, 17309, 16774, 12475, 0, 0,
+    28692, 13197, 12357, 12428, 0, 0, 0, 32845, 0, 0, 0, 8656, 6465, 8695, 28822, 16597,
+    9646, 32845, 8765, 12972, 0, 10573, 0, 12010, 9613, 4869, 12604, 28768, 28815, 5499, 17328, 0,
+    0, 0, 9598, 9974, 4700, 0, 0, 17327, 28820, 10342, 12666, 17384, 8757, 12438, 10925, 13184,
+    9001, 16667, 0, 10196, 13164, 0, 12405, 13196, 0, 8955, 12367, 12444, 12726, 10736, 13211, 13211,
+    0, 0, 0, 12468, 12523, 8285, 28798, 13175, 0, 32937, 20483, 12630, 0, 0, 28730, 13128,
+    9900, 12001, 12595, 5068, 13197, 28804, 12583, 13116, 0, 13151, 0, 0, 8322, 12948, 0, 12476,
+    32844, 13174, 28759, 0, 5955, 12739, 12345, 12858, 9564, 28714, 16756, 9509, 8710, 12837, 10225, 0,
+    12960, 12681, 0, 13206, 16500, 8664, 13175, 12420, 13000, 8446, 0, 11480, 0, 6465, 0, 28714,
+    32830, 13032, 12560, 17251, 0, 0, 28739, 13196, 0, 0, 8949, 0, 0, 5805, 0, 0,
+    16664, 13104, 0, 32921, 12010, 0, 28820, 6427, 10095, 17376, 12299, 12065, 12611, 8994, 9364, 0,
+    12572, 28747, 9653, 13092, 12778, 12572, 9009, 13185, 11767, 0, 0, 16606, 4621, 0, 4932, 32819,
+    13114, 11035, 8285, 8359, 9883, 9808, 13196, 0, 32807, 6095, 12573, 0, 9899, 0, 0, 10925,
+    4694, 32845, 12333, 5254, 0, 8350, 12348, 0, 0, 16526, 0, 13163, 0, 32846, 11768, 11265,
+    0, 28772, 5868, 11955, 11181, 0, 16952, 16688, 12954, 0, 32819, 0, 12998, 0, 12384, 0,
+    12768, 0, 0, 13222, 16756, 28785, 32820, 8919, 8719, 10343, 0, 13208, 13161, 0, 9606, 12618,
+    0, 0, 12548, 0, 13173, 11481, 28816, 12066, 8452, 13031, 0, 12074, 12322, 28759, 13140, 11947,
+    13116, 12954, 8955, 12010, 12989, 0, 8321, 28749, 10582, 28744, 12057, 12708, 28762, 8637, 8766, 0,
+    0, 0, 6466, 0, 11769, 0, 0, 9308, 16697, 12511, 16755, 13197, 17251, 12618, 28690, 12655,
+    12359, 4722, 28765, 12739, 16684, 28727, 12501, 16438, 12720, 17410, 0, 12525, 6325, 0, 13127, 0,
+    10048, 12791, 5340, 12456, 4692, 12538, 12605, 28690, 28757, 9883, 10137, 0, 12876, 12680, 12443, 10343,
+    0, 13163, 32845, 28735, 12989, 12002, 5360, 12079, 8695, 9660, 12001, 0, 12442, 9940, 12787, 8359,
+    10213, 12396, 32844, 0, 0, 0, 11246, 16833, 11081, 9859, 13162, 8620, 9349, 12562, 13151, 13173,
+    12408, 8314, 0, 8322, 9815, 0, 11768, 0, 12499, 32794, 9816, 12680, 12999, 9917, 10654, 10086,
+    28726, 8411, 12010, 13163, 28680, 10385, 16688, 17368, 9802, 8964, 9510, 11246, 28677, 28750, 12690, 17230,
+    9317, 13196, 16529, 28703, 9671, 9349, 12502, 0, 12430, 28717, 17320, 9382, 0, 9009, 13175, 16538,
+    5254, 0, 0, 9211, 0, 16617, 10360, 32791, 0, 0, 12523, 0, 9308, 0, 16686, 0,
+    12643, 12067, 0, 0, 0, 12515, 13152, 13197, 13175, 12574, 8621, 0, 28679, 16763, 10342, 12477,
+    16698, 28784, 13208, 16842, 12655, 12372, 12690, 12606, 0, 12874, 13008, 5772, 0, 8964, 16695, 9293,
+    0, 0, 9891, 9679, 28733, 12002, 9860, 0, 0, 12468, 8584, 9211, 28733, 9670, 0, 8751,
+    0, 0, 12561, 0, 5651, 12893, 16439, 9009, 4693, 28736, 8467, 0, 12478, 16528, 10377, 12776,
+    28721, 16766, 16429, 0, 28792, 9882, 12585, 9615, 12727, 9263, 28678, 32781, 28684, 32807, 16534, 12475,
+    32779, 9018, 5340, 32842, 12312, 0, 13219, 8965, 8956, 8322, 0, 0, 0, 11380, 12894, 0,
+    0, 0, 4625, 13079, 0, 28726, 5041, 28735, 8321, 5532, 0, 10108, 16832, 16621, 13160, 0,
+    0, 8956, 28758, 9293, 12739, 13025, 12455, 9182, 16767, 0, 0, 0, 4707, 16775, 20483, 32846,
+    12624, 13152, 0, 12011, 0, 28753, 0, 12633, 0, 28747, 13197, 10360, 0, 6099, 0, 13140,
+    17044, 9668, 13016, 28724, 10633, 28692, 9642, 0, 28682, 8949, 13222, 8741, 32793, 12690, 0, 13197,
+    12525, 16964, 12894, 12814, 10100, 9661, 16980, 16608, 12778, 28731, 13219, 28827, 9897, 8665, 9593, 28811,
+    28766, 17037, 12333, 5540, 28716, 9311, 6089, 0, 28693, 0, 12550, 0, 13164, 0, 10149, 12622,
+    12587, 16824, 10412, 12701, 12551, 12871, 8758, 28691, 13208, 12012, 17162, 0, 12574, 13012, 16823, 12454,
+    16509, 4722, 12935, 11266, 12826, 9898, 12465, 12862, 12432, 0, 0, 28789, 28762, 32921, 16528, 28727,
+    12692, 13032, 11238, 0, 17036, 8720, 16461, 28764, 12431, 16775, 28749, 0, 5340, 8919, 0, 0,
+    8420, 8404, 0, 13219, 13080, 12893, 0, 32779, 28690, 12408, 0, 17099, 5041, 28813, 9065, 13212,
+    12618, 0, 5427, 0, 11004, 17131, 13197, 0, 10932, 12752, 0, 16834, 9320, 28745, 13224, 12599,
+    12847, 12786, 0, 13220, 13164, 12491, 5440, 8965, 28820, 9898, 12699, 12572, 12419, 20485, 28712, 8964,
+    12978, 9669, 28828, 28781, 10245, 10997, 28821, 28804, 0, 12895, 0, 28747, 0, 0, 32831, 28819,
+    12560, 12075, 10234, 9609, 17330, 0, 0, 28729, 12732, 13139, 17405, 12076, 9301, 9662, 9859, 11481,
+    12478, 12612, 16923, 0, 5540, 16459, 0, 32844, 8358, 28779, 9003, 32879, 28773, 8658, 10260, 9947,
+    0, 9382, 10112, 11955, 0, 12431, 12502, 12527, 10996, 5333, 0, 28765, 0, 28733, 0, 11470,
+    28747, 28782, 12467, 12562, 16990, 13080, 0, 0, 10404, 4948, 28701, 9964, 12455, 9343, 12454, 0,
+    0, 28727, 10838, 17388, 12467, 10149, 13001, 28821, 12347, 0, 12492, 32846, 10252, 12441, 9853, 0,
+    12966, 12619, 28723, 16440, 0, 12432, 8712, 8703, 11563, 0, 17399, 0, 10734, 28785, 12795, 16685,
+    17332, 16451, 9665, 0, 28782, 16529, 13211, 12420, 16776, 9956, 12796, 32872, 8995, 5415, 16686, 32833,
+    9899, 0, 13147, 10202, 12894, 8665, 9050, 0, 8445, 12467, 11517, 10968, 9356, 28817, 28749, 12803,
+    12538, 28690, 10078, 12502, 13208, 0, 11769, 0, 12492, 12766, 13162, 0, 12780, 28749, 16973, 0,
+    12514, 0, 16842, 0, 0, 28680, 12479, 12299, 12648, 0, 10269, 17149, 28822, 12619, 16903, 12515,
+    12610, 32854, 32842, 16440, 28751, 12432, 0, 9963, 10184, 0, 16914, 0, 17394, 12610, 28690, 20483,
+    12764, 28815, 16971, 28733, 10451, 0, 11137, 9973, 12348, 12563, 28774, 12609, 12611, 28690, 28739, 5333,
+    32862, 28762, 0, 0, 0, 28811, 28823, 32854, 16924, 20488, 0, 12563, 0, 10244, 0, 16894,
+    11033, 10736, 10079, 16687, 0, 8775, 10113, 32864, 13186, 10713, 9003, 16606, 0, 13092, 12359, 13186,
+    10459, 28759, 10673, 12396, 12907, 16895, 12371, 28771, 32781, 28821, 12066, 12467, 16816, 16618, 0, 9861,
+    10750, 12871, 28678, 9817, 32833, 12455, 5106, 10158, 32861, 0, 10451, 8711, 9885, 28785, 9907, 8751,
+    12408, 12903, 5427, 12657, 11545, 28773, 5650, 12778, 28716, 12728, 16914, 9309, 0, 12634, 12684, 12798,
+    16911, 12682, 17410, 12336, 9862, 12584, 8712, 16913, 12515, 12573, 17080, 10838, 0, 12360, 17369, 5444,
+    0, 17069, 5614, 28785, 0, 12692, 9940, 12862, 11049, 12324, 13212, 28688, 28757, 16833, 8413, 17395,
+    5541, 6013, 28714, 28827, 16895, 9891, 12919, 12514, 0, 12079, 13220, 13220, 0, 10470, 32846, 12741,
+    0, 0, 12372, 12966, 16800, 9074, 8404, 12874, 16777, 10443, 28724, 28682, 10507, 17131, 0, 12453,
+    5614, 12608, 32908, 5966, 12610, 28681, 12515, 0, 28796, 12078, 10145, 9600, 0, 17052, 12618, 28785,
+    0, 12902, 28800, 8873, 11049, 16922, 0, 12335, 0, 0, 12067, 13080, 12416, 9302, 32833, 17406,
+    12479, 9256, 17386, 12611, 13121, 12028, 0, 12624, 8486, 0, 12789, 10459, 5106, 0, 11534, 12077,
+    17044, 11033, 12780, 5455, 0, 12670, 17275, 0, 28785, 16698, 12729, 28692, 5877, 13011, 12466, 11137,
+    12693, 16451, 28764, 28801, 0, 0, 12635, 11815, 9610, 0, 16451, 17398, 0, 16923, 10284, 16507,
+    0, 13172, 0, 17194, 32891, 0, 0, 0, 16985, 0, 17409, 12479, 28738, 10497, 10160, 10151,
+    12503, 16767, 10412, 10789, 32867, 0, 0, 10442, 17369, 16978, 0, 12823, 12300, 16924, 12694, 28720,
+    12396, 11356, 12886, 5590, 32930, 32781, 10234, 32819, 8766, 12935, 9074, 16835, 0, 17376, 16462, 0,
+    0, 17408, 16970, 0, 17330, 12694, 12704, 28819, 12479, 28812, 9051, 10703, 0, 5993, 28773, 12766,
+    9057, 28678, 28749, 9947, 17398, 10505, 4981, 12798, 17196, 8405, 0, 5726, 12539, 0, 28786, 10796,
+    0, 28796, 0, 9899, 17042, 12492, 12694, 12935, 12538, 10159, 5665, 12077, 9318, 12789, 16609, 32832,
+    12525, 10161, 0, 9051, 0, 10153, 8476, 0, 12904, 12729, 11077, 11536, 9600, 0, 0, 12455,
+    0, 0, 12489, 17396, 12620, 20483, 28742, 12741, 32856, 0, 9021, 16516, 8766, 32924, 16766, 0,
+    9863, 0, 8666, 17331, 32879, 32867, 12455, 10210, 0, 16911, 0, 10377, 16767, 8461, 0, 32892,
+    12645, 28762, 32844, 12528, 16777, 16986, 13211, 10804, 32806, 11533, 0, 10527, 12647, 11095, 8423, 16970,
+    12768, 12490, 11300, 9674, 12444, 32831, 16833, 32892, 0, 0, 32930, 17139, 0, 13006, 16914, 17121,
+    17386, 10751, 11537, 17069, 32832, 12372, 8723, 9066, 10108, 6123, 0, 0, 0, 10488, 28745, 0,
+    28738, 17042, 13133, 8759, 17386, 12886, 9960, 11273, 11002, 12300, 12790, 12947, 0, 12525, 12911, 8368,
+    32867, 0, 0, 5830, 5482, 0, 20481, 8468, 28761, 12898, 12754, 28758, 16461, 0, 0, 12503,
+    0, 28764, 9620, 12702, 12704, 10079, 28824, 12576, 0, 12906, 0, 17226, 11311, 11779, 12884, 0,
+    17396, 0, 12704, 0, 0, 0, 0, 12919, 11311, 32857, 9051, 9066, 0, 12645, 0, 10205,
+    9020, 12897, 12552, 10714, 28782, 12057, 0, 16999, 28758, 28731, 28719, 13128, 13014, 12635, 12863, 10414,
+    12743, 0, 12684, 28770, 16460, 10406, 0, 5099, 0, 10786, 12480, 0, 28729, 0, 12849, 28753,
+    0, 32883, 12575, 0, 11538, 32831, 32932, 17227, 12850, 8965, 17042, 28766, 13152, 0, 12504, 32857,
+    9075, 28797, 32879, 28774, 10488, 9020, 12525, 28797, 9909, 0, 0, 6433, 12516, 32869, 28797, 17061,
+    28773, 28677, 13066, 13013, 5986, 12527, 12919, 32868, 9219, 20481, 16853, 10205, 32919, 32895, 28742, 16974,
+    12620, 0, 32905, 12742, 12848, 11039, 16779, 10153, 12800, 9947, 12348, 17158, 5878, 0, 12684, 9386,
+    0, 12396, 0, 12659, 12874, 5490, 28692, 11711, 11523, 13051, 11573, 11819, 0, 28762, 13066, 12622,
+    0, 28775, 20481, 12695, 12610, 8704, 0, 16991, 17062, 17407, 12706, 28764, 10838, 16903, 0, 0,
+    17409, 11084, 28788, 0, 16914, 0, 12780, 32854, 11341, 10415, 13221, 5986, 12887, 11085, 17016, 9388,
+    12789, 28787, 32870, 9357, 12468, 32879, 12791, 12491, 8766, 12706, 28751, 11013, 10251, 32880, 32870, 17131,
+    16999, 9084, 8460, 10514, 28757, 8387, 12823, 12789, 9620, 28785, 0, 10234, 17132, 12456, 28786, 11394,
+    17053, 0, 0, 12706, 10751, 0, 12694, 28762, 28760, 32870, 13023, 12576, 28823, 8461, 11566, 32867,
+    13039, 17230, 10788, 6299, 0, 0, 8461, 10214, 9947, 0, 0, 0, 17396, 11703, 12694, 16912,
+    9383, 11337, 13224, 28775, 12599, 11387, 12492, 11380, 12492, 0, 0, 12516, 16974, 28802, 11401, 28824,
+    0, 9899, 16778, 28816, 12887, 12801, 11679, 28746, 28752, 0, 28759, 0, 17141, 32904, 6111, 28765,
+    28774, 13050, 28764, 16983, 10503, 17217, 12779, 12790, 9956, 0, 16925, 32867, 20488, 9066, 32833, 5491,
+    0, 28776, 8368, 9592, 28764, 16542, 16462, 12670, 16451, 12823, 0, 0, 17140, 0, 12813, 11394,
+    12801, 12824, 16983, 12779, 28757, 28785, 0, 28747, 32832, 8368, 12621, 10759, 9961, 28756, 32882, 0,
+    0, 11633, 28753, 17094, 13039, 16856, 32880, 28819, 9357, 12779, 0, 5921, 13025, 12789, 13132, 28796,
+    0, 0, 0, 32870, 0, 10861, 11087, 28762, 0, 28775, 28744, 17274, 0, 6211, 12516, 0,
+    32807, 10527, 28719, 6021, 12620, 28782, 10161, 0, 5488, 13016, 0, 12910, 0, 12814, 11596, 17094,
+    0, 9909, 16845, 10251, 32870, 13050, 28774, 5411, 0, 10116, 32870, 12612, 28748, 0, 32845, 8786,
+    0, 8487, 12767, 12610, 11401, 0, 0, 12816, 12898, 12910, 10836, 8480, 13007, 0, 32932, 12934,
+    0, 0, 20488, 0, 28783, 28775, 9664, 0, 12920, 9973, 0, 0, 10751, 16620, 16933, 12876,
+    11013, 16995, 0, 5985, 28693, 0, 11610, 0, 12526, 12921, 16934, 12515, 28749, 28745, 9724, 12492,
+    12801, 10498, 28774, 11357, 10758, 11171, 12875, 9067, 0, 9620, 13132, 13220, 12931, 9147, 0, 20488,
+    0, 13176, 32820, 12779, 0, 8487, 8769, 12585, 12611, 17170, 12623, 17399, 17162, 12801, 12695, 28786,
+    12479, 10246, 20488, 0, 12935, 12791, 28766, 12931, 20488, 12790, 16992, 28766, 12492, 6101, 0, 6211,
+    6321, 28727, 11693, 16451, 0, 6427, 32931, 28802, 0, 16993, 12789, 28728, 0, 0, 6051, 0,
+    17149, 10506, 12552, 28758, 11686, 11572, 17140, 11956, 12932, 0, 28793, 0, 12719, 12571, 11135, 16463,
+    11403, 0, 32807, 11816, 0, 12944, 12942, 12599, 10751, 0, 16996, 0, 0, 28794, 28803, 13223,
+    32908, 16664, 8301, 17408, 9918, 10785, 11312, 28719, 12804, 4463, 0, 12957, 0, 0, 10852, 12684,
+    12719, 20485, 0, 0, 12899, 10260, 28753, 11647, 17211, 0, 6058, 0, 10784, 12993, 32883, 10267,
+    32893, 0, 0, 28728, 6386, 12816, 0, 0, 16935, 28729, 8414, 6044, 32844, 10516, 16932, 0,
+    12956, 0, 9964, 12899, 0, 16934, 28801, 16421, 0, 12815, 28708, 28779, 17211, 0, 28774, 17090,
+    6350, 28741, 17002, 0, 0, 32932, 12911, 32830, 17070, 13131, 0, 16854, 12674, 11050, 0, 12912,
+    5590, 0, 0, 12624, 12886, 0, 17001, 17210, 12802, 0, 28812, 28797, 12944, 10515, 16993, 17080,
+    12815, 11610, 11159, 12899, 12824, 17072, 0, 8470, 12492, 12803, 0, 13125, 10217, 0, 6350, 8491,
+    12623, 32936, 12731, 0, 16914, 12790, 12623, 32881, 10247, 11084, 16932, 28799, 9955, 10797, 4778, 28738,
+    32871, 12922, 11151, 13162, 12815, 28702, 28741, 11610, 20488, 12910, 32931, 6188, 12719, 28762, 12921, 9358,
+    11710, 11647, 0, 0, 12813, 0, 28788, 16854, 32867, 0, 8554, 17272, 13050, 12564, 11349, 12716,
+    10805, 11312, 10797, 0, 0, 32859, 13006, 0, 0, 9666, 32896, 16845, 0, 11058, 0, 16463,
+    0, 6181, 28815, 0, 28715, 28698, 12993, 8487, 17211, 17409, 28752, 13075, 11058, 11572, 12888, 0,
+    12770, 28825, 28684, 11349, 17399, 28777, 12503, 13147, 0, 20485, 17228, 0, 16855, 10253, 28799, 0,
+    32880, 28797, 12815, 11104, 5665, 10544, 11144, 6181, 16461, 16674, 13086, 0, 12696, 12803, 28796, 12540,
+    17275, 6326, 0, 0, 8470, 17162, 0, 12838, 13110, 0, 28778, 28732, 12944, 32778, 12480, 12910,
+    28800, 9919, 0, 32775, 16924, 28728, 13042, 0, 10507, 12945, 12791, 32934, 0, 9726, 17002, 28815,
+    12815, 0, 12717, 12792, 12972, 12719, 17320, 0, 8912, 12587, 0, 28700, 13075, 0, 28828, 28782,
+    10515, 12564, 0, 11443, 9377, 10216, 11096, 10261, 10553, 0, 9384, 11168, 12911, 12442, 28766, 10263,
+    17236, 28786, 0, 20490, 13086, 0, 12516, 17228, 0, 17082, 13126, 12910, 16666, 28732, 12540, 28727,
+    12732, 32835, 12611, 32934, 6409, 20484, 32802, 8548, 32781, 12899, 11635, 0, 6181, 28795, 28737, 12876,
+    6018, 5674, 0, 9973, 12403, 10217, 13067, 0, 13007, 12911, 0, 32846, 9462, 32872, 5666, 10244,
+    12456, 0, 28800, 32911, 17399, 12888, 0, 0, 6218, 32871, 17219, 10461, 28732, 12392, 12719, 10263,
+    6176, 0, 0, 12839, 32884, 11096, 9685, 16923, 28802, 0, 10207, 28799, 8424, 0, 17162, 10853,
+    32870, 0, 28746, 32931, 6385, 12684, 28689, 32905, 17289, 28823, 12583, 10797, 11357, 10452, 17003, 12780,
+    0, 32882, 12923, 17297, 4880, 6150, 12814, 0, 0, 0, 17211, 32885, 17072, 0, 0, 11411,
+    0, 28732, 28815, 12576, 11817, 28759, 11703, 11700, 16663, 10515, 28814, 0, 10584, 10838, 12531, 12636,
+    10805, 13113, 17407, 0, 12767, 0, 0, 0, 28755, 9544, 12359, 0, 0, 12779, 0, 0,
+    28821, 32937, 12587, 11603, 0, 28684, 6188, 10516, 28706, 13026, 17141, 13067, 6408, 9986, 9086, 28806,
+    13029, 0, 17071, 11414, 13051, 9175, 9675, 0, 11648, 0, 11480, 32894, 12720, 12487, 6188, 12816,
+    12696, 11750, 12815, 10760, 13144, 12546, 13016, 10517, 13054, 0, 5629, 0, 6188, 0, 28767, 16515,
+    9974, 13040, 10217, 32906, 32908, 11467, 6225, 12840, 12996, 12717, 13019, 8397, 0, 28779, 12899, 16463,
+    9676, 0, 12791, 10805, 12551, 9814, 0, 0, 17161, 0, 0, 9975, 0, 5010, 0, 9974,
+    12828, 16672, 12576, 0, 17241, 0, 12665, 0, 13030, 0, 0, 28755, 0, 9507, 9687, 32937,
+    17248, 11137, 6150, 11141, 9591, 12382, 17012, 4571, 13123, 13018, 11403, 0, 5927, 12862, 12491, 28767,
+    32804, 10089, 28781, 13030, 0, 0, 9508, 12936, 5674, 8319, 10216, 28796, 0, 10285, 0, 32870,
+    9299, 0, 0, 12672, 11972, 17012, 0, 0, 12708, 17309, 0, 11889, 0, 12501, 9805, 32898,
+    28788, 0, 16935, 0, 28749, 11113, 12475, 17150, 0, 11115, 12899, 8949, 28791, 12624, 13064, 17012,
+    32872, 6401, 12996, 9516, 28767, 10277, 11694, 12695, 0, 13078, 12441, 0, 9088, 0, 17409, 11611,
+    12893, 10580, 9377, 12602, 13111, 9074, 6454, 12539, 12533, 0, 28762, 28790, 12921, 13063, 28802, 0,
+    28786, 12708, 10853, 28801, 12492, 28823, 11357, 0, 12570, 10507, 12761, 10883, 0, 12911, 10162, 0,
+    0, 0, 0, 11395, 0, 32841, 12545, 6455, 11450, 0, 12372, 11647, 12696, 17296, 13031, 13055,
+    9687, 13052, 0, 32910, 0, 0, 0, 8985, 12576, 32859, 0, 12948, 12936, 16813, 10255, 12368,
+    12419, 12756, 12780, 32872, 16597, 16756, 0, 13136, 13032, 12677, 0, 12774, 0, 16842, 28791, 12934,
+    12624, 12516, 11656, 17290, 9546, 12528, 13055, 17014, 16937, 10127, 6059, 10517, 12650, 8954, 0, 0,
+    8470, 0, 0, 0, 0, 32937, 17081, 12335, 9501, 12899, 11711, 13044, 8307, 6447, 9983, 12947,
+    0, 0, 0, 0, 0, 11413, 9843, 0, 28688, 0, 0, 0, 10554, 0, 10153, 12468,
+    12322, 0, 12731, 0, 9241, 8778, 0, 13041, 0, 0, 17083, 28768, 10816, 28778, 0, 11466,
+    5302, 12995, 12792, 0, 13054, 0, 32937, 13043, 8616, 0, 11611, 12610, 12804, 20486, 12684, 13138,
+    0, 28731, 13031, 13067, 13020, 13042, 10264, 13019, 0, 8384, 13079, 12077, 8356, 0, 10281, 12432,
+    0, 17238, 11181, 0, 28826, 11160, 0, 13008, 32872, 12923, 0, 10571, 10554, 13186, 13111, 0,
+    0, 28750, 28708, 9965, 17139, 32898, 17239, 0, 12635, 13136, 32831, 32916, 8709, 10872, 0, 10870,
+    13042, 12564, 28802, 13019, 32791, 13063, 10571, 0, 6059, 28797, 10321, 28708, 13054, 13127, 0, 0,
+    11477, 13018, 8490, 0, 28814, 0, 0, 28738, 0, 28812, 0, 4932, 32932, 12487, 12696, 0,
+    0, 0, 32910, 0, 17228, 28784, 12394, 12815, 0, 8549, 28718, 11160, 32833, 0, 6463, 28814,
+    0, 0, 4408, 0, 0, 8357, 10178, 9086, 13173, 12540, 12603, 0, 11152, 0, 16732, 28731,
+    6059, 9387, 0, 32779, 17015, 28811, 6059, 17306, 0, 0, 8696, 16428, 0, 32936, 16935, 9480,
+    11749, 10853, 0, 9891, 32872, 28721, 13008, 16519, 12827, 0, 11694, 0, 9088, 32911, 28704, 10872,
+    0, 8488, 28810, 0, 8785, 8479, 9975, 28675, 16765, 13043, 12393, 0, 17160, 0, 0, 32778,
+    0, 0, 0, 11169, 0, 0, 10853, 32842, 28828, 17289, 8962, 11451, 32804, 4516, 17251, 32910,
+    0, 0, 12528, 12959, 6189, 28685, 12972, 32896, 0, 0, 10034, 13089, 28745, 0, 13123, 0,
+    10563, 28790, 28791, 28706, 17290, 12912, 12654, 13030, 12655, 13078, 12321, 0, 32885, 13154, 16685, 28726,
+    10035, 16686, 13074, 4678, 17013, 11656, 32917, 9905, 0, 12415, 13137, 12533, 17173, 32845, 13199, 17289,
+    12876, 0, 8769, 0, 12936, 0, 8911, 0, 0, 0, 20485, 0, 28725, 4497, 28738, 12510,
+    0, 17014, 11694, 28791, 28792, 28715, 17091, 13043, 32841, 12346, 12573, 0, 11895, 13163, 6326, 12344,
+    12870, 13171, 32894, 28811, 28785, 12394, 11459, 12815, 10623, 12816, 0, 16763, 16806, 16812, 12476, 0,
+    12545, 0, 12580, 17228, 16430, 12828, 12696, 9241, 17307, 12371, 0, 0, 8284, 12600, 10624, 9590,
+    32818, 11458, 6365, 12406, 0, 10883, 16675, 16937, 11656, 12310, 10273, 28697, 32792, 0, 12528, 0,
+    0, 12676, 13182, 17306, 9247, 13066, 17083, 9376, 11451, 28732, 12750, 8701, 10572, 32830, 16665, 11181,
+    17095, 0, 0, 32909, 16858, 12786, 6226, 11403, 0, 28734, 12309, 28815, 0, 12564, 9540, 6189,
+    0, 12453, 32817, 13183, 28678, 13183, 13137, 12367, 0, 13114, 12504, 17095, 9293, 12465, 12648, 12684,
+    17330, 0, 9248, 0, 9586, 28745, 0, 6326, 32779, 0, 11160, 28728, 13139, 12381, 13137, 0,
+    12295, 28822, 10573, 5395, 9287, 11946, 12335, 12444, 0, 12440, 32818, 0, 28817, 12594, 8656, 0,
+    12718, 0, 6401, 11477, 0, 9471, 0, 12296, 8446, 28748, 12416, 8779, 17298, 0, 0, 12582,
+    12900, 0, 10923, 32910, 16528, 0, 9837, 12332, 0, 0, 0, 11939, 12675, 28796, 12924, 5525,
+    0, 17316, 11451, 10872, 0, 12772, 12451, 0, 10882, 0, 16430, 0, 0, 0, 11160, 11765,
+    13078, 8411, 13136, 0, 32817, 28692, 0, 8366, 20484, 13013, 16755, 4825, 0, 0, 13052, 4604,
+    28716, 0, 13211, 10282, 0, 17290, 4841, 12404, 0, 13195, 10285, 6226, 5402, 11179, 28732, 8343,
+    12576, 12068, 17227, 9254, 10872, 12924, 0, 32819, 11742, 12826, 8407, 0, 9217, 0, 0, 28729,
+    12612, 11749, 13101, 8646, 13053, 10572, 28773, 9986, 0, 9687, 13207, 12336, 32778, 0, 11468, 11702,
+    13042, 11179, 32831, 0, 8606, 13056, 32805, 11207, 16674, 9262, 0, 11459, 6402, 32936, 6411, 0,
+    0, 28746, 28744, 28811, 0, 11223, 11403, 16779, 11459, 32817, 0, 11978, 11178, 9430, 0, 0,
+    12771, 0, 9975, 0, 0, 13044, 17094, 0, 0, 13149, 17307, 16667, 17174, 16598, 0, 28709,
+    28756, 8549, 0, 28746, 12432, 0, 12534, 0, 0, 28693, 6234, 11179, 12696, 5538, 11712, 10284,
+    0, 5026, 13008, 11237, 12383, 13174, 17240, 28801, 28756, 17249, 9240, 12996, 0, 16498, 32801, 16868,
+    17332, 0, 13157, 32841, 12708, 12816, 28727, 16451, 11765, 5673, 28732, 13139, 32828, 0, 8946, 0,
+    8649, 9253, 12395, 9175, 8419, 0, 12311, 9646, 8694, 12368, 8882, 12000, 9748, 32845, 0, 13148,
+    8948, 8963, 0, 11767, 0, 10582, 17309, 4447, 16439, 13068, 28748, 13152, 20484, 11179, 20482, 0,
+    17092, 9474, 13206, 8458, 28680, 4519, 28807, 9837, 0, 32918, 6464, 17251, 9001, 13052, 12540, 10880,
+    0, 11765, 20486, 12298, 0, 10583, 4869, 12454, 5395, 12642, 11909, 11451, 16756, 8739, 0, 0,
+    0, 6448, 13008, 0, 11946, 12359, 0, 32843, 9550, 17327, 10066, 16755, 0, 32843, 12869, 0,
+    12792, 12642, 12079, 16508, 5021, 16765, 0, 32935, 0, 13150, 5333, 0, 5384, 13055, 8883, 32776,
+    12396, 9559, 11478, 6455, 12079, 11503, 8918, 9779, 12815, 0, 0, 0, 11909, 0, 16587, 11978,
+    11871, 4668, 12654, 9624, 0, 28689, 10581, 12594, 12948, 0, 13150, 12776, 10284, 28804, 12965, 28717,
+    0, 8790, 12407, 0, 12440, 0, 13206, 0, 9986, 12477, 9262, 0, 10284, 11215, 32859, 28748,
+    16605, 0, 17348, 28803, 8411, 0, 8711, 17320, 12726, 13150, 16508, 0, 9300, 4621, 0, 16837,
+    16436, 12540, 12738, 11179, 16858, 8693, 12417, 12476, 28728, 13183, 0, 12310, 9750, 12738, 16448, 0,
+    4955, 0, 12347, 16451, 11750, 12696, 10285, 11170, 16746, 0, 16754, 10143, 32844, 12441, 9970, 13151,
+    32897, 9474, 32793, 12523, 28681, 9299, 0, 16754, 13140, 12079, 28791, 0, 28707, 0, 13032, 28682,
+    32816, 0, 8948, 9986, 5318, 0, 13127, 32780, 12610, 12048, 12324, 0, 28682, 0, 28702, 12600,
+    10806, 16746, 0, 16764, 8719, 28712, 11992, 9217, 0, 0, 13104, 17015, 6456, 28713, 13140, 12768,
+    0, 12642, 28792, 8584, 0, 28769, 12684, 12785, 0, 13139, 13187, 11750, 9559, 12869, 28690, 17317,
+    28724, 17117, 13020, 0, 9001, 32918, 28776, 17230, 12895, 10736, 17319, 9883, 16675, 0, 0, 16609,
+    11169, 28766, 28765, 0, 9986, 10373, 0, 0, 32779, 12347, 5254, 9056, 17052, 16587, 8664, 32819,
+    12762, 12065, 16755, 9560, 28749, 12420, 0, 16839, 20487, 0, 0, 5212, 0, 0, 9356, 16765,
+    12347, 12922, 0, 13163, 0, 0, 28714, 0, 0, 9837, 0, 11993, 12430, 12442, 9064, 8695,
+    16529, 12463, 9343, 11910, 0, 28748, 0, 28702, 4869, 32919, 0, 0, 13151, 12008, 0, 32919,
+    0, 0, 13160, 12605, 28690, 13044, 12431, 8765, 12645, 0, 17331, 13042, 8613, 28792, 0, 17249,
+    28808, 8365, 16808, 9254, 16858, 12871, 0, 0, 13140, 10998, 28814, 28768, 17252, 13172, 9308, 13171,
+    0, 28689, 12599, 0, 32919, 16885, 32819, 28729, 12879, 0, 0, 16766, 0, 9300, 13128, 9899,
+    12420, 8883, 0, 13161, 10882, 12444, 0, 0, 28767, 16688, 0, 12784, 17327, 11947, 0, 0,
+    0, 0, 12607, 28787, 28714, 9802, 6410, 13206, 11480, 13020, 12880, 17307, 9262, 32792, 12075, 12466,
+    0, 12828, 11777, 28728, 13068, 0, 8466, 20486, 12719, 5877, 32922, 13187, 13183, 0, 28676, 28732,
+    0, 12454, 0, 4468, 12396, 0, 12881, 20481, 10144, 16462, 12523, 0, 12064, 12900, 9851, 32857,
+    0, 10582, 28796, 8459, 0, 32924, 12984, 12572, 32818, 11955, 13138, 0, 28759, 28702, 16604, 28689,
+    20482, 32781, 0, 12074, 10150, 0, 12693, 12644, 17354, 12798, 8695, 16754, 12538, 11217, 11766, 16598,
+    10099, 12984, 9311, 0, 28738, 8766, 13054, 0, 13056, 28722, 8584, 0, 5249, 28810, 0, 9597,
+    0, 9854, 0, 13219, 13150, 12891, 16421, 16767, 0, 5247, 16874, 32845, 9850, 0, 28785, 12300,
+    12953, 8695, 9373, 28691, 11758, 12996, 12682, 12478, 28728, 11993, 0, 0, 0, 0, 13140, 0,
+    16449, 12935, 28775, 10442, 0, 32898, 8412, 9751, 9974, 0, 0, 12690, 10076, 11451, 0, 28792,
+    0, 16620, 8912, 13163, 12418, 8491, 28796, 0, 11767, 13198, 8919, 28688, 12347, 9598, 13174, 0,
+    12357, 32840, 28679, 9815, 12816, 13172, 0, 12595, 28689, 16517, 12655, 16880, 12467, 9606, 12991, 28701,
+    5260, 0, 11777, 12763, 10071, 17190, 11268, 12417, 0, 32816, 28786, 10883, 12548, 11767, 20483, 10048,
+    13172, 28722, 12694, 13163, 5313, 28759, 12881, 9343, 16808, 0, 28716, 12858, 10135, 13161, 12559, 12777,
+    17320, 16816, 0, 11780, 10071, 28678, 28693, 12560, 16419, 28760, 17038, 9801, 12431, 13176, 13160, 32832,
+    13151, 0, 16951, 0, 0, 8396, 0, 0, 0, 0, 9210, 13218, 28729, 0, 17251, 8458,
+    13173, 16816, 12890, 13068, 16696, 13210, 0, 0, 12561, 32911, 16536, 13068, 12631, 28703, 0, 10072,
+    8710, 11993, 0, 28707, 17095, 28701, 28703, 8912, 0, 0, 16934, 28808, 0, 12690, 28780, 12407,
+    12395, 12548, 12357, 16460, 12359, 16439, 0, 12989, 28720, 17332, 13150, 13173, 10713, 13185, 16697, 9852,
+    13150, 0, 9211, 4689, 12432, 0, 11777, 12786, 13184, 0, 0, 17328, 0, 5362, 12549, 12068,
+    0, 28773, 0, 13161, 0, 0, 0, 8397, 20481, 28773, 28821, 32923, 0, 0, 28717, 32840,
+    13208, 28808, 16607, 0, 16675, 13172, 32853, 0, 0, 8466, 12538, 0, 5872, 10452, 10998, 13218,
+    13183, 12075, 8920, 4691, 17327, 13207, 11513, 11777, 12300, 11947, 9907, 32831, 4722, 0, 13151, 8949,
+    28714, 32830, 12056, 12490, 9939, 12618, 10274, 32844, 11993, 12419, 0, 0, 28680, 0, 12442, 13161,
+    10940, 8964, 16894, 5814, 16832, 16430, 0, 12727, 10698, 0, 9939, 32853, 12882, 12455, 12323, 0,
+    28721, 28707, 32820, 28766, 11777, 28765, 32792, 0, 16776, 5769, 9255, 13186, 9913, 9044, 12009, 0,
+    17131, 12075, 10136, 12490, 0, 12560, 9022, 28700, 12740, 8366, 0, 16832, 13020, 8445, 16776, 4943,
+    12442, 8650, 13186, 13211, 32919, 28702, 16620, 28767, 13152, 28748, 10424, 9648, 12884, 28738, 0, 28745,
+    0, 5780, 0, 0, 4885, 9018, 28745, 12479, 17395, 28753, 9255, 5024, 12330, 12767, 16700, 0,
+    32833, 4694, 12454, 16675, 12753, 6083, 20485, 9364, 12574, 12001, 16620, 12620, 17410, 28688, 0, 16887,
+    12621, 28749, 12419, 8397, 13187, 8920, 0, 12454, 12526, 28758, 32880, 0, 13187, 9364, 32856, 0,
+    28781, 28806, 28749, 12512, 0, 8865, 0, 0, 0, 28746, 28727, 10078, 17116, 0, 0, 13174,
+    9363, 0, 12079, 5030, 12048, 9263, 0, 5491, 5771, 13151, 17003, 12699, 11768, 0, 12573, 5971,
+    12608, 28692, 17060, 12766, 16835, 11713, 32833, 13208, 12646, 0, 9642, 0, 12456, 12701, 12777, 0,
+    12512, 28693, 12700, 16965, 12527, 11233, 11033, 32833, 0, 10467, 4726, 11779, 9048, 12691, 5813, 32817,
+    9619, 8595, 8485, 17330, 0, 0, 17217, 0, 0, 17376, 12692, 13212, 8965, 12608, 28703, 9065,
+    28826, 28730, 12513, 0, 0, 13164, 0, 12548, 12478, 0, 8758, 0, 8397, 4949, 12823, 10113,
+    17394, 12998, 9816, 0, 12299, 0, 0, 12384, 0, 12871, 12894, 0, 0, 5658, 9911, 12609,
+    16439, 8452, 0, 11178, 5814, 12610, 12740, 13116, 12827, 0, 0, 9363, 9817, 13001, 12620, 12049,
+    0, 13185, 9518, 13000, 9002, 12477, 9651, 12798, 13001, 12871, 0, 16541, 9372, 13152, 12479, 12795,
+    0, 0, 5966, 0, 0, 0, 0, 12618, 0, 10114, 10441, 28749, 5417, 12898, 13116, 9661,
+    12076, 12056, 0, 0, 16894, 13211, 0, 28773, 0, 0, 12787, 12947, 5329, 9317, 8696, 12787,
+    0, 0, 11331, 32923, 11240, 9861, 12682, 0, 0, 12702, 17375, 0, 16435, 0, 0, 12049,
+    8711, 10442, 0, 0, 17394, 12700, 13152, 12560, 11253, 9906, 0, 12490, 32832, 0, 5316, 13198,
+    12551, 8397, 12620, 28811, 12478, 17069, 0, 11769, 28703, 0, 13184, 28695, 12335, 12502, 13011, 0,
+    0, 0, 0, 16911, 8995, 28728, 0, 32879, 8711, 0, 12789, 10405, 5563, 17361, 5900, 17331,
+    11057, 12888, 10144, 0, 10182, 13197, 0, 10708, 5552, 0, 32846, 13173, 9074, 16842, 28719, 12575,
+    10476, 10147, 5422, 8696, 12966, 32780, 11049, 12513, 16766, 11050, 0, 9906, 13174, 16775, 12574, 12610,
+    0, 0, 13164, 11049, 12372, 0, 0, 0, 13109, 28686, 28814, 9863, 12478, 32855, 0, 9861,
+    28773, 12478, 6275, 10156, 9817, 8412, 32846, 12905, 16904, 5482, 28785, 5334, 16538, 12798, 12959, 13152,
+    0, 11181, 12066, 12068, 0, 32844, 0, 28821, 12657, 12418, 9661, 16451, 9863, 16913, 5099, 9003,
+    17332, 0, 12787, 28753, 12896, 28769, 12514, 8775, 0, 28776, 28819, 8452, 0, 0, 13196, 0,
+    0, 10750, 16991, 16459, 5444, 0, 12396, 9309, 10449, 12905, 9854, 32781, 0, 11297, 13012, 12514,
+    20487, 9662, 12800, 9862, 28785, 28693, 12789, 10442, 13176, 12056, 12809, 16974, 12443, 0, 13222, 12371,
+    0, 10114, 32832, 12524, 13024, 0, 12896, 17328, 12444, 17369, 9938, 16529, 12610, 16451, 12598, 12811,
+    12720, 0, 12766, 9317, 17331, 12584, 5814, 0, 5113, 12620, 28822, 10152, 12920, 28775, 9817, 11348,
+    28752, 12904, 12897, 16922, 10796, 32891, 12012, 0, 0, 28749, 5105, 0, 16777, 12682, 17410, 12299,
+    12862, 16618, 12682, 28692, 16451, 28784, 16921, 0, 16834, 28773, 28777, 12717, 13209, 28729, 12562, 0,
+    10162, 0, 16699, 17410, 12478, 8485, 12884, 9960, 32831, 11012, 17002, 0, 12778, 28765, 0, 0,
+    17203, 5658, 11057, 32776, 12838, 11049, 17396, 10114, 12802, 12705, 12826, 12396, 28813, 16921, 13219, 28748,
+    12884, 0, 17060, 0, 28727, 9972, 12742, 5439, 9670, 0, 0, 16538, 32882, 12468, 10713, 16576,
+    28752, 10789, 13223, 28773, 9817, 5491, 12671, 28775, 0, 32931, 16843, 10750, 20485, 13005, 0, 13221,
+    32904, 0, 12078, 0, 10414, 11356, 28774, 11334, 16912, 16463, 0, 10883, 5499, 16982, 28821, 17161,
+    8359, 0, 11678, 10498, 28753, 28690, 5498, 0, 11095, 12695, 28826, 10452, 0, 12432, 11479, 10196,
+    28684, 17405, 10252, 10505, 10194, 12610, 10194, 32868, 10415, 16922, 16921, 28686, 0, 0, 28786, 12706,
+    0, 28796, 11395, 32820, 11334, 0, 12905, 28695, 12852, 28820, 32870, 8785, 9900, 28821, 11470, 9956,
+    12902, 5649, 0, 9968, 28825, 0, 12611, 28701, 16699, 17053, 9952, 16621, 12694, 17385, 17124, 10161,
+    13122, 0, 12743, 12896, 0, 11057, 17139, 0, 12863, 0, 28731, 11042, 0, 13221, 17069, 16992,
+    20486, 10544, 13220, 16924, 0, 11088, 8359, 12599, 11769, 28729, 10751, 12801, 11042, 28822, 16922, 16924,
+    0, 0, 28702, 13012, 10198, 0, 28824, 0, 16913, 28775, 9382, 10796, 10804, 16912, 9319, 10207,
+    9908, 13013, 0, 0, 8423, 0, 12432, 8752, 28761, 16991, 10460, 10796, 32883, 12515, 5665, 0,
+    12647, 16844, 32892, 11430, 0, 9854, 16925, 12563, 20488, 13188, 0, 10505, 12670, 0, 0, 0,
+    28758, 20488, 16913, 12802, 32805, 16670, 12919, 17203, 28798, 11611, 9908, 5484, 0, 16541, 32905, 11700,
+    10216, 13223, 12791, 9917, 11567, 16982, 0, 10195, 0, 10486, 28787, 0, 28682, 12911, 12408, 17158,
+    12790, 0, 12706, 13133, 11603, 11436, 9620, 10813, 12814, 32859, 12979, 28826, 28679, 0, 0, 28784,
+    12491, 28737, 17139, 28825, 9058, 0, 12908, 12705, 0, 16617, 17069, 12504, 28769, 12730, 11050, 9916,
+    28803, 0, 9972, 12767, 28783, 0, 16924, 10162, 13014, 0, 12838, 0, 17071, 0, 28752, 11095,
+    11182, 0, 12991, 12491, 32854, 28774, 17158, 0, 20488, 0, 5614, 0, 28772, 0, 0, 10162,
+    28776, 28799, 32881, 9908, 9863, 13074, 12079, 13212, 12419, 12906, 6344, 0, 12587, 28747, 13223, 12527,
+    17132, 0, 0, 11050, 28797, 10804, 0, 8460, 17159, 32924, 0, 11629, 9863, 10497, 0, 9918,
+    12516, 0, 0, 8453, 12931, 12863, 12803, 16923, 12646, 0, 32868, 28765, 28760, 17397, 12899, 16461,
+    0, 11551, 17210, 28822, 0, 13220, 0, 12754, 10153, 0, 0, 11112, 32880, 9973, 13208, 8704,
+    12635, 10237, 9321, 17172, 12528, 9377, 12623, 5651, 10804, 17376, 0, 12908, 12444, 12875, 28772, 11380,
+    17140, 17061, 32857, 0, 12408, 12610, 0, 0, 10116, 8460, 0, 0, 0, 17001, 0, 0,
+    0, 12468, 0, 28689, 28691, 17148, 11087, 12930, 28721, 32871, 9979, 12731, 0, 12931, 12717, 17406,
+    10238, 10240, 12718, 0, 12348, 12609, 32820, 5459, 16925, 16853, 28751, 12849, 32897, 28819, 0, 5830,
+    12636, 11610, 9321, 12813, 28708, 28753, 17069, 28765, 10714, 17158, 28826, 10797, 32870, 6015, 12837, 11349,
+    16779, 0, 12946, 17377, 28775, 16922, 20481, 10216, 32894, 5968, 0, 17369, 0, 6051, 12720, 28703,
+    0, 12624, 13200, 16619, 11610, 13018, 12576, 5499, 28708, 0, 9619, 16992, 12943, 0, 12336, 0,
+    32855, 28828, 28739, 12875, 11112, 0, 17253, 11380, 17377, 0, 28765, 12909, 0, 17241, 17299, 12622,
+    12922, 12444, 13025, 0, 32872, 17140, 11596, 0, 0, 0, 13224, 0, 0, 17070, 10460, 0,
+    5498, 8975, 28778, 9365, 12803, 0, 10498, 16463, 12897, 12920, 5651, 12942, 12456, 5628, 28828, 13016,
+    13110, 12943, 16856, 11769, 17079, 10813, 10853, 12550, 28787, 10580, 10273, 11647, 0, 0, 17388, 11349,
+    12802, 12887, 13223, 17071, 11135, 13040, 28763, 16983, 20489, 13222, 12378, 13017, 17411, 10515, 28713, 0,
+    12768, 0, 28749, 28776, 11457, 28786, 5499, 9974, 12801, 0, 9067, 0, 16647, 28741, 17386, 17397,
+    16620, 28827, 17411, 28822, 28703, 6466, 0, 0, 17140, 28776, 0, 32935, 0, 0, 12574, 12468,
+    11469, 0, 0, 32905, 13098, 16993, 0, 0, 12479, 11686, 32790, 6394, 32881, 11349, 28777, 0,
+    13006, 0, 12492, 12312, 20489, 28752, 12551, 10507, 12491, 13004, 32907, 0, 0, 0, 0, 0,
+    12635, 11058, 12743, 17219, 12717, 13220, 0, 9374, 17071, 13097, 12576, 17062, 0, 0, 9619, 12432,
+    10852, 0, 12779, 9919, 28753, 12824, 0, 0, 11103, 13074, 6058, 12812, 13098, 11430, 11655, 8470,
+    0, 28738, 16620, 17399, 0, 9075, 9012, 12812, 16934, 28797, 16461, 28798, 28749, 0, 0, 32815,
+    32832, 28826, 0, 5658, 0, 0, 0, 12730, 28707, 11096, 16456, 10878, 0, 12995, 32935, 0,
+    11387, 28765, 12944, 0, 28765, 20486, 12480, 28788, 8479, 10253, 0, 17290, 0, 12420, 16779, 13025,
+    28787, 11734, 0, 17090, 28782, 28802, 0, 0, 12921, 13007, 13175, 0, 12492, 0, 0, 9666,
+    12825, 12684, 11349, 32857, 5499, 0, 12922, 11655, 9657, 9919, 6299, 13027, 13016, 0, 12684, 28759,
+    10246, 0, 10153, 12910, 17158, 0, 6288, 28732, 0, 5665, 17151, 0, 13198, 17399, 0, 17141,
+    13080, 11711, 0, 28786, 11151, 12824, 12480, 32854, 12911, 28778, 12456, 0, 12576, 12612, 10562, 12648,
+    0, 0, 17388, 28825, 9965, 12932, 12767, 0, 8909, 0, 13121, 0, 0, 8329, 0, 12480,
+    0, 10257, 28812, 12875, 28763, 12908, 13007, 0, 0, 0, 17169, 12921, 9665, 11709, 12887, 28804,
+    0, 32897, 32778, 0, 11410, 5666, 12420, 28788, 28785, 16463, 9965, 16934, 6044, 0, 12943, 32881,
+    0, 0, 12919, 11395, 0, 11817, 32936, 32934, 11693, 28800, 17002, 0, 17090, 12824, 12994, 12704,
+    11686, 17003, 12708, 28813, 11693, 11686, 28811, 10269, 9956, 28822, 16924, 6174, 0, 12575, 12960, 0,
+    10844, 0, 28785, 0, 0, 12908, 16777, 0, 12420, 0, 10208, 17148, 17227, 0, 0, 13028,
+    17398, 28800, 0, 32936, 9973, 5666, 0, 11159, 13039, 32884, 0, 0, 13063, 11711, 12516, 13029,
+    9240, 0, 0, 28799, 10161, 12946, 6058, 0, 9086, 17230, 10571, 6058, 12943, 17072, 10506, 13052,
+    9974, 28804, 10559, 0, 4842, 16621, 11412, 8779, 0, 28822, 0, 9973, 10199, 32879, 32917, 0,
+    12684, 9674, 8786, 0, 6402, 17004, 0, 17062, 11096, 13050, 5499, 0, 10551, 0, 10264, 28767,
+    28779, 0, 12669, 12825, 32896, 11470, 0, 28801, 32909, 12611, 12981, 0, 9085, 13051, 11443, 28785,
+    11159, 12935, 0, 0, 28800, 0, 12804, 9683, 28755, 13132, 32892, 11693, 0, 12767, 9674, 28769,
+    6174, 12324, 0, 32895, 11143, 0, 13132, 13220, 12002, 0, 11169, 32883, 12510, 13042, 10452, 0,
+    13067, 13028, 13124, 0, 12539, 0, 0, 32883, 12575, 10852, 17079, 0, 0, 11412, 17247, 28782,
+    17409, 11395, 10218, 6233, 16463, 9665, 0, 8788, 11443, 16806, 0, 17012, 28782, 10304, 13039, 32917,
+    11734, 17151, 0, 32833, 17172, 0, 11167, 17140, 0, 10554, 17409, 16846, 0, 11656, 0, 10272,
+    12732, 12899, 0, 0, 11611, 17071, 12945, 0, 16579, 0, 12934, 12533, 13110, 0, 0, 16937,
+    6448, 12825, 16935, 0, 12516, 8769, 11977, 0, 0, 6218, 0, 0, 12612, 9078, 0, 6385,
+    12934, 13063, 0, 32884, 0, 6357, 32872, 11395, 32841, 12456, 8469, 0, 28781, 10263, 12582, 32817,
+    6292, 9973, 12720, 11159, 28791, 12564, 16934, 28745, 11647, 12912, 28737, 32806, 16523, 10218, 0, 17332,
+    13031, 12534, 28732, 28702, 11450, 12911, 0, 12308, 28764, 13042, 0, 12946, 32936, 10869, 0, 28766,
+    16779, 16993, 32870, 9956, 32934, 6454, 12900, 32871, 11611, 12780, 9919, 32910, 0, 0, 11436, 0,
+    0, 32845, 13040, 0, 0, 0, 17316, 0, 10562, 0, 11161, 32893, 28787, 12911, 11655, 32858,
+    32884, 10255, 28809, 10759, 12706, 12480, 6059, 12824, 28721, 11059, 0, 13066, 12768, 8313, 17012, 0,
+    16934, 28802, 0, 16690, 16456, 32894, 12730, 17219, 9387, 12528, 0, 13098, 11711, 0, 10282, 6401,
+    0, 0, 0, 0, 12970, 9676, 0, 28789, 9514, 12910, 0, 10285, 17240, 0, 0, 32909,
+    12708, 6051, 28726, 11978, 0, 28696, 12816, 0, 12875, 0, 10263, 28769, 8642, 16838, 10277, 0,
+    0, 12936, 0, 28813, 10272, 28782, 28742, 16429, 17090, 12648, 28789, 0, 12623, 28798, 0, 28725,
+    16517, 10562, 12540, 13077, 0, 10264, 9985, 12612, 12580, 13114, 32909, 0, 9684, 0, 0, 13136,
+    6233, 9684, 8576, 0, 0, 0, 0, 17238, 12935, 6188, 0, 0, 10517, 11450, 32858, 32846,
+    0, 10814, 9965, 11775, 13029, 0, 11729, 17149, 32906, 0, 32910, 32893, 12900, 0, 12921, 0,
+    0, 32881, 32909, 0, 13019, 0, 0, 0, 10860, 0, 17169, 0, 13054, 0, 13157, 8649,
+    5674, 28828, 10869, 28774, 12683, 17407, 10862, 13055, 0, 0, 10815, 0, 6364, 12570, 0, 12334,
+    11450, 12887, 0, 10517, 9550, 12936, 0, 0, 13019, 10274, 0, 13148, 17396, 28697, 0, 11104,
+    12420, 0, 12816, 0, 12501, 6387, 0, 0, 28738, 20489, 11648, 13074, 0, 9802, 0, 0,
+    8479, 9068, 0, 13075, 28770, 0, 17003, 0, 8491, 9985, 28796, 0, 0, 28732, 12665, 6464,
+    0, 13143, 0, 12876, 17002, 10105, 13079, 12994, 11113, 32924, 0, 9686, 10517, 28827, 32910, 8905,
+    12720, 32830, 10263, 28798, 12909, 11113, 10279, 9687, 28810, 6189, 12379, 9975, 17094, 0, 9508, 13042,
+    0, 0, 0, 28800, 9684, 12825, 17080, 0, 0, 13051, 9986, 17238, 12582, 32846, 8256, 12612,
+    0, 12921, 13006, 9983, 13041, 10282, 0, 0, 17239, 10806, 10263, 0, 28703, 12720, 11648, 0,
+    11411, 12404, 10582, 12394, 12570, 0, 28748, 6364, 9685, 17013, 32790, 0, 0, 8790, 12464, 0,
+    12762, 17316, 16937, 10699, 13212, 6189, 0, 12911, 12792, 8944, 17240, 0, 28745, 28772, 10573, 28678,
+    0, 0, 10043, 12451, 0, 17228, 0, 8256, 0, 9839, 13175, 13212, 17173, 28746, 4572, 32872,
+    0, 17162, 12761, 0, 0, 12677, 12545, 10571, 0, 28677, 28755, 11611, 12008, 28813, 12476, 0,
+    10280, 10141, 0, 10879, 0, 32858, 12857, 0, 32858, 12869, 12427, 11042, 0, 12840, 28746, 0,
+    13075, 28767, 11713, 0, 13111, 16745, 12369, 13040, 12912, 32894, 0, 12416, 9687, 0, 32842, 17307,
+    0, 0, 11702, 28800, 0, 0, 0, 28810, 13030, 0, 12311, 12427, 10592, 17160, 28708, 13043,
+    12678, 9181, 0, 13052, 13122, 28815, 28728, 12912, 9500, 0, 10282, 17298, 11395, 12888, 12630, 0,
+    32830, 28696, 0, 0, 32872, 0, 13041, 17117, 11058, 0, 12333, 13222, 6226, 13043, 13029, 0,
+    28747, 0, 9181, 5211, 0, 0, 10280, 12612, 17250, 8911, 32859, 12864, 5674, 0, 9801, 11470,
+    11712, 0, 9591, 12693, 17093, 13042, 32778, 28801, 16509, 12773, 0, 17095, 10571, 28701, 12923, 0,
+    32884, 9985, 12924, 0, 11742, 4673, 17307, 0, 12816, 13146, 0, 11972, 17306, 8350, 0, 0,
+    12359, 11742, 12921, 13111, 0, 12696, 8320, 28810, 28789, 12900, 28733, 0, 10572, 20484, 13068, 0,
+    16517, 0, 9549, 0, 8284, 0, 16421, 0, 28755, 28815, 28810, 12476, 16936, 11468, 0, 32778,
+    9686, 8994, 0, 0, 12774, 12369, 28803, 8320, 0, 28796, 13076, 10274, 0, 9687, 0, 0,
+    0, 28808, 10913, 11611, 9836, 12502, 9307, 13008, 12416, 16857, 12371, 17174, 10497, 13212, 9687, 0,
+    0, 12417, 0, 13075, 0, 28810, 12823, 9985, 9975, 32830, 0, 13008, 10273, 0, 17241, 6457,
+    12357, 28760, 13032, 0, 16754, 0, 11113, 6401, 17172, 0, 10285, 32869, 0, 12895, 13224, 11767,
+    13183, 11476, 13090, 12738, 13066, 0, 32910, 28816, 28702, 12900, 32830, 32818, 0, 17091, 12512, 13020,
+    16687, 4927, 10573, 32806, 5195, 12780, 0, 9986, 11179, 12719, 16904, 8431, 16815, 0, 5491, 8490,
+    9985, 28812, 4930, 0, 12873, 28813, 0, 16887, 8692, 10572, 28789, 9779, 10861, 0, 12491, 9676,
+    12984, 0, 10077, 13043, 0, 17241, 16598, 20487, 0, 0, 0, 16440, 0, 32844, 10032, 10563,
+    11702, 17298, 0, 13052, 17306, 28721, 0, 12900, 9560, 28812, 11735, 0, 10027, 0, 13008, 12608,
+    0, 0, 17172, 11742, 28738, 17248, 12654, 32921, 28734, 8390, 12840, 9451, 8955, 12510, 12816, 13139,
+    0, 0, 16744, 20484, 13184, 13008, 0, 0, 9772, 0, 0, 8948, 16650, 28715, 0, 12557,
+    32816, 0, 12502, 12700, 0, 13042, 28810, 8846, 0, 28714, 16806, 9839, 28747, 0, 0, 12453,
+    17038, 28796, 28718, 13079, 0, 28733, 12492, 11470, 12706, 9388, 11768, 16500, 12392, 12371, 11459, 13187,
+    28814, 28813, 8619, 0, 6465, 11932, 28736, 13156, 16937, 16579, 10309, 12671, 16991, 0, 10285, 32831,
+    12791, 28723, 28700, 11468, 0, 28810, 0, 13041, 32909, 10584, 0, 13079, 12571, 28718, 11181, 9203,
+    13138, 32910, 12718, 28714, 28699, 16579, 0, 16490, 0, 12888, 10460, 10675, 0, 32829, 0, 8963,
+    32817, 8963, 12924, 4587, 0, 28729, 28709, 9286, 12381, 13157, 13147, 16667, 9974, 13076, 0, 17227,
+    32841, 0, 28698, 32844, 28730, 12321, 0, 17399, 13196, 28812, 16448, 10406, 0, 28789, 9262, 12795,
+    8963, 0, 16448, 13077, 0, 32885, 13148, 12796, 0, 11656, 12716, 6465, 32918, 12750, 13068, 8882,
+    32867, 32892, 0, 11470, 16923, 12881, 11985, 10282, 0, 12694, 28729, 28749, 4614, 0, 10882, 12900,
+    9286, 16753, 0, 0, 12750, 28814, 12552, 28815, 13182, 0, 32778, 32778, 0, 10582, 10998, 9986,
+    0, 28812, 9287, 9247, 12846, 5541, 0, 11181, 16753, 11702, 12430, 0, 28815, 12900, 9773, 13078,
+    0, 11776, 10583, 8396, 17353, 0, 5249, 9815, 28748, 0, 12454, 12490, 11939, 9480, 17249, 10974,
+    13079, 16518, 32846, 0, 9300, 0, 13138, 9017, 16765, 10582, 12523, 12924, 32805, 4810, 16438, 0,
+    9515, 9254, 0, 28676, 11170, 20485, 11750, 13163, 8656, 0, 0, 10284, 12583, 28729, 10116, 10862,
+    28811, 8646, 0, 10272, 11171, 0, 12476, 0, 0, 9240, 12429, 16763, 11219, 0, 16857, 17014,
+    32872, 0, 6448, 28745, 13151, 0, 0, 16829, 9985, 13125, 16500, 12700, 9598, 8647, 28814, 0,
+    12547, 12936, 11978, 0, 17327, 0, 28813, 8411, 4869, 0, 32859, 0, 0, 13064, 32911, 12977,
+    5025, 9217, 28773, 13115, 9985, 28697, 12559, 17320, 28728, 10095, 0, 8702, 10066, 0, 10095, 13194,
+    12404, 13032, 0, 16597, 17218, 11459, 9316, 11778, 12001, 8358, 11767, 10273, 13044, 8912, 17319, 12064,
+    13196, 32844, 0, 28756, 0, 8920, 9808, 8649, 16666, 9779, 12431, 9808, 10144, 28712, 12395, 12407,
+    0, 12893, 0, 11410, 9001, 13032, 0, 0, 16857, 32807, 5755, 13020, 0, 9802, 28724, 32919,
+    10441, 0, 11160, 17171, 17016, 12689, 13161, 9814, 12489, 12610, 0, 12900, 12490, 17016, 8748, 13187,
+    17317, 9300, 32923, 9001, 0, 0, 0, 0, 17252, 32804, 4624, 28740, 12895, 12705, 17174, 12796,
+    0, 12740, 0, 13149, 12834, 12429, 10883, 11909, 12787, 0, 10583, 11268, 0, 0, 12884, 0,
+    8710, 0, 0, 13194, 11479, 0, 8446, 28729, 13161, 0, 13152, 12477, 10572, 28720, 0, 0,
+    17252, 10341, 6402, 12549, 5264, 10132, 9317, 0, 32863, 5099, 10641, 10813, 10880, 5802, 0, 8710,
+    0, 16976, 28715, 0, 10189, 0, 11767, 13150, 16438, 0, 16968, 10374, 16579, 8351, 0, 32923,
+    0, 0, 9845, 0, 0, 9546, 11334, 0, 13184, 10284, 16815, 12477, 12573, 0, 28678, 12478,
+    9907, 12611, 12501, 9884, 17253, 13162, 28816, 6411, 0, 12785, 32831, 32918, 10389, 28701, 12693, 12874,
+    28811, 11776, 13020, 11750, 12966, 0, 13186, 28774, 12417, 0, 9884, 13160, 12418, 12065, 0, 20490,
+    12048, 0, 13150, 12443, 16766, 0, 13015, 12298, 0, 9653, 28678, 8403, 17253, 28810, 12696, 17195,
+    13150, 9553, 12790, 11909, 32819, 9601, 8322, 11910, 13171, 8420, 13161, 16451, 16606, 0, 0, 12672,
+    0, 12370, 10077, 13196, 5409, 13173, 28821, 20490, 13152, 5026, 9851, 12573, 0, 0, 10940, 0,
+    10699, 17253, 32921, 12576, 28752, 11297, 16974, 12786, 16903, 13163, 0, 28776, 16887, 32859, 17320, 12608,
+    16964, 12479, 16913, 12767, 4983, 28711, 28734, 28677, 12527, 0, 16910, 12034, 0, 32867, 13151, 12523,
+    0, 12692, 12515, 11910, 0, 10285, 11700, 32885, 28678, 28825, 12335, 28685, 9916, 0, 12503, 28758,
+    28757, 13068, 28720, 11224, 12323, 0, 9311, 9846, 10425, 0, 28792, 16901, 12606, 10443, 10144, 9918,
+    12490, 10160, 0, 10376, 13091, 28784, 0, 0, 16528, 16815, 0, 28758, 16921, 28735, 16764, 12344,
+    5075, 12702, 10107, 11779, 9073, 13092, 0, 0, 9809, 4982, 13044, 28719, 0, 12430, 11769, 32831,
+    12431, 9057, 12502, 4885, 11481, 12549, 13163, 11758, 12655, 28731, 16767, 16977, 0, 12631, 10113, 0,
+    28802, 13209, 10107, 16903, 9564, 11081, 11992, 10422, 0, 16440, 0, 0, 10782, 13044, 6410, 0,
+    5418, 13127, 28774, 10405, 16913, 0, 12802, 12575, 16766, 9906, 32923, 9817, 12682, 0, 12465, 28813,
+    28739, 6365, 10158, 16904, 13212, 16910, 28763, 11993, 0, 0, 12009, 0, 13001, 13184, 11035, 28723,
+    12681, 20486, 9606, 12790, 0, 13160, 12599, 0, 11710, 0, 32911, 0, 11767, 28731, 0, 9862,
+    12453, 9859, 9846, 12695, 0, 0, 16924, 12911, 8713, 13140, 16903, 12764, 16902, 28706, 12693, 10675,
+    28787, 0, 12693, 13151, 28772, 10153, 13163, 12299, 12924, 28763, 12478, 8452, 8696, 12479, 13001, 8405,
+    13208, 0, 17170, 0, 9020, 13101, 11910, 0, 28733, 12701, 13173, 12716, 12751, 32807, 8749, 13152,
+    32930, 10929, 12610, 17000, 12683, 16617, 11179, 12895, 13176, 0, 13206, 12010, 5318, 11521, 4982, 12730,
+    12526, 13211, 16767, 28738, 13080, 0, 12692, 12871, 32921, 12467, 12790, 16451, 32879, 10078, 28792, 6232,
+    12478, 32921, 9937, 12504, 13163, 12906, 12514, 0, 12681, 12502, 0, 0, 9941, 17410, 32923, 13032,
+    16617, 28733, 28780, 0, 12683, 9264, 11057, 20481, 12634, 10190, 13161, 12694, 0, 28732, 0, 12798,
+    8657, 13151, 16775, 9854, 16835, 10199, 17149, 12791, 12055, 12431, 8666, 9972, 0, 12704, 16767, 12716,
+    32833, 16914, 28731, 32922, 12074, 10196, 12847, 0, 28770, 32820, 12811, 0, 12788, 9601, 9654, 28825,
+    13174, 5491, 13128, 5367, 0, 12490, 10415, 28786, 13174, 16921, 28813, 28773, 0, 32892, 20488, 0,
+    0, 10113, 9900, 12996, 6465, 32846, 13174, 13080, 12779, 12067, 11481, 12812, 0, 17327, 9899, 16982,
+    12000, 0, 8719, 20490, 32933, 28745, 12900, 12683, 32868, 0, 0, 28813, 8404, 12898, 9817, 9364,
+    28757, 0, 12996, 0, 12619, 17053, 12898, 13218, 28824, 10208, 12622, 16991, 10197, 11993, 8995, 0,
+    0, 32820, 28804, 10181, 12908, 17320, 0, 13186, 12562, 12524, 0, 32869, 11035, 12797, 10502, 12876,
+    12041, 5484, 11356, 13218, 17012, 28787, 9909, 32862, 13140, 9050, 12919, 17297, 12990, 12706, 32855, 12077,
+    12504, 12800, 0, 12812, 32867, 17080, 0, 9662, 12079, 11450, 12788, 0, 13211, 12908, 8367, 28775,
+    16699, 32832, 12717, 28826, 13164, 20481, 12708, 8459, 9648, 12644, 9050, 12372, 12001, 28825, 28814, 17053,
+    10751, 9311, 0, 32931, 11567, 9317, 5970, 0, 0, 13163, 28785, 12930, 13164, 13211, 10161, 10460,
+    0, 12978, 0, 0, 0, 0, 17132, 10460, 16766, 32931, 13056, 0, 17410, 0, 9913, 28803,
+    12720, 17328, 5484, 32881, 16541, 10814, 11334, 12056, 10562, 11013, 12909, 12610, 0, 9909, 0, 13026,
+    5651, 0, 0, 17210, 28765, 12312, 28752, 28763, 0, 12491, 0, 10199, 12704, 11467, 10207, 11633,
+    16974, 0, 16778, 0, 13212, 17053, 0, 0, 0, 10804, 11778, 16777, 13016, 17332, 28780, 0,
+    17410, 28787, 28701, 12887, 32892, 12779, 12001, 16844, 13116, 28752, 0, 28756, 32933, 0, 0, 12075,
+    0, 12515, 12718, 9671, 11518, 10488, 10162, 11633, 32857, 12791, 16721, 0, 12789, 12621, 16982, 16774,
+    16606, 28738, 32868, 0, 11050, 5265, 17328, 16983, 11678, 32908, 28813, 16460, 16648, 0, 9891, 12823,
+    32833, 9899, 6099, 9863, 28808, 12743, 28755, 11758, 9938, 28773, 17332, 17410, 10804, 11779, 13218, 13219,
+    12705, 12620, 17140, 32883, 16912, 17405, 17332, 12825, 10797, 10250, 16497, 0, 8744, 5484, 28752, 8758,
+    13018, 28789, 0, 0, 0, 28721, 28774, 10205, 0, 28786, 11411, 5754, 28821, 12693, 28820, 17410,
+    16993, 28676, 0, 12933, 6409, 12360, 5876, 0, 32880, 11013, 10216, 11679, 28776, 28730, 32781, 5484,
+    10415, 12716, 13198, 12904, 28799, 0, 16450, 9342, 0, 12694, 13005, 12803, 32868, 9687, 16983, 12920,
+    10216, 32894, 10461, 0, 12778, 17062, 12910, 28792, 16913, 28753, 11679, 5787, 13211, 10571, 12478, 13188,
+    17354, 5367, 12694, 13210, 13186, 0, 12539, 12800, 12791, 32931, 16619, 12911, 28804, 12611, 17053, 13208,
+    0, 0, 0, 12898, 32880, 17331, 0, 12514, 28804, 17227, 12525, 32895, 12812, 17331, 28754, 12527,
+    17158, 0, 0, 11380, 9382, 13221, 17377, 8460, 12993, 11385, 28765, 17331, 11096, 0, 13012, 17411,
+    0, 11050, 28753, 0, 12610, 5808, 17158, 12708, 0, 5614, 0, 0, 16778, 0, 17140, 10190,
+    5585, 0, 0, 11596, 32935, 28804, 11103, 17003, 17061, 0, 12645, 0, 12824, 28816, 10543, 12647,
+    0, 32833, 28768, 0, 12696, 28798, 0, 17001, 11312, 12827, 12480, 12515, 32869, 9065, 17328, 32856,
+    32924, 0, 0, 12300, 28799, 0, 10498, 0, 0, 17141, 28707, 0, 13053, 8333, 8486, 32931,
+    28731, 17071, 13066, 0, 9373, 28778, 9619, 12824, 12611, 6145, 32933, 0, 32845, 28788, 10714, 16935,
+    11955, 28712, 0, 20490, 8785, 12933, 12012, 10153, 17385, 13220, 12800, 9373, 32870, 0, 12707, 11349,
+    28774, 28828, 28754, 0, 9383, 0, 0, 13024, 10516, 12792, 0, 28776, 0, 28788, 11358, 0,
+    11601, 0, 16992, 13218, 10214, 32894, 0, 0, 12897, 16983, 13223, 11412, 11947, 13172, 17218, 0,
+    12991, 28804, 0, 9648, 6211, 10208, 12899, 0, 0, 17395, 12741, 11693, 17140, 12480, 13026, 10514,
+    10216, 9917, 13212, 13015, 17070, 12862, 32871, 28806, 0, 12980, 28768, 17061, 9919, 32897, 12360, 17001,
+    0, 16993, 9909, 11137, 12921, 6409, 0, 0, 0, 0, 12420, 9916, 0, 0, 12623, 32871,
+    0, 0, 12909, 0, 12056, 8453, 10571, 16538, 12910, 12946, 16461, 32893, 28777, 11435, 13200, 11534,
+    12683, 12707, 32883, 10759, 0, 12933, 11096, 8486, 32893, 16463, 0, 32935, 28776, 17151, 17387, 11151,
+    12396, 0, 13042, 4440, 0, 16776, 28785, 12444, 0, 16937, 10545, 0, 12899, 10269, 12947, 11710,
+    13066, 0, 12491, 0, 10216, 28828, 0, 28773, 16463, 13200, 0, 0, 6044, 0, 0, 28798,
+    0, 10506, 28828, 28801, 5499, 0, 12994, 0, 28787, 11700, 9973, 17220, 12911, 32910, 13176, 0,
+    0, 12623, 0, 13054, 28751, 0, 11404, 12066, 0, 13223, 13031, 17368, 0, 0, 32833, 17140,
+    10263, 13200, 10217, 11096, 9961, 28786, 0, 12827, 17331, 13127, 0, 12719, 10246, 28798, 10234, 10262,
+    12480, 28762, 12971, 32885, 11312, 28801, 32871, 17395, 9665, 17230, 10217, 5666, 11144, 28766, 6020, 10208,
+    12827, 12898, 11749, 13015, 9087, 12803, 13028, 5927, 10252, 32845, 32935, 9947, 28798, 12420, 9980, 0,
+    12504, 0, 12079, 0, 28754, 32896, 11049, 17160, 32897, 0, 13023, 28811, 32884, 0, 9982, 28801,
+    0, 0, 28726, 17405, 32905, 9956, 8775, 12420, 0, 28787, 0, 12778, 0, 0, 12511, 32932,
+    0, 28742, 0, 12791, 9152, 0, 28775, 10261, 28810, 11112, 12684, 32806, 8678, 13223, 10214, 0,
+    11050, 32833, 28808, 13029, 28731, 17369, 4826, 0, 10300, 0, 28800, 12605, 10572, 0, 0, 28737,
+    32858, 32885, 16499, 0, 0, 12382, 28788, 5113, 16893, 13137, 12348, 28827, 0, 28816, 0, 9961,
+    0, 16932, 0, 0, 12695, 0, 28816, 0, 12621, 28802, 0, 13027, 0, 12803, 32871, 12600,
+    12546, 28822, 0, 10255, 17002, 20486, 0, 12504, 28775, 0, 9518, 10217, 9955, 0, 17396, 28788,
+    11152, 28749, 0, 12477, 12564, 28762, 0, 0, 11168, 16428, 12624, 16934, 0, 16932, 32910, 9077,
+    12612, 17094, 28738, 12465, 32884, 28774, 0, 28801, 28821, 0, 0, 32935, 0, 13007, 9974, 17399,
+    16779, 13176, 17385, 32833, 0, 9374, 10616, 28762, 28757, 9261, 10270, 0, 0, 28822, 0, 9919,
+    13031, 12491, 9503, 10270, 5673, 10515, 11114, 12379, 12444, 32896, 10814, 0, 32924, 0, 12947, 28827,
+    28803, 32846, 0, 28702, 32908, 0, 0, 9973, 32802, 12579, 0, 0, 13053, 0, 5882, 12384,
+    0, 0, 10805, 0, 0, 0, 0, 0, 6020, 13147, 13029, 0, 9963, 13031, 28827, 17329,
+    11115, 12922, 8619, 0, 6112, 17093, 16925, 32790, 13085, 13194, 13220, 12474, 28786, 9971, 0, 13030,
+    12516, 12791, 0, 10259, 12695, 0, 12934, 13017, 28799, 32907, 0, 11710, 9963, 0, 28776, 10120,
+    17169, 11404, 17408, 0, 12720, 8343, 10216, 12346, 12552, 5498, 28825, 4555, 13018, 9964, 28691, 17241,
+    6277, 12658, 11710, 8470, 28821, 0, 13163, 16993, 28800, 0, 0, 9387, 0, 16846, 16429, 13040,
+    6299, 10218, 17280, 0, 0, 0, 4424, 28824, 12624, 17012, 17220, 0, 17159, 12729, 11113, 5666,
+    0, 32818, 28790, 12523, 0, 32885, 10542, 28813, 32884, 28802, 28801, 0, 0, 17003, 9919, 12768,
+    13065, 0, 0, 0, 0, 13076, 17159, 17377, 12708, 0, 9684, 32909, 32872, 12510, 12480, 32908,
+    12606, 12957, 17240, 17410, 0, 32858, 12432, 11992, 9552, 28754, 10218, 10272, 28733, 16815, 12444, 13132,
+    28751, 32804, 8610, 8584, 6188, 12696, 11115, 17160, 12533, 28741, 16806, 0, 12695, 0, 28678, 10218,
+    12888, 17016, 12815, 9383, 13031, 8277, 0, 9919, 9974, 0, 0, 17289, 12920, 32802, 10038, 0,
+    10255, 28728, 16430, 9387, 0, 32841, 32859, 16925, 11648, 8879, 32908, 28755, 9979, 28722, 0, 16657,
+    9130, 0, 13098, 20489, 32936, 13223, 28746, 0, 10273, 17252, 8346, 12603, 0, 0, 4300, 16648,
+    0, 17169, 0, 9982, 9918, 28763, 0, 0, 0, 0, 6059, 0, 28703, 17386, 12708, 28810,
+    9480, 17083, 13079, 28689, 28763, 0, 32859, 28826, 0, 0, 12480, 11694, 28811, 32790, 0, 0,
+    12453, 17319, 11414, 32909, 6447, 16508, 12708, 0, 28802, 8941, 0, 28704, 12716, 9984, 28773, 0,
+    20485, 0, 16887, 28803, 12492, 12588, 0, 9508, 0, 16936, 9181, 0, 9919, 0, 16974, 0,
+    12791, 0, 32777, 28731, 28809, 13019, 32840, 0, 0, 28764, 0, 28767, 0, 10218, 13053, 28739,
+    10272, 28732, 28756, 32817, 28725, 28758, 17398, 0, 10562, 28790, 0, 6392, 0, 12355, 13222, 32872,
+    16587, 16974, 13078, 28763, 0, 17297, 9387, 32934, 12444, 0, 11268, 12636, 10563, 0, 12900, 0,
+    12804, 12624, 0, 12468, 13029, 0, 0, 12701, 0, 17171, 17239, 0, 17289, 0, 12912, 10861,
+    32866, 10871, 11611, 17252, 12428, 0, 0, 9675, 0, 17309, 28776, 12792, 16595, 12792, 28762, 8320,
+    13195, 13017, 12912, 0, 12692, 32842, 0, 13200, 12676, 20483, 12947, 28708, 12516, 13067, 13040, 0,
+    28816, 16517, 16779, 12696, 10274, 11734, 0, 28778, 11735, 11656, 0, 13172, 12393, 13184, 28816, 9907,
+    12767, 32858, 28697, 9545, 12888, 13162, 28681, 28724, 9975, 9975, 17251, 8911, 12945, 32859, 28825, 12705,
+    0, 9975, 13065, 13176, 0, 12863, 0, 11467, 20482, 28712, 13185, 17174, 0, 28816, 16597, 32805,
+    8333, 12582, 13150, 12792, 28826, 0, 10331, 6438, 28779, 28813, 28734, 0, 12693, 12492, 0, 11152,
+    32792, 16676, 0, 0, 6463, 12499, 17091, 12705, 8831, 10571, 28732, 12948, 28811, 0, 28727, 0,
+    13040, 16795, 12516, 28728, 0, 12367, 28738, 12343, 10572, 20483, 10041, 8278, 13067, 12480, 17409, 12624,
+    28747, 11246, 12604, 12675, 12693, 28825, 6189, 32933, 16936, 10283, 9386, 4921, 12772, 12864, 17411, 9983,
+    28697, 13067, 28717, 0, 8987, 28702, 4613, 28748, 0, 12716, 12534, 0, 28762, 28711, 12792, 9980,
+    0, 13040, 13122, 28729, 12828, 28738, 8313, 0, 0, 0, 11895, 0, 12594, 10044, 8938, 13051,
+    17290, 12825, 8320, 10626, 20485, 10255, 28732, 32841, 28696, 9771, 0, 11470, 0, 6226, 6409, 0,
+    16936, 28749, 9508, 12499, 4916, 12033, 32920, 0, 0, 12512, 12606, 16662, 13067, 10264, 28802, 28816,
+    17013, 0, 28820, 9509, 0, 28789, 32819, 12780, 0, 28713, 0, 6059, 12912, 28728, 12463, 6234,
+    0, 12467, 0, 12792, 9986, 13088, 9778, 28729, 6466, 11749, 9965, 28727, 11411, 0, 12074, 28788,
+    28826, 12488, 12630, 0, 32910, 32878, 13075, 12771, 5340, 12900, 9986, 12678, 0, 13078, 12936, 17014,
+    4614, 13114, 12540, 0, 32818, 28775, 17170, 28676, 12453, 6364, 9916, 9984, 12624, 12812, 12428, 5651,
+    16674, 12678, 0, 32882, 13172, 12490, 32919, 12501, 28774, 0, 9615, 28788, 9217, 0, 10273, 10042,
+    16937, 0, 0, 12720, 32806, 5264, 0, 10925, 28714, 12912, 17308, 28813, 32910, 16597, 12800, 13054,
+    12636, 0, 12430, 0, 12441, 0, 12792, 0, 28819, 12787, 0, 13157, 10572, 12881, 32910, 17408,
+    10278, 12405, 32894, 17307, 6433, 12606, 28709, 9553, 8631, 9982, 10044, 8393, 10274, 12490, 12909, 17172,
+    28823, 28767, 16447, 11112, 11012, 8480, 9839, 11756, 13148, 8954, 0, 9311, 0, 28778, 12571, 12624,
+    12511, 17309, 0, 11655, 6433, 0, 10916, 12606, 13032, 12322, 28821, 13078, 32833, 12732, 32879, 0,
+    10283, 28811, 12936, 10088, 28810, 0, 17409, 0, 16912, 28718, 10562, 0, 12823, 12605, 28698, 0,
+    11735, 28746, 28816, 28809, 0, 12869, 0, 10714, 12696, 6402, 8394, 28752, 28810, 11470, 12618, 6189,
+    9804, 8912, 0, 28801, 13067, 8663, 28803, 17172, 12678, 0, 0, 12932, 28784, 0, 28734, 0,
+    11358, 11219, 10460, 28791, 11151, 17173, 28814, 12812, 28714, 0, 0, 28762, 0, 28778, 12666, 28751,
+    11735, 0, 28690, 10581, 11821, 13040, 0, 0, 16745, 32867, 28764, 0, 10998, 0, 6226, 32910,
+    0, 11459, 11946, 12948, 32857, 12452, 32869, 0, 32843, 5410, 9986, 28738, 10280, 0, 28747, 13067,
+    28788, 13019, 0, 28777, 5771, 0, 12371, 28731, 28776, 12706, 13173, 0, 12394, 8686, 0, 0,
+    32857, 32779, 32776, 9647, 12898, 16448, 9877, 16598, 28814, 0, 12500, 32894, 0, 28809, 9685, 13143,
+    28711, 16450, 28690, 12718, 28828, 10199, 28740, 0, 0, 10132, 12371, 17132, 12870, 28738, 0, 10157,
+    12370, 28791, 11596, 0, 0, 13139, 32867, 12440, 9861, 0, 0, 13100, 12774, 4876, 10284, 10403,
+    32898, 17299, 9561, 28741, 12503, 10285, 9845, 10116, 9001, 11035, 12417, 0, 32832, 12633, 16937, 28780,
+    28718, 12684, 9254, 0, 32885, 12909, 17016, 16878, 13079, 28732, 8410, 9985, 0, 0, 9985, 17411,
+    11953, 10123, 10153, 13123, 32911, 12075, 10044, 9363, 12912, 12803, 12418, 9986, 8988, 12511, 13032, 10283,
+    12523, 13162, 12897, 10581, 12924, 5539, 11655, 32898, 10880, 0, 11451, 9591, 0, 13173, 11012, 28797,
+    0, 28799, 17251, 12606, 12984, 13076, 13147, 0, 9516, 11932, 12606, 10282, 11780, 12606, 28730, 10144,
+    0, 0, 12512, 13219, 28679, 17060, 12699, 12800, 13150, 10581, 16815, 8285, 12500, 28747, 0, 12487,
+    8584, 13149, 11833, 11469, 0, 12936, 4463, 32793, 17139, 0, 28682, 32933, 32898, 11049, 28776, 9779,
+    28813, 0, 0, 32909, 10872, 0, 32819, 12672, 0, 12440, 12513, 12678, 0, 32829, 0, 17095,
+    0, 17114, 10150, 6464, 10282, 9341, 9848, 0, 12456, 9916, 11058, 12419, 12479, 8491, 12456, 9307,
+    9686, 28732, 12490, 17411, 28823, 28785, 28766, 9807, 0, 32857, 17174, 0, 16823, 12371, 28756, 9854,
+    12936, 0, 16508, 13116, 0, 32856, 28815, 12995, 12946, 13126, 8994, 10581, 11179, 12678, 28765, 12430,
+    12876, 12479, 12635, 10090, 12694, 17001, 0, 12802, 16767, 10883, 0, 32828, 9802, 32937, 12490, 10065,
+    12513, 20481, 32806, 10172, 16449, 12717, 17318, 9918, 12464, 16904, 12795, 6044, 12479, 13149, 12419, 32846,
+    9806, 9919, 12936, 12701, 11179, 28759, 9654, 28797, 0, 12892, 0, 12430, 28789, 9817, 17203, 12826,
+    9888, 0, 28788, 9599, 28814, 32833, 20487, 0, 10580, 10283, 12935, 9899, 0, 10284, 0, 28778,
+    12692, 17331, 13032, 10107, 28740, 9599, 0, 12778, 12687, 0, 10571, 28690, 5484, 32869, 10131, 12908,
+    10461, 0, 32861, 16982, 12862, 12492, 16695, 13162, 12395, 12785, 12572, 28732, 12503, 17016, 10153, 11159,
+    32908, 12468, 12384, 10208, 16969, 32856, 0, 16925, 0, 12672, 12635, 0, 12828, 11479, 12910, 0,
+    11895, 12800, 12904, 12840, 0, 12931, 11095, 17174, 28786, 16676, 0, 28828, 0, 12778, 28678, 28797,
+    9813, 0, 13150, 12705, 13032, 17306, 17003, 12418, 12882, 11750, 32911, 12719, 9018, 28801, 12811, 17330,
+    12540, 12681, 12933, 12911, 0, 32869, 28790, 12797, 12908, 0, 28775, 28677, 28815, 12931, 12443, 11507,
+    28690, 32819, 13162, 13211, 13219, 28747, 11115, 12876, 32935, 11870, 0, 12623, 13032, 9563, 12056, 32794,
+    5498, 12990, 10162, 32907, 12788, 28756, 13160, 10714, 10498, 0, 16912, 10882, 12783, 10797, 13160, 12823,
+    0, 32867, 28752, 13157, 12514, 28815, 32936, 17151, 0, 13020, 6402, 28678, 11182, 32872, 11182, 9863,
+    16688, 12946, 13148, 13171, 0, 12693, 13001, 0, 12479, 0, 20487, 12599, 28754, 10506, 11081, 12752,
+    13148, 12442, 0, 12704, 11104, 0, 12000, 13029, 9909, 28799, 13068, 12034, 12910, 32870, 0, 16911,
+    0, 13211, 32923, 12526, 28763, 13137, 28779, 28774, 0, 28815, 16616, 28801, 32910, 32858, 13140, 11181,
+    28786, 9321, 17330, 16914, 20489, 13151, 28798, 17150, 0, 12898, 17162, 32923, 16833, 17174, 32781, 12933,
+    12610, 32869, 32868, 32922, 28754, 17095, 0, 17218, 10452, 0, 17062, 13162, 10505, 16834, 12989, 32905,
+    9083, 13161, 17149, 8658, 28799, 5454, 11769, 32911, 9940, 0, 0, 11768, 0, 0, 32895, 32923,
+    0, 11096, 28756, 13053, 28815, 0, 17072, 28731, 12826, 10207, 11518, 32882, 17210, 16924, 8435, 12893,
+    28710, 28819, 0, 12719, 17174, 0, 32884, 0, 16849, 0, 10320, 12694, 13067, 0, 16538, 13172,
+    32858, 0, 0, 16923, 11648, 12586, 0, 13172, 28815, 12552, 28755, 10507, 13068, 0, 11178, 20490,
+    5666, 0, 13114, 10208, 13211, 28767, 12802, 17219, 12068, 17151, 13068, 12516, 32833, 28753, 10189, 12828,
+    10714, 9616, 12802, 12503, 13198, 12948, 28756, 0, 9064, 20486, 9607, 0, 32937, 12491, 11514, 12933,
+    9909, 0, 13176, 12790, 0, 13207, 17081, 0, 12612, 28779, 0, 12611, 0, 17409, 28789, 12057,
+    12443, 16606, 13116, 12694, 10506, 17241, 0, 12624, 5263, 0, 0, 12824, 0, 0, 10190, 11058,
+    28685, 17080, 8995, 0, 17229, 28763, 12779, 12456, 0, 11910, 11506, 11435, 17237, 32917, 0, 32895,
+    32922, 0, 10487, 9021, 0, 13206, 8917, 28780, 28815, 28719, 12827, 12611, 10782, 11095, 0, 32933,
+    32894, 32922, 32871, 28779, 12790, 0, 0, 12419, 0, 16924, 13039, 13187, 13020, 13080, 0, 12076,
+    11380, 0, 20487, 10507, 28723, 28828, 32935, 0, 28823, 12534, 6464, 9919, 17405, 32908, 0, 0,
+    28801, 9607, 28764, 11776, 28799, 13199, 20487, 0, 32884, 0, 13031, 16766, 12946, 0, 9903, 13068,
+    28777, 10175, 11610, 12945, 0, 28822, 0, 0, 9982, 0, 28796, 13050, 16766, 6387, 16695, 0,
+    0, 0, 32807, 10228, 32880, 0, 32923, 12802, 0, 9241, 0, 0, 12779, 12944, 28756, 32893,
+    12705, 0, 0, 9065, 13188, 0, 0, 12990, 28778, 32934, 17253, 11357, 0, 0, 0, 13018,
+    9944, 0, 32827, 12948, 16923, 20484, 11312, 28802, 12012, 13195, 13173, 9671, 13006, 12936, 13008, 12384,
+    0, 32931, 11567, 16935, 12403, 9655, 5697, 32935, 0, 8846, 13162, 10225, 10273, 13187, 28768, 0,
+    28770, 16844, 12812, 28792, 9941, 12480, 10197, 0, 28809, 0, 32843, 28780, 32867, 11104, 13032, 0,
+    13151, 12852, 32790, 12492, 12935, 0, 0, 9065, 13172, 0, 28763, 0, 12946, 0, 0, 10273,
+    0, 16936, 11414, 0, 12369, 10208, 16933, 17015, 12312, 13044, 12815, 13020, 12887, 17218, 28755, 0,
+    17003, 0, 12978, 9372, 9914, 28820, 28723, 20484, 11312, 0, 28810, 12012, 17211, 11910, 12443, 28744,
+    17241, 0, 13012, 5955, 13080, 28749, 28764, 13151, 16663, 0, 13163, 0, 0, 0, 11404, 6096,
+    10562, 13056, 10805, 12636, 9317, 11780, 12503, 32909, 0, 0, 5666, 16904, 0, 10797, 12803, 32909,
+    12492, 0, 0, 32859, 13066, 17012, 0, 0, 32885, 13075, 28792, 32909, 11947, 17253, 32832, 0,
+    28763, 13199, 0, 11161, 0, 12492, 0, 9909, 28814, 28756, 28753, 0, 12503, 0, 10516, 28791,
+    12945, 28823, 0, 32898, 17328, 0, 17329, 0, 28731, 28799, 16596, 13024, 0, 0, 12743, 32898,
+    13187, 28757, 16462, 12002, 0, 32935, 13152, 12792, 0, 12706, 16698, 0, 0, 16620, 28822, 0,
+    12492, 13002, 13078, 32936, 10813, 0, 13055, 0, 0, 9941, 13042, 32859, 0, 10259, 11647, 9980,
+    17173, 13028, 0, 13080, 28801, 0, 17238, 0, 28736, 0, 28800, 17330, 13223, 17297, 16462, 0,
+    0, 0, 0, 13164, 16609, 12370, 0, 11137, 13017, 0, 20489, 12504, 13077, 32911, 16699, 32776,
+    0, 11096, 0, 12911, 32871, 0, 20490, 8875, 0, 28715, 11414, 12394, 0, 0, 12804, 10224,
+    10255, 28765, 28804, 0, 11779, 13173, 0, 0, 12444, 17174, 10325, 16579, 0, 13140, 0, 13079,
+    0, 32842, 12947, 12706, 0, 0, 32937, 12718, 0, 28767, 11436, 0, 8476, 0, 13137, 12912,
+    0, 12708, 0, 28777, 9590, 16579, 32871, 17240, 0, 28803, 0, 0, 0, 12802, 12057, 10274,
+    0, 0, 0, 13152, 13055, 16541, 11694, 9672, 0, 0, 13067, 0, 32859, 13211, 28749, 11467,
+    0, 17173, 20489, 11096, 0, 11710, 32885, 28686, 12492, 0, 0, 11480, 9975, 12402, 13183, 32885,
+    11701, 0, 8830, 10562, 0, 20486, 13198, 16925, 11458, 28738, 13140, 16794, 0, 32922, 0, 32815,
+    32910, 8544, 0, 0, 13080, 17094, 28802, 17377, 11112, 10862, 0, 12911, 0, 16974, 12492, 28678,
+    10228, 13054, 12366, 20484, 13008, 28768, 28790, 8784, 5395, 13188, 0, 17377, 6174, 28687, 28801, 17170,
+    10872, 16777, 32820, 9376, 28709, 28742, 8543, 12802, 12899, 12945, 12947, 32859, 0, 9944, 0, 28775,
+    0, 0, 32894, 12624, 12812, 12804, 10283, 0, 16913, 13079, 0, 28765, 10260, 13223, 32909, 28777,
+    0, 0, 28685, 20483, 17002, 28786, 0, 0, 13067, 0, 28763, 0, 28774, 0, 28757, 8642,
+    28762, 0, 0, 12935, 0, 9189, 0, 9969, 32937, 9964, 28789, 0, 17318, 28825, 28712, 0,
+    17095, 12705, 11693, 17093, 28776, 12815, 13007, 12367, 17319, 8643, 4869, 0, 16795, 0, 17320, 13199,
+    13164, 12947, 28777, 12068, 13015, 10218, 28724, 12519, 13172, 12323, 4489, 10307, 9974, 17253, 28820, 28679,
+    9941, 12300, 12825, 13160, 11734, 0, 13188, 12667, 0, 12331, 12468, 16576, 10255, 13152, 28710, 32923,
+    16676, 28733, 9919, 28738, 17332, 28779, 12816, 12296, 0, 28766, 17290, 12077, 13164, 9837, 0, 0,
+    10268, 0, 13018, 0, 20490, 8453, 32844, 32790, 13140, 9972, 12049, 10572, 8649, 0, 12076, 9078,
+    12910, 0, 12500, 17173, 12934, 12420, 9672, 16413, 32833, 13055, 12432, 12936, 28815, 0, 11168, 28789,
+    9953, 8321, 0, 12707, 28763, 13066, 10272, 12321, 32935, 10078, 17252, 32871, 0, 12898, 9174, 4586,
+    28675, 28826, 28803, 13209, 11181, 28787, 13068, 28775, 12813, 16982, 17004, 6321, 28735, 20488, 13152, 8603,
+    9356, 17250, 28823, 13075, 12816, 28708, 16877, 10515, 9794, 0, 10025, 8785, 0, 32937, 11703, 0,
+    0, 10452, 32885, 32831, 12372, 32779, 4461, 6044, 28700, 32792, 13200, 12705, 12626, 28738, 13188, 8486,
+    9262, 0, 12812, 16874, 12839, 13007, 0, 6233, 28752, 28691, 0, 16914, 28785, 12557, 0, 11414,
+    13018, 13042, 12719, 32833, 17376, 17241, 28775, 28773, 28734, 13224, 28801, 32872, 0, 10116, 32911, 17172,
+    9751, 17173, 16924, 0, 12452, 12475, 0, 17316, 28698, 12936, 11729, 9450, 28811, 28791, 10116, 12594,
+    28754, 16587, 17095, 32921, 0, 13066, 12574, 13163, 13067, 12068, 12624, 32936, 9772, 12846, 12934, 12780,
+    10263, 28709, 32778, 8631, 17289, 11458, 32803, 4393, 28702, 17319, 0, 32898, 28821, 12896, 28686, 17388,
+    12708, 5927, 11768, 32830, 13151, 11713, 6365, 28762, 6457, 12797, 16437, 8580, 12624, 12612, 16752, 16937,
+    32778, 32921, 17253, 10414, 17320, 28701, 12828, 12441, 13068, 9563, 28690, 28773, 9509, 32882, 28718, 28787,
+    16778, 13064, 28792, 28753, 32820, 12367, 12788, 32933, 13079, 12477, 32856, 0, 17060, 12704, 12924, 17376,
+    10107, 12480, 10562, 9210, 0, 32924, 13127, 28679, 32881, 0, 9882, 12777, 0, 8990, 0, 28711,
+    12633, 28810, 17399, 13219, 28738, 20490, 12417, 32791, 16937, 10132, 12715, 32907, 12934, 12609, 12920, 28825,
+    17095, 0, 13077, 10217, 0, 28685, 17094, 8994, 28811, 32897, 10153, 17252, 28813, 28787, 28690, 11013,
+    10338, 0, 28823, 12778, 11178, 9983, 9845, 13187, 0, 28753, 28824, 12682, 10879, 32830, 28797, 28788,
+    9918, 12696, 28715, 11481, 28738, 28810, 28821, 9451, 28822, 8306, 28786, 12368, 16516, 28813, 12681, 12552,
+    32909, 28748, 9851, 11458, 0, 12910, 0, 10415, 12726, 11977, 16815, 10307, 12406, 4580, 9676, 6466,
+    12622, 28789, 0, 9850, 28776, 11012, 12912, 28702, 9546, 0, 28791, 28732, 28811, 28740, 28736, 12688,
+    17139, 28733, 10094, 28755, 0, 12824, 32803, 8581, 9605, 0, 12658, 12465, 16674, 28762, 16602, 17405,
+    12861, 0, 28763, 16597, 17132, 32776, 32898, 12466, 12983, 17170, 28814, 28814, 17397, 8883, 12936, 12550,
+    0, 13219, 13078, 28826, 12713, 28787, 32885, 28815, 13032, 12936, 11171, 12574, 28787, 6401, 11057, 12430,
+    17319, 32882, 17251, 28697, 32806, 5169, 0, 16766, 28775, 10207, 10189, 12429, 8491, 13075, 9863, 17252,
+    10880, 13068, 32933, 0, 32924, 12657, 13172, 9343, 0, 28786, 11769, 12792, 9687, 12453, 28749, 0,
+    28763, 28814, 10182, 9985, 28823, 28774, 12611, 12611, 28788, 13210, 32935, 28788, 12503, 32867, 12622, 28803,
+    12524, 28776, 12708, 12718, 5023, 32869, 17388, 12551, 32779, 13133, 11480, 0, 9601, 32831, 13222, 28814,
+    17016, 28822, 20487, 12784, 10338, 28691, 0, 0, 32935, 32911, 9986, 17319, 28790, 28678, 12488, 28699,
+    13000, 17251, 17248, 28676, 10207, 16756, 0, 10804, 28697, 32858, 10161, 12598, 12658, 32936, 17309, 11972,
+    12643, 13155, 17252, 32859, 17290, 17095, 12897, 17411, 9853, 17386, 12828, 0, 12920, 28789, 28776, 0,
+    12455, 12611, 32922, 4880, 12479, 28789, 28803, 32883, 10207, 12719, 8642, 28701, 10760, 28798, 28752, 10279,
+    12909, 13121, 9980, 0, 32881, 9309, 10094, 17062, 16937, 10152, 16925, 16991, 12444, 12882, 20487, 12909,
+    9286, 12908, 16936, 32868, 20488, 17072, 28753, 17072, 4684, 28718, 12621, 0, 9983, 0, 20490, 16832,
+    28828, 32869, 12919, 13223, 5227, 8650, 16834, 32881, 12682, 13162, 13198, 12684, 17308, 17252, 32896, 28755,
+    6189, 28811, 28809, 12812, 20488, 32855, 8963, 32871, 12479, 28791, 28828, 28801, 28824, 0, 32893, 9812,
+    12948, 0, 0, 10714, 28778, 32872, 12683, 12716, 0, 12887, 17385, 17095, 10883, 28754, 0, 12514,
+    0, 13162, 28767, 28815, 12739, 0, 8389, 17148, 5673, 0, 17151, 13223, 32931, 32868, 28786, 12910,
+    32918, 0, 32854, 0, 12815, 0, 28765, 0, 17062, 20487, 8991, 12826, 12610, 13223, 0, 28763,
+    32778, 28827, 13210, 0, 12622, 0, 16620, 28820, 0, 8949, 17174, 28745, 12898, 0, 0, 28790,
+    0, 0, 12936, 11780, 9599, 0, 12707, 16921, 10199, 13160, 28808, 28710, 9885, 13065, 28826, 17160,
+    12900, 28762, 32905, 12372, 0, 12348, 10190, 11115, 28778, 13139, 12942, 9592, 13044, 13086, 12563, 17012,
+    12936, 10285, 28810, 0, 20490, 32906, 32896, 12800, 16923, 12396, 10498, 13055, 0, 17082, 6409, 0,
+    20488, 28802, 32922, 12611, 13098, 9553, 0, 17132, 10506, 0, 32858, 28754, 0, 17211, 12514, 28792,
+    11182, 12708, 9686, 16937, 12811, 32897, 17398, 28732, 0, 17093, 12922, 0, 13032, 13163, 17397, 32868,
+    28744, 11356, 4880, 13056, 32919, 11480, 17079, 32885, 32832, 32884, 13185, 9845, 12467, 13162, 10212, 12815,
+    0, 0, 32935, 13098, 9687, 13134, 10162, 28822, 12621, 12707, 12515, 12803, 0, 0, 13223, 9308,
+    0, 28768, 17241, 11766, 28810, 0, 11518, 9686, 0, 28779, 13150, 12816, 28826, 13028, 17083, 12826,
+    9884, 12816, 0, 28731, 0, 16937, 12695, 9908, 16935, 10881, 13147, 32869, 28768, 32880, 0, 11057,
+    11404, 0, 0, 32936, 12948, 0, 28822, 13065, 28815, 17241, 17094, 17332, 16842, 28823, 12910, 0,
+    12909, 0, 8696, 0, 28724, 17082, 17320, 11703, 28755, 0, 28816, 20490, 32905, 10714, 12910, 12528,
+    32898, 13125, 10218, 12791, 5629, 12804, 12550, 32922, 16606, 11776, 17332, 12898, 32911, 28753, 28780, 32885,
+    0, 0, 12009, 32868, 0, 13018, 28826, 13068, 32896, 32896, 11103, 13051, 13056, 13028, 13224, 0,
+    32907, 12934, 13032, 32895, 13077, 12623, 10861, 13040, 13183, 17320, 28735, 0, 28827, 5755, 9436, 8788,
+    10788, 12824, 16925, 16687, 0, 13144, 11932, 10218, 0, 0, 10272, 0, 0, 0, 10871, 0,
+    16459, 13090, 0, 32896, 0, 13065, 17330, 5772, 5665, 32803, 8267, 12792, 0, 28804, 32934, 9917,
+    0, 0, 13134, 0, 0, 13208, 0, 0, 12816, 13079, 13149, 13068, 11757, 9620, 0, 32923,
+    0, 28754, 10503, 28786, 0, 28801, 0, 12707, 11822, 12944, 0, 13051, 0, 17387, 28796, 12372,
+    17015, 10218, 16842, 11402, 13079, 12324, 0, 28768, 8696, 0, 12624, 9939, 0, 0, 13156, 28820,
+    28746, 28708, 13200, 11081, 10207, 0, 28815, 12792, 28755, 28826, 5814, 28802, 17407, 28802, 9919, 28789,
+    13020, 0, 13044, 13163, 13199, 12934, 16765, 17082, 17082, 6457, 10161, 28775, 13195, 28774, 12571, 12888,
+    11414, 28797, 0, 12501, 11087, 13032, 12504, 12512, 13211, 28792, 13210, 11779, 17220, 10816, 28775, 13056,
+    8420, 17411, 28788, 9616, 6233, 28790, 13175, 28803, 0, 13066, 28764, 0, 17210, 32857, 0, 0,
+    0, 17253, 17082, 0, 9778, 0, 0, 12910, 10871, 13125, 11112, 16842, 20487, 11115, 12683, 10554,
+    0, 32833, 10804, 32859, 32907, 12455, 28711, 28686, 32909, 28802, 11523, 12803, 13078, 28695, 9364, 13008,
+    0, 6365, 28774, 0, 32910, 11954, 11402, 16933, 28780, 0, 0, 28813, 32895, 28827, 17162, 5499,
+    28792, 17060, 0, 13041, 10860, 17410, 32897, 0, 13210, 10498, 9918, 11776, 28778, 32868, 13017, 28709,
+    12946, 12322, 13039, 13028, 28739, 17327, 28723, 32883, 0, 0, 28757, 16925, 28780, 32936, 28789, 13017,
+    32895, 12934, 13012, 17227, 12576, 28823, 0, 28734, 20482, 0, 10516, 6096, 13206, 0, 13002, 12068,
+    32781, 13080, 12801, 12372, 12573, 17410, 12720, 28776, 28780, 28766, 28764, 28777, 12324, 0, 17320, 28827,
+    0, 12909, 28822, 12969, 17083, 17253, 12320, 0, 16458, 12718, 28801, 11610, 28780, 28822, 0, 28803,
+    13212, 11679, 28790, 17151, 11522, 13134, 13149, 12623, 12492, 12800, 0, 28778, 17320, 12948, 11694, 20489,
+    17162, 0, 32908, 28813, 16925, 0, 32911, 12934, 28778, 10814, 0, 28766, 5674, 28800, 28787, 28756,
+    0, 13015, 0, 17331, 0, 12623, 20489, 0, 12633, 13176, 28827, 0, 20489, 28779, 16584, 28780,
+    0, 28733, 12067, 10815, 17241, 12804, 28811, 12300, 0, 28800, 12504, 10273, 10571, 0, 0, 0,
+    13151, 11414, 0, 0, 10563, 28790, 32859, 11479, 28714, 0, 12485, 10517, 12492, 10199, 10273, 32794,
+    28802, 0, 12792, 12462, 32869, 10806, 17162, 28827, 17004, 28752, 32885, 28749, 10216, 13156, 0, 32897,
+    0, 0, 12520, 10023, 0, 12451, 28690, 28767, 9666, 13199, 8744, 9974, 13053, 16721, 28802, 13200,
+    9953, 12000, 28787, 9065, 9151, 11470, 12716, 13222, 13175, 11414, 12707, 13223, 4982, 11655, 28751, 12011,
+    16805, 17083, 32884, 28689, 13103, 0, 28691, 32881, 13015, 11170, 28789, 12708, 0, 28814, 13076, 32884,
+    12660, 17388, 32790, 12402, 13043, 12464, 12492, 13164, 16564, 20488, 32846, 32816, 17120, 8566, 12065, 11956,
+    28799, 13066, 17004, 17405, 32859, 12468, 12946, 8843, 20488, 13067, 12683, 20488, 17250, 10816, 32792, 13207,
+    10584, 12624, 11013, 17229, 13077, 28815, 13199, 0, 0, 28736, 11655, 9787, 17161, 9959, 28759, 32815,
+    13210, 16418, 0, 12344, 17083, 13176, 16665, 13040, 12935, 16993, 28810, 13149, 12548, 17229, 28768, 13064,
+    0, 12465, 28755, 9795, 6058, 28779, 13206, 12945, 12356, 32791, 6211, 17320, 0, 9065, 28786, 13175,
+    0, 17332, 17173, 0, 0, 20490, 8744, 32838, 9425, 0, 16570, 12994, 13065, 28755, 28710, 13019,
+    17240, 28725, 32827, 12813, 32853, 12552, 0, 13092, 32870, 13195, 16647, 12357, 0, 12947, 28777, 17092,
+    10515, 28776, 16779, 28787, 20484, 28690, 8869, 12882, 11480, 10157, 8853, 0, 32932, 16491, 4693, 13080,
+    13207, 28738, 32778, 32835, 28679, 0, 28764, 13030, 16496, 8548, 32922, 13019, 8919, 17348, 11777, 12078,
+    28709, 0, 12380, 17399, 9974, 12897, 4383, 13031, 32911, 28749, 12011, 28812, 32924, 28676, 28757, 12416,
+    0, 0, 32857, 17410, 10264, 0, 28677, 13188, 5756, 28810, 28827, 32910, 5877, 10584, 28755, 9655,
+    17062, 12468, 10218, 12298, 12816, 8341, 20482, 9084, 16937, 10273, 12739, 32937, 32937, 12718, 28677, 28674,
+    32872, 9965, 28711, 28813, 11956, 28803, 11159, 28766, 28709, 12488, 12319, 13017, 12068, 17318, 32791, 16936,
+    17015, 17095, 16507, 5824, 32830, 28800, 16933, 28711, 0, 11170, 13055, 12521, 32897, 32921, 10883, 12336,
+    13080, 28801, 6466, 32883, 17230, 28753, 16496, 28763, 12504, 10816, 17172, 10106, 12612, 9074, 28786, 4292,
+    17411, 28737, 17094, 28703, 16895, 12903, 28828, 12056, 12463, 28753, 12936, 16937, 0, 12924, 13212, 32805,
+    12346, 0, 28726, 13031, 12922, 12444, 17162, 28811, 12609, 28715, 32803, 8575, 12695, 12511, 32924, 0,
+    28811, 9852, 32894, 16983, 12331, 32856, 12720, 28758, 28789, 9450, 11947, 8470, 28690, 9518, 8890, 0,
+    12708, 28734, 13078, 11480, 17015, 11470, 28721, 28720, 10300, 17309, 12605, 12580, 13032, 0, 16515, 17173,
+    12796, 12516, 16499, 13222, 8918, 17061, 17239, 28767, 0, 28775, 12569, 8329, 32872, 12696, 32921, 11481,
+    0, 17408, 0, 9174, 32858, 11181, 0, 12358, 8378, 16500, 12521, 13067, 28811, 28763, 9946, 13164,
+    16925, 16812, 8413, 28799, 12394, 17240, 12442, 28789, 16801, 12827, 28776, 12666, 32815, 12801, 8311, 10199,
+    5460, 28775, 0, 13068, 0, 28825, 12034, 12463, 28727, 28810, 4552, 0, 10195, 4556, 0, 12671,
+    32869, 28749, 12912, 12465, 28780, 9899, 28828, 12801, 10272, 17141, 28687, 32858, 12827, 9970, 13080, 6233,
+    5825, 8908, 32936, 12002, 20489, 28779, 13200, 12454, 17299, 28798, 17016, 12948, 10278, 28734, 13200, 17411,
+    12635, 12827, 12923, 10415, 12813, 12612, 10751, 17241, 13188, 16434, 13200, 12900, 17368, 20488, 10203, 9663,
+    11481, 12706, 28788, 28757, 17174, 13218, 12718, 9907, 28690, 12801, 32924, 8883, 10156, 11480, 17095, 12432,
+    32882, 17240, 28767, 17329, 12922, 0, 28679, 32907, 28789, 13032, 28799, 12453, 28799, 11357, 12701, 28679,
+    0, 0, 13210, 9451, 17332, 28680, 0, 12356, 32924, 20488, 10285, 12430, 28752, 12696, 32819, 32935,
+    12804, 28760, 12789, 10285, 17331, 11759, 17196, 12569, 17318, 32805, 4839, 12692, 10274, 10151, 12502, 28815,
+    10284, 17411, 12825, 12034, 16526, 16437, 28821, 32933, 12947, 12624, 11469, 13079, 28800, 28733, 32806, 5141,
+    17385, 28752, 10047, 8581, 28756, 12627, 0, 0, 32818, 13066, 32872, 10282, 16438, 16887, 28800, 12503,
+    0, 12369, 6455, 28828, 11096, 0, 0, 0, 0, 10285, 17309, 11480, 0, 12899, 12823, 20489,
+    28800, 28735, 32924, 0, 32806, 12335, 17240, 11769, 17248, 28678, 5269, 32908, 28778, 0, 6402, 32921,
+    32882, 28775, 32923, 12621, 28803, 10162, 6401, 12935, 13076, 17248, 32905, 8909, 12936, 12334, 11404, 12812,
+    12933, 12297, 28787, 28826, 12636, 32936, 28680, 10881, 0, 12727, 28790, 17240, 10554, 9685, 13137, 12946,
+    28762, 28786, 17309, 28814, 13187, 28814, 28754, 28798, 28789, 12684, 17230, 12691, 32909, 0, 9863, 28786,
+    28825, 32934, 13066, 12621, 17002, 28722, 12945, 6411, 8383, 11171, 28812, 11297, 9970, 16832, 6235, 0,
+    12513, 17317, 9309, 16982, 28811, 28810, 32829, 0, 0, 32806, 8673, 0, 12948, 28766, 5422, 13223,
+    28763, 32932, 13031, 9919, 9568, 11778, 13065, 13212, 8388, 32924, 11713, 28774, 11712, 12609, 20490, 17162,
+    0, 11481, 0, 28688, 13017, 12705, 12908, 13020, 17398, 9509, 10573, 32936, 28812, 6464, 8486, 32937,
+    32936, 28753, 12905, 17004, 28824, 17230, 32895, 6411, 13198, 17218, 32871, 12826, 20487, 12888, 28678, 28788,
+    13065, 12681, 10452, 12919, 12948, 4678, 12438, 12719, 11178, 0, 12727, 28777, 12432, 13200, 11956, 12896,
+    32931, 28812, 28757, 32896, 17160, 16993, 0, 12696, 13221, 28773, 32937, 16983, 10815, 28767, 32907, 28740,
+    12910, 12801, 9592, 28764, 0, 32910, 17230, 32806, 12299, 20488, 28724, 32937, 12816, 17015, 28734, 32893,
+    13002, 0, 17172, 32897, 12931, 12852, 12767, 12706, 11171, 28759, 17094, 13055, 32924, 17061, 13222, 9032,
+    0, 28716, 28786, 28802, 17002, 0, 11757, 12994, 13026, 12801, 12996, 13163, 16605, 32924, 12923, 12550,
+    17016, 13080, 0, 17387, 8987, 12454, 10584, 0, 12911, 11817, 17394, 0, 28787, 9421, 28779, 13224,
+    12945, 13067, 11460, 28828, 28775, 13016, 28725, 17015, 0, 16664, 28809, 28811, 12946, 12491, 28751, 12331,
+    0, 16720, 0, 32832, 17397, 17016, 9885, 0, 11114, 12824, 17150, 12778, 32908, 13224, 32923, 11735,
+    11180, 17001, 12933, 12331, 10883, 28799, 10883, 17229, 28810, 28799, 32897, 12299, 32922, 16495, 13043, 17398,
+    13042, 10159, 17083, 17094, 28804, 28788, 12706, 10208, 32780, 32924, 0, 12923, 28752, 20489, 9985, 17240,
+    0, 16497, 12707, 12479, 0, 12908, 0, 17354, 28814, 20487, 17399, 10274, 0, 32883, 13022, 28828,
+    0, 10881, 13065, 13056, 0, 32922, 28825, 10871, 13040, 13161, 20489, 16605, 32896, 32898, 28789, 20490,
+    32880, 28774, 0, 10563, 32778, 0, 32883, 28792, 16993, 11182, 32898, 28790, 13161, 10218, 12912, 17299,
+    20488, 11171, 20489, 0, 32932, 10572, 17016, 28763, 32885, 8893, 16564, 28798, 17330, 13212, 11769, 17253,
+    13160, 10871, 28824, 0, 0, 16673, 8338, 12367, 0, 13149, 20489, 0, 20484, 5265, 0, 28753,
+    28800, 28828, 0, 12931, 28816, 20490, 10283, 20490, 28742, 17081, 5927, 0, 10217, 0, 20489, 0,
+    16570, 12768, 17369, 16418, 13053, 0, 28780, 0, 10517, 20489, 16722, 13224, 0, 32934, 0, 28738,
+    28753, 13111, 0, 9984, 12828, 17250, 13055, 12948, 0, 17241, 10517, 32937, 12331, 8992, 32871, 0,
+    17016, 12946, 0, 9853, 0, 12318, 0, 13068, 0, 28699, 13209, 10882, 16535, 28736, 13183, 13199,
+    28801, 11469, 5651, 13018, 32806, 8394, 28718, 32924, 17399, 12924, 16498, 17083, 10204, 28711, 13211, 20484,
+    16433, 0, 12936, 9516, 0, 12480, 28780, 28789, 9724, 0, 17083, 0, 12356, 12932, 13044, 16663,
+    28742, 32839, 32827, 0, 16435, 11170, 28827, 12343, 11932, 9908, 17253, 0, 11749, 28824, 5265, 28816,
+    28803, 13067, 16937, 12946, 28712, 0, 17330, 12719, 0, 8847, 13176, 28755, 12803, 32911, 9610, 12428,
+    12308, 0, 4526, 12815, 17172, 8853, 28804, 12718, 0, 13163, 12480, 0, 28804, 0, 0, 9985,
+    13043, 28812, 28688, 16722, 10197, 9672, 16426, 10259, 12345, 13188, 0, 11413, 0, 12514, 32937, 11679,
+    28813, 8276, 0, 10871, 28824, 9147, 13151, 17172, 28777, 13043, 28776, 0, 0, 17409, 0, 28792,
+    13134, 12058, 28712, 10881, 28802, 17240, 28804, 9984, 6411, 28751, 9844, 16664, 0, 16686, 28766, 17162,
+    12520, 28678, 0, 16498, 8285, 0, 0, 16925, 32936, 0, 12322, 28701, 16800, 0, 28711, 0,
+    0, 8445, 12331, 8443, 17330, 28825, 0, 17399, 13211, 0, 17241, 16672, 12370, 28816, 0, 32830,
+    28711, 28754, 17253, 13080, 28691, 17016, 9974, 17319, 13163, 13209, 0, 8872, 12009, 0, 28768, 32921,
+    16499, 32896, 0, 12924, 16419, 10274, 28724, 28754, 13056, 28778, 32920, 0, 12708, 16436, 13224, 17299,
+    12297, 13080, 11470, 0, 28791, 0, 0, 28778, 32882, 12077, 0, 17318, 13055, 17003, 0, 28755,
+    28792, 28703, 9975, 11713, 12346, 0, 0, 13160, 13187, 0, 0, 0, 28768, 32807, 9325, 0,
+    0, 8875, 28812, 0, 11596, 16525, 0, 8603, 8902, 32830, 12464, 12827, 32885, 12078, 28711, 16752,
+    12417, 9795, 0, 0, 0, 32910, 13211, 28787, 8637, 0, 12816, 0, 10188, 0, 32884, 32937,
+    0, 12078, 0, 12012, 32885, 12370, 13056, 11114, 0, 17252, 0, 0, 8738, 32921, 12720, 0,
+    32907, 20490, 12936, 28826, 28756, 0, 17406, 0, 28698, 0, 17330, 17171, 11779, 16507, 32897, 0,
+    0, 11469, 11701, 12075, 28679, 12360, 10816, 12502, 13138, 20487, 10583, 13075, 8874, 16429, 28755, 0,
+    32884, 28821, 12396, 12816, 12444, 9767, 8338, 0, 0, 10882, 16933, 28790, 11780, 12944, 0, 12299,
+    0, 28810, 32936, 13052, 12924, 32871, 0, 0, 0, 13030, 10782, 0, 0, 28818, 0, 32922,
+    12947, 32819, 32872, 12299, 10217, 28791, 13125, 13029, 28732, 0, 12945, 0, 13224, 28758, 11750, 8940,
+    0, 0, 32779, 16437, 0, 11182, 9620, 0, 16507, 28765, 0, 8936, 0, 32937, 13168, 11481,
+    28821, 12611, 0, 32896, 13017, 0, 0, 28812, 0, 17398, 0, 0, 13211, 13006, 13078, 12708,
+    0, 11169, 13161, 0, 12720, 0, 5673, 0, 28796, 13006, 17407, 12078, 28828, 13145, 0, 0,
+    0, 13198, 0, 0, 13197, 13066, 28699, 28826, 0, 0, 12947, 32910, 16620, 17387, 17248, 0,
+    17237, 16764, 28816, 0, 28812, 10872, 32820, 0, 10584, 9934, 0, 0, 0, 0, 11657, 0,
+    6059, 0, 28789, 0, 11436, 0, 17329, 11170, 0, 32793, 32884, 10253, 0, 28753, 11081, 0,
+    0, 0, 0, 0, 28812, 20481, 28813, 17161, 0, 17248, 12324, 28688, 0, 0, 0, 0,
+    0, 12065, 0, 0, 0, 13044, 0, 32885, 0, 28816, 0, 13080, 13008, 32909, 0, 0,
+    16937, 0, 32859, 17016, 13164, 32819, 0, 28800, 28768, 12078, 0, 16617, 32872, 10583, 0, 0,
+    0, 0, 17082, 32921, 0, 0, 11776, 28811, 0, 28800, 28756, 17309, 0, 0, 17378, 0,
+    28824, 13043, 0, 0, 0, 32885, 12924, 0, 0, 0, 0, 13176, 28803, 0, 0, 12012,
+    0, 12012, 0, 0, 17408, 0, 13175, 28755, 0, 0, 0, 12911, 0, 0, 17230, 12924,
+    32806, 9873, 12804, 0, 28756, 0, 12924, 13028, 11470, 0, 0, 6350, 0, 12804, 0, 0,
+    28755, 0, 10582, 28700, 13016, 17399, 10872, 13079, 0, 6174, 13145, 16853, 0, 0, 0, 28815,
+    0, 0, 17320, 16447, 13039, 0, 12012, 10218, 6466, 8479, 0, 0, 0, 0, 17408, 28753,
+    13032, 0, 0, 0, 0, 11481, 12491, 0, 11769, 0, 11479, 0, 0, 12948, 17388, 0,
+    6401, 0, 28812, 28814, 12611, 8683, 17161, 0, 0, 0, 28812, 12065, 0, 0, 0, 0,
+    20481, 32911, 13077, 0, 9043, 0, 17094, 11458, 32872, 12828, 12011, 0, 0, 0, 0, 11611,
+    0, 0, 10881, 0, 0, 11712, 0, 0, 0, 0, 0, 0, 0, 0, 8687, 12067,
+    0, 0, 12299, 17014, 0, 28814, 0, 9879, 12455, 13053, 16525, 0, 0, 0, 10274, 10882,
+    12504, 0, 0, 0, 0, 13224, 0, 10563, 28814, 0, 0, 0, 16853, 0, 17249, 0,
+    0, 0, 0, 11993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12792, 0,
+    0, 0, 0, 5191, 13079, 0, 0, 9904, 0, 28823, 0, 12324, 10584, 0, 0, 0,
+    0, 28825, 0, 13188, 0, 12828, 0, 11778, 0, 0, 28785, 28780, 0, 0, 0, 0,
+    0, 0, 0, 13164, 10582, 0, 13210, 0, 12912, 0, 11171, 0, 0, 0, 10879, 10881,
+    0, 0, 32872, 12912, 13164, 11181, 11180, 10283, 12078, 20487, 0, 0, 0, 0, 0, 28804,
+    0, 0, 13188, 0, 13188, 0, 0, 0, 0, 0, 12912, 0, 0, 0, 5184, 0,
+    0, 0, 28825, 32872, 17399, 0, 0, 0, 0, 10584, 0, 0, 12011, 0, 28815, 0,
+    0, 0, 0, 0, 0, 0, 0, 12924, 11779, 13162, 0, 0, 13077, 0, 0, 0,
+    0, 13198, 0, 0, 0, 32921, 0, 0, 0, 28825, 0, 0, 0, 32872, 0, 10273,
+    0, 12079, 28677, 13176, 10883, 28826, 0, 13200, 17241, 0, 0, 0, 13164, 11458, 28815, 13198,
+    20490, 0, 0, 13223, 0, 0, 12708, 11181, 32923, 28773, 0, 0, 9974, 0, 11170, 0,
+    0, 28812, 28799, 0, 8440, 0, 0, 0, 0, 0, 0, 0, 11458, 0, 0, 28780,
+    0, 0, 28767, 9084, 0, 0, 12696, 0, 32898, 0, 13068, 0, 0, 0, 0, 11114,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 10883, 0, 17332, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 11481, 0, 12720, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 11182, 12002, 0, 0, 32921, 0, 17015, 0, 0, 0, 28826, 11757, 0,
+    6387, 12078, 0, 0, 0, 8476, 10284, 13176, 11180, 12077, 0, 10584, 0, 28731, 0, 28803,
+    0, 12068, 0, 11779, 13219, 0, 0, 0, 17331, 0, 0, 0, 0, 0, 28792, 0,
+    11769, 0, 10581, 0, 20481, 0, 0, 12079, 0, 17251, 0, 0, 0, 0, 0, 28798,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32872,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28827, 0, 12012, 0, 0, 0,
+    0, 0, 0, 13134, 0, 8470, 28821, 0, 0, 11481, 0, 12516, 0, 0, 11769, 13161,
+    0, 13185, 0, 13164, 0, 0, 0, 0, 0, 0, 0, 11181, 0, 13077, 0, 0,
+    0, 10583, 11776, 0, 0, 0, 0, 0, 9946, 28810, 0, 0, 0, 17251, 0, 0,
+    13176, 0, 0, 0, 32924, 17250, 0, 0, 9032, 0, 0, 0, 28708, 0, 0, 0,
+    0, 11168, 0, 0, 0, 10285, 0, 9980, 0, 0, 12372, 0, 0, 0, 0, 0,
+    0, 28824, 0, 0, 13149, 0, 28823, 0, 0, 32921, 0, 13187, 0, 12058, 0, 13044,
+    0, 10583, 9986, 13175, 0, 0, 0, 0, 0, 0, 0, 12078, 0, 20481, 0, 0,
+    0, 17409, 0, 0, 28811, 0, 0, 0, 0, 0, 0, 13175, 0, 0, 0, 0,
+    0, 32781, 32898, 0, 28827, 0, 0, 0, 32923, 0, 0, 13211, 0, 0, 0, 0,
+    0, 17331, 0, 0, 0, 0, 0, 10274, 0, 0, 0, 0, 28815, 16773, 28768, 0,
+    0, 32898, 0, 17253, 0, 0, 5723, 0, 0, 0, 13176, 0, 0, 0, 17331, 13199,
+    0, 13196, 0, 17329, 0, 16693, 0, 0, 0, 0, 0, 11481, 0, 0, 17330, 0,
+    0, 0, 0, 28756, 28825, 0, 16616, 0, 0, 0, 13222, 0, 0, 0, 0, 12444,
+    0, 17406, 0, 0, 17253, 17174, 12912, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8785, 0, 12360, 0, 0, 0, 13223, 12078, 0, 0, 0, 0,
+    0, 13185, 0, 0, 6466, 17253, 0, 0, 0, 0, 0, 0, 0, 17308, 13162, 0,
+    0, 0, 0, 0, 0, 13008, 0, 0, 0, 0, 0, 0, 0, 0, 12420, 0,
+    32781, 0, 0, 32833, 0, 0, 17331, 0, 0, 9038, 11779, 17378, 0, 12079, 17318, 0,
+    13211, 0, 0, 0, 0, 0, 17327, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13212, 0, 6409, 0, 0, 17250, 0, 0, 6402, 0, 13199, 0, 28708, 13222,
+    0, 0, 0, 0, 0, 0, 16458, 0, 28812, 0, 0, 0, 0, 0, 0, 28791,
+    0, 0, 0, 0, 10583, 0, 13176, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28812,
+    0, 0, 0, 0, 13032, 0, 0, 13207, 13211, 0, 0, 0, 0, 0, 0, 0,
+    28792, 20490, 0, 13221, 0, 0, 0, 0, 0, 13224, 0, 0, 0, 0, 0, 13198,
+    0, 16458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 0, 0,
+    0, 12624, 0, 17388, 13077, 32924, 0, 13219, 0, 0, 11956, 0, 13032, 0, 0, 0,
+    0, 0, 0, 0, 13175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28826, 0, 0, 0, 0, 13080, 10285, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 28824, 0, 32922, 0, 0, 0, 0, 28804, 17395, 0, 0, 0,
+    0, 0, 0, 12079, 13186, 0, 0, 0, 0, 0, 0, 0, 0, 17332, 12056, 0,
+    28809, 13186, 0, 0, 17388, 28720, 12067, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17332, 12079, 0, 0, 0, 0, 12077, 17395, 0, 0, 0, 0, 0, 0,
+    28824, 0, 28792, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 0, 0, 11778, 32924,
+    0, 0, 9682, 0, 0, 0, 0, 0, 0, 0, 28732, 0, 0, 0, 0, 0,
+    13187, 0, 11779, 0, 0, 0, 11477, 0, 11767, 0, 0, 0, 0, 0, 0, 0,
+    28816, 0, 0, 0, 0, 13209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13032,
+    0, 0, 0, 17385, 13174, 11822, 0, 0, 0, 0, 12068, 0, 28824, 0, 0, 0,
+    0, 17369, 17399, 0, 13185, 0, 0, 0, 0, 12065, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12079, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13200, 0, 28812, 0, 0,
+    11993, 0, 0, 0, 17398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20490, 0, 13008, 0, 0, 0, 0, 0, 0, 0, 0, 13068, 0,
+    0, 0, 17388, 0, 28808, 0, 0, 28825, 13156, 0, 0, 0, 0, 13210, 0, 0,
+    0, 0, 0, 0, 13164, 0, 13200, 0, 0, 0, 17387, 0, 17332, 0, 0, 0,
+    28768, 0, 0, 0, 0, 0, 13222, 28816, 0, 10583, 0, 0, 13197, 0, 0, 13008,
+    0, 0, 0, 0, 0, 13176, 0, 0, 0, 13186, 32919, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13176, 17398, 0,
+    13162, 0, 0, 28824, 13223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13162, 28768, 0, 0, 0, 0, 0, 0, 0, 13174, 13208, 0,
+    13224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17332, 0, 0,
+    0, 13150, 0, 0, 0, 17331, 0, 0, 0, 12079, 0, 0, 0, 28822, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28816, 0, 13175, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12009, 0, 0, 0, 0, 12068, 0, 0, 0, 0,
+    0, 13212, 0, 13140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 13222, 0, 0, 17332, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13207, 0, 0, 0, 12078, 13210, 0, 0, 0, 0, 0, 0, 0, 13187,
+    32898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28804, 0, 13164,
+    0, 0, 28732, 0, 0, 12079, 0, 0, 0, 0, 17388, 0, 0, 0, 0, 17388,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17329, 0, 13104,
+    0, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 0, 0, 0, 0, 13207, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13128, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 28824, 0, 0, 13199, 0, 28823, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13188, 0,
+    0, 0, 12000, 0, 0, 0, 0, 0, 0, 0, 0, 17331, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17398, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17388, 0, 0, 0, 0, 0,
+    0, 17397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17397, 0, 0, 0, 0, 0,
+    0, 0, 13212, 0, 0, 0, 0, 0, 0, 17398, 0, 0, 0, 0, 0, 0,
+    0, 0, 17331, 0, 0, 0, 17387, 0, 0, 0, 0, 28825, 0, 0, 13221, 28756,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 12012, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17332, 0, 0, 0, 0, 13221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17399, 17332, 0, 0, 0, 0, 0, 28825, 0, 13176, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13222, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12067,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32911, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17399, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13220, 0, 28816, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28825, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13223, 0, 0, 0, 0, 0,
+    0, 0, 0, 13188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13200, 0, 0, 28826,
+    0, 0, 0, 17397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13222, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13212,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 17399, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13220, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 28823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28825, 0, 0, 0, 0,
+    0, 0, 0, 17408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 17388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 32924, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 17385, 0, 0, 0, 0, 0, 0, 28827, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 17409, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 28824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 17385, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28824, 0, 0, 0,
+    0, 13224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 28825, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 28824, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28823, 0, 0, 0, 0, 0, 0, 0, 17388,
+};
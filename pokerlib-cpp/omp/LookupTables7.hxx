@@ -0,0 +1,3140 @@
+#include "HandEvaluator.h"
+
+// Non-flush lookup table for the evaluator (SevenCardLookupLayout, size 50137 + 1 padding).
+// Generated by HandEvaluatorT::outputLookupTables().
+const uint16_t omp::SevenCardLookupLayout::LOOKUP[] {
+    32799, 32824, 12507, 32770, 28711, 32774, 28709, 32813, 32851, 28746, 32850, 32783, 28688, 12388, 12484, 12460,
+    28722, 28725, 32774, 32771, 12534, 28749, 32828, 28712, 32838, 28714, 28685, 12510, 28733, 12366, 12343, 12427,
+    32854, 16721, 12343, 12390, 12462, 12535, 28689, 12511, 12593, 28746, 12402, 12427, 12595, 32784, 32852, 28709,
+    32855, 32841, 32855, 28709, 28734, 12332, 12451, 28674, 16806, 10071, 32789, 28674, 32855, 28759, 12580, 32855,
+    32838, 28736, 28761, 28709, 28739, 28690, 28688, 28710, 28758, 16737, 28760, 16737, 28727, 28685, 12459, 12536,
+    28711, 16497, 32866, 12320, 28689, 16721, 16816, 28697, 32813, 9175, 12344, 32855, 12560, 32828, 28746, 8869,
+    12652, 32866, 32801, 12572, 28698, 32789, 32789, 16648, 20486, 28748, 20486, 12525, 28757, 16973, 12521, 28674,
+    28757, 32856, 28758, 28740, 28737, 32804, 12525, 32802, 32856, 12644, 32856, 12644, 28688, 32866, 32817, 32850,
+    8910, 12702, 12714, 8284, 12714, 16497, 12451, 12405, 9211, 12465, 4635, 12463, 28715, 12380, 12537, 28769,
+    28725, 17045, 12714, 12537, 28771, 32828, 28724, 12537, 28713, 28773, 12390, 12321, 16667, 28727, 12344, 12584,
+    17045, 12632, 8320, 32843, 28740, 12702, 16509, 12465, 16981, 16508, 10072, 28734, 12355, 32777, 20485, 28686,
+    16981, 32838, 12524, 10405, 12332, 20484, 12561, 16746, 32804, 32877, 12716, 32827, 20487, 32790, 16903, 20487,
+    16814, 12597, 32877, 17052, 9182, 12573, 12344, 16816, 28735, 32877, 28686, 12585, 8533, 12560, 8321, 12461,
+    32803, 12441, 28737, 28686, 32774, 32855, 12799, 10405, 32843, 10712, 28673, 12775, 28740, 10365, 8621, 12653,
+    12738, 10712, 28692, 32830, 32857, 8577, 32857, 12645, 32818, 16673, 32857, 12524, 8942, 28717, 28697, 32857,
+    10407, 12764, 12536, 16507, 28703, 12358, 12763, 28772, 10976, 32773, 16508, 8343, 28771, 9182, 12787, 8912,
+    28698, 12810, 12368, 28772, 32792, 9772, 12741, 12538, 32881, 28723, 8613, 28693, 12681, 16569, 11005, 28721,
+    28700, 28736, 28705, 12753, 12522, 32774, 28690, 32805, 28712, 8358, 28734, 32790, 28716, 28741, 32857, 28717,
+    12294, 12681, 10115, 11005, 32791, 28772, 9540, 16755, 32776, 16990, 32777, 12704, 12821, 28698, 12789, 11012,
+    8874, 32854, 28703, 12502, 12570, 32865, 10677, 12591, 9247, 12320, 12322, 9795, 28770, 12550, 12811, 16825,
+    28774, 12598, 12586, 28674, 12296, 16829, 12370, 32831, 28710, 28781, 28680, 16517, 17130, 16990, 12634, 16677,
+    28735, 28770, 11011, 12810, 10749, 20487, 16518, 12646, 8957, 12307, 10749, 17130, 32805, 10749, 9182, 12786,
+    28759, 32796, 28717, 28673, 5077, 12629, 5077, 28783, 16667, 16642, 8367, 12322, 28724, 32775, 32830, 5077,
+    12478, 12502, 16413, 17043, 28725, 28709, 12729, 28781, 28771, 32879, 12598, 12526, 28769, 28772, 10749, 17124,
+    12464, 12749, 12598, 12345, 12752, 9507, 28681, 5106, 12477, 12406, 32804, 28753, 12367, 28751, 12714, 8368,
+    9481, 12656, 12598, 4728, 16411, 16753, 16677, 12440, 9547, 28716, 16992, 17045, 5112, 32777, 20488, 5106,
+    32890, 12750, 16434, 32890, 28761, 12417, 28711, 12334, 12788, 10756, 28715, 8667, 20485, 16437, 28735, 12499,
+    12634, 8359, 8368, 32791, 12778, 16753, 9255, 10043, 32779, 16598, 28740, 28735, 32853, 10101, 8919, 12634,
+    12644, 9517, 16834, 10028, 32843, 16518, 12658, 28717, 16518, 28739, 32890, 32802, 12845, 12512, 28761, 32851,
+    12881, 12298, 28697, 12754, 9263, 12893, 4983, 20484, 12512, 28738, 32803, 20486, 32831, 32844, 28748, 5063,
+    16807, 32792, 28742, 12754, 12742, 8656, 28691, 28730, 12742, 12658, 9778, 11275, 12535, 11055, 17136, 28741,
+    12880, 12645, 28705, 28783, 16807, 28739, 12774, 12885, 10759, 32797, 12557, 12610, 28674, 12678, 28772, 11286,
+    11240, 12861, 12766, 10160, 10365, 12678, 12885, 9564, 28772, 12873, 11310, 8277, 12919, 16981, 12754, 28758,
+    28775, 12454, 32858, 11239, 12712, 32858, 10749, 12849, 32858, 12861, 12478, 32858, 16597, 12586, 11011, 28757,
+    12763, 12765, 12885, 28782, 12929, 12885, 28691, 28694, 28699, 12929, 12814, 28783, 12358, 28783, 28697, 12918,
+    28718, 8613, 16603, 12928, 28713, 12539, 12928, 12646, 12418, 28709, 16665, 32806, 32858, 32806, 28722, 12886,
+    28754, 12886, 28728, 12838, 11347, 28725, 17137, 16752, 4984, 12850, 10490, 28782, 12868, 12464, 16449, 28725,
+    8359, 32928, 12927, 11257, 17000, 32927, 28759, 5369, 28758, 12539, 16607, 32791, 16765, 32927, 16519, 11354,
+    17000, 32845, 32890, 12836, 28711, 12587, 32806, 12347, 11354, 12587, 32772, 16519, 32933, 32928, 32858, 12850,
+    17000, 12850, 12299, 28677, 28734, 12311, 28706, 32791, 10973, 32927, 28685, 32789, 16686, 12688, 16450, 16605,
+    12311, 16430, 28752, 12596, 12659, 10795, 12419, 17051, 28682, 9010, 10795, 28759, 12647, 32845, 28741, 12735,
+    12703, 9011, 5462, 28704, 12764, 12826, 12837, 28776, 12941, 32830, 12941, 5462, 12510, 12941, 12527, 12692,
+    32785, 10795, 28706, 12747, 32880, 12599, 20486, 16606, 12707, 12941, 28771, 16677, 28771, 12753, 28703, 8367,
+    12405, 28797, 5491, 12712, 10706, 12395, 28797, 12370, 12315, 16807, 16687, 28798, 12668, 28704, 9600, 16608,
+    12860, 12370, 12322, 16450, 32798, 12719, 32806, 28676, 16608, 28675, 28796, 11346, 12929, 32804, 8713, 16674,
+    28793, 28685, 28718, 28751, 32858, 28772, 32780, 5207, 8881, 12586, 28795, 28795, 28685, 17215, 28795, 28796,
+    12730, 28794, 10802, 12455, 32780, 5369, 28794, 28685, 28676, 4699, 12755, 28795, 28705, 12810, 12647, 16449,
+    12358, 12646, 8405, 12669, 12767, 12755, 28765, 12940, 32780, 28757, 11005, 32793, 28721, 16450, 9617, 32857,
+    9617, 8883, 12669, 28698, 17216, 28736, 28787, 32891, 32788, 16767, 28714, 12335, 28749, 12779, 16529, 11101,
+    16688, 12731, 9319, 10975, 11101, 28801, 5592, 12821, 28673, 12862, 11101, 5562, 12538, 5592, 28795, 5592,
+    32853, 20486, 28793, 12874, 16575, 28793, 16923, 28739, 11310, 28699, 28725, 12299, 11011, 12359, 16530, 28690,
+    16530, 28786, 28704, 28757, 32780, 28693, 12407, 5627, 8963, 8722, 16687, 12443, 12703, 12743, 28790, 28758,
+    12523, 28760, 16530, 32828, 9320, 12346, 12572, 9320, 5621, 12827, 28783, 28706, 28717, 28679, 32831, 16764,
+    12551, 12635, 12583, 16981, 32816, 32803, 8423, 32780, 32926, 17124, 28752, 28757, 28680, 28784, 9620, 12571,
+    12802, 32895, 28709, 10514, 16667, 10797, 17003, 28728, 12736, 17160, 12870, 32880, 12418, 12630, 32855, 12754,
+    32790, 32845, 17220, 16676, 28682, 12718, 28722, 5627, 10513, 16688, 12406, 28687, 16846, 32856, 16688, 8704,
+    9321, 11094, 16530, 12883, 12498, 28783, 9620, 12359, 12311, 28777, 12860, 12536, 28733, 16406, 8723, 12671,
+    12679, 28799, 8721, 32901, 12683, 16450, 5671, 32902, 28685, 16756, 12800, 28828, 28793, 32902, 9308, 28736,
+    32791, 32806, 12550, 12730, 12941, 12369, 5498, 28691, 32842, 16609, 9320, 9321, 12310, 28678, 12874, 5449,
+    16925, 28679, 28761, 12849, 32828, 10489, 12599, 12299, 32802, 28702, 32777, 28793, 32890, 17083, 32803, 20487,
+    28770, 20486, 12585, 5339, 12739, 28705, 12837, 32826, 12755, 8667, 28677, 32892, 12898, 32813, 16973, 28686,
+    12898, 12731, 32806, 32902, 12731, 12297, 28701, 11275, 28763, 12887, 32837, 32792, 12887, 16688, 28723, 12688,
+    8548, 4970, 12501, 32778, 11112, 12515, 16449, 9202, 10044, 28704, 32883, 10218, 12875, 12839, 12875, 12755,
+    28675, 12644, 32933, 10802, 16846, 32871, 11393, 12875, 32878, 28769, 28738, 12839, 12525, 32780, 8643, 17051,
+    12487, 32883, 16843, 12887, 32909, 12606, 16492, 11110, 12522, 12851, 16764, 12695, 28694, 12863, 12367, 11400,
+    12777, 32780, 11399, 11094, 28742, 12307, 20483, 12839, 16609, 12358, 9153, 28771, 12395, 12604, 16736, 28687,
+    28714, 9003, 12765, 8949, 32829, 12953, 12875, 11400, 32816, 13001, 17409, 28725, 12645, 12862, 32935, 28723,
+    5665, 28688, 12551, 12851, 28752, 32934, 12678, 32851, 32790, 28788, 28718, 28743, 11574, 12451, 28793, 32845,
+    28693, 12992, 10398, 5627, 11574, 5557, 9021, 13025, 8723, 13000, 12967, 32844, 16846, 32891, 12642, 12923,
+    13005, 12851, 28706, 8256, 12535, 12597, 16745, 12394, 12957, 11539, 12981, 28689, 32779, 12453, 28706, 12731,
+    28783, 12346, 12633, 9796, 13016, 12839, 16741, 16529, 28727, 28736, 12981, 9022, 12955, 28743, 32818, 13027,
+    11609, 12742, 12339, 10693, 9562, 20484, 28731, 5276, 28785, 28715, 9839, 28795, 28775, 28795, 13005, 28769,
+    13047, 28752, 13049, 12599, 13027, 9546, 9264, 12755, 12356, 12309, 12574, 11385, 13048, 12545, 4891, 13048,
+    5621, 16834, 17411, 12776, 32859, 16643, 12920, 32803, 32853, 32856, 12918, 12887, 11414, 12958, 10806, 32818,
+    12297, 28743, 11646, 28687, 16519, 12988, 12969, 11304, 28782, 9348, 28711, 13047, 12956, 12946, 32902, 8368,
+    28743, 11070, 16923, 16846, 20481, 11274, 12537, 17209, 28759, 8721, 12599, 12670, 28767, 28793, 10546, 17234,
+    10546, 11653, 28795, 12597, 16460, 16508, 12979, 8414, 11652, 10546, 11653, 12851, 28794, 10756, 28795, 28707,
+    8321, 28716, 28713, 12743, 20484, 16437, 16449, 32803, 16667, 28758, 28757, 8709, 16697, 12404, 12360, 28679,
+    16764, 28697, 32777, 16775, 12933, 9342, 12980, 9058, 28711, 10749, 32828, 12584, 12658, 11048, 12514, 12684,
+    9350, 9264, 12587, 13061, 28679, 32877, 17216, 32778, 20486, 28697, 13061, 28748, 8919, 13060, 28740, 28718,
+    32845, 28698, 13061, 10851, 12396, 12839, 28716, 16595, 32859, 32781, 12874, 9854, 20483, 32855, 16777, 28707,
+    16528, 13007, 13061, 16617, 6022, 28743, 5106, 28742, 9809, 12983, 12995, 32846, 28685, 28771, 17088, 28770,
+    32859, 12588, 20481, 12995, 11645, 13049, 13007, 28769, 28725, 32820, 32815, 28719, 10262, 32793, 9649, 12672,
+    28715, 12408, 8404, 12765, 12983, 8994, 12959, 16698, 5591, 12983, 11699, 32791, 10811, 12492, 8769, 11698,
+    32794, 28695, 8768, 12660, 13017, 11646, 16619, 6057, 16855, 16856, 16698, 28793, 10815, 16598, 12516, 12514,
+    13060, 9021, 8696, 16774, 13038, 12370, 12971, 28719, 16855, 32907, 16597, 13031, 6057, 8397, 8760, 28771,
+    32794, 16776, 10858, 12780, 12720, 12929, 12862, 28795, 4984, 11056, 13006, 9947, 16833, 12732, 13055, 28707,
+    28725, 9320, 12586, 32859, 12946, 12346, 9666, 28717, 28679, 12766, 32779, 8642, 11055, 12847, 28683, 28742,
+    9012, 12957, 5671, 8757, 17014, 12929, 28697, 12756, 8776, 11144, 32907, 12310, 32928, 12323, 10327, 12417,
+    6152, 12648, 12755, 12744, 28706, 12775, 12539, 28791, 32897, 12310, 12970, 16778, 28699, 11157, 28701, 6152,
+    6022, 32806, 32858, 12455, 12624, 11347, 12527, 32858, 16588, 8470, 32858, 12815, 32870, 28674, 12443, 16845,
+    11159, 12689, 32859, 32845, 12372, 12347, 13060, 12708, 16538, 6187, 9376, 8478, 32936, 28713, 6143, 12677,
+    28701, 5367, 6187, 12990, 12539, 12741, 17132, 6167, 11573, 28795, 28765, 8778, 9610, 28782, 12311, 17167,
+    16584, 28771, 10444, 11157, 12636, 28781, 8722, 32814, 32854, 28783, 16616, 10867, 28783, 28794, 12660, 16745,
+    32866, 11110, 28743, 10867, 32928, 28734, 12307, 16541, 11414, 8779, 12754, 8779, 13071, 9676, 28695, 12821,
+    9676, 28793, 8480, 12660, 6224, 28784, 13072, 9078, 17166, 16687, 32805, 10137, 12647, 12419, 12883, 12935,
+    32794, 32779, 9377, 6224, 11048, 12588, 12324, 20482, 12683, 12552, 32858, 28713, 11595, 12324, 12407, 12384,
+    28718, 16462, 28740, 32780, 28707, 12324, 12597, 10450, 16833, 12394, 28680, 28716, 13007, 8779, 12562, 28683,
+    16541, 28765, 5666, 16430, 9971, 10569, 12703, 9310, 20481, 13018, 5462, 12839, 13072, 12371, 28694, 16607,
+    28702, 10866, 6022, 28809, 28695, 28809, 12323, 28704, 12504, 5477, 8469, 20484, 32791, 28733, 28809, 16776,
+    16583, 16406, 28810, 8650, 5077, 12396, 28796, 5626, 9373, 11166, 28808, 28705, 16684, 28719, 28711, 28805,
+    28808, 12732, 12744, 28705, 28805, 28679, 28770, 6179, 20485, 28693, 16459, 8423, 10845, 12667, 16677, 12883,
+    12324, 28734, 17294, 28806, 28757, 28806, 28807, 9675, 28805, 12466, 28742, 28805, 8883, 28809, 28806, 12648,
+    12755, 12514, 28783, 17287, 16913, 28735, 5563, 12796, 10872, 12468, 12876, 16439, 12323, 10569, 8468, 28735,
+    32800, 13006, 32819, 12988, 9619, 32857, 9676, 16462, 28731, 12864, 9593, 12864, 17295, 28717, 16833, 12849,
+    11354, 9656, 17072, 10263, 28722, 12356, 12851, 12648, 28682, 12501, 16745, 28706, 28742, 28813, 16698, 16588,
+    32815, 16579, 12848, 16697, 28675, 28690, 28807, 12766, 28812, 12480, 28805, 9384, 12450, 8957, 28734, 28674,
+    12612, 12970, 16857, 28788, 12647, 12323, 8779, 32901, 16779, 12319, 8704, 28783, 32793, 28776, 28805, 12672,
+    17140, 28692, 12886, 28759, 11464, 12852, 16779, 12852, 16525, 9067, 12840, 6328, 16895, 12840, 8787, 12888,
+    28694, 9077, 17240, 12588, 28775, 10743, 12983, 28725, 9385, 28741, 10579, 12835, 28685, 12351, 28781, 28828,
+    16779, 10860, 9685, 16858, 28805, 16688, 28763, 28757, 8788, 20486, 12635, 9012, 16700, 16542, 11465, 9386,
+    6363, 12525, 4890, 28791, 10664, 12756, 16542, 28693, 13072, 32856, 8745, 32794, 12763, 12575, 6224, 12852,
+    28704, 9078, 12660, 16413, 12927, 9685, 10877, 16620, 9076, 12528, 5664, 12660, 12574, 12492, 11573, 32817,
+    12959, 8486, 12648, 10802, 28700, 12840, 16821, 11455, 28805, 28811, 32794, 9672, 12345, 32857, 12636, 28807,
+    28682, 8620, 16958, 10198, 28805, 28806, 12468, 28807, 28735, 28700, 12491, 8490, 28674, 6364, 9387, 28783,
+    9685, 10281, 6394, 12743, 32816, 28697, 16439, 28807, 12670, 8778, 28771, 8490, 32871, 11024, 5592, 32807,
+    16844, 12636, 9386, 9562, 28698, 12490, 13004, 28734, 28795, 9088, 8490, 8480, 28794, 12295, 12660, 12959,
+    12525, 17245, 28741, 12668, 12775, 16677, 28719, 28687, 8423, 28698, 28712, 28806, 12852, 28769, 28805, 10563,
+    28692, 6400, 12430, 28676, 6328, 28705, 16463, 28755, 16700, 28750, 12840, 28721, 10677, 28737, 32802, 12404,
+    28743, 28699, 32791, 16519, 28705, 32846, 12969, 12348, 12900, 12888, 32792, 17156, 32778, 5497, 28801, 28757,
+    8620, 32816, 12597, 12732, 12765, 12732, 12840, 28682, 9687, 10281, 12600, 12453, 20483, 28701, 11401, 10706,
+    17228, 32781, 32869, 4473, 12588, 28706, 32832, 9984, 28715, 17240, 11657, 32855, 9388, 11349, 11400, 28692,
+    9319, 12863, 8664, 16858, 28805, 16657, 16858, 28726, 9386, 12852, 28677, 12636, 16764, 6448, 28777, 28719,
+    28737, 28723, 32871, 28752, 9388, 28733, 32777, 12777, 8790, 28734, 28777, 8750, 28704, 13067, 13049, 12982,
+    32872, 28747, 9089, 28798, 12838, 32793, 12822, 16430, 13066, 9075, 12456, 8768, 28699, 13066, 32901, 11310,
+    9683, 13076, 12836, 16699, 17094, 12864, 11544, 12320, 32844, 28794, 28728, 32857, 8704, 28707, 11646, 8351,
+    10533, 12993, 9385, 8367, 32780, 12479, 9302, 32818, 16516, 20482, 28773, 28711, 28788, 16461, 12594, 11100,
+    12357, 12408, 12821, 16542, 9089, 8491, 16667, 6231, 9089, 9654, 8491, 12416, 8790, 12334, 11646, 9985,
+    16542, 13078, 12756, 17304, 28735, 28806, 13072, 6235, 11011, 8461, 28770, 16570, 12598, 10877, 32807, 28706,
+    10806, 6462, 17130, 12660, 12659, 16674, 9687, 8420, 10182, 5106, 12983, 32845, 17110, 17211, 32807, 28728,
+    10815, 8696, 16428, 28705, 12513, 17306, 9343, 10851, 9388, 28705, 32805, 12298, 9377, 8789, 32788, 12752,
+    8789, 16858, 12396, 9676, 12631, 12371, 28805, 16754, 28802, 28801, 28738, 28691, 32814, 12526, 16992, 32830,
+    12487, 9807, 5900, 16754, 32856, 32914, 16542, 32914, 32850, 12811, 32915, 12600, 32906, 28726, 28795, 5878,
+    32777, 11096, 28681, 9384, 32803, 11175, 32915, 13003, 5899, 28713, 11055, 28742, 28723, 12606, 12333, 12941,
+    28685, 20487, 12324, 12792, 6187, 12299, 12549, 8658, 32779, 12504, 12335, 12348, 28693, 8657, 11474, 17071,
+    28771, 16463, 16676, 8658, 16764, 28746, 12840, 12852, 8904, 13062, 12861, 9309, 32908, 8584, 12322, 6179,
+    28694, 32819, 10881, 12824, 12668, 32915, 12444, 12969, 16779, 16737, 28706, 12933, 28784, 28731, 32794, 20482,
+    16463, 6218, 28807, 9985, 12390, 28707, 16615, 16621, 32890, 32775, 12659, 32829, 10759, 8414, 12936, 28704,
+    12406, 12897, 16621, 8912, 16446, 9367, 28711, 16617, 12756, 32885, 13077, 16451, 28783, 12420, 17094, 28719,
+    32910, 16697, 12995, 28772, 28706, 28788, 17088, 11157, 28710, 12644, 9388, 16525, 12528, 12971, 12456, 9682,
+    12886, 13008, 32856, 9666, 28686, 28743, 32805, 8490, 8314, 12996, 28704, 28772, 11392, 16462, 6235, 28718,
+    12346, 32793, 32859, 6057, 16643, 32849, 6057, 9687, 11170, 12873, 9815, 32792, 6363, 16766, 32858, 16515,
+    12587, 32880, 32869, 10145, 12984, 12918, 11749, 32929, 11594, 12958, 17000, 4716, 8778, 12330, 16459, 28805,
+    12850, 12972, 16893, 28707, 12732, 28801, 9686, 28693, 8786, 10795, 13052, 12956, 12407, 12715, 28722, 32917,
+    12744, 10153, 6355, 12839, 32781, 28736, 12336, 12310, 32786, 12996, 5929, 28784, 32804, 28693, 20481, 20486,
+    13071, 6364, 8389, 12717, 32908, 8963, 16937, 28679, 12739, 12688, 16621, 10877, 10094, 12960, 11763, 8875,
+    12960, 9019, 32807, 12972, 12660, 12993, 8789, 28722, 32855, 12972, 28684, 28771, 12347, 32858, 28803, 12836,
+    32924, 12694, 12468, 16990, 28683, 32807, 28682, 28796, 28794, 10145, 32932, 6400, 12845, 12321, 13112, 32846,
+    20487, 11873, 6457, 13100, 9067, 32816, 9264, 12960, 11115, 12391, 12539, 20487, 16439, 17124, 32776, 28774,
+    12464, 32915, 12574, 8479, 16609, 32902, 28739, 28807, 11769, 12779, 12660, 12348, 13170, 28683, 28789, 28759,
+    11312, 16608, 12863, 13137, 20488, 28705, 28782, 28737, 11873, 28728, 32934, 28684, 11176, 16698, 10151, 6231,
+    12960, 28731, 9219, 9385, 32794, 8469, 12944, 13063, 12587, 9617, 28801, 16541, 10581, 28747, 9294, 28715,
+    16607, 16925, 12658, 13181, 28673, 8491, 28705, 12694, 12882, 12743, 16450, 9854, 13181, 12910, 28708, 28682,
+    10712, 28711, 12933, 13179, 12876, 13138, 32807, 28734, 13138, 28770, 12682, 28761, 16677, 28695, 9917, 12787,
+    12983, 13126, 28764, 11945, 13126, 12972, 28726, 28744, 20487, 8722, 12960, 13090, 13102, 32793, 32898, 12372,
+    32890, 13102, 12548, 16571, 28685, 11749, 28752, 12487, 9350, 32850, 11775, 12448, 20484, 11005, 32829, 10789,
+    28708, 11952, 12467, 28683, 12767, 13102, 13114, 12537, 13102, 16420, 28770, 28720, 10458, 11952, 12732, 12684,
+    13146, 28681, 28793, 12840, 12900, 9878, 16539, 32867, 12407, 16833, 5410, 28810, 32777, 11952, 32896, 28683,
+    28732, 12672, 13162, 5878, 17157, 17068, 13120, 13053, 8424, 12959, 6187, 13138, 17092, 28795, 32852, 11907,
+    32807, 10215, 17319, 28732, 13125, 28743, 28684, 17295, 17174, 28793, 28807, 11596, 5270, 4614, 32794, 28770,
+    11873, 10560, 11754, 12859, 12393, 12311, 5077, 28696, 12347, 16446, 10272, 9254, 12584, 28761, 16846, 9050,
+    13101, 20489, 32792, 12312, 32781, 17229, 12357, 10811, 12572, 11274, 4473, 13102, 16778, 6328, 32828, 16677,
+    28784, 12731, 28716, 28744, 13091, 28796, 32776, 28683, 11609, 32922, 12763, 28683, 13115, 28681, 13127, 28684,
+    28759, 6399, 12971, 32843, 28686, 13137, 16527, 5664, 12732, 8613, 13115, 12934, 12888, 13089, 28757, 12837,
+    28775, 13102, 13115, 32889, 13020, 13196, 28684, 13125, 11991, 17032, 32863, 12440, 28793, 28745, 28729, 32807,
+    32858, 13138, 16779, 10806, 17252, 11180, 28705, 12778, 12696, 11465, 32921, 13112, 12864, 17082, 20484, 32915,
+    28742, 17011, 32845, 13126, 16981, 28696, 32856, 20481, 28807, 12766, 16755, 9517, 11112, 9377, 32794, 12395,
+    28769, 12838, 10376, 12006, 12378, 13103, 11694, 12636, 12525, 16541, 9555, 16843, 12828, 16667, 28686, 12863,
+    12322, 28696, 8788, 17174, 28794, 12756, 16649, 28693, 12754, 28684, 13100, 28788, 28757, 32817, 5488, 12528,
+    10413, 28695, 10851, 16686, 16597, 13031, 10273, 6008, 6394, 12888, 12646, 28692, 12883, 16775, 4869, 10812,
+    28678, 12875, 28765, 13138, 32790, 16463, 20486, 16746, 8621, 5047, 28781, 12876, 10805, 11759, 12872, 12588,
+    16857, 16609, 28704, 13115, 32855, 12729, 32856, 32877, 13061, 12838, 28719, 13102, 11481, 11109, 12300, 8769,
+    32788, 16687, 32929, 32854, 12515, 17000, 28682, 28805, 13090, 28694, 16617, 11161, 28694, 16539, 10444, 9078,
+    17324, 12536, 13125, 12825, 12838, 13078, 32866, 12645, 10206, 28806, 10517, 12671, 6452, 32903, 32781, 32843,
+    12619, 12443, 28756, 16568, 5489, 12552, 10976, 9382, 5459, 5629, 28793, 12821, 28775, 12693, 28684, 16756,
+    12798, 32919, 28713, 13203, 12310, 16845, 12671, 10571, 12598, 28799, 8359, 28717, 28736, 32841, 32921, 12682,
+    17140, 13103, 28703, 28828, 13042, 4954, 17067, 28707, 10496, 28774, 11029, 9085, 28717, 28707, 12316, 12502,
+    32857, 28798, 12537, 32776, 12828, 28750, 13005, 16874, 32908, 11475, 12727, 16578, 28694, 13030, 12599, 12928,
+    16461, 32921, 12945, 5491, 12935, 17287, 5112, 12658, 28694, 12982, 12755, 12635, 17067, 12538, 16620, 28770,
+    9089, 12586, 16530, 12372, 9751, 8712, 32857, 32833, 8368, 32778, 16794, 12695, 16448, 12600, 9617, 28763,
+    16490, 13140, 8490, 17058, 10444, 28675, 13049, 12335, 28797, 11655, 16460, 13128, 28756, 17051, 13055, 13092,
+    12335, 11908, 12905, 28703, 32883, 28744, 32805, 28744, 16429, 13128, 11873, 12441, 11042, 28708, 28798, 32817,
+    11481, 12821, 11956, 28685, 4928, 12454, 28761, 8422, 16677, 32913, 28707, 12047, 28705, 13078, 16530, 12896,
+    28793, 13104, 13164, 20486, 12984, 12765, 13116, 28716, 6463, 32832, 28794, 28740, 32802, 12441, 13007, 13115,
+    12883, 17130, 12990, 12852, 8446, 13140, 11860, 11041, 8790, 12838, 32806, 8790, 13061, 28732, 16429, 12984,
+    9264, 11773, 12872, 28696, 32815, 20482, 13204, 9210, 28677, 10867, 32877, 12633, 32818, 28761, 28817, 11998,
+    8723, 32902, 28696, 8490, 17155, 28806, 28708, 12403, 12924, 12383, 20487, 9302, 12062, 12753, 12971, 32793,
+    28694, 12731, 28781, 28746, 6057, 6410, 28782, 28693, 13104, 8779, 10712, 28807, 12790, 13090, 13056, 17157,
+    28814, 12526, 16585, 17045, 9916, 12682, 12396, 32845, 20489, 16790, 32881, 32781, 11946, 8695, 9686, 28687,
+    17130, 16813, 32778, 17004, 10490, 11110, 17288, 12344, 8711, 17093, 28750, 13008, 9833, 12821, 32816, 16912,
+    32803, 13193, 13104, 28771, 16657, 12837, 13030, 12336, 28697, 28707, 28690, 13053, 28695, 12996, 28756, 12862,
+    28704, 12646, 12307, 8491, 10998, 16936, 16451, 13080, 32777, 9940, 16775, 32818, 28739, 28782, 8789, 28726,
+    10460, 9656, 28680, 12947, 12527, 12683, 32844, 32788, 16428, 13042, 12755, 28695, 12346, 10497, 28793, 28675,
+    28784, 16650, 32781, 13200, 28730, 17238, 12838, 28797, 11456, 28773, 28785, 12838, 28725, 12393, 9619, 32934,
+    12321, 28737, 12623, 8682, 16855, 12310, 28772, 9321, 17014, 12598, 8760, 28683, 11275, 32844, 28734, 16499,
+    9320, 12648, 12730, 8666, 8703, 28770, 10743, 12587, 12587, 28712, 28699, 16619, 28696, 28716, 12873, 12360,
+    12899, 12658, 9087, 16450, 17167, 5671, 12983, 28794, 28714, 12622, 28782, 28704, 28696, 12321, 28692, 9019,
+    9255, 16540, 28683, 12852, 13013, 32911, 6152, 16540, 28814, 28684, 13135, 28815, 12979, 11353, 13140, 12503,
+    6121, 13112, 28722, 9586, 20481, 12451, 12945, 12754, 28771, 28783, 12076, 17089, 28809, 12672, 13197, 9050,
+    12683, 12899, 12956, 16767, 11609, 16685, 13040, 32833, 12740, 5497, 12309, 12885, 16608, 12886, 28721, 12984,
+    28793, 28766, 12575, 32858, 4885, 28698, 28710, 28709, 12012, 12756, 13101, 16815, 32807, 28708, 11392, 12874,
+    32937, 32780, 12944, 16528, 13054, 13008, 10349, 17071, 28683, 12670, 32844, 17173, 28806, 9675, 13140, 12852,
+    10545, 10883, 6411, 17068, 12670, 12847, 12576, 32781, 13180, 12730, 12655, 12929, 28795, 28694, 16649, 9376,
+    28705, 16586, 16688, 28708, 13065, 16429, 6387, 28751, 28750, 11048, 12873, 16846, 16729, 13092, 10554, 28808,
+    28806, 12347, 9309, 9377, 9673, 28696, 28744, 12679, 11004, 11908, 12360, 12599, 32894, 28692, 13104, 28728,
+    11074, 10795, 28795, 17409, 28762, 28794, 9375, 12487, 5491, 28716, 12311, 12562, 12573, 17313, 28730, 10199,
+    12360, 13055, 32779, 32895, 32792, 11998, 28733, 9563, 28771, 12940, 28721, 10263, 8582, 13151, 10177, 8414,
+    12056, 16697, 13008, 11574, 16541, 13003, 12588, 28770, 10815, 12585, 17230, 28764, 12611, 28797, 28794, 28770,
+    13134, 12810, 12803, 12756, 13061, 20486, 17156, 17216, 12370, 17156, 9656, 5592, 16924, 12444, 11005, 28796,
+    28704, 12595, 28683, 11460, 12479, 28805, 8605, 9687, 13098, 16507, 17095, 12978, 9358, 17309, 12476, 32894,
+    12996, 28742, 12972, 28760, 9586, 12969, 28761, 28807, 32807, 16427, 12419, 12404, 32881, 28794, 32921, 11373,
+    13209, 12875, 12537, 5929, 20485, 12527, 12049, 28760, 17171, 12660, 28692, 12767, 9664, 13090, 16993, 32804,
+    12862, 28691, 28763, 12671, 11953, 8723, 11657, 8790, 28783, 12732, 28747, 28794, 28684, 12450, 16620, 32910,
+    12475, 28739, 28755, 8321, 8702, 32858, 28719, 8368, 10282, 17061, 8480, 8721, 9620, 13116, 32842, 28785,
+    12995, 28700, 12635, 5449, 8584, 12647, 32781, 16846, 12067, 12862, 17209, 12480, 8769, 28739, 9321, 10760,
+    13152, 10071, 28805, 28758, 32933, 28806, 28760, 32871, 13048, 12408, 28797, 12429, 32831, 28813, 12861, 12948,
+    32929, 28806, 32794, 17000, 9666, 11972, 12659, 12407, 11115, 28706, 10208, 16765, 16530, 28720, 16816, 16542,
+    12840, 12684, 12432, 16542, 32803, 10871, 9367, 13091, 12300, 13128, 5621, 13127, 11058, 17308, 11094, 16777,
+    28744, 12756, 28781, 16855, 8285, 17319, 10879, 9909, 10189, 12348, 32830, 12995, 12863, 16842, 12779, 12851,
+    20481, 28807, 12996, 11991, 28692, 9675, 32858, 28743, 32806, 28821, 32839, 12467, 28797, 12971, 28821, 13180,
+    28733, 28770, 12660, 10560, 28818, 12611, 20482, 13172, 28822, 28721, 5454, 8478, 12941, 28750, 28818, 12648,
+    28820, 17061, 12495, 11692, 16667, 12800, 28673, 8424, 12933, 13003, 28819, 12851, 17331, 17366, 11144, 11470,
+    12633, 32898, 28683, 28711, 11410, 12648, 8405, 28673, 28817, 28818, 12367, 12872, 28817, 13159, 28818, 13216,
+    32780, 28817, 12811, 16858, 16973, 5664, 28720, 12636, 10882, 17366, 13072, 12816, 12672, 16688, 11180, 16858,
+    10962, 6407, 10810, 5836, 12732, 12348, 12072, 17252, 28715, 12969, 28744, 16621, 32914, 12751, 16450, 28719,
+    16605, 28673, 16621, 12552, 28733, 28707, 28707, 12871, 28718, 13006, 12296, 12779, 28740, 28801, 12312, 32802,
+    16814, 28726, 28745, 12823, 28818, 28772, 12512, 28708, 6440, 12300, 28821, 28783, 17382, 32858, 28824, 13205,
+    12513, 32891, 5627, 28716, 28777, 9022, 11648, 12420, 8665, 13123, 12968, 13139, 13164, 28778, 28683, 9620,
+    17360, 17384, 13140, 16816, 12636, 12564, 32849, 28721, 12982, 32833, 12539, 8987, 12728, 16824, 32800, 13204,
+    32924, 8657, 10706, 32859, 16777, 9852, 9609, 12839, 12596, 17220, 9077, 12322, 32937, 16460, 28695, 5658,
+    12995, 32844, 12656, 32864, 9665, 12631, 9366, 16973, 12336, 6461, 32935, 13103, 8920, 8486, 17317, 8723,
+    32843, 17160, 12832, 28820, 28707, 28673, 28778, 16903, 12994, 16755, 11401, 13145, 28744, 28781, 9065, 12533,
+    16588, 12921, 28792, 11170, 16540, 13005, 8713, 16855, 12498, 13133, 13116, 28761, 28706, 12464, 32903, 12334,
+    32842, 12525, 12372, 12077, 12598, 32779, 28702, 16598, 5929, 28810, 12852, 28724, 32841, 28694, 28817, 16771,
+    17319, 10759, 28691, 16778, 12595, 17392, 28704, 16458, 9728, 12984, 12624, 12569, 12960, 28817, 12609, 28708,
+    16776, 12536, 28754, 32911, 13104, 13048, 12958, 28811, 9859, 13192, 13176, 16825, 17397, 28819, 12359, 8351,
+    16507, 8621, 9358, 12815, 28736, 28783, 13104, 28762, 8412, 28818, 17174, 12344, 32829, 16606, 12804, 32827,
+    16779, 28686, 11358, 12887, 12560, 28728, 13006, 9059, 28704, 9676, 28767, 8532, 28819, 16721, 11393, 16542,
+    28692, 9665, 13104, 8966, 32781, 13128, 9666, 28729, 28750, 9981, 20485, 9203, 16853, 9021, 17138, 5992,
+    10858, 28682, 10987, 28736, 12656, 12334, 12696, 17058, 28805, 10261, 8787, 9077, 17106, 12360, 12955, 12404,
+    11166, 13005, 17252, 32805, 13049, 28770, 12970, 12597, 12755, 8779, 28704, 9198, 32866, 20482, 32898, 28722,
+    12744, 8769, 12657, 12993, 9218, 12657, 12648, 12741, 13114, 28705, 16736, 17251, 12887, 11574, 16937, 9074,
+    12550, 32883, 10582, 16576, 12970, 11701, 12599, 13111, 28707, 28806, 11567, 12983, 9180, 9547, 11707, 6400,
+    13124, 28695, 12752, 5621, 9898, 28696, 32801, 28705, 17053, 28699, 9367, 28783, 32922, 32859, 28710, 12586,
+    28807, 10760, 13060, 12536, 11114, 16606, 16754, 28694, 28760, 28714, 28692, 9673, 12935, 32807, 8766, 9562,
+    10431, 28676, 28771, 28745, 12798, 12623, 13007, 11780, 12586, 4567, 12540, 28761, 12012, 16518, 12552, 16418,
+    11699, 12827, 28790, 28761, 12497, 13062, 12455, 32837, 4984, 28725, 12540, 28793, 12815, 12319, 16449, 32934,
+    12416, 12788, 17002, 6448, 12623, 8479, 16518, 16904, 32865, 28716, 16438, 8778, 13128, 28758, 13104, 8667,
+    12994, 6321, 9350, 16858, 16856, 20486, 12971, 5112, 28805, 17383, 16621, 28818, 8470, 12564, 32935, 12689,
+    20486, 17003, 10095, 28788, 13031, 32856, 9321, 28723, 28695, 28711, 32794, 28725, 12519, 12703, 6411, 6363,
+    32856, 16530, 28767, 12660, 12959, 17137, 9218, 16957, 12359, 12982, 32852, 17385, 12856, 13078, 12331, 9808,
+    6232, 13019, 9010, 12844, 28684, 16485, 12655, 6328, 28728, 16895, 5621, 28685, 28717, 16643, 11859, 12984,
+    12715, 9068, 17011, 11692, 16983, 6152, 16621, 12311, 28737, 32866, 28794, 11347, 32790, 28759, 28771, 12872,
+    17403, 12907, 28819, 13007, 28818, 12525, 12608, 12540, 10664, 32818, 28790, 32803, 28818, 13092, 12836, 12993,
+    16463, 17083, 9608, 8367, 32897, 28822, 12822, 12431, 20483, 10569, 28817, 32829, 28818, 17051, 28742, 20486,
+    32794, 28795, 32857, 10851, 11902, 17062, 12826, 11012, 12597, 12754, 12503, 28697, 32814, 28766, 10851, 32858,
+    13054, 12297, 12007, 6440, 16857, 8620, 12756, 28819, 28805, 12960, 28747, 28817, 9385, 12883, 8993, 8467,
+    32859, 28787, 8713, 12600, 6152, 28751, 16593, 17146, 28819, 12669, 12888, 12680, 32789, 11860, 28706, 11059,
+    6051, 8351, 12824, 12660, 11414, 32898, 32801, 28684, 9377, 5076, 20485, 6051, 32816, 5275, 28718, 12744,
+    17241, 12996, 13027, 28741, 17303, 13114, 11873, 13066, 9982, 12298, 11758, 12524, 32920, 12849, 12886, 32830,
+    13007, 8777, 17111, 17173, 32923, 12300, 10868, 12744, 10813, 16458, 12852, 12515, 12694, 12777, 9357, 32777,
+    28677, 17167, 28785, 13054, 28761, 13207, 11111, 13126, 10208, 17083, 28806, 13140, 10184, 28806, 10271, 28809,
+    28680, 10677, 12969, 20487, 17410, 20482, 9388, 6298, 16843, 28696, 16450, 12643, 13056, 12671, 12587, 12454,
+    12991, 8422, 28826, 28698, 11048, 28817, 32781, 16914, 32799, 16843, 12384, 16857, 32855, 12821, 17399, 12670,
+    8413, 10407, 17309, 16752, 16973, 12442, 16766, 12311, 13217, 28699, 5069, 13104, 9385, 28720, 12768, 28806,
+    16687, 32818, 16695, 28821, 28746, 28765, 17077, 32791, 28788, 12704, 12562, 9376, 28693, 12940, 12405, 16990,
+    8405, 16461, 16608, 28733, 28764, 8366, 28741, 28763, 11479, 12299, 32794, 12850, 16604, 11992, 11348, 32896,
+    28775, 28751, 28701, 32819, 9000, 16620, 8713, 20486, 16688, 28679, 10751, 28818, 13193, 8480, 28808, 13223,
+    28706, 8956, 17095, 11310, 8490, 28705, 17053, 17230, 10579, 12720, 16700, 28683, 32831, 32820, 12669, 28818,
+    12670, 28751, 11694, 28805, 12919, 28795, 17091, 28817, 12468, 9554, 12671, 16439, 8368, 28819, 32794, 32794,
+    28700, 16426, 6411, 32859, 12948, 32780, 28704, 13073, 28741, 28732, 16413, 28673, 28681, 28712, 32806, 12984,
+    11341, 12852, 28806, 11739, 16846, 20486, 12970, 16621, 16846, 12810, 9088, 12708, 28794, 5106, 28793, 12660,
+    28819, 28787, 28809, 28686, 17071, 32856, 12729, 8643, 12766, 12646, 13200, 32859, 28820, 8721, 32910, 12440,
+    10274, 11480, 8712, 12635, 28700, 12358, 16655, 9021, 17094, 32779, 28821, 28744, 10514, 28710, 17240, 20486,
+    10789, 9022, 9685, 12068, 16677, 12864, 6224, 32869, 12743, 12935, 11165, 12632, 12660, 8359, 17082, 28706,
+    12731, 16642, 12972, 11094, 11456, 12840, 17239, 17288, 10787, 12002, 12683, 28798, 28725, 9641, 9687, 32781,
+    12912, 12732, 28807, 9918, 32855, 28686, 28791, 8491, 28783, 11413, 28818, 10393, 12920, 32868, 11873, 16696,
+    16527, 16981, 12648, 28783, 28742, 13209, 16584, 9386, 8712, 12708, 8366, 12960, 12886, 28751, 12837, 28710,
+    32806, 13209, 12672, 6226, 13116, 16413, 12839, 28730, 6211, 9301, 28710, 17150, 12906, 16539, 28763, 16699,
+    6406, 17408, 28715, 12928, 16856, 32777, 28703, 9388, 28817, 12503, 16925, 12571, 11993, 28817, 13150, 12431,
+    28817, 28798, 12669, 12671, 6394, 13062, 13018, 17241, 12456, 12896, 28735, 10562, 12850, 32890, 32858, 9087,
+    8966, 10751, 8752, 16619, 12826, 28684, 17070, 12850, 10207, 17147, 12321, 12945, 16688, 28741, 32809, 12396,
+    12968, 11290, 28706, 12001, 32781, 28813, 17070, 5356, 28740, 9451, 9592, 12539, 10642, 11341, 11094, 11005,
+    32833, 32840, 28783, 32845, 12431, 12611, 32934, 28696, 13043, 17002, 12441, 28791, 9686, 10217, 28690, 8490,
+    32819, 12732, 32858, 12814, 20487, 32893, 12887, 28771, 32845, 17015, 9022, 32929, 28693, 12695, 32900, 13113,
+    11058, 28797, 28771, 28733, 8711, 32936, 32846, 12972, 32832, 8581, 16615, 28689, 32777, 13174, 12585, 13127,
+    6464, 9315, 16597, 11275, 12860, 28817, 32896, 28694, 13188, 32908, 17081, 32810, 8789, 32882, 28819, 9962,
+    12623, 12799, 32895, 32806, 12670, 10234, 12851, 9003, 28682, 28772, 10349, 16491, 13068, 32833, 32853, 28795,
+    10107, 12516, 17015, 28794, 28682, 12976, 32921, 11470, 12383, 13067, 12919, 28682, 28683, 28711, 28712, 8424,
+    12624, 13185, 9947, 28721, 13066, 28795, 13003, 10805, 17078, 28720, 9302, 12935, 5628, 12609, 16854, 11176,
+    17146, 32894, 12756, 28683, 28774, 28675, 28716, 10872, 12992, 12786, 12840, 32793, 12310, 17014, 16688, 32801,
+    28795, 28779, 13126, 4694, 28819, 12672, 16778, 6299, 32793, 6410, 5592, 12930, 11408, 9059, 32903, 12432,
+    10322, 8491, 20487, 28685, 11944, 5592, 28695, 28686, 28673, 12755, 12384, 32891, 13115, 13038, 12681, 16858,
+    28695, 13151, 32792, 12550, 12972, 28818, 12473, 17309, 32870, 28693, 11945, 12886, 28750, 9617, 28705, 32803,
+    28766, 16462, 17229, 16777, 32833, 17082, 12648, 9022, 11481, 32933, 32820, 20482, 11349, 9620, 13040, 12490,
+    32915, 12665, 9619, 28778, 13115, 6218, 9089, 28782, 12980, 12777, 28783, 11358, 12300, 17309, 12384, 12559,
+    28726, 12756, 32865, 28693, 13111, 11105, 12847, 32893, 28694, 12041, 32811, 28737, 12755, 8722, 12910, 12550,
+    16696, 12381, 13020, 12322, 10452, 12384, 28683, 32778, 16463, 12863, 9387, 8366, 10872, 28725, 32935, 17077,
+    16767, 17003, 12647, 17330, 11694, 20483, 28807, 9375, 6453, 16775, 10816, 28817, 28678, 17211, 32794, 16608,
+    12643, 12300, 9319, 6453, 9374, 6448, 20488, 32936, 28783, 12948, 17004, 11181, 11170, 32896, 12850, 12513,
+    28769, 8491, 16439, 12659, 28811, 32794, 28682, 28793, 28782, 28677, 16436, 28735, 12886, 20481, 28822, 12945,
+    16530, 12596, 32859, 13115, 12947, 10283, 11769, 6393, 32833, 8760, 17251, 12994, 16824, 13187, 28680, 12948,
+    4728, 13092, 12585, 28704, 13137, 13102, 32802, 13126, 10553, 16458, 12936, 10815, 13128, 16619, 32832, 28783,
+    6363, 28708, 17174, 12587, 9256, 17094, 13060, 5894, 12452, 28771, 8876, 12309, 12934, 16437, 32806, 12911,
+    17307, 12812, 11460, 9562, 11626, 13211, 28781, 12958, 12384, 10513, 13137, 16933, 28757, 13031, 11181, 12696,
+    28695, 16451, 28801, 11888, 8883, 12622, 12539, 9067, 5674, 17089, 9358, 13004, 12899, 6394, 32882, 17220,
+    32908, 32861, 16913, 9153, 12922, 12600, 11102, 12068, 12612, 12572, 32779, 28723, 28801, 12839, 32820, 13224,
+    32776, 11357, 6181, 8667, 11170, 28766, 32820, 32884, 32794, 12563, 28684, 12930, 17082, 13068, 28750, 16727,
+    32916, 28817, 11312, 13125, 28746, 12562, 28826, 32794, 4971, 12958, 11764, 12969, 28794, 32859, 32807, 32838,
+    12720, 12636, 28700, 32936, 32843, 12959, 17004, 32778, 11611, 10845, 32920, 16526, 17367, 9216, 9286, 16910,
+    32807, 12607, 32820, 12502, 12623, 28696, 17160, 28815, 28716, 28693, 12540, 28695, 10216, 32920, 16577, 9064,
+    28711, 11150, 13133, 32788, 28725, 5046, 32844, 12658, 17235, 32916, 12768, 28696, 32780, 28727, 6457, 17151,
+    17159, 13179, 13170, 13042, 12716, 12875, 32817, 32871, 28686, 12708, 9773, 12588, 28689, 12960, 8424, 28805,
+    11413, 12839, 28682, 28738, 13019, 9377, 12970, 12972, 11479, 13032, 13194, 28745, 16506, 13197, 32866, 28802,
+    10343, 6149, 17308, 9169, 12693, 12046, 13067, 28761, 16462, 32858, 5629, 28715, 11954, 12360, 32829, 28802,
+    13116, 12754, 12731, 12993, 4473, 13192, 13162, 28741, 28740, 12935, 32806, 10562, 28754, 28690, 12563, 12670,
+    12047, 12371, 32793, 28734, 28719, 28730, 13028, 28710, 28727, 13139, 12943, 28735, 13053, 9366, 12600, 12714,
+    13091, 16579, 12312, 12983, 5621, 8278, 12753, 12636, 12766, 9375, 13019, 6051, 17045, 8322, 28826, 5070,
+    17320, 5275, 12839, 12348, 10539, 12958, 32937, 12372, 12660, 12828, 9554, 12876, 32897, 9217, 13212, 8489,
+    11654, 12299, 32777, 8470, 12790, 12849, 11997, 28676, 5088, 13103, 12957, 28714, 20487, 28733, 32884, 32936,
+    28732, 28694, 17004, 8648, 16801, 32819, 5929, 13222, 9078, 17171, 8554, 12947, 12996, 11951, 28808, 28708,
+    13215, 28720, 32851, 12588, 28721, 12684, 20485, 11115, 12456, 32909, 12646, 13162, 17159, 16844, 13187, 13078,
+    12852, 28720, 13147, 32896, 32859, 16508, 8883, 28673, 32829, 9656, 28793, 13192, 13064, 11096, 12777, 12535,
+    13102, 12528, 6409, 16619, 13115, 17236, 12792, 9321, 13150, 28807, 16519, 16463, 12659, 12980, 12768, 28819,
+    12965, 13122, 13078, 10882, 12984, 12863, 32872, 16764, 28764, 28681, 16614, 13103, 9320, 17162, 12467, 17309,
+    12728, 32780, 28758, 28810, 28772, 13055, 32805, 20486, 11414, 12648, 32803, 28754, 12971, 17296, 28715, 12864,
+    12960, 8788, 8469, 28817, 13180, 28757, 12838, 12453, 32818, 9367, 11990, 28779, 20483, 13224, 28707, 9050,
+    16729, 16844, 8453, 10663, 13181, 12346, 32842, 8704, 12896, 5658, 32849, 32805, 28828, 16959, 9358, 32897,
+    13170, 11910, 28715, 28805, 28806, 12756, 6122, 12936, 9302, 9219, 12656, 16576, 8942, 11902, 28822, 28698,
+    28784, 16607, 28690, 12790, 28828, 28805, 12076, 13073, 32807, 12888, 16814, 28795, 17397, 17282, 28818, 13055,
+    16500, 28751, 17083, 17388, 16529, 13031, 5275, 13191, 28793, 28697, 9078, 5992, 28808, 28819, 12680, 28734,
+    12568, 12948, 9067, 12872, 13006, 17148, 9086, 28687, 28736, 28767, 32803, 12959, 13146, 13172, 16852, 11466,
+    32781, 11779, 9300, 9664, 12348, 12816, 12876, 13138, 16835, 12852, 12995, 10273, 28779, 32791, 32885, 13140,
+    16542, 8356, 11160, 12775, 28682, 12336, 9685, 28699, 32846, 28675, 28736, 4700, 10571, 12312, 17253, 11539,
+    28759, 13059, 12540, 28696, 13126, 12992, 12632, 16598, 9974, 16699, 12775, 9591, 11657, 12635, 10862, 9261,
+    13126, 12804, 9089, 16540, 17239, 13140, 13159, 9608, 10688, 9077, 32778, 28818, 16620, 12876, 32911, 13104,
+    28808, 8789, 16858, 12741, 17253, 32859, 12648, 13128, 12485, 16687, 16963, 12884, 16745, 10870, 28717, 32922,
+    16676, 10664, 12393, 28744, 16609, 10197, 13064, 11656, 12740, 9387, 12741, 28718, 28772, 32872, 16958, 32781,
+    12057, 9087, 17013, 6298, 32936, 28696, 28797, 16529, 12780, 12407, 16912, 16451, 17162, 28814, 9773, 28678,
+    17241, 12597, 17013, 11779, 17079, 28789, 16825, 17393, 28749, 28824, 13067, 10349, 8621, 28728, 4698, 12588,
+    17171, 28709, 28789, 28791, 11456, 9367, 13066, 16688, 8480, 12046, 12909, 12983, 32923, 16760, 12720, 12668,
+    13053, 32781, 12467, 17092, 28771, 13054, 32885, 16650, 11168, 28809, 10858, 11759, 5075, 6230, 13223, 28741,
+    9984, 28785, 16440, 13091, 8413, 11171, 12840, 12897, 12489, 28693, 8359, 20481, 12679, 28770, 12007, 12597,
+    16671, 10451, 28719, 9002, 32816, 13203, 12729, 28785, 12694, 8367, 11150, 20487, 4699, 12384, 12756, 17369,
+    10861, 10348, 11341, 32908, 32794, 11152, 8422, 32922, 28706, 28828, 12400, 8779, 16745, 12514, 16542, 32774,
+    20486, 13135, 9675, 28744, 13050, 8723, 28693, 12864, 28808, 32932, 12598, 12598, 28770, 28807, 12585, 9089,
+    13078, 12765, 17068, 13124, 13040, 11774, 9984, 10743, 16439, 28702, 12610, 28779, 12984, 13221, 20481, 11451,
+    28703, 13015, 12667, 28768, 12744, 8786, 32933, 28816, 28807, 17240, 17398, 28812, 16509, 12537, 28803, 12074,
+    8314, 28696, 12648, 12455, 32910, 12754, 32854, 5077, 16570, 13007, 12774, 16485, 12324, 12776, 28751, 11873,
+    16763, 28805, 9510, 11169, 32910, 32779, 9311, 12756, 28686, 12883, 28742, 28751, 16846, 11443, 28808, 32869,
+    12872, 32831, 28820, 12828, 28715, 12941, 12395, 28681, 28750, 28772, 28805, 12888, 17410, 10677, 12319, 12394,
+    28778, 28742, 32867, 16667, 32779, 12372, 13185, 12684, 9683, 12861, 12876, 16609, 16825, 11369, 12656, 12620,
+    8701, 11457, 16509, 16835, 10881, 20490, 6401, 12443, 13067, 12849, 12900, 6328, 9510, 13092, 10883, 28712,
+    28706, 12382, 28813, 12011, 12703, 28755, 12323, 10477, 28781, 17172, 28793, 12936, 17248, 28743, 28673, 11358,
+    12763, 28695, 32868, 8424, 10872, 12300, 12844, 28770, 8788, 10573, 9043, 12510, 13116, 12754, 16981, 12574,
+    9175, 12418, 28809, 13080, 17388, 12358, 28733, 12391, 32844, 12011, 32807, 28805, 8621, 9546, 10647, 28710,
+    12876, 12883, 28796, 12982, 32803, 28783, 10407, 28816, 28734, 28678, 12598, 12898, 12944, 12799, 11596, 5099,
+    12669, 17317, 28750, 12872, 28774, 16700, 28703, 8956, 28707, 9564, 12970, 12864, 9686, 16775, 17387, 28718,
+    10757, 12550, 28806, 6453, 9003, 6226, 28818, 12320, 12918, 28824, 28741, 9384, 16429, 12336, 9387, 17045,
+    9555, 32792, 13079, 32876, 11470, 12837, 28768, 12669, 9008, 28683, 32843, 8752, 32897, 12539, 28718, 32929,
+    12318, 16606, 28760, 13175, 5627, 16845, 8405, 6411, 12635, 12646, 28777, 8712, 16542, 8760, 10997, 6218,
+    16983, 12441, 28812, 13144, 32866, 13030, 28787, 17299, 28769, 28725, 28813, 28679, 16447, 13104, 28807, 28710,
+    28681, 28716, 32898, 8956, 13067, 12984, 20481, 17299, 8712, 28717, 28684, 12732, 16461, 9683, 12575, 28818,
+    32857, 8723, 13018, 13044, 28798, 11712, 32851, 12859, 12984, 17093, 9265, 28741, 28681, 32779, 28708, 16700,
+    28681, 28741, 11323, 12548, 13211, 12574, 17366, 17388, 28743, 13127, 28716, 28820, 12773, 32815, 32842, 12981,
+    13210, 32832, 13042, 12535, 12012, 10208, 12621, 8643, 16856, 28761, 12753, 28819, 8367, 16542, 12348, 13186,
+    32807, 28783, 28794, 12345, 28705, 32842, 4984, 12499, 8489, 12936, 12824, 13135, 13103, 13195, 16755, 11908,
+    32841, 10712, 12768, 28785, 12743, 16778, 17068, 12312, 9617, 11469, 13003, 32806, 11470, 13124, 13198, 13188,
+    28775, 13073, 28714, 28759, 12654, 12430, 12634, 10274, 28707, 11469, 13068, 12822, 8790, 13008, 28817, 12395,
+    8411, 28703, 12672, 16697, 16587, 17411, 17411, 32921, 11765, 32889, 28718, 32794, 11939, 16608, 12646, 12454,
+    9376, 28740, 12960, 28782, 28674, 8779, 10458, 28814, 8722, 12706, 12981, 11947, 28695, 8366, 28747, 28747,
+    8338, 12528, 6009, 9388, 28763, 12690, 16666, 5369, 13028, 12600, 12346, 12539, 13124, 13056, 28729, 12323,
+    28771, 12739, 12850, 32857, 28794, 8982, 9955, 32777, 17226, 32803, 9211, 12439, 28701, 28789, 32805, 13032,
+    17058, 32866, 5915, 28823, 12336, 32793, 12527, 13080, 32856, 10152, 20490, 12391, 12894, 12828, 16844, 28783,
+    11088, 8769, 13008, 9320, 13004, 13146, 12918, 16429, 28807, 32898, 17399, 13123, 13020, 12715, 28681, 16737,
+    11011, 12054, 11102, 9687, 12366, 16421, 13030, 12811, 12939, 11481, 28703, 16973, 17157, 28704, 28732, 32867,
+    28688, 17137, 13164, 8453, 16858, 12936, 8703, 11050, 28771, 28805, 11480, 16903, 28795, 16981, 13197, 17225,
+    12340, 6363, 12972, 17146, 13196, 12918, 32909, 17189, 12934, 10114, 9311, 8423, 9503, 11755, 12767, 28732,
+    28783, 28806, 11304, 20490, 12296, 28757, 13125, 11180, 12822, 32877, 6448, 28822, 28773, 12544, 9210, 12357,
+    32807, 16457, 6457, 4891, 16756, 9851, 9817, 12860, 28773, 12407, 28817, 17069, 9265, 12861, 8789, 28683,
+    12396, 13090, 28679, 28784, 17067, 32781, 5603, 32807, 28785, 9077, 9002, 12731, 16509, 16700, 13215, 13101,
+    12480, 12539, 12732, 6328, 11181, 28676, 12910, 12405, 10976, 10706, 28780, 13209, 13114, 9618, 28810, 16830,
+    28818, 28707, 12744, 16608, 8667, 28687, 28678, 32856, 11310, 12347, 28706, 13187, 28673, 32857, 9619, 10860,
+    28782, 16530, 13192, 16440, 12799, 16697, 28793, 32934, 12465, 32921, 28742, 11275, 12635, 28822, 12310, 12773,
+    32890, 17174, 10178, 6457, 9320, 20484, 28741, 12715, 10883, 32807, 17235, 12811, 28682, 9388, 32911, 12803,
+    12732, 13006, 17077, 12840, 10759, 11341, 20487, 12811, 12718, 32857, 12504, 16853, 5455, 16608, 28826, 9891,
+    28707, 8752, 16854, 17331, 12418, 17070, 32856, 13003, 8359, 12319, 16435, 16936, 12815, 28815, 28787, 13181,
+    28819, 28732, 5497, 12696, 9311, 16447, 12538, 12572, 12476, 12992, 17251, 28784, 16895, 9073, 20490, 16776,
+    16570, 17404, 6292, 13124, 12312, 5562, 28786, 13028, 8422, 9647, 32904, 12837, 28777, 11993, 13185, 11393,
+    12992, 11750, 28820, 32844, 5112, 12416, 28805, 32793, 12876, 13144, 12811, 11481, 16903, 9685, 12874, 8683,
+    5497, 28696, 12957, 13020, 8912, 12804, 32924, 9896, 16698, 13066, 32779, 28782, 16922, 20485, 12598, 16429,
+    16766, 32793, 10215, 32780, 13056, 13068, 32882, 12826, 12941, 28822, 28688, 12538, 32920, 32936, 12456, 12952,
+    28766, 11042, 12792, 17161, 16541, 12873, 12503, 28681, 16508, 13008, 17045, 12822, 32924, 11088, 12490, 12486,
+    16936, 12635, 10490, 28820, 28735, 13051, 32779, 20481, 12634, 28768, 13003, 12900, 28795, 28727, 12562, 12368,
+    12372, 28775, 13088, 17068, 32803, 13064, 28764, 17220, 16688, 13079, 10706, 12078, 12992, 12873, 28809, 12297,
+    28741, 28675, 11341, 9021, 12352, 13162, 10545, 12981, 11048, 12972, 12683, 8466, 10414, 28817, 28707, 11956,
+    13199, 28788, 28782, 28827, 12396, 13003, 28694, 12764, 17367, 28815, 28695, 28819, 17150, 28680, 12587, 28692,
+    12648, 12756, 13150, 28796, 17241, 9321, 32858, 28719, 12864, 28740, 16700, 16485, 12811, 12294, 12635, 10507,
+    16846, 32934, 32934, 20481, 28784, 9673, 16697, 12624, 28745, 9309, 28770, 17132, 10505, 11479, 12618, 12502,
+    28784, 12395, 12345, 28699, 12660, 28695, 12940, 12336, 32931, 12574, 16698, 28745, 12919, 9584, 5106, 28701,
+    10760, 32803, 28795, 16696, 28762, 12417, 9970, 28699, 16588, 8490, 28797, 28679, 32836, 13019, 28828, 12335,
+    11170, 16846, 16491, 12356, 32792, 16541, 12502, 11475, 16974, 12983, 12994, 12958, 17250, 13223, 12560, 9067,
+    28825, 28763, 12299, 12078, 12634, 12851, 13186, 12527, 9517, 17151, 32781, 13088, 13162, 16528, 13103, 28746,
+    32820, 28680, 32929, 17011, 10274, 11765, 11093, 12041, 12540, 13073, 28794, 12971, 9051, 12704, 12930, 6224,
+    12528, 16461, 16542, 16461, 11355, 12621, 32859, 13191, 16855, 11990, 17094, 17081, 32923, 12571, 8256, 12862,
+    28757, 9975, 12886, 28782, 11991, 11769, 13187, 8704, 12645, 12299, 32916, 12564, 32923, 17410, 8414, 12475,
+    13092, 28717, 11768, 28772, 12839, 16831, 28754, 12660, 8946, 9076, 17224, 12765, 8784, 32816, 12407, 28788,
+    12648, 28697, 10816, 28807, 28735, 12858, 28724, 12300, 28693, 12600, 13186, 28733, 16700, 16845, 13185, 12406,
+    9980, 12298, 28758, 28768, 11993, 16925, 10870, 12540, 16936, 32789, 28801, 32879, 28817, 11181, 16596, 12574,
+    11910, 16699, 12660, 32803, 32778, 12367, 12909, 32848, 13102, 12657, 11991, 12958, 16655, 12960, 28781, 16698,
+    12669, 11709, 28728, 17211, 12073, 9973, 5670, 28768, 32884, 9657, 12564, 12671, 12863, 12690, 12312, 12670,
+    12525, 12935, 12547, 12077, 12907, 12875, 32807, 16439, 12863, 16857, 12684, 6123, 9051, 32793, 32819, 12348,
+    12682, 28792, 12333, 11686, 12992, 12296, 12933, 32820, 10806, 16835, 28707, 5461, 32929, 10812, 12924, 12369,
+    12672, 28683, 28770, 12751, 12599, 12393, 12864, 32794, 12312, 32896, 13027, 12827, 16672, 28684, 11355, 12586,
+    16509, 5491, 12599, 8480, 17217, 9088, 9686, 12526, 11708, 28754, 16856, 12008, 28693, 12944, 13038, 8423,
+    12959, 12358, 6022, 13212, 28798, 28684, 28819, 28743, 12068, 12984, 9078, 12957, 6277, 9020, 11768, 13207,
+    28688, 12342, 13092, 12885, 16406, 10184, 28796, 8790, 32859, 12552, 12598, 28712, 28733, 12391, 13198, 13044,
+    28796, 32815, 12346, 32779, 5916, 10158, 12981, 8657, 11102, 9610, 11312, 16417, 6138, 12946, 9377, 9366,
+    13000, 13127, 13220, 9600, 9615, 12743, 28719, 12012, 12563, 12755, 16451, 28674, 17383, 28781, 28802, 17157,
+    10514, 12573, 9862, 28780, 13031, 12335, 28784, 28786, 9555, 11137, 12867, 12835, 16825, 16767, 8383, 16463,
+    13056, 5991, 12372, 12780, 28723, 12491, 12972, 32844, 9252, 28709, 11158, 12548, 11945, 12063, 12407, 16993,
+    17361, 5929, 13222, 28692, 11574, 12768, 16462, 28738, 28771, 11645, 12551, 28704, 8477, 12487, 13199, 11013,
+    9321, 10812, 10693, 16700, 32843, 9131, 8955, 13080, 9309, 32893, 28807, 9919, 28683, 12647, 11640, 28698,
+    28713, 9373, 28744, 28693, 9375, 28794, 11837, 28825, 13104, 28809, 12603, 11993, 5658, 28744, 12695, 9358,
+    10159, 8480, 13055, 16588, 32858, 9066, 28705, 8453, 12730, 32839, 12504, 28774, 5592, 5987, 28737, 12667,
+    28771, 16839, 16858, 12942, 12384, 8993, 32909, 16527, 8787, 28694, 9554, 12539, 12935, 17235, 10516, 32903,
+    12323, 10431, 32816, 13074, 12768, 13006, 13038, 13147, 17288, 32843, 12944, 32903, 9256, 28705, 28705, 10561,
+    12659, 11105, 28680, 28820, 12058, 17014, 9861, 12994, 16616, 12002, 17399, 16894, 28719, 28700, 12011, 12336,
+    28760, 16778, 9554, 12012, 12802, 13012, 28804, 12298, 12742, 17157, 28692, 5666, 28731, 11404, 28774, 12548,
+    28806, 13061, 28698, 12077, 13048, 28695, 28807, 9683, 28754, 9984, 16937, 32833, 28744, 28702, 13135, 12402,
+    10859, 10562, 8777, 13115, 32775, 32780, 13199, 12971, 32819, 11449, 8786, 32777, 9020, 11150, 13150, 28825,
+    13124, 8778, 12646, 17408, 32905, 12875, 12882, 16451, 28750, 5449, 12406, 13013, 13050, 32844, 9309, 17404,
+    11703, 10514, 12574, 8650, 12549, 13206, 12993, 8788, 12909, 11409, 12419, 11640, 32781, 28698, 28696, 12356,
+    28804, 9899, 16542, 28746, 28807, 11708, 9657, 28806, 13138, 12898, 16845, 12538, 8478, 16463, 28814, 28806,
+    9152, 12631, 12420, 28728, 13128, 13115, 28735, 5355, 28682, 16542, 12371, 10992, 28698, 17320, 32937, 13092,
+    6186, 28677, 10812, 10730, 32934, 11479, 32794, 10271, 13019, 16608, 28796, 13085, 13027, 13210, 12562, 12583,
+    28740, 32897, 32794, 10262, 9247, 32778, 12648, 12407, 10199, 12599, 28742, 16542, 28681, 12477, 11414, 32792,
+    6409, 12730, 9620, 28770, 12041, 12597, 9301, 20490, 12515, 32819, 12299, 12983, 32910, 12538, 12334, 12514,
+    13161, 12528, 4699, 28789, 28761, 16763, 28817, 13176, 28828, 12053, 12417, 32781, 32802, 9088, 9078, 12012,
+    17374, 20486, 12660, 16699, 12079, 9891, 13008, 28687, 28710, 9479, 13099, 12450, 16834, 13149, 28805, 8368,
+    12002, 9376, 28685, 28794, 16620, 12300, 12875, 12552, 13127, 28743, 28684, 8786, 28688, 8422, 28682, 12477,
+    16609, 12300, 32916, 12959, 32850, 8702, 32850, 12717, 13054, 28771, 9377, 12658, 12815, 16858, 12786, 16586,
+    17014, 28795, 12310, 13135, 28744, 10860, 8606, 8779, 12982, 28764, 12408, 12407, 12695, 10184, 12600, 12491,
+    8789, 17013, 12672, 13102, 9088, 12077, 28682, 12743, 10569, 12850, 9815, 10845, 9087, 28754, 28795, 17398,
+    6440, 32827, 16426, 12959, 13079, 28717, 8964, 12600, 28724, 32828, 16843, 12595, 9563, 10515, 28689, 32851,
+    12563, 10862, 6224, 13113, 12540, 16844, 12524, 16737, 12536, 28822, 12898, 12347, 8314, 28760, 28703, 28714,
+    28745, 12838, 28744, 17375, 9076, 11729, 16657, 12584, 12300, 12584, 12462, 12540, 12535, 10506, 11640, 13029,
+    9601, 12464, 12636, 28750, 12659, 16460, 8459, 12564, 12728, 12596, 12466, 28691, 12451, 12828, 11160, 12936,
+    13055, 32793, 9385, 16686, 28786, 12536, 12643, 28692, 12872, 12761, 32852, 32780, 6152, 13027, 12539, 12657,
+    32779, 32794, 8469, 16746, 4635, 28743, 4635, 9376, 28679, 28681, 28689, 28817, 12680, 12049, 12672, 12309,
+    16578, 32831, 12838, 17361, 17305, 28801, 10550, 12535, 13200, 12840, 17308, 32897, 8358, 12775, 11479, 9684,
+    13039, 28785, 28820, 12078, 8776, 32855, 28706, 12958, 28674, 28791, 28740, 16643, 9011, 11700, 11150, 12764,
+    28687, 13184, 8368, 12645, 16686, 12420, 28737, 9377, 6051, 16656, 28758, 16542, 28794, 13007, 12768, 9211,
+    32859, 28719, 12727, 32910, 12983, 12598, 12513, 32866, 20486, 16858, 28712, 9022, 9919, 28693, 6433, 8788,
+    32813, 12732, 9255, 28706, 12848, 28676, 28703, 16959, 9218, 12995, 13174, 12670, 28682, 32845, 32877, 6454,
+    32844, 9309, 16936, 16825, 12595, 28752, 13066, 28717, 32833, 12731, 6445, 17240, 28729, 12971, 9608, 28711,
+    12408, 12536, 28730, 11161, 9021, 16835, 6356, 16965, 28818, 13091, 28806, 32885, 9001, 10859, 13160, 8966,
+    28826, 8306, 12657, 28683, 28683, 12564, 17172, 12348, 32803, 13170, 9601, 28675, 32779, 8789, 9675, 8949,
+    12444, 17059, 32818, 28676, 12560, 28801, 13089, 32911, 5112, 28679, 10481, 28717, 12741, 12863, 8713, 32836,
+    12348, 12655, 32817, 28826, 32802, 32789, 11992, 28793, 17236, 12371, 28721, 9367, 32814, 16936, 28821, 12767,
+    32924, 12898, 12799, 8461, 28820, 10711, 12498, 28737, 32816, 20481, 12647, 32817, 10881, 12576, 11709, 17238,
+    20487, 16523, 12932, 32806, 12634, 11042, 9952, 28781, 16989, 28751, 12884, 10776, 8965, 13220, 12372, 28821,
+    8920, 12430, 28757, 12859, 13103, 28793, 12392, 4636, 11144, 8995, 11161, 28747, 13062, 12851, 28818, 13079,
+    8397, 13175, 28806, 12438, 8666, 8711, 17314, 12835, 12419, 11769, 28790, 12383, 32917, 12420, 17089, 12857,
+    9885, 12369, 16677, 13064, 13073, 12408, 12528, 32880, 12439, 12622, 16429, 12370, 12828, 16451, 12300, 12670,
+    11451, 28808, 28768, 17051, 28716, 17308, 8337, 32820, 9350, 28796, 12660, 12334, 6232, 9078, 28820, 13224,
+    32779, 9255, 28700, 28818, 32851, 28784, 17299, 16621, 6232, 9203, 11087, 17290, 11655, 28689, 32807, 5064,
+    12728, 16846, 28716, 28734, 28742, 28687, 16539, 13112, 28729, 12744, 28694, 32859, 28809, 17016, 11380, 12929,
+    17388, 12535, 11748, 16959, 13221, 28821, 9681, 32805, 5093, 28705, 12764, 12576, 32854, 28694, 16673, 13002,
+    9021, 28785, 28698, 13077, 28675, 28828, 20483, 17094, 28707, 5921, 12874, 12883, 11181, 12883, 32841, 10876,
+    12924, 13029, 17304, 9308, 28758, 12382, 13067, 12754, 28693, 13224, 12359, 9210, 28806, 12367, 9256, 10246,
+    16858, 28726, 12503, 12876, 12680, 28763, 12839, 16779, 13136, 17083, 16620, 12907, 32819, 11048, 16597, 11261,
+    12996, 17378, 28803, 28742, 32818, 11115, 28719, 28711, 11469, 12538, 12970, 12861, 11902, 12849, 9608, 9088,
+    12744, 10729, 13140, 28808, 28751, 12512, 13222, 12852, 28825, 12753, 32857, 5047, 10570, 9601, 12510, 12426,
+    28708, 8620, 12861, 28743, 28814, 5484, 32851, 28680, 10280, 12972, 9666, 12849, 12562, 16755, 28769, 28688,
+    28677, 28762, 12416, 32855, 12730, 28815, 12718, 6408, 8348, 8424, 10579, 28733, 28707, 12684, 8713, 32807,
+    12007, 12579, 13090, 12535, 9852, 11544, 12861, 12825, 32845, 28713, 28784, 6439, 9256, 10868, 12852, 8745,
+    28821, 10537, 28694, 13223, 28721, 9309, 6328, 17396, 28729, 8965, 28674, 13088, 12971, 12646, 12801, 28809,
+    32841, 12358, 8469, 13223, 10870, 13181, 13089, 32780, 12754, 12551, 9320, 12671, 9263, 9676, 28778, 28720,
+    17092, 12779, 13055, 28749, 12840, 32819, 20485, 16519, 28695, 28794, 12375, 28741, 28730, 28756, 28717, 28744,
+    28818, 11291, 10832, 12480, 6226, 16845, 32831, 32822, 12822, 12660, 13001, 12322, 16973, 12659, 28698, 32780,
+    13018, 28826, 28683, 28675, 12862, 16461, 9043, 17124, 28824, 13088, 28820, 17393, 12599, 17378, 12837, 28795,
+    28825, 28772, 12384, 12492, 28817, 32916, 8720, 16619, 28719, 10789, 28755, 28736, 12930, 11075, 8718, 28721,
+    17031, 17052, 12348, 5834, 28682, 12672, 13135, 28751, 8479, 16684, 28683, 11341, 12766, 17051, 28720, 28742,
+    28707, 5112, 28807, 11742, 12467, 16525, 13113, 12936, 12729, 28772, 9012, 28796, 12502, 16983, 16463, 28731,
+    5970, 10414, 12537, 10496, 28762, 10669, 10273, 32895, 28813, 9656, 16857, 5835, 12395, 12597, 28782, 12297,
+    16993, 28753, 17239, 6446, 8422, 28750, 13101, 12420, 28773, 12442, 10706, 12336, 11999, 9301, 12742, 11748,
+    16577, 13091, 28769, 6440, 32807, 13032, 28808, 8421, 12755, 16620, 17332, 12850, 13087, 28710, 12777, 12969,
+    28682, 9642, 12682, 9287, 12384, 20490, 20490, 17329, 12898, 28692, 12330, 28723, 12383, 28705, 16614, 28707,
+    16765, 28707, 13020, 12336, 28790, 13113, 9366, 16844, 17071, 12928, 6408, 32789, 9319, 13115, 9319, 12683,
+    8987, 16767, 9302, 17387, 12864, 12971, 16419, 8491, 12540, 9235, 28709, 12372, 9664, 11357, 16530, 28794,
+    12731, 16539, 12881, 11998, 32794, 12763, 12659, 32779, 12539, 16655, 13211, 20490, 32793, 11571, 16698, 32818,
+    28692, 32868, 12984, 28725, 28745, 32780, 12503, 12811, 12799, 17378, 10743, 12564, 32876, 17383, 32891, 5432,
+    9388, 8722, 16428, 4977, 28805, 28795, 16700, 16688, 32856, 8461, 12335, 28696, 16540, 28796, 16688, 28742,
+    28782, 28733, 17367, 16887, 13075, 28741, 28750, 16527, 32791, 13003, 28823, 17409, 11075, 16777, 17399, 20485,
+    16688, 16895, 28700, 12431, 13136, 12537, 16598, 12921, 12822, 28719, 11291, 12752, 8424, 32882, 28796, 12754,
+    9861, 28745, 8918, 12633, 12753, 16755, 28758, 12599, 11842, 11075, 6174, 32793, 32856, 6440, 16697, 12526,
+    28683, 17315, 32843, 12884, 10789, 12658, 16621, 16936, 9555, 12993, 11944, 12873, 28704, 8769, 28744, 16440,
+    9051, 12311, 9076, 16857, 13101, 12917, 16673, 9609, 17317, 17325, 12008, 13052, 13170, 28716, 32787, 12307,
+    10152, 28781, 11460, 13004, 11750, 17409, 28793, 9683, 11182, 11902, 32793, 8478, 12979, 16974, 17174, 8658,
+    32858, 11938, 9077, 28694, 8367, 32885, 17268, 28714, 12646, 12336, 5657, 11648, 32856, 16834, 28756, 11685,
+    12346, 12828, 28684, 11476, 13127, 9838, 32854, 32818, 9388, 12766, 12840, 12918, 28763, 11409, 28784, 12996,
+    17408, 28699, 17059, 32932, 12451, 28741, 28724, 16542, 11304, 12732, 32877, 13126, 28764, 12883, 13192, 5579,
+    9388, 32909, 12979, 12619, 28798, 32889, 9003, 12671, 12396, 32916, 9088, 28740, 12372, 12440, 12521, 28772,
+    28804, 11779, 13139, 32818, 12755, 6055, 32924, 16990, 12387, 12778, 10712, 28813, 20487, 28743, 28827, 32805,
+    16650, 28801, 12822, 12968, 13127, 28708, 8470, 11094, 9619, 16937, 28771, 12463, 13193, 12873, 13100, 16657,
+    28751, 13170, 11393, 9010, 12703, 28792, 12967, 10751, 12324, 28676, 12930, 16686, 32920, 12540, 32790, 6365,
+    13139, 28766, 28696, 28827, 28713, 9086, 12672, 32869, 12982, 12742, 13008, 12634, 8962, 28762, 16609, 11058,
+    11999, 28740, 12528, 13134, 12456, 28743, 16519, 17225, 12647, 32923, 32846, 28773, 12376, 16537, 28747, 16458,
+    28684, 32854, 16699, 13199, 12778, 28719, 12585, 11348, 12956, 12839, 28783, 32923, 28817, 12514, 5490, 32833,
+    13103, 12917, 12992, 11347, 12981, 12755, 12957, 11178, 12597, 12540, 12972, 28744, 32812, 13211, 16756, 12863,
+    11742, 13100, 8759, 28746, 28714, 12537, 12524, 13038, 12360, 16767, 9854, 32878, 11054, 12597, 10270, 16722,
+    28743, 28746, 12600, 10217, 11603, 12538, 12767, 9298, 17217, 16421, 10706, 16983, 28691, 11275, 32870, 12636,
+    32937, 28736, 32891, 28767, 28790, 12801, 13007, 28792, 12561, 6401, 13090, 9973, 12480, 12934, 12646, 12981,
+    13044, 28771, 28784, 12875, 32846, 12408, 12644, 11765, 12942, 8722, 10976, 12970, 12984, 11042, 28704, 8571,
+    9059, 28768, 32903, 28744, 10161, 12551, 12600, 13171, 10459, 8234, 10496, 11395, 5658, 32897, 17229, 28718,
+    32917, 16779, 28734, 9058, 28773, 28769, 11639, 28747, 32789, 28823, 28782, 16858, 12715, 9078, 10969, 28827,
+    28710, 12610, 11672, 11088, 12456, 12348, 32856, 32919, 12982, 13104, 12957, 28689, 12588, 28765, 17015, 28752,
+    32805, 12863, 28724, 28780, 32794, 11011, 9321, 5462, 12766, 10757, 9358, 32903, 11304, 8423, 6402, 11780,
+    12820, 8788, 13194, 13180, 28718, 6456, 13137, 13112, 17170, 11135, 28795, 32871, 11115, 32878, 11769, 9253,
+    28751, 28781, 10758, 12693, 13176, 13050, 12798, 13186, 16746, 12600, 17171, 28720, 32820, 32935, 13091, 28716,
+    28798, 12621, 28808, 32884, 12848, 11102, 8460, 28798, 28743, 12683, 9971, 28713, 12333, 12681, 12968, 12767,
+    13056, 32884, 9657, 12788, 28772, 12934, 9367, 32882, 12540, 16856, 5462, 17141, 9066, 12900, 28762, 28824,
+    12300, 28827, 10505, 9168, 8478, 16657, 28784, 17124, 12885, 11902, 9610, 17140, 12825, 16621, 17203, 28732,
+    28775, 28722, 28795, 28796, 28719, 12540, 28684, 10968, 9068, 28770, 12767, 10504, 20486, 13175, 28747, 12874,
+    10371, 12971, 16992, 32896, 12958, 32829, 17132, 12600, 32893, 17208, 20484, 12399, 13092, 12984, 16697, 10713,
+    16900, 13018, 16982, 10803, 8470, 16932, 12300, 10803, 12564, 16776, 12647, 8709, 17140, 10215, 8905, 13104,
+    8410, 28803, 10811, 12755, 12984, 5836, 12851, 28791, 32830, 28724, 28807, 12779, 12658, 9809, 16621, 16774,
+    28769, 28773, 16854, 12934, 13198, 28708, 8723, 28730, 12971, 28697, 16846, 9365, 12789, 12767, 12552, 28717,
+    12838, 12983, 8723, 10714, 8301, 8367, 16993, 20486, 28785, 12648, 17367, 8477, 17045, 10812, 16463, 11999,
+    28800, 28796, 16695, 28778, 11150, 28796, 28815, 12635, 9365, 6231, 11648, 28693, 32934, 12468, 12983, 8757,
+    32893, 13049, 12671, 11111, 12317, 16577, 32859, 12851, 28716, 9234, 6380, 9059, 32880, 16688, 11609, 12717,
+    12801, 13199, 12918, 11358, 12539, 28765, 20485, 32857, 28714, 8479, 12524, 16777, 17061, 11309, 10414, 32895,
+    16688, 12761, 17082, 12540, 28828, 13194, 28714, 12995, 9366, 10568, 12372, 32903, 12426, 28738, 28722, 28781,
+    12764, 28737, 28684, 28721, 12684, 12456, 32792, 12464, 9066, 12516, 28680, 12970, 13004, 17151, 9077, 32932,
+    28768, 6297, 32826, 28736, 12993, 16541, 17004, 16541, 12932, 28715, 12643, 8769, 32907, 9319, 28706, 28772,
+    28722, 28806, 12372, 9022, 28734, 28697, 16857, 17149, 11379, 9518, 28743, 11759, 6204, 13065, 8491, 28698,
+    17161, 28734, 12308, 32936, 28770, 6152, 10560, 16654, 32883, 12921, 16508, 12600, 12969, 12297, 32904, 32882,
+    12592, 12540, 12718, 12779, 12468, 9077, 16570, 17330, 10845, 13160, 9003, 11404, 28805, 8278, 9962, 16935,
+    8779, 5629, 12300, 28683, 16744, 28708, 28805, 28763, 8424, 12645, 12887, 12826, 11692, 12634, 16880, 12345,
+    12534, 28708, 12934, 13216, 28825, 10270, 12319, 11050, 12885, 12432, 28721, 12768, 20487, 11386, 32794, 28808,
+    28697, 28701, 17168, 28808, 9387, 28718, 12731, 6328, 10872, 12813, 12011, 17150, 16657, 32841, 28769, 13188,
+    12058, 12559, 12945, 12980, 8618, 28723, 12824, 16463, 10760, 12419, 13055, 12940, 32884, 28792, 8739, 12942,
+    12428, 10515, 28802, 13212, 12453, 32903, 12993, 12393, 32820, 17348, 28720, 28783, 32778, 12516, 11166, 32829,
+    12864, 13139, 28742, 13050, 9365, 28751, 17080, 6189, 9068, 13211, 28707, 12355, 12839, 9311, 12827, 9620,
+    12333, 32929, 32857, 12358, 20489, 28773, 12840, 28700, 17195, 17123, 16855, 10553, 32776, 13210, 9087, 12702,
+    16462, 12513, 13102, 11355, 32872, 13135, 32843, 28800, 12840, 10760, 12659, 12983, 12911, 12054, 12993, 12538,
+    13128, 13103, 11766, 28789, 8488, 12574, 16621, 28720, 12323, 12660, 16700, 32857, 12079, 16931, 9808, 8723,
+    16699, 28725, 28733, 28676, 32819, 8918, 12666, 11414, 12295, 32805, 17229, 12041, 9904, 12946, 28771, 28770,
+    32937, 10406, 11387, 20486, 10698, 28696, 17011, 12041, 12538, 28788, 17081, 11640, 28819, 28806, 28715, 12312,
+    32843, 20486, 12575, 13114, 20486, 10281, 12956, 32820, 28687, 16937, 11947, 12768, 28785, 28676, 12672, 16399,
+    12599, 32857, 13188, 9020, 12740, 13092, 16846, 6298, 12983, 13103, 28828, 13212, 28808, 5621, 28777, 28778,
+    12573, 13062, 16858, 8480, 12464, 16983, 9984, 12672, 12681, 28801, 13139, 9182, 10924, 11387, 12596, 12876,
+    28674, 12537, 12671, 10803, 28766, 16436, 13065, 11169, 28796, 28771, 20481, 12631, 28782, 9089, 12552, 12312,
+    28753, 16463, 8776, 28748, 9684, 13200, 32858, 12886, 12730, 17229, 32868, 10214, 28743, 17161, 28720, 6466,
+    16438, 12552, 5664, 9067, 6051, 12875, 28745, 6446, 13038, 17151, 13128, 16542, 16683, 28695, 17088, 8490,
+    12415, 10145, 12336, 11312, 13073, 11603, 32908, 12322, 11609, 32909, 12047, 17251, 28801, 17230, 32935, 16505,
+    20489, 17003, 12418, 28677, 8788, 12442, 28718, 28751, 28776, 32930, 16700, 12995, 17000, 32895, 12500, 12049,
+    28757, 10573, 12996, 12372, 6205, 12418, 28800, 32858, 8957, 12756, 12588, 28687, 9020, 11574, 17246, 11691,
+    28718, 28681, 17211, 17087, 11932, 11640, 16755, 28815, 32842, 32934, 16621, 5666, 17002, 12888, 12669, 11158,
+    12776, 32776, 10806, 28744, 32803, 28804, 10845, 12456, 28816, 12295, 12348, 32904, 8650, 12293, 28783, 12336,
+    16621, 28673, 6218, 28751, 28722, 28702, 12396, 28697, 28787, 12594, 12743, 12417, 12379, 13111, 10963, 28771,
+    28688, 11449, 16767, 9386, 16541, 12942, 12440, 10963, 12994, 12624, 28725, 12074, 11925, 12852, 12580, 11104,
+    28750, 8488, 11691, 32872, 12360, 12334, 28769, 17173, 32884, 12336, 28735, 28744, 16842, 9620, 17230, 11111,
+    8490, 16924, 32859, 28698, 32842, 12946, 16517, 17398, 28711, 9089, 28728, 13040, 32790, 32841, 32904, 17304,
+    17168, 12454, 8723, 12559, 6173, 28790, 12456, 8790, 13061, 11843, 13113, 16607, 13054, 32868, 12767, 28720,
+    17162, 28723, 12684, 12654, 16932, 32937, 13212, 11096, 28767, 16835, 17004, 13223, 8491, 17236, 32933, 12346,
+    32909, 12369, 17161, 28742, 11115, 28717, 9017, 10871, 17239, 12465, 17241, 16746, 11161, 28793, 28716, 32895,
+    28720, 12971, 12078, 12402, 10857, 5584, 9675, 6022, 12310, 9217, 16886, 12784, 16686, 32779, 12624, 12977,
+    17296, 32908, 11275, 16700, 5673, 32815, 28693, 16598, 16823, 6180, 13078, 13038, 11657, 28738, 11158, 28713,
+    12441, 28708, 11158, 28782, 12803, 12732, 11608, 12607, 9088, 17170, 17384, 12645, 32851, 8480, 16754, 28740,
+    16700, 12466, 17318, 28687, 11735, 8966, 17095, 8919, 17162, 13140, 10946, 12935, 13103, 32907, 16598, 28766,
+    6365, 12791, 20485, 12684, 12299, 16608, 17308, 12516, 5674, 12535, 16825, 17288, 11686, 12599, 28771, 8322,
+    28759, 28701, 12586, 28820, 17083, 13077, 13114, 16596, 6232, 17149, 10805, 9666, 12684, 28787, 13005, 28779,
+    12935, 28805, 16462, 16478, 9964, 13019, 28782, 32788, 13164, 12657, 11245, 16437, 11395, 10284, 8920, 28803,
+    9089, 11648, 11466, 28806, 20489, 12910, 12815, 13074, 28794, 6400, 16449, 32792, 13092, 11971, 28820, 28715,
+    11574, 12431, 28807, 11104, 28730, 13152, 8745, 11171, 28819, 28801, 12478, 12648, 10806, 12828, 16999, 13110,
+    28818, 16844, 12922, 28809, 12431, 12335, 13040, 28740, 28810, 28746, 28771, 12968, 9915, 28784, 9077, 28810,
+    12533, 13005, 12524, 12864, 28790, 28755, 28805, 28733, 12394, 6187, 20482, 10853, 9211, 12562, 10208, 10443,
+    12876, 17015, 17230, 13055, 12359, 32859, 28708, 28779, 28797, 12672, 13221, 13065, 32896, 32841, 5657, 12464,
+    12702, 4890, 13016, 12558, 28822, 16745, 17282, 17398, 13062, 10845, 17282, 12305, 28748, 28718, 8487, 12875,
+    8790, 12552, 12643, 16857, 6457, 28769, 8779, 8490, 17080, 12984, 12312, 28810, 12945, 5491, 28772, 28808,
+    28803, 28806, 13223, 8995, 12864, 16700, 28782, 16504, 28794, 16808, 28761, 16989, 5490, 12636, 10816, 12583,
+    28674, 12959, 12549, 28681, 12455, 8621, 13028, 20486, 16958, 12497, 32791, 12876, 28817, 28794, 28782, 11449,
+    13043, 9377, 11448, 11908, 28761, 28783, 16598, 9608, 12308, 8282, 28678, 28688, 16700, 4890, 11114, 16745,
+    9089, 8285, 12360, 28743, 13224, 13224, 12439, 12408, 12776, 28726, 12730, 17387, 13151, 11414, 12923, 17027,
+    28720, 9256, 13040, 28771, 12537, 12965, 13066, 28687, 28812, 32898, 9385, 11403, 28716, 28808, 32845, 28701,
+    28823, 12336, 12672, 12391, 16767, 6402, 12780, 8713, 16618, 16684, 28710, 28772, 11478, 12780, 10208, 8621,
+    28717, 12636, 16450, 12455, 28697, 12840, 16687, 28691, 32804, 8667, 28793, 13066, 9287, 28822, 20483, 12786,
+    12870, 28748, 12983, 11413, 13128, 32803, 16515, 16779, 28680, 13114, 16421, 32918, 12394, 12576, 11414, 13007,
+    11395, 28732, 12993, 28808, 28722, 12596, 12744, 16743, 28817, 9012, 11460, 32794, 28705, 12744, 9780, 6189,
+    16677, 28793, 10646, 28732, 32829, 16699, 28716, 17375, 32936, 12419, 12732, 12540, 28803, 16959, 9087, 10273,
+    20484, 32776, 11712, 16936, 28760, 28772, 12323, 8789, 10814, 28818, 13100, 11158, 12658, 16675, 28706, 13055,
+    16835, 13101, 12357, 13193, 16463, 10862, 11395, 8396, 28824, 8720, 10796, 12498, 10871, 28757, 12564, 16825,
+    28680, 10562, 9009, 13101, 12679, 12371, 12440, 17161, 16615, 10868, 12996, 12888, 28696, 11144, 12680, 8966,
+    8656, 16857, 28819, 10101, 28824, 20481, 12668, 8779, 13181, 11457, 13017, 9610, 9388, 5672, 12567, 13044,
+    28698, 8366, 16618, 5578, 11460, 11712, 17203, 12960, 8949, 11457, 28795, 11694, 9020, 28764, 28727, 28782,
+    16824, 16667, 28820, 16557, 32790, 12669, 12561, 32898, 11945, 20485, 16834, 4700, 6123, 28679, 8920, 28705,
+    32880, 10570, 12622, 28712, 13074, 9002, 12499, 28789, 28682, 32814, 28795, 12683, 16934, 12848, 10582, 28741,
+    32844, 28716, 28781, 12883, 28706, 12740, 32908, 10191, 12680, 28733, 17241, 13111, 28720, 17314, 12333, 28685,
+    32911, 8411, 12835, 13077, 12598, 13079, 11755, 17094, 28791, 32869, 12679, 12751, 11694, 28807, 16440, 11943,
+    28784, 8358, 28720, 12706, 16604, 32859, 13064, 11713, 28708, 13078, 12876, 6402, 13208, 28761, 28684, 12526,
+    32885, 6457, 28807, 12849, 12924, 13092, 12595, 9762, 16858, 28796, 20486, 9264, 28771, 28712, 12850, 17246,
+    12694, 9248, 32774, 12476, 12630, 12395, 32845, 11713, 16832, 10285, 28772, 12509, 28715, 28742, 9248, 12752,
+    32805, 12408, 16438, 6454, 28798, 12586, 28805, 11843, 17375, 13031, 32845, 28720, 13001, 28758, 4977, 16518,
+    28733, 13184, 17308, 16754, 16825, 11180, 12560, 28750, 9745, 28684, 32859, 28785, 28718, 13079, 13126, 9019,
+    28730, 16440, 28680, 28712, 9044, 17411, 13019, 28735, 9954, 12659, 17170, 11574, 8414, 11741, 28784, 12995,
+    28808, 11947, 28729, 17093, 12334, 11910, 17282, 32853, 32820, 28791, 28715, 12838, 28820, 16834, 28685, 28781,
+    28674, 16778, 32910, 8658, 12864, 4971, 28731, 12731, 10190, 13204, 12751, 10637, 12600, 11167, 9919, 6446,
+    16778, 32820, 32842, 11161, 12993, 32937, 11985, 28781, 28767, 6357, 12615, 12454, 28819, 9302, 12526, 11451,
+    12455, 12324, 12548, 16505, 28754, 12611, 32807, 11460, 28676, 12534, 28720, 8613, 11480, 32859, 16766, 12873,
+    16519, 11182, 8665, 32806, 12756, 11748, 28736, 28782, 5473, 12598, 17093, 28737, 28822, 6349, 13136, 28728,
+    28721, 16685, 9321, 13114, 28766, 12862, 8358, 16698, 16779, 32830, 9388, 12960, 10582, 12464, 8657, 11168,
+    28750, 17320, 12455, 28769, 12636, 9000, 12683, 28721, 28673, 28808, 28820, 28706, 28713, 10271, 8713, 28712,
+    28810, 12947, 13055, 12538, 28696, 17290, 10750, 28761, 28699, 10872, 12502, 12860, 11873, 28784, 32858, 28770,
+    12616, 12597, 28695, 9518, 20486, 11777, 5113, 10870, 8790, 13127, 16857, 12968, 28807, 17036, 8321, 9676,
+    12536, 17239, 11712, 11169, 12297, 28760, 12684, 28678, 12786, 6402, 16686, 11713, 9204, 28816, 32802, 8452,
+    12527, 6455, 9984, 28806, 28677, 12766, 28809, 28817, 12894, 9686, 10882, 12426, 28711, 28745, 28759, 6235,
+    5254, 28713, 12910, 12323, 12670, 12341, 10240, 13103, 12536, 13079, 12557, 12862, 28810, 28676, 28817, 11170,
+    10285, 16445, 28708, 12599, 16688, 20481, 28770, 9010, 10583, 32923, 11180, 28704, 13222, 12984, 10670, 9961,
+    8703, 11713, 28731, 16854, 8475, 16746, 28806, 12778, 16587, 12564, 28797, 12443, 28817, 9263, 6411, 13126,
+    28729, 28754, 6020, 9299, 16845, 28754, 17315, 9219, 12691, 9012, 12672, 12960, 32937, 28793, 12852, 28700,
+    8445, 10443, 28725, 16887, 28813, 12995, 28795, 16842, 8995, 12804, 11028, 13091, 12599, 28673, 6364, 9518,
+    16462, 16766, 12972, 9012, 9915, 28692, 28805, 32779, 16456, 8404, 16440, 13089, 10704, 32804, 12837, 17404,
+    28739, 10437, 32852, 9301, 10946, 16762, 9002, 13089, 8957, 10859, 12658, 13176, 32792, 5499, 12967, 9059,
+    28719, 32806, 11180, 12054, 12416, 17328, 28715, 6365, 16618, 12512, 12767, 8350, 28735, 28748, 12775, 11864,
+    17002, 12870, 6365, 28683, 12450, 16831, 28767, 12732, 12948, 12990, 16530, 12346, 5562, 28782, 16844, 17173,
+    9089, 12443, 12682, 9373, 8479, 8964, 9778, 17309, 13104, 28747, 9750, 17218, 16933, 12996, 13102, 12406,
+    32804, 28780, 16448, 28737, 12310, 12297, 12864, 32791, 12624, 12379, 28683, 13151, 11713, 5339, 12741, 12624,
+    16925, 32792, 9089, 12916, 28793, 32911, 28774, 12597, 12948, 12612, 8412, 12657, 12335, 10580, 17174, 28720,
+    12850, 11956, 12002, 12660, 9816, 12408, 32819, 12443, 28734, 12312, 28822, 28795, 16440, 32780, 12670, 17290,
+    13138, 12994, 12732, 12546, 16530, 9609, 13114, 28744, 9654, 28786, 9387, 28802, 8994, 16982, 28807, 17111,
+    13200, 12756, 20485, 13102, 32806, 13161, 28704, 10648, 28728, 17185, 28686, 28795, 11460, 12552, 10878, 13182,
+    13159, 10741, 11756, 13122, 11985, 16778, 17171, 28708, 12766, 12948, 8721, 28704, 10152, 16666, 12846, 12744,
+    16722, 28760, 13204, 32883, 12629, 8713, 13127, 9375, 12756, 10584, 10578, 16618, 8942, 8367, 17095, 17173,
+    16687, 8666, 9147, 12908, 28677, 9388, 12600, 28703, 28746, 10399, 12871, 9318, 9673, 12767, 28756, 28745,
+    13101, 28783, 13194, 6234, 12381, 16541, 12956, 12765, 10881, 12455, 20490, 28710, 28796, 12777, 16699, 12430,
+    16498, 11480, 12923, 28780, 28680, 16756, 28726, 28752, 12703, 28815, 32807, 11908, 16904, 28760, 32922, 28744,
+    12948, 16900, 12617, 5608, 16609, 28717, 16754, 32820, 6189, 12755, 12669, 12730, 16541, 16921, 12837, 11042,
+    11710, 12334, 16988, 16542, 28797, 13220, 32869, 13127, 12732, 12838, 12984, 12295, 11585, 16767, 9809, 28762,
+    16746, 28729, 12355, 28724, 28741, 8667, 12643, 12958, 11939, 12574, 13186, 16930, 28783, 12539, 12360, 9261,
+    28723, 12550, 28815, 9022, 11458, 12537, 28702, 32804, 28675, 28693, 8649, 9302, 11747, 11769, 17320, 12300,
+    12526, 12300, 16746, 11778, 28794, 32844, 12780, 28780, 9948, 10079, 32845, 28723, 12359, 8722, 17095, 16609,
+    10670, 16844, 32843, 9683, 28684, 10551, 16447, 28709, 12561, 28731, 10730, 12669, 28718, 12466, 32911, 12728,
+    28731, 13092, 12634, 16763, 12861, 28744, 28739, 16761, 5432, 13127, 12588, 13103, 28688, 12528, 28726, 12775,
+    8667, 11268, 28784, 11939, 28683, 28741, 13080, 10882, 16451, 32859, 9563, 12322, 13199, 9816, 32853, 10215,
+    20485, 12764, 9563, 8788, 12884, 12899, 16588, 12617, 28763, 28682, 28737, 13193, 16857, 32805, 13159, 32896,
+    8357, 32909, 11182, 8701, 11477, 9051, 8366, 28774, 11750, 28820, 12063, 12311, 10108, 8759, 16499, 28693,
+    28819, 12616, 28691, 12851, 28762, 17330, 28803, 9597, 28712, 12486, 5368, 9366, 16667, 10882, 28777, 12576,
+    32781, 13170, 12359, 12571, 17016, 28706, 13078, 12682, 12468, 28739, 28810, 8453, 8995, 12467, 12982, 20486,
+    28723, 28754, 11756, 28673, 28718, 32780, 28734, 28681, 11478, 10079, 12884, 28717, 32789, 9915, 32864, 12836,
+    6150, 32859, 12537, 20485, 32794, 10670, 28720, 32778, 28694, 16619, 12851, 10162, 13068, 28724, 28680, 16617,
+    12765, 28748, 11057, 13104, 9010, 12358, 9664, 12478, 12744, 12504, 12693, 32775, 28744, 28726, 17282, 12644,
+    32875, 28772, 32917, 16966, 13090, 28745, 10676, 32820, 9366, 11079, 9043, 8689, 17253, 12406, 9809, 28717,
+    32781, 12624, 12429, 12391, 12881, 13054, 28794, 13211, 16460, 10496, 12562, 11387, 12779, 11910, 17082, 8489,
+    28801, 5497, 32921, 12732, 13128, 16767, 16540, 28774, 5899, 12861, 12408, 13030, 12900, 8577, 10191, 12728,
+    12884, 16966, 32922, 12888, 12982, 10533, 12335, 13116, 16979, 4983, 5048, 28728, 9219, 8489, 9813, 28684,
+    17052, 11759, 32911, 12320, 16688, 12539, 8489, 28701, 12596, 11130, 16540, 28739, 9012, 12539, 12743, 17012,
+    28687, 28697, 12360, 13103, 28745, 12703, 28725, 28717, 8723, 5561, 12672, 8446, 9377, 28679, 12011, 28705,
+    28724, 11947, 10676, 12008, 28698, 28699, 12798, 17325, 12563, 16765, 28694, 28770, 12634, 12597, 12347, 12983,
+    12563, 13186, 12329, 9617, 16856, 28794, 12405, 13182, 12711, 13044, 10115, 16937, 12009, 13150, 8461, 32854,
+    28725, 12860, 12597, 12788, 11481, 32802, 32844, 28737, 12516, 28820, 32818, 16698, 5076, 13127, 13115, 10115,
+    12345, 28773, 28826, 28725, 28760, 16972, 12741, 16825, 28786, 12647, 13128, 13188, 9292, 12561, 12002, 16763,
+    12454, 13186, 32921, 8722, 28820, 9947, 17241, 28678, 9309, 11093, 12990, 8468, 12732, 16972, 12576, 12884,
+    12372, 13068, 28691, 11780, 12357, 13212, 28820, 9357, 12680, 12574, 32881, 12067, 9321, 16541, 12336, 10449,
+    28775, 12058, 10407, 12432, 12756, 28721, 13186, 12573, 20481, 12836, 12713, 32922, 6315, 13187, 9919, 8702,
+    32859, 28781, 28694, 12972, 5644, 13224, 12407, 28796, 16778, 11946, 32865, 28726, 13036, 12064, 12756, 10832,
+    17150, 28814, 28720, 32820, 28730, 28697, 8477, 12548, 28770, 11622, 16980, 6466, 13092, 12863, 12547, 12370,
+    28782, 12312, 12372, 10705, 12324, 8367, 28818, 28778, 10705, 16776, 12432, 13137, 28757, 16621, 16920, 12672,
+    28746, 16856, 12888, 17367, 12864, 20484, 32870, 12972, 8778, 16858, 12466, 12645, 13014, 11947, 8488, 28781,
+    12934, 28759, 12959, 28818, 28705, 11759, 16609, 28774, 17253, 16856, 12799, 9518, 5613, 13210, 28694, 8768,
+    17150, 20486, 12300, 12861, 12347, 12809, 12454, 11518, 9555, 12648, 12809, 13216, 12046, 13007, 32820, 32814,
+    28709, 28773, 28820, 28768, 13116, 9076, 16729, 28741, 5992, 32920, 9319, 28705, 13199, 12809, 28739, 28757,
+    12839, 28714, 16966, 28740, 13163, 28740, 13104, 12356, 12799, 32828, 28777, 12645, 32854, 12898, 28750, 9673,
+    13208, 17062, 12444, 13196, 12636, 12683, 9474, 5830, 12646, 28723, 28805, 10254, 12406, 32878, 28736, 17081,
+    28760, 16609, 28771, 12899, 13185, 8479, 8582, 12353, 28717, 12417, 28810, 11296, 11358, 28742, 13198, 5104,
+    13115, 28794, 13208, 12680, 13099, 16675, 12443, 28683, 8848, 11953, 9012, 11480, 12837, 16579, 32883, 8778,
+    13210, 8533, 12634, 13198, 16459, 11295, 12642, 12634, 28695, 12432, 28699, 16462, 12861, 28727, 16621, 12621,
+    11151, 11955, 13187, 28781, 8422, 10444, 16699, 28721, 8898, 13186, 12703, 28717, 11742, 28774, 28806, 17081,
+    10115, 28721, 32866, 28770, 13115, 28760, 16508, 11409, 10450, 12444, 12550, 32911, 10407, 11779, 28740, 12479,
+    28747, 10516, 12408, 13020, 12992, 13199, 5584, 16463, 11041, 13197, 11303, 10378, 13211, 12714, 9367, 28793,
+    12073, 16925, 13188, 32780, 28733, 10206, 10742, 13080, 10794, 28722, 16489, 10198, 10407, 9318, 8480, 10742,
+    28760, 12981, 28783, 32778, 12598, 5077, 28681, 12404, 13210, 8445, 11567, 5927, 28780, 10705, 13128, 32924,
+    16427, 10743, 12827, 12810, 12345, 9620, 9563, 8490, 16844, 9656, 8777, 13128, 28772, 11009, 28810, 28818,
+    28723, 12360, 9008, 17297, 16777, 32775, 28693, 28727, 12586, 12426, 13056, 9358, 16463, 12776, 32866, 12996,
+    12995, 10457, 12672, 28695, 10152, 12068, 28772, 9620, 13200, 28786, 28694, 13128, 28805, 9919, 13174, 12809,
+    28818, 8390, 32889, 10450, 28738, 5613, 16519, 11402, 8480, 28692, 28690, 13003, 28706, 10191, 28715, 12358,
+    12320, 9240, 6009, 28807, 8769, 9058, 32794, 12562, 12767, 28744, 28769, 28731, 17386, 28693, 12839, 12714,
+    9067, 28827, 12814, 12916, 9319, 32779, 28740, 28691, 12432, 13197, 28739, 16621, 12492, 32794, 11303, 12047,
+    20481, 28806, 12852, 17264, 28775, 12659, 12920, 12838, 12312, 28700, 12064, 12969, 12790, 17009, 13090, 28761,
+    12900, 9084, 32820, 12909, 8665, 11467, 12755, 17160, 32878, 12432, 28744, 16538, 20487, 28818, 8466, 32833,
+    13199, 28774, 16578, 28743, 9683, 28805, 13068, 11087, 17397, 12587, 9617, 12695, 28680, 17130, 32815, 12971,
+    12755, 16608, 12372, 28681, 28744, 8469, 12921, 28705, 13198, 12714, 28707, 28724, 12995, 12991, 28703, 12839,
+    16687, 17367, 12981, 28804, 9617, 13217, 9601, 10976, 9367, 13217, 10450, 12527, 13092, 12064, 12394, 12384,
+    9385, 28733, 28735, 32779, 8788, 12811, 9319, 12297, 12355, 9647, 8722, 10450, 28727, 9086, 28685, 28795,
+    9068, 28750, 28723, 11047, 10459, 11087, 28786, 32774, 17329, 10115, 28726, 10160, 17050, 28761, 10748, 13200,
+    28786, 32803, 12825, 17211, 16530, 12820, 12647, 8424, 17373, 28682, 12632, 8722, 17066, 5318, 12838, 28736,
+    28781, 12876, 12875, 12968, 12563, 28730, 28804, 12888, 16973, 12682, 12917, 12657, 12561, 16463, 11690, 28783,
+    12068, 28694, 28765, 28735, 32830, 10757, 12971, 8909, 32791, 12776, 8760, 12670, 11150, 17331, 9087, 32845,
+    9302, 28700, 28794, 9564, 32855, 12968, 28790, 12907, 12660, 13128, 20487, 12799, 12855, 16857, 12851, 9975,
+    28790, 32928, 32803, 6122, 28759, 12778, 28806, 16913, 28684, 28770, 28744, 10458, 12067, 5591, 8941, 32816,
+    17361, 20486, 9320, 28741, 28742, 12863, 32924, 28773, 13004, 12741, 11993, 28772, 9077, 10206, 12766, 8283,
+    28734, 20485, 28727, 12646, 28741, 12898, 32789, 5619, 16674, 28772, 12742, 10757, 9086, 12706, 8966, 10198,
+    28761, 16974, 28683, 12466, 12540, 10795, 28719, 12919, 32866, 12755, 16845, 12972, 16608, 20486, 12821, 9974,
+    28719, 28777, 13188, 8491, 8424, 9075, 28713, 32875, 16584, 10413, 16569, 28826, 12297, 28726, 12803, 10215,
+    8414, 32846, 12563, 11308, 28732, 12429, 28807, 13187, 32845, 12850, 10512, 6173, 9666, 12765, 28784, 12575,
+    9898, 28769, 5491, 28789, 6038, 13209, 12525, 28697, 13127, 12714, 17209, 28680, 28724, 28743, 6209, 32871,
+    9059, 9088, 12563, 12360, 12912, 17083, 12740, 16607, 12550, 13163, 17138, 12538, 28782, 8722, 10444, 17083,
+    28741, 32776, 28747, 9078, 28690, 16540, 16446, 12972, 13123, 13188, 17124, 17138, 12981, 11056, 32788, 12705,
+    12731, 12766, 9059, 32793, 28704, 12448, 20487, 28793, 28797, 13065, 8467, 20486, 32819, 12995, 12562, 12921,
+    32778, 9182, 11340, 13116, 9649, 12467, 10198, 9672, 16699, 9357, 28825, 28760, 12693, 12838, 9564, 12670,
+    32876, 28784, 9321, 16779, 28781, 28761, 12588, 13195, 16993, 28744, 28769, 28682, 12862, 17207, 13221, 13124,
+    12539, 9666, 10677, 9832, 28761, 12767, 11872, 28673, 12538, 28689, 10451, 12683, 32855, 8487, 12489, 28715,
+    9388, 5369, 17138, 12907, 16539, 13002, 12322, 28785, 13113, 32791, 17332, 16541, 12992, 12671, 13092, 10976,
+    5657, 28715, 12696, 12563, 5111, 12804, 10215, 28740, 32814, 13222, 17387, 28734, 12705, 11386, 12957, 17203,
+    28742, 12731, 28781, 28725, 28750, 28709, 32887, 28751, 28821, 16835, 12910, 28770, 32928, 10504, 28699, 9685,
+    28737, 32877, 5498, 16846, 11603, 28744, 28688, 10706, 28757, 28796, 6168, 16451, 32820, 28806, 32832, 12861,
+    32788, 32846, 12820, 28804, 32819, 32908, 12360, 12839, 12731, 28763, 28775, 12528, 28763, 28819, 28687, 11442,
+    28795, 9343, 12825, 8779, 28708, 11429, 6315, 28696, 28825, 12078, 16766, 16530, 12456, 16733, 12567, 9516,
+    28785, 28793, 32878, 28769, 16990, 17203, 32866, 12929, 5620, 32867, 32882, 5462, 28807, 8688, 12755, 28732,
+    16779, 13222, 28784, 17393, 10512, 12930, 12618, 17225, 12703, 12549, 12816, 8788, 20487, 28760, 17124, 28828,
+    28675, 12309, 9618, 17361, 10218, 28747, 12910, 28726, 16564, 9001, 12647, 6179, 13099, 11685, 12918, 28684,
+    28782, 10976, 11345, 28762, 12587, 13210, 13027, 12715, 17374, 11088, 28717, 13027, 8300, 11392, 12839, 12839,
+    11440, 28750, 9358, 12970, 28745, 32869, 13077, 16904, 13092, 17361, 10871, 28823, 28795, 32906, 13027, 28731,
+    28778, 32777, 16530, 28743, 32820, 28707, 28705, 12648, 28743, 6168, 28750, 28707, 10497, 12523, 28744, 12929,
+    13053, 16649, 10490, 6056, 20487, 12533, 10262, 28821, 28796, 12851, 12528, 28807, 9088, 16542, 12767, 28680,
+    12360, 16778, 9022, 12691, 28702, 28682, 28781, 32845, 13185, 13089, 9087, 12960, 17015, 5077, 12480, 11347,
+    28683, 32890, 32841, 16856, 32937, 28719, 28820, 28767, 12513, 12564, 12919, 12357, 17361, 8584, 11766, 28685,
+    28744, 11341, 32895, 12671, 28784, 12068, 28701, 28818, 13038, 13221, 8778, 12683, 5497, 12372, 28719, 11346,
+    28678, 10546, 5077, 32933, 12516, 12609, 16835, 16779, 11391, 5928, 12983, 28728, 28727, 28732, 12672, 13041,
+    6210, 13067, 28702, 28782, 13224, 16846, 12981, 10757, 12635, 5106, 32891, 12930, 28694, 12873, 32888, 11309,
+    28780, 16856, 28689, 10843, 5626, 28715, 9918, 16658, 12538, 11088, 28705, 12635, 28765, 12455, 28727, 12996,
+    13127, 8774, 10844, 32820, 9508, 12312, 12669, 16592, 28775, 16779, 32896, 16420, 16700, 16845, 9618, 20481,
+    9068, 6446, 12825, 12306, 16700, 10505, 6386, 9012, 12573, 12779, 12417, 12504, 28732, 8779, 17411, 5664,
+    12420, 12634, 9665, 28685, 28718, 28723, 16778, 12871, 28794, 5496, 12996, 28808, 6150, 16983, 17147, 28720,
+    13008, 10757, 28788, 13037, 12588, 12766, 13145, 28742, 13136, 8788, 12966, 12918, 32857, 17071, 8722, 32883,
+    13088, 5620, 9383, 11386, 12861, 12357, 10803, 17138, 28675, 17059, 28826, 11685, 12682, 28735, 32882, 12851,
+    13027, 28816, 16540, 12319, 16542, 28683, 28819, 28805, 10262, 28791, 12528, 9265, 8276, 13116, 28821, 13090,
+    12851, 32805, 17010, 12659, 11653, 6210, 12779, 12537, 32855, 12744, 17385, 17010, 16815, 28743, 12825, 10451,
+    12792, 16779, 10513, 13037, 28724, 16856, 28709, 12468, 17093, 28696, 12767, 13127, 28801, 17011, 9367, 8779,
+    20482, 8470, 5627, 5658, 32843, 28703, 6215, 11639, 28761, 32884, 8788, 28704, 28697, 10567, 28818, 12784,
+    13039, 16530, 12930, 16400, 13135, 20486, 32869, 28822, 28714, 28726, 32830, 16597, 13125, 13163, 17386, 16542,
+    17068, 17226, 17037, 12466, 28710, 12995, 13222, 12874, 32817, 17410, 28825, 12499, 12957, 17078, 32820, 5658,
+    9022, 13049, 11644, 28751, 11779, 12454, 12863, 32930, 32846, 16413, 17000, 28717, 28754, 16764, 12348, 11992,
+    9564, 11275, 12936, 12933, 13101, 32857, 12539, 12396, 13068, 8769, 8981, 28748, 12499, 13032, 28759, 28713,
+    17160, 12442, 28818, 28689, 12299, 28800, 11711, 12312, 16450, 12360, 12755, 9385, 11056, 12393, 28701, 20486,
+    28710, 10789, 8480, 6180, 8285, 28777, 28717, 28786, 20487, 16990, 11699, 28796, 17329, 12636, 9618, 12921,
+    28723, 28794, 11387, 16435, 12779, 12982, 32855, 28686, 16846, 12690, 28751, 12981, 12525, 28817, 8723, 32807,
+    28736, 32904, 28721, 11387, 8665, 17141, 28801, 28695, 32932, 28698, 32858, 12932, 32855, 10560, 9211, 8789,
+    12576, 6464, 12767, 28698, 17250, 13087, 12959, 17053, 16846, 9984, 12678, 12420, 16479, 11144, 8722, 20482,
+    12942, 12552, 28807, 12944, 12874, 20482, 32909, 28765, 28748, 32929, 32883, 17203, 16509, 17151, 32868, 16585,
+    12588, 9919, 12532, 12774, 28708, 20488, 28686, 28807, 6217, 6186, 10872, 6185, 13158, 32859, 12886, 12684,
+    12972, 8605, 9311, 8357, 17388, 9862, 17281, 10215, 11686, 28686, 32856, 28781, 9852, 32893, 12756, 13037,
+    11387, 32818, 28728, 13030, 32882, 16858, 12347, 32802, 12731, 13148, 12540, 8787, 32857, 28684, 28690, 12864,
+    13140, 10262, 28726, 11410, 10850, 28761, 28774, 5663, 16658, 12455, 12563, 12984, 13224, 16991, 12599, 11088,
+    11992, 11050, 5929, 9022, 28761, 28752, 20487, 32846, 9665, 12908, 28772, 12539, 28759, 11102, 12960, 32792,
+    28784, 10751, 9984, 17072, 12564, 28789, 9666, 28696, 12894, 32832, 20485, 28678, 8469, 32781, 11686, 12671,
+    28724, 8368, 8778, 28711, 28713, 12345, 9610, 13126, 12705, 10281, 12588, 32881, 28751, 13068, 12563, 16447,
+    12959, 12393, 16856, 12911, 9077, 28677, 28712, 11114, 8769, 28780, 13128, 28743, 32884, 28789, 11983, 16542,
+    11646, 28725, 28793, 32832, 12416, 16542, 12648, 13038, 32859, 28762, 32895, 12958, 28691, 10262, 28789, 6394,
+    10850, 6152, 12933, 11692, 11735, 12466, 28805, 17089, 28805, 12960, 12812, 16406, 28828, 32894, 12778, 32920,
+    28673, 28795, 13042, 28790, 12587, 32891, 12767, 12683, 28801, 28748, 8321, 16697, 12576, 13113, 17238, 32857,
+    12726, 12911, 28726, 28795, 17399, 17230, 20483, 16507, 28705, 5664, 32934, 6057, 32882, 32862, 17247, 12942,
+    28820, 12995, 17288, 6217, 12946, 12825, 20485, 16412, 12442, 11657, 12858, 28808, 9674, 12419, 12826, 32924,
+    12429, 32870, 13124, 28797, 28748, 32859, 11936, 12552, 11646, 12370, 28800, 13050, 6327, 10844, 28785, 32778,
+    10498, 28777, 8788, 13039, 9065, 11158, 12576, 6356, 11144, 12551, 28707, 17320, 5628, 13218, 9388, 28764,
+    12768, 16808, 28685, 28704, 16699, 28773, 17157, 11312, 17141, 13150, 13109, 16516, 8778, 12297, 28709, 11480,
+    11059, 28805, 8322, 28794, 12840, 11393, 10254, 10815, 32805, 9686, 9684, 28760, 13139, 8779, 10552, 12588,
+    8883, 17388, 28778, 32895, 13050, 28806, 17226, 12552, 12862, 28796, 28715, 32933, 12588, 13124, 32871, 9078,
+    13199, 28679, 17083, 17061, 16529, 32883, 32818, 10461, 28767, 16578, 11393, 28751, 16700, 17149, 12932, 12931,
+    28822, 13212, 16858, 32906, 13006, 13114, 12893, 17149, 16700, 12648, 16542, 28707, 5672, 13193, 28802, 32859,
+    9641, 11401, 12298, 12499, 28681, 12078, 16535, 28782, 13115, 16773, 28800, 28784, 28766, 28802, 13187, 12719,
+    11713, 11708, 28682, 32910, 11050, 28699, 16857, 17219, 12784, 28791, 12874, 28790, 12540, 12716, 8790, 10162,
+    28743, 28678, 28732, 32859, 28689, 9986, 12970, 28714, 17405, 12984, 12552, 13091, 12466, 13052, 28787, 12983,
+    20481, 11449, 28759, 28777, 12864, 28708, 12516, 28712, 17286, 8412, 32844, 32779, 20487, 32896, 28684, 8480,
+    13175, 28728, 10151, 12753, 12452, 12588, 12440, 28750, 17409, 28805, 32803, 11114, 17218, 28806, 6181, 12826,
+    32898, 12690, 12813, 16858, 16856, 16676, 32882, 9554, 28741, 12658, 12479, 32807, 12430, 28711, 12744, 6181,
+    8604, 32907, 16800, 12932, 32933, 28798, 9211, 32871, 12343, 16676, 12559, 32870, 17080, 13104, 11767, 32897,
+    9388, 16823, 9087, 28718, 28740, 17151, 17080, 12419, 32935, 16684, 32846, 28795, 28810, 28778, 28718, 9320,
+    11103, 28697, 11449, 12779, 11926, 11712, 28724, 28692, 13049, 6222, 12959, 17150, 6356, 20490, 8965, 28707,
+    8919, 11401, 28673, 28778, 28807, 12922, 32872, 28825, 28774, 12600, 17083, 13073, 12718, 12501, 20484, 32818,
+    32858, 12668, 28743, 10254, 6357, 28811, 6181, 12599, 10507, 9217, 12466, 6152, 13053, 32828, 13032, 11176,
+    12945, 9377, 10281, 12743, 5674, 12443, 28748, 12431, 28822, 10569, 32936, 16824, 28769, 28824, 17290, 6232,
+    28753, 12534, 16699, 9068, 12876, 28713, 13005, 13073, 17409, 20488, 11866, 28765, 12617, 12588, 28677, 8832,
+    10759, 11358, 6411, 12451, 13091, 11937, 28723, 28826, 17238, 16765, 11686, 28805, 28684, 12380, 28793, 28766,
+    28737, 28807, 12863, 32908, 28701, 12311, 8322, 32904, 12395, 28762, 9087, 10699, 13062, 28728, 28820, 12790,
+    17001, 28689, 32832, 12404, 32884, 12550, 13053, 28755, 12636, 13015, 10872, 28731, 6407, 12960, 32837, 10273,
+    9320, 28717, 11113, 17239, 10271, 12851, 9367, 16700, 16858, 12600, 17081, 28827, 10698, 20485, 9377, 13007,
+    12933, 13149, 12852, 28743, 12959, 9387, 8489, 32816, 9308, 16621, 10670, 28732, 28709, 28770, 28749, 12600,
+    9802, 17168, 12946, 28751, 11686, 32805, 11395, 12460, 11105, 28787, 12571, 12970, 6051, 8351, 28727, 16450,
+    32804, 5484, 20482, 28700, 13041, 6462, 28797, 13104, 32775, 17282, 12597, 9853, 11603, 11357, 32807, 11457,
+    13050, 28749, 12418, 32788, 28696, 20486, 28765, 9816, 12756, 13075, 28782, 28819, 28805, 9387, 12491, 11866,
+    28741, 12824, 17229, 13139, 12864, 17159, 17091, 10245, 9600, 16756, 32858, 12882, 28730, 12875, 16834, 9385,
+    32789, 11648, 10816, 28698, 13150, 28784, 28801, 32907, 6356, 6223, 28783, 13092, 28793, 6328, 28690, 12852,
+    16913, 12491, 12540, 13173, 12612, 10553, 28781, 12623, 32909, 6439, 13125, 28729, 28813, 28704, 9562, 10515,
+    16682, 13175, 32937, 8942, 6454, 28767, 12355, 12995, 12647, 12944, 28798, 13073, 12852, 12011, 12671, 12480,
+    12334, 6187, 12478, 28771, 28813, 8479, 9975, 32933, 9375, 13052, 28800, 32778, 12576, 10771, 12504, 28719,
+    10161, 17002, 12995, 12718, 8491, 10838, 17089, 28680, 6365, 16751, 10815, 12744, 12369, 28710, 16519, 12418,
+    10814, 12635, 28772, 12944, 12804, 12869, 12727, 10862, 16542, 12923, 13005, 12407, 16756, 8712, 6218, 17161,
+    11750, 13175, 32843, 9687, 28818, 10281, 9666, 12728, 12660, 28779, 12404, 13042, 13088, 10868, 32858, 12527,
+    9387, 5448, 12012, 12598, 12597, 6439, 28684, 11775, 12774, 28741, 12730, 11709, 12672, 6407, 11470, 28755,
+    4953, 8919, 12587, 12978, 28779, 11404, 16677, 16936, 12564, 10561, 32859, 12539, 28790, 28812, 8752, 28726,
+    5113, 16429, 32833, 32827, 28740, 16676, 11470, 10101, 16585, 28783, 12668, 12730, 6400, 8912, 28749, 12647,
+    28750, 12479, 11443, 13104, 16684, 13212, 10571, 32852, 12620, 28712, 12624, 32936, 28725, 9676, 12600, 9646,
+    32828, 32807, 16933, 28771, 16824, 9064, 16744, 11161, 17330, 28784, 17251, 6181, 11700, 28678, 28733, 8576,
+    28700, 12768, 13116, 12380, 12563, 9248, 9182, 28762, 16778, 28723, 11177, 32801, 28720, 16636, 12492, 12612,
+    6462, 12982, 28699, 13139, 13169, 16658, 28825, 5254, 32853, 28710, 13041, 12497, 28721, 8779, 17320, 16835,
+    16598, 32807, 12771, 9265, 12765, 12633, 8619, 13052, 13051, 17347, 13062, 11657, 12864, 12524, 12775, 13013,
+    28698, 10579, 28761, 32790, 16418, 12971, 6408, 17162, 20486, 13159, 12444, 10562, 8696, 11938, 8966, 9182,
+    12764, 13006, 11938, 12833, 12972, 12740, 32885, 6225, 16609, 28817, 28674, 28772, 12296, 17162, 12309, 28724,
+    12990, 32792, 8899, 13169, 12827, 12947, 13019, 8424, 13064, 32863, 13211, 8461, 12395, 28692, 28693, 28769,
+    10861, 28748, 28742, 8790, 11657, 16406, 8351, 28751, 32778, 32817, 12960, 28755, 16451, 32937, 28699, 13137,
+    28767, 13054, 28711, 28755, 28772, 16571, 12792, 13078, 12479, 16914, 5362, 28772, 11413, 32872, 12611, 4715,
+    28752, 11749, 28772, 12596, 6448, 11701, 6357, 32898, 12540, 28750, 16558, 28720, 12659, 28744, 12477, 12804,
+    12631, 12632, 8689, 13102, 13198, 13102, 32803, 12297, 32804, 32816, 16858, 9219, 13126, 28680, 13150, 13181,
+    6400, 12825, 4716, 28782, 11703, 12504, 32841, 32859, 32885, 12058, 12312, 11182, 12394, 17251, 9682, 11460,
+    4636, 12561, 28750, 12600, 12984, 28795, 28779, 4726, 16450, 6189, 32819, 11748, 16485, 13136, 28680, 12527,
+    6357, 20484, 11901, 12828, 12540, 16460, 28735, 10759, 12739, 17275, 17296, 10581, 28779, 16536, 32868, 12739,
+    13098, 9294, 9077, 28776, 28766, 28691, 28794, 11152, 13176, 12455, 10570, 17308, 12322, 17309, 16816, 16593,
+    32842, 13114, 32781, 12729, 28751, 32805, 4971, 8322, 16913, 9387, 28752, 9387, 8995, 13101, 13170, 16528,
+    12536, 28807, 12596, 16658, 28694, 28710, 28746, 17251, 28761, 12814, 12600, 28761, 13115, 12996, 13102, 12655,
+    32916, 28718, 28685, 28686, 32804, 9854, 9318, 10861, 20486, 28713, 11657, 10868, 12514, 17002, 28771, 28782,
+    13091, 12001, 12045, 8665, 12727, 9009, 28704, 28797, 12394, 13170, 28824, 12403, 13078, 12297, 32852, 28687,
+    32776, 28761, 32846, 9387, 16667, 11901, 9089, 13090, 4716, 9854, 12680, 11104, 11466, 11703, 10853, 12659,
+    13182, 11404, 28784, 13159, 16587, 28742, 11901, 28795, 28706, 10870, 10132, 28745, 28778, 9608, 17305, 12948,
+    12599, 32916, 17139, 28719, 32932, 20489, 28799, 8956, 12322, 32792, 16699, 11748, 28817, 5338, 17173, 9310,
+    11907, 8322, 9935, 9218, 10572, 10945, 16835, 9845, 12680, 12992, 17015, 17317, 28705, 16430, 16903, 28736,
+    28787, 12716, 12669, 28724, 28709, 13127, 28791, 8988, 32774, 13042, 13079, 28745, 16641, 16529, 28741, 12467,
+    9554, 13209, 16530, 12789, 17170, 28783, 11656, 12460, 12960, 13170, 28824, 8424, 17318, 28729, 12658, 12456,
+    32781, 6226, 10963, 12055, 28809, 6350, 28696, 17250, 9317, 9676, 8995, 28793, 12489, 12753, 13161, 32807,
+    12691, 6411, 16619, 12827, 9388, 32934, 13126, 12764, 32818, 12420, 12754, 28706, 12371, 32843, 8965, 13055,
+    12646, 9554, 28716, 13007, 16412, 17240, 28825, 28730, 11746, 12429, 9265, 12406, 32893, 12741, 28730, 5613,
+    9311, 28820, 8413, 12334, 28806, 13152, 32846, 12895, 28784, 8779, 10992, 16607, 8752, 13067, 12859, 28704,
+    12872, 17251, 11985, 12404, 32853, 11756, 11177, 28771, 10878, 17318, 9307, 12790, 12647, 17095, 9300, 28761,
+    5835, 28692, 12456, 12406, 8831, 16834, 12848, 32898, 12538, 28821, 6440, 12346, 6189, 9616, 28694, 12895,
+    16605, 28738, 8359, 28806, 28700, 13128, 12540, 12617, 10992, 12804, 10573, 11908, 13064, 9310, 28793, 28741,
+    12664, 17241, 28812, 12669, 12658, 28721, 13089, 13014, 11989, 11764, 28699, 28691, 13125, 12039, 11480, 17015,
+    12839, 28702, 12670, 28783, 28762, 12862, 28796, 28814, 11395, 12696, 16822, 12695, 10261, 32843, 12323, 12897,
+    8611, 16450, 32879, 5318, 28698, 32852, 12852, 9676, 13102, 17172, 12874, 12912, 6465, 28748, 8424, 13091,
+    32842, 12874, 5064, 6042, 28753, 13091, 11475, 12359, 12862, 11939, 28736, 13103, 28776, 28697, 13015, 11769,
+    12599, 12395, 28819, 12905, 13185, 4954, 32780, 16662, 8470, 12370, 9846, 12960, 17014, 8404, 12924, 13030,
+    32919, 28741, 12312, 28728, 12729, 16700, 17253, 12648, 13170, 9021, 16937, 28676, 32780, 32924, 12456, 17315,
+    12896, 12660, 16936, 11779, 12408, 11902, 28774, 12537, 9294, 12587, 32898, 8790, 13042, 32776, 9985, 9318,
+    28724, 32825, 12753, 13089, 10882, 9020, 32774, 9983, 12596, 32781, 12860, 16683, 28793, 28801, 12711, 12047,
+    32819, 12573, 8666, 8388, 32843, 12667, 16755, 13198, 13193, 12894, 28803, 28685, 16437, 9600, 16767, 12418,
+    28708, 12429, 5098, 4977, 28742, 12984, 5460, 10369, 9256, 13194, 32882, 28712, 12924, 8460, 11633, 12838,
+    12348, 12994, 13204, 32833, 12068, 20485, 12780, 12872, 16677, 12860, 11160, 12744, 28683, 10216, 12936, 11180,
+    12489, 9012, 10693, 13170, 12467, 28793, 28692, 28749, 32830, 28747, 28695, 12840, 11182, 12647, 28814, 11451,
+    12635, 9302, 17250, 28756, 12298, 5047, 12599, 8491, 17032, 28787, 28717, 32819, 16835, 12888, 16746, 13124,
+    28677, 11748, 12776, 16449, 12463, 16681, 17251, 12852, 12910, 13162, 12552, 12731, 32833, 12708, 28680, 17318,
+    32921, 12754, 28681, 32823, 16756, 17308, 28771, 12488, 12381, 32868, 16966, 12658, 13224, 8605, 16697, 28675,
+    17320, 16756, 32909, 32844, 12479, 28730, 32916, 9002, 10883, 11984, 16755, 28795, 17173, 8720, 12645, 16620,
+    8405, 20490, 28689, 9600, 12428, 6365, 10284, 28679, 28825, 10881, 13152, 28680, 13152, 12787, 20490, 9002,
+    28783, 12407, 12885, 16620, 8254, 12922, 11779, 28735, 8423, 12860, 9555, 12984, 13002, 28686, 16774, 28781,
+    8491, 17251, 28727, 11034, 9562, 12849, 8421, 13092, 17332, 28709, 13115, 12635, 17016, 8412, 12923, 12536,
+    9348, 12918, 16909, 12647, 12550, 12551, 11170, 28696, 16856, 5069, 10553, 28819, 11181, 32851, 13115, 12971,
+    12002, 12671, 20490, 12982, 8723, 8469, 16966, 5048, 5579, 32780, 28746, 13181, 8555, 12920, 16539, 9846,
+    32911, 11939, 12560, 28771, 8667, 11985, 16685, 9068, 13003, 10145, 12535, 16845, 28794, 12970, 28828, 12935,
+    12347, 5340, 28746, 17004, 12597, 16778, 12635, 8723, 13209, 28796, 32829, 11945, 10240, 11059, 12384, 6466,
+    13181, 10115, 16687, 16755, 17253, 5104, 28739, 32841, 32846, 9074, 12047, 17095, 12298, 28706, 12996, 32891,
+    32828, 13205, 28745, 28719, 6411, 28799, 9609, 11451, 12969, 16854, 12778, 10837, 28783, 5916, 8964, 28716,
+    12393, 9608, 16764, 28729, 12561, 28824, 12572, 12636, 32881, 32857, 17299, 13114, 32846, 28761, 28743, 10883,
+    9562, 28723, 12619, 16846, 12968, 28691, 32936, 11953, 13068, 16822, 20487, 12851, 8424, 12407, 17411, 12345,
+    12380, 13171, 9264, 12836, 13193, 8322, 28728, 9020, 28720, 12396, 8767, 12299, 11245, 32846, 28689, 6466,
+    28818, 8713, 8704, 12742, 12516, 11657, 10444, 17032, 12309, 9173, 13210, 11296, 16609, 8421, 9254, 10483,
+    16519, 12355, 13043, 12702, 12765, 32816, 16463, 12707, 28705, 13205, 13221, 28736, 9077, 32854, 28714, 13205,
+    12635, 9983, 10880, 9839, 12586, 28748, 10584, 9518, 28746, 28723, 9610, 16688, 28730, 5640, 12899, 5607,
+    12692, 28717, 28815, 32793, 28797, 5483, 10216, 10742, 12803, 16695, 9068, 12608, 11469, 12779, 13193, 10414,
+    12683, 12619, 9892, 28770, 28737, 12585, 12980, 32830, 28755, 10506, 13079, 12476, 11182, 12040, 17319, 28818,
+    12743, 32833, 28771, 12611, 32833, 12791, 32794, 28731, 8468, 11479, 12647, 16437, 12849, 9021, 28762, 28718,
+    8422, 12888, 16451, 32839, 8775, 28704, 9003, 16972, 17359, 12586, 12960, 13055, 12420, 28791, 10079, 13188,
+    17059, 28750, 12702, 32864, 12574, 13206, 12444, 16971, 12744, 16744, 13031, 16778, 32923, 17358, 28796, 11560,
+    12371, 16618, 12324, 32854, 12599, 32865, 16998, 12969, 28721, 32837, 28800, 28739, 28817, 32920, 32859, 12692,
+    11932, 10789, 13194, 11657, 12561, 32866, 12442, 32815, 10450, 16925, 16776, 12790, 13197, 28799, 16541, 28696,
+    12619, 28746, 32845, 17014, 28715, 12525, 28732, 12404, 8712, 8618, 20490, 13160, 8965, 16570, 11327, 16814,
+    17252, 5462, 16695, 32793, 12527, 16742, 16695, 28782, 13017, 10255, 8480, 12768, 16825, 12468, 12431, 11766,
+    13109, 16621, 12465, 32866, 28753, 8666, 12714, 12002, 11647, 13187, 16966, 9863, 28706, 10153, 12653, 17325,
+    13092, 12467, 28818, 11953, 28757, 12645, 13103, 16461, 13186, 9364, 28798, 32869, 28794, 12492, 32806, 32833,
+    32820, 28704, 16620, 16932, 8713, 28685, 16998, 13044, 8785, 12011, 12610, 32793, 32794, 13116, 13127, 28809,
+    13104, 28718, 28681, 20487, 28807, 13200, 11080, 28678, 28749, 16677, 12753, 10676, 12515, 12456, 12393, 28709,
+    11450, 13128, 13116, 32820, 11047, 16855, 28804, 17090, 28702, 13140, 10975, 12396, 11947, 16649, 12526, 28807,
+    12729, 13221, 28750, 12980, 11778, 28768, 28693, 32854, 11266, 9919, 28732, 9683, 32781, 12707, 8467, 16619,
+    12396, 10443, 13188, 32923, 12660, 9374, 32865, 16989, 12489, 13205, 13091, 12466, 11893, 28760, 28731, 9318,
+    12515, 12850, 5894, 11561, 8359, 28743, 32846, 28724, 28683, 13104, 8414, 13216, 16930, 12837, 12646, 28747,
+    12992, 12730, 12980, 8422, 5489, 12040, 13217, 13056, 16461, 12731, 13006, 8788, 17240, 16844, 13187, 10506,
+    12324, 12888, 12307, 12840, 5916, 16462, 12765, 12839, 12504, 9948, 28746, 28799, 28695, 16779, 28695, 9861,
+    28750, 16656, 28707, 16436, 17251, 12703, 28809, 11768, 12810, 12886, 28760, 12041, 12659, 9319, 12992, 13198,
+    11735, 9953, 9916, 28705, 28718, 16609, 11223, 28817, 28798, 9181, 10741, 11956, 13162, 16776, 12408, 13185,
+    10198, 8767, 16540, 16756, 12462, 5105, 5105, 9673, 11378, 12882, 8453, 10197, 13217, 12875, 17360, 28673,
+    28804, 11114, 32819, 13006, 13042, 12681, 16767, 10407, 28795, 28703, 16585, 11479, 28745, 12819, 12576, 11768,
+    17240, 16598, 12513, 9501, 12683, 13198, 9801, 32856, 9900, 32806, 9664, 28780, 12756, 12862, 13042, 12895,
+    12318, 5495, 16538, 28769, 12440, 12333, 28694, 8778, 20481, 16697, 28747, 32840, 9366, 16440, 12957, 9808,
+    9673, 28771, 12766, 12514, 6145, 28770, 13140, 12810, 8488, 32922, 32885, 6139, 12600, 16966, 11777, 32777,
+    17230, 20488, 9076, 16509, 13224, 9321, 28693, 28705, 9885, 5898, 16540, 28722, 12441, 16530, 28808, 28759,
+    16835, 28703, 28707, 9311, 12768, 28678, 16463, 12405, 12980, 12850, 28714, 12526, 12887, 12917, 28817, 12887,
+    8778, 32854, 9066, 12452, 28795, 12959, 13104, 12790, 32879, 9068, 13008, 12660, 12670, 16619, 12668, 8966,
+    11947, 28823, 11005, 28731, 11956, 28678, 32776, 12454, 10706, 28717, 28753, 32854, 28745, 17332, 12619, 11374,
+    32794, 28724, 12874, 28710, 12837, 28682, 12942, 28746, 28809, 12073, 13056, 12646, 13216, 32833, 17208, 12366,
+    11750, 10756, 28677, 28745, 28704, 13185, 16461, 12788, 11086, 12620, 28705, 10115, 5922, 28741, 8470, 8790,
+    28760, 8351, 12066, 20485, 12430, 13212, 13188, 28792, 12791, 5619, 12811, 12868, 9367, 4689, 12598, 12762,
+    12779, 12742, 9358, 12700, 28805, 12332, 12559, 16530, 16825, 10254, 17365, 10152, 13209, 12684, 12502, 12296,
+    28739, 12359, 13223, 32824, 12372, 11544, 12875, 16999, 12750, 13007, 28775, 10065, 5993, 13076, 28698, 5836,
+    12768, 5362, 12898, 13116, 12957, 28784, 16855, 16832, 12887, 12838, 13004, 12822, 16753, 16517, 12562, 8767,
+    12743, 13080, 8423, 28729, 12408, 12312, 13186, 28774, 32869, 16699, 11309, 32830, 28744, 16777, 12923, 13197,
+    11005, 11302, 8790, 20481, 12300, 13210, 8664, 28810, 5461, 16459, 17329, 16686, 12585, 9564, 12431, 28733,
+    16514, 12876, 28685, 28783, 28792, 16508, 28702, 17360, 12790, 32804, 13134, 32883, 8656, 12636, 32857, 20486,
+    12067, 13015, 32871, 32922, 12348, 16530, 9012, 9563, 12058, 28768, 28730, 12919, 32854, 16989, 9265, 17385,
+    8368, 16777, 17329, 28757, 12730, 11589, 16608, 28695, 28719, 28819, 17320, 16579, 11136, 6015, 16775, 12944,
+    28761, 17227, 28761, 17329, 32870, 28707, 12521, 17123, 16700, 12619, 28705, 12777, 13210, 10677, 13218, 5369,
+    13174, 16835, 28689, 10539, 28793, 12575, 17141, 8667, 28819, 12899, 12864, 12777, 8723, 11955, 12884, 16699,
+    8491, 10751, 11056, 12463, 28821, 9918, 16913, 28673, 16697, 32897, 8480, 16462, 12299, 32846, 8760, 28807,
+    12732, 10144, 32911, 12552, 16858, 9636, 8575, 12332, 10743, 10215, 8787, 9666, 8941, 12495, 9609, 11092,
+    12731, 8787, 9265, 9854, 12684, 28721, 28698, 12958, 12783, 13176, 12838, 12819, 28819, 9580, 12849, 5928,
+    12804, 16430, 12718, 16993, 28818, 11156, 16846, 13172, 9078, 28678, 32837, 12983, 12563, 17147, 12681, 16609,
+    16491, 28730, 12068, 6173, 16777, 28776, 13116, 10407, 9051, 12863, 32780, 10451, 9302, 32893, 8713, 11042,
+    12669, 28744, 28751, 32816, 32830, 12959, 12918, 12683, 13026, 11692, 9851, 16914, 32924, 17089, 12444, 12682,
+    28819, 32879, 8490, 32820, 9918, 32868, 8488, 28742, 13217, 32807, 28749, 12359, 10539, 12851, 28770, 12443,
+    12810, 13211, 28820, 28753, 9077, 13016, 16458, 12430, 28722, 9376, 28733, 32891, 28773, 20485, 12828, 12514,
+    8696, 16620, 8413, 12888, 28732, 11093, 9265, 28741, 12969, 13043, 12581, 10497, 12755, 32794, 28820, 28736,
+    12788, 12956, 28729, 12420, 28818, 28710, 12799, 9919, 13209, 20482, 12491, 5626, 9845, 12491, 12377, 28760,
+    12527, 28696, 13217, 9384, 12839, 10490, 12820, 6314, 32790, 10414, 12958, 9366, 28761, 28781, 28697, 28775,
+    5462, 17208, 10284, 32843, 11056, 9941, 13175, 8397, 32807, 4984, 12682, 20481, 17078, 12467, 11356, 11142,
+    28753, 9367, 28755, 10714, 12754, 10218, 12067, 12595, 16992, 11895, 13008, 10546, 16912, 32781, 28698, 9608,
+    8722, 12920, 6299, 16895, 28678, 11304, 13077, 13200, 12884, 9375, 28674, 11049, 32832, 32934, 8957, 17209,
+    17002, 20481, 13006, 17010, 8250, 13056, 12822, 11102, 12876, 12460, 28770, 8397, 10458, 28719, 28763, 12954,
+    16463, 16621, 12920, 11603, 32776, 28747, 28783, 12560, 10264, 13222, 28796, 6168, 10844, 13028, 28797, 8713,
+    12899, 28805, 28742, 16491, 16594, 28819, 28808, 11379, 12849, 12839, 9564, 28694, 12575, 28727, 13184, 12826,
+    10160, 13120, 11448, 12670, 17399, 12588, 28709, 12622, 9364, 32889, 10743, 5411, 9265, 28679, 13221, 12732,
+    12910, 28773, 12921, 9078, 12076, 12660, 11930, 28745, 12528, 8790, 13209, 12503, 12789, 16835, 12588, 12972,
+    28751, 32807, 12538, 28681, 13088, 28722, 32793, 28760, 28718, 8789, 28692, 9383, 12899, 28700, 13135, 12587,
+    13200, 9265, 9683, 10743, 12415, 12468, 28716, 9021, 12611, 20489, 28824, 13051, 10459, 20490, 9317, 16925,
+    32806, 32879, 9687, 10414, 32791, 28816, 28790, 12539, 12648, 12467, 28818, 28773, 11050, 28763, 10850, 12510,
+    32836, 12307, 11637, 28753, 32921, 10750, 16541, 8789, 28809, 10451, 10803, 28718, 9917, 12983, 13101, 12816,
+    20483, 28823, 8788, 9349, 32833, 10459, 10282, 28723, 12365, 10782, 32866, 20486, 16806, 13019, 10560, 12575,
+    12788, 32879, 28691, 12861, 9018, 9385, 12768, 17219, 28805, 12431, 32820, 32856, 12732, 28683, 28822, 13062,
+    28818, 17209, 17368, 12612, 11434, 17369, 12620, 12444, 20487, 16463, 28772, 12308, 8739, 16609, 12478, 12836,
+    11042, 12677, 13172, 28680, 12384, 16621, 12670, 28726, 12077, 28820, 9321, 12408, 28719, 28744, 28816, 12919,
+    10812, 32892, 20482, 28729, 12988, 17217, 12982, 13092, 12527, 13174, 17150, 28737, 16931, 13175, 32868, 17354,
+    28817, 32781, 32934, 11310, 28743, 32882, 12900, 10247, 12622, 16616, 12076, 28684, 13113, 12358, 10804, 9321,
+    12706, 17387, 28676, 9320, 28729, 28774, 10751, 20486, 16609, 13116, 32870, 13018, 17145, 13219, 17388, 12876,
+    12930, 28809, 28690, 12743, 28739, 10254, 28773, 17394, 8704, 28678, 28758, 12718, 32880, 28741, 5037, 28776,
+    12850, 13199, 32781, 12957, 17132, 32855, 28817, 32806, 28702, 8854, 12430, 28746, 16446, 32833, 13222, 9657,
+    9657, 6431, 16855, 28784, 9388, 16615, 28677, 17070, 16993, 28708, 12996, 10583, 16700, 17002, 28744, 28773,
+    12825, 12588, 12404, 10751, 13100, 28819, 10750, 12348, 13027, 12750, 28694, 8776, 20487, 20487, 12826, 32829,
+    12984, 6343, 28797, 32858, 13039, 12823, 17009, 28751, 5672, 20482, 28763, 12659, 12360, 12370, 28694, 28692,
+    12648, 17147, 12545, 16857, 16992, 8491, 12971, 32894, 32868, 17081, 28739, 16858, 6015, 20485, 9254, 32882,
+    17281, 12813, 17053, 28726, 28762, 17131, 8487, 28676, 16698, 12812, 16744, 28781, 12695, 28683, 12939, 6321,
+    28710, 12982, 17328, 12633, 12528, 28793, 12801, 32894, 28826, 28820, 28739, 17076, 9209, 12298, 16427, 28684,
+    28737, 28822, 11410, 10758, 12635, 17361, 11058, 17241, 12476, 28807, 16845, 10805, 12395, 32794, 17132, 17001,
+    10868, 12468, 12755, 8577, 11387, 12539, 20488, 28715, 28827, 12813, 16509, 12994, 20489, 13224, 13185, 10497,
+    12942, 12539, 28772, 28683, 8769, 12078, 12911, 11607, 12523, 12659, 28808, 13027, 9674, 32885, 12671, 28740,
+    8490, 10264, 32845, 28776, 12932, 10513, 13210, 28675, 16925, 28684, 28731, 10851, 28806, 20489, 32845, 32870,
+    11111, 17002, 28807, 12540, 10247, 12606, 11057, 28771, 28760, 32858, 12983, 12756, 16846, 13116, 13125, 17411,
+    17078, 28707, 28733, 11909, 12826, 13125, 12851, 11413, 8584, 13224, 28742, 12539, 13089, 32807, 12309, 12528,
+    9975, 28696, 8777, 16542, 28781, 6180, 17287, 28758, 28820, 12576, 28684, 28684, 20487, 32857, 28677, 10513,
+    9610, 9375, 9985, 9077, 32858, 6178, 13221, 12875, 8255, 16767, 17062, 10460, 28710, 12407, 12982, 17093,
+    16778, 12996, 17072, 8478, 6437, 17369, 17368, 32892, 16536, 28706, 9898, 17218, 32844, 12921, 12994, 16541,
+    32818, 32897, 12696, 28699, 28748, 12528, 20482, 12921, 28789, 32909, 13052, 12778, 13224, 28826, 12622, 10806,
+    11394, 32930, 12873, 13002, 12932, 28701, 16991, 9366, 32918, 11148, 12959, 28782, 11700, 28790, 28769, 12772,
+    28673, 9900, 10048, 12624, 10207, 10882, 28818, 11655, 5665, 16617, 11349, 28762, 32781, 16529, 9321, 9975,
+    28787, 28727, 9088, 28799, 8488, 16540, 32906, 12898, 5928, 28822, 12942, 12742, 13042, 13140, 10254, 12767,
+    28695, 28739, 28682, 12908, 12935, 28758, 10460, 28748, 11692, 16621, 12456, 12549, 28769, 12407, 28783, 28814,
+    17226, 32911, 28702, 6392, 8491, 17394, 10561, 17149, 10218, 32903, 16451, 28696, 10750, 32871, 32833, 32807,
+    28742, 12564, 12886, 28707, 9908, 10262, 6223, 13007, 28674, 28810, 28711, 28761, 28709, 11244, 32829, 28701,
+    12690, 11608, 28805, 12525, 12972, 9919, 28788, 10759, 20488, 13116, 28707, 11747, 13115, 12347, 32895, 16779,
+    32930, 17220, 12599, 28708, 17378, 9211, 13210, 10859, 28691, 9863, 12598, 13041, 12600, 12923, 13137, 10814,
+    28723, 20488, 12850, 32893, 32892, 11442, 13099, 10162, 16925, 10845, 17378, 6216, 28769, 32872, 28715, 17161,
+    10797, 17220, 11357, 32791, 12932, 12922, 17377, 12780, 12875, 12814, 17332, 13172, 13090, 20483, 12468, 12648,
+    8271, 13027, 17168, 28727, 17011, 32895, 16857, 28674, 17071, 6022, 12562, 12864, 10497, 17228, 6394, 32882,
+    8321, 20485, 12569, 28713, 5673, 28677, 28715, 32883, 13115, 12719, 12732, 12921, 16924, 28771, 16935, 12750,
+    12874, 28721, 12887, 12576, 32870, 12863, 17080, 28755, 6180, 17396, 16778, 12444, 9859, 13113, 32842, 28810,
+    13125, 28813, 12827, 9540, 12528, 10281, 12755, 12839, 17062, 9908, 32895, 10252, 28820, 28796, 28828, 28783,
+    10553, 13020, 32846, 12404, 12766, 32789, 9385, 16538, 28795, 13210, 12887, 11442, 28778, 12960, 28732, 11104,
+    16935, 12296, 16858, 16756, 10859, 12946, 12933, 16447, 9956, 28708, 9986, 28825, 28804, 28725, 28785, 12407,
+    13099, 13113, 32844, 8656, 16542, 16776, 32820, 28763, 5665, 28702, 32858, 17229, 10861, 9964, 12959, 12462,
+    28802, 12943, 32801, 28695, 32817, 10852, 32816, 12667, 16541, 8489, 12851, 9011, 11609, 28808, 12576, 16699,
+    10883, 12840, 28753, 8667, 32868, 16463, 28735, 28738, 12875, 9088, 20481, 10271, 12982, 11931, 28740, 32893,
+    10515, 28721, 16420, 11470, 12932, 10561, 32933, 28785, 16700, 32871, 12394, 16419, 13091, 12312, 12816, 12428,
+    28729, 28778, 28750, 28746, 9961, 13152, 28761, 32931, 10862, 11640, 10813, 12945, 9663, 28771, 12564, 32933,
+    28721, 28825, 28784, 8461, 16605, 32932, 11410, 28698, 17001, 13006, 28799, 28705, 12755, 17397, 13102, 32895,
+    32936, 13200, 28745, 13126, 28747, 16621, 10516, 28782, 12719, 10862, 12528, 28703, 28711, 28785, 12696, 12370,
+    12887, 13124, 12405, 12972, 13112, 28699, 10552, 16463, 28794, 32829, 32817, 32934, 11114, 28676, 9599, 16858,
+    12945, 11443, 28685, 28793, 12444, 8789, 11105, 12963, 28802, 12449, 12706, 11403, 16530, 11654, 9377, 12417,
+    13163, 9545, 9376, 12804, 28797, 8986, 16910, 12934, 12911, 16606, 8760, 10552, 12908, 16959, 17168, 12298,
+    12851, 10218, 32908, 6022, 10815, 9320, 17011, 13059, 12744, 28773, 17408, 28727, 28761, 13151, 32883, 13087,
+    13113, 10507, 16779, 9846, 8790, 6439, 28773, 12359, 4700, 4472, 28749, 17305, 32897, 17219, 11702, 6218,
+    8650, 16429, 28708, 9481, 28794, 11115, 10435, 10217, 6022, 32936, 11029, 11402, 17004, 17282, 12520, 17011,
+    32826, 5276, 9481, 16933, 12632, 12584, 6362, 11447, 28827, 13062, 32830, 32932, 13090, 11050, 5674, 28734,
+    11945, 11105, 28802, 9239, 6058, 13102, 32884, 13104, 10507, 8941, 12488, 28741, 32818, 11865, 28710, 28760,
+    17117, 28744, 13089, 28692, 10862, 32816, 11114, 10730, 12430, 17172, 6022, 10348, 28740, 28782, 12320, 10101,
+    12684, 32779, 12644, 13164, 6363, 16851, 12632, 9975, 28693, 12995, 12381, 12348, 12756, 13019, 12389, 17298,
+    13113, 32918, 11741, 12827, 28716, 11096, 12636, 12382, 10049, 17288, 28698, 13172, 9219, 12659, 10853, 28822,
+    9687, 10845, 28691, 9685, 28697, 12681, 11160, 12537, 13116, 10580, 20484, 12768, 12827, 6051, 12309, 28714,
+    28808, 6394, 16904, 17408, 9310, 28739, 28742, 17397, 28807, 13139, 32791, 28758, 16440, 20485, 28798, 28808,
+    28784, 13159, 8490, 32826, 10582, 28711, 12728, 16439, 5829, 13005, 12561, 17091, 12452, 13220, 28707, 28797,
+    8790, 10343, 13079, 10561, 11703, 28809, 28772, 12524, 32885, 17289, 12492, 12876, 17014, 12768, 28744, 12477,
+    12536, 17407, 32872, 12923, 32923, 12324, 12690, 10208, 28709, 12525, 13221, 13104, 8786, 6223, 12532, 12624,
+    16825, 11468, 13029, 11648, 28737, 13053, 28808, 28793, 32820, 13051, 28766, 16666, 12417, 32842, 12945, 13076,
+    17061, 13122, 9685, 12887, 9909, 12971, 12465, 12643, 12636, 13212, 12871, 12780, 12574, 28718, 13074, 12657,
+    28684, 12570, 16736, 17013, 12768, 28816, 16953, 28785, 12728, 16509, 6408, 12586, 12995, 12934, 12383, 32872,
+    17091, 28674, 17239, 6189, 28720, 28743, 28719, 32807, 11113, 28723, 28809, 28827, 17239, 12873, 28772, 28767,
+    12335, 8949, 12813, 28814, 11713, 17352, 12955, 12888, 12390, 13119, 12636, 10581, 28778, 10852, 12923, 28772,
+    6059, 11479, 12641, 16667, 28726, 9939, 17162, 6463, 16637, 28736, 6232, 11113, 9815, 28735, 32793, 12947,
+    9480, 9204, 12539, 13125, 12666, 12598, 28812, 12466, 28785, 28698, 10878, 11657, 12995, 6438, 28794, 16991,
+    17090, 28725, 8358, 9088, 16609, 32844, 28802, 28706, 12320, 16776, 32815, 32846, 16616, 13052, 32779, 9248,
+    11404, 13089, 12729, 28787, 8620, 28691, 28793, 28690, 8351, 28787, 32909, 12922, 32777, 13158, 10725, 32791,
+    6058, 11402, 16891, 12876, 13150, 13066, 16542, 13122, 28782, 11404, 28797, 12450, 16795, 28749, 28750, 11403,
+    28786, 32778, 28687, 12442, 9264, 32922, 28771, 12391, 16526, 12994, 17240, 28809, 8490, 28744, 8666, 12358,
+    17015, 11984, 9078, 10991, 17060, 32859, 28696, 13077, 9364, 12540, 13140, 12308, 10852, 13101, 16598, 12847,
+    28673, 6446, 32907, 28727, 32817, 32910, 12996, 16676, 8423, 10583, 9350, 12371, 17092, 12490, 16439, 12752,
+    4955, 28735, 13020, 28728, 28809, 28779, 12768, 12319, 12624, 12835, 32898, 28727, 9386, 28693, 28679, 28819,
+    28740, 12486, 32818, 12370, 12873, 13224, 16578, 20482, 4700, 12430, 11953, 12523, 13158, 16650, 8414, 6362,
+    12738, 11693, 17290, 10584, 10273, 17090, 10326, 5093, 32830, 17332, 10882, 12299, 16936, 12401, 11703, 28771,
+    17239, 12513, 10580, 17297, 32789, 11443, 12775, 11713, 20485, 13148, 16616, 13092, 9767, 28810, 10274, 28680,
+    20483, 11901, 4721, 12298, 16778, 32774, 28740, 12420, 17161, 9973, 32831, 8584, 28682, 17172, 16824, 28710,
+    17015, 12828, 13007, 28694, 10883, 6447, 16858, 12677, 10183, 12859, 12888, 28745, 12575, 32820, 32917, 12369,
+    28704, 13077, 12528, 16460, 13065, 28787, 12753, 12515, 10517, 28728, 10861, 28811, 9386, 16588, 32816, 32791,
+    13170, 8364, 8912, 12324, 12345, 16843, 16934, 28722, 28679, 28711, 12382, 12765, 28704, 11931, 12405, 13102,
+    28704, 12684, 20482, 32897, 16843, 28808, 16587, 12923, 17305, 28769, 13031, 32853, 9256, 12671, 10477, 11262,
+    12033, 17314, 8788, 16413, 32817, 11467, 16695, 10284, 12984, 17052, 11742, 13065, 9010, 12360, 9088, 28742,
+    12548, 13067, 4889, 16607, 17298, 11872, 17094, 28743, 16825, 28677, 32792, 16922, 13137, 28682, 12345, 12863,
+    28745, 28770, 17309, 17014, 12612, 13028, 12972, 28749, 12440, 17299, 13064, 16687, 12874, 9600, 12907, 32910,
+    11262, 10217, 16451, 12669, 10116, 13041, 12423, 12657, 17299, 10234, 32819, 17016, 28773, 12912, 9685, 16686,
+    13065, 12792, 12467, 12978, 28795, 12764, 28675, 16831, 32845, 28725, 6139, 13077, 13180, 11703, 20490, 28783,
+    17015, 16656, 12432, 28716, 17297, 32911, 9947, 12488, 13103, 13076, 12599, 6445, 16937, 28692, 9010, 12369,
+    12960, 28708, 28743, 12382, 32872, 17307, 8954, 9002, 12442, 9663, 28783, 13067, 32885, 16845, 10563, 12767,
+    9320, 8882, 12431, 11458, 12850, 9264, 11468, 12876, 32776, 28715, 20482, 6456, 12720, 12550, 12528, 6235,
+    6445, 5042, 28773, 32780, 12948, 17398, 12858, 11742, 12490, 12324, 12393, 11469, 9012, 12323, 20484, 6235,
+    28736, 16834, 10580, 32792, 11982, 11413, 16766, 9744, 16607, 28679, 11469, 11152, 12816, 28701, 12441, 13032,
+    17289, 8919, 12634, 12549, 12455, 12407, 10273, 12755, 8720, 28698, 16608, 32792, 11169, 28742, 8779, 12659,
+    28781, 9852, 6446, 32843, 28793, 10871, 11467, 5557, 28728, 28790, 28769, 12371, 32846, 12002, 8570, 9883,
+    8600, 28680, 17172, 13114, 28787, 13065, 8713, 11160, 28718, 13222, 9311, 11171, 16675, 11712, 13103, 9011,
+    32865, 17093, 16893, 32806, 12633, 10573, 4891, 16834, 32911, 11900, 8322, 32922, 32872, 12731, 32922, 8421,
+    32807, 28786, 11741, 16765, 13169, 6454, 9372, 28757, 28722, 11774, 28719, 12299, 10871, 12311, 12803, 32936,
+    17015, 28712, 12936, 20486, 12776, 13145, 12658, 12729, 12682, 12885, 12960, 12359, 11750, 13076, 28726, 28763,
+    9518, 12762, 28748, 12576, 28717, 16608, 10583, 10516, 32923, 28825, 32814, 10870, 20485, 12616, 17043, 9517,
+    28682, 28820, 13183, 28783, 28821, 12461, 11985, 32917, 11872, 12536, 28823, 13160, 32866, 32842, 28807, 9780,
+    12537, 10871, 9308, 12644, 28803, 12371, 13186, 16756, 12435, 13056, 28784, 17318, 28713, 10947, 8621, 28769,
+    17003, 28763, 13128, 12476, 10832, 17318, 32842, 12981, 17083, 9264, 32818, 13091, 12560, 28693, 4977, 12645,
+    28814, 16527, 32828, 16492, 12635, 16446, 17012, 13219, 13031, 11873, 28710, 16579, 12936, 13199, 6234, 12473,
+    12608, 32865, 16834, 16620, 9665, 8650, 12391, 16519, 13197, 16846, 17319, 10670, 10282, 28735, 12756, 12996,
+    10881, 28675, 12310, 28797, 6409, 16763, 28703, 11775, 6365, 13183, 28821, 9861, 12415, 12524, 28721, 12894,
+    28748, 12658, 9687, 32831, 13161, 12347, 12713, 9292, 12714, 13147, 13032, 32819, 16462, 13186, 13126, 12715,
+    10583, 5092, 20487, 13079, 12360, 13194, 8283, 13128, 12356, 16688, 17297, 8966, 17249, 12607, 12803, 16904,
+    13067, 28697, 28745, 13007, 12489, 16528, 16980, 12658, 12684, 32922, 28769, 12984, 32805, 12655, 8359, 11182,
+    16619, 16765, 8790, 10274, 10563, 8790, 10871, 16923, 28749, 28743, 12972, 12912, 28728, 28730, 12754, 12862,
+    32920, 12780, 9860, 8307, 28788, 8719, 12360, 28817, 11545, 28685, 12617, 10969, 17252, 8414, 28743, 8319,
+    28785, 5356, 12883, 28696, 28794, 32830, 12732, 12934, 28770, 12703, 12816, 16765, 16767, 11755, 12766, 9610,
+    12873, 12647, 9517, 28687, 12872, 12551, 12792, 28762, 28690, 12719, 32923, 28743, 13126, 12756, 11245, 32859,
+    8412, 6440, 12887, 28763, 12779, 8790, 32842, 12886, 12923, 10735, 12502, 10997, 11467, 32831, 5431, 8643,
+    17174, 9687, 28694, 28772, 12596, 16765, 12485, 13170, 32832, 17318, 12808, 28747, 12540, 12708, 8459, 16608,
+    16619, 12691, 12645, 17174, 16901, 8696, 28776, 32917, 11010, 12407, 5406, 12576, 28785, 16779, 5422, 28796,
+    5608, 28777, 11985, 13029, 5313, 28740, 12759, 12408, 8935, 10881, 12786, 28747, 12968, 28794, 28821, 32818,
+    28818, 12648, 12979, 12912, 28682, 12647, 10159, 11907, 12383, 16688, 28704, 12540, 5099, 12574, 32911, 5276,
+    28807, 28749, 6402, 32780, 5432, 12355, 5433, 11181, 10736, 8995, 12504, 28698, 12672, 16596, 28707, 28680,
+    28756, 28732, 8774, 9862, 28726, 28757, 32864, 13184, 32846, 28828, 13090, 32885, 16972, 32924, 20486, 28807,
+    32832, 12767, 16598, 28815, 13137, 28681, 28681, 13171, 12956, 6466, 12777, 16912, 28804, 16505, 12960, 13079,
+    28682, 12701, 28756, 28796, 9972, 17318, 11013, 32845, 12359, 11105, 9020, 32920, 16902, 12001, 11768, 12335,
+    9600, 12936, 12539, 12424, 8759, 16936, 13139, 32802, 28807, 11179, 11114, 5070, 28821, 12516, 12692, 13148,
+    16766, 8414, 9302, 5894, 17250, 12994, 28827, 9656, 13182, 11561, 28720, 6233, 8366, 9256, 16698, 12561,
+    12633, 20482, 9310, 28787, 12983, 16519, 13032, 28717, 32817, 28730, 16854, 8965, 9310, 9365, 12600, 32806,
+    28692, 28718, 10448, 12536, 32920, 32863, 6456, 28707, 28760, 28795, 13039, 5899, 12466, 16746, 28750, 28716,
+    16529, 12802, 4983, 13205, 11338, 28682, 12055, 12648, 28719, 16618, 10160, 28737, 12620, 11947, 16935, 10360,
+    16598, 17331, 12809, 32936, 28721, 8422, 12492, 9377, 12872, 12885, 12468, 32842, 28679, 12958, 13068, 12797,
+    28808, 28781, 32921, 12525, 12356, 9309, 28699, 16835, 12838, 28762, 12897, 32802, 28715, 9534, 17241, 11057,
+    32820, 12401, 13126, 11627, 12960, 12917, 32774, 32883, 9664, 10218, 17318, 28787, 12788, 32923, 5835, 28765,
+    12864, 9657, 12597, 11776, 16855, 12550, 17360, 11759, 32815, 13111, 16686, 12412, 28759, 17328, 12680, 12477,
+    12898, 11759, 9051, 8621, 16607, 13172, 12752, 12716, 8491, 13199, 12465, 6123, 12980, 11990, 16698, 28731,
+    16813, 32792, 12924, 12850, 8424, 20482, 28783, 10881, 8769, 12310, 28726, 5098, 8423, 28703, 28735, 28819,
+    16608, 28728, 12561, 6466, 12504, 13172, 9018, 12838, 32920, 12359, 12526, 17060, 8478, 9960, 28770, 28704,
+    16980, 16428, 10676, 12055, 11481, 11339, 13184, 12884, 32819, 10198, 11478, 12372, 13194, 28693, 28760, 12969,
+    28820, 28735, 11040, 5076, 32930, 13139, 12703, 16525, 28736, 9302, 8658, 16513, 13163, 10711, 12659, 20490,
+    16620, 16698, 28818, 28702, 28675, 28711, 12886, 28747, 28817, 28797, 8667, 8666, 11767, 6117, 16988, 9685,
+    12789, 28725, 10498, 28740, 16979, 12407, 12691, 12359, 13174, 32780, 28775, 13198, 32807, 12810, 12887, 32831,
+    16924, 12703, 13212, 12034, 16715, 32818, 9907, 16462, 17122, 16756, 28716, 13183, 16439, 13176, 13162, 13139,
+    28807, 11131, 28771, 8752, 28729, 28793, 6139, 16698, 12419, 8957, 12671, 8479, 16541, 9908, 11050, 12299,
+    9011, 13068, 28774, 28743, 11999, 17398, 28753, 12407, 28756, 12862, 12907, 13133, 9311, 28800, 16777, 12984,
+    12008, 12599, 28785, 32778, 32845, 13056, 16462, 12547, 5563, 8776, 12074, 28703, 28748, 9672, 10198, 13187,
+    9918, 28726, 28726, 28760, 10573, 5645, 12358, 28790, 12790, 16700, 12776, 16529, 17210, 28694, 16973, 28674,
+    28725, 12436, 11003, 32819, 32845, 12984, 32876, 12574, 16615, 9892, 10116, 28730, 17326, 10378, 8777, 10533,
+    10115, 28691, 12916, 17050, 12669, 10788, 11480, 11151, 9356, 13173, 13206, 9649, 12660, 12695, 12011, 28750,
+    12040, 8704, 12644, 16530, 13115, 13017, 13184, 12609, 28785, 13173, 12741, 12584, 12808, 12588, 9955, 10584,
+    32814, 10108, 9088, 11379, 13175, 10444, 32936, 6299, 12490, 28676, 9376, 20483, 32844, 12816, 28713, 16461,
+    12598, 12001, 10998, 20484, 6116, 12359, 4630, 10503, 10191, 32839, 6457, 16539, 12383, 10152, 28739, 16516,
+    5612, 12586, 28760, 12780, 28758, 11780, 12419, 12324, 11946, 11040, 12730, 13003, 32898, 11777, 28674, 13195,
+    28718, 32807, 28797, 12048, 32794, 11956, 32910, 13044, 32839, 13185, 28822, 11478, 16687, 5625, 8549, 32839,
+    28691, 10742, 28782, 12765, 5628, 28756, 17083, 12955, 13200, 4984, 10197, 8418, 16937, 12896, 16841, 16904,
+    12897, 28785, 28702, 17129, 16527, 28795, 11161, 8870, 8710, 28787, 10115, 12969, 12848, 9374, 12392, 12452,
+    8765, 13160, 12671, 12839, 10108, 28733, 12695, 9900, 5461, 13062, 9619, 8787, 20487, 12009, 28748, 28783,
+    12621, 28819, 28745, 10457, 28771, 12066, 28717, 16825, 12995, 12810, 28689, 9310, 16845, 10208, 28744, 13175,
+    28724, 28674, 13187, 9563, 9874, 28674, 11668, 28758, 28681, 28735, 17328, 20485, 13128, 28786, 5111, 9619,
+    12852, 32804, 28744, 10459, 12300, 17057, 16777, 28825, 12063, 13220, 9909, 5629, 8470, 13139, 11703, 28818,
+    16776, 5920, 8478, 12600, 28798, 28679, 28818, 28768, 16619, 32856, 17328, 17095, 9265, 16597, 11777, 12872,
+    8460, 12777, 12693, 8667, 12907, 12798, 13032, 17387, 16931, 5585, 13092, 10755, 28750, 28717, 10713, 16858,
+    11348, 28760, 32833, 12840, 28714, 28792, 16463, 12764, 28781, 12715, 12574, 16696, 12995, 12706, 12995, 12765,
+    10284, 28742, 8368, 28752, 28811, 16981, 9085, 12501, 13164, 32846, 28685, 13103, 16989, 28687, 17124, 8467,
+    17200, 12451, 13115, 10198, 11956, 28693, 11956, 10444, 32794, 13218, 16594, 12551, 12012, 11778, 12479, 11268,
+    6037, 28812, 12384, 9676, 28723, 13152, 16895, 12551, 12660, 32781, 32878, 10742, 32820, 13188, 11303, 12528,
+    16844, 10583, 28792, 28785, 10213, 11955, 12681, 17210, 28712, 16621, 28719, 13032, 8423, 17249, 20481, 16752,
+    16598, 12563, 9384, 9916, 12731, 32878, 12001, 28718, 12672, 13104, 32830, 32883, 12468, 12958, 28786, 13003,
+    13112, 9917, 28752, 13162, 28680, 9909, 32820, 28735, 12444, 20485, 12404, 11113, 28769, 12586, 28750, 8759,
+    28807, 12992, 28761, 11005, 17171, 10506, 28721, 28728, 6015, 16700, 5105, 9664, 13004, 28698, 12504, 12692,
+    28726, 28799, 16903, 16542, 17045, 32888, 16687, 28794, 13032, 12311, 12684, 32843, 12982, 16656, 13037, 28695,
+    12799, 13133, 12875, 10713, 28806, 28771, 11992, 28795, 16903, 12726, 12587, 10710, 28761, 12299, 28798, 28690,
+    16587, 10490, 12656, 17015, 13197, 13020, 32911, 9075, 12635, 5369, 12551, 8769, 28695, 28719, 12894, 12907,
+    12647, 12010, 9620, 10584, 12332, 12609, 10414, 11384, 11301, 13127, 28695, 12744, 11627, 17329, 16674, 10206,
+    28819, 28817, 28779, 28685, 28681, 12744, 28819, 28740, 20486, 12862, 12447, 13164, 12696, 9609, 32832, 12332,
+    12528, 6038, 10788, 28817, 17202, 9918, 9657, 8423, 17237, 12681, 12049, 12873, 16845, 17331, 12958, 28781,
+    12947, 9366, 12563, 28751, 16903, 11347, 10706, 28752, 28744, 17359, 28682, 28754, 13032, 9022, 28796, 28812,
+    8414, 28678, 28723, 9664, 11340, 28806, 6426, 16845, 12550, 13222, 9610, 17123, 28742, 8713, 13005, 10247,
+    8760, 11171, 28745, 5620, 12587, 12669, 17332, 16982, 12896, 28770, 9377, 12810, 9311, 11010, 12943, 16904,
+    28796, 8787, 12874, 28722, 12563, 12372, 28750, 9620, 12811, 12621, 28766, 28816, 28739, 16922, 28696, 11459,
+    32820, 13065, 11956, 8769, 32867, 12600, 12430, 16614, 10191, 32921, 28692, 12811, 12660, 12899, 28683, 32922,
+    12079, 13116, 9955, 28810, 10801, 13137, 28762, 5618, 28736, 12057, 13184, 28808, 12358, 12432, 17384, 32828,
+    12524, 12418, 16777, 13027, 10262, 12576, 28767, 9480, 12360, 12660, 6381, 28758, 9089, 12696, 12995, 28694,
+    10852, 28748, 32820, 12778, 13151, 11768, 28728, 20481, 32845, 12323, 28706, 8664, 12551, 12608, 12332, 28817,
+    12780, 11843, 16698, 13163, 10247, 11693, 13035, 12564, 20483, 28769, 28740, 16593, 11654, 16902, 9854, 6172,
+    12644, 11866, 8769, 13025, 32833, 12634, 12684, 16858, 28744, 12515, 32816, 28747, 28795, 16542, 28696, 17330,
+    4452, 32924, 8478, 28793, 9386, 16913, 20483, 32856, 12620, 17053, 28681, 11481, 12756, 16936, 12863, 28736,
+    13016, 12948, 9087, 28745, 28694, 9367, 16845, 28713, 32830, 28737, 13055, 12684, 17274, 28745, 12379, 28722,
+    9673, 28793, 8966, 12755, 12384, 12813, 32776, 12768, 5620, 11143, 12621, 32892, 28716, 12429, 12356, 10284,
+    11144, 16922, 9375, 12622, 28674, 9012, 32922, 12527, 9022, 12480, 28733, 16983, 11346, 12384, 10751, 28730,
+    12559, 12704, 8966, 12897, 28720, 5922, 28728, 12516, 6394, 9319, 12371, 28733, 12636, 13176, 32889, 17070,
+    16541, 8553, 5496, 32869, 13015, 16874, 32781, 10925, 12360, 12672, 12930, 9388, 12564, 28773, 12077, 6151,
+    11355, 13211, 12778, 12907, 28739, 28771, 28695, 16530, 12792, 16913, 12917, 28737, 6021, 12600, 12077, 16735,
+    16993, 12403, 9751, 32846, 13218, 11565, 28752, 28674, 12892, 12058, 10254, 5113, 28805, 12620, 32780, 10789,
+    9085, 10750, 10871, 12576, 13017, 5113, 32802, 13018, 28679, 16974, 12392, 12621, 28781, 32876, 32781, 10413,
+    12504, 12456, 12742, 12692, 9975, 16594, 9619, 12575, 10853, 12824, 28762, 8480, 12970, 12564, 13029, 17248,
+    28776, 28729, 9320, 28681, 17331, 28695, 10758, 13123, 32923, 20481, 12079, 10451, 5590, 12444, 12453, 12336,
+    28816, 10505, 16577, 8489, 5628, 12379, 13026, 28763, 8480, 32879, 17053, 16914, 10976, 28796, 16541, 8480,
+    16773, 13091, 16716, 9076, 13019, 10261, 13006, 32792, 12992, 28730, 28821, 17052, 13100, 32855, 17203, 28711,
+    16621, 11639, 28763, 28828, 12705, 12744, 8490, 8491, 9862, 10713, 12984, 28785, 13019, 9367, 13128, 9684,
+    9051, 9965, 9964, 9387, 28808, 12420, 28695, 12705, 17369, 5113, 12811, 12347, 28760, 16436, 9683, 32866,
+    13037, 28740, 12404, 10803, 12598, 12704, 12425, 12789, 12693, 12959, 13160, 28788, 16460, 28678, 8853, 16914,
+    9385, 9863, 28766, 9077, 32858, 12715, 11602, 16992, 32804, 13200, 17253, 28824, 32776, 12942, 5592, 13019,
+    13076, 28810, 28774, 10496, 28693, 16904, 12790, 13171, 11779, 6466, 28809, 12551, 9862, 20481, 16542, 28784,
+    13125, 12696, 12664, 10843, 11458, 12622, 11111, 28690, 12912, 28747, 28730, 9982, 28789, 28673, 28730, 12413,
+    13146, 28796, 32904, 5673, 28746, 28728, 12456, 11304, 28774, 16619, 28809, 13018, 16822, 28811, 8420, 32858,
+    5462, 13116, 13113, 6021, 13223, 12900, 28792, 32868, 13183, 13116, 17385, 16845, 28764, 12321, 28732, 10844,
+    11638, 13099, 12597, 16462, 16462, 9863, 16992, 9169, 10714, 28731, 28773, 17090, 17409, 12450, 28707, 12705,
+    12959, 17331, 12623, 12396, 28686, 9472, 12324, 12970, 32818, 28798, 28817, 28808, 9254, 11356, 13197, 28794,
+    12621, 9321, 28719, 28828, 11057, 12934, 12515, 12332, 17388, 12444, 8489, 5672, 12634, 9375, 13101, 12766,
+    28785, 10559, 12717, 12660, 16621, 32880, 12834, 13014, 32929, 12058, 28765, 28709, 13097, 17010, 16700, 28823,
+    28805, 12957, 17016, 16846, 11654, 28692, 12468, 10759, 5658, 10804, 32924, 28772, 12443, 17274, 13110, 16992,
+    5657, 12705, 12982, 16983, 32845, 10714, 32855, 10514, 10552, 8911, 28817, 13038, 9619, 12959, 8344, 17411,
+    10513, 6364, 9021, 28820, 28730, 12623, 6123, 28754, 12766, 11095, 32830, 5499, 32846, 10514, 12693, 32892,
+    32817, 32846, 12945, 8488, 28755, 12623, 10552, 12995, 13091, 32871, 8789, 12864, 12792, 11639, 12466, 32931,
+    16913, 16607, 28762, 12812, 12896, 28743, 28777, 28765, 28820, 28810, 32868, 12968, 12931, 32845, 10759, 28766,
+    13175, 13016, 17071, 16461, 12588, 16992, 12335, 8789, 8488, 17131, 28777, 6050, 12552, 28774, 12671, 28771,
+    10882, 8397, 28705, 8768, 13019, 28795, 17368, 17377, 12887, 32894, 9975, 12408, 9974, 12851, 11356, 16687,
+    12792, 12683, 32855, 28738, 16619, 28775, 12466, 32855, 32854, 10514, 32858, 6433, 13055, 6050, 13223, 17004,
+    12814, 12334, 12393, 10796, 9385, 9358, 9655, 32778, 28754, 32872, 28744, 28680, 28730, 28761, 17070, 28696,
+    13100, 28827, 11088, 32931, 12620, 10880, 12429, 12839, 28806, 20485, 8405, 28681, 13099, 32856, 16596, 32882,
+    12634, 9375, 28723, 12455, 5628, 12780, 12430, 11058, 11149, 9686, 17378, 17369, 12396, 8637, 8480, 32801,
+    28772, 32781, 12321, 10759, 28724, 6402, 17411, 17010, 12972, 32781, 16779, 17159, 6438, 28776, 9089, 9985,
+    10461, 28796, 12718, 28777, 32905, 6440, 28818, 9066, 17158, 12702, 16856, 28710, 28683, 28693, 17132, 11356,
+    11349, 13131, 12908, 28702, 12468, 12744, 12552, 28807, 28772, 12406, 12075, 32883, 12840, 12966, 28798, 12732,
+    28757, 11348, 8480, 17247, 17386, 10214, 12330, 10264, 9059, 9376, 32815, 10461, 5540, 32819, 17072, 16536,
+    12754, 28719, 28797, 11103, 28673, 28784, 28708, 28688, 28803, 28770, 28708, 10406, 17327, 32868, 12476, 16925,
+    32905, 32832, 9917, 17378, 12885, 12958, 28696, 12028, 12298, 17151, 12716, 13049, 16462, 32867, 32856, 17297,
+    32858, 12310, 20487, 11909, 32855, 6050, 16858, 11177, 6217, 12719, 32792, 12416, 9917, 12933, 9975, 17002,
+    17398, 13004, 13111, 28734, 28777, 8719, 10546, 11778, 9388, 11654, 12756, 28780, 13027, 12623, 10814, 12600,
+    17386, 8491, 28697, 32854, 12931, 9087, 16925, 11103, 12694, 13027, 28765, 12490, 8479, 13114, 9674, 12970,
+    12996, 13012, 12490, 17061, 28752, 32837, 10797, 32931, 12756, 32817, 28762, 12623, 28730, 16526, 12336, 13038,
+    12588, 12969, 12540, 28776, 11860, 13114, 32845, 12672, 28799, 17158, 28819, 32846, 9674, 13128, 32816, 12430,
+    28706, 10199, 16684, 11403, 13138, 32931, 28820, 28696, 28762, 28793, 8790, 12887, 12335, 12467, 16541, 10860,
+    12438, 11467, 28764, 32806, 32911, 12813, 12789, 11478, 17003, 12621, 9057, 10796, 11059, 12732, 28739, 17053,
+    32858, 20486, 13020, 16762, 28796, 13126, 16857, 10461, 32884, 28715, 28757, 12943, 8778, 12576, 28788, 32869,
+    12840, 28777, 8779, 12716, 28724, 5629, 32932, 12393, 17161, 17001, 28714, 11357, 6361, 28727, 13224, 16924,
+    28775, 16856, 17236, 12443, 8479, 12384, 11402, 12840, 9909, 8306, 6051, 12791, 28742, 9686, 28825, 9985,
+    28728, 12943, 12852, 16982, 5663, 12502, 32937, 12455, 12547, 13116, 28783, 13074, 11448, 12521, 16538, 28817,
+    28772, 10816, 32775, 28776, 32781, 32869, 16435, 28735, 32859, 10284, 10797, 11059, 12671, 13146, 9620, 28708,
+    11394, 17062, 28769, 16664, 12840, 10759, 32826, 32858, 9598, 32919, 12463, 12522, 9068, 16879, 28684, 10814,
+    28787, 28703, 28726, 12825, 12384, 28679, 17229, 12372, 8368, 6356, 12945, 12972, 12576, 12320, 28704, 5673,
+    10813, 32906, 28818, 12464, 17295, 32881, 17397, 10208, 28737, 11402, 16808, 16656, 28760, 16991, 8723, 28725,
+    28691, 12933, 28679, 9386, 9686, 12982, 10569, 17395, 11105, 11402, 12500, 12344, 32857, 28778, 11411, 28819,
+    28823, 8789, 8576, 12934, 11394, 17396, 28767, 12392, 13089, 10282, 28765, 28695, 8775, 12839, 12732, 17004,
+    28827, 12922, 12624, 6357, 12814, 12754, 28759, 12440, 16515, 12870, 5628, 17397, 28719, 13100, 10751, 10271,
+    12780, 6393, 32932, 28802, 12309, 17001, 32894, 32793, 11691, 12885, 32872, 12418, 28769, 28773, 28817, 12993,
+    8694, 13158, 12078, 12437, 8384, 10553, 32857, 11895, 16587, 13102, 10255, 17013, 16857, 11402, 13064, 10553,
+    8338, 12996, 12564, 5265, 11112, 16935, 11465, 10814, 28748, 28800, 12706, 10162, 13127, 28697, 12732, 16935,
+    28760, 28789, 13147, 6188, 10760, 12718, 12815, 28739, 10515, 12933, 28817, 12910, 17004, 32846, 12933, 12921,
+    10852, 12923, 17230, 17141, 12402, 20485, 28773, 5666, 28694, 10506, 13222, 12923, 11149, 5674, 12944, 12802,
+    28684, 28795, 6393, 11182, 10759, 16933, 28783, 32881, 13113, 28731, 12416, 12499, 10460, 16754, 16937, 28755,
+    13074, 13063, 6180, 12993, 12934, 12718, 12479, 28802, 8489, 10281, 12527, 17281, 11151, 28697, 32778, 10580,
+    32905, 13115, 32826, 32934, 12344, 12923, 11167, 20482, 32931, 10861, 10805, 32895, 13016, 32893, 16934, 28733,
+    17397, 12540, 8649, 12600, 9676, 16517, 12812, 12785, 9057, 28758, 12744, 28677, 13032, 32908, 32881, 11177,
+    12696, 20484, 32894, 16935, 17149, 13126, 17282, 12958, 28711, 16933, 8723, 16934, 11403, 6444, 32846, 32932,
+    10878, 13074, 28721, 13159, 28751, 11151, 12778, 9676, 17411, 10625, 12371, 28789, 12815, 28743, 16912, 28776,
+    11711, 11357, 32815, 9919, 13063, 16858, 28690, 12824, 9956, 12944, 13222, 8790, 11105, 12983, 28712, 12682,
+    9686, 8758, 28751, 11976, 13063, 11059, 13171, 13127, 12827, 9247, 32868, 11449, 9387, 11900, 17399, 13064,
+    11159, 28786, 16934, 28688, 32853, 12946, 12742, 12935, 13007, 28750, 32870, 12930, 12392, 28736, 6401, 32780,
+    17378, 8491, 10498, 6393, 9300, 12369, 9254, 12684, 12823, 28788, 11709, 13198, 32937, 12813, 28773, 28770,
+    32933, 12814, 20486, 32858, 28712, 28818, 28702, 12708, 12525, 32932, 12921, 13028, 12652, 13194, 32820, 10870,
+    12803, 9130, 10199, 10806, 32776, 28683, 16438, 6188, 12971, 12635, 12467, 12600, 11775, 32845, 6058, 28703,
+    28720, 28701, 20486, 17080, 28818, 9685, 17348, 28770, 6357, 10561, 12402, 9367, 12321, 12934, 28767, 9655,
+    13103, 12359, 12311, 12945, 16993, 12899, 11114, 13112, 12645, 13075, 12815, 28686, 32937, 13102, 28702, 28767,
+    28789, 10853, 9684, 12432, 13020, 32906, 17228, 28748, 20488, 12864, 12431, 13155, 28755, 16621, 12864, 16676,
+    28771, 12707, 10869, 12944, 28755, 12587, 12634, 11404, 13028, 28751, 12344, 12756, 12869, 28788, 12009, 16525,
+    28774, 12432, 6058, 13063, 20485, 12996, 20488, 17002, 12945, 28818, 28827, 28731, 28686, 13051, 28789, 12888,
+    13053, 28743, 8788, 17014, 32817, 9311, 28722, 17072, 28820, 32937, 10516, 28703, 12737, 13054, 12594, 28776,
+    17161, 16778, 8491, 10506, 12882, 9012, 16535, 13158, 10507, 12944, 12418, 12452, 12792, 28802, 28781, 12792,
+    17237, 13031, 17004, 5666, 10506, 10580, 17150, 13064, 12408, 13124, 28809, 10860, 28805, 11656, 10348, 12852,
+    28799, 10050, 13149, 20488, 28809, 10869, 12348, 28793, 16440, 28801, 11766, 13031, 17159, 10797, 13078, 11171,
+    13104, 32777, 32871, 13150, 13043, 12660, 28795, 28696, 12419, 28747, 17014, 8451, 28810, 28798, 28680, 16448,
+    10870, 32793, 32907, 20485, 28758, 6357, 16456, 28781, 32840, 6234, 8489, 28759, 16605, 17307, 32907, 12667,
+    32897, 11160, 13066, 32806, 16404, 28828, 12478, 28751, 13209, 12984, 17397, 12971, 28695, 20481, 8312, 28805,
+    28683, 6059, 13052, 17220, 6362, 32805, 13195, 13115, 10815, 28737, 8489, 11747, 6398, 10853, 28825, 12690,
+    12503, 12298, 28726, 12610, 32917, 16449, 28751, 28689, 13103, 28828, 17013, 16440, 12888, 28785, 12840, 28723,
+    12756, 28715, 28696, 17091, 9211, 12419, 12888, 10516, 28809, 17289, 16935, 28790, 32872, 12371, 10145, 28729,
+    11701, 12947, 6454, 16775, 9675, 17081, 10217, 11105, 17161, 28734, 9502, 28760, 12513, 17230, 12900, 17014,
+    9386, 5317, 16509, 28681, 13043, 20486, 12870, 10572, 5629, 10861, 13076, 28678, 28730, 28788, 32896, 28711,
+    13159, 28820, 11978, 32898, 12900, 12888, 13074, 13090, 13116, 9817, 32807, 13158, 28827, 12935, 13140, 12741,
+    16937, 12840, 13065, 12792, 12648, 28685, 28779, 17306, 11113, 28734, 8617, 28806, 28728, 28744, 12555, 32792,
+    13147, 12576, 13136, 13169, 32935, 28816, 16830, 17003, 13148, 10049, 13042, 12478, 12694, 9985, 13168, 11702,
+    16936, 13075, 13140, 9386, 13169, 28697, 10816, 16657, 12368, 10208, 28730, 13101, 13067, 12503, 32830, 13026,
+    28689, 9264, 28706, 12372, 12033, 16597, 28739, 13042, 12660, 13113, 6234, 12779, 28758, 9973, 12562, 28732,
+    13169, 9089, 28696, 28795, 32934, 32840, 13029, 10544, 16427, 32872, 17083, 6233, 13016, 6226, 28675, 11764,
+    28793, 28744, 12804, 28679, 12801, 12912, 12934, 12592, 12640, 11168, 17016, 12358, 32910, 28678, 28809, 28677,
+    16586, 16483, 13053, 28743, 8876, 17093, 28786, 13053, 13041, 16438, 28812, 11476, 9017, 17082, 17308, 13182,
+    28723, 12972, 32807, 17094, 28812, 12816, 12547, 9009, 16508, 28759, 17169, 16460, 12443, 11906, 11939, 13075,
+    12558, 28751, 12355, 11403, 13044, 6225, 28819, 13042, 12528, 11412, 28772, 11395, 12679, 13054, 17238, 32807,
+    32828, 32805, 28714, 17238, 28790, 32859, 28774, 12839, 12921, 32897, 6447, 11297, 28736, 12464, 12668, 28807,
+    28686, 13043, 28777, 12689, 6447, 17092, 12489, 11412, 13116, 28807, 8402, 6225, 10814, 28722, 10579, 28736,
+    12768, 12983, 12540, 28751, 12923, 8555, 28706, 13151, 8789, 13041, 11404, 16576, 28770, 17092, 10394, 12331,
+    12917, 28788, 16562, 12429, 17317, 6455, 12346, 9215, 17162, 28688, 32917, 32804, 12924, 12687, 12656, 20486,
+    28690, 28736, 13159, 28725, 11611, 28733, 28742, 11004, 12732, 9388, 16413, 12343, 12848, 32790, 10517, 12394,
+    12924, 28677, 12846, 10871, 12378, 12922, 12923, 12708, 8314, 6364, 12299, 9986, 28760, 11459, 12573, 28744,
+    12664, 12358, 13140, 10283, 32777, 16993, 28675, 10669, 28760, 12848, 16728, 16604, 12039, 12516, 13066, 28735,
+    28813, 17014, 8554, 12396, 13050, 12536, 28688, 28807, 6447, 28729, 28760, 17016, 9941, 12936, 13113, 28686,
+    8910, 32897, 28733, 17083, 32790, 12947, 12934, 10400, 12345, 11657, 9956, 13077, 12864, 10283, 28755, 20487,
+    32829, 10342, 32842, 13041, 28705, 11169, 8319, 28808, 28764, 28727, 28732, 12369, 8912, 12594, 5478, 28809,
+    32833, 28674, 16620, 11459, 12395, 12298, 4955, 12994, 16753, 8394, 12416, 12531, 28812, 28675, 12792, 28811,
+    12804, 17161, 16490, 11169, 9002, 28794, 12359, 28779, 12681, 12514, 9246, 11181, 16598, 17239, 32906, 20490,
+    11991, 32908, 32918, 17172, 12475, 28782, 12632, 32791, 11711, 28810, 32872, 28685, 32859, 12840, 32789, 12417,
+    32906, 12323, 12840, 12623, 28686, 12532, 12442, 28783, 16518, 12864, 10190, 28766, 11460, 13171, 17238, 9364,
+    28805, 32818, 10571, 10816, 28709, 12395, 28745, 11403, 6226, 5490, 12695, 12370, 12720, 10218, 12456, 12358,
+    9387, 32792, 12768, 17016, 12672, 12683, 17012, 12611, 12558, 16736, 28679, 12804, 11477, 13116, 11161, 28727,
+    28744, 12888, 8876, 6464, 13182, 11984, 12586, 13076, 12299, 9265, 12972, 28695, 12476, 11171, 13182, 28819,
+    13138, 10947, 12678, 12996, 16736, 20484, 16588, 9311, 28741, 17309, 12369, 12298, 9319, 28811, 17061, 17171,
+    17014, 32909, 28817, 13008, 17171, 32898, 6456, 32829, 11757, 12641, 10879, 12948, 28756, 16756, 12780, 12560,
+    10283, 28752, 28735, 28796, 28750, 12420, 12978, 32921, 12333, 12657, 28810, 13043, 28716, 28769, 17299, 17092,
+    32846, 32779, 12840, 32935, 12641, 32910, 12996, 6464, 11179, 28688, 32898, 13077, 13043, 12322, 12804, 28769,
+    17092, 12466, 13115, 8307, 16588, 17319, 16822, 13077, 8490, 32898, 13030, 32806, 8446, 11946, 12744, 10563,
+    32937, 12539, 13031, 28767, 12588, 16667, 8313, 9655, 11181, 9241, 12617, 32898, 11703, 28722, 28827, 28737,
+    32839, 9879, 32807, 12474, 28784, 16588, 16491, 28743, 16665, 12306, 28673, 12948, 28708, 28821, 12744, 12598,
+    28733, 32779, 32804, 28800, 13008, 28711, 16538, 28762, 11179, 12307, 16840, 28761, 4954, 28741, 12756, 12812,
+    12347, 20486, 16831, 8453, 28791, 10138, 12557, 13103, 20487, 11481, 28814, 28685, 12040, 13076, 28705, 28713,
+    11469, 12467, 12528, 28799, 32885, 28726, 12959, 13115, 16618, 28697, 28681, 28784, 8599, 9941, 16934, 12990,
+    11939, 16597, 16753, 32919, 6188, 12635, 28717, 17252, 12668, 12631, 10072, 6402, 16779, 17174, 32872, 28760,
+    12600, 28785, 12358, 12835, 8664, 8395, 6465, 6189, 8344, 8397, 13031, 28768, 32818, 6410, 32893, 11944,
+    11451, 28686, 8790, 6235, 17309, 8703, 12333, 16816, 28752, 4629, 12381, 12924, 12333, 16596, 32844, 10584,
+    11909, 28705, 8655, 16841, 12371, 9816, 17308, 12551, 17368, 12347, 28820, 12323, 13077, 28774, 10178, 12368,
+    28709, 28801, 10573, 16729, 12893, 9538, 28745, 10880, 9263, 13162, 12922, 6464, 17251, 8955, 17307, 12705,
+    10862, 10274, 12311, 8964, 12596, 28745, 9940, 12334, 28716, 12455, 11702, 9891, 8467, 13076, 28799, 20484,
+    17151, 10647, 12515, 6226, 12924, 11778, 16676, 28822, 12912, 28780, 12354, 8390, 12693, 16814, 12768, 12800,
+    28821, 12906, 32872, 8582, 12564, 16518, 5042, 20486, 12730, 13102, 9377, 28709, 16807, 12720, 28789, 16843,
+    12533, 8613, 32857, 16440, 13104, 28742, 12948, 12996, 32920, 12538, 13100, 28676, 13138, 12512, 16686, 13078,
+    28821, 28737, 32815, 9286, 12334, 11479, 28719, 13055, 32918, 12833, 6465, 16579, 17298, 32841, 9003, 12394,
+    16507, 11171, 28807, 12558, 28724, 28742, 12775, 17317, 10806, 28705, 16816, 32775, 8413, 28791, 16699, 32872,
+    28700, 28813, 10880, 12396, 11596, 32779, 12766, 28718, 12008, 16698, 12441, 28809, 13102, 9547, 32918, 16676,
+    16597, 12583, 32817, 28723, 10158, 10872, 13128, 13196, 12617, 12656, 20488, 12636, 28768, 28753, 12335, 28696,
+    11161, 17117, 12366, 17299, 12665, 16459, 12741, 12836, 28726, 12864, 9219, 13163, 13205, 8490, 12575, 32884,
+    32846, 9862, 28729, 16665, 10583, 28762, 28817, 16834, 12347, 12001, 28820, 28806, 9263, 8658, 28737, 28803,
+    28796, 28800, 28716, 17353, 12395, 11561, 28700, 28749, 28682, 10370, 12864, 11522, 28700, 12729, 11468, 28781,
+    28723, 28694, 12296, 28693, 9897, 12836, 28774, 10946, 12643, 12511, 12984, 13103, 10050, 17239, 11096, 11954,
+    28756, 13140, 12956, 11470, 5064, 16456, 32852, 10100, 12000, 16858, 12910, 12984, 13218, 28717, 32807, 11954,
+    11160, 17116, 9686, 16405, 32817, 16461, 12605, 28690, 11478, 10941, 9592, 12748, 12418, 13148, 28757, 28758,
+    12323, 28722, 12575, 13196, 16824, 11469, 8775, 12898, 9510, 12840, 12561, 16841, 16825, 17229, 16484, 9539,
+    12009, 28727, 28675, 9292, 6456, 11999, 28746, 8689, 28815, 28745, 13044, 12600, 20484, 12852, 10072, 13065,
+    28750, 28709, 8789, 13183, 11910, 5356, 28735, 12666, 10254, 9909, 16607, 12657, 12596, 4976, 11776, 12462,
+    8344, 32793, 16825, 32907, 13162, 11909, 28709, 6457, 8621, 10647, 28784, 12679, 32852, 32841, 13162, 16518,
+    10285, 12560, 12467, 6457, 28688, 16855, 16695, 9509, 12475, 13076, 28717, 12564, 8702, 8994, 17250, 28761,
+    28733, 12894, 8711, 28812, 28768, 12786, 12347, 28763, 12660, 4636, 28727, 32919, 8883, 12538, 10872, 12428,
+    17298, 13174, 12041, 16643, 11180, 12606, 12588, 12631, 13184, 9089, 5025, 28771, 28746, 12573, 28737, 28674,
+    12780, 10431, 12504, 28710, 32923, 28805, 10436, 12743, 32920, 12732, 28681, 28706, 16579, 28742, 9564, 28712,
+    32919, 9218, 16673, 12848, 16767, 12012, 28747, 16693, 16440, 28686, 12383, 13174, 20481, 28817, 28743, 9066,
+    28708, 6448, 10882, 12347, 28820, 13018, 28792, 12550, 28780, 12549, 13174, 12632, 28716, 11573, 12383, 28820,
+    12744, 12359, 12359, 9388, 28738, 28680, 12575, 12670, 32924, 12467, 11262, 12393, 13139, 9517, 10668, 12324,
+    10488, 17253, 11955, 28737, 10371, 12767, 28737, 12742, 13164, 5645, 12619, 10406, 12764, 13138, 11171, 9219,
+    9263, 28737, 11468, 32781, 28746, 17376, 28732, 8366, 17016, 12856, 16886, 28741, 12309, 28754, 28715, 32830,
+    9666, 28693, 9838, 12546, 12655, 9365, 9255, 10776, 32820, 16563, 32843, 12657, 12576, 28692, 16517, 12357,
+    28709, 12489, 12991, 28732, 28747, 28773, 28734, 11954, 13104, 11758, 13207, 12702, 12887, 13186, 12312, 13184,
+    11780, 20484, 12768, 12671, 13068, 6456, 10815, 9609, 32852, 13128, 12497, 12335, 16767, 16924, 10138, 12681,
+    12684, 12010, 28808, 13092, 16530, 11954, 12573, 12787, 12692, 13076, 28748, 13162, 16886, 16845, 10947, 10371,
+    16439, 17329, 11539, 8712, 28680, 8779, 12573, 12439, 12679, 12634, 28681, 16833, 13164, 12585, 16537, 28746,
+    10138, 12562, 32906, 32818, 32806, 28727, 6410, 12607, 28746, 12607, 12668, 11768, 20485, 13138, 28750, 28749,
+    11780, 16892, 10648, 12835, 8790, 16677, 11955, 12669, 12599, 12982, 28744, 11545, 32832, 16833, 32843, 13104,
+    6457, 28761, 13008, 11758, 12740, 8404, 16412, 12681, 28770, 17220, 10400, 16779, 12607, 9553, 9780, 16541,
+    32828, 28758, 8957, 20484, 28717, 32818, 32845, 9555, 12074, 28738, 8368, 12801, 8704, 13102, 28819, 12488,
+    28743, 16892, 28820, 11778, 10399, 32920, 17317, 28780, 17249, 16449, 28746, 10378, 12837, 13013, 17174, 12452,
+    9564, 28761, 12972, 20489, 28694, 11779, 13137, 28742, 12789, 10581, 12312, 17253, 12608, 16410, 9780, 16451,
+    12310, 5093, 12539, 9657, 12801, 16607, 32919, 20481, 13163, 32794, 12048, 32853, 16894, 9320, 32831, 28817,
+    12416, 12371, 13173, 28699, 13040, 12669, 12009, 12381, 12789, 16529, 13026, 17250, 17044, 16440, 32806, 32845,
+    11328, 12813, 28728, 12479, 28709, 28799, 28822, 16893, 32775, 11478, 17374, 12863, 28734, 12010, 28726, 12815,
+    5993, 28783, 12846, 28697, 13044, 12776, 16677, 12299, 17059, 13020, 9676, 9552, 12979, 32870, 32859, 17253,
+    12391, 12048, 28683, 16507, 12297, 9562, 12563, 12860, 8963, 28735, 12730, 28725, 12742, 12549, 12585, 9517,
+    20481, 9559, 11955, 16846, 11750, 13187, 28706, 32894, 28819, 8721, 16893, 28808, 12598, 28730, 8759, 28824,
+    12911, 9219, 32794, 10741, 13140, 6465, 28757, 32819, 12970, 9853, 28819, 12048, 12742, 32870, 28748, 12513,
+    32905, 12596, 16935, 28781, 28720, 8667, 28729, 32868, 16530, 32788, 12056, 12395, 9019, 12752, 12691, 28692,
+    28683, 16901, 6457, 5076, 28774, 13217, 20484, 28772, 8397, 32911, 16541, 9809, 9817, 28728, 9376, 13185,
+    5433, 16754, 12359, 28686, 32911, 6456, 9022, 28792, 16766, 32806, 13175, 32829, 11333, 13209, 9019, 12994,
+    16609, 32780, 28773, 28795, 16982, 12911, 12442, 4722, 12778, 12312, 12987, 32831, 28703, 32806, 28683, 20485,
+    13104, 13209, 12324, 12885, 16774, 28781, 17318, 12312, 12908, 28741, 12860, 32819, 11769, 11955, 8751, 17190,
+    28701, 8658, 12899, 13030, 28718, 28763, 16696, 12442, 13068, 12743, 32853, 28811, 9265, 12551, 5361, 12911,
+    16776, 17360, 28712, 32794, 12787, 12919, 9837, 11080, 28812, 9608, 4722, 12360, 32791, 32843, 12407, 9321,
+    13018, 12669, 32844, 12587, 16539, 12504, 11712, 28738, 17151, 28717, 28769, 12335, 12010, 10477, 28717, 9318,
+    12468, 12414, 9649, 12767, 12584, 12048, 11768, 9011, 20490, 12312, 16755, 10279, 12753, 28701, 8359, 28734,
+    28746, 10969, 28710, 32831, 28715, 9068, 16919, 12787, 16519, 16529, 11005, 12886, 28810, 32864, 13044, 9961,
+    9554, 28730, 16687, 16774, 28745, 12836, 16462, 28678, 9983, 12804, 28827, 32883, 16855, 28820, 8491, 12871,
+    9649, 10108, 16539, 9892, 13173, 12336, 12619, 12730, 28736, 16542, 13014, 12778, 16697, 28748, 12010, 8695,
+    13175, 17384, 12588, 28702, 28677, 32842, 12816, 12049, 9675, 9262, 12001, 9064, 12078, 8745, 28739, 32831,
+    12646, 13184, 17092, 16539, 12049, 9601, 12076, 12360, 16776, 32863, 12453, 12634, 28712, 9011, 4983, 12010,
+    16539, 11947, 28804, 28730, 13140, 16765, 13044, 12702, 9374, 12076, 12971, 13139, 11556, 13197, 9909, 13152,
+    6009, 5579, 12527, 4728, 12792, 10283, 12886, 32884, 12539, 28703, 12075, 5070, 16540, 28784, 10246, 12885,
+    12408, 12658, 5433, 13174, 12692, 32781, 16530, 12525, 12885, 28693, 12720, 13209, 12068, 8272, 12619, 12467,
+    28688, 12870, 12612, 10442, 13188, 6189, 9310, 20481, 11302, 12585, 17332, 28750, 13185, 16462, 28821, 9618,
+    12799, 13199, 12647, 16937, 8413, 12419, 20485, 9089, 12431, 13066, 16857, 32793, 28772, 17319, 12779, 28789,
+    16911, 28794, 12976, 32781, 17375, 11985, 13164, 16509, 11993, 13210, 16910, 12715, 9916, 28775, 12560, 32794,
+    28694, 28797, 28705, 5563, 16463, 12860, 16825, 28686, 32780, 12480, 28786, 8272, 12573, 28707, 12600, 20482,
+    28702, 13188, 11340, 12562, 10272, 12970, 12526, 9555, 28718, 28812, 17253, 8460, 12799, 12967, 12466, 28695,
+    17049, 13092, 10151, 12850, 12346, 28759, 13218, 9357, 9384, 12860, 16451, 28792, 32878, 32880, 12742, 10415,
+    28749, 16755, 16801, 9003, 16904, 12360, 20481, 12924, 13209, 8721, 9452, 12659, 9280, 12670, 28730, 9854,
+    28821, 12586, 12550, 28784, 9861, 12001, 8658, 16620, 28790, 12359, 12324, 9518, 12582, 11311, 12430, 17252,
+    10217, 8875, 12861, 12514, 17209, 28689, 10676, 12808, 13127, 9011, 12575, 12729, 12800, 5076, 12659, 16688,
+    12490, 13185, 28815, 12011, 28728, 28760, 9321, 16929, 12594, 16458, 16500, 12598, 16990, 16914, 12991, 16855,
+    9862, 16856, 11703, 17386, 12066, 9771, 28711, 16540, 12478, 10217, 12633, 12645, 10273, 11333, 12336, 28784,
+    11004, 11955, 8411, 10115, 12010, 11480, 17124, 32833, 28760, 13014, 20488, 32820, 16766, 9918, 8384, 16621,
+    12906, 11777, 8440, 12631, 8721, 12300, 16988, 17194, 28730, 28728, 28817, 12562, 9451, 12972, 17399, 32781,
+    13150, 17230, 28818, 9863, 28705, 12657, 17329, 17409, 16776, 17147, 9618, 11357, 16912, 9337, 28715, 12587,
+    32857, 13196, 16619, 12779, 11012, 9972, 12903, 12384, 12906, 28763, 16618, 10145, 32807, 17060, 28757, 12876,
+    12753, 12636, 12322, 11086, 20485, 12549, 28733, 17083, 12572, 12958, 17094, 12731, 16500, 12049, 28726, 12790,
+    28782, 12991, 11759, 32865, 28726, 28681, 28821, 32820, 9217, 16778, 28743, 12954, 11380, 12943, 28758, 16921,
+    10378, 28786, 12658, 9684, 13198, 12825, 12765, 6014, 12849, 32891, 20485, 16989, 12915, 9374, 28792, 13220,
+    12980, 12067, 8847, 16901, 5104, 17332, 13107, 12575, 28783, 17044, 10743, 28814, 16843, 12067, 8759, 12540,
+    10747, 9555, 6411, 28679, 12646, 17123, 28731, 9656, 6427, 12694, 8848, 12360, 12526, 12057, 12467, 16440,
+    9809, 11296, 12754, 10160, 12574, 16621, 12972, 28797, 9377, 16620, 13221, 28744, 32846, 12887, 9264, 28746,
+    28807, 20486, 12564, 12715, 28795, 32854, 12906, 9619, 17078, 12408, 8424, 12585, 10459, 12492, 8665, 32883,
+    16835, 16460, 12967, 28699, 9253, 9078, 12562, 12648, 12872, 12058, 13113, 12778, 16519, 13080, 32876, 28826,
+    28675, 12599, 12057, 12381, 12336, 12958, 11275, 32921, 28763, 28748, 10285, 16463, 12983, 16698, 12479, 28755,
+    13006, 28688, 32845, 16621, 32878, 32924, 28694, 12587, 32933, 28745, 13221, 16742, 13005, 12872, 12875, 9349,
+    11041, 16895, 17377, 9319, 12348, 28763, 9948, 9986, 11673, 13173, 12991, 32856, 28791, 28808, 10459, 28774,
+    16699, 12563, 28766, 12764, 12588, 17377, 5585, 28750, 28811, 20490, 20484, 12468, 17004, 16683, 12608, 13029,
+    13152, 28719, 12478, 17147, 9219, 17385, 17376, 10748, 12537, 10793, 32934, 12715, 17162, 12011, 10285, 17395,
+    12348, 9919, 11339, 16727, 12730, 20487, 17159, 28676, 9729, 20481, 16776, 12811, 9011, 28775, 13016, 12682,
+    16767, 28772, 10191, 12480, 32804, 28812, 13222, 10458, 32781, 11481, 17396, 9657, 8723, 10494, 28677, 17045,
+    17238, 12799, 28741, 28708, 13006, 17202, 9945, 28725, 28787, 11838, 28774, 32924, 16857, 28745, 28785, 28739,
+    12612, 28797, 8777, 28707, 28753, 28758, 28694, 11049, 12991, 16698, 9674, 13223, 12822, 32819, 28741, 9058,
+    12634, 28702, 12862, 32924, 28680, 12850, 28680, 10160, 32857, 8469, 32781, 17368, 10883, 28719, 16974, 5650,
+    12408, 12585, 5672, 28819, 12432, 12840, 13210, 12428, 9076, 11087, 12491, 11603, 12716, 17377, 28782, 28682,
+    32791, 12378, 12396, 28763, 16835, 12753, 12636, 9467, 12765, 9319, 28745, 12864, 12454, 12623, 10283, 9601,
+    12871, 28800, 17078, 9146, 28827, 9579, 13212, 12384, 28746, 9555, 8413, 28779, 8768, 5993, 9909, 13006,
+    12659, 12587, 16990, 12550, 12744, 28697, 10414, 10458, 13005, 10505, 28724, 32923, 12708, 28827, 32869, 9685,
+    10206, 32790, 16688, 17217, 20481, 17203, 32844, 13212, 32802, 12077, 16777, 28771, 12982, 11181, 12888, 28692,
+    9649, 12957, 9367, 28740, 8461, 12827, 10160, 28776, 12742, 12646, 28717, 12744, 12474, 16845, 10881, 17009,
+    28796, 12715, 12575, 12682, 17131, 32819, 6145, 17059, 8277, 12547, 11673, 10796, 13067, 13187, 12994, 10285,
+    32879, 16904, 16777, 12851, 12405, 28769, 16642, 11759, 28791, 12970, 13007, 8995, 8272, 12057, 12980, 28691,
+    8760, 28721, 28753, 12943, 12598, 13159, 8414, 12777, 5656, 12792, 17139, 11639, 16857, 12801, 28734, 12540,
+    5106, 12694, 32878, 28797, 16914, 12384, 5922, 28797, 16451, 9918, 12539, 28806, 11633, 10796, 28711, 12788,
+    8423, 16912, 28684, 28717, 13019, 28783, 9601, 17190, 13044, 6315, 10452, 17398, 32845, 11311, 9918, 17388,
+    13044, 13221, 9468, 12408, 28685, 32846, 28821, 28806, 16508, 9564, 13220, 28754, 8478, 6049, 12610, 12862,
+    9497, 12420, 12058, 9963, 9022, 5620, 12887, 28794, 6174, 28775, 28772, 12981, 28825, 16606, 28706, 28693,
+    28740, 12491, 32804, 10206, 17378, 16697, 12647, 11340, 16772, 16999, 16914, 17070, 32857, 12066, 28818, 28698,
+    13128, 16922, 32792, 12743, 28787, 28742, 28818, 28754, 13088, 12646, 12916, 12850, 11380, 13143, 12863, 12066,
+    28784, 11012, 9365, 13006, 11889, 28802, 10804, 32846, 13007, 5628, 12720, 10415, 28745, 12332, 17330, 12622,
+    28716, 28799, 28784, 5814, 5666, 32781, 12887, 28788, 12983, 11012, 32831, 28734, 28745, 12586, 16462, 10758,
+    12959, 8424, 17060, 28750, 12899, 32838, 9068, 28731, 13112, 12420, 11355, 16756, 13080, 28752, 16895, 16595,
+    5657, 32858, 17237, 28706, 28773, 28782, 12659, 32818, 28675, 12078, 32833, 5619, 32880, 32905, 11111, 28683,
+    28824, 28720, 11404, 16594, 12356, 28824, 12704, 16542, 16621, 28745, 13108, 12813, 11311, 12824, 12539, 28751,
+    13200, 13088, 32898, 10206, 28713, 8852, 10794, 32880, 12078, 28785, 9022, 9675, 12774, 28778, 12813, 12621,
+    28824, 12864, 17411, 28740, 9087, 28805, 13063, 16764, 16991, 12696, 11049, 17387, 28776, 12945, 32930, 12634,
+    13211, 11600, 9088, 12910, 13223, 28683, 12563, 11348, 9975, 16857, 32881, 17220, 28762, 12981, 12824, 28788,
+    28752, 11304, 17202, 32881, 12683, 11341, 12800, 13220, 8777, 10572, 16923, 28749, 16983, 12384, 20482, 28777,
+    6293, 8478, 11355, 12814, 13017, 17210, 12813, 32930, 10843, 11112, 11595, 12778, 12706, 20486, 17132, 20484,
+    13007, 28773, 13138, 28741, 9375, 28788, 10505, 9900, 11095, 32892, 12598, 9386, 11459, 28813, 10568, 13026,
+    16923, 28749, 12621, 10504, 28770, 11386, 10504, 12706, 8768, 28740, 13135, 12492, 32816, 32930, 28826, 28724,
+    28786, 32905, 12813, 12516, 16595, 12932, 28750, 28720, 5585, 20487, 28764, 12875, 9086, 9900, 20481, 28762,
+    13026, 32881, 32869, 16983, 28731, 28750, 12944, 12683, 28773, 13209, 12718, 6043, 28763, 10246, 17408, 12969,
+    12612, 28690, 28821, 13018, 28761, 11349, 12851, 12600, 12942, 9385, 13125, 12983, 28729, 13016, 9086, 12344,
+    9684, 20487, 32858, 28764, 10254, 8910, 17406, 16934, 12564, 28760, 12612, 28812, 28700, 5113, 28689, 28797,
+    12812, 32807, 16700, 6299, 12969, 28763, 10215, 6145, 10161, 10497, 32891, 20488, 16586, 12706, 12943, 12876,
+    10253, 16656, 9676, 13097, 17406, 28741, 32869, 28691, 12824, 28746, 17407, 11638, 12419, 12942, 17298, 28700,
+    8486, 12683, 28719, 17398, 28816, 28739, 20481, 28788, 28766, 28817, 12717, 17139, 28706, 9956, 12719, 12801,
+    9311, 9376, 17062, 12780, 12982, 6189, 12704, 11095, 12802, 12696, 28753, 28821, 10261, 16778, 11685, 28774,
+    20485, 12675, 17149, 28789, 17069, 17407, 6344, 10869, 12886, 10284, 16609, 10461, 28719, 9021, 28812, 28806,
+    32856, 17061, 12876, 12715, 28808, 28825, 9685, 28781, 16778, 9964, 17211, 12873, 12552, 16855, 11639, 17386,
+    16540, 13114, 12623, 16904, 32816, 10806, 16516, 6225, 28760, 9321, 10284, 28797, 8779, 28716, 28683, 13156,
+    12670, 12716, 32893, 32831, 8470, 12696, 12900, 32819, 28797, 5498, 10461, 16914, 12660, 28751, 5928, 9687,
+    11468, 28801, 12467, 12813, 12984, 12812, 11105, 32843, 28754, 12991, 28753, 16778, 32805, 20489, 16922, 12875,
+    8790, 17228, 32904, 10284, 12501, 28787, 13162, 10882, 12552, 9022, 12921, 28697, 9897, 10247, 28759, 28766,
+    32845, 12660, 11866, 28684, 6344, 12896, 8918, 12432, 10545, 17396, 32895, 12611, 28789, 28775, 28771, 12749,
+    11104, 28735, 12520, 10377, 28754, 10760, 17011, 28747, 12887, 32885, 10281, 28776, 28798, 28687, 9986, 13112,
+    28758, 17080, 28716, 16753, 9151, 9388, 13054, 28707, 12943, 32892, 10538, 8478, 32856, 32846, 16674, 9974,
+    28826, 5629, 11312, 12576, 12378, 16675, 6394, 16858, 12995, 16903, 17070, 17150, 17279, 12564, 28697, 28828,
+    13135, 17407, 32790, 17218, 12971, 28753, 28709, 28754, 16934, 13162, 9665, 8745, 9087, 10859, 11386, 28719,
+    6320, 32845, 13124, 16518, 16992, 28730, 17062, 28717, 28706, 12418, 12540, 13087, 6050, 11357, 10280, 12552,
+    12802, 28727, 16541, 12372, 32790, 17246, 12718, 32896, 12874, 17003, 12920, 8284, 10461, 32820, 8278, 13030,
+    28696, 12933, 12922, 12551, 32857, 13212, 10452, 32933, 28792, 32869, 8769, 9983, 6151, 11443, 28808, 12922,
+    11358, 10460, 9384, 16761, 28755, 5674, 5628, 12693, 11401, 28728, 28828, 8779, 32830, 28753, 17070, 12356,
+    11701, 32792, 11686, 32778, 11348, 28790, 8787, 5665, 28798, 12768, 12898, 32933, 12800, 28741, 32871, 13067,
+    12958, 12813, 12067, 12740, 28699, 12787, 12392, 32859, 32906, 11394, 13128, 32777, 12743, 8744, 12348, 28799,
+    12921, 12887, 28791, 13036, 11645, 17275, 12706, 10208, 12441, 12811, 17081, 6432, 12381, 9377, 9974, 11640,
+    10461, 10247, 12946, 13074, 12420, 28774, 11050, 11104, 6058, 6321, 13031, 11685, 9685, 28806, 13097, 28809,
+    6349, 10568, 17237, 12694, 5041, 13224, 28743, 28696, 32833, 10271, 13198, 12824, 11113, 28810, 12824, 17219,
+    28718, 9077, 28728, 12803, 17141, 12815, 17082, 13224, 28749, 11358, 16700, 17316, 13123, 28826, 12739, 11394,
+    16447, 13123, 9975, 28812, 13116, 20488, 16857, 9376, 28776, 12706, 28673, 32870, 28676, 32894, 28677, 28690,
+    12791, 6056, 12636, 10814, 12575, 12957, 32883, 12379, 28748, 28789, 28748, 10216, 28793, 28788, 28777, 12696,
+    28788, 12719, 28685, 11104, 17083, 32882, 32805, 32932, 12500, 28790, 17001, 16615, 16801, 11096, 13075, 0,
+    20487, 11159, 28752, 13210, 9366, 12612, 13065, 9964, 28739, 28799, 12323, 28708, 32894, 13038, 11112, 8965,
+    16603, 32894, 10546, 11441, 11703, 11050, 32906, 28757, 12945, 12454, 11603, 11685, 16699, 10805, 28740, 16751,
+    12887, 10641, 10264, 28746, 17132, 12899, 32820, 10562, 8476, 12935, 28795, 11654, 11167, 13020, 12959, 13042,
+    28828, 13086, 6327, 28675, 32820, 12922, 6216, 11443, 28808, 12695, 16412, 17238, 11177, 17247, 10415, 12612,
+    17399, 12946, 32794, 13087, 12840, 12525, 28808, 12486, 9509, 9591, 9087, 28708, 10553, 17236, 9321, 17072,
+    12624, 8470, 12707, 10389, 11655, 28729, 28744, 28760, 10861, 0, 13075, 11611, 28729, 8402, 10218, 12453,
+    28778, 13062, 17072, 28784, 28734, 28828, 12803, 32893, 8663, 12588, 12886, 28809, 8490, 28762, 9086, 12932,
+    17141, 12066, 10271, 13187, 28749, 12297, 12839, 13039, 17083, 12860, 9986, 12815, 13123, 10814, 11648, 17269,
+    12827, 12563, 11059, 10516, 12384, 16935, 17072, 11358, 11357, 16846, 12816, 13137, 28738, 32906, 32881, 12599,
+    5673, 20489, 9918, 12552, 28754, 12564, 10814, 12595, 13007, 11442, 12876, 12311, 10217, 28703, 12786, 11395,
+    32845, 12922, 9964, 32933, 12488, 28684, 13126, 12863, 12596, 28760, 28710, 13008, 10208, 11457, 10581, 12636,
+    12467, 11972, 12588, 28685, 17160, 12691, 32779, 17013, 16901, 10815, 12456, 13103, 12934, 12812, 11113, 12563,
+    28769, 28767, 28759, 32934, 9675, 28742, 17002, 32790, 10517, 16845, 13149, 28786, 28733, 28814, 12677, 12909,
+    12875, 12334, 8647, 32777, 32906, 9809, 13208, 11113, 9686, 10517, 8490, 28747, 12552, 10853, 12876, 32907,
+    12671, 13092, 13029, 16529, 10562, 32906, 13184, 12636, 10516, 11611, 12920, 11703, 16937, 13008, 12923, 13137,
+    13030, 12708, 13112, 11694, 17159, 13158, 12944, 5674, 28725, 28716, 32918, 9509, 12803, 13092, 12971, 6393,
+    11412, 10806, 13102, 12934, 10561, 32896, 12348, 10461, 9078, 12479, 16966, 12456, 11105, 12720, 12720, 13198,
+    16440, 10570, 13052, 10879, 16609, 12983, 0, 28793, 13174, 12780, 32897, 12932, 32780, 32934, 10781, 20489,
+    12657, 12815, 9986, 17332, 12356, 28698, 28764, 16516, 12428, 12552, 11478, 10217, 9675, 17228, 17004, 28790,
+    10506, 32781, 11656, 6401, 13088, 10515, 32896, 13103, 17072, 28800, 9051, 32909, 10879, 12804, 17229, 12065,
+    11413, 11926, 12684, 12911, 9299, 17173, 32896, 12478, 9918, 12744, 32884, 17220, 32830, 12922, 28722, 32844,
+    32794, 13138, 32788, 13064, 11167, 8649, 12309, 8785, 32781, 32819, 12792, 11012, 12359, 28824, 28733, 17219,
+    12923, 13063, 11412, 28724, 28687, 8789, 10443, 11894, 17012, 28763, 11656, 32844, 32895, 10023, 32846, 11413,
+    6226, 16517, 17160, 8790, 12732, 13162, 10283, 28686, 28789, 13064, 17282, 13150, 12959, 28674, 11458, 28786,
+    12827, 13221, 9676, 17012, 17082, 12683, 12839, 17281, 11160, 32932, 16805, 9852, 32867, 28764, 12871, 13006,
+    28691, 17015, 16597, 12344, 10507, 32818, 11656, 12984, 11177, 28749, 8491, 9077, 17307, 28786, 11774, 13090,
+    4864, 10216, 12624, 13040, 28761, 12600, 11901, 28783, 8721, 12002, 10578, 28714, 28732, 10218, 17095, 28771,
+    28755, 5629, 12708, 28828, 17309, 28770, 12463, 12815, 13042, 28800, 32802, 9620, 32907, 28800, 12611, 12970,
+    17161, 17296, 28796, 28783, 17095, 17082, 16767, 17238, 12605, 28690, 16846, 11395, 8480, 13040, 16767, 28802,
+    16665, 9001, 9386, 12512, 13098, 12720, 12010, 16756, 11450, 17012, 28687, 12465, 11152, 11443, 28808, 28708,
+    10881, 13076, 17289, 12419, 32932, 17091, 28689, 6356, 13031, 12923, 28797, 12647, 32882, 13091, 17161, 10813,
+    9778, 12382, 32936, 32936, 13029, 12468, 28750, 28791, 13159, 28767, 6364, 28734, 10078, 32828, 28787, 12924,
+    9376, 32793, 11114, 6327, 17123, 9919, 13064, 8667, 28802, 13052, 10853, 28805, 12547, 8424, 13137, 12730,
+    16425, 13089, 10517, 12539, 28778, 10517, 12948, 28732, 11702, 12608, 11993, 28786, 10263, 12540, 9687, 11702,
+    32846, 6225, 10272, 11466, 16428, 28718, 6455, 28808, 32840, 16902, 10264, 8491, 28732, 12380, 8555, 28749,
+    12532, 32775, 32778, 12407, 12672, 28811, 11114, 10264, 12899, 28739, 28810, 8853, 28760, 28703, 28704, 12414,
+    12876, 9516, 10869, 10816, 32885, 32840, 13149, 32935, 28718, 28700, 28773, 9686, 28725, 12298, 28778, 12720,
+    32803, 16447, 28791, 28691, 16736, 10862, 28820, 32918, 28802, 17307, 10870, 16766, 12660, 11404, 13157, 12488,
+    10580, 11775, 17170, 28734, 12684, 28682, 16658, 8491, 12708, 32846, 28688, 13090, 12960, 28731, 10860, 12703,
+    13079, 13065, 12780, 11152, 9088, 12816, 28813, 6399, 32907, 28809, 16537, 13148, 12428, 28822, 32845, 28730,
+    32908, 16767, 28813, 28813, 28692, 17092, 28809, 28681, 20489, 12827, 11412, 28736, 12797, 12768, 6218, 9388,
+    11742, 28710, 32820, 9204, 28680, 20489, 12960, 6189, 16920, 11611, 28702, 8396, 16880, 11413, 13157, 28773,
+    32802, 8982, 10570, 12756, 4625, 13055, 17013, 12996, 28736, 12788, 12309, 32777, 11114, 13151, 16596, 10584,
+    12346, 12028, 17247, 28797, 9884, 9892, 16619, 12528, 12719, 16808, 10572, 13148, 28822, 28693, 28740, 6365,
+    32859, 12873, 17396, 28680, 28790, 13100, 10878, 16588, 13115, 32845, 28743, 12672, 28720, 28806, 10570, 16527,
+    9606, 10580, 12669, 16595, 28764, 28684, 28784, 28778, 12936, 12983, 16983, 28795, 12798, 17290, 28802, 11161,
+    12958, 13158, 9255, 12924, 11470, 11470, 13076, 12648, 9010, 10505, 12490, 28824, 9606, 12489, 13149, 17162,
+    28720, 12768, 12960, 12996, 4949, 28679, 12001, 20485, 17290, 13224, 17013, 13115, 16439, 12357, 12742, 12827,
+    12600, 10554, 12684, 32832, 28796, 13150, 16953, 12430, 28680, 28701, 6394, 8744, 28723, 10264, 16517, 13158,
+    28806, 9620, 12522, 12683, 10554, 11656, 6402, 28811, 32829, 16936, 13127, 17238, 13104, 16515, 13030, 13002,
+    12552, 13030, 17012, 10572, 13053, 13008, 11900, 12744, 12297, 17298, 6447, 16517, 28734, 28720, 6234, 28786,
+    12564, 13065, 17091, 12636, 12995, 12624, 28711, 12947, 13077, 17239, 28746, 6235, 12320, 13041, 12743, 13101,
+    13054, 9685, 12320, 28770, 32897, 10517, 13079, 28806, 10879, 12503, 11170, 13041, 13066, 9975, 17290, 11179,
+    8789, 6234, 10871, 28704, 13159, 12972, 32859, 8320, 10861, 17307, 10581, 16832, 13054, 5585, 13159, 12012,
+    32831, 32805, 10285, 17353, 12588, 28757, 13182, 16752, 12739, 11871, 13116, 12947, 10584, 12768, 28779, 17016,
+    12910, 12648, 13054, 12624, 32806, 12405, 13124, 13091, 17317, 11476, 10573, 32804, 32930, 10853, 28796, 17000,
+    9021, 10456, 28694, 28805, 28708, 28757, 28722, 28680, 28791, 32937, 12816, 11468, 28808, 12898, 12310, 12394,
+    11872, 12768, 9553, 11459, 13006, 32831, 16699, 11712, 9180, 17308, 28728, 16620, 9044, 12475, 17317, 32807,
+    28734, 9687, 28791, 10573, 12959, 12345, 17249, 8313, 10581, 12852, 28702, 11938, 12767, 9089, 28810, 28681,
+    28731, 28743, 17306, 12857, 12504, 20487, 32790, 13126, 13043, 17249, 28808, 13032, 17092, 12984, 28727, 12322,
+    28758, 13126, 12384, 32919, 12970, 8606, 10283, 28781, 28805, 28807, 16650, 9773, 28693, 6410, 12756, 17174,
+    12510, 9965, 13029, 28732, 5026, 32917, 13224, 11757, 28743, 6043, 11170, 17014, 13043, 12323, 10882, 32793,
+    12672, 12852, 9675, 12477, 12660, 8256, 10274, 12991, 12466, 10581, 28803, 12600, 20485, 16807, 12948, 13017,
+    12886, 28795, 13183, 12581, 11991, 28737, 0, 11954, 10880, 28736, 28682, 17015, 12893, 12077, 28690, 9363,
+    13115, 12295, 12892, 9975, 8349, 16685, 32830, 13128, 12804, 17016, 28799, 16439, 12308, 28715, 8963, 17307,
+    32776, 12404, 12648, 32804, 9853, 16729, 13043, 28809, 8875, 10138, 10880, 28689, 28796, 17249, 12522, 32844,
+    28805, 28813, 17016, 16925, 28723, 28734, 13008, 28679, 12588, 32779, 13104, 12864, 12924, 17094, 32778, 16588,
+    16650, 12960, 11938, 11901, 10571, 13076, 16744, 16492, 16448, 16447, 10881, 28737, 12562, 16744, 8955, 12828,
+    28702, 12666, 28812, 28809, 12575, 8583, 32917, 8384, 12333, 28735, 32819, 32828, 12588, 28723, 16499, 16666,
+    6226, 9685, 0, 12309, 32804, 12311, 32910, 28746, 32840, 6234, 6448, 32843, 5444, 13171, 13212, 28730,
+    5368, 12660, 12055, 28730, 32818, 16607, 16509, 6410, 28686, 13187, 12593, 12499, 12336, 16509, 9011, 32776,
+    12828, 28818, 11459, 12756, 28688, 28737, 17298, 8876, 11161, 28785, 11178, 12380, 9263, 32910, 17240, 11749,
+    28736, 12648, 9607, 12936, 28693, 13115, 28710, 12888, 12368, 16736, 32804, 5270, 9065, 10206, 13182, 12947,
+    12548, 16462, 28773, 16884, 28719, 17250, 20484, 9255, 32804, 28816, 32805, 11702, 12724, 28702, 0, 28674,
+    28785, 13152, 32802, 11114, 9388, 0, 11171, 17015, 16507, 32898, 32839, 12540, 16451, 10584, 13138, 10284,
+    28691, 10213, 6456, 9480, 10283, 13171, 12760, 12852, 12639, 12642, 28701, 12300, 28794, 8683, 12383, 6456,
+    28736, 13091, 28706, 16439, 10284, 13171, 8619, 28748, 9801, 8870, 13172, 12406, 12370, 12418, 9917, 28791,
+    9291, 13077, 12564, 13205, 28727, 11768, 16449, 13161, 11468, 13139, 16667, 11909, 28732, 32805, 17249, 12358,
+    12429, 10648, 16530, 17307, 9750, 28714, 28711, 17298, 28811, 11902, 12737, 28700, 28724, 16588, 32793, 9343,
+    9860, 12816, 12779, 28678, 32868, 20486, 11909, 13140, 16427, 28717, 13173, 6466, 12900, 28699, 28798, 11767,
+    12804, 12884, 12605, 8710, 6457, 16411, 13194, 10282, 28724, 12524, 12371, 28682, 16686, 28759, 13067, 12406,
+    28679, 20485, 28803, 10399, 13079, 12318, 11476, 32907, 12440, 12912, 28727, 16688, 11460, 28791, 12868, 13183,
+    12728, 12358, 12537, 16694, 17308, 8350, 12464, 10072, 17298, 13159, 8314, 28717, 28760, 28733, 28739, 17150,
+    16774, 28689, 12803, 8694, 28758, 9503, 20485, 28812, 10285, 12667, 12299, 12525, 13044, 9586, 20484, 32843,
+    9838, 32883, 10280, 11115, 17172, 9010, 32846, 16666, 12491, 11468, 28691, 28722, 12852, 11460, 32818, 9293,
+    17309, 16596, 12490, 16823, 6402, 13115, 32805, 8356, 12465, 12623, 28722, 12564, 16885, 11179, 32919, 9983,
+    8758, 12504, 12835, 6411, 28724, 16509, 13103, 8488, 13103, 13067, 28756, 8620, 9516, 16528, 16720, 11479,
+    10881, 10203, 12549, 13103, 11777, 9962, 16756, 12404, 12345, 12607, 12668, 16667, 9065, 13139, 32920, 28728,
+    12331, 13090, 12840, 17250, 32818, 11946, 32806, 13148, 12477, 13208, 11468, 28713, 13152, 13020, 28689, 10517,
+    28814, 32920, 11775, 28787, 12776, 6456, 12527, 32792, 12321, 12948, 13139, 32906, 17249, 12684, 16497, 32922,
+    12407, 16677, 16832, 16677, 8606, 10136, 17317, 32779, 8365, 17317, 10648, 12561, 13182, 32804, 17081, 10584,
+    10872, 28694, 12948, 12467, 32838, 32805, 11480, 12048, 32907, 28726, 28687, 13161, 32801, 8995, 5098, 28812,
+    28768, 16597, 28721, 12500, 8350, 12478, 12347, 28815, 28691, 32839, 8351, 12834, 5478, 12514, 10507, 32780,
+    10692, 12983, 17326, 12308, 17320, 11477, 28727, 10274, 11479, 32833, 17219, 12964, 12585, 12728, 12407, 6411,
+    16516, 16857, 10582, 16815, 17377, 28676, 28768, 8477, 28691, 8584, 16833, 12763, 11758, 9545, 13196, 12936,
+    13104, 28686, 12299, 13210, 12612, 12001, 32820, 12600, 4932, 5484, 12407, 11181, 28680, 28821, 10872, 12960,
+    28806, 20482, 11767, 28675, 6456, 28713, 10583, 12444, 9263, 16597, 32780, 16676, 12977, 28818, 12347, 13008,
+    12065, 28750, 16596, 17253, 28824, 13044, 28690, 12583, 9255, 12707, 28820, 32792, 12549, 12667, 12879, 28699,
+    12834, 12924, 16607, 28733, 28743, 28787, 9218, 12441, 32937, 12295, 28808, 8966, 11954, 28821, 32841, 16605,
+    32818, 13164, 12632, 12298, 12573, 13184, 28802, 16823, 10852, 11224, 17326, 16412, 28713, 10815, 12694, 28720,
+    13116, 28746, 13008, 28783, 12456, 12393, 12777, 28747, 10271, 12780, 12936, 13138, 12680, 12347, 16608, 28748,
+    13160, 32898, 11181, 32780, 8695, 13013, 16763, 9562, 16449, 28736, 12884, 13012, 28700, 13151, 28749, 28710,
+    13092, 13184, 32870, 17327, 12607, 28759, 28814, 12057, 12335, 12492, 9377, 28691, 9892, 8689, 11180, 12431,
+    28741, 10883, 11180, 28768, 28714, 12552, 13173, 12514, 12312, 13173, 28735, 28737, 32804, 12727, 12895, 11180,
+    12323, 9517, 12894, 13127, 13185, 28698, 16528, 8667, 13196, 9481, 28756, 12444, 12780, 10284, 12488, 11769,
+    12360, 28736, 12359, 28760, 16833, 20484, 12680, 11478, 20485, 13198, 12786, 28702, 12546, 9089, 12751, 28761,
+    11778, 9941, 28817, 32919, 13174, 28718, 13163, 32806, 32832, 12478, 9985, 28734, 6365, 11240, 28738, 12864,
+    8920, 12645, 28726, 8957, 11029, 8359, 5427, 28816, 12419, 12644, 12657, 13032, 28698, 28750, 12656, 28681,
+    12527, 12311, 28714, 4700, 28676, 9641, 28780, 12585, 13077, 13175, 10272, 12922, 12562, 12665, 17151, 13208,
+    12848, 20485, 13207, 12679, 28690, 17111, 13222, 28709, 11479, 16675, 12847, 12311, 28747, 32936, 8767, 12456,
+    28818, 13140, 8657, 32838, 32794, 16616, 28694, 16697, 28819, 12343, 28678, 11956, 32819, 9508, 28739, 11779,
+    12323, 10138, 12575, 12571, 28680, 16539, 32924, 16763, 28716, 8696, 16530, 28732, 13068, 12869, 12357, 12707,
+    12586, 28784, 28697, 28770, 13161, 10394, 11777, 12394, 12395, 9293, 28674, 16684, 12334, 32839, 12516, 12691,
+    11759, 28827, 28679, 12379, 28691, 11684, 28737, 13007, 13196, 10941, 16607, 28707, 9563, 28728, 12407, 12690,
+    16619, 9672, 13196, 12884, 12667, 13197, 12765, 16528, 20485, 12596, 10940, 9946, 13217, 12679, 9648, 32807,
+    16530, 13206, 32819, 11478, 16666, 5274, 12703, 11777, 12323, 10365, 28775, 28760, 11956, 12874, 32931, 12814,
+    13160, 17328, 20488, 28822, 32832, 8422, 16608, 10883, 12011, 13152, 16598, 32780, 32806, 32884, 12000, 11992,
+    9317, 28817, 28703, 9601, 11413, 12483, 28715, 28814, 28681, 28692, 13004, 28793, 4721, 28770, 12679, 12549,
+    13008, 13184, 12615, 32805, 10239, 13163, 4634, 13126, 8719, 17320, 6401, 32923, 28706, 12300, 16825, 11235,
+    12668, 16421, 12669, 9010, 13175, 12682, 13209, 13122, 12671, 17328, 12010, 13172, 13162, 13103, 13218, 32833,
+    32922, 16854, 13151, 28754, 8954, 32911, 12383, 12564, 6465, 12383, 28801, 16677, 28734, 12310, 28770, 32794,
+    10394, 32781, 28718, 12742, 28822, 12552, 28815, 12066, 9310, 28744, 16886, 17253, 16597, 12752, 9906, 28699,
+    28681, 12000, 11767, 0, 12002, 17328, 11759, 28707, 16440, 16540, 9318, 20484, 13208, 12777, 28676, 13172,
+    28745, 9547, 9593, 32791, 9593, 0, 32793, 12775, 28745, 28768, 28714, 28683, 16982, 12407, 32828, 12011,
+    12538, 9766, 12369, 12586, 12587, 13173, 12695, 16698, 17329, 12764, 16606, 12057, 28820, 13199, 28675, 16893,
+    13184, 17253, 12468, 10430, 13056, 28681, 9649, 28736, 12491, 28729, 17162, 9915, 11778, 13187, 28733, 28761,
+    28780, 16518, 16528, 12743, 8704, 12575, 28791, 32791, 32859, 12408, 16727, 9357, 20486, 0, 13068, 32806,
+    28695, 28728, 16440, 28780, 32791, 16461, 8957, 17411, 10436, 13140, 10482, 32793, 8919, 10583, 12778, 32793,
+    28733, 28731, 16657, 12476, 0, 32923, 8760, 12656, 12884, 12717, 12964, 13029, 12537, 12464, 28717, 10669,
+    8421, 28819, 28796, 12076, 12599, 32869, 10776, 28774, 17397, 12348, 12801, 16506, 0, 12616, 10238, 28690,
+    12416, 5339, 32818, 9263, 28683, 13116, 28680, 8957, 8766, 12670, 28727, 12671, 12347, 12528, 16886, 12561,
+    8322, 28805, 0, 13186, 28712, 4975, 9038, 9816, 12936, 28781, 8359, 17158, 8936, 28780, 12551, 16696,
+    12871, 28691, 28785, 8414, 8477, 28737, 28799, 32791, 5362, 9563, 12468, 12607, 28737, 13140, 12777, 12538,
+    12384, 32845, 11779, 12536, 28796, 13176, 32831, 16617, 28818, 28779, 12953, 32911, 16918, 16539, 12503, 12765,
+    13163, 13056, 32831, 12551, 12058, 32884, 9044, 20484, 32843, 32818, 28693, 10670, 32844, 9044, 16851, 28702,
+    32842, 9516, 12562, 28735, 28695, 32833, 13128, 28683, 0, 28683, 10371, 28735, 12679, 13104, 28745, 12990,
+    13164, 9365, 16536, 12971, 16687, 20481, 12382, 11131, 28736, 12816, 16899, 9564, 28701, 16618, 28709, 12656,
+    12682, 16459, 12682, 11778, 28711, 16685, 9642, 11778, 16449, 16766, 16756, 32859, 12066, 16765, 16530, 32908,
+    16448, 5048, 10114, 12537, 28794, 28807, 12668, 16618, 9349, 28678, 28747, 28773, 28770, 16461, 12585, 11274,
+    17360, 4976, 12836, 0, 11137, 13176, 28733, 8421, 32794, 12312, 28702, 13176, 8693, 6440, 28742, 9915,
+    32843, 16687, 28769, 28781, 10371, 28735, 16539, 28778, 12912, 20481, 28784, 16746, 16901, 10437, 12982, 13187,
+    16698, 16779, 12359, 5478, 28746, 12516, 16621, 13152, 11080, 12863, 12057, 13014, 5454, 12393, 16696, 10184,
+    12681, 6355, 4722, 13128, 11993, 13004, 12670, 8965, 16588, 32833, 12551, 16774, 28748, 12524, 13104, 16460,
+    17328, 12429, 16854, 32832, 12066, 9593, 8367, 28693, 12679, 12408, 9022, 12408, 32819, 9349, 12682, 28823,
+    5362, 8423, 28691, 12057, 12539, 8424, 12955, 16886, 16910, 9846, 10968, 16449, 9085, 32830, 12501, 12395,
+    17043, 9059, 17161, 32781, 28810, 28745, 28804, 28674, 5922, 28688, 28728, 16539, 12360, 12644, 16756, 16844,
+    9078, 32845, 17386, 28819, 17328, 8704, 9022, 12563, 28770, 12956, 10400, 28687, 13091, 9907, 17330, 32832,
+    28682, 13172, 12418, 11543, 9593, 16745, 28682, 17330, 28715, 9593, 17196, 10151, 28768, 12617, 5556, 12967,
+    28749, 12300, 28714, 12693, 16887, 17037, 12587, 12778, 32829, 32831, 13200, 5608, 10969, 8774, 20484, 28786,
+    16844, 28764, 32853, 32775, 32842, 12679, 12490, 11436, 9854, 10997, 28762, 12681, 28794, 16901, 16766, 12456,
+    12753, 28730, 5830, 28749, 16528, 8621, 8486, 28758, 12369, 8704, 9299, 20483, 16677, 12729, 11081, 17115,
+    12488, 16966, 32922, 13176, 16755, 12618, 13211, 17331, 10483, 12658, 9809, 28768, 32923, 32879, 12320, 13147,
+    17241, 13158, 28678, 13092, 12807, 28770, 20481, 10400, 5070, 12694, 16696, 16519, 10159, 12789, 28728, 32832,
+    13211, 12348, 10239, 12699, 16460, 13209, 12994, 12420, 13132, 13211, 28823, 32924, 28753, 0, 13148, 12540,
+    12079, 28675, 16825, 16745, 12646, 32872, 9074, 12441, 12058, 9862, 12079, 9066, 12594, 12588, 28745, 16854,
+    13052, 28712, 16676, 9861, 16542, 28721, 12574, 9355, 0, 12416, 16729, 28823, 32816, 28736, 28770, 12683,
+    12597, 16458, 28715, 13122, 11866, 28707, 20484, 8882, 12955, 32872, 28818, 13092, 12582, 9816, 5433, 12778,
+    12549, 12561, 9619, 16913, 32781, 10161, 10704, 32814, 13208, 12539, 32845, 28688, 9058, 28817, 8721, 13210,
+    13152, 10377, 8766, 8966, 32833, 13208, 16913, 16621, 12032, 11268, 16500, 32893, 28678, 9609, 5574, 12058,
+    9854, 12837, 13212, 9067, 28713, 16698, 10975, 28738, 12468, 28790, 32807, 28819, 12563, 28796, 17394, 8368,
+    28693, 20481, 12012, 16834, 13128, 12789, 12921, 10443, 12971, 28727, 12765, 28761, 28821, 28761, 9665, 28816,
+    13080, 12442, 12756, 17332, 12822, 11137, 16894, 8368, 10079, 9300, 12476, 12836, 17171, 32864, 8957, 12861,
+    12728, 12731, 0, 12887, 8479, 8712, 16778, 28821, 28800, 16687, 17332, 28748, 12502, 16965, 16750, 28777,
+    32778, 9863, 4728, 9320, 12012, 20482, 12872, 28746, 12502, 12560, 12394, 28758, 12796, 28758, 16621, 32779,
+    16902, 12395, 4977, 10675, 28787, 8775, 32777, 12656, 16833, 12610, 11267, 9075, 16696, 28687, 12633, 32846,
+    28749, 12886, 12850, 8311, 8920, 12336, 8778, 32833, 12751, 12382, 28822, 28719, 28719, 16451, 12392, 12799,
+    11710, 13004, 12514, 12561, 32924, 12633, 8453, 8957, 12838, 9853, 8477, 28781, 28726, 28695, 12810, 28688,
+    12442, 28693, 8776, 0, 9265, 28728, 28727, 16754, 17083, 28759, 10736, 28733, 32794, 12501, 9248, 12610,
+    28690, 12343, 28693, 5900, 9021, 10975, 12682, 12067, 28774, 11902, 9302, 10114, 9019, 28704, 10218, 12068,
+    12799, 16857, 13212, 12619, 5563, 17399, 11114, 8777, 16835, 12991, 28697, 12886, 16518, 8768, 12840, 8469,
+    32843, 9916, 28824, 28800, 28703, 16620, 9619, 10145, 28745, 12549, 20481, 28718, 9089, 8413, 12738, 17377,
+    32781, 17331, 16911, 12808, 5483, 8413, 12862, 8966, 32924, 12075, 32828, 16887, 20481, 28816, 28759, 5614,
+    32815, 28679, 16921, 28775, 28739, 12419, 17013, 28681, 10797, 12658, 28758, 12693, 16677, 10831, 32872, 28822,
+    16998, 6038, 12742, 9262, 17369, 16542, 16880, 11003, 10159, 6433, 32781, 12864, 12755, 16450, 28758, 16843,
+    12764, 28826, 12049, 13004, 17122, 12600, 9367, 8413, 10506, 20481, 32819, 11332, 13126, 9376, 20483, 9321,
+    9617, 12815, 9357, 28784, 28799, 9862, 10676, 20484, 28826, 28691, 10787, 16779, 28727, 11677, 17396, 28747,
+    32919, 20488, 28766, 12708, 16620, 8966, 32806, 28741, 28708, 12691, 9058, 12884, 28749, 12079, 8461, 12945,
+    12359, 28798, 12900, 16921, 13137, 12514, 28761, 28743, 16920, 6122, 5461, 12799, 8966, 28695, 12513, 28817,
+    8722, 13032, 11003, 10079, 17396, 28714, 12753, 17387, 16979, 12875, 28738, 9318, 16835, 12694, 12799, 5583,
+    12492, 10711, 9862, 13206, 5075, 10583, 12563, 20489, 17385, 12981, 12526, 12609, 28690, 12634, 12807, 4983,
+    28739, 17052, 12455, 28798, 28679, 9374, 28758, 32845, 28825, 11297, 12714, 13163, 12657, 12612, 28696, 17378,
+    13028, 12810, 13007, 12587, 28729, 28738, 28690, 9863, 16777, 32832, 16895, 28718, 28681, 28722, 12703, 32845,
+    16585, 13220, 28733, 28760, 8405, 28704, 12527, 12836, 12343, 12712, 12646, 16430, 10160, 13039, 8765, 13224,
+    12846, 5585, 16857, 32845, 32794, 32854, 17388, 12490, 16541, 8721, 16542, 28740, 16699, 20485, 9021, 11049,
+    12383, 28674, 28774, 8489, 17395, 10705, 9067, 28820, 28759, 10108, 9383, 17385, 12713, 17386, 28818, 12790,
+    32805, 16694, 12586, 11679, 9174, 17386, 8704, 8723, 5455, 12729, 28797, 10804, 11937, 8461, 28800, 28781,
+    11040, 13212, 10214, 28727, 12836, 8965, 28722, 32846, 32820, 12620, 12479, 10443, 28758, 8760, 12695, 13110,
+    5900, 12803, 9918, 12575, 28728, 11678, 12527, 12809, 12455, 16675, 9059, 12897, 16462, 16767, 12719, 11272,
+    28794, 28823, 16767, 12703, 9907, 28750, 8404, 28716, 28795, 10975, 12503, 12671, 28821, 8790, 32814, 12766,
+    17408, 9374, 32781, 12575, 32832, 0, 10517, 12406, 28748, 17320, 12346, 12972, 28808, 10160, 28734, 28795,
+    20481, 12731, 32869, 32924, 10788, 12596, 8713, 32833, 16904, 8987, 32863, 32907, 12490, 9851, 13221, 12396,
+    32865, 12812, 12703, 9909, 32833, 12609, 13222, 17052, 28700, 12852, 11004, 9649, 17377, 16767, 28730, 12872,
+    12562, 9656, 5585, 12860, 12695, 20487, 6205, 9965, 12972, 12444, 9863, 16856, 9564, 12899, 13005, 28740,
+    28757, 8768, 10108, 12515, 32894, 12713, 12587, 32831, 12695, 32870, 16530, 28746, 8403, 28673, 12900, 8768,
+    12502, 12551, 8965, 32874, 8469, 11430, 9863, 17398, 12801, 8461, 9918, 8760, 28806, 9310, 28772, 9021,
+    9900, 12648, 8776, 12515, 11081, 6293, 12479, 16621, 13222, 11042, 12876, 12875, 12527, 12504, 12694, 5368,
+    12766, 6466, 12956, 11545, 32885, 12635, 28731, 32839, 8322, 12718, 28723, 13026, 13133, 20483, 4728, 12753,
+    9900, 32781, 8414, 12419, 12324, 9320, 12995, 11838, 12550, 12714, 12612, 28751, 8403, 16845, 28695, 12372,
+    20484, 32857, 11161, 9555, 10411, 5461, 28731, 12897, 16844, 12300, 12670, 12514, 12647, 9955, 28825, 28754,
+    28673, 10750, 12684, 0, 28683, 12586, 12917, 12478, 28708, 8479, 9666, 12799, 12837, 13003, 12538, 9986,
+    12396, 12684, 17072, 9265, 16835, 17376, 9075, 12823, 28739, 12852, 32881, 10838, 13223, 9676, 28798, 12907,
+    20486, 12742, 28822, 28692, 12681, 32846, 8721, 8461, 12837, 13017, 28694, 8768, 12332, 28730, 28816, 32793,
+    12968, 12670, 8488, 28715, 28765, 13113, 12994, 12574, 32845, 12826, 17387, 11631, 28750, 12969, 16672, 12620,
+    8413, 0, 16564, 28823, 10787, 17407, 32867, 16921, 28721, 12575, 10108, 28740, 9656, 12713, 12991, 9086,
+    12644, 13041, 28806, 16698, 12575, 28703, 12588, 32802, 10214, 9087, 9076, 0, 28762, 8636, 17217, 12743,
+    9367, 28759, 12462, 32831, 16843, 12659, 17072, 11274, 28682, 17388, 5368, 28676, 32869, 12550, 28752, 5368,
+    13006, 32819, 12600, 12012, 17407, 9917, 12528, 5656, 28759, 9377, 10497, 28816, 12648, 16973, 16530, 12420,
+    16931, 11047, 12874, 17397, 13006, 9376, 12907, 12851, 12588, 28773, 17408, 9059, 9021, 16903, 28713, 12778,
+    12826, 5334, 12452, 28785, 17408, 9020, 32820, 9386, 12693, 9022, 13197, 13098, 12491, 9948, 16699, 12982,
+    10152, 12789, 16999, 9018, 28752, 12357, 16539, 12898, 5656, 12915, 12609, 28748, 28675, 12764, 28819, 12408,
+    12899, 28774, 12657, 28763, 17138, 12705, 13164, 28759, 16846, 32875, 32869, 10413, 16846, 16834, 28720, 5490,
+    12864, 12791, 12799, 9664, 12984, 8789, 28794, 28678, 12608, 10247, 28724, 28819, 28769, 9059, 32807, 32846,
+    9675, 12777, 32801, 32829, 12958, 28781, 10705, 9021, 28747, 20485, 28704, 5110, 12713, 28827, 9076, 28741,
+    5105, 16529, 12791, 12322, 12809, 16914, 28739, 12812, 10976, 8461, 8314, 12754, 12790, 16923, 28753, 9087,
+    32871, 12372, 28708, 8769, 12479, 12444, 28739, 12755, 12598, 13135, 11086, 6319, 11311, 28825, 10253, 12906,
+    5490, 12820, 9862, 16677, 28784, 10152, 17407, 11640, 12809, 28751, 12634, 12527, 13121, 12907, 13122, 32843,
+    28763, 6349, 4678, 11085, 28786, 9012, 32855, 12563, 28747, 28793, 12907, 12943, 12896, 11056, 16621, 12455,
+    10496, 17411, 16834, 17201, 10713, 28784, 12780, 16506, 12562, 13101, 32845, 32792, 16413, 32866, 12657, 12849,
+    12919, 28737, 12957, 8424, 12863, 11769, 12599, 13018, 28813, 12620, 13164, 8722, 12550, 12571, 16904, 32892,
+    28752, 9618, 28816, 10198, 12899, 12537, 5657, 32879, 17052, 28727, 6299, 32820, 12384, 12635, 28761, 12706,
+    11596, 28701, 12658, 28786, 8424, 12863, 5621, 13152, 9366, 12954, 17407, 20487, 13138, 11136, 5922, 28807,
+    28811, 8461, 28786, 9050, 11339, 16932, 12563, 9675, 12550, 9974, 13062, 8480, 12575, 5498, 10197, 12837,
+    32835, 28718, 12888, 13099, 10437, 12444, 12295, 28785, 12802, 17202, 32842, 10794, 32888, 12874, 9020, 32855,
+    11303, 28773, 16854, 32846, 11385, 16778, 28703, 13043, 32843, 10490, 32803, 9963, 32793, 12984, 28701, 8423,
+    16846, 16912, 10252, 13099, 17016, 13017, 28732, 9376, 6014, 6210, 12948, 10504, 10837, 12992, 28731, 16925,
+    12538, 5591, 11041, 28755, 28824, 17128, 9311, 17202, 12956, 12959, 28741, 12792, 28727, 9387, 12610, 9956,
+    12743, 12672, 9386, 12672, 9662, 28785, 9358, 28745, 12790, 5491, 10788, 16428, 8768, 20483, 28743, 16936,
+    10713, 16779, 12528, 28689, 12825, 12730, 12682, 28785, 17139, 12918, 9078, 28809, 12813, 16856, 32855, 8488,
+    28719, 12372, 17409, 13031, 13112, 28682, 13026, 12970, 28742, 9684, 9609, 28706, 12995, 9349, 28754, 10743,
+    12811, 6019, 12960, 9963, 9174, 28759, 12732, 28809, 17217, 28763, 12438, 28738, 12587, 10451, 12768, 16913,
+    28781, 12551, 8760, 28774, 6044, 11385, 28810, 28782, 5106, 16932, 12852, 32820, 16620, 16914, 6381, 12528,
+    9666, 10507, 32867, 28798, 11844, 12406, 12969, 12823, 13092, 10563, 16529, 28682, 8301, 12587, 12960, 12694,
+    28728, 12586, 16924, 12931, 16412, 28811, 28818, 32856, 9076, 28752, 10570, 12791, 12612, 5628, 10545, 13114,
+    16700, 13018, 32829, 12996, 10253, 28754, 12920, 32856, 12597, 16855, 5591, 12501, 12588, 9375, 16820, 8760,
+    28749, 11141, 28810, 11348, 16508, 12693, 12692, 12715, 28753, 12346, 16923, 32857, 10813, 0, 12576, 12480,
+    16672, 9956, 12893, 6049, 28738, 12394, 20481, 28746, 12441, 28720, 9919, 12672, 13127, 12345, 28764, 9965,
+    11303, 11410, 28700, 10495, 12886, 12311, 32781, 32777, 10414, 28757, 12755, 28810, 12516, 28714, 17210, 13037,
+    12489, 8600, 12564, 12480, 20485, 12369, 13124, 16461, 28753, 10561, 12750, 11087, 28679, 12803, 9618, 28769,
+    0, 10553, 11728, 28701, 9068, 13019, 12551, 20481, 13027, 9964, 12456, 28740, 32891, 32846, 12382, 12744,
+    12503, 28683, 32867, 12970, 12971, 10153, 28758, 12837, 12396, 28773, 6021, 16904, 28785, 12511, 17053, 9374,
+    9247, 17160, 28720, 8723, 9012, 28761, 12744, 12077, 13151, 12672, 12684, 13036, 12899, 12443, 8722, 11341,
+    12371, 11349, 12704, 28704, 10796, 11348, 12863, 9965, 12851, 28766, 28739, 9620, 17061, 12731, 32792, 12704,
+    12706, 13068, 10497, 28765, 12887, 16933, 12708, 8470, 9620, 6021, 28750, 12000, 28771, 17409, 16853, 13099,
+    32896, 17407, 16924, 11450, 8752, 28764, 32930, 16666, 12932, 12572, 28738, 8489, 12715, 12694, 32844, 12621,
+    11087, 12792, 5591, 12705, 28747, 10215, 17410, 12528, 32885, 5672, 10497, 12994, 28764, 6277, 10254, 12888,
+    17273, 32776, 9984, 28760, 11311, 12348, 13019, 12503, 17131, 12500, 16924, 8478, 12780, 12443, 11348, 11844,
+    13136, 12717, 12477, 12528, 12509, 28807, 28727, 17280, 6385, 32882, 9685, 16855, 32869, 16924, 11103, 6049,
+    10153, 16856, 13035, 10845, 11088, 9358, 12440, 12648, 32818, 28703, 13018, 28773, 12575, 12931, 28794, 17149,
+    28706, 12439, 6050, 16450, 13114, 13037, 32934, 11648, 13112, 12984, 28746, 28777, 11436, 28814, 32794, 11683,
+    9068, 16620, 10845, 28692, 12971, 16699, 12540, 28684, 12622, 5673, 6021, 12839, 9985, 12575, 28793, 12622,
+    16762, 12945, 10514, 12468, 28776, 10561, 12824, 12427, 28703, 12900, 28808, 16448, 12826, 12624, 16766, 17082,
+    28798, 32868, 12863, 32846, 9544, 28762, 28720, 9078, 12552, 17210, 9321, 9687, 12731, 12993, 17069, 28747,
+    32871, 28749, 13126, 10582, 10561, 11610, 12792, 9516, 17141, 5498, 28762, 10849, 13188, 16767, 10153, 28786,
+    12443, 9319, 32892, 12432, 9974, 32937, 28797, 12432, 32905, 13138, 11095, 16934, 9982, 5928, 28810, 28710,
+    5663, 28720, 11095, 12716, 12383, 6354, 12933, 12706, 32880, 13146, 11143, 28788, 12959, 11095, 11838, 12789,
+    28799, 12492, 9089, 12825, 12792, 12672, 28760, 11574, 11601, 13039, 11394, 10852, 10546, 28732, 17080, 17315,
+    32870, 28809, 13187, 8424, 9084, 10107, 13039, 28733, 12852, 12898, 10262, 28790, 11112, 12300, 8491, 16463,
+    0, 8479, 10153, 13020, 9985, 32869, 13006, 12800, 16935, 6386, 12779, 12815, 28773, 28703, 5499, 12919,
+    10572, 16992, 12609, 8320, 12359, 32868, 28797, 28750, 9965, 28679, 10546, 11143, 12717, 11311, 12417, 28739,
+    16598, 9077, 32892, 28785, 28797, 12931, 28775, 13050, 12996, 32892, 28684, 13008, 11931, 5621, 32893, 11095,
+    12756, 6327, 13116, 13136, 28754, 12971, 28745, 28798, 8403, 12957, 32801, 10560, 6151, 17280, 28809, 16992,
+    12930, 28719, 12900, 5628, 12528, 12814, 17296, 28745, 32870, 16777, 12994, 6058, 32904, 8489, 12802, 28813,
+    28750, 28693, 28800, 32937, 12790, 12823, 8480, 32802, 11103, 17140, 32908, 28743, 12943, 12768, 20490, 28730,
+    16699, 28730, 6327, 17071, 8489, 28796, 12706, 9599, 28722, 16683, 28784, 12790, 11844, 16682, 12886, 32820,
+    16621, 12623, 17410, 6432, 8778, 13027, 32868, 32883, 28755, 17220, 32884, 32880, 17132, 13123, 11356, 10161,
+    10554, 10558, 13038, 17172, 28679, 32869, 28765, 12802, 11151, 10261, 10760, 32931, 12502, 17149, 28762, 12942,
+    32779, 9376, 17218, 20487, 11349, 10751, 12683, 11608, 10460, 13027, 9657, 11610, 32867, 32870, 13188, 16933,
+    11411, 11700, 17061, 16451, 12825, 9067, 20488, 12912, 11466, 12442, 16462, 32854, 28764, 12717, 28806, 12779,
+    12828, 20488, 12944, 11733, 32856, 9986, 10461, 32882, 10274, 28763, 13041, 20487, 12516, 9358, 28776, 17410,
+    12921, 11105, 12335, 17378, 12900, 28759, 12910, 12634, 32870, 13088, 12648, 9388, 32870, 12694, 13139, 13126,
+    12027, 12621, 16620, 28688, 32904, 9975, 8789, 9666, 12994, 9983, 17172, 13030, 32871, 12900, 28755, 13040,
+    12875, 17140, 12766, 13091, 32931, 12028, 10188, 10797, 12515, 12887, 10262, 17405, 11647, 8488, 28769, 12825,
+    28777, 32931, 17061, 12864, 16993, 12802, 28757, 32827, 13018, 28731, 9935, 13013, 12994, 32814, 12717, 32857,
+    9684, 12779, 11394, 11356, 32893, 12611, 17070, 16856, 12755, 11602, 17305, 12814, 17080, 28755, 32893, 28748,
+    11059, 12887, 12790, 12790, 12826, 13005, 11712, 11693, 0, 17003, 17173, 12539, 9618, 10813, 6151, 28731,
+    28750, 6391, 12802, 11058, 12813, 12744, 20488, 12392, 28733, 17305, 11143, 28800, 9917, 28765, 12295, 17289,
+    8788, 28751, 13075, 17002, 10782, 12599, 13135, 20485, 10498, 28785, 5499, 32872, 12636, 5665, 10507, 12932,
+    12944, 28730, 9918, 12719, 32881, 12947, 8779, 12840, 12932, 13050, 28796, 9087, 8722, 16620, 28762, 28801,
+    28814, 16779, 12742, 11866, 12623, 16935, 9986, 6233, 6181, 11312, 12958, 12908, 17218, 0, 11647, 0,
+    11865, 17281, 32820, 28798, 12717, 13137, 13101, 17168, 9607, 12826, 16463, 17070, 28799, 5665, 12552, 12455,
+    12920, 9687, 28796, 10217, 32870, 32867, 11442, 11104, 12828, 10805, 17072, 12624, 28684, 12740, 13147, 28713,
+    32932, 16726, 32871, 12983, 12838, 12707, 32868, 28796, 17158, 11686, 28680, 32828, 9078, 11647, 13050, 17281,
+    9918, 10805, 12888, 28781, 11412, 28771, 17132, 10162, 17002, 17095, 32898, 28766, 6056, 32857, 17071, 28731,
+    11977, 11648, 12695, 32870, 16924, 32882, 12587, 11647, 6355, 12931, 10515, 12815, 12708, 10805, 9919, 12719,
+    16457, 12498, 20486, 13150, 16835, 12599, 6188, 12587, 13139, 8480, 12622, 10814, 12852, 28811, 12874, 6058,
+    28729, 16845, 10208, 12815, 32778, 28800, 13051, 11693, 11159, 12696, 11899, 17011, 12921, 11096, 28789, 28796,
+    12802, 10207, 12801, 10498, 12623, 11735, 12538, 28752, 9376, 13065, 17071, 13020, 12864, 12802, 12588, 11647,
+    28820, 13126, 12648, 32881, 12502, 12563, 17003, 16937, 12790, 12456, 13065, 28766, 12995, 28800, 17158, 11693,
+    32831, 17219, 13020, 6186, 11167, 17298, 28798, 16857, 13062, 11357, 10461, 28785, 12909, 13150, 11058, 13089,
+    10207, 28766, 11693, 16752, 9918, 17149, 13152, 12708, 12920, 12812, 12078, 9687, 28766, 16993, 28727, 10852,
+    12780, 12719, 28769, 10162, 12345, 13138, 17071, 28775, 32846, 28766, 13056, 6181, 28689, 10806, 16617, 12695,
+    12839, 13075, 16857, 11357, 28718, 9088, 28765, 32893, 10797, 28798, 11104, 28789, 28700, 12754, 28750, 13053,
+    10797, 20490, 11902, 28784, 12767, 13198, 16923, 32935, 32871, 32846, 32867, 17002, 12576, 28781, 17219, 12621,
+    6439, 12909, 0, 13151, 12755, 12756, 28729, 11112, 12944, 12813, 12672, 28754, 11603, 8787, 12791, 12718,
+    12826, 12960, 17159, 13007, 12983, 6144, 9686, 11468, 12527, 9674, 12838, 17238, 28799, 11742, 12623, 10570,
+    28825, 16594, 17003, 28785, 12922, 32932, 10461, 9321, 32906, 12946, 12934, 12540, 6233, 10878, 28755, 8458,
+    10157, 12932, 32867, 12911, 28799, 12514, 28720, 13212, 32931, 28733, 17171, 28762, 12671, 17159, 13051, 16490,
+    28732, 17237, 6438, 20487, 17080, 28732, 8789, 12803, 8722, 8778, 28696, 12671, 28794, 17411, 17072, 5666,
+    13090, 12635, 12610, 28782, 28776, 12908, 10208, 28800, 28731, 16983, 8779, 13020, 17012, 12826, 11647, 11057,
+    6455, 5666, 12921, 8490, 32932, 32932, 9446, 10216, 17001, 28753, 8233, 11358, 17228, 6447, 16936, 28799,
+    17228, 28815, 28772, 12720, 17015, 9676, 10507, 12826, 28785, 28731, 12720, 28752, 13052, 16459, 13188, 28798,
+    28764, 12780, 13128, 12971, 16914, 28785, 12893, 13006, 12573, 11152, 28758, 12720, 32935, 11059, 6188, 13104,
+    16904, 12911, 32804, 28812, 13074, 13124, 28675, 11655, 10217, 12684, 28751, 32881, 11411, 32921, 11656, 32846,
+    16924, 32932, 6408, 6364, 17159, 28724, 28793, 12790, 11403, 17090, 11358, 11701, 28788, 11648, 13042, 28732,
+    28811, 32936, 12593, 16461, 12923, 16846, 32908, 28751, 28741, 32896, 10264, 32832, 9386, 13088, 9687, 9175,
+    32792, 11765, 28742, 12367, 6327, 28789, 5674, 11395, 28684, 32880, 12812, 13064, 12731, 28709, 12696, 11412,
+    12695, 32932, 6234, 17169, 28762, 28679, 8250, 9965, 10217, 12801, 12911, 20489, 28778, 28711, 13140, 28684,
+    6218, 28787, 12372, 12744, 32883, 11349, 16620, 28700, 32918, 11113, 10579, 17004, 28800, 17220, 16924, 28761,
+    11443, 28806, 32933, 28685, 11978, 11404, 16936, 28773, 16937, 28755, 17004, 12717, 10797, 12719, 28676, 11481,
+    28809, 13066, 13116, 5629, 32816, 17159, 32907, 28732, 12996, 10516, 12492, 20487, 28828, 12910, 12618, 6439,
+    28806, 9676, 6399, 28807, 32897, 9985, 6401, 28698, 28761, 10515, 17228, 28805, 13150, 12922, 10044, 28727,
+    9078, 10516, 17159, 17012, 28828, 20487, 11412, 28800, 28799, 17211, 28742, 13114, 9899, 10806, 8458, 12972,
+    10218, 12672, 9388, 11178, 12779, 10583, 28785, 9479, 17083, 17149, 16617, 12606, 17171, 32802, 32846, 12720,
+    17229, 6276, 13092, 13115, 13043, 16913, 12485, 12456, 12708, 28800, 28673, 32918, 6463, 12814, 17289, 32778,
+    12323, 28749, 28801, 6364, 17220, 28749, 12815, 20486, 12708, 13064, 28731, 12725, 11702, 32897, 28793, 28690,
+    32884, 12984, 17228, 12427, 8606, 12696, 16421, 12511, 10263, 13208, 28800, 12480, 32896, 16937, 28730, 12840,
+    13052, 32917, 12581, 20489, 13092, 28740, 6225, 32933, 28743, 11768, 10263, 20488, 17229, 10195, 12826, 32934,
+    10282, 12492, 17002, 12430, 12605, 32790, 13209, 10861, 11712, 32897, 17240, 17169, 12779, 12752, 9087, 11741,
+    13043, 28819, 16924, 13064, 28809, 28783, 20488, 28767, 6188, 6188, 13041, 12851, 12972, 28739, 13056, 12588,
+    28699, 12382, 12935, 28754, 12720, 32937, 11759, 13151, 13043, 9620, 28768, 13090, 10870, 9089, 17162, 8470,
+    17160, 12935, 17012, 12586, 28795, 12732, 12908, 28812, 17080, 12816, 6447, 28799, 12743, 28725, 12816, 12419,
+    28741, 28816, 13139, 28764, 9686, 13030, 13114, 6225, 12696, 16779, 12708, 11937, 13113, 12792, 12921, 28777,
+    13044, 32792, 13160, 12919, 32936, 11740, 13052, 28825, 13159, 20489, 13052, 28790, 28779, 12768, 12663, 12875,
+    13065, 32872, 28772, 11403, 9051, 12324, 17230, 11459, 32907, 28716, 20482, 32884, 13031, 28807, 12623, 6364,
+    28743, 28733, 17170, 28767, 13007, 12970, 28681, 16492, 28733, 28750, 28770, 28696, 10562, 28802, 8611, 17251,
+    28703, 13052, 13101, 12509, 28767, 13075, 13167, 28799, 13040, 13019, 11702, 16587, 11160, 28774, 16541, 12528,
+    10264, 12629, 12958, 28757, 9473, 13029, 13020, 13019, 11412, 11694, 5674, 12748, 12414, 17091, 11403, 28776,
+    12415, 13040, 12321, 13104, 12971, 32924, 28709, 6440, 32897, 12504, 10563, 12934, 13075, 28779, 10516, 12370,
+    12945, 16429, 28677, 10255, 13197, 28797, 10260, 11711, 13041, 13113, 12636, 9767, 10815, 13054, 9986, 8769,
+    28724, 13127, 28777, 28789, 28692, 12075, 12875, 16937, 11694, 28775, 28694, 13149, 17091, 12947, 28801, 12864,
+    12744, 32804, 17013, 9964, 12827, 12751, 28694, 12886, 32789, 12803, 17083, 11403, 12772, 10273, 12040, 12298,
+    12816, 32898, 11711, 13064, 32791, 12394, 13079, 32871, 28759, 12526, 32779, 28796, 13159, 28808, 16507, 12851,
+    32831, 12696, 13104, 28800, 10870, 17306, 12911, 10879, 28704, 28819, 32882, 9248, 13114, 13042, 13152, 28709,
+    10272, 28774, 12406, 13054, 12514, 12816, 32908, 13040, 0, 12816, 13052, 28757, 28811, 9254, 13079, 13167,
+    11115, 12912, 12660, 28742, 28759, 12322, 9367, 32910, 11161, 32792, 13067, 28766, 28811, 28739, 13008, 28827,
+    28688, 9854, 28791, 13116, 28753, 11702, 10573, 10862, 13089, 16830, 13053, 12528, 28787, 32935, 13028, 12346,
+    13043, 20486, 32793, 16729, 28811, 28765, 12828, 17013, 12684, 12815, 12900, 13041, 12864, 12833, 17172, 28684,
+    9377, 12660, 32937, 12984, 11657, 12581, 12753, 11180, 28697, 13140, 28819, 20489, 12899, 28782, 28721, 28712,
+    12946, 17162, 12946, 32859, 11414, 12720, 13152, 12708, 10571, 12899, 12526, 12648, 28732, 12358, 28802, 12756,
+    28756, 16419, 12837, 16500, 11983, 12528, 16492, 28776, 32937, 11451, 12827, 11992, 9256, 12720, 17250, 11103,
+    12707, 32792, 6234, 12912, 12780, 12786, 28796, 28724, 32910, 16657, 32858, 8405, 16436, 17411, 12296, 28808,
+    32779, 13195, 10816, 6226, 28725, 17354, 13008, 17016, 10274, 28725, 28692, 28821, 9287, 28812, 10517, 13078,
+    10583, 12804, 32918, 12475, 32917, 12648, 28694, 28794, 20487, 28745, 32906, 12009, 32831, 13206, 17248, 13159,
+    12707, 11657, 16799, 12852, 12828, 16857, 17319, 8854, 16492, 12923, 11460, 28775, 28680, 11766, 12038, 12875,
+    12603, 9899, 28735, 12570, 12888, 10516, 32804, 13168, 8487, 12430, 28755, 28696, 13139, 20486, 16587, 10862,
+    16587, 12040, 28810, 16821, 10870, 13043, 16735, 28801, 10862, 28687, 28699, 10284, 8312, 11152, 11765, 32802,
+    28779, 32804, 10517, 13222, 17332, 28714, 28733, 13052, 11776, 12887, 16737, 9620, 8752, 13197, 11412, 13115,
+    11946, 6401, 12309, 13125, 12677, 6410, 17251, 12310, 12876, 11113, 32911, 11985, 0, 17239, 13056, 32819,
+    17139, 13139, 12452, 11711, 32780, 12924, 10573, 0, 9502, 12009, 17162, 12936, 32868, 16579, 12867, 28805,
+    12311, 6364, 13079, 10872, 32820, 12453, 11909, 12503, 17252, 13042, 16666, 9965, 9986, 28815, 12501, 9518,
+    12623, 12708, 20483, 11703, 28681, 28796, 28681, 32885, 12322, 8313, 10272, 10101, 28714, 11779, 10659, 17170,
+    10282, 13103, 32910, 12935, 13043, 32909, 16685, 13184, 16509, 10581, 16586, 12297, 13055, 11703, 9985, 28732,
+    9089, 32885, 10284, 0, 12055, 28810, 17015, 9478, 13076, 12451, 12623, 0, 10947, 28758, 12561, 28791,
+    11711, 12947, 12396, 8404, 28736, 10572, 13169, 12395, 32840, 32918, 12371, 28787, 28723, 11081, 12343, 16858,
+    32898, 28799, 28724, 16430, 28705, 11712, 10880, 17170, 28734, 8993, 12592, 12522, 12552, 28757, 10584, 4311,
+    20483, 12454, 12593, 8953, 16935, 28791, 32803, 12308, 16753, 13067, 32910, 28807, 8718, 9153, 12696, 4405,
+    28722, 0, 9986, 28808, 17307, 10264, 9687, 12323, 17092, 32884, 28814, 28742, 28755, 28675, 12763, 10273,
+    28810, 9964, 6448, 9387, 11984, 12321, 16840, 8349, 12828, 12912, 28808, 16499, 17238, 12760, 11946, 32827,
+    28778, 17376, 28810, 17173, 0, 12756, 13195, 6465, 8656, 28712, 13104, 16451, 13025, 17398, 32923, 28784,
+    12946, 12406, 28716, 16514, 0, 16607, 32885, 32852, 13065, 9687, 28814, 6410, 11910, 32830, 12732, 16506,
+    28722, 32828, 11909, 32818, 12635, 10582, 13114, 13043, 12480, 13016, 13136, 16743, 13115, 32827, 12405, 12380,
+    28697, 32859, 9209, 32832, 12535, 13066, 28679, 12737, 9986, 17169, 12333, 28724, 32937, 12852, 12356, 12403,
+    32817, 28687, 16667, 12370, 11115, 9388, 13067, 12522, 13206, 8790, 12924, 13205, 12828, 28713, 32918, 13194,
+    32791, 28756, 8555, 28801, 32885, 13092, 28802, 10272, 17071, 12843, 13101, 0, 12876, 28688, 28687, 12945,
+    28822, 10880, 28803, 12480, 28737, 28819, 28705, 17171, 13102, 28733, 12593, 11035, 10582, 0, 13151, 12344,
+    28802, 10285, 13152, 32827, 28682, 28822, 28817, 8577, 20485, 32856, 9539, 12749, 12534, 16440, 16506, 16795,
+    32831, 28794, 17095, 11152, 11170, 12343, 8711, 9175, 28680, 10106, 13194, 17353, 16675, 17359, 16858, 28721,
+    10872, 32775, 13078, 28683, 13092, 32871, 12708, 13206, 16588, 12984, 13090, 28738, 28828, 16586, 28697, 12965,
+    11179, 32817, 32842, 12380, 16744, 32804, 12609, 17174, 8583, 12391, 16518, 28702, 11451, 28748, 32776, 28815,
+    32794, 9986, 12800, 17173, 17251, 9181, 10872, 32793, 17308, 11985, 12936, 4468, 13176, 8349, 17093, 12298,
+    13171, 11170, 9986, 12924, 28728, 28747, 16430, 32840, 12684, 12358, 12427, 10883, 32818, 13149, 16430, 6466,
+    12880, 11711, 9585, 32790, 8618, 28689, 16959, 20483, 10882, 28703, 13032, 32895, 11778, 0, 12792, 20484,
+    11169, 13078, 28812, 10583, 16685, 10572, 16578, 17240, 12489, 13151, 32817, 4822, 12480, 13207, 12630, 17249,
+    13139, 16598, 32829, 28756, 28806, 13053, 12876, 28699, 32911, 10871, 13196, 10883, 17241, 13044, 28726, 13055,
+    28717, 10582, 16528, 8320, 11701, 28688, 16737, 28728, 28705, 28751, 32919, 32791, 28745, 28727, 8612, 32777,
+    32827, 28733, 11459, 12725, 28712, 11480, 17094, 12348, 11013, 9293, 8404, 28743, 12406, 16852, 20482, 20484,
+    28735, 8396, 12676, 12749, 12947, 17394, 16527, 12936, 28768, 12415, 28736, 13139, 17299, 12857, 8584, 6410,
+    28674, 20484, 17095, 12370, 8744, 8490, 12972, 16753, 0, 20490, 28695, 17250, 16618, 12311, 17331, 9546,
+    12380, 20484, 32817, 9285, 28710, 8313, 8320, 20481, 13149, 12357, 12583, 16588, 12346, 16737, 16677, 32840,
+    8491, 28803, 16873, 28756, 28709, 12487, 10285, 17071, 13116, 13184, 28756, 13104, 13199, 13128, 32841, 12975,
+    17318, 32804, 6448, 13138, 20486, 32832, 32844, 8655, 11910, 10881, 9972, 12335, 11758, 28746, 8350, 8440,
+    13148, 12441, 28739, 28817, 28821, 12394, 8853, 28744, 16774, 32806, 9503, 0, 8988, 8962, 13076, 12492,
+    12876, 32804, 16687, 28679, 13025, 5673, 11955, 12065, 32793, 13160, 13163, 20484, 12333, 12912, 11469, 12492,
+    6457, 9088, 12768, 32829, 28717, 11769, 12773, 9687, 17250, 28677, 13173, 12776, 12631, 16776, 32936, 28705,
+    12534, 13016, 13208, 28685, 16665, 12322, 16461, 16831, 8757, 0, 16509, 13126, 12432, 16517, 28722, 32832,
+    16429, 32910, 12666, 9540, 6465, 28736, 28768, 12572, 16851, 32859, 12322, 28710, 8613, 6465, 28687, 9560,
+    16438, 12010, 28712, 12558, 32829, 32881, 32921, 12987, 16448, 28748, 12754, 12845, 11180, 12648, 11179, 9860,
+    28785, 8321, 4614, 13114, 12311, 28701, 28803, 12312, 12406, 8423, 32819, 28823, 9963, 28735, 28730, 16687,
+    10573, 13079, 11478, 8656, 11768, 13140, 12451, 32843, 28772, 13116, 28741, 28815, 12980, 8612, 16667, 28716,
+    28768, 12540, 28709, 12727, 12677, 12920, 12571, 32789, 28822, 12720, 28733, 16932, 32807, 16598, 12512, 12383,
+    8613, 32919, 6410, 9204, 12432, 11171, 16937, 32828, 10583, 11767, 11910, 13140, 12368, 12750, 12849, 32804,
+    13196, 12370, 11181, 5557, 28799, 12720, 12406, 16823, 12534, 12068, 16526, 16816, 9676, 16763, 28691, 13174,
+    16815, 9540, 16609, 12526, 28822, 32898, 11776, 10642, 20490, 16538, 12996, 12075, 28759, 28808, 11219, 16685,
+    12041, 28798, 8966, 12334, 5645, 28809, 16588, 13162, 28815, 16695, 28704, 16457, 12644, 17307, 6387, 16608,
+    12785, 12835, 9860, 12369, 28725, 12695, 32859, 9510, 12428, 32817, 11759, 32820, 12406, 16528, 11955, 16874,
+    16606, 16518, 13160, 12322, 20484, 17317, 32922, 20490, 16605, 12585, 17319, 12499, 8718, 32819, 12417, 17384,
+    11182, 32817, 12383, 10247, 16506, 17368, 13185, 12502, 13092, 8955, 12852, 9551, 9751, 6456, 16461, 16540,
+    12898, 28703, 28725, 12297, 12881, 13044, 32921, 16509, 28739, 6447, 28717, 12405, 13151, 13183, 12834, 28716,
+    28825, 32780, 16746, 12453, 12442, 12871, 28758, 16458, 16598, 16606, 12501, 32806, 0, 16879, 13150, 32842,
+    32829, 20481, 16438, 13128, 17330, 28749, 17327, 32845, 32909, 12632, 32911, 11956, 17016, 8695, 10426, 13207,
+    17320, 13218, 12312, 13044, 17095, 17411, 32780, 12335, 12671, 12690, 16808, 12345, 16529, 32920, 28704, 13067,
+    12559, 16948, 28683, 6402, 12835, 32806, 9293, 16677, 13065, 13164, 13206, 12359, 17252, 16744, 16666, 11947,
+    28768, 12762, 16492, 17368, 28697, 12488, 4869, 13224, 28792, 28724, 28760, 28823, 13196, 32780, 16737, 9210,
+    28697, 13104, 13209, 28814, 16448, 12574, 11778, 8395, 11481, 8994, 11778, 20484, 16686, 12358, 4949, 12525,
+    16735, 13013, 12383, 32806, 28820, 4949, 12864, 12395, 16596, 12466, 11780, 12802, 32780, 16509, 28694, 12299,
+    28714, 28704, 12001, 9372, 9293, 12334, 13211, 9860, 12525, 12727, 10582, 12465, 12465, 28792, 28771, 12595,
+    17331, 16925, 13008, 12696, 12011, 11478, 32921, 12596, 12891, 11057, 8350, 6466, 10071, 12453, 13150, 8620,
+    28726, 28760, 32793, 13056, 12691, 12465, 28748, 28746, 28679, 28730, 28719, 32807, 11955, 12001, 16846, 12417,
+    12500, 28700, 20484, 28703, 12384, 28699, 28761, 13174, 12345, 16816, 16766, 28689, 11759, 32806, 32792, 28691,
+    12056, 17160, 28738, 9780, 12880, 16519, 20481, 13056, 13173, 9850, 32921, 4884, 9085, 28735, 16687, 9640,
+    12643, 28704, 12967, 32852, 28795, 16754, 12503, 13164, 16609, 28803, 28715, 28780, 28767, 28761, 12707, 12477,
+    12501, 12336, 12295, 12656, 32794, 17320, 28734, 12504, 16853, 28815, 8285, 28682, 32794, 16530, 16538, 16448,
+    12535, 20484, 28740, 32905, 9294, 12508, 12358, 16688, 12876, 28682, 32832, 11758, 28733, 12478, 16438, 16539,
+    8720, 8650, 12561, 16649, 28675, 13164, 32923, 0, 16571, 28681, 16685, 16449, 12407, 20490, 10364, 0,
+    13091, 13212, 12427, 16667, 12443, 32819, 28750, 8351, 32779, 32807, 28813, 32793, 12456, 28681, 12862, 32832,
+    12936, 16498, 13152, 12442, 28718, 32833, 28727, 13092, 11954, 10871, 28688, 32833, 11481, 28721, 28703, 12048,
+    12595, 12751, 32792, 5340, 9974, 10838, 12443, 16676, 12727, 17062, 10183, 16457, 12859, 12512, 28740, 11767,
+    13080, 0, 12466, 12763, 12936, 28726, 11993, 11779, 28821, 9316, 12523, 9614, 28694, 20481, 13185, 32820,
+    9618, 16460, 12888, 20485, 28712, 11955, 12466, 16843, 32794, 28804, 16816, 12384, 9481, 28691, 32778, 28819,
+    12584, 13208, 28725, 13163, 32778, 28700, 28726, 28679, 13162, 8949, 16892, 28813, 11403, 28761, 28715, 9058,
+    28712, 10183, 28757, 16530, 28726, 8657, 17210, 11768, 28818, 12656, 8584, 32826, 12948, 8368, 28761, 28706,
+    28744, 11778, 16540, 11777, 28694, 13174, 28740, 9780, 28723, 12489, 17173, 8285, 28692, 4976, 16843, 13164,
+    4948, 28725, 9615, 12366, 12563, 32937, 12296, 9555, 28741, 17375, 28785, 12476, 12347, 13197, 12740, 11480,
+    28710, 28755, 13068, 17409, 8703, 28675, 17218, 4966, 12311, 11777, 12803, 13174, 9240, 17332, 32781, 12670,
+    28785, 11758, 9255, 13186, 28683, 4720, 28823, 13092, 12324, 32778, 17361, 11750, 32819, 28714, 28707, 12010,
+    12310, 11955, 16728, 28685, 5048, 12076, 32853, 13196, 12467, 16835, 11947, 17328, 17330, 13211, 12419, 8666,
+    8321, 28722, 8367, 12408, 16687, 13080, 32830, 13209, 28722, 12309, 12455, 16617, 9517, 28735, 28773, 12467,
+    12324, 28733, 12550, 9374, 13091, 28769, 12996, 8666, 8413, 28691, 9219, 12444, 32934, 13147, 12333, 12311,
+    28792, 12575, 13208, 28688, 9388, 12443, 28680, 11590, 28689, 28714, 16527, 12360, 16835, 12001, 16835, 32921,
+    13152, 12521, 16519, 17361, 8666, 8964, 12777, 12977, 12324, 17095, 13198, 11181, 28692, 13151, 6466, 28804,
+    28748, 17331, 12419, 16650, 12996, 32872, 28736, 12954, 28694, 17368, 28722, 16688, 16608, 11268, 12463, 28689,
+    12002, 28808, 12336, 9672, 32794, 12049, 28722, 12766, 20484, 16728, 28792, 13174, 16648, 12607, 13211, 12455,
+    32818, 16499, 28732, 32936, 17196, 8880, 12058, 16457, 9348, 28741, 28802, 28682, 12467, 12728, 13174, 32781,
+    10370, 12586, 12477, 12348, 9255, 12068, 17387, 16578, 12783, 28818, 32790, 12509, 28765, 28737, 12859, 12076,
+    9342, 8421, 9517, 17329, 17368, 32923, 32794, 12681, 28773, 13018, 11779, 16537, 8411, 13001, 12667, 13174,
+    16766, 11481, 10027, 16537, 16616, 28715, 28820, 28683, 12427, 28690, 28821, 16676, 16885, 28756, 28730, 13186,
+    32842, 28772, 12668, 13211, 28811, 16852, 8420, 17405, 12989, 11769, 28695, 12077, 16766, 28734, 11766, 13004,
+    16608, 12538, 12645, 13187, 16676, 28691, 12049, 13208, 13219, 12607, 13068, 28713, 12681, 16460, 16835, 28726,
+    28715, 9518, 16842, 28712, 12860, 12067, 20484, 10698, 8765, 16608, 12802, 16696, 12528, 28683, 32844, 5426,
+    28703, 9294, 12876, 12549, 32807, 8965, 9593, 10370, 32843, 16775, 28775, 9564, 8713, 28727, 8421, 32794,
+    28806, 11769, 12336, 5427, 12396, 12777, 17394, 10969, 28715, 12468, 10648, 28755, 12057, 28824, 12739, 16528,
+    28737, 28820, 16775, 12536, 10106, 9203, 28687, 28711, 8249, 32852, 11291, 11778, 8759, 28745, 20481, 28780,
+    16844, 28750, 28727, 10400, 12847, 16767, 16528, 12967, 28772, 9642, 9510, 12347, 12418, 28742, 12825, 4955,
+    32842, 12609, 11240, 9301, 16677, 16908, 20485, 10538, 12489, 28773, 28729, 16696, 12585, 32820, 28748, 8712,
+    28755, 28683, 28737, 17376, 13220, 12455, 12572, 28766, 12012, 32820, 17331, 28733, 32805, 28709, 12538, 11178,
+    16775, 8712, 32806, 32841, 12681, 12429, 28747, 13163, 12466, 16539, 16509, 12452, 28820, 10437, 28729, 12528,
+    32898, 12501, 10699, 9616, 12618, 12360, 13176, 12396, 12672, 12381, 12741, 32844, 12396, 13000, 9684, 16540,
+    28801, 9350, 12753, 28747, 28729, 9012, 16755, 28773, 32879, 28793, 28677, 12775, 8413, 28734, 12609, 16519,
+    17162, 12885, 28737, 16693, 12537, 32805, 9554, 32794, 12716, 12597, 8957, 28783, 28821, 10273, 32819, 16539,
+    12442, 28703, 16451, 13220, 9073, 13174, 12417, 8479, 12752, 28823, 12336, 28747, 8721, 13116, 28720, 9562,
+    20483, 32843, 32780, 28773, 16438, 16853, 16609, 28727, 28714, 13146, 16699, 12741, 9547, 16540, 9654, 10699,
+    17410, 11246, 12680, 12468, 8358, 5069, 12646, 12335, 9019, 28722, 16597, 13187, 12442, 16607, 12586, 16756,
+    8920, 12730, 0, 16462, 16618, 12456, 9671, 12067, 9301, 12754, 28729, 17385, 32832, 28719, 12979, 8667,
+    12618, 28699, 20490, 16965, 9301, 28707, 10968, 16616, 13014, 5360, 28812, 9564, 16518, 12883, 28785, 10996,
+    17062, 28819, 28823, 28689, 8452, 12979, 28713, 16450, 32842, 32924, 9954, 28720, 8453, 28762, 32819, 12502,
+    5097, 12408, 28823, 9264, 8477, 12966, 9601, 28749, 16571, 8250, 32832, 28773, 11131, 5351, 11034, 32884,
+    9816, 9599, 10967, 17331, 28747, 13176, 28726, 28771, 28713, 28825, 13220, 32794, 28756, 12849, 9011, 12395,
+    13125, 12777, 12582, 8721, 12528, 28824, 8920, 17332, 13199, 13043, 28826, 12752, 10781, 16540, 16845, 9262,
+    8957, 12441, 32885, 5433, 17331, 32852, 12336, 12488, 16920, 20481, 12383, 16688, 12787, 12967, 9953, 20485,
+    17397, 12348, 12549, 8766, 10735, 12384, 8759, 16697, 32830, 12618, 12633, 32859, 5455, 10736, 8468, 28771,
+    12538, 32844, 12535, 28716, 16539, 13176, 20490, 12787, 28785, 12617, 16742, 13212, 28748, 32794, 28673, 28719,
+    13219, 28718, 12057, 28785, 5070, 28746, 12548, 12624, 12468, 32844, 10969, 12431, 12480, 16909, 11246, 8658,
+    16919, 8720, 32806, 28717, 28746, 12068, 28762, 11328, 16772, 9846, 12802, 28729, 28679, 5893, 28748, 9609,
+    12430, 28681, 12428, 32846, 28747, 8405, 13223, 10998, 28684, 12796, 9846, 28698, 17398, 9892, 32924, 28691,
+    16460, 16919, 32844, 13145, 12764, 9971, 12767, 12680, 12671, 9593, 12479, 20486, 32828, 17385, 0, 28784,
+    16700, 12440, 9057, 28747, 16925, 16909, 32794, 12991, 28774, 13128, 17251, 13220, 11374, 5362, 9892, 12079,
+    32870, 28745, 12077, 28768, 12993, 12586, 17116, 32898, 5455, 8413, 28784, 16853, 17269, 28738, 12797, 5987,
+    11034, 28818, 9846, 12489, 32894, 16463, 8320, 28782, 28738, 8704, 17016, 32778, 11267, 32819, 10077, 28813,
+    28715, 12968, 16765, 16542, 28680, 32814, 10150, 12477, 12396, 32839, 9058, 12788, 0, 12444, 11328, 12343,
+    12609, 28794, 13077, 16911, 28787, 0, 9816, 13223, 28738, 28710, 12618, 12608, 28786, 28762, 28696, 28767,
+    5099, 12634, 28713, 9854, 12295, 8460, 13222, 12701, 12308, 28689, 13199, 28804, 12407, 12980, 12633, 9608,
+    16833, 8966, 12300, 16965, 9219, 12715, 16894, 28762, 12743, 12066, 12779, 28760, 28797, 32807, 28823, 8357,
+    5455, 9310, 8490, 12432, 12692, 12548, 8405, 28707, 12511, 12514, 17331, 28822, 12622, 12574, 10239, 12981,
+    12873, 16682, 12979, 4722, 13186, 9264, 32818, 28731, 9564, 12635, 8664, 10498, 32845, 12886, 12491, 16529,
+    12057, 17252, 12516, 32844, 32937, 12606, 9845, 8775, 12680, 28762, 9619, 16854, 12468, 12743, 8903, 12701,
+    9364, 28691, 28791, 9600, 9564, 8486, 28714, 32804, 20481, 12765, 16621, 9012, 16765, 9601, 16462, 16854,
+    12787, 17387, 32793, 28824, 8405, 12588, 13209, 28746, 12478, 16964, 28724, 12996, 12692, 28680, 32908, 10107,
+    28826, 28729, 17131, 12454, 12872, 9816, 12528, 9610, 28811, 12513, 16853, 28685, 32815, 9962, 12312, 12910,
+    17117, 28820, 12454, 12647, 12787, 12079, 13220, 12712, 12693, 17369, 8489, 20481, 12647, 12905, 12480, 16419,
+    16449, 16920, 28787, 11590, 28705, 20485, 9817, 28749, 32830, 12600, 28687, 9907, 12552, 11538, 10143, 12683,
+    10538, 13223, 28747, 9357, 13200, 11182, 8759, 9899, 28749, 10240, 12896, 10240, 13004, 5111, 9892, 13220,
+    13221, 12564, 28762, 12618, 12465, 32924, 8723, 16609, 32830, 28794, 17406, 12610, 12324, 28749, 28825, 12443,
+    16894, 17387, 12701, 28784, 11297, 28760, 17410, 12489, 17369, 28694, 28796, 17173, 28691, 12904, 12564, 12396,
+    17377, 12672, 9618, 12906, 28812, 12569, 12858, 12732, 12490, 28827, 32853, 12778, 32819, 12456, 17131, 12692,
+    8487, 28793, 16767, 28691, 12429, 28749, 32781, 12478, 12503, 13223, 8767, 12823, 10736, 12702, 12784, 8477,
+    28774, 9665, 9861, 32832, 28752, 28728, 12478, 17117, 17397, 12515, 9610, 28733, 16902, 9382, 32832, 12324,
+    9600, 8768, 12467, 28748, 32807, 32845, 12502, 10451, 20481, 12728, 16687, 28821, 9563, 5366, 9365, 28730,
+    32885, 28816, 28712, 12418, 10161, 12491, 9900, 32853, 17406, 16824, 12714, 9020, 12618, 12934, 13132, 12561,
+    16816, 12742, 9310, 9620, 10674, 12694, 12478, 28828, 9563, 16894, 12955, 16686, 16688, 11297, 13121, 32891,
+    12647, 12610, 12431, 12720, 8414, 28827, 12683, 17399, 9985, 16921, 12619, 10240, 12885, 12873, 8423, 12656,
+    28750, 9089, 13220, 12863, 28797, 8414, 16594, 12887, 16699, 12619, 32885, 12887, 12560, 28753, 20484, 12336,
+    12756, 32865, 12924, 16800, 12812, 28717, 28747, 8479, 13088, 28687, 32820, 10490, 28756, 12623, 28748, 12979,
+    16609, 12808, 12540, 12576, 9673, 17396, 12800, 28749, 9075, 12336, 28728, 13056, 32865, 10377, 8314, 12576,
+    16700, 10441, 12308, 28827, 32895, 16965, 9066, 16700, 12800, 4728, 17377, 9948, 28797, 5482, 9300, 32846,
+    16971, 9907, 4981, 17044, 12798, 5674, 12957, 5614, 28754, 11304, 28729, 28708, 12513, 16767, 13005, 12515,
+    17407, 16779, 9981, 11955, 8778, 28771, 12839, 12491, 16619, 17229, 12489, 12768, 12515, 16462, 9365, 0,
+    17386, 12788, 10483, 12920, 17396, 32780, 17013, 28786, 9320, 9817, 11010, 10796, 9890, 16937, 20485, 11081,
+    16767, 16699, 17378, 28769, 8469, 10412, 8322, 11757, 28677, 9908, 16542, 9909, 5614, 12619, 13005, 32894,
+    11567, 12599, 12994, 12712, 32832, 12443, 12823, 28738, 32814, 9020, 12521, 11673, 17399, 12491, 12419, 12776,
+    28774, 13176, 11334, 10114, 9022, 17172, 9011, 11545, 8469, 12768, 32879, 32853, 28684, 12885, 10704, 10713,
+    28708, 17396, 12848, 12504, 12767, 13015, 8491, 12463, 16971, 12515, 12611, 9022, 12874, 32878, 12702, 5650,
+    9817, 28827, 32934, 12479, 28787, 12863, 16616, 16773, 28759, 16923, 12344, 12468, 28690, 9607, 12740, 12741,
+    12444, 11566, 9012, 28826, 28694, 12780, 12611, 28820, 12490, 17122, 9358, 12692, 28737, 28785, 12864, 32854,
+    28704, 28793, 12789, 16440, 12898, 17269, 12729, 12515, 12755, 28714, 12384, 28680, 9085, 28710, 16542, 12993,
+    12585, 12443, 28748, 10975, 8779, 16834, 12798, 28767, 12767, 13120, 28745, 28723, 16767, 8478, 12888, 10539,
+    12822, 12321, 13015, 32854, 12611, 11566, 12455, 16542, 12442, 28740, 6144, 11103, 17227, 16902, 28748, 9948,
+    12668, 17044, 16902, 9256, 32833, 10675, 10740, 11627, 12695, 12502, 12959, 10205, 11012, 16972, 28824, 28759,
+    0, 17388, 28826, 32937, 12816, 9916, 12741, 17050, 28771, 28729, 16824, 16824, 8722, 28719, 12702, 16722,
+    9916, 17139, 8359, 32881, 28707, 12671, 8966, 13004, 9908, 28769, 12309, 11567, 17069, 10539, 28754, 10152,
+    12668, 12331, 12971, 10412, 28760, 28686, 12574, 10413, 6015, 28751, 8920, 16603, 12502, 16921, 5614, 9387,
+    16937, 12527, 32930, 12624, 8368, 17000, 13006, 12885, 32781, 12993, 12444, 9676, 32879, 12907, 28770, 16498,
+    10406, 28753, 9384, 12587, 6013, 28719, 12898, 13007, 17148, 9648, 13132, 12549, 12850, 32865, 12684, 10205,
+    28691, 13224, 9863, 11311, 12468, 12798, 28823, 17406, 28702, 9916, 10378, 10705, 12766, 5489, 16620, 11088,
+    12918, 16528, 28679, 32846, 32820, 28828, 12683, 32905, 28684, 12907, 8966, 28731, 9908, 28750, 12789, 13221,
+    13223, 28802, 12788, 12790, 9067, 17388, 12891, 20486, 0, 28729, 12694, 10145, 12478, 8487, 9375, 28679,
+    12898, 12897, 9265, 16448, 17407, 28693, 28742, 12659, 12703, 28790, 8422, 17044, 12917, 12809, 17226, 9264,
+    17398, 9674, 17410, 5491, 11480, 12780, 13025, 28754, 5650, 28746, 9088, 12969, 28825, 12768, 28758, 28758,
+    28787, 13133, 32845, 11273, 16461, 28740, 28707, 28770, 28750, 16981, 12744, 9518, 17409, 5614, 8777, 28728,
+    12887, 28786, 28773, 13016, 12503, 12504, 12922, 28782, 28782, 17121, 10837, 28740, 9321, 12585, 12897, 16620,
+    10813, 17131, 11679, 9675, 28682, 32841, 12713, 17079, 12635, 17408, 9078, 16914, 5651, 16922, 12970, 28757,
+    12513, 16992, 13023, 12995, 16974, 12888, 13024, 32907, 12946, 12919, 6015, 28692, 13026, 28742, 8422, 12978,
+    8368, 16914, 12780, 17408, 8367, 28682, 16980, 5498, 10504, 28781, 28702, 28716, 9618, 28739, 6043, 28769,
+    17407, 28800, 9374, 20485, 17202, 12527, 32924, 6044, 9674, 16914, 9085, 12620, 12503, 12680, 0, 28773,
+    12850, 16932, 12574, 10838, 16912, 16997, 10489, 9302, 28779, 28753, 8479, 16895, 12573, 8413, 12716, 13133,
+    28739, 11049, 6174, 32846, 28729, 17044, 28684, 16904, 28762, 8787, 28714, 28738, 16844, 8488, 9085, 20488,
+    16913, 12610, 12779, 12620, 12564, 28692, 12898, 32832, 12608, 13064, 12875, 5496, 28684, 28770, 17053, 16980,
+    12515, 32930, 10206, 12527, 12515, 28751, 28798, 12612, 12660, 32870, 11610, 12659, 16912, 12707, 16980, 10539,
+    12898, 12897, 16776, 28816, 12741, 13005, 28773, 10412, 12756, 5113, 20481, 28783, 12777, 28739, 10415, 32883,
+    28738, 9917, 10796, 17132, 28809, 12563, 13051, 13200, 32867, 10214, 12516, 13044, 9673, 9387, 17131, 9563,
+    12516, 17201, 11889, 8713, 12516, 12907, 17410, 8776, 10742, 13123, 12910, 9068, 12575, 12982, 13131, 12504,
+    11776, 17052, 12754, 28720, 12635, 28750, 12823, 12612, 8469, 11049, 12801, 32885, 12823, 12612, 12456, 9021,
+    10260, 9964, 12897, 12514, 12983, 10758, 12884, 12898, 9376, 17160, 12682, 32806, 8778, 11004, 12504, 8667,
+    32883, 16700, 28809, 6320, 12899, 12767, 12754, 12789, 9919, 16912, 10457, 8470, 11004, 9964, 17409, 11095,
+    9863, 13087, 11712, 32891, 28755, 11049, 0, 12815, 12672, 12791, 12884, 12744, 12981, 12862, 9089, 12731,
+    28681, 16999, 5498, 28799, 16912, 32907, 12849, 10552, 16845, 11679, 28770, 12620, 10459, 13078, 32833, 11046,
+    12384, 32867, 0, 32897, 12705, 28782, 6348, 32905, 28757, 12813, 13063, 12078, 16846, 12704, 16913, 9619,
+    28798, 9955, 8721, 12823, 12864, 28703, 28753, 9012, 28762, 17148, 12849, 12958, 12487, 17240, 5655, 16931,
+    32910, 5368, 11356, 28732, 9686, 16777, 28732, 9963, 12732, 32867, 12715, 11573, 32833, 32937, 12823, 28827,
+    5491, 16463, 8480, 10882, 12887, 12822, 28781, 13134, 5591, 13128, 16736, 12970, 9948, 12983, 28807, 0,
+    12480, 28764, 12480, 12671, 12800, 17053, 11042, 28775, 17053, 28737, 12708, 12636, 16903, 12968, 10206, 12379,
+    11701, 16779, 17139, 16462, 11012, 28752, 9384, 12984, 28749, 28799, 32819, 28742, 8368, 28752, 12624, 10116,
+    16922, 28746, 12065, 13146, 28774, 12695, 8414, 16450, 32868, 9686, 12642, 16934, 12791, 16779, 20487, 28758,
+    9919, 11340, 28727, 9685, 16698, 16537, 9022, 13008, 12716, 12417, 16983, 10452, 10573, 12611, 16904, 9955,
+    12467, 8788, 17158, 32904, 10544, 12959, 16974, 11302, 12490, 16936, 28717, 12620, 17092, 32857, 12564, 12621,
+    28740, 9088, 12823, 32844, 0, 12431, 5926, 32898, 17079, 28744, 12920, 20487, 28765, 32924, 32904, 9366,
+    12888, 28788, 32804, 10452, 17140, 28785, 9973, 28729, 0, 28784, 32869, 16923, 28762, 11411, 28748, 28754,
+    12431, 12767, 28690, 12778, 9972, 12515, 28714, 9970, 12756, 11274, 10214, 17399, 16991, 28772, 32924, 8423,
+    10153, 12863, 12873, 11435, 17386, 6144, 17062, 28753, 13026, 12910, 12717, 16854, 16778, 10805, 6350, 12468,
+    13037, 0, 9917, 12455, 28730, 0, 28787, 9917, 9068, 28773, 12852, 10116, 28813, 12610, 5490, 9386,
+    12492, 12743, 28682, 13026, 12501, 11638, 17169, 10460, 28797, 12718, 9059, 10869, 28808, 32820, 6217, 28786,
+    11311, 6174, 10511, 0, 28809, 10452, 10452, 10497, 12609, 13038, 28777, 13136, 8778, 28776, 0, 12432,
+    16991, 12441, 9089, 8948, 32883, 32934, 12718, 6211, 11013, 9377, 12551, 11050, 8414, 13112, 17069, 13011,
+    12900, 32829, 12885, 28727, 11349, 28757, 17001, 32816, 28771, 13018, 13017, 12800, 8723, 28781, 9086, 9982,
+    12416, 12503, 28696, 32880, 32894, 13037, 5665, 11709, 28772, 17060, 0, 9972, 17275, 12704, 28693, 11348,
+    28755, 12919, 28809, 11050, 12802, 9676, 9675, 12931, 12811, 6321, 32857, 8641, 32870, 28814, 12912, 11341,
+    12516, 12480, 32881, 13066, 16895, 17410, 28698, 13176, 17237, 10269, 12779, 28777, 11312, 28695, 12504, 20487,
+    8899, 28741, 12774, 28690, 16778, 12717, 13005, 13017, 11142, 8489, 17141, 11700, 8768, 9956, 10452, 16982,
+    17240, 28808, 12930, 6218, 32936, 12504, 9973, 12968, 11115, 32833, 12814, 10460, 5621, 16451, 13136, 0,
+    13199, 12802, 13039, 12790, 10208, 28765, 28714, 12719, 13188, 12803, 32880, 32879, 11572, 12840, 32859, 17141,
+    17140, 9963, 9387, 11640, 9311, 12372, 28750, 16923, 32906, 12369, 16779, 10161, 28759, 32935, 11144, 16728,
+    28765, 9909, 28774, 12456, 12814, 9620, 6387, 10268, 16688, 12958, 20488, 28741, 28769, 28774, 20488, 12825,
+    8723, 12624, 28798, 17211, 9965, 32870, 16925, 12513, 6211, 12800, 12444, 10759, 12717, 16621, 6411, 16923,
+    11394, 16936, 12765, 12682, 28760, 10452, 28696, 9676, 9022, 12645, 10247, 28797, 28720, 12801, 28714, 28783,
+    13199, 28776, 17008, 12504, 12609, 32932, 12923, 10714, 28804, 12563, 13007, 11050, 28746, 17151, 12932, 12528,
+    16925, 10162, 12910, 12526, 17158, 28732, 28784, 12933, 16855, 13091, 12789, 12456, 12971, 20486, 11394, 10217,
+    32820, 12717, 11151, 28770, 9084, 16993, 8777, 32832, 12599, 28738, 9068, 12862, 28689, 12910, 11712, 12898,
+    12528, 32855, 5620, 12480, 28748, 12707, 6021, 12993, 32895, 28765, 11684, 11602, 9918, 16936, 13027, 12648,
+    9675, 11356, 17161, 20488, 9059, 32871, 11312, 12768, 12696, 13163, 12898, 17062, 17410, 12924, 28824, 28769,
+    12420, 9956, 12792, 6320, 9620, 32871, 16992, 10805, 12719, 32845, 12718, 13017, 5928, 9366, 12720, 13224,
+    8769, 28695, 12755, 32857, 32885, 10760, 11149, 12887, 12888, 10545, 12932, 12813, 32845, 12792, 17149, 17316,
+    28783, 32868, 6321, 32881, 12766, 13051, 9619, 9687, 12480, 16913, 20483, 12456, 9965, 12539, 11411, 12718,
+    11143, 12468, 13114, 8723, 12526, 12944, 16700, 12342, 12623, 12492, 32781, 32883, 32884, 28800, 28787, 12957,
+    28775, 6409, 8965, 28723, 32882, 28772, 9684, 17140, 6387, 32801, 32845, 17410, 12922, 11349, 12732, 28747,
+    13075, 28793, 32931, 17227, 13112, 28762, 12647, 28801, 32857, 12623, 32793, 28786, 32905, 32895, 16700, 16461,
+    32820, 12432, 12887, 11610, 12646, 32880, 12803, 16924, 12492, 9078, 9078, 11096, 17002, 13125, 12552, 28765,
+    13019, 17071, 28754, 12933, 28801, 12552, 28729, 12815, 11844, 28815, 28801, 10852, 10814, 11144, 28753, 10714,
+    28781, 12947, 12731, 28763, 11142, 12432, 10570, 28795, 9076, 12815, 12563, 13089, 11865, 17410, 12780, 32932,
+    13100, 12774, 11603, 10270, 9965, 17228, 28799, 11710, 16904, 12456, 9545, 20487, 8790, 17080, 8479, 9388,
+    16596, 12623, 32936, 20490, 17227, 32831, 32883, 32932, 12995, 12755, 11573, 10517, 32924, 12516, 12576, 32883,
+    12371, 13090, 17159, 28798, 17410, 20487, 28690, 28765, 0, 5674, 9676, 28799, 28696, 12527, 11410, 12943,
+    17062, 12624, 32906, 12588, 10216, 12982, 11684, 28725, 17003, 16587, 9973, 10759, 12684, 28802, 28781, 6225,
+    11601, 11058, 20481, 28825, 13087, 12382, 32937, 17411, 12717, 13114, 6409, 20487, 28800, 13138, 20488, 28787,
+    28784, 12611, 11610, 6408, 28744, 28787, 10516, 13074, 0, 13008, 11349, 16856, 13199, 12647, 28785, 13103,
+    28740, 12335, 11889, 12992, 10273, 12994, 12515, 12428, 17150, 12996, 12924, 6464, 28786, 12814, 13138, 12920,
+    13019, 10285, 11573, 12600, 28773, 16937, 8479, 12587, 12695, 32882, 0, 12993, 12960, 10255, 13224, 10852,
+    9965, 28681, 10199, 9918, 9610, 28782, 12707, 32871, 28748, 28806, 12484, 13139, 12767, 5629, 13138, 28681,
+    11395, 32908, 8854, 12960, 17010, 28674, 11104, 32896, 28766, 12636, 12612, 12932, 11932, 17071, 12996, 28767,
+    10216, 28788, 17348, 12576, 13063, 9973, 16934, 12427, 32870, 17171, 16935, 10218, 32924, 12912, 12825, 13099,
+    28712, 13137, 13115, 10860, 12647, 13055, 28761, 9687, 17411, 12911, 28828, 32908, 16911, 12592, 12792, 28776,
+    10806, 12684, 28787, 9956, 11610, 32842, 16935, 12922, 17320, 13020, 16420, 9975, 13079, 12922, 12755, 12923,
+    12838, 32789, 16934, 11151, 32827, 11458, 12887, 12791, 17062, 17093, 12910, 16845, 6188, 9089, 12730, 20489,
+    12420, 8712, 9619, 28816, 12504, 17150, 28800, 17081, 10805, 11932, 28777, 10279, 17228, 13078, 10813, 28722,
+    13103, 12480, 12719, 28797, 32881, 16666, 32924, 32937, 11640, 32883, 13006, 12943, 16934, 11656, 13042, 0,
+    28720, 17316, 11441, 12552, 12380, 11611, 32935, 32936, 9983, 8789, 11395, 32883, 12432, 12528, 8489, 17162,
+    28789, 12945, 12647, 17219, 12564, 8313, 17082, 13124, 12946, 28828, 12815, 11413, 12875, 17160, 28679, 12514,
+    28723, 16858, 32846, 28765, 28797, 17399, 9087, 17236, 13100, 32870, 12920, 32840, 32905, 28675, 12429, 13054,
+    28720, 8555, 12492, 28737, 0, 12516, 28768, 5629, 28824, 12383, 0, 13006, 9862, 8788, 12420, 12323,
+    9516, 28763, 10217, 28791, 17409, 13212, 13055, 12768, 32883, 32880, 17091, 11476, 12826, 13148, 32898, 28804,
+    12921, 17230, 9965, 32871, 16937, 13018, 13092, 28828, 13212, 11412, 32846, 11411, 28742, 16765, 28732, 12576,
+    28797, 28794, 8489, 12780, 17081, 16924, 12771, 17150, 32846, 9388, 28690, 17315, 11168, 32937, 13091, 32883,
+    28763, 9235, 8648, 11395, 28684, 32910, 6463, 12945, 0, 12803, 32909, 32818, 10563, 13133, 28759, 28812,
+    32935, 28778, 28775, 12899, 12456, 12696, 11104, 6218, 11656, 28702, 32910, 0, 6455, 13040, 28779, 12804,
+    17219, 5666, 4677, 16728, 12900, 28757, 28741, 28782, 13157, 12825, 12972, 0, 9905, 32844, 13040, 28774,
+    12946, 12699, 10880, 8649, 12696, 10853, 28701, 11442, 13136, 12492, 12909, 9089, 12792, 16430, 6409, 10281,
+    13042, 28676, 28678, 11412, 8285, 13148, 11480, 13066, 13063, 11403, 16936, 17160, 10153, 28790, 13052, 11611,
+    11178, 32870, 13092, 13171, 28825, 10562, 32820, 12897, 11403, 32896, 16935, 28788, 12792, 28780, 12499, 28677,
+    0, 8779, 12564, 10218, 10583, 0, 12945, 28793, 13101, 28781, 32896, 13053, 5674, 0, 32911, 28815,
+    11169, 13008, 11312, 13052, 8961, 12899, 17081, 10563, 28809, 12600, 32910, 12604, 13017, 12564, 10263, 28732,
+    13042, 12720, 12911, 10573, 12852, 32907, 9974, 17306, 9598, 13134, 12552, 16674, 12944, 11694, 13064, 13042,
+    10255, 9984, 12826, 32897, 32858, 12731, 32922, 16974, 0, 12575, 10263, 10570, 12972, 6217, 12367, 28809,
+    16935, 28728, 9387, 16925, 13063, 13042, 6393, 11451, 17093, 9089, 28792, 12982, 20483, 12612, 28721, 12946,
+    12923, 13156, 6411, 9687, 10872, 13075, 32934, 12612, 17239, 17220, 32923, 28809, 16754, 9356, 12720, 13171,
+    16535, 8790, 28753, 10563, 32833, 12935, 12767, 13114, 16935, 28827, 6225, 10853, 32884, 13055, 9828, 28754,
+    12743, 32779, 28752, 28784, 13128, 28756, 11104, 13158, 32884, 6181, 28776, 12779, 9555, 12876, 17090, 32846,
+    6409, 20483, 12420, 13028, 10554, 17162, 12498, 28766, 32884, 32884, 8285, 32935, 12539, 28789, 11711, 13031,
+    28743, 12576, 13136, 11712, 16598, 10853, 11403, 17093, 12780, 28684, 16463, 16596, 10578, 28718, 12390, 32909,
+    13039, 12888, 13125, 28735, 10218, 6463, 28766, 0, 12756, 12568, 28821, 12827, 13019, 32908, 32908, 32838,
+    16744, 6233, 13140, 28797, 13031, 11115, 0, 28803, 17160, 16519, 13028, 32897, 12528, 16937, 8490, 32894,
+    11151, 28777, 12923, 20489, 28678, 12803, 12934, 17014, 17094, 12672, 9386, 10572, 11595, 13104, 12320, 32872,
+    12347, 32793, 32911, 13053, 28828, 16463, 28802, 10272, 9563, 28708, 13067, 8988, 10554, 10516, 32859, 13019,
+    8619, 13078, 12791, 17229, 0, 13054, 17229, 32921, 28801, 16665, 17015, 9675, 8778, 17398, 10095, 13127,
+    32858, 28767, 28772, 13044, 12465, 12791, 28732, 28701, 10861, 28810, 20484, 32895, 32831, 11757, 16779, 28801,
+    13063, 12405, 16914, 10815, 32884, 20489, 6189, 28787, 13051, 13056, 12972, 9808, 13157, 28681, 32897, 10870,
+    28746, 10571, 17239, 9986, 28708, 28732, 28828, 6235, 11152, 17290, 13078, 28817, 17247, 12994, 6059, 16835,
+    28679, 17309, 28821, 32858, 9648, 12684, 10577, 20489, 12503, 13148, 12344, 28757, 13075, 17174, 32935, 12540,
+    28800, 17003, 28802, 12816, 28801, 13195, 13091, 13020, 6455, 17002, 13149, 8365, 12576, 6401, 9307, 12370,
+    28768, 10573, 16937, 16529, 12367, 12443, 17015, 12600, 6234, 12912, 13116, 12804, 32937, 11450, 12371, 32871,
+    17237, 6235, 17162, 17161, 10273, 6234, 10554, 32909, 28754, 10284, 11169, 4307, 28729, 32817, 12960, 9983,
+    17170, 12523, 10285, 12804, 6455, 28812, 8343, 32870, 28809, 11711, 12359, 32780, 8789, 10263, 12406, 13043,
+    12654, 32936, 11953, 28715, 12296, 11711, 9985, 12564, 6226, 32922, 13138, 17306, 28731, 16438, 12606, 9986,
+    8779, 28781, 28742, 12948, 32858, 28737, 28767, 32896, 32897, 9373, 12924, 16815, 17309, 17399, 28809, 11451,
+    28758, 16500, 17239, 28805, 10563, 9885, 0, 10805, 17320, 10189, 13151, 10584, 9089, 28689, 9860, 11161,
+    20483, 11459, 28701, 12379, 20484, 13068, 32858, 28708, 17016, 10815, 28789, 12732, 12381, 12552, 13056, 17290,
+    17315, 28797, 0, 32937, 17249, 12582, 12611, 32936, 9687, 32832, 17173, 12936, 13151, 10816, 16666, 16801,
+    28744, 11477, 17297, 28686, 32895, 12343, 28784, 13076, 20482, 13171, 11170, 9666, 17306, 12935, 13031, 11742,
+    13051, 32884, 28764, 32790, 17326, 10264, 9986, 10283, 12945, 6233, 16751, 17004, 32791, 13032, 12308, 28701,
+    17332, 12696, 13125, 12311, 10285, 32858, 17251, 10782, 11179, 28816, 17317, 11648, 16586, 28752, 12948, 12828,
+    12454, 12492, 16856, 13195, 16858, 8606, 10282, 17014, 9308, 28800, 13182, 12648, 17290, 6235, 32923, 10581,
+    12780, 12828, 17196, 13079, 12336, 28814, 17082, 28709, 16419, 12628, 11451, 8256, 13052, 17316, 12432, 28705,
+    28682, 12522, 17241, 13128, 28798, 32778, 6411, 12588, 16579, 28758, 13149, 10584, 10572, 16937, 13139, 12369,
+    16755, 9986, 13176, 12382, 11467, 28796, 12404, 9905, 13090, 8611, 13006, 28815, 28743, 10274, 28792, 17241,
+    11741, 12995, 28750, 32870, 12592, 9245, 32921, 28724, 13158, 17095, 13043, 12298, 17307, 0, 9253, 11476,
+    16858, 8577, 12357, 11179, 10284, 32910, 13116, 32832, 28803, 12002, 28824, 11984, 32935, 13053, 28737, 12760,
+    13053, 17298, 17170, 32792, 11742, 11160, 12663, 17015, 12759, 32872, 6410, 10283, 9502, 10487, 28767, 8365,
+    28821, 9985, 32844, 12406, 28700, 0, 32815, 28790, 8649, 9473, 12523, 11611, 11758, 12392, 28709, 0,
+    16822, 28792, 13066, 28813, 12405, 12368, 16508, 13127, 9984, 13158, 10282, 28811, 12924, 11741, 28734, 0,
+    12708, 12828, 10285, 28744, 28676, 9676, 28780, 12606, 12924, 13100, 11871, 13076, 16509, 32911, 32805, 11870,
+    28700, 32846, 13152, 12346, 16815, 16526, 12540, 16538, 11481, 12640, 8584, 11702, 13139, 12651, 28812, 9986,
+    12960, 13089, 17174, 13064, 12345, 10584, 6448, 8789, 12748, 10246, 13079, 10581, 12299, 28780, 32883, 12034,
+    28791, 32855, 20484, 11468, 17241, 28764, 13176, 12996, 28728, 16508, 13088, 9073, 12382, 20488, 13195, 12573,
+    28698, 16608, 32919, 16936, 13127, 32933, 12612, 11169, 10879, 16936, 12791, 17298, 32898, 12431, 16675, 16807,
+    28798, 10862, 13139, 8491, 16571, 17252, 13183, 28797, 9373, 12946, 11523, 0, 28777, 4447, 11460, 9503,
+    16857, 16729, 16437, 6448, 12815, 6447, 17095, 12947, 28821, 13162, 13031, 16438, 32792, 13114, 28814, 28711,
+    10285, 28723, 32859, 12581, 10582, 12533, 11946, 12453, 32779, 12744, 12456, 32910, 28749, 16421, 32830, 28815,
+    13140, 28703, 13103, 16438, 13183, 12725, 28796, 11780, 12947, 17309, 0, 32806, 0, 9986, 12511, 8619,
+    32923, 16500, 32841, 13032, 28756, 16665, 32803, 12719, 16429, 28756, 28803, 12600, 13171, 32920, 28789, 12455,
+    28721, 13116, 13159, 11740, 13172, 13089, 28765, 32859, 10283, 12924, 16428, 12605, 28690, 11468, 12381, 13171,
+    13183, 12851, 28699, 28814, 28820, 17399, 32805, 28711, 28724, 8790, 16463, 12576, 12372, 28724, 28809, 12299,
+    13067, 6410, 12773, 12520, 28777, 13168, 10282, 11171, 16779, 28731, 6456, 12564, 32833, 13182, 12856, 28722,
+    12641, 6402, 11780, 17094, 28817, 12355, 12522, 32910, 16665, 20490, 12075, 13100, 12492, 16695, 16840, 16428,
+    13168, 13092, 28684, 12612, 28687, 20489, 17172, 13173, 12331, 0, 10573, 12948, 12300, 12347, 9049, 9480,
+    32896, 32840, 16606, 28686, 32919, 0, 4451, 28705, 12570, 28691, 28798, 17241, 11756, 12311, 12747, 12864,
+    32807, 28828, 12408, 11479, 12696, 13126, 16499, 6386, 16440, 17093, 12911, 9539, 16440, 28721, 8710, 13067,
+    28736, 12684, 12382, 28723, 12067, 11712, 28710, 12360, 28780, 11766, 28753, 12568, 28714, 32910, 32805, 16832,
+    11477, 32791, 28811, 28728, 12334, 8650, 12065, 12899, 17253, 12677, 10881, 11758, 32803, 10116, 13185, 12310,
+    13161, 28812, 9503, 13008, 8947, 28693, 11758, 11777, 10343, 28736, 32816, 8654, 13159, 28698, 28819, 28816,
+    6402, 28701, 32792, 12653, 13171, 28688, 8284, 28722, 13089, 20487, 17332, 16595, 16674, 13197, 28812, 20490,
+    0, 12359, 8905, 6465, 28736, 4826, 17249, 12466, 8881, 0, 13152, 16857, 13079, 12570, 12546, 11181,
+    16439, 17299, 8619, 16766, 12888, 12593, 12465, 13185, 11750, 8947, 28676, 6465, 12048, 13044, 4452, 28775,
+    13064, 12532, 8278, 8917, 32779, 6448, 12744, 28731, 10245, 13173, 11758, 17060, 0, 17239, 28826, 13140,
+    32792, 20484, 12900, 28725, 16684, 8905, 12738, 16858, 28791, 28818, 28749, 11999, 12378, 11777, 12665, 12677,
+    16992, 28803, 28719, 20483, 12936, 12612, 8401, 16746, 28736, 28722, 17327, 9800, 28755, 10582, 12331, 13091,
+    32919, 12936, 12064, 28686, 12357, 13008, 12408, 16658, 28737, 13077, 28813, 32924, 28804, 16937, 12358, 16745,
+    12924, 12642, 10284, 12429, 13008, 28717, 13207, 16607, 9261, 17173, 12488, 28809, 32790, 13140, 32897, 16746,
+    12924, 16438, 17354, 11469, 12396, 11181, 12334, 16937, 28807, 28750, 8988, 0, 20485, 16658, 13161, 12552,
+    13149, 12780, 12732, 12594, 9204, 28709, 12726, 28688, 16437, 13020, 12908, 28735, 16933, 9388, 13078, 28735,
+    28677, 12751, 32936, 32833, 28712, 8357, 32805, 13160, 12760, 12814, 12657, 13149, 16801, 16608, 12706, 10881,
+    12936, 13173, 16492, 8313, 16609, 12526, 32842, 6465, 12732, 0, 32806, 32806, 8583, 8717, 12762, 16658,
+    6465, 13151, 28818, 13184, 13171, 16608, 8911, 28813, 0, 13219, 17318, 9985, 11470, 28792, 17396, 28821,
+    12477, 17326, 13218, 32791, 28819, 12372, 12079, 12855, 28755, 32911, 8344, 28768, 32818, 12039, 28815, 11910,
+    28733, 13161, 6044, 16777, 17326, 12298, 8610, 32859, 12931, 16595, 32898, 13173, 12513, 16687, 9585, 11910,
+    16991, 28702, 8364, 13139, 11947, 13174, 28745, 32817, 17095, 28746, 12383, 28685, 28813, 28813, 13149, 20483,
+    12477, 12828, 32794, 32831, 28729, 28738, 12394, 11767, 12516, 16824, 12534, 11780, 16685, 28698, 28703, 9635,
+    16729, 12708, 16439, 13195, 12701, 13044, 12427, 28729, 32918, 12559, 12768, 12528, 17330, 13139, 8700, 17320,
+    12444, 16755, 16462, 16527, 8613, 12432, 13080, 32841, 8920, 12936, 32793, 32844, 16449, 6411, 17241, 12371,
+    13102, 12692, 12056, 32896, 12489, 12834, 28796, 16737, 10066, 28820, 12323, 28710, 12858, 12334, 9815, 12654,
+    8583, 13197, 16746, 9965, 16526, 12897, 8882, 28678, 8285, 28756, 16597, 8759, 12358, 16595, 12319, 28700,
+    16428, 28680, 16841, 17354, 13151, 9779, 13184, 12000, 8694, 12513, 28679, 12509, 16923, 32805, 12948, 12948,
+    8365, 4933, 12655, 32778, 16685, 32794, 28819, 12066, 12453, 13020, 8419, 17320, 32829, 17174, 20490, 11451,
+    13007, 8314, 10573, 28724, 8663, 32872, 12417, 13224, 20483, 28809, 12583, 16755, 28806, 12595, 13211, 13196,
+    28814, 12785, 0, 16698, 9884, 17395, 16676, 28726, 16508, 13186, 10070, 28702, 28748, 28697, 28707, 28760,
+    13172, 32792, 16430, 28744, 17174, 17250, 28804, 16746, 12689, 12583, 28753, 10095, 12466, 12347, 12419, 4467,
+    13161, 32819, 13150, 12511, 9586, 28815, 16746, 9615, 12000, 20485, 9802, 9796, 16463, 28691, 17330, 32840,
+    8358, 12076, 11413, 32923, 13164, 12480, 12335, 16500, 9808, 13032, 5021, 28776, 20485, 28744, 32859, 9682,
+    12606, 12371, 12055, 11954, 13195, 12465, 11767, 12299, 8883, 12924, 17275, 11750, 12444, 12689, 32830, 16519,
+    28693, 13152, 32921, 13195, 16528, 16429, 10920, 6457, 12727, 28739, 32922, 16773, 32806, 12828, 11460, 12786,
+    20484, 20484, 28790, 12976, 13163, 12785, 17148, 16687, 32920, 16832, 32910, 0, 32793, 9218, 28822, 13174,
+    0, 12678, 16451, 0, 28815, 12429, 9510, 13220, 12572, 8452, 12441, 13176, 13206, 28708, 12078, 12407,
+    6100, 11910, 12776, 16608, 13068, 5771, 32793, 13056, 8956, 8689, 9007, 13150, 6466, 12762, 13151, 16439,
+    13211, 28703, 28736, 28779, 17320, 17253, 28675, 12407, 11480, 13116, 28725, 10049, 28678, 16437, 28792, 32898,
+    32819, 16529, 5070, 28713, 17251, 17174, 8621, 28675, 16823, 32778, 16438, 32884, 16463, 13219, 8613, 12739,
+    13196, 8919, 12077, 28757, 12888, 28787, 28815, 12478, 28739, 17327, 28679, 32885, 12948, 16953, 13208, 28808,
+    20488, 13161, 12655, 32818, 16663, 13091, 13174, 13127, 12871, 12395, 16777, 13152, 16746, 16832, 12888, 12442,
+    12894, 8366, 32806, 12346, 12418, 12848, 10274, 32819, 10936, 12396, 16537, 13173, 28759, 28815, 32781, 8650,
+    16763, 17095, 28821, 12632, 8719, 17079, 16923, 28706, 9363, 12690, 4944, 8719, 12310, 20484, 28705, 11777,
+    12476, 13209, 12524, 28729, 12585, 32922, 28802, 0, 28674, 12323, 12407, 28678, 28694, 16755, 16666, 20489,
+    32807, 28820, 12526, 10400, 16658, 28721, 8314, 0, 10958, 12324, 16808, 12785, 28724, 8956, 12010, 12464,
+    8702, 10217, 32781, 11601, 9248, 16517, 28821, 13188, 32911, 28695, 12359, 4694, 9256, 16606, 12561, 13208,
+    12900, 13211, 28692, 12078, 8285, 13090, 5048, 12547, 32831, 17253, 11779, 12584, 12407, 12418, 12611, 12527,
+    28761, 12066, 16518, 12442, 28779, 32897, 0, 32819, 17320, 28706, 4694, 8420, 12418, 16421, 28769, 32884,
+    12881, 12382, 28804, 32923, 16450, 11767, 12858, 9555, 11096, 8665, 28680, 16767, 12467, 9016, 28724, 13219,
+    28714, 12477, 28747, 32792, 13068, 28804, 13001, 12948, 12631, 13175, 13044, 10072, 11768, 32815, 32911, 8703,
+    28760, 13128, 28740, 5536, 28769, 13187, 5498, 28809, 0, 16529, 28686, 32791, 12871, 12453, 12395, 12056,
+    9265, 28798, 20490, 13028, 28691, 17396, 12465, 32921, 9510, 8412, 28715, 8650, 16541, 0, 28736, 32806,
+    28791, 17319, 28702, 12443, 28769, 8949, 28750, 12527, 12011, 12766, 12585, 28707, 20484, 17331, 12420, 11182,
+    13188, 16461, 11778, 12791, 28769, 32779, 9610, 16852, 13175, 9294, 8957, 28723, 16688, 8956, 32832, 32923,
+    5483, 32922, 16459, 0, 28804, 12859, 12076, 32885, 16509, 11768, 16439, 16430, 12616, 9899, 12523, 16542,
+    12975, 10781, 12538, 13172, 11777, 13152, 9056, 16528, 13152, 12751, 13188, 17388, 9685, 12847, 9218, 13080,
+    12583, 13051, 12777, 28714, 16449, 12538, 28705, 12057, 13152, 8359, 28745, 12491, 12299, 12526, 32805, 32818,
+    28768, 8712, 8920, 28821, 28715, 12562, 20490, 11035, 13161, 11481, 9547, 8949, 32827, 5411, 16500, 12334,
+    12455, 12922, 32844, 17252, 28715, 12763, 12077, 12607, 8358, 12527, 11956, 12527, 28740, 12049, 20484, 16687,
+    32924, 13208, 28750, 12396, 16688, 9510, 0, 28722, 32781, 12526, 12632, 16685, 16834, 16518, 12752, 28813,
+    8711, 17253, 13056, 32839, 28715, 12049, 12467, 12670, 28741, 20482, 8658, 9906, 12380, 16964, 32793, 8956,
+    9311, 13039, 9547, 12538, 28782, 0, 12466, 9510, 12778, 16528, 32793, 8703, 32844, 8412, 13017, 28788,
+    13104, 32844, 16577, 10078, 12076, 8621, 12419, 32790, 9601, 12346, 0, 13128, 12300, 0, 12729, 32819,
+    16937, 11460, 13152, 13186, 12360, 13210, 9916, 13068, 16519, 13080, 32777, 20486, 28713, 16842, 20481, 8397,
+    28746, 17405, 8658, 12347, 20481, 32920, 16449, 8621, 9049, 12988, 9256, 6455, 17190, 8359, 28826, 28785,
+    16767, 16698, 9647, 32868, 28802, 8711, 28701, 5059, 13175, 20481, 12633, 28748, 12311, 13175, 12586, 32911,
+    13056, 13211, 16586, 10160, 10775, 16540, 10748, 32781, 13197, 12584, 28695, 12644, 9616, 28817, 28777, 13224,
+    16688, 9974, 12408, 12336, 28816, 16530, 16449, 9861, 20485, 13200, 12776, 9018, 28695, 8421, 9564, 8920,
+    16774, 12775, 13056, 12753, 12443, 28705, 12562, 12396, 28772, 13223, 9913, 17308, 16597, 32844, 28766, 28716,
+    32820, 4722, 28695, 12895, 32819, 12894, 28748, 9554, 0, 9547, 28772, 13152, 12527, 12618, 12405, 12859,
+    28804, 12534, 28796, 28787, 13164, 32853, 28674, 12395, 28735, 9256, 28708, 12587, 13176, 32885, 12321, 28708,
+    8758, 12741, 5541, 12454, 8696, 17384, 10376, 12324, 0, 12467, 17014, 12057, 28768, 8766, 20490, 10517,
+    12490, 12319, 28738, 16686, 28792, 28823, 12408, 28692, 9593, 8658, 11780, 10947, 8703, 12407, 9670, 4955,
+    32832, 20485, 32832, 9084, 8720, 9853, 28802, 12682, 28709, 10207, 12587, 13051, 28716, 17398, 12619, 16735,
+    5427, 28686, 28729, 28724, 28744, 13221, 28699, 13219, 32846, 13223, 12408, 12680, 32793, 16925, 28772, 9853,
+    28714, 28707, 28775, 28735, 12067, 28698, 12611, 0, 16528, 12477, 28821, 28762, 12406, 9019, 9618, 16735,
+    10734, 32864, 28798, 16607, 12860, 17241, 5362, 9057, 32843, 12383, 28744, 11267, 12873, 28736, 17169, 12300,
+    16745, 9906, 10482, 10076, 13080, 28814, 20487, 12372, 28780, 16618, 28713, 12587, 11180, 28768, 12417, 9050,
+    9294, 17116, 28775, 13199, 17376, 13219, 9049, 16449, 28704, 13220, 16620, 28680, 9003, 9020, 11567, 9057,
+    9914, 10375, 9265, 9907, 12584, 28768, 9301, 9861, 9265, 32793, 8452, 13210, 28756, 13208, 9791, 28822,
+    28707, 12742, 28718, 12671, 12503, 17329, 12645, 12633, 12906, 32779, 28747, 16695, 5361, 12894, 12384, 32898,
+    16766, 32844, 9265, 16451, 10507, 13011, 12456, 13116, 32831, 12691, 8367, 32794, 5361, 28731, 13198, 28817,
+    10483, 17038, 16450, 9609, 28718, 12896, 12575, 9906, 0, 28781, 12539, 12545, 13221, 12598, 13200, 16451,
+    12384, 12796, 17377, 16542, 10974, 0, 8666, 9861, 13220, 12693, 12418, 10998, 12068, 13164, 10143, 28821,
+    16845, 13209, 8476, 16451, 10750, 28719, 16529, 32845, 32844, 12300, 28757, 12816, 32833, 20484, 12848, 32781,
+    28800, 12683, 10782, 28708, 5813, 16887, 12767, 12683, 12480, 13001, 12766, 12610, 17072, 9610, 17405, 12978,
+    12636, 32807, 28729, 12576, 10459, 12012, 9003, 28700, 5076, 12904, 28695, 28824, 28695, 12514, 11374, 12693,
+    28738, 16766, 28751, 28702, 9065, 28733, 12490, 13080, 13127, 28695, 12624, 12564, 28716, 12371, 12496, 10149,
+    10998, 28702, 10483, 28738, 12431, 12548, 9980, 16619, 28756, 28748, 9862, 5971, 10736, 32781, 6392, 28762,
+    28749, 12875, 17388, 12610, 12827, 28820, 11821, 12619, 11633, 8421, 12587, 12439, 28824, 12859, 17399, 16778,
+    20485, 12966, 16887, 12691, 28822, 28722, 12455, 12395, 12729, 12905, 9907, 10142, 28823, 32806, 12599, 28682,
+    16698, 12635, 12444, 12683, 28762, 17369, 13188, 9610, 12513, 16619, 28707, 9899, 11380, 28688, 28822, 9600,
+    12700, 28771, 9955, 32793, 16598, 28713, 12896, 28730, 17376, 28822, 16609, 5074, 16767, 10476, 16766, 12657,
+    9085, 9302, 28826, 8965, 32778, 12609, 12955, 13197, 12619, 17195, 8468, 11710, 16777, 28712, 0, 28728,
+    12701, 17369, 9011, 12360, 12632, 10106, 13200, 12442, 12502, 0, 16853, 8453, 28695, 28728, 12862, 28692,
+    12586, 16459, 28821, 12694, 32829, 28762, 12599, 28682, 9655, 10736, 28738, 17409, 28755, 12692, 12408, 12861,
+    12874, 8666, 12609, 9899, 9610, 12442, 28675, 16618, 32854, 9058, 10078, 28826, 12503, 12767, 12701, 32892,
+    9518, 12895, 17377, 17395, 28759, 12598, 12444, 16910, 28803, 32833, 17332, 11136, 28695, 28718, 9311, 13013,
+    12633, 0, 9853, 10078, 16894, 9367, 0, 12608, 9963, 0, 12394, 12692, 8470, 12384, 10107, 28759,
+    12528, 10451, 8767, 10699, 9846, 12633, 0, 28746, 28822, 12480, 28811, 17397, 17409, 12787, 9057, 12850,
+    12608, 16816, 28817, 32831, 12752, 0, 32853, 28822, 28719, 10284, 12766, 12609, 16777, 12077, 13222, 28747,
+    16902, 5106, 17329, 12776, 11333, 12694, 12420, 10114, 12526, 10406, 9350, 12479, 11297, 12525, 16913, 9618,
+    12324, 0, 28814, 8752, 16894, 12959, 9985, 28738, 12906, 12897, 12586, 9863, 28745, 32806, 12912, 8423,
+    28779, 16542, 10703, 28691, 9817, 28690, 28746, 12800, 12611, 12432, 12659, 28760, 10158, 28819, 28749, 28772,
+    12740, 20486, 9083, 10245, 12538, 11273, 28749, 28714, 16518, 16618, 9657, 12768, 12898, 8620, 28712, 12562,
+    12515, 0, 9610, 28703, 8767, 13080, 8468, 16459, 12491, 9862, 28729, 9962, 12948, 12971, 28729, 28678,
+    12612, 32844, 28824, 9665, 12453, 12452, 16902, 28693, 28747, 9954, 10197, 11386, 28750, 12611, 28690, 12478,
+    5563, 12779, 28759, 10189, 12766, 12632, 12488, 5993, 12979, 16618, 13110, 32864, 12444, 12550, 28710, 12875,
+    32922, 10377, 0, 16824, 12538, 12823, 28713, 9900, 17248, 9620, 16598, 28786, 12874, 32859, 28722, 5455,
+    12611, 10838, 28759, 12713, 13223, 0, 13198, 13222, 28687, 16970, 28690, 28752, 32794, 28786, 12753, 8470,
+    12575, 32844, 0, 9078, 12336, 28765, 16439, 28757, 28827, 16699, 12778, 12503, 32865, 16485, 10108, 28786,
+    16597, 9665, 20486, 12408, 28826, 8322, 28767, 12321, 9863, 10378, 16529, 8461, 28748, 28749, 12576, 28819,
+    9011, 10782, 8712, 28769, 10151, 28827, 5649, 12525, 12443, 28717, 10750, 12694, 0, 8477, 9609, 8460,
+    5103, 32908, 16903, 9321, 28759, 9969, 0, 28820, 12444, 16843, 12768, 12704, 12884, 12980, 12540, 32930,
+    16766, 9609, 12646, 28798, 12956, 20486, 12788, 32832, 6401, 28798, 32865, 28798, 10449, 12704, 10449, 12609,
+    11002, 12034, 12633, 16700, 12420, 13076, 12981, 12645, 9003, 28826, 9077, 0, 12693, 12895, 0, 0,
+    17409, 32801, 12525, 13188, 8768, 28769, 32854, 20481, 17042, 12468, 12432, 10413, 28814, 16982, 12432, 28804,
+    28710, 12764, 13077, 28684, 13030, 12694, 13220, 28747, 10796, 9020, 12549, 12682, 9357, 8776, 9619, 12791,
+    5614, 28681, 12573, 28739, 8460, 20481, 13014, 12895, 12840, 28730, 16420, 12897, 10145, 16834, 12456, 28816,
+    28690, 10532, 12645, 12300, 16931, 12931, 12490, 12933, 10505, 12980, 28820, 11678, 13221, 28747, 16619, 11380,
+    17139, 28775, 28825, 12694, 17203, 5113, 10159, 28731, 28743, 28812, 13223, 5658, 12658, 9981, 12576, 28758,
+    12905, 9948, 0, 12621, 12906, 28757, 12850, 17411, 16776, 32832, 13221, 28826, 28783, 12704, 12729, 28825,
+    13096, 13056, 28815, 32833, 28699, 9021, 28734, 11566, 28715, 17123, 12742, 12491, 10488, 12896, 12634, 16904,
+    9563, 12896, 8405, 16983, 16540, 10444, 10788, 9982, 0, 8767, 28765, 8477, 16541, 32909, 10191, 12875,
+    32846, 0, 12907, 16922, 9619, 12789, 16620, 12893, 12431, 16937, 32923, 10789, 16912, 32792, 17210, 28731,
+    8965, 12659, 28729, 16930, 12372, 12503, 5900, 6014, 28731, 17387, 9075, 17129, 16974, 17141, 28797, 5484,
+    8667, 28758, 28704, 13095, 28759, 12479, 13223, 12908, 10503, 12610, 28808, 32879, 28775, 11081, 8405, 28786,
+    9948, 28822, 17129, 28824, 28796, 28782, 12514, 12467, 28782, 28775, 28763, 32878, 12742, 10505, 12886, 11311,
+    10451, 16903, 28732, 28828, 28727, 17386, 12823, 12549, 17226, 20486, 28749, 28826, 12695, 11273, 32781, 12527,
+    28746, 10789, 5113, 9844, 32855, 17275, 28727, 12886, 12780, 28819, 11041, 9075, 12931, 32833, 12609, 28823,
+    28731, 9310, 12779, 5900, 28825, 12874, 12575, 12431, 12780, 16699, 12776, 12599, 13223, 13188, 12671, 28711,
+    16460, 6344, 11678, 12791, 28749, 28695, 9066, 16440, 10198, 12647, 12705, 10836, 8786, 12885, 17014, 16529,
+    9089, 10713, 5105, 10505, 28689, 32832, 28753, 12861, 10751, 0, 12360, 12420, 9657, 16991, 16619, 12408,
+    32794, 28778, 5922, 6123, 12981, 16844, 12791, 16779, 12716, 28731, 12741, 12563, 12754, 13146, 6117, 12921,
+    12823, 12730, 9610, 13078, 12492, 32936, 12873, 28787, 10460, 12479, 13015, 10714, 9657, 11057, 28731, 12863,
+    28730, 12992, 12780, 16540, 28749, 9078, 12828, 6180, 17069, 8767, 9664, 12919, 9909, 10489, 0, 12432,
+    9085, 11057, 9916, 12899, 28786, 12906, 11303, 28729, 12968, 28708, 32867, 12527, 12800, 28810, 10490, 11088,
+    12622, 12468, 12621, 13097, 32896, 9666, 20490, 16459, 11632, 9963, 28754, 16779, 12621, 12683, 28680, 28699,
+    12849, 17124, 12896, 16922, 12492, 8424, 28731, 28754, 28788, 0, 8769, 12907, 12897, 11632, 16934, 10750,
+    6432, 9357, 28767, 10714, 9665, 11596, 9377, 28820, 28792, 0, 12503, 12647, 0, 20488, 12420, 12491,
+    12611, 12432, 12600, 12396, 28827, 5651, 17131, 10246, 28823, 16912, 10804, 10495, 10161, 28826, 12916, 12480,
+    11340, 28748, 9068, 13122, 10161, 28804, 12731, 12443, 10213, 11401, 12823, 28733, 12431, 32878, 12956, 28777,
+    10713, 8777, 32857, 28816, 12612, 13018, 12312, 28765, 10116, 32904, 8786, 28825, 28758, 11013, 12456, 9974,
+    10191, 10789, 12564, 13133, 16982, 9917, 32807, 16445, 9909, 16845, 9011, 32846, 11058, 32931, 16924, 28738,
+    16617, 28774, 9919, 28804, 28720, 12609, 28787, 32870, 28757, 8786, 12620, 12480, 12875, 12575, 12874, 11042,
+    16914, 12779, 13151, 20489, 12907, 12684, 12467, 8414, 28808, 28752, 10758, 9908, 17060, 28808, 28700, 16620,
+    11103, 17132, 10758, 12587, 28747, 16618, 16982, 28762, 32905, 9919, 16462, 10498, 17069, 9862, 12515, 28775,
+    12730, 32844, 13015, 12502, 5491, 11749, 16846, 16903, 12791, 28752, 16700, 28730, 11012, 11311, 12695, 6427,
+    9086, 13039, 12504, 12621, 0, 12468, 16914, 12705, 9076, 10751, 12624, 9917, 5113, 13077, 32909, 28826,
+    16904, 12396, 12801, 9310, 32898, 17398, 17070, 12706, 20482, 28684, 9674, 9012, 12791, 16982, 17210, 28793,
+    8414, 28806, 28715, 32883, 0, 13008, 10415, 12838, 28816, 12492, 8423, 28827, 28785, 12696, 28788, 12972,
+    17139, 11304, 13050, 12561, 12694, 13127, 5590, 17173, 12812, 12812, 16855, 13098, 13019, 32893, 12767, 32931,
+    12779, 17069, 9909, 17148, 13019, 32905, 17210, 12993, 8423, 12671, 12716, 0, 16983, 8786, 32871, 28696,
+    12684, 9686, 9088, 11312, 5498, 12994, 13015, 12767, 32924, 8777, 12888, 16933, 12705, 10199, 12838, 12908,
+    32895, 9086, 16912, 32869, 6015, 10162, 28733, 11387, 10253, 32857, 8424, 16923, 20481, 12719, 6145, 28690,
+    12743, 28741, 16925, 9682, 10199, 32794, 28811, 10514, 32930, 12693, 28827, 11096, 12933, 12574, 12706, 28769,
+    12587, 32859, 9863, 28760, 12624, 9956, 32832, 6455, 20486, 10270, 32935, 8255, 12909, 32937, 28772, 17411,
+    10217, 12611, 11430, 17095, 12852, 13110, 10246, 28797, 11435, 32869, 12491, 12635, 10760, 16922, 12540, 12972,
+    0, 28762, 12551, 9241, 28798, 12767, 9973, 28696, 17070, 6216, 12824, 28773, 0, 13026, 11647, 11647,
+    28794, 9088, 16541, 28764, 10153, 13018, 32885, 16779, 12899, 10498, 12611, 11610, 12814, 12658, 9087, 8777,
+    5662, 11013, 17079, 12491, 32881, 17072, 12920, 12800, 28753, 16974, 13016, 12931, 28708, 32931, 9666, 12804,
+    17053, 12610, 16974, 13074, 32867, 12372, 10460, 9022, 13211, 28790, 10461, 6211, 28788, 28752, 13155, 28802,
+    28765, 16914, 12475, 16779, 12684, 12943, 6188, 16699, 13018, 9386, 13152, 12659, 28798, 12803, 0, 12908,
+    32893, 13018, 28789, 28732, 12837, 10253, 12707, 12741, 17062, 13223, 11411, 11144, 28707, 9687, 13036, 32867,
+    13028, 28816, 10116, 12814, 0, 12716, 32818, 13007, 20488, 13110, 12791, 10460, 12919, 9687, 12324, 9974,
+    6211, 28754, 17158, 9975, 10516, 28794, 28799, 13006, 11610, 28809, 12778, 32781, 12623, 28828, 28825, 12609,
+    12659, 32904, 13195, 13101, 32879, 32855, 11572, 12705, 28799, 12718, 32881, 28787, 13111, 9684, 16933, 28753,
+    12801, 6050, 20487, 9078, 12479, 12888, 12708, 32869, 28731, 12943, 12576, 13019, 13113, 16992, 11096, 13007,
+    10797, 10162, 32883, 28737, 12802, 28702, 16924, 32845, 28786, 16993, 12909, 12612, 12503, 12789, 16993, 28754,
+    12504, 12754, 17162, 12696, 12716, 0, 13005, 17140, 28775, 12812, 12732, 17072, 28799, 12599, 9863, 28743,
+    32831, 12790, 28684, 32893, 10252, 12908, 10514, 28798, 17410, 16461, 9909, 32827, 12753, 12861, 28786, 9619,
+    12931, 28810, 9620, 28810, 28794, 12851, 32781, 17219, 17332, 13007, 32881, 0, 12920, 28712, 11686, 9909,
+    12526, 9956, 12943, 12845, 12624, 13173, 5658, 28778, 32893, 16923, 9078, 13145, 12932, 10584, 12444, 0,
+    8255, 12550, 17227, 0, 10805, 12849, 28775, 13144, 11103, 17218, 9067, 28688, 12943, 12780, 12920, 11602,
+    12803, 28762, 12792, 32854, 10844, 9984, 6174, 28812, 0, 12812, 20488, 5665, 11058, 12874, 0, 17001,
+    12646, 28754, 12552, 28755, 6058, 9965, 11602, 10580, 16541, 11602, 12744, 13134, 17228, 12791, 12886, 20488,
+    28763, 8790, 9687, 9553, 28776, 12825, 12815, 8790, 16991, 17230, 28785, 12719, 28759, 13146, 28742, 11358,
+    28763, 28779, 12908, 12814, 16779, 28786, 10559, 11709, 28759, 32871, 32857, 17132, 8485, 28765, 12395, 11096,
+    32781, 6433, 5499, 13044, 11926, 10571, 0, 13036, 13044, 12767, 12576, 16463, 12515, 28826, 9675, 28695,
+    17159, 28761, 0, 16857, 11387, 12622, 10842, 17211, 10507, 8777, 28757, 28751, 12779, 12683, 10153, 12420,
+    12480, 32833, 17211, 11104, 17219, 13160, 8491, 12527, 9984, 9909, 8789, 12900, 13111, 10208, 12468, 12803,
+    12444, 28755, 12824, 12540, 10844, 0, 17289, 9088, 12981, 28759, 32831, 32814, 9675, 12420, 28813, 6233,
+    12780, 28758, 12888, 28774, 12945, 17141, 10162, 12696, 28821, 28797, 12824, 17410, 13008, 28684, 10506, 8424,
+    32846, 17410, 32856, 13146, 11349, 20487, 6048, 8713, 28713, 28797, 28752, 17140, 28808, 17061, 12432, 6151,
+    28777, 13019, 12372, 10553, 11414, 28763, 10559, 5499, 12921, 12695, 0, 9386, 0, 28765, 17409, 6387,
+    13039, 28808, 12717, 13183, 28774, 5673, 11610, 12875, 11458, 10498, 10207, 28680, 12708, 28773, 10515, 12659,
+    28798, 17062, 11113, 11693, 16991, 17219, 12670, 17090, 11411, 16983, 12862, 32818, 28696, 32868, 10551, 12813,
+    11844, 12551, 12827, 12792, 28772, 11394, 32856, 11104, 11457, 10269, 28811, 32870, 11700, 28758, 32871, 10216,
+    12924, 12825, 28677, 17071, 9974, 12900, 12909, 28774, 10452, 17211, 0, 9067, 9068, 12982, 12911, 13136,
+    32871, 12908, 28687, 13146, 32872, 9676, 9973, 28810, 10217, 13032, 20489, 17169, 12611, 28731, 28772, 12946,
+    11694, 12814, 28684, 12897, 12933, 17004, 11167, 32892, 28797, 11349, 28783, 12899, 12957, 10271, 11058, 12932,
+    28748, 12743, 13112, 17399, 28766, 9918, 20489, 28799, 12899, 6150, 10760, 32858, 12744, 12825, 20488, 13020,
+    17282, 12851, 13114, 28789, 16936, 17141, 6233, 16722, 13007, 13137, 11701, 32894, 28754, 9983, 17149, 10216,
+    13136, 28764, 13212, 16845, 16922, 28775, 12756, 10554, 32905, 12792, 12970, 5666, 13051, 28786, 0, 9684,
+    12720, 9974, 8488, 12910, 12574, 16462, 28755, 9377, 32909, 17411, 9674, 17241, 12744, 11734, 12646, 12716,
+    13007, 6217, 9666, 16857, 12034, 13042, 12943, 8571, 9592, 9919, 32924, 13092, 13051, 13018, 32857, 10280,
+    12718, 10517, 6350, 13016, 32905, 16993, 12922, 32802, 32805, 11710, 28828, 12933, 8305, 32906, 0, 12392,
+    9377, 32885, 13031, 32883, 28754, 28766, 17289, 28782, 13220, 28781, 8778, 28732, 12933, 0, 12718, 13040,
+    32880, 11938, 12648, 12814, 13051, 28753, 10280, 13030, 6151, 9665, 28749, 17169, 32917, 12947, 28733, 17149,
+    12588, 12897, 13039, 28782, 8554, 32884, 32933, 12899, 10515, 12442, 12432, 0, 28696, 13019, 13063, 12654,
+    28795, 12719, 12790, 11178, 12824, 13019, 17411, 13116, 13028, 9687, 11655, 12480, 32935, 17080, 32807, 17003,
+    10218, 11977, 12717, 28805, 32907, 10217, 12516, 16937, 12706, 8769, 12492, 12792, 32859, 16846, 13018, 12719,
+    28828, 13008, 32858, 12826, 32881, 13039, 12994, 28746, 16858, 12911, 28755, 28810, 12708, 9919, 11694, 13031,
+    17316, 32906, 12405, 9983, 9983, 32856, 28753, 9068, 28752, 9919, 28763, 28778, 28700, 5674, 10515, 17003,
+    32816, 12876, 12683, 6463, 12694, 0, 12899, 32804, 28770, 12696, 10460, 17211, 32845, 13040, 13137, 17368,
+    12622, 28777, 13063, 12812, 28787, 32872, 13066, 17071, 28769, 32882, 12921, 11477, 10498, 12780, 16934, 28790,
+    5499, 0, 17013, 28760, 32935, 12540, 17289, 12827, 32933, 12635, 28763, 12569, 12982, 9853, 17080, 28764,
+    13091, 10274, 28770, 12815, 17003, 13031, 0, 10218, 17296, 8904, 5629, 13054, 17398, 32856, 28784, 12528,
+    17251, 32896, 32846, 12876, 28825, 13031, 13041, 32869, 32894, 16993, 12791, 11170, 13030, 17316, 17289, 12947,
+    12959, 28801, 11894, 28775, 9919, 13040, 12852, 9387, 28731, 13127, 0, 16515, 12953, 10263, 17071, 12790,
+    11611, 12912, 17297, 12922, 13125, 13052, 28802, 17151, 8488, 13018, 13042, 13043, 8283, 12468, 11611, 12648,
+    10208, 32933, 11701, 12516, 16924, 13063, 12720, 13040, 32916, 12414, 12576, 6059, 28794, 17003, 12900, 10814,
+    5666, 32935, 12791, 11872, 32896, 12621, 12792, 12995, 32872, 12826, 17012, 32908, 12707, 13030, 13074, 10507,
+    12612, 20487, 0, 32896, 32894, 11711, 12996, 12946, 32885, 28766, 11466, 32894, 13055, 16734, 17083, 10869,
+    12719, 32871, 28762, 6326, 13075, 0, 13128, 28823, 11702, 12946, 12576, 10860, 17072, 13040, 8365, 12803,
+    28721, 10517, 28680, 12635, 17013, 12911, 13147, 12659, 11894, 13041, 10571, 28788, 8424, 12720, 28790, 11939,
+    17082, 28788, 12391, 28732, 11467, 17151, 28825, 32776, 28674, 32872, 20489, 12912, 32909, 28727, 28767, 0,
+    28756, 32910, 32934, 12767, 9376, 28813, 0, 13198, 32933, 32791, 4410, 12959, 12333, 32833, 28782, 17228,
+    16696, 12802, 11414, 12533, 12708, 28778, 32884, 10562, 28689, 12672, 13136, 28794, 28735, 12934, 13147, 12671,
+    12900, 28786, 12320, 12696, 8490, 28825, 10274, 32885, 12570, 10815, 11115, 13210, 12736, 13065, 12814, 13115,
+    32841, 12696, 17016, 32884, 17161, 12623, 12582, 12900, 10272, 28759, 28755, 12995, 10882, 13092, 28741, 0,
+    28802, 10861, 17082, 32907, 12575, 28804, 0, 11711, 16439, 28720, 28801, 10255, 32858, 12813, 10263, 12308,
+    0, 13041, 28799, 13147, 12912, 32906, 12659, 6059, 17230, 12677, 32791, 12591, 28814, 32935, 28828, 12828,
+    28811, 13043, 13078, 12816, 28801, 32935, 12984, 11470, 16420, 13019, 28776, 12612, 9686, 17083, 11702, 12443,
+    28776, 28778, 28790, 13150, 32884, 28711, 11357, 28732, 12804, 16745, 28734, 12864, 28727, 28790, 13091, 16650,
+    0, 11756, 28788, 13002, 28751, 6409, 10869, 5666, 16604, 6357, 0, 13140, 10816, 20483, 28802, 12588,
+    0, 13140, 11694, 17169, 17016, 32936, 28769, 4693, 32897, 28773, 32858, 10282, 17220, 17161, 17160, 28810,
+    9514, 28786, 11152, 28812, 8306, 17230, 12772, 28811, 28774, 13150, 12696, 32908, 0, 11756, 16925, 17241,
+    16764, 28801, 13019, 13008, 10554, 12311, 13126, 6189, 12612, 32893, 10204, 32936, 20481, 28767, 28790, 13103,
+    11168, 9984, 12804, 20485, 12552, 13182, 11978, 13156, 17015, 12624, 17306, 9918, 17411, 13018, 10517, 32897,
+    13125, 17332, 17229, 28776, 32880, 28755, 32894, 9908, 11648, 10572, 32906, 12804, 32846, 12552, 28797, 12970,
+    32807, 13008, 17170, 28767, 10274, 0, 12684, 28790, 32843, 16936, 6365, 10283, 32872, 13140, 32908, 12516,
+    12828, 17083, 11113, 9686, 28806, 12696, 32859, 16657, 12792, 10861, 28754, 13020, 17083, 28791, 17220, 8342,
+    13147, 17309, 32859, 12900, 28708, 28788, 0, 6226, 28798, 17240, 12008, 13019, 12420, 16529, 10871, 13042,
+    11611, 6464, 17159, 12492, 13140, 12888, 28763, 32884, 12984, 28732, 13157, 17238, 28778, 13065, 28767, 17174,
+    32833, 11648, 28682, 11412, 9387, 13053, 28765, 12299, 12779, 11909, 9687, 12816, 28775, 13151, 8549, 17290,
+    13149, 10284, 10105, 32779, 17091, 17316, 28820, 13148, 32937, 12749, 28706, 0, 6448, 32885, 10571, 28812,
+    28810, 16821, 10554, 28786, 11152, 28745, 10582, 12371, 13157, 11757, 17093, 16925, 10880, 28722, 9687, 10273,
+    13029, 17239, 28791, 11395, 32908, 0, 9473, 10274, 28811, 28675, 9676, 28790, 0, 17290, 12403, 9246,
+    16588, 9687, 12415, 12948, 28790, 13148, 28779, 12492, 16658, 12442, 32909, 28813, 12612, 13090, 10879, 28813,
+    32815, 11459, 28811, 13041, 17241, 32827, 28763, 28685, 17174, 13052, 11413, 17091, 9068, 32792, 9552, 28722,
+    10699, 17248, 8662, 0, 9088, 17307, 28692, 28767, 16813, 0, 12996, 28776, 28679, 16755, 28687, 28810,
+    13176, 9088, 8881, 6464, 12500, 13075, 12947, 28811, 12581, 10814, 28791, 10879, 28731, 10255, 28779, 28732,
+    28700, 28800, 32872, 13041, 17327, 12380, 12624, 12651, 28810, 12945, 8992, 13042, 28726, 10563, 16693, 32897,
+    13138, 12440, 5367, 12994, 13116, 11939, 28821, 12332, 10861, 13125, 12768, 12828, 12935, 16676, 9986, 12321,
+    0, 20481, 28779, 28762, 12720, 0, 28718, 28732, 0, 13219, 10815, 10517, 9262, 17252, 32909, 28727,
+    28704, 12948, 28731, 32885, 16935, 32790, 13064, 6365, 28814, 12947, 28779, 12900, 8577, 16925, 10872, 12960,
+    28809, 13115, 28814, 32884, 13067, 28753, 10283, 11702, 28814, 11114, 12672, 17015, 13020, 10572, 32918, 12744,
+    12335, 11909, 16430, 28799, 13127, 17092, 16598, 28779, 12406, 28799, 9074, 32908, 12935, 32779, 12708, 32895,
+    17162, 13075, 12792, 9984, 11170, 11711, 12474, 10562, 32778, 17240, 12900, 28817, 13067, 13169, 13194, 12486,
+    12923, 17013, 11114, 17241, 13078, 11978, 11765, 11414, 13194, 28813, 11872, 10283, 32898, 10862, 13150, 12947,
+    17320, 28716, 12760, 28733, 10285, 6226, 16448, 32910, 11702, 12557, 32910, 16413, 28734, 32918, 16526, 16935,
+    0, 10583, 13066, 32885, 13139, 12696, 12911, 28679, 9984, 0, 10880, 13092, 13200, 32859, 28811, 12359,
+    20485, 0, 0, 12935, 28790, 17317, 9479, 32872, 12359, 11703, 16937, 28790, 16814, 32885, 28809, 17241,
+    28735, 12299, 12593, 13206, 13032, 11160, 16674, 12467, 17093, 8490, 10282, 6457, 11179, 12531, 6365, 16420,
+    13195, 28725, 28673, 13169, 11766, 32910, 10283, 11713, 28735, 16936, 8312, 28704, 28738, 0, 12322, 32803,
+    17170, 28752, 28788, 4571, 11712, 12298, 13054, 13128, 17298, 32895, 32909, 12936, 32804, 32832, 12816, 28779,
+    28691, 12576, 28802, 12570, 12935, 8355, 28723, 13224, 12593, 0, 12895, 11902, 12369, 13140, 11178, 13151,
+    28777, 12935, 13092, 28682, 28761, 8278, 32779, 32827, 12431, 10584, 10563, 16857, 10797, 12672, 32911, 28765,
+    12369, 10255, 16658, 12624, 32859, 20488, 16587, 8402, 12684, 11170, 12934, 17253, 13032, 12383, 13076, 13207,
+    28797, 32793, 32918, 32910, 20482, 13151, 12321, 10870, 6464, 10883, 17308, 32921, 13067, 28788, 11160, 12310,
+    28762, 10282, 32911, 17095, 28758, 32885, 9919, 12380, 8854, 12672, 28779, 28788, 16935, 32840, 32920, 12453,
+    12297, 12664, 28681, 32872, 12381, 0, 12761, 13114, 13160, 9179, 11468, 28693, 12945, 13067, 12803, 20485,
+    28703, 17319, 28736, 6410, 8480, 17173, 32816, 11459, 28720, 10573, 9687, 28735, 12696, 28778, 0, 10284,
+    17309, 28713, 28713, 13162, 13067, 13171, 32897, 32790, 28714, 11460, 28802, 12347, 28681, 28720, 11713, 28814,
+    10285, 16597, 16736, 12462, 28736, 16700, 13186, 32830, 11910, 8643, 16694, 28716, 12881, 32910, 17172, 13077,
+    13150, 12546, 12598, 17094, 12332, 12451, 8942, 16516, 28706, 32883, 32779, 11984, 13031, 11481, 28814, 9853,
+    12356, 28709, 32816, 8954, 13139, 12323, 13206, 17173, 12671, 9180, 12624, 9209, 32830, 32921, 32919, 32779,
+    28736, 28681, 28692, 32790, 12624, 16519, 32778, 13008, 17299, 28813, 12595, 17016, 28706, 16571, 13020, 11703,
+    13195, 8307, 16666, 17252, 28826, 28765, 28825, 12476, 12816, 13162, 9246, 8612, 12322, 8905, 11992, 8916,
+    12576, 32910, 12948, 12624, 28787, 16586, 8606, 20484, 32911, 11983, 17016, 9287, 13020, 12310, 13128, 32792,
+    17318, 28810, 17319, 32792, 17095, 16537, 28676, 32806, 12064, 6448, 12560, 12624, 11478, 12438, 0, 16606,
+    28679, 8307, 8491, 28759, 13150, 28779, 28802, 13160, 12392, 9260, 28687, 28727, 17307, 32777, 28676, 28721,
+    32793, 17172, 13091, 28767, 9585, 0, 17299, 28686, 5340, 5484, 28735, 13160, 0, 10284, 11479, 12924,
+    12335, 16734, 13172, 11478, 13171, 11759, 28709, 28734, 0, 32896, 11469, 12888, 28693, 28778, 28723, 28737,
+    12357, 11750, 32792, 16440, 28797, 11947, 32885, 12065, 12652, 9452, 12333, 13032, 28811, 16964, 28706, 12346,
+    28717, 10437, 16595, 32792, 16528, 28705, 12922, 28715, 12761, 28717, 16667, 13183, 13068, 28791, 12936, 12382,
+    12334, 28702, 11767, 32898, 17252, 28673, 12912, 20489, 13020, 16753, 32898, 8947, 28724, 13200, 0, 28734,
+    12333, 6410, 28813, 28775, 12761, 12936, 9986, 13195, 12868, 8583, 28811, 28676, 16617, 8963, 13104, 11478,
+    10883, 32922, 12682, 12900, 11180, 28775, 28685, 32819, 11469, 28828, 16578, 9311, 12552, 12396, 16529, 13032,
+    12768, 13183, 12546, 12772, 28745, 32884, 17253, 28737, 11058, 8655, 32830, 28700, 12346, 17015, 28734, 20490,
+    12395, 32832, 12465, 13080, 12065, 32780, 11750, 32831, 13020, 0, 16937, 10113, 12405, 32923, 28754, 12678,
+    32880, 16516, 32805, 28680, 12533, 12358, 12394, 10563, 17083, 28676, 12348, 12359, 12467, 12324, 13152, 28719,
+    9008, 28718, 16763, 12501, 16684, 13079, 16686, 13185, 9817, 28802, 28688, 12041, 12924, 8663, 10583, 28725,
+    12323, 32841, 28673, 13116, 11470, 17308, 16519, 12382, 28736, 28813, 17249, 13151, 12533, 12074, 28710, 0,
+    6411, 12311, 28779, 20490, 28803, 16526, 12573, 12323, 11766, 28673, 28744, 12534, 8322, 12357, 0, 28821,
+    8882, 13199, 8701, 28725, 17174, 28813, 13090, 12308, 0, 32841, 28745, 12009, 13032, 0, 17320, 12311,
+    11169, 8964, 28765, 28703, 28821, 13173, 13091, 12718, 32911, 20486, 17327, 13140, 32911, 8469, 12558, 16658,
+    28803, 32830, 32816, 16841, 12334, 28736, 28813, 32779, 28737, 6457, 6456, 12584, 32859, 17016, 32819, 16650,
+    12804, 12984, 32936, 11993, 12582, 28780, 12763, 13196, 32872, 8410, 6466, 13218, 8689, 12311, 28707, 10584,
+    12001, 13163, 9000, 28750, 12653, 28690, 28705, 8363, 16936, 28692, 13079, 11470, 28813, 13187, 17094, 16665,
+    16674, 12381, 6465, 12358, 12335, 28773, 12075, 28822, 28687, 16617, 32831, 28737, 13218, 11759, 13151, 12868,
+    28678, 28697, 28689, 11776, 12393, 28716, 12559, 11470, 13020, 9480, 28703, 32829, 32897, 12539, 17072, 12996,
+    28747, 32804, 32898, 12048, 12502, 16937, 8390, 17174, 32919, 17003, 10882, 12773, 8389, 28733, 13196, 28694,
+    32778, 12441, 32918, 12556, 10584, 17211, 13162, 13151, 28802, 28713, 12382, 13068, 8750, 8395, 9256, 32831,
+    28732, 28815, 9986, 13015, 32828, 32828, 9802, 13176, 12321, 12012, 28813, 12675, 32780, 12048, 32911, 12347,
+    32829, 9474, 12368, 13150, 16841, 16746, 13209, 12803, 11182, 28729, 8307, 20482, 32922, 13207, 11470, 17327,
+    12475, 28800, 12404, 13140, 12740, 12476, 20485, 12534, 11910, 17327, 16685, 8357, 8710, 17174, 32805, 12382,
+    32780, 10582, 0, 32780, 11947, 32832, 13091, 8452, 28715, 0, 9474, 0, 8643, 12604, 28709, 32910,
+    28692, 12642, 12642, 12900, 32841, 17016, 5814, 12743, 28728, 12582, 12558, 12012, 16658, 13020, 13056, 4572,
+    32842, 9681, 16430, 11767, 12762, 28810, 16500, 12571, 12406, 28826, 32843, 8390, 12056, 28722, 13185, 32919,
+    8612, 12996, 32923, 32911, 8745, 12383, 28779, 13163, 32843, 10584, 28692, 12501, 12948, 12336, 12630, 32805,
+    13056, 11181, 12960, 12923, 12405, 17331, 32872, 16688, 28678, 16869, 12816, 0, 32793, 9898, 12384, 12001,
+    16450, 20489, 16461, 13212, 13151, 0, 28815, 8918, 9662, 13163, 28768, 8964, 12719, 0, 9509, 28690,
+    12336, 6457, 17319, 12707, 12684, 28775, 9749, 16777, 32828, 20490, 0, 17361, 8664, 13151, 28681, 13172,
+    9248, 28738, 12465, 28702, 12394, 9474, 13151, 28800, 17016, 32779, 32872, 17411, 20483, 16736, 32794, 16421,
+    28740, 28746, 28778, 16746, 28748, 28707, 0, 12332, 13183, 10699, 16737, 32922, 32867, 20490, 28709, 9181,
+    28822, 28815, 17174, 13175, 28815, 11182, 0, 28710, 9955, 11480, 28815, 32781, 16421, 10066, 0, 28686,
+    28823, 12439, 12429, 28755, 12689, 28692, 28729, 13211, 0, 12429, 16596, 8948, 13210, 28692, 16438, 12479,
+    12523, 11759, 28706, 17174, 12624, 17328, 16529, 12381, 13198, 12335, 9779, 16517, 9801, 28822, 12766, 12300,
+    12370, 12690, 12726, 12726, 17252, 12359, 13173, 32833, 28756, 9210, 32806, 9591, 12419, 16609, 12347, 28819,
+    12348, 28822, 5340, 28746, 12453, 12774, 12357, 17329, 16458, 17174, 13207, 12407, 11910, 32923, 12501, 11246,
+    12320, 12666, 32921, 12491, 12478, 28735, 28701, 32791, 32885, 8419, 10116, 12319, 12075, 32791, 28742, 13056,
+    12427, 28718, 28678, 10280, 0, 8955, 13068, 12384, 9342, 20490, 9586, 32843, 9560, 13076, 28728, 0,
+    16440, 8612, 11767, 13163, 16666, 11777, 11769, 0, 13128, 16735, 32802, 16451, 12762, 32872, 28737, 16430,
+    9983, 28682, 32807, 12524, 16541, 28758, 10780, 28735, 0, 32911, 28695, 12372, 20484, 9607, 11758, 12548,
+    13151, 12988, 16972, 32806, 16880, 12332, 17015, 32898, 12487, 28700, 8702, 32923, 32831, 28804, 28800, 9343,
+    13064, 16911, 28779, 28768, 11137, 9311, 8949, 32817, 17060, 32923, 17332, 28675, 16993, 9814, 8948, 28768,
+    12057, 16808, 12874, 28692, 11481, 8965, 32829, 12559, 12453, 12762, 28748, 13173, 32924, 32843, 16833, 10407,
+    12011, 28737, 28815, 12345, 12562, 13199, 32895, 13152, 28799, 13220, 0, 12633, 13198, 12406, 11955, 12300,
+    5212, 13207, 12572, 17253, 0, 16832, 13173, 16808, 16588, 28694, 28719, 8650, 12309, 28677, 8446, 11993,
+    12395, 17210, 32820, 32832, 9815, 32831, 12678, 12880, 13219, 12584, 12453, 12751, 13196, 11769, 12455, 28717,
+    16658, 4868, 11632, 28792, 28759, 9802, 16579, 13140, 32897, 16755, 32920, 28786, 0, 12346, 12478, 12526,
+    28788, 28822, 32820, 12895, 16850, 32872, 12778, 13200, 8446, 16842, 16538, 9019, 12076, 28737, 16617, 12900,
+    12667, 10998, 8410, 17253, 13163, 28820, 32807, 28693, 12700, 20485, 13199, 12418, 12466, 32817, 32923, 0,
+    4977, 28705, 28726, 13152, 5026, 13080, 12455, 9056, 9002, 8912, 28729, 32920, 12066, 28694, 16852, 8657,
+    4630, 12010, 12548, 20482, 16538, 12526, 28739, 16684, 12454, 32923, 28713, 0, 13068, 12548, 12667, 16460,
+    11993, 28709, 28722, 32845, 32845, 17148, 32932, 13187, 13068, 13184, 8695, 20481, 8949, 12430, 17375, 32833,
+    28700, 32819, 8620, 13116, 11769, 8396, 16439, 32933, 16823, 32859, 32871, 13197, 28741, 28676, 8613, 8314,
+    12727, 4468, 12740, 16852, 32781, 8657, 12874, 28678, 32896, 8750, 32864, 28804, 9561, 20482, 12369, 13175,
+    16700, 32898, 12858, 12067, 16697, 16451, 9293, 16606, 17376, 28699, 8451, 9601, 0, 13080, 8720, 8475,
+    12881, 12708, 28821, 12491, 28677, 0, 5042, 32819, 12965, 13208, 12360, 16607, 28705, 12828, 10099, 12511,
+    28756, 9906, 20490, 13219, 12011, 12787, 4468, 9050, 16579, 12430, 10132, 32911, 12395, 11479, 12297, 12584,
+    12526, 32780, 28721, 11414, 32859, 28756, 16766, 10675, 9907, 13164, 13208, 12454, 28739, 12312, 16463, 12487,
+    12892, 28691, 12002, 28680, 0, 12778, 13219, 9845, 28730, 9018, 12547, 28750, 16619, 12466, 16462, 12550,
+    32805, 12394, 13172, 12489, 17079, 13127, 13152, 10406, 4727, 28759, 28678, 28703, 28768, 28725, 5541, 12396,
+    8657, 12502, 12300, 16564, 32781, 16527, 11779, 32845, 32841, 9863, 13080, 5921, 0, 12690, 32924, 16458,
+    0, 28747, 12335, 16537, 8712, 12740, 16832, 28778, 16777, 12574, 0, 28825, 28673, 12562, 11268, 0,
+    32819, 12763, 32817, 16765, 12574, 20481, 8666, 28804, 11480, 28702, 13184, 12945, 32777, 12690, 0, 32777,
+    12787, 12852, 13152, 16451, 28734, 8956, 28736, 28678, 32832, 12681, 12881, 12847, 16823, 0, 0, 12312,
+    16462, 28726, 12345, 28747, 11246, 28682, 28701, 9316, 28809, 12392, 12479, 9051, 13176, 13210, 12479, 12012,
+    16527, 28752, 17328, 9182, 12705, 9056, 12763, 8919, 12751, 32885, 12068, 12309, 13174, 12491, 10137, 10371,
+    12300, 28678, 9905, 28724, 9263, 12990, 28711, 10347, 28675, 13176, 12967, 12419, 12526, 28821, 20487, 16900,
+    13212, 28692, 17170, 16540, 13176, 28748, 28823, 8458, 28700, 12656, 12431, 16833, 16598, 9481, 16675, 9906,
+    10100, 8451, 12752, 12863, 13044, 12527, 12443, 12311, 28706, 12466, 4711, 12515, 9809, 28706, 28705, 12584,
+    9661, 4721, 12607, 28784, 12527, 28823, 9547, 16893, 10642, 12419, 9616, 13200, 16518, 16824, 12012, 4885,
+    13223, 28740, 28726, 28691, 12371, 16842, 9294, 32781, 9891, 28745, 10137, 28707, 12623, 28692, 12538, 17091,
+    10713, 12894, 28822, 28813, 20486, 12299, 13080, 32923, 12381, 28824, 9044, 17332, 12894, 17328, 13080, 28697,
+    28733, 16677, 17320, 5454, 32793, 12700, 8658, 16833, 28716, 9518, 12585, 32844, 28758, 28691, 32853, 9003,
+    16541, 8719, 8657, 12477, 12795, 28757, 17195, 32931, 28746, 10941, 32844, 13222, 0, 12500, 9816, 12383,
+    28756, 10563, 13140, 12310, 9317, 8711, 32781, 28756, 32791, 9311, 28719, 28738, 28711, 17290, 28803, 32820,
+    12417, 16451, 12840, 20489, 12066, 12432, 0, 12800, 32831, 28738, 12608, 12479, 16688, 13152, 32780, 28679,
+    8405, 0, 0, 8751, 12693, 5334, 17332, 16618, 12455, 9963, 12500, 11655, 32868, 12739, 16609, 12431,
+    11035, 16685, 28702, 13068, 17332, 28804, 10750, 32864, 12966, 32920, 17399, 0, 10153, 9363, 28691, 12454,
+    28808, 12078, 12551, 28785, 28802, 10184, 13224, 0, 12078, 32879, 9372, 17038, 10697, 5993, 16991, 12702,
+    12491, 16616, 32846, 12943, 28726, 13188, 12797, 11035, 8751, 32935, 12791, 28749, 13222, 17411, 12847, 12919,
+    16609, 16756, 12787, 11246, 9317, 28711, 16776, 12500, 28787, 5105, 12068, 0, 12859, 12512, 9564, 16991,
+    12478, 13032, 28819, 12788, 28688, 32793, 28738, 16450, 17038, 0, 28676, 17332, 17332, 28759, 12622, 12501,
+    12658, 10405, 12967, 28826, 8703, 28759, 8751, 17328, 8367, 17227, 12608, 28692, 12768, 12418, 28823, 28685,
+    13000, 8470, 16887, 17369, 12299, 4727, 10376, 10512, 13212, 12066, 11033, 12480, 32833, 28789, 13001, 16538,
+    13210, 28825, 13220, 16449, 32924, 8467, 10489, 32843, 9309, 17060, 12502, 28749, 13015, 13188, 13221, 28739,
+    12768, 28815, 16697, 12347, 12360, 28774, 5075, 28706, 12574, 12002, 12863, 17386, 12298, 16974, 16779, 32878,
+    28819, 32781, 0, 17376, 28785, 28784, 12874, 12573, 0, 0, 9219, 12575, 12384, 9317, 32872, 28788,
+    28731, 12620, 12894, 13132, 12478, 16618, 12966, 12323, 9665, 32807, 20490, 12489, 16619, 12716, 28804, 28681,
+    12691, 12465, 12765, 12801, 13176, 16463, 8404, 12078, 9971, 0, 20483, 28804, 0, 12360, 10758, 28822,
+    4982, 11049, 12477, 12512, 17158, 28714, 9601, 32892, 12885, 17386, 16697, 0, 12789, 16982, 9355, 32898,
+    16853, 32806, 28781, 9294, 12789, 12468, 12348, 12728, 32867, 32924, 32867, 28704, 10459, 28696, 12324, 12994,
+    12608, 12693, 12609, 12068, 13187, 28758, 16775, 12551, 12466, 16459, 12312, 12705, 12502, 12336, 11012, 12312,
+    16902, 28680, 16699, 12859, 28822, 12851, 16450, 12904, 28782, 28792, 12887, 12776, 12670, 12797, 32832, 10196,
+    9915, 5099, 16524, 9355, 12800, 28714, 10251, 8422, 12551, 9863, 16999, 28681, 28804, 16824, 28751, 10483,
+    12826, 28749, 28785, 16911, 0, 12500, 28774, 13013, 12694, 16965, 12788, 13224, 9900, 17069, 28751, 28825,
+    12408, 12811, 12454, 12478, 32846, 32846, 12886, 13110, 12360, 32892, 12895, 13017, 9674, 12396, 12466, 28821,
+    16833, 28731, 0, 12619, 12752, 16834, 5552, 8404, 28726, 8487, 10758, 12803, 16766, 5651, 32820, 28741,
+    28764, 12490, 10144, 16618, 28759, 12443, 9174, 28749, 12526, 12348, 9601, 12779, 12574, 28781, 28730, 28774,
+    11679, 12873, 0, 0, 13002, 13224, 32862, 16895, 10415, 11436, 12682, 28677, 32867, 28792, 12430, 12979,
+    12684, 12622, 28677, 28773, 0, 12610, 16619, 11567, 8713, 32924, 32833, 8720, 16911, 16609, 12790, 8766,
+    11402, 28801, 16834, 12861, 28774, 20483, 9899, 12489, 8658, 12790, 11729, 12909, 16974, 16924, 17377, 4983,
+    17369, 12875, 28753, 13001, 28683, 12922, 12668, 16529, 12622, 16833, 13188, 28731, 12905, 12874, 9907, 12888,
+    28734, 28773, 28748, 16895, 16921, 12516, 32791, 16609, 12454, 28693, 12492, 12468, 28678, 12752, 9648, 12814,
+    9356, 28775, 12705, 10751, 28689, 12797, 13176, 12742, 9321, 12896, 28746, 17369, 12490, 8460, 28769, 20485,
+    28739, 12526, 9947, 28761, 12455, 12873, 13223, 12563, 17406, 28816, 16767, 12909, 0, 9610, 28774, 11151,
+    10079, 12862, 12788, 28791, 12813, 17148, 28722, 16835, 28792, 16914, 0, 12432, 32924, 17406, 16777, 28796,
+    28696, 28715, 12905, 12491, 16992, 16765, 12682, 32931, 16451, 9311, 11081, 8459, 9083, 12408, 12742, 11039,
+    6145, 8658, 17409, 28758, 28825, 12895, 10815, 28688, 17132, 16844, 28720, 10153, 28753, 12647, 9019, 12896,
+    12743, 28717, 32831, 28824, 13223, 32820, 12528, 12515, 9318, 0, 13014, 32892, 32807, 11095, 12408, 32924,
+    9649, 13014, 28763, 12599, 5584, 28826, 13212, 32924, 9350, 28792, 16617, 12931, 12812, 13164, 28774, 12812,
+    12695, 12525, 0, 16924, 9908, 32905, 13212, 10452, 13222, 12827, 32856, 10151, 0, 12704, 32867, 28786,
+    0, 12707, 8720, 9219, 17148, 5658, 32794, 12908, 10489, 10152, 12467, 0, 12920, 28768, 28760, 16777,
+    8760, 11334, 16491, 10551, 17407, 16987, 16934, 32924, 10796, 17069, 12715, 12908, 12420, 16778, 0, 11059,
+    5461, 28692, 13223, 8487, 17079, 10205, 16834, 32885, 12372, 11059, 16903, 12503, 11380, 11013, 32880, 28783,
+    16778, 32898, 16853, 20486, 32904, 10199, 9320, 0, 16921, 12431, 28786, 13063, 12635, 28822, 0, 17001,
+    16461, 16420, 32871, 12526, 17203, 28695, 12803, 28739, 10461, 9356, 12695, 13127, 28823, 10205, 5651, 16540,
+    12706, 9918, 28702, 28731, 16777, 12931, 12622, 16779, 12791, 0, 9067, 13026, 13063, 12800, 12468, 28752,
+    16935, 6433, 17248, 28825, 16779, 32804, 13221, 12955, 17203, 12931, 28775, 11387, 11545, 12694, 28824, 28815,
+    10161, 12802, 12324, 8667, 32858, 32931, 10161, 12802, 13016, 13017, 28756, 16460, 13223, 9964, 0, 0,
+    28765, 28766, 12527, 17079, 28780, 6427, 12803, 9954, 17398, 28786, 32881, 16461, 32880, 13135, 5830, 28775,
+    8468, 12621, 11710, 10207, 12790, 12456, 11178, 12886, 28729, 10488, 5651, 12515, 10415, 9971, 12910, 28825,
+    5499, 12911, 12718, 17227, 28823, 11041, 12980, 28696, 12790, 13222, 16619, 12780, 9954, 12876, 28762, 28679,
+    12611, 12731, 12647, 20481, 13108, 12360, 10207, 9021, 9908, 9610, 16540, 9909, 11059, 13101, 12716, 16991,
+    13223, 28796, 16700, 9681, 12682, 12919, 12049, 32867, 13005, 28798, 28749, 12717, 12480, 10506, 12504, 12994,
+    8479, 32911, 12897, 32908, 28782, 12898, 9084, 17158, 12824, 10502, 28679, 11013, 12406, 28765, 13085, 28798,
+    12768, 10804, 9058, 32895, 0, 17201, 28754, 12540, 32871, 6044, 28696, 9350, 28678, 17140, 28693, 5986,
+    17396, 12372, 12718, 12479, 13224, 32857, 12909, 12503, 16595, 0, 12491, 20481, 28800, 12716, 12885, 32881,
+    9618, 28822, 28702, 0, 10804, 28775, 0, 12813, 12706, 10216, 12920, 16745, 12515, 16463, 32781, 12564,
+    12419, 12622, 13199, 28797, 9909, 17218, 10199, 12823, 28708, 9619, 12636, 28754, 10869, 10162, 12800, 32781,
+    28757, 10191, 28774, 28740, 17387, 10116, 12812, 12910, 12717, 12611, 8422, 28765, 20484, 16451, 17274, 28752,
+    13024, 13063, 28789, 32931, 32870, 13120, 12491, 28752, 12432, 16609, 9863, 12811, 17151, 12636, 0, 28764,
+    11103, 17001, 28796, 32807, 28758, 10804, 5499, 32895, 0, 12910, 28825, 10797, 28720, 28751, 17132, 32872,
+    13007, 28730, 12033, 0, 12716, 28759, 10495, 10813, 12515, 12468, 13024, 12971, 28718, 28825, 17150, 16992,
+    12456, 9665, 12707, 10161, 12681, 12621, 12898, 12898, 28764, 17248, 28762, 28789, 0, 12705, 32870, 28798,
+    28801, 11402, 12658, 12899, 12825, 9917, 28738, 28799, 13224, 17140, 16541, 28790, 32859, 17211, 12899, 12695,
+    16993, 28788, 32894, 13005, 12636, 12707, 28758, 28777, 32856, 17140, 12719, 32896, 16540, 13030, 12621, 28720,
+    12372, 20490, 11735, 11450, 28770, 32856, 28765, 12682, 0, 28738, 12480, 11050, 32905, 28770, 12658, 12812,
+    32893, 12909, 12695, 16925, 9357, 12792, 13053, 9919, 9076, 0, 12503, 9066, 32833, 12550, 12707, 13039,
+    5921, 20487, 17398, 10805, 12972, 11312, 32895, 12420, 12920, 32923, 28730, 32884, 9979, 12791, 13042, 12826,
+    10545, 28719, 11058, 12777, 10272, 13025, 9985, 28827, 13008, 13028, 28777, 16922, 16767, 12720, 17062, 17070,
+    9674, 6051, 13107, 17062, 12743, 12935, 12468, 28753, 28788, 28799, 32936, 28813, 17062, 17081, 11058, 11679,
+    13050, 12612, 13016, 28816, 28766, 28741, 13039, 6117, 28739, 12850, 10285, 10272, 17072, 5666, 12993, 32869,
+    8776, 11356, 17388, 12825, 13029, 17248, 12995, 28702, 9077, 9980, 17083, 28764, 0, 13006, 11657, 17410,
+    11112, 11105, 11693, 11143, 13039, 12360, 28745, 9986, 12612, 17219, 28773, 13025, 13139, 17399, 13224, 12934,
+    17409, 10515, 10869, 13066, 12851, 28826, 32905, 13051, 28774, 12372, 6044, 17253, 13063, 28801, 28819, 28802,
+    28784, 6293, 28675, 17388, 12659, 13007, 28749, 28686, 13016, 32894, 17001, 13017, 12684, 17061, 28757, 12899,
+    28786, 12933, 12862, 17140, 12768, 13050, 32833, 6181, 13028, 16925, 12312, 9657, 28703, 13211, 32820, 17408,
+    12899, 9076, 0, 12468, 16932, 28827, 16934, 13030, 32933, 28776, 10517, 12921, 17002, 11013, 11404, 16993,
+    16699, 13113, 5629, 17387, 10218, 32858, 12708, 17150, 28718, 28800, 9985, 28754, 16936, 32833, 6409, 9919,
+    16778, 16854, 28815, 9956, 12922, 32935, 11349, 12564, 17072, 17160, 13007, 11402, 16932, 10273, 32857, 17071,
+    17072, 9919, 28780, 10506, 0, 12719, 28766, 9684, 12516, 13006, 28789, 12552, 28765, 13019, 32894, 28782,
+    32894, 0, 16925, 32934, 16856, 32907, 28788, 11112, 11159, 16854, 8768, 10264, 10207, 13074, 28816, 12719,
+    11450, 13175, 9676, 12946, 20489, 12612, 10261, 12360, 11693, 17410, 9377, 12719, 12911, 11686, 28708, 9917,
+    11096, 28789, 12731, 28776, 8487, 12922, 0, 28788, 9965, 0, 0, 12910, 12851, 12909, 17388, 10272,
+    12508, 32881, 12515, 9964, 28678, 12516, 0, 28696, 9972, 12456, 28696, 11776, 8414, 32846, 13109, 12516,
+    13066, 12636, 12730, 8777, 28767, 13018, 28763, 6145, 28763, 17230, 28742, 28753, 13029, 12439, 12707, 12611,
+    32935, 28752, 9956, 8470, 11357, 12504, 17081, 8787, 28800, 8940, 17172, 28776, 9975, 32907, 12923, 13121,
+    12995, 12863, 6321, 28764, 16934, 5666, 10572, 16936, 9986, 13017, 32936, 9975, 28800, 28738, 12694, 12716,
+    10263, 28801, 28751, 12079, 17094, 16779, 5927, 13030, 10853, 12636, 28811, 11096, 11710, 10869, 28770, 16856,
+    10506, 12717, 9981, 17408, 11159, 6447, 12996, 11096, 11115, 12993, 20488, 16935, 28764, 17411, 12731, 32872,
+    12826, 28812, 12623, 28679, 28776, 10507, 12718, 32894, 16933, 0, 8479, 12512, 12432, 28791, 28799, 28828,
+    6188, 13078, 11656, 17090, 28752, 8478, 16914, 17150, 12719, 28763, 28752, 11357, 17072, 32896, 13018, 17150,
+    16937, 12933, 10255, 32869, 9985, 32934, 11443, 13031, 12440, 17151, 32932, 28798, 32898, 6225, 10860, 6234,
+    0, 28764, 28813, 10216, 28765, 17160, 12815, 12946, 12504, 12622, 17408, 0, 9086, 9982, 28789, 12612,
+    5666, 13028, 17228, 17062, 32907, 13043, 17316, 28747, 12623, 28769, 10571, 11152, 12623, 12912, 0, 9965,
+    13029, 11414, 13040, 28766, 12696, 11450, 12696, 6235, 32893, 8787, 28797, 9674, 12944, 6059, 12804, 17411,
+    8787, 28826, 13041, 11458, 28696, 11115, 32935, 12719, 28684, 28762, 13055, 12516, 12623, 17316, 12516, 12946,
+    17161, 12969, 10216, 10563, 32896, 28765, 32882, 16924, 28790, 13054, 12551, 12792, 12934, 11972, 32856, 28757,
+    11113, 12683, 28802, 28753, 12468, 28763, 32934, 10760, 12612, 28762, 12825, 12612, 11159, 13164, 9022, 28800,
+    0, 17094, 28778, 12492, 11470, 0, 17081, 12659, 12623, 0, 28731, 9387, 17082, 32896, 17081, 28827,
+    9387, 10218, 12480, 17237, 0, 10263, 28776, 11932, 32884, 12468, 12516, 17004, 11114, 9982, 20488, 11159,
+    13176, 11436, 12960, 12441, 10515, 11168, 32885, 11956, 11734, 12580, 12444, 13031, 28788, 32897, 12840, 12792,
+    13031, 10263, 12946, 12944, 32858, 9975, 12324, 9964, 32935, 28776, 12491, 16934, 17012, 10554, 13144, 13157,
+    17003, 17151, 12696, 9984, 12935, 12492, 0, 12863, 0, 28828, 28806, 11395, 11749, 10515, 0, 17237,
+    28765, 16778, 28790, 12827, 9684, 13075, 10272, 32935, 12612, 32936, 13029, 13044, 13148, 28755, 17094, 13098,
+    32882, 11152, 13164, 17082, 0, 16935, 8470, 17083, 16526, 32908, 17297, 28778, 9975, 12888, 28802, 28788,
+    16925, 10573, 10270, 13145, 12465, 17229, 10563, 10816, 17411, 5674, 32896, 13086, 6357, 32883, 12660, 9975,
+    10264, 28790, 32909, 28788, 12480, 0, 28802, 13019, 32882, 11115, 13175, 28806, 17082, 9919, 32846, 13075,
+    13029, 28753, 28789, 12888, 0, 12310, 13055, 28738, 17319, 20489, 10516, 28736, 12827, 9965, 9686, 28708,
+    10264, 32815, 11648, 28738, 28810, 11710, 13127, 32896, 12900, 28766, 11655, 28738, 11414, 13017, 11776, 32933,
+    13188, 28810, 13029, 6233, 8787, 32858, 12500, 28788, 5674, 6454, 12356, 17319, 16934, 9965, 12815, 0,
+    32884, 13111, 11702, 28778, 28704, 28801, 16937, 28810, 12504, 6357, 12700, 28798, 11467, 17280, 11160, 20489,
+    11169, 32884, 28753, 20488, 32858, 28732, 17251, 10255, 11113, 28828, 10272, 0, 11413, 13065, 28789, 32937,
+    9975, 12792, 12664, 16858, 13145, 11161, 8343, 13116, 13065, 6326, 13053, 12780, 12816, 11451, 28776, 12791,
+    12804, 10816, 12624, 32794, 32872, 12516, 12780, 12612, 12636, 17082, 17252, 32934, 11450, 0, 28764, 12935,
+    17083, 6392, 20482, 10272, 28749, 0, 17171, 12946, 28810, 28788, 28740, 17093, 13075, 32857, 12828, 28762,
+    0, 6059, 9983, 12900, 28755, 28789, 28799, 28750, 17240, 11180, 28755, 12368, 13052, 17252, 32908, 11648,
+    12612, 9086, 8256, 32937, 17297, 12983, 17083, 13028, 9088, 32858, 6350, 12624, 9387, 0, 11404, 28828,
+    28755, 16658, 28802, 0, 12492, 9975, 32936, 13018, 32794, 0, 13087, 32858, 13053, 12816, 13077, 6410,
+    20482, 12594, 12996, 11358, 16937, 32937, 11414, 28790, 8307, 11749, 20487, 12934, 12947, 28797, 9772, 32896,
+    8790, 16571, 12840, 0, 28776, 28725, 17173, 12888, 28809, 8491, 11694, 32882, 32872, 12683, 28759, 13063,
+    17239, 9983, 12743, 12784, 13111, 17290, 11954, 12520, 13087, 20484, 16587, 28808, 9986, 17306, 28767, 13111,
+    32918, 32805, 28728, 12381, 11694, 13064, 28791, 16764, 17091, 10862, 16421, 0, 6059, 32840, 28702, 17093,
+    11694, 10582, 28755, 16492, 28767, 12333, 11467, 6234, 28776, 13041, 0, 28725, 20487, 11656, 32936, 32937,
+    10563, 12540, 13065, 12593, 0, 12935, 13077, 12296, 28736, 16597, 13008, 28701, 12540, 0, 16578, 13017,
+    9175, 32934, 17320, 32791, 13164, 13043, 17092, 0, 32909, 13079, 10563, 11451, 12876, 12509, 12887, 28789,
+    0, 16667, 13127, 12310, 12357, 10218, 10563, 28704, 32871, 16588, 12948, 17013, 11160, 9986, 10871, 28776,
+    0, 11182, 0, 12392, 8687, 32910, 17083, 28680, 32777, 12720, 9745, 32933, 32817, 17298, 17083, 0,
+    11413, 13088, 12394, 11477, 12624, 17095, 17411, 16587, 17014, 28814, 0, 13224, 0, 10285, 28714, 12945,
+    11459, 28787, 11656, 13040, 28701, 12946, 17320, 9986, 11161, 28681, 32924, 12492, 12393, 28801, 12056, 11742,
+    8905, 12707, 20489, 10285, 32936, 0, 28828, 17004, 28704, 0, 13078, 32841, 10283, 28676, 28810, 8318,
+    13224, 12357, 0, 32817, 28802, 11713, 28790, 13146, 10880, 12947, 17004, 12672, 17170, 0, 10282, 32869,
+    9986, 12816, 12570, 17240, 28745, 8688, 20489, 6189, 13123, 10861, 8882, 16743, 12321, 32872, 11749, 17249,
+    10571, 6455, 17092, 12815, 28828, 13064, 13043, 28703, 11735, 10815, 12390, 11404, 11757, 28673, 8357, 11468,
+    12406, 28791, 13080, 17162, 12828, 28678, 28815, 17171, 13066, 28752, 10583, 13053, 12355, 11179, 16519, 32908,
+    12696, 9686, 11932, 12665, 28723, 13054, 17240, 9388, 28802, 12370, 12864, 28756, 20490, 10573, 28790, 12773,
+    17162, 17004, 28677, 12761, 13137, 28721, 12708, 10872, 12653, 12815, 32790, 28712, 17014, 12912, 8883, 28734,
+    12676, 0, 12508, 9508, 16831, 32909, 12792, 28811, 10816, 32909, 8648, 9515, 17316, 9985, 32859, 16914,
+    11768, 17241, 6326, 12696, 32814, 28766, 12657, 28737, 13078, 13160, 12056, 11657, 11169, 12379, 28777, 9740,
+    8356, 11939, 0, 12888, 28810, 32884, 6448, 32859, 28756, 0, 12321, 0, 11703, 10583, 10880, 28715,
+    32788, 28736, 13087, 20489, 16429, 28809, 13171, 12900, 6466, 13078, 11749, 16517, 6402, 16447, 12392, 10581,
+    10572, 13100, 28753, 12369, 28732, 12438, 17241, 28734, 28712, 12792, 28711, 32792, 11414, 32790, 16676, 11115,
+    12356, 28810, 28779, 28802, 0, 12521, 28698, 13162, 13161, 12474, 13212, 13055, 16990, 28763, 12496, 28732,
+    10583, 13055, 13128, 13055, 13040, 28798, 13114, 12846, 8284, 16734, 10862, 12935, 12496, 28779, 28692, 28779,
+    12381, 28677, 12463, 11414, 16858, 20489, 28733, 10273, 28716, 28813, 32872, 12439, 12556, 28766, 0, 12480,
+    28768, 28827, 8708, 13043, 13042, 12296, 28776, 28802, 12479, 12439, 28756, 12803, 12846, 16674, 12739, 12816,
+    9287, 11459, 16822, 0, 16857, 10572, 28748, 28755, 0, 13137, 28773, 0, 28765, 11459, 13150, 13078,
+    32779, 13020, 17318, 28812, 28802, 17309, 10870, 12876, 9197, 32840, 6457, 10581, 11451, 10816, 32924, 20485,
+    9687, 8917, 10872, 9750, 0, 13077, 13029, 12321, 11171, 17094, 12370, 9286, 28709, 32872, 13055, 13067,
+    28801, 13173, 8994, 28703, 0, 11895, 28814, 12465, 13182, 13185, 12636, 6466, 12381, 0, 16936, 9686,
+    28746, 28756, 28778, 32936, 11169, 16746, 17004, 12857, 13149, 28682, 9496, 11470, 13042, 28755, 17171, 12815,
+    16858, 13139, 0, 12630, 17173, 0, 11750, 8364, 12404, 12996, 32910, 12612, 32919, 28814, 28726, 32918,
+    11757, 13138, 17174, 32819, 12665, 12816, 12636, 17173, 12034, 11049, 13019, 12935, 12773, 13030, 13139, 32805,
+    13066, 32937, 10584, 4613, 8344, 12924, 32872, 12948, 16450, 0, 32816, 28725, 13020, 10283, 0, 17299,
+    28804, 12720, 13161, 32803, 12785, 20484, 11780, 11712, 9985, 16429, 28814, 17093, 32922, 16762, 12344, 11946,
+    0, 13031, 17249, 12520, 13079, 28737, 28814, 28736, 28790, 28680, 9984, 8319, 12492, 16448, 17015, 20482,
+    28757, 17173, 32898, 28734, 12676, 12331, 0, 0, 0, 16437, 28811, 17320, 28686, 0, 32777, 0,
+    28791, 28680, 0, 13055, 12676, 12533, 12655, 12372, 11977, 13161, 32872, 11182, 11171, 10882, 28754, 32922,
+    32818, 0, 11413, 16499, 28729, 12972, 28785, 13172, 28780, 17318, 13147, 10882, 28756, 12298, 0, 17318,
+    28747, 12335, 32841, 17095, 0, 12311, 8912, 12996, 28734, 12309, 16937, 12900, 32921, 12869, 17241, 28812,
+    8419, 11469, 17319, 12912, 28737, 8409, 32885, 0, 28717, 13148, 12382, 11170, 32840, 11460, 12948, 0,
+    12010, 16579, 0, 28803, 28706, 10582, 12945, 32789, 11179, 10285, 8491, 13186, 13056, 0, 6365, 28811,
+    13149, 17319, 28812, 17016, 28715, 28814, 28814, 13149, 17241, 16764, 16597, 8912, 32842, 17308, 8390, 11749,
+    12936, 28723, 32922, 17016, 8350, 10621, 11992, 17095, 32817, 0, 11758, 28809, 32842, 11703, 0, 12876,
+    32885, 12948, 10880, 12511, 20489, 17319, 9605, 20484, 32885, 32832, 8882, 12654, 0, 13161, 13162, 16579,
+    12834, 32844, 28767, 20484, 6456, 8612, 13139, 12000, 12395, 28728, 20484, 12452, 28799, 32780, 20490, 28673,
+    12605, 6465, 12393, 0, 17252, 28773, 20485, 32792, 11757, 32844, 32818, 8911, 0, 13077, 13066, 11180,
+    8911, 17094, 16598, 12720, 10583, 12454, 16598, 16517, 13043, 12383, 16675, 9281, 11978, 13184, 28682, 28812,
+    13163, 12912, 13113, 17252, 13211, 12382, 13195, 28694, 28678, 13149, 0, 10883, 8404, 28764, 9515, 32872,
+    32842, 12666, 12571, 28732, 12065, 28801, 8583, 12684, 4673, 11182, 12499, 17173, 28690, 32843, 13032, 12455,
+    12475, 10285, 13161, 28677, 12395, 13079, 8709, 17252, 9017, 32780, 16677, 32843, 20485, 12440, 11480, 13068,
+    9474, 10872, 17331, 12370, 17299, 4827, 32817, 12604, 32830, 17250, 12574, 9560, 32921, 16687, 28698, 13149,
+    11871, 12773, 9181, 28758, 11095, 0, 28809, 0, 28792, 28712, 28768, 9553, 10880, 11179, 16517, 17319,
+    32921, 8284, 11179, 12064, 32833, 12490, 32842, 28814, 32818, 28726, 12738, 13161, 12344, 32816, 13076, 12750,
+    28692, 13206, 13162, 12924, 28780, 28721, 12512, 17253, 10626, 28699, 28814, 12534, 16755, 12881, 0, 28755,
+    17317, 12407, 13020, 9540, 32805, 12654, 28697, 10925, 32844, 12396, 0, 28724, 32832, 13219, 12417, 12455,
+    17117, 11170, 28827, 9779, 11477, 16675, 10883, 10883, 9509, 12428, 0, 28759, 13020, 9815, 12594, 10061,
+    9217, 20486, 12359, 12405, 6235, 16744, 11469, 28757, 13207, 20490, 17095, 12428, 32793, 12418, 11481, 12572,
+    12077, 0, 11750, 16518, 16440, 11776, 6411, 12879, 13211, 28757, 13164, 9859, 9777, 8948, 11633, 10377,
+    16823, 17252, 11481, 9552, 0, 17309, 13206, 12501, 13150, 12074, 12371, 12359, 28791, 12312, 28746, 5211,
+    12828, 12869, 13067, 12323, 11404, 8619, 16754, 28780, 28721, 28676, 32805, 13078, 0, 32830, 13044, 32885,
+    12954, 17016, 0, 11171, 28813, 11224, 12501, 13160, 28756, 28769, 0, 0, 17309, 13020, 20484, 13175,
+    17320, 32789, 0, 16527, 0, 0, 28738, 28729, 17253, 10112, 12465, 32898, 12511, 12823, 12512, 13140,
+    28814, 9480, 12068, 28747, 0, 28683, 32911, 6466, 28729, 0, 11758, 32923, 10584, 12381, 16756, 8358,
+    28803, 8994, 17016, 0, 28811, 12500, 12960, 12430, 8948, 12605, 17016, 12608, 0, 13067, 28757, 16605,
+    13187, 8396, 32922, 12785, 13077, 12499, 12571, 12948, 32780, 5249, 17173, 28800, 0, 0, 9802, 28764,
+    12000, 16448, 9307, 13079, 17060, 12323, 20490, 13208, 32922, 28813, 13163, 12824, 20490, 12299, 20490, 20490,
+    12395, 12371, 12606, 12324, 16737, 11759, 11470, 0, 20490, 0, 28803, 28813, 28814, 12524, 12948, 10974,
+    12977, 16667, 5329, 12720, 11769, 12583, 12479, 11768, 16538, 12443, 32832, 10883, 20482, 12870, 0, 12298,
+    28706, 9899, 9606, 28756, 16696, 16832, 12513, 28749, 16756, 28680, 11180, 16587, 8358, 17253, 12076, 13172,
+    13044, 13185, 12383, 12678, 12802, 10132, 13184, 12384, 28747, 12563, 12383, 28735, 8321, 12643, 12989, 17250,
+    0, 12324, 12371, 9807, 8412, 9563, 0, 32892, 12311, 9349, 12383, 12372, 12500, 17061, 13152, 11050,
+    32832, 12762, 9845, 16937, 28812, 28735, 12077, 12488, 10735, 28782, 13125, 17252, 0, 32922, 13008, 16878,
+    12478, 32868, 28768, 28768, 11780, 17318, 12667, 32794, 13068, 17095, 16880, 32807, 28721, 12936, 10498, 13068,
+    32898, 17320, 12393, 12936, 17016, 20484, 8396, 28774, 8666, 12335, 16765, 12300, 8665, 9316, 28752, 12371,
+    17250, 11947, 28691, 28803, 12408, 32794, 4630, 12523, 12454, 32819, 28756, 12065, 12903, 28679, 9553, 17410,
+    9814, 12740, 28689, 13212, 12774, 12701, 13199, 16430, 8403, 12583, 17038, 28714, 13175, 8403, 28719, 28738,
+    16737, 12936, 12321, 16756, 12490, 28718, 12989, 16745, 28815, 13185, 0, 0, 8695, 13032, 32922, 13161,
+    13199, 28763, 12692, 28749, 12348, 5772, 17408, 16500, 12453, 8411, 28803, 13164, 32923, 16885, 28778, 16676,
+    12512, 28734, 12513, 13056, 28754, 16460, 28763, 32806, 12720, 16766, 12689, 12444, 9852, 12513, 12527, 28767,
+    20485, 17320, 12584, 13103, 28808, 28728, 8949, 17395, 16677, 17253, 12607, 32924, 12861, 9779, 20490, 9807,
+    12335, 28756, 20490, 12512, 0, 28714, 12477, 12524, 13212, 12515, 9808, 13056, 12932, 13188, 9592, 17095,
+    28811, 17174, 13056, 12322, 32807, 17253, 17037, 12912, 8964, 12657, 12871, 10404, 5099, 32923, 16528, 16519,
+    12428, 13151, 12454, 28822, 28693, 13152, 9891, 28706, 9182, 4982, 16823, 12706, 13164, 16606, 13080, 13164,
+    16508, 12523, 28768, 12636, 9814, 28679, 4722, 12643, 10131, 17016, 28712, 32911, 16910, 8956, 28745, 16588,
+    12000, 12372, 28757, 10482, 17332, 16952, 32840, 28754, 13044, 13152, 32820, 28726, 11780, 12477, 12606, 13164,
+    12999, 12776, 0, 16459, 0, 10100, 12395, 0, 12595, 9846, 10144, 16815, 17378, 13212, 13056, 10437,
+    16756, 12344, 28815, 28677, 28780, 12500, 17174, 11780, 13012, 13187, 12609, 28780, 28828, 13044, 8964, 12323,
+    13187, 13044, 16824, 28726, 16609, 12882, 9653, 17330, 17174, 17253, 12655, 8703, 8351, 8321, 28738, 28674,
+    12655, 16620, 13199, 16450, 12491, 13188, 0, 12789, 12572, 13199, 0, 16774, 9018, 16686, 32815, 13210,
+    28723, 9003, 16911, 17196, 12067, 9022, 32820, 28824, 12467, 13080, 32820, 16451, 13198, 12502, 13151, 9301,
+    12633, 12431, 28792, 8620, 12372, 0, 16815, 28804, 12682, 8368, 13218, 32781, 13068, 16913, 10442, 28690,
+    17329, 12729, 12573, 11956, 12786, 12562, 12012, 16461, 28717, 9642, 32819, 8758, 9264, 9009, 16835, 32855,
+    12049, 0, 12695, 0, 8666, 12655, 28782, 12777, 9218, 12828, 9256, 28828, 17354, 28693, 28737, 9009,
+    16596, 28766, 11334, 0, 12618, 10077, 12503, 10377, 12079, 13211, 17369, 13218, 17395, 12704, 10078, 28718,
+    16459, 13219, 13186, 8665, 13152, 28779, 13198, 28822, 13198, 8758, 13186, 12396, 13176, 12396, 13220, 32868,
+    12999, 28762, 12608, 9934, 28780, 28676, 8420, 13090, 28804, 10714, 12989, 17331, 28723, 12786, 32882, 13218,
+    13068, 17377, 12695, 12515, 10108, 28701, 13186, 13210, 12730, 10078, 12989, 9001, 32779, 16767, 13044, 9898,
+    28753, 10472, 12778, 28729, 0, 28678, 12514, 13014, 10974, 12812, 32833, 16766, 12408, 11104, 12954, 16842,
+    12419, 10178, 13163, 17038, 10782, 8696, 16440, 28758, 9914, 9863, 28749, 32879, 28773, 13208, 13209, 17070,
+    12075, 17332, 12012, 12610, 8964, 8665, 12076, 4982, 10077, 12002, 28815, 12895, 28721, 12898, 9891, 13080,
+    0, 28748, 12786, 16765, 28792, 32832, 12882, 8711, 17411, 8412, 28820, 8713, 13014, 28819, 16685, 10150,
+    32840, 28730, 5099, 16991, 5589, 12608, 12905, 28773, 12706, 13176, 12707, 12701, 12467, 9609, 28739, 13210,
+    9383, 9343, 28796, 12067, 12670, 12930, 12906, 28690, 28826, 28803, 9898, 28792, 9854, 28768, 12797, 8366,
+    28791, 13209, 12848, 12896, 12408, 5068, 13219, 12512, 12692, 28785, 16894, 10107, 16925, 12572, 28755, 28760,
+    17139, 32820, 12455, 32923, 12324, 16775, 17038, 28768, 10144, 12491, 10460, 12788, 12828, 28780, 11274, 13001,
+    8412, 12633, 28826, 32870, 12608, 17053, 20483, 16816, 17411, 12797, 11443, 28756, 28749, 16529, 28718, 32832,
+    12058, 13080, 16696, 10816, 12884, 12610, 9518, 28820, 17330, 12897, 28716, 28792, 12827, 28768, 12300, 28821,
+    12324, 10162, 16700, 13000, 16440, 16621, 12788, 12480, 28751, 13172, 16921, 12966, 12862, 11769, 17398, 17332,
+    13080, 32832, 12618, 28780, 17410, 28772, 12778, 12692, 20486, 12681, 13186, 28752, 12491, 10161, 16451, 16894,
+    28760, 12702, 10113, 10204, 12420, 28762, 12682, 16843, 10234, 9616, 13199, 28759, 12622, 12563, 10758, 28762,
+    28754, 13210, 32853, 16920, 28702, 12056, 17330, 12705, 12077, 10460, 12610, 28785, 16816, 8468, 16459, 9817,
+    9908, 32869, 12560, 17148, 16978, 9947, 12012, 28789, 10205, 28735, 12622, 10580, 9963, 12896, 20487, 32841,
+    9892, 28701, 28768, 12573, 5484, 13023, 12078, 17395, 12408, 12754, 13211, 28780, 28816, 28776, 16913, 28776,
+    32794, 17411, 10786, 8424, 16541, 9908, 12798, 28762, 12068, 12575, 12384, 17196, 9609, 12906, 28719, 32780,
+    28757, 9564, 12798, 28791, 12503, 9663, 10161, 11057, 8920, 16450, 28780, 20486, 12672, 11057, 28822, 16982,
+    12467, 13200, 12704, 11050, 28721, 0, 12527, 12743, 12348, 10162, 10415, 12898, 8452, 12931, 10162, 28738,
+    12777, 12812, 16606, 12610, 28827, 28782, 32894, 28727, 13211, 10562, 17331, 9301, 9382, 12849, 12443, 12715,
+    12779, 10872, 12741, 12611, 5340, 28721, 8397, 12801, 16618, 10442, 28787, 9863, 12455, 28753, 12503, 16922,
+    16844, 13007, 12704, 9310, 12904, 13052, 8704, 8459, 5460, 16911, 9981, 17053, 13210, 11778, 28678, 16923,
+    28731, 12622, 17079, 16461, 28797, 12383, 32895, 13017, 12904, 12480, 32881, 12706, 32930, 13004, 12789, 28761,
+    32879, 4727, 28758, 28695, 12490, 12812, 8405, 16451, 12981, 12516, 12704, 12707, 9900, 12801, 12708, 12791,
+    28786, 28798, 12705, 28812, 16982, 28781, 12823, 10255, 16450, 28787, 12514, 32895, 16621, 16983, 8711, 17161,
+    12479, 17409, 32833, 13174, 16529, 28752, 12612, 10452, 12695, 12636, 28718, 10207, 12443, 10460, 17410, 12693,
+    0, 28738, 9914, 17227, 9972, 28701, 12933, 12610, 28776, 28822, 28770, 28821, 16982, 13200, 16924, 28727,
+    12825, 28764, 20481, 13040, 28792, 28822, 28761, 32868, 17399, 11334, 13198, 28786, 8460, 12068, 13002, 8453,
+    32880, 32882, 32869, 20487, 28798, 32924, 17410, 12622, 16699, 12300, 12994, 9908, 12456, 9318, 16460, 32882,
+    13210, 28753, 10199, 12299, 32892, 12528, 10507, 16922, 12312, 12944, 32832, 8723, 32832, 12444, 9620, 28828,
+    28766, 32870, 17219, 12945, 28762, 16924, 28758, 12480, 10797, 28789, 12695, 10207, 13014, 13222, 32855, 12611,
+    13224, 16451, 12468, 20488, 13187, 12944, 32883, 16619, 20481, 28781, 28764, 12078, 32854, 28777, 16699, 17001,
+    32911, 17148, 28712, 28704, 32934, 12348, 32908, 16699, 12360, 28719, 12564, 12623, 20488, 28764, 16620, 28768,
+    9059, 12704, 12694, 28788, 28798, 9083, 32868, 12707, 0, 28742, 12480, 11633, 11334, 13210, 28708, 12848,
+    11013, 12802, 0, 32869, 12908, 12695, 8468, 12384, 12743, 12980, 8485, 32896, 12420, 9020, 16463, 32820,
+    12909, 12885, 10199, 13014, 12908, 13078, 12899, 12420, 28752, 28776, 12515, 32870, 28684, 12479, 12790, 17331,
+    9364, 12919, 12408, 12468, 32933, 32871, 12909, 13200, 12945, 10506, 12336, 0, 28766, 28765, 28823, 28748,
+    12479, 17141, 12743, 9671, 28742, 11059, 12492, 12611, 17061, 10806, 12078, 11334, 10208, 12922, 32895, 10461,
+    32917, 12920, 28721, 12897, 28792, 11480, 28787, 32924, 12444, 16538, 28818, 32869, 20485, 12384, 28712, 28753,
+    12993, 32907, 12931, 28734, 12912, 32895, 13220, 28788, 10207, 12737, 0, 28798, 5590, 32820, 12934, 28788,
+    17079, 11058, 12931, 12491, 11436, 17320, 17376, 28775, 17015, 28789, 8460, 13040, 12813, 12780, 28788, 13054,
+    12444, 12900, 12826, 28731, 16778, 11713, 16993, 13210, 5673, 0, 11137, 9975, 28787, 28822, 28775, 13025,
+    28801, 13211, 28787, 16923, 28764, 5665, 10489, 17012, 32935, 32794, 17082, 17151, 6101, 32897, 10212, 13026,
+    32931, 13221, 32923, 17332, 17411, 16462, 28776, 28775, 10862, 32935, 9962, 28683, 13016, 9383, 8476, 28786,
+    16844, 28827, 13221, 28703, 12791, 12944, 10804, 10207, 28824, 12897, 12516, 28823, 28732, 17411, 12691, 6044,
+    0, 28777, 12707, 17004, 28776, 28786, 6205, 12408, 12909, 13053, 32871, 16460, 12695, 32894, 13152, 10205,
+    11152, 12815, 0, 12444, 28763, 28775, 16924, 12444, 28822, 28775, 32924, 16932, 32895, 28827, 32856, 12825,
+    32882, 10806, 32856, 28801, 12802, 17002, 11137, 28828, 32937, 28763, 0, 28826, 32857, 9680, 12768, 12551,
+    32883, 28752, 32833, 12611, 13200, 10264, 12600, 8785, 13200, 16621, 12827, 17275, 32906, 13051, 12564, 12420,
+    10199, 28708, 28789, 9955, 12480, 12683, 11356, 8767, 17397, 28824, 17385, 12803, 9674, 28774, 12696, 17072,
+    28797, 28775, 12825, 28765, 12718, 16700, 28755, 11611, 32895, 16937, 32884, 4463, 16462, 12384, 28802, 17150,
+    28813, 12420, 12719, 13199, 28778, 17230, 12991, 28707, 17332, 0, 28780, 0, 12863, 32893, 28774, 12588,
+    28827, 12492, 32897, 8461, 13041, 28825, 10282, 12730, 28788, 17151, 32910, 8723, 32936, 28738, 0, 13024,
+    13068, 12814, 28800, 12707, 28755, 32909, 10253, 17172, 9773, 12803, 0, 0, 28828, 32794, 32935, 6051,
+    10143, 10581, 17407, 12612, 12959, 17406, 12922, 28827, 0, 32830, 10270, 0, 28799, 16925, 9953, 0,
+    10806, 0, 32840, 16855, 6433, 17250, 10516, 10259, 0, 28826, 0, 28789, 28777, 12610, 17227, 20483,
+    12444, 32933, 12384, 17229, 17332, 28777, 17151, 9973, 20488, 28737, 12920, 11115, 28803, 28828, 12635, 28802,
+    12576, 12552, 13211, 12504, 10879, 28786, 12957, 32907, 12791, 28787, 28826, 12910, 17150, 13085, 0, 12624,
+    28820, 28749, 16924, 28790, 11115, 0, 11647, 20488, 32907, 0, 9666, 17013, 0, 12943, 17081, 28801,
+    28823, 17399, 13109, 32895, 28754, 32885, 12576, 12791, 8917, 13018, 28799, 9217, 17409, 8470, 8988, 28824,
+    8649, 13024, 32937, 12803, 12576, 32909, 11411, 12452, 32884, 12946, 32846, 12504, 12534, 32909, 9384, 28775,
+    12899, 12488, 17299, 0, 17012, 28702, 17396, 28749, 28749, 12079, 28808, 9955, 9985, 28695, 32907, 17331,
+    32906, 13051, 32858, 12549, 32882, 28778, 16621, 17240, 9375, 13223, 0, 0, 32908, 10881, 8479, 28691,
+    12684, 28825, 9620, 28766, 20482, 28791, 9365, 12815, 28703, 28727, 32882, 32909, 17308, 9981, 32777, 13053,
+    28826, 10415, 9974, 0, 12420, 32884, 4409, 12491, 12488, 10255, 28801, 9241, 28737, 17151, 28720, 32870,
+    10814, 6020, 11633, 9181, 28774, 0, 12504, 12624, 17003, 32897, 9358, 17081, 13015, 17162, 16778, 17016,
+    17162, 9306, 17083, 28824, 17211, 28828, 28825, 0, 0, 13222, 32817, 17238, 12744, 32896, 32936, 10217,
+    9383, 13187, 13119, 9088, 11469, 0, 28802, 12719, 12357, 13029, 13116, 12444, 13065, 9974, 13030, 12442,
+    12429, 12384, 12516, 13067, 32907, 28811, 12911, 11112, 5927, 0, 32898, 5629, 32935, 13172, 28755, 32871,
+    0, 17248, 32907, 11693, 12923, 13065, 32896, 17090, 9509, 13224, 0, 12300, 28800, 12910, 32871, 9956,
+    16463, 17241, 28801, 28790, 10860, 16992, 13004, 28825, 10273, 9216, 13054, 28702, 17004, 13031, 28713, 13005,
+    12624, 6058, 32937, 0, 11655, 32933, 20489, 0, 11572, 8854, 12504, 28809, 28801, 17241, 17330, 28787,
+    32859, 28800, 0, 9975, 0, 9974, 28787, 13025, 10255, 32909, 13019, 32937, 32884, 10263, 28767, 28682,
+    12945, 12816, 28824, 28729, 12456, 28800, 16925, 32820, 28779, 0, 20489, 13185, 28779, 28684, 9387, 28779,
+    0, 0, 6226, 6059, 13016, 28767, 16686, 4933, 12947, 28757, 12612, 12934, 17082, 9972, 13109, 12432,
+    0, 28759, 12396, 13028, 9974, 13212, 16463, 28746, 9553, 12654, 13040, 17399, 0, 12477, 17241, 9089,
+    9247, 13066, 20489, 0, 17309, 17308, 16587, 12911, 9982, 13017, 12381, 10452, 0, 13032, 32908, 17387,
+    13039, 32898, 13067, 20485, 13019, 17083, 10872, 0, 32918, 12456, 32897, 10162, 9208, 12960, 28708, 9009,
+    13211, 12334, 28773, 0, 32885, 12922, 16933, 28786, 17411, 12946, 13020, 13006, 16779, 12504, 10815, 8955,
+    17173, 28827, 32907, 28801, 0, 17162, 13132, 17012, 0, 28813, 32791, 0, 28824, 11450, 32871, 11441,
+    13111, 17169, 28786, 28739, 0, 9089, 28801, 28679, 12816, 28810, 32896, 0, 32936, 28727, 11713, 8919,
+    9377, 16933, 28720, 12804, 11413, 11430, 17251, 13041, 17399, 16993, 8278, 13079, 32911, 10871, 12847, 9972,
+    12804, 28763, 13017, 11477, 12936, 28767, 12948, 12900, 28808, 13224, 9386, 9387, 17162, 0, 12947, 13055,
+    6350, 32885, 16936, 12432, 28797, 12708, 12720, 13055, 12778, 28827, 16935, 16766, 8911, 28724, 12368, 28702,
+    11895, 11114, 12720, 28747, 13054, 12393, 9590, 12719, 28767, 28803, 32778, 9686, 17171, 12827, 28825, 12708,
+    9086, 0, 12827, 13121, 0, 32898, 13040, 16856, 13212, 32937, 28748, 12948, 28701, 16936, 28799, 13086,
+    12816, 13124, 13054, 12498, 28790, 16923, 13144, 13067, 12911, 17408, 17298, 32818, 20489, 32937, 20489, 32885,
+    28767, 28747, 11168, 28775, 32884, 13110, 12923, 20485, 28825, 8995, 9975, 10263, 8487, 12333, 28802, 28786,
+    28735, 10562, 12371, 12792, 28780, 8284, 9985, 32833, 13077, 32884, 12876, 13043, 28789, 12772, 17319, 17092,
+    32936, 12342, 12492, 17004, 13065, 32885, 13067, 10517, 12857, 12870, 16519, 32936, 28711, 28700, 32871, 28811,
+    0, 11404, 17094, 12666, 20489, 20488, 11713, 32831, 8365, 28752, 16421, 28779, 17001, 12516, 13079, 12432,
+    16675, 12687, 16737, 12936, 12489, 9674, 16516, 12947, 12912, 0, 17003, 11822, 28810, 13019, 0, 17162,
+    8918, 11413, 12521, 20483, 17171, 13031, 16665, 20481, 0, 12684, 9973, 16858, 11468, 16936, 11778, 10153,
+    12791, 13018, 28776, 12406, 28709, 28786, 9515, 32819, 28756, 20489, 12516, 28715, 17091, 28811, 11161, 12463,
+    12804, 11712, 6402, 32884, 32898, 17093, 32937, 9388, 9675, 32845, 12547, 11458, 12610, 28776, 17240, 13008,
+    17252, 4609, 16499, 32842, 32817, 11711, 11152, 9984, 6365, 17318, 28810, 32833, 12804, 12792, 10273, 32910,
+    12572, 12395, 32840, 9452, 16463, 17409, 12514, 28813, 9001, 12492, 17015, 32910, 32816, 28810, 12804, 20484,
+    8918, 32819, 13086, 11159, 28727, 12582, 5498, 10853, 0, 32897, 0, 9974, 28826, 12947, 28757, 17306,
+    12618, 8876, 13065, 9844, 8322, 28696, 0, 0, 28813, 28810, 13031, 11161, 13079, 12487, 28775, 12923,
+    13136, 9982, 12510, 16500, 8962, 16779, 28738, 13077, 0, 13076, 9982, 0, 16596, 17241, 28779, 20483,
+    12475, 32909, 12773, 8642, 10760, 12900, 28716, 13043, 28778, 32842, 16450, 28734, 28767, 13055, 28763, 16806,
+    28746, 16463, 13042, 13052, 28811, 12393, 28731, 28738, 11946, 12792, 32778, 12582, 12510, 12512, 12501, 28759,
+    28704, 8948, 10338, 12454, 9839, 13079, 12405, 32924, 28815, 11470, 17240, 17170, 28747, 28734, 16579, 12900,
+    16756, 16514, 28724, 12803, 9561, 12720, 13137, 12936, 28810, 28735, 9779, 12441, 12511, 28706, 28730, 13043,
+    32804, 17398, 13031, 17093, 9216, 16765, 28812, 13043, 32831, 17172, 11470, 12750, 28716, 17388, 12630, 28801,
+    28738, 13020, 32818, 9984, 9907, 32817, 0, 13195, 32803, 12605, 12620, 9561, 0, 5269, 0, 16753,
+    9985, 28786, 11779, 12816, 28749, 13079, 28737, 28734, 9241, 28722, 16598, 17014, 32833, 12465, 12777, 28702,
+    12812, 9247, 12382, 32921, 32934, 17239, 28787, 12620, 28715, 12549, 12453, 10572, 28820, 10113, 11596, 32817,
+    17015, 12463, 10274, 17196, 8411, 12393, 32936, 9262, 12347, 12548, 12666, 8480, 13056, 12619, 32832, 16518,
+    16815, 10278, 28753, 20483, 12488, 28814, 11178, 8710, 12888, 32845, 9817, 12322, 28814, 12429, 13068, 11713,
+    8390, 28777, 13079, 28791, 28715, 32871, 17319, 28749, 17309, 12417, 10274, 12912, 8911, 12310, 28812, 32831,
+    32862, 12428, 10498, 28713, 10284, 9300, 12816, 16421, 9001, 12511, 12828, 12371, 16815, 28729, 9940, 32831,
+    11168, 28814, 28824, 10871, 4955, 17052, 28678, 0, 12924, 28803, 28730, 28785, 9986, 13134, 16911, 12464,
+    28776, 10066, 8642, 9884, 9546, 20490, 12606, 28690, 8344, 16857, 10581, 9599, 12688, 12501, 12334, 28678,
+    17141, 28730, 28724, 20488, 12405, 11181, 6464, 9086, 12876, 12523, 9686, 17331, 12514, 12924, 9779, 13175,
+    12523, 28691, 13091, 12453, 28720, 12515, 32910, 28724, 12880, 12622, 12900, 12583, 20482, 10285, 13042, 12689,
+    28684, 28720, 13066, 12335, 10107, 12487, 28773, 13054, 17252, 12418, 12948, 17253, 13055, 12573, 5253, 16879,
+    12078, 13149, 12431, 32856, 6189, 17250, 28762, 10414, 11740, 16500, 9642, 28807, 12515, 28689, 12419, 12713,
+    12296, 16698, 28813, 28769, 8489, 12624, 28703, 28753, 32789, 11655, 13123, 12681, 16808, 17308, 11729, 13156,
+    9839, 12693, 32793, 13076, 12798, 17174, 16687, 12955, 16756, 9890, 20490, 9564, 12504, 12816, 16686, 17320,
+    6325, 10751, 28785, 12500, 12796, 28731, 28801, 32911, 28760, 16887, 8758, 17172, 32881, 13211, 13175, 17218,
+    16527, 10283, 12681, 12431, 28797, 28706, 28765, 11477, 28749, 12444, 12058, 16445, 17016, 11768, 9592, 28722,
+    12778, 10804, 32879, 16686, 13145, 17131, 28739, 12694, 20490, 20488, 10159, 32869, 28758, 32937, 12910, 12814,
+    12621, 10050, 28714, 28747, 12492, 12742, 10883, 12978, 28751, 28812, 5334, 11479, 16430, 10883, 12785, 13187,
+    13158, 16430, 12516, 17227, 12936, 17150, 12802, 13020, 12490, 11182, 12912, 17251, 17318, 13103, 12923, 12453,
+    13089, 16517, 28789, 16605, 12779, 12858, 13195, 11479, 10150, 17327, 28812, 28702, 28803, 13148, 8476, 9986,
+    12622, 32920, 10883, 16764, 28812, 28763, 9218, 12895, 10584, 13139, 10573, 28714, 13150, 28763, 12658, 32832,
+    28803, 12977, 13149, 8420, 28716, 9854, 32868, 32898, 32867, 8403, 16895, 16696, 13172, 28762, 12681, 12690,
+    12893, 28773, 11479, 6457, 28708, 10285, 32854, 13068, 12610, 28781, 9248, 12418, 10882, 9897, 13076, 12514,
+    28679, 13032, 12371, 28782, 9211, 16887, 12797, 12882, 12501, 12933, 12801, 17388, 8696, 28758, 12551, 13077,
+    32806, 28815, 32894, 17094, 12515, 11767, 28816, 13138, 11171, 0, 12996, 12801, 9845, 28799, 12778, 12490,
+    17319, 28787, 17309, 12788, 12516, 12441, 12599, 12789, 17319, 13032, 16765, 12707, 10196, 32845, 28752, 12813,
+    0, 9900, 28803, 9899, 17081, 12693, 28751, 17318, 12798, 11780, 13198, 10190, 11182, 12551, 28786, 10190,
+    11304, 9946, 32779, 13020, 10714, 13172, 20483, 10516, 13079, 9900, 28678, 12551, 12825, 11182, 12524, 17173,
+    11180, 11182, 28768, 12691, 16913, 28737, 10882, 12383, 8446, 28760, 13136, 16526, 32881, 12430, 12931, 28776,
+    12584, 12910, 12798, 12694, 9858, 11181, 12802, 12824, 12513, 12419, 32872, 10881, 13152, 28815, 5453, 12990,
+    12011, 28703, 12620, 16697, 17174, 9885, 28749, 12419, 12847, 17092, 12621, 20488, 12792, 17071, 28692, 28752,
+    12731, 28752, 17252, 28774, 12948, 12609, 17320, 12827, 16620, 32898, 17252, 6101, 12895, 12683, 17330, 28775,
+    12871, 12897, 9663, 12550, 17332, 10415, 12467, 17249, 16430, 32872, 28740, 16765, 12801, 32869, 20490, 11297,
+    17411, 11049, 12716, 13090, 12892, 32806, 12490, 28756, 12791, 12729, 13044, 28767, 12396, 28753, 12899, 10452,
+    28749, 10507, 9909, 12312, 32857, 32919, 28775, 12058, 17394, 11412, 28815, 32807, 13138, 12693, 16913, 12779,
+    13056, 11151, 12480, 9619, 12312, 28797, 12695, 28731, 32892, 20483, 28812, 28796, 13138, 11895, 17095, 32898,
+    17141, 10571, 12479, 28774, 11992, 16983, 11349, 28756, 13187, 28714, 12335, 12610, 32935, 17410, 10506, 10204,
+    12706, 13160, 12456, 28676, 16538, 13150, 12514, 17253, 17093, 12897, 28799, 16448, 17253, 28763, 12576, 17013,
+    13211, 32923, 16914, 28809, 13149, 32882, 12611, 12550, 12908, 13161, 17251, 32868, 9908, 16937, 13032, 10760,
+    32895, 10584, 12719, 12610, 28775, 13156, 12882, 28798, 17095, 11769, 32870, 12479, 11679, 28786, 11978, 28789,
+    28701, 13068, 28785, 28673, 16992, 12919, 11993, 10498, 16914, 11115, 12479, 9003, 13020, 17229, 12942, 12431,
+    9620, 10583, 20488, 10196, 12479, 9616, 11181, 17174, 12419, 12840, 12431, 13044, 28789, 17251, 28787, 13183,
+    13089, 17001, 16688, 12824, 16778, 28792, 16764, 12825, 12862, 8475, 11358, 10788, 32894, 12420, 12707, 32833,
+    9900, 28791, 5333, 28804, 11312, 28756, 17141, 28785, 11182, 12791, 17410, 11114, 32871, 12079, 20488, 28828,
+    10584, 28822, 32923, 32885, 13157, 32894, 17332, 28815, 12790, 12705, 12624, 16621, 32911, 28690, 12041, 28774,
+    32923, 16776, 28815, 32859, 5270, 12924, 32921, 6466, 17072, 6387, 28799, 32819, 28756, 10503, 13207, 11895,
+    32870, 13148, 10759, 12779, 16993, 10255, 11779, 16983, 11171, 28796, 28689, 5499, 12791, 28747, 12396, 28815,
+    13139, 32880, 13197, 28810, 32867, 13198, 12920, 12420, 32868, 13150, 20488, 28800, 28774, 12012, 16914, 10208,
+    16923, 9610, 12612, 28689, 17248, 12706, 10190, 13020, 10207, 11404, 17253, 12824, 28756, 32933, 28780, 20487,
+    12336, 10498, 28804, 28754, 28789, 12801, 28676, 12610, 13162, 12933, 10813, 12610, 32911, 12611, 12623, 5877,
+    28753, 12824, 12694, 13175, 28780, 28764, 20488, 12324, 12825, 32911, 8785, 16923, 20488, 17299, 16775, 28813,
+    11160, 17141, 17253, 28828, 12705, 13150, 32884, 12933, 11481, 28767, 0, 16925, 28754, 32882, 20488, 12876,
+    12909, 28803, 11169, 12431, 12906, 12824, 17405, 12706, 32934, 28754, 28780, 12503, 13160, 16937, 12563, 16620,
+    12515, 28828, 32870, 28788, 12683, 16775, 32936, 13207, 12611, 28763, 12468, 12075, 17230, 12897, 16992, 11780,
+    28788, 12932, 28780, 8784, 32898, 12935, 28765, 13030, 28787, 28752, 16937, 17399, 5665, 9908, 11610, 13175,
+    12564, 32871, 11358, 13173, 32870, 12068, 32934, 13053, 0, 16993, 28800, 13199, 11710, 28792, 32807, 17230,
+    11312, 9648, 12718, 28761, 11178, 28788, 12695, 28812, 13163, 12814, 17410, 28797, 17332, 13198, 12978, 11469,
+    10199, 17252, 13187, 12922, 12348, 11105, 12934, 0, 12624, 16700, 13183, 12503, 17309, 32920, 10197, 12503,
+    12623, 28777, 28778, 28769, 13030, 13164, 13044, 13163, 12923, 13164, 28801, 13176, 13162, 32871, 32921, 10208,
+    20488, 32870, 13207, 28758, 32870, 28732, 10218, 13151, 12443, 32894, 32936, 10815, 11159, 28762, 12814, 32935,
+    12432, 13018, 11769, 17003, 12984, 13152, 9546, 13163, 16935, 12719, 16924, 8752, 28799, 12516, 20487, 11105,
+    13002, 13080, 20488, 32820, 13199, 5987, 17411, 32932, 8784, 32895, 28763, 28776, 13163, 16846, 11171, 28778,
+    12067, 10815, 13080, 32898, 13175, 12612, 17220, 32906, 28755, 16776, 9985, 28764, 12623, 12791, 28788, 32872,
+    32819, 11780, 17003, 10582, 13065, 6234, 10806, 32871, 28798, 13151, 12802, 32871, 28731, 28828, 12948, 10543,
+    16620, 10244, 28711, 28823, 11105, 12420, 28826, 17230, 12944, 11603, 32883, 32883, 12594, 0, 28690, 13163,
+    20490, 17160, 12049, 5673, 13152, 17161, 12372, 32831, 12932, 9772, 13127, 17230, 28742, 28798, 28800, 32807,
+    28824, 12827, 17228, 13054, 28799, 12945, 13185, 13198, 12420, 12826, 13030, 28799, 32871, 28708, 13015, 28766,
+    17331, 28828, 32833, 32924, 17004, 12472, 11059, 28803, 16541, 10218, 12802, 28676, 12718, 28767, 9356, 13207,
+    12058, 11534, 16974, 12707, 28792, 17161, 12933, 17399, 6350, 32896, 12802, 12791, 28716, 32936, 12706, 10838,
+    13066, 12402, 12415, 32897, 11114, 13015, 10264, 10260, 13005, 16935, 32859, 16779, 28786, 20490, 12623, 13200,
+    12708, 9655, 12058, 32815, 16462, 20489, 28800, 12622, 11657, 17220, 12826, 28789, 13077, 32872, 32829, 12718,
+    12504, 28721, 10515, 12491, 9964, 0, 10544, 17297, 28698, 12707, 12729, 13164, 17230, 32909, 12324, 20488,
+    12623, 32790, 32911, 16675, 12719, 32895, 12911, 13080, 13140, 17388, 17062, 12034, 32869, 12444, 17330, 12815,
+    32937, 12994, 9373, 13065, 12814, 11115, 12695, 10216, 12826, 11450, 28678, 13066, 13207, 28800, 17251, 17411,
+    11710, 28673, 28768, 12381, 28755, 10218, 28776, 28711, 12480, 28768, 11701, 28824, 28754, 4678, 13078, 6181,
+    12828, 20483, 32897, 17330, 20488, 12726, 13054, 28748, 9666, 13223, 28690, 11779, 20488, 28691, 17092, 10760,
+    32883, 13016, 20489, 28681, 28792, 12780, 11105, 10144, 17082, 12899, 11458, 6059, 12468, 28776, 28768, 12815,
+    10039, 11114, 28779, 0, 28736, 10871, 13210, 20487, 12569, 11467, 12516, 12357, 16579, 13128, 12430, 28764,
+    13175, 13161, 17387, 12946, 12610, 13030, 17090, 32911, 17330, 12486, 12300, 32776, 8485, 12604, 28802, 12814,
+    13211, 9965, 17162, 8883, 11412, 12383, 16983, 9946, 13147, 32838, 17160, 10436, 12696, 12504, 12476, 28710,
+    12813, 28702, 32898, 11657, 13209, 17151, 13176, 12923, 16620, 12719, 12492, 16778, 32789, 11480, 28756, 28800,
+    12708, 10233, 11778, 28751, 10584, 13211, 32934, 12067, 12308, 32871, 12718, 16564, 13198, 28804, 10626, 12947,
+    32924, 13007, 12492, 28802, 28789, 12504, 13208, 28751, 16722, 28802, 12911, 28823, 11113, 11404, 28812, 12324,
+    12707, 17094, 16430, 32805, 13200, 17229, 10153, 13219, 6058, 10816, 16649, 16856, 28792, 10571, 12381, 12432,
+    28789, 12346, 10562, 12815, 16418, 12384, 9067, 28825, 6409, 28826, 13211, 13164, 13197, 12067, 16925, 13164,
+    32935, 11171, 32898, 16745, 12824, 12519, 12456, 11268, 16498, 17332, 17307, 13188, 13176, 11776, 28738, 12552,
+    12893, 32831, 8486, 6235, 13137, 0, 8470, 28675, 32921, 12791, 13200, 5367, 28766, 8468, 12002, 0,
+    12738, 28779, 32896, 9970, 12720, 13080, 28804, 32872, 10517, 32872, 12079, 12516, 17094, 12501, 28711, 9084,
+    9241, 12077, 12504, 12935, 32884, 28685, 28713, 17092, 9181, 11182, 32936, 17004, 12452, 10218, 12011, 28763,
+    12490, 17331, 12689, 12300, 13183, 28816, 32818, 20489, 9973, 13029, 28788, 28815, 12719, 32868, 16676, 9971,
+    10571, 12573, 32934, 12923, 12720, 10507, 32833, 12876, 10218, 28720, 28803, 28821, 28736, 12430, 12576, 10279,
+    12474, 28800, 17013, 12067, 12396, 28811, 13017, 32924, 20490, 16933, 12804, 13219, 12780, 10199, 17406, 9429,
+    12800, 13176, 32846, 12911, 12396, 12611, 10573, 28700, 28799, 20489, 11481, 8999, 9983, 17331, 16934, 32805,
+    12466, 12331, 28810, 28691, 32935, 8480, 17237, 10862, 13212, 11611, 12611, 10816, 28758, 13041, 32869, 28825,
+    13161, 17239, 28811, 6411, 17220, 17161, 17162, 13164, 10116, 10218, 12394, 16855, 28776, 12473, 32933, 16498,
+    28721, 17083, 13188, 20482, 16937, 16676, 28677, 28698, 13200, 6211, 28699, 12322, 12911, 13173, 12486, 28810,
+    17013, 28727, 17299, 11480, 13176, 10264, 28813, 32910, 13200, 10562, 12415, 13219, 16766, 16924, 9773, 12827,
+    13212, 12612, 28828, 12333, 12935, 28732, 32911, 12912, 13065, 28776, 32910, 12676, 13066, 9686, 28804, 28703,
+    28816, 32789, 12405, 28675, 4880, 12795, 9075, 12705, 12719, 6401, 12405, 11657, 12492, 28799, 8963, 32778,
+    16675, 32814, 12516, 12785, 12900, 12876, 32792, 11404, 16754, 13068, 32937, 28816, 12462, 12068, 10554, 9592,
+    28753, 32791, 13138, 13078, 12717, 12058, 13161, 12466, 9451, 20488, 12492, 20483, 9685, 32897, 28713, 9974,
+    17171, 17251, 13031, 17378, 12624, 16686, 12078, 12502, 28751, 28703, 28715, 16743, 20484, 32817, 12708, 12708,
+    12012, 13176, 28698, 13149, 11469, 28779, 28701, 12827, 11470, 20484, 28751, 12012, 28689, 10584, 17014, 13019,
+    12571, 4885, 16812, 12947, 11713, 12379, 28747, 12430, 16500, 12516, 12780, 11611, 11170, 12946, 11703, 12706,
+    12708, 12503, 32934, 28804, 28755, 28676, 13188, 12579, 28767, 12624, 17171, 9518, 13212, 11105, 32897, 16419,
+    20489, 17014, 11168, 12439, 13053, 16519, 9973, 28755, 12503, 12428, 17161, 12816, 12464, 28827, 6226, 32924,
+    13043, 12852, 12432, 12485, 12465, 32790, 32937, 13043, 12816, 28812, 32910, 28791, 28746, 28824, 12947, 28673,
+    9879, 28825, 28786, 32910, 28791, 12443, 12924, 28714, 28823, 12696, 12474, 16764, 28799, 17354, 9682, 28711,
+    12427, 13196, 11413, 10144, 28714, 32920, 11985, 12911, 32804, 28711, 32872, 28812, 28712, 28825, 11168, 16507,
+    32898, 12521, 9687, 32872, 12463, 11713, 32780, 28733, 28748, 11404, 20482, 28752, 17172, 28691, 12814, 28708,
+    12610, 12606, 32859, 32815, 32911, 9833, 13043, 28710, 32897, 28786, 17092, 13210, 28788, 17015, 12463, 17250,
+    12923, 17016, 28757, 17247, 32819, 20485, 9210, 28721, 28740, 10871, 12656, 11459, 12551, 28773, 6457, 28791,
+    28738, 28687, 28812, 13224, 12909, 28812, 9607, 12912, 12688, 13077, 28676, 12489, 11035, 28779, 28825, 12513,
+    32898, 17250, 13219, 32804, 20483, 28702, 12310, 13224, 9308, 28813, 13187, 17117, 12911, 28754, 28729, 12500,
+    8904, 10573, 13053, 11757, 12900, 28788, 16756, 10554, 12779, 12056, 32793, 12420, 12429, 8912, 12910, 10127,
+    28804, 11436, 11766, 12801, 12708, 12912, 28766, 12921, 11956, 16604, 12920, 17320, 12394, 12716, 13041, 10573,
+    10507, 12078, 17174, 13008, 17240, 12935, 8936, 32872, 28711, 16752, 12898, 28812, 9843, 16842, 28827, 32897,
+    28753, 17071, 10217, 16527, 28811, 8786, 17174, 17299, 16666, 28736, 12912, 28747, 11170, 8710, 28685, 13043,
+    12479, 13043, 10274, 32885, 12924, 12824, 32869, 13149, 28774, 12707, 12078, 16762, 28824, 32872, 13223, 32869,
+    32780, 11181, 17330, 28769, 12922, 10273, 11480, 12923, 9002, 32924, 13223, 11470, 28803, 12924, 12575, 12502,
+    11171, 12705, 13067, 28759, 28678, 32883, 32919, 12504, 12869, 10284, 12406, 28789, 10872, 28714, 10881, 13224,
+    8459, 12706, 32937, 12707, 10516, 10872, 28764, 28764, 12464, 32880, 16842, 28754, 12442, 12382, 12802, 12911,
+    8696, 28822, 11458, 32937, 17015, 32922, 28812, 12708, 16914, 16754, 12452, 28821, 12792, 11460, 12718, 28789,
+    13200, 11411, 13064, 12706, 13079, 32936, 32881, 13222, 17004, 11469, 28799, 12790, 13078, 32885, 12513, 16450,
+    32830, 28773, 28814, 9986, 32832, 17003, 20483, 12622, 28692, 12828, 32819, 6411, 17398, 13086, 12720, 17016,
+    12909, 32920, 32872, 28777, 13211, 9546, 13134, 28765, 28718, 12816, 17014, 12441, 32870, 32937, 28774, 13196,
+    17094, 10114, 32923, 17395, 28762, 12814, 12455, 10190, 16448, 12912, 28753, 12911, 28764, 9561, 12707, 12803,
+    12935, 11713, 20487, 13077, 28798, 28816, 17141, 28677, 28775, 32937, 13008, 13019, 32895, 28826, 28811, 10283,
+    8491, 28720, 20483, 12407, 12611, 17016, 28689, 17072, 17410, 16524, 12946, 12695, 13066, 12909, 10563, 12932,
+    12920, 28816, 28778, 11767, 12431, 28774, 28810, 17004, 32936, 32819, 32883, 12946, 16569, 20488, 10274, 32885,
+    17171, 17173, 28816, 28782, 32892, 13005, 6020, 32922, 28725, 12815, 12717, 12468, 12933, 28766, 10583, 32870,
+    13066, 28816, 12624, 28777, 32827, 32921, 28720, 12706, 12804, 12921, 10582, 9975, 11590, 12827, 28764, 16993,
+    10882, 17369, 12909, 16925, 32896, 8688, 28720, 9074, 12738, 17411, 17072, 28821, 32846, 28701, 12924, 11180,
+    32881, 12720, 32898, 28777, 11171, 28811, 16571, 28802, 28701, 32806, 11712, 12432, 10285, 32839, 28690, 12921,
+    12912, 32872, 28809, 12936, 12380, 12379, 32871, 13188, 28823, 11414, 20482, 28688, 12718, 12909, 8397, 10161,
+    13121, 20489, 12816, 12882, 28827, 16525, 32932, 20487, 28798, 16935, 32806, 28689, 28709, 12909, 10327, 17174,
+    20484, 13173, 28810, 32910, 12378, 12892, 12312, 32846, 32780, 10285, 13029, 10806, 20488, 28825, 28786, 28791,
+    17299, 12419, 13028, 12708, 13030, 32846, 16647, 11481, 11780, 32828, 16496, 8751, 28777, 10218, 13137, 28824,
+    17095, 10882, 9724, 12696, 12804, 13223, 17072, 13041, 13008, 32906, 11779, 11956, 13157, 28803, 12491, 32827,
+    12933, 13018, 11703, 12354, 32790, 28754, 13121, 12912, 32804, 12792, 28828, 28778, 17016, 28768, 20487, 11956,
+    17399, 12403, 28789, 17082, 12716, 17016, 28724, 32833, 28699, 13148, 13185, 12431, 28814, 17173, 28678, 11170,
+    12455, 17095, 10583, 28801, 28824, 13134, 28778, 12354, 32896, 17251, 12912, 32885, 0, 20489, 20487, 28688,
+    13051, 20489, 16605, 28710, 28690, 20489, 28763, 32907, 28824, 10882, 12492, 28677, 28824, 17094, 12923, 32898,
+    32792, 10583, 11469, 12011, 11822, 32897, 28791, 12079, 12707, 12924, 11750, 28708, 28827, 28789, 12402, 28754,
+    32882, 20487, 12624, 32936, 28675, 16664, 12909, 12923, 28768, 10285, 12804, 20484, 28811, 10573, 13098, 17016,
+    32815, 17094, 13140, 13030, 10285, 13079, 32817, 12947, 5460, 17318, 10284, 13186, 10881, 32906, 28732, 10573,
+    10882, 13004, 10274, 11181, 13140, 9941, 13175, 28681, 12507, 28810, 16516, 17160, 32833, 17397, 28687, 28724,
+    12419, 12863, 12334, 28757, 20484, 13029, 6402, 32937, 12696, 6466, 32817, 9003, 28811, 12947, 28810, 12910,
+    5651, 28798, 13032, 16767, 32920, 12415, 13151, 28812, 10269, 12079, 32935, 11171, 17095, 32883, 11181, 10583,
+    12804, 16421, 13017, 13136, 12367, 28816, 10208, 28774, 32871, 16617, 28699, 10584, 12336, 20484, 13174, 13020,
+    28688, 13054, 32934, 32896, 28816, 9973, 12504, 11780, 28800, 13143, 11778, 17253, 17299, 12792, 16663, 12442,
+    10872, 13163, 17320, 12611, 12924, 28811, 20483, 32871, 32827, 12932, 32827, 20484, 12432, 6233, 12900, 28714,
+    10273, 12551, 12298, 12444, 12402, 17230, 13065, 13030, 28697, 13168, 12403, 28812, 12403, 8476, 9853, 16675,
+    32833, 9074, 10882, 20482, 16777, 28812, 32815, 32817, 32896, 13008, 9599, 16570, 12605, 12802, 12912, 12803,
+    28804, 12426, 13146, 32922, 32911, 32830, 11413, 28811, 32790, 32935, 28688, 11993, 12438, 10883, 32936, 32921,
+    16426, 9598, 17409, 12816, 28687, 32919, 13185, 20482, 10816, 28756, 17378, 16694, 11171, 13044, 17388, 12390,
+    16663, 13066, 12002, 12911, 12816, 28824, 12622, 17004, 12828, 12946, 12814, 20483, 13183, 28716, 11469, 5971,
+    12450, 12355, 17240, 32937, 9663, 13224, 12911, 17094, 11435, 32911, 28787, 20484, 9430, 6411, 32817, 12708,
+    13079, 12989, 17082, 32803, 20489, 32832, 28755, 28814, 13209, 17407, 17174, 12370, 28826, 12079, 28709, 28686,
+    13029, 16427, 10217, 32827, 28724, 11712, 17330, 28786, 13172, 20484, 17399, 16571, 12696, 9561, 10584, 12312,
+    28790, 28722, 28735, 10273, 28710, 9954, 16492, 13076, 12322, 32827, 12923, 28759, 16498, 28700, 13161, 16664,
+    32909, 11481, 13066, 9147, 12382, 13080, 28815, 17082, 28788, 16937, 16444, 12403, 10584, 32829, 13123, 13224,
+    9974, 11993, 12405, 12380, 32897, 28824, 13196, 28778, 28800, 12846, 11035, 28677, 32803, 32922, 28710, 11769,
+    12911, 32790, 12935, 32817, 11780, 12432, 32909, 12826, 12508, 28688, 12391, 12336, 28701, 12382, 16664, 28745,
+    28726, 12804, 32833, 17230, 28811, 28700, 28756, 32897, 13031, 28790, 13172, 10584, 12580, 12899, 17002, 10573,
+    13164, 16428, 12331, 17309, 16447, 12415, 32830, 13008, 13211, 32863, 12464, 20482, 16664, 28816, 28685, 32805,
+    32920, 12347, 12559, 28726, 12803, 12453, 9665, 12720, 28777, 10264, 28686, 13174, 28678, 12720, 17409, 28687,
+    16499, 28678, 13031, 12802, 28787, 9152, 13188, 17329, 32911, 11480, 12719, 32806, 9450, 12804, 13079, 28779,
+    28801, 16515, 16430, 28815, 32923, 28799, 13197, 16936, 13030, 28767, 28676, 12444, 8637, 16507, 12580, 13019,
+    32833, 9986, 6174, 32790, 13184, 32806, 13185, 32884, 28778, 28726, 12792, 17332, 17411, 13185, 12431, 28764,
+    32869, 28828, 32885, 11769, 9839, 11480, 9497, 10274, 13138, 12946, 17253, 9152, 16500, 12720, 17409, 16800,
+    8338, 10862, 32937, 17378, 13032, 12948, 13044, 8920, 10583, 9671, 28780, 9533, 8785, 12910, 10173, 12804,
+    8785, 11769, 16524, 6466, 9975, 32910, 13174, 28752, 17095, 16499, 28821, 10207, 13002, 20484, 16578, 28687,
+    9240, 17016, 13053, 10572, 32894, 28791, 13029, 20482, 32908, 12370, 13104, 9889, 9445, 32872, 13012, 28814,
+    28788, 32898, 17150, 11956, 9281, 28823, 32793, 12508, 12611, 0, 9446, 17397, 32911, 28825, 10507, 12514,
+    13163, 28803, 9075, 28775, 32845, 32827, 16537, 6381, 10264, 11179, 28799, 13174, 28814, 28775, 12825, 11779,
+    32908, 10285, 28822, 32885, 12439, 11956, 12358, 9262, 0, 11171, 28755, 16421, 12430, 17004, 13008, 16602,
+    17174, 28764, 28713, 13175, 28800, 11182, 28755, 28798, 17253, 12624, 28688, 28799, 0, 32872, 12612, 28803,
+    13175, 10573, 17388, 32919, 11758, 12380, 13079, 13174, 13140, 28767, 12012, 12414, 12383, 32830, 13197, 13066,
+    16664, 28823, 11779, 13032, 28678, 28792, 12058, 32793, 28755, 12504, 28756, 32830, 12911, 8459, 16683, 17014,
+    13175, 28689, 20484, 28690, 17003, 28801, 20490, 13162, 11713, 16925, 12947, 11759, 32833, 28724, 12444, 32829,
+    28799, 8476, 13044, 28815, 12010, 20483, 12444, 0, 28709, 12743, 12551, 12947, 13066, 28755, 12438, 9972,
+    12079, 17081, 28791, 28814, 13150, 13176, 10584, 13175, 13077, 0, 28726, 28775, 32793, 28800, 13032, 13207,
+    0, 10806, 20488, 13067, 12912, 12912, 13186, 13173, 13160, 28780, 0, 13042, 28778, 0, 12828, 13198,
+    13207, 28827, 32829, 12827, 17093, 28767, 16463, 28799, 13080, 13055, 28688, 13044, 12009, 28799, 12333, 12430,
+    12947, 12900, 6466, 17014, 28821, 32806, 0, 12011, 11182, 12335, 8576, 17015, 28790, 28799, 13068, 10090,
+    28810, 28802, 28802, 13067, 28798, 32817, 11780, 13066, 13068, 28791, 0, 16446, 28814, 12382, 13174, 12480,
+    17093, 32920, 0, 28718, 28780, 13208, 12708, 28814, 13151, 13068, 28791, 32793, 9806, 0, 12780, 28811,
+    10883, 9198, 16596, 32872, 17332, 32898, 13183, 13224, 32922, 0, 13198, 0, 0, 28814, 13212, 13163,
+    0, 11779, 13053, 0, 28756, 13196, 17014, 13020, 0, 32885, 0, 0, 28813, 12708, 28792, 16937,
+    17331, 17329, 32921, 12816, 0, 0, 10572, 0, 13198, 13044, 28688, 0, 0, 16604, 0, 28768,
+    9065, 12828, 32833, 11769, 0, 0, 13164, 0, 0, 12335, 32923, 0, 32896, 28812, 0, 10218,
+    0, 13207, 0, 0, 28777, 0, 13032, 13186, 0, 0, 13151, 0, 0, 12774, 0, 11780,
+    17094, 0, 13176, 0, 0, 28787, 32937, 32910, 0, 28802, 32846, 28779, 0, 0, 0, 28768,
+    28778, 28779, 9534, 13020, 0, 32937, 28804, 11768, 0, 0, 28790, 0, 0, 0, 0, 28792,
+    28753, 11734, 13196, 28756, 17330, 12347, 10283, 0, 8389, 28813, 0, 17331, 28813, 28776, 17252, 0,
+    10274, 13221, 0, 20488, 20490, 0, 0, 0, 0, 0, 12011, 0, 13164, 0, 16683, 0,
+    0, 0, 0, 0, 12936, 9885, 8775, 10274, 0, 17329, 0, 12924, 0, 0, 12780, 28766,
+    32919, 0, 17016, 0, 0, 13208, 0, 0, 28815, 16936, 0, 0, 9662, 0, 0, 0,
+    17331, 17172, 0, 0, 0, 0, 13210, 13212, 28792, 28768, 32885, 28776, 0, 13162, 0, 13187,
+    13020, 0, 11523, 28823, 28778, 0, 13186, 9607, 28774, 28780, 13187, 17320, 13200, 12936, 28811, 0,
+    12828, 28803, 0, 32923, 0, 17332, 13211, 0, 28778, 0, 13210, 28801, 11768, 32807, 12900, 13188,
+    0, 13032, 13032, 17408, 13224, 28811, 0, 0, 0, 28779, 13162, 0, 28790, 10274, 28780, 13196,
+    0, 28788, 0, 0, 0, 0, 28804, 0, 0, 0, 0, 0, 0, 0, 13020, 28803,
+    0, 0, 28788, 0, 32919, 0, 0, 16694, 0, 0, 0, 0, 13197, 0, 28792, 13152,
+    0, 0, 13211, 13020, 0, 0, 0, 32807, 0, 28764, 32924, 9672, 9686, 16772, 28811, 0,
+    0, 13197, 0, 0, 13210, 0, 16536, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10274, 28686, 0, 13176, 0, 28811, 0, 28804, 0, 32846, 13196, 13186, 0, 12826, 13188, 8751,
+    0, 0, 0, 10285, 32923, 17015, 13175, 0, 10274, 0, 0, 28787, 0, 28825, 0, 0,
+    0, 0, 28815, 0, 0, 0, 13123, 0, 0, 13080, 16773, 0, 0, 0, 0, 28826,
+    0, 0, 0, 0, 0, 0, 10554, 11171, 28786, 12804, 28804, 28776, 0, 0, 0, 28823,
+    28779, 0, 0, 0, 0, 13184, 0, 17093, 28812, 0, 11779, 0, 13212, 0, 0, 0,
+    0, 28776, 20482, 13164, 17016, 0, 0, 11780, 28804, 0, 9682, 0, 28822, 0, 12900, 0,
+    0, 0, 13185, 0, 0, 12912, 0, 0, 28814, 0, 0, 0, 0, 0, 0, 0,
+    32833, 0, 0, 28768, 13198, 0, 0, 13195, 0, 0, 0, 0, 0, 28812, 13149, 0,
+    0, 0, 32911, 0, 32911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32922,
+    0, 11780, 0, 12803, 0, 0, 0, 0, 17378, 13188, 13078, 0, 0, 0, 13221, 0,
+    13222, 0, 8466, 0, 0, 9356, 0, 0, 0, 0, 0, 13125, 0, 13080, 0, 10881,
+    0, 10584, 8445, 0, 11479, 0, 0, 0, 0, 12816, 0, 0, 0, 10285, 12708, 0,
+    32924, 0, 28821, 0, 0, 0, 0, 0, 0, 0, 32833, 0, 0, 0, 13043, 0,
+    0, 32807, 0, 0, 28708, 11757, 0, 0, 0, 0, 17331, 0, 13032, 0, 28756, 0,
+    0, 0, 0, 0, 0, 9038, 0, 0, 13030, 0, 0, 0, 13212, 0, 13161, 0,
+    0, 0, 0, 32924, 0, 0, 0, 0, 13086, 0, 0, 0, 9984, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13032, 0, 0,
+    17332, 13161, 0, 28815, 0, 0, 0, 0, 0, 0, 0, 12348, 28766, 12360, 28804, 0,
+    0, 0, 13212, 0, 0, 0, 13223, 0, 28803, 0, 0, 0, 0, 0, 0, 17377,
+    0, 0, 0, 0, 0, 0, 0, 0, 32923, 28816, 0, 0, 12077, 0, 0, 0,
+    0, 0, 17398, 0, 13041, 28765, 0, 0, 0, 12936, 13079, 13008, 0, 0, 0, 0,
+    0, 13056, 0, 0, 17253, 0, 0, 0, 0, 0, 0, 0, 28811, 13140, 11768, 0,
+    0, 12009, 0, 28768, 0, 0, 0, 0, 0, 0, 0, 0, 13145, 0, 0, 0,
+    13176, 9648, 0, 12079, 0, 32911, 0, 0, 13017, 28810, 0, 0, 0, 0, 0, 13152,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28811, 0, 28813, 13197, 0, 0, 28768,
+    0, 0, 0, 0, 17378, 28816, 12360, 0, 0, 0, 0, 20490, 28780, 28804, 13163, 0,
+    0, 0, 0, 0, 12348, 0, 0, 0, 0, 0, 0, 11479, 20483, 12079, 0, 0,
+    13176, 0, 0, 28811, 0, 0, 0, 0, 0, 0, 13032, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 28826, 13221, 13222, 0, 0, 13223, 12079, 13222, 0, 13174, 0, 0,
+    0, 0, 13223, 0, 0, 0, 0, 0, 11480, 0, 0, 0, 0, 32924, 0, 13162,
+    28816, 12876, 0, 20481, 13164, 10584, 28822, 0, 0, 28822, 0, 0, 0, 17252, 0, 0,
+    0, 13221, 0, 32920, 0, 0, 0, 28827, 0, 0, 0, 10572, 13176, 0, 0, 0,
+    0, 13162, 0, 28792, 0, 0, 12348, 32872, 13222, 0, 0, 13147, 0, 12324, 32833, 0,
+    13222, 9655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12924, 28823,
+    0, 0, 0, 0, 0, 11182, 0, 0, 0, 0, 0, 0, 0, 0, 28804, 0,
+    0, 13163, 0, 13020, 0, 12012, 0, 11759, 0, 0, 28824, 0, 12360, 0, 13176, 0,
+    10285, 0, 0, 0, 0, 0, 0, 0, 13056, 12000, 13056, 28823, 17388, 0, 0, 0,
+    17406, 0, 28768, 0, 0, 0, 0, 28823, 0, 28827, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13152, 0, 0, 0, 0, 0, 0, 0, 13197, 12324, 0, 0,
+    0, 0, 0, 0, 0, 13032, 0, 0, 0, 28768, 0, 20483, 0, 0, 0, 0,
+    12002, 0, 0, 0, 0, 0, 0, 0, 0, 28827, 0, 0, 0, 0, 0, 17399,
+    12079, 0, 12079, 0, 0, 0, 0, 0, 9337, 28780, 0, 0, 10285, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32872, 0, 0, 0,
+    0, 0, 0, 0, 28824, 28756, 0, 28767, 0, 0, 0, 0, 0, 13199, 0, 13164,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13220, 0, 0,
+    0, 0, 0, 0, 13112, 28756, 13044, 0, 13172, 0, 0, 0, 13152, 0, 28821, 32872,
+    0, 28815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13163, 0, 13056, 0, 0,
+    32872, 0, 0, 0, 0, 32911, 0, 0, 0, 12804, 0, 0, 0, 0, 0, 0,
+    28821, 0, 13197, 0, 0, 0, 17397, 13173, 0, 0, 0, 0, 0, 12360, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32872, 0, 0, 0, 0,
+    28768, 0, 0, 0, 0, 28824, 28824, 0, 0, 28768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 32911, 0, 28824, 13078, 0, 0, 0, 0, 0, 28826, 0, 0,
+    0, 0, 0, 32911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28816, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32923, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28756, 0, 13163, 0, 0, 0, 12792,
+    17399, 0, 0, 13184, 0, 0, 0, 0, 0, 0, 17398, 0, 0, 0, 0, 28786,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17399, 0, 0, 32911,
+    0, 0, 0, 32923, 0, 0, 0, 0, 0, 0, 0, 0, 17388, 0, 0, 0,
+    0, 0, 13223, 0, 0, 0, 0, 0, 0, 17332, 0, 0, 0, 0, 0, 0,
+    0, 13221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 28816, 0, 0, 13151, 13164, 0, 13164, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 28823, 0, 13188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17399, 0,
+    28816, 0, 0, 0, 0, 0, 0, 0, 0, 13208, 17398, 13221, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13196, 0, 17329, 0, 13176, 13224, 0, 0, 0, 28804, 0, 0, 13188, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 28792, 28822, 13080, 28823, 0, 0, 0, 0, 0, 0, 28824, 0, 0, 0, 0,
+    0, 0, 0, 9985, 0, 0, 0, 0, 0, 0, 0, 0, 13164, 0, 0, 0,
+    0, 28822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 28822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13224, 28823, 0, 13184, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 13080, 0, 0, 0, 0, 28803, 0, 0, 13209, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13032, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28821, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 28815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28827, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 17408, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 28824, 0, 13222, 0, 0, 28804, 0, 0, 0, 0, 32924,
+    0, 0, 0, 0, 0, 0, 28822, 28812, 0, 0, 0, 0, 0, 0, 0, 0,
+    32898, 0, 0, 0, 17408, 0, 0, 12077, 0, 0, 0, 0, 0, 0, 0, 13200,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13152, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32924, 13209, 0, 13200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 28815, 17409, 0, 0, 0, 32923, 0, 0, 0, 0, 0,
+    0, 0, 28792, 0, 0, 0, 0, 0, 0, 0, 0, 28815, 0, 0, 0, 28821,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13122, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 28804, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13223, 0, 0, 0, 0, 0, 0, 0, 28821, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 12068, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28823, 0, 0, 0, 12068,
+    0, 0, 0, 0, 0, 0, 0, 0, 32911, 17378, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 28824, 0, 0, 0, 0, 28823, 0, 0, 0,
+    0, 0, 0, 0, 13176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28822, 17387, 0, 0, 0, 0, 0,
+    0, 0, 28826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 28825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28804,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28816, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 28823, 13224, 0, 0, 0, 0, 0, 13212, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 28827, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28822,
+    0, 0, 28826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13221, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 28827, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28823, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13224,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28827, 0, 28827, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28826, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 28823, 0, 0, 0, 0, 0, 0, 17408, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28826, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28823, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 28826,
+};
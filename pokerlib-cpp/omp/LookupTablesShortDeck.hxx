@@ -0,0 +1,1604 @@
+#include "HandEvaluator.h"
+
+// Non-flush lookup table for the evaluator (ShortDeckLookupLayout, size 17375 + 1 padding).
+// Generated by HandEvaluatorT::outputLookupTables().
+const uint16_t omp::ShortDeckLookupLayout::LOOKUP[] {
+    4097, 32769, 8195, 8379, 32771, 8194, 4103, 32771, 12298, 24642, 8286, 12305, 32770, 12290, 24593, 24585,
+    16424, 16461, 0, 32790, 8197, 32780, 16463, 32778, 32780, 4107, 32772, 12299, 0, 4109, 12291, 32772,
+    0, 0, 16426, 24644, 24585, 0, 24645, 8200, 32781, 8472, 32772, 12315, 0, 32790, 24595, 32791,
+    0, 4113, 16716, 24595, 4119, 0, 0, 32773, 32791, 16715, 24603, 12292, 12300, 24585, 8202, 24601,
+    0, 24586, 0, 24602, 0, 24587, 32791, 16716, 24594, 0, 8294, 24594, 32799, 0, 8292, 12308,
+    16432, 0, 32773, 32799, 0, 0, 32798, 32791, 24586, 16431, 16498, 8203, 32791, 8205, 24645, 32773,
+    32773, 24602, 0, 0, 32782, 16715, 0, 12355, 24603, 32782, 16506, 8393, 16396, 32781, 24593, 24596,
+    16505, 24602, 16398, 24594, 8565, 4131, 24594, 24602, 4133, 8486, 32800, 32792, 12356, 24602, 12348, 24577,
+    16399, 32800, 16469, 4123, 32800, 16473, 12364, 12363, 8385, 12364, 32791, 12309, 4137, 12364, 12332, 12332,
+    16539, 24611, 32773, 16434, 24611, 24595, 24610, 8306, 12324, 24604, 24604, 32782, 8397, 24611, 12292, 32789,
+    24610, 16474, 0, 24578, 12314, 24588, 12348, 24587, 32792, 16400, 4125, 24610, 24609, 8480, 0, 16717,
+    0, 0, 12339, 16717, 16400, 24612, 24603, 24612, 24646, 24611, 32801, 24612, 24595, 32808, 0, 32773,
+    0, 12345, 32808, 24593, 32807, 24596, 24579, 32807, 24612, 12357, 8304, 32809, 24603, 12331, 0, 24642,
+    4147, 16716, 32808, 24640, 24588, 32782, 24644, 32809, 24586, 8588, 8497, 32792, 16717, 24597, 12369, 24640,
+    24579, 24578, 8660, 32792, 32793, 12349, 4158, 8221, 32809, 24596, 8662, 0, 0, 12365, 12388, 12365,
+    12380, 32793, 0, 24609, 32805, 16547, 24597, 24589, 16543, 0, 24585, 0, 16546, 12394, 16510, 12396,
+    32793, 16478, 32774, 0, 12372, 16548, 12373, 12389, 12381, 20483, 24586, 12378, 24597, 24605, 4164, 4149,
+    24596, 24589, 32793, 12371, 24605, 8504, 12334, 0, 12389, 12349, 20483, 0, 32801, 8478, 16533, 12331,
+    0, 32801, 32798, 12356, 24597, 16479, 24601, 24602, 12397, 32810, 12373, 12323, 32810, 12397, 32774, 8322,
+    12395, 0, 12404, 32810, 8415, 12321, 24603, 0, 24602, 24617, 32802, 12404, 12334, 24589, 32793, 8508,
+    32793, 12358, 12318, 32802, 20483, 24594, 12403, 16576, 32784, 12326, 12358, 24601, 0, 24594, 32783, 12405,
+    16516, 24588, 16516, 8601, 32784, 24596, 12389, 12405, 32775, 0, 32783, 24613, 16579, 12350, 0, 24620,
+    12388, 24613, 24610, 8229, 32802, 24596, 12366, 16582, 4203, 32783, 0, 16584, 12366, 0, 24611, 24609,
+    12405, 0, 8319, 16552, 0, 12342, 16400, 16443, 24610, 8512, 24618, 12366, 24609, 12318, 24604, 24613,
+    16480, 16553, 16585, 0, 0, 24613, 24609, 0, 16471, 8597, 32800, 16443, 24620, 32802, 4212, 32784,
+    16406, 8600, 24647, 20484, 24621, 24588, 0, 0, 24612, 8387, 8327, 12310, 4174, 16553, 16580, 32811,
+    20484, 32811, 0, 32817, 32810, 16571, 24588, 24594, 24580, 32817, 8513, 16436, 8419, 16515, 8511, 12318,
+    0, 16477, 24617, 32818, 24645, 0, 24597, 20482, 12318, 32817, 4186, 8606, 32818, 8498, 12396, 8604,
+    16517, 0, 24621, 12382, 12302, 0, 32811, 12366, 12316, 32816, 32793, 12405, 8694, 24605, 16549, 24605,
+    32818, 32819, 12390, 32819, 0, 8751, 16554, 12374, 32819, 8403, 0, 12398, 16437, 24598, 32796, 16554,
+    12428, 16585, 8698, 32819, 32819, 32810, 12358, 12390, 12420, 16554, 8697, 24577, 12374, 0, 0, 0,
+    12436, 24589, 32816, 32819, 12382, 12436, 32793, 0, 8699, 0, 20484, 12412, 12427, 8327, 12390, 24589,
+    12429, 24606, 0, 24598, 12413, 32819, 24648, 12435, 24594, 8310, 8688, 32819, 8776, 32784, 12398, 0,
+    12406, 24598, 20482, 8399, 8422, 12406, 4221, 12374, 12436, 32773, 32784, 12421, 32802, 16587, 4215, 16408,
+    32775, 12437, 12398, 16589, 12406, 12444, 24618, 16484, 8329, 12437, 8411, 32819, 24589, 12429, 12444, 16590,
+    12444, 24590, 24648, 32794, 24606, 12390, 16590, 12445, 12445, 12443, 24585, 16517, 4198, 12445, 24585, 12437,
+    24590, 24619, 24620, 24648, 32794, 24613, 24577, 8785, 8787, 12379, 16591, 24598, 8220, 12311, 16483, 8515,
+    8782, 16410, 16485, 24614, 12422, 8228, 4225, 12334, 24614, 12327, 32785, 12438, 32790, 24590, 24582, 24619,
+    8775, 4194, 24614, 16448, 8791, 0, 12430, 12372, 8505, 32803, 20482, 32784, 0, 12445, 12419, 8780,
+    24618, 8792, 0, 32842, 12327, 24605, 8675, 4227, 24621, 32794, 24613, 24604, 32846, 4170, 12422, 4243,
+    24580, 32811, 4245, 20482, 32820, 32776, 12398, 16522, 32811, 32820, 24613, 12443, 12446, 12430, 24606, 12303,
+    12311, 8617, 12446, 24598, 16508, 12367, 16486, 24580, 12452, 16446, 8616, 24606, 16556, 12382, 32803, 12446,
+    8247, 8339, 16558, 8525, 0, 24610, 8520, 32794, 12319, 24648, 24590, 12452, 32793, 4266, 16559, 0,
+    12453, 12311, 32820, 24598, 32847, 16559, 16486, 12453, 12453, 12351, 16486, 8691, 32847, 12452, 8436, 32847,
+    24627, 24612, 4184, 12453, 16616, 24625, 12454, 16613, 32820, 32812, 0, 24578, 20483, 32776, 24612, 24597,
+    32785, 24627, 12335, 24579, 24598, 24628, 12343, 24627, 32847, 8618, 24625, 8621, 12350, 0, 24611, 20483,
+    0, 24597, 12425, 8249, 16717, 16523, 32820, 12391, 12343, 4231, 24606, 24628, 24628, 24625, 16622, 32820,
+    24628, 24589, 4270, 24626, 8312, 16622, 32794, 32844, 12427, 32847, 16449, 12359, 16523, 0, 32847, 0,
+    12353, 0, 24628, 16560, 24622, 8405, 12454, 12391, 16560, 32818, 24629, 32803, 24628, 8708, 12413, 24629,
+    12399, 12399, 12397, 12382, 8710, 12454, 16626, 12451, 16450, 24625, 24629, 0, 32847, 0, 32784, 8622,
+    8533, 24609, 8715, 12437, 24626, 12335, 12454, 16627, 0, 8223, 12327, 12383, 4143, 12295, 24622, 32775,
+    24614, 32812, 4168, 12435, 12311, 24612, 12294, 24603, 24609, 8250, 16524, 4296, 24626, 8345, 12374, 32848,
+    0, 8766, 16523, 16628, 32848, 24579, 4295, 24612, 16413, 8534, 12407, 32803, 16413, 8347, 16594, 24629,
+    12407, 32820, 16628, 16595, 32787, 16628, 8605, 8531, 12417, 16522, 24587, 24618, 8666, 32794, 16596, 32775,
+    32774, 12311, 16442, 16487, 4303, 24610, 32789, 12351, 24618, 12311, 8627, 32802, 16450, 24629, 24590, 8412,
+    12429, 24619, 12407, 4307, 32785, 24620, 12383, 12367, 32820, 24625, 24601, 24593, 16597, 32784, 12310, 12404,
+    8349, 24630, 16450, 16561, 12335, 24619, 8624, 8442, 8535, 8420, 12410, 16597, 4308, 8256, 12335, 24630,
+    32826, 4311, 24627, 8348, 24603, 12300, 32847, 8577, 12428, 12367, 8256, 16524, 0, 24630, 20485, 24582,
+    24587, 20483, 8349, 32848, 12359, 16406, 12319, 16618, 32827, 12411, 32827, 0, 24595, 32812, 20485, 12351,
+    12402, 12327, 32821, 20485, 16399, 4251, 32827, 0, 32825, 12294, 8571, 8628, 20484, 8225, 32828, 8628,
+    24619, 8404, 0, 0, 8248, 32846, 12373, 16487, 32773, 20485, 8718, 32828, 20483, 24581, 32827, 8535,
+    16560, 0, 0, 0, 0, 16411, 8442, 8256, 8720, 12316, 0, 32784, 12413, 24581, 24597, 32848,
+    16441, 0, 8432, 0, 32846, 24630, 24582, 8250, 0, 12361, 0, 0, 16480, 32828, 0, 12381,
+    0, 0, 0, 24593, 20485, 24601, 0, 16561, 32829, 4292, 32823, 8721, 32821, 16411, 32800, 24601,
+    32785, 4241, 12439, 0, 0, 16597, 20485, 0, 24647, 12351, 0, 32829, 0, 12431, 32848, 0,
+    8343, 24580, 32814, 4278, 8626, 24621, 32829, 12327, 12423, 16486, 8808, 32828, 0, 32828, 0, 0,
+    0, 32783, 16500, 0, 24648, 8808, 24599, 0, 32794, 12335, 8256, 12457, 24599, 4282, 32826, 8846,
+    8807, 24617, 24581, 24617, 24589, 32794, 0, 32785, 20482, 24602, 16598, 0, 8858, 4272, 12439, 24589,
+    16598, 12415, 20482, 24630, 8528, 8613, 12386, 16406, 24591, 12482, 12326, 12415, 16598, 12484, 16411, 4209,
+    12484, 12477, 12484, 24599, 0, 32828, 12461, 8490, 12477, 0, 12387, 8813, 12476, 0, 12415, 12469,
+    24586, 24580, 8813, 24591, 24614, 16442, 12477, 24590, 8869, 12461, 0, 32849, 12476, 24587, 8583, 8814,
+    24605, 24588, 12431, 12461, 0, 12469, 12485, 4180, 12447, 16598, 16617, 8714, 24591, 12485, 12492, 12485,
+    8672, 8866, 32849, 32803, 0, 32829, 12491, 0, 0, 0, 0, 32849, 12492, 24591, 32776, 12492,
+    0, 12329, 8863, 12493, 24626, 4312, 12493, 8259, 16468, 12490, 24625, 32821, 12460, 8880, 32825, 32777,
+    12312, 8803, 12307, 12493, 24617, 12296, 16479, 8350, 32845, 32777, 24599, 12493, 32795, 32829, 32803, 32795,
+    8258, 24585, 24615, 12486, 12304, 12296, 12455, 24594, 24586, 24615, 12336, 12439, 12455, 24627, 12478, 24615,
+    32820, 32795, 16632, 8536, 12336, 24618, 12470, 24626, 12304, 4327, 32795, 24615, 24603, 16528, 12469, 4318,
+    12470, 8885, 24583, 16633, 16492, 16596, 24602, 12304, 32786, 8542, 24599, 12302, 24607, 24602, 4287, 32804,
+    12320, 32804, 8884, 8261, 24628, 32801, 12494, 12478, 0, 32804, 12423, 16634, 8882, 12486, 8546, 32795,
+    12344, 24603, 12500, 12497, 12328, 16455, 32849, 12500, 32812, 12360, 16529, 24601, 12499, 4347, 16630, 16529,
+    16493, 32786, 24596, 16455, 8757, 12501, 16419, 12501, 32786, 16449, 12501, 12463, 12312, 32804, 8885, 12344,
+    16419, 24603, 16453, 12352, 0, 16527, 24591, 24588, 8360, 24629, 24615, 12501, 8249, 20484, 8896, 24609,
+    12502, 24617, 12471, 16565, 12368, 12502, 16562, 16635, 0, 24622, 12502, 16635, 12487, 24604, 8458, 24609,
+    24609, 16493, 16419, 12320, 8357, 24627, 16566, 24626, 16633, 12479, 24593, 12487, 8456, 0, 12479, 32812,
+    8900, 32777, 12471, 24612, 8443, 24591, 4345, 8901, 0, 32849, 8318, 32813, 8901, 24590, 12502, 24611,
+    32813, 12502, 12479, 16635, 8551, 12368, 8551, 32786, 16635, 16566, 24580, 12471, 12500, 24599, 8763, 12487,
+    16492, 32813, 16530, 12392, 8365, 24628, 12495, 12487, 24597, 12320, 8644, 12376, 8890, 24607, 24623, 24630,
+    4339, 24577, 32804, 8905, 20485, 12495, 12479, 32795, 12376, 16520, 12471, 32828, 8732, 12304, 8326, 0,
+    4269, 12357, 24610, 8642, 24623, 24596, 8906, 24623, 32813, 12384, 12495, 12312, 16521, 16567, 16567, 8799,
+    8529, 12304, 4284, 12400, 12487, 12447, 24607, 8522, 12392, 16567, 24640, 8639, 8907, 0, 8906, 16457,
+    8369, 32830, 12384, 8555, 24589, 32795, 4365, 16454, 24615, 12336, 12320, 4389, 8814, 24588, 0, 12312,
+    12396, 24601, 4368, 4324, 12392, 16494, 12325, 12336, 8277, 32786, 16531, 24593, 16531, 12400, 16457, 8635,
+    12408, 8267, 12495, 32804, 4380, 16514, 8370, 24628, 8705, 16457, 12368, 12495, 12408, 32821, 24648, 32802,
+    8556, 32830, 4392, 12344, 8645, 8713, 12503, 32786, 8648, 16450, 8458, 12503, 12328, 12352, 24607, 12408,
+    12503, 16494, 8462, 12376, 16531, 4393, 8649, 8464, 12344, 4374, 12384, 8649, 8265, 12406, 12455, 12508,
+    16603, 12508, 16457, 4402, 8464, 12508, 20481, 20481, 32785, 24591, 16494, 16602, 12368, 16603, 32799, 12506,
+    24607, 16568, 12509, 8371, 12503, 8325, 16568, 8719, 12509, 32830, 8496, 24610, 16400, 4207, 8557, 32795,
+    8879, 12400, 0, 12336, 16604, 24620, 24605, 0, 16531, 32777, 12510, 8805, 8557, 8903, 24629, 32829,
+    4409, 16625, 12510, 24619, 12327, 8463, 16635, 24607, 24618, 8552, 12503, 32776, 8440, 32849, 4378, 32813,
+    8463, 24597, 24612, 8724, 12503, 24621, 8371, 12328, 32822, 24635, 0, 12503, 32830, 12360, 8686, 8453,
+    32821, 12503, 12296, 12503, 8370, 8435, 12510, 12376, 12510, 12502, 4237, 16654, 12405, 4407, 16649, 8650,
+    24578, 24620, 24634, 12502, 12511, 12333, 24589, 8893, 8721, 8740, 12471, 32795, 12384, 12355, 24636, 24599,
+    12416, 8821, 12432, 16658, 8861, 8650, 24635, 12432, 8650, 16657, 24590, 8852, 12509, 24636, 8742, 8741,
+    24605, 8825, 32786, 12432, 16659, 12420, 24634, 12463, 12376, 12416, 12424, 12400, 24579, 32822, 12510, 24590,
+    8743, 16491, 12511, 4306, 8726, 16494, 12440, 8743, 8743, 8826, 16652, 12416, 8761, 12373, 8829, 8812,
+    0, 8802, 24605, 8742, 12335, 12440, 12424, 12460, 12463, 24637, 24622, 24606, 12416, 8363, 24583, 16663,
+    12392, 12408, 24637, 24598, 24597, 8830, 32795, 8830, 12400, 16495, 24634, 12483, 32822, 24634, 12408, 16605,
+    16440, 12312, 12416, 16664, 16457, 16421, 12376, 12448, 8638, 12479, 12511, 8349, 12448, 16495, 12471, 20481,
+    4411, 12448, 8276, 8871, 8334, 8834, 24636, 16607, 32777, 24633, 24637, 8833, 32826, 8824, 24631, 16665,
+    20481, 12360, 24631, 4153, 12441, 24635, 8835, 32849, 24625, 12502, 8899, 32822, 16665, 16605, 24633, 8469,
+    16421, 24631, 16530, 12440, 16511, 24614, 24594, 24636, 16421, 4435, 4434, 24607, 16665, 8550, 12336, 32811,
+    32782, 12384, 12511, 12423, 0, 16421, 32804, 8342, 0, 24606, 8274, 8836, 8562, 24637, 24577, 16413,
+    24631, 8373, 24631, 4297, 8836, 32849, 12466, 8366, 24638, 8376, 32785, 12448, 8284, 32795, 32775, 8652,
+    12384, 0, 12507, 8876, 8655, 12448, 0, 32822, 16669, 24615, 24591, 12352, 32813, 8655, 32811, 24633,
+    12312, 12408, 12448, 32849, 12448, 12440, 12368, 32820, 8492, 8284, 24611, 12456, 8836, 0, 16569, 16670,
+    16458, 12456, 24638, 24631, 16568, 8549, 24631, 24637, 16495, 0, 8284, 0, 4447, 4446, 12456, 24597,
+    24582, 24631, 8643, 24625, 8737, 16671, 12360, 24630, 16639, 24634, 12423, 16532, 16495, 8284, 12456, 8427,
+    4451, 16671, 4451, 8563, 0, 12382, 24625, 8250, 20485, 16671, 16640, 32775, 32813, 16420, 12412, 12456,
+    32775, 24614, 12468, 24625, 8677, 12336, 32776, 24593, 8656, 4337, 12510, 24638, 4450, 32773, 24628, 16641,
+    16636, 24640, 16641, 8656, 8794, 32777, 32822, 24629, 24626, 8256, 32828, 8585, 8377, 32811, 0, 24605,
+    16600, 16421, 32781, 24633, 16672, 24614, 12463, 0, 24648, 16672, 24648, 8748, 8680, 8747, 12453, 8809,
+    8622, 24643, 24615, 32822, 24622, 8629, 16569, 32785, 24607, 12456, 16717, 24629, 12384, 24638, 24629, 32802,
+    16532, 20484, 12433, 12342, 16672, 4461, 24614, 16642, 24631, 12352, 16406, 16485, 16668, 12343, 8564, 12294,
+    0, 16641, 8654, 16642, 16672, 8749, 16456, 16542, 12347, 12493, 16568, 16642, 8442, 0, 16672, 0,
+    12340, 12368, 0, 20485, 12459, 8378, 4453, 24578, 12479, 4467, 24614, 32811, 12328, 0, 16621, 8749,
+    12363, 12467, 12463, 24629, 32822, 32822, 4467, 32812, 4464, 8284, 16413, 8591, 8564, 24627, 24617, 4192,
+    4462, 12450, 32830, 8888, 8227, 16606, 24627, 20482, 16640, 8657, 16641, 0, 8449, 12454, 8772, 16606,
+    24638, 4468, 8285, 32777, 0, 0, 4471, 8418, 12381, 16421, 8336, 24639, 20483, 8378, 0, 32822,
+    12421, 8556, 0, 4472, 16494, 8285, 12359, 12509, 24599, 24619, 0, 12359, 12400, 4472, 20481, 12338,
+    24639, 8703, 12431, 16569, 8300, 0, 24630, 24585, 32820, 0, 4431, 0, 8575, 8311, 20486, 12296,
+    24630, 12352, 32777, 8564, 32831, 24630, 0, 8471, 12461, 32831, 0, 4421, 32813, 16421, 8275, 4260,
+    32803, 16606, 12431, 8729, 32831, 4333, 32777, 0, 20486, 0, 0, 32849, 24630, 0, 24577, 0,
+    20486, 0, 0, 0, 16606, 32835, 24635, 24585, 32832, 32835, 0, 8365, 20486, 24582, 32831, 0,
+    0, 32831, 0, 32813, 0, 32834, 16456, 0, 32813, 32822, 24638, 12320, 32836, 16447, 0, 24647,
+    0, 8749, 8750, 12296, 32831, 0, 24613, 8266, 24578, 0, 32830, 8750, 0, 0, 12392, 12509,
+    16606, 12303, 32837, 8285, 12432, 4458, 0, 8840, 20483, 4351, 0, 12493, 16421, 32837, 20486, 0,
+    16606, 24639, 0, 12295, 0, 12499, 12474, 20485, 24604, 32831, 32837, 24629, 0, 8841, 32835, 0,
+    32831, 16410, 12440, 24593, 20485, 0, 0, 24611, 16662, 24636, 24639, 8842, 20486, 0, 24648, 8841,
+    32837, 0, 0, 24607, 0, 0, 32843, 24628, 0, 0, 24633, 0, 12328, 12368, 32777, 8750,
+    8608, 12432, 0, 16487, 0, 24599, 0, 12480, 32837, 0, 32837, 12304, 0, 12464, 0, 16490,
+    32838, 4255, 24585, 0, 16606, 0, 24591, 32837, 32838, 12464, 8450, 0, 0, 8918, 16458, 0,
+    8470, 12448, 16606, 12392, 8843, 8441, 20485, 12472, 0, 32837, 0, 16606, 0, 16419, 8563, 8843,
+    0, 0, 8912, 12464, 24599, 24599, 12472, 32837, 4466, 0, 12488, 32836, 12424, 0, 16449, 0,
+    12472, 12480, 24591, 8277, 8922, 0, 12488, 0, 8923, 4383, 0, 0, 8923, 8921, 0, 12416,
+    12480, 24607, 20486, 0, 24626, 16448, 16420, 0, 32802, 12472, 24589, 8277, 0, 0, 12488, 0,
+    0, 12496, 12496, 0, 32838, 32836, 16449, 0, 12496, 0, 12432, 8356, 8843, 12480, 0, 0,
+    0, 12344, 0, 8927, 12496, 0, 12472, 12472, 32839, 12440, 32795, 12424, 4408, 24627, 32839, 12531,
+    32838, 12514, 32838, 8943, 24607, 12480, 0, 24595, 12509, 12516, 8937, 20486, 0, 24600, 0, 12532,
+    12532, 32838, 24593, 24615, 12524, 8736, 16409, 0, 12440, 8843, 24600, 8929, 12540, 32777, 0, 0,
+    16643, 24615, 0, 8928, 32795, 12517, 32839, 12539, 12464, 24600, 24615, 0, 20486, 4397, 12533, 24608,
+    12320, 12540, 12529, 24592, 24608, 12296, 12344, 0, 0, 32849, 12524, 0, 0, 12517, 0, 12539,
+    0, 8838, 32804, 24600, 24600, 20481, 0, 8543, 24592, 24605, 0, 0, 12541, 24598, 16643, 12541,
+    12496, 0, 12548, 0, 12541, 12504, 0, 8961, 8438, 24627, 0, 4399, 0, 12533, 32839, 12504,
+    12545, 8429, 24608, 12534, 8815, 12548, 12504, 0, 12504, 24600, 0, 24587, 8925, 12549, 8933, 12549,
+    12549, 12453, 32786, 32777, 12541, 0, 24599, 8790, 24591, 8932, 24606, 0, 8934, 0, 0, 12464,
+    20481, 24616, 8934, 12504, 12504, 12504, 12549, 8459, 16643, 24591, 12517, 24626, 12488, 24616, 0, 8977,
+    24616, 0, 12504, 20485, 4360, 0, 0, 12464, 12472, 24608, 0, 12480, 0, 8935, 0, 0,
+    8978, 0, 24607, 8848, 32786, 0, 0, 32831, 0, 0, 8935, 0, 0, 12488, 0, 0,
+    0, 0, 0, 24616, 20486, 12504, 16421, 0, 12424, 20481, 0, 12550, 0, 32813, 12360, 0,
+    20486, 12472, 0, 0, 24608, 12496, 4257, 8735, 8466, 32849, 12525, 0, 0, 12550, 0, 0,
+    8656, 8936, 12540, 12515, 0, 32839, 24592, 0, 12556, 12480, 32795, 0, 32839, 32777, 12519, 12376,
+    24613, 12496, 12519, 12496, 24581, 0, 12328, 0, 12535, 0, 0, 0, 8378, 8989, 0, 0,
+    0, 16647, 0, 12557, 8470, 12547, 0, 8979, 12558, 8746, 32786, 0, 0, 24592, 0, 4442,
+    8471, 0, 0, 12525, 12535, 0, 0, 0, 12519, 0, 24608, 0, 4423, 12521, 0, 12535,
+    24616, 12527, 20486, 0, 24582, 0, 12543, 0, 24608, 12543, 12360, 12535, 0, 12534, 12527, 4362,
+    12554, 8990, 8656, 12558, 8994, 8994, 0, 0, 8993, 12543, 0, 12548, 12550, 32831, 0, 0,
+    12533, 12557, 8559, 12519, 8910, 12519, 12551, 24600, 0, 12504, 0, 24616, 24592, 12537, 32777, 12527,
+    12551, 0, 32839, 0, 0, 0, 12558, 12551, 0, 12551, 0, 12558, 0, 12512, 0, 8998,
+    0, 8997, 8968, 32777, 8958, 12512, 8999, 4322, 12512, 0, 0, 0, 0, 0, 8966, 24624,
+    0, 0, 8457, 0, 24616, 12551, 12551, 20486, 0, 0, 0, 4417, 0, 0, 0, 0,
+    0, 12512, 32776, 12551, 0, 12480, 0, 8928, 0, 0, 24604, 0, 24635, 0, 24608, 9000,
+    32804, 12464, 0, 9000, 0, 0, 24608, 12488, 0, 0, 0, 0, 0, 24624, 0, 0,
+    32804, 32777, 12512, 12543, 0, 0, 32813, 12512, 0, 24592, 0, 0, 16675, 24600, 8284, 16458,
+    0, 0, 24600, 0, 32831, 24633, 16676, 0, 8949, 16677, 0, 0, 9000, 12559, 12475, 32822,
+    0, 0, 12557, 0, 24633, 12512, 0, 0, 0, 0, 0, 32839, 0, 16531, 12564, 12559,
+    12561, 0, 0, 12564, 16678, 0, 0, 0, 12559, 16678, 0, 12563, 0, 0, 0, 0,
+    12559, 0, 12565, 0, 0, 0, 12557, 16678, 12565, 32804, 0, 12531, 12559, 0, 8976, 0,
+    24634, 32804, 12542, 0, 0, 0, 0, 0, 12559, 0, 0, 0, 12566, 0, 8377, 0,
+    0, 12566, 12547, 0, 8962, 12563, 12565, 12566, 0, 0, 32804, 12559, 12565, 0, 0, 24601,
+    0, 12566, 0, 0, 16679, 8952, 0, 0, 0, 24579, 12536, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24624, 0, 0, 0, 0, 24592, 12566, 12566, 0, 24584, 32786, 0,
+    16679, 0, 0, 0, 0, 0, 12567, 0, 0, 0, 0, 12567, 0, 16679, 12544, 12512,
+    0, 24584, 0, 0, 0, 8988, 16679, 0, 0, 12567, 0, 24584, 24631, 0, 0, 0,
+    16679, 16679, 9013, 12528, 0, 12536, 0, 12526, 24616, 0, 9016, 0, 0, 0, 0, 0,
+    8471, 32786, 0, 0, 9016, 0, 0, 0, 0, 0, 0, 32834, 12566, 0, 0, 0,
+    9015, 16419, 16532, 12552, 0, 0, 9011, 16532, 24638, 0, 0, 0, 0, 0, 0, 12520,
+    0, 0, 0, 32822, 0, 0, 0, 0, 24631, 0, 0, 32822, 0, 0, 0, 0,
+    0, 0, 8364, 12558, 12543, 0, 0, 9021, 0, 9021, 0, 16680, 0, 16680, 0, 12567,
+    0, 0, 0, 24616, 8985, 12544, 0, 12528, 12567, 0, 0, 0, 9010, 9022, 16680, 0,
+    12558, 0, 12567, 0, 0, 0, 0, 0, 24632, 16458, 12528, 0, 0, 12520, 0, 0,
+    0, 0, 0, 0, 8470, 0, 0, 0, 24584, 0, 0, 0, 24632, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8915, 0, 12552, 0, 0, 0,
+    24632, 0, 0, 0, 0, 0, 0, 12560, 0, 9017, 32839, 0, 0, 0, 0, 0,
+    0, 0, 0, 32804, 0, 0, 0, 24632, 0, 0, 12560, 9024, 16680, 0, 0, 0,
+    0, 24632, 9026, 0, 9002, 12560, 0, 24638, 0, 12536, 24616, 0, 12536, 0, 0, 0,
+    0, 24632, 0, 0, 16680, 0, 16680, 0, 0, 0, 0, 0, 0, 12536, 9027, 0,
+    24632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9028, 0, 0, 0, 0,
+    12544, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9022, 0, 0, 0, 0, 0, 12528, 0, 0, 4445, 0, 0,
+    0, 0, 24632, 0, 0, 0, 24592, 0, 0, 12552, 0, 0, 0, 0, 0, 0,
+    0, 0, 9027, 9029, 0, 12536, 0, 24633, 0, 0, 0, 0, 0, 12528, 0, 0,
+    0, 0, 0, 0, 24624, 0, 12557, 0, 0, 0, 0, 0, 0, 9029, 32786, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12520, 0, 0,
+    0, 0, 20486, 0, 0, 0, 32831, 0, 0, 0, 0, 0, 24624, 0, 0, 0,
+    0, 12544, 0, 24632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 32840, 0, 0, 0, 0, 0, 8971, 0, 0,
+    0, 0, 0, 32840, 0, 0, 32840, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12564, 0, 0, 0, 0, 12556, 0, 0, 0, 0, 0, 0, 12568,
+    0, 0, 0, 0, 0, 32840, 0, 0, 20486, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 8947, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 32831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12568,
+    0, 0, 0, 0, 32840, 0, 4436, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 12523, 0, 8563, 0, 0, 0, 12570, 12572, 12571, 12572, 0,
+    0, 0, 0, 0, 0, 0, 0, 24592, 12519, 0, 32840, 12573, 0, 0, 0, 12573,
+    12573, 0, 0, 0, 0, 0, 0, 12568, 0, 0, 0, 0, 0, 0, 12573, 0,
+    0, 0, 9029, 0, 0, 0, 12574, 12574, 0, 0, 0, 0, 0, 0, 0, 0,
+    12574, 24608, 0, 0, 0, 12573, 0, 0, 0, 12574, 9022, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 20486, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 32786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    12575, 0, 0, 0, 0, 0, 0, 0, 0, 32795, 24641, 0, 32840, 12574, 0, 12572,
+    24641, 24600, 0, 0, 0, 0, 0, 24643, 0, 24642, 0, 0, 0, 0, 32786, 0,
+    0, 16690, 0, 0, 0, 0, 24642, 0, 0, 0, 16681, 24643, 0, 0, 12544, 0,
+    12575, 0, 0, 0, 24644, 0, 0, 24641, 16687, 24643, 32840, 24642, 16692, 0, 0, 0,
+    24632, 24641, 0, 0, 0, 0, 24644, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16696, 24641, 0, 24644, 0, 24644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 24645, 12575, 0, 0, 24645, 0, 0, 12558, 0,
+    0, 0, 32804, 4426, 0, 24645, 24641, 24645, 0, 0, 0, 0, 12576, 0, 24624, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 12576, 24592, 0, 0, 0, 0, 12576,
+    0, 0, 24644, 24645, 0, 0, 12573, 0, 24645, 0, 9007, 12575, 24632, 0, 0, 16702,
+    0, 0, 0, 24644, 12576, 24645, 0, 0, 0, 0, 16700, 12576, 24643, 0, 0, 12576,
+    0, 0, 16702, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 16702, 0, 0, 12576, 0, 0, 0, 32822,
+    8377, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24646, 0, 0, 0, 0,
+    0, 0, 0, 24646, 0, 0, 0, 0, 0, 0, 0, 0, 12576, 24641, 0, 0,
+    32840, 0, 24641, 0, 16703, 24643, 0, 24642, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24584, 0, 0, 16707, 0, 24646, 0, 24646, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12528, 24641, 0, 0, 0, 24644, 0, 16696, 0, 16708,
+    0, 0, 0, 16708, 0, 0, 0, 0, 0, 0, 0, 9020, 0, 0, 0, 24642,
+    0, 0, 0, 0, 24584, 0, 0, 0, 0, 0, 0, 0, 0, 16695, 0, 24646,
+    0, 24644, 0, 24646, 0, 0, 0, 0, 0, 24645, 0, 0, 12576, 0, 0, 0,
+    0, 16706, 0, 0, 0, 16709, 0, 16707, 0, 0, 0, 0, 0, 0, 32813, 0,
+    0, 0, 0, 0, 24643, 0, 24645, 0, 16708, 12555, 0, 0, 12526, 12576, 0, 0,
+    16709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12576, 24645, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16709, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12542, 0, 0, 0, 0, 24644, 0, 0, 0, 0,
+    0, 32839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24642, 32822, 0, 0, 0, 0, 0, 0, 0, 24640, 0, 0, 0, 0,
+    0, 24646, 0, 24646, 0, 0, 0, 0, 0, 0, 24640, 0, 0, 0, 0, 0,
+    0, 0, 24647, 24647, 0, 0, 0, 0, 24647, 12544, 0, 0, 24647, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24642, 24647,
+    0, 0, 0, 0, 0, 0, 0, 0, 12556, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 24640, 0, 24643, 0, 0, 0, 0, 0,
+    16711, 0, 0, 0, 16713, 0, 0, 0, 0, 0, 0, 24646, 0, 24647, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16714, 0, 0, 0, 0, 0,
+    0, 24640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4098, 16387, 16715, 8380, 16701, 16386, 4104, 24578, 24593, 16462, 8287, 24577, 0, 12306, 0, 24585,
+    16425, 0, 0, 16389, 32779, 0, 0, 0, 4108, 0, 0, 4110, 0, 24577, 0, 0,
+    24642, 16391, 0, 0, 8293, 0, 24645, 8473, 0, 32790, 16427, 0, 0, 0, 24593, 0,
+    4114, 0, 8386, 16716, 0, 0, 0, 0, 16716, 0, 0, 8295, 16393, 0, 4120, 16394,
+    0, 16469, 0, 24642, 0, 0, 32789, 24578, 0, 0, 0, 32777, 16468, 32799, 0, 32797,
+    0, 24578, 16501, 0, 0, 24579, 0, 0, 0, 0, 12308, 0, 32791, 24644, 24602, 12354,
+    16716, 0, 32791, 12330, 32780, 0, 24647, 20482, 24596, 32792, 32798, 4128, 0, 0, 4134, 24596,
+    24580, 32774, 32792, 16716, 0, 12293, 12301, 24585, 8209, 24640, 32800, 32799, 8566, 16395, 12346, 0,
+    32792, 20482, 0, 24579, 8301, 24594, 0, 24588, 20482, 12309, 16436, 16506, 32774, 0, 8388, 16539,
+    8578, 32792, 24586, 16435, 0, 8210, 32792, 8212, 24645, 32774, 32774, 24604, 12363, 24609, 32783, 16716,
+    24609, 12309, 24603, 32783, 16510, 8400, 16534, 24578, 0, 16474, 16509, 24602, 24647, 20482, 4144, 16542,
+    24594, 0, 24611, 8493, 32801, 0, 12301, 24602, 20483, 32808, 32806, 32801, 16473, 4138, 32801, 32808,
+    12317, 12317, 32807, 12333, 32792, 16543, 16717, 20483, 12333, 12333, 8586, 24596, 32774, 12355, 12357, 0,
+    12349, 24587, 12325, 24601, 16511, 32783, 32809, 24596, 12293, 16691, 24588, 24597, 0, 32809, 32809, 16437,
+    12293, 24587, 24594, 24581, 4140, 20483, 12341, 8487, 24644, 24612, 24610, 4159, 8217, 16402, 24581, 20483,
+    24603, 12365, 16477, 20483, 24585, 12365, 24595, 16547, 32784, 32774, 16478, 8308, 24611, 24593, 24609, 24597,
+    24581, 24610, 24604, 12389, 8313, 24609, 16403, 4171, 32800, 4165, 8661, 16404, 24609, 24643, 24589, 32783,
+    32782, 16548, 32793, 8681, 12396, 4169, 16717, 4124, 8406, 24588, 12362, 24581, 12310, 24577, 16440, 12381,
+    32810, 24601, 24612, 24593, 16699, 16479, 32810, 12397, 8504, 12397, 0, 24643, 0, 24581, 16544, 12404,
+    0, 32802, 8590, 16717, 0, 16442, 12403, 24595, 0, 12576, 24603, 0, 16515, 20482, 0, 12405,
+    24617, 24619, 24618, 20483, 0, 0, 32810, 0, 0, 8663, 16474, 16516, 32793, 12350, 8499, 0,
+    16516, 32810, 24619, 12381, 16580, 12364, 0, 8601, 8580, 0, 0, 12331, 32831, 20483, 24619, 16480,
+    0, 4187, 24620, 24613, 24617, 32810, 24613, 24620, 4175, 8326, 32840, 12366, 24619, 24613, 8419, 16550,
+    16405, 16505, 12358, 16552, 0, 24618, 12334, 24618, 24610, 8512, 32793, 8420, 12318, 32810, 20483, 32802,
+    16583, 32782, 0, 0, 12310, 24601, 32790, 16553, 0, 24619, 16517, 16443, 16517, 20484, 32784, 20484,
+    24619, 24620, 24579, 32793, 24612, 24621, 0, 20484, 0, 8572, 0, 24621, 24588, 8233, 32802, 16480,
+    8513, 32815, 0, 0, 16553, 32817, 20484, 0, 12358, 12342, 16585, 0, 8323, 8605, 24585, 8234,
+    24581, 0, 12350, 0, 32816, 12326, 12342, 12318, 16517, 24621, 24597, 20484, 32818, 0, 0, 24621,
+    12342, 0, 24579, 4210, 32801, 24589, 32818, 0, 8692, 0, 32793, 4213, 0, 8694, 32819, 16437,
+    0, 0, 12366, 8394, 12382, 12310, 4189, 8606, 0, 16554, 12398, 16554, 12326, 24648, 24621, 24582,
+    16443, 0, 24581, 24648, 12398, 12420, 24643, 24648, 12427, 24582, 24590, 0, 0, 12322, 20486, 0,
+    0, 20483, 12334, 12436, 4201, 8699, 0, 24582, 16404, 8697, 24605, 24603, 32819, 8506, 12302, 0,
+    24612, 20484, 12317, 24598, 8413, 24620, 0, 24620, 8602, 24620, 0, 8776, 8479, 24647, 24582, 0,
+    12406, 8775, 8235, 12387, 4218, 32811, 24589, 4216, 32776, 12406, 0, 32818, 16589, 12437, 24648, 24621,
+    20484, 24619, 24590, 12406, 16588, 24581, 32802, 8772, 12295, 32794, 12303, 24618, 8481, 12444, 24618, 12443,
+    32793, 24606, 16590, 16481, 16590, 24582, 24593, 12382, 16444, 32788, 12430, 4222, 12445, 24598, 12414, 12324,
+    32776, 12445, 16442, 12379, 8240, 24595, 8787, 32784, 24620, 12319, 24617, 24598, 8233, 32844, 12442, 16591,
+    24603, 32844, 32794, 32774, 32785, 12422, 24594, 4234, 24586, 24606, 8431, 12438, 12445, 12311, 16591, 12414,
+    4244, 8332, 32794, 12438, 32845, 32803, 12319, 12430, 8791, 8242, 12430, 24590, 24648, 24595, 24606, 24596,
+    12335, 20484, 12414, 12414, 24585, 8524, 24585, 8792, 32803, 12438, 32846, 24587, 12351, 16522, 32794, 24621,
+    32846, 32811, 8764, 32845, 32820, 8617, 8425, 12311, 24602, 16485, 12434, 12359, 16486, 12446, 24577, 8232,
+    12343, 0, 12446, 12327, 12367, 32784, 20482, 24590, 24582, 16518, 8786, 16558, 12446, 16449, 12452, 32845,
+    24611, 32803, 8509, 16557, 8528, 12343, 16485, 12438, 32846, 8245, 24610, 12453, 32843, 24610, 12327, 24620,
+    16572, 16559, 32820, 16559, 24621, 24605, 32847, 12359, 24588, 4258, 16412, 24614, 16448, 8342, 0, 24625,
+    0, 16523, 24610, 8611, 24621, 12422, 12454, 24612, 16464, 32812, 32781, 4270, 12454, 0, 32812, 8529,
+    12343, 16412, 0, 24648, 4269, 12335, 8619, 24618, 32803, 12454, 16714, 12367, 8621, 32812, 32776, 12351,
+    32846, 32794, 16448, 24648, 24627, 24601, 24594, 8706, 8622, 8337, 12310, 12391, 24628, 4232, 12359, 8622,
+    24597, 0, 8430, 8343, 24597, 16487, 16432, 32776, 12391, 12311, 32794, 12367, 4199, 16514, 0, 16619,
+    24622, 12435, 8251, 16560, 16521, 24586, 12383, 32776, 12365, 24619, 32785, 0, 12335, 12295, 4285, 24594,
+    12375, 24627, 12311, 8711, 24625, 8714, 8327, 16450, 12359, 12399, 32794, 24603, 32811, 12319, 20482, 24605,
+    12335, 8253, 12375, 4246, 16487, 12327, 4290, 24625, 16627, 24595, 24587, 24625, 8710, 0, 24612, 16627,
+    24626, 32812, 20482, 32847, 24589, 12391, 16524, 32848, 32847, 24629, 8401, 4296, 12303, 12407, 8441, 12367,
+    24622, 8348, 12407, 32803, 16628, 24603, 24628, 32803, 12414, 16628, 12319, 0, 24620, 32785, 8534, 24622,
+    8600, 8626, 8441, 24614, 24626, 32785, 24610, 32846, 4279, 8715, 8330, 12341, 16596, 12438, 32848, 24580,
+    24622, 8532, 24580, 24588, 12359, 4238, 0, 24629, 32820, 8627, 12446, 24613, 24596, 0, 12319, 24604,
+    12351, 8627, 12341, 12375, 8614, 4307, 12351, 16487, 24617, 0, 12444, 8777, 12367, 24630, 8338, 24609,
+    4306, 12407, 16413, 8535, 16597, 24601, 16413, 8238, 24611, 24629, 16597, 16622, 24630, 0, 8255, 24630,
+    8698, 32848, 16450, 16523, 0, 0, 32781, 0, 0, 32775, 0, 24602, 16443, 32824, 32825, 12407,
+    32826, 8349, 8254, 0, 20485, 32827, 12332, 24627, 32812, 8416, 12430, 0, 16597, 4273, 32776, 32827,
+    0, 20485, 0, 24625, 8767, 8533, 32821, 24647, 32848, 16584, 12334, 32826, 4181, 8628, 32828, 32812,
+    4309, 0, 32776, 12390, 32848, 32821, 8716, 12375, 8255, 20482, 12311, 8719, 12351, 8349, 16561, 12301,
+    8625, 4156, 12335, 12399, 0, 0, 8597, 0, 12375, 24598, 8534, 12391, 12383, 4126, 8436, 16561,
+    32840, 16623, 16405, 8411, 12431, 32811, 0, 16561, 8720, 12383, 24617, 0, 0, 12399, 32828, 8348,
+    20482, 8803, 12327, 12294, 4150, 8721, 24620, 24609, 32829, 8721, 32817, 12388, 24626, 32803, 0, 32847,
+    24617, 4293, 32774, 8720, 12439, 32829, 8672, 0, 8807, 24593, 12407, 16484, 24593, 8806, 32794, 16412,
+    24594, 12375, 0, 12317, 16616, 32784, 12414, 24590, 8518, 0, 32848, 8439, 0, 0, 32847, 8808,
+    32794, 12375, 12428, 8494, 16479, 0, 0, 32829, 24583, 24618, 8808, 24586, 12415, 0, 20485, 0,
+    0, 12407, 24583, 4303, 12439, 16598, 12431, 16412, 32801, 24601, 12447, 4256, 24598, 32846, 12415, 32821,
+    16598, 24648, 12476, 12383, 12423, 0, 0, 12431, 12447, 8858, 12383, 16412, 0, 24583, 4311, 32821,
+    0, 12399, 12423, 8800, 8813, 32829, 12447, 32829, 0, 0, 16441, 8853, 24583, 0, 24578, 8813,
+    24591, 12469, 12483, 12399, 32849, 8867, 8254, 8241, 20482, 8244, 8812, 0, 24617, 0, 8346, 12477,
+    12469, 12431, 8214, 0, 0, 24612, 8245, 12485, 12439, 24618, 24606, 12423, 8435, 12485, 8523, 4266,
+    0, 24581, 0, 12491, 12326, 0, 24583, 8862, 16412, 8689, 0, 12478, 24607, 24599, 0, 32829,
+    12462, 12493, 12478, 4313, 16524, 32845, 0, 12415, 16415, 12470, 4319, 24581, 12423, 24591, 12447, 16443,
+    12478, 24607, 8880, 12462, 32849, 8351, 16491, 4325, 8676, 12455, 16417, 24585, 4323, 12462, 32786, 12470,
+    12486, 4195, 8814, 32821, 24615, 16595, 24606, 12486, 8884, 12486, 8537, 8877, 16453, 24625, 32844, 24615,
+    8883, 32795, 16631, 20481, 24586, 32849, 12470, 24591, 16492, 12478, 32776, 12312, 8874, 8885, 24626, 4228,
+    20483, 32848, 16472, 12462, 16492, 16633, 24627, 8847, 24602, 0, 24627, 24577, 12328, 12470, 32821, 24577,
+    16480, 24641, 24626, 32804, 24599, 12486, 24628, 0, 32803, 8444, 0, 24625, 12494, 20481, 20482, 12360,
+    24628, 16455, 12336, 12494, 24602, 24579, 4340, 0, 12500, 12494, 24628, 32795, 12447, 16634, 16528, 16529,
+    12499, 24580, 12304, 4342, 0, 12494, 24580, 0, 12470, 16632, 16634, 12501, 12479, 8639, 16493, 0,
+    0, 12304, 32795, 32804, 0, 12328, 0, 0, 4298, 12471, 12352, 0, 12500, 20482, 0, 0,
+    12502, 16563, 16634, 8896, 24580, 16635, 12498, 12501, 8550, 32795, 8272, 4185, 24583, 8544, 12328, 16456,
+    32849, 12487, 24615, 12312, 16530, 24601, 0, 32786, 24583, 16530, 16565, 12326, 16493, 16456, 24629, 0,
+    24607, 24626, 32786, 24589, 8576, 24612, 12312, 32804, 12501, 8272, 24591, 0, 32813, 20483, 16566, 24610,
+    0, 16456, 8364, 16635, 12502, 8638, 16566, 12390, 24599, 12344, 24623, 16447, 32846, 8643, 12328, 24623,
+    8640, 0, 12431, 32843, 24623, 24583, 24629, 16530, 12392, 12344, 12344, 24597, 0, 12320, 8361, 12495,
+    8644, 0, 16613, 12479, 24593, 12495, 16418, 32795, 4369, 24613, 8905, 32777, 12471, 12368, 32785, 24591,
+    16420, 8906, 16617, 0, 12312, 16567, 8906, 0, 24623, 12360, 16567, 24623, 8901, 24630, 12400, 20483,
+    12400, 8367, 16494, 8644, 24581, 12471, 0, 24599, 24599, 12487, 16493, 24610, 24605, 16708, 12384, 32848,
+    12463, 32830, 32830, 12320, 8737, 8864, 20481, 0, 20481, 24630, 4354, 32830, 24611, 24587, 12455, 8907,
+    16420, 24578, 16457, 32813, 32830, 32829, 12336, 0, 4393, 16531, 8709, 12389, 12352, 8735, 24579, 16493,
+    12368, 16499, 24612, 0, 20485, 0, 12328, 12408, 12408, 8440, 12399, 20481, 16431, 32804, 8556, 12455,
+    24607, 8526, 24619, 12408, 16494, 4367, 12503, 8516, 0, 12360, 0, 16416, 24618, 24580, 24618, 32795,
+    8730, 12352, 12495, 12336, 0, 4400, 12455, 16456, 32830, 12312, 12295, 8370, 8649, 16420, 8889, 24583,
+    0, 16622, 8278, 32786, 0, 24625, 0, 24620, 16457, 4363, 24617, 8271, 8907, 8648, 24601, 24611,
+    8371, 16568, 8463, 16457, 8551, 12503, 16604, 8646, 12368, 32827, 8557, 32830, 4403, 8278, 4405, 16594,
+    0, 0, 4408, 0, 12392, 0, 12328, 8371, 12510, 16604, 16418, 16494, 0, 24617, 16531, 4404,
+    20484, 4381, 8278, 12508, 12468, 4409, 8269, 16591, 24614, 8649, 0, 12510, 8318, 0, 0, 0,
+    0, 0, 32785, 32794, 0, 32813, 8557, 0, 24633, 16650, 24635, 8650, 0, 0, 24623, 24635,
+    8650, 12510, 24634, 4328, 12395, 12352, 24581, 8687, 12439, 16654, 32785, 24635, 12431, 12336, 32822, 4334,
+    24620, 24633, 24634, 8451, 12511, 8810, 24579, 24634, 24630, 12439, 8742, 12295, 12511, 0, 24636, 8464,
+    0, 16655, 0, 24633, 12421, 0, 16658, 0, 12477, 16568, 8464, 24619, 12368, 24636, 24634, 32822,
+    0, 0, 0, 24636, 24633, 24623, 32830, 8464, 0, 8457, 0, 24635, 16418, 16659, 8371, 16659,
+    12511, 12440, 12511, 24623, 4252, 24582, 24618, 8740, 0, 8743, 24633, 0, 0, 24623, 8829, 24637,
+    0, 12432, 16598, 4338, 24637, 12424, 16454, 12301, 0, 24637, 0, 12484, 24582, 16663, 8872, 8743,
+    0, 8830, 8743, 16662, 16495, 16653, 32812, 12495, 24582, 0, 32795, 0, 0, 32777, 16664, 12440,
+    24601, 12463, 24617, 24594, 0, 12418, 16608, 12448, 12511, 8830, 16605, 24636, 12511, 24637, 12467, 0,
+    12492, 16605, 16605, 8831, 0, 12416, 32795, 24617, 8834, 0, 4424, 24595, 24583, 8630, 24631, 12312,
+    12424, 24636, 16495, 16665, 8900, 12475, 12416, 12336, 24629, 20481, 12328, 16604, 16665, 16532, 12304, 8835,
+    8279, 8835, 24620, 24637, 8376, 8283, 24614, 8255, 16605, 24631, 16458, 4435, 12416, 24637, 8561, 32841,
+    16532, 8836, 4366, 4429, 32812, 32804, 8836, 8609, 24603, 0, 24637, 12424, 24637, 24636, 8562, 8376,
+    12344, 8283, 24602, 24638, 16665, 24631, 16531, 32848, 24598, 24638, 12304, 8458, 12424, 8667, 8788, 24588,
+    8374, 24615, 8653, 24623, 8904, 12352, 24638, 32822, 24633, 8470, 16421, 24633, 0, 12440, 24605, 12448,
+    16669, 0, 16421, 4446, 4445, 12320, 24638, 8655, 8654, 24629, 32783, 4392, 24623, 12455, 24633, 32848,
+    24578, 24609, 16670, 12296, 12368, 12456, 8563, 24638, 8827, 16569, 24631, 24633, 24631, 16633, 12456, 32849,
+    16569, 16569, 24627, 8377, 16639, 8836, 24636, 16671, 16666, 4448, 16671, 24604, 8655, 32784, 4451, 12440,
+    24634, 0, 12312, 20485, 0, 8377, 24614, 4451, 24611, 12360, 0, 16605, 12432, 24596, 20484, 16458,
+    8563, 0, 16527, 0, 12360, 0, 12456, 32813, 8656, 0, 0, 16532, 24638, 24631, 20484, 16641,
+    0, 24638, 0, 24637, 12376, 24628, 8744, 8347, 0, 24619, 4412, 8795, 8736, 4432, 16603, 16672,
+    8470, 24630, 16621, 32786, 0, 12423, 32849, 12376, 16495, 16671, 8748, 16672, 8748, 0, 24587, 12304,
+    24628, 12375, 32821, 16672, 24609, 16495, 16569, 24581, 16458, 24622, 32775, 12446, 12479, 24629, 16574, 8320,
+    4462, 24593, 8749, 4352, 20485, 8423, 8747, 32774, 0, 16642, 4288, 24637, 16642, 8749, 8564, 12320,
+    24579, 16628, 24626, 8564, 32829, 8678, 12384, 20484, 8469, 16420, 4466, 16421, 8821, 0, 24635, 20484,
+    16670, 12336, 16671, 8891, 4456, 16458, 16577, 0, 8378, 12352, 8715, 32776, 24623, 12509, 4467, 4357,
+    12408, 0, 24607, 24622, 8560, 16642, 24618, 32821, 20484, 32802, 32813, 24619, 16490, 8234, 4384, 24580,
+    12455, 8564, 16532, 12384, 12344, 16486, 12429, 12375, 0, 12294, 8657, 16642, 4450, 24648, 24638, 16606,
+    8471, 8589, 12293, 12478, 8650, 8282, 12391, 8657, 24638, 0, 8218, 12400, 24639, 24638, 24599, 8378,
+    24614, 24639, 12479, 4472, 12446, 16554, 0, 8657, 16626, 16606, 12325, 12432, 24639, 24629, 12351, 8553,
+    4472, 24615, 4469, 32840, 16413, 4204, 8564, 24627, 16569, 8285, 12303, 0, 0, 0, 8231, 8758,
+    24627, 20481, 8824, 20486, 16642, 8282, 24639, 24622, 8783, 24639, 12295, 0, 0, 32831, 4389, 8635,
+    20482, 16522, 24618, 8816, 8340, 0, 16603, 32840, 24604, 0, 12422, 8557, 24639, 8797, 16494, 8378,
+    8442, 0, 0, 16524, 20481, 12391, 8255, 12359, 8762, 8216, 12426, 0, 32835, 20486, 8307, 32835,
+    0, 32831, 16569, 16455, 4442, 8471, 4154, 12380, 8750, 12296, 24611, 8365, 32777, 0, 0, 16640,
+    4459, 24639, 12462, 24647, 8378, 32836, 16567, 8358, 24639, 8700, 32836, 32822, 12455, 16457, 8840, 4348,
+    24648, 12416, 12384, 32837, 8839, 8825, 24630, 32836, 8283, 12432, 8750, 24590, 32786, 0, 24577, 24636,
+    8841, 0, 12432, 0, 8841, 12384, 20486, 0, 8592, 24635, 12423, 32831, 0, 24613, 24583, 4418,
+    24589, 24578, 24611, 0, 0, 24586, 0, 0, 24590, 24647, 12343, 16606, 0, 12296, 12416, 8842,
+    24621, 8270, 8375, 32848, 8842, 0, 32812, 12327, 0, 32837, 32822, 0, 32838, 32813, 12440, 0,
+    8285, 0, 20481, 0, 8899, 12486, 0, 32838, 20486, 24599, 32822, 0, 12480, 0, 0, 8842,
+    12440, 20485, 20484, 32831, 32838, 24628, 0, 0, 0, 8916, 24606, 0, 12472, 20481, 12455, 12448,
+    16640, 12407, 12480, 24591, 0, 8843, 12392, 24633, 24583, 12448, 32838, 24627, 24634, 24607, 12448, 24639,
+    0, 24628, 0, 0, 0, 12303, 24583, 12336, 12488, 0, 4261, 12432, 0, 12507, 0, 0,
+    12296, 12296, 32838, 8921, 32838, 24614, 0, 8923, 0, 8471, 0, 24607, 24585, 8752, 0, 0,
+    0, 32838, 0, 32834, 8454, 24635, 0, 0, 8922, 12487, 0, 20486, 8913, 24619, 0, 8442,
+    20485, 0, 16420, 32838, 0, 0, 0, 0, 12400, 0, 0, 12496, 0, 12464, 0, 24599,
+    24636, 32838, 4471, 0, 12496, 0, 32795, 8938, 32839, 0, 12472, 12480, 24591, 8278, 8927, 0,
+    12531, 12522, 8928, 4394, 0, 24600, 8928, 8926, 16529, 0, 12480, 0, 12456, 24600, 0, 16449,
+    20481, 24583, 32802, 12472, 0, 8278, 0, 0, 12488, 32833, 0, 8929, 12464, 24592, 0, 0,
+    24625, 20481, 8929, 12540, 12533, 24635, 32839, 0, 0, 16458, 0, 8272, 32849, 24584, 8929, 0,
+    0, 16495, 0, 0, 24584, 24608, 8741, 8962, 12496, 24601, 24584, 8953, 16644, 0, 24607, 0,
+    32777, 0, 0, 0, 8961, 20486, 24584, 32786, 4275, 0, 0, 32785, 0, 12496, 0, 16602,
+    12525, 8281, 12548, 12546, 24585, 12504, 0, 0, 12539, 24608, 0, 12496, 0, 0, 32795, 12518,
+    32839, 24584, 8958, 24600, 12496, 8469, 12400, 12547, 12534, 12549, 0, 0, 16643, 16637, 12548, 16450,
+    8278, 0, 32849, 0, 24582, 8285, 0, 12518, 12549, 0, 0, 12541, 0, 8934, 24600, 24639,
+    24616, 8547, 24592, 4465, 16532, 32804, 12542, 24639, 16643, 12542, 12504, 12530, 12518, 12488, 12542, 0,
+    24634, 8972, 8283, 0, 0, 8285, 0, 12534, 32839, 0, 8974, 8433, 24608, 0, 0, 8977,
+    0, 0, 0, 32785, 0, 0, 0, 8978, 0, 12518, 8978, 8935, 32786, 0, 12542, 0,
+    32785, 12451, 0, 8935, 0, 0, 0, 0, 12320, 12538, 0, 12550, 0, 24623, 16643, 0,
+    12542, 8933, 0, 32813, 12518, 24598, 0, 12550, 0, 12556, 12550, 0, 0, 12455, 8725, 0,
+    4379, 12464, 0, 8849, 0, 0, 0, 8936, 12549, 8468, 12557, 0, 24626, 12535, 0, 0,
+    0, 0, 0, 0, 8936, 0, 0, 0, 0, 0, 0, 24583, 0, 12550, 8750, 24623,
+    0, 0, 0, 0, 0, 12558, 8988, 24616, 20483, 0, 24630, 8932, 8467, 0, 0, 20486,
+    0, 16601, 0, 0, 12526, 32839, 0, 12558, 12535, 0, 8749, 0, 0, 0, 8993, 0,
+    4414, 0, 12527, 0, 0, 8285, 12415, 32813, 0, 32831, 24621, 20486, 0, 20486, 0, 0,
+    0, 0, 0, 8378, 0, 0, 0, 12303, 0, 12415, 12367, 0, 8935, 0, 24584, 12526,
+    0, 8985, 24624, 24604, 0, 0, 12551, 0, 0, 8950, 8471, 0, 0, 12526, 8994, 0,
+    0, 0, 12519, 0, 24591, 0, 0, 0, 0, 0, 12550, 0, 12504, 0, 0, 12512,
+    0, 0, 0, 0, 12392, 12535, 0, 0, 0, 8727, 12471, 8995, 8749, 24624, 8999, 8999,
+    0, 0, 8998, 0, 0, 12534, 12558, 24584, 0, 0, 12534, 24616, 0, 12519, 0, 12519,
+    9000, 0, 0, 0, 0, 12550, 0, 0, 32777, 12527, 12527, 12527, 32839, 0, 0, 0,
+    24624, 12535, 0, 9000, 0, 24624, 32786, 8991, 0, 0, 0, 0, 0, 32777, 8969, 0,
+    0, 0, 0, 8944, 0, 0, 24633, 0, 16673, 32822, 0, 16676, 0, 0, 12551, 9000,
+    20484, 24623, 0, 24634, 0, 0, 12424, 0, 0, 8911, 16677, 0, 0, 12543, 0, 0,
+    16677, 0, 0, 12424, 16530, 0, 0, 0, 0, 12559, 0, 0, 0, 12559, 0, 12564,
+    24608, 0, 0, 0, 16678, 0, 12564, 0, 0, 16678, 32804, 0, 12512, 24633, 24633, 24635,
+    24616, 12512, 32803, 24592, 24636, 0, 0, 0, 12376, 24634, 12565, 4375, 0, 12565, 0, 24584,
+    0, 0, 0, 0, 12565, 8894, 12559, 0, 12562, 0, 0, 0, 12566, 0, 0, 0,
+    0, 0, 24637, 16678, 8989, 12472, 24593, 16531, 0, 0, 0, 0, 0, 0, 16679, 0,
+    0, 0, 0, 16679, 0, 0, 0, 24600, 0, 0, 0, 0, 12536, 0, 0, 0,
+    0, 16679, 0, 32804, 0, 0, 24624, 12520, 12555, 0, 12520, 32804, 0, 0, 0, 0,
+    24637, 9011, 24624, 0, 24592, 12536, 12567, 0, 32849, 9005, 0, 12567, 12518, 12566, 8973, 0,
+    0, 12567, 12544, 24592, 24636, 24624, 0, 0, 0, 12520, 0, 12567, 0, 0, 0, 8963,
+    9015, 0, 0, 12543, 0, 24592, 24608, 8460, 12528, 0, 0, 0, 0, 9016, 0, 0,
+    12536, 0, 0, 0, 12567, 12567, 0, 12536, 12528, 0, 0, 0, 12544, 0, 4454, 0,
+    9008, 0, 12544, 0, 0, 0, 12552, 24638, 0, 0, 0, 0, 0, 0, 0, 0,
+    24638, 0, 0, 0, 24608, 24584, 0, 4427, 12552, 0, 24638, 0, 9018, 12528, 0, 12536,
+    16680, 12552, 12567, 0, 9021, 0, 0, 0, 9014, 12552, 0, 0, 0, 0, 9021, 0,
+    0, 0, 8994, 0, 16680, 24616, 12567, 0, 12512, 0, 9020, 24581, 0, 9022, 0, 0,
+    24600, 24616, 12543, 32804, 0, 0, 0, 0, 16680, 0, 0, 0, 24632, 0, 0, 0,
+    0, 0, 0, 0, 24616, 0, 0, 12512, 0, 0, 0, 12536, 0, 24624, 12543, 16680,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 24636, 0, 0, 0, 12552, 0, 0,
+    24632, 0, 0, 0, 0, 0, 0, 12560, 0, 16680, 24624, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 12560, 0, 0, 0, 24637, 0, 0, 9026, 0, 0, 12392, 0,
+    0, 0, 0, 9016, 0, 0, 0, 0, 32777, 0, 24592, 0, 0, 0, 0, 0,
+    0, 9027, 0, 9027, 24600, 0, 12560, 0, 12528, 0, 24632, 0, 0, 0, 0, 0,
+    0, 0, 12528, 12536, 12544, 0, 0, 0, 0, 0, 24634, 20481, 0, 12536, 0, 9028,
+    12520, 0, 0, 12544, 16643, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 12560, 24608, 12560, 0, 0, 0, 0, 9028, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 12552, 0, 24632, 0, 0, 12520, 0, 12528,
+    0, 12552, 0, 0, 0, 9029, 0, 0, 0, 0, 0, 12552, 9028, 0, 24639, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8980, 24635, 0, 0, 12560, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24635, 0, 0, 0, 32831,
+    0, 0, 0, 0, 0, 0, 0, 32840, 32786, 0, 0, 0, 0, 0, 0, 12528,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12560, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9003, 0, 0, 24639, 0, 0, 0, 0, 0, 12563,
+    0, 0, 0, 0, 12568, 0, 12568, 32840, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 12568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12568, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 12568, 0, 0, 0, 0, 0, 0, 0, 32840,
+    0, 0, 20486, 0, 0, 0, 0, 0, 12572, 0, 0, 0, 0, 0, 0, 12568,
+    0, 12568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32831, 0, 0, 0, 0,
+    0, 0, 0, 0, 12571, 0, 0, 0, 0, 12568, 0, 0, 0, 0, 32840, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8948, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 12573, 0, 0, 12574, 0, 0, 9025, 12574,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 12574, 12520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    12575, 12575, 0, 0, 0, 0, 0, 0, 0, 24641, 12575, 0, 16682, 0, 24584, 0,
+    0, 0, 0, 12575, 12560, 0, 0, 0, 32840, 0, 0, 0, 0, 0, 0, 0,
+    12568, 0, 0, 16687, 16690, 0, 0, 0, 0, 24641, 0, 0, 0, 0, 0, 0,
+    24644, 0, 0, 0, 0, 0, 24643, 24643, 0, 0, 0, 0, 16695, 0, 0, 0,
+    0, 24642, 0, 16643, 0, 0, 0, 12575, 0, 0, 0, 0, 0, 16696, 0, 0,
+    0, 24584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24644, 0,
+    0, 0, 0, 0, 24641, 24645, 24632, 0, 12544, 0, 12575, 0, 0, 0, 0, 0,
+    0, 24641, 24632, 24643, 32840, 0, 16697, 0, 16693, 0, 0, 24641, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16701, 24641, 0, 0, 0, 0,
+    0, 0, 0, 24645, 0, 0, 0, 0, 0, 12576, 0, 0, 0, 0, 0, 0,
+    0, 16702, 0, 0, 0, 16702, 0, 0, 24624, 0, 0, 0, 12576, 4437, 0, 24643,
+    0, 24642, 16696, 0, 0, 0, 0, 12520, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24644, 24645, 0, 0,
+    0, 0, 16702, 0, 0, 24624, 0, 0, 0, 24646, 0, 0, 0, 0, 0, 24644,
+    0, 0, 0, 12528, 12544, 12576, 0, 0, 0, 12576, 0, 0, 24646, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 16706, 16704, 24643, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24646, 0, 0, 12576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16708, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24644, 0, 0, 0,
+    0, 0, 0, 0, 16707, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24646, 0, 24642, 0, 0, 0, 0, 0, 0, 0, 24645, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 16701, 24639, 16709, 0, 0, 0, 16709, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 24642, 0, 0, 0, 0, 0, 0,
+    24632, 0, 0, 0, 0, 0, 0, 16700, 0, 24646, 0, 24644, 0, 0, 0, 0,
+    0, 0, 0, 16709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 24645, 0, 0, 0, 0, 0, 0, 0,
+    16702, 0, 16709, 0, 0, 0, 0, 0, 0, 0, 24640, 24640, 0, 0, 0, 0,
+    24640, 0, 0, 0, 24640, 0, 24645, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24647, 0, 0, 0, 24640, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12544, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24642, 0,
+    0, 0, 0, 0, 0, 24640, 0, 24647, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12560, 0, 0, 0, 0, 0, 0, 16713, 0, 0, 24641, 0, 0,
+    24643, 0, 0, 0, 0, 0, 0, 16712, 0, 0, 0, 24642, 0, 0, 0, 24642,
+    0, 0, 16714, 0, 0, 0, 0, 0, 24642, 24647, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 24641, 0, 0, 0, 16715, 0, 0, 0,
+    8193, 4101, 16691, 32771, 24644, 4099, 32770, 8196, 12297, 8381, 12289, 16715, 8288, 12306, 16714, 24593,
+    16422, 32770, 32771, 32789, 8199, 24646, 4105, 24647, 32772, 8198, 24586, 32779, 24585, 12307, 8290, 32780,
+    32772, 32772, 16459, 16428, 0, 0, 0, 12313, 32781, 0, 24645, 24643, 24645, 32790, 32772, 32772,
+    0, 32790, 8201, 0, 4111, 0, 32791, 4115, 0, 4117, 32773, 0, 16716, 16429, 24640, 8296,
+    8204, 32773, 12315, 32791, 12292, 16496, 24595, 24594, 24602, 32791, 0, 24587, 12322, 32781, 4121, 8298,
+    0, 0, 12308, 8476, 0, 24593, 32799, 12308, 12300, 24586, 20482, 0, 8207, 24645, 24601, 32782,
+    16716, 32773, 32830, 12337, 0, 0, 24603, 24603, 24593, 32791, 4129, 16715, 32797, 0, 16506, 32791,
+    16503, 24601, 0, 12356, 24602, 8302, 16397, 24647, 4135, 16398, 32800, 16473, 8389, 12356, 32790, 24596,
+    32800, 24578, 24596, 12362, 24640, 32781, 16472, 12339, 0, 32782, 12324, 24611, 0, 24596, 0, 24611,
+    12364, 0, 24588, 16432, 12309, 0, 32792, 0, 12324, 8402, 24646, 20482, 32792, 24588, 0, 24604,
+    8391, 8493, 16474, 32799, 24604, 16543, 20482, 8206, 0, 16474, 16400, 12354, 0, 32800, 24596, 24588,
+    24612, 12363, 24612, 8383, 32801, 12348, 4145, 16399, 8309, 0, 32808, 20483, 12291, 32807, 0, 32800,
+    0, 16437, 20483, 32808, 24609, 16510, 0, 0, 8395, 8586, 4157, 0, 32807, 0, 0, 0,
+    32792, 16717, 24646, 32774, 0, 16511, 12325, 24580, 0, 0, 24580, 12387, 24595, 24609, 0, 32809,
+    8581, 24578, 0, 24597, 32809, 16502, 24647, 8307, 8658, 8589, 8219, 4160, 12357, 32798, 32809, 4162,
+    12388, 32775, 12380, 24611, 16545, 12294, 32809, 32793, 12355, 16547, 12396, 12395, 24610, 12396, 32792, 8590,
+    32808, 12396, 12310, 12332, 8679, 24597, 4166, 12309, 12389, 24641, 12381, 4127, 16717, 24605, 24605, 32809,
+    16548, 24597, 16479, 16478, 24589, 16438, 24601, 16548, 24612, 24589, 12380, 4176, 32775, 24603, 32784, 20483,
+    12373, 32810, 24601, 12365, 12349, 24604, 12371, 24601, 32784, 20483, 8415, 12397, 24586, 20483, 4188, 12397,
+    12310, 12404, 32802, 32774, 24640, 12377, 12404, 24595, 12403, 24619, 32793, 12403, 24605, 24619, 24595, 12405,
+    8229, 24594, 32801, 24596, 8222, 24594, 12404, 12334, 24618, 32783, 32783, 12405, 32793, 16578, 8314, 32802,
+    16479, 4139, 16707, 16437, 8495, 12342, 12310, 12358, 8601, 24618, 24613, 12342, 12405, 24597, 24610, 16480,
+    24613, 24620, 8507, 24620, 32798, 24643, 12366, 24617, 12401, 16584, 12350, 12350, 8683, 16717, 12366, 16443,
+    16583, 8224, 32793, 8316, 12334, 24593, 16551, 8512, 24610, 16585, 12310, 12346, 12318, 16580, 24610, 12342,
+    24613, 16469, 24593, 8593, 24597, 16517, 16553, 8327, 32810, 32806, 16517, 24613, 12302, 24618, 12318, 12333,
+    24611, 20484, 8673, 24587, 16717, 24603, 24612, 12388, 32802, 8508, 16553, 4202, 24612, 24621, 24610, 24613,
+    24621, 32811, 4190, 24609, 24585, 8513, 32817, 24621, 8407, 8603, 16406, 16509, 8420, 8605, 32809, 32817,
+    24593, 32816, 12350, 24610, 32793, 12390, 24612, 24613, 32818, 32802, 32816, 32783, 24594, 16512, 12390, 0,
+    32811, 20484, 0, 32818, 0, 24589, 16552, 8694, 32784, 24597, 12366, 32818, 24579, 16442, 12366, 32819,
+    24604, 12382, 0, 4151, 8567, 32819, 24589, 12411, 0, 24597, 12398, 24648, 32811, 12364, 8606, 32809,
+    12398, 8765, 12390, 12374, 32818, 24640, 12428, 8698, 24585, 12374, 32775, 24588, 12382, 12428, 16516, 12398,
+    12374, 0, 24605, 32819, 0, 20484, 24598, 24590, 32793, 32819, 12374, 32799, 24579, 8690, 32801, 0,
+    12435, 24590, 24610, 12436, 16442, 8693, 12421, 12413, 24606, 24589, 12413, 24598, 12398, 12429, 12294, 24611,
+    8776, 8699, 24606, 12406, 32789, 12406, 12326, 8482, 32819, 32794, 24589, 16407, 24617, 4219, 12436, 24594,
+    12421, 12437, 4217, 24586, 32794, 16717, 12437, 32793, 24646, 16484, 24598, 12372, 12334, 24590, 24585, 16590,
+    16482, 24582, 24577, 16588, 24647, 16717, 4223, 8510, 32802, 12442, 12406, 12398, 12294, 32775, 8417, 32818,
+    16445, 16409, 8695, 32818, 16410, 8787, 8333, 12335, 24582, 12429, 16591, 8786, 12445, 24590, 24595, 24613,
+    0, 12445, 24614, 16591, 16447, 32844, 32844, 12438, 24648, 32819, 12390, 20482, 12445, 16591, 32782, 24587,
+    8773, 8783, 12576, 24585, 24590, 16441, 8488, 8791, 0, 12422, 16448, 0, 8524, 0, 0, 24582,
+    0, 8519, 32845, 24596, 8426, 32811, 8792, 24602, 0, 12325, 32846, 20484, 16443, 0, 24588, 24614,
+    24648, 8615, 0, 16411, 32820, 24603, 20482, 12443, 8789, 32820, 32793, 0, 32794, 12351, 32785, 12327,
+    24594, 4249, 24586, 12367, 8435, 12413, 12438, 12311, 32820, 12452, 4259, 24609, 32794, 12367, 12413, 8431,
+    12319, 8523, 12452, 8246, 12452, 12444, 12358, 24595, 32846, 16486, 12335, 12453, 12453, 12451, 16559, 8528,
+    24627, 12453, 16557, 24604, 32847, 24587, 8343, 16523, 24603, 32820, 32847, 24614, 24614, 24627, 24625, 20483,
+    24627, 24625, 24602, 16486, 16617, 8436, 24625, 12454, 24577, 32812, 8250, 16540, 12454, 12327, 12319, 32784,
+    8419, 12426, 32812, 24628, 24626, 8621, 12454, 8598, 16609, 24628, 12359, 32803, 32812, 8620, 24587, 8250,
+    16486, 12453, 32847, 8249, 24588, 0, 8579, 12351, 0, 0, 24626, 8622, 24627, 20483, 32820, 24620,
+    12351, 8436, 16449, 16611, 24581, 12454, 16449, 24628, 16487, 12350, 16521, 0, 12406, 4264, 32820, 12451,
+    24622, 12367, 0, 24609, 0, 8710, 24622, 24628, 16560, 12399, 8250, 24581, 24629, 16413, 8709, 8346,
+    8712, 24606, 24586, 24622, 0, 8529, 8714, 16560, 32776, 12383, 32847, 24588, 16449, 8533, 24628, 24609,
+    8532, 0, 8715, 8341, 4280, 12412, 32775, 4247, 12303, 8715, 0, 8347, 8434, 12383, 16522, 4239,
+    16436, 32776, 32784, 16450, 24625, 12399, 12444, 24629, 32812, 16624, 4294, 20482, 32811, 12407, 8753, 24585,
+    0, 4285, 12397, 4291, 16535, 16622, 0, 8348, 32790, 8573, 24617, 24627, 12358, 16592, 8534, 16595,
+    12382, 24580, 12391, 0, 4235, 24603, 24614, 8626, 16399, 8441, 24629, 32848, 24617, 32785, 16487, 24629,
+    4301, 16519, 4289, 0, 8627, 12409, 0, 24627, 24604, 24610, 24626, 24613, 20483, 32812, 16413, 24619,
+    0, 8348, 16524, 24629, 12385, 4307, 12421, 16597, 8442, 8529, 32820, 8349, 16597, 32812, 24630, 16561,
+    8441, 12419, 0, 24630, 12319, 16561, 16487, 32848, 8535, 12436, 4213, 4311, 8442, 12446, 24630, 24640,
+    12351, 32847, 16561, 16596, 32824, 12373, 32773, 8439, 32848, 16400, 0, 32826, 16406, 16450, 8442, 4253,
+    32825, 16628, 24604, 20485, 12454, 24621, 16487, 12444, 32827, 24605, 20485, 20485, 12373, 12316, 4267, 24606,
+    8349, 24627, 32827, 32827, 12430, 32845, 20485, 32827, 8342, 12343, 0, 24620, 24609, 32827, 32821, 24601,
+    12427, 32828, 24596, 24630, 32821, 16627, 24627, 0, 8256, 24598, 16589, 24603, 16450, 0, 16537, 32827,
+    12342, 8225, 32811, 32828, 16475, 12326, 12364, 24598, 32788, 24618, 0, 12383, 32828, 16524, 8720, 8798,
+    12333, 24630, 24621, 32825, 32828, 16515, 32821, 4276, 0, 24578, 16622, 12399, 24579, 12340, 8778, 0,
+    32828, 8803, 24648, 32817, 24612, 16413, 4196, 8721, 32829, 16561, 8717, 32826, 32828, 0, 32848, 4274,
+    0, 0, 8256, 8400, 12439, 0, 12295, 4229, 20485, 8807, 4310, 8670, 24582, 24620, 32811, 32828,
+    4210, 0, 24590, 8796, 8535, 0, 32826, 4141, 12391, 8628, 8808, 12340, 16406, 16614, 8759, 16554,
+    8768, 12407, 32794, 24618, 32815, 24642, 8844, 32842, 32829, 8349, 8326, 32772, 12475, 8502, 8664, 16598,
+    0, 12343, 0, 16598, 12465, 0, 12447, 8331, 24579, 0, 12460, 4304, 8424, 12475, 0, 24606,
+    0, 16410, 8812, 8850, 16597, 12447, 12445, 8811, 12447, 16558, 0, 12484, 12468, 24599, 32827, 24599,
+    32794, 24590, 12483, 12302, 24602, 0, 24599, 8865, 12326, 8813, 32780, 24607, 12477, 12393, 16480, 24591,
+    32849, 32829, 12476, 32849, 8813, 0, 8869, 32785, 24620, 12484, 12318, 16598, 32802, 32826, 12439, 12481,
+    12431, 32849, 32801, 12469, 12415, 24591, 24598, 32847, 12415, 24582, 12477, 12485, 12359, 24618, 12423, 12489,
+    12492, 12485, 20485, 0, 12492, 24581, 12484, 24591, 8719, 0, 24578, 12330, 32843, 12461, 24607, 32829,
+    8814, 12493, 16413, 32795, 24591, 12491, 32849, 24629, 16411, 12334, 24591, 12470, 8409, 8257, 12296, 8878,
+    32777, 12493, 8880, 8248, 12485, 16488, 12493, 32786, 32795, 12478, 12470, 32803, 20481, 32795, 24615, 12367,
+    8249, 12486, 24615, 24590, 24629, 4314, 8595, 12486, 8527, 8706, 24599, 24594, 12493, 8883, 16451, 16632,
+    24583, 8873, 12485, 24593, 12304, 32849, 4316, 24587, 32795, 12477, 12491, 8885, 24585, 24594, 4320, 24603,
+    12312, 24625, 32849, 32776, 32795, 24617, 24606, 12347, 12455, 32781, 16466, 24607, 32786, 8354, 32849, 16485,
+    32777, 32804, 16573, 32804, 32804, 24589, 12296, 24615, 12328, 24595, 32812, 16634, 12455, 0, 12494, 12360,
+    24606, 12328, 12500, 24596, 12336, 0, 8263, 8484, 24587, 12494, 12499, 32795, 24615, 12352, 16634, 20481,
+    12500, 24591, 16493, 12500, 24602, 12312, 32794, 12501, 8636, 16634, 12501, 24601, 8892, 12498, 16493, 12344,
+    12479, 12344, 32804, 8229, 32786, 24591, 12368, 12501, 24587, 8500, 12368, 16492, 16529, 12461, 24599, 12501,
+    8896, 12431, 16564, 12463, 12479, 24625, 12502, 16565, 20481, 8458, 8359, 16456, 12336, 12502, 8546, 24610,
+    4355, 12487, 16566, 12502, 12463, 24591, 8814, 16635, 24591, 16530, 24580, 16419, 24610, 8352, 12463, 12502,
+    16419, 12471, 8612, 32802, 16635, 24611, 32786, 4367, 0, 24612, 12479, 8260, 24607, 32804, 8901, 12328,
+    32813, 12463, 16529, 12336, 8365, 8901, 8453, 20481, 16633, 24611, 24623, 8641, 16635, 0, 16419, 32813,
+    8445, 24614, 12495, 32795, 12376, 4200, 12312, 8548, 12487, 12311, 32849, 24595, 12502, 12392, 12344, 24587,
+    12463, 32786, 24583, 16492, 8643, 8322, 24597, 24648, 16635, 32849, 24626, 16494, 32786, 32795, 4155, 12368,
+    8273, 24594, 8228, 12376, 4370, 8895, 16567, 12384, 8644, 12352, 32795, 24589, 32786, 24630, 24623, 4366,
+    8644, 4382, 24599, 12376, 32785, 16455, 32847, 8736, 12400, 0, 8733, 8545, 12431, 24586, 12320, 8267,
+    16635, 24605, 8555, 12376, 12376, 12336, 12304, 12328, 16494, 8907, 8737, 8277, 12302, 8463, 12487, 20485,
+    16419, 8462, 12320, 24621, 8370, 24606, 32830, 12400, 16457, 24593, 32830, 8463, 0, 4393, 8277, 12408,
+    24607, 12312, 32821, 12392, 12408, 24611, 8906, 32775, 8277, 12400, 12296, 12320, 32830, 8737, 24617, 32803,
+    32813, 16457, 8556, 8648, 8556, 12408, 4390, 16709, 32804, 32813, 12503, 8647, 24626, 12471, 16603, 8875,
+    0, 12352, 24588, 32777, 12360, 12326, 12358, 4387, 8649, 12503, 12508, 8649, 12508, 24613, 12344, 12505,
+    12476, 8276, 4404, 32802, 12507, 24619, 12384, 16601, 12352, 24597, 8551, 12360, 12408, 16631, 12503, 24596,
+    12368, 16604, 16604, 12509, 12509, 24609, 16435, 24609, 8557, 24622, 12418, 24586, 12312, 16604, 16568, 8732,
+    12359, 24598, 12420, 8464, 16568, 0, 8262, 16406, 32808, 8569, 12510, 8371, 12503, 8633, 12510, 12328,
+    16568, 24589, 32830, 8370, 12295, 8371, 4409, 16420, 12510, 32813, 12510, 16627, 0, 0, 32803, 24595,
+    24607, 16531, 24601, 8728, 32822, 12439, 12503, 4408, 16465, 12360, 0, 8650, 8464, 24579, 12400, 24623,
+    32822, 4406, 8557, 24611, 16413, 12509, 12510, 12376, 8738, 12332, 8639, 12510, 8741, 32813, 8854, 0,
+    0, 12384, 12511, 32822, 16419, 0, 0, 24626, 12510, 24636, 8742, 0, 12376, 24633, 12431, 8742,
+    12416, 32820, 12447, 20484, 24577, 12511, 16658, 12495, 8447, 24635, 24577, 24590, 32811, 24634, 12336, 16568,
+    12400, 8338, 8321, 8825, 24633, 8743, 24598, 12424, 32813, 16659, 8743, 12511, 0, 4343, 24594, 12384,
+    24633, 12440, 12323, 32777, 4172, 24602, 16516, 24636, 24615, 4349, 24648, 4341, 32773, 8455, 12432, 24637,
+    12440, 16659, 24630, 12432, 0, 8829, 8538, 12424, 0, 24610, 24590, 16660, 8830, 24633, 12422, 12495,
+    16663, 8830, 12478, 12408, 16421, 32817, 12400, 12432, 24634, 16566, 0, 24602, 0, 12331, 24633, 32821,
+    12424, 12392, 24598, 12299, 12440, 0, 16419, 16664, 16495, 16664, 12511, 12448, 12440, 20481, 24637, 4415,
+    32818, 8819, 24602, 16605, 24633, 0, 24644, 0, 8834, 16665, 12448, 12432, 0, 4353, 16665, 12424,
+    12509, 12387, 24631, 24634, 8560, 0, 24631, 0, 16528, 16605, 8469, 8835, 16605, 32845, 0, 12448,
+    16560, 8907, 24631, 16532, 24634, 16458, 4433, 8469, 32803, 12440, 20482, 24606, 24643, 16495, 8226, 24647,
+    12508, 8836, 12511, 8835, 24631, 24636, 8376, 24637, 8337, 0, 8884, 8375, 24631, 24614, 8374, 0,
+    8610, 8562, 24629, 12423, 12458, 0, 0, 4358, 32785, 8467, 4413, 16532, 16495, 24638, 8905, 8562,
+    16656, 24615, 20485, 8655, 8806, 32822, 24638, 12448, 12304, 12510, 24635, 24631, 16669, 16665, 8377, 8284,
+    12448, 8256, 32822, 32848, 16458, 4446, 24625, 24636, 4178, 8376, 0, 12456, 8731, 4440, 24637, 24631,
+    12456, 4262, 8414, 16531, 24635, 12456, 16665, 12423, 8563, 8377, 8284, 8284, 8264, 0, 24638, 0,
+    8653, 0, 16569, 0, 24627, 12392, 16639, 16671, 12449, 16458, 24626, 12494, 4449, 24636, 24626, 8377,
+    12483, 32784, 0, 0, 24625, 24603, 0, 16640, 16569, 12456, 0, 16569, 32775, 24626, 24604, 12320,
+    8474, 20483, 4450, 24630, 32783, 4403, 8468, 24593, 0, 0, 0, 12344, 24644, 12296, 8563, 24625,
+    24588, 24638, 8832, 8656, 12412, 24637, 8868, 16641, 0, 8561, 8656, 8656, 24628, 8267, 0, 12456,
+    32777, 16672, 8900, 8745, 16672, 16532, 4451, 12368, 8748, 12456, 24634, 0, 16421, 20485, 8471, 12384,
+    12456, 8748, 12406, 8470, 16650, 32822, 12456, 16495, 12456, 4182, 12400, 24629, 0, 16641, 12392, 12360,
+    20481, 16569, 8749, 4457, 0, 16532, 0, 8378, 20484, 16642, 0, 24638, 8822, 16672, 12469, 12424,
+    12344, 12507, 32830, 8564, 24598, 0, 16602, 4443, 4466, 4385, 12392, 8471, 16626, 8886, 4465, 0,
+    4376, 24628, 16532, 16672, 0, 12460, 0, 0, 0, 4467, 24628, 16458, 12416, 0, 24580, 0,
+    12408, 8770, 0, 24629, 32775, 12454, 0, 16642, 32784, 8324, 0, 8440, 16606, 0, 12511, 4460,
+    32830, 12434, 0, 24635, 4299, 24637, 12495, 16606, 0, 0, 12487, 24630, 8276, 12416, 8657, 16575,
+    0, 20484, 8470, 16420, 4471, 0, 8859, 8657, 24635, 20484, 16653, 0, 16672, 16620, 0, 16458,
+    8554, 0, 8378, 8377, 16596, 24639, 32821, 24601, 4472, 8722, 16606, 16645, 0, 24579, 12432, 24630,
+    12429, 0, 24630, 12424, 16569, 0, 0, 12374, 4395, 16406, 24622, 8564, 0, 24618, 20486, 8657,
+    12430, 24617, 0, 32831, 20486, 24612, 8747, 32831, 12320, 24639, 8471, 8682, 12379, 12501, 8743, 8828,
+    0, 20486, 0, 16421, 12372, 24620, 32831, 16670, 0, 0, 12447, 32840, 8564, 12459, 12454, 12406,
+    24606, 20486, 16525, 12463, 12395, 4326, 32835, 24630, 8343, 32833, 8856, 12502, 32834, 16654, 0, 8684,
+    24580, 32835, 20486, 32834, 12303, 32831, 0, 32831, 32836, 32776, 32836, 12296, 32836, 8750, 0, 32786,
+    12352, 32820, 0, 24639, 12295, 0, 24612, 16638, 4400, 4363, 20481, 16523, 12461, 8840, 24614, 24587,
+    0, 32840, 16523, 4329, 24582, 0, 32837, 32837, 0, 0, 12391, 24648, 32837, 16524, 0, 24619,
+    8256, 20485, 8897, 12370, 8841, 32777, 32836, 20486, 32831, 32849, 0, 32831, 20486, 16456, 0, 8801,
+    8668, 16458, 0, 0, 12359, 12384, 32831, 32837, 32836, 32812, 8842, 24639, 16621, 16411, 8378, 0,
+    12408, 8362, 32836, 0, 0, 12352, 8842, 32837, 16670, 24602, 0, 0, 0, 32838, 8842, 12492,
+    24611, 32837, 8284, 4331, 0, 32795, 32837, 8369, 24577, 24636, 24578, 32785, 8517, 0, 8914, 24629,
+    16606, 0, 4205, 24635, 12423, 0, 24647, 24621, 24583, 0, 0, 24577, 12408, 0, 0, 8918,
+    8540, 12473, 4233, 0, 8256, 0, 32786, 12480, 12416, 8843, 32822, 12416, 12488, 32848, 8843, 32849,
+    20485, 0, 12488, 32838, 8919, 12464, 12464, 24613, 0, 8922, 8430, 12480, 24591, 16531, 8904, 12501,
+    12472, 32777, 20486, 12472, 12471, 0, 8923, 0, 12464, 8843, 0, 16598, 24605, 32831, 24615, 24630,
+    8923, 8839, 12480, 0, 8917, 12479, 0, 0, 0, 20486, 0, 24619, 4335, 16491, 12360, 0,
+    24591, 12496, 0, 20486, 32838, 20481, 12488, 24607, 20486, 8275, 0, 0, 0, 12432, 24626, 12303,
+    24583, 12400, 0, 32803, 8701, 12495, 8368, 12416, 32839, 12513, 8941, 12496, 32813, 8926, 24631, 20485,
+    32795, 8928, 24600, 12496, 8939, 12531, 24639, 32777, 8817, 32795, 8945, 24600, 0, 8631, 0, 24615,
+    0, 0, 8927, 0, 0, 12456, 32776, 0, 8266, 24599, 16598, 0, 24600, 32838, 0, 0,
+    16643, 24603, 12540, 0, 0, 8929, 24600, 0, 12533, 12540, 32786, 0, 16640, 24627, 8929, 24608,
+    12532, 24578, 12530, 8954, 0, 16643, 12464, 0, 0, 0, 0, 0, 12517, 24608, 8962, 0,
+    24608, 32813, 16530, 0, 32839, 16667, 12517, 32804, 0, 0, 24615, 12539, 32802, 8277, 0, 12541,
+    12522, 8360, 12541, 0, 0, 12504, 12504, 12495, 12541, 0, 0, 24608, 12504, 0, 12534, 12496,
+    32839, 12488, 8908, 12547, 0, 12376, 12549, 0, 12504, 24600, 12464, 16495, 24599, 8930, 8933, 12549,
+    0, 8973, 8929, 0, 24584, 8964, 0, 0, 24595, 0, 12472, 12549, 24608, 0, 8972, 24622,
+    24584, 8934, 24616, 12549, 0, 32785, 0, 12504, 12525, 24616, 12526, 12548, 12534, 8975, 0, 0,
+    12549, 0, 0, 24616, 24627, 12504, 32839, 8935, 0, 24615, 12540, 24584, 8969, 32835, 12504, 8470,
+    12368, 12526, 8935, 8978, 0, 12548, 16643, 0, 8977, 24608, 12376, 12304, 0, 24611, 0, 12472,
+    12525, 12533, 12542, 12480, 24634, 12542, 0, 0, 0, 12546, 12550, 0, 0, 4470, 16532, 16643,
+    0, 24639, 0, 32849, 24623, 12496, 12556, 0, 24604, 16421, 0, 0, 8284, 0, 12516, 8285,
+    0, 0, 32839, 0, 12553, 32813, 0, 0, 0, 12556, 24600, 8951, 12535, 12480, 8755, 8935,
+    4419, 12557, 12519, 12557, 12557, 8936, 0, 0, 24616, 0, 0, 24592, 12488, 8936, 12519, 8654,
+    0, 32839, 8989, 0, 0, 12558, 0, 0, 0, 12525, 12557, 24607, 12527, 24616, 24615, 0,
+    0, 12558, 0, 0, 12558, 0, 0, 8983, 12519, 16494, 24600, 12527, 8935, 0, 0, 12543,
+    12488, 0, 8978, 0, 32813, 12527, 12535, 24592, 0, 8993, 12488, 12543, 16450, 8994, 0, 12496,
+    4428, 8994, 8992, 0, 32813, 12535, 24608, 12558, 0, 32822, 12468, 0, 0, 8956, 12527, 24624,
+    0, 12558, 12392, 12543, 0, 0, 12551, 12551, 0, 12504, 12464, 0, 0, 12551, 0, 0,
+    0, 24624, 12535, 0, 16606, 0, 0, 12538, 8998, 12551, 8452, 12527, 12527, 12512, 4430, 0,
+    0, 24616, 0, 12512, 32822, 12504, 0, 12504, 0, 24608, 12535, 0, 0, 24628, 0, 0,
+    0, 0, 0, 0, 20485, 0, 8936, 0, 24616, 12555, 8625, 12464, 0, 20485, 0, 0,
+    9000, 0, 0, 0, 0, 0, 24616, 0, 8999, 32786, 0, 12512, 0, 12519, 32835, 24616,
+    0, 8959, 0, 0, 12558, 0, 12495, 0, 0, 0, 0, 32836, 0, 0, 24619, 0,
+    0, 0, 24586, 0, 0, 0, 16606, 24635, 0, 0, 0, 0, 0, 0, 16676, 12556,
+    24624, 0, 0, 16455, 24592, 12551, 0, 12496, 0, 0, 12559, 0, 0, 0, 0, 12558,
+    0, 0, 16677, 12512, 12559, 16677, 0, 0, 0, 0, 32822, 12559, 24636, 12559, 0, 32822,
+    16674, 8996, 12523, 12564, 16678, 0, 0, 32777, 24592, 0, 0, 24600, 0, 24592, 12563, 24599,
+    0, 12565, 0, 0, 12562, 0, 0, 12565, 12559, 12559, 12559, 0, 32786, 0, 16457, 0,
+    0, 12543, 0, 0, 0, 24592, 12304, 12559, 0, 0, 0, 0, 12566, 12564, 24605, 0,
+    12564, 0, 12566, 0, 0, 0, 0, 24608, 4372, 0, 0, 0, 0, 0, 16679, 12566,
+    0, 12467, 12565, 16679, 0, 24637, 0, 16454, 0, 24635, 12559, 0, 12536, 24585, 0, 24600,
+    0, 0, 0, 24634, 0, 0, 12565, 24592, 0, 0, 12566, 0, 0, 0, 12517, 20481,
+    0, 12517, 0, 0, 0, 0, 12567, 0, 0, 0, 12512, 0, 16679, 16679, 12565, 0,
+    0, 24631, 24592, 0, 0, 0, 12566, 0, 12566, 12544, 0, 0, 0, 0, 0, 0,
+    0, 0, 9015, 0, 9014, 0, 4455, 0, 0, 9016, 0, 0, 0, 32804, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24637, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12555, 12567, 0, 0, 0, 0, 0, 0, 24636, 0,
+    0, 0, 12552, 12520, 0, 0, 12552, 0, 0, 0, 9020, 24608, 0, 0, 0, 24592,
+    0, 0, 0, 0, 16680, 0, 0, 9021, 0, 8981, 0, 0, 0, 0, 12567, 0,
+    0, 12536, 12528, 0, 0, 0, 12544, 24631, 0, 0, 0, 0, 12544, 0, 0, 12552,
+    12520, 0, 24632, 0, 0, 0, 0, 0, 16680, 0, 24632, 12536, 0, 24632, 24608, 0,
+    0, 4438, 9022, 32777, 0, 0, 0, 0, 0, 0, 24599, 9022, 12567, 0, 0, 0,
+    12528, 0, 9019, 9022, 0, 0, 24632, 32777, 0, 0, 12535, 0, 8999, 0, 0, 12552,
+    0, 16495, 9006, 12528, 0, 0, 12519, 12560, 0, 0, 24600, 12552, 12543, 0, 0, 0,
+    0, 12549, 16680, 0, 0, 9009, 0, 24632, 0, 0, 0, 0, 24632, 0, 12552, 0,
+    12533, 9025, 0, 0, 0, 12536, 0, 32822, 0, 12548, 16421, 9026, 32839, 0, 9027, 0,
+    0, 0, 0, 8461, 0, 0, 0, 12560, 0, 24584, 24632, 0, 32804, 0, 0, 0,
+    12512, 0, 0, 0, 0, 0, 0, 0, 0, 9028, 0, 0, 0, 0, 9028, 0,
+    0, 0, 20486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9028, 9021, 0, 0,
+    0, 0, 0, 0, 0, 8378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24624, 0, 0, 12480, 0, 0, 0, 0, 0, 0, 0, 0, 12528, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9029, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32804, 0, 0, 0, 24624, 0,
+    0, 0, 0, 0, 0, 9029, 0, 24639, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24607, 20486, 16421, 24632, 0, 0, 0, 0, 0, 0, 20486, 0, 0, 0, 0,
+    0, 32831, 0, 0, 0, 20486, 9029, 0, 0, 0, 0, 0, 0, 0, 0, 24592,
+    0, 0, 0, 0, 12472, 0, 0, 24634, 0, 0, 0, 24584, 32840, 0, 32840, 0,
+    12464, 0, 0, 0, 0, 0, 24584, 0, 0, 0, 32840, 0, 0, 12560, 0, 0,
+    0, 0, 0, 0, 32840, 0, 0, 0, 0, 0, 0, 0, 0, 32831, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32840,
+    12568, 0, 12568, 32804, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12568, 0, 0, 0, 32840, 0, 32840, 0, 0, 12515, 0, 0, 0,
+    0, 0, 0, 24639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 32840, 0, 0, 0, 0, 0, 12516, 0, 12569, 12572, 0, 0, 12572, 0, 8986,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 12571, 12524, 0, 0, 0, 0, 12512,
+    0, 0, 0, 0, 12573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12573, 0,
+    0, 12568, 12573, 0, 0, 0, 12574, 0, 12574, 0, 0, 0, 24624, 0, 0, 0,
+    12574, 0, 0, 0, 0, 0, 0, 0, 0, 12568, 0, 12568, 0, 12572, 0, 0,
+    12574, 0, 0, 0, 0, 0, 0, 24592, 0, 0, 0, 0, 0, 0, 0, 0,
+    24631, 0, 0, 0, 0, 12574, 0, 0, 32840, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 12574, 0, 0, 0, 0, 24643, 0, 0, 0, 0, 0, 0,
+    0, 24643, 0, 0, 0, 12575, 0, 32777, 0, 12575, 0, 32839, 0, 0, 0, 24641,
+    16688, 0, 0, 16691, 0, 0, 0, 0, 0, 0, 0, 12575, 12520, 0, 0, 0,
+    9004, 0, 0, 0, 0, 0, 24644, 24641, 0, 0, 24642, 0, 16694, 0, 32840, 24643,
+    0, 0, 24644, 0, 0, 0, 0, 0, 24642, 0, 32840, 24616, 0, 0, 0, 16696,
+    24643, 0, 0, 0, 24643, 0, 0, 0, 12573, 0, 0, 0, 24642, 0, 16421, 0,
+    24644, 0, 0, 0, 0, 24645, 0, 0, 0, 0, 24644, 0, 0, 0, 0, 0,
+    0, 24643, 24644, 0, 24644, 0, 16700, 24645, 0, 0, 0, 24642, 12576, 0, 0, 0,
+    0, 12575, 12532, 16695, 24645, 0, 0, 16701, 12576, 0, 0, 12576, 0, 0, 0, 0,
+    0, 24600, 0, 0, 0, 0, 0, 0, 24644, 0, 0, 0, 24645, 0, 0, 16702,
+    0, 0, 0, 0, 24642, 0, 0, 0, 0, 0, 12576, 0, 0, 0, 0, 0,
+    0, 0, 16698, 0, 0, 12574, 0, 0, 24645, 0, 0, 24642, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24645, 0, 0,
+    0, 0, 0, 0, 12571, 0, 0, 0, 24642, 12576, 0, 24646, 0, 0, 0, 24646,
+    24645, 0, 0, 0, 0, 24642, 0, 0, 0, 24646, 0, 24646, 16701, 0, 0, 0,
+    24641, 16706, 16705, 24643, 0, 0, 0, 0, 0, 0, 0, 0, 24642, 0, 0, 12576,
+    24643, 0, 0, 0, 16707, 16707, 0, 24646, 0, 0, 0, 0, 24646, 0, 0, 0,
+    0, 0, 0, 24644, 0, 0, 0, 0, 0, 24646, 0, 24641, 16708, 0, 0, 0,
+    0, 0, 0, 0, 0, 16708, 24644, 0, 0, 0, 24644, 0, 0, 24641, 16708, 24599,
+    24644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 32840, 0, 0, 0, 0, 0, 0, 16685,
+    12464, 0, 0, 0, 0, 16709, 0, 0, 0, 0, 0, 0, 24643, 0, 0, 0,
+    0, 12576, 24645, 0, 24642, 0, 24643, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24641, 0, 0, 0,
+    0, 0, 0, 0, 0, 16709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12576,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24640, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24646, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24647, 24646, 0, 0, 0, 0, 0, 0, 0, 24646, 0, 0, 0, 24647, 24640,
+    0, 0, 0, 0, 24647, 0, 0, 0, 0, 0, 0, 24642, 0, 0, 0, 0,
+    24646, 0, 0, 0, 0, 0, 0, 0, 0, 24647, 0, 0, 0, 0, 0, 0,
+    24647, 0, 0, 0, 24647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16713,
+    24647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24641, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16714, 0, 0, 0, 24640,
+    0, 24647, 0, 0, 0, 24632, 0, 0, 16715, 0, 0, 0, 0, 0, 0, 0,
+    24578, 16385, 24645, 4102, 0, 4100, 24593, 16388, 8382, 0, 24577, 16460, 8289, 24578, 0, 24586,
+    16423, 24585, 0, 16715, 4106, 32790, 32779, 32780, 16391, 16390, 0, 0, 0, 8291, 24577, 4112,
+    0, 0, 0, 24593, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24578, 16715,
+    16392, 24579, 24641, 32791, 4116, 4118, 16716, 32789, 24594, 24603, 12323, 24577, 8384, 16497, 16394, 24579,
+    0, 32791, 0, 8477, 12544, 16716, 0, 0, 0, 0, 0, 8390, 0, 24579, 0, 24640,
+    0, 24647, 0, 0, 0, 20482, 0, 0, 0, 0, 32797, 0, 0, 24580, 0, 24596,
+    0, 8568, 16430, 0, 16716, 0, 16716, 16696, 0, 24587, 20482, 0, 8208, 20482, 24641, 12307,
+    32792, 4130, 24647, 4132, 32774, 20482, 0, 16433, 0, 8303, 8211, 32774, 4122, 32792, 12293, 24595,
+    24647, 24603, 24580, 32792, 32800, 0, 32800, 8570, 4136, 8305, 24611, 16683, 12309, 0, 8485, 24593,
+    0, 12309, 12301, 24586, 12317, 24610, 8214, 16716, 0, 32783, 24646, 32774, 12363, 8215, 16541, 24611,
+    24601, 24603, 20482, 32792, 0, 16716, 32831, 24610, 16510, 32792, 16507, 24601, 20482, 8404, 24602, 12364,
+    24612, 24609, 0, 20482, 32801, 24612, 8396, 20483, 0, 24594, 32801, 0, 24595, 12317, 24640, 0,
+    16717, 8217, 0, 32783, 12325, 24596, 24612, 20483, 12355, 12357, 20483, 32809, 24587, 16436, 0, 16717,
+    32792, 32807, 12325, 12386, 0, 12293, 0, 20483, 0, 24602, 8398, 0, 24597, 24610, 20483, 20483,
+    12301, 8213, 32808, 24597, 24581, 12301, 16401, 32801, 16474, 16437, 12365, 8496, 12365, 4161, 4163, 8311,
+    8659, 16403, 12378, 16504, 16547, 12380, 16439, 16546, 8483, 32801, 12356, 24589, 12396, 24610, 12341, 4167,
+    16404, 24602, 24577, 8679, 8671, 24586, 24610, 24611, 8317, 8408, 0, 0, 24646, 0, 12348, 24605,
+    12395, 24581, 0, 16405, 24581, 8315, 24595, 12341, 16404, 20483, 8674, 8414, 4177, 16717, 24612, 24594,
+    12334, 8501, 24603, 8682, 16515, 32810, 12389, 16513, 24612, 12326, 16405, 20482, 8415, 12404, 12402, 0,
+    24611, 0, 8403, 12404, 12331, 0, 12403, 24587, 32792, 8683, 24611, 8508, 32793, 12333, 16576, 24619,
+    0, 12387, 24619, 16405, 24618, 4142, 16717, 0, 16441, 16548, 12405, 24619, 16480, 4179, 24618, 20482,
+    24601, 12405, 12405, 8599, 16405, 4191, 32775, 0, 20482, 24618, 24617, 24613, 0, 12397, 12381, 24603,
+    12350, 0, 32784, 24620, 8419, 24620, 24586, 24619, 4203, 24620, 12310, 16584, 0, 32774, 0, 12366,
+    24619, 12366, 24617, 24580, 32793, 24618, 24620, 0, 24595, 24617, 8233, 24594, 32801, 16480, 20482, 0,
+    24617, 16553, 0, 32783, 32783, 16585, 0, 0, 16502, 32810, 16480, 8596, 24579, 24589, 12394, 20484,
+    0, 20484, 20484, 0, 24621, 8234, 24620, 8507, 24588, 0, 24621, 0, 8511, 0, 0, 0,
+    12318, 32815, 16581, 32817, 12294, 8327, 16580, 0, 20484, 24580, 32816, 16538, 32793, 24604, 12334, 32811,
+    8604, 16712, 12350, 32818, 32810, 12293, 12318, 24595, 24588, 8234, 24621, 16473, 24609, 4206, 0, 0,
+    20484, 12382, 24621, 24609, 16395, 24621, 32799, 0, 8475, 12396, 12358, 8694, 16570, 24587, 16717, 24582,
+    24604, 8299, 32802, 8512, 8606, 12419, 12366, 32819, 12350, 24621, 32819, 16554, 24648, 12341, 32810, 12398,
+    24648, 32819, 24582, 8696, 12428, 0, 12390, 8698, 24610, 24582, 0, 24590, 12382, 12349, 0, 24582,
+    12365, 24621, 12420, 0, 0, 0, 24594, 12435, 8754, 32810, 24609, 20484, 24648, 24598, 16536, 12429,
+    8605, 16552, 0, 24648, 8513, 24643, 0, 16443, 12398, 24648, 16517, 0, 32840, 8665, 4146, 0,
+    24618, 32794, 20482, 4214, 8237, 8765, 16554, 20483, 8699, 24612, 24582, 24590, 24619, 24617, 32794, 32811,
+    0, 16589, 0, 24582, 12437, 16443, 24618, 24585, 16517, 0, 24617, 0, 16551, 32794, 16484, 16590,
+    24598, 0, 0, 16478, 24617, 0, 8321, 24586, 24606, 12445, 8774, 4220, 12349, 0, 16443, 32794,
+    12422, 12414, 8520, 12335, 12414, 24598, 24620, 12430, 12294, 12357, 8787, 16590, 32842, 16591, 0, 16591,
+    12443, 8489, 16485, 24601, 24602, 12444, 0, 24580, 0, 8297, 12422, 12438, 8338, 32843, 32844, 0,
+    12438, 8431, 16479, 24603, 32845, 24614, 0, 32803, 24585, 12335, 24614, 32794, 8524, 32794, 12359, 12319,
+    32803, 0, 24594, 12414, 24620, 32785, 12327, 12359, 24601, 32845, 32846, 0, 16586, 16522, 24588, 16522,
+    8617, 32785, 24596, 12430, 32820, 32776, 20484, 24590, 0, 24621, 12351, 12438, 12446, 32820, 24647, 0,
+    8245, 32803, 24596, 12367, 0, 4259, 8792, 32820, 32783, 12367, 8784, 24611, 24609, 24585, 32845, 8335,
+    16558, 12452, 12343, 12451, 16449, 24610, 8528, 0, 12367, 24609, 12319, 24604, 32845, 16486, 16559, 24621,
+    12453, 24627, 12437, 24609, 32847, 12453, 8613, 24627, 16449, 12446, 32803, 4268, 32785, 16412, 8616, 24648,
+    20483, 8790, 12450, 12347, 12350, 24612, 32846, 8343, 12311, 4230, 16559, 24604, 32812, 8529, 32812, 12414,
+    12453, 24614, 32782, 24588, 12310, 24580, 0, 8529, 12414, 8435, 16521, 8527, 12319, 16621, 16483, 8791,
+    12302, 24648, 32847, 24597, 0, 12319, 0, 4242, 8622, 0, 8514, 0, 8620, 16523, 16622, 8503,
+    12383, 12303, 32811, 32812, 12367, 12454, 12446, 32794, 16395, 8710, 24580, 16555, 0, 24577, 0, 12391,
+    0, 24622, 4271, 16560, 12375, 8587, 24622, 16617, 12399, 24629, 16487, 0, 16560, 8440, 0, 8714,
+    24622, 4211, 24628, 12359, 12391, 8347, 16560, 8713, 32846, 12375, 32784, 24629, 32847, 12335, 24589, 0,
+    20483, 12383, 8533, 32794, 24626, 8715, 24627, 20483, 8254, 12311, 8343, 12391, 24589, 12311, 24601, 24622,
+    16487, 8255, 32848, 8327, 12319, 24594, 24618, 8704, 32848, 4296, 32785, 12399, 32848, 12407, 16487, 20482,
+    24578, 24628, 12407, 24594, 12375, 12319, 24625, 32785, 8348, 32803, 16593, 24606, 24582, 32776, 8534, 12399,
+    16595, 12407, 12343, 24618, 32847, 24586, 12335, 8427, 24628, 12342, 8441, 8626, 16596, 12359, 16450, 0,
+    32775, 16524, 12391, 16596, 8627, 12343, 12343, 24585, 16523, 4254, 8627, 24627, 12327, 16450, 24625, 24620,
+    12422, 16628, 24613, 32848, 4305, 4307, 24613, 16597, 16487, 8236, 24629, 12358, 24620, 4302, 8582, 16627,
+    16561, 8349, 8244, 4152, 12335, 16561, 8420, 0, 8535, 8410, 16450, 16413, 24619, 4295, 4250, 24610,
+    24622, 4311, 24582, 8442, 24629, 8521, 32844, 0, 32785, 24629, 12367, 12295, 4300, 32826, 20485, 32825,
+    16612, 32843, 24605, 12349, 32827, 24621, 12388, 24613, 32844, 0, 4226, 8349, 16610, 24630, 32812, 24579,
+    12422, 32821, 12358, 12399, 32811, 32812, 32821, 24613, 12351, 8628, 8442, 16524, 24601, 24580, 24578, 8628,
+    16487, 32848, 0, 8574, 8693, 8719, 0, 12454, 16524, 24579, 12383, 24588, 20485, 32828, 12421, 24617,
+    32774, 32828, 0, 24581, 32781, 24580, 24581, 24589, 12391, 32794, 0, 24630, 16511, 8720, 24622, 32821,
+    24597, 12430, 16465, 24620, 12383, 8720, 24617, 12317, 8707, 0, 12383, 24627, 24606, 12431, 12452, 4240,
+    12399, 8802, 12415, 12375, 8799, 32821, 12341, 12429, 8760, 0, 32828, 32829, 24597, 24630, 24598, 0,
+    24627, 24593, 12439, 24598, 12431, 24603, 0, 12415, 8584, 12351, 8234, 16476, 16554, 32829, 0, 8437,
+    8497, 24648, 16516, 32821, 16428, 0, 32829, 16524, 12439, 12439, 12415, 8808, 32821, 24606, 32829, 0,
+    24590, 8328, 8808, 32794, 16627, 12303, 0, 8218, 32848, 0, 32829, 0, 16620, 32845, 20484, 12439,
+    24628, 16598, 8421, 12407, 0, 0, 32829, 12447, 32848, 12439, 0, 8255, 12447, 0, 32788, 24596,
+    12383, 8756, 20485, 8812, 8718, 24591, 24582, 12447, 24614, 32829, 8690, 32785, 0, 12484, 0, 8769,
+    8534, 12423, 12484, 8721, 8813, 8218, 8239, 12483, 16442, 12406, 8779, 16598, 32776, 24612, 4183, 4224,
+    12327, 12475, 32829, 12295, 32793, 0, 0, 24607, 8869, 24590, 12466, 12375, 32849, 24587, 4286, 0,
+    8814, 32849, 24579, 8868, 0, 24583, 12485, 0, 32803, 24583, 12468, 0, 24614, 0, 32821, 8814,
+    12422, 8392, 20485, 8621, 12482, 8344, 0, 0, 32784, 24625, 32794, 0, 32776, 12302, 24602, 16448,
+    24599, 8876, 0, 16414, 12491, 24626, 12478, 12493, 32803, 24591, 12447, 16450, 8428, 8441, 32782, 24594,
+    8880, 32785, 24577, 32795, 12493, 32821, 12415, 32795, 24593, 16452, 32785, 12311, 32801, 12470, 12455, 24591,
+    24615, 4321, 8322, 12490, 12478, 12486, 8436, 8252, 4315, 8881, 12462, 12486, 12455, 24625, 8884, 24598,
+    12469, 24603, 16417, 20481, 32786, 12303, 8353, 12462, 24607, 32829, 12455, 12462, 16413, 8355, 4317, 12470,
+    32849, 24629, 16412, 32811, 8804, 16633, 8253, 16633, 16418, 24595, 32812, 8885, 16418, 4330, 12486, 0,
+    12486, 24578, 8453, 24628, 32804, 24626, 12295, 8546, 12494, 12399, 8241, 16634, 12494, 24590, 16628, 24596,
+    4208, 4336, 4332, 0, 24599, 12360, 8885, 12499, 24626, 32786, 24583, 24625, 12486, 24593, 12304, 24588,
+    16418, 24587, 32795, 12478, 12462, 12501, 32824, 24594, 32785, 8255, 20481, 16417, 32849, 16447, 32795, 32844,
+    24606, 8310, 24622, 24583, 16470, 12360, 32786, 16526, 8360, 16486, 24629, 8637, 0, 0, 12368, 12368,
+    12296, 12494, 20482, 24595, 24615, 16635, 8865, 16629, 12502, 12304, 0, 12328, 0, 16493, 12336, 12487,
+    16566, 8491, 24587, 12502, 0, 24648, 12494, 8365, 16635, 12352, 12479, 32849, 0, 16455, 24602, 0,
+    8851, 12492, 4364, 16635, 8446, 12471, 0, 8901, 24629, 8272, 24627, 8272, 32804, 8233, 32786, 0,
+    12320, 0, 8901, 0, 8551, 16493, 16530, 12462, 32813, 0, 8855, 24627, 8642, 8900, 32813, 0,
+    24623, 8643, 8452, 12392, 8363, 12427, 24602, 24623, 8550, 24588, 8845, 12487, 8644, 24623, 12463, 0,
+    12455, 0, 0, 0, 16412, 24581, 12352, 12327, 12463, 24623, 24581, 20481, 4265, 24578, 32846, 12360,
+    32813, 8732, 16634, 12368, 12352, 24578, 32845, 16420, 8906, 24602, 16567, 12463, 16530, 16529, 12384, 8906,
+    8457, 24615, 16448, 24596, 24585, 8734, 32848, 8462, 24581, 16567, 24587, 12446, 8907, 16416, 20481, 12479,
+    12312, 32830, 24577, 32830, 4236, 12495, 24623, 8803, 8272, 0, 0, 32830, 0, 16493, 8736, 8326,
+    4377, 16420, 24630, 0, 24626, 16457, 8370, 8554, 8669, 12400, 4391, 32830, 8232, 20482, 20481, 24579,
+    12408, 12423, 8737, 12384, 8463, 8370, 0, 12415, 32821, 8731, 8737, 24625, 8556, 24617, 8896, 16456,
+    32830, 16602, 8556, 16485, 16599, 8549, 32806, 24602, 8647, 8271, 24630, 24580, 4386, 24617, 24617, 32830,
+    12304, 16531, 16494, 12503, 16603, 8278, 8649, 8464, 12487, 12503, 12508, 24580, 12320, 32821, 8371, 12508,
+    0, 24620, 16457, 0, 12507, 8464, 16531, 4404, 8278, 16604, 0, 16615, 0, 24619, 16604, 24596,
+    12509, 32775, 8278, 0, 12296, 12320, 0, 16603, 12303, 16568, 24613, 8860, 8557, 4408, 8557, 24618,
+    4401, 12509, 24587, 16567, 16568, 4407, 24626, 12471, 12510, 0, 32811, 8371, 16457, 32777, 8464, 12326,
+    12390, 4398, 4409, 32813, 32802, 20484, 32830, 24621, 8278, 0, 0, 12506, 4371, 32802, 0, 8545,
+    24618, 4277, 8371, 32802, 12400, 8458, 24620, 0, 24633, 16494, 8557, 32822, 32822, 0, 24595, 12344,
+    24609, 12344, 24579, 24634, 32798, 24586, 12510, 32822, 8650, 0, 8436, 16654, 0, 12392, 8650, 24634,
+    24602, 24581, 24611, 4148, 12511, 12384, 24623, 4361, 12511, 24636, 8650, 0, 0, 8371, 0, 0,
+    8742, 12432, 12511, 24621, 12511, 12509, 24635, 24582, 24636, 0, 0, 24635, 32812, 16658, 12424, 24634,
+    16492, 8741, 24634, 12392, 16659, 8743, 32849, 8334, 20481, 16659, 16450, 8739, 12400, 12357, 24604, 24635,
+    12511, 16420, 0, 12333, 20483, 12511, 12440, 16568, 24634, 16565, 24635, 4283, 24636, 24582, 20482, 0,
+    32830, 0, 12511, 24637, 24636, 24606, 16467, 0, 0, 16648, 0, 0, 12455, 8742, 24577, 24590,
+    16663, 20485, 24637, 24635, 32795, 0, 24614, 24634, 16634, 12408, 12304, 8342, 8325, 16494, 0, 16605,
+    0, 0, 24609, 16664, 16605, 0, 8594, 24637, 12312, 24618, 24582, 0, 8892, 32777, 12304, 8857,
+    16517, 24636, 12495, 24636, 12448, 4356, 32774, 32840, 12432, 16665, 12448, 16664, 16458, 8375, 24631, 8834,
+    8561, 12424, 32795, 12352, 24590, 24637, 8835, 12320, 4431, 8907, 0, 8835, 12312, 16605, 24601, 4410,
+    24620, 8830, 16495, 20483, 12336, 8283, 32786, 16532, 24593, 16532, 12424, 16458, 24598, 16494, 12440, 24637,
+    32804, 4422, 16520, 8376, 24606, 12416, 16458, 0, 24637, 0, 4388, 24648, 32803, 8562, 24631, 4434,
+    12344, 8651, 0, 24638, 8836, 8654, 24591, 32804, 24638, 12328, 12352, 0, 0, 24638, 16495, 8468,
+    0, 16532, 4435, 8655, 8470, 12344, 4416, 0, 8655, 8836, 12407, 12503, 24635, 32846, 16669, 16458,
+    4444, 8470, 24634, 20481, 20481, 24606, 24634, 16495, 8230, 12368, 0, 12456, 24633, 0, 16569, 16670,
+    8377, 24638, 8341, 16569, 12500, 24634, 24631, 12448, 24610, 24586, 4263, 8563, 16628, 0, 20481, 4173,
+    12336, 8723, 24588, 8818, 24625, 16532, 32777, 24633, 8898, 8563, 16661, 12511, 24630, 4451, 8811, 16671,
+    0, 8836, 8469, 12511, 24636, 12436, 8558, 24638, 24626, 12476, 12456, 4420, 32813, 8469, 0, 24612,
+    24578, 24638, 4193, 8377, 12328, 0, 0, 0, 24638, 24631, 12360, 8702, 8418, 16641, 24638, 12296,
+    24638, 8376, 0, 24637, 12376, 16671, 8268, 0, 16639, 8369, 4449, 0, 8656, 0, 0, 0,
+    16641, 16672, 24577, 24589, 16651, 12502, 8746, 24634, 32795, 12384, 8539, 32784, 24635, 8285, 4458, 8471,
+    0, 0, 8656, 24622, 12312, 8656, 16641, 16458, 16530, 24636, 0, 8748, 8747, 24630, 4462, 32786,
+    8471, 0, 12295, 0, 24633, 12376, 8285, 8378, 12400, 24625, 16456, 24637, 16458, 8749, 0, 16672,
+    8879, 16642, 16495, 8564, 8749, 8749, 4463, 8271, 8285, 4281, 32830, 4466, 8905, 8463, 8895, 24605,
+    8748, 8551, 12336, 8378, 0, 24633, 0, 24623, 16532, 8285, 24622, 24603, 24619, 12392, 0, 0,
+    16495, 24597, 4467, 4197, 4467, 16642, 8634, 16642, 24619, 8458, 0, 12408, 16606, 16446, 0, 8285,
+    0, 16458, 16605, 16564, 8657, 0, 24635, 24638, 12470, 8657, 8272, 24634, 0, 0, 12352, 8282,
+    8555, 0, 4471, 4396, 8793, 0, 0, 0, 4470, 16632, 4461, 24639, 12448, 0, 0, 24639,
+    0, 8623, 24625, 4472, 0, 12415, 12416, 16657, 24581, 0, 16606, 8781, 0, 16642, 24639, 24622,
+    8564, 24630, 16569, 8368, 0, 8648, 0, 0, 24636, 0, 32830, 0, 32812, 0, 0, 24638,
+    12471, 24579, 24579, 32831, 0, 0, 16532, 8280, 20486, 8829, 8461, 20484, 24583, 24639, 0, 24639,
+    8870, 20486, 32849, 24622, 8372, 0, 0, 16625, 8657, 0, 24626, 32776, 0, 12384, 32831, 16668,
+    0, 0, 12368, 0, 32822, 32835, 24637, 0, 0, 32813, 12430, 32812, 32833, 0, 12408, 12360,
+    0, 8657, 12328, 24581, 32821, 0, 0, 24611, 12376, 20486, 32831, 0, 32836, 0, 8750, 24604,
+    24639, 16569, 0, 24639, 24628, 16579, 16568, 0, 16605, 8833, 0, 8750, 24586, 16421, 24639, 0,
+    12416, 8771, 32837, 0, 12455, 8840, 0, 12471, 24622, 16591, 0, 8750, 0, 0, 32837, 0,
+    0, 24630, 12383, 12416, 0, 24623, 32837, 8841, 32776, 0, 16421, 8254, 20486, 32776, 24611, 32831,
+    12416, 32831, 0, 32776, 24593, 0, 0, 24637, 0, 0, 8365, 12440, 8842, 8837, 32840, 8842,
+    24604, 8887, 0, 8728, 12447, 12424, 12462, 24628, 12448, 0, 32812, 0, 24605, 4344, 0, 0,
+    32838, 32838, 16561, 24633, 0, 24648, 32838, 0, 0, 0, 0, 12391, 8902, 0, 24648, 32777,
+    0, 16606, 32831, 0, 32785, 0, 20486, 24648, 12448, 0, 0, 12447, 32803, 0, 12391, 8530,
+    12343, 32838, 8917, 24615, 8843, 24639, 16626, 16412, 0, 32834, 16604, 12488, 12295, 12421, 8842, 12296,
+    8843, 32838, 0, 0, 0, 0, 0, 16569, 8843, 12478, 20484, 32838, 8448, 4346, 0, 0,
+    32838, 12432, 12472, 8909, 24578, 24635, 8923, 16561, 32812, 16642, 0, 8807, 8685, 0, 0, 24633,
+    24614, 32822, 0, 8923, 0, 8920, 24619, 24583, 8607, 12488, 12431, 8359, 4248, 8918, 12375, 24639,
+    16646, 8243, 0, 12432, 0, 8841, 12496, 8842, 8820, 0, 20485, 4292, 0, 32838, 8924, 12464,
+    32777, 24621, 16640, 8927, 8434, 0, 24583, 16531, 32839, 24584, 12472, 24600, 32822, 8348, 8562, 12531,
+    8928, 16495, 12464, 12492, 16670, 24635, 8940, 0, 12494, 8946, 8928, 0, 0, 32839, 0, 12479,
+    24615, 24584, 32848, 12456, 0, 32821, 4350, 0, 20484, 0, 0, 8929, 24584, 12456, 0, 32777,
+    12488, 16643, 12456, 24598, 12480, 0, 16643, 12432, 24600, 12533, 24583, 8281, 24595, 32803, 0, 12479,
+    0, 24626, 0, 20481, 0, 12472, 16568, 12539, 32849, 20485, 0, 8541, 12525, 8929, 8960, 12533,
+    0, 12525, 0, 24584, 24585, 8955, 0, 4359, 0, 12496, 24583, 24628, 0, 24584, 16643, 12541,
+    0, 0, 8270, 0, 0, 24584, 0, 32838, 12320, 0, 0, 24603, 24648, 0, 0, 12504,
+    24600, 16643, 12534, 0, 24592, 24608, 0, 24639, 12504, 12549, 12532, 12548, 24635, 8965, 0, 0,
+    12464, 12480, 8914, 0, 8933, 0, 12518, 0, 8973, 0, 0, 24615, 0, 0, 32839, 0,
+    12518, 0, 0, 0, 12494, 24604, 24629, 8278, 12447, 12542, 8934, 8364, 12542, 16643, 0, 12488,
+    0, 20485, 12542, 24616, 0, 32848, 0, 32839, 8935, 12480, 0, 20482, 8934, 8976, 0, 0,
+    8978, 12541, 0, 24600, 12440, 0, 0, 0, 0, 12534, 0, 0, 12504, 24616, 8471, 0,
+    24599, 0, 0, 16420, 0, 12542, 24608, 0, 0, 16489, 0, 0, 12550, 20483, 0, 0,
+    0, 24623, 12526, 12550, 0, 12534, 12556, 12554, 0, 0, 12542, 0, 0, 12550, 12496, 24623,
+    0, 8936, 12477, 12494, 0, 0, 0, 0, 24623, 8828, 20484, 12555, 8936, 12557, 24600, 8977,
+    0, 12535, 12556, 24608, 0, 8922, 0, 12360, 0, 12472, 12526, 12534, 12557, 0, 8987, 8632,
+    8283, 12527, 20481, 12518, 12558, 0, 4425, 12535, 24592, 0, 0, 0, 8285, 16420, 0, 20486,
+    0, 12424, 16531, 16421, 32831, 32803, 0, 0, 8283, 0, 0, 24584, 0, 12543, 0, 24616,
+    0, 0, 16638, 0, 0, 0, 0, 12480, 8992, 8936, 0, 0, 8994, 0, 0, 0,
+    24608, 0, 12550, 0, 0, 0, 12488, 0, 12472, 4450, 12432, 0, 0, 8993, 12440, 24624,
+    0, 8984, 0, 12526, 0, 24636, 0, 12558, 20486, 0, 0, 24624, 0, 0, 24624, 24616,
+    12551, 0, 12519, 0, 24600, 8564, 8936, 0, 0, 12551, 0, 0, 12557, 12512, 24616, 12527,
+    12535, 24592, 0, 8998, 0, 0, 0, 8999, 0, 12488, 4439, 8999, 8997, 0, 24616, 12535,
+    0, 24624, 12296, 12344, 0, 0, 24584, 8967, 12527, 0, 0, 24624, 0, 12543, 8931, 0,
+    9000, 12519, 0, 0, 0, 0, 0, 9000, 0, 0, 16495, 12512, 0, 0, 0, 0,
+    0, 0, 0, 9000, 8456, 12474, 12431, 0, 4441, 0, 0, 24624, 0, 12551, 0, 0,
+    0, 4452, 0, 24608, 0, 0, 0, 0, 20481, 0, 0, 16676, 0, 0, 12399, 0,
+    24584, 0, 12551, 24635, 4310, 24634, 16675, 24605, 8957, 16677, 12559, 0, 24633, 0, 0, 16677,
+    12551, 0, 0, 0, 8465, 12512, 0, 0, 12423, 12551, 0, 8970, 0, 0, 24624, 0,
+    20485, 0, 0, 0, 24633, 24634, 0, 0, 24635, 0, 16678, 0, 0, 0, 0, 24636,
+    0, 32786, 12565, 0, 24627, 0, 0, 16678, 0, 0, 24636, 0, 32831, 16456, 24592, 12559,
+    0, 8929, 12543, 24583, 0, 8378, 0, 0, 24592, 24624, 0, 0, 0, 20486, 24634, 0,
+    0, 0, 24637, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16679, 0,
+    12566, 0, 0, 0, 0, 0, 24635, 32795, 12566, 0, 32777, 12520, 0, 0, 24637, 12520,
+    24637, 0, 24624, 0, 0, 12536, 12564, 0, 0, 12472, 9011, 0, 0, 0, 0, 24592,
+    0, 0, 0, 0, 9001, 0, 12567, 32786, 4373, 0, 24592, 0, 12567, 12480, 0, 0,
+    0, 12536, 0, 0, 0, 12520, 0, 0, 0, 12567, 0, 0, 12536, 0, 12528, 16679,
+    24584, 24583, 0, 12544, 24624, 24608, 12544, 0, 12536, 0, 0, 12528, 0, 0, 9012, 0,
+    12563, 9016, 9016, 0, 12567, 9015, 12544, 0, 12518, 0, 24631, 12518, 0, 0, 0, 0,
+    12520, 0, 12520, 12552, 24600, 0, 24638, 0, 0, 24592, 0, 0, 12528, 12552, 0, 0,
+    12567, 24608, 12567, 0, 12552, 0, 12552, 0, 0, 0, 16680, 0, 9020, 0, 9019, 0,
+    0, 12566, 24633, 9021, 0, 16680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24616, 12552, 12552, 24638, 0, 0, 0, 0, 16457, 0, 0, 0, 0, 16680, 0,
+    12552, 12567, 0, 0, 24632, 0, 0, 0, 0, 0, 0, 24608, 9022, 32804, 0, 12424,
+    9022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16680,
+    12544, 0, 0, 32813, 16680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24600,
+    0, 24631, 0, 0, 0, 0, 0, 0, 0, 9022, 12560, 0, 0, 0, 0, 0,
+    0, 0, 16680, 0, 0, 0, 0, 0, 0, 0, 16532, 12520, 12560, 9023, 0, 0,
+    9026, 0, 24584, 0, 0, 12560, 24624, 0, 12528, 0, 0, 0, 0, 12560, 8982, 9027,
+    0, 0, 0, 0, 0, 9027, 0, 12547, 0, 12560, 0, 0, 0, 0, 32804, 0,
+    0, 0, 0, 0, 0, 12560, 0, 0, 0, 9028, 0, 12526, 0, 0, 9028, 0,
+    0, 24632, 12520, 12520, 12536, 0, 24632, 32804, 12560, 12544, 12534, 0, 0, 0, 12528, 0,
+    0, 0, 0, 12526, 0, 0, 0, 0, 0, 0, 8823, 0, 0, 0, 0, 0,
+    0, 24624, 0, 0, 0, 0, 32804, 12552, 9028, 0, 12527, 0, 0, 0, 0, 0,
+    0, 0, 0, 9029, 0, 0, 0, 0, 9029, 0, 0, 0, 24638, 0, 0, 0,
+    0, 0, 9010, 0, 0, 0, 9029, 0, 0, 24639, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 24616, 0, 0, 0, 0, 0, 0, 0, 12480, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 12544, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 24639, 0, 0, 32822, 0, 0, 0, 0, 0, 0, 0,
+    0, 12544, 0, 0, 0, 0, 0, 0, 32840, 0, 32840, 0, 12560, 0, 0, 0,
+    0, 9007, 0, 0, 0, 12560, 0, 0, 0, 0, 0, 32840, 0, 0, 0, 12560,
+    0, 0, 0, 0, 0, 12568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24584, 24584, 0, 0, 0, 12568, 0, 0, 0, 24632, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12568, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24632, 0, 0, 0,
+    0, 0, 0, 0, 12568, 0, 0, 0, 12570, 32840, 0, 0, 0, 0, 12568, 12572,
+    0, 0, 0, 0, 0, 0, 12572, 0, 0, 0, 0, 0, 0, 0, 12568, 0,
+    0, 32840, 0, 32840, 0, 0, 0, 0, 0, 0, 0, 12573, 0, 12568, 0, 0,
+    0, 0, 0, 0, 0, 0, 12523, 0, 12574, 0, 0, 0, 0, 12573, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 12571, 0, 0, 0, 0, 0, 0, 0, 12568,
+    0, 0, 0, 0, 0, 0, 12574, 0, 0, 0, 0, 0, 0, 0, 0, 12573,
+    12575, 0, 12575, 0, 0, 0, 0, 0, 0, 0, 12575, 0, 24643, 0, 24643, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12575, 0, 0, 0, 0, 0,
+    0, 0, 0, 20481, 0, 24643, 0, 16686, 0, 0, 0, 0, 0, 0, 0, 12575,
+    0, 0, 0, 24632, 0, 0, 0, 0, 0, 16695, 0, 0, 16689, 24642, 12575, 0,
+    12568, 0, 0, 0, 0, 12524, 0, 0, 0, 0, 0, 24641, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24644, 0, 0, 0,
+    0, 0, 0, 0, 0, 24645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    12536, 24641, 0, 0, 24642, 0, 16699, 0, 24645, 0, 0, 0, 12576, 0, 0, 0,
+    0, 0, 24642, 24645, 0, 12575, 0, 0, 0, 16701, 24643, 0, 0, 0, 24643, 0,
+    0, 0, 0, 0, 0, 0, 24642, 0, 0, 24644, 24644, 0, 0, 0, 24632, 24641,
+    0, 0, 0, 0, 24644, 0, 0, 0, 0, 0, 0, 0, 12576, 0, 24644, 0,
+    0, 16702, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16700, 16702, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 16696, 0, 0, 12520, 16702, 12540, 0, 24646, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 12576, 0, 0, 0, 0, 0, 0, 0, 0, 16706, 0, 12575,
+    0, 0, 24645, 0, 0, 24642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 24646, 0, 16705, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20486, 0, 0, 0, 0, 0, 0, 24645, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16707, 0, 0,
+    16708, 0, 0, 0, 16708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24646, 0, 0, 0, 0, 16708, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 24641, 16709, 0, 0, 0, 0, 0, 0, 0, 0, 16709,
+    0, 0, 0, 0, 0, 0, 0, 0, 16709, 0, 0, 0, 0, 12576, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 16694, 24641, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16709, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 24641, 0, 0, 24640, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 24640, 0, 0, 0, 0, 0, 24640, 0, 0, 24646,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 12576, 0, 0, 0, 0, 0, 0,
+    0, 24640, 0, 0, 0, 0, 0, 0, 24640, 0, 0, 0, 24640, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8942, 0, 0, 0, 24647, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 24640, 0, 0, 0, 0, 0, 0, 0,
+    0, 24647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24646, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 24640, 24641, 0, 0, 0, 0, 24641,
+    0, 16710, 24643, 0, 24642, 0, 0, 0, 0, 0, 24646, 0, 0, 0, 0, 0,
+    0, 0, 16714, 0, 0, 0, 0, 0, 0, 0, 24647, 0, 0, 0, 24647, 0,
+    0, 0, 0, 0, 24641, 0, 0, 0, 24644, 0, 0, 0, 16715, 0, 0, 0,
+    16715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24647, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16713, 0,
+    0, 0, 0, 0, 16714, 0, 0, 0, 0, 0, 0, 0, 24645, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32831, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 16701, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24644, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24643,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 24643, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 24647, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16684,
+};
+
+const uint16_t omp::HandEvaluatorBase::SHORT_DECK_FLUSH_LOOKUP[] {
+    28673, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28677, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28684, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28691, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28692, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28693, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28695, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28696, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28698, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28699, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28701, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28702, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28705, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28707, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28716, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28719, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28721, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28723, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28724, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28727, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28728, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28731, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28733, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28736, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28737, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28738, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28743, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28747, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28748, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28749, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28751, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28757, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28758, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28759, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28765, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28766, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28772, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28773, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28775, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28777, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28781, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28782, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28783, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28784, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28787, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28789, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28789, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28790, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28791, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28792, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28793, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28794, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28795, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28797, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28804, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28805, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28806, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28807, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28809, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28810, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28811, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28812, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28814, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28816, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28821, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28827, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28828, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28829, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28830, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28832, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28833, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28835, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28835, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28836, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28837, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28838, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28841, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28843, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28845, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28845, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28847, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28849, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28851, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28853, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28855, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28856, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28858, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28863, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28877, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28880, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28882, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28882, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28883, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28883, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28883, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28883, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28884, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28885, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28886, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28886, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28889, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28891, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28892, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28893, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28895, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28896, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28897, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28899, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28900, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28902, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28903, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28904, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28907, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28908, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28914, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28916, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28918, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28919, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28920, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28923, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28929, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28930, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28931, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28932, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28933, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28936, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28937, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28939, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28939, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28941, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28948, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28950, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28953, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28954, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28957, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28959, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28964, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28966, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28968, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28968, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28973, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28975, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28981, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28983, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28983, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28987, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28990, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28991, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28992, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28994, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28996, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29002, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29004, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29005, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29006, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29008, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29009, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29010, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29010, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29011, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29011, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29011, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29012, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29013, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29015, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29016, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29017, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29018, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29018, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29019, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29021, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29021, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29025, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29025, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29029, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29030, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29032, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29034, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29034, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29036, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29037, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29037, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29040, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29041, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29041, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29045, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29046, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29046, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36870,
+};
@@ -2,8 +2,8 @@
 #include "HandEvaluator.h"
 
 // Offset table for the perfect hashing algorithm used in the evaluator. Generated by
-// HandEvaluator::calculatePerfectHash().
-uint32_t omp::HandEvaluator::PERF_HASH_ROW_OFFSETS[] {
+// HandEvaluatorT::outputLookupTables().
+const uint32_t omp::FullLookupLayout::PERF_HASH_ROW_OFFSETS[] {
     0x1fb5, 0xfffff000, 0xfffffc09, 0xffffd000, 0xffffd94b, 0xffffb000, 0xffffb919, 0xffff9000,
     0xffffd508, 0xffff7000, 0xffff7835, 0xffff5000, 0xffff5436, 0xffff3000, 0xffff338c, 0xffff1000,
     0xffff5547, 0xffff023c, 0xfffef1e3, 0xfffee12c, 0xfffecfc6, 0xfffebf08, 0xfffea193, 0xfffe9ca1,
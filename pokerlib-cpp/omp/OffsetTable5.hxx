@@ -0,0 +1,1030 @@
+#include "HandEvaluator.h"
+
+// Offset table for the perfect hashing algorithm used in the evaluator (FiveCardLookupLayout, 8191 rows).
+// Generated by HandEvaluatorT::outputLookupTables().
+const uint32_t omp::FiveCardLookupLayout::PERF_HASH_ROW_OFFSETS[] {
+    0x0, 0xfffff000, 0xffffe000, 0xffffd000, 0xffffc000, 0xffffb000, 0xffffa000, 0xffff9000,
+    0xffff8000, 0xffff7000, 0xffff6000, 0xffff5000, 0xffff4000, 0xffff3000, 0xffff2000, 0xffff1000,
+    0xffff0006, 0xfffef000, 0xfffee000, 0xfffed000, 0xfffec000, 0xfffeb000, 0xfffea000, 0xfffe9000,
+    0xfffe8005, 0xfffe7062, 0xfffe6000, 0xfffe5000, 0xfffe4078, 0xfffe3000, 0xfffe2078, 0xfffe1263,
+    0xfffe0004, 0xfffdf061, 0xfffde2db, 0xfffdd000, 0xfffdc2db, 0xfffdb32a, 0xfffda2db, 0xfffd9000,
+    0xfffd800d, 0xfffd7060, 0xfffd6062, 0xfffd53e4, 0xfffd4000, 0xfffd3078, 0xfffd257e, 0xfffd1078,
+    0xfffd000c, 0xfffcf004, 0xfffce061, 0xfffcd004, 0xfffcc60d, 0xfffcb004, 0xfffca60d, 0xfffc9042,
+    0xfffc800b, 0xfffc7042, 0xfffc6105, 0xfffc5062, 0xfffc4105, 0xfffc3642, 0xfffc2105, 0xfffc1041,
+    0xfffc0000, 0xfffbf041, 0xfffbe004, 0xfffbd0ef, 0xfffbc004, 0xfffbb0ef, 0xfffba01f, 0xfffb90ef,
+    0xfffb801f, 0xfffb7000, 0xfffb745e, 0xfffb50ee, 0xfffb46f2, 0xfffb30ee, 0xfffb440f, 0xfffb1000,
+    0xfffb0871, 0xfffaf820, 0xfffae002, 0xfffad004, 0xfffae978, 0xfffab000, 0xfffaca70, 0xfffa984c,
+    0xfffa8078, 0xfffa781f, 0xfffa6447, 0xfffa5003, 0xfffa6db1, 0xfffa38d7, 0xfffa2447, 0xfffa1b07,
+    0xfffa0b8d, 0xfff9f000, 0xfff9e00d, 0xfff9dbe9, 0xfff9c004, 0xfff9bbe9, 0xfff9ac7b, 0xfff99078,
+    0xfff98b8c, 0xfff97000, 0xfff9600c, 0xfff95447, 0xfff94cf0, 0xfff93447, 0xfff92cf0, 0xfff91e88,
+    0xfff90cf0, 0xfff8f042, 0xfff8e000, 0xfff8d042, 0xfff8c105, 0xfff8bec9, 0xfff8a105, 0xfff89ec9,
+    0xfff88000, 0xfff87041, 0xfff86070, 0xfff85000, 0xfff84447, 0xfff830ef, 0xfff82000, 0xfff810ef,
+    0xfff830a5, 0xfff7f000, 0xfff8110a, 0xfff7d000, 0xfff7c003, 0xfff7b0ee, 0xfff7d207, 0xfff79000,
+    0xfff7b207, 0xfff781b0, 0xfff7606e, 0xfff75070, 0xfff74036, 0xfff73004, 0xfff758c0, 0xfff7225e,
+    0xfff70036, 0xfff701af, 0xfff6e000, 0xfff6d06f, 0xfff6c447, 0xfff6b0d9, 0xfff6a447, 0xfff690d9,
+    0xfff69415, 0xfff670d9, 0xfff67415, 0xfff65000, 0xfff64070, 0xfff63036, 0xfff633b1, 0xfff61136,
+    0xfff613b1, 0xfff5f0d8, 0xfff5f3b1, 0xfff5d000, 0xfff5c000, 0xfff5ba0c, 0xfff5b3b0, 0xfff5a24f,
+    0xfff593b0, 0xfff585b4, 0xfff560d9, 0xfff556b3, 0xfff54000, 0xfff53078, 0xfff53bd5, 0xfff533f4,
+    0xfff513af, 0xfff512ec, 0xfff51a77, 0xfff4d7da, 0xfff4e784, 0xfff4b7da, 0xfff4c85b, 0xfff4c17d,
+    0xfff48000, 0xfff4700d, 0xfff4600b, 0xfff450d9, 0xfff4400b, 0xfff4444c, 0xfff45add, 0xfff4267d,
+    0xfff42509, 0xfff42bd3, 0xfff413a7, 0xfff403c2, 0xfff3c7da, 0xfff3e3c2, 0xfff3c487, 0xfff3ce7d,
+    0xfff3a49a, 0xfff389bd, 0xfff36042, 0xfff35105, 0xfff35a58, 0xfff33105, 0xfff34afc, 0xfff31025,
+    0xfff33fdb, 0xfff32546, 0xfff2e28e, 0xfff2d7da, 0xfff2f5e8, 0xfff2b024, 0xfff2a0ef, 0xfff29024,
+    0xfff2828d, 0xfff2b05e, 0xfff2628d, 0xfff250d8, 0xfff240ee, 0xfff27186, 0xfff22000, 0xfff251ba,
+    0xfff236d4, 0xfff2279c, 0xfff1fa94, 0xfff201a2, 0xfff1c0d9, 0xfff1f1fd, 0xfff1a034, 0xfff19078,
+    0xfff18034, 0xfff1728d, 0xfff16965, 0xfff157da, 0xfff17a45, 0xfff137da, 0xfff15ac6, 0xfff12cb4,
+    0xfff120ef, 0xfff1067e, 0xfff1235c, 0xfff0d00d, 0xfff0fe6c, 0xfff0ccd7, 0xfff0a032, 0xfff09034,
+    0xfff09dea, 0xfff0b5cc, 0xfff07dea, 0xfff06e32, 0xfff047da, 0xfff06ff0, 0xfff04099, 0xfff01033,
+    0xfff03294, 0xfff00e31, 0xffefe042, 0xffefee31, 0xffefc000, 0xffefb105, 0xffefc098, 0xffef9000,
+    0xffef8034, 0xffefb446, 0xffef7e32, 0xffef5070, 0xffef5e32, 0xffef30d9, 0xffef20ef, 0xffef5646,
+    0xffef0000, 0xffef36e2, 0xffeefe31, 0xffeed06f, 0xffeec000, 0xffeed0ce, 0xffeea000, 0xffeedaff,
+    0xffeea28f, 0xffee90ce, 0xffee862a, 0xffee6e32, 0xffee4070, 0xffee3036, 0xffee4647, 0xffee1036,
+    0xffee0034, 0xffedf000, 0xffede034, 0xffedd000, 0xffedc000, 0xffedb7da, 0xffedc0ce, 0xffedb69f,
+    0xffed86a2, 0xffed969f, 0xffed60d9, 0xffed769f, 0xffed4000, 0xffed3000, 0xffed4cbb, 0xffed369e,
+    0xffed00a0, 0xffecf034, 0xffece0d8, 0xffecd000, 0xffece726, 0xffecb000, 0xffecc726, 0xffecd4f3,
+    0xffecc642, 0xffec70a1, 0xffec94ea, 0xffec50d9, 0xffec405c, 0xffec5925, 0xffec205c, 0xffec3b45,
+    0xffec023a, 0xffebf2fe, 0xffebe7da, 0xffec16f5, 0xffebc7da, 0xffebf6f5, 0xffebcc08, 0xffebdb03,
+    0xffebac08, 0xffebbcaf, 0xffeb60a1, 0xffeb9867, 0xffeb6c27, 0xffeb305c, 0xffeb4c27, 0xffeb1025,
+    0xffeb5108, 0xffeaf025, 0xffeb0de1, 0xffead7da, 0xffeb0973, 0xffeab9af, 0xffeacc26, 0xffeac56f,
+    0xffeaade0, 0xffea79af, 0xffea6034, 0xffea5000, 0xffea405c, 0xffea39ae, 0xffea2000, 0xffea19ae,
+    0xffea5129, 0xffe9f28e, 0xffe9e0a1, 0xffe9d28e, 0xffe9c0d9, 0xffe9b9ad, 0xffe9f3b2, 0xffe99000,
+    0xffe9d62f, 0xffe9728d, 0xffe960a0, 0xffe95000, 0xffe970db, 0xffe93000, 0xffe976ef, 0xffe94166,
+    0xffe930db, 0xffe92341, 0xffe8e28e, 0xffe8d0a1, 0xffe8c05c, 0xffe8e40d, 0xffe8a05c, 0xffe89034,
+    0xffe88000, 0xffe8c735, 0xffe86000, 0xffe850b2, 0xffe847da, 0xffe88182, 0xffe82bf4, 0xffe81033,
+    0xffe80bf4, 0xffe7f0b1, 0xffe7ebf4, 0xffe7d0b1, 0xffe7f452, 0xffe7b05c, 0xffe7abf3, 0xffe79000,
+    0xffe78034, 0xffe770b0, 0xffe760b2, 0xffe75000, 0xffe74489, 0xffe76503, 0xffe72bf2, 0xffe723f5,
+    0xffe73517, 0xffe6f9af, 0xffe6ea39, 0xffe70607, 0xffe6c073, 0xffe6e502, 0xffe6a013, 0xffe6a3f4,
+    0xffe68444, 0xffe6a676, 0xffe66444, 0xffe650b2, 0xffe64145, 0xffe63129, 0xffe6298f, 0xffe64a1d,
+    0xffe60208, 0xffe62a1d, 0xffe5f691, 0xffe5d073, 0xffe5c144, 0xffe5b000, 0xffe5a98e, 0xffe590c6,
+    0xffe59c8e, 0xffe570c6, 0xffe57c8e, 0xffe56ddd, 0xffe55c8e, 0xffe5303d, 0xffe5205c, 0xffe51da5,
+    0xffe50100, 0xffe4f503, 0xffe4e100, 0xffe4d503, 0xffe4c000, 0xffe4b03c, 0xffe4d6ca, 0xffe4a39e,
+    0xffe480c6, 0xffe479d8, 0xffe482d4, 0xffe45d40, 0xffe497ea, 0xffe46a52, 0xffe47828, 0xffe41013,
+    0xffe400c5, 0xffe3f9d7, 0xffe4397e, 0xffe3d074, 0xffe4199a, 0xffe3e59c, 0xffe3b0be, 0xffe3c6ca,
+    0xffe38733, 0xffe383f5, 0xffe37dab, 0xffe3881a, 0xffe357e6, 0xffe3659b, 0xffe337e6, 0xffe346c9,
+    0xffe30013, 0xffe323a7, 0xffe2e013, 0xffe303a7, 0xffe2df45, 0xffe2cb0c, 0xffe2db99, 0xffe29152,
+    0xffe28b5a, 0xffe278e2, 0xffe2899e, 0xffe25733, 0xffe27bb6, 0xffe23151, 0xffe22144, 0xffe21151,
+    0xffe20011, 0xffe1f013, 0xffe1fc8e, 0xffe1fe48, 0xffe1dc8e, 0xffe1d7d8, 0xffe1a152, 0xffe1903d,
+    0xffe18152, 0xffe17012, 0xffe16100, 0xffe177d7, 0xffe14000, 0xffe157d7, 0xffe1308a, 0xffe14b3b,
+    0xffe1006b, 0xffe0f014, 0xffe112a5, 0xffe0d9d8, 0xffe119c3, 0xffe0eb8f, 0xffe0fa60, 0xffe0ea85,
+    0xffe0806a, 0xffe07013, 0xffe07c4c, 0xffe05000, 0xffe09a97, 0xffe06c94, 0xffe03c4c, 0xffe050f1,
+    0xffe01c4c, 0xffdff06b, 0xffdfee99, 0xffe00bf3, 0xffdfc031, 0xffdff8e5, 0xffdfbc4b, 0xffdfa089,
+    0xffdf8034, 0xffdf7000, 0xffdf6aa9, 0xffdf6c4c, 0xffdf78c9, 0xffdf8223, 0xffdf6a48, 0xffdf1a52,
+    0xffdf38c9, 0xffdef152, 0xffdee0b1, 0xffdf22bf, 0xffdef8c8, 0xffdeed46, 0xffded8c8, 0xffde9a51,
+    0xffde8000, 0xffdead78, 0xffde6000, 0xffde50b2, 0xffde9444, 0xffde424a, 0xffde5d47, 0xffde57ef,
+    0xffde0a52, 0xffde0c6e, 0xffde1ec9, 0xffddd073, 0xffddff10, 0xffddb235, 0xffddfad1, 0xffdd91da,
+    0xffddd4e0, 0xffdd71da, 0xffddb4e0, 0xffdd69e6, 0xffdd9b29, 0xffdd3145, 0xffdd7c2d, 0xffdd22a4,
+    0xffdd5672, 0xffdd29ab, 0xffdcfc6e, 0xffdd09ab, 0xffdcc020, 0xffdd0daa, 0xffdca020, 0xffdca117,
+    0xffdc81da, 0xffdcc814, 0xffdc9e94, 0xffdc6c8e, 0xffdc8ae5, 0xffdc4116, 0xffdc203d, 0xffdc2116,
+    0xffdc0029, 0xffdbf100, 0xffdc1e93, 0xffdbd000, 0xffdbfe93, 0xffdc083b, 0xffdbe129, 0xffdbcd47,
+    0xffdbc129, 0xffdbb708, 0xffdb7e6b, 0xffdbae23, 0xffdb42ef, 0xffdb8fd3, 0xffdb68a1, 0xffdb4d46,
+    0xffdb02ef, 0xffdb2f6e, 0xffdae000, 0xffdb3072, 0xffdb0b53, 0xffdad4e5, 0xffdaec49, 0xffdad993,
+    0xffdabd47, 0xffda8c6e, 0xffda62ed, 0xffda6c6e, 0xffda42ed, 0xffda3e00, 0xffda833b, 0xffda1e00,
+    0xffda0e02, 0xffd9f1da, 0xffda0b3a, 0xffda1c8b, 0xffd9c2ec, 0xffd9fdb7, 0xffd9ae01, 0xffd99145,
+    0xffd98e01, 0xffd97029, 0xffd962eb, 0xffd952ed, 0xffd94000, 0xffd932ed, 0xffd92e00, 0xffd91e02,
+    0xffd90000, 0xffd8fe02, 0xffd8e02a, 0xffd8d2ec, 0xffd8fe94, 0xffd8b000, 0xffd8de94, 0xffd89e01,
+    0xffd88000, 0xffd87000, 0xffd86000, 0xffd85000, 0xffd842ed, 0xffd86f7b, 0xffd8219c, 0xffd8208a,
+    0xffd84c9e, 0xffd7f06b, 0xffd7e19c, 0xffd80fe7, 0xffd7c000, 0xffd81373, 0xffd7a19b, 0xffd7a089,
+    0xffd7819b, 0xffd77000, 0xffd76000, 0xffd76c4c, 0xffd7804b, 0xffd74c4c, 0xffd76ed1, 0xffd7119c,
+    0xffd7108a, 0xffd6f19c, 0xffd6e000, 0xffd6d031, 0xffd6c2ed, 0xffd6b000, 0xffd6a2ed, 0xffd6919b,
+    0xffd68000, 0xffd67000, 0xffd66000, 0xffd650b2, 0xffd69d94, 0xffd668c9, 0xffd6209c, 0xffd648c9,
+    0xffd64f1e, 0xffd5f000, 0xffd620bd, 0xffd5d000, 0xffd600e2, 0xffd5b2ed, 0xffd5a09b, 0xffd59000,
+    0xffd5c1ac, 0xffd57000, 0xffd5a1ac, 0xffd59206, 0xffd581ac, 0xffd570e3, 0xffd52236, 0xffd5109c,
+    0xffd50057, 0xffd532bc, 0xffd4e057, 0xffd512bc, 0xffd4c000, 0xffd513b6, 0xffd4a000, 0xffd4d30f,
+    0xffd4a8ac, 0xffd4cda2, 0xffd4afeb, 0xffd491ac, 0xffd48313, 0xffd4730e, 0xffd46313, 0xffd4530e,
+    0xffd4019b, 0xffd3f057, 0xffd42312, 0xffd3d000, 0xffd40312, 0xffd3b020, 0xffd3e30f, 0xffd39000,
+    0xffd3c30f, 0xffd3719c, 0xffd3a311, 0xffd359aa, 0xffd34000, 0xffd339aa, 0xffd322ed, 0xffd31000,
+    0xffd30000, 0xffd2f000, 0xffd2e000, 0xffd2d9a9, 0xffd303f2, 0xffd2b000, 0xffd2e0e3, 0xffd29289,
+    0xffd2809c, 0xffd27000, 0xffd2a450, 0xffd25000, 0xffd2a46e, 0xffd23000, 0xffd260e2, 0xffd21000,
+    0xffd20000, 0xffd1f000, 0xffd221ac, 0xffd214c8, 0xffd201ac, 0xffd1f4c8, 0xffd1a000, 0xffd1d0e3,
+    0xffd18000, 0xffd17000, 0xffd16057, 0xffd152ed, 0xffd14000, 0xffd132ed, 0xffd12000, 0xffd11e02,
+    0xffd10000, 0xffd0fe02, 0xffd0e19c, 0xffd0d2ec, 0xffd1104c, 0xffd0b000, 0xffd0e313, 0xffd09e01,
+    0xffd0c4e5, 0xffd07000, 0xffd0619b, 0xffd05000, 0xffd0488e, 0xffd03000, 0xffd047c7, 0xffd01000,
+    0xffd027c7, 0xffd034f7, 0xffcfe19a, 0xffcfd19c, 0xffcfc0f4, 0xffcfc3f0, 0xffcfa0f4, 0xffcfd53a,
+    0xffcf80f4, 0xffcfb4f6, 0xffcf6000, 0xffcf519b, 0xffcf68ef, 0xffcf7573, 0xffcf48ef, 0xffcf5573,
+    0xffcf506f, 0xffcf3573, 0xffcf25d1, 0xffced000, 0xffcee581, 0xffceb0f4, 0xffcef080, 0xffce90f4,
+    0xffcec8d3, 0xffce7000, 0xffcea8d3, 0xffce5000, 0xffce6580, 0xffce58ef, 0xffce68d2, 0xffce53d4,
+    0xffce48d2, 0xffcdf11b, 0xffcde000, 0xffcdd11b, 0xffcdc000, 0xffcdb2ed, 0xffcda0f4, 0xffcd911a,
+    0xffcd8000, 0xffcd711a, 0xffcda908, 0xffcd9942, 0xffcd419c, 0xffcd300f, 0xffcd71a6, 0xffcd19d2,
+    0xffcd6592, 0xffcd3a3c, 0xffcd4609, 0xffcd1a3c, 0xffccc19b, 0xffccb00e, 0xffccc9fc, 0xffcc9000,
+    0xffcce6c3, 0xffccc053, 0xffcc89fc, 0xffcca174, 0xffcc69fc, 0xffcc319c, 0xffcc3d27, 0xffcc5a78,
+    0xffcc00f4, 0xffcc455d, 0xffcc09fb, 0xffcc1907, 0xffcbe9fb, 0xffcbb000, 0xffcba00e, 0xffcbb9fc,
+    0xffcbd209, 0xffcb99fc, 0xffcbb784, 0xffcb514d, 0xffcb8a7d, 0xffcb314d, 0xffcb200d, 0xffcb10f4,
+    0xffcb4a7c, 0xffcaf000, 0xffcb2a7c, 0xffcad14c, 0xffcac000, 0xffcab000, 0xffcaa000, 0xffca900e,
+    0xffcaca7b, 0xffca711b, 0xffca6000, 0xffca511b, 0xffca414d, 0xffca3000, 0xffca2000, 0xffca1000,
+    0xffca0000, 0xffc9f11a, 0xffca2ac3, 0xffc9d014, 0xffca0ac3, 0xffc9b014, 0xffc9a19c, 0xffc9900f,
+    0xffc9cb0e, 0xffc97000, 0xffc9c715, 0xffc95013, 0xffc98b0e, 0xffc93013, 0xffc92015, 0xffc91000,
+    0xffc94b0d, 0xffc91aa2, 0xffc92b0d, 0xffc92882, 0xffc8e6c2, 0xffc8daa2, 0xffc8a014, 0xffc89000,
+    0xffc880f4, 0xffc89aa1, 0xffc8684e, 0xffc87aa1, 0xffc84fe6, 0xffc83a4e, 0xffc82013, 0xffc81015,
+    0xffc85dcc, 0xffc84de4, 0xffc80aa2, 0xffc7fc84, 0xffc7eaa2, 0xffc7ba4d, 0xffc7a08c, 0xffc7a305,
+    0xffc7808c, 0xffc79e94, 0xffc78c3a, 0xffc78c63, 0xffc74695, 0xffc74939, 0xffc7200d, 0xffc751b6,
+    0xffc71b2f, 0xffc731b6, 0xffc7319a, 0xffc7003c, 0xffc713ed, 0xffc6b0f4, 0xffc6c412, 0xffc6e533,
+    0xffc6d592, 0xffc6708c, 0xffc66461, 0xffc69b28, 0xffc64461, 0xffc631d5, 0xffc62117, 0xffc61223,
+    0xffc629dc, 0xffc64647, 0xffc6084d, 0xffc62647, 0xffc5c06a, 0xffc5b041, 0xffc5a5b7, 0xffc590ef,
+    0xffc5b7d8, 0xffc570ef, 0xffc56950, 0xffc57ccf, 0xffc5a92b, 0xffc5306b, 0xffc52eaf, 0xffc510ee,
+    0xffc5409c, 0xffc4f0ee, 0xffc4ffc5, 0xffc4d06a, 0xffc52a79, 0xffc4fcaa, 0xffc4a000, 0xffc495b7,
+    0xffc48b40, 0xffc49910, 0xffc4615c, 0xffc4a65e, 0xffc44b12, 0xffc4872f, 0xffc42024, 0xffc43932,
+    0xffc4008c, 0xffc3f635, 0xffc43eb3, 0xffc42d10, 0xffc3e14b, 0xffc3b84e, 0xffc3a695, 0xffc39117,
+    0xffc3aec6, 0xffc3cd74, 0xffc36022, 0xffc3515c, 0xffc39f42, 0xffc33024, 0xffc32694, 0xffc310f4,
+    0xffc302e8, 0xffc2f08c, 0xffc33f71, 0xffc30138, 0xffc2ef81, 0xffc2e138, 0xffc2adfd, 0xffc29042,
+    0xffc282e7, 0xffc270f0, 0xffc26105, 0xffc2af82, 0xffc2730f, 0xffc26137, 0xffc221b0, 0xffc21000,
+    0xffc20070, 0xffc1f2e8, 0xffc1e015, 0xffc1d0ef, 0xffc22aa0, 0xffc1bdfd, 0xffc20b66, 0xffc19000,
+    0xffc1806f, 0xffc17000, 0xffc17209, 0xffc15000, 0xffc1a3d6, 0xffc17ceb, 0xffc12add, 0xffc111b0,
+    0xffc10000, 0xffc12908, 0xffc0e036, 0xffc13037, 0xffc0c036, 0xffc11037, 0xffc0a024, 0xffc091af,
+    0xffc08000, 0xffc0a24a, 0xffc0608c, 0xffc0abf5, 0xffc077c4, 0xffc06956, 0xffc02180, 0xffc01015,
+    0xffc00180, 0xffc02249, 0xffc0124b, 0xffc02f4e, 0xffc020e6, 0xffbfc88f, 0xffbfa17f, 0xffbf9014,
+    0xffbf8000, 0xffbfbd7c, 0xffbf62e8, 0xffbf584e, 0xffbf9fa8, 0xffbf424f, 0xffbf2b3c, 0xffbf6add,
+    0xffbf3929, 0xffbf05c1, 0xffbf42b7, 0xffbf024b, 0xffbf254c, 0xffbeb23a, 0xffbeab3b, 0xffbe908c,
+    0xffbea300, 0xffbe708c, 0xffbe8300, 0xffbe9d9f, 0xffbeac32, 0xffbe3695, 0xffbe29e1, 0xffbe4a4d,
+    0xffbe3006, 0xffbe5569, 0xffbdf5c1, 0xffbe3569, 0xffbdc025, 0xffbe1c35, 0xffbdb353, 0xffbdb761,
+    0xffbd8d67, 0xffbdac02, 0xffbd6356, 0xffbd5461, 0xffbd9af7, 0xffbd8360, 0xffbd3591, 0xffbd3760,
+    0xffbd28c9, 0xffbd08ba, 0xffbce355, 0xffbce74c, 0xffbcc67d, 0xffbd1156, 0xffbca470, 0xffbc9fc7,
+    0xffbc8470, 0xffbc7157, 0xffbc61d0, 0xffbc8023, 0xffbc69e2, 0xffbc42a2, 0xffbc255a, 0xffbc317d,
+    0xffbc0712, 0xffbbf11b, 0xffbbe166, 0xffbbe499, 0xffbbd468, 0xffbbe1fe, 0xffbbda5e, 0xffbb9470,
+    0xffbb9a14, 0xffbb85c1, 0xffbb7ead, 0xffbb8abd, 0xffbb62ae, 0xffbb30b9, 0xffbb3792, 0xffbb5e08,
+    0xffbb182f, 0xffbaf4fd, 0xffbb1cdd, 0xffbb0322, 0xffbae64e, 0xffbaef8a, 0xffbabb79, 0xffbad00f,
+    0xffba982e, 0xffbab1cb, 0xffba79e4, 0xffbab69f, 0xffba80fc, 0xffba7ae3, 0xffba32b6, 0xffba3d40,
+    0xffba6d40, 0xffba270f, 0xffba4d81, 0xffb9d461, 0xffb9c356, 0xffb9d021, 0xffb9b65f, 0xffb994b8,
+    0xffb9a038, 0xffb9a222, 0xffb96851, 0xffb969e4, 0xffb96a60, 0xffb964c8, 0xffb9504e, 0xffb95c5e,
+    0xffb907ed, 0xffb92221, 0xffb8e083, 0xffb90cd1, 0xffb8c8dc, 0xffb8b6dc, 0xffb8a8dc, 0xffb894b6,
+    0xffb8ce96, 0xffb89038, 0xffb86d84, 0xffb85add, 0xffb851c5, 0xffb85d83, 0xffb86e85, 0xffb8404e,
+    0xffb839ed, 0xffb7f26c, 0xffb80fe8, 0xffb7e229, 0xffb7c04c, 0xffb7b8dc, 0xffb7c9bb, 0xffb7c9b0,
+    0xffb7acb0, 0xffb77bd6, 0xffb7604b, 0xffb7a29d, 0xffb79bf5, 0xffb73412, 0xffb74b10, 0xffb71809,
+    0xffb70784, 0xffb6fbd5, 0xffb6e26c, 0xffb6e6e6, 0xffb7507a, 0xffb6b17f, 0xffb6a0a0, 0xffb6b765,
+    0xffb6b18a, 0xffb6bc8a, 0xffb6850f, 0xffb65120, 0xffb6720d, 0xffb67d04, 0xffb64d3f, 0xffb69017,
+    0xffb62e6d, 0xffb5f6ae, 0xffb691ee, 0xffb706ac, 0xffb645cb, 0xffb60e96, 0xffb6947e, 0xffb5c3d3,
+    0xffb5d449, 0xffb63c27, 0xffb5a31f, 0xffb60f1e, 0xffb593ac, 0xffb5a2c0, 0xffb540b6, 0xffb51f70,
+    0xffb555f3, 0xffb565ad, 0xffb5609f, 0xffb56549, 0xffb4d302, 0xffb5758d, 0xffb4d830, 0xffb5021f,
+    0xffb4c28e, 0xffb4f126, 0xffb4cb89, 0xffb4c183, 0xffb4d270, 0xffb517c1, 0xffb42302, 0xffb497c6,
+    0xffb490c7, 0xffb43316, 0xffb3f2c7, 0xffb4efd1, 0xffb3dccc, 0xffb3c283, 0xffb414ce, 0xffb39470,
+    0xffb382ff, 0xffb3b554, 0xffb39499, 0xffb377cb, 0xffb3e4cd, 0xffb3330b, 0xffb44e21, 0xffb355c5,
+    0xffb301e4, 0xffb3ecdd, 0xffb2e159, 0xffb304c1, 0xffb2c994, 0xffb2ccca, 0xffb35d97, 0xffb2900a,
+    0xffb322f0, 0xffb27711, 0xffb261ae, 0xffb38407, 0xffb28576, 0xffb36465, 0xffb2c165, 0xffb2b444,
+    0xffb2bd75, 0xffb2199c, 0xffb2329a, 0xffb2eab8, 0xffb259d0, 0xffb2728a, 0xffb20219, 0xffb1e105,
+    0xffb28408, 0xffb24652, 0xffb1ecf3, 0xffb17a56, 0xffb1636c, 0xffb15676, 0xffb18971, 0xffb11375,
+    0xffb1b28b, 0xffb17439, 0xffb127de, 0xffb11582, 0xffb1457b, 0xffb110ec, 0xffb0ad48, 0xffb0d7e7,
+    0xffb0a124, 0xffb14f69, 0xffb0ff3b, 0xffb0a690, 0xffb07cc4, 0xffb035fd, 0xffb06025, 0xffb05907,
+    0xffb00021, 0xffb01fb3, 0xffafe690, 0xffb09171, 0xffafc008, 0xffafb8dc, 0xffb0cdfc, 0xffafdfc0,
+    0xffafa63b, 0xffb0085f, 0xffaf889e, 0xffaf5d84, 0xffafeb60, 0xffaf374d, 0xffaf35a5, 0xffb043b3,
+    0xffb0376e, 0xffaf470f, 0xffb013ca, 0xffaeee4e, 0xffaec0b1, 0xffaf855e, 0xffaeb85e, 0xffaeb386,
+    0xffaebfcf, 0xffae80ad, 0xffae94f9, 0xffaed52b, 0xffae4725, 0xffaef4ba, 0xffae3fdc, 0xffae2221,
+    0xffaee23f, 0xffae782a, 0xffae11ab, 0xffadda3c, 0xffae0075, 0xffaec194, 0xffadaf4f, 0xffadde2d,
+    0xffadb063, 0xffadab93, 0xffad6849, 0xffad6799, 0xffad5b6f, 0xffaddd73, 0xffad36c9, 0xffad845c,
+    0xffada662, 0xffacf332, 0xffadb2ef, 0xffadcef5, 0xffadf6c0, 0xffad6aac, 0xffacc4f0, 0xffad341f,
+    0xffaca4db, 0xffac8dd1, 0xffacb1cd, 0xffaca200, 0xffacf192, 0xffad62e6, 0xffad4e6d, 0xffac90d6,
+    0xffad2832, 0xffac088a, 0xffacbba5, 0xffac62c0, 0xffacd880, 0xffabe0bd, 0xffaba560, 0xffac1a08,
+    0xffac5114, 0xffac47fc, 0xffab9a5f, 0xffab7d37, 0xffab9867, 0xffab47b5, 0xffab2409, 0xffac41fb,
+    0xffab622c, 0xffac2724, 0xffab00fd, 0xffaadc01, 0xffaba4b7, 0xffab5296, 0xffab8082, 0xffaa98de,
+    0xffaaccb7, 0xffaaba61, 0xffaabf43, 0xffaae709, 0xffaa41aa, 0xffab0d1d, 0xffaae33d, 0xffaa1684,
+    0xffaa7de7, 0xffaa7ae3, 0xffaa43d1, 0xffaaf73b, 0xffaaf38d, 0xffaac6a7, 0xffaa7d45, 0xffaa5b4e,
+    0xffaa368d, 0xffaa52da, 0xffa97344, 0xffa9770d, 0xffaa63d9, 0xffa9455d, 0xffa94319, 0xffa97977,
+    0xffa93885, 0xffa95ba5, 0xffa90a37, 0xffa8d31c, 0xffa8d8c3, 0xffa8b152, 0xffa8b94e, 0xffa8d63b,
+    0xffa8a88b, 0xffa87e2b, 0xffa86bc7, 0xffa86bf3, 0xffa8bceb, 0xffa83c18, 0xffa83f94, 0xffa81e27,
+    0xffa856da, 0xffa818f5, 0xffa839e6, 0xffa817b0, 0xffa807a8, 0xffa7bb52, 0xffa86de6, 0xffa7da17,
+    0xffa7b7d0, 0xffa7c0d8, 0xffa79079, 0xffa75bc7, 0xffa7757d, 0xffa73697, 0xffa75352, 0xffa7c7f0,
+    0xffa73c09, 0xffa73659, 0xffa701bc, 0xffa6e08d, 0xffa6cf9e, 0xffa6e977, 0xffa73018, 0xffa6f7c6,
+    0xffa684d5, 0xffa67c00, 0xffa69cc2, 0xffa66e72, 0xffa68210, 0xffa673c0, 0xffa6575c, 0xffa624bc,
+    0xffa63d41, 0xffa61da9, 0xffa5e049, 0xffa6065a, 0xffa60842, 0xffa5c8ce, 0xffa5c431, 0xffa5b992,
+    0xffa5842a, 0xffa5c1f7, 0xffa598fd, 0xffa55b7d, 0xffa5e631, 0xffa5516a, 0xffa57962, 0xffa581c2,
+    0xffa50365, 0xffa50d16, 0xffa59b1f, 0xffa4e9c9, 0xffa4d459, 0xffa4ed87, 0xffa4bb66, 0xffa4b9cf,
+    0xffa48161, 0xffa47e6f, 0xffa58cb0, 0xffa58412, 0xffa55f8e, 0xffa4439d, 0xffa4e464, 0xffa41262,
+    0xffa50f3f, 0xffa3f0b4, 0xffa41619, 0xffa4cc71, 0xffa3f905, 0xffa412d3, 0xffa46a6d, 0xffa3902a,
+    0xffa39e78, 0xffa3d26b, 0xffa39d0f, 0xffa48737, 0xffa3c4c7, 0xffa3ab71, 0xffa367f2, 0xffa3778a,
+    0xffa31513, 0xffa35420, 0xffa2eaec, 0xffa34b36, 0xffa30120, 0xffa31a54, 0xffa327cc, 0xffa342c7,
+    0xffa2ef5f, 0xffa2d228, 0xffa3941f, 0xffa27a35, 0xffa34f2d, 0xffa2447d, 0xffa3080b, 0xffa26bb9,
+    0xffa275cc, 0xffa22a2c, 0xffa1e1e1, 0xffa1eae3, 0xffa24718, 0xffa1db59, 0xffa22611, 0xffa19fbb,
+    0xffa186f0, 0xffa1854a, 0xffa1cb28, 0xffa16dff, 0xffa277a1, 0xffa1b862, 0xffa12061, 0xffa11f1c,
+    0xffa12088, 0xffa12951, 0xffa1a1d2, 0xffa0f004, 0xffa15648, 0xffa0e5d6, 0xffa0f8de, 0xffa0e0aa,
+    0xffa096e8, 0xffa0967f, 0xffa0ab54, 0xffa05704, 0xffa08df4, 0xffa088e0, 0xffa02af7, 0xffa03457,
+    0xffa07962, 0xffa00ce6, 0xffa01436, 0xffa0087d, 0xff9ff40e, 0xff9fdd3e, 0xff9fce1e, 0xff9fa10d,
+    0xff9fe9f9, 0xff9fa259, 0xffa0000c, 0xffa02fc5, 0xff9f5fc7, 0xff9f3f9c, 0xff9f3bd9, 0xff9f3d4a,
+    0xff9f5ab8, 0xff9f1bbc, 0xff9f7d56, 0xff9f1571, 0xff9f1985, 0xff9ec26b, 0xff9ee0e3, 0xff9f3db7,
+    0xff9ef2e2, 0xff9f3914, 0xff9ec8bd, 0xff9e9fcc, 0xff9e94df, 0xff9e6009, 0xff9e3ede, 0xff9f0f00,
+    0xff9e645c, 0xff9e812f, 0xff9e8ed0, 0xff9df745, 0xff9e415a, 0xff9e2d8d, 0xff9e6fa1, 0xff9dba6d,
+    0xff9e5f34, 0xff9e299a, 0xff9df15e, 0xff9d6293, 0xff9dea6f, 0xff9d4fec, 0xff9dc856, 0xff9d7a08,
+    0xff9d76b7, 0xff9cf9aa, 0xff9dab96, 0xff9de14f, 0xff9d560a, 0xff9cbac4, 0xff9d08c7, 0xff9cf021,
+    0xff9d41ec, 0xff9c7cda, 0xff9c6e66, 0xff9d4823, 0xff9ccf6e, 0xff9c9f79, 0xff9c2e9a, 0xff9cc1a6,
+    0xff9c6957, 0xff9c4a7b, 0xff9cf317, 0xff9be106, 0xff9be2ea, 0xff9bc150, 0xff9c1cd3, 0xff9bbf2e,
+    0xff9bbd46, 0xff9bf4a1, 0xff9be1eb, 0xff9c50c7, 0xff9c2004, 0xff9b418d, 0xff9bda91, 0xff9b979d,
+    0xff9b8d76, 0xff9b15a7, 0xff9bac40, 0xff9ae898, 0xff9bf3f2, 0xff9af676, 0xff9b0ebf, 0xff9ac115,
+    0xff9b1be3, 0xff9a87fa, 0xff9a8a82, 0xff9a6057, 0xff9b1556, 0xff9aea79, 0xff9a7f7b, 0xff9a1ae0,
+    0xff9a830c, 0xff9a3857, 0xff99e024, 0xff99d9a1, 0xff9a11fc, 0xff99e602, 0xff99f02c, 0xff999949,
+    0xff99b2a6, 0xff9a0f4d, 0xff9976bb, 0xff996203, 0xff9a1285, 0xff99fd51, 0xff992954, 0xff9958c2,
+    0xff99308c, 0xff991723, 0xff98e16d, 0xff98dfd5, 0xff99818e, 0xff98d5eb, 0xff997947, 0xff98e96b,
+    0xff988256, 0xff987381, 0xff98cc9b, 0xff9927ea, 0xff988a40, 0xff9842ba, 0xff9863dc, 0xff984362,
+    0xff98b618, 0xff98122f, 0xff980f0e, 0xff98c002, 0xff9813b6, 0xff98c595, 0xff97a1bc, 0xff97c622,
+    0xff97ed4a, 0xff979cbd, 0xff97ab9e, 0xff97de17, 0xff975213, 0xff976d9f, 0xff9822dc, 0xff975c6b,
+    0xff970983, 0xff97bf39, 0xff9726a8, 0xff973a2d, 0xff96cf22, 0xff96b676, 0xff96ad7a, 0xff974855,
+    0xff970b8d, 0xff97a754, 0xff967f17, 0xff966b96, 0xff966e8b, 0xff973da4, 0xff9632b7, 0xff96f4a2,
+    0xff96197e, 0xff96459b, 0xff968195, 0xff96b300, 0xff961379, 0xff96e78d, 0xff963bc7, 0xff9609da,
+    0xff96b7cd, 0xff963b3f, 0xff957f9f, 0xff9591de, 0xff959194, 0xff955178, 0xff95f198, 0xff951b2b,
+    0xff96364c, 0xff95335c, 0xff959f09, 0xff94ff0a, 0xff9596e9, 0xff95481d, 0xff95a6d2, 0xff94b674,
+    0xff95072c, 0xff94770d, 0xff949294, 0xff94f99b, 0xff94fff1, 0xff94c244, 0xff9429e6, 0xff954801,
+    0xff94032c, 0xff93f70b, 0xff93f136, 0xff947d62, 0xff949220, 0xff942ed3, 0xff93f2d8, 0xff93e412,
+    0xff93a78b, 0xff93e06f, 0xff9383ad, 0xff941e57, 0xff936bce, 0xff934a3e, 0xff93b8d0, 0xff93188d,
+    0xff9300b6, 0xff9364b0, 0xff935f36, 0xff934c17, 0xff93009d, 0xff92f9ec, 0xff9311b1, 0xff937cbb,
+    0xff928f8c, 0xff931bf8, 0xff938e1e, 0xff927305, 0xff92a31a, 0xff924d60, 0xff929243, 0xff923bed,
+    0xff92a8c8, 0xff92173b, 0xff920eb3, 0xff922d1e, 0xff91c965, 0xff92bf03, 0xff91a7aa, 0xff91b185,
+    0xff91cc8c, 0xff91771c, 0xff9161cc, 0xff9151ec, 0xff9192f7, 0xff913bb0, 0xff916cef, 0xff916764,
+    0xff916b19, 0xff912051, 0xff913075, 0xff90dfed, 0xff90f17c, 0xff91355b, 0xff913ecc, 0xff910a1d,
+    0xff90d65d, 0xff90acbd, 0xff909ff3, 0xff906304, 0xff90ad71, 0xff903d67, 0xff906947, 0xff9013e3,
+    0xff90174d, 0xff8ff28c, 0xff901c7d, 0xff8fea0c, 0xff8fcfed, 0xff8fc8cf, 0xff8fd870, 0xff8f928b,
+    0xff8f9afa, 0xff8f728b, 0xff8f83fe, 0xff8f7f0f, 0xff8fa735, 0xff8f3ede, 0xff8f233b, 0xff8f5923,
+    0xff8f3d91, 0xff8ef278, 0xff8f3e74, 0xff8ed03b, 0xff8f1c8a, 0xff8ec839, 0xff8ef922, 0xff8eae3d,
+    0xff8f0c37, 0xff8eb3f8, 0xff8e6ddc, 0xff8ec365, 0xff8e459d, 0xff8e6c6d, 0xff8e29fa, 0xff8e71c5,
+    0xff8ebb95, 0xff8e2edb, 0xff8e5886, 0xff8ea5de, 0xff8df242, 0xff8db59e, 0xff8db5fb, 0xff8db494,
+    0xff8dd4bd, 0xff8dab2f, 0xff8d9241, 0xff8d6b77, 0xff8ddbf7, 0xff8d52fd, 0xff8d79cc, 0xff8d6272,
+    0xff8d6e2f, 0xff8d57cf, 0xff8ce597, 0xff8ce398, 0xff8d3a0b, 0xff8cc64f, 0xff8cd731, 0xff8c972d,
+    0xff8cad8b, 0xff8cc091, 0xff8c92ae, 0xff8c61f6, 0xff8c6ea6, 0xff8c537b, 0xff8c3f68, 0xff8c337b,
+    0xff8c0ee3, 0xff8c2e55, 0xff8beee3, 0xff8bf996, 0xff8bdcda, 0xff8bd17e, 0xff8bf0e4, 0xff8bb50f,
+    0xff8b98a1, 0xff8ba205, 0xff8bf8e2, 0xff8b8f01, 0xff8bd2c4, 0xff8b3d10, 0xff8b3eb2, 0xff8b115d,
+    0xff8b000f, 0xff8af316, 0xff8b3a50, 0xff8b44d8, 0xff8ace00, 0xff8b250e, 0xff8ae5df, 0xff8ad059,
+    0xff8a89fa, 0xff8a9d11, 0xff8ab216, 0xff8ab6f1, 0xff8a4d10, 0xff8a3e01, 0xff8a388d, 0xff8a2c7c,
+    0xff8a2520, 0xff8a0997, 0xff8a05c9, 0xff89d3bf, 0xff89f59c, 0xff89b301, 0xff89e299, 0xff899ea9,
+    0xff8a2021, 0xff89b3e5, 0xff8967fd, 0xff899a52, 0xff894af3, 0xff894fe3, 0xff8965fa, 0xff8916de,
+    0xff892389, 0xff88fd5b, 0xff88e737, 0xff890608, 0xff88fd30, 0xff88b208, 0xff88b90e, 0xff889209,
+    0xff88f5a2, 0xff887ea6, 0xff88b060, 0xff886827, 0xff887895, 0xff88308c, 0xff895368, 0xff88cda0,
+    0xff882004, 0xff87f24e, 0xff882193, 0xff880130, 0xff887433, 0xff885569, 0xff887455, 0xff884494,
+    0xff885a3e, 0xff878b9d, 0xff87751d, 0xff87eb24, 0xff878a3e, 0xff87b39c, 0xff8808c9, 0xff872752,
+    0xff87a33f, 0xff870d9a, 0xff86ea8d, 0xff86dec1, 0xff86e09f, 0xff873e97, 0xff86cfc9, 0xff86d3a6,
+    0xff875331, 0xff875a0e, 0xff86ad00, 0xff86d864, 0xff866b34, 0xff866419, 0xff8634ad, 0xff862498,
+    0xff86a6ab, 0xff862a84, 0xff86754d, 0xff85e039, 0xff8673aa, 0xff85d22b, 0xff85d32a, 0xff8598de,
+    0xff866672, 0xff85e286, 0xff8612ba, 0xff859e1a, 0xff85d142, 0xff854496, 0xff854231, 0xff8526e9,
+    0xff859749, 0xff851536, 0xff84e7bf, 0xff856bee, 0xff851e4a, 0xff84c9e7, 0xff84a92f, 0xff85550e,
+    0xff850ddd, 0xff8505c6, 0xff84bf51, 0xff84f1c6, 0xff84a7a5, 0xff848b34, 0xff849b3f, 0xff854785,
+    0xff843cec, 0xff843d34, 0xff844f3c, 0xff84297c, 0xff8439e2, 0xff845097, 0xff83d9a0, 0xff839319,
+    0xff83a8b8, 0xff8385a2, 0xff84033f, 0xff838350, 0xff8340ab, 0xff83d3f5, 0xff83c58f, 0xff833f57,
+    0xff831eb0, 0xff83188d, 0xff8326a6, 0xff832a2f, 0xff82f745, 0xff833d35, 0xff82b4ad, 0xff82acd4,
+    0xff8292e8, 0xff828d42, 0xff8272e8, 0xff835489, 0xff833762, 0xff829096, 0xff824c7a, 0xff8235bd,
+    0xff823b48, 0xff8269a8, 0xff81e170, 0xff826989, 0xff820c52, 0xff81b8f0, 0xff81b0ce, 0xff81926c,
+    0xff81b04a, 0xff818bd2, 0xff81d9d1, 0xff819435, 0xff815136, 0xff816dbf, 0xff814c1d, 0xff8113b3,
+    0xff8137ff, 0xff811b02, 0xff816a8f, 0xff80f567, 0xff80fc20, 0xff80bf7e, 0xff8139d3, 0xff80bac2,
+    0xff8129da, 0xff807412, 0xff8120be, 0xff80780d, 0xff80b11d, 0xff8058bd, 0xff80f927, 0xff80ab36,
+    0xff812e85, 0xff809ed4, 0xff8117fd, 0xff80b962, 0xff80a367, 0xff80aeb5, 0xff7fa208, 0xff7f9448,
+    0xff80651d, 0xff80a7ff, 0xff806ab4, 0xff7fd284, 0xff804456, 0xff7fd7c3, 0xff801044, 0xff804380,
+    0xff7f5b07, 0xff7f9b89, 0xff7f1639, 0xff7ed0af, 0xff7f44f4, 0xff7efabd, 0xff7fc79a, 0xff7f7c1e,
+    0xff7ea6d3, 0xff7e7812, 0xff7e7ed1, 0xff7e7d82, 0xff7efaeb, 0xff7e5a67, 0xff7e2e61, 0xff7e9fa6,
+    0xff7e5365, 0xff7efe95, 0xff7e82b5, 0xff7deb21, 0xff7dc003, 0xff7e884a, 0xff7e6680, 0xff7df5ef,
+    0xff7e6a80, 0xff7db733, 0xff7e948b, 0xff7d5476, 0xff7d5f09, 0xff7d5b34, 0xff7d6ecd, 0xff7d7fe1,
+    0xff7dda5f, 0xff7d8bf4, 0xff7d8186, 0xff7e0417, 0xff7d6c08, 0xff7de7b2, 0xff7cccf0, 0xff7ce360,
+    0xff7ccaf2, 0xff7cfec0, 0xff7c73bd, 0xff7d1434, 0xff7d38b2, 0xff7c9700, 0xff7cbd2d, 0xff7c80b1,
+    0xff7c43f6, 0xff7cb815, 0xff7d187d, 0xff7c5e14, 0xff7c8f58, 0xff7bb4b9, 0xff7c8f54, 0xff7beb73,
+    0xff7b8843, 0xff7c4d22, 0xff7b6010, 0xff7c4e04, 0xff7c0cd5, 0xff7bbbc4, 0xff7b77d0, 0xff7b3c03,
+    0xff7c37fb, 0xff7b34d9, 0xff7aecd2, 0xff7b3c92, 0xff7b629d, 0xff7b0d30, 0xff7aa1bd, 0xff7b05a0,
+    0xff7b02c4, 0xff7ac1f4, 0xff7a656d, 0xff7ab93b, 0xff7b4083, 0xff7a7cf1, 0xff7ac1e7, 0xff7a75be,
+    0xff7a2313, 0xff7a2308, 0xff79fae0, 0xff7a0642, 0xff79dae0, 0xff79ec41, 0xff79ff8d, 0xff79d790,
+    0xff7a53e3, 0xff79de80, 0xff7a94f9, 0xff7a310d, 0xff7a1d5f, 0xff79bfec, 0xff796f16, 0xff798679,
+    0xff792d9a, 0xff78fa42, 0xff796ede, 0xff792088, 0xff793394, 0xff7976eb, 0xff78f30a, 0xff78d69c,
+    0xff78f26e, 0xff78c5fa, 0xff791eab, 0xff785b18, 0xff7860e0, 0xff783afa, 0xff784bd7, 0xff783a95,
+    0xff780fa4, 0xff78a9d6, 0xff77ff8b, 0xff7834a8, 0xff77c030, 0xff7823c2, 0xff77a39a, 0xff78b5d1,
+    0xff779bf2, 0xff78a4b1, 0xff7777ff, 0xff77f5a2, 0xff775545, 0xff776843, 0xff77545b, 0xff771a48,
+    0xff773ea6, 0xff77b70d, 0xff7766f6, 0xff77c6eb, 0xff76c8a4, 0xff76b549, 0xff773f49, 0xff77c37d,
+    0xff76e740, 0xff77a832, 0xff766105, 0xff76615f, 0xff76d59c, 0xff76b93c, 0xff769e35, 0xff769d5d,
+    0xff770565, 0xff76c50c, 0xff7667f2, 0xff76a405, 0xff75e0e8, 0xff75b3d7, 0xff766033, 0xff75d1b0,
+    0xff75da91, 0xff75f1de, 0xff758175, 0xff75b8da, 0xff75e46e, 0xff7563e8, 0xff764f71, 0xff75ff40,
+    0xff754894, 0xff755305, 0xff760652, 0xff75ff28, 0xff74d572, 0xff756656, 0xff74f653, 0xff74b111,
+    0xff74bf08, 0xff747c45, 0xff74c2c7, 0xff7553db, 0xff7475f8, 0xff7564b5, 0xff7546f7, 0xff74c898,
+    0xff74f195, 0xff744ccf, 0xff73ede7, 0xff74249f, 0xff748d2b, 0xff7494fc, 0xff742592, 0xff74af88,
+    0xff73a476, 0xff7481fa, 0xff747d32, 0xff740114, 0xff734fde, 0xff745d79, 0xff7342e7, 0xff742c56,
+    0xff73ee14, 0xff732b8a, 0xff7307ed, 0xff73a234, 0xff739b59, 0xff73def5, 0xff72e17f, 0xff72df16,
+    0xff731c52, 0xff72b498, 0xff727b88, 0xff72de6b, 0xff72780f, 0xff7253c1, 0xff734fc4, 0xff733695,
+    0xff732e64, 0xff7247e2, 0xff72b6af, 0xff71eb7b, 0xff721ed8, 0xff724ed8, 0xff72bf77, 0xff7287cc,
+    0xff718ef0, 0xff7202d5, 0xff729492, 0xff7284c4, 0xff719e0d, 0xff718310, 0xff71397c, 0xff724560,
+    0xff718d22, 0xff717069, 0xff7136d2, 0xff71e1df, 0xff710cea, 0xff70cba3, 0xff70c053, 0xff716e23,
+    0xff712b3e, 0xff718b1c, 0xff717de6, 0xff70c30f, 0xff716eaf, 0xff7076d4, 0xff7056d1, 0xff70407a,
+    0xff712735, 0xff710fa4, 0xff705861, 0xff6fdddf, 0xff705181, 0xff70e549, 0xff703c80, 0xff6f963a,
+    0xff700434, 0xff704c03, 0xff707266, 0xff706e1f, 0xff7000fe, 0xff6fce77, 0xff6f6d4d, 0xff6f21e4,
+    0xff6f2668, 0xff6f2085, 0xff6fbb8f, 0xff6fd43b, 0xff6fd070, 0xff6ef3e2, 0xff6fa256, 0xff6e9046,
+    0xff6e802e, 0xff6ee13b, 0xff6f3b06, 0xff6e5037, 0xff6e7435, 0xff6f339f, 0xff6eb16a, 0xff6e3324,
+    0xff6e8506, 0xff6e0e3c, 0xff6e93bf, 0xff6eaa33, 0xff6e31d6, 0xff6e9ed0, 0xff6e4048, 0xff6e41b6,
+    0xff6d833f, 0xff6e0ef2, 0xff6e1058, 0xff6e2b84, 0xff6dde8d, 0xff6dc0ea, 0xff6dbefe, 0xff6d913e,
+    0xff6d09c0, 0xff6ddbd4, 0xff6d60cb, 0xff6d61b2, 0xff6d5c9c, 0xff6cb005, 0xff6cbfb6, 0xff6d3ff6,
+    0xff6cdf1a, 0xff6d2219, 0xff6cef67, 0xff6ca19e, 0xff6cd043, 0xff6cc1e4, 0xff6c3eb7, 0xff6cb013,
+    0xff6ca037, 0xff6c610d, 0xff6c8101, 0xff6c2f60, 0xff6c2043, 0xff6c502d, 0xff6ba366, 0xff6c2146,
+    0xff6c59e3, 0xff6bf209, 0xff6bc237, 0xff6bee41, 0xff6bc1e1, 0xff6bd1cd, 0xff6bc0d0, 0xff6b3723,
+    0xff6ba28b, 0xff6b61ec, 0xff6b5f1d, 0xff6adfa3, 0xff6b71d1, 0xff6b754f, 0xff6b3fdf, 0xff6b6bf5,
+    0xff6a8d6f, 0xff6ad205, 0xff6aca9b, 0xff6b1593, 0xff6b03df, 0xff6b4142, 0xff6a26c5, 0xff6ac2a7,
+    0xff6a921e, 0xff6aa18d, 0xff6a9237, 0xff6aabb4, 0xff69c827, 0xff6a9f0f, 0xff69bd3b, 0xff6a0125,
+    0xff6a012d, 0xff6a49d6, 0xff69e1bf, 0xff69ce2c, 0xff69b29d, 0xff69d140, 0xff69c21b, 0xff699331,
+    0xff69b225, 0xff69cc7d, 0xff69a38a, 0xff69bdf9, 0xff697318, 0xff692058, 0xff6931ed, 0xff68d72e,
+    0xff6945e6, 0xff696f76, 0xff68d713, 0xff687015, 0xff691b65, 0xff68cf4e, 0xff68aef7, 0xff68ec5e,
+    0xff686fb7, 0xff68ccff, 0xff68cde1, 0xff685574, 0xff67c0d5, 0xff688cb3, 0xff68664c, 0xff6855a3,
+    0xff685cad, 0xff6802e2, 0xff67ee25, 0xff68028f, 0xff681d1c, 0xff6785bd, 0xff674ac2, 0xff67bf6f,
+    0xff67b411, 0xff675c49, 0xff67a3ac, 0xff679758, 0xff67872b, 0xff66d282, 0xff66ec2b, 0xff669d19,
+    0xff668b49, 0xff67124c, 0xff670350, 0xff672cf6, 0xff66e1a4, 0xff66478a, 0xff66d3ea, 0xff66ff59,
+    0xff66a19d, 0xff66a432, 0xff65e125, 0xff668142, 0xff65e436, 0xff6616e0, 0xff665315, 0xff6612a8,
+    0xff6623bf, 0xff663897, 0xff663cae, 0xff662d7c, 0xff659989, 0xff654804, 0xff65fe0d, 0xff6582eb,
+    0xff6546f6, 0xff65cdb4, 0xff64e0c4, 0xff6549a1, 0xff65ae04, 0xff65318a, 0xff64a192, 0xff653061,
+    0xff64ac77, 0xff6499a4, 0xff65131b, 0xff6501ba, 0xff64f3c8, 0xff64c233, 0xff647e24, 0xff64a23c,
+    0xff64f040, 0xff646211, 0xff645d1d, 0xff647227, 0xff644e44, 0xff63f112, 0xff642221, 0xff6432fc,
+    0xff648fa2, 0xff63ddd6, 0xff64030f, 0xff63f293, 0xff63a13f, 0xff633010, 0xff63c37c, 0xff63ff6f,
+    0xff63b44a, 0xff63b8a7, 0xff63a61b, 0xff638456, 0xff62fd6e, 0xff637868, 0xff637cd6, 0xff63b781,
+    0xff632224, 0xff6324c9, 0xff627f17, 0xff627380, 0xff62e45e, 0xff630afd, 0xff6237b5, 0xff62ed6e,
+    0xff622e98, 0xff62cd88, 0xff62bcb4, 0xff62dec1, 0xff62d00a, 0xff622036, 0xff62cbaf, 0xff61db26,
+    0xff6281c5, 0xff627219, 0xff624eb6, 0xff62403a, 0xff62511e, 0xff62413e, 0xff61ca5a, 0xff612a72,
+    0xff61ddd1, 0xff621817, 0xff61f06e, 0xff6111fc, 0xff6182f4, 0xff6178bb, 0xff618fef, 0xff616e95,
+    0xff61707d, 0xff617fba, 0xff60ca2c, 0xff6115b4, 0xff604a60, 0xff611fce, 0xff60e978, 0xff603382,
+    0xff609cd6, 0xff6069e0, 0xff61070c, 0xff60e1e1, 0xff5fc340, 0xff6088f6, 0xff607dcf, 0xff60036f,
+    0xff609d72, 0xff5f72c1, 0xff5fdfca, 0xff5feacc, 0xff5ff53e, 0xff604c8d, 0xff5fadc9, 0xff5fd02c,
+    0xff5f3ec0, 0xff5fe3ae, 0xff60050c, 0xff5f31c7, 0xff5fb11f, 0xff5f6392, 0xff5fae00, 0xff5f1980,
+    0xff5e8d0a, 0xff5e814f, 0xff5f1341, 0xff5ebfbd, 0xff5f524f, 0xff5ed64e, 0xff5f47f6, 0xff5e66d9,
+    0xff5ea8ac, 0xff5dfe3e, 0xff5ed046, 0xff5ec2b1, 0xff5dcfe7, 0xff5ec1e5, 0xff5e75ec, 0xff5e742d,
+    0xff5e9dd0, 0xff5da561, 0xff5d9f75, 0xff5e40df, 0xff5d6f7d, 0xff5e578b, 0xff5e3c91, 0xff5dd84c,
+    0xff5e1295, 0xff5de1c7, 0xff5d24a3, 0xff5d2cfb, 0xff5db075, 0xff5cc896, 0xff5d2eda, 0xff5ca49f,
+    0xff5d07d0, 0xff5d72fd, 0xff5c8bc7, 0xff5ce58c, 0xff5d4391, 0xff5d081a, 0xff5c70a0, 0xff5d1291,
+    0xff5d1274, 0xff5cf196, 0xff5cf30f, 0xff5cfd8e, 0xff5cc36a, 0xff5cb3d2, 0xff5c54e1, 0xff5c5873,
+    0xff5b9cff, 0xff5c8cc7, 0xff5c63f9, 0xff5b502a, 0xff5c1f08, 0xff5c0f85, 0xff5b3bbe, 0xff5c11ce,
+    0xff5bf1c3, 0xff5c1c5e, 0xff5aec7b, 0xff5bd306, 0xff5ac0b4, 0xff5ba1f6, 0xff5b507d, 0xff5a90e1,
+    0xff5b7130, 0xff5b308f, 0xff5b6531, 0xff5b6330, 0xff5b3124, 0xff5b20ed, 0xff5a531b, 0xff5b2de9,
+    0xff5a2049, 0xff5a8806, 0xff5a1068, 0xff5ac5be, 0xff5a3a38, 0xff5a45e5, 0xff5abfd9, 0xff59bc7c,
+    0xff5a362e, 0xff597178, 0xff59a70e, 0xff5a5492, 0xff5a5323, 0xff59aa7c, 0xff59a9db, 0xff59ce11,
+    0xff590b11, 0xff59c8a4, 0xff59fe2c, 0xff58fa07, 0xff59c427, 0xff593905, 0xff59b34e, 0xff591332,
+    0xff5971d7, 0xff5995f5, 0xff597336, 0xff5876e3, 0xff595e5c, 0xff593524, 0xff5912e1, 0xff590283,
+    0xff59054b, 0xff58ceeb, 0xff5849a5, 0xff58f860, 0xff58e743, 0xff58b2d5, 0xff587e4a, 0xff586f8d,
+    0xff587364, 0xff578456, 0xff5865a2, 0xff58632b, 0xff576c1e, 0xff580fa5, 0xff573e23, 0xff571bdc,
+    0xff57df8c, 0xff575f59, 0xff57d224, 0xff5704a4, 0xff57b264, 0xff57b2bc, 0xff572bac, 0xff57a05d,
+    0xff56b2a1, 0xff56effb, 0xff575026, 0xff56a4c0, 0xff56cb00, 0xff56ec46, 0xff56ff18, 0xff572ea0,
+    0xff570389, 0xff56f49c, 0xff56206c, 0xff55d37a, 0xff561e09, 0xff56b44e, 0xff561343, 0xff56a21f,
+    0xff55a5c7, 0xff564e99, 0xff5665be, 0xff561784, 0xff55f496, 0xff5657e6, 0xff55e74b, 0xff560324,
+    0xff5613ee, 0xff54f036, 0xff55bfaa, 0xff54fe50, 0xff55b17a, 0xff55b5a7, 0xff5554cf, 0xff554549,
+    0xff55723b, 0xff55113d, 0xff552a07, 0xff547c0e, 0xff555e29, 0xff55226b, 0xff5512cb, 0xff54d6fc,
+    0xff5456f1, 0xff541372, 0xff54a792, 0xff54a72d, 0xff54d175, 0xff5451f4, 0xff5450b6, 0xff53c374,
+    0xff538670, 0xff53986a, 0xff547370, 0xff538af3, 0xff5432f0, 0xff5422a6, 0xff543262, 0xff54020a,
+    0xff53ddc6, 0xff538c7f, 0xff53074a, 0xff5347cc, 0xff5370d0, 0xff53650b, 0xff53a5d2, 0xff53ae9e,
+    0xff52beaf, 0xff538ebf, 0xff5361ec, 0xff532fde, 0xff5320d8, 0xff524929, 0xff52d501, 0xff526ce9,
+    0xff52dbe9, 0xff5317a3, 0xff52e4d7, 0xff5298c9, 0xff52b383, 0xff52d850, 0xff51b054, 0xff52afac,
+    0xff529e15, 0xff529d7e, 0xff519959, 0xff525679, 0xff51ade4, 0xff5169be, 0xff5233ac, 0xff5223ab,
+    0xff521f5a, 0xff520299, 0xff51e549, 0xff51ae34, 0xff51d250, 0xff50d50f, 0xff5188db, 0xff51bdbe,
+    0xff509cfd, 0xff5181b7, 0xff5165cd, 0xff50565c, 0xff50e2b4, 0xff513617, 0xff505e65, 0xff50709a,
+    0xff507905, 0xff5101cc, 0xff501c2a, 0xff504570, 0xff4fc07e, 0xff4ff2a0, 0xff505236, 0xff509536,
+    0xff50824e, 0xff4fcfcc, 0xff4ff04f, 0xff4fc366, 0xff4f66e8, 0xff504e3b, 0xff504f13, 0xff4fd165,
+    0xff4fc940, 0xff4f98b9, 0xff4ef0f9, 0xff4fcd53, 0xff4f85b3, 0xff4efb79, 0xff4fb559, 0xff4f571f,
+    0xff4f14c4, 0xff4f8f25, 0xff4f0ec5, 0xff4ea6c1, 0xff4ece4a, 0xff4f4f5f, 0xff4e5b47, 0xff4eb4ed,
+    0xff4ee8a6, 0xff4df50c, 0xff4e0f2d, 0xff4eef47, 0xff4ed043, 0xff4e496e, 0xff4ea646, 0xff4df4d0,
+    0xff4de17b, 0xff4e0cac, 0xff4e871a, 0xff4e4374, 0xff4e0905, 0xff4d8664, 0xff4e4f95, 0xff4e2e75,
+    0xff4d6bca, 0xff4df360, 0xff4df148, 0xff4dd609, 0xff4d2933, 0xff4db69a, 0xff4d3353, 0xff4d5508,
+    0xff4cade4, 0xff4d45a2, 0xff4ceab8, 0xff4c8ad5, 0xff4d75b9, 0xff4c5806, 0xff4d4efc, 0xff4d3866,
+    0xff4ce099, 0xff4c166b, 0xff4cd12d, 0xff4c8a05, 0xff4ce822, 0xff4be660, 0xff4bd65a, 0xff4c045f,
+    0xff4ca058, 0xff4c11f9, 0xff4bd630, 0xff4c5af9, 0xff4c189e, 0xff4b7322, 0xff4bac1f, 0xff4bfa13,
+    0xff4c11ef, 0xff4b4f4a, 0xff4b2510, 0xff4b630c, 0xff4bf449, 0xff4b999b, 0xff4b9a74, 0xff4abc79,
+    0xff4aae98, 0xff4b623b, 0xff4a730f, 0xff4a75e0, 0xff4a4c7a, 0xff4ac0e8, 0xff4b27b6, 0xff4a3c1e,
+    0xff4a0605, 0xff4aa916, 0xff4b05ca, 0xff4a0f14, 0xff4a5938, 0xff49f565, 0xff4a4a9f, 0xff4a6b4e,
+    0xff4a41a2, 0xff499855, 0xff49fe85, 0xff49af81, 0xff4a6016, 0xff49ceb7, 0xff49a2e4, 0xff4a2d4b,
+    0xff4a2e93, 0xff4950cb, 0xff49e861, 0xff49f91c, 0xff49b4ec, 0xff491cff, 0xff494a81, 0xff491878,
+    0xff48f61d, 0xff499837, 0xff49240f, 0xff49528a, 0xff4974aa, 0xff485497, 0xff48455a, 0xff48ddcd,
+    0xff48c6bf, 0xff4918db, 0xff48febd, 0xff48ff21, 0xff48327d, 0xff47cde9, 0xff485ba0, 0xff4856d0,
+    0xff4835e8, 0xff487fc8, 0xff487e1f, 0xff47ad19, 0xff4834dd, 0xff473ed7, 0xff47994d, 0xff480b56,
+    0xff4703bb, 0xff47b52a, 0xff476ca8, 0xff471375, 0xff4746c1, 0xff46c24c, 0xff47b483, 0xff4715da,
+    0xff47aa2a, 0xff46d6e3, 0xff46baa7, 0xff474be4, 0xff464634, 0xff468f73, 0xff47407a, 0xff473891,
+    0xff467a3c, 0xff47187f, 0xff47098c, 0xff46dfe5, 0xff46e7ff, 0xff460580, 0xff461351, 0xff45b775,
+    0xff4668bc, 0xff45bfe0, 0xff45d1c6, 0xff45bff3, 0xff4578a2, 0xff45d545, 0xff45c635, 0xff45eab8,
+    0xff45109e, 0xff454a31, 0xff460ef0, 0xff44d74e, 0xff455273, 0xff44f54d, 0xff453599, 0xff44c7b0,
+    0xff44ff6e, 0xff4599f2, 0xff44d683, 0xff44d7e3, 0xff445dab, 0xff44d18d, 0xff447d3e, 0xff44c305,
+    0xff453258, 0xff43f036, 0xff45086a, 0xff44bf3a, 0xff44e907, 0xff4420a1, 0xff440b0f, 0xff43b211,
+    0xff4397bf, 0xff43c9d1, 0xff436137, 0xff43ce97, 0xff437fe6, 0xff43d2ed, 0xff433f10, 0xff433fca,
+    0xff43035f, 0xff436291, 0xff42fb46, 0xff438bc0, 0xff43f6f8, 0xff42ed95, 0xff4353a1, 0xff42c930,
+    0xff4367f5, 0xff42c0e7, 0xff42d83e, 0xff426e5e, 0xff4335f2, 0xff427154, 0xff425bb9, 0xff429d8c,
+    0xff426f68, 0xff422ebc, 0xff42cc84, 0xff41e8d1, 0xff41c000, 0xff41b0b8, 0xff41e911, 0xff42c04e,
+    0xff419347, 0xff41a26a, 0xff4199b1, 0xff425346, 0xff419ea8, 0xff41bfcd, 0xff424a70, 0xff423f99,
+    0xff41eca2, 0xff41e295, 0xff42094a, 0xff412d38, 0xff411849, 0xff417b49, 0xff411c30, 0xff413850,
+    0xff4172bc, 0xff409356, 0xff40dee8, 0xff40ceee, 0xff4169fa, 0xff40ee19, 0xff4039b1, 0xff406fd1,
+    0xff40750c, 0xff411ed7, 0xff403fd8, 0xff3fe585, 0xff400d2c, 0xff40822c, 0xff3feac0, 0xff3fc330,
+    0xff409410, 0xff40843f, 0xff402805, 0xff3fbe6c, 0xff3ff88b, 0xff4067c3, 0xff3f3aa1, 0xff401197,
+    0xff3fb58f, 0xff3efc1d, 0xff3fe6e0, 0xff3f27bd, 0xff3fd381, 0xff3fb17e, 0xff3ed0cb, 0xff3f4da3,
+    0xff3f750c, 0xff3f333e, 0xff3f15d9, 0xff3f6507, 0xff3f1f7e, 0xff3e4438, 0xff3e69a5, 0xff3ec662,
+    0xff3f208e, 0xff3f1056, 0xff3ef37c, 0xff3ef051, 0xff3ed49f, 0xff3ed8e5, 0xff3e4d93, 0xff3e3eb4,
+    0xff3e50bd, 0xff3dcff5, 0xff3e2763, 0xff3e54ef, 0xff3e5402, 0xff3d6dcf, 0xff3da0dc, 0xff3d72f3,
+    0xff3e0f64, 0xff3e1a0e, 0xff3ce019, 0xff3df10a, 0xff3deec5, 0xff3cfb9e, 0xff3d2eff, 0xff3d3c2c,
+    0xff3d2fc7, 0xff3d43db, 0xff3ce8a6, 0xff3cddfc, 0xff3c8728, 0xff3d508e, 0xff3d26b3, 0xff3c414d,
+    0xff3c1e99, 0xff3c4190, 0xff3d09fd, 0xff3c5eca, 0xff3cc837, 0xff3c5245, 0xff3c9499, 0xff3c1ccb,
+    0xff3bc282, 0xff3bdea4, 0xff3bdaa3, 0xff3c7a04, 0xff3b8c94, 0xff3c3dd7, 0xff3b5dd5, 0xff3b2805,
+    0xff3b0055, 0xff3c0f0f, 0xff3b33ab, 0xff3bf6d0, 0xff3b38dd, 0xff3ad568, 0xff3bcfdc, 0xff3b9e9d,
+    0xff3adcec, 0xff3b9fac, 0xff3afc2a, 0xff3a6b52, 0xff3b7519, 0xff3b2146, 0xff3a2cd8, 0xff3b408a,
+    0xff3ab8af, 0xff3a8237, 0xff3b01c0, 0xff39f667, 0xff3af589, 0xff3a2eb6, 0xff39ace0, 0xff39dbf4,
+    0xff3a8643, 0xff39d0b0, 0xff3a9032, 0xff39bef9, 0xff39fdd6, 0xff3a37c8, 0xff39db07, 0xff39afb6,
+    0xff39f45a, 0xff39f887, 0xff397e86, 0xff390481, 0xff397b0d, 0xff39c596, 0xff396531, 0xff3952ae,
+    0xff398773, 0xff38aa2c, 0xff392def, 0xff38b65a, 0xff3961bc, 0xff388c80, 0xff38e920, 0xff383d07,
+    0xff38ca45, 0xff3904f3, 0xff38a9d0, 0xff38c490, 0xff389e27, 0xff37e054, 0xff3893bc, 0xff38afb6,
+    0xff387322, 0xff37c082, 0xff37b916, 0xff3805bc, 0xff37e06d, 0xff3823e3, 0xff37c19d, 0xff382515,
+    0xff37af77, 0xff37cfc7, 0xff37a9dd, 0xff378605, 0xff36f56b, 0xff37b720, 0xff36dd50, 0xff370284,
+    0xff3749e7, 0xff37131f, 0xff370482, 0xff36f314, 0xff370a2f, 0xff372409, 0xff37004c, 0xff36c58d,
+    0xff36e0bb, 0xff368171, 0xff36727b, 0xff36996e, 0xff3600d6, 0xff369010, 0xff3669a4, 0xff361396,
+    0xff3649e4, 0xff35f399, 0xff356e54, 0xff3630b3, 0xff36557c, 0xff362246, 0xff3586c4, 0xff3574a8,
+    0xff355093, 0xff35c9f1, 0xff3530bd, 0xff35b394, 0xff356be3, 0xff34be12, 0xff3591f1, 0xff350f47,
+    0xff34ae6d, 0xff34b89c, 0xff35753d, 0xff3583a5, 0xff348add, 0xff352334, 0xff34e886, 0xff34d9b9,
+    0xff344258, 0xff350558, 0xff340398, 0xff34b015, 0xff3452bc, 0xff3490e9, 0xff346aaf, 0xff342861,
+    0xff348796, 0xff3449ef, 0xff3453a7, 0xff33af62, 0xff33f74b, 0xff33fb08, 0xff338c36, 0xff3416dc,
+    0xff33a36d, 0xff335297, 0xff339735, 0xff32f79e, 0xff33b500, 0xff33a580, 0xff33b4d2, 0xff32bfdc,
+    0xff3370d5, 0xff33911c, 0xff332aca, 0xff331c0f, 0xff326d62, 0xff32c8fa, 0xff32c280, 0xff32f9da,
+    0xff331568, 0xff32a5ba, 0xff3284a9, 0xff320f2b, 0xff329814, 0xff3208dc, 0xff325894, 0xff32a598,
+    0xff326e96, 0xff3264c1, 0xff3275ad, 0xff31859d, 0xff326e3b, 0xff31cabc, 0xff31dec0, 0xff312d4d,
+    0xff316412, 0xff313744, 0xff31e74d, 0xff3176d3, 0xff31a896, 0xff317660, 0xff31b571, 0xff31861c,
+    0xff3137b2, 0xff3177f2, 0xff31066b, 0xff318398, 0xff315590, 0xff30d3bd, 0xff30fe0c, 0xff311886,
+    0xff30cc38, 0xff30597e, 0xff3100dd, 0xff30208b, 0xff308b9e, 0xff2fe9fc, 0xff30961a, 0xff300393,
+    0xff303746, 0xff2f8576, 0xff306701, 0xff302571, 0xff3048a7, 0xff2f7040, 0xff301586, 0xff301800,
+    0xff2fdfab, 0xff30017b, 0xff2fc1a3, 0xff2f0612, 0xff2ed0fd, 0xff2ef69d, 0xff2f6b55, 0xff2f9769,
+    0xff2ee346, 0xff2f6536, 0xff2f410f, 0xff2ec0a5, 0xff2ee434, 0xff2f37af, 0xff2ed247, 0xff2e35f8,
+    0xff2ef3e6, 0xff2e83af, 0xff2eac44, 0xff2e42fe, 0xff2df5e1, 0xff2e671d, 0xff2ea822, 0xff2e5c4e,
+    0xff2e0ce8, 0xff2e2848, 0xff2e0417, 0xff2d7653, 0xff2e0af9, 0xff2d4d4f, 0xff2dc53e, 0xff2dd80d,
+    0xff2dccc1, 0xff2d535b, 0xff2d5298, 0xff2dc314, 0xff2d64fc, 0xff2dc61b, 0xff2d02c6, 0xff2d4754,
+    0xff2c8027, 0xff2c9ff5, 0xff2d29b8, 0xff2d56d9, 0xff2c6d4d, 0xff2cb638, 0xff2cb33d, 0xff2ca2ed,
+    0xff2c8402, 0xff2c843c, 0xff2c968d, 0xff2cd808, 0xff2c8b9f, 0xff2c2edc, 0xff2c9433, 0xff2c238b,
+    0xff2c0292, 0xff2c64a1, 0xff2bd3b0, 0xff2c65bc, 0xff2bf6a1, 0xff2b9146, 0xff2b6eb7, 0xff2bb506,
+    0xff2ba561, 0xff2b8162, 0xff2b2fe7, 0xff2b6433, 0xff2b8cf3, 0xff2b3239, 0xff2b016d, 0xff2b708f,
+    0xff2b5f8f, 0xff2b5090, 0xff2b1694, 0xff2aa20f, 0xff2ad3db, 0xff2ac4c2, 0xff2ad843, 0xff2adc58,
+    0xff2a7e9e, 0xff2ad079, 0xff2a07a3, 0xff2a755d, 0xff2a3dd5, 0xff2a7d25, 0xff2a6d10, 0xff2a842c,
+    0xff2a75f9, 0xff2a150d, 0xff298ceb, 0xff2a1c48, 0xff29e5d0, 0xff2a0fd7, 0xff29d705, 0xff2a2598,
+    0xff298480, 0xff2983e9, 0xff297128, 0xff29860e, 0xff298560, 0xff29b812, 0xff294510, 0xff29869e,
+    0xff28f073, 0xff290557, 0xff28e4a1, 0xff291d02, 0xff28c317, 0xff283610, 0xff28c507, 0xff28a582,
+    0xff2860c3, 0xff2874fd, 0xff282578, 0xff28762d, 0xff27fcc3, 0xff287d5c, 0xff2846fa, 0xff27f077,
+    0xff27c62b, 0xff27e1da, 0xff27bfe1, 0xff27c4c5, 0xff2792a3, 0xff278375, 0xff2759fc, 0xff276242,
+    0xff273355, 0xff2753ac, 0xff27431c, 0xff2716c0, 0xff2707b7, 0xff26cfed, 0xff26d4db, 0xff26d8f2,
+    0xff26c025, 0xff26e32b, 0xff26c231, 0xff26a2cf, 0xff267d35, 0xff265a88, 0xff2645ed, 0xff263c52,
+    0xff26498b, 0xff262cd8, 0xff25f71a, 0xff25efe3, 0xff25e06b, 0xff25d705, 0xff25b8a3, 0xff25bff0,
+    0xff259770, 0xff2595a1, 0xff257942, 0xff255c00, 0xff2558ef, 0xff254f58, 0xff2539cb, 0xff256203,
+    0xff2510b4, 0xff2509c9, 0xff24f9f6, 0xff24e13d, 0xff24c029, 0xff24dd21, 0xff24b280, 0xff24b807,
+    0xff248b5a, 0xff247004, 0xff24601d, 0xff2474e4, 0xff244003, 0xff245001, 0xff244c27, 0xff241336,
+    0xff241ba9, 0xff240154, 0xff23e2d0, 0xff2402c5, 0xff23c6d4, 0xff23d095, 0xff23c6b2, 0xff23921c,
+    0xff238c88, 0xff239329, 0xff2367b1, 0xff2374bd, 0xff236703, 0xff235557, 0xff2348c9, 0xff231185,
+    0xff230543, 0xff232307, 0xff22ff9d, 0xff22efd8, 0xff22e14e, 0xff22b4a0, 0xff22ad65, 0xff22aab3,
+    0xff2295ff, 0xff22a2db, 0xff229d10, 0xff227ba8, 0xff226881, 0xff2251e7, 0xff223ade, 0xff2229f0,
+    0xff222c7b, 0xff224072, 0xff21f1ff, 0xff21fde4, 0xff21c024, 0xff21b0d6, 0xff21b230, 0xff21d7be,
+    0xff21b619, 0xff21f360, 0xff219ada, 0xff217d43, 0xff217d3b, 0xff215f1d, 0xff213c0c, 0xff217385,
+    0xff213641, 0xff211565, 0xff211301, 0xff21056e, 0xff20e969, 0xff21022b, 0xff20d638, 0xff210276,
+    0xff20bb40, 0xff20a49d, 0xff20c129, 0xff20a174, 0xff206e6c, 0xff20a3ce, 0xff206696, 0xff208411,
+    0xff20372e, 0xff201213, 0xff2015fa, 0xff203451, 0xff1ffa8d, 0xff202423, 0xff201371, 0xff1fe2d4,
+    0xff1fbefc, 0xff1fae2b, 0xff1f97ba, 0xff1f8e54, 0xff1f702e, 0xff1f9275, 0xff1f73f8, 0xff1f4e20,
+    0xff1f008c, 0xff1f38dd, 0xff1f22d7, 0xff1f19d8, 0xff1f148a, 0xff1f1c33, 0xff1f03ec, 0xff1ebef3,
+    0xff1e859a, 0xff1ee3c3, 0xff1ed33d, 0xff1e9810, 0xff1e553c, 0xff1e5a6c, 0xff1e69df, 0xff1e6312,
+    0xff1e341e, 0xff1e73bf, 0xff1e7491, 0xff1e5325, 0xff1e53a0, 0xff1e049b, 0xff1dd684, 0xff1df340,
+    0xff1dd3a2, 0xff1de5d6, 0xff1db401, 0xff1dc302, 0xff1da40e, 0xff1d6f09, 0xff1d41dc, 0xff1d73b9,
+    0xff1d83e0, 0xff1d4375, 0xff1d18b0, 0xff1d06ee, 0xff1cc25f, 0xff1d15e3, 0xff1cdcd4, 0xff1cd77c,
+    0xff1cd49e, 0xff1caf64, 0xff1c9900, 0xff1ca638, 0xff1c6ddf, 0xff1c77c3, 0xff1ca3ad, 0xff1c7499,
+    0xff1c4a51, 0xff1c2826, 0xff1c105e, 0xff1c0dc9, 0xff1be2a8, 0xff1bdf56, 0xff1bdf9c, 0xff1bcfca,
+    0xff1bca28, 0xff1b9143, 0xff1b9055, 0xff1b9986, 0xff1bbe27, 0xff1ba2b2, 0xff1b69c8, 0xff1b718f,
+    0xff1b3f39, 0xff1b407c, 0xff1af911, 0xff1b1910, 0xff1b2e42, 0xff1b355a, 0xff1b158b, 0xff1adb69,
+    0xff1ad4e7, 0xff1b1547, 0xff1ae108, 0xff1ab217, 0xff1ac46f, 0xff1a84cb, 0xff1ac526, 0xff1a5047,
+    0xff1a4aaf, 0xff1a9548, 0xff1a180d, 0xff1a9d16, 0xff1a2dd8, 0xff19c61e, 0xff1a25f6, 0xff1a4690,
+    0xff1a1476, 0xff1a50e9, 0xff1a3a7f, 0xff1a1c86, 0xff1989b9, 0xff19b647, 0xff19758b, 0xff196a81,
+    0xff19a68c, 0xff19ceb7, 0xff19aba0, 0xff1947f5, 0xff19a1cc, 0xff18d523, 0xff19532c, 0xff1901f0,
+    0xff196027, 0xff1982f8, 0xff18ca4e, 0xff18709e, 0xff18e32f, 0xff185cd9, 0xff1926f7, 0xff18f0e3,
+    0xff183244, 0xff17f051, 0xff18dfbe, 0xff189c6f, 0xff1807c9, 0xff18a4d1, 0xff17a526, 0xff18b684,
+    0xff183796, 0xff1824f6, 0xff1772a3, 0xff181c7b, 0xff183548, 0xff18365d, 0xff1801a0, 0xff1805b3,
+    0xff1814c1, 0xff1770ef, 0xff1786cc, 0xff17956c, 0xff16fa9d, 0xff172b5e, 0xff176d63, 0xff172522,
+    0xff178639, 0xff16c62c, 0xff16e4b0, 0xff171cfb, 0xff1721bb, 0xff172723, 0xff1701c6, 0xff16f25f,
+    0xff16c686, 0xff16d044, 0xff163760, 0xff16f027, 0xff168de4, 0xff1691b4, 0xff15a043, 0xff1671be,
+    0xff15ac75, 0xff15e18d, 0xff162bbe, 0xff15e4c4, 0xff160ea2, 0xff15fde8, 0xff15edc3, 0xff1540ab,
+    0xff16059e, 0xff15e540, 0xff15853f, 0xff14ed32, 0xff15672e, 0xff14c3e7, 0xff156cd9, 0xff14b3ac,
+    0xff154db0, 0xff157743, 0xff1516b9, 0xff149ddd, 0xff147d34, 0xff14c3ea, 0xff147395, 0xff144a79,
+    0xff14649c, 0xff14e55c, 0xff141811, 0xff143651, 0xff1455be, 0xff13eae4, 0xff14585a, 0xff13f22f,
+    0xff142709, 0xff142839, 0xff13630c, 0xff13e64c, 0xff13e5ca, 0xff139f3f, 0xff13c760, 0xff13c82d,
+    0xff13cbd2, 0xff137456, 0xff136e96, 0xff133bb9, 0xff13b501, 0xff13b912, 0xff134404, 0xff135d94,
+    0xff12ada7, 0xff1327df, 0xff1318ab, 0xff126040, 0xff1335c3, 0xff132475, 0xff132871, 0xff12c7e9,
+    0xff12cbeb, 0xff12d0d7, 0xff126607, 0xff11e148, 0xff12b5c2, 0xff125696, 0xff126e8c, 0xff12486d,
+    0xff1227ea, 0xff126565, 0xff1255b7, 0xff127923, 0xff116aff, 0xff11fde4, 0xff11ef5a, 0xff120646,
+    0xff11a7ea, 0xff11bf35, 0xff11d684, 0xff11673c, 0xff11a2b4, 0xff1157bd, 0xff1134b2, 0xff116053,
+    0xff10e50a, 0xff1178a4, 0xff11568d, 0xff111ece, 0xff1122a3, 0xff106cf4, 0xff10f015, 0xff1107db,
+    0xff101809, 0xff106f48, 0xff109950, 0xff0ffcb2, 0xff106720, 0xff108efd, 0xff106efb, 0xff109948,
+    0xff101546, 0xff0fc1ca, 0xff1056c0, 0xff0fb620, 0xff0fe813, 0xff103896, 0xff0fd7a5, 0xff10254c,
+    0xff0f745c, 0xff0f840b, 0xff0ee9f3, 0xff0f3190, 0xff0f6802, 0xff0f832a, 0xff0f6fa6, 0xff0f1ded,
+    0xff0f4f3b, 0xff0ee60a, 0xff0ea3fa, 0xff0eb4a4, 0xff0ec639, 0xff0eff34, 0xff0e852b, 0xff0e76a1,
+    0xff0e0fb0, 0xff0e50c7, 0xff0e5439, 0xff0ee59e, 0xff0e54bc, 0xff0ea61c, 0xff0e4799, 0xff0e05b9,
+    0xff0e39b6, 0xff0e1806, 0xff0db584, 0xff0e5872, 0xff0df74f, 0xff0d6f88, 0xff0db077, 0xff0d65d5,
+    0xff0d66a0, 0xff0d452d, 0xff0d556c, 0xff0d7761, 0xff0d75b9, 0xff0d3593, 0xff0d6da3, 0xff0d5c6f,
+    0xff0d03cf, 0xff0d3ddc, 0xff0cd59d, 0xff0c5746, 0xff0c7012, 0xff0cc2fa, 0xff0cc6d5, 0xff0d0645,
+    0xff0cb76f, 0xff0cbd34, 0xff0c992f, 0xff0c6606, 0xff0c3660, 0xff0c4498, 0xff0c2717, 0xff0c7222,
+    0xff0be4da, 0xff0c4fa0, 0xff0bf46b, 0xff0bb534, 0xff0be7ab, 0xff0bd8e3, 0xff0b2143, 0xff0bf18d,
+    0xff0bf7e6, 0xff0b9fe1, 0xff0bd626, 0xff0b56cb, 0xff0b46ba, 0xff0b8034, 0xff0b58bf, 0xff0a9789,
+    0xff0b766f, 0xff0b18d9, 0xff0b42c4, 0xff0b1f80, 0xff0ac33b, 0xff0b3723, 0xff0a7dd7, 0xff0b04df,
+    0xff0af41c, 0xff0ad181, 0xff0a888d, 0xff09e5be, 0xff0ab42c, 0xff0aa602, 0xff0a979f, 0xff0a5fbf,
+    0xff0a61f7, 0xff0a519d, 0xff09f630, 0xff097434, 0xff0a5296, 0xff0a4edd, 0xff0a1608, 0xff09569e,
+    0xff099544, 0xff09bfc1, 0xff09c03e, 0xff09e3c6, 0xff0998b8, 0xff09d5da, 0xff0959a4, 0xff097327,
+    0xff0962aa, 0xff09853a, 0xff097d59, 0xff096f3a, 0xff0937b5, 0xff08cb04, 0xff09038d, 0xff081398,
+    0xff08b996, 0xff08e7c6, 0xff08e0c1, 0xff08c799, 0xff0827b4, 0xff086938, 0xff086ecd, 0xff08b183,
+    0xff07a7d8, 0xff0890e6, 0xff088888, 0xff084793, 0xff082bbc, 0xff0835a7, 0xff081793, 0xff08382f,
+    0xff083657, 0xff07e85f, 0xff080f7c, 0xff07b2e9, 0xff07b7c5, 0xff07bab8, 0xff07184a, 0xff07afba,
+    0xff07584b, 0xff0740b6, 0xff078161, 0xff075522, 0xff06fa2e, 0xff067801, 0xff0631fd, 0xff0617d2,
+    0xff06d04d, 0xff06d3d2, 0xff06c329, 0xff07041f, 0xff06c7a7, 0xff06d57c, 0xff0635c9, 0xff064db8,
+    0xff0663d7, 0xff065401, 0xff062f79, 0xff055066, 0xff05b70a, 0xff05437d, 0xff061919, 0xff05f342,
+    0xff061631, 0xff060f20, 0xff057b90, 0xff053cde, 0xff0599f1, 0xff057af4, 0xff04f35d, 0xff050ab5,
+    0xff05636e, 0xff059e15, 0xff046ebe, 0xff04ada4, 0xff05372f, 0xff054324, 0xff04764a, 0xff0507de,
+    0xff04e374, 0xff051095, 0xff04d821, 0xff04423e, 0xff046f2d, 0xff0480af, 0xff04b68e, 0xff0494ce,
+    0xff04a9d9, 0xff0379ab, 0xff047f3e, 0xff03d008, 0xff0382a4, 0xff04283b, 0xff04290c, 0xff038d8e,
+    0xff0351d9, 0xff03c071, 0xff03f6bf, 0xff03b464, 0xff03d692, 0xff036c34, 0xff039794, 0xff03b03e,
+    0xff032354, 0xff03a40f, 0xff0309f2, 0xff0366a6, 0xff034779, 0xff0346a4, 0xff0272ac, 0xff022a51,
+    0xff031f47, 0xff023f21, 0xff0292d4, 0xff02c9a7, 0xff01c1e6, 0xff027827, 0xff02b738, 0xff01f26f,
+    0xff028919, 0xff0278b2, 0xff028882, 0xff0257fb, 0xff0272dc, 0xff0262d4, 0xff02176d, 0xff01483c,
+    0xff01b8d5, 0xff01193e, 0xff0201a7, 0xff01672a, 0xff00da5f, 0xff016036, 0xff01a8b7, 0xff0199c0,
+    0xff008848, 0xff018699, 0xff014459, 0xff0170c5, 0xff01226d, 0xff00b6d3, 0xff01476a, 0xff00f3aa,
+    0xff00e3f5, 0xff011187, 0xff010e98, 0xff0098a0, 0xfeffd74e, 0xff00d938, 0xfeffb42a, 0xfeffebcc,
+    0xff00a26b, 0xff009a57, 0xff000374, 0xfeffc710, 0xfeff6660, 0xfeff710b, 0xfeffd2d9, 0xff0026a0,
+    0xfeffab41, 0xfeff738c, 0xfefeeca0, 0xfeffb4d3, 0xfeffd421, 0xfefec284, 0xfeff581b, 0xfeffb0a5,
+    0xfeffb512, 0xfeff344a, 0xfeff29d6, 0xfeff7950, 0xfeff60f6, 0xfefe7d45, 0xfeff190e, 0xfefe9cd7,
+    0xfefe9492, 0xfefe69ac, 0xfefef62f, 0xfefed50b, 0xfefec92a, 0xfefdd291, 0xfefea4a3, 0xfefde61e,
+    0xfefe5121, 0xfefd72de, 0xfefdba8a, 0xfefe49c1, 0xfefd9bbc, 0xfefd6f7d, 0xfefdeeee, 0xfefd5b7b,
+    0xfefd391d, 0xfefdc1b6, 0xfefd4ece, 0xfefde741, 0xfefce572, 0xfefd68b4, 0xfefd0b93, 0xfefda660,
+    0xfefda22c, 0xfefcff10, 0xfefc6275, 0xfefd7f15, 0xfefcad79, 0xfefd0cf5, 0xfefc9e7e, 0xfefd2fe5,
+    0xfefca998, 0xfefcbcca, 0xfefd0a0a, 0xfefc8441, 0xfefc7258, 0xfefcc6ca, 0xfefbf950, 0xfefc480f,
+    0xfefcaf21, 0xfefbefa2, 0xfefb6179, 0xfefbf45f, 0xfefc23c4, 0xfefc0874, 0xfefb6764, 0xfefc08f6,
+    0xfefc16d3, 0xfefbeda3, 0xfefaf748, 0xfefb6961, 0xfefbab4f, 0xfefbd1a4, 0xfefae2b2, 0xfefb88ba,
+    0xfefb4a7a, 0xfefb1e9c, 0xfefb1053, 0xfefaf54b, 0xfefafb66, 0xfefb2f7a, 0xfefae6b8, 0xfefa2c56,
+    0xfefb172d, 0xfefa6139, 0xfefa8423, 0xfefa6a1e, 0xfefaf595, 0xfefad19e, 0xfef9c903, 0xfef9e4e6,
+    0xfefa9468, 0xfefaa47a, 0xfefa6a2c, 0xfefa5a1c, 0xfefa39dc, 0xfef99579, 0xfefa4a96, 0xfefa06ba,
+    0xfef9da07, 0xfefa0687, 0xfef93c82, 0xfef922ef, 0xfef9b8e1, 0xfef8c7e6, 0xfef9a9a6, 0xfef98357,
+    0xfef989f2, 0xfef92ae8, 0xfef95a5d, 0xfef85046, 0xfef92f5e, 0xfef950ec, 0xfef87c90, 0xfef8fc70,
+    0xfef922f8, 0xfef8c18d, 0xfef89aa4, 0xfef81fb3, 0xfef8d661, 0xfef84baf, 0xfef89956, 0xfef79ec4,
+    0xfef89801, 0xfef7f780, 0xfef85a69, 0xfef82026, 0xfef83948, 0xfef78af5, 0xfef74fe9, 0xfef7e001,
+    0xfef78e7c, 0xfef7d41b, 0xfef7b2a4, 0xfef76963, 0xfef79061, 0xfef77eca, 0xfef6b62e, 0xfef79a41,
+    0xfef716bd, 0xfef787ab, 0xfef7416f, 0xfef6d67a, 0xfef7392d, 0xfef6d731, 0xfef679b5, 0xfef6a5be,
+    0xfef6c286, 0xfef61cc8, 0xfef697d7, 0xfef6ca26, 0xfef669b0, 0xfef6575e, 0xfef60c69, 0xfef5ec78,
+    0xfef65160, 0xfef5fb0d, 0xfef642f1, 0xfef620fc, 0xfef5d652, 0xfef5d824, 0xfef5f0dd, 0xfef607ef,
+    0xfef5e42f, 0xfef5ae89, 0xfef5d8fa, 0xfef4d688, 0xfef591c2, 0xfef4dec4, 0xfef5306e, 0xfef589e5,
+    0xfef4c7c9, 0xfef55411, 0xfef51aec, 0xfef53450, 0xfef470aa, 0xfef54f7c, 0xfef52124, 0xfef4f2f1,
+    0xfef4a950, 0xfef4866d, 0xfef459b0, 0xfef4f1ff, 0xfef3e6e9, 0xfef3f0e0, 0xfef4d276, 0xfef40078,
+    0xfef4a0e3, 0xfef490a0, 0xfef44486, 0xfef3cbc7, 0xfef34b4e, 0xfef412e3, 0xfef44a8c, 0xfef43179,
+    0xfef3d516, 0xfef319b6, 0xfef3daaa, 0xfef32d9e, 0xfef344bf, 0xfef36b0a, 0xfef2d349, 0xfef38890,
+    0xfef3385d, 0xfef2b7a8, 0xfef3271c, 0xfef38283, 0xfef34a0b, 0xfef3383a, 0xfef2748d, 0xfef31b57,
+    0xfef2d2bd, 0xfef2faea, 0xfef2ea97, 0xfef2684b, 0xfef2a3e0, 0xfef2815b, 0xfef24a1f, 0xfef29bbf,
+    0xfef208e8, 0xfef26a25, 0xfef21014, 0xfef23508, 0xfef18f94, 0xfef22afd, 0xfef1bd5a, 0xfef21ba7,
+    0xfef15953, 0xfef1f9bf, 0xfef1b275, 0xfef11dfa, 0xfef0c982, 0xfef1ab57, 0xfef19b2f, 0xfef12d08,
+    0xfef16439, 0xfef12bca, 0xfef15b67, 0xfef0b719, 0xfef0e950, 0xfef11534, 0xfef0a61e, 0xfef11ac0,
+    0xfef109cb, 0xfef077b9, 0xfef0af7f, 0xfef03714, 0xfeefcfdb, 0xfef0a92c, 0xfef08479, 0xfef04b63,
+    0xfef018c7, 0xfeeff7c1, 0xfeeff6d5, 0xfef00af3, 0xfeefb66b, 0xfeefebb2, 0xfeef9529, 0xfeef977f,
+    0xfeefbaf6, 0xfeef0c98, 0xfeeee856, 0xfeefb48f, 0xfeef368d, 0xfeef824c, 0xfeef1591, 0xfeef0627,
+    0xfeeef6c2, 0xfeeee735, 0xfeeeb647, 0xfeef0bad, 0xfeee5420, 0xfeee4ee5, 0xfeee861f, 0xfeee6672,
+    0xfeee4ad1, 0xfeee2154, 0xfeee55f0, 0xfeee8a15, 0xfeee5610, 0xfeee16c7, 0xfeee3276, 0xfeee39b4,
+    0xfeedf698, 0xfeee17f1, 0xfeedc659, 0xfeee3472, 0xfeeda74f, 0xfeeda6ba, 0xfeeda724, 0xfeed23c9,
+    0xfeeda876, 0xfeed9705, 0xfeed9b7c, 0xfeed664a, 0xfeed280c, 0xfeed17ed, 0xfeecf6c4, 0xfeed26fb,
+    0xfeed51b1, 0xfeed297b, 0xfeed0992, 0xfeeca630, 0xfeece8cc, 0xfeeca879, 0xfeed052f, 0xfeed0976,
+    0xfeec47da, 0xfeecd54d, 0xfeecafd2, 0xfeec483c, 0xfeec5783, 0xfeec6b70, 0xfeec4a8d, 0xfeec41ea,
+    0xfeec1710, 0xfeebb845, 0xfeec0888, 0xfeebd61d, 0xfeebc65d, 0xfeebae6b, 0xfeeb48ea, 0xfeec309f,
+    0xfeeba7df, 0xfeeb855a, 0xfeebb203, 0xfeeba1ff, 0xfeeb7adf, 0xfeeb2bb0, 0xfeeb36e1, 0xfeeb6265,
+    0xfeea9716, 0xfeeaf817, 0xfeea9e8c, 0xfeeb49da, 0xfeeafaa4, 0xfeeb29d0, 0xfeeac8b6, 0xfeea9930,
+    0xfeea7881, 0xfeeaaba6, 0xfeea4749, 0xfeeab51d, 0xfeea5804, 0xfeeaa872, 0xfeea838b, 0xfeea39ca,
+    0xfeea2c0e, 0xfeea7855, 0xfeea459b, 0xfeea351f, 0xfeea26a4, 0xfee9ec59, 0xfee9caac, 0xfee91bac,
+    0xfee98891, 0xfee9d4ff, 0xfee9dbfc, 0xfee968a8, 0xfee9ba50, 0xfee928ef, 0xfee920bc, 0xfee98b11,
+    0xfee98a75, 0xfee96bd0, 0xfee88823, 0xfee88ad2, 0xfee93ae8, 0xfee91636, 0xfee8cb81, 0xfee8ad52,
+    0xfee92fa2, 0xfee8f9dd, 0xfee8f744, 0xfee88cbc, 0xfee87ccf, 0xfee8c6f0, 0xfee838ee, 0xfee88b02,
+    0xfee86771, 0xfee82d2d, 0xfee8322b, 0xfee7d8c6, 0xfee7a85c, 0xfee82ba1, 0xfee7f228, 0xfee7133e,
+    0xfee7d30f, 0xfee7acbe, 0xfee78991, 0xfee7c977, 0xfee748dd, 0xfee76cd0, 0xfee75c41, 0xfee7628f,
+    0xfee71851, 0xfee6e865, 0xfee6a05c, 0xfee70e01, 0xfee640d2, 0xfee6ed58, 0xfee66954, 0xfee66673,
+    0xfee6be45, 0xfee69a1f, 0xfee667ff, 0xfee68cc7, 0xfee64739, 0xfee66c6a, 0xfee616db, 0xfee5e6cc,
+    0xfee5d64c, 0xfee5d4a5, 0xfee60c31, 0xfee5c8bf, 0xfee5c894, 0xfee5b96f, 0xfee53dc8, 0xfee55b04,
+    0xfee56711, 0xfee59a8c, 0xfee568ab, 0xfee5a144, 0xfee55715, 0xfee4fb0b, 0xfee5382b, 0xfee4e69e,
+    0xfee517b1, 0xfee541de, 0xfee4d7b2, 0xfee4c886, 0xfee510da, 0xfee4870e, 0xfee447c3, 0xfee4bbdf,
+    0xfee477b5, 0xfee482c1, 0xfee42b70, 0xfee41151, 0xfee47b2b, 0xfee40811, 0xfee3eb61, 0xfee462de,
+    0xfee40883, 0xfee45767, 0xfee3e77e, 0xfee35ea7, 0xfee398bf, 0xfee397f0, 0xfee37860, 0xfee3e329,
+    0xfee389d2, 0xfee3692c, 0xfee35841, 0xfee33662, 0xfee2f967, 0xfee30ec1, 0xfee318eb, 0xfee34d0d,
+    0xfee33beb, 0xfee2d7b0, 0xfee2f79a, 0xfee322a2, 0xfee2c834, 0xfee2c865, 0xfee2a722, 0xfee25b95,
+    0xfee278d9, 0xfee20281, 0xfee236be, 0xfee26886, 0xfee26b2b, 0xfee20d23, 0xfee229e2, 0xfee1e942,
+    0xfee1a927, 0xfee1d8c5, 0xfee1b723, 0xfee1ca08, 0xfee1cb72, 0xfee1ea19, 0xfee1ab3b, 0xfee18975,
+    0xfee168a8, 0xfee1593a, 0xfee19e7b, 0xfee149b1, 0xfee14a21, 0xfee148d5, 0xfee13a5b, 0xfee10c06,
+    0xfee0ccbe, 0xfee0c9be, 0xfee0b9a1, 0xfee09c5c, 0xfee0ba68, 0xfee07118, 0xfee06ccf, 0xfee06b16,
+    0xfee05955, 0xfee07ae7, 0xfee048e3, 0xfee04ace, 0xfedfff9b, 0xfedffc1f, 0xfedfd78f, 0xfedfeb36,
+    0xfedf8139, 0xfedffb55, 0xfedfac24, 0xfedfaa89, 0xfedf80e0, 0xfedf89bf, 0xfedf3b89, 0xfedf507e,
+    0xfedf4dd0, 0xfedf3221, 0xfedf21a5, 0xfedf1be7, 0xfeded2b1, 0xfedee820, 0xfedec0dc, 0xfeded1a4,
+    0xfedea298, 0xfede9949, 0xfede71e5, 0xfede716f, 0xfede6a26, 0xfede67c1, 0xfede3205, 0xfede3e82,
+    0xfede0201, 0xfeddf205, 0xfeddf2d4, 0xfeddf81f, 0xfeddcc36, 0xfeddd832, 0xfeddba34, 0xfeddab5b,
+    0xfedda925, 0xfedd75ba, 0xfedd68b9, 0xfedd6bae, 0xfedd4cee, 0xfedd4312, 0xfedd41c5, 0xfedd119d,
+    0xfedd0982, 0xfedcf72d, 0xfedce037, 0xfedcf23c, 0xfedccc9a, 0xfedcb153, 0xfedcc2bb, 0xfedc9003,
+    0xfedc8682, 0xfedcb04c, 0xfedc6320, 0xfedc6c43, 0xfedc4deb, 0xfedc304e, 0xfedc311c, 0xfedc1c8f,
+    0xfedc0000, 0xfedc11e2, 0xfedbf37b, 0xfedbd7d0, 0xfedbcd25, 0xfedbb13e, 0xfedba000, 0xfedb9b35,
+    0xfedb8002, 0xfedb7940, 0xfedb6ea5, 0xfedb5620, 0xfedb4005, 0xfedb355d, 0xfedb2008, 0xfedb317c,
+    0xfedb1320, 0xfedb1204, 0xfedafaeb, 0xfedad883, 0xfedad32d, 0xfedac39f, 0xfedaa7c2, 0xfeda98bb,
+    0xfeda8fd5, 0xfeda8c50, 0xfeda7444, 0xfeda5a97, 0xfeda4be0, 0xfeda4666, 0xfeda36f7, 0xfeda31f4,
+    0xfeda1c49, 0xfeda19be, 0xfeda0d1a, 0xfed9e4b3, 0xfed9f00e, 0xfeda0784, 0xfed9b683, 0xfed9ab4f,
+    0xfed9af07, 0xfed98009, 0xfed98fa8, 0xfed968f9, 0xfed9447d, 0xfed997b0, 0xfed95ef5, 0xfed93f8c,
+    0xfed94c62, 0xfed91ad1, 0xfed8f55a, 0xfed907da, 0xfed902e6, 0xfed8b888, 0xfed8e2c9, 0xfed8bb22,
+    0xfed8e70e, 0xfed8a9a3, 0xfed896cf, 0xfed8b8f8, 0xfed8a959, 0xfed88613, 0xfed878a9, 0xfed84867,
+    0xfed838cc, 0xfed86aea, 0xfed82248, 0xfed8395a, 0xfed7ea5c, 0xfed7f3e6, 0xfed7ed19, 0xfed7992c,
+    0xfed7af9b, 0xfed7d79e, 0xfed79631, 0xfed7da05, 0xfed7b9e1, 0xfed77d96, 0xfed779ff, 0xfed76aa3,
+    0xfed7567d, 0xfed76a3c, 0xfed7591f, 0xfed74a85, 0xfed73874, 0xfed70b01, 0xfed708e0, 0xfed7194a,
+    0xfed6ea23, 0xfed6d9ce, 0xfed6d8b6, 0xfed6941c, 0xfed68d2e, 0xfed6d277, 0xfed63143, 0xfed68afc,
+    0xfed66ab9, 0xfed66a0d, 0xfed64962, 0xfed638c1, 0xfed6037b, 0xfed64891, 0xfed67126, 0xfed60062,
+    0xfed59622, 0xfed5cc14, 0xfed5a436, 0xfed5baca, 0xfed58dbd, 0xfed57c45, 0xfed5caf7, 0xfed55aa5,
+    0xfed58885, 0xfed5346c, 0xfed5248c, 0xfed57c3b, 0xfed56912, 0xfed51ada, 0xfed538b2, 0xfed4c1cd,
+    0xfed4e8d9, 0xfed506c5, 0xfed4a355, 0xfed4d7fb, 0xfed4eaaf, 0xfed4987b, 0xfed478f6, 0xfed46b98,
+    0xfed410be, 0xfed46a46, 0xfed43bfe, 0xfed3e9be, 0xfed43cd6, 0xfed3ffae, 0xfed40a1f, 0xfed3d353,
+    0xfed3d96d, 0xfed3ebe1, 0xfed3db86, 0xfed40c98, 0xfed3bbfb, 0xfed36321, 0xfed3aa56, 0xfed3a695,
+    0xfed32e3e, 0xfed36a8c, 0xfed37835, 0xfed38caf, 0xfed31c56, 0xfed2e991, 0xfed2e3ee, 0xfed29e6a,
+    0xfed2dbce, 0xfed306da, 0xfed2db58, 0xfed2bb07, 0xfed312cc, 0xfed2ad3e, 0xfed29cad, 0xfed2b4dd,
+    0xfed2983f, 0xfed2f892, 0xfed2b239, 0xfed25a87, 0xfed1e930, 0xfed2a716, 0xfed22195, 0xfed2743e,
+    0xfed23be1, 0xfed1748a, 0xfed268f7, 0xfed15b58, 0xfed1eb6c, 0xfed24ca2, 0xfed2363f, 0xfed2243b,
+    0xfed1f827, 0xfed11857, 0xfed1db8e, 0xfed18104, 0xfed1c8c0, 0xfed1d044, 0xfed13426, 0xfed0fece,
+    0xfed18a3b, 0xfed1493f, 0xfed0cbd1, 0xfed1597d, 0xfed15773, 0xfed12957, 0xfed12a73, 0xfed0cdfb,
+    0xfed09d4a, 0xfed047f8, 0xfed0d8ba, 0xfed0e52f, 0xfed0ba8b, 0xfed092cc, 0xfecfff74, 0xfed099a2,
+    0xfecff942, 0xfed083da, 0xfecf7d2c, 0xfed02b24, 0xfecf8cda, 0xfecf4623, 0xfed01b90, 0xfed00b71,
+    0xfecfe6c5, 0xfecf5c72, 0xfecff7d1, 0xfecff80d, 0xfecec8d8, 0xfecee03d, 0xfecfa917, 0xfecfa6c5,
+    0xfecfa3f9, 0xfecf85de, 0xfecf1e54, 0xfece8cd6, 0xfecf3c35, 0xfecf1dfa, 0xfecf19bf, 0xfecf26c9,
+    0xfece7552, 0xfecf0617, 0xfecec61f, 0xfececc16, 0xfece2124, 0xfecec762, 0xfecdb9df, 0xfecea609,
+    0xfece65ee, 0xfece24dc, 0xfece4681, 0xfece0e81, 0xfece5803, 0xfecd6ae1, 0xfece4eb2, 0xfecdf9a6,
+    0xfece0a2e, 0xfecdf9fe, 0xfecd90bc, 0xfecda3c6, 0xfecd93cd, 0xfecd9705, 0xfecca0e9, 0xfecd1e65,
+    0xfecd7c50, 0xfecd440f, 0xfecd3658, 0xfecd367c, 0xfeccebf4, 0xfecd3b6e, 0xfeccf3c5, 0xfecd193d,
+    0xfecd0984, 0xfeccc343, 0xfeccdb4b, 0xfecccbbe, 0xfecca453, 0xfeccd908, 0xfecc6ec0, 0xfecc4d70,
+    0xfecc7a8e, 0xfecc4380, 0xfecc1947, 0xfecc66b6, 0xfecb89a2, 0xfecc2acb, 0xfecc03ad, 0xfecbcd7e,
+    0xfecba7b5, 0xfecbf8e9, 0xfecbb347, 0xfecbd8c3, 0xfecb9364, 0xfecbba24, 0xfecb4ae3, 0xfecb8b55,
+    0xfecb2ab6, 0xfecb6c48, 0xfecb3406, 0xfecb4c87, 0xfecb27ec, 0xfeca3990, 0xfecaabe4, 0xfeca5793,
+    0xfecabe73, 0xfeca4085, 0xfecaea09, 0xfecab4dc, 0xfecae157, 0xfeca6fb6, 0xfeca50cb, 0xfecab1ef,
+    0xfeca95fb, 0xfeca7bf8, 0xfeca77ab, 0xfec9fa56, 0xfeca270d, 0xfec945e9, 0xfec9f2f8, 0xfec9f772,
+    0xfec9155e, 0xfec9d6cc, 0xfec9f826, 0xfec9a417, 0xfec991d8, 0xfec903b2, 0xfec9b72d, 0xfec909a6,
+    0xfec996fa, 0xfec92eb0, 0xfec8e991, 0xfec935ac, 0xfec8fcc1, 0xfec831dd, 0xfec83d80, 0xfec930df,
+    0xfec91804, 0xfec8c461, 0xfec8c7a7, 0xfec8e631, 0xfec87e72, 0xfec8c6aa, 0xfec884b1, 0xfec8a661,
+    0xfec8669b, 0xfec81c96, 0xfec846d8, 0xfec7b7a7, 0xfec7d9de, 0xfec85edf, 0xfec7dfa8, 0xfec79be1,
+    0xfec7ab14, 0xfec7d86f, 0xfec78d6d, 0xfec7a365, 0xfec73dad, 0xfec79824, 0xfec75f13, 0xfec71a73,
+    0xfec72c6e, 0xfec768de, 0xfec733b0, 0xfec74bb8, 0xfec713d4, 0xfec6ee47, 0xfec74475, 0xfec6e2ce,
+    0xfec6e61c, 0xfec71881, 0xfec69def, 0xfec68eaf, 0xfec5f0d5, 0xfec63a70, 0xfec68817, 0xfec61277,
+    0xfec5a29b, 0xfec66be9, 0xfec61dba, 0xfec5da0a, 0xfec6492d, 0xfec5dba5, 0xfec5aa3c, 0xfec52d03,
+    0xfec608dc, 0xfec57d81, 0xfec5b24e, 0xfec57bb5, 0xfec5a5cf, 0xfec4c8e5, 0xfec55d29, 0xfec5a5d9,
+    0xfec4d532, 0xfec56a44, 0xfec48a16, 0xfec50ff7, 0xfec4d858, 0xfec4a1ed, 0xfec4dd95, 0xfec4e618,
+    0xfec4e645, 0xfec4d5bc, 0xfec4c6d2, 0xfec4a08a, 0xfec46b70, 0xfec495ec, 0xfec4a805, 0xfec42518,
+    0xfec47c0c, 0xfec46b1f, 0xfec468de, 0xfec437a0, 0xfec45de5, 0xfec42b59, 0xfec3f61e, 0xfec3d3e5,
+    0xfec3bf7e, 0xfec32795, 0xfec324a1, 0xfec3efec, 0xfec3e8c7, 0xfec3cce5, 0xfec3aba3, 0xfec35077,
+    0xfec2a160, 0xfec2ef2c, 0xfec2a021, 0xfec298bd, 0xfec36954, 0xfec28b1d, 0xfec2d0cd, 0xfec30a56,
+    0xfec2d036, 0xfec30fd4, 0xfec31245, 0xfec25ef4, 0xfec2b95d, 0xfec2d77a, 0xfec1f152, 0xfec29ae7,
+    0xfec27ba6, 0xfec27b95, 0xfec28e95, 0xfec238a3, 0xfec23256, 0xfec218d6, 0xfec1f5e4, 0xfec19fdf,
+    0xfec2293d, 0xfec2181a, 0xfec208dc, 0xfec1da21, 0xfec0f49d, 0xfec0fe04, 0xfec1b6b2, 0xfec1c2bc,
+    0xfec133cb, 0xfec1a1da, 0xfec0c51b, 0xfec15a60, 0xfec0ab41, 0xfec030c7, 0xfec09ff3, 0xfec13fd8,
+    0xfec12ee6, 0xfec11122, 0xfec01cb8, 0xfec0bd06, 0xfebfea6e, 0xfec07ffd, 0xfebffb6e, 0xfec01388,
+    0xfec0a181, 0xfec08667, 0xfebf658e, 0xfebfdc0d, 0xfebfdc32, 0xfebfbbe4, 0xfebffb29, 0xfebff698,
+    0xfebf7420, 0xfebf0c15, 0xfebfa417, 0xfebeec15, 0xfebf4539, 0xfebfdd78, 0xfebfc559, 0xfebfa7ba,
+    0xfebfaf1d, 0xfebefa24, 0xfebf774e, 0xfebf8575, 0xfebee864, 0xfebe91c1, 0xfebe4cd3, 0xfebed16e,
+    0xfebf2904, 0xfebec029, 0xfebdf5af, 0xfebefa1e, 0xfebecfc9, 0xfebed21f, 0xfebe0e35, 0xfebe5bee,
+    0xfebe5ddc, 0xfebdb238, 0xfebdd17c, 0xfebe8369, 0xfebe614f, 0xfebd35e9, 0xfebdab16, 0xfebdc970,
+    0xfebe2df7, 0xfebd8583, 0xfebd8c95, 0xfebdbfc3, 0xfebd30ab, 0xfebdc8d3, 0xfebdac07, 0xfebdbe47,
+    0xfebd99ca, 0xfebd9dad, 0xfebcc36e, 0xfebd7138, 0xfebd745e, 0xfebc84ea, 0xfebd382c, 0xfebc9a3c,
+    0xfebc9ae2, 0xfebc37f3, 0xfebc65d1, 0xfebcdc1c, 0xfebcf545, 0xfebcc7d3, 0xfebcd571, 0xfebcc204,
+    0xfebc66d9, 0xfebca45b, 0xfebc59ae, 0xfebb8d7d, 0xfebc3d61, 0xfebc52d4, 0xfebc4a4e, 0xfebbfd74,
+    0xfebc1841, 0xfebc0705, 0xfebc0c82, 0xfebb17ac, 0xfebb0322, 0xfebabc6c, 0xfebbc84b, 0xfeba92fa,
+    0xfebbb40f, 0xfeba90dc, 0xfebaf14f, 0xfebad3cd, 0xfebac989, 0xfebade12, 0xfebb4fda, 0xfebb3308,
+    0xfebb2eba, 0xfebafb59, 0xfebaa27b, 0xfeba2e2b, 0xfebabf9d, 0xfebae43f, 0xfebac727, 0xfeba0c60,
+    0xfeb9e328, 0xfeba926e, 0xfeba338c, 0xfeb9de9a, 0xfeb960c9, 0xfeb9959b, 0xfeba4db5, 0xfeba333c,
+    0xfeba0ccf, 0xfeb9dd82, 0xfeb96f2a, 0xfeb9d10e, 0xfeb92169, 0xfeb9d1a3, 0xfeb9cfad, 0xfeb9b74a,
+    0xfeb97d88, 0xfeb99e84, 0xfeb95795, 0xfeb96a4d, 0xfeb924a5, 0xfeb8d9f8, 0xfeb9511b, 0xfeb84020,
+    0xfeb92773, 0xfeb8d0e7, 0xfeb8eb79, 0xfeb8f9c8, 0xfeb8d7af, 0xfeb82e26, 0xfeb8c082, 0xfeb88bad,
+    0xfeb79e98, 0xfeb7b5c9, 0xfeb80a11, 0xfeb8682c, 0xfeb814b7, 0xfeb85f2b, 0xfeb8425d, 0xfeb83159,
+    0xfeb82e1c, 0xfeb76ef8, 0xfeb80208, 0xfeb74be2, 0xfeb7e25c, 0xfeb75274, 0xfeb71869, 0xfeb7b94c,
+    0xfeb699a3, 0xfeb79c90, 0xfeb783ad, 0xfeb73f04, 0xfeb76374, 0xfeb6e5d2, 0xfeb6524b, 0xfeb73215,
+    0xfeb7351a, 0xfeb63172, 0xfeb6f96f, 0xfeb70074, 0xfeb6b0da, 0xfeb60085, 0xfeb6cdc8, 0xfeb6b7ff,
+    0xfeb593ac, 0xfeb5eb85, 0xfeb60e26, 0xfeb67ef4, 0xfeb62273, 0xfeb5a81a, 0xfeb5b10c, 0xfeb5bcb1,
+    0xfeb5bd05, 0xfeb51719, 0xfeb5824b, 0xfeb5b91a, 0xfeb4c550, 0xfeb5bb52, 0xfeb4fdc1, 0xfeb5a7a2,
+    0xfeb553e5, 0xfeb49fdf, 0xfeb5766d, 0xfeb48878, 0xfeb53de7, 0xfeb51834, 0xfeb54a42, 0xfeb46cd8,
+    0xfeb4a66b, 0xfeb42ae0, 0xfeb5053c, 0xfeb3f614, 0xfeb4df98, 0xfeb3bac4, 0xfeb46a97, 0xfeb3dba6,
+    0xfeb46aa8, 0xfeb42e21, 0xfeb415a3, 0xfeb47dbf, 0xfeb441d4, 0xfeb3731d, 0xfeb34c02, 0xfeb32c06,
+    0xfeb3f7d3, 0xfeb41f9e, 0xfeb39c0c, 0xfeb3eeaf, 0xfeb2ec25, 0xfeb2d199, 0xfeb3d487, 0xfeb37103,
+    0xfeb283be, 0xfeb3920d, 0xfeb263f0, 0xfeb263ab, 0xfeb288e2, 0xfeb23e98, 0xfeb2d251, 0xfeb25dbc,
+    0xfeb2eaf0, 0xfeb30e77, 0xfeb2e07a, 0xfeb2f8e2, 0xfeb1d0de, 0xfeb25a38, 0xfeb29739, 0xfeb1e3a4,
+    0xfeb219f4, 0xfeb29a70, 0xfeb25e01, 0xfeb2801c, 0xfeb23627, 0xfeb25ec9, 0xfeb15dca, 0xfeb1335e,
+    0xfeb16c87, 0xfeb22105, 0xfeb20287, 0xfeb12d3c, 0xfeb1cba9, 0xfeb19291, 0xfeb1a017, 0xfeb1b349,
+    0xfeb148e4, 0xfeb193c1, 0xfeb183f7, 0xfeb116c5, 0xfeb1157b, 0xfeb0c1a6, 0xfeb11cca, 0xfeb11d0b,
+    0xfeb0745a, 0xfeb0fc32, 0xfeb0f970, 0xfeb102c0, 0xfeb0cb80, 0xfeb0bb8e, 0xfeb088d2, 0xfeb0a7ca,
+    0xfeb0a2b9, 0xfeb09187, 0xfeb06412, 0xfeb002a6, 0xfeb055a3, 0xfeb03c49, 0xfeaf5721, 0xfeb0321d,
+    0xfeaf8aef, 0xfeb0080c, 0xfeb00aad, 0xfeafce19, 0xfeafd845, 0xfeafbcb4, 0xfeaf875a, 0xfeaf7269,
+    0xfeaf8c0c, 0xfeaed8f6, 0xfeaf829e, 0xfeaf0ef4, 0xfeaf4bed, 0xfeaf2d62, 0xfeaee9e3, 0xfeae33f4,
+    0xfeaf1830, 0xfeae79d9, 0xfeaef86c, 0xfeaebb90, 0xfeaea7e6, 0xfeaed880, 0xfeaeceae, 0xfeaea885,
+    0xfeae8b3b, 0xfeae7ca7, 0xfeae5c8d, 0xfeae7b28, 0xfeae276d, 0xfeae523a, 0xfeae071c, 0xfeae2505,
+    0xfeae191c, 0xfeacf6ca, 0xfeaddbf1, 0xfeadf2d2, 0xfeadcb4c, 0xfeacf395, 0xfead86b7, 0xfeacd643,
+    0xfead97d7, 0xfeac7162, 0xfeac8f81, 0xfead78cd, 0xfead7015, 0xfead0104, 0xfead2a7d, 0xfead1c44,
+    0xfeacfc31, 0xfeabf817, 0xfeac3c29, 0xfeacf251, 0xfeace985, 0xfeac2aca, 0xfeacac8e, 0xfeacc3f3,
+    0xfeac8c05, 0xfeac9429, 0xfeabb825, 0xfeac68aa, 0xfeac6aff, 0xfeab405b, 0xfeac0983, 0xfeabba56,
+    0xfeac236f, 0xfeabba58, 0xfeaba6be, 0xfeabf29b, 0xfeab2283, 0xfeab30f8, 0xfeaae221, 0xfeabbbdc,
+    0xfeabb59b, 0xfeaaaada, 0xfeab83a6, 0xfeab739b, 0xfeab591f, 0xfeab4b5b, 0xfeaa37e3, 0xfeab0e14,
+    0xfeaa34fa, 0xfeab0aa0, 0xfeaa445c, 0xfeaa8090, 0xfeaacce9, 0xfeaa1836, 0xfeaa1e7d, 0xfeaa57ac,
+    0xfeaaa3ac, 0xfea9eccf, 0xfea982cf, 0xfea986bd, 0xfea9a404, 0xfeaa240c, 0xfea9f594, 0xfeaa3a4d,
+    0xfeaa0bd4, 0xfea9d7e1, 0xfea9df04, 0xfea9b92f, 0xfea96ccc, 0xfea9adfd, 0xfea95de2, 0xfea99d2d,
+    0xfea9677a, 0xfea930a3, 0xfea90c19, 0xfea97318, 0xfea8fe8a, 0xfea86ad7, 0xfea90968, 0xfea875bd,
+    0xfea842d7, 0xfea8edc7, 0xfea87ac8, 0xfea8abf5, 0xfea89597, 0xfea89a0f, 0xfea88965, 0xfea82a44,
+    0xfea83fef, 0xfea87b6c, 0xfea81d2a, 0xfea836e7, 0xfea84c8f, 0xfea743d5, 0xfea837d4, 0xfea7ceb3,
+    0xfea73fe8, 0xfea80612, 0xfea7c7c3, 0xfea7cd41, 0xfea75965, 0xfea739cf, 0xfea76142, 0xfea7796d,
+    0xfea68b61, 0xfea7167b, 0xfea7467c, 0xfea723a4, 0xfea6dcef, 0xfea6d807, 0xfea68bdd, 0xfea6f661,
+    0xfea6bf65, 0xfea688be, 0xfea68c43, 0xfea68f7b, 0xfea6a472, 0xfea69839, 0xfea63829, 0xfea68c08,
+    0xfea654f7, 0xfea65896, 0xfea62021, 0xfea5a8ca, 0xfea5d88b, 0xfea5dc3f, 0xfea5b859, 0xfea5e66a,
+    0xfea59990, 0xfea5b022, 0xfea56b77, 0xfea57e00, 0xfea549ce, 0xfea55daa, 0xfea59d72, 0xfea59c09,
+    0xfea5400d, 0xfea530bc, 0xfea54857, 0xfea5256a, 0xfea53d70, 0xfea4a61a, 0xfea4e0ff, 0xfea51f0f,
+    0xfea4d4b2, 0xfea4b017, 0xfea4c973, 0xfea45b59, 0xfea4bccf, 0xfea49898, 0xfea4ab8d, 0xfea4521b,
+    0xfea44034, 0xfea37b65, 0xfea372cd, 0xfea467ad, 0xfea44c81, 0xfea44829, 0xfea41c1b, 0xfea3d0e7,
+    0xfea3e97d, 0xfea3c61a, 0xfea3a406, 0xfea3e93e, 0xfea2e067, 0xfea3acd1, 0xfea3b910, 0xfea36542,
+    0xfea3188e, 0xfea2d05f, 0xfea28d43, 0xfea32647, 0xfea34c90, 0xfea2f25e, 0xfea28a05, 0xfea2d131,
+    0xfea2c1e0, 0xfea309e8, 0xfea2f971, 0xfea2b8eb, 0xfea2cc64, 0xfea297f6, 0xfea261c9, 0xfea2b43b,
+    0xfea209ca, 0xfea2891f, 0xfea25cf6, 0xfea21010, 0xfea23e0e, 0xfea1e0db, 0xfea18b64, 0xfea21cdb,
+    0xfea1675b, 0xfea1ef16, 0xfea19f7c, 0xfea18322, 0xfea1803c, 0xfea0e96c, 0xfea1a7fe, 0xfea19bda,
+    0xfea1a864, 0xfea0d6dd, 0xfea178f7, 0xfea07784, 0xfea0630e, 0xfea13b93, 0xfea13cb6, 0xfea0fb6f,
+    0xfea0ff1e, 0xfea0ee27, 0xfea08d93, 0xfea0ffb1, 0xfea0da20, 0xfea0ca05, 0xfea0bb61, 0xfea08d6c,
+    0xfe9fbbdb, 0xfea05ab9, 0xfea05b60, 0xfe9f60c5, 0xfe9f7641, 0xfea04af4, 0xfea04340, 0xfe9ffaa6,
+    0xfe9fec14, 0xfe9ffe28, 0xfe9fb4b3, 0xfe9f097f, 0xfe9fdb21, 0xfe9faf80, 0xfe9fae50, 0xfe9f8d5c,
+    0xfe9f5419, 0xfe9ef1ee, 0xfe9f0f7b, 0xfe9e5a49, 0xfe9f3e43, 0xfe9f19f8, 0xfe9e31a5, 0xfe9f282b,
+    0xfe9ed338, 0xfe9f0b14, 0xfe9eca48, 0xfe9eccc9, 0xfe9e2bd6, 0xfe9e875f, 0xfe9e6280, 0xfe9e79af,
+    0xfe9e0949, 0xfe9e4641, 0xfe9e0a91, 0xfe9e0eb4, 0xfe9e13fe, 0xfe9df21d, 0xfe9de0a7, 0xfe9d8d9a,
+    0xfe9d4ec3, 0xfe9d26d9, 0xfe9da13d, 0xfe9d6925, 0xfe9dbdc2, 0xfe9d9b87, 0xfe9cd261, 0xfe9cc14d,
+    0xfe9d0ae9, 0xfe9d5976, 0xfe9cedd9, 0xfe9ce9ea, 0xfe9c823f, 0xfe9d1aab, 0xfe9ccc8a, 0xfe9ce654,
+    0xfe9ceabb, 0xfe9c8923, 0xfe9bf06a, 0xfe9beb7d, 0xfe9c81bc, 0xfe9cbdbc, 0xfe9c38ec, 0xfe9c8e4e,
+    0xfe9c7e2a, 0xfe9c09be, 0xfe9bbcdd, 0xfe9b556c, 0xfe9c2ae7, 0xfe9c2ee5, 0xfe9bf56e, 0xfe9b1789,
+    0xfe9bd52f, 0xfe9bd913, 0xfe9b18c3, 0xfe9bba3d, 0xfe9bbc9e, 0xfe9bad91, 0xfe9b71db, 0xfe9b51e5,
+    0xfe9b54a8, 0xfe9b326f, 0xfe9ac3f0, 0xfe9b3bb3, 0xfe9b2a60, 0xfe9af26b, 0xfe9abb2e, 0xfe9ae28a,
+    0xfe9a9a19, 0xfe9ab2c6, 0xfe9ab552, 0xfe99e9d7, 0xfe9a6e06, 0xfe9a319b, 0xfe9a6256, 0xfe9a3cf3,
+    0xfe9a6c26, 0xfe9a3375, 0xfe9a4b59, 0xfe99e362, 0xfe99daf9, 0xfe9a0719, 0xfe99f538, 0xfe99abe8,
+    0xfe99ff4d, 0xfe999d5d, 0xfe996da2, 0xfe99a75f, 0xfe993cdf, 0xfe995cfa, 0xfe997621, 0xfe993cbd,
+    0xfe99581b, 0xfe994623, 0xfe9937dc, 0xfe98cdd3, 0xfe98ca1f, 0xfe991cab, 0xfe98cabf, 0xfe98d3a5,
+    0xfe98ae9e, 0xfe98db1f, 0xfe987b42, 0xfe98675b, 0xfe985b8c, 0xfe985e2a, 0xfe9875cc, 0xfe982b80,
+    0xfe97e979, 0xfe981d93, 0xfe97ebc9, 0xfe979328, 0xfe97db57, 0xfe97cadb, 0xfe97f839, 0xfe97ab03,
+    0xfe973052, 0xfe974cd0, 0xfe973b75, 0xfe977e63, 0xfe975b76, 0xfe972cd9, 0xfe971cee, 0xfe970d34,
+    0xfe96ec98, 0xfe96fb2a, 0xfe96bbd6, 0xfe96dc38, 0xfe96aa0a, 0xfe967dfe, 0xfe968ae1, 0xfe967c2a,
+    0xfe968ba1, 0xfe9666a1, 0xfe96398a, 0xfe9669eb, 0xfe961b2d, 0xfe95c1b5, 0xfe961cc1, 0xfe95c9ad,
+    0xfe95b814, 0xfe95fbf9, 0xfe9566ec, 0xfe95aa10, 0xfe958c49, 0xfe9552fa, 0xfe956c3e, 0xfe959a48,
+    0xfe952ff1, 0xfe9549c9, 0xfe953a57, 0xfe951c4c, 0xfe952990, 0xfe94fbce, 0xfe94d000, 0xfe953ca7,
+    0xfe94b929, 0xfe94da5b, 0xfe94cad2, 0xfe947ffb, 0xfe948edd, 0xfe947af1, 0xfe944947, 0xfe945b8f,
+    0xfe9424c8, 0xfe942137, 0xfe942042, 0xfe9406db, 0xfe93ee24, 0xfe93f3f3, 0xfe9409e4, 0xfe93c015,
+    0xfe93ea36, 0xfe93bd61, 0xfe93cc19, 0xfe93cbd9, 0xfe939789, 0xfe939c19, 0xfe939c70, 0xfe9369c5,
+    0xfe9342dc, 0xfe934978, 0xfe932412, 0xfe932d43, 0xfe930d1f, 0xfe933b1f, 0xfe92fbfd, 0xfe93018d,
+    0xfe928f90, 0xfe92bec0, 0xfe92a504, 0xfe92bb8c, 0xfe929825, 0xfe92aa3d, 0xfe92ac36, 0xfe929b11,
+    0xfe928a3d, 0xfe926de0, 0xfe925c26, 0xfe91d646, 0xfe925a84, 0xfe92857f, 0xfe9238c4, 0xfe91fd94,
+    0xfe922d4d, 0xfe921dcf, 0xfe920c69, 0xfe91bd98, 0xfe91ad33, 0xfe91de9e, 0xfe918d5a, 0xfe91bd22,
+    0xfe914a00, 0xfe91c447, 0xfe91c96e, 0xfe91a211, 0xfe917eb4, 0xfe9170ae, 0xfe90ffaf, 0xfe917971,
+    0xfe917b74, 0xfe917bc1, 0xfe9122e0, 0xfe915c1e, 0xfe90579f, 0xfe90de3e, 0xfe910b8d, 0xfe910ed1,
+    0xfe911a37, 0xfe90691f, 0xfe90b600, 0xfe901f3d, 0xfe904de0, 0xfe90bc91, 0xfe900542, 0xfe908e36,
+    0xfe90992f, 0xfe8fd47e, 0xfe904a79, 0xfe904c50, 0xfe903ec6, 0xfe9050b5, 0xfe8fd40c, 0xfe8fd5a4,
+    0xfe90168a, 0xfe8fedaa, 0xfe8fb761, 0xfe8ff273, 0xfe8f3b11, 0xfe8faf38, 0xfe8f4c12, 0xfe8ecea1,
+    0xfe8f8c66, 0xfe8ef18f, 0xfe8f2313, 0xfe8f79b5, 0xfe8f176d, 0xfe8f1d39, 0xfe8f4742, 0xfe8f1b50,
+    0xfe8f18a5, 0xfe8f103f, 0xfe8eeca8, 0xfe8eea0e, 0xfe8ed78c, 0xfe8ebd7b, 0xfe8e8c35, 0xfe8eb29d,
+    0xfe8e41f9, 0xfe8e993b, 0xfe8db335, 0xfe8e5b64, 0xfe8df014, 0xfe8e3b3d, 0xfe8e38c6, 0xfe8e0fe2,
+    0xfe8deadb, 0xfe8e1e10, 0xfe8e0918, 0xfe8dbc3a, 0xfe8d3bab, 0xfe8db9f4, 0xfe8d9e79, 0xfe8db267,
+    0xfe8d8dc6, 0xfe8d7714, 0xfe8d8303, 0xfe8d5c36, 0xfe8d4e5b, 0xfe8c4ca0, 0xfe8d0bd7, 0xfe8d319a,
+    0xfe8c4e79, 0xfe8cfa51, 0xfe8cf989, 0xfe8c721f, 0xfe8ce8eb, 0xfe8cb0bb, 0xfe8cac5e, 0xfe8bd2c6,
+    0xfe8bcbe6, 0xfe8c98c4, 0xfe8c802b, 0xfe8c6937, 0xfe8c3e90, 0xfe8c493f, 0xfe8c0d08, 0xfe8c1d43,
+    0xfe8c2323, 0xfe8b02ce, 0xfe8c009d, 0xfe8bdd25, 0xfe8bcc78, 0xfe8bb740, 0xfe8b9ca8, 0xfe8b001f,
+    0xfe8b983c, 0xfe8b10f7, 0xfe8aa504, 0xfe8b4b98, 0xfe8b594d, 0xfe8a7d20, 0xfe8aefb5, 0xfe8b180b,
+    0xfe8b1125, 0xfe8adb8c, 0xfe8ac64d, 0xfe8af883, 0xfe8ae991, 0xfe8aab32, 0xfe8ac9c9, 0xfe8ab38e,
+    0xfe8a9544, 0xfe8990a2, 0xfe8a8caa, 0xfe89be63, 0xfe8a6306, 0xfe893ab3, 0xfe89e62b, 0xfe896d54,
+    0xfe89265a, 0xfe89bd56, 0xfe89cd86, 0xfe89bc63, 0xfe894193, 0xfe893546, 0xfe89d30a, 0xfe89ba00,
+    0xfe89afe3, 0xfe88c142, 0xfe891072, 0xfe894fc6, 0xfe88ea3e, 0xfe890d95, 0xfe883d44, 0xfe8942b5,
+    0xfe884c9a, 0xfe87f798, 0xfe881be7, 0xfe87f761, 0xfe888512, 0xfe8868ba, 0xfe87b1e4, 0xfe88584b,
+    0xfe87b4e1, 0xfe87dbd1, 0xfe87d5bb, 0xfe88426e, 0xfe878deb, 0xfe879ec3, 0xfe87895d, 0xfe877220,
+    0xfe872a02, 0xfe870b94, 0xfe871b93, 0xfe873489, 0xfe873e45, 0xfe86bc04, 0xfe86b574, 0xfe87038e,
+    0xfe87b496, 0xfe86a682, 0xfe8665c0, 0xfe869ae2, 0xfe867c98, 0xfe86d6b8, 0xfe86e1c3, 0xfe8622a9,
+    0xfe867cfe, 0xfe8653d0, 0xfe865c7a, 0xfe86ffe9, 0xfe86da15, 0xfe86e2ea, 0xfe86cef5, 0xfe85c776,
+    0xfe858aea, 0xfe85d468, 0xfe863104, 0xfe867aa0, 0xfe85ab94, 0xfe8663ab, 0xfe864289, 0xfe858bac,
+    0xfe85577e, 0xfe8586b0, 0xfe85a547, 0xfe86047f, 0xfe84f65d, 0xfe85864f, 0xfe853a04, 0xfe84c595,
+    0xfe84d3da, 0xfe84b5cc, 0xfe858c8a, 0xfe84f794, 0xfe851882, 0xfe850529, 0xfe8462ea, 0xfe842efa,
+    0xfe841d71, 0xfe849312, 0xfe83e279, 0xfe84873c, 0xfe846d01, 0xfe84e011, 0xfe846eba, 0xfe83ae40,
+    0xfe84a79a, 0xfe83c64e, 0xfe84484e, 0xfe83535c, 0xfe83fd23, 0xfe845ae3, 0xfe83849a, 0xfe83275a,
+    0xfe836343, 0xfe834667, 0xfe839ffb, 0xfe83f278, 0xfe82db75, 0xfe82fe5c, 0xfe83b715, 0xfe83c4aa,
+    0xfe83b2be, 0xfe83a45e, 0xfe82a977, 0xfe82d371, 0xfe82eb32, 0xfe825dd1, 0xfe8287e7, 0xfe8216b5,
+    0xfe82e11b, 0xfe831d23, 0xfe8215d9, 0xfe82f9eb, 0xfe82ef06, 0xfe81b1cc, 0xfe82cf9a, 0xfe82b908,
+    0xfe81972b, 0xfe829167, 0xfe81a572, 0xfe81cb3f, 0xfe8269b2, 0xfe81b27f, 0xfe8152db, 0xfe8241c6,
+    0xfe8100a2, 0xfe818c45, 0xfe8207e7, 0xfe80da94, 0xfe8179f1, 0xfe81024d, 0xfe8134d0, 0xfe81bf70,
+    0xfe80f659, 0xfe80e242, 0xfe8194e8, 0xfe809cf7, 0xfe80963f, 0xfe810a1b, 0xfe80504e, 0xfe813414,
+    0xfe80b464, 0xfe805a05, 0xfe81100e, 0xfe80fd4e, 0xfe8003ef, 0xfe8042b5, 0xfe7fd04d, 0xfe807d8e,
+    0xfe80b0a6, 0xfe7fcb28, 0xfe7fd250, 0xfe7f876c, 0xfe7f4775, 0xfe7f9d10, 0xfe7f64aa, 0xfe7fb94a,
+    0xfe7fac63, 0xfe7f2c4b, 0xfe7f3b29, 0xfe7f21f4, 0xfe7fc97b, 0xfe7ee9a9, 0xfe7fceec, 0xfe7eea52,
+    0xfe7efaab, 0xfe7fa088, 0xfe7eac45, 0xfe7f7266, 0xfe7e780f, 0xfe7f5eea, 0xfe7eb66a, 0xfe7e6a0b,
+    0xfe7e44d9, 0xfe7e12f5, 0xfe7dfc9b, 0xfe7ef212, 0xfe7eec9f, 0xfe7dfe74, 0xfe7e419c, 0xfe7dd03d,
+    0xfe7e6aab, 0xfe7dbc47, 0xfe7e86fa, 0xfe7e755c, 0xfe7e5a31, 0xfe7d7b76, 0xfe7d7c8b, 0xfe7db4c0,
+    0xfe7dbeaf, 0xfe7e1cbd, 0xfe7d2ed8, 0xfe7d1bca, 0xfe7deecf, 0xfe7d2a9d, 0xfe7cc4c3, 0xfe7cc132,
+    0xfe7cc03d, 0xfe7ca6d6, 0xfe7cc9df, 0xfe7c93ee, 0xfe7c4012, 0xfe7c6010, 0xfe7d164a, 0xfe7c94e2,
+    0xfe7d2da1, 0xfe7cf070, 0xfe7cd643, 0xfe7cd7a1, 0xfe7bc7ab, 0xfe7c09c0, 0xfe7cc368, 0xfe7cba29,
+    0xfe7c2d1a, 0xfe7ca46c, 0xfe7bfb17, 0xfe7c38a3, 0xfe7b741a, 0xfe7b7ebb, 0xfe7c01e4, 0xfe7b68bd,
+    0xfe7bb6b2, 0xfe7b8fc8, 0xfe7aefac, 0xfe7b5c5e, 0xfe7b8ff8, 0xfe7b952b, 0xfe7bd1dd, 0xfe7b3e40,
+    0xfe7b1032, 0xfe7ba560, 0xfe7a9a08, 0xfe7ac435, 0xfe7ad77f, 0xfe7b0b93, 0xfe7a7a52, 0xfe7af250,
+    0xfe7a6426, 0xfe7abbcc, 0xfe7afbb1, 0xfe79e1d6, 0xfe7aec16, 0xfe7a8909, 0xfe79d7b6, 0xfe7a2222,
+    0xfe79983f, 0xfe79e345, 0xfe79f7e5, 0xfe79b3ad, 0xfe7a56d0, 0xfe797117, 0xfe7983b0, 0xfe79522b,
+    0xfe792d08, 0xfe790e1d, 0xfe78ebce, 0xfe78f99c, 0xfe79476f, 0xfe791534, 0xfe795b11, 0xfe792add,
+    0xfe79140b, 0xfe78cff7, 0xfe78cc56, 0xfe786ae9, 0xfe78bc53, 0xfe784177, 0xfe78abd3, 0xfe78e5a0,
+    0xfe781e9f, 0xfe784f83, 0xfe789cf8, 0xfe77ee71, 0xfe77f107, 0xfe77f2f2, 0xfe77d525, 0xfe784427,
+    0xfe78109b, 0xfe7807ac, 0xfe789416, 0xfe7750cd, 0xfe7783c7, 0xfe781919, 0xfe777327, 0xfe77afd4,
+    0xfe77be1d, 0xfe76f472, 0xfe776c4c, 0xfe77414c, 0xfe76f0ae, 0xfe777502, 0xfe76a292, 0xfe76f4bb,
+    0xfe778069, 0xfe7674e1, 0xfe767e86, 0xfe7695e0, 0xfe76c2d9, 0xfe764e99, 0xfe767392, 0xfe767a54,
+    0xfe7609dd, 0xfe763ccd, 0xfe7636d4, 0xfe7609dc, 0xfe76c2b9, 0xfe7635a4, 0xfe76a8a2, 0xfe75bd6f,
+    0xfe759beb, 0xfe757fac, 0xfe758903, 0xfe7570c7, 0xfe7561b7, 0xfe755950, 0xfe7588e1, 0xfe757031,
+    0xfe761bdb, 0xfe7531dc, 0xfe751404, 0xfe76059e, 0xfe75f657, 0xfe74e6fe, 0xfe74f00a, 0xfe7499a6,
+    0xfe7542af, 0xfe7565bd, 0xfe749e96, 0xfe751ef0, 0xfe74ced6, 0xfe7449ec, 0xfe743c75, 0xfe7434c4,
+    0xfe74bbdc, 0xfe7524df, 0xfe7451d6, 0xfe73eeef, 0xfe742627, 0xfe73e9af, 0xfe73d71d, 0xfe73b00e,
+    0xfe7438c1, 0xfe745ae2, 0xfe73a36f, 0xfe7381c7, 0xfe74741c, 0xfe73b341, 0xfe737f5b, 0xfe733c5c,
+    0xfe7301bd, 0xfe73f069, 0xfe737d7a, 0xfe72da73, 0xfe72d167, 0xfe72e2d6, 0xfe7338f9, 0xfe73c049,
+    0xfe72c28d, 0xfe72ebd1, 0xfe730501, 0xfe72b6ed, 0xfe7333de, 0xfe72906e, 0xfe72f271, 0xfe727209,
+    0xfe72219c, 0xfe727707, 0xfe7256ef, 0xfe71da68, 0xfe724520, 0xfe7264f3, 0xfe722a42, 0xfe72326b,
+    0xfe723acb, 0xfe723a9d, 0xfe7218b5, 0xfe7182ad, 0xfe717501, 0xfe717505, 0xfe717197, 0xfe711d72,
+    0xfe717703, 0xfe7195fb, 0xfe70ef45, 0xfe720593, 0xfe70d5ea, 0xfe70d1dd, 0xfe719e4e, 0xfe70f390,
+    0xfe709e6b, 0xfe709d1f, 0xfe70d834, 0xfe71204e, 0xfe704d1f, 0xfe709029, 0xfe70ce7a, 0xfe70f8b5,
+    0xfe706cb8, 0xfe706e8d, 0xfe71010b, 0xfe70c0d9, 0xfe70edc4, 0xfe6fd77b, 0xfe6fb39d, 0xfe704afa,
+    0xfe704997, 0xfe703c31, 0xfe6f72ac, 0xfe6f50cd, 0xfe701b85, 0xfe6f721e, 0xfe6f2a43, 0xfe703eb1,
+    0xfe703625, 0xfe6fb9f5, 0xfe701392, 0xfe6f422f, 0xfe6f308c, 0xfe6ec39d, 0xfe6fcefd, 0xfe6fc228,
+    0xfe6f5031, 0xfe6ede08, 0xfe6e8ee8, 0xfe6ec1f0, 0xfe6e587a, 0xfe6e4add, 0xfe6f3e7b, 0xfe6f44d8,
+    0xfe6efcf1, 0xfe6e37a9, 0xfe6e0f50, 0xfe6e0708, 0xfe6dcd04, 0xfe6dffd2, 0xfe6e0a46, 0xfe6da470,
+    0xfe6e0b2f, 0xfe6d7e61, 0xfe6dc723, 0xfe6df42b, 0xfe6d91e4, 0xfe6d8b6a, 0xfe6e53d5, 0xfe6d1b65,
+    0xfe6dc713, 0xfe6d6448, 0xfe6d8c97, 0xfe6d2890, 0xfe6cd31c, 0xfe6dbc7d, 0xfe6d448f, 0xfe6c9126,
+    0xfe6c871b, 0xfe6cc976, 0xfe6cfa98, 0xfe6d2e03, 0xfe6c44de, 0xfe6c3125, 0xfe6cac9c, 0xfe6d2a59,
+    0xfe6c03fa, 0xfe6c3a9f, 0xfe6c14b9, 0xfe6c05cf, 0xfe6c50fd, 0xfe6bba47, 0xfe6bcb8b, 0xfe6c1aa9,
+    0xfe6bd8c1, 0xfe6ba4fa, 0xfe6b71a5, 0xfe6b78f5, 0xfe6bab65, 0xfe6b3b62, 0xfe6bf285, 0xfe6b261d,
+    0xfe6b2784, 0xfe6bdedc, 0xfe6b2608, 0xfe6aebac, 0xfe6af268, 0xfe6ad5f9, 0xfe6ac652, 0xfe6af405,
+    0xfe6b1c0b, 0xfe6a7977, 0xfe6b1bf7, 0xfe6ab852, 0xfe6abea9, 0xfe6a597c, 0xfe6a5ace, 0xfe6a27a5,
+    0xfe6a2ddb, 0xfe6a2bec, 0xfe6a04f2, 0xfe6a4ecb, 0xfe6a0f4f, 0xfe69cd49, 0xfe69a144, 0xfe69eb75,
+    0xfe69a1ae, 0xfe6990d8, 0xfe69aeb3, 0xfe6994d3, 0xfe696523, 0xfe69f287, 0xfe695dd7, 0xfe692d9f,
+    0xfe690af3, 0xfe696877, 0xfe696181, 0xfe690176, 0xfe692d9c, 0xfe693522, 0xfe692c69, 0xfe68bc59,
+    0xfe690bc3, 0xfe693c80, 0xfe68ce40, 0xfe687b21, 0xfe68f25e, 0xfe68cbef, 0xfe68c2aa, 0xfe68a895,
+    0xfe6856ae, 0xfe688b45, 0xfe67f409, 0xfe68bbe9, 0xfe67d260, 0xfe6823f0, 0xfe686cb0, 0xfe67fafa,
+    0xfe68a968, 0xfe67d2ca, 0xfe6830c5, 0xfe688308, 0xfe67c828, 0xfe67d109, 0xfe677c51, 0xfe6740c0,
+    0xfe6821eb, 0xfe673cc4, 0xfe68114b, 0xfe66e192, 0xfe67b0d1, 0xfe67a610, 0xfe66d0ac, 0xfe66d125,
+    0xfe67b1fc, 0xfe677428, 0xfe6792dc, 0xfe67835b, 0xfe66ff59, 0xfe66abb6, 0xfe66c544, 0xfe66baed,
+    0xfe66db3d, 0xfe66957d, 0xfe661f3a, 0xfe65e93c, 0xfe65e757, 0xfe66e0ab, 0xfe65a1ff, 0xfe65d412,
+    0xfe667fbf, 0xfe65756d, 0xfe665a13, 0xfe65e178, 0xfe65ee9e, 0xfe653f90, 0xfe65e4ea, 0xfe65aede,
+    0xfe6631c4, 0xfe658865, 0xfe64e27e, 0xfe654890, 0xfe65362d, 0xfe651fd4, 0xfe64d2c7, 0xfe649a00,
+    0xfe659756, 0xfe6545e0, 0xfe647855, 0xfe649f3b, 0xfe64572a, 0xfe648cd0, 0xfe64849f, 0xfe6423d0,
+    0xfe652c79, 0xfe651e5d, 0xfe644153, 0xfe65015a, 0xfe641ee2, 0xfe6441c4, 0xfe63fbd6, 0xfe64c727,
+    0xfe63c42b, 0xfe6439d9, 0xfe649121, 0xfe63d2f5, 0xfe634190, 0xfe63d970, 0xfe635e34, 0xfe63d14e,
+    0xfe6332cf, 0xfe63524b, 0xfe631c86, 0xfe63738b, 0xfe62dcdc, 0xfe63760e, 0xfe6376ca, 0xfe62c2ce,
+    0xfe637f4d, 0xfe62edd4, 0xfe634b04, 0xfe632646, 0xfe62fc75, 0xfe62b7b3, 0xfe6252e0, 0xfe63240a,
+    0xfe6335cf, 0xfe62875c, 0xfe6291c3, 0xfe61f972, 0xfe623c99, 0xfe628428, 0xfe62d0d9, 0xfe625975,
+    0xfe6201e8, 0xfe62a065, 0xfe6175d5, 0xfe619cfc, 0xfe61513b, 0xfe616e8a, 0xfe624ea1, 0xfe61a7dc,
+    0xfe61a822, 0xfe612ce6, 0xfe612c05, 0xfe61ce7f, 0xfe613e71, 0xfe61c05f, 0xfe613b7a, 0xfe60ec42,
+    0xfe6089e4, 0xfe60cb2d, 0xfe6183e2, 0xfe608771, 0xfe609d06, 0xfe6134ed, 0xfe6052c1, 0xfe608cf0,
+    0xfe602580, 0xfe6065ab, 0xfe610814, 0xfe6102b7, 0xfe604ba1, 0xfe60c932, 0xfe60cf29, 0xfe6068b5,
+    0xfe5fc948, 0xfe608158, 0xfe5ff2a0, 0xfe607de3, 0xfe60117c, 0xfe5f6929, 0xfe6048af, 0xfe5f6a10,
+    0xfe5f0040, 0xfe602204, 0xfe5f2c49, 0xfe5fff25, 0xfe5f6d4d, 0xfe5f3a48, 0xfe5fc2b5, 0xfe5fb936,
+    0xfe5f7093, 0xfe5f57e9, 0xfe5f8c7c, 0xfe5f7b8e, 0xfe5e4ff0, 0xfe5eb6a7, 0xfe5edd91, 0xfe5f3732,
+    0xfe5e7bd9, 0xfe5f1c38, 0xfe5f1100, 0xfe5efe2f, 0xfe5ef0e0, 0xfe5edeba, 0xfe5ecf49, 0xfe5e905f,
+    0xfe5ea814, 0xfe5e97f5, 0xfe5e2cb8, 0xfe5dc6e6, 0xfe5d6c64, 0xfe5e53ed, 0xfe5dca6a, 0xfe5d92f6,
+    0xfe5e2297, 0xfe5e2387, 0xfe5d2d20, 0xfe5dda5f, 0xfe5d1924, 0xfe5d856d, 0xfe5d6393, 0xfe5ccaf1,
+    0xfe5daab0, 0xfe5d82d2, 0xfe5d8bf9, 0xfe5c7120, 0xfe5d628b, 0xfe5d420d, 0xfe5d49c5, 0xfe5d42e0,
+    0xfe5c60a3, 0xfe5ca4d2, 0xfe5c247f, 0xfe5cdfdd, 0xfe5ce2fa, 0xfe5bf74e, 0xfe5c6709, 0xfe5c0ab4,
+    0xfe5cb20d, 0xfe5b9cd7, 0xfe5c9574, 0xfe5ba790, 0xfe5c07e6, 0xfe5bfe35, 0xfe5b8837, 0xfe5c43f2,
+    0xfe5c3440, 0xfe5b9105, 0xfe5c0a8a, 0xfe5b29c5, 0xfe5ba81c, 0xfe5b1710, 0xfe5b5911, 0xfe5ae91b,
+    0xfe5b66ce, 0xfe5ba14a, 0xfe5a9afe, 0xfe5b82bd, 0xfe5b7236, 0xfe5a5b93, 0xfe5af9b4, 0xfe5af3cc,
+    0xfe5afc99, 0xfe5b229c, 0xfe5ac82c, 0xfe5b014b, 0xfe5a1a34, 0xfe5ab236, 0xfe5a8812, 0xfe5abe5a,
+    0xfe59c774, 0xfe5a2578, 0xfe5a8dc4, 0xfe59a238, 0xfe5a6bf4, 0xfe59ee79, 0xfe592e3e, 0xfe5a1a1c,
+    0xfe592083, 0xfe592c32, 0xfe599769, 0xfe5901c2, 0xfe59d70d, 0xfe59defe, 0xfe58d76c, 0xfe59bef6,
+    0xfe58f4e2, 0xfe58e496, 0xfe598f95, 0xfe585a3d, 0xfe584ef2, 0xfe596202, 0xfe58c12b, 0xfe5817f9,
+    0xfe582dd1, 0xfe57f477, 0xfe582733, 0xfe589a7a, 0xfe57f00a, 0xfe57c1a2, 0xfe57ded1, 0xfe5810a8,
+    0xfe580efb, 0xfe57bded, 0xfe57f354, 0xfe57b713, 0xfe58765c, 0xfe57cc2e, 0xfe58180f, 0xfe57b9da,
+    0xfe583427, 0xfe56f8ef, 0xfe579595, 0xfe5801db, 0xfe576c0c, 0xfe57584b, 0xfe57d325, 0xfe56b619,
+    0xfe56bc16, 0xfe56d2de, 0xfe56fbd0, 0xfe569bb6, 0xfe568eca, 0xfe568547, 0xfe56cdb8, 0xfe5688df,
+    0xfe56b3ea, 0xfe5618a4, 0xfe571076, 0xfe56daef, 0xfe56f3e2, 0xfe56875a, 0xfe562c86, 0xfe559fff,
+    0xfe559317, 0xfe55e8e7, 0xfe5645f5, 0xfe568367, 0xfe558993, 0xfe559c06, 0xfe55f58f, 0xfe564321,
+    0xfe559090, 0xfe55f98c, 0xfe557e58, 0xfe55d72f, 0xfe55f2d7, 0xfe550d0c, 0xfe55c86f, 0xfe55c13e,
+    0xfe557fcf, 0xfe554fac, 0xfe55929f, 0xfe546d6e, 0xfe54bf2f, 0xfe550b99, 0xfe554ddf, 0xfe5447bc,
+    0xfe543801, 0xfe551ede, 0xfe546d75, 0xfe54fead, 0xfe54ef61, 0xfe53d2e7, 0xfe54b545, 0xfe54c0c8,
+    0xfe53afee, 0xfe5490fd, 0xfe538fde, 0xfe539c39, 0xfe5411df, 0xfe535e11, 0xfe545230, 0xfe53bf00,
+    0xfe53737d, 0xfe533b68, 0xfe5413d8, 0xfe532a45, 0xfe53ea43, 0xfe53dd0d, 0xfe53d007, 0xfe53c00f,
+    0xfe53b168, 0xfe534d7d, 0xfe53875a, 0xfe5291de, 0xfe5370cf, 0xfe524516, 0xfe530230, 0xfe524002,
+    0xfe520004, 0xfe5322c0, 0xfe529f8f, 0xfe52cac1, 0xfe529171, 0xfe52ca57, 0xfe52cc11, 0xfe52c28f,
+    0xfe51d650, 0xfe52a2f0, 0xfe527982, 0xfe527fa0, 0xfe526eca, 0xfe5162ea, 0xfe51a9a7, 0xfe523843,
+    0xfe5223b6, 0xfe50fe68, 0xfe51d6f2, 0xfe518a6f, 0xfe51f4d0, 0xfe51e2b8, 0xfe50aa4a, 0xfe51a8b0,
+    0xfe51b496, 0xfe51a57f, 0xfe51947d, 0xfe51858d, 0xfe5172fb, 0xfe5030d1, 0xfe5153a4, 0xfe5044b0,
+    0xfe5119e6, 0xfe50893f, 0xfe5109f7, 0xfe5038bc, 0xfe50ce5e, 0xfe50318f, 0xfe4fe3fd, 0xfe507a7c,
+    0xfe50ad4a, 0xfe502e58, 0xfe50164d, 0xfe503174, 0xfe4fcdb7, 0xfe4fba1d, 0xfe50544a, 0xfe503ed5,
+    0xfe4f93fe, 0xfe4f9f1c, 0xfe4f3b8a, 0xfe5000c1, 0xfe4fe298, 0xfe4fd8ff, 0xfe4f42df, 0xfe4fb393,
+    0xfe4ef2e6, 0xfe4f50e4, 0xfe4e764d, 0xfe4f7ebf, 0xfe4f6247, 0xfe4e6e64, 0xfe4f0a58, 0xfe4f1a3d,
+    0xfe4e3b18, 0xfe4f162d, 0xfe4f0313, 0xfe4ef915, 0xfe4eb070, 0xfe4e21bd, 0xfe4e0208, 0xfe4ebbd4,
+    0xfe4dbf5b, 0xfe4e8933, 0xfe4e8b7f, 0xfe4e786a, 0xfe4e5a11, 0xfe4e5888, 0xfe4dd4a9, 0xfe4e3377,
+    0xfe4e278e, 0xfe4d6179, 0xfe4d45f6, 0xfe4de7d8, 0xfe4db807, 0xfe4d2cf8, 0xfe4d9610, 0xfe4cbe33,
+    0xfe4d8a9a, 0xfe4d871c, 0xfe4d7f74, 0xfe4d7b61, 0xfe4cac13, 0xfe4d56a3, 0xfe4d42c9, 0xfe4d332c,
+    0xfe4c0811, 0xfe4d150f, 0xfe4cf7f9, 0xfe4c6b7b, 0xfe4ce1b2, 0xfe4cc822, 0xfe4cd15b, 0xfe4cb5f3,
+    0xfe4c97ab, 0xfe4c7c9a, 0xfe4c70d4, 0xfe4c79aa, 0xfe4bf4c0, 0xfe4b4aa5, 0xfe4b8693, 0xfe4c2686,
+    0xfe4baf19, 0xfe4c18e9, 0xfe4b4662, 0xfe4bf369, 0xfe4b472f, 0xfe4ae92b, 0xfe4bb82e, 0xfe4bc2e2,
+    0xfe4a9c96, 0xfe4b9747, 0xfe4b4355, 0xfe4b7901, 0xfe4b338b, 0xfe4b3e2e, 0xfe4b47bd, 0xfe4a6de0,
+    0xfe4a6c53, 0xfe4af233, 0xfe4aa78c, 0xfe4a8e0d, 0xfe4ac769, 0xfe4a5e05, 0xfe4acf8f, 0xfe4abe2b,
+    0xfe49d2b2, 0xfe4aa3f4, 0xfe4a85d8, 0xfe4a68c8, 0xfe4a713a, 0xfe4a13fe, 0xfe4993fa, 0xfe4a02be,
+    0xfe49bec5, 0xfe49375a, 0xfe4a1312, 0xfe4a019d, 0xfe490d0f, 0xfe48c79f, 0xfe496891, 0xfe492836,
+    0xfe495321, 0xfe495e32, 0xfe491cb9, 0xfe48b125, 0xfe48a2d4, 0xfe484faa, 0xfe4849f3, 0xfe4837d5,
+    0xfe493170, 0xfe48387a, 0xfe482058, 0xfe480255, 0xfe47c442, 0xfe47de70, 0xfe47ca47, 0xfe47cb37,
+    0xfe484a8b, 0xfe478034, 0xfe479eb3, 0xfe476f13, 0xfe476205, 0xfe47e3f9, 0xfe47a412, 0xfe4793f2,
+    0xfe47d6f0, 0xfe470f3a, 0xfe474122, 0xfe46fe2e, 0xfe46d88c, 0xfe47ab94, 0xfe46c583, 0xfe46c7a2,
+    0xfe469992, 0xfe4680e1, 0xfe468dff, 0xfe46c793, 0xfe464b97, 0xfe4659a7, 0xfe462e1b, 0xfe461076,
+    0xfe468184, 0xfe464129, 0xfe45ef00, 0xfe4650fa, 0xfe462a9d, 0xfe45cb00, 0xfe463c24, 0xfe45d715,
+    0xfe45b36a, 0xfe46134d, 0xfe456211, 0xfe457159, 0xfe45714b, 0xfe45567e, 0xfe455450, 0xfe4516be,
+    0xfe45359b, 0xfe452fcc, 0xfe44f470, 0xfe450ea3, 0xfe44faf7, 0xfe452449, 0xfe451848, 0xfe452621,
+    0xfe44b890, 0xfe44d129, 0xfe4474e3, 0xfe44ac8d, 0xfe447c37, 0xfe4493f3, 0xfe446c6c, 0xfe44490c,
+    0xfe443cba, 0xfe43ff3b, 0xfe444414, 0xfe442114, 0xfe44011f, 0xfe43b25a, 0xfe43b73a, 0xfe43b536,
+    0xfe43b60c, 0xfe4406cb, 0xfe437692, 0xfe4355d8, 0xfe43419e, 0xfe43485c, 0xfe438693, 0xfe439d60,
+    0xfe4307ad, 0xfe435b0a, 0xfe42e5fe, 0xfe42d619, 0xfe42f68d, 0xfe42eb4f, 0xfe430d48, 0xfe42a104,
+    0xfe428592, 0xfe429075, 0xfe42a663, 0xfe4250b6, 0xfe4273ed, 0xfe424bec, 0xfe427f47, 0xfe42794c,
+    0xfe4204d0, 0xfe41ff62, 0xfe4204bd, 0xfe42127f, 0xfe41d58e, 0xfe423875, 0xfe41c9ba, 0xfe4194ee,
+    0xfe41c7a9, 0xfe41ba4f, 0xfe4183e6, 0xfe418ecc, 0xfe417c64, 0xfe41625e, 0xfe412000, 0xfe411000,
+    0xfe412865, 0xfe40f000, 0xfe411e99, 0xfe412034, 0xfe40c000, 0xfe40ed6c, 0xfe40f0a2, 0xfe409000,
+    0xfe40d187, 0xfe40708f, 0xfe406472, 0xfe4064b5, 0xfe404a81, 0xfe405c43, 0xfe4035b1, 0xfe4011b9,
+    0xfe401672, 0xfe3ff19d, 0xfe3fe090, 0xfe3fd20a, 0xfe3fd55c, 0xfe3fb8ea, 0xfe3fa0dd, 0xfe3f98ea,
+    0xfe3f808f, 0xfe3f7000, 0xfe3f6274, 0xfe3f5559, 0xfe3f4126, 0xfe3f3000, 0xfe3f2000, 0xfe3f1000,
+    0xfe3f1f7b, 0xfe3ef9cc, 0xfe3f02fc, 0xfe3ee198, 0xfe3efc6a, 0xfe3f000e, 0xfe3ef304, 0xfe3eb89f,
+    0xfe3e87e1, 0xfe3e8511, 0xfe3e645f, 0xfe3e5ffa, 0xfe3e519e, 0xfe3e3f78, 0xfe3e3897, 0xfe3e14a3,
+    0xfe3e09cc, 0xfe3e253b, 0xfe3e2cab, 0xfe3ddbad, 0xfe3dc762, 0xfe3db80c, 0xfe3dcafa, 0xfe3de28c,
+    0xfe3dbbb4, 0xfe3da268, 0xfe3db1d0, 0xfe3d8a87, 0xfe3d8114, 0xfe3d394f, 0xfe3d4a1b, 0xfe3d4be4,
+    0xfe3d5236, 0xfe3d4355, 0xfe3cfddc, 0xfe3ce19d, 0xfe3cc65d, 0xfe3cfdb3, 0xfe3ca6d4, 0xfe3c962e,
+    0xfe3cbf90, 0xfe3c70cc, 0xfe3c6f24, 0xfe3ca6c9, 0xfe3c61de, 0xfe3c618f, 0xfe3c475c, 0xfe3c68cc,
+    0xfe3c1396, 0xfe3c2946, 0xfe3c311f, 0xfe3c26b3, 0xfe3bf2e3, 0xfe3bea49, 0xfe3bf58d, 0xfe3be827,
+    0xfe3bc4e7, 0xfe3bb1da, 0xfe3b974c, 0xfe3ba6a4, 0xfe3b98a4, 0xfe3b3000, 0xfe3b4a07, 0xfe3b46c3,
+    0xfe3b0b84, 0xfe3b2634, 0xfe3b320b, 0xfe3ad000, 0xfe3b10f0, 0xfe3ae42d, 0xfe3aa28d, 0xfe3acbca,
+    0xfe3adc57, 0xfe3aad6d, 0xfe3a91e8, 0xfe3a5a2c, 0xfe3a44e6, 0xfe3a729c, 0xfe3a27b0, 0xfe3a2bd1,
+    0xfe3a3d00, 0xfe39f1ef, 0xfe3a218b, 0xfe39e507, 0xfe39ca46, 0xfe39d94d, 0xfe39a074, 0xfe39903a,
+    0xfe39a5e7, 0xfe3970ce, 0xfe39739d, 0xfe395212, 0xfe394000, 0xfe3979e3, 0xfe393580, 0xfe392f26,
+    0xfe39563b, 0xfe38f0cc, 0xfe391c03, 0xfe391151, 0xfe390148, 0xfe38fb0c, 0xfe38bf35, 0xfe38b0e7,
+    0xfe38800c, 0xfe388887, 0xfe38b983, 0xfe385f66, 0xfe387abd, 0xfe38588e, 0xfe384d15, 0xfe386319,
+    0xfe3804b3, 0xfe384528, 0xfe37ed7d, 0xfe37ecf8, 0xfe38088e, 0xfe37dd6f, 0xfe37e3e2, 0xfe37900d,
+    0xfe379649, 0xfe377681, 0xfe377afb, 0xfe3777fe, 0xfe378710, 0xfe376365, 0xfe373648, 0xfe37120c,
+    0xfe372a25, 0xfe37224b, 0xfe370679, 0xfe3724cb, 0xfe3716c5, 0xfe36e596, 0xfe36db13, 0xfe36d52e,
+    0xfe36c92d, 0xfe36b9f2, 0xfe366cc2, 0xfe367256, 0xfe364efe, 0xfe364c61, 0xfe365f56, 0xfe3624de,
+    0xfe364456, 0xfe361ca7, 0xfe362bca, 0xfe361c67, 0xfe36056e, 0xfe35b063, 0xfe35af36, 0xfe35ced9,
+    0xfe35cfe3, 0xfe35af0f, 0xfe35b737, 0xfe355273, 0xfe356fe2, 0xfe3573df, 0xfe35280d, 0xfe353ea0,
+    0xfe3505d3, 0xfe34f199, 0xfe3504a9, 0xfe35099f, 0xfe34f4f9, 0xfe34b7a8, 0xfe34a80c, 0xfe34a913,
+    0xfe348614, 0xfe3475da, 0xfe3464cb, 0xfe346aa1, 0xfe34758a, 0xfe34358d, 0xfe347013, 0xfe344e78,
+    0xfe342848, 0xfe33f077, 0xfe33e97d, 0xfe33eaa0, 0xfe33c5b1, 0xfe33b000, 0xfe33c4f2, 0xfe33a7ff,
+    0xfe339012, 0xfe339eff, 0xfe339c4f, 0xfe335523, 0xfe3344e9, 0xfe333000, 0xfe333c91, 0xfe3333e1,
+    0xfe330000, 0xfe32f2e8, 0xfe332091, 0xfe32d1c5, 0xfe32c387, 0xfe32b135, 0xfe32a0fb, 0xfe329f43,
+    0xfe328b92, 0xfe327000, 0xfe32a45c, 0xfe325459, 0xfe3240fa, 0xfe327d7f, 0xfe322af0, 0xfe3252e1,
+    0xfe322d1c, 0xfe31f000, 0xfe321f35, 0xfe31db67, 0xfe31cc38, 0xfe31e634, 0xfe31a149, 0xfe319000,
+    0xfe318000, 0xfe31707f, 0xfe316000, 0xfe315000, 0xfe31438a, 0xfe313000, 0xfe3169c4, 0xfe31107e,
+    0xfe3105c5, 0xfe311692, 0xfe30f068, 0xfe30d204, 0xfe30cf05, 0xfe30b978, 0xfe30e889, 0xfe309d43,
+    0xfe308b82, 0xfe3079be, 0xfe3069bb, 0xfe305a55, 0xfe304000, 0xfe303000, 0xfe30256d, 0xfe3054f3,
+    0xfe301cdc, 0xfe2ff000, 0xfe2ff09d, 0xfe2fe063, 0xfe2fc000, 0xfe2fbd0c, 0xfe2facd2, 0xfe2f9000,
+    0xfe2f87d6, 0xfe2f779c, 0xfe2f650f, 0xfe2f63f6, 0xfe2f4027, 0xfe2f3d47, 0xfe2f2d0d, 0xfe2f1000,
+    0xfe2f09b0, 0xfe2ef976, 0xfe2ee017, 0xfe2eddf6, 0xfe2ec000, 0xfe2eba84, 0xfe2ec8cb, 0xfe2e9000,
+    0xfe2e8000, 0xfe2e7eba, 0xfe2e6061, 0xfe2e5027, 0xfe2e72c7, 0xfe2e320c, 0xfe2e61ab, 0xfe2e11ff,
+    0xfe2e0000, 0xfe2df32c, 0xfe2de48a, 0xfe2dd000, 0xfe2dc8fa, 0xfe2dba51, 0xfe2daf06, 0xfe2dd103,
+    0xfe2d877a, 0xfe2d79ce, 0xfe2d6000, 0xfe2d5000, 0xfe2d4f05, 0xfe2d3000, 0xfe2d3868, 0xfe2d1000,
+    0xfe2d0190, 0xfe2d187b, 0xfe2ce042, 0xfe2cd063, 0xfe2ccb34, 0xfe2cb063, 0xfe2ca000, 0xfe2c9bd3,
+    0xfe2c9cdc, 0xfe2cc960, 0xfe2c7cdc, 0xfe2c7afc, 0xfe2c8458, 0xfe2c31b5, 0xfe2c21e9, 0xfe2c1222,
+    0xfe2c1574, 0xfe2bf0c5, 0xfe2be0f5, 0xfe2bd514, 0xfe2bdf64, 0xfe2bba50, 0xfe2ba000, 0xfe2ba02a,
+    0xfe2b8ff0, 0xfe2b7000, 0xfe2b6a3a, 0xfe2b5a00, 0xfe2b9bb2, 0xfe2b39e4, 0xfe2b35d5, 0xfe2b3a6e,
+    0xfe2b2146, 0xfe2af1e9, 0xfe2b2dc8, 0xfe2af8b7, 0xfe2b0f3e, 0xfe2b012d, 0xfe2aab67, 0xfe2a9cd4,
+    0xfe2a9885, 0xfe2a7a3a, 0xfe2a6331, 0xfe2a58a7, 0xfe2a49e4, 0xfe2a36ed, 0xfe2a29e4, 0xfe2a1bc5,
+    0xfe2a1aff, 0xfe2a3344, 0xfe29e0a4, 0xfe2a0af1, 0xfe29ccb7, 0xfe29b040, 0xfe29a8ef, 0xfe299781,
+    0xfe29d2e5, 0xfe29c539, 0xfe29b5bb, 0xfe29a9a5, 0xfe294279, 0xfe293984, 0xfe292041, 0xfe29195b,
+    0xfe290675, 0xfe28fddb, 0xfe28e6ec, 0xfe28d646, 0xfe290be1, 0xfe28b0e4, 0xfe28a000, 0xfe289e9f,
+    0xfe28bba6, 0xfe28700c, 0xfe286ff1, 0xfe286f18, 0xfe2889f5, 0xfe285d35, 0xfe282131, 0xfe281311,
+    0xfe2857b1, 0xfe27f017, 0xfe27e8df, 0xfe27d8a5, 0xfe27cf69, 0xfe280ac8, 0xfe27a1ba, 0xfe2799b3,
+    0xfe278979, 0xfe277000, 0xfe276018, 0xfe27587a, 0xfe27584d, 0xfe274813, 0xfe272e20, 0xfe273860,
+    0xfe274e98, 0xfe273269, 0xfe26ef05, 0xfe272297, 0xfe26f7bc, 0xfe26b1c2, 0xfe26e447, 0xfe269504,
+    0xfe26b36f, 0xfe2675af, 0xfe266000, 0xfe2655c0, 0xfe264646, 0xfe263000, 0xfe2620e4, 0xfe261000,
+    0xfe26002c, 0xfe25f61e, 0xfe25e5b2, 0xfe25d06b, 0xfe2606f9, 0xfe25be89, 0xfe25b055, 0xfe259647,
+    0xfe258ef2, 0xfe25a4c4, 0xfe2574e8, 0xfe255d30, 0xfe256dd1, 0xfe25335b, 0xfe2526ed, 0xfe25135b,
+    0xfe250000, 0xfe24f000, 0xfe24e55a, 0xfe24d0f7, 0xfe24dcc9, 0xfe24b000, 0xfe24a3cc, 0xfe249392,
+    0xfe248000, 0xfe24775b, 0xfe246721, 0xfe245000, 0xfe2441a3, 0xfe243169, 0xfe2449d9, 0xfe247109,
+    0xfe240145, 0xfe23f63d, 0xfe23e603, 0xfe23d000, 0xfe23ca8a, 0xfe23ba50, 0xfe23ae68, 0xfe239e2e,
+    0xfe238000, 0xfe2378b0, 0xfe23a668, 0xfe235000, 0xfe234000, 0xfe2331e9, 0xfe23265a, 0xfe231620,
+    0xfe234ee2, 0xfe22f261, 0xfe22e227, 0xfe230f18, 0xfe22c000, 0xfe22d7f6, 0xfe22a477, 0xfe229000,
+    0xfe2289d4, 0xfe227a3e, 0xfe226ef3, 0xfe228ed1, 0xfe224767, 0xfe2237fa, 0xfe222000, 0xfe221000,
+    0xfe220ef2, 0xfe21f000, 0xfe21e5a4, 0xfe21d000, 0xfe21c1d1, 0xfe21e7be, 0xfe21a15d, 0xfe219107,
+    0xfe2180cd, 0xfe217093, 0xfe216000, 0xfe215bc0, 0xfe21a134, 0xfe21342b, 0xfe2123f1, 0xfe215fa8,
+    0xfe21002d, 0xfe20f1a2, 0xfe20e095, 0xfe20d20f, 0xfe20d561, 0xfe20b8ef, 0xfe20a0e2, 0xfe2098ef,
+    0xfe209cf5, 0xfe2070e1, 0xfe206000, 0xfe205051, 0xfe204017, 0xfe203000, 0xfe20235c, 0xfe201322,
+    0xfe20610b, 0xfe1ff375, 0xfe1fe016, 0xfe2013e1, 0xfe201fb2, 0xfe1fc000, 0xfe1fb128, 0xfe1fb8a4,
+    0xfe1fc02f, 0xfe1fcca0, 0xfe1f6cdb, 0xfe1f5fff, 0xfe1f6fc9, 0xfe1f3f7d, 0xfe1f2768, 0xfe1f13d3,
+    0xfe1f09d1, 0xfe1ef6da, 0xfe1f231a, 0xfe1edbb2, 0xfe1f1b1c, 0xfe1efadf, 0xfe1ea091, 0xfe1eefa8,
+    0xfe1e8f84, 0xfe1e702d, 0xfe1ebf8b, 0xfe1e5e57, 0xfe1e9b1b, 0xfe1e9127, 0xfe1e2f7d, 0xfe1e6e3b,
+    0xfe1e0266, 0xfe1df634, 0xfe1de02e, 0xfe1de1a2, 0xfe1e1d41, 0xfe1db8b0, 0xfe1da6d9, 0xfe1d9633,
+    0xfe1d802d, 0xfe1d70d1, 0xfe1d6000, 0xfe1d72e7, 0xfe1d4ce2, 0xfe1d4026, 0xfe1d2fde, 0xfe1d2f05,
+    0xfe1d5852, 0xfe1d0304, 0xfe1d2936, 0xfe1ce1c8, 0xfe1ccfdd, 0xfe1cb004, 0xfe1ca785, 0xfe1cac67,
+    0xfe1cc4ec, 0xfe1cb1df, 0xfe1c9751, 0xfe1c61d1, 0xfe1c5984, 0xfe1c3000, 0xfe1c2005, 0xfe1c1867,
+    0xfe1c0b89, 0xfe1c0516, 0xfe1bee0d, 0xfe1bd128, 0xfe1bdad9, 0xfe1c011b, 0xfe1ba681, 0xfe1bb08f,
+    0xfe1bb7a9, 0xfe1b71af, 0xfe1ba434, 0xfe1b6c74, 0xfe1b8bf0, 0xfe1b5b8c, 0xfe1b27b5, 0xfe1b1e69,
+    0xfe1b3d05, 0xfe1af1f4, 0xfe1ae0d1, 0xfe1ae50c, 0xfe1aca4b, 0xfe1abe68, 0xfe1abf36, 0xfe1a9a22,
+    0xfe1aac73, 0xfe1a7605, 0xfe1a7042, 0xfe1a95df, 0xfe1a4a0c, 0xfe1a72ee, 0xfe1a4dbd, 0xfe1a6b4a,
+    0xfe1a2525, 0xfe1a3bd1, 0xfe1a3599, 0xfe1a2db8, 0xfe1a014d, 0xfe19e4b0, 0xfe1a04c2, 0xfe19f607,
+    0xfe19e8f2, 0xfe19888c, 0xfe19bd3f, 0xfe1999e9, 0xfe19474d, 0xfe194d53, 0xfe19606b, 0xfe19197c,
+    0xfe1909b6, 0xfe193e84, 0xfe18fad1, 0xfe19162a, 0xfe19130c, 0xfe190d48, 0xfe18da89, 0xfe189012,
+    0xfe18e5ba, 0xfe187887, 0xfe18c97c, 0xfe1878f9, 0xfe188715, 0xfe188e24, 0xfe18633a, 0xfe181211,
+    0xfe18164d, 0xfe183b88, 0xfe18471a, 0xfe183788, 0xfe180f32, 0xfe17e59b, 0xfe17b6ce, 0xfe1790b6,
+    0xfe17bea3, 0xfe1788ee, 0xfe176cc7, 0xfe17725b, 0xfe17731b, 0xfe176c4d, 0xfe178867, 0xfe17540b,
+    0xfe175be8, 0xfe175aac, 0xfe172bcf, 0xfe171c6c, 0xfe170b66, 0xfe16b068, 0xfe170bae, 0xfe16cede,
+    0xfe16cfe8, 0xfe16af14, 0xfe16ab32, 0xfe165000, 0xfe1652a0, 0xfe16384c, 0xfe162812, 0xfe1658ee,
+    0xfe1651f5, 0xfe15fdb8, 0xfe163cc3, 0xfe1667d2, 0xfe163309, 0xfe160679, 0xfe16069e, 0xfe15cb94,
+    0xfe15c4d8, 0xfe15b3df, 0xfe15b451, 0xfe15ba01, 0xfe1590f8, 0xfe153592, 0xfe154075, 0xfe1515de,
+    0xfe1500b6, 0xfe14f07c, 0xfe14e982, 0xfe14eaa5, 0xfe150946, 0xfe14b9be, 0xfe14fa7f, 0xfe1520d0,
+    0xfe149027, 0xfe14d0ee, 0xfe14f076, 0xfe1499a4, 0xfe14791c, 0xfe14841a, 0xfe147713, 0xfe14af53,
+    0xfe1402f3, 0xfe14215e, 0xfe143494, 0xfe13d000, 0xfe140c07, 0xfe13b6c7, 0xfe13a4c0, 0xfe13dfa3,
+    0xfe13aacf, 0xfe137364, 0xfe13ba94, 0xfe1398b2, 0xfe134f71, 0xfe138e68, 0xfe1326c8, 0xfe136763,
+    0xfe1323d0, 0xfe135417, 0xfe1300d4, 0xfe132288, 0xfe12c253, 0xfe12dbc0, 0xfe12a01b, 0xfe129a22,
+    0xfe12864f, 0xfe127e00, 0xfe1266c6, 0xfe125620, 0xfe129617, 0xfe1230be, 0xfe122000, 0xfe1211bb,
+    0xfe12161f, 0xfe11f5f2, 0xfe11ef0b, 0xfe11e2a8, 0xfe11c0a3, 0xfe120532, 0xfe11a061, 0xfe11b7c8,
+    0xfe11e32b, 0xfe118f19, 0xfe1169a6, 0xfe11596c, 0xfe1184d9, 0xfe1178eb, 0xfe116401, 0xfe1117cc,
+    0xfe110792, 0xfe10f000, 0xfe10f2a8, 0xfe10d854, 0xfe10c576, 0xfe10b53c, 0xfe10a1e0, 0xfe109000,
+    0xfe10d7a4, 0xfe10ad68, 0xfe106000, 0xfe105016, 0xfe104640, 0xfe10319c, 0xfe102621, 0xfe101a1e,
+    0xfe1004d8, 0xfe102ded, 0xfe0fe7a2, 0xfe0fde56, 0xfe0ffcf2, 0xfe0fb1e1, 0xfe0fa0be, 0xfe0fa4f9,
+    0xfe0f8a38, 0xfe0f7e55, 0xfe0f6066, 0xfe0f5000, 0xfe0f5393, 0xfe0f3000, 0xfe0f2000, 0xfe0f10ac,
+    0xfe0f0000, 0xfe0ef530, 0xfe0ee9a2, 0xfe0eef18, 0xfe0edf00, 0xfe0eb0be, 0xfe0ef4eb, 0xfe0e9fd2,
+    0xfe0eda74, 0xfe0ea49d, 0xfe0e7f27, 0xfe0e70d9, 0xfe0e6e1b, 0xfe0e4879, 0xfe0e63ea, 0xfe0e1f58,
+    0xfe0e073a, 0xfe0df39c, 0xfe0df0ce, 0xfe0dd969, 0xfe0dc4a5, 0xfe0dbb84, 0xfe0dad6f, 0xfe0d96ff,
+    0xfe0d8063, 0xfe0d9d61, 0xfe0d6f56, 0xfe0d5f1c, 0xfe0d563b, 0xfe0d3e29, 0xfe0d6917, 0xfe0d37f0,
+    0xfe0d4702, 0xfe0d2357, 0xfe0cf63a, 0xfe0cd1fe, 0xfe0cd63a, 0xfe0cb672, 0xfe0cc66b, 0xfe0cc43d,
+    0xfe0c86ab, 0xfe0ca588, 0xfe0c76bb, 0xfe0c50a3, 0xfe0c7e90, 0xfe0c3556, 0xfe0c6901, 0xfe0c3248,
+    0xfe0c0ef0, 0xfe0c3734, 0xfe0c1f48, 0xfe0be4d0, 0xfe0c242d, 0xfe0bdc99, 0xfe0bebbc, 0xfe0bdc59,
+    0xfe0bb8f9, 0xfe0b7055, 0xfe0b6f28, 0xfe0bad8d, 0xfe0ba313, 0xfe0b6f01, 0xfe0b2247, 0xfe0b1265,
+    0xfe0b128d, 0xfe0af839, 0xfe0ae7ff, 0xfe0ae4e8, 0xfe0ac5c5, 0xfe0ab18b, 0xfe0ab849, 0xfe0ac991,
+    0xfe0a87fe, 0xfe0a779a, 0xfe0a67fe, 0xfe0a55eb, 0xfe0a4606, 0xfe0a35cc, 0xfe0a7302, 0xfe0a74fb,
+    0xfe0a4e3b, 0xfe0a4531, 0xfe0a5115, 0xfe0a2765, 0xfe09c0a3, 0xfe09b069, 0xfe09f874, 0xfe0a0086,
+    0xfe0985a3, 0xfe097000, 0xfe096f4f, 0xfe0967f1, 0xfe094000, 0xfe09457b, 0xfe095796, 0xfe091515,
+    0xfe0904db, 0xfe08f94d, 0xfe092296, 0xfe08f3d3, 0xfe08c6d1, 0xfe08b2da, 0xfe08dc21, 0xfe08edf3,
+    0xfe08dd98, 0xfe08c6f4, 0xfe08bd79, 0xfe08870f, 0xfe087b9a, 0xfe08383a, 0xfe0855e2, 0xfe085fd7,
+    0xfe080000, 0xfe0845c1, 0xfe07e914, 0xfe082439, 0xfe07cc52, 0xfe07b6e4, 0xfe07f9d3, 0xfe07ef30,
+    0xfe07bca2, 0xfe07d009, 0xfe077ff4, 0xfe0783cc, 0xfe079daf, 0xfe077cce, 0xfe077a9a, 0xfe0765f0,
+    0xfe07639e, 0xfe074d39, 0xfe0738f9, 0xfe072a89, 0xfe071de0, 0xfe070a29, 0xfe06ef04, 0xfe06e853,
+    0xfe06acb8, 0xfe067088, 0xfe069e75, 0xfe06adce, 0xfe0695fc, 0xfe06522d, 0xfe0654f7, 0xfe062c38,
+    0xfe06406c, 0xfe06596a, 0xfe06441d, 0xfe0635c7, 0xfe06320a, 0xfe0612fa, 0xfe060652, 0xfe05d325,
+    0xfe05de07, 0xfe05e1bc, 0xfe059e76, 0xfe05beb3, 0xfe0551ba, 0xfe0531f2, 0xfe05538a, 0xfe05181e,
+    0xfe0507e4, 0xfe052c55, 0xfe04e5aa, 0xfe04d570, 0xfe0502c3, 0xfe0501ee, 0xfe04fc81, 0xfe04cda1,
+    0xfe04e2f9, 0xfe04ba86, 0xfe0478c1, 0xfe0492d2, 0xfe04874f, 0xfe049320, 0xfe047eb7, 0xfe046c7b,
+    0xfe046270, 0xfe04100d, 0xfe043be5, 0xfe03d049, 0xfe041ac1, 0xfe03b5c2, 0xfe03e370, 0xfe03d336,
+    0xfe03e998, 0xfe03c25f, 0xfe03672d, 0xfe036560, 0xfe039d74, 0xfe036741, 0xfe0324c0, 0xfe031486,
+    0xfe031c68, 0xfe035ac6, 0xfe03037e, 0xfe02d2bf, 0xfe032231, 0xfe02b4fa, 0xfe02a35e, 0xfe029324,
+    0xfe028000, 0xfe027f1a, 0xfe0289c1, 0xfe025b2f, 0xfe024ded, 0xfe028074, 0xfe02200e, 0xfe021118,
+    0xfe0236c5, 0xfe01f444, 0xfe023368, 0xfe01d3ce, 0xfe01c088, 0xfe01d302, 0xfe01a000, 0xfe01aa85,
+    0xfe01d1e2, 0xfe017000, 0xfe0160dc, 0xfe015000, 0xfe014000, 0xfe0136f1, 0xfe012ab3, 0xfe011000,
+    0xfe010d37, 0xfe00f37a, 0xfe00e000, 0xfe00d062, 0xfe00c000, 0xfe00b38e, 0xfe00a352, 0xfe009000,
+    0xfe0096bb, 0xfe007d20, 0xfe006000, 0xfe00658e, 0xfe004000, 0xfe003000, 0xfe003461,
+};
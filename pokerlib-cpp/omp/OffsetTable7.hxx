@@ -0,0 +1,1030 @@
+#include "HandEvaluator.h"
+
+// Offset table for the perfect hashing algorithm used in the evaluator (SevenCardLookupLayout, 8191 rows).
+// Generated by HandEvaluatorT::outputLookupTables().
+const uint32_t omp::SevenCardLookupLayout::PERF_HASH_ROW_OFFSETS[] {
+    0x0, 0xfffff000, 0xffffe000, 0xffffd000, 0xffffc000, 0xffffb000, 0xffffa000, 0xffff9000,
+    0xffff8000, 0xffff7000, 0xffff6000, 0xffff5000, 0xffff4000, 0xffff3000, 0xffff2000, 0xffff1000,
+    0xffff0000, 0xfffef000, 0xfffee000, 0xfffed000, 0xfffec000, 0xfffeb000, 0xfffea000, 0xfffe9000,
+    0xfffe8000, 0xfffe7000, 0xfffe6000, 0xfffe5000, 0xfffe4000, 0xfffe3000, 0xfffe2000, 0xfffe1000,
+    0xfffe0000, 0xfffdf000, 0xfffde000, 0xfffdd000, 0xfffdc000, 0xfffdb000, 0xfffda007, 0xfffd9000,
+    0xfffd8000, 0xfffd7011, 0xfffd6000, 0xfffd5000, 0xfffd4000, 0xfffd3000, 0xfffd2000, 0xfffd1017,
+    0xfffd0000, 0xfffcf000, 0xfffce012, 0xfffcd000, 0xfffcc000, 0xfffcb029, 0xfffca000, 0xfffc9000,
+    0xfffc8035, 0xfffc7000, 0xfffc6000, 0xfffc5013, 0xfffc4000, 0xfffc3000, 0xfffc20ac, 0xfffc1000,
+    0xfffc0000, 0xfffbf056, 0xfffbe000, 0xfffbd000, 0xfffbc029, 0xfffbb000, 0xfffba000, 0xfffb9062,
+    0xfffb8000, 0xfffb7000, 0xfffb6161, 0xfffb5000, 0xfffb4000, 0xfffb3061, 0xfffb2000, 0xfffb1000,
+    0xfffb01f8, 0xfffaf000, 0xfffae268, 0xfffad029, 0xfffac000, 0xfffab000, 0xfffaa1f7, 0xfffa9000,
+    0xfffa8017, 0xfffa7000, 0xfffa6000, 0xfffa5269, 0xfffa41f6, 0xfffa3000, 0xfffa229c, 0xfffa1000,
+    0xfffa0000, 0xfff9f0d8, 0xfff9e000, 0xfff9d000, 0xfff9c26a, 0xfff9b000, 0xfff9a000, 0xfff99017,
+    0xfff98000, 0xfff97000, 0xfff96036, 0xfff95000, 0xfff94000, 0xfff9329c, 0xfff92000, 0xfff91000,
+    0xfff902b6, 0xfff8f000, 0xfff8e000, 0xfff8d057, 0xfff8c000, 0xfff8b000, 0xfff8a0ac, 0xfff89000,
+    0xfff88000, 0xfff87056, 0xfff86000, 0xfff85000, 0xfff8429c, 0xfff83000, 0xfff82000, 0xfff81062,
+    0xfff80000, 0xfff7f000, 0xfff7e2c4, 0xfff7d000, 0xfff7c269, 0xfff7b061, 0xfff7a000, 0xfff79000,
+    0xfff782c3, 0xfff77000, 0xfff762c7, 0xfff75000, 0xfff74000, 0xfff7326a, 0xfff722c2, 0xfff71000,
+    0xfff70378, 0xfff6f000, 0xfff6e000, 0xfff6d2c8, 0xfff6c000, 0xfff6b000, 0xfff6a29c, 0xfff69000,
+    0xfff68000, 0xfff67470, 0xfff66000, 0xfff65000, 0xfff642c9, 0xfff63000, 0xfff62000, 0xfff61378,
+    0xfff60000, 0xfff5f000, 0xfff5e6dc, 0xfff5d000, 0xfff5c000, 0xfff5b29c, 0xfff5a000, 0xfff59000,
+    0xfff586db, 0xfff570f7, 0xfff56000, 0xfff55228, 0xfff54000, 0xfff53000, 0xfff52378, 0xfff51017,
+    0xfff50000, 0xfff4f227, 0xfff4e0f8, 0xfff4d000, 0xfff4c000, 0xfff4b904, 0xfff4a26a, 0xfff49226,
+    0xfff480d8, 0xfff47000, 0xfff462c4, 0xfff450f9, 0xfff44005, 0xfff43000, 0xfff42017, 0xfff41000,
+    0xfff402c3, 0xfff3f036, 0xfff3e045, 0xfff3d000, 0xfff3c904, 0xfff3b006, 0xfff3a000, 0xfff39b0c,
+    0xfff38044, 0xfff37000, 0xfff36057, 0xfff35005, 0xfff34000, 0xfff330ac, 0xfff3229c, 0xfff31000,
+    0xfff30056, 0xfff2f045, 0xfff2e000, 0xfff2d904, 0xfff2c004, 0xfff2b000, 0xfff2a062, 0xfff29044,
+    0xfff28000, 0xfff27000, 0xfff26003, 0xfff250f8, 0xfff24061, 0xfff23000, 0xfff22000, 0xfff22077,
+    0xfff20002, 0xfff1f0d8, 0xfff1e000, 0xfff1d004, 0xfff1c0f9, 0xfff1c076, 0xfff1a000, 0xfff19017,
+    0xfff18000, 0xfff17003, 0xfff16606, 0xfff15000, 0xfff14000, 0xfff13904, 0xfff1319e, 0xfff11000,
+    0xfff10605, 0xfff0f000, 0xfff0e2c4, 0xfff0d037, 0xfff0d1ea, 0xfff0b000, 0xfff0a604, 0xfff09000,
+    0xfff08000, 0xfff07606, 0xfff071e9, 0xfff05000, 0xfff04904, 0xfff0428a, 0xfff02000, 0xfff01605,
+    0xfff011e8, 0xffeff000, 0xffefe057, 0xffefe289, 0xffefc000, 0xffefb0ac, 0xffefa000, 0xffef9000,
+    0xffef8606, 0xffef8288, 0xffef6000, 0xffef5000, 0xffef528a, 0xffef30f9, 0xffef2062, 0xffef1000,
+    0xffef0000, 0xffeef000, 0xffeef289, 0xffeed2c8, 0xffeec000, 0xffeeb000, 0xffeea000, 0xffeea077,
+    0xffee8000, 0xffee878e, 0xffee6000, 0xffee628a, 0xffee42c9, 0xffee3000, 0xffee2000, 0xffee1378,
+    0xffee0000, 0xffedf000, 0xffede606, 0xffedd000, 0xffedc000, 0xffedb904, 0xffeda000, 0xffed9000,
+    0xffed8605, 0xffed7000, 0xffed6000, 0xffed68b4, 0xffed4000, 0xffed3000, 0xffed2378, 0xffed1000,
+    0xffed0000, 0xffecf606, 0xffece0f8, 0xffecd000, 0xffecc000, 0xffecb000, 0xffeca000, 0xffeca8b2,
+    0xffec82c5, 0xffec7000, 0xffec6228, 0xffec50f9, 0xffec4000, 0xffec3000, 0xffec2009, 0xffec1000,
+    0xffec0227, 0xffebf2c6, 0xffebe000, 0xffebd000, 0xffebc904, 0xffebb006, 0xffeba000, 0xffebadf8,
+    0xffeb8000, 0xffeb7000, 0xffeb62c7, 0xffeb5005, 0xffeb4000, 0xffeb3009, 0xffeb2000, 0xffeb1000,
+    0xffeb1f87, 0xffeaf045, 0xffeae000, 0xffead904, 0xffeac006, 0xffeab000, 0xffeabf86, 0xffea9044,
+    0xffea8000, 0xffea7110, 0xffea6606, 0xffea5000, 0xffea4009, 0xffea3000, 0xffea2000, 0xffea110f,
+    0xffea0045, 0xffe9f000, 0xffe9e000, 0xffe9d004, 0xffe9c0f9, 0xffe9b10e, 0xffe9a000, 0xffe99000,
+    0xffe98000, 0xffe97003, 0xffe962c6, 0xffe95000, 0xffe94000, 0xffe93000, 0xffe93077, 0xffe91000,
+    0xffe91fca, 0xffe8f000, 0xffe8e004, 0xffe8d2c7, 0xffe8c000, 0xffe8b000, 0xffe8a009, 0xffe89000,
+    0xffe88000, 0xffe87606, 0xffe86000, 0xffe85000, 0xffe84904, 0xffe84fec, 0xffe82000, 0xffe81605,
+    0xffe80000, 0xffe7f000, 0xffe7e00d, 0xffe7efeb, 0xffe7c000, 0xffe7b009, 0xffe7a000, 0xffe79000,
+    0xffe78606, 0xffe78fea, 0xffe76000, 0xffe75000, 0xffe75fec, 0xffe73000, 0xffe7200b, 0xffe71000,
+    0xffe70000, 0xffe6f110, 0xffe6ffeb, 0xffe6d000, 0xffe6c012, 0xffe6b000, 0xffe6a000, 0xffe6910f,
+    0xffe68000, 0xffe67000, 0xffe67f25, 0xffe66fec, 0xffe642c7, 0xffe630d3, 0xffe62000, 0xffe61000,
+    0xffe60000, 0xffe5f000, 0xffe600da, 0xffe5d012, 0xffe5c000, 0xffe5b000, 0xffe5a031, 0xffe59000,
+    0xffe5a0d9, 0xffe58f25, 0xffe56000, 0xffe5658a, 0xffe5612d, 0xffe53000, 0xffe52009, 0xffe51052,
+    0xffe50000, 0xffe4f606, 0xffe4e0a7, 0xffe4d000, 0xffe4c000, 0xffe4b051, 0xffe4a000, 0xffe4a588,
+    0xffe49f25, 0xffe47000, 0xffe4758a, 0xffe450f9, 0xffe44000, 0xffe43000, 0xffe4267b, 0xffe41000,
+    0xffe41589, 0xffe3f2fb, 0xffe3e000, 0xffe3d000, 0xffe3c67a, 0xffe3b000, 0xffe3a0d3, 0xffe3900e,
+    0xffe38000, 0xffe37110, 0xffe36e47, 0xffe35000, 0xffe34012, 0xffe3300d, 0xffe32000, 0xffe33269,
+    0xffe3010e, 0xffe2f000, 0xffe2ff25, 0xffe2d904, 0xffe2c017, 0xffe2d306, 0xffe2a00e, 0xffe29000,
+    0xffe28032, 0xffe27109, 0xffe26016, 0xffe273db, 0xffe2400d, 0xffe23000, 0xffe24445, 0xffe21108,
+    0xffe20015, 0xffe20f25, 0xffe1e000, 0xffe1d017, 0xffe1e12d, 0xffe1b107, 0xffe1a000, 0xffe19052,
+    0xffe18109, 0xffe17016, 0xffe160a7, 0xffe15000, 0xffe14000, 0xffe1554d, 0xffe12108, 0xffe11000,
+    0xffe10000, 0xffe0f000, 0xffe105ad, 0xffe0d2fc, 0xffe0c000, 0xffe0b000, 0xffe0a67b, 0xffe09000,
+    0xffe082c3, 0xffe0710e, 0xffe06000, 0xffe05000, 0xffe0467a, 0xffe03000, 0xffe0469e, 0xffe0100e,
+    0xffe00000, 0xffdff2c4, 0xffdfe10f, 0xffdfd000, 0xffdfc373, 0xffdfb00d, 0xffdfa000, 0xffdfb93c,
+    0xffdf8606, 0xffdf7000, 0xffdf7f25, 0xffdf5000, 0xffdf5fec, 0xffdf569e, 0xffdf200e, 0xffdf1000,
+    0xffdf2a32, 0xffdef109, 0xffdeffeb, 0xffded373, 0xffdec000, 0xffdeb000, 0xffdeca31, 0xffdebb71,
+    0xffde8000, 0xffde7000, 0xffde6000, 0xffde6fec, 0xffde6a30, 0xffde30d3, 0xffde2000, 0xffde1223,
+    0xffde2b72, 0xffddf000, 0xffdde000, 0xffddd012, 0xffddc000, 0xffddb222, 0xffddce4d, 0xffdd9000,
+    0xffdd8000, 0xffdd8f25, 0xffdd6001, 0xffdd5096, 0xffdd6306, 0xffdd3000, 0xffdd267b, 0xffdd1032,
+    0xffdd0000, 0xffdcf095, 0xffdd0ed4, 0xffdcd000, 0xffdcc000, 0xffdcd445, 0xffdca040, 0xffdc9094,
+    0xffdc9f25, 0xffdc7001, 0xffdc6096, 0xffdc712d, 0xffdc403f, 0xffdc3000, 0xffdc2052, 0xffdc4257,
+    0xffdc0095, 0xffdbf0a7, 0xffdbe000, 0xffdbd000, 0xffdbf2d4, 0xffdbb040, 0xffdba000, 0xffdb9000,
+    0xffdb804b, 0xffdba3b3, 0xffdb7e07, 0xffdb5000, 0xffdb4000, 0xffdb367b, 0xffdb204a, 0xffdb3e4d,
+    0xffdb3522, 0xffdaf000, 0xffdae000, 0xffdad67a, 0xffdac000, 0xffdad306, 0xffdad521, 0xffda904b,
+    0xffdaae4e, 0xffda7001, 0xffda6000, 0xffda7ed4, 0xffda7520, 0xffda3000, 0xffda2410, 0xffda1000,
+    0xffda0000, 0xffda0f25, 0xffd9e002, 0xffd9d096, 0xffd9c40f, 0xffd9e851, 0xffd9a000, 0xffd9b446,
+    0xffd98001, 0xffd97095, 0xffd9640e, 0xffd95000, 0xffd94000, 0xffd93410, 0xffd92000, 0xffd91000,
+    0xffd90000, 0xffd8f002, 0xffd8e096, 0xffd8d40f, 0xffd8c000, 0xffd8b000, 0xffd8d2d5, 0xffd89001,
+    0xffd88000, 0xffd87000, 0xffd86000, 0xffd85000, 0xffd84410, 0xffd83000, 0xffd82000, 0xffd81000,
+    0xffd80002, 0xffd7f2c4, 0xffd814b1, 0xffd7d000, 0xffd7c000, 0xffd7b67b, 0xffd7a000, 0xffd7b93c,
+    0xffd7b4b0, 0xffd77000, 0xffd76000, 0xffd75000, 0xffd74000, 0xffd7569e, 0xffd754af, 0xffd71000,
+    0xffd7293d, 0xffd724b1, 0xffd6e000, 0xffd6d373, 0xffd6c000, 0xffd6b000, 0xffd6a410, 0xffd6c4b0,
+    0xffd68000, 0xffd67000, 0xffd66000, 0xffd66fec, 0xffd6440f, 0xffd63000, 0xffd62000, 0xffd63a32,
+    0xffd634b1, 0xffd5f000, 0xffd5e000, 0xffd5d000, 0xffd5c000, 0xffd5b410, 0xffd5a2c1, 0xffd59000,
+    0xffd58000, 0xffd57000, 0xffd56000, 0xffd55000, 0xffd57977, 0xffd53000, 0xffd52223, 0xffd512c2,
+    0xffd50000, 0xffd4f000, 0xffd4e004, 0xffd4d000, 0xffd4c000, 0xffd4ea52, 0xffd4a000, 0xffd49000,
+    0xffd49f25, 0xffd47001, 0xffd494b1, 0xffd48977, 0xffd44000, 0xffd43000, 0xffd45de9, 0xffd44ea2,
+    0xffd434b0, 0xffd3f004, 0xffd3e000, 0xffd3d000, 0xffd3fde8, 0xffd3b040, 0xffd3a000, 0xffd39000,
+    0xffd3bea3, 0xffd3a4b1, 0xffd39de7, 0xffd35000, 0xffd34000, 0xffd3310b, 0xffd32410, 0xffd31000,
+    0xffd30000, 0xffd2f000, 0xffd2e000, 0xffd2d10a, 0xffd2c000, 0xffd2b000, 0xffd2a000, 0xffd2904b,
+    0xffd282c2, 0xffd27000, 0xffd26000, 0xffd25000, 0xffd2467b, 0xffd23000, 0xffd25a52, 0xffd21000,
+    0xffd20000, 0xffd1f000, 0xffd1e000, 0xffd1d000, 0xffd1f977, 0xffd1b000, 0xffd1a000, 0xffd1ca53,
+    0xffd18000, 0xffd17000, 0xffd16004, 0xffd15000, 0xffd14000, 0xffd13410, 0xffd12000, 0xffd11000,
+    0xffd10000, 0xffd0f002, 0xffd114b1, 0xffd0d40f, 0xffd0c000, 0xffd0b000, 0xffd0dde9, 0xffd09001,
+    0xffd08000, 0xffd07000, 0xffd06000, 0xffd05000, 0xffd07f5a, 0xffd03000, 0xffd02000, 0xffd01000,
+    0xffd00002, 0xffcff000, 0xffcfe267, 0xffcfd000, 0xffcfc000, 0xffcfb10b, 0xffcfa000, 0xffcf9000,
+    0xffcf8019, 0xffcf7000, 0xffcf6000, 0xffcf5268, 0xffcf4000, 0xffcf3000, 0xffcf3f20, 0xffcf1000,
+    0xffcf3f48, 0xffcf2fda, 0xffcee000, 0xffced000, 0xffcec269, 0xffceb000, 0xffcedf47, 0xffce9019,
+    0xffce8000, 0xffce7000, 0xffcea0cd, 0xffce5000, 0xffce7f46, 0xffce4f20, 0xffce2000, 0xffce4f48,
+    0xffce40cc, 0xffcdf000, 0xffcde000, 0xffcdd3cc, 0xffcdc000, 0xffcdb410, 0xffcda019, 0xffcd9000,
+    0xffcd8000, 0xffcd73cb, 0xffcd6000, 0xffcd5000, 0xffcd4000, 0xffcd3000, 0xffcd628c, 0xffcd31c5,
+    0xffcd0000, 0xffccf000, 0xffcce676, 0xffccd000, 0xffccc268, 0xffccb109, 0xffcca000, 0xffcc9000,
+    0xffcc8675, 0xffcc7000, 0xffcca217, 0xffcc5009, 0xffcc4000, 0xffcc3269, 0xffcc210a, 0xffcc1000,
+    0xffcc0019, 0xffcbf008, 0xffcbe000, 0xffcc12a0, 0xffcc031e, 0xffcbb000, 0xffcbbf20, 0xffcb9000,
+    0xffcb8012, 0xffcbb217, 0xffcb6009, 0xffcb5000, 0xffcb8367, 0xffcb3104, 0xffcb2011, 0xffcb1019,
+    0xffcb0000, 0xffcaf000, 0xffcb2366, 0xffcad103, 0xffcac000, 0xffcab000, 0xffcaa000, 0xffca9012,
+    0xffcac365, 0xffca7000, 0xffca6000, 0xffca53cc, 0xffca4104, 0xffca3000, 0xffca2000, 0xffca1000,
+    0xffca0000, 0xffc9f3cb, 0xffc9e000, 0xffc9d000, 0xffc9c000, 0xffc9b000, 0xffc9a269, 0xffc9910a,
+    0xffc98000, 0xffc97000, 0xffc96676, 0xffc95000, 0xffc9851f, 0xffc9769c, 0xffc92000, 0xffc91000,
+    0xffc90000, 0xffc8f000, 0xffc9251e, 0xffc8d009, 0xffc8c000, 0xffc8b9b1, 0xffc8e69d, 0xffc89000,
+    0xffc88019, 0xffc87000, 0xffc86000, 0xffc859b0, 0xffc84410, 0xffc83000, 0xffc8216b, 0xffc81000,
+    0xffc80002, 0xffc7f9af, 0xffc7e000, 0xffc7d000, 0xffc7c9b1, 0xffc7db6d, 0xffc7a000, 0xffc7916c,
+    0xffc78000, 0xffc77000, 0xffc78c4a, 0xffc75268, 0xffc74000, 0xffc730d8, 0xffc72000, 0xffc71000,
+    0xffc7016d, 0xffc736ca, 0xffc6e000, 0xffc6fd7c, 0xffc6c269, 0xffc6b000, 0xffc6a036, 0xffc69019,
+    0xffc68000, 0xffc67304, 0xffc6a704, 0xffc65000, 0xffc6567e, 0xffc64f20, 0xffc6208e, 0xffc62971,
+    0xffc646ca, 0xffc5f000, 0xffc5e0ac, 0xffc619a9, 0xffc5c08d, 0xffc5c970, 0xffc5a019, 0xffc59000,
+    0xffc58304, 0xffc5b9a8, 0xffc5608c, 0xffc55062, 0xffc54000, 0xffc5308e, 0xffc5681f, 0xffc559a7,
+    0xffc5016c, 0xffc4f061, 0xffc4e3cc, 0xffc4d08d, 0xffc4c061, 0xffc4b000, 0xffc4a0d8, 0xffc49000,
+    0xffc483cb, 0xffc4716d, 0xffc46060, 0xffc45000, 0xffc4734f, 0xffc43269, 0xffc423c2, 0xffc45b63,
+    0xffc40000, 0xffc3f676, 0xffc3e304, 0xffc41704, 0xffc3c3c1, 0xffc3b11e, 0xffc3a000, 0xffc39000,
+    0xffc38037, 0xffc3b6ca, 0xffc363c0, 0xffc39c2e, 0xffc38705, 0xffc333c2, 0xffc34dd2, 0xffc31019,
+    0xffc30000, 0xffc2f304, 0xffc2e40b, 0xffc2d3c1, 0xffc2d67e, 0xffc2b000, 0xffc2a04e, 0xffc2a971,
+    0xffc2840a, 0xffc27000, 0xffc260ac, 0xffc299a9, 0xffc243c2, 0xffc27c91, 0xffc22000, 0xffc21000,
+    0xffc20000, 0xffc1f40b, 0xffc1e16d, 0xffc1d062, 0xffc1c000, 0xffc1b04e, 0xffc1a062, 0xffc19000,
+    0xffc182c8, 0xffc17000, 0xffc163cc, 0xffc15000, 0xffc14061, 0xffc13000, 0xffc139ff, 0xffc11000,
+    0xffc10000, 0xffc0f2c9, 0xffc0e000, 0xffc0d000, 0xffc0c378, 0xffc0ed5f, 0xffc0a3c2, 0xffc098ec,
+    0xffc08000, 0xffc07000, 0xffc06304, 0xffc08d5e, 0xffc043c1, 0xffc049ff, 0xffc02000, 0xffc01000,
+    0xffc04e7a, 0xffc02d5d, 0xffbfe000, 0xffbfd378, 0xffbffd5f, 0xffbfb3c2, 0xffbfee79, 0xffbf916c,
+    0xffbf8000, 0xffbf7000, 0xffbf640b, 0xffbf5000, 0xffbf8e78, 0xffbf30d8, 0xffbf2000, 0xffbf1228,
+    0xffbf016d, 0xffbef000, 0xffbee000, 0xffbf0d5f, 0xffbec269, 0xffbeb227, 0xffbeef32, 0xffbe9000,
+    0xffbe8000, 0xffbe7304, 0xffbe6043, 0xffbe5000, 0xffbe411e, 0xffbe3000, 0xffbe2062, 0xffbe1037,
+    0xffbe0042, 0xffbdf000, 0xffbe2f4b, 0xffbdd005, 0xffbdc000, 0xffbdddd2, 0xffbdc04e, 0xffbd9000,
+    0xffbd8304, 0xffbda14c, 0xffbd6000, 0xffbd667e, 0xffbd4044, 0xffbd308e, 0xffbd6a0d, 0xffbd43bb,
+    0xffbd0000, 0xffbcf0ac, 0xffbd19bf, 0xffbcd08d, 0xffbd1018, 0xffbcb045, 0xffbca000, 0xffbc9000,
+    0xffbc8004, 0xffbc716d, 0xffbc6062, 0xffbc5114, 0xffbc408e, 0xffbc3062, 0xffbc204f, 0xffbc5f32,
+    0xffbc0000, 0xffbc2bdb, 0xffbbe000, 0xffbbd061, 0xffbbc115, 0xffbbb11e, 0xffbba000, 0xffbb9004,
+    0xffbbcf33, 0xffbb7000, 0xffbb6023, 0xffbb9f4b, 0xffbb40c5, 0xffbb3023, 0xffbb2606, 0xffbb1000,
+    0xffbb06a4, 0xffbaf304, 0xffbb20ba, 0xffbad044, 0xffbac605, 0xffbab000, 0xffbaa099, 0xffbabdd3,
+    0xffbac0b9, 0xffba7043, 0xffbaaf4b, 0xffba50c5, 0xffba4023, 0xffba3606, 0xffba25d5, 0xffba104f,
+    0xffba0000, 0xffba33a0, 0xffb9e064, 0xffb9e67e, 0xffb9c114, 0xffb9b04e, 0xffb9f019, 0xffb995d6,
+    0xffb98063, 0xffb97000, 0xffb960c5, 0xffb95000, 0xffb99018, 0xffb93115, 0xffb92062, 0xffb91000,
+    0xffb92569, 0xffb8f2c9, 0xffb8e000, 0xffb920a9, 0xffb8c000, 0xffb8b062, 0xffb8a023, 0xffb898ec,
+    0xffb88000, 0xffb89233, 0xffb86000, 0xffb85000, 0xffb8469c, 0xffb849ff, 0xffb82000, 0xffb83a84,
+    0xffb808ed, 0xffb7f000, 0xffb7ff1b, 0xffb7d378, 0xffb7c0c5, 0xffb7b023, 0xffb7a606, 0xffb79000,
+    0xffb7adfe, 0xffb77000, 0xffb760c4, 0xffb77172, 0xffb759ff, 0xffb73000, 0xffb75547, 0xffb75e7a,
+    0xffb7016d, 0xffb6facf, 0xffb6e000, 0xffb6d0c5, 0xffb6c0b7, 0xffb6fe79, 0xffb6d49a, 0xffb6ab17,
+    0xffb68000, 0xffb6707e, 0xffb66b69, 0xffb65000, 0xffb68cb2, 0xffb630b8, 0xffb62228, 0xffb612e8,
+    0xffb60e0b, 0xffb5f000, 0xffb62c96, 0xffb5ff67, 0xffb5c0d2, 0xffb62262, 0xffb5a671, 0xffb590c3,
+    0xffb5d94e, 0xffb57006, 0xffb56193, 0xffb5d1ea, 0xffb5502b, 0xffb530d3, 0xffb52023, 0xffb52130,
+    0xffb5116a, 0xffb5526c, 0xffb4e086, 0xffb50801, 0xffb4c099, 0xffb4de9e, 0xffb4abfe, 0xffb49bb9,
+    0xffb48169, 0xffb47200, 0xffb4ff58, 0xffb47c2d, 0xffb444c8, 0xffb44d22, 0xffb474c5, 0xffb4307e,
+    0xffb42b53, 0xffb416d8, 0xffb3f1ad, 0xffb4024f, 0xffb3f7f3, 0xffb3b4a2, 0xffb3a1ab, 0xffb39264,
+    0xffb382e8, 0xffb3c770, 0xffb36180, 0xffb363c4, 0xffb3522f, 0xffb3304e, 0xffb3201c, 0xffb317f5,
+    0xffb322f4, 0xffb309ec, 0xffb339a7, 0xffb3140e, 0xffb31712, 0xffb2b0b8, 0xffb2ecfc, 0xffb2c81f,
+    0xffb2836b, 0xffb27bde, 0xffb2bc71, 0xffb25007, 0xffb25005, 0xffb2e3a9, 0xffb243fc, 0xffb225d9,
+    0xffb29318, 0xffb21ca8, 0xffb2370b, 0xffb283c2, 0xffb1de7c, 0xffb1b0bd, 0xffb1de98, 0xffb20727,
+    0xffb23348, 0xffb1a960, 0xffb16086, 0xffb1841e, 0xffb14893, 0xffb176d9, 0xffb12118, 0xffb112f5,
+    0xffb105d7, 0xffb13214, 0xffb0e97d, 0xffb12cf1, 0xffb0dabd, 0xffb0e163, 0xffb0a299, 0xffb0f4b3,
+    0xffb08390, 0xffb0ce14, 0xffb07d25, 0xffb0563b, 0xffb09cf2, 0xffb034a2, 0xffb02825, 0xffb07a79,
+    0xffb049e4, 0xffaff119, 0xffb04221, 0xffaffce2, 0xffafdc33, 0xffafd031, 0xffb0543d, 0xffafc304,
+    0xffaf8db1, 0xffafa8c8, 0xffafadd3, 0xffaf55d3, 0xffafef8f, 0xffaf8130, 0xffaf2b2a, 0xffaf102a,
+    0xffaf1679, 0xffaf2965, 0xffaf7dbc, 0xffaef91c, 0xffaf11ae, 0xffaf64c3, 0xffaef96f, 0xffaecf12,
+    0xffae8459, 0xffae9d12, 0xffae8bf7, 0xffae5516, 0xffae42e2, 0xffae570c, 0xffae3adf, 0xffaebfb1,
+    0xffae00f9, 0xffae04a9, 0xffadf021, 0xffae29ca, 0xffadd9fe, 0xffadc212, 0xffade4b8, 0xffad91f9,
+    0xffadb255, 0xffad8b59, 0xffad6119, 0xffad9c7b, 0xffad420b, 0xffad5f86, 0xffad5ca1, 0xffad361a,
+    0xffad18d3, 0xffacf00d, 0xffad1e19, 0xffad3ab4, 0xffad1d6d, 0xffacf1a2, 0xffacabfe, 0xffaccedc,
+    0xffacf240, 0xffac7ed4, 0xfface515, 0xffac6e7c, 0xffac6dce, 0xffac3109, 0xffaca7ed, 0xffac9845,
+    0xffac6ed0, 0xffac1168, 0xffac141e, 0xffac1c3f, 0xffac0a91, 0xffabb05f, 0xffabb45c, 0xffaba0ed,
+    0xffabb7a9, 0xffab97ee, 0xffab7c51, 0xffabe65e, 0xffab7e89, 0xffab3299, 0xffab27f3, 0xffab2965,
+    0xffab4680, 0xffaba055, 0xffab9487, 0xffaadf3e, 0xffaae025, 0xffaac48b, 0xffaaf3ab, 0xffaac26c,
+    0xffaab303, 0xffaa7178, 0xffaa6f31, 0xffaa6079, 0xffaa5e84, 0xffaa3020, 0xffaa45b8, 0xffaa67d2,
+    0xffaa3f73, 0xffa9f780, 0xffa9f9fa, 0xffaa42e8, 0xffa9c706, 0xffa9f851, 0xffa9aedd, 0xffa9977f,
+    0xffa9a49f, 0xffaa0319, 0xffa99da6, 0xffa99a9b, 0xffa94054, 0xffa95264, 0xffa93746, 0xffa93eb0,
+    0xffa90ffc, 0xffa99a2a, 0xffa8e053, 0xffa8dbb0, 0xffa973ee, 0xffa8dac0, 0xffa8e6c3, 0xffa8fa28,
+    0xffa8cc5d, 0xffa89ba0, 0xffa91411, 0xffa882af, 0xffa85f96, 0xffa8702e, 0xffa82ef4, 0xffa81567,
+    0xffa86d8c, 0xffa808d6, 0xffa7e3fa, 0xffa88135, 0xffa7c388, 0xffa7b580, 0xffa7d9c4, 0xffa79fad,
+    0xffa7f9aa, 0xffa77085, 0xffa78033, 0xffa753fb, 0xffa7724b, 0xffa73ab7, 0xffa74cb0, 0xffa765ff,
+    0xffa72a4a, 0xffa732b1, 0xffa724e6, 0xffa71dd4, 0xffa6cfb7, 0xffa725c9, 0xffa6d304, 0xffa6b734,
+    0xffa685d8, 0xffa6a0f9, 0xffa6a0f3, 0xffa65516, 0xffa64000, 0xffa64c36, 0xffa67963, 0xffa66d0e,
+    0xffa60935, 0xffa5f45a, 0xffa60d13, 0xffa5d48f, 0xffa5c517, 0xffa5b472, 0xffa5edc0, 0xffa59459,
+    0xffa5e4ac, 0xffa59204, 0xffa56000, 0xffa552e2, 0xffa594e9, 0xffa53388, 0xffa58e5f, 0xffa5606d,
+    0xffa501fa, 0xffa54db7, 0xffa4e25f, 0xffa4f033, 0xffa573ee, 0xffa4d7e1, 0xffa4a0d4, 0xffa490d3,
+    0xffa4e0ff, 0xffa470c5, 0xffa514b6, 0xffa489c8, 0xffa4bf7f, 0xffa4ace4, 0xffa46dd0, 0xffa425c3,
+    0xffa4463c, 0xffa4096d, 0xffa4637b, 0xffa484b9, 0xffa3d80f, 0xffa3fdb7, 0xffa3bcb7, 0xffa3be34,
+    0xffa433b9, 0xffa37b93, 0xffa370e8, 0xffa40446, 0xffa3a907, 0xffa36694, 0xffa34313, 0xffa35e92,
+    0xffa31e8a, 0xffa3a497, 0xffa31358, 0xffa314c3, 0xffa30dcb, 0xffa313c9, 0xffa2c676, 0xffa2b3a4,
+    0xffa2af9e, 0xffa27db5, 0xffa31197, 0xffa28a4a, 0xffa241b2, 0xffa27b33, 0xffa285cc, 0xffa26d45,
+    0xffa24bc9, 0xffa2566c, 0xffa22a2f, 0xffa20939, 0xffa1d8f7, 0xffa1b8e8, 0xffa20f70, 0xffa2037f,
+    0xffa1e97d, 0xffa1be21, 0xffa17c99, 0xffa16a5f, 0xffa1cc0a, 0xffa133c6, 0xffa1267f, 0xffa115d8,
+    0xffa13a29, 0xffa16bb0, 0xffa0e746, 0xffa10905, 0xffa15e94, 0xffa134fc, 0xffa0f349, 0xffa0941b,
+    0xffa09cb8, 0xffa0b89f, 0xffa1146e, 0xffa05004, 0xffa04f53, 0xffa06c6b, 0xffa07757, 0xffa0318e,
+    0xffa080be, 0xff9ff000, 0xffa01119, 0xffa084b6, 0xff9fc2e3, 0xff9fc5af, 0xff9fa3f5, 0xff9ff694,
+    0xff9f92ea, 0xff9f852b, 0xff9fd25d, 0xff9f8675, 0xff9f8dcb, 0xff9f4e72, 0xff9f7c8a, 0xff9f4270,
+    0xff9f81e5, 0xff9f43ef, 0xff9f0a79, 0xff9ee76f, 0xff9ef278, 0xff9ee26f, 0xff9ea004, 0xff9ed5ea,
+    0xff9e8cfc, 0xff9f20f9, 0xff9e732c, 0xff9e6030, 0xff9e9d9f, 0xff9e7f9e, 0xff9e2ecf, 0xff9e645a,
+    0xff9e5fd6, 0xff9e2679, 0xff9e5e79, 0xff9dd8ce, 0xff9dc68d, 0xff9e0ecf, 0xff9dc948, 0xff9dcc94,
+    0xff9e34f9, 0xff9d8318, 0xff9d605a, 0xff9d633a, 0xff9da2f2, 0xff9d53ea, 0xff9d55f8, 0xff9d6821,
+    0xff9d04af, 0xff9da102, 0xff9ce294, 0xff9cd7ee, 0xff9cc09d, 0xff9d0be7, 0xff9d0cfd, 0xff9cba42,
+    0xff9cb3dc, 0xff9c749d, 0xff9c609c, 0xff9ce987, 0xff9c8edd, 0xff9c512e, 0xff9c59ab, 0xff9c85bc,
+    0xff9c0cbc, 0xff9c2ca9, 0xff9c9516, 0xff9c3e0f, 0xff9c5004, 0xff9bec4c, 0xff9bccbe, 0xff9b93fd,
+    0xff9b8a6d, 0xff9b9b37, 0xff9b71e0, 0xff9b9039, 0xff9b8d9d, 0xff9b5a2f, 0xff9bd025, 0xff9b875d,
+    0xff9b19dc, 0xff9b61bb, 0xff9b4527, 0xff9af1ac, 0xff9ac02b, 0xff9ad9fa, 0xff9aa7f3, 0xff9ac6f4,
+    0xff9a8624, 0xff9a8c2c, 0xff9ac149, 0xff9abc03, 0xff9a5827, 0xff9a433b, 0xff9a4e82, 0xff9a73e2,
+    0xff9a4a20, 0xff9a4e23, 0xff99ea0b, 0xff99f101, 0xff99cb54, 0xff9a3d8f, 0xff99c150, 0xff99fb0d,
+    0xff99c0de, 0xff998da6, 0xff9973ac, 0xff997c73, 0xff997047, 0xff9973c4, 0xff992080, 0xff999e8e,
+    0xff997461, 0xff995988, 0xff98e2fa, 0xff991dbb, 0xff990ab5, 0xff98d150, 0xff9938cc, 0xff98d58b,
+    0xff991253, 0xff98a64d, 0xff98837d, 0xff98940d, 0xff98a433, 0xff98507f, 0xff98bfca, 0xff986362,
+    0xff9862a7, 0xff97f000, 0xff97fa74, 0xff984ed5, 0xff98264e, 0xff97f5af, 0xff97f551, 0xff979783,
+    0xff978376, 0xff977b7c, 0xff97646d, 0xff980389, 0xff97973b, 0xff97afb4, 0xff97d4c3, 0xff973636,
+    0xff9702dd, 0xff97104f, 0xff9710f4, 0xff973d19, 0xff971095, 0xff96d635, 0xff96dce8, 0xff96dbab,
+    0xff96d1a6, 0xff96e7b9, 0xff96d054, 0xff96ab40, 0xff969209, 0xff96960e, 0xff96468f, 0xff96c53a,
+    0xff96032f, 0xff965c62, 0xff95fffa, 0xff961001, 0xff95f8c5, 0xff962535, 0xff95e937, 0xff9643d7,
+    0xff95a79a, 0xff95de6e, 0xff9581ac, 0xff9593c3, 0xff957234, 0xff95e4d5, 0xff9523fd, 0xff952c16,
+    0xff9548d6, 0xff94f104, 0xff954c03, 0xff95179d, 0xff95450f, 0xff94e72d, 0xff9554e1, 0xff94b7ea,
+    0xff94eb36, 0xff94caa5, 0xff947e3c, 0xff9481ba, 0xff9488ac, 0xff9462a4, 0xff943d54, 0xff94c19c,
+    0xff943ad1, 0xff943b96, 0xff94388a, 0xff93ec65, 0xff94738b, 0xff940247, 0xff93c0a6, 0xff94447c,
+    0xff93c3a1, 0xff938c64, 0xff937b71, 0xff93dd62, 0xff93a662, 0xff93e603, 0xff937499, 0xff9330a7,
+    0xff930d42, 0xff93a062, 0xff933fab, 0xff9315e4, 0xff92dd22, 0xff92ec0f, 0xff92dedf, 0xff92bd38,
+    0xff928321, 0xff932506, 0xff930aaa, 0xff92bd73, 0xff9290e7, 0xff928c96, 0xff929a53, 0xff925732,
+    0xff920c96, 0xff923e69, 0xff91f647, 0xff923dfc, 0xff91c3a8, 0xff920a31, 0xff91a585, 0xff91c5e2,
+    0xff9186a2, 0xff917269, 0xff91ae6a, 0xff917d8f, 0xff91865f, 0xff91672d, 0xff9143e3, 0xff916a34,
+    0xff917e06, 0xff914f53, 0xff91223b, 0xff90d000, 0xff90d52f, 0xff90dabd, 0xff910a9d, 0xff90d4fc,
+    0xff913661, 0xff90cb9e, 0xff906dd1, 0xff90637f, 0xff909ef9, 0xff90436f, 0xff902e9d, 0xff90c612,
+    0xff9038fb, 0xff8ff000, 0xff9023a4, 0xff8fde96, 0xff8fe150, 0xff8fb3fd, 0xff8fe704, 0xff904694,
+    0xff8fa090, 0xff8fb842, 0xff8f6000, 0xff8f5da6, 0xff8f5d22, 0xff8f4ce8, 0xff8f8ef1, 0xff8f3d62,
+    0xff8f0000, 0xff8f0dbf, 0xff8ee062, 0xff8ed46e, 0xff8f740d, 0xff8f08f1, 0xff8f2197, 0xff8e925a,
+    0xff8e8061, 0xff8ebe84, 0xff8edc98, 0xff8e5063, 0xff8e40ce, 0xff8ecf65, 0xff8e2585, 0xff8e12dd,
+    0xff8e11bb, 0xff8e41a7, 0xff8e9630, 0xff8e7f74, 0xff8dc000, 0xff8db0cf, 0xff8dd16f, 0xff8de3fd,
+    0xff8e3543, 0xff8d700c, 0xff8d61de, 0xff8da433, 0xff8ddffc, 0xff8d4d93, 0xff8d2b8e, 0xff8d661e,
+    0xff8db52f, 0xff8da52e, 0xff8d7fed, 0xff8cd416, 0xff8d03cb, 0xff8cefcd, 0xff8d5602, 0xff8c9b8f,
+    0xff8d06dc, 0xff8cac66, 0xff8c7cb2, 0xff8cb06f, 0xff8c5914, 0xff8c3000, 0xff8c64ba, 0xff8cc511,
+    0xff8c0000, 0xff8c8688, 0xff8c325e, 0xff8c1ed9, 0xff8c15cf, 0xff8bc526, 0xff8bf1d7, 0xff8c0e16,
+    0xff8bcdc6, 0xff8b8c64, 0xff8bc84a, 0xff8baef9, 0xff8bf467, 0xff8ba2e0, 0xff8b6bc5, 0xff8b1338,
+    0xff8b006c, 0xff8b4ef8, 0xff8ae000, 0xff8ad224, 0xff8b14ce, 0xff8b6578, 0xff8b1d8b, 0xff8a9027,
+    0xff8a91bb, 0xff8a76a2, 0xff8b136f, 0xff8aef91, 0xff8a8cb1, 0xff8a84cf, 0xff8a74a3, 0xff8a3719,
+    0xff8a0100, 0xff8a61c3, 0xff89e05d, 0xff89d3e2, 0xff8a7627, 0xff89febb, 0xff89a000, 0xff899321,
+    0xff8a3678, 0xff897000, 0xff89fc3f, 0xff8986f6, 0xff899753, 0xff89518a, 0xff893526, 0xff891000,
+    0xff89345c, 0xff8931a4, 0xff88e23a, 0xff890c22, 0xff88f6f7, 0xff88b000, 0xff88a175, 0xff88932c,
+    0xff88bce5, 0xff88a45d, 0xff887255, 0xff887f2d, 0xff884201, 0xff883304, 0xff883bdf, 0xff888ae7,
+    0xff881506, 0xff87f7c2, 0xff87e132, 0xff88026b, 0xff8851e7, 0xff87fcb1, 0xff87dabf, 0xff87cce5,
+    0xff878d07, 0xff879478, 0xff877f45, 0xff87adb5, 0xff878496, 0xff873019, 0xff87927a, 0xff871f62,
+    0xff870a12, 0xff86fae8, 0xff872a96, 0xff86d018, 0xff86c8f3, 0xff86e3e0, 0xff86d77a, 0xff86ff5d,
+    0xff86d440, 0xff86b015, 0xff86c58c, 0xff86bae3, 0xff868464, 0xff866ac9, 0xff862f97, 0xff863e65,
+    0xff867e64, 0xff865542, 0xff865cca, 0xff8610fe, 0xff864cea, 0xff85b738, 0xff860148, 0xff85911f,
+    0xff859711, 0xff8621e1, 0xff857d79, 0xff85c10c, 0xff85f12d, 0xff855829, 0xff852145, 0xff8521bb,
+    0xff854f65, 0xff856cca, 0xff852029, 0xff8519c2, 0xff8545cc, 0xff84d47a, 0xff855171, 0xff84bc14,
+    0xff84eb94, 0xff84956e, 0xff84e5eb, 0xff847479, 0xff84ccba, 0xff84399f, 0xff846a2b, 0xff84c19f,
+    0xff843385, 0xff844039, 0xff8404ee, 0xff83f32e, 0xff83f9ea, 0xff83b83c, 0xff83c942, 0xff8402be,
+    0xff83815e, 0xff83705e, 0xff83bc9d, 0xff8374ef, 0xff838652, 0xff83ad5f, 0xff838929, 0xff831410,
+    0xff834208, 0xff835589, 0xff837ea2, 0xff82d672, 0xff832c31, 0xff831c53, 0xff8353c1, 0xff82c540,
+    0xff828000, 0xff827120, 0xff828bcf, 0xff8275ba, 0xff829077, 0xff82761c, 0xff828e1e, 0xff8256f7,
+    0xff8205d3, 0xff826319, 0xff81f2bf, 0xff823d62, 0xff825edd, 0xff81b4d2, 0xff81f581, 0xff819000,
+    0xff81e4c8, 0xff819180, 0xff81e2fa, 0xff8162c0, 0xff81d4d6, 0xff81547a, 0xff815ead, 0xff8181c5,
+    0xff810123, 0xff8133c6, 0xff80e718, 0xff813764, 0xff8106dd, 0xff812464, 0xff80a122, 0xff80ea7d,
+    0xff80a84f, 0xff809ba1, 0xff811094, 0xff810533, 0xff806261, 0xff80399a, 0xff806278, 0xff808ee2,
+    0xff800f9a, 0xff8016db, 0xff8002a8, 0xff806e97, 0xff7fef83, 0xff7fb122, 0xff800353, 0xff800c3d,
+    0xff7faba1, 0xff8010b2, 0xff7f8f3c, 0xff7f8cfd, 0xff7fb6a3, 0xff7f3420, 0xff7f94f4, 0xff7f66f0,
+    0xff7f5f88, 0xff7ef0c8, 0xff7f1dae, 0xff7f3deb, 0xff7ee624, 0xff7ee083, 0xff7ef41d, 0xff7ed792,
+    0xff7f0122, 0xff7e7a13, 0xff7e605f, 0xff7f05df, 0xff7e4c48, 0xff7e8cf9, 0xff7e41f7, 0xff7e4f9f,
+    0xff7e1147, 0xff7e0add, 0xff7de299, 0xff7df669, 0xff7deb94, 0xff7e254f, 0xff7da99a, 0xff7d97b9,
+    0xff7dae66, 0xff7d888d, 0xff7d7615, 0xff7dac21, 0xff7ddfe5, 0xff7d3f97, 0xff7d5ba4, 0xff7da9a3,
+    0xff7d8288, 0xff7d5c91, 0xff7d8a61, 0xff7d2098, 0xff7d0cbd, 0xff7cdded, 0xff7d2d43, 0xff7c9146,
+    0xff7c9f7c, 0xff7caf23, 0xff7c63f0, 0xff7c88c6, 0xff7c7026, 0xff7c8a27, 0xff7cb319, 0xff7c68ee,
+    0xff7c2f4c, 0xff7c62d0, 0xff7c4c53, 0xff7c52d9, 0xff7bc101, 0xff7c2545, 0xff7c5383, 0xff7ba543,
+    0xff7b9d1d, 0xff7bff0a, 0xff7ba92d, 0xff7bad2e, 0xff7b72b1, 0xff7b3aed, 0xff7b3b37, 0xff7b89c5,
+    0xff7bafd4, 0xff7b00d7, 0xff7b7ce1, 0xff7aebf1, 0xff7acc48, 0xff7adf04, 0xff7b5137, 0xff7b1b17,
+    0xff7b1b84, 0xff7abbb6, 0xff7a6580, 0xff7a8b63, 0xff7a4327, 0xff7abdbf, 0xff7a846d, 0xff7ac0ea,
+    0xff7a8c1d, 0xff79f423, 0xff7a0cc7, 0xff7a523c, 0xff79c06e, 0xff79ef2a, 0xff79e2b1, 0xff79e51f,
+    0xff79a516, 0xff79ca52, 0xff7a1210, 0xff79d7cd, 0xff7953f5, 0xff7965da, 0xff79237e, 0xff797fc3,
+    0xff790516, 0xff7927ba, 0xff7937ec, 0xff79472a, 0xff7929ba, 0xff78f6ca, 0xff78e5e0, 0xff793870,
+    0xff78837b, 0xff787517, 0xff7872c0, 0xff785719, 0xff7858e4, 0xff785d9c, 0xff78d528, 0xff781123,
+    0xff785471, 0xff782cde, 0xff78739b, 0xff784236, 0xff782d91, 0xff77d907, 0xff78289c, 0xff77ae6a,
+    0xff7831f4, 0xff78257f, 0xff781562, 0xff776786, 0xff7741dc, 0xff7778b0, 0xff774882, 0xff77c5a1,
+    0xff770147, 0xff778fe4, 0xff7796aa, 0xff76dcac, 0xff76d48a, 0xff772f90, 0xff76bbb7, 0xff76e967,
+    0xff7735d8, 0xff767e55, 0xff76e154, 0xff76a292, 0xff76f1f7, 0xff768840, 0xff763b0c, 0xff766fd4,
+    0xff767e61, 0xff75f7a7, 0xff75ebb6, 0xff7661aa, 0xff7632e9, 0xff75fbc8, 0xff7649fd, 0xff75c1a3,
+    0xff75a615, 0xff762172, 0xff758b03, 0xff75d519, 0xff7582d8, 0xff7576c0, 0xff758aff, 0xff754ce4,
+    0xff750ba0, 0xff750fc7, 0xff74fc8e, 0xff7550c8, 0xff7571a0, 0xff74b1dc, 0xff74bc28, 0xff74a982,
+    0xff748423, 0xff74b439, 0xff747d99, 0xff74821f, 0xff746e97, 0xff74e5a8, 0xff74748a, 0xff749f2c,
+    0xff743a39, 0xff73fbfe, 0xff7491a4, 0xff73f307, 0xff73e3fb, 0xff73f9ae, 0xff73b624, 0xff74235b,
+    0xff738917, 0xff737016, 0xff73a952, 0xff7384c3, 0xff73f566, 0xff738bea, 0xff73adf1, 0xff73bacc,
+    0xff733f2a, 0xff73124c, 0xff737d32, 0xff72d8f0, 0xff72c80f, 0xff72b701, 0xff72e16e, 0xff72e676,
+    0xff732af7, 0xff729682, 0xff73144f, 0xff728d25, 0xff726feb, 0xff7285e4, 0xff722495, 0xff7264a6,
+    0xff720dd7, 0xff721aea, 0xff721aeb, 0xff72860a, 0xff71cc3a, 0xff726022, 0xff71f2f8, 0xff71c817,
+    0xff71cdce, 0xff719447, 0xff71c1d7, 0xff71fff2, 0xff71df98, 0xff71c887, 0xff71932c, 0xff712196,
+    0xff718209, 0xff71660e, 0xff710151, 0xff71707e, 0xff70d888, 0xff716174, 0xff710626, 0xff709e83,
+    0xff70f2c3, 0xff709b2b, 0xff70a92b, 0xff70e280, 0xff70a365, 0xff704cc0, 0xff70aecf, 0xff709551,
+    0xff704ae4, 0xff701a0c, 0xff70293d, 0xff7027d9, 0xff6fd14c, 0xff6ff256, 0xff6ffe96, 0xff6fa38f,
+    0xff6fed12, 0xff6f7051, 0xff6fd198, 0xff6fd664, 0xff6f5870, 0xff6f7c92, 0xff6f42c3, 0xff6f9e75,
+    0xff6fb52b, 0xff6f80f1, 0xff6f7065, 0xff6f6e39, 0xff6ec467, 0xff6f0c5a, 0xff6f103b, 0xff6e91bd,
+    0xff6eee8c, 0xff6ebc6b, 0xff6efe49, 0xff6e9716, 0xff6e773a, 0xff6ec0f8, 0xff6eb03a, 0xff6e7d1b,
+    0xff6e01d2, 0xff6e8187, 0xff6e8900, 0xff6e5e25, 0xff6e401f, 0xff6dbbb5, 0xff6e208c, 0xff6d9b94,
+    0xff6d869f, 0xff6dac6b, 0xff6dff9f, 0xff6d599b, 0xff6d5919, 0xff6d7282, 0xff6dafb9, 0xff6d5d70,
+    0xff6d40f6, 0xff6d8e68, 0xff6cf6eb, 0xff6d6062, 0xff6d2acf, 0xff6d2f1d, 0xff6d3103, 0xff6cfd0b,
+    0xff6cdaab, 0xff6c7730, 0xff6ccb75, 0xff6cbc06, 0xff6c443a, 0xff6c9cef, 0xff6c6bca, 0xff6ca128,
+    0xff6c8e4a, 0xff6c3af2, 0xff6c5d27, 0xff6c0943, 0xff6c2c35, 0xff6c2fd3, 0xff6bc9f3, 0xff6c0f8c,
+    0xff6c1e98, 0xff6bcbcb, 0xff6b9223, 0xff6bcf22, 0xff6bc0ad, 0xff6bb01b, 0xff6b6b42, 0xff6b1296,
+    0xff6b0004, 0xff6b4a14, 0xff6b4b9b, 0xff6b6017, 0xff6b2d5f, 0xff6b0af9, 0xff6aea3f, 0xff6b21a8,
+    0xff6ace6a, 0xff6b0e1f, 0xff6adc89, 0xff6ae062, 0xff6ad23a, 0xff6a778a, 0xff6a9fb6, 0xff6aae8b,
+    0xff6a5a31, 0xff6a7087, 0xff6a6f24, 0xff6a509c, 0xff6a407d, 0xff6a4d97, 0xff69ade9, 0xff69fdf5,
+    0xff69810f, 0xff699b9d, 0xff69cd20, 0xff69cca7, 0xff6999b7, 0xff69decb, 0xff69a130, 0xff691ca9,
+    0xff696bd1, 0xff691179, 0xff6920f5, 0xff6960df, 0xff68c401, 0xff68c45c, 0xff691fd8, 0xff690fec,
+    0xff68ff66, 0xff690db6, 0xff68ce04, 0xff68abe6, 0xff684740, 0xff689e25, 0xff686e40, 0xff6843e3,
+    0xff684c00, 0xff687177, 0xff6835ba, 0xff67e30a, 0xff67cde2, 0xff67f6a4, 0xff67fb0d, 0xff682040,
+    0xff67cc64, 0xff67df13, 0xff67df5f, 0xff675313, 0xff6781cd, 0xff6736eb, 0xff67b164, 0xff67ae9a,
+    0xff676d8c, 0xff67811b, 0xff677ea1, 0xff66e935, 0xff67511c, 0xff6730d2, 0xff66bdc7, 0xff673647,
+    0xff669871, 0xff66de98, 0xff66f151, 0xff66e1c3, 0xff669bcd, 0xff66b0c2, 0xff668c04, 0xff6650d8,
+    0xff666ea2, 0xff664b56, 0xff664e16, 0xff66519f, 0xff660d46, 0xff65e611, 0xff65fc18, 0xff659083,
+    0xff65b572, 0xff65de0b, 0xff656eeb, 0xff658ac1, 0xff659bb1, 0xff656671, 0xff65bfaa, 0xff6510b0,
+    0xff6591d7, 0xff65819f, 0xff653c44, 0xff655145, 0xff65510e, 0xff653f57, 0xff6530ff, 0xff64dd3f,
+    0xff64cd2e, 0xff6501cf, 0xff64f215, 0xff647632, 0xff644260, 0xff649e61, 0xff646c23, 0xff64a0d6,
+    0xff6400c0, 0xff642f03, 0xff644e90, 0xff63e01c, 0xff645142, 0xff63c3fe, 0xff63d0ca, 0xff63b747,
+    0xff63cc5f, 0xff63f014, 0xff63acff, 0xff63df9a, 0xff634002, 0xff637d2b, 0xff63414c, 0xff637dc5,
+    0xff630109, 0xff639025, 0xff634adb, 0xff632a25, 0xff631bd4, 0xff6309ea, 0xff633147, 0xff6337fd,
+    0xff62c946, 0xff629ee6, 0xff62f1b6, 0xff62ee9d, 0xff627e44, 0xff629e9c, 0xff626a3a, 0xff62a328,
+    0xff62813d, 0xff625eb3, 0xff6261c6, 0xff6236bc, 0xff61d3bf, 0xff624f2b, 0xff6247c1, 0xff61e61e,
+    0xff619e77, 0xff618c6c, 0xff61ce6b, 0xff617d98, 0xff61a5be, 0xff61e3d7, 0xff61238d, 0xff615ce0,
+    0xff6191d5, 0xff61471a, 0xff617e0a, 0xff616101, 0xff60de70, 0xff613a59, 0xff60c416, 0xff612097,
+    0xff60eb45, 0xff60ce71, 0xff610987, 0xff60e1f4, 0xff604e74, 0xff605848, 0xff607c38, 0xff602214,
+    0xff60a872, 0xff6080f5, 0xff600d49, 0xff6055d8, 0xff5fc772, 0xff5ffe86, 0xff5fc8c8, 0xff5fab37,
+    0xff601f17, 0xff601a8e, 0xff5f8081, 0xff5fe321, 0xff5f7c79, 0xff5fd86f, 0xff5fa191, 0xff5f22c6,
+    0xff5f9eb2, 0xff5f996a, 0xff5f8011, 0xff5eef6c, 0xff5f40cb, 0xff5f2b23, 0xff5ec493, 0xff5f3028,
+    0xff5f12a7, 0xff5f01d8, 0xff5e75ec, 0xff5eacf5, 0xff5ebf0c, 0xff5e56c3, 0xff5e7624, 0xff5e6f2b,
+    0xff5e31a1, 0xff5e201d, 0xff5e3291, 0xff5de3a2, 0xff5e537d, 0xff5e0704, 0xff5e1ca4, 0xff5e2f34,
+    0xff5dff69, 0xff5dfec6, 0xff5df3b1, 0xff5de281, 0xff5dd1b9, 0xff5de0fe, 0xff5daef9, 0xff5d4b1e,
+    0xff5d5d35, 0xff5d9a8a, 0xff5ce442, 0xff5d3f24, 0xff5d52f9, 0xff5d595b, 0xff5d4078, 0xff5d3acf,
+    0xff5d1213, 0xff5d1037, 0xff5c88cb, 0xff5cef38, 0xff5ce067, 0xff5cd0cb, 0xff5c8bdb, 0xff5c5924,
+    0xff5c9349, 0xff5c5fb8, 0xff5c2fc4, 0xff5c10b4, 0xff5be647, 0xff5c4ecc, 0xff5bfc55, 0xff5c22b6,
+    0xff5c2a04, 0xff5c0f44, 0xff5bf1f4, 0xff5b9d63, 0xff5be05d, 0xff5bc331, 0xff5b203c, 0xff5b7d68,
+    0xff5b8193, 0xff5b12db, 0xff5b7fbc, 0xff5b7861, 0xff5b4214, 0xff5b1fcb, 0xff5adf1a, 0xff5b39df,
+    0xff5aef25, 0xff5af5b5, 0xff5af3dd, 0xff5a5026, 0xff5aaff6, 0xff5ab076, 0xff5aca10, 0xff5a9eed,
+    0xff5aa0f8, 0xff5a05fc, 0xff5a061e, 0xff5a714e, 0xff5a53ae, 0xff5a1d57, 0xff5a3f04, 0xff5a30f0,
+    0xff59fcb5, 0xff5a1a50, 0xff5a0120, 0xff59bed2, 0xff59a180, 0xff597708, 0xff597872, 0xff59ba5f,
+    0xff5992eb, 0xff5948a3, 0xff5902b6, 0xff595f5c, 0xff59606f, 0xff595fd6, 0xff591bc9, 0xff58e857,
+    0xff591034, 0xff58bfe8, 0xff58f3af, 0xff585338, 0xff58f2b1, 0xff58d058, 0xff58a297, 0xff58c392,
+    0xff589441, 0xff585f6c, 0xff584128, 0xff57d30b, 0xff57c006, 0xff5843ed, 0xff580ece, 0xff582448,
+    0xff578563, 0xff5803ae, 0xff57e052, 0xff575009, 0xff57e194, 0xff57c4d1, 0xff575a24, 0xff57b17c,
+    0xff57172e, 0xff56f61f, 0xff56f6a2, 0xff56f1a9, 0xff572f97, 0xff576081, 0xff56bcea, 0xff57112d,
+    0xff570d7c, 0xff570eaf, 0xff56c603, 0xff56c0ad, 0xff5659e8, 0xff569f2a, 0xff56264f, 0xff56272f,
+    0xff560b0e, 0xff563178, 0xff567e4d, 0xff55d03c, 0xff563d45, 0xff564fb1, 0xff55fb26, 0xff5591e6,
+    0xff55a9d1, 0xff561863, 0xff5582a3, 0xff55abfd, 0xff55aeec, 0xff559ec7, 0xff55a160, 0xff5591d3,
+    0xff55a025, 0xff5551a1, 0xff5509f3, 0xff555125, 0xff55410f, 0xff555012, 0xff550f0b, 0xff5523ed,
+    0xff5513d6, 0xff54ccc7, 0xff54e298, 0xff54f0d3, 0xff54e0fc, 0xff54b2a0, 0xff54a1e6, 0xff54371c,
+    0xff547467, 0xff5471ae, 0xff543c29, 0xff547103, 0xff5460ea, 0xff5443bc, 0xff53dbca, 0xff542319,
+    0xff541484, 0xff5402e4, 0xff53deee, 0xff53f9c4, 0xff53e109, 0xff53d8e6, 0xff53c762, 0xff531a4c,
+    0xff538208, 0xff539131, 0xff531f7f, 0xff530f3b, 0xff532f10, 0xff52d417, 0xff52ecd1, 0xff53318b,
+    0xff52cd46, 0xff53017c, 0xff52fe28, 0xff52f954, 0xff52e1e1, 0xff527599, 0xff528fb1, 0xff5217c3,
+    0xff52704c, 0xff52478c, 0xff5210e6, 0xff523ec0, 0xff52547f, 0xff5202ac, 0xff522188, 0xff51997d,
+    0xff518068, 0xff5195cf, 0xff51bbde, 0xff51c06e, 0xff51d435, 0xff51d9e2, 0xff5142ee, 0xff51a34f,
+    0xff51a197, 0xff516029, 0xff518aa7, 0xff50f1e4, 0xff50f03d, 0xff50efdb, 0xff514b0c, 0xff510f4a,
+    0xff5088f3, 0xff50c0a7, 0xff5069a2, 0xff50f950, 0xff507e53, 0xff505477, 0xff50b474, 0xff50bf2e,
+    0xff50b40e, 0xff502a07, 0xff506f6b, 0xff507acc, 0xff50349a, 0xff4fdeca, 0xff504100, 0xff4fd634,
+    0xff4fe181, 0xff4fe977, 0xff4f91d9, 0xff4fffd9, 0xff4f6553, 0xff4f9788, 0xff4fcf20, 0xff4fa449,
+    0xff4f70af, 0xff4effc4, 0xff4f29e7, 0xff4f4d06, 0xff4ee1b6, 0xff4f586c, 0xff4eab16, 0xff4f2e46,
+    0xff4edc56, 0xff4f11a8, 0xff4ec1d7, 0xff4e7302, 0xff4e964b, 0xff4e30cc, 0xff4e5733, 0xff4ec1b6,
+    0xff4e2759, 0xff4e98f7, 0xff4dfe66, 0xff4e7a55, 0xff4e1074, 0xff4e0898, 0xff4dfce0, 0xff4dde58,
+    0xff4dbce8, 0xff4db96c, 0xff4d675b, 0xff4dac52, 0xff4dad4f, 0xff4da447, 0xff4dc998, 0xff4d294f,
+    0xff4db01d, 0xff4d3f23, 0xff4cfa48, 0xff4d7701, 0xff4d4108, 0xff4d43dd, 0xff4cfabc, 0xff4cd424,
+    0xff4caad4, 0xff4cb9c8, 0xff4c95a8, 0xff4cfffc, 0xff4cef51, 0xff4c7561, 0xff4c787b, 0xff4cb9f9,
+    0xff4c4ae3, 0xff4bf3eb, 0xff4c5e23, 0xff4c0e69, 0xff4c6187, 0xff4c14e7, 0xff4c4122, 0xff4c214c,
+    0xff4c3218, 0xff4b9dec, 0xff4bddca, 0xff4bff55, 0xff4ba218, 0xff4b4492, 0xff4b815b, 0xff4bb82f,
+    0xff4b9462, 0xff4b9e0a, 0xff4b121e, 0xff4b527e, 0xff4b6a15, 0xff4ae783, 0xff4ae468, 0xff4a9388,
+    0xff4b01ea, 0xff4aca83, 0xff4a6f80, 0xff4a7949, 0xff4a777d, 0xff4acf83, 0xff4aa0db, 0xff4a8a58,
+    0xff4a051d, 0xff4aa00f, 0xff4a88f4, 0xff4a7087, 0xff4a2ba3, 0xff4a6115, 0xff4a3363, 0xff4a3878,
+    0xff49cfb7, 0xff4a239a, 0xff4a0257, 0xff49f1cf, 0xff499c6c, 0xff497f06, 0xff493352, 0xff4992d8,
+    0xff49b230, 0xff49340e, 0xff495c93, 0xff49712f, 0xff4967bf, 0xff49522b, 0xff48f7c8, 0xff48f0a4,
+    0xff49308e, 0xff491b21, 0xff48cea3, 0xff4867a8, 0xff48eb09, 0xff48d175, 0xff48576a, 0xff484867,
+    0xff481540, 0xff48396f, 0xff488a16, 0xff485b6e, 0xff47d27e, 0xff482d5a, 0xff4814ab, 0xff47fbc5,
+    0xff4834f5, 0xff481ab8, 0xff47a83f, 0xff476ae4, 0xff478d11, 0xff4779ea, 0xff4774c7, 0xff474ec1,
+    0xff4734f7, 0xff47634e, 0xff46e1a3, 0xff472fd5, 0xff46c120, 0xff46b19d, 0xff46f998, 0xff46eb93,
+    0xff471513, 0xff4711e0, 0xff471676, 0xff46519c, 0xff469cd1, 0xff4644f5, 0xff4650dd, 0xff46bb44,
+    0xff463372, 0xff461e78, 0xff46472b, 0xff4649ec, 0xff4607cc, 0xff4664ac, 0xff464226, 0xff4624aa,
+    0xff461055, 0xff45d632, 0xff45f29e, 0xff458535, 0xff45bb3c, 0xff45e18a, 0xff45d57a, 0xff45b0b4,
+    0xff45b3ec, 0xff44f38b, 0xff458977, 0xff452a04, 0xff44f5bc, 0xff44ff75, 0xff4551db, 0xff44d330,
+    0xff44bb19, 0xff451fc7, 0xff450237, 0xff44bb5a, 0xff445d67, 0xff44b291, 0xff44d013, 0xff449639,
+    0xff441927, 0xff43f82b, 0xff43e19e, 0xff447309, 0xff43c3d5, 0xff442cb5, 0xff43d133, 0xff43d7d3,
+    0xff442363, 0xff4421e5, 0xff4363d4, 0xff43a9a5, 0xff43e26e, 0xff43ca1b, 0xff43a46a, 0xff4347bb,
+    0xff43aae8, 0xff4316ea, 0xff42e7bb, 0xff437282, 0xff42ec54, 0xff42de1e, 0xff432871, 0xff42973a,
+    0xff430b4c, 0xff4319ea, 0xff42fc7d, 0xff430296, 0xff42f549, 0xff423af6, 0xff427a7a, 0xff42b9c2,
+    0xff424901, 0xff422b19, 0xff4254de, 0xff42237e, 0xff423e13, 0xff423871, 0xff41e5f8, 0xff423841,
+    0xff4229ea, 0xff419998, 0xff41d23d, 0xff41b6fa, 0xff418947, 0xff41db86, 0xff416c35, 0xff41badb,
+    0xff41382c, 0xff40f8b3, 0xff418ae9, 0xff414574, 0xff41729f, 0xff4120e8, 0xff4142d7, 0xff4141e1,
+    0xff40a86d, 0xff410db8, 0xff40cd76, 0xff40fbe9, 0xff40c330, 0xff403215, 0xff40b400, 0xff4032af,
+    0xff400379, 0xff4046f8, 0xff400f6e, 0xff400de1, 0xff4062e3, 0xff3ff88f, 0xff404b55, 0xff3f9adc,
+    0xff3fad74, 0xff4021ed, 0xff3fc306, 0xff3fc07c, 0xff3febbd, 0xff3f4832, 0xff3f361d, 0xff3f2fc8,
+    0xff3f6f95, 0xff3f36f8, 0xff3f8bb5, 0xff3ee80a, 0xff3efdd7, 0xff3ede62, 0xff3f1652, 0xff3ec706,
+    0xff3e832b, 0xff3f046e, 0xff3ee2d2, 0xff3e7d3a, 0xff3ec247, 0xff3e551d, 0xff3e4447, 0xff3e6a2f,
+    0xff3e4c0c, 0xff3e9323, 0xff3e62aa, 0xff3e4e66, 0xff3defbe, 0xff3e61f1, 0xff3e4b77, 0xff3e12f3,
+    0xff3e2b82, 0xff3d7f29, 0xff3df49d, 0xff3defca, 0xff3d85ac, 0xff3dc545, 0xff3d6485, 0xff3d9306,
+    0xff3da29f, 0xff3d394c, 0xff3d8a96, 0xff3cd65f, 0xff3cd698, 0xff3d50d4, 0xff3d4201, 0xff3d3a63,
+    0xff3d143e, 0xff3c85f1, 0xff3d1099, 0xff3c7677, 0xff3c72a5, 0xff3c681e, 0xff3c2d62, 0xff3c5c3c,
+    0xff3c5493, 0xff3c6b29, 0xff3c8ece, 0xff3c32d0, 0xff3bfb55, 0xff3c1fe3, 0xff3becca, 0xff3c0d83,
+    0xff3be4df, 0xff3ba753, 0xff3bdf2d, 0xff3bf342, 0xff3b61b9, 0xff3bd789, 0xff3b7a28, 0xff3b7587,
+    0xff3b1384, 0xff3b9ace, 0xff3b8314, 0xff3b5037, 0xff3b4351, 0xff3b6189, 0xff3b4ff2, 0xff3adc81,
+    0xff3a854a, 0xff3b1b32, 0xff3b01b8, 0xff3a873a, 0xff3a52d2, 0xff3a3827, 0xff3a5773, 0xff3a84a5,
+    0xff3a6904, 0xff3aa06c, 0xff3a74da, 0xff3a3fc6, 0xff3a079e, 0xff39e87a, 0xff3a0d15, 0xff3a2472,
+    0xff3a2187, 0xff39bc20, 0xff3a028f, 0xff39a7dd, 0xff3996fc, 0xff3954c4, 0xff39cbcb, 0xff392379,
+    0xff3994e4, 0xff390947, 0xff39478e, 0xff38eac4, 0xff38ef03, 0xff39451f, 0xff38a0bb, 0xff38cbd9,
+    0xff38be0b, 0xff391369, 0xff38e755, 0xff38aa96, 0xff38e3ae, 0xff38c625, 0xff38a171, 0xff381083,
+    0xff382e53, 0xff3884d4, 0xff3883f8, 0xff380029, 0xff384408, 0xff37b11c, 0xff37b6ce, 0xff38316c,
+    0xff37c0ef, 0xff377003, 0xff37cbd3, 0xff377def, 0xff37b000, 0xff37c4e1, 0xff3749d6, 0xff37a45b,
+    0xff3782fa, 0xff375c6b, 0xff3774d1, 0xff37533d, 0xff36dca8, 0xff372e28, 0xff372295, 0xff3732b1,
+    0xff37139e, 0xff3694c6, 0xff366d38, 0xff36bf4b, 0xff36af9f, 0xff36d255, 0xff36a2a7, 0xff366caf,
+    0xff364bd0, 0xff367313, 0xff36011c, 0xff3640d7, 0xff3642fd, 0xff35fdbd, 0xff360f9b, 0xff35ff83,
+    0xff3603e3, 0xff35ade0, 0xff35683a, 0xff3575ae, 0xff3577a6, 0xff35b327, 0xff35b53e, 0xff3593a2,
+    0xff351b19, 0xff3513f4, 0xff353cd3, 0xff356f4c, 0xff35607a, 0xff35333b, 0xff3534ab, 0xff34bd76,
+    0xff34f0a3, 0xff34f23e, 0xff34e2a5, 0xff34f918, 0xff34d5e7, 0xff34d260, 0xff34600c, 0xff3492f7,
+    0xff343981, 0xff3473ae, 0xff348082, 0xff340f44, 0xff341b99, 0xff34454c, 0xff33acea, 0xff341403,
+    0xff3403ab, 0xff338a7a, 0xff3407f4, 0xff340079, 0xff33986f, 0xff339ed9, 0xff33c2ba, 0xff33a204,
+    0xff335d1b, 0xff33058a, 0xff32e00f, 0xff332da6, 0xff335571, 0xff3332f6, 0xff3335b0, 0xff32d33b,
+    0xff32e6e4, 0xff331b5e, 0xff32bcdb, 0xff32c0f0, 0xff32d5e4, 0xff32c544, 0xff32c3c2, 0xff32a2a6,
+    0xff323f4d, 0xff328607, 0xff325043, 0xff322dc0, 0xff326bef, 0xff31b62b, 0xff3240b0, 0xff32108c,
+    0xff3180a3, 0xff31ccbb, 0xff3210ba, 0xff31f1ef, 0xff314601, 0xff318a67, 0xff31a435, 0xff31728c,
+    0xff310b8c, 0xff314b85, 0xff317578, 0xff30d7d7, 0xff313209, 0xff30ba49, 0xff3141e2, 0xff30df03,
+    0xff30a580, 0xff30e142, 0xff31039b, 0xff30666f, 0xff3092a7, 0xff303cbd, 0xff309138, 0xff30a672,
+    0xff304b19, 0xff30321a, 0xff3037c4, 0xff305ef0, 0xff301e59, 0xff2fdc1f, 0xff304c38, 0xff2f9006,
+    0xff2fceba, 0xff30054a, 0xff2f62f2, 0xff2f5c4e, 0xff2f6321, 0xff2f3d3d, 0xff2fc377, 0xff2f401b,
+    0xff2fa1ca, 0xff2f93b3, 0xff2f7620, 0xff2f3187, 0xff2f4220, 0xff2f1ff3, 0xff2f114d, 0xff2ee667,
+    0xff2f2269, 0xff2f1bb2, 0xff2ed0f5, 0xff2e5512, 0xff2ed61e, 0xff2ed1de, 0xff2e902b, 0xff2ea583,
+    0xff2ea25c, 0xff2e85d4, 0xff2e7379, 0xff2e2acc, 0xff2dfd61, 0xff2e341c, 0xff2e4377, 0xff2e0089,
+    0xff2db2f7, 0xff2dccf9, 0xff2d604a, 0xff2de69b, 0xff2dc3a4, 0xff2d8e48, 0xff2da49a, 0xff2da590,
+    0xff2d71da, 0xff2d0252, 0xff2d1e3c, 0xff2d669b, 0xff2d302b, 0xff2cc19d, 0xff2cee69, 0xff2d121e,
+    0xff2cdeb9, 0xff2cf3f6, 0xff2c714f, 0xff2cd3c3, 0xff2cd668, 0xff2cd2a7, 0xff2c8af8, 0xff2c802b,
+    0xff2c3ee4, 0xff2c7403, 0xff2c7525, 0xff2c5386, 0xff2bc466, 0xff2c2131, 0xff2c4325, 0xff2b9e35,
+    0xff2bf033, 0xff2c04ca, 0xff2bbd8d, 0xff2bb2c2, 0xff2bb10a, 0xff2b7c5b, 0xff2b79e1, 0xff2b5d39,
+    0xff2b3271, 0xff2b9a1a, 0xff2b3c3c, 0xff2b2ce4, 0xff2afdaf, 0xff2b0cf3, 0xff2add71, 0xff2aa591,
+    0xff2af189, 0xff2a80bc, 0xff2a8326, 0xff2a8d95, 0xff2ab1ea, 0xff2a4556, 0xff2a6f2b, 0xff2a7d7e,
+    0xff2a9640, 0xff2a7344, 0xff29e037, 0xff2a1b02, 0xff2a4447, 0xff29b14f, 0xff29eecd, 0xff2a250d,
+    0xff29cc2f, 0xff29ce07, 0xff29f5ff, 0xff29c156, 0xff299ec8, 0xff298d90, 0xff299143, 0xff2994f5,
+    0xff2900a0, 0xff296170, 0xff293b30, 0xff294151, 0xff294417, 0xff28c7ef, 0xff29122a, 0xff28e9cf,
+    0xff28cd0b, 0xff28bdd6, 0xff28d173, 0xff28e56e, 0xff289ed1, 0xff28aa63, 0xff2824c5, 0xff2893fa,
+    0xff287202, 0xff27f088, 0xff283f01, 0xff284215, 0xff27db5c, 0xff285b78, 0xff2824b5, 0xff279077,
+    0xff27a4c6, 0xff27ad52, 0xff27bee5, 0xff27ae77, 0xff279deb, 0xff277de6, 0xff2751b9, 0xff274f23,
+    0xff2701af, 0xff273bff, 0xff272f56, 0xff2701ad, 0xff26fca2, 0xff26fea6, 0xff26d2de, 0xff26c061,
+    0xff2693df, 0xff2687e3, 0xff26af1f, 0xff269f55, 0xff267e86, 0xff266ec5, 0xff263997, 0xff261fc7,
+    0xff265d0b, 0xff263f76, 0xff261304, 0xff25f20e, 0xff25ce45, 0xff25c987, 0xff25a327, 0xff25cd76,
+    0xff25bfe0, 0xff25a113, 0xff2568d3, 0xff2561ce, 0xff25644b, 0xff253848, 0xff2543ca, 0xff2541b0,
+    0xff251477, 0xff25206d, 0xff24f36d, 0xff24eb95, 0xff24d510, 0xff24c892, 0xff24b403, 0xff24c225,
+    0xff248d1c, 0xff2479b7, 0xff246c6a, 0xff2459d4, 0xff24400a, 0xff245414, 0xff243433, 0xff241df3,
+    0xff240dc3, 0xff23f74c, 0xff23fb93, 0xff23d334, 0xff23c12b, 0xff23c41a, 0xff23c344, 0xff239e4e,
+    0xff2392d8, 0xff2381b7, 0xff2362bb, 0xff23507f, 0xff235a05, 0xff2348d4, 0xff234f74, 0xff2315f6,
+    0xff230740, 0xff232d9d, 0xff22f27d, 0xff22d588, 0xff22ef5f, 0xff22d390, 0xff22a1cf, 0xff22a9b0,
+    0xff228e03, 0xff227032, 0xff22928e, 0xff225d69, 0xff225411, 0xff226df2, 0xff223ba3, 0xff221f68,
+    0xff220841, 0xff22123a, 0xff21e435, 0xff220111, 0xff21f249, 0xff21b008, 0xff21b491, 0xff21b490,
+    0xff2194a2, 0xff21a2cf, 0xff218244, 0xff2173ab, 0xff21652e, 0xff214008, 0xff212684, 0xff214248,
+    0xff2132ee, 0xff212176, 0xff20f8fe, 0xff210210, 0xff20dbcf, 0xff20d47a, 0xff20af54, 0xff209122,
+    0xff20a4b5, 0xff2094dc, 0xff20d13e, 0xff2080f8, 0xff205223, 0xff207dc5, 0xff205158, 0xff204f1f,
+    0xff20186d, 0xff1ff754, 0xff2004df, 0xff200312, 0xff1fd540, 0xff1ffd12, 0xff1faad6, 0xff1fcdd3,
+    0xff1fa439, 0xff1f8b2a, 0xff1f927f, 0xff1f75e3, 0xff1f5b7d, 0xff1f7acf, 0xff1f3d24, 0xff1f4a6f,
+    0xff1f4e0f, 0xff1f04e0, 0xff1f062e, 0xff1eec67, 0xff1edda5, 0xff1f0d0b, 0xff1ede04, 0xff1e96e3,
+    0xff1eb241, 0xff1ebf18, 0xff1e7ac7, 0xff1e72e5, 0xff1e72fd, 0xff1e46b6, 0xff1e5dab, 0xff1e25dc,
+    0xff1e024d, 0xff1e3e41, 0xff1e1f12, 0xff1e40d3, 0xff1e0cd4, 0xff1de3b3, 0xff1ddf8a, 0xff1d917e,
+    0xff1d9c50, 0xff1dafb6, 0xff1d8535, 0xff1dd316, 0xff1d4391, 0xff1d39ee, 0xff1d2958, 0xff1d4b87,
+    0xff1d5ddd, 0xff1d2f66, 0xff1d03b5, 0xff1d036d, 0xff1cdc49, 0xff1ced95, 0xff1cc508, 0xff1cb5c9,
+    0xff1cbfc0, 0xff1ca235, 0xff1c7b9f, 0xff1c7431, 0xff1c4faa, 0xff1c647d, 0xff1c23ae, 0xff1c430b,
+    0xff1c2646, 0xff1c121d, 0xff1c1464, 0xff1bde79, 0xff1bc021, 0xff1bcbac, 0xff1bd57d, 0xff1bc42e,
+    0xff1b9a2d, 0xff1b7f0a, 0xff1b754a, 0xff1b7702, 0xff1b49be, 0xff1b499d, 0xff1b5339, 0xff1b6d9c,
+    0xff1b14ea, 0xff1b2c96, 0xff1afbcd, 0xff1ad955, 0xff1ada6d, 0xff1afa56, 0xff1abb4b, 0xff1aac9b,
+    0xff1aa689, 0xff1a8912, 0xff1a86fa, 0xff1a8dcd, 0xff1a9d00, 0xff1a7daa, 0xff1a7e2c, 0xff1a2c28,
+    0xff1a19f2, 0xff1a3f46, 0xff1a1bf5, 0xff1a2da8, 0xff1a1b24, 0xff19cc0a, 0xff19eeaf, 0xff19ec7f,
+    0xff19a4bf, 0xff19b007, 0xff19cf18, 0xff19be76, 0xff198091, 0xff1957a3, 0xff193d04, 0xff1982b7,
+    0xff195011, 0xff192e9d, 0xff192c9c, 0xff192caf, 0xff1931a3, 0xff19231d, 0xff18c725, 0xff18ee27,
+    0xff18ed36, 0xff18f2bf, 0xff190f2b, 0xff188e08, 0xff187435, 0xff18d196, 0xff188fbe, 0xff185fb3,
+    0xff185f61, 0xff184dc9, 0xff18324b, 0xff182ee9, 0xff180bef, 0xff1832f5, 0xff1823f6, 0xff182034,
+    0xff17ced2, 0xff17bea6, 0xff17e4d7, 0xff17c142, 0xff179dbd, 0xff17c28d, 0xff179224, 0xff178263,
+    0xff17a359, 0xff175ef8, 0xff16e37b, 0xff175316, 0xff17530a, 0xff16ed40, 0xff16b32f, 0xff16cd3e,
+    0xff171312, 0xff16e329, 0xff169cfd, 0xff169f79, 0xff16b1d6, 0xff16a399, 0xff16b5d5, 0xff166d48,
+    0xff16143f, 0xff167515, 0xff1664b7, 0xff15db8e, 0xff16201b, 0xff162392, 0xff162436, 0xff161530,
+    0xff15de34, 0xff15cf10, 0xff15bf92, 0xff156c31, 0xff15b32f, 0xff15a298, 0xff157f50, 0xff156f0a,
+    0xff15a3a0, 0xff154f50, 0xff155201, 0xff157a8c, 0xff14e7b8, 0xff1534bd, 0xff14d35c, 0xff14cf67,
+    0xff14f2e0, 0xff1503e1, 0xff14aae7, 0xff14d46f, 0xff148f7c, 0xff147ff5, 0xff14a38f, 0xff146f82,
+    0xff142757, 0xff1484d7, 0xff143037, 0xff140537, 0xff141f9a, 0xff13eeb3, 0xff140021, 0xff140310,
+    0xff13c10c, 0xff13b21a, 0xff13a05d, 0xff13502e, 0xff138f9a, 0xff137c53, 0xff137eae, 0xff132fdf,
+    0xff133c3d, 0xff1362cd, 0xff131308, 0xff12ede0, 0xff135642, 0xff13236d, 0xff12efc3, 0xff1313e4,
+    0xff12f132, 0xff12e2d0, 0xff12bfbe, 0xff129f36, 0xff129e4a, 0xff12b444, 0xff1293b3, 0xff121acd,
+    0xff129191, 0xff123e43, 0xff121415, 0xff1203d2, 0xff124415, 0xff11bb39, 0xff11fed2, 0xff11ef86,
+    0xff118f25, 0xff118880, 0xff11e424, 0xff11e491, 0xff11c44a, 0xff11b54b, 0xff117042, 0xff11a666,
+    0xff1160f4, 0xff1130e7, 0xff1164cc, 0xff1171ca, 0xff1134a5, 0xff11106a, 0xff10eff6, 0xff10e073,
+    0xff10a779, 0xff1095ed, 0xff10f6c2, 0xff10c35b, 0xff10a031, 0xff10a20b, 0xff104077, 0xff107097,
+    0xff107287, 0xff106326, 0xff1053f8, 0xff1034d5, 0xff1010b9, 0xff1022ce, 0xff1014c6, 0xff10041c,
+    0xff0fb731, 0xff1012df, 0xff0fe49f, 0xff0f848e, 0xff0f9f3b, 0xff0fb4da, 0xff0f92f0, 0xff0fa620,
+    0xff0f92a3, 0xff0f6430, 0xff0f05f2, 0xff0f02a9, 0xff0f0fb4, 0xff0f34a6, 0xff0ecf44, 0xff0eab10,
+    0xff0ef290, 0xff0e9377, 0xff0ed30f, 0xff0eaff6, 0xff0ea033, 0xff0ea3f1, 0xff0e5fa4, 0xff0e6038,
+    0xff0e7148, 0xff0e1859, 0xff0e40b5, 0xff0df18a, 0xff0e0097, 0xff0e3503, 0xff0de083, 0xff0d9492,
+    0xff0de01b, 0xff0db024, 0xff0d8649, 0xff0df317, 0xff0db29e, 0xff0d9056, 0xff0d6df4, 0xff0d34a3,
+    0xff0d50c6, 0xff0d1dd2, 0xff0d1072, 0xff0ce58a, 0xff0d33e8, 0xff0d0055, 0xff0d41c2, 0xff0cec3e,
+    0xff0cb3a9, 0xff0cf25e, 0xff0c9388, 0xff0cadf1, 0xff0cb2ef, 0xff0c6413, 0xff0c8117, 0xff0c836f,
+    0xff0c3353, 0xff0c62c5, 0xff0c522a, 0xff0c3008, 0xff0c0eb1, 0xff0bf053, 0xff0be14b, 0xff0c0376,
+    0xff0bd6ab, 0xff0bf213, 0xff0b940f, 0xff0b9f26, 0xff0bb10d, 0xff0b60d6, 0xff0b70ec, 0xff0b7064,
+    0xff0b01b6, 0xff0b7568, 0xff0b0670, 0xff0af840, 0xff0b10b8, 0xff0b00d8, 0xff0ac6c4, 0xff0b03ed,
+    0xff0af390, 0xff0ac185, 0xff0ae57e, 0xff0a8379, 0xff0a67bc, 0xff0aa4e5, 0xff0a3f66, 0xff0a8a56,
+    0xff0a90f2, 0xff0a0da9, 0xff0a4024, 0xff0a5519, 0xff0a1ea9, 0xff0a1107, 0xff0a13d2, 0xff0a2485,
+    0xff09927a, 0xff09c00d, 0xff099609, 0xff09c296, 0xff09c4d2, 0xff09b487, 0xff09a3e1, 0xff0994d8,
+    0xff093fc4, 0xff0930c7, 0xff096283, 0xff0953cf, 0xff09459e, 0xff095eb7, 0xff08e144, 0xff08efa1,
+    0xff08e0f5, 0xff08f5f1, 0xff08efa6, 0xff08e49d, 0xff08b4a2, 0xff08c6c8, 0xff08784f, 0xff08712d,
+    0xff083473, 0xff0862e5, 0xff087729, 0xff0863c0, 0xff0802af, 0xff07fda4, 0xff07a8c4, 0xff07e2fb,
+    0xff0822ba, 0xff07a051, 0xff076af0, 0xff078c92, 0xff077235, 0xff07b613, 0xff0793e0, 0xff07a5b6,
+    0xff0766d1, 0xff077692, 0xff076666, 0xff07305d, 0xff071886, 0xff075a9a, 0xff071378, 0xff07322d,
+    0xff0733b1, 0xff06f440, 0xff0702e8, 0xff06bb37, 0xff0680a2, 0xff06d362, 0xff068d11, 0xff06b241,
+    0xff068fcc, 0xff06514d, 0xff0654fc, 0xff063e6d, 0xff0633be, 0xff06467b, 0xff05fcac, 0xff05a1f8,
+    0xff05d05c, 0xff05e4b6, 0xff05d492, 0xff05f487, 0xff05c6ca, 0xff05a3f4, 0xff05951a, 0xff0584c0,
+    0xff054a6f, 0xff059423, 0xff055318, 0xff055597, 0xff05711d, 0xff0552f9, 0xff054708, 0xff051268,
+    0xff04cf6d, 0xff047b83, 0xff04f6fc, 0xff04c366, 0xff04c5dd, 0xff04d0c3, 0xff049d31, 0xff048507,
+    0xff04405d, 0xff0485de, 0xff0465ef, 0xff03feb5, 0xff041e88, 0xff0435a6, 0xff0436f1, 0xff04133d,
+    0xff03fd54, 0xff03cb4c, 0xff03f663, 0xff03f25c, 0xff03a12b, 0xff035ce0, 0xff038135, 0xff0324d0,
+    0xff03b093, 0xff0327e7, 0xff02faf9, 0xff034429, 0xff03576c, 0xff0312a3, 0xff02ff97, 0xff03254b,
+    0xff0321d2, 0xff02f5c0, 0xff03022c, 0xff02d69c, 0xff02b534, 0xff02b6c2, 0xff02b783, 0xff0215a5,
+    0xff029d9e, 0xff02a027, 0xff028b54, 0xff0274c6, 0xff01ecfd, 0xff0224b6, 0xff0236c8, 0xff020053,
+    0xff01e16b, 0xff01a04f, 0xff017960, 0xff01d5cc, 0xff01a933, 0xff01d8b1, 0xff01898d, 0xff016af7,
+    0xff01515d, 0xff016524, 0xff018087, 0xff0163b4, 0xff01631b, 0xff014268, 0xff014172, 0xff0133af,
+    0xff0104f3, 0xff00f501, 0xff00d553, 0xff00e69d, 0xff00b45e, 0xff00b6f5, 0xff00cc11, 0xff008464,
+    0xff008257, 0xff008264, 0xff008458, 0xff007b69, 0xfeffe6ca, 0xff00543e, 0xfeffe1b3, 0xff00058f,
+    0xff00242c, 0xff00148f, 0xff0004cc, 0xfeffe6c6, 0xfeff75dd, 0xfeffc7ba, 0xfeffb69e, 0xfeff850a,
+    0xfeffaac6, 0xfeff8844, 0xfeff8b42, 0xfefee176, 0xfeff63cc, 0xfefefd87, 0xfeff42f3, 0xfeff262f,
+    0xfeff22e9, 0xfeff1c22, 0xfefef79d, 0xfefeff82, 0xfefe77f9, 0xfefea434, 0xfefea690, 0xfefebaca,
+    0xfefeab94, 0xfefe7d31, 0xfefe6541, 0xfefe7b65, 0xfefdd8c8, 0xfefe1141, 0xfefe4a9c, 0xfefe3b15,
+    0xfefdf424, 0xfefdaed3, 0xfefdd5ec, 0xfefdd742, 0xfefda78a, 0xfefdb5fc, 0xfefdc31c, 0xfefd8cc9,
+    0xfefd87a1, 0xfefd7728, 0xfefd6712, 0xfefd4656, 0xfefd01af, 0xfefd5ab5, 0xfefd44b9, 0xfefd2779,
+    0xfefd06e3, 0xfefce542, 0xfefcb9bb, 0xfefc6185, 0xfefcea4b, 0xfefc9a49, 0xfefccac4, 0xfefcbf10,
+    0xfefc098a, 0xfefc65c6, 0xfefc2b16, 0xfefc7be6, 0xfefc3e05, 0xfefc610b, 0xfefc0bc2, 0xfefbe177,
+    0xfefc3102, 0xfefc1a85, 0xfefbf6ee, 0xfefbc09f, 0xfefb43db, 0xfefbabe2, 0xfefbc421, 0xfefb8419,
+    0xfefb7482, 0xfefb13e4, 0xfefb620a, 0xfefb2a0c, 0xfefb080b, 0xfefacecb, 0xfefb2581, 0xfefa9048,
+    0xfefae1f4, 0xfefb1c17, 0xfefa92bb, 0xfefad6e9, 0xfefae52c, 0xfefaa5ef, 0xfefab84f, 0xfefa1a1e,
+    0xfefa9733, 0xfefa500c, 0xfefa84d6, 0xfefa67f2, 0xfefa6c9d, 0xfefa4781, 0xfef9a024, 0xfefa428a,
+    0xfefa2b43, 0xfef9a2bb, 0xfefa04de, 0xfef9d751, 0xfef9c799, 0xfef97db8, 0xfef932d5, 0xfef9b505,
+    0xfef99448, 0xfef99c42, 0xfef9275d, 0xfef97334, 0xfef8ef60, 0xfef8c934, 0xfef937f2, 0xfef93c9f,
+    0xfef9173c, 0xfef8c138, 0xfef8f878, 0xfef8fafd, 0xfef8c6d4, 0xfef8939e, 0xfef8b763, 0xfef8846a,
+    0xfef8ab41, 0xfef8653a, 0xfef840ac, 0xfef7d9fd, 0xfef828a8, 0xfef7fcb7, 0xfef8166d, 0xfef7ac4d,
+    0xfef82cbc, 0xfef7c1bb, 0xfef7e721, 0xfef7c614, 0xfef7725d, 0xfef73194, 0xfef7c32d, 0xfef786f1,
+    0xfef7769c, 0xfef70fb5, 0xfef72208, 0xfef756fb, 0xfef73630, 0xfef72731, 0xfef7382a, 0xfef71600,
+    0xfef6cfcf, 0xfef68703, 0xfef66e84, 0xfef7054d, 0xfef6c6c0, 0xfef69029, 0xfef6608a, 0xfef685bc,
+    0xfef685cb, 0xfef6930f, 0xfef6541a, 0xfef5d85b, 0xfef6203f, 0xfef6018f, 0xfef5e1aa, 0xfef60531,
+    0xfef5e142, 0xfef5f5d4, 0xfef5bcf3, 0xfef5d646, 0xfef59180, 0xfef5918c, 0xfef56f6c, 0xfef5454c,
+    0xfef57586, 0xfef4ffa4, 0xfef565d3, 0xfef531e3, 0xfef521d3, 0xfef5472b, 0xfef541db, 0xfef5172b,
+    0xfef506cb, 0xfef48a87, 0xfef4a55f, 0xfef45e16, 0xfef4969e, 0xfef4c5c8, 0xfef4c568, 0xfef495b1,
+    0xfef484a0, 0xfef42616, 0xfef43099, 0xfef44735, 0xfef455ae, 0xfef453c4, 0xfef3f1ee, 0xfef43339,
+    0xfef42293, 0xfef40696, 0xfef3c0fd, 0xfef3de4f, 0xfef3f1cb, 0xfef3d50f, 0xfef3b7c1, 0xfef3b2f3,
+    0xfef325d6, 0xfef393a2, 0xfef2f3fd, 0xfef2d17d, 0xfef2c36f, 0xfef2e24a, 0xfef301c9, 0xfef3270a,
+    0xfef2e1d4, 0xfef307b2, 0xfef30e58, 0xfef2f36b, 0xfef2c609, 0xfef2c784, 0xfef281d1, 0xfef2b413,
+    0xfef221c3, 0xfef277d1, 0xfef284e2, 0xfef28229, 0xfef247ce, 0xfef22678, 0xfef21761, 0xfef228ea,
+    0xfef1c384, 0xfef1f81d, 0xfef1e70d, 0xfef1d791, 0xfef1b730, 0xfef15862, 0xfef1a7cd, 0xfef157dd,
+    0xfef1880c, 0xfef166b6, 0xfef1572e, 0xfef0f325, 0xfef12228, 0xfef14887, 0xfef13761, 0xfef0f1fd,
+    0xfef0f66a, 0xfef0c85b, 0xfef0cc17, 0xfef0a22f, 0xfef0b67e, 0xfef0a665, 0xfef0a6f5, 0xfef0a79a,
+    0xfef0a334, 0xfeeff7e6, 0xfef042a1, 0xfef006d9, 0xfef0018e, 0xfef037a6, 0xfef027ac, 0xfeeff13d,
+    0xfef023e5, 0xfeefe67e, 0xfeefd6e0, 0xfeefb286, 0xfeef5236, 0xfeef91a1, 0xfeef71cd, 0xfeef7267,
+    0xfeef62dd, 0xfeef3321, 0xfeef2033, 0xfeef4679, 0xfeef0273, 0xfeef2630, 0xfeeed627, 0xfeeee160,
+    0xfeeeb5b7, 0xfeeea60f, 0xfeee8866, 0xfeee50e9, 0xfeeea112, 0xfeee9224, 0xfeee61f0, 0xfeee37e3,
+    0xfeee27fc, 0xfeee5085, 0xfeee0637, 0xfeee31d8, 0xfeee21ab, 0xfeedf1d3, 0xfeedc650, 0xfeede1e9,
+    0xfeedc13d, 0xfeed7eca, 0xfeed949c, 0xfeedb288, 0xfeed75fc, 0xfeed56d4, 0xfeed70e8, 0xfeed5fe3,
+    0xfeed343b, 0xfeed51ec, 0xfeed408d, 0xfeecd83d, 0xfeecf547, 0xfeece639, 0xfeecc8c4, 0xfeecd214,
+    0xfeece246, 0xfeece565, 0xfeecb051, 0xfeec90b4, 0xfeec9ed4, 0xfeec58c3, 0xfeec8189, 0xfeec86a0,
+    0xfeec63a7, 0xfeec65ca, 0xfeebe2d9, 0xfeec068b, 0xfeec23a4, 0xfeebb22f, 0xfeebd516, 0xfeebf1bb,
+    0xfeeb8192, 0xfeebe800, 0xfeebb1d1, 0xfeeb7776, 0xfeeb9257, 0xfeeb817a, 0xfeeb82e6, 0xfeeb8fe2,
+    0xfeeb42a5, 0xfeeaf0b1, 0xfeeb6569, 0xfeeb1119, 0xfeeb1a0e, 0xfeeb4724, 0xfeeaf1b7, 0xfeeb27c9,
+    0xfeead16d, 0xfeeaa734, 0xfeeac28c, 0xfeea673e, 0xfeeaa36f, 0xfeeaa664, 0xfeea8329, 0xfeea86b7,
+    0xfeea621a, 0xfeea3194, 0xfeea20a4, 0xfeea473f, 0xfeea017c, 0xfeea5343, 0xfeea0133, 0xfee9b564,
+    0xfee9e309, 0xfee9e658, 0xfee9d746, 0xfee9c84d, 0xfee998cb, 0xfee9b83e, 0xfee98391, 0xfee938af,
+    0xfee92915, 0xfee967f4, 0xfee9583b, 0xfee932c1, 0xfee922fc, 0xfee8e78f, 0xfee8f34b, 0xfee8f43a,
+    0xfee8f716, 0xfee8d481, 0xfee8aba8, 0xfee8d7d0, 0xfee8c755, 0xfee8a7d7, 0xfee8635f, 0xfee8745d,
+    0xfee8ab7d, 0xfee811c4, 0xfee8445e, 0xfee82232, 0xfee7e34d, 0xfee83754, 0xfee7e2a1, 0xfee8262f,
+    0xfee81881, 0xfee7b118, 0xfee7aaa2, 0xfee77856, 0xfee7695e, 0xfee7b827, 0xfee7a7c5, 0xfee796a8,
+    0xfee76287, 0xfee753f9, 0xfee732f6, 0xfee764bb, 0xfee7023f, 0xfee70212, 0xfee7164c, 0xfee71808,
+    0xfee6d213, 0xfee6a5ff, 0xfee68918, 0xfee6c7b1, 0xfee669e9, 0xfee681f2, 0xfee66423, 0xfee639ab,
+    0xfee664c9, 0xfee64051, 0xfee608fe, 0xfee6483e, 0xfee5e0e0, 0xfee5f287, 0xfee5e295, 0xfee5abbb,
+    0xfee59df3, 0xfee5f7b1, 0xfee5b2df, 0xfee57904, 0xfee54bca, 0xfee5823d, 0xfee5833d, 0xfee53956,
+    0xfee5360c, 0xfee5421c, 0xfee543bd, 0xfee547a7, 0xfee51178, 0xfee4e4f6, 0xfee4d60a, 0xfee4b8d3,
+    0xfee4c2c4, 0xfee4d2c8, 0xfee47a48, 0xfee48672, 0xfee4b75b, 0xfee464ec, 0xfee4635b, 0xfee473d6,
+    0xfee409d3, 0xfee45177, 0xfee3fd37, 0xfee3f894, 0xfee44800, 0xfee3da09, 0xfee3cade, 0xfee3f259,
+    0xfee3c0a6, 0xfee3f7ef, 0xfee3a323, 0xfee38703, 0xfee369d4, 0xfee35942, 0xfee34ac6, 0xfee3871a,
+    0xfee34226, 0xfee3345c, 0xfee322a8, 0xfee2fa32, 0xfee2d5b3, 0xfee2f2e5, 0xfee2bbed, 0xfee305f8,
+    0xfee30806, 0xfee299bd, 0xfee2e432, 0xfee2c47f, 0xfee269ab, 0xfee28315, 0xfee26377, 0xfee23684,
+    0xfee25354, 0xfee22748, 0xfee20a21, 0xfee222a4, 0xfee202a1, 0xfee2132a, 0xfee2036b, 0xfee1bb2f,
+    0xfee19642, 0xfee19a2a, 0xfee18b16, 0xfee1853c, 0xfee16817, 0xfee1a620, 0xfee15670, 0xfee153d8,
+    0xfee12c0d, 0xfee11a7d, 0xfee1446f, 0xfee11475, 0xfee0f7dd, 0xfee102f6, 0xfee1044a, 0xfee0bba6,
+    0xfee0ab4c, 0xfee0a859, 0xfee06311, 0xfee07bb7, 0xfee08342, 0xfee04f43, 0xfee02087, 0xfee02578,
+    0xfee03644, 0xfee035b3, 0xfee016d1, 0xfee03443, 0xfedfd5bb, 0xfedfd940, 0xfedfd85a, 0xfedfba39,
+    0xfedfc48e, 0xfedfc357, 0xfedf7e13, 0xfedf855f, 0xfedf6a58, 0xfedf686f, 0xfedf28a2, 0xfedf3a1d,
+    0xfedf42b2, 0xfedf0e19, 0xfedf189f, 0xfedf12be, 0xfedec4df, 0xfedeb85a, 0xfedeb4df, 0xfedeadd5,
+    0xfede9e2c, 0xfedea383, 0xfede602c, 0xfede5f2c, 0xfede7894, 0xfede4c75, 0xfede3eb2, 0xfede2f53,
+    0xfede0000, 0xfeddfa4c, 0xfeddefed, 0xfeddd8fa, 0xfeddc9fe, 0xfeddbe04, 0xfeddaab0, 0xfedda61a,
+    0xfedd86f7, 0xfedd7010, 0xfedd600f, 0xfedd505d, 0xfedd4f4f, 0xfedd3ae2, 0xfedd365e, 0xfedd1a35,
+    0xfedd00e0, 0xfedcf0c2, 0xfedce00e, 0xfedce6f0, 0xfedcca50, 0xfedcb4c2, 0xfedcae3e, 0xfedc9002,
+    0xfedc9655, 0xfedca678, 0xfedc600a, 0xfedc5dfa, 0xfedc443d, 0xfedc300a, 0xfedc29bf, 0xfedc108d,
+    0xfedc0000, 0xfedbf998, 0xfedbe325, 0xfedbd678, 0xfedbd577, 0xfedbb11e, 0xfedba000, 0xfedb99bd,
+    0xfedb8000, 0xfedb7399, 0xfedb7003, 0xfedb500c, 0xfedb4004, 0xfedb3431, 0xfedb2001, 0xfedb2da0,
+    0xfedb000a, 0xfedaf041, 0xfedaea85, 0xfedad011, 0xfedac5c5, 0xfedab361, 0xfedaa001, 0xfeda910c,
+    0xfeda86c6, 0xfeda71f7, 0xfeda6810, 0xfeda50a7, 0xfeda4009, 0xfeda3010, 0xfeda21ea, 0xfeda18b9,
+    0xfeda021b, 0xfeda19f2, 0xfeda096b, 0xfed9d007, 0xfed9db1b, 0xfed9cbb6, 0xfed9a005, 0xfed9bad2,
+    0xfed98aaa, 0xfed9702a, 0xfed97cb3, 0xfed95af1, 0xfed94020, 0xfed95636, 0xfed93ca2, 0xfed91a2c,
+    0xfed9147a, 0xfed8f58f, 0xfed8e396, 0xfed8e6c7, 0xfed8cead, 0xfed8d975, 0xfed8b5a6, 0xfed89eba,
+    0xfed8c302, 0xfed87167, 0xfed86afc, 0xfed87a6f, 0xfed85bae, 0xfed86899, 0xfed84b2b, 0xfed812ac,
+    0xfed8134d, 0xfed80f41, 0xfed7ec0b, 0xfed7ecda, 0xfed7c340, 0xfed7ce70, 0xfed7b5df, 0xfed79d88,
+    0xfed790ab, 0xfed79b0c, 0xfed78c39, 0xfed7a005, 0xfed75e65, 0xfed75ad3, 0xfed74c09, 0xfed71b34,
+    0xfed72bfe, 0xfed726ff, 0xfed70bd1, 0xfed713fd, 0xfed6d462, 0xfed6b69a, 0xfed6be74, 0xfed6c41f,
+    0xfed69735, 0xfed69a43, 0xfed697b2, 0xfed65f7d, 0xfed67775, 0xfed65c2e, 0xfed62876, 0xfed63c48,
+    0xfed62a6a, 0xfed641d6, 0xfed5fe11, 0xfed5ed85, 0xfed5d77f, 0xfed5e8c7, 0xfed5a74d, 0xfed5b1b1,
+    0xfed59d6d, 0xfed58c06, 0xfed56f37, 0xfed56f55, 0xfed5571a, 0xfed54fc5, 0xfed573c5, 0xfed5267c,
+    0xfed52ca1, 0xfed4fc91, 0xfed4f116, 0xfed513e1, 0xfed4f57d, 0xfed4cdcb, 0xfed503bd, 0xfed4c7ba,
+    0xfed4ab4c, 0xfed4b2bb, 0xfed46a72, 0xfed47ae1, 0xfed491e4, 0xfed45d17, 0xfed4375f, 0xfed43ae5,
+    0xfed41d2e, 0xfed41cf2, 0xfed409fd, 0xfed3d387, 0xfed3f8f5, 0xfed3db31, 0xfed3b709, 0xfed3a433,
+    0xfed39ec0, 0xfed39cb9, 0xfed39700, 0xfed36e0d, 0xfed376b7, 0xfed35c9c, 0xfed33eaf, 0xfed31dfb,
+    0xfed31588, 0xfed304b8, 0xfed343ab, 0xfed320fd, 0xfed2dfbe, 0xfed2c017, 0xfed2b6e6, 0xfed2d455,
+    0xfed297e1, 0xfed2a77d, 0xfed27f7a, 0xfed27b86, 0xfed29373, 0xfed247fa, 0xfed2370f, 0xfed253cf,
+    0xfed24340, 0xfed253b8, 0xfed22113, 0xfed1fd87, 0xfed1f89c, 0xfed2030c, 0xfed1c08d, 0xfed1c73f,
+    0xfed1d0c7, 0xfed1c1b9, 0xfed1e654, 0xfed188b5, 0xfed16c2a, 0xfed139a3, 0xfed1a6ff, 0xfed1737d,
+    0xfed17529, 0xfed14224, 0xfed13360, 0xfed1327f, 0xfed103ec, 0xfed12596, 0xfed12708, 0xfed1168e,
+    0xfed0e1f4, 0xfed0a90c, 0xfed098de, 0xfed0d632, 0xfed0b7fd, 0xfed0b6b9, 0xfed0a7e8, 0xfed0551c,
+    0xfed00f78, 0xfed077f7, 0xfed0429e, 0xfed06633, 0xfed03695, 0xfed05af4, 0xfed01879, 0xfecff481,
+    0xfecff7b3, 0xfecff588, 0xfecfe8a2, 0xfecf786e, 0xfecfb663, 0xfecfa8ae, 0xfecf94ee, 0xfecf6390,
+    0xfecf447d, 0xfecef020, 0xfecf68c4, 0xfecf6747, 0xfecf37bd, 0xfecf10e8, 0xfecf361d, 0xfecee4aa,
+    0xfecf1ebc, 0xfecf0722, 0xfeceb3f9, 0xfeceeeca, 0xfecec728, 0xfecea7ab, 0xfece7930, 0xfece9712,
+    0xfece24e4, 0xfece8665, 0xfece0295, 0xfece350a, 0xfece24e9, 0xfece38b6, 0xfece27df, 0xfece06f4,
+    0xfecde48e, 0xfece17f6, 0xfecdb37d, 0xfecd5e65, 0xfecde2d1, 0xfecd70a8, 0xfecdcb36, 0xfecd5490,
+    0xfecd777a, 0xfecd76ac, 0xfecd2856, 0xfecd361f, 0xfeccdd8f, 0xfecd1554, 0xfeccaee1, 0xfecd18d6,
+    0xfecce4da, 0xfeccd35d, 0xfeccc515, 0xfecc9416, 0xfecc942a, 0xfecc9607, 0xfecc7310, 0xfeccba45,
+    0xfecc654c, 0xfecc5520, 0xfecc76d5, 0xfecc0f17, 0xfecc24b8, 0xfecc0845, 0xfecbf364, 0xfecc1822,
+    0xfecc054c, 0xfecbb4d3, 0xfecbb3de, 0xfecbd633, 0xfecb40e7, 0xfecb94f4, 0xfecb450d, 0xfecb408d,
+    0xfecb37ee, 0xfecb4267, 0xfecb431d, 0xfecb34e0, 0xfecb1342, 0xfecb45ac, 0xfecada04, 0xfecaf319,
+    0xfecac4c9, 0xfecad1b3, 0xfecad67d, 0xfeca7a03, 0xfecaa546, 0xfeca852c, 0xfeca6466, 0xfeca7518,
+    0xfeca3883, 0xfeca2e0c, 0xfeca688e, 0xfeca34cc, 0xfeca262c, 0xfec9dca0, 0xfec9d972, 0xfec99043,
+    0xfec9f7f9, 0xfec9d4fa, 0xfec9f6f2, 0xfec9c852, 0xfec9936f, 0xfec93226, 0xfec96359, 0xfec96402,
+    0xfec941e3, 0xfec9686c, 0xfec91226, 0xfec93409, 0xfec93658, 0xfec953c0, 0xfec8e0a7, 0xfec91164,
+    0xfec8e0c0, 0xfec8b54e, 0xfec8d7f5, 0xfec8a38a, 0xfec87a22, 0xfec84648, 0xfec8b681, 0xfec897fa,
+    0xfec89714, 0xfec827d4, 0xfec82593, 0xfec85864, 0xfec813b1, 0xfec837e5, 0xfec7b293, 0xfec83966,
+    0xfec7e553, 0xfec7b57a, 0xfec7f4f5, 0xfec7fb03, 0xfec78382, 0xfec73019, 0xfec76679, 0xfec7168b,
+    0xfec788e6, 0xfec7687e, 0xfec725dc, 0xfec75985, 0xfec6f9d4, 0xfec70500, 0xfec6e5fa, 0xfec6bdf5,
+    0xfec6b73a, 0xfec6c46a, 0xfec6c355, 0xfec6d964, 0xfec69443, 0xfec6a482, 0xfec6c74b, 0xfec65509,
+    0xfec68753, 0xfec69b85, 0xfec63236, 0xfec65835, 0xfec63656, 0xfec5e8ec, 0xfec62919, 0xfec60788,
+    0xfec5c56d, 0xfec5e5d7, 0xfec5a49f, 0xfec57d9c, 0xfec5d719, 0xfec56995, 0xfec5599e, 0xfec58767,
+    0xfec5526b, 0xfec56486, 0xfec556a3, 0xfec522ef, 0xfec50218, 0xfec50511, 0xfec4e4d9, 0xfec533d0,
+    0xfec513b4, 0xfec4f750, 0xfec4c45a, 0xfec494ea, 0xfec4865e, 0xfec495d7, 0xfec465cf, 0xfec47442,
+    0xfec4660b, 0xfec4562a, 0xfec430af, 0xfec41609, 0xfec3e003, 0xfec4020e, 0xfec41721, 0xfec422ad,
+    0xfec3f482, 0xfec3f6ac, 0xfec3d72f, 0xfec39684, 0xfec3b51a, 0xfec39409, 0xfec3868d, 0xfec3b32a,
+    0xfec35397, 0xfec3355d, 0xfec3446a, 0xfec36709, 0xfec34959, 0xfec344af, 0xfec3266a, 0xfec2cad4,
+    0xfec2c537, 0xfec2e75d, 0xfec2a666, 0xfec2d1c7, 0xfec2d674, 0xfec2545c, 0xfec298ba, 0xfec272f4,
+    0xfec245b1, 0xfec26925, 0xfec24e2e, 0xfec25831, 0xfec25862, 0xfec1f076, 0xfec2281c, 0xfec1f625,
+    0xfec1f5e1, 0xfec1f88e, 0xfec1e0e4, 0xfec1c5f5, 0xfec1b857, 0xfec18564, 0xfec18352, 0xfec110bb,
+    0xfec19440, 0xfec176f3, 0xfec183a4, 0xfec155c9, 0xfec125cf, 0xfec11075, 0xfec106e7, 0xfec0a8f5,
+    0xfec123fe, 0xfec111ad, 0xfec0d8d1, 0xfec0d775, 0xfec0e152, 0xfec0c836, 0xfec0a8d5, 0xfec07f82,
+    0xfec0a480, 0xfec0948c, 0xfec06924, 0xfec0364a, 0xfec048cc, 0xfec053d5, 0xfec03772, 0xfec027b9,
+    0xfec0076b, 0xfec004e5, 0xfebfc939, 0xfebf81e4, 0xfebfc96e, 0xfebfc6fd, 0xfebf88c8, 0xfebfb362,
+    0xfebf97fb, 0xfebf87bc, 0xfebf46b0, 0xfebf12d1, 0xfebf5791, 0xfebf53a8, 0xfebf451d, 0xfebf105e,
+    0xfebf191d, 0xfebef99e, 0xfebed9a7, 0xfebefbc2, 0xfebe46a1, 0xfebe4411, 0xfebe386e, 0xfebea6b4,
+    0xfebe97d0, 0xfebe9553, 0xfebe59a2, 0xfebddcf2, 0xfebe2c55, 0xfebe47c6, 0xfebdd5a8, 0xfebe3457,
+    0xfebe14d4, 0xfebe1eab, 0xfebd6f0c, 0xfebdb5c2, 0xfebde949, 0xfebdd3fd, 0xfebdb7ee, 0xfebdb41f,
+    0xfebd836c, 0xfebcf9eb, 0xfebd027c, 0xfebd797b, 0xfebd6950, 0xfebd290b, 0xfebcbed5, 0xfebcb6db,
+    0xfebd08c2, 0xfebd0797, 0xfebcca2b, 0xfebcaced, 0xfebcec54, 0xfebca93c, 0xfebc2185, 0xfebca796,
+    0xfebc89b3, 0xfebbfed8, 0xfebc7880, 0xfebc5a16, 0xfebc5993, 0xfebc38d4, 0xfebc451d, 0xfebc36ff,
+    0xfebc15f0, 0xfebc14e9, 0xfebbd90e, 0xfebbca6e, 0xfebb9699, 0xfebb6904, 0xfebbb84d, 0xfebba724,
+    0xfebb892d, 0xfebb85ca, 0xfebb1c29, 0xfebb73c6, 0xfebb612f, 0xfebb267f, 0xfebb2a05, 0xfebb41fd,
+    0xfebb2c4e, 0xfebaada1, 0xfebac837, 0xfebaf27b, 0xfeba6ed5, 0xfeba9f97, 0xfebac505, 0xfeba242e,
+    0xfeba96f5, 0xfeba56a6, 0xfeba844e, 0xfeba7ab1, 0xfeba6a6d, 0xfeb9d186, 0xfeba3734, 0xfeba27fd,
+    0xfeb9fdb0, 0xfeb9f80c, 0xfeba107f, 0xfeba001d, 0xfeb95910, 0xfeb9e03c, 0xfeb9cf1a, 0xfeb9b582,
+    0xfeb99a0b, 0xfeb93d9b, 0xfeb92f9d, 0xfeb97b99, 0xfeb958bd, 0xfeb9493a, 0xfeb8ca89, 0xfeb8bb8a,
+    0xfeb8fa2e, 0xfeb8af3b, 0xfeb8e909, 0xfeb8922d, 0xfeb8d692, 0xfeb8c657, 0xfeb8d250, 0xfeb8a887,
+    0xfeb8a55e, 0xfeb89bbc, 0xfeb8688f, 0xfeb87f50, 0xfeb858a0, 0xfeb85454, 0xfeb83853, 0xfeb833ae,
+    0xfeb78ae3, 0xfeb7c4e2, 0xfeb7b655, 0xfeb7e932, 0xfeb7a6a9, 0xfeb7c8a7, 0xfeb7983c, 0xfeb798ab,
+    0xfeb7a4db, 0xfeb715d8, 0xfeb7691c, 0xfeb735e0, 0xfeb74a67, 0xfeb7550d, 0xfeb73885, 0xfeb6cba0,
+    0xfeb6fbc4, 0xfeb6c940, 0xfeb70cce, 0xfeb6da15, 0xfeb6d887, 0xfeb64302, 0xfeb6cc89, 0xfeb65cf9,
+    0xfeb6a4f9, 0xfeb64607, 0xfeb66af9, 0xfeb669cb, 0xfeb61781, 0xfeb65a59, 0xfeb64f9d, 0xfeb5a354,
+    0xfeb5f92d, 0xfeb5fa38, 0xfeb5d82c, 0xfeb5da93, 0xfeb58235, 0xfeb5e025, 0xfeb5320b, 0xfeb51f26,
+    0xfeb5ad7f, 0xfeb59c27, 0xfeb55969, 0xfeb52781, 0xfeb56bec, 0xfeb53a2f, 0xfeb51515, 0xfeb508da,
+    0xfeb48a8d, 0xfeb5237f, 0xfeb500b8, 0xfeb4faee, 0xfeb4c977, 0xfeb4a7b9, 0xfeb4aa30, 0xfeb4a885,
+    0xfeb489e5, 0xfeb410c3, 0xfeb4355a, 0xfeb48059, 0xfeb446e7, 0xfeb4281c, 0xfeb4379b, 0xfeb3e48f,
+    0xfeb409e3, 0xfeb41bcd, 0xfeb376f6, 0xfeb3f512, 0xfeb3732e, 0xfeb3d7e4, 0xfeb3ab02, 0xfeb36f1b,
+    0xfeb3a4f0, 0xfeb388a9, 0xfeb391ba, 0xfeb34953, 0xfeb2f39f, 0xfeb2dfcb, 0xfeb33970, 0xfeb2f461,
+    0xfeb32bcd, 0xfeb30670, 0xfeb2715c, 0xfeb2f3a8, 0xfeb2e801, 0xfeb2a336, 0xfeb253aa, 0xfeb25952,
+    0xfeb2a832, 0xfeb294ca, 0xfeb26b4b, 0xfeb27b61, 0xfeb1f4af, 0xfeb25b97, 0xfeb200cf, 0xfeb20d91,
+    0xfeb1d62c, 0xfeb214ff, 0xfeb1c736, 0xfeb17741, 0xfeb180ad, 0xfeb1d44a, 0xfeb1cc48, 0xfeb1b4da,
+    0xfeb115a6, 0xfeb19c97, 0xfeb0ee9a, 0xfeb17c1c, 0xfeb14a4f, 0xfeb0c79f, 0xfeb14ae0, 0xfeb0a8b1,
+    0xfeb125ab, 0xfeb0b9ef, 0xfeb0ea84, 0xfeb0f488, 0xfeb0c93c, 0xfeb09e67, 0xfeb0a936, 0xfeb047d0,
+    0xfeb046bd, 0xfeb07ad2, 0xfeb05b27, 0xfeb075ae, 0xfeb05992, 0xfeb0474d, 0xfeafd99f, 0xfeafa128,
+    0xfeb02137, 0xfeb0085a, 0xfeafc68f, 0xfeafd173, 0xfeafcafb, 0xfeafa9e4, 0xfeafb785, 0xfeafa7c0,
+    0xfeaf8a1b, 0xfeaf93fc, 0xfeaee0e5, 0xfeaef453, 0xfeaf498b, 0xfeaf1751, 0xfeaf0728, 0xfeaed176,
+    0xfeaf095f, 0xfeaf0775, 0xfeaee8e9, 0xfeaeb4cd, 0xfeaed6f2, 0xfeae83da, 0xfeaeaa0a, 0xfeaeb51f,
+    0xfeae8a2a, 0xfeae8934, 0xfeae022f, 0xfeae3760, 0xfeae3841, 0xfeae53b2, 0xfeae38ac, 0xfeae1b30,
+    0xfeadf912, 0xfeade96c, 0xfeadc660, 0xfead88cb, 0xfeadb966, 0xfeadc80c, 0xfeada9e2, 0xfeadb363,
+    0xfead62e9, 0xfead692d, 0xfead6a04, 0xfead4918, 0xfead48f4, 0xfeacc94e, 0xfead17b8, 0xfead284e,
+    0xfead0855, 0xfeacf890, 0xfeac8d6a, 0xfeacb048, 0xfeaceb71, 0xfeac355d, 0xfeaca955, 0xfeac897c,
+    0xfeac78b3, 0xfeac9407, 0xfeac781b, 0xfeac5826, 0xfeac5964, 0xfeac47ae, 0xfeac1948, 0xfeac3ace,
+    0xfeac0abd, 0xfeab85c0, 0xfeabef0c, 0xfeabda2d, 0xfeabd93c, 0xfeabdb43, 0xfeab869e, 0xfeabb5b5,
+    0xfeab9905, 0xfeab920a, 0xfeab8cb6, 0xfeab69b2, 0xfeab663c, 0xfeab3b23, 0xfeaaf1e3, 0xfeab2a39,
+    0xfeab2d57, 0xfeaaeb2d, 0xfeaaac8c, 0xfeaafbeb, 0xfeaaca91, 0xfeaa48c9, 0xfeaa9a11, 0xfeaa772f,
+    0xfeaaa605, 0xfeaa7b9d, 0xfeaa6b74, 0xfeaa698f, 0xfeaa6350, 0xfeaa5c79, 0xfeaa2a69, 0xfea9af6a,
+    0xfea9fca1, 0xfea9e996, 0xfea9ecb8, 0xfea9ca3a, 0xfea9a77e, 0xfea9c9f1, 0xfea94f58, 0xfea9a106,
+    0xfea98bb3, 0xfea8f7d7, 0xfea9472b, 0xfea9380c, 0xfea9084b, 0xfea91750, 0xfea92b51, 0xfea9286d,
+    0xfea90a07, 0xfea8d7aa, 0xfea8c6b7, 0xfea8f55e, 0xfea88661, 0xfea8c95a, 0xfea8885b, 0xfea8205e,
+    0xfea89a62, 0xfea8691a, 0xfea826ad, 0xfea86acb, 0xfea81492, 0xfea8178b, 0xfea7f512, 0xfea7ca4f,
+    0xfea7d4de, 0xfea7d629, 0xfea7a54c, 0xfea7ca60, 0xfea7c93c, 0xfea7347b, 0xfea7b7f9, 0xfea754cb,
+    0xfea76734, 0xfea78964, 0xfea747c0, 0xfea75b86, 0xfea759a3, 0xfea6e78d, 0xfea707a8, 0xfea70973,
+    0xfea6c635, 0xfea6d563, 0xfea6c6e8, 0xfea6a4e4, 0xfea6c947, 0xfea6767a, 0xfea65963, 0xfea68981,
+    0xfea63875, 0xfea65677, 0xfea624e1, 0xfea62509, 0xfea64b06, 0xfea5f4c1, 0xfea5e5cf, 0xfea62970,
+    0xfea5d466, 0xfea5e8b2, 0xfea5b3e1, 0xfea5a0bd, 0xfea58881, 0xfea57676, 0xfea55a33, 0xfea563f7,
+    0xfea51aad, 0xfea544de, 0xfea4f811, 0xfea515fd, 0xfea4e03c, 0xfea4f105, 0xfea50741, 0xfea50854,
+    0xfea4d486, 0xfea4d514, 0xfea47c4f, 0xfea49756, 0xfea4a67a, 0xfea483da, 0xfea45ac3, 0xfea4a9ce,
+    0xfea454b2, 0xfea42ae8, 0xfea45928, 0xfea448f3, 0xfea42726, 0xfea42900, 0xfea429d8, 0xfea3d84b,
+    0xfea3d4be, 0xfea3c5df, 0xfea3a6ba, 0xfea3d9c8, 0xfea3d997, 0xfea3d3a8, 0xfea367c2, 0xfea36508,
+    0xfea379c2, 0xfea35827, 0xfea36c3a, 0xfea35be4, 0xfea2e928, 0xfea33b4e, 0xfea2effd, 0xfea2e574,
+    0xfea2d4fc, 0xfea2e9db, 0xfea2c810, 0xfea25757, 0xfea2b98a, 0xfea2787d, 0xfea2881d, 0xfea28a31,
+    0xfea2559e, 0xfea27a1d, 0xfea1ff54, 0xfea259ef, 0xfea2137e, 0xfea1f5eb, 0xfea1bcdb, 0xfea20a81,
+    0xfea1e7d3, 0xfea1fbeb, 0xfea1b461, 0xfea1b703, 0xfea1ca63, 0xfea1b9da, 0xfea16616, 0xfea19b6c,
+    0xfea12e0b, 0xfea16a23, 0xfea1106c, 0xfea125ab, 0xfea0c04f, 0xfea1498b, 0xfea10680, 0xfea0f6cb,
+    0xfea0d497, 0xfea0d828, 0xfea0d8eb, 0xfea0e1f1, 0xfea09600, 0xfea0aaa3, 0xfea0c53f, 0xfea077f9,
+    0xfea066b4, 0xfea06a87, 0xfea027f3, 0xfea074cd, 0xfea04b4e, 0xfea03a92, 0xfea02c1d, 0xfea00975,
+    0xfea01a05, 0xfe9fe91c, 0xfe9fb544, 0xfe9fea1d, 0xfe9fda42, 0xfe9f9928, 0xfe9fba59, 0xfe9f77c0,
+    0xfe9f564b, 0xfe9f7d08, 0xfe9f27c1, 0xfe9f192b, 0xfe9f5a5d, 0xfe9f1774, 0xfe9f2beb, 0xfe9f08e0,
+    0xfe9ee6f1, 0xfe9f1928, 0xfe9ef7b9, 0xfe9ee8be, 0xfe9eb9e7, 0xfe9e85e9, 0xfe9e99d0, 0xfe9e9bd1,
+    0xfe9e487f, 0xfe9e7ba2, 0xfe9e59da, 0xfe9e38e8, 0xfe9e3a49, 0xfe9e03bd, 0xfe9dda9f, 0xfe9e0a6f,
+    0xfe9dc818, 0xfe9db745, 0xfe9ddb47, 0xfe9db744, 0xfe9da5ae, 0xfe9d8615, 0xfe9d7301, 0xfe9d9bb4,
+    0xfe9d6824, 0xfe9d8973, 0xfe9d27a0, 0xfe9d09ef, 0xfe9d4a17, 0xfe9d29bc, 0xfe9d0889, 0xfe9d0a76,
+    0xfe9cac93, 0xfe9cc6f7, 0xfe9cb62a, 0xfe9c7c4b, 0xfe9c6e8f, 0xfe9c856c, 0xfe9c6813, 0xfe9c8950,
+    0xfe9c565d, 0xfe9bff3a, 0xfe9c76c2, 0xfe9c16cc, 0xfe9c151a, 0xfe9c3a99, 0xfe9bdab5, 0xfe9c1be2,
+    0xfe9c0b4c, 0xfe9ba964, 0xfe9bc869, 0xfe9bd981, 0xfe9ba72b, 0xfe9b8b00, 0xfe9b7619, 0xfe9b5885,
+    0xfe9b68a4, 0xfe9b56de, 0xfe9b286f, 0xfe9b24eb, 0xfe9b07ba, 0xfe9aeef6, 0xfe9b03a4, 0xfe9a9c65,
+    0xfe9ae917, 0xfe9a9c7c, 0xfe9ab53a, 0xfe9ae857, 0xfe9a6781, 0xfe9a9895, 0xfe9a673a, 0xfe9a6558,
+    0xfe9a484d, 0xfe9a4555, 0xfe9a478d, 0xfe9a26d4, 0xfe9a07a6, 0xfe9a1849, 0xfe99da7f, 0xfe99ca1f,
+    0xfe998829, 0xfe99a9fd, 0xfe99b692, 0xfe99b8a5, 0xfe997b6f, 0xfe99a910, 0xfe9974ef, 0xfe993e35,
+    0xfe997b7f, 0xfe9946ea, 0xfe991984, 0xfe994b9f, 0xfe98ede9, 0xfe98eab6, 0xfe9918d7, 0xfe98f8c7,
+    0xfe98e8b6, 0xfe98bc25, 0xfe987e4e, 0xfe987f66, 0xfe986e77, 0xfe9878b7, 0xfe984dac, 0xfe984afb,
+    0xfe9856b0, 0xfe986b4c, 0xfe97ff23, 0xfe97e039, 0xfe97facf, 0xfe97ebf1, 0xfe9807b3, 0xfe97c8ed,
+    0xfe979134, 0xfe97ea22, 0xfe97a72a, 0xfe97a676, 0xfe9787ae, 0xfe9784f8, 0xfe979be3, 0xfe9749b1,
+    0xfe972e6f, 0xfe97006e, 0xfe96f755, 0xfe9727c2, 0xfe971630, 0xfe96dcee, 0xfe96cd4b, 0xfe96bdd9,
+    0xfe969024, 0xfe969e5a, 0xfe967e76, 0xfe966f86, 0xfe9668bf, 0xfe96783c, 0xfe963c88, 0xfe96586a,
+    0xfe964626, 0xfe963641, 0xfe96002d, 0xfe9616f7, 0xfe95ee8c, 0xfe95d124, 0xfe95da44, 0xfe959b15,
+    0xfe958d85, 0xfe95c68c, 0xfe957fab, 0xfe9566df, 0xfe954f62, 0xfe95300c, 0xfe953ffb, 0xfe9549eb,
+    0xfe950f83, 0xfe95106e, 0xfe94ee2a, 0xfe94e69d, 0xfe94f8f7, 0xfe94c78f, 0xfe94b00a, 0xfe94d6af,
+    0xfe9484bc, 0xfe94a7df, 0xfe948ca3, 0xfe94575a, 0xfe945ed1, 0xfe944f36, 0xfe9421e7, 0xfe943055,
+    0xfe9420b5, 0xfe93f555, 0xfe93f020, 0xfe93d7ae, 0xfe93c2ad, 0xfe93bc61, 0xfe93aef0, 0xfe939994,
+    0xfe939f32, 0xfe937b6c, 0xfe9399c4, 0xfe937aee, 0xfe935d91, 0xfe93507f, 0xfe932cda, 0xfe9325b9,
+    0xfe931f81, 0xfe930f8b, 0xfe92f6b2, 0xfe92dcf4, 0xfe92cfe9, 0xfe92ea06, 0xfe92c100, 0xfe92b0ef,
+    0xfe929032, 0xfe9276ee, 0xfe926bb4, 0xfe927dfb, 0xfe924f3c, 0xfe92501a, 0xfe924e36, 0xfe923b34,
+    0xfe922c63, 0xfe920023, 0xfe91f667, 0xfe91edd8, 0xfe91e1b8, 0xfe920543, 0xfe91d9bb, 0xfe91a0ce,
+    0xfe91b622, 0xfe91a909, 0xfe918d54, 0xfe918ae1, 0xfe916df4, 0xfe915f09, 0xfe9133ae, 0xfe9131b1,
+    0xfe910f87, 0xfe9144f3, 0xfe9126ee, 0xfe91166f, 0xfe90edb0, 0xfe90eaeb, 0xfe90da0f, 0xfe90bf1c,
+    0xfe90d527, 0xfe90e8a9, 0xfe908d68, 0xfe90b7a7, 0xfe90a631, 0xfe90509f, 0xfe90751c, 0xfe9087a4,
+    0xfe908a25, 0xfe905850, 0xfe90262f, 0xfe90193a, 0xfe901643, 0xfe900649, 0xfe8fe930, 0xfe8ff89c,
+    0xfe8ff8f2, 0xfe8fc680, 0xfe8f9974, 0xfe8f9798, 0xfe8fa827, 0xfe8f9968, 0xfe8f9763, 0xfe8f998f,
+    0xfe8f6714, 0xfe8f3f5e, 0xfe8f34c3, 0xfe8f59d5, 0xfe8f099a, 0xfe8f2a62, 0xfe8f380b, 0xfe8ef999,
+    0xfe8ee8ed, 0xfe8eaa79, 0xfe8ea777, 0xfe8edc02, 0xfe8e8963, 0xfe8e7989, 0xfe8eab26, 0xfe8e77d0,
+    0xfe8e5659, 0xfe8e68a6, 0xfe8e48da, 0xfe8e39ef, 0xfe8e3b69, 0xfe8e0475, 0xfe8de578, 0xfe8e28a5,
+    0xfe8de8f4, 0xfe8e0833, 0xfe8df730, 0xfe8db8b5, 0xfe8dd9d3, 0xfe8da8eb, 0xfe8dac52, 0xfe8d78d0,
+    0xfe8d53f3, 0xfe8d896c, 0xfe8d69c5, 0xfe8d3899, 0xfe8ceaa3, 0xfe8d1862, 0xfe8ce831, 0xfe8d0a1f,
+    0xfe8cd762, 0xfe8cd9be, 0xfe8cf882, 0xfe8ca6c2, 0xfe8ca9fd, 0xfe8cc999, 0xfe8c7793, 0xfe8c9866,
+    0xfe8c78a3, 0xfe8c5747, 0xfe8c17e0, 0xfe8c6699, 0xfe8c4b0d, 0xfe8c1a36, 0xfe8c09d5, 0xfe8c1939,
+    0xfe8c1886, 0xfe8b9adc, 0xfe8bf6a5, 0xfe8bcb3f, 0xfe8b8a5a, 0xfe8b9a5c, 0xfe8b5d69, 0xfe8b668a,
+    0xfe8b9912, 0xfe8b46c2, 0xfe8b5859, 0xfe8b3975, 0xfe8b37f9, 0xfe8b57b3, 0xfe8b0864, 0xfe8ac7e2,
+    0xfe8afa83, 0xfe8ae731, 0xfe8aa93a, 0xfe8ac7c8, 0xfe8aa955, 0xfe8a3cda, 0xfe8a95f3, 0xfe8a3bbe,
+    0xfe8a9917, 0xfe8a368b, 0xfe8a116a, 0xfe8a5875, 0xfe8a27f4, 0xfe8a395a, 0xfe8a4199, 0xfe8a08e4,
+    0xfe8a1643, 0xfe89e838, 0xfe899790, 0xfe89f8da, 0xfe89cb90, 0xfe89412f, 0xfe893733, 0xfe89a82a,
+    0xfe89afc5, 0xfe896056, 0xfe894f55, 0xfe88f917, 0xfe88df78, 0xfe895c78, 0xfe893a58, 0xfe890b6f,
+    0xfe890d33, 0xfe88e355, 0xfe890ca2, 0xfe88b649, 0xfe88da00, 0xfe88bbcf, 0xfe8841b1, 0xfe88b836,
+    0xfe8876ad, 0xfe87fafa, 0xfe888ec0, 0xfe8801ad, 0xfe886a42, 0xfe885c4d, 0xfe880d32, 0xfe883e3f,
+    0xfe87b3b3, 0xfe87eac1, 0xfe880c49, 0xfe87fcdf, 0xfe87ae30, 0xfe87dbee, 0xfe87c4fa, 0xfe874865,
+    0xfe87a522, 0xfe879bad, 0xfe877897, 0xfe8779fa, 0xfe86d8ba, 0xfe871828, 0xfe86b740, 0xfe873d7c,
+    0xfe872a31, 0xfe867766, 0xfe870c1d, 0xfe8677c6, 0xfe8649b6, 0xfe867ccd, 0xfe86d082, 0xfe864e4d,
+    0xfe86a409, 0xfe869b73, 0xfe864c0e, 0xfe866bef, 0xfe86157b, 0xfe865603, 0xfe863ad4, 0xfe85d818,
+    0xfe85c076, 0xfe861a7d, 0xfe860c3c, 0xfe85cb36, 0xfe856e71, 0xfe85d573, 0xfe85acfc, 0xfe8549bf,
+    0xfe850876, 0xfe859c4e, 0xfe853516, 0xfe85580c, 0xfe850d96, 0xfe8523cc, 0xfe84a672, 0xfe852b3b,
+    0xfe85255a, 0xfe851a70, 0xfe84fa6f, 0xfe84ffae, 0xfe845890, 0xfe84402d, 0xfe84ba79, 0xfe849b9a,
+    0xfe8497bf, 0xfe8489b3, 0xfe842bcb, 0xfe847ea6, 0xfe8435d8, 0xfe845c4c, 0xfe8447f4, 0xfe8431e9,
+    0xfe84186c, 0xfe83cc39, 0xfe8371c5, 0xfe83e9ba, 0xfe837c80, 0xfe83bda9, 0xfe834733, 0xfe839257,
+    0xfe83a0bd, 0xfe839369, 0xfe82e64f, 0xfe8359f9, 0xfe833d08, 0xfe8345ed, 0xfe831b00, 0xfe82e8c6,
+    0xfe832a21, 0xfe831ad8, 0xfe82f903, 0xfe82e6d2, 0xfe8252b1, 0xfe82dd44, 0xfe82284c, 0xfe82758b,
+    0xfe82ac80, 0xfe821aa2, 0xfe828c43, 0xfe81d18e, 0xfe81c260, 0xfe81f683, 0xfe820597, 0xfe821c96,
+    0xfe821b21, 0xfe81c163, 0xfe81ec11, 0xfe81fc3c, 0xfe81cbed, 0xfe81cb21, 0xfe819cdd, 0xfe81b1f9,
+    0xfe81a2b2, 0xfe810c86, 0xfe816b72, 0xfe813993, 0xfe8122fb, 0xfe811294, 0xfe80b130, 0xfe813644,
+    0xfe813381, 0xfe80b82c, 0xfe80d5bd, 0xfe8069f5, 0xfe80cbbe, 0xfe80498d, 0xfe804e6b, 0xfe809c7b,
+    0xfe809a43, 0xfe7ff038, 0xfe807a62, 0xfe8069c0, 0xfe8047bf, 0xfe80541e, 0xfe7fab11, 0xfe7fab97,
+    0xfe7fc4c4, 0xfe7fdba5, 0xfe7f6cd5, 0xfe7f7dd4, 0xfe7fe433, 0xfe7fd48e, 0xfe7f43fa, 0xfe7f1cef,
+    0xfe7f9a02, 0xfe7f2a01, 0xfe7efc83, 0xfe7f7c13, 0xfe7efa40, 0xfe7f3cf8, 0xfe7f3b67, 0xfe7e9e25,
+    0xfe7f1a83, 0xfe7f140c, 0xfe7e6f5e, 0xfe7edc2d, 0xfe7e49b3, 0xfe7eca1d, 0xfe7eb93a, 0xfe7e26da,
+    0xfe7e64a7, 0xfe7df007, 0xfe7e01ab, 0xfe7e5c09, 0xfe7dd006, 0xfe7e580e, 0xfe7dae25, 0xfe7da01b,
+    0xfe7e286c, 0xfe7d72a8, 0xfe7dfbfd, 0xfe7ddde9, 0xfe7da923, 0xfe7d5ff2, 0xfe7dca1e, 0xfe7db2e3,
+    0xfe7d3135, 0xfe7d0d8c, 0xfe7d1a0a, 0xfe7d6aac, 0xfe7d6175, 0xfe7d59d1, 0xfe7cb01b, 0xfe7d3244,
+    0xfe7ce970, 0xfe7d0fa1, 0xfe7d08a4, 0xfe7c707b, 0xfe7c468b, 0xfe7c45b5, 0xfe7ccaa1, 0xfe7cb4f5,
+    0xfe7c9e25, 0xfe7c8aa7, 0xfe7c7a4d, 0xfe7c3897, 0xfe7bdfbf, 0xfe7bdc5e, 0xfe7c2baf, 0xfe7c1c72,
+    0xfe7c0c93, 0xfe7c160f, 0xfe7b6eee, 0xfe7bfd90, 0xfe7be308, 0xfe7b36e9, 0xfe7bc296, 0xfe7bbf17,
+    0xfe7b2d2b, 0xfe7b94a0, 0xfe7b9162, 0xfe7b7c93, 0xfe7b1664, 0xfe7b5bc5, 0xfe7ab662, 0xfe7b3d31,
+    0xfe7a9f03, 0xfe7b149e, 0xfe7a8c9d, 0xfe7b0022, 0xfe7ae3f3, 0xfe7a37e0, 0xfe7a4279, 0xfe7ab6a1,
+    0xfe7a2bd5, 0xfe7a3b13, 0xfe7a5b87, 0xfe79fbaf, 0xfe7a5945, 0xfe79e644, 0xfe7a0421, 0xfe7a3b6e,
+    0xfe79a204, 0xfe79d7a3, 0xfe79c46b, 0xfe79994a, 0xfe79ed72, 0xfe79649c, 0xfe7987eb, 0xfe7987f4,
+    0xfe795f9d, 0xfe78f860, 0xfe7948de, 0xfe79131a, 0xfe78ed68, 0xfe795dc3, 0xfe78fc7f, 0xfe793442,
+    0xfe79303b, 0xfe78e7f6, 0xfe790dd7, 0xfe788cab, 0xfe787635, 0xfe78639a, 0xfe78d1b3, 0xfe78ba0a,
+    0xfe783a9e, 0xfe78a1fb, 0xfe7809a3, 0xfe7825cf, 0xfe780f8b, 0xfe7802b1, 0xfe77a4dd, 0xfe7841a4,
+    0xfe7826ba, 0xfe782090, 0xfe77afb3, 0xfe77fd5d, 0xfe77994b, 0xfe778ba8, 0xfe77cfb6, 0xfe775d34,
+    0xfe77ae70, 0xfe76feeb, 0xfe773291, 0xfe771f6a, 0xfe7716ab, 0xfe775e6f, 0xfe76aad7, 0xfe76ae1e,
+    0xfe768f8b, 0xfe767cd5, 0xfe770dab, 0xfe769b44, 0xfe76f17e, 0xfe76dcad, 0xfe76ad3a, 0xfe761028,
+    0xfe76b1dc, 0xfe76051b, 0xfe75fff6, 0xfe760b65, 0xfe7613ef, 0xfe7602e6, 0xfe75ec63, 0xfe75bd1e,
+    0xfe75c196, 0xfe75ea91, 0xfe756986, 0xfe756ff7, 0xfe759a3e, 0xfe754d7d, 0xfe75b248, 0xfe752fce,
+    0xfe75b179, 0xfe7511b2, 0xfe75125c, 0xfe7550fb, 0xfe756d78, 0xfe75654a, 0xfe754f67, 0xfe74bff2,
+    0xfe750a87, 0xfe74c7e5, 0xfe74c6d6, 0xfe749b40, 0xfe747898, 0xfe7454a8, 0xfe748744, 0xfe744055,
+    0xfe74a7b9, 0xfe745897, 0xfe743dcc, 0xfe740908, 0xfe7473d1, 0xfe741028, 0xfe740a6b, 0xfe73e557,
+    0xfe73f20b, 0xfe73f0a5, 0xfe7405b1, 0xfe740397, 0xfe73e51d, 0xfe736e2e, 0xfe734093, 0xfe73bea6,
+    0xfe7301b6, 0xfe739c46, 0xfe738de6, 0xfe734188, 0xfe7364ea, 0xfe72e342, 0xfe735295, 0xfe7335dd,
+    0xfe7286de, 0xfe72de5d, 0xfe726060, 0xfe72593d, 0xfe72e177, 0xfe725443, 0xfe724f4a, 0xfe729844,
+    0xfe72ad9d, 0xfe725317, 0xfe72358a, 0xfe7253fb, 0xfe72503d, 0xfe71e950, 0xfe725221, 0xfe7199fa,
+    0xfe722d1f, 0xfe7223b4, 0xfe71ee09, 0xfe71ad32, 0xfe7152be, 0xfe71de00, 0xfe71d23b, 0xfe711887,
+    0xfe717960, 0xfe7178e7, 0xfe71259c, 0xfe717d34, 0xfe710d4d, 0xfe716316, 0xfe715053, 0xfe709d9e,
+    0xfe70da3e, 0xfe70a929, 0xfe710bf8, 0xfe70fc9d, 0xfe70f0fc, 0xfe70d526, 0xfe70d059, 0xfe70987e,
+    0xfe703b8a, 0xfe705964, 0xfe708e1b, 0xfe703641, 0xfe7064ef, 0xfe706280, 0xfe700518, 0xfe704107,
+    0xfe7033ba, 0xfe702029, 0xfe700f5c, 0xfe6faf1e, 0xfe6fce18, 0xfe6fe0cd, 0xfe6fd12b, 0xfe6f86bc,
+    0xfe6facb0, 0xfe6f9c68, 0xfe6f8c5a, 0xfe6f0273, 0xfe6f3950, 0xfe6f5f1c, 0xfe6f39b3, 0xfe6f3fda,
+    0xfe6f2e49, 0xfe6f1e1f, 0xfe6ee06f, 0xfe6efe49, 0xfe6e5612, 0xfe6e7de8, 0xfe6ecef3, 0xfe6ebccb,
+    0xfe6eadf9, 0xfe6e512a, 0xfe6e9360, 0xfe6e464f, 0xfe6dc871, 0xfe6e6169, 0xfe6ded24, 0xfe6d920f,
+    0xfe6e2c5e, 0xfe6e2044, 0xfe6dec2d, 0xfe6dfa94, 0xfe6d9fea, 0xfe6d7c04, 0xfe6db38a, 0xfe6d653a,
+    0xfe6d3c05, 0xfe6d9e29, 0xfe6d6acb, 0xfe6d02fe, 0xfe6cedd9, 0xfe6d5f8a, 0xfe6cfa0b, 0xfe6caf54,
+    0xfe6ce453, 0xfe6d220a, 0xfe6cc254, 0xfe6d005b, 0xfe6cc2ab, 0xfe6c3829, 0xfe6c8935, 0xfe6cbd35,
+    0xfe6c2ef8, 0xfe6c504b, 0xfe6c2757, 0xfe6c8048, 0xfe6c6e48, 0xfe6bc0c3, 0xfe6c00cb, 0xfe6c3ec6,
+    0xfe6bf4fc, 0xfe6ba85d, 0xfe6b6bb9, 0xfe6ba4ff, 0xfe6b70e5, 0xfe6b30b4, 0xfe6bcdb7, 0xfe6b5c2f,
+    0xfe6b2f66, 0xfe6b98a5, 0xfe6b914b, 0xfe6b255e, 0xfe6b43a7, 0xfe6b4c4c, 0xfe6add8f, 0xfe6aa34d,
+    0xfe6ad035, 0xfe6afdb8, 0xfe6b0d90, 0xfe6aa677, 0xfe6af18a, 0xfe6ab3ad, 0xfe6a47f5, 0xfe6a22c1,
+    0xfe6a3275, 0xfe6a04fc, 0xfe6a43bf, 0xfe6a4104, 0xfe69ea43, 0xfe6a064b, 0xfe6a1381, 0xfe69a755,
+    0xfe69ea1f, 0xfe69e930, 0xfe6a14fe, 0xfe69875c, 0xfe69f460, 0xfe69a3e7, 0xfe699de9, 0xfe69472c,
+    0xfe695c03, 0xfe696ad8, 0xfe696bfc, 0xfe692216, 0xfe6971bd, 0xfe68ff64, 0xfe68db07, 0xfe693b70,
+    0xfe68e9f1, 0xfe6923f3, 0xfe6913c9, 0xfe68e86f, 0xfe68f10f, 0xfe68dcc2, 0xfe68ccfa, 0xfe6858f6,
+    0xfe680527, 0xfe689bec, 0xfe688cdd, 0xfe688133, 0xfe6834cb, 0xfe685bac, 0xfe67e93b, 0xfe6806da,
+    0xfe67a7c1, 0xfe6820e3, 0xfe67a656, 0xfe67fbf5, 0xfe6784f7, 0xfe67db97, 0xfe6757be, 0xfe676ebe,
+    0xfe679989, 0xfe679ca0, 0xfe6783d7, 0xfe677629, 0xfe675ba7, 0xfe675bbb, 0xfe674dd0, 0xfe6692ce,
+    0xfe672a2e, 0xfe66fb74, 0xfe670b61, 0xfe668bb3, 0xfe66ebbd, 0xfe66dc07, 0xfe66cc39, 0xfe668b9c,
+    0xfe6631c8, 0xfe669a2f, 0xfe669092, 0xfe667db5, 0xfe6612cd, 0xfe660616, 0xfe661eb5, 0xfe663d5c,
+    0xfe65fefd, 0xfe65b8b7, 0xfe660c76, 0xfe65fe18, 0xfe655895, 0xfe65de37, 0xfe653d17, 0xfe655978,
+    0xfe65adff, 0xfe65960d, 0xfe64e1b6, 0xfe6523a4, 0xfe6528a4, 0xfe64cea8, 0xfe654ace, 0xfe64a667,
+    0xfe6524da, 0xfe648aac, 0xfe64c5ec, 0xfe649a4c, 0xfe64f05e, 0xfe64e065, 0xfe64c9ae, 0xfe647053,
+    0xfe64aafe, 0xfe649541, 0xfe6468e5, 0xfe64815b, 0xfe646685, 0xfe640ad9, 0xfe63be76, 0xfe63c3b9,
+    0xfe643281, 0xfe639db0, 0xfe6405bd, 0xfe63fd3d, 0xfe634829, 0xfe63e1cc, 0xfe6349b5, 0xfe6366e7,
+    0xfe63a77a, 0xfe633670, 0xfe6303d3, 0xfe636388, 0xfe637129, 0xfe634a2a, 0xfe62a085, 0xfe62be5b,
+    0xfe63321f, 0xfe629f67, 0xfe630dae, 0xfe6301b3, 0xfe62cbf2, 0xfe62d500, 0xfe627680, 0xfe62bc23,
+    0xfe624590, 0xfe622bf1, 0xfe628ecf, 0xfe6282f1, 0xfe627171, 0xfe624670, 0xfe624663, 0xfe623d05,
+    0xfe618c24, 0xfe618e19, 0xfe61c7b3, 0xfe61aef9, 0xfe61f13f, 0xfe61aaa2, 0xfe614e70, 0xfe6177ed,
+    0xfe619b70, 0xfe618b76, 0xfe617bde, 0xfe616beb, 0xfe616cf8, 0xfe60bb19, 0xfe614aba, 0xfe609beb,
+    0xfe60beeb, 0xfe60907f, 0xfe60a067, 0xfe60fcc0, 0xfe60ebe2, 0xfe607fcf, 0xfe603e76, 0xfe60ba70,
+    0xfe608a93, 0xfe60a1f2, 0xfe5fe5ec, 0xfe607c79, 0xfe606cec, 0xfe603cb6, 0xfe603b93, 0xfe60349e,
+    0xfe601a90, 0xfe6014a9, 0xfe5f6f63, 0xfe5fe979, 0xfe5fc927, 0xfe5fc9a6, 0xfe5fba90, 0xfe5f26df,
+    0xfe5f9a90, 0xfe5f946d, 0xfe5f18f8, 0xfe5edc33, 0xfe5f6439, 0xfe5eb654, 0xfe5f2aec, 0xfe5f3530,
+    0xfe5efc57, 0xfe5f0a8a, 0xfe5f05b7, 0xfe5e5877, 0xfe5ebc25, 0xfe5ee013, 0xfe5e4b8f, 0xfe5ea9db,
+    0xfe5e9ae0, 0xfe5e1754, 0xfe5e85a3, 0xfe5e5b3f, 0xfe5e617a, 0xfe5e26e5, 0xfe5e3b53, 0xfe5e34fe,
+    0xfe5e1683, 0xfe5e094c, 0xfe5e0a1c, 0xfe5db27b, 0xfe5decc1, 0xfe5dbc9f, 0xfe5dcd4e, 0xfe5dbc9a,
+    0xfe5d9a44, 0xfe5d2743, 0xfe5d6b38, 0xfe5d6bf6, 0xfe5d2657, 0xfe5cf6a0, 0xfe5d2c02, 0xfe5ca57c,
+    0xfe5c8179, 0xfe5cdadb, 0xfe5cf864, 0xfe5cdbbb, 0xfe5cbb99, 0xfe5cdab7, 0xfe5c2b8e, 0xfe5cb479,
+    0xfe5ca42a, 0xfe5c8941, 0xfe5c9070, 0xfe5c7c24, 0xfe5c4b71, 0xfe5c5700, 0xfe5c04e2, 0xfe5c3c4c,
+    0xfe5c25b0, 0xfe5c0b9d, 0xfe5c0d2f, 0xfe5b82b5, 0xfe5be3dc, 0xfe5bdc2d, 0xfe5bb9b1, 0xfe5bac51,
+    0xfe5ba670, 0xfe5af660, 0xfe5b5cd9, 0xfe5b816e, 0xfe5acea5, 0xfe5b5abb, 0xfe5add31, 0xfe5b3e86,
+    0xfe5b197b, 0xfe5ad600, 0xfe5a9c13, 0xfe5a95b3, 0xfe5ae806, 0xfe5aa81f, 0xfe5acc85, 0xfe5abc52,
+    0xfe5a7002, 0xfe5a9bba, 0xfe5a85c2, 0xfe5a7dae, 0xfe5a65e9, 0xfe5a3c99, 0xfe5a45dc, 0xfe5a2ab9,
+    0xfe598c24, 0xfe5a1c0e, 0xfe59f9ac, 0xfe59fe14, 0xfe59d8b6, 0xfe59b417, 0xfe59913c, 0xfe59b451,
+    0xfe594311, 0xfe599c22, 0xfe598417, 0xfe58d83d, 0xfe58db80, 0xfe59553c, 0xfe5951a6, 0xfe593582,
+    0xfe590f0e, 0xfe592243, 0xfe58fa18, 0xfe58ec84, 0xfe58aab1, 0xfe58cb36, 0xfe58c51c, 0xfe58be2c,
+    0xfe58a33b, 0xfe589e87, 0xfe588cb2, 0xfe587d6a, 0xfe57d1eb, 0xfe57b21c, 0xfe57e929, 0xfe57b0fc,
+    0xfe57b6ec, 0xfe57f4d3, 0xfe581354, 0xfe577c90, 0xfe57f241, 0xfe57d6a2, 0xfe57ce50, 0xfe57a1c4,
+    0xfe57ad45, 0xfe57958b, 0xfe5790ec, 0xfe572738, 0xfe576bca, 0xfe575eca, 0xfe574472, 0xfe56b89f,
+    0xfe5731fd, 0xfe56d2dd, 0xfe570de8, 0xfe5675d8, 0xfe566762, 0xfe5644f9, 0xfe56d071, 0xfe567918,
+    0xfe56b158, 0xfe56804b, 0xfe56861f, 0xfe566a7c, 0xfe5666af, 0xfe55f887, 0xfe564e03, 0xfe56363d,
+    0xfe56258b, 0xfe561afc, 0xfe55db1e, 0xfe55fc7d, 0xfe55ec37, 0xfe55dd4a, 0xfe55c530, 0xfe555ce7,
+    0xfe55a534, 0xfe559bf2, 0xfe5503ec, 0xfe557e3d, 0xfe556c87, 0xfe555fc1, 0xfe553ad9, 0xfe54c47a,
+    0xfe54eb26, 0xfe550bb2, 0xfe5505f6, 0xfe54fcf6, 0xfe54db5d, 0xfe54de6d, 0xfe54c44c, 0xfe549c86,
+    0xfe5409a5, 0xfe548ad3, 0xfe53edd3, 0xfe54758c, 0xfe544bca, 0xfe53cebe, 0xfe53fd88, 0xfe543389,
+    0xfe538ff8, 0xfe537641, 0xfe536e17, 0xfe53600d, 0xfe53ad9a, 0xfe53329a, 0xfe537c47, 0xfe53ae58,
+    0xfe534512, 0xfe530f1f, 0xfe538c98, 0xfe53165c, 0xfe535b8e, 0xfe534900, 0xfe53394a, 0xfe531bcb,
+    0xfe52e94f, 0xfe531cd1, 0xfe52ecb0, 0xfe52579b, 0xfe52e42e, 0xfe52a7e6, 0xfe52cd0c, 0xfe521981,
+    0xfe520cc8, 0xfe529621, 0xfe525bd6, 0xfe527cf5, 0xfe5264c7, 0xfe525dc9, 0xfe524625, 0xfe523d47,
+    0xfe52336a, 0xfe521b47, 0xfe51db27, 0xfe51ec43, 0xfe51daa0, 0xfe51d59b, 0xfe51d154, 0xfe51ab95,
+    0xfe517b37, 0xfe519405, 0xfe512758, 0xfe510509, 0xfe516e55, 0xfe515481, 0xfe515156, 0xfe513ca3,
+    0xfe51230f, 0xfe5116f8, 0xfe508523, 0xfe510098, 0xfe50babc, 0xfe50d6d6, 0xfe50cd4a, 0xfe50bd86,
+    0xfe507ad7, 0xfe507d51, 0xfe507c20, 0xfe505d25, 0xfe4fd0ba, 0xfe5049aa, 0xfe50096e, 0xfe503d38,
+    0xfe4f8279, 0xfe4f716a, 0xfe500c65, 0xfe4fe9e3, 0xfe4fdc08, 0xfe4fca6f, 0xfe4fc5cc, 0xfe4fb53a,
+    0xfe4fa424, 0xfe4f9fb3, 0xfe4f8cb7, 0xfe4f74f7, 0xfe4f4b3a, 0xfe4f5622, 0xfe4f3c89, 0xfe4f2bfe,
+    0xfe4f0ce3, 0xfe4eebef, 0xfe4efa6c, 0xfe4eea26, 0xfe4ecaf7, 0xfe4eaba9, 0xfe4e9ba4, 0xfe4e619b,
+    0xfe4e8aa2, 0xfe4e8992, 0xfe4e6bf2, 0xfe4e5ac6, 0xfe4e640d, 0xfe4e5403, 0xfe4e2a4c, 0xfe4e32a2,
+    0xfe4df8b4, 0xfe4de963, 0xfe4e0394, 0xfe4deb36, 0xfe4dbc07, 0xfe4dca89, 0xfe4d4c80, 0xfe4d8b3b,
+    0xfe4d99f9, 0xfe4d68df, 0xfe4d6962, 0xfe4ce336, 0xfe4d2785, 0xfe4d2a9f, 0xfe4d07a1, 0xfe4d2962,
+    0xfe4cfa0a, 0xfe4cd718, 0xfe4ce8e8, 0xfe4ce725, 0xfe4cb92c, 0xfe4cd2b3, 0xfe4c5cb5, 0xfe4c8bad,
+    0xfe4c8bf3, 0xfe4c8a27, 0xfe4c59fd, 0xfe4c6b83, 0xfe4c3c2c, 0xfe4c27e1, 0xfe4c445d, 0xfe4c1be4,
+    0xfe4bfb68, 0xfe4bc674, 0xfe4bc764, 0xfe4bdc38, 0xfe4bcc2a, 0xfe4b60a1, 0xfe4baba8, 0xfe4b6564,
+    0xfe4b8968, 0xfe4b8925, 0xfe4af639, 0xfe4b5c73, 0xfe4b3a74, 0xfe4b51f3, 0xfe4b15d2, 0xfe4b2bc6,
+    0xfe4b1ccb, 0xfe4b0686, 0xfe4b04a0, 0xfe4a6b4b, 0xfe4acd0a, 0xfe4ad48d, 0xfe4aabec, 0xfe4a9c5d,
+    0xfe4a99e9, 0xfe4a944c, 0xfe4a848b, 0xfe4a76fc, 0xfe4a1627, 0xfe4a0770, 0xfe4a464e, 0xfe4a27d2,
+    0xfe4a197e, 0xfe4a156e, 0xfe49eb63, 0xfe496469, 0xfe49e06f, 0xfe494e1b, 0xfe494d7c, 0xfe49141f,
+    0xfe491918, 0xfe499b78, 0xfe49279c, 0xfe497c89, 0xfe496f35, 0xfe496222, 0xfe48e093, 0xfe4935de,
+    0xfe491c67, 0xfe489b18, 0xfe4904ba, 0xfe48ea1d, 0xfe48f1a8, 0xfe48ddf8, 0xfe48d207, 0xfe4876a5,
+    0xfe48a1f4, 0xfe487c59, 0xfe485001, 0xfe482f36, 0xfe487255, 0xfe481cfb, 0xfe47e4c5, 0xfe47f6ea,
+    0xfe479e50, 0xfe479c6a, 0xfe4812ad, 0xfe47fec9, 0xfe47a4dd, 0xfe47d58e, 0xfe47cd2e, 0xfe477fa5,
+    0xfe47aafe, 0xfe476565, 0xfe478eae, 0xfe46e669, 0xfe4743fa, 0xfe475c7b, 0xfe473d4c, 0xfe46a734,
+    0xfe470ffb, 0xfe467af0, 0xfe46701b, 0xfe46cde4, 0xfe46bf8c, 0xfe46838b, 0xfe46bbad, 0xfe4688a3,
+    0xfe46b2fd, 0xfe469e93, 0xfe4637b8, 0xfe46802f, 0xfe45c717, 0xfe46017b, 0xfe464545, 0xfe45faf3,
+    0xfe462df6, 0xfe45d1f5, 0xfe456d7f, 0xfe45d74f, 0xfe45ad52, 0xfe4554d5, 0xfe456da5, 0xfe451db8,
+    0xfe45ab33, 0xfe454cb3, 0xfe456688, 0xfe455bfa, 0xfe4553c8, 0xfe452d7b, 0xfe452069, 0xfe4491bb,
+    0xfe44fa0a, 0xfe4481ef, 0xfe450fa9, 0xfe44e769, 0xfe44f0b1, 0xfe44de82, 0xfe44b805, 0xfe448f0c,
+    0xfe441128, 0xfe44371f, 0xfe444719, 0xfe447c54, 0xfe443d16, 0xfe43b954, 0xfe43cd35, 0xfe43e132,
+    0xfe4382e1, 0xfe441ffc, 0xfe439b3b, 0xfe4369f5, 0xfe43babb, 0xfe4363d0, 0xfe43886f, 0xfe436733,
+    0xfe437acb, 0xfe432d32, 0xfe4391fa, 0xfe42d14c, 0xfe43547d, 0xfe42f612, 0xfe434bfd, 0xfe42d753,
+    0xfe4286c1, 0xfe431b15, 0xfe42d4cc, 0xfe4254d5, 0xfe426698, 0xfe428d40, 0xfe42abec, 0xfe4281de,
+    0xfe422721, 0xfe41f3b6, 0xfe422679, 0xfe421851, 0xfe41d273, 0xfe4261b7, 0xfe41c19a, 0xfe41cd07,
+    0xfe41cb34, 0xfe418dc5, 0xfe41a644, 0xfe4169b7, 0xfe41ad55, 0xfe419aeb, 0xfe412000, 0xfe41141f,
+    0xfe41083a, 0xfe40f000, 0xfe412a95, 0xfe40e57a, 0xfe40c000, 0xfe40f968, 0xfe4100fa, 0xfe409000,
+    0xfe408844, 0xfe4070d3, 0xfe4061a8, 0xfe40eb68, 0xfe404236, 0xfe409294, 0xfe408281, 0xfe40211d,
+    0xfe40b0e8, 0xfe3ffc0c, 0xfe3ff4f4, 0xfe3fe2b3, 0xfe3fc346, 0xfe3fb63c, 0xfe3fa4a5, 0xfe3fa008,
+    0xfe3f911e, 0xfe3f7000, 0xfe3f690d, 0xfe3f5309, 0xfe3f41ed, 0xfe3f3000, 0xfe3f2000, 0xfe3f1000,
+    0xfe3f0bd3, 0xfe3ef797, 0xfe3f34c4, 0xfe3ef89e, 0xfe3eefc4, 0xfe3f02c2, 0xfe3eb0e7, 0xfe3e9796,
+    0xfe3e8295, 0xfe3e7025, 0xfe3e6ed8, 0xfe3e55d4, 0xfe3e4678, 0xfe3e3b01, 0xfe3e59bf, 0xfe3e1253,
+    0xfe3e0e12, 0xfe3e0f3f, 0xfe3e2ed3, 0xfe3dd40c, 0xfe3dc45e, 0xfe3db9a0, 0xfe3e27eb, 0xfe3d91b2,
+    0xfe3daf0e, 0xfe3db07f, 0xfe3da272, 0xfe3d7de1, 0xfe3d4db8, 0xfe3d36d6, 0xfe3daaff, 0xfe3d3de3,
+    0xfe3d6763, 0xfe3d5850, 0xfe3d4101, 0xfe3cd973, 0xfe3cc85f, 0xfe3d00a7, 0xfe3cadce, 0xfe3c963d,
+    0xfe3d326a, 0xfe3c8009, 0xfe3c77c5, 0xfe3cc48a, 0xfe3c6439, 0xfe3ca674, 0xfe3c2def, 0xfe3c8672,
+    0xfe3c2d91, 0xfe3c6d44, 0xfe3c9034, 0xfe3c4514, 0xfe3bfcff, 0xfe3bd0d7, 0xfe3c040e, 0xfe3c06ce,
+    0xfe3b96e9, 0xfe3b7797, 0xfe3bd967, 0xfe3bc73d, 0xfe3b79ef, 0xfe3b3000, 0xfe3b52eb, 0xfe3b4a26,
+    0xfe3b06d7, 0xfe3b33f1, 0xfe3b57b1, 0xfe3ad000, 0xfe3b3d44, 0xfe3b23e6, 0xfe3aa829, 0xfe3b1c3b,
+    0xfe3ac674, 0xfe3ae02a, 0xfe3add60, 0xfe3a51e1, 0xfe3abe79, 0xfe3a59a6, 0xfe3a8905, 0xfe3a24dc,
+    0xfe3a4754, 0xfe3a0298, 0xfe3a6a81, 0xfe39d2f1, 0xfe3a0241, 0xfe3a034c, 0xfe39b103, 0xfe399932,
+    0xfe39ec87, 0xfe397829, 0xfe398f5e, 0xfe399006, 0xfe394000, 0xfe396f2b, 0xfe397abc, 0xfe391b7e,
+    0xfe396a27, 0xfe390ce1, 0xfe396f1c, 0xfe39387e, 0xfe39296a, 0xfe395af9, 0xfe38a275, 0xfe389166,
+    0xfe3890b5, 0xfe38df49, 0xfe38c969, 0xfe3852a7, 0xfe38889f, 0xfe389161, 0xfe387d65, 0xfe38778e,
+    0xfe380ca7, 0xfe3856cc, 0xfe37e443, 0xfe380148, 0xfe37fb17, 0xfe3805e6, 0xfe380750, 0xfe379727,
+    0xfe37f323, 0xfe37757f, 0xfe37aeb3, 0xfe37a3b4, 0xfe379eac, 0xfe378197, 0xfe373634, 0xfe371d7a,
+    0xfe3787a3, 0xfe376610, 0xfe3704d0, 0xfe3719ea, 0xfe372a5d, 0xfe3724c7, 0xfe372bed, 0xfe37095f,
+    0xfe370c59, 0xfe36ded2, 0xfe366ad8, 0xfe36cfe2, 0xfe36c378, 0xfe3683eb, 0xfe3631ea, 0xfe367dc7,
+    0xfe362829, 0xfe365947, 0xfe360c7b, 0xfe360cb0, 0xfe361667, 0xfe35bbd1, 0xfe35e71a, 0xfe362044,
+    0xfe35e780, 0xfe358e16, 0xfe35cf6d, 0xfe35541a, 0xfe357c41, 0xfe35caa6, 0xfe35661e, 0xfe358035,
+    0xfe3519f0, 0xfe34f1f3, 0xfe3528f3, 0xfe35386a, 0xfe35538a, 0xfe34bb5b, 0xfe34dd2d, 0xfe3504a5,
+    0xfe348147, 0xfe34710d, 0xfe346ec1, 0xfe34809d, 0xfe348d0c, 0xfe3436bc, 0xfe3442b5, 0xfe346574,
+    0xfe342d3a, 0xfe33f496, 0xfe33e90f, 0xfe34255f, 0xfe33de4b, 0xfe33b000, 0xfe33d50d, 0xfe339377,
+    0xfe338994, 0xfe33e479, 0xfe33ebb8, 0xfe335259, 0xfe337d02, 0xfe333000, 0xfe333dc0, 0xfe332664,
+    0xfe330000, 0xfe32fcde, 0xfe334855, 0xfe32d414, 0xfe32c41a, 0xfe32b16a, 0xfe32a130, 0xfe32a859,
+    0xfe329575, 0xfe327000, 0xfe33152a, 0xfe32ad87, 0xfe32476f, 0xfe32c015, 0xfe32532f, 0xfe3265da,
+    0xfe3231ad, 0xfe31f000, 0xfe3223e0, 0xfe31d04d, 0xfe31c92a, 0xfe3207b5, 0xfe31a398, 0xfe319000,
+    0xfe318000, 0xfe3170b4, 0xfe316000, 0xfe315000, 0xfe3142ce, 0xfe313000, 0xfe316656, 0xfe3116f3,
+    0xfe310877, 0xfe314ab5, 0xfe30e673, 0xfe30d92a, 0xfe30c556, 0xfe30b652, 0xfe312b08, 0xfe309344,
+    0xfe308874, 0xfe3079e8, 0xfe307ca0, 0xfe305747, 0xfe304000, 0xfe303000, 0xfe30287c, 0xfe301013,
+    0xfe300265, 0xfe2ff000, 0xfe2fe0a4, 0xfe2fd06a, 0xfe2fc000, 0xfe2fbee5, 0xfe2faeab, 0xfe2f9000,
+    0xfe2f8014, 0xfe2f7514, 0xfe2f6aa4, 0xfe2f8917, 0xfe2f406b, 0xfe2f4df0, 0xfe2f3db6, 0xfe2f1000,
+    0xfe2f0aa3, 0xfe2efa69, 0xfe2effc9, 0xfe2eef8f, 0xfe2ec000, 0xfe2eb2c4, 0xfe2ef974, 0xfe2e9000,
+    0xfe2e8000, 0xfe2e7629, 0xfe2e6959, 0xfe2e591f, 0xfe2e73b9, 0xfe2e38a5, 0xfe2e836d, 0xfe2e4ff3,
+    0xfe2e0000, 0xfe2df8c1, 0xfe2de7e5, 0xfe2dd000, 0xfe2dc9ed, 0xfe2dc0cd, 0xfe2da22f, 0xfe2dfaff,
+    0xfe2d8193, 0xfe2d720e, 0xfe2d6000, 0xfe2d5000, 0xfe2d4852, 0xfe2d3000, 0xfe2d28a3, 0xfe2d1000,
+    0xfe2d0829, 0xfe2d29a3, 0xfe2ce109, 0xfe2cd6fc, 0xfe2cc086, 0xfe2cb2b0, 0xfe2ca000, 0xfe2c900d,
+    0xfe2ce6eb, 0xfe2cf43c, 0xfe2c6085, 0xfe2cb8e7, 0xfe2cbecc, 0xfe2c300c, 0xfe2c2c9a, 0xfe2c11e7,
+    0xfe2c035e, 0xfe2bf14f, 0xfe2be4bd, 0xfe2bda18, 0xfe2c0590, 0xfe2bba18, 0xfe2ba000, 0xfe2b9877,
+    0xfe2b883d, 0xfe2b7000, 0xfe2b6033, 0xfe2b5a17, 0xfe2b4beb, 0xfe2b4e19, 0xfe2b21e7, 0xfe2b9879,
+    0xfe2b69b7, 0xfe2af90f, 0xfe2b5fa8, 0xfe2ad7ae, 0xfe2b7032, 0xfe2b60bb, 0xfe2aa859, 0xfe2acbec,
+    0xfe2adfbe, 0xfe2a772c, 0xfe2a6835, 0xfe2a586f, 0xfe2a4e2a, 0xfe2a3cf5, 0xfe2a4d81, 0xfe2a1424,
+    0xfe2a05ed, 0xfe2a3b2c, 0xfe29e4bc, 0xfe29e57c, 0xfe29ce90, 0xfe29b75a, 0xfe29a5ec, 0xfe2994f9,
+    0xfe298c33, 0xfe29e3bd, 0xfe29e0d1, 0xfe29ff39, 0xfe294de7, 0xfe293676, 0xfe2922ad, 0xfe291a4e,
+    0xfe290877, 0xfe290f74, 0xfe28ede6, 0xfe28d655, 0xfe293ad0, 0xfe28b00c, 0xfe28a000, 0xfe28960e,
+    0xfe28e2cb, 0xfe287904, 0xfe28a887, 0xfe28b68c, 0xfe28b25c, 0xfe28b942, 0xfe28824e, 0xfe2818a6,
+    0xfe287655, 0xfe27f17d, 0xfe27e9d2, 0xfe27d998, 0xfe27cbb4, 0xfe283022, 0xfe27a389, 0xfe2791f3,
+    0xfe2781b9, 0xfe277000, 0xfe276691, 0xfe27530f, 0xfe274888, 0xfe27384e, 0xfe277644, 0xfe274988,
+    0xfe277a56, 0xfe271017, 0xfe270d44, 0xfe271795, 0xfe26c71c, 0xfe26b1bb, 0xfe26a17a, 0xfe269b4c,
+    0xfe26e657, 0xfe26ab73, 0xfe266000, 0xfe2656ef, 0xfe264179, 0xfe263000, 0xfe262503, 0xfe261000,
+    0xfe260942, 0xfe25f65e, 0xfe25e29a, 0xfe25d6e0, 0xfe262051, 0xfe25dcc8, 0xfe25a660, 0xfe2591c0,
+    0xfe258543, 0xfe257ea5, 0xfe25c4d1, 0xfe255331, 0xfe25b147, 0xfe2539a3, 0xfe253f58, 0xfe251661,
+    0xfe250000, 0xfe24f000, 0xfe24e869, 0xfe24d7fb, 0xfe24c252, 0xfe24b000, 0xfe24be20, 0xfe24ade6,
+    0xfe248000, 0xfe247022, 0xfe248037, 0xfe245000, 0xfe244c5e, 0xfe243c24, 0xfe2424f9, 0xfe2455b3,
+    0xfe240efa, 0xfe240fcd, 0xfe23ff93, 0xfe23d000, 0xfe23cdaa, 0xfe23bd70, 0xfe23ac25, 0xfe239beb,
+    0xfe238000, 0xfe23732f, 0xfe23d4d1, 0xfe235000, 0xfe234000, 0xfe234c3d, 0xfe232021, 0xfe2316f2,
+    0xfe23849d, 0xfe22f682, 0xfe234298, 0xfe2333a6, 0xfe22c000, 0xfe22b316, 0xfe22a7d2, 0xfe229000,
+    0xfe228cf4, 0xfe2280ba, 0xfe22621c, 0xfe2269bc, 0xfe224180, 0xfe223279, 0xfe222000, 0xfe221000,
+    0xfe22083f, 0xfe21f000, 0xfe21e676, 0xfe21d000, 0xfe21c420, 0xfe2217be, 0xfe21a3ac, 0xfe21913c,
+    0xfe218102, 0xfe2170c8, 0xfe216000, 0xfe215180, 0xfe21d05a, 0xfe21790d, 0xfe2168d3, 0xfe219183,
+    0xfe210747, 0xfe20fc11, 0xfe20f4f9, 0xfe20d1d4, 0xfe20c34b, 0xfe20b641, 0xfe20a4aa, 0xfe20a00d,
+    0xfe20e66b, 0xfe207330, 0xfe206000, 0xfe205086, 0xfe20404c, 0xfe203000, 0xfe2022a0, 0xfe201266,
+    0xfe20921d, 0xfe203857, 0xfe1fe68b, 0xfe205c5a, 0xfe205387, 0xfe1fb60b, 0xfe1fb00d, 0xfe1f979b,
+    0xfe20313c, 0xfe202135, 0xfe1f62dc, 0xfe1f55d9, 0xfe1fb228, 0xfe1f3b06, 0xfe1f2209, 0xfe1f1317,
+    0xfe1f0e17, 0xfe1efce2, 0xfe1f400e, 0xfe1ed411, 0xfe1f57e5, 0xfe1f1876, 0xfe1ea4a9, 0xfe1f1d39,
+    0xfe1e858f, 0xfe1e7747, 0xfe1ef795, 0xfe1e5462, 0xfe1ef0ca, 0xfe1e91bd, 0xfe1e2641, 0xfe1e4509,
+    0xfe1e0dd4, 0xfe1e06cd, 0xfe1de29a, 0xfe1dd978, 0xfe1e6d46, 0xfe1db803, 0xfe1dadd3, 0xfe1d9642,
+    0xfe1d8543, 0xfe1d800e, 0xfe1d6000, 0xfe1d51d4, 0xfe1d4af8, 0xfe1d3641, 0xfe1d6874, 0xfe1d7679,
+    0xfe1d86e0, 0xfe1cf29a, 0xfe1d5546, 0xfe1cd864, 0xfe1cc1d5, 0xfe1cb16a, 0xfe1caae7, 0xfe1c9543,
+    0xfe1c96ee, 0xfe1c779c, 0xfe1c9b43, 0xfe1c5c4f, 0xfe1c4ede, 0xfe1c3000, 0xfe1c267e, 0xfe1c12fc,
+    0xfe1c06dc, 0xfe1bf166, 0xfe1c3631, 0xfe1bd7c1, 0xfe1c2722, 0xfe1c2b86, 0xfe1ba694, 0xfe1c1838,
+    0xfe1b8709, 0xfe1b71a8, 0xfe1b6167, 0xfe1bb683, 0xfe1bc350, 0xfe1b42bd, 0xfe1b4b18, 0xfe1b24e1,
+    0xfe1b4759, 0xfe1af1b9, 0xfe1ae4f0, 0xfe1ad2f6, 0xfe1b0246, 0xfe1b0351, 0xfe1ae562, 0xfe1a99ea,
+    0xfe1afb96, 0xfe1a7618, 0xfe1a664d, 0xfe1acd08, 0xfe1a4005, 0xfe1a9cbb, 0xfe1a99a6, 0xfe1a1b83,
+    0xfe1ab2f5, 0xfe1a8a54, 0xfe1a7b17, 0xfe1a6568, 0xfe1a296f, 0xfe19bf57, 0xfe1a1565, 0xfe1a3eae,
+    0xfe1a179b, 0xfe19df4e, 0xfe19e39d, 0xfe19b688, 0xfe1941ee, 0xfe19737f, 0xfe198f4d, 0xfe191dc2,
+    0xfe192d53, 0xfe19569c, 0xfe19928a, 0xfe1980a3, 0xfe192f60, 0xfe195fb3, 0xfe18b514, 0xfe18972c,
+    0xfe1931cb, 0xfe187584, 0xfe1910df, 0xfe18cbaa, 0xfe189eb1, 0xfe18b9a1, 0xfe188022, 0xfe181d7f,
+    0xfe187a74, 0xfe185445, 0xfe188d35, 0xfe187cfc, 0xfe183164, 0xfe1824cc, 0xfe182cff, 0xfe1814f7,
+    0xfe179336, 0xfe1773dc, 0xfe176add, 0xfe17a4cb, 0xfe175d54, 0xfe17e2fa, 0xfe17350a, 0xfe17c248,
+    0xfe178f75, 0xfe179f05, 0xfe170c80, 0xfe170cb5, 0xfe1727a2, 0xfe16bbd6, 0xfe174c90, 0xfe16a336,
+    0xfe16e785, 0xfe168e1b, 0xfe16dd45, 0xfe16541f, 0xfe164663, 0xfe1632e1, 0xfe166623, 0xfe168e20,
+    0xfe16b103, 0xfe1645dc, 0xfe169607, 0xfe1682e8, 0xfe167492, 0xfe16061d, 0xfe1631f3, 0xfe15c7fa,
+    0xfe1631a8, 0xfe157112, 0xfe15e9fb, 0xfe160001, 0xfe15b3ae, 0xfe1536c1, 0xfe1542ba, 0xfe151111,
+    0xfe1504d5, 0xfe14f49b, 0xfe14e914, 0xfe152564, 0xfe14fc24, 0xfe14b789, 0xfe152a53, 0xfe1544c6,
+    0xfe148632, 0xfe1515f3, 0xfe15139e, 0xfe14c9b9, 0xfe14f156, 0xfe14a032, 0xfe14b9ea, 0xfe14c12d,
+    0xfe14093b, 0xfe145446, 0xfe145d3d, 0xfe13d000, 0xfe143407, 0xfe13bccf, 0xfe13acb4, 0xfe14093a,
+    0xfe13dc5c, 0xfe138db8, 0xfe1399c6, 0xfe13cb52, 0xfe13457c, 0xfe13b8fe, 0xfe1325c6, 0xfe138b83,
+    0xfe1310a8, 0xfe137609, 0xfe133648, 0xfe134384, 0xfe12cdc1, 0xfe131f36, 0xfe12a287, 0xfe129d42,
+    0xfe128851, 0xfe127bbd, 0xfe126dc0, 0xfe12562f, 0xfe12c48d, 0xfe123ffb, 0xfe122000, 0xfe122c0f,
+    0xfe12664e, 0xfe11f6c4, 0xfe11e1c3, 0xfe11dffa, 0xfe11d98d, 0xfe1238c4, 0xfe11ae16, 0xfe1192e8,
+    0xfe120985, 0xfe117157, 0xfe116cc6, 0xfe115c8c, 0xfe1156db, 0xfe11c608, 0xfe119d95, 0xfe11124b,
+    0xfe110211, 0xfe10f000, 0xfe10e66b, 0xfe10d2e9, 0xfe10c648, 0xfe10b60e, 0xfe10a23a, 0xfe109000,
+    0xfe10f5a5, 0xfe10d5bc, 0xfe106000, 0xfe1067aa, 0xfe1046f6, 0xfe103195, 0xfe102154, 0xfe1011d3,
+    0xfe10786a, 0xfe1008d8, 0xfe100b05, 0xfe0fe4ce, 0xfe100746, 0xfe0fb1a6, 0xfe0fa4dd, 0xfe0f92e3,
+    0xfe0fc233, 0xfe0fc33e, 0xfe0f633a, 0xfe0f5000, 0xfe0f4d5a, 0xfe0f3000, 0xfe0f2000, 0xfe0f119a,
+    0xfe0f0000, 0xfe0ef266, 0xfe0ee157, 0xfe0edb70, 0xfe0f2772, 0xfe0eccd3, 0xfe0f2679, 0xfe0e95dd,
+    0xfe0f08e8, 0xfe0e7f44, 0xfe0e6267, 0xfe0e5158, 0xfe0e50a7, 0xfe0e9f3b, 0xfe0e5ca2, 0xfe0e1299,
+    0xfe0e01db, 0xfe0df157, 0xfe0deadd, 0xfe0dddaf, 0xfe0dcc99, 0xfe0db3e3, 0xfe0da435, 0xfe0d93fb,
+    0xfe0d847b, 0xfe0d9c37, 0xfe0d6561, 0xfe0d5527, 0xfe0db315, 0xfe0d3434, 0xfe0da723, 0xfe0d63a6,
+    0xfe0d5e9e, 0xfe0d4189, 0xfe0cf626, 0xfe0cdd6c, 0xfe0d3a61, 0xfe0cb232, 0xfe0cc4c2, 0xfe0cbc6d,
+    0xfe0c8da5, 0xfe0ce4b9, 0xfe0cbca0, 0xfe0c5fe0, 0xfe0c5323, 0xfe0c3252, 0xfe0c7dd1, 0xfe0c64b8,
+    0xfe0c01a8, 0xfe0c5596, 0xfe0bf1dc, 0xfe0c3db9, 0xfe0c4af7, 0xfe0bc324, 0xfe0bcc6d, 0xfe0bcca2,
+    0xfe0bd659, 0xfe0b7bc3, 0xfe0ba70c, 0xfe0bec9b, 0xfe0bc8d6, 0xfe0b4e08, 0xfe0b2941, 0xfe0b140c,
+    0xfe0b0650, 0xfe0af2ce, 0xfe0b2610, 0xfe0ad138, 0xfe0ad9e2, 0xfe0ab1e5, 0xfe0ad08e, 0xfe0af85c,
+    0xfe0ad551, 0xfe0a7b4d, 0xfe0a9d1f, 0xfe0a6626, 0xfe0a4139, 0xfe0a30ff, 0xfe0a9e22, 0xfe0abb19,
+    0xfe0a7ff3, 0xfe0a7032, 0xfe0a8bd8, 0xfe0a5048, 0xfe09c4c2, 0xfe09b488, 0xfe0a0e87, 0xfe0a3a2b,
+    0xfe0a2f92, 0xfe097000, 0xfe0963a3, 0xfe095369, 0xfe094000, 0xfe094260, 0xfe09775d, 0xfe09124b,
+    0xfe093cf4, 0xfe08f102, 0xfe09668f, 0xfe08eb38, 0xfe08ea34, 0xfe09266c, 0xfe08e675, 0xfe091ac5,
+    0xfe090254, 0xfe08fa8c, 0xfe08eaaf, 0xfe089b54, 0xfe088640, 0xfe083636, 0xfe086a27, 0xfe0817b3,
+    0xfe080000, 0xfe085c2a, 0xfe07ed5a, 0xfe084b2a, 0xfe0838cb, 0xfe07b3e0, 0xfe081449, 0xfe081e54,
+    0xfe0811ac, 0xfe07e6fc, 0xfe077ad5, 0xfe075e73, 0xfe07caa2, 0xfe07897a, 0xfe079b78, 0xfe0797ed,
+    0xfe07af0a, 0xfe077bd9, 0xfe076b7b, 0xfe07598b, 0xfe074bf7, 0xfe073f18, 0xfe072f6c, 0xfe071dc8,
+    0xfe06f1b4, 0xfe067fc5, 0xfe067308, 0xfe0673a9, 0xfe06b656, 0xfe06849d, 0xfe06d0ed, 0xfe0663c2,
+    0xfe0665ce, 0xfe069fd8, 0xfe066b8b, 0xfe067ee2, 0xfe06582e, 0xfe0639c9, 0xfe064dc6, 0xfe060a99,
+    0xfe06108a, 0xfe05e9cf, 0xfe0572ce, 0xfe05fb49, 0xfe0551a6, 0xfe0538ec, 0xfe0592bb, 0xfe0512b3,
+    0xfe0545f5, 0xfe058884, 0xfe04f9c7, 0xfe04e98d, 0xfe057033, 0xfe0541a8, 0xfe054fc1, 0xfe04f1f6,
+    0xfe04b919, 0xfe04d4b0, 0xfe04aa93, 0xfe04b9b3, 0xfe04b992, 0xfe04bb0d, 0xfe04abda, 0xfe04a28f,
+    0xfe0491e7, 0xfe041252, 0xfe046a3d, 0xfe03d743, 0xfe045034, 0xfe03b602, 0xfe04497a, 0xfe03e43c,
+    0xfe03fcca, 0xfe03eff5, 0xfe03b480, 0xfe036245, 0xfe03cb8f, 0xfe03aeb6, 0xfe035cd9, 0xfe034c9f,
+    0xfe031d97, 0xfe039c87, 0xfe02f601, 0xfe02dcb5, 0xfe035255, 0xfe02b02d, 0xfe02a3f1, 0xfe0293b7,
+    0xfe028000, 0xfe028830, 0xfe02c480, 0xfe026512, 0xfe025703, 0xfe028293, 0xfe02275e, 0xfe0210ae,
+    0xfe02568c, 0xfe01f17a, 0xfe026549, 0xfe01d28b, 0xfe01c721, 0xfe01c585, 0xfe01a000, 0xfe01abb4,
+    0xfe01eb8f, 0xfe017000, 0xfe016ad2, 0xfe015000, 0xfe014000, 0xfe013b0c, 0xfe013496, 0xfe011000,
+    0xfe01164d, 0xfe00f6e2, 0xfe00e000, 0xfe00d33c, 0xfe00c000, 0xfe00b0c4, 0xfe00a20f, 0xfe009000,
+    0xfe00866b, 0xfe007333, 0xfe006000, 0xfe00553e, 0xfe004000, 0xfe003000, 0xfe002411,
+};
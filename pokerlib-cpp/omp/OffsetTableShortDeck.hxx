@@ -0,0 +1,262 @@
+#include "HandEvaluator.h"
+
+// Offset table for the perfect hashing algorithm used in the evaluator (ShortDeckLookupLayout, 2048 rows).
+// Generated by HandEvaluatorT::outputLookupTables().
+const uint32_t omp::ShortDeckLookupLayout::PERF_HASH_ROW_OFFSETS[] {
+    0x0, 0xffffc000, 0xffff8000, 0xffff4000, 0xffff0000, 0xfffec000, 0xfffe8000, 0xfffe4000,
+    0xfffe0000, 0xfffdc000, 0xfffd8000, 0xfffd4000, 0xfffd0000, 0xfffcc000, 0xfffc8000, 0xfffc4000,
+    0xfffc0000, 0xfffbc000, 0xfffb8000, 0xfffb4000, 0xfffb0000, 0xfffac000, 0xfffa8000, 0xfffa4000,
+    0xfffa0000, 0xfff9c000, 0xfff98000, 0xfff94000, 0xfff90000, 0xfff8c000, 0xfff88000, 0xfff84000,
+    0xfff80000, 0xfff7c000, 0xfff78000, 0xfff74000, 0xfff70000, 0xfff6c000, 0xfff68000, 0xfff64000,
+    0xfff60000, 0xfff5c000, 0xfff58000, 0xfff54000, 0xfff50000, 0xfff4c000, 0xfff48000, 0xfff44000,
+    0xfff40000, 0xfff3c000, 0xfff38000, 0xfff34000, 0xfff30000, 0xfff2c000, 0xfff28000, 0xfff24000,
+    0xfff20000, 0xfff1c000, 0xfff18000, 0xfff14000, 0xfff10000, 0xfff0c000, 0xfff08000, 0xfff04000,
+    0xfff00000, 0xffefc000, 0xffef8000, 0xffef4000, 0xffef0000, 0xffeec000, 0xffee8000, 0xffee4000,
+    0xffee0000, 0xffedc000, 0xffed8000, 0xffed4000, 0xffed0000, 0xffecc000, 0xffec8000, 0xffec4000,
+    0xffec0000, 0xffebc000, 0xffeb8000, 0xffeb4000, 0xffeb0000, 0xffeac000, 0xffea8000, 0xffea4000,
+    0xffea0000, 0xffe9c000, 0xffe98000, 0xffe94000, 0xffe90000, 0xffe8c000, 0xffe88000, 0xffe84000,
+    0xffe80000, 0xffe7c000, 0xffe78000, 0xffe74000, 0xffe70000, 0xffe6c000, 0xffe68000, 0xffe64000,
+    0xffe60000, 0xffe5c000, 0xffe58000, 0xffe54000, 0xffe50001, 0xffe4c000, 0xffe48000, 0xffe44000,
+    0xffe40000, 0xffe3c000, 0xffe38000, 0xffe34000, 0xffe30000, 0xffe2c000, 0xffe28000, 0xffe24000,
+    0xffe20000, 0xffe1c000, 0xffe18000, 0xffe14000, 0xffe10000, 0xffe0c000, 0xffe08000, 0xffe04000,
+    0xffe00000, 0xffdfc000, 0xffdf8000, 0xffdf4000, 0xffdf0000, 0xffdec000, 0xffde8000, 0xffde4000,
+    0xffde0000, 0xffddc000, 0xffdd8000, 0xffdd4000, 0xffdd0000, 0xffdcc000, 0xffdc8000, 0xffdc4000,
+    0xffdc0000, 0xffdbc001, 0xffdb8000, 0xffdb4000, 0xffdb0000, 0xffdac000, 0xffda8000, 0xffda4000,
+    0xffda0000, 0xffd9c000, 0xffd98000, 0xffd94000, 0xffd90000, 0xffd8c000, 0xffd88000, 0xffd84000,
+    0xffd80000, 0xffd7c000, 0xffd78000, 0xffd74000, 0xffd70000, 0xffd6c000, 0xffd68000, 0xffd64000,
+    0xffd60000, 0xffd5c000, 0xffd58000, 0xffd54000, 0xffd50000, 0xffd4c000, 0xffd48000, 0xffd44000,
+    0xffd40000, 0xffd3c000, 0xffd38000, 0xffd34000, 0xffd30000, 0xffd2c000, 0xffd28000, 0xffd24000,
+    0xffd20000, 0xffd1c000, 0xffd18000, 0xffd14000, 0xffd10000, 0xffd0c000, 0xffd08000, 0xffd04000,
+    0xffd00000, 0xffcfc000, 0xffcf8000, 0xffcf4000, 0xffcf0000, 0xffcec000, 0xffce8000, 0xffce4000,
+    0xffce0000, 0xffcdc000, 0xffcd8000, 0xffcd4000, 0xffcd0000, 0xffccc000, 0xffcc8000, 0xffcc4000,
+    0xffcc0000, 0xffcbc000, 0xffcb8000, 0xffcb4000, 0xffcb0000, 0xffcac000, 0xffca8000, 0xffca4000,
+    0xffca0000, 0xffc9c001, 0xffc98000, 0xffc94000, 0xffc90000, 0xffc8c000, 0xffc88000, 0xffc84000,
+    0xffc80000, 0xffc7c000, 0xffc78000, 0xffc74000, 0xffc70000, 0xffc6c000, 0xffc68000, 0xffc64000,
+    0xffc60000, 0xffc5c000, 0xffc58000, 0xffc54000, 0xffc50000, 0xffc4c000, 0xffc48001, 0xffc44000,
+    0xffc40000, 0xffc3c000, 0xffc38000, 0xffc34000, 0xffc30000, 0xffc2c000, 0xffc28000, 0xffc24000,
+    0xffc20000, 0xffc1c000, 0xffc18000, 0xffc14000, 0xffc10000, 0xffc0c003, 0xffc08000, 0xffc04000,
+    0xffc00000, 0xffbfc000, 0xffbf8000, 0xffbf4000, 0xffbf0000, 0xffbec000, 0xffbe8003, 0xffbe4000,
+    0xffbe0000, 0xffbdc000, 0xffbd8000, 0xffbd4000, 0xffbd0000, 0xffbcc000, 0xffbc8000, 0xffbc4000,
+    0xffbc0000, 0xffbbc000, 0xffbb8000, 0xffbb4000, 0xffbb0000, 0xffbac000, 0xffba8000, 0xffba4000,
+    0xffba0001, 0xffb9c000, 0xffb98000, 0xffb94000, 0xffb90000, 0xffb8c000, 0xffb88003, 0xffb84000,
+    0xffb80000, 0xffb7c000, 0xffb78002, 0xffb74002, 0xffb70000, 0xffb6c002, 0xffb68000, 0xffb64000,
+    0xffb60000, 0xffb5c000, 0xffb58001, 0xffb54000, 0xffb50000, 0xffb4c000, 0xffb48000, 0xffb44000,
+    0xffb40000, 0xffb3c000, 0xffb38000, 0xffb34000, 0xffb30000, 0xffb2c000, 0xffb28000, 0xffb24001,
+    0xffb20000, 0xffb1c000, 0xffb18000, 0xffb14000, 0xffb10001, 0xffb0c000, 0xffb08000, 0xffb04000,
+    0xffb00000, 0xffafc000, 0xffaf8002, 0xffaf4000, 0xffaf0000, 0xffaec000, 0xffae8001, 0xffae4007,
+    0xffae000d, 0xffadc000, 0xffad8000, 0xffad4000, 0xffad0002, 0xffacc000, 0xffac8000, 0xffac4001,
+    0xffac0000, 0xffabc000, 0xffab8000, 0xffab4000, 0xffab0000, 0xffaac000, 0xffaa8000, 0xffaa4000,
+    0xffaa0000, 0xffa9c000, 0xffa98000, 0xffa94001, 0xffa90000, 0xffa8c000, 0xffa88000, 0xffa84000,
+    0xffa80000, 0xffa7c000, 0xffa78000, 0xffa74000, 0xffa70001, 0xffa6c000, 0xffa68004, 0xffa64000,
+    0xffa60000, 0xffa5c000, 0xffa58003, 0xffa54006, 0xffa50001, 0xffa4c00a, 0xffa48000, 0xffa44000,
+    0xffa40000, 0xffa3c000, 0xffa38000, 0xffa34000, 0xffa30000, 0xffa2c000, 0xffa28003, 0xffa24000,
+    0xffa20000, 0xffa1c000, 0xffa18000, 0xffa14004, 0xffa10000, 0xffa0c000, 0xffa08000, 0xffa04002,
+    0xffa00002, 0xff9fc001, 0xff9f801d, 0xff9f4000, 0xff9f0000, 0xff9ec000, 0xff9e8000, 0xff9e4000,
+    0xff9e0000, 0xff9dc000, 0xff9d8002, 0xff9d4004, 0xff9d0000, 0xff9cc000, 0xff9c8000, 0xff9c4002,
+    0xff9c000a, 0xff9bc000, 0xff9b8000, 0xff9b4000, 0xff9b0002, 0xff9ac000, 0xff9a8000, 0xff9a4005,
+    0xff9a0000, 0xff99c000, 0xff998000, 0xff994000, 0xff990000, 0xff98c000, 0xff988000, 0xff984001,
+    0xff980008, 0xff97c000, 0xff978000, 0xff974002, 0xff970004, 0xff96c00c, 0xff968020, 0xff964000,
+    0xff960000, 0xff95c002, 0xff958000, 0xff954000, 0xff950001, 0xff94c000, 0xff948000, 0xff944009,
+    0xff940000, 0xff93c000, 0xff938000, 0xff934003, 0xff930074, 0xff92c000, 0xff92800c, 0xff924000,
+    0xff920002, 0xff91c000, 0xff918000, 0xff914000, 0xff910000, 0xff90c000, 0xff908007, 0xff904000,
+    0xff900000, 0xff8fc001, 0xff8f8000, 0xff8f4000, 0xff8f000b, 0xff8ec000, 0xff8e8000, 0xff8e4000,
+    0xff8e0002, 0xff8dc163, 0xff8d8000, 0xff8d4018, 0xff8d0000, 0xff8cc000, 0xff8c8000, 0xff8c4000,
+    0xff8c0001, 0xff8bc000, 0xff8b8000, 0xff8b4000, 0xff8b0000, 0xff8ac000, 0xff8a8000, 0xff8a4003,
+    0xff8a0000, 0xff89c012, 0xff898000, 0xff894000, 0xff890000, 0xff88c003, 0xff888206, 0xff884000,
+    0xff88000a, 0xff87c000, 0xff878002, 0xff874000, 0xff870000, 0xff86c000, 0xff868000, 0xff864000,
+    0xff860009, 0xff85c000, 0xff858000, 0xff854000, 0xff850000, 0xff84c004, 0xff848009, 0xff844000,
+    0xff840000, 0xff83c000, 0xff838001, 0xff834000, 0xff830000, 0xff82c002, 0xff828000, 0xff82400b,
+    0xff820000, 0xff81c000, 0xff818000, 0xff814008, 0xff81000b, 0xff80c003, 0xff808033, 0xff804000,
+    0xff800000, 0xff7fc001, 0xff7f8016, 0xff7f400d, 0xff7f0008, 0xff7ec000, 0xff7e8000, 0xff7e4000,
+    0xff7e0000, 0xff7dc000, 0xff7d8001, 0xff7d4000, 0xff7d0007, 0xff7cc003, 0xff7c8000, 0xff7c4000,
+    0xff7c0004, 0xff7bc008, 0xff7b8002, 0xff7b4008, 0xff7b0000, 0xff7ac000, 0xff7a8001, 0xff7a4000,
+    0xff7a0000, 0xff79c000, 0xff798000, 0xff794007, 0xff790010, 0xff78c000, 0xff788000, 0xff784000,
+    0xff78000a, 0xff77c00c, 0xff77803b, 0xff774000, 0xff77000d, 0xff76c008, 0xff768007, 0xff76400d,
+    0xff760001, 0xff75c00f, 0xff758017, 0xff754028, 0xff750000, 0xff74c000, 0xff748000, 0xff744000,
+    0xff740000, 0xff73c001, 0xff738000, 0xff734000, 0xff730003, 0xff72c000, 0xff728000, 0xff724000,
+    0xff720000, 0xff71c000, 0xff71800d, 0xff714022, 0xff710018, 0xff70c01c, 0xff708000, 0xff704000,
+    0xff70002d, 0xff6fc08a, 0xff6f8009, 0xff6f4008, 0xff6f0004, 0xff6ec003, 0xff6e800d, 0xff6e4004,
+    0xff6e003b, 0xff6dc011, 0xff6d8014, 0xff6d4017, 0xff6d0005, 0xff6cc008, 0xff6c8012, 0xff6c400b,
+    0xff6c0000, 0xff6bc000, 0xff6b8003, 0xff6b4000, 0xff6b0000, 0xff6ac001, 0xff6a8000, 0xff6a4000,
+    0xff6a0000, 0xff69c003, 0xff698025, 0xff69401c, 0xff690037, 0xff68c000, 0xff688002, 0xff684003,
+    0xff680020, 0xff67c007, 0xff678000, 0xff674000, 0xff670011, 0xff66c056, 0xff6680aa, 0xff664182,
+    0xff660000, 0xff65c022, 0xff658735, 0xff654148, 0xff650001, 0xff64c01c, 0xff648001, 0xff64406a,
+    0xff640000, 0xff63c00c, 0xff638232, 0xff634003, 0xff63003d, 0xff62c000, 0xff628000, 0xff624000,
+    0xff620000, 0xff61c00b, 0xff618000, 0xff614000, 0xff610001, 0xff60c002, 0xff608020, 0xff604000,
+    0xff600002, 0xff5fc000, 0xff5f803d, 0xff5f4000, 0xff5f0007, 0xff5ec00e, 0xff5e800f, 0xff5e4236,
+    0xff5e000c, 0xff5dc5dc, 0xff5d802a, 0xff5d427b, 0xff5d0022, 0xff5cc00d, 0xff5c819d, 0xff5c400d,
+    0xff5c0009, 0xff5bc03c, 0xff5b8003, 0xff5b4000, 0xff5b0022, 0xff5ac000, 0xff5a8014, 0xff5a402d,
+    0xff5a0004, 0xff59c173, 0xff59800d, 0xff594031, 0xff590000, 0xff58c00d, 0xff588004, 0xff5840a9,
+    0xff5803ad, 0xff57c00d, 0xff57805b, 0xff574171, 0xff5700b3, 0xff56c008, 0xff5680d1, 0xff564009,
+    0xff560001, 0xff55c01e, 0xff558009, 0xff554019, 0xff55002d, 0xff54c001, 0xff548044, 0xff544017,
+    0xff54000b, 0xff53c000, 0xff538007, 0xff534079, 0xff530010, 0xff52c000, 0xff528003, 0xff524060,
+    0xff52013f, 0xff51c0a0, 0xff518025, 0xff51401c, 0xff51003a, 0xff50c000, 0xff508035, 0xff504007,
+    0xff500000, 0xff4fc00b, 0xff4f8005, 0xff4f468e, 0xff4f0017, 0xff4ec046, 0xff4e8008, 0xff4e402b,
+    0xff4e0105, 0xff4dc0b0, 0xff4d8061, 0xff4d400b, 0xff4d0000, 0xff4cc003, 0xff4c8000, 0xff4c4075,
+    0xff4c001b, 0xff4bc16b, 0xff4b824d, 0xff4b400c, 0xff4b0080, 0xff4ac00e, 0xff4a8221, 0xff4a4058,
+    0xff4a00b1, 0xff49c0a2, 0xff498003, 0xff494027, 0xff49021c, 0xff48c029, 0xff488000, 0xff484004,
+    0xff480000, 0xff47c026, 0xff4787ae, 0xff47409f, 0xff470072, 0xff46c033, 0xff46802d, 0xff4646cd,
+    0xff460022, 0xff45c126, 0xff45800c, 0xff45406f, 0xff4501bd, 0xff44c2dd, 0xff44817e, 0xff444000,
+    0xff440006, 0xff43c000, 0xff438000, 0xff434004, 0xff43001b, 0xff42c060, 0xff428000, 0xff42405b,
+    0xff420001, 0xff41c008, 0xff418034, 0xff414003, 0xff410056, 0xff40c01e, 0xff408069, 0xff404000,
+    0xff400248, 0xff3fc186, 0xff3f8008, 0xff3f4186, 0xff3f0012, 0xff3ec10d, 0xff3e800f, 0xff3e4001,
+    0xff3e0007, 0xff3dc018, 0xff3d801d, 0xff3d4059, 0xff3d0191, 0xff3cc0b0, 0xff3c8004, 0xff3c4000,
+    0xff3c001c, 0xff3bc04e, 0xff3b8004, 0xff3b400c, 0xff3b0032, 0xff3ac5bd, 0xff3a801a, 0xff3a4070,
+    0xff3a005c, 0xff39c02a, 0xff398616, 0xff394018, 0xff3903f2, 0xff38c003, 0xff3880a8, 0xff384846,
+    0xff380683, 0xff37c5b1, 0xff37839c, 0xff374004, 0xff37002f, 0xff36c4e3, 0xff36803e, 0xff364010,
+    0xff360053, 0xff35c001, 0xff358000, 0xff354059, 0xff350000, 0xff34c235, 0xff348049, 0xff344005,
+    0xff3400b3, 0xff33c11d, 0xff33800a, 0xff3340bf, 0xff33058f, 0xff32c0c8, 0xff328067, 0xff324004,
+    0xff32000c, 0xff31c02b, 0xff318079, 0xff31401a, 0xff310000, 0xff30c000, 0xff30803b, 0xff304115,
+    0xff300031, 0xff2fc002, 0xff2f82da, 0xff2f4279, 0xff2f00f2, 0xff2ec5e1, 0xff2e801b, 0xff2e4674,
+    0xff2e0113, 0xff2dc438, 0xff2d800e, 0xff2d42da, 0xff2d0243, 0xff2cc050, 0xff2c8236, 0xff2c41d8,
+    0xff2c0001, 0xff2bc01c, 0xff2b8018, 0xff2b402f, 0xff2b0044, 0xff2ac018, 0xff2a8001, 0xff2a4020,
+    0xff2a0226, 0xff29c0ac, 0xff298094, 0xff2940c5, 0xff290006, 0xff28c0b1, 0xff288056, 0xff28469b,
+    0xff280588, 0xff27c2a6, 0xff27839a, 0xff274143, 0xff27014b, 0xff26c3a6, 0xff268354, 0xff26462a,
+    0xff2601e1, 0xff25c41b, 0xff2582b7, 0xff254339, 0xff2500dd, 0xff24c01d, 0xff24836b, 0xff244021,
+    0xff24021d, 0xff23c01c, 0xff238026, 0xff234359, 0xff230000, 0xff22c000, 0xff228000, 0xff224009,
+    0xff220360, 0xff21c137, 0xff21836f, 0xff214000, 0xff2100db, 0xff20c337, 0xff20801c, 0xff20406d,
+    0xff2002ac, 0xff1fc008, 0xff1f8014, 0xff1f4748, 0xff1f0643, 0xff1ec1de, 0xff1e805f, 0xff1e405e,
+    0xff1e01be, 0xff1dc1bb, 0xff1d8239, 0xff1d4751, 0xff1d0017, 0xff1cc40a, 0xff1c839b, 0xff1c41d8,
+    0xff1c003e, 0xff1bc290, 0xff1b80ed, 0xff1b4003, 0xff1b0061, 0xff1ac583, 0xff1a8390, 0xff1a4138,
+    0xff1a0052, 0xff19c000, 0xff19800a, 0xff194014, 0xff1902a5, 0xff18c406, 0xff188189, 0xff184013,
+    0xff1807a8, 0xff17c652, 0xff178119, 0xff17458f, 0xff1703f2, 0xff16c198, 0xff168630, 0xff164290,
+    0xff160063, 0xff15c2c1, 0xff1584ac, 0xff154214, 0xff15009f, 0xff14c3c4, 0xff1483d8, 0xff1442f0,
+    0xff140022, 0xff13c012, 0xff138680, 0xff1342cc, 0xff1302bd, 0xff12c1fc, 0xff128146, 0xff1242b5,
+    0xff120173, 0xff11c7c9, 0xff118040, 0xff114026, 0xff11003e, 0xff10c485, 0xff108449, 0xff1040cb,
+    0xff10046b, 0xff0fc225, 0xff0f8482, 0xff0f420f, 0xff0f04d0, 0xff0ec00a, 0xff0e8027, 0xff0e439d,
+    0xff0e02d8, 0xff0dc401, 0xff0d81aa, 0xff0d41ba, 0xff0d02cd, 0xff0cc0fc, 0xff0c8668, 0xff0c4120,
+    0xff0c0471, 0xff0bc16f, 0xff0b843e, 0xff0b4327, 0xff0b001f, 0xff0ac556, 0xff0a80a0, 0xff0a405f,
+    0xff0a04a2, 0xff09c08c, 0xff0981af, 0xff09416f, 0xff0903a5, 0xff08c062, 0xff0881c2, 0xff0841f6,
+    0xff080571, 0xff07c48e, 0xff07852b, 0xff074496, 0xff07003d, 0xff06c254, 0xff06803a, 0xff064032,
+    0xff060379, 0xff05c01c, 0xff0580fb, 0xff054035, 0xff0500e3, 0xff04c3e9, 0xff04821f, 0xff0442a4,
+    0xff040620, 0xff03c026, 0xff038594, 0xff034095, 0xff03025d, 0xff02c169, 0xff028409, 0xff02427d,
+    0xff020297, 0xff01c11a, 0xff0184af, 0xff014440, 0xff010198, 0xff00c03c, 0xff008003, 0xff004010,
+    0xff000292, 0xfeffc050, 0xfeff8446, 0xfeff4122, 0xfeff04a3, 0xfefec030, 0xfefe813b, 0xfefe442d,
+    0xfefe0465, 0xfefdc323, 0xfefd81e1, 0xfefd4417, 0xfefd0361, 0xfefcc0c8, 0xfefc8061, 0xfefc4427,
+    0xfefc0018, 0xfefbc019, 0xfefb8646, 0xfefb4003, 0xfefb03ca, 0xfefac002, 0xfefa8043, 0xfefa4000,
+    0xfefa00f2, 0xfef9c752, 0xfef98192, 0xfef9415f, 0xfef90328, 0xfef8c682, 0xfef88693, 0xfef84600,
+    0xfef80354, 0xfef7c095, 0xfef7876a, 0xfef7409c, 0xfef70705, 0xfef6c3e4, 0xfef68383, 0xfef64415,
+    0xfef6003a, 0xfef5c69a, 0xfef5819f, 0xfef5400d, 0xfef50019, 0xfef4c1e5, 0xfef4803a, 0xfef444b2,
+    0xfef40043, 0xfef3c009, 0xfef38038, 0xfef34344, 0xfef30666, 0xfef2c025, 0xfef280a0, 0xfef2404f,
+    0xfef20376, 0xfef1c056, 0xfef1812e, 0xfef14121, 0xfef10341, 0xfef0c5db, 0xfef08003, 0xfef04042,
+    0xfef00021, 0xfeefc109, 0xfeef8047, 0xfeef4464, 0xfeef0066, 0xfeeec03c, 0xfeee802d, 0xfeee4022,
+    0xfeee0146, 0xfeedc367, 0xfeed80a7, 0xfeed428a, 0xfeed0097, 0xfeecc385, 0xfeec8130, 0xfeec4004,
+    0xfeec0490, 0xfeebc61b, 0xfeeb80ae, 0xfeeb45b4, 0xfeeb0027, 0xfeeac08c, 0xfeea81f3, 0xfeea4121,
+    0xfeea06b7, 0xfee9c383, 0xfee9800a, 0xfee94117, 0xfee9004b, 0xfee8c2d5, 0xfee882e7, 0xfee84526,
+    0xfee8022e, 0xfee7c67b, 0xfee78020, 0xfee74155, 0xfee703ac, 0xfee6c184, 0xfee680f4, 0xfee64006,
+    0xfee602bd, 0xfee5c01b, 0xfee58057, 0xfee540cb, 0xfee5001e, 0xfee4c098, 0xfee4814a, 0xfee4415e,
+    0xfee40067, 0xfee3c13e, 0xfee380c5, 0xfee34332, 0xfee30046, 0xfee2c004, 0xfee286a6, 0xfee2409c,
+    0xfee2003c, 0xfee1c272, 0xfee18398, 0xfee1409d, 0xfee102ae, 0xfee0c060, 0xfee08004, 0xfee04009,
+    0xfee001b2, 0xfedfc663, 0xfedf84b0, 0xfedf4001, 0xfedf0001, 0xfedec002, 0xfede800e, 0xfede40cd,
+    0xfede034e, 0xfeddc000, 0xfedd8001, 0xfedd4019, 0xfedd006a, 0xfedcc005, 0xfedc8031, 0xfedc4004,
+    0xfedc0002, 0xfedbc001, 0xfedb8007, 0xfedb433c, 0xfedb04a3, 0xfedac5fc, 0xfeda8044, 0xfeda4001,
+    0xfeda00cb, 0xfed9c020, 0xfed980ad, 0xfed945f3, 0xfed90002, 0xfed8c001, 0xfed8831e, 0xfed8412b,
+    0xfed80016, 0xfed7c001, 0xfed78001, 0xfed74004, 0xfed701b5, 0xfed6c49d, 0xfed6802a, 0xfed64035,
+    0xfed60034, 0xfed5c00f, 0xfed58001, 0xfed54025, 0xfed50214, 0xfed4c0af, 0xfed48022, 0xfed4407f,
+    0xfed4000d, 0xfed3c041, 0xfed3825e, 0xfed34105, 0xfed3002a, 0xfed2c000, 0xfed2800a, 0xfed24006,
+    0xfed201db, 0xfed1c32a, 0xfed18291, 0xfed141d3, 0xfed1033b, 0xfed0c618, 0xfed08715, 0xfed0402c,
+    0xfed000d1, 0xfecfc284, 0xfecf8143, 0xfecf4039, 0xfecf02c1, 0xfecec1b1, 0xfece815c, 0xfece40e8,
+    0xfece0052, 0xfecdc30e, 0xfecd8015, 0xfecd4549, 0xfecd001b, 0xfeccc000, 0xfecc8067, 0xfecc405a,
+    0xfecc0037, 0xfecbc143, 0xfecb820f, 0xfecb4000, 0xfecb0004, 0xfecac000, 0xfeca8015, 0xfeca4005,
+    0xfeca0016, 0xfec9c035, 0xfec98003, 0xfec94003, 0xfec90000, 0xfec8c461, 0xfec8803a, 0xfec8405e,
+    0xfec8007a, 0xfec7c003, 0xfec7800d, 0xfec7400c, 0xfec7051e, 0xfec6c001, 0xfec681a1, 0xfec641f8,
+    0xfec60015, 0xfec5c04e, 0xfec58000, 0xfec54123, 0xfec50003, 0xfec4c00b, 0xfec4816e, 0xfec44000,
+    0xfec40008, 0xfec3c150, 0xfec382a0, 0xfec341af, 0xfec30005, 0xfec2c004, 0xfec2807d, 0xfec24003,
+    0xfec20176, 0xfec1c014, 0xfec18005, 0xfec14008, 0xfec10082, 0xfec0c01e, 0xfec080b9, 0xfec04012,
+    0xfec002c1, 0xfebfc027, 0xfebf8352, 0xfebf4027, 0xfebf0744, 0xfebec000, 0xfebe803b, 0xfebe42b0,
+    0xfebe014d, 0xfebdc308, 0xfebd837b, 0xfebd4003, 0xfebd000b, 0xfebcc00a, 0xfebc813b, 0xfebc42fe,
+    0xfebc0090, 0xfebbc08d, 0xfebb8001, 0xfebb4017, 0xfebb01e2, 0xfebac462, 0xfeba8655, 0xfeba417a,
+    0xfeba0079, 0xfeb9c08b, 0xfeb98318, 0xfeb9410c, 0xfeb906dd, 0xfeb8c044, 0xfeb88007, 0xfeb8404d,
+    0xfeb8000e, 0xfeb7c584, 0xfeb78354, 0xfeb74009, 0xfeb704d3, 0xfeb6c00d, 0xfeb680af, 0xfeb64061,
+    0xfeb60010, 0xfeb5c047, 0xfeb5838e, 0xfeb5438f, 0xfeb5019b, 0xfeb4c09a, 0xfeb48005, 0xfeb44024,
+    0xfeb4007e, 0xfeb3c028, 0xfeb38109, 0xfeb34005, 0xfeb3001f, 0xfeb2c342, 0xfeb28032, 0xfeb24137,
+    0xfeb20000, 0xfeb1c0d0, 0xfeb1805b, 0xfeb145f0, 0xfeb105b2, 0xfeb0c05d, 0xfeb0800d, 0xfeb04000,
+    0xfeb00038, 0xfeafc099, 0xfeaf81b0, 0xfeaf409f, 0xfeaf0003, 0xfeaec003, 0xfeae802d, 0xfeae401e,
+    0xfeae01bd, 0xfeadc1bb, 0xfead8007, 0xfead4003, 0xfead0007, 0xfeacc000, 0xfeac81cc, 0xfeac430d,
+    0xfeac0567, 0xfeabc002, 0xfeab8253, 0xfeab40af, 0xfeab053b, 0xfeaac5b9, 0xfeaa8058, 0xfeaa4000,
+    0xfeaa000a, 0xfea9c3b4, 0xfea98166, 0xfea94081, 0xfea90000, 0xfea8c000, 0xfea88028, 0xfea84053,
+    0xfea805c2, 0xfea7c001, 0xfea7800c, 0xfea74004, 0xfea70011, 0xfea6c00b, 0xfea6804c, 0xfea64007,
+    0xfea60002, 0xfea5c005, 0xfea58000, 0xfea54004, 0xfea50000, 0xfea4c2c3, 0xfea480b5, 0xfea44207,
+    0xfea40045, 0xfea3c107, 0xfea3804c, 0xfea34236, 0xfea30615, 0xfea2c02a, 0xfea28003, 0xfea242be,
+    0xfea202c7, 0xfea1c0b6, 0xfea18093, 0xfea141ae, 0xfea1016c, 0xfea0c1eb, 0xfea08044, 0xfea04031,
+    0xfea00006, 0xfe9fc242, 0xfe9f831f, 0xfe9f4019, 0xfe9f0003, 0xfe9ec002, 0xfe9e81a0, 0xfe9e4002,
+    0xfe9e0025, 0xfe9dc00d, 0xfe9d8002, 0xfe9d4039, 0xfe9d0001, 0xfe9cc058, 0xfe9c8010, 0xfe9c4000,
+    0xfe9c0005, 0xfe9bc002, 0xfe9b80ab, 0xfe9b426d, 0xfe9b020a, 0xfe9ac001, 0xfe9a8000, 0xfe9a4003,
+    0xfe9a0004, 0xfe99c031, 0xfe99801a, 0xfe994003, 0xfe990000, 0xfe98c000, 0xfe988143, 0xfe984001,
+    0xfe980001, 0xfe97c002, 0xfe978000, 0xfe974000, 0xfe970001, 0xfe96c002, 0xfe968000, 0xfe964000,
+    0xfe960000, 0xfe95c000, 0xfe958000, 0xfe954002, 0xfe950002, 0xfe94c000, 0xfe948000, 0xfe944000,
+    0xfe940004, 0xfe93c001, 0xfe938000, 0xfe934045, 0xfe930000, 0xfe92c001, 0xfe928001, 0xfe924088,
+    0xfe9201d0, 0xfe91c005, 0xfe918001, 0xfe914000, 0xfe91002d, 0xfe90c00e, 0xfe9084ef, 0xfe904249,
+    0xfe900000, 0xfe8fc001, 0xfe8f801b, 0xfe8f4337, 0xfe8f0101, 0xfe8ec004, 0xfe8e8000, 0xfe8e4000,
+    0xfe8e0000, 0xfe8dc05f, 0xfe8d8043, 0xfe8d4000, 0xfe8d0005, 0xfe8cc000, 0xfe8c8000, 0xfe8c4000,
+    0xfe8c0002, 0xfe8bc001, 0xfe8b8000, 0xfe8b4002, 0xfe8b0000, 0xfe8ac00a, 0xfe8a8000, 0xfe8a400a,
+    0xfe8a0000, 0xfe89c002, 0xfe898018, 0xfe89402b, 0xfe890007, 0xfe88c004, 0xfe8880be, 0xfe884025,
+    0xfe8800ad, 0xfe87c017, 0xfe8784a3, 0xfe874024, 0xfe870000, 0xfe86c12d, 0xfe868001, 0xfe864026,
+    0xfe860000, 0xfe85c000, 0xfe858006, 0xfe854003, 0xfe850002, 0xfe84c004, 0xfe848005, 0xfe844004,
+    0xfe840000, 0xfe83c001, 0xfe838003, 0xfe834000, 0xfe830002, 0xfe82c004, 0xfe828000, 0xfe824159,
+    0xfe820000, 0xfe81c000, 0xfe818000, 0xfe814008, 0xfe810007, 0xfe80c028, 0xfe80805b, 0xfe804008,
+    0xfe800006, 0xfe7fc004, 0xfe7f83f5, 0xfe7f40c2, 0xfe7f005b, 0xfe7ec01e, 0xfe7e8002, 0xfe7e4021,
+    0xfe7e001a, 0xfe7dc02b, 0xfe7d8000, 0xfe7d4001, 0xfe7d0001, 0xfe7cc005, 0xfe7c806e, 0xfe7c42ff,
+    0xfe7c0006, 0xfe7bc000, 0xfe7b8008, 0xfe7b4172, 0xfe7b0007, 0xfe7ac063, 0xfe7a8108, 0xfe7a401b,
+    0xfe7a0004, 0xfe79c00b, 0xfe79829d, 0xfe7942f8, 0xfe790479, 0xfe78c004, 0xfe788008, 0xfe784003,
+    0xfe7800d3, 0xfe77c07a, 0xfe778001, 0xfe774260, 0xfe770025, 0xfe76c0ba, 0xfe76806d, 0xfe76400b,
+    0xfe760140, 0xfe75c005, 0xfe758005, 0xfe75400a, 0xfe750019, 0xfe74c024, 0xfe748007, 0xfe744090,
+    0xfe740000, 0xfe73c026, 0xfe738032, 0xfe73409a, 0xfe730165, 0xfe72c00c, 0xfe728431, 0xfe72406a,
+    0xfe7204aa, 0xfe71c0d9, 0xfe718503, 0xfe7143d1, 0xfe710228, 0xfe70c390, 0xfe708013, 0xfe70409e,
+    0xfe700002, 0xfe6fc1ee, 0xfe6f804a, 0xfe6f4205, 0xfe6f0002, 0xfe6ec008, 0xfe6e80ac, 0xfe6e4272,
+    0xfe6e0283, 0xfe6dc020, 0xfe6d800a, 0xfe6d4091, 0xfe6d0009, 0xfe6cc006, 0xfe6c8008, 0xfe6c4001,
+    0xfe6c025a, 0xfe6bc03b, 0xfe6b8000, 0xfe6b40e1, 0xfe6b043e, 0xfe6ac043, 0xfe6a80e2, 0xfe6a4058,
+    0xfe6a000c, 0xfe69c156, 0xfe6984b5, 0xfe694006, 0xfe690046, 0xfe68c000, 0xfe688037, 0xfe684006,
+    0xfe680008, 0xfe67c27a, 0xfe678000, 0xfe674010, 0xfe670000, 0xfe66c003, 0xfe668008, 0xfe664001,
+    0xfe66000e, 0xfe65c00b, 0xfe658000, 0xfe65400a, 0xfe650007, 0xfe64c0d3, 0xfe648096, 0xfe644005,
+    0xfe640001, 0xfe63c017, 0xfe638057, 0xfe634592, 0xfe630236, 0xfe62c3dd, 0xfe62808e, 0xfe6240e2,
+    0xfe6204e7, 0xfe61c30f, 0xfe618060, 0xfe61401f, 0xfe610012, 0xfe60c068, 0xfe6081ac, 0xfe604021,
+    0xfe600013, 0xfe5fc006, 0xfe5f8000, 0xfe5f401e, 0xfe5f0012, 0xfe5ec00a, 0xfe5e800a, 0xfe5e4006,
+    0xfe5e0043, 0xfe5dc001, 0xfe5d8004, 0xfe5d409e, 0xfe5d0000, 0xfe5cc01d, 0xfe5c8000, 0xfe5c4023,
+    0xfe5c0002, 0xfe5bc003, 0xfe5b817e, 0xfe5b400e, 0xfe5b000c, 0xfe5ac054, 0xfe5a8034, 0xfe5a400d,
+    0xfe5a0156, 0xfe59c000, 0xfe598035, 0xfe594009, 0xfe590081, 0xfe58c018, 0xfe588000, 0xfe584008,
+    0xfe58002d, 0xfe57c02d, 0xfe578001, 0xfe574001, 0xfe57000d, 0xfe56c03b, 0xfe568057, 0xfe56403c,
+    0xfe560000, 0xfe55c000, 0xfe558000, 0xfe55401c, 0xfe550000, 0xfe54c015, 0xfe548000, 0xfe544000,
+    0xfe540002, 0xfe53c024, 0xfe53801d, 0xfe534012, 0xfe530000, 0xfe52c00f, 0xfe528000, 0xfe524000,
+    0xfe520490, 0xfe51c011, 0xfe518000, 0xfe514000, 0xfe510174, 0xfe50c253, 0xfe508001, 0xfe504010,
+    0xfe500000, 0xfe4fc000, 0xfe4f800f, 0xfe4f4019, 0xfe4f00f8, 0xfe4ec000, 0xfe4e8000, 0xfe4e4000,
+    0xfe4e0001, 0xfe4dc000, 0xfe4d8000, 0xfe4d4000, 0xfe4d0000, 0xfe4cc001, 0xfe4c8000, 0xfe4c4000,
+    0xfe4c0000, 0xfe4bc000, 0xfe4b8000, 0xfe4b4000, 0xfe4b0000, 0xfe4ac000, 0xfe4a8000, 0xfe4a4001,
+    0xfe4a0001, 0xfe49c000, 0xfe498006, 0xfe494008, 0xfe490002, 0xfe48c138, 0xfe488000, 0xfe48401d,
+    0xfe48000e, 0xfe47c092, 0xfe478001, 0xfe474000, 0xfe470006, 0xfe46c000, 0xfe468015, 0xfe464003,
+    0xfe460001, 0xfe45c001, 0xfe458001, 0xfe454007, 0xfe450002, 0xfe44c000, 0xfe448002, 0xfe444009,
+    0xfe440013, 0xfe43c002, 0xfe438002, 0xfe434000, 0xfe430000, 0xfe42c000, 0xfe428002, 0xfe424008,
+    0xfe420057, 0xfe41c029, 0xfe418019, 0xfe41400d, 0xfe410012, 0xfe40c6d1, 0xfe40830f, 0xfe404617,
+    0xfe4000b5, 0xfe3fc2c9, 0xfe3f8090, 0xfe3f4004, 0xfe3f0560, 0xfe3ec505, 0xfe3e81a1, 0xfe3e4280,
+    0xfe3e00a3, 0xfe3dc457, 0xfe3d80ed, 0xfe3d403c, 0xfe3d01ae, 0xfe3cc017, 0xfe3c81a5, 0xfe3c401b,
+    0xfe3c002c, 0xfe3bc05d, 0xfe3b8017, 0xfe3b40d7, 0xfe3b0035, 0xfe3ac029, 0xfe3a81ab, 0xfe3a4002,
+    0xfe3a006b, 0xfe39c41e, 0xfe39821e, 0xfe394189, 0xfe39000d, 0xfe38c019, 0xfe388079, 0xfe384061,
+    0xfe38015c, 0xfe37c398, 0xfe378013, 0xfe374001, 0xfe37000d, 0xfe36c00b, 0xfe368048, 0xfe364033,
+    0xfe360002, 0xfe35c019, 0xfe358005, 0xfe354014, 0xfe350001, 0xfe34c019, 0xfe348012, 0xfe344005,
+    0xfe340000, 0xfe33c02b, 0xfe338010, 0xfe334006, 0xfe33003a, 0xfe32c016, 0xfe32872f, 0xfe3245ac,
+    0xfe3204ad, 0xfe31c32f, 0xfe318002, 0xfe314015, 0xfe3104e3, 0xfe30c328, 0xfe308046, 0xfe30400a,
+    0xfe3000d9, 0xfe2fc01c, 0xfe2f8281, 0xfe2f4027, 0xfe2f000a, 0xfe2ec00f, 0xfe2e8006, 0xfe2e4272,
+    0xfe2e0003, 0xfe2dc05d, 0xfe2d8015, 0xfe2d4000, 0xfe2d070f, 0xfe2cc005, 0xfe2c8582, 0xfe2c4594,
+    0xfe2c030d, 0xfe2bc005, 0xfe2b8005, 0xfe2b450f, 0xfe2b0452, 0xfe2ac129, 0xfe2a82e2, 0xfe2a400d,
+    0xfe2a0065, 0xfe29c3c3, 0xfe29806b, 0xfe29407e, 0xfe290011, 0xfe28c05f, 0xfe288010, 0xfe284079,
+    0xfe280046, 0xfe27c00b, 0xfe278002, 0xfe274260, 0xfe2701b4, 0xfe26c006, 0xfe2680f1, 0xfe264000,
+    0xfe260002, 0xfe25c6e3, 0xfe2583d7, 0xfe25400e, 0xfe250003, 0xfe24c007, 0xfe248007, 0xfe244005,
+    0xfe240005, 0xfe23c005, 0xfe238001, 0xfe234003, 0xfe230328, 0xfe22c01c, 0xfe22801e, 0xfe224003,
+    0xfe220000, 0xfe21c77c, 0xfe2181bb, 0xfe2145ce, 0xfe2100ba, 0xfe20c2ce, 0xfe20855d, 0xfe204487,
+    0xfe200520, 0xfe1fc4bb, 0xfe1f8120, 0xfe1f42d7, 0xfe1f007d, 0xfe1ec483, 0xfe1e8412, 0xfe1e405a,
+    0xfe1e000f, 0xfe1dc01d, 0xfe1d8084, 0xfe1d40ee, 0xfe1d006a, 0xfe1cc035, 0xfe1c801c, 0xfe1c4007,
+    0xfe1c06bf, 0xfe1bc05a, 0xfe1b82cf, 0xfe1b404c, 0xfe1b0070, 0xfe1ac279, 0xfe1a86d9, 0xfe1a43ec,
+    0xfe1a0012, 0xfe19c01e, 0xfe19800b, 0xfe194076, 0xfe190029, 0xfe18c1c5, 0xfe188018, 0xfe184006,
+    0xfe180004, 0xfe17c004, 0xfe178025, 0xfe174000, 0xfe170011, 0xfe16c000, 0xfe168001, 0xfe164019,
+    0xfe160004, 0xfe15c01e, 0xfe158017, 0xfe154024, 0xfe150001, 0xfe14c0b8, 0xfe148015, 0xfe14400b,
+    0xfe140033, 0xfe13c00d, 0xfe13855d, 0xfe13452e, 0xfe130038, 0xfe12c118, 0xfe128017, 0xfe124396,
+    0xfe12001a, 0xfe11c114, 0xfe11802f, 0xfe11404a, 0xfe110018, 0xfe10c000, 0xfe108005, 0xfe104008,
+    0xfe100029, 0xfe0fc05d, 0xfe0f8266, 0xfe0f4002, 0xfe0f017b, 0xfe0ec4e6, 0xfe0e82ea, 0xfe0e406b,
+    0xfe0e0014, 0xfe0dc011, 0xfe0d847f, 0xfe0d4176, 0xfe0d002d, 0xfe0cc008, 0xfe0c8010, 0xfe0c41ac,
+    0xfe0c0111, 0xfe0bc003, 0xfe0b8009, 0xfe0b4001, 0xfe0b0006, 0xfe0ac024, 0xfe0a800b, 0xfe0a4009,
+    0xfe0a000f, 0xfe09c00e, 0xfe09801d, 0xfe094002, 0xfe090034, 0xfe08c12a, 0xfe088216, 0xfe08408f,
+    0xfe080001, 0xfe07c38b, 0xfe0782db, 0xfe074009, 0xfe070004, 0xfe06c004, 0xfe068001, 0xfe06409d,
+    0xfe06000a, 0xfe05c00b, 0xfe058000, 0xfe054029, 0xfe050005, 0xfe04c00a, 0xfe04800a, 0xfe044012,
+    0xfe040001, 0xfe03c000, 0xfe0380aa, 0xfe034038, 0xfe03003d, 0xfe02c001, 0xfe028019, 0xfe02469f,
+    0xfe020461, 0xfe01c196, 0xfe018001, 0xfe014013, 0xfe010192, 0xfe00c0a7, 0xfe008216, 0xfe00400a,
+};
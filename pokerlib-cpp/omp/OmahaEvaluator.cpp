@@ -0,0 +1,151 @@
+#include "OmahaEvaluator.h"
+
+#include <algorithm>
+
+namespace omp {
+
+	unsigned OmahaEvaluator::PAIR_INDEXES[RANK_COUNT][RANK_COUNT];
+	std::vector<uint16_t> OmahaEvaluator::RANK_TABLE;
+
+	// Binomial coefficients for ranking the board rank multisets.
+	static const unsigned BINOMIALS[17][6] = {
+		{ 1 }, { 1, 1 }, { 1, 2, 1 }, { 1, 3, 3, 1 }, { 1, 4, 6, 4, 1 }, { 1, 5, 10, 10, 5, 1 },
+		{ 1, 6, 15, 20, 15, 6 }, { 1, 7, 21, 35, 35, 21 }, { 1, 8, 28, 56, 70, 56 }, { 1, 9, 36, 84, 126, 126 },
+		{ 1, 10, 45, 120, 210, 252 }, { 1, 11, 55, 165, 330, 462 }, { 1, 12, 66, 220, 495, 792 },
+		{ 1, 13, 78, 286, 715, 1287 }, { 1, 14, 91, 364, 1001, 2002 }, { 1, 15, 105, 455, 1365, 3003 },
+		{ 1, 16, 120, 560, 1820, 4368 } };
+
+	OmahaEvaluator::OmahaEvaluator()
+	{
+		static bool initVar = (initRankTable(), true);
+		(void)initVar;
+	}
+
+	// Maps a multiset of 5 ranks to range [0, 6188). Rank r_i of the sorted ranks is mapped to r_i + i, which makes them
+	// unique, and the resulting combination is ranked in the combinatorial number system.
+	unsigned OmahaEvaluator::getBoardIndex(const unsigned* ranks)
+	{
+		// Sorting network written with masks, because compilers tend to turn min/max into unpredictable branches.
+		unsigned r[BOARD_CARDS] = { ranks[0], ranks[1], ranks[2], ranks[3], ranks[4] };
+		auto sort2 = [&r](unsigned i, unsigned j) {
+			unsigned swap = (r[i] ^ r[j]) & (0 - (unsigned)(r[j] < r[i]));
+			r[i] ^= swap;
+			r[j] ^= swap;
+		};
+		sort2(0, 1);
+		sort2(3, 4);
+		sort2(2, 4);
+		sort2(2, 3);
+		sort2(0, 3);
+		sort2(0, 2);
+		sort2(1, 4);
+		sort2(1, 3);
+		sort2(1, 2);
+		unsigned idx = 0;
+		for (unsigned i = 0; i < BOARD_CARDS; ++i)
+			idx += BINOMIALS[r[i] + i][i + 1];
+		return idx;
+	}
+
+	OmahaEvaluator::Board::Board(const uint8_t* cards)
+	{
+		unsigned ranks[BOARD_CARDS], suitCounts[SUIT_COUNT] = {};
+		for (unsigned i = 0; i < BOARD_CARDS; ++i) {
+			ranks[i] = cards[i] >> RANK_SHIFT;
+			++suitCounts[cards[i] & SUIT_MASK];
+		}
+		mRow = getBoardIndex(ranks) * PAIR_COUNT;
+
+		// Only one suit can have 3 or more cards on the board, so that's the only possible flush suit.
+		mFlushSuit = ~0u;
+		mFlushTripleCount = 0;
+		for (unsigned suit = 0; suit < SUIT_COUNT; ++suit) {
+			if (suitCounts[suit] >= 3)
+				mFlushSuit = suit;
+		}
+		if (mFlushSuit == ~0u)
+			return;
+
+		uint8_t suited[BOARD_CARDS];
+		unsigned suitedCount = 0;
+		for (unsigned i = 0; i < BOARD_CARDS; ++i) {
+			if ((cards[i] & SUIT_MASK) == mFlushSuit)
+				suited[suitedCount++] = cards[i];
+		}
+		for (unsigned i = 0; i < suitedCount; ++i)
+			for (unsigned j = i + 1; j < suitedCount; ++j)
+				for (unsigned k = j + 1; k < suitedCount; ++k)
+					mFlushTriples[mFlushTripleCount++] = Hand::empty() + suited[i] + suited[j] + suited[k];
+	}
+
+	// Flush can only happen with two hole cards of the board's flush suit.
+	uint16_t OmahaEvaluator::evaluateFlush(const uint8_t* holeCards, unsigned holeCardCount, const Board& board,
+		uint16_t best) const
+	{
+		uint8_t suited[MAX_HOLE_CARDS];
+		unsigned suitedCount = 0;
+		for (unsigned i = 0; i < holeCardCount; ++i) {
+			if ((holeCards[i] & SUIT_MASK) == board.mFlushSuit)
+				suited[suitedCount++] = holeCards[i];
+		}
+
+		for (unsigned i = 0; i < suitedCount; ++i) {
+			for (unsigned j = i + 1; j < suitedCount; ++j) {
+				Hand pair = Hand::empty() + suited[i] + suited[j];
+				for (unsigned k = 0; k < board.mFlushTripleCount; ++k)
+					best = std::max(best, mEval.evaluate(pair + board.mFlushTriples[k]));
+			}
+		}
+		return best;
+	}
+
+	// Fills the table of best non-flush hands for each board rank multiset and hole card rank pair by evaluating all
+	// board rank triples with the pair. Impossible rank combinations (5 or more cards of the same rank) are left 0.
+	void OmahaEvaluator::initRankTable()
+	{
+		for (unsigned r1 = 0; r1 < RANK_COUNT; ++r1)
+			for (unsigned r2 = r1; r2 < RANK_COUNT; ++r2)
+				PAIR_INDEXES[r1][r2] = PAIR_INDEXES[r2][r1] = r2 * (r2 + 1) / 2 + r1;
+
+		RANK_TABLE.assign(BOARD_RANK_COUNT * PAIR_COUNT, 0);
+		HandEvaluator eval;
+
+		unsigned ranks[BOARD_CARDS];
+		for (ranks[0] = 0; ranks[0] < RANK_COUNT; ++ranks[0])
+		for (ranks[1] = ranks[0]; ranks[1] < RANK_COUNT; ++ranks[1])
+		for (ranks[2] = ranks[1]; ranks[2] < RANK_COUNT; ++ranks[2])
+		for (ranks[3] = ranks[2]; ranks[3] < RANK_COUNT; ++ranks[3])
+		for (ranks[4] = ranks[3]; ranks[4] < RANK_COUNT; ++ranks[4]) {
+			uint16_t* row = RANK_TABLE.data() + getBoardIndex(ranks) * PAIR_COUNT;
+
+			for (unsigned r1 = 0; r1 < RANK_COUNT; ++r1) {
+				for (unsigned r2 = r1; r2 < RANK_COUNT; ++r2) {
+					unsigned handRanks[7] = { r1, r2, ranks[0], ranks[1], ranks[2], ranks[3], ranks[4] };
+					unsigned rankCounts[RANK_COUNT] = {};
+					bool possible = true;
+					for (unsigned r : handRanks)
+						possible &= ++rankCounts[r] <= SUIT_COUNT;
+					if (!possible)
+						continue;
+
+					// Suits only need to make the cards unique, because flushes are ignored.
+					uint16_t best = 0;
+					for (unsigned i = 0; i < BOARD_CARDS; ++i) {
+						for (unsigned j = i + 1; j < BOARD_CARDS; ++j) {
+							for (unsigned k = j + 1; k < BOARD_CARDS; ++k) {
+								unsigned subRanks[5] = { r1, r2, ranks[i], ranks[j], ranks[k] };
+								unsigned suits[RANK_COUNT] = {};
+								Hand hand = Hand::empty();
+								for (unsigned r : subRanks)
+									hand += (r << RANK_SHIFT) | suits[r]++;
+								best = std::max(best, eval.evaluate<false>(hand));
+							}
+						}
+					}
+					row[PAIR_INDEXES[r1][r2]] = best;
+				}
+			}
+		}
+	}
+
+}
@@ -0,0 +1,85 @@
+#ifndef OMP_OMAHA_EVALUATOR_H
+#define OMP_OMAHA_EVALUATOR_H
+
+#include "HandEvaluator.h"
+#include "Hand.h"
+#include "Constants.h"
+#include <cstdint>
+#include <vector>
+
+namespace omp {
+
+// Evaluates Omaha hands with 4 (PLO4) or 5 (PLO5) hole cards and a full board. The hand must be made of exactly
+// two hole cards and three board cards. Non-flush hands are looked up from a table that has the best hand for every
+// combination of board ranks and two hole card ranks, so a hand takes one lookup per hole card pair instead of
+// evaluating all 60 or 100 five card hands. Flushes are only evaluated when the board and hole cards have enough cards
+// of the same suit. The ranks are the same as with HandEvaluator.
+class OmahaEvaluator
+{
+public:
+    // Board cards and data that is shared by all hands evaluated on the same board.
+    class Board
+    {
+    public:
+        Board(const uint8_t* cards);
+
+    private:
+        unsigned mRow;
+        unsigned mFlushSuit;
+        unsigned mFlushTripleCount;
+        Hand mFlushTriples[10];
+
+        friend class OmahaEvaluator;
+    };
+
+    // Builds the rank table when the first evaluator is created (thread-safe).
+    OmahaEvaluator();
+
+    // Returns the rank of the best hand using exactly two of the hole cards and three board cards. holeCardCount is
+    // 4 or 5 (at least 2 works too).
+    uint16_t evaluate(const uint8_t* holeCards, unsigned holeCardCount, const Board& board) const
+    {
+        omp_assert(holeCardCount >= 2 && holeCardCount <= MAX_HOLE_CARDS);
+
+        // Best non-flush hand for every pair of hole card ranks.
+        const uint16_t* row = RANK_TABLE.data() + board.mRow;
+        uint16_t best = 0;
+        for (unsigned i = 0; i < holeCardCount; ++i) {
+            unsigned r1 = holeCards[i] >> RANK_SHIFT;
+            for (unsigned j = i + 1; j < holeCardCount; ++j) {
+                uint16_t value = row[PAIR_INDEXES[r1][holeCards[j] >> RANK_SHIFT]];
+                best = value > best ? value : best;
+            }
+        }
+
+        if (board.mFlushTripleCount)
+            best = evaluateFlush(holeCards, holeCardCount, board, best);
+        return best;
+    }
+
+    // Same as above, but for a board given as 5 cards.
+    uint16_t evaluate(const uint8_t* holeCards, unsigned holeCardCount, const uint8_t* boardCards) const
+    {
+        return evaluate(holeCards, holeCardCount, Board(boardCards));
+    }
+
+    static const unsigned MAX_HOLE_CARDS = 5;
+
+private:
+    uint16_t evaluateFlush(const uint8_t* holeCards, unsigned holeCardCount, const Board& board, uint16_t best) const;
+    static void initRankTable();
+    static unsigned getBoardIndex(const unsigned* ranks);
+
+    // Number of different rank pairs and 5 card rank multisets (17 choose 5).
+    static const unsigned PAIR_COUNT = RANK_COUNT * (RANK_COUNT + 1) / 2;
+    static const unsigned BOARD_RANK_COUNT = 6188;
+
+    HandEvaluator mEval;
+
+    static unsigned PAIR_INDEXES[RANK_COUNT][RANK_COUNT];
+    static std::vector<uint16_t> RANK_TABLE;
+};
+
+}
+
+#endif // OMP_OMAHA_EVALUATOR_H
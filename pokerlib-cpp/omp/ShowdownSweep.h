@@ -0,0 +1,105 @@
+#ifndef OMP_SHOWDOWN_SWEEP_H
+#define OMP_SHOWDOWN_SWEEP_H
+
+#include "Constants.h"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace omp {
+
+// Heads-up showdowns between all the combos of two ranges on one board. The combos are sorted by rank and swept from
+// the weakest up, so that a combo beats the opponent combos that came before it, except the ones that share a card
+// with it, which are counted by card and subtracted. Ties are found the same way within a rank. The cost grows with
+// the number of combos instead of the number of combo pairs.
+class ShowdownSweep
+{
+public:
+    void clear()
+    {
+        mCombos.clear();
+    }
+
+    // Adds a combo of player 0 or 1 with its rank on the board.
+    void add(unsigned player, unsigned rank, unsigned card1, unsigned card2)
+    {
+        unsigned high = std::max(card1, card2), low = std::min(card1, card2);
+        mCombos.push_back(rank << KEY_RANK_SHIFT | player << KEY_PLAYER_SHIFT | high << KEY_CARD_BITS | low);
+    }
+
+    size_t size() const
+    {
+        return mCombos.size();
+    }
+
+    // Counts the showdowns won by each player and the ties, over all pairs of combos that don't share a card.
+    void count(uint64_t* wins, uint64_t& ties)
+    {
+        sortByRank();
+
+        wins[0] = wins[1] = ties = 0;
+        unsigned below[2] = {}, belowByCard[2][CARD_COUNT] = {};
+        for (size_t i = 0, j; i < mCombos.size(); i = j) {
+            for (j = i; j < mCombos.size() && mCombos[j] >> KEY_RANK_SHIFT == mCombos[i] >> KEY_RANK_SHIFT; ++j) {
+                unsigned player = mCombos[j] >> KEY_PLAYER_SHIFT & 1;
+                unsigned c1 = mCombos[j] >> KEY_CARD_BITS & KEY_CARD_MASK, c2 = mCombos[j] & KEY_CARD_MASK;
+                ++mEqual[player];
+                ++mEqualByCard[player][c1];
+                ++mEqualByCard[player][c2];
+                mEqualCombos[c1][c2] |= 1 << player;
+            }
+            for (size_t k = i; k < j; ++k) {
+                unsigned player = mCombos[k] >> KEY_PLAYER_SHIFT & 1;
+                unsigned c1 = mCombos[k] >> KEY_CARD_BITS & KEY_CARD_MASK, c2 = mCombos[k] & KEY_CARD_MASK;
+                unsigned opponent = player ^ 1;
+                wins[player] += below[opponent] - belowByCard[opponent][c1] - belowByCard[opponent][c2];
+                // The same combo of the opponent shares both cards, so it was subtracted twice.
+                if (player == 0)
+                    ties += mEqual[1] - mEqualByCard[1][c1] - mEqualByCard[1][c2] + (mEqualCombos[c1][c2] >> 1);
+            }
+            for (size_t k = i; k < j; ++k) {
+                unsigned player = mCombos[k] >> KEY_PLAYER_SHIFT & 1;
+                unsigned c1 = mCombos[k] >> KEY_CARD_BITS & KEY_CARD_MASK, c2 = mCombos[k] & KEY_CARD_MASK;
+                ++below[player];
+                ++belowByCard[player][c1];
+                ++belowByCard[player][c2];
+                --mEqualByCard[player][c1];
+                --mEqualByCard[player][c2];
+                mEqualCombos[c1][c2] = 0;
+            }
+            mEqual[0] = mEqual[1] = 0;
+        }
+    }
+
+private:
+    // The combos are sort keys with the 16-bit rank in the high bits, then the player and the two cards.
+    static const unsigned KEY_CARD_BITS = 6;
+    static const unsigned KEY_CARD_MASK = (1 << KEY_CARD_BITS) - 1;
+    static const unsigned KEY_PLAYER_SHIFT = 2 * KEY_CARD_BITS;
+    static const unsigned KEY_RANK_SHIFT = KEY_PLAYER_SHIFT + 1;
+
+    // Two passes of radix sort on the ranks.
+    void sortByRank()
+    {
+        mSortedCombos.resize(mCombos.size());
+        for (unsigned shift = KEY_RANK_SHIFT; shift < KEY_RANK_SHIFT + 16; shift += 8) {
+            unsigned offsets[257] = {};
+            for (uint32_t combo : mCombos)
+                ++offsets[(combo >> shift & 0xff) + 1];
+            for (unsigned i = 0; i < 256; ++i)
+                offsets[i + 1] += offsets[i];
+            for (uint32_t combo : mCombos)
+                mSortedCombos[offsets[combo >> shift & 0xff]++] = combo;
+            mCombos.swap(mSortedCombos);
+        }
+    }
+
+    std::vector<uint32_t> mCombos, mSortedCombos;
+    // Counts for the current rank, which are cleared again after each rank.
+    unsigned mEqual[2] = {}, mEqualByCard[2][CARD_COUNT] = {};
+    uint8_t mEqualCombos[CARD_COUNT][CARD_COUNT] = {};
+};
+
+}
+
+#endif // OMP_SHOWDOWN_SWEEP_H
@@ -0,0 +1,63 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace omp {
+
+	ThreadPool::ThreadPool(unsigned threadCount)
+	{
+		if (threadCount == 0)
+			threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		for (unsigned i = 0; i < threadCount; ++i)
+			mThreads.emplace_back([this] { work(); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStopping = true;
+		}
+		mTaskAdded.notify_all();
+		for (auto& t : mThreads)
+			t.join();
+	}
+
+	ThreadPool& ThreadPool::instance()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	void ThreadPool::submit(std::function<bool()> task, int priority)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mTasks.push(Task{ std::move(task), priority, mNextSequence++ });
+		}
+		mTaskAdded.notify_one();
+	}
+
+	// Worker loop. Tasks that want to run again are requeued with a new sequence number, which puts them behind the
+	// other tasks with the same priority.
+	void ThreadPool::work()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		for (;;) {
+			mTaskAdded.wait(lock, [this] { return mStopping || !mTasks.empty(); });
+			if (mTasks.empty())
+				return;
+
+			Task task = std::move(const_cast<Task&>(mTasks.top()));
+			mTasks.pop();
+			lock.unlock();
+			bool again = task.run();
+			lock.lock();
+			if (again) {
+				task.sequence = mNextSequence++;
+				mTasks.push(std::move(task));
+			}
+		}
+	}
+
+}
@@ -0,0 +1,68 @@
+#ifndef OMP_THREAD_POOL_H
+#define OMP_THREAD_POOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <queue>
+#include <cstdint>
+
+namespace omp {
+
+// Fixed set of worker threads that run tasks from a shared queue. Tasks with higher priority run first and tasks with
+// the same priority run in submission order. A task returns true if it wants to run again, in which case it goes to
+// the back of the queue. Long running work should be split into short slices this way, so that concurrent users of
+// the pool share the threads fairly.
+class ThreadPool
+{
+public:
+    // Starts threadCount workers, or one for each hardware thread if threadCount is 0.
+    ThreadPool(unsigned threadCount = 0);
+
+    // Runs the remaining tasks and stops the workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Process-wide pool used by EquityCalculator by default. Created on first use (thread-safe).
+    static ThreadPool& instance();
+
+    // Adds a task to the queue. Can be called from any thread, including the workers.
+    void submit(std::function<bool()> task, int priority = 0);
+
+    unsigned threadCount() const
+    {
+        return (unsigned)mThreads.size();
+    }
+
+private:
+    struct Task
+    {
+        std::function<bool()> run;
+        int priority;
+        uint64_t sequence;
+
+        bool operator<(const Task& other) const
+        {
+            if (priority != other.priority)
+                return priority < other.priority;
+            return sequence > other.sequence;
+        }
+    };
+
+    void work();
+
+    std::vector<std::thread> mThreads;
+    std::mutex mMutex;
+    std::condition_variable mTaskAdded;
+    std::priority_queue<Task> mTasks;
+    uint64_t mNextSequence = 0;
+    bool mStopping = false;
+};
+
+}
+
+#endif // OMP_THREAD_POOL_H
@@ -24,12 +24,37 @@
     #endif
 #endif
 
+// Detect AVX2.
+#ifndef OMP_AVX2
+    #if __AVX2__
+        #define OMP_AVX2 1
+    #endif
+#endif
+
 #if _MSC_VER
     #define OMP_FORCE_INLINE __forceinline
+#elif __GNUC__ || __clang__
+    #define OMP_FORCE_INLINE inline __attribute__((always_inline))
 #else
-    #define OMP_FORCE_INLINE
+    #define OMP_FORCE_INLINE inline
 #endif
 
+// Runtime CPU dispatch. Kernels that use AVX2 intrinsics directly are compiled with OMP_TARGET_AVX2 and selected with
+// cpuSupportsAvx2(). Everything else, including the SSE4.1 code paths of Hand (OMP_SSE4), uses the instruction set
+// that the compiler targets. Nothing is dispatched when the compiler already targets AVX2 or when OMP_NO_DISPATCH is
+// defined.
+#if !OMP_AVX2 && OMP_X64 && !defined(OMP_NO_DISPATCH) && (_MSC_VER || __GNUC__ >= 5 || __clang__)
+    #define OMP_AVX2_DISPATCH 1
+    #if _MSC_VER
+        #define OMP_TARGET_AVX2
+    #else
+        #define OMP_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#else
+    #define OMP_TARGET_AVX2
+#endif
+#define OMP_AVX2_KERNELS (OMP_AVX2 || OMP_AVX2_DISPATCH)
+
 namespace omp {
 
 inline unsigned countTrailingZeros(unsigned x)
@@ -54,6 +79,44 @@ inline unsigned countLeadingZeros(unsigned x)
     #endif
 }
 
+// Checks whether the CPU and OS support AVX2.
+inline bool cpuSupportsAvx2()
+{
+    #if OMP_AVX2
+    return true;
+    #elif _MSC_VER && OMP_X64
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0, avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+    #elif (__GNUC__ || __clang__) && OMP_X64
+    return __builtin_cpu_supports("avx2");
+    #else
+    return false;
+    #endif
+}
+
+// Returns the name of the instruction set used by the AVX2 kernels (OMP_TARGET_AVX2) on this CPU: "avx2" if they are
+// selected, otherwise what the rest of the code is compiled for.
+inline const char* dispatchTarget()
+{
+    #if OMP_AVX2_KERNELS
+    if (cpuSupportsAvx2())
+        return "avx2";
+    #endif
+    #if OMP_SSE4
+    return "sse4.1";
+    #else
+    return "default";
+    #endif
+}
+
 inline unsigned bitCount(unsigned x)
 {
     #if _MSC_VER
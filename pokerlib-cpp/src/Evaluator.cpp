@@ -21,40 +21,112 @@ namespace pokerlib {
 		return playerEval == *std::max_element(opponentEvals.begin(), opponentEvals.end());
 	}
 
-	std::vector<Card> GetFiveBestCards(std::vector<Card> cards) {
-		if (cards.size() <= 5) {
-			return cards;
+	// Tries every 5-card subset, for more cards than the evaluator can rank at once. Later subsets win ties, so ties
+	// keep the higher cards.
+	static uint64_t GetFiveBestCardsMaskExhaustive(const unsigned* cards, unsigned n) {
+		omp::HandEvaluator ev;
+		uint16_t bestEval = 0;
+		uint64_t bestMask = 0;
+
+		for (unsigned a = 0; a < n; ++a) {
+			omp::Hand hand1 = omp::Hand::empty() + omp::Hand(cards[a]);
+			for (unsigned b = a + 1; b < n; ++b) {
+				omp::Hand hand2 = hand1 + omp::Hand(cards[b]);
+				for (unsigned c = b + 1; c < n; ++c) {
+					omp::Hand hand3 = hand2 + omp::Hand(cards[c]);
+					for (unsigned d = c + 1; d < n; ++d) {
+						omp::Hand hand4 = hand3 + omp::Hand(cards[d]);
+						for (unsigned e = d + 1; e < n; ++e) {
+							uint16_t eval = ev.evaluate(hand4 + omp::Hand(cards[e]));
+							if (eval >= bestEval) {
+								bestEval = eval;
+								bestMask = (1ull << cards[a]) | (1ull << cards[b]) | (1ull << cards[c])
+									| (1ull << cards[d]) | (1ull << cards[e]);
+							}
+						}
+					}
+				}
+			}
 		}
 
-		// Keep removing the card that decreases the score the least until 5 cards are left
-		omp::HandEvaluator ev;
+		return bestMask;
+	}
 
-		while (cards.size() > 5) {
-			uint16_t maxScore = 0;
-			int maxIndex = -1;
+	uint64_t GetFiveBestCardsMask(uint64_t cardMask) {
+		cardMask &= (1ull << omp::CARD_COUNT) - 1;
+		unsigned cardCount = omp::bitCount(cardMask);
 
-			for (int i = 0; i < cards.size(); i++) {
-				std::vector<Card> hand;
+		if (cardCount <= 5) {
+			return cardMask;
+		}
+
+		unsigned cards[omp::CARD_COUNT];
+		unsigned n = 0;
+		omp::Hand hand = omp::Hand::empty();
+
+		for (uint64_t m = cardMask; m; m &= m - 1) {
+			unsigned low = (unsigned)m;
+			cards[n] = low ? omp::countTrailingZeros(low) : 32 + omp::countTrailingZeros((unsigned)(m >> 32));
+			hand += cards[n++];
+		}
+
+		if (n > 7) {
+			return GetFiveBestCardsMaskExhaustive(cards, n);
+		}
+
+		// A 6 or 7 card hand is ranked by its best 5 cards, so the answer is the first subset with the same
+		// evaluation. Lowest cards are tried first, so ties keep the higher cards.
+		omp::HandEvaluator ev;
+		uint16_t target = ev.evaluate(hand);
+
+		if (n == 6) {
+			for (unsigned i = 0; i < n; ++i) {
+				if (ev.evaluate(hand - omp::Hand(cards[i])) == target) {
+					return cardMask & ~(1ull << cards[i]);
+				}
+			}
+		}
+		else {
+			for (unsigned i = 0; i < n; ++i) {
+				omp::Hand hand6 = hand - omp::Hand(cards[i]);
 
-				for (size_t j = 0; j < cards.size(); j++) {
-					if (i != j) {
-						hand.push_back(cards[j]);
+				for (unsigned j = i + 1; j < n; ++j) {
+					if (ev.evaluate(hand6 - omp::Hand(cards[j])) == target) {
+						return cardMask & ~(1ull << cards[i]) & ~(1ull << cards[j]);
 					}
 				}
+			}
+		}
 
-				uint16_t eval = ev.evaluate(Card::CreateHand(hand));
+		assert(false);
+		return cardMask;
+	}
 
-				if (eval > maxScore) {
-					maxScore = eval;
-					maxIndex = i;
-				}
+	std::vector<Card> GetFiveBestCards(std::vector<Card> cards) {
+		if (cards.size() <= 5) {
+			return cards;
+		}
+
+		uint64_t cardMask = 0;
+		for (const auto& card : cards) {
+			int index = Card::RankSuitToCardIndex(card.rank, card.suit);
+			if (index >= 0 && index < (int)omp::CARD_COUNT) {
+				cardMask |= 1ull << index;
 			}
+		}
+
+		uint64_t bestMask = GetFiveBestCardsMask(cardMask);
 
-			// Remove the card that gives the highest score when removed
-			if (maxIndex >= 0) {
-				cards.erase(cards.begin() + maxIndex);
+		// Keep the original order. A repeated card is only kept once, and cards that aren't valid are dropped.
+		size_t kept = 0;
+		for (size_t i = 0; i < cards.size(); ++i) {
+			int index = Card::RankSuitToCardIndex(cards[i].rank, cards[i].suit);
+			if (index >= 0 && index < (int)omp::CARD_COUNT && (bestMask & (1ull << index))) {
+				bestMask &= ~(1ull << index);
+				cards[kept++] = cards[i];
 			}
 		}
+		cards.erase(cards.begin() + kept, cards.end());
 
 		return cards;
 	}
@@ -79,20 +151,15 @@ namespace pokerlib {
 		}
 		return evals;
 	}
+	uint64_t GetCardMask(const std::vector<Card>& cards) {
+		uint64_t cardMask = 0;
+		for (const auto& card : cards) {
+			cardMask |= 1ull << Card::RankSuitToCardIndex(card.rank, card.suit);
+		}
+		return cardMask;
+	}
 
-	std::vector<PlayerResults> Evaluate(std::vector<std::string> hands, std::string boardStr, std::string deadStr) {
-		assert(hands.size() > 1);
-		assert(boardStr.length() <= 5 * 2);
-
-		std::unordered_map<unsigned int, GameState> stateMap = {
-			{ 0, GameState::PreFlop },
-			{ 3, GameState::Flop },
-			{ 4, GameState::Turn },
-			{ 5, GameState::River }
-		};
-
-		GameState gameState = stateMap[boardStr.length() / 2];
-
+	std::vector<PlayerResults> CreatePlayers(const std::vector<std::string>& hands) {
 		std::vector<PlayerResults> players(hands.size());
 
 		// Setup hands 
@@ -100,22 +167,48 @@ namespace pokerlib {
 			players[i].hand = Card::GetCards(hands[i]);
 		}
 
-		// Calculate winning / tying percentages
-		omp::EquityCalculator eq;
+		return players;
+	}
+
+	// Fills in the current evaluation and win status of each player
+	void EvaluateShowdown(std::vector<PlayerResults>& players, const std::vector<Card>& board) {
+		// Calculate evaluation
+		const auto playerHands = GetPlayerHands(players);
+		const auto evals = EvaluatePlayers(playerHands, board);
 
-		// Construct ranges
-		std::vector<omp::CardRange> ranges;
 		for (auto&& player : players) {
-			ranges.push_back(player.hand[0].to_string() + player.hand[1].to_string());
+			// OMFG this is so bad
+			const unsigned int playerIndex = &player - &players[0];
+
+			player.eval = evals[playerIndex];
 		}
 
-		std::vector<Card> dead = Card::GetCards(deadStr);
-		std::vector<Card> board = Card::GetCards(boardStr);
+		//determine win status
+		for (auto&& player : players) {
+			std::vector<uint16_t> opponentEvals;
+			for (auto&& otherPlayer : players) {
+				if (&player != &otherPlayer) {
+					opponentEvals.push_back(otherPlayer.eval);
+				}
+			}
 
-		auto boardMask = omp::CardRange::getCardMask(boardStr);
-		auto deadMask = omp::CardRange::getCardMask(deadStr);
+			player.winStatus = IsWinning(opponentEvals, player.eval) ? WinStatus::Ahead : (IsTie(opponentEvals, player.eval) ? WinStatus::Tied : WinStatus::Behind);
+		}
+	}
 
-		if (eq.start(ranges, boardMask, deadMask, true)) {
+	// Finds the cards that improve each player who isn't ahead, given the win statuses from EvaluateShowdown()
+	void FindImmediateOuts(std::vector<PlayerResults>& players, const std::vector<Card>& board, const std::vector<Card>& dead) {
+		std::unordered_map<unsigned int, GameState> stateMap = {
+			{ 0, GameState::PreFlop },
+			{ 3, GameState::Flop },
+			{ 4, GameState::Turn },
+			{ 5, GameState::River }
+		};
+
+		GameState gameState = stateMap[(unsigned int)board.size()];
+
+		//calculate immediate outs
+		if (gameState == GameState::Flop || gameState == GameState::Turn) {
 			// Make a copy of dead cards for later use
 			std::vector<Card> allDeadCards = dead;
 
@@ -131,87 +224,235 @@ namespace pokerlib {
 
 			deck.RemoveCards(allDeadCards);
 			auto deckCards = deck.GetRemainingCards();
-
-			// Calculate evaluation
 			const auto playerHands = GetPlayerHands(players);
-			const auto evals = EvaluatePlayers(playerHands, board);
 
 			for (auto&& player : players) {
-				// OMFG this is so bad
+
+				// Skip if player is already ahead
+				if (player.winStatus == WinStatus::Ahead) {
+					continue;
+				}
+
 				const unsigned int playerIndex = &player - &players[0];
 
-				player.eval = evals[playerIndex];
-			}
+				for (auto&& card : deckCards) {
+					std::vector<Card> boardWithOut(board);
+					boardWithOut.push_back(card);
+					auto outEvals = EvaluatePlayers(playerHands, boardWithOut);
 
-			//determine win status
-			for (auto&& player : players) {
-				std::vector<uint16_t> opponentEvals;
-				for (auto&& otherPlayer : players) {
-					if (&player != &otherPlayer) {
-						opponentEvals.push_back(otherPlayer.eval);
+					const auto playerEval = outEvals[playerIndex];
+
+					//remove player eval
+					outEvals.erase(outEvals.begin() + playerIndex);
+
+					//if we are tied right now we need to win to improve
+					if (player.winStatus == WinStatus::Tied) {
+						if (IsWinning(outEvals, playerEval)) {
+							player.immediateOutsToWin.push_back(card);
+
+							continue;
+						}
 					}
-				}
 
-				player.winStatus = IsWinning(opponentEvals, player.eval) ? WinStatus::Ahead : (IsTie(opponentEvals, player.eval) ? WinStatus::Tied : WinStatus::Behind);
+					// if we are behind right now we need to tie or win to improve
+					if (player.winStatus == WinStatus::Behind) {
+						if (IsWinning(outEvals, playerEval)) {
+							player.immediateOutsToWin.push_back(card);
+						}
+						else if (IsTie(outEvals, playerEval)) {
+							player.immediateOutsToTie.push_back(card);
+						}
+					}
+				}
 			}
+		}
+	}
 
-			//calculate immediate outs
-			if (gameState == GameState::Flop || gameState == GameState::Turn) {
-				for (auto&& player : players) {
+	// Fills in the counts and percentages the same way as they come from omp::EquityCalculator
+	void SetEquities(std::vector<PlayerResults>& players, const uint64_t* wins, const uint64_t* ties, uint64_t hands) {
+		for (size_t i = 0; i < players.size(); i++) {
+			players[i].numWins = wins[i];
+			players[i].numTies = ties[i];
 
-					// Skip if player is already ahead
-					if (player.winStatus == WinStatus::Ahead) {
-						continue;
-					}
+			players[i].winPercentage = float(players[i].numWins) / hands;
+			players[i].tiePercentage = float(players[i].numTies) / hands;
+			players[i].equityPercentage = (wins[i] + ties[i]) / (hands + 1e-9);
+		}
+	}
+
+	std::vector<PlayerResults> Evaluate(std::vector<std::string> hands, std::string boardStr, std::string deadStr,
+		double maxSeconds) {
+		assert(hands.size() > 1);
+		assert(boardStr.length() <= 5 * 2);
+
+		std::vector<PlayerResults> players = CreatePlayers(hands);
+
+		// Calculate winning / tying percentages
+		omp::EquityCalculator eq;
+
+		// Construct ranges
+		std::vector<omp::CardRange> ranges;
+		for (auto&& player : players) {
+			ranges.push_back(player.hand[0].to_string() + player.hand[1].to_string());
+		}
 
-					const unsigned int playerIndex = &player - &players[0];
+		std::vector<Card> dead = Card::GetCards(deadStr);
+		std::vector<Card> board = Card::GetCards(boardStr);
 
-					for (auto&& card : deckCards) {
-						std::vector<Card> boardWithOut(board);
-						boardWithOut.push_back(card);
-						auto outEvals = EvaluatePlayers(playerHands, boardWithOut);
+		auto boardMask = omp::CardRange::getCardMask(boardStr);
+		auto deadMask = omp::CardRange::getCardMask(deadStr);
 
-						const auto playerEval = outEvals[playerIndex];
+		omp::EquityCalculator::Results res;
+		if (eq.calculate(ranges, boardMask, deadMask, res, maxSeconds)) {
+			EvaluateShowdown(players, board);
+			FindImmediateOuts(players, board, dead);
 
-						//remove player eval
-						outEvals.erase(outEvals.begin() + playerIndex);
+			SetEquities(players, res.wins, res.ties, res.hands);
+		}
 
-						//if we are tied right now we need to win to improve
-						if (player.winStatus == WinStatus::Tied) {
-							if (IsWinning(outEvals, playerEval)) {
-								player.immediateOutsToWin.push_back(card);
+		return players;
+	}
 
-								continue;
-							}
-						}
+	EvaluationSession::EvaluationSession(std::vector<std::string> hands, std::string deadStr)
+		: hands(std::move(hands)), deadStr(std::move(deadStr)) {
+	}
 
-						// if we are behind right now we need to tie or win to improve
-						if (player.winStatus == WinStatus::Behind) {
-							if (IsWinning(outEvals, playerEval)) {
-								player.immediateOutsToWin.push_back(card);
-							}
-							else if (IsTie(outEvals, playerEval)) {
-								player.immediateOutsToTie.push_back(card);
-							}
-						}
+	std::vector<PlayerResults> EvaluationSession::Evaluate(std::string boardStr) {
+		assert(hands.size() > 1);
+		assert(boardStr.length() <= 5 * 2);
+
+		std::vector<Card> board = Card::GetCards(boardStr);
+		std::vector<Card> dead = Card::GetCards(deadStr);
+
+		// Cards that appear twice make the calculation impossible, Evaluate() reports that the same way as any other
+		uint64_t usedMask = omp::CardRange::getCardMask(boardStr) | omp::CardRange::getCardMask(deadStr);
+		size_t usedCount = board.size() + dead.size();
+		for (auto&& hand : hands) {
+			usedMask |= omp::CardRange::getCardMask(hand);
+			usedCount += hand.length() / 2;
+		}
+
+		if (board.size() < 3 || omp::bitCount(usedMask) != usedCount) {
+			return pokerlib::Evaluate(hands, boardStr, deadStr);
+		}
+
+		std::vector<Card> flop(board.begin(), board.begin() + 3);
+		if (GetCardMask(flop) != flopMask) {
+			DealRunouts(flop);
+		}
+
+		std::vector<PlayerResults> players = CreatePlayers(hands);
+		EvaluateShowdown(players, board);
+
+		// On the turn the outs are the rivers in the table where the player wins or ties
+		if (board.size() == 4) {
+			unsigned turn = Card::RankSuitToCardIndex(board[3].rank, board[3].suit);
+			for (unsigned river = 0; river < omp::CARD_COUNT; river++) {
+				unsigned winnerMask = winners[turn * omp::CARD_COUNT + river];
+				for (unsigned i = 0; i < players.size(); i++) {
+					if (players[i].winStatus == WinStatus::Ahead || !(winnerMask >> i & 1)) {
+						continue;
+					}
+
+					Card card = Card::FromRankSuit(river / 4, river % 4);
+					if (winnerMask == 1u << i) {
+						players[i].immediateOutsToWin.push_back(card);
+					}
+					else if (players[i].winStatus == WinStatus::Behind) {
+						players[i].immediateOutsToTie.push_back(card);
 					}
 				}
 			}
+		}
+		else {
+			FindImmediateOuts(players, board, dead);
+		}
 
-			eq.wait();
+		// Sum the runouts that complete the board
+		uint64_t wins[omp::MAX_PLAYERS] = {};
+		uint64_t ties[omp::MAX_PLAYERS] = {};
+		uint64_t runouts = 0;
 
-			auto res = eq.getResults();
+		auto addRunout = [&](unsigned turn, unsigned river) {
+			unsigned winnerMask = winners[turn * omp::CARD_COUNT + river];
+			if (!winnerMask) {
+				return;
+			}
 
-			for (size_t i = 0; i < players.size(); i++) {
-				players[i].numWins = res.wins[i];
-				players[i].numTies = res.ties[i];
+			uint64_t* counts = omp::bitCount(winnerMask) == 1 ? wins : ties;
+			for (unsigned i = 0; i < players.size(); i++) {
+				counts[i] += winnerMask >> i & 1;
+			}
+			runouts++;
+		};
 
-				players[i].winPercentage = float(players[i].numWins) / res.hands;
-				players[i].tiePercentage = float(players[i].numTies) / res.hands;
-				players[i].equityPercentage = res.equity[i];
+		if (board.size() == 3) {
+			for (unsigned turn = 0; turn < omp::CARD_COUNT; turn++) {
+				for (unsigned river = turn + 1; river < omp::CARD_COUNT; river++) {
+					addRunout(turn, river);
+				}
+			}
+		}
+		else {
+			unsigned turn = Card::RankSuitToCardIndex(board[3].rank, board[3].suit);
+			if (board.size() == 5) {
+				addRunout(turn, Card::RankSuitToCardIndex(board[4].rank, board[4].suit));
+			}
+			else {
+				for (unsigned river = 0; river < omp::CARD_COUNT; river++) {
+					addRunout(turn, river);
+				}
 			}
 		}
 
+		SetEquities(players, wins, ties, runouts);
+
 		return players;
 	}
-} // namespace pokerlib 
\ No newline at end of file
+
+	// Deals every turn and river after the flop once and stores the players that win each runout. Runouts with
+	// cards that aren't in the deck stay 0.
+	void EvaluationSession::DealRunouts(const std::vector<Card>& flop) {
+		omp::HandEvaluator ev;
+
+		flopMask = GetCardMask(flop);
+		uint64_t usedMask = flopMask | omp::CardRange::getCardMask(deadStr);
+
+		std::vector<omp::Hand> playerHands;
+		for (auto&& hand : hands) {
+			playerHands.push_back(Card::CreateHand(Card::CombineCards(flop, Card::GetCards(hand))));
+			usedMask |= omp::CardRange::getCardMask(hand);
+		}
+
+		winners.assign(omp::CARD_COUNT * omp::CARD_COUNT, 0);
+
+		for (unsigned turn = 0; turn < omp::CARD_COUNT; turn++) {
+			if (usedMask >> turn & 1) {
+				continue;
+			}
+
+			for (unsigned river = turn + 1; river < omp::CARD_COUNT; river++) {
+				if (usedMask >> river & 1) {
+					continue;
+				}
+
+				omp::Hand runout = omp::Hand(turn) + omp::Hand(river);
+				uint16_t bestEval = 0;
+				uint16_t winnerMask = 0;
+
+				for (size_t i = 0; i < playerHands.size(); i++) {
+					uint16_t eval = ev.evaluate(playerHands[i] + runout);
+					if (eval > bestEval) {
+						bestEval = eval;
+						winnerMask = 0;
+					}
+					if (eval == bestEval) {
+						winnerMask |= 1 << i;
+					}
+				}
+
+				winners[turn * omp::CARD_COUNT + river] = winners[river * omp::CARD_COUNT + turn] = winnerMask;
+			}
+		}
+	}
+} // namespace pokerlib
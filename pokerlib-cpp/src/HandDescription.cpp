@@ -10,12 +10,10 @@
 
 namespace pokerlib {
 
-	// Implementation of HandDescription methods
-	std::string HandDescription::to_string() {
-		if (eval == 0) {
-			return "";
-		}
+	// Evaluations of all categories fit below this, the best hand is a royal flush
+	static const unsigned DESCRIPTION_TABLE_SIZE = 10 * omp::HAND_CATEGORY_OFFSET;
 
+	static std::string CreateDescriptionString(unsigned category, unsigned highCard, unsigned lowCard) {
 		static std::vector<std::string> rankToString = { "two", "three", "four", "five", "six", "seven", "eight", "nine", "ten", "jack", "queen", "king", "ace" };
 		static std::vector<std::string> rankToStringPlural = { "twos", "threes", "fours", "fives", "sixes", "sevens", "eights", "nines", "tens", "jacks", "queens", "kings", "aces" };
 
@@ -54,12 +52,8 @@ namespace pokerlib {
 		return "";
 	}
 
-	HandDescription HandDescription::Invalid() {
-		return { 0, 0, 0 };
-	}
-
-	// Implementation of HandDescriptionProvider
-	HandDescription HandDescriptionProvider::GetDescription(uint16_t eval) {
+	// Calculates the high and low card of an evaluation
+	static HandDescription CalculateDescription(uint16_t eval) {
 		// determine category
 		uint8_t category = eval / omp::HAND_CATEGORY_OFFSET;
 
@@ -179,9 +173,64 @@ namespace pokerlib {
 			return { eval, highCard, 0 };
 		}
 
-		if (category == 0 || category > 9) {
+		return HandDescription::Invalid();
+	}
+
+	// High card (upper 4 bits) and low card of every evaluation, calculated once
+	static const std::vector<uint8_t>& GetDescriptionTable() {
+		static const std::vector<uint8_t> table = [] {
+			std::vector<uint8_t> cards(DESCRIPTION_TABLE_SIZE);
+			for (unsigned eval = omp::HAND_CATEGORY_OFFSET; eval < DESCRIPTION_TABLE_SIZE; eval++) {
+				HandDescription desc = CalculateDescription(eval);
+				cards[eval] = (desc.highCard << 4) | desc.lowCard;
+			}
+			return cards;
+		}();
+
+		return table;
+	}
+
+	// Interned description strings, indexed by category, high card and low card
+	static const std::vector<std::string>& GetDescriptionStrings() {
+		static const std::vector<std::string> strings = [] {
+			std::vector<std::string> result(16 * 16 * 16);
+			for (unsigned category = 1; category <= 9; category++) {
+				for (unsigned highCard = 0; highCard < omp::RANK_COUNT; highCard++) {
+					for (unsigned lowCard = 0; lowCard < omp::RANK_COUNT; lowCard++) {
+						result[(category << 8) | (highCard << 4) | lowCard] = CreateDescriptionString(category, highCard, lowCard);
+					}
+				}
+			}
+			return result;
+		}();
+
+		return strings;
+	}
+
+	// Implementation of HandDescription methods
+	const std::string& HandDescription::to_string() const {
+		static const std::string empty;
+
+		if (eval == 0) {
+			return empty;
+		}
+
+		return GetDescriptionStrings()[(category << 8) | (highCard << 4) | lowCard];
+	}
+
+	HandDescription HandDescription::Invalid() {
+		return { 0, 0, 0 };
+	}
+
+	// Implementation of HandDescriptionProvider
+	HandDescription HandDescriptionProvider::GetDescription(uint16_t eval) {
+		if (eval < omp::HAND_CATEGORY_OFFSET || eval >= DESCRIPTION_TABLE_SIZE) {
 			return HandDescription::Invalid();
 		}
+
+		uint8_t cards = GetDescriptionTable()[eval];
+
+		return { eval, (uint8_t)(cards >> 4), (uint8_t)(cards & 0xf) };
 	}
 
 	// validation implementation to ensure the math crazyness above is correct
@@ -97,6 +97,18 @@ describe('PokerLib', () => {
       
       expect(evaluation.description.category).toBe(HandCategory.Flush);
     });
+
+    it('should return the royal flush from eight suited cards', () => {
+      const bestHand = PokerLib.getBestHand('AhKh', 'QhJhTh9h8h7h');
+      expect(bestHand.map(card => card.string)).toEqual(['ah', 'kh', 'qh', 'jh', 'th']);
+    });
+
+    it('should return a repeated card only once', () => {
+      const bestHand = PokerLib.getBestHand('AhAh', 'KdQc2s3d');
+      const cardStrings = bestHand.map(card => card.string);
+      expect(cardStrings).toHaveLength(5);
+      expect(new Set(cardStrings).size).toBe(5);
+    });
   });
 
   describe('formatHandDescription', () => {